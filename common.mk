@@ -5,6 +5,11 @@ MINGW := $(shell $(CC) -dumpmachine 2>&1 | grep -v mingw)
 # Detect Mac OS compilers: these usually don't like ELF pie related flags ...
 APPLE := $(shell $(CC) -dumpmachine 2>&1 | grep -v apple)
 RISCV := $(shell $(CC) -dumpmachine 2>&1 | grep -E "riscv.*(none|unknown)")
+# Detect riscv64 targets, where the assembly ll_u256_mont kernels can be used
+RISCV64 := $(shell $(CC) -dumpmachine 2>&1 | grep -E "^riscv64")
+# Detect x86-64 ELF targets with the System V ABI (Linux, BSD), where the
+# BMI2/ADX ll_mont kernels can be used
+X86_64 := $(shell $(CC) -dumpmachine 2>&1 | grep -E "^(x86_64|amd64)-.*(linux|bsd)")
 ifneq ($(MINGW),)
 FPIC_CFLAG=-fPIC
 endif
@@ -61,6 +66,24 @@ LDFLAGS ?=
 
 ifeq ($(LIBECC_WITH_LL_U256_MONT),1)
 CFLAGS += -DWITH_LL_U256_MONT
+# On riscv64, the 384, 512 and 521-bit assembly kernels come along
+ifneq ($(RISCV64),)
+CFLAGS += -DWITH_LL_MONT_RISCV64
+endif
+endif
+
+# x86-64 BMI2/ADX Montgomery kernels, selected at runtime (see
+# src/nn/ll_mont_x86_64.h), ignored on other targets (including the
+# x86-64 Windows and Mac OS ones)
+ifeq ($(LIBECC_WITH_LL_MONT_X86_64),1)
+ifneq ($(X86_64),)
+CFLAGS += -DWITH_LL_MONT_X86_64
+endif
+endif
+
+# Fixed limb count field backend for the enabled curves (see src/fp/fp_fixed.h)
+ifeq ($(LIBECC_WITH_FIXED_LIMBS),1)
+CFLAGS += -DWITH_FIXED_LIMBS
 endif
 
 # Default AR and RANLIB if not overriden by user
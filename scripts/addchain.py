@@ -0,0 +1,271 @@
+#/*
+# *  Copyright (C) 2017 - This file is part of libecc project
+# *
+# *  Authors:
+# *      Ryad BENADJILA <ryadbenadjila@gmail.com>
+# *      Arnaud EBALARD <arnaud.ebalard@ssi.gouv.fr>
+# *      Jean-Pierre FLORI <jean-pierre.flori@ssi.gouv.fr>
+# *
+# *  Contributors:
+# *      Nicolas VIVET <nicolas.vivet@ssi.gouv.fr>
+# *      Karim KHALFALLAH <karim.khalfallah@ssi.gouv.fr>
+# *
+# *  This software is licensed under a dual BSD and GPL v2 license.
+# *  See LICENSE file at the root folder of the project.
+# */
+#! /usr/bin/env python
+#
+# Addition chains for the fixed exponents of a curve: p - 2 (inversion in
+# Fp), (p + 1) / 4 (square root in Fp when p = 3 mod 4) and q - 2
+# (inversion modulo the order). They are used by expand_libecc.py when
+# generating the parameters of a user defined curve, and this script can
+# be run on the headers of src/curves/known to (re)generate their chains:
+#
+#   python scripts/addchain.py src/curves/known/ec_params_*.h
+#
+# A chain is a program run by nn_pow_redc1_chain() on registers t[0..15],
+# t[0] holding the input x. Each instruction is three bytes:
+#
+#   (dst << 4) | src, nsqr, mul:  t[dst] = t[src]^(2^nsqr) * t[mul]
+#
+# where mul = 0xff means no multiplication. The result is the destination
+# of the last instruction.
+#
+# The chain is built from a decomposition of the exponent (from its most
+# significant bit) into long runs of ones, cut in runs of 2^j ones whose
+# powers x^(2^(2^j) - 1) are obtained by repeated doubling, and sliding
+# windows of odd values of at most w bits. The window width and the
+# minimal length of a run are chosen to minimize the cost of the chain, a
+# squaring being counted as 0.8 multiplication.
+import sys, re
+
+CHAIN_MAX_REGS = 16
+CHAIN_NO_MUL = 0xff
+SQR_COST = 0.8
+
+class Chain(object):
+    def __init__(self):
+        self.ops = []
+        # Map exponent value -> register holding x^value
+        self.regs = { 1 : 0 }
+        self.nregs = 1
+    def new_reg(self, value):
+        if self.nregs >= CHAIN_MAX_REGS:
+            raise ValueError("too many registers")
+        self.regs[value] = self.nregs
+        self.nregs += 1
+        return self.regs[value]
+    def op(self, dst, src, nsqr, mul):
+        # Split long squaring sequences
+        while nsqr > 255:
+            self.ops.append((dst, src, 255, CHAIN_NO_MUL))
+            src = dst
+            nsqr -= 255
+        self.ops.append((dst, src, nsqr, mul))
+    def cost(self):
+        c = 0
+        for (dst, src, nsqr, mul) in self.ops:
+            c += SQR_COST * nsqr
+            if mul != CHAIN_NO_MUL:
+                c += 1
+        return c
+    def to_bytes(self):
+        out = []
+        for (dst, src, nsqr, mul) in self.ops:
+            out += [ (dst << 4) | src, nsqr, mul ]
+        return out
+    def run(self, x, m):
+        # Python model of nn_pow_redc1_chain(), to check the chain
+        t = [ 0 ] * CHAIN_MAX_REGS
+        t[0] = x % m
+        dst = 0
+        for (dst, src, nsqr, mul) in self.ops:
+            v = pow(t[src], 2**nsqr, m)
+            if mul != CHAIN_NO_MUL:
+                v = (v * t[mul]) % m
+            t[dst] = v
+        return t[dst]
+
+def get_ones_reg(chain, j):
+    """
+    Register holding x^(2^(2^j) - 1), i.e. a run of 2^j ones:
+    x^(2^(2a) - 1) = (x^(2^a - 1))^(2^a) * x^(2^a - 1)
+    """
+    value = (1 << (1 << j)) - 1
+    if value in chain.regs:
+        return chain.regs[value]
+    prev = get_ones_reg(chain, j - 1)
+    dst = chain.new_reg(value)
+    chain.op(dst, prev, 1 << (j - 1), prev)
+    return dst
+
+def get_odd_reg(chain, value):
+    """
+    Register holding x^value for an odd value, the odd powers being
+    computed incrementally from x^2.
+    """
+    if value in chain.regs:
+        return chain.regs[value]
+    if 2 not in chain.regs:
+        x2 = chain.new_reg(2)
+        chain.op(x2, 0, 1, CHAIN_NO_MUL)
+    prev = get_odd_reg(chain, value - 2)
+    dst = chain.new_reg(value)
+    chain.op(dst, prev, 0, chain.regs[2])
+    return dst
+
+def decompose(e, w, run_min, jmax):
+    """
+    Split e in (kind, value, position) segments from the most significant
+    bit: runs of at least run_min ones, cut in runs of 2^j ones (kind
+    "ones", value j <= jmax), and odd windows of at most w bits (kind
+    "odd").
+    """
+    segs = []
+    i = e.bit_length() - 1
+    while i >= 0:
+        if (e >> i) & 1 == 0:
+            i -= 1
+            continue
+        # Length of the run of ones starting at bit i
+        L = 0
+        while (i - L >= 0) and ((e >> (i - L)) & 1):
+            L += 1
+        if L >= run_min:
+            while L > 0:
+                j = min(L.bit_length() - 1, jmax)
+                segs.append(("ones", j, i - (1 << j) + 1))
+                i -= (1 << j)
+                L -= (1 << j)
+            continue
+        # Odd window of at most w bits
+        j = max(i - w + 1, 0)
+        while (e >> j) & 1 == 0:
+            j += 1
+        segs.append(("odd", (e >> j) & ((1 << (i - j + 1)) - 1), j))
+        i = j - 1
+    return segs
+
+def build_chain(e, w, run_min, jmax):
+    chain = Chain()
+    segs = decompose(e, w, run_min, jmax)
+    # Precompute the table
+    regs = []
+    for (kind, v, pos) in segs:
+        if kind == "ones":
+            regs.append(get_ones_reg(chain, v))
+        else:
+            regs.append(get_odd_reg(chain, v))
+    # Main loop: acc = acc^(2^(distance to the previous segment)) * x^value
+    acc = None
+    src = regs[0]
+    for k in range(1, len(segs)):
+        if acc == None:
+            acc = chain.new_reg(-1)
+        chain.op(acc, src, segs[k - 1][2] - segs[k][2], regs[k])
+        src = acc
+    # Trailing zeros (and make sure the result is the last destination)
+    tz = segs[-1][2]
+    if (acc == None) or (tz > 0):
+        if acc == None:
+            acc = chain.new_reg(-1)
+        chain.op(acc, src, tz, CHAIN_NO_MUL)
+    return chain
+
+def addchain(e, m=None):
+    """
+    Return the cheapest chain found for the exponent e (checked modulo m
+    when given).
+    """
+    best = None
+    for w in range(1, 6):
+        for run_min in list(range(2, 4 * w + 2)) + [ e.bit_length() + 1 ]:
+            for jmax in range(1, 10):
+                try:
+                    chain = build_chain(e, w, run_min, jmax)
+                except ValueError:
+                    continue
+                if (best == None) or (chain.cost() < best.cost()):
+                    best = chain
+    if m != None:
+        for x in [ 2, 3, 0x1234567, m - 2 ]:
+            if best.run(x, m) != pow(x, e, m):
+                raise Exception("Bad addition chain")
+    return best
+
+def curve_chains(prime, order):
+    """
+    Return the list of (suffix, exponent, modulus, comment) of the chains
+    to generate for a curve. The square root one is only given when
+    p = 3 mod 4.
+    """
+    out = [ ("p_inv", prime - 2, prime, "p - 2") ]
+    if prime % 4 == 3:
+        out.append(("p_sqrt", (prime + 1) // 4, prime, "(p + 1) / 4"))
+    out.append(("q_inv", order - 2, order, "q - 2"))
+    return out
+
+def chain_to_C_array(chain):
+    b = chain.to_bytes()
+    out = "{\n"
+    for i in range(0, len(b), 3):
+        out += "\t0x%02x, 0x%02x, 0x%02x,\n" % (b[i], b[i + 1], b[i + 2])
+    out += "};\n"
+    return out
+
+def export_curve_chains(curvename, prime, order):
+    """
+    C definitions of the chains of a curve, to be put before its
+    ec_str_params structure.
+    """
+    out = ""
+    for (suffix, e, m, comment) in curve_chains(prime, order):
+        chain = addchain(e, m)
+        nsqr = sum([ op[2] for op in chain.ops ])
+        nmul = len([ op for op in chain.ops if op[3] != CHAIN_NO_MUL ])
+        out += "/* x^(" + comment + "): " + str(nsqr) + " squarings and " + str(nmul) + " multiplications */\n"
+        out += "static const u8 " + curvename + "_" + suffix + "[] = " + chain_to_C_array(chain)
+        out += "TO_EC_CHAIN_PARAM(" + curvename + "_" + suffix + ");\n\n"
+    return out
+
+def export_curve_chains_struct(curvename, prime):
+    out = "\t.p_inv_chain = &" + curvename + "_p_inv_chain_param,\n"
+    if prime % 4 == 3:
+        out += "\t.p_sqrt_chain = &" + curvename + "_p_sqrt_chain_param,\n"
+    out += "\t.q_inv_chain = &" + curvename + "_q_inv_chain_param,\n"
+    return out
+
+def parse_header_int(header, curvename, intname):
+    m = re.search(r"static const u8 " + curvename + "_" + intname + r"\[\] = \{([^}]*)\}", header)
+    if m == None:
+        raise Exception("Cannot find " + curvename + "_" + intname)
+    return int("".join([ b.strip()[2:] for b in m.group(1).split(",") if b.strip() != "" ]), 16)
+
+def update_header(fname):
+    """
+    (Re)generate the chains of a curve parameters header
+    """
+    with open(fname) as f:
+        header = f.read()
+    m = re.search(r"static const ec_str_params (\w+)_str_params = \{", header)
+    if m == None:
+        # Not a curve parameters header (e.g. ec_params_external.h)
+        return
+    curvename = m.group(1)
+    prime = parse_header_int(header, curvename, "p")
+    order = parse_header_int(header, curvename, "order")
+    # Remove the chains of a previous run
+    header = re.sub(r"/\* x\^\([^\n]*\*/\nstatic const u8 \w+\[\] = \{[^}]*\};\nTO_EC_CHAIN_PARAM\(\w+\);\n\n", "", header)
+    header = re.sub(r"\t\.\w+_chain = &\w+_chain_param,\n", "", header)
+    # Add the new ones
+    header = header.replace(m.group(0), export_curve_chains(curvename, prime, order) + m.group(0))
+    header = re.sub(r"(\t\.name = &" + curvename + r"_name_str_param,\n)", r"\1" + export_curve_chains_struct(curvename, prime), header)
+    with open(fname, "w") as f:
+        f.write(header)
+
+if __name__ == "__main__":
+    if len(sys.argv) < 2:
+        print("Usage: " + sys.argv[0] + " ec_params_header.h [...]")
+        sys.exit(1)
+    for fname in sys.argv[1:]:
+        update_header(fname)
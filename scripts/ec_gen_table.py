@@ -0,0 +1,213 @@
+#/*
+# *  Copyright (C) 2017 - This file is part of libecc project
+# *
+# *  Authors:
+# *      Ryad BENADJILA <ryadbenadjila@gmail.com>
+# *      Arnaud EBALARD <arnaud.ebalard@ssi.gouv.fr>
+# *      Jean-Pierre FLORI <jean-pierre.flori@ssi.gouv.fr>
+# *
+# *  Contributors:
+# *      Nicolas VIVET <nicolas.vivet@ssi.gouv.fr>
+# *      Karim KHALFALLAH <karim.khalfallah@ssi.gouv.fr>
+# *
+# *  This software is licensed under a dual BSD and GPL v2 license.
+# *  See LICENSE file at the root folder of the project.
+# */
+#! /usr/bin/env python
+#
+# Precomputed tables of multiples of the generator of a curve. They are
+# used by expand_libecc.py when generating the parameters of a user
+# defined curve, and this script can be run on the headers of
+# src/curves/known to (re)generate their tables:
+#
+#   python scripts/ec_gen_table.py src/curves/known/ec_params_*.h
+#
+# The wNAF table holds the odd multiples G, 3G, ..., (2^(w - 1) - 1)G
+# used by prj_pt_ec_mult_wnaf() for the generator half of u * G + v * Y,
+# with a wider window than the one of the points only known at runtime.
+# Each point is given by its affine coordinates x and y in Montgomery
+# representation (i.e. multiplied by r = 2^(WORD_BITS * n) mod p, n being
+# the number of words of p), as little endian arrays of words: this is
+# what the fp layer works on, so that the points are used without any
+# conversion. As r depends on the size of the words, there is a table
+# for each word size.
+#
+# The comb table is the one of the constant time fixed base multiplication
+# of prj_pt_mul_monty() (key generation and signatures). With w teeth and
+# d = ceil(bitlen(q) / w), the odd scalars are recoded with digits +1 and
+# -1 on w * d bits, and the 2^(w - 1) points of the table are the
+# (1 + e_1 2^d + e_2 2^(2d) + ... + e_(w - 1) 2^((w - 1)d))G, e_t being
+# +1 when bit t - 1 of their index is set and -1 otherwise.
+import sys, re
+
+# Window of the wNAF of the scalar multiplying the generator
+GEN_WNAF_WINDOW = 7
+# Number of teeth of the signed comb of the generator
+GEN_COMB_TEETH = 6
+
+def modinv(x, p):
+    return pow(x, p - 2, p)
+
+def aff_add(P, Q, p, a):
+    """
+    Sum of the affine points P and Q (None being the point at infinity)
+    """
+    if P == None:
+        return Q
+    if Q == None:
+        return P
+    (x1, y1) = P
+    (x2, y2) = Q
+    if x1 == x2:
+        if (y1 + y2) % p == 0:
+            return None
+        l = ((3 * x1 * x1 + a) * modinv(2 * y1, p)) % p
+    else:
+        l = ((y2 - y1) * modinv(x2 - x1, p)) % p
+    x3 = (l * l - x1 - x2) % p
+    y3 = (l * (x1 - x3) - y1) % p
+    return (x3, y3)
+
+def gen_odd_multiples(prime, a, b, gx, gy, window):
+    """
+    G, 3G, ..., (2^(window - 1) - 1)G, checking that they are on the curve
+    """
+    G = (gx % prime, gy % prime)
+    G2 = aff_add(G, G, prime, a)
+    out = [ G ]
+    for i in range(1, 1 << (window - 2)):
+        out.append(aff_add(out[-1], G2, prime, a))
+    for P in out:
+        if (P == None) or ((P[1] * P[1] - (P[0] * P[0] * P[0] + a * P[0] + b)) % prime != 0):
+            raise ValueError("bad multiple of the generator")
+    return out
+
+def gen_comb_points(prime, a, b, gx, gy, order, teeth):
+    """
+    Points of the signed comb with the given number of teeth, checking
+    that they are on the curve
+    """
+    d = (order.bit_length() + teeth - 1) // teeth
+    # The 2^(t * d)G
+    B = [ (gx % prime, gy % prime) ]
+    for t in range(1, teeth):
+        P = B[-1]
+        for i in range(d):
+            P = aff_add(P, P, prime, a)
+        B.append(P)
+    out = []
+    for v in range(1 << (teeth - 1)):
+        P = B[0]
+        for t in range(1, teeth):
+            (x, y) = B[t]
+            P = aff_add(P, (x, y if (v >> (t - 1)) & 1 else (prime - y) % prime), prime, a)
+        out.append(P)
+    for P in out:
+        if (P == None) or ((P[1] * P[1] - (P[0] * P[0] * P[0] + a * P[0] + b)) % prime != 0):
+            raise ValueError("bad point of the comb of the generator")
+    return out
+
+def words_of(x, wbits, wlen):
+    return [ (x >> (wbits * i)) & ((1 << wbits) - 1) for i in range(wlen) ]
+
+def export_words(name, points, labels, prime, wbits):
+    """
+    C array of the points for words of wbits bits, each one preceded by its
+    label as a comment
+    """
+    wlen = (prime.bit_length() + wbits - 1) // wbits
+    r = (1 << (wbits * wlen)) % prime
+    digits = wbits // 4
+    per_line = { 64 : 2, 32 : 4, 16 : 6 }[wbits]
+    out = "static const word_t " + name + "[] = {\n"
+    for (k, (x, y)) in enumerate(points):
+        out += "\t/* " + labels[k] + " */\n"
+        words = words_of((x * r) % prime, wbits, wlen) + words_of((y * r) % prime, wbits, wlen)
+        for i in range(0, len(words), per_line):
+            line = [ "WORD(0x%0*x)" % (digits, w) for w in words[i:i + per_line] ]
+            out += "\t" + ", ".join(line) + ",\n"
+    out += "};\n"
+    return out
+
+def export_table(name, points, labels, prime, w):
+    out = "#if (WORD_BYTES == 8)     /* 64-bit words */\n"
+    out += export_words(name, points, labels, prime, 64)
+    out += "#elif (WORD_BYTES == 4)   /* 32-bit words */\n"
+    out += export_words(name, points, labels, prime, 32)
+    out += "#elif (WORD_BYTES == 2)   /* 16-bit words */\n"
+    out += export_words(name, points, labels, prime, 16)
+    out += "#else                     /* unknown word size */\n"
+    out += "#error \"Unsupported word size\"\n"
+    out += "#endif\n"
+    out += "TO_EC_GEN_TABLE_PARAM(" + name + ", " + str(w) + ");\n\n"
+    return out
+
+def export_gen_tables(curvename, prime, a, b, gx, gy, order):
+    """
+    C definitions of the generator tables of a curve, to be put before its
+    ec_str_params structure.
+    """
+    w = GEN_WNAF_WINDOW
+    points = gen_odd_multiples(prime, a, b, gx, gy, w)
+    labels = [ ("" if k == 0 else str(2 * k + 1)) + "G" for k in range(len(points)) ]
+    out = "/*\n"
+    out += " * Odd multiples G, 3G, ..., " + str((1 << (w - 1)) - 1) + "G of the generator for the wNAF\n"
+    out += " * multiplications (window " + str(w) + "), affine x and y in Montgomery representation\n"
+    out += " */\n"
+    out += export_table(curvename + "_gen_wnaf", points, labels, prime, w)
+    w = GEN_COMB_TEETH
+    d = (order.bit_length() + w - 1) // w
+    points = gen_comb_points(prime, a, b, gx, gy, order, w)
+    labels = [ "T[" + str(k) + "]" for k in range(len(points)) ]
+    out += "/*\n"
+    out += " * Signed comb of the generator for the fixed base multiplications (" + str(w) + "\n"
+    out += " * teeth, spacing " + str(d) + "), affine x and y in Montgomery representation\n"
+    out += " */\n"
+    out += export_table(curvename + "_gen_comb", points, labels, prime, w)
+    return out
+
+def export_gen_tables_struct(curvename):
+    out = "\t.gen_wnaf_table = &" + curvename + "_gen_wnaf_table_param,\n"
+    out += "\t.gen_comb_table = &" + curvename + "_gen_comb_table_param,\n"
+    return out
+
+def parse_header_int(header, curvename, intname):
+    m = re.search(r"static const u8 " + curvename + "_" + intname + r"\[\] = \{([^}]*)\}", header)
+    if m == None:
+        raise Exception("Cannot find " + curvename + "_" + intname)
+    return int("".join([ b.strip()[2:] for b in m.group(1).split(",") if b.strip() != "" ]), 16)
+
+def update_header(fname):
+    """
+    (Re)generate the generator tables of a curve parameters header
+    """
+    with open(fname) as f:
+        header = f.read()
+    m = re.search(r"static const ec_str_params (\w+)_str_params = \{", header)
+    if m == None:
+        # Not a curve parameters header (e.g. ec_params_external.h)
+        return
+    curvename = m.group(1)
+    prime = parse_header_int(header, curvename, "p")
+    a = parse_header_int(header, curvename, "a")
+    b = parse_header_int(header, curvename, "b")
+    gx = parse_header_int(header, curvename, "gx")
+    gy = parse_header_int(header, curvename, "gy")
+    order = parse_header_int(header, curvename, "order")
+    # Remove the tables of a previous run
+    header = re.sub(r"/\*\n \* (Odd multiples G,|Signed comb of the generator) .*?\nTO_EC_GEN_TABLE_PARAM\(\w+, \d+\);\n\n", "", header, flags=re.S)
+    header = re.sub(r"\t\.gen_\w+_table = &\w+_table_param,\n", "", header)
+    # Add the new ones, at the end of the parameters
+    header = header.replace(m.group(0), export_gen_tables(curvename, prime, a, b, gx, gy, order) + m.group(0))
+    sm = re.search(r"static const ec_str_params " + curvename + r"_str_params = \{.*?\n\};\n", header, flags=re.S)
+    struct = sm.group(0)
+    header = header.replace(struct, struct[:-len("};\n")] + export_gen_tables_struct(curvename) + "};\n")
+    with open(fname, "w") as f:
+        f.write(header)
+
+if __name__ == "__main__":
+    if len(sys.argv) < 2:
+        print("Usage: " + sys.argv[0] + " ec_params_header.h [...]")
+        sys.exit(1)
+    for fname in sys.argv[1:]:
+        update_header(fname)
@@ -22,6 +22,11 @@ import random, sys, re, math, os, getopt, glob, copy, hashlib, binascii, string,
 # for SHA-3 functions for now
 import sha3
 
+# Addition chains for inversion and square root with the curve constants
+import addchain
+# Precomputed multiples of the generator
+import ec_gen_table
+
 # Handle Python 2/3 issues
 def is_python_2():
     if sys.version_info[0] < 3:
@@ -59,6 +64,20 @@ def modinv(a, m):
     else:
         return x % m
 
+# Largest limb count instantiated by the fixed limbs field backend
+# (src/fp/fp_fixed.c)
+FP_FIXED_MAX_WLEN = 17
+
+def fp_fixed_wlen_used(pbitlen, wbits):
+    """
+    Definition telling the fixed limbs field backend the limb count of p
+    for words of wbits bits, nothing when it is above the ones it supports
+    """
+    wlen = (pbitlen + wbits - 1) // wbits
+    if wlen > FP_FIXED_MAX_WLEN:
+        return "/* More than "+str(FP_FIXED_MAX_WLEN)+" limbs: generic field code */\n"
+    return "#define FP_FIXED_WLEN_"+str(wlen)+"_USED\n"
+
 def compute_monty_coef(prime, pbitlen, wlen):
     """
     Compute montgomery coeff r, r^2 and mpinv. pbitlen is the size
@@ -1420,6 +1439,9 @@ def curve_params(name, prime, pbitlen, a, b, gx, gy, order, cofactor, oid):
         oid = ""
     ec_params_string += export_curve_string(name, "oid", oid); 
 
+    ec_params_string += addchain.export_curve_chains(name, prime, order)
+    ec_params_string += ec_gen_table.export_gen_tables(name, prime, a, b, gx, gy, order)
+
     ec_params_string += "static const ec_str_params "+name+"_str_params = {\n"+\
     export_curve_struct(name, "p", "p") +\
     export_curve_struct(name, "p_bitlen", "p_bitlen") +\
@@ -1439,7 +1461,9 @@ def curve_params(name, prime, pbitlen, a, b, gx, gy, order, cofactor, oid):
     export_curve_struct(name, "order_bitlen", "order_bitlen") +\
     export_curve_struct(name, "cofactor", "cofactor") +\
     export_curve_struct(name, "oid", "oid") +\
-    export_curve_struct(name, "name", "name")
+    export_curve_struct(name, "name", "name") +\
+    addchain.export_curve_chains_struct(name, prime) +\
+    ec_gen_table.export_gen_tables_struct(name)
     ec_params_string += "};\n\n"
 
     ec_params_string += "/*\n"+\
@@ -1460,6 +1484,17 @@ def curve_params(name, prime, pbitlen, a, b, gx, gy, order, cofactor, oid):
     "#define CURVES_MAX_Q_BIT_LEN CURVE_"+name.upper()+"_Q_BITLEN\n"+\
     "#endif\n\n"
 
+    ec_params_string += "/*\n"+\
+    " * Limb count of p for the fixed limbs field backend (see fp_fixed.h)\n"+\
+    " */\n"+\
+    "#if (WORD_BYTES == 8)     /* 64-bit words */\n"+\
+    fp_fixed_wlen_used(pbitlen, 64)+\
+    "#elif (WORD_BYTES == 4)   /* 32-bit words */\n"+\
+    fp_fixed_wlen_used(pbitlen, 32)+\
+    "#elif (WORD_BYTES == 2)   /* 16-bit words */\n"+\
+    fp_fixed_wlen_used(pbitlen, 16)+\
+    "#endif\n\n"
+
     ec_params_string += "/*\n"+\
     " * Compute and adapt max name and oid length\n"+\
     " */\n"+\
@@ -0,0 +1,1147 @@
+#/*
+# *  Copyright (C) 2017 - This file is part of libecc project
+# *
+# *  Authors:
+# *      Ryad BENADJILA <ryadbenadjila@gmail.com>
+# *      Arnaud EBALARD <arnaud.ebalard@ssi.gouv.fr>
+# *      Jean-Pierre FLORI <jean-pierre.flori@ssi.gouv.fr>
+# *
+# *  Contributors:
+# *      Nicolas VIVET <nicolas.vivet@ssi.gouv.fr>
+# *      Karim KHALFALLAH <karim.khalfallah@ssi.gouv.fr>
+# *
+# *  This software is licensed under a dual BSD and GPL v2 license.
+# *  See LICENSE file at the root folder of the project.
+# */
+#! /usr/bin/env python
+#
+# Generator of the rv64 Montgomery kernels: src/nn/ll_mont-riscv64.S for
+# 6, 8 and 9 limbs moduli (see src/nn/ll_mont_riscv64.h), and
+# src/nn/ll_u256_mont_fused-riscv64.S, a drop-in replacement of the 4 limbs
+# ll_u256_mont-riscv64.S kernels (see src/nn/ll_u256_mont.h):
+#
+#   python scripts/ll_mont_riscv64.py > src/nn/ll_mont-riscv64.S
+#   python scripts/ll_mont_riscv64.py u256 > src/nn/ll_u256_mont_fused-riscv64.S
+#
+# as well as src/nn/ll_u256_mod-riscv64.S, the 4 limbs modular addition,
+# subtraction, doubling, tripling and negation of ll_u256_mont.h:
+#
+#   python scripts/ll_mont_riscv64.py u256mod > src/nn/ll_u256_mod-riscv64.S
+#
+# and src/nn/ll_u256_pt-riscv64.S, the whole Jacobian point doubling and
+# mixed addition formulas of ll_u256_pt.h built from the same pieces:
+#
+#   python scripts/ll_mont_riscv64.py u256pt > src/nn/ll_u256_pt-riscv64.S
+#
+# Each multiplication is a fully unrolled CIOS on n limbs, with the limbs
+# of a and the n + 2 words accumulator t in registers (as well as the
+# limbs of N and k0 when there are enough registers left). Since t is
+# shifted by one word after each reduction row, the registers are renamed
+# instead of moved. The low word of t + m * N being zero by construction,
+# its carry is (t[0] != 0) and its product is not computed. The squaring
+# is a SOS one (cross products computed once, doubled and added to the
+# diagonal products, followed by n reduction rounds), with the 2n words
+# square in registers when it fits along with a (up to 6 limbs), and its
+# top words spilled on the stack otherwise. The final subtraction of N is
+# done with masks (no branch).
+#
+# The instructions are scheduled for the macro-op fusion of CKB-VM (see
+# scripts/rv_mont_count.py): each mulhu is immediately followed by the
+# mul of the same operands, its destination being none of them, and each
+# carry (resp. borrow) is computed by a sltu right after the add (resp.
+# sub) it comes from.
+import sys
+
+# (name, limbs)
+KERNELS = [ ("ll_u384_mont", 6), ("ll_u512_mont", 8), ("ll_u521_mont", 9) ]
+KERNELS_U256 = [ ("ll_u256_mont", 4) ]
+
+# Temporaries: multiplier (b[i] or m), product low/high, scratch, carry
+BI, LO, HI, TMP, C = "t0", "t1", "t2", "t3", "t4"
+# Registers for a, t, N and k0, in allocation order (the callee saved
+# ones being saved on the stack when used)
+POOL = [ "t5", "t6", "a0", "a1", "a4", "a5", "a6", "a7",
+         "s0", "s1", "s2", "s3", "s4", "s5", "s6", "s7", "s8", "s9",
+         "s10", "s11" ]
+SAVED = [ "s0", "s1", "s2", "s3", "s4", "s5", "s6", "s7", "s8", "s9",
+          "s10", "s11" ]
+
+LICENSE = """/*
+ *  Copyright (C) 2017 - This file is part of libecc project
+ *
+ *  Authors:
+ *      Ryad BENADJILA <ryadbenadjila@gmail.com>
+ *      Arnaud EBALARD <arnaud.ebalard@ssi.gouv.fr>
+ *      Jean-Pierre FLORI <jean-pierre.flori@ssi.gouv.fr>
+ *
+ *  Contributors:
+ *      Nicolas VIVET <nicolas.vivet@ssi.gouv.fr>
+ *      Karim KHALFALLAH <karim.khalfallah@ssi.gouv.fr>
+ *
+ *  This software is licensed under a dual BSD and GPL v2 license.
+ *  See LICENSE file at the root folder of the project.
+ */
+"""
+
+HEADER = LICENSE + """
+/*
+ * rv64 Montgomery kernels for 6, 8 and 9 limbs moduli, see
+ * ll_mont_riscv64.h. This file is generated by scripts/ll_mont_riscv64.py,
+ * do not edit.
+ */
+
+.text
+"""
+
+HEADER_U256 = LICENSE + """
+/*
+ * rv64 Montgomery kernels for 4 limbs moduli, see ll_u256_mont.h: same
+ * interface as ll_u256_mont-riscv64.S, with a constant time final
+ * subtraction and an instruction schedule suited to the macro-op fusion
+ * of CKB-VM. This file is generated by scripts/ll_mont_riscv64.py
+ * (with the u256 argument), do not edit.
+ */
+
+.text
+"""
+
+HEADER_U256_MOD = LICENSE + """
+/*
+ * rv64 modular addition, subtraction, doubling, tripling and negation for
+ * 4 limbs moduli, see ll_u256_mont.h. This file is generated by
+ * scripts/ll_mont_riscv64.py (with the u256mod argument), do not edit.
+ */
+
+.text
+"""
+
+HEADER_U256_PT = LICENSE + """
+/*
+ * rv64 Jacobian point doubling (a = -3) and mixed addition for 4 limbs
+ * moduli, see ll_u256_pt.h. This file is generated by
+ * scripts/ll_mont_riscv64.py (with the u256pt argument), do not edit.
+ */
+
+.text
+"""
+
+class Gen(object):
+    def __init__(self, n, n_a, n_t, n_extra, bd_reg, nd_reg, k0_reg_arg,
+                 with_n=True, n_spill=0):
+        self.n = n
+        self.out = []
+        self.shift = 0
+        # Arguments we keep as pointers are not in the pool
+        pool = [ r for r in POOL if r not in (bd_reg, nd_reg) ]
+        self.A = [ pool.pop(0) for _ in range(n_a) ]
+        self.T = [ pool.pop(0) for _ in range(n_t) ]
+        self.X = [ pool.pop(0) for _ in range(n_extra) ]
+        # k0 stays in its argument register when it is not in the pool
+        if k0_reg_arg not in POOL:
+            self.K0 = k0_reg_arg
+        if with_n and len(pool) >= n + 1:
+            self.N = [ pool.pop(0) for _ in range(n) ]
+        else:
+            self.N = None
+        if k0_reg_arg in POOL:
+            self.K0 = pool.pop(0) if len(pool) >= 1 else None
+        # Unused registers, for t - N when neither a nor N are in registers
+        if n_a != n and self.N is None and len(pool) >= n:
+            self.D = pool[:n]
+        else:
+            self.D = None
+        used = self.A + self.T + self.X + (self.N or []) + \
+               ([ self.K0 ] if self.K0 else []) + (self.D or [])
+        self.saved = [ r for r in SAVED if r in used ]
+        # Stack frame: rd, k0, n_spill words and the saved registers, 16
+        # bytes aligned
+        self.rd_off = 0
+        self.k0_off = 8
+        self.spill_off = 16
+        self.saved_off = 16 + 8 * n_spill
+        self.frame = (((self.saved_off + 8 * len(self.saved)) + 15) // 16) * 16
+        self.bd = bd_reg
+        self.bd_off = 0
+        # Whether the result is left in D (see final_sub())
+        self.keep = False
+        self.nd = nd_reg
+        self.k0_arg = k0_reg_arg
+
+    def o(self, s):
+        self.out.append("    " + s)
+
+    def t(self, j):
+        return self.T[(j + self.shift) % len(self.T)]
+
+    def prologue(self, name):
+        self.out.append(".globl  " + name)
+        self.out.append(".align  4")
+        self.out.append(name + ":")
+        self.out.append(".L" + name + ":")
+        self.o("addi sp, sp, -%d" % self.frame)
+        for i, r in enumerate(self.saved):
+            self.o("sd %s, %d(sp)" % (r, self.saved_off + 8 * i))
+        self.o("sd a0, %d(sp)" % self.rd_off)
+        if self.K0 != self.k0_arg:
+            self.o("sd %s, %d(sp)" % (self.k0_arg, self.k0_off))
+            if self.K0 is not None:
+                self.o("mv %s, %s" % (self.K0, self.k0_arg))
+        if self.N is not None:
+            for j in range(self.n):
+                self.o("ld %s, %d(%s)" % (self.N[j], 8 * j, self.nd))
+
+    def epilogue(self):
+        for i, r in enumerate(self.saved):
+            self.o("ld %s, %d(sp)" % (r, self.saved_off + 8 * i))
+        self.o("addi sp, sp, %d" % self.frame)
+        self.o("ret")
+
+    def load_a(self, a_reg, dst):
+        # Load the n limbs at a_reg in dst, a_reg itself last
+        last = None
+        for j in range(self.n):
+            if dst[j] == a_reg:
+                last = j
+                continue
+            self.o("ld %s, %d(%s)" % (dst[j], 8 * j, a_reg))
+        if last is not None:
+            self.o("ld %s, %d(%s)" % (dst[last], 8 * last, a_reg))
+
+    def nj(self, j):
+        # Register holding N[j] (loaded in TMP when N is not kept)
+        if self.N is not None:
+            return self.N[j]
+        self.o("ld %s, %d(%s)" % (TMP, 8 * j, self.nd))
+        return TMP
+
+    def m(self, tj):
+        # BI = m = tj * k0
+        if self.K0 is not None:
+            self.o("mul %s, %s, %s" % (BI, tj, self.K0))
+        else:
+            self.o("ld %s, %d(sp)" % (TMP, self.k0_off))
+            self.o("mul %s, %s, %s" % (BI, tj, TMP))
+
+    def wide(self, lo, hi, x, y):
+        # (hi, lo) = x * y, as a fusable mulhu/mul pair
+        self.o("mulhu %s, %s, %s" % (hi, x, y))
+        self.o("mul %s, %s, %s" % (lo, x, y))
+
+    def mac(self, tj, x, y):
+        # (c, tj) = tj + x * y + c
+        self.wide(LO, HI, x, y)
+        self.o("add %s, %s, %s" % (LO, LO, C))
+        self.o("sltu %s, %s, %s" % (TMP, LO, C))
+        self.o("add %s, %s, %s" % (HI, HI, TMP))
+        self.o("add %s, %s, %s" % (tj, tj, LO))
+        self.o("sltu %s, %s, %s" % (TMP, tj, LO))
+        self.o("add %s, %s, %s" % (C, HI, TMP))
+
+    def mac_first(self, tj, x, y):
+        # (c, tj) = tj + x * y
+        self.wide(LO, C, x, y)
+        self.o("add %s, %s, %s" % (tj, tj, LO))
+        self.o("sltu %s, %s, %s" % (TMP, tj, LO))
+        self.o("add %s, %s, %s" % (C, C, TMP))
+
+    def mul_set(self, tj, x, y):
+        # (c, tj) = x * y + c
+        self.wide(LO, HI, x, y)
+        self.o("add %s, %s, %s" % (tj, LO, C))
+        self.o("sltu %s, %s, %s" % (TMP, tj, C))
+        self.o("add %s, %s, %s" % (C, HI, TMP))
+
+    def mul_row_first(self):
+        n = self.n
+        self.o("# t = a * b[0]")
+        self.o("ld %s, %d(%s)" % (BI, self.bd_off, self.bd))
+        self.wide(self.t(0), C, self.A[0], BI)
+        for j in range(1, n):
+            self.mul_set(self.t(j), self.A[j], BI)
+        self.o("mv %s, %s" % (self.t(n), C))
+        self.o("li %s, 0" % self.t(n + 1))
+
+    def mul_row(self, i):
+        n = self.n
+        self.o("# t += a * b[%d]" % i)
+        self.o("ld %s, %d(%s)" % (BI, self.bd_off + 8 * i, self.bd))
+        self.mac_first(self.t(0), self.A[0], BI)
+        for j in range(1, n):
+            self.mac(self.t(j), self.A[j], BI)
+        self.o("add %s, %s, %s" % (self.t(n), self.t(n), C))
+        self.o("sltu %s, %s, %s" % (self.t(n + 1), self.t(n), C))
+
+    def red_row(self, top_zero=False):
+        # top_zero: t[n + 1] is known to be zero
+        n = self.n
+        self.o("# t = (t + m * N) / 2^64, m = t[0] * k0")
+        self.m(self.t(0))
+        # t[0] + low(m * N[0]) is zero: its carry is (t[0] != 0)
+        n0 = self.nj(0)
+        self.o("mulhu %s, %s, %s" % (C, BI, n0))
+        self.o("snez %s, %s" % (TMP, self.t(0)))
+        self.o("add %s, %s, %s" % (C, C, TMP))
+        for j in range(1, n):
+            self.mac(self.t(j), BI, self.nj(j))
+        self.o("add %s, %s, %s" % (self.t(n), self.t(n), C))
+        if top_zero:
+            self.o("sltu %s, %s, %s" % (self.t(n + 1), self.t(n), C))
+        else:
+            self.o("sltu %s, %s, %s" % (TMP, self.t(n), C))
+            self.o("add %s, %s, %s" % (self.t(n + 1), self.t(n + 1), TMP))
+        self.shift += 1
+
+    def dst(self):
+        # Base register and offset of rd
+        self.o("ld %s, %d(sp)" % (BI, self.rd_off))
+        return (BI, 0)
+
+    def final_sub(self, v, hi, spare):
+        # rd = v - N if (hi, v) >= N, v otherwise, hi being 0 or 1. t - N
+        # is computed in registers: the ones of a if dead, else the spare
+        # one and the ones of N (each N[j] being dead once t[j] - N[j] is
+        # computed), else the unused ones. Otherwise, it goes in rd.
+        n = self.n
+        if len(self.A) == n:
+            D = self.A
+        elif self.N is not None:
+            D = [ spare ] + self.N[1:]
+        else:
+            D = self.D
+        self.o("# rd = t - N if t >= N, t otherwise (constant time)")
+        rd = self.dst()
+        (rb, ro) = rd if rd is not None else (None, 0)
+        if D is not None:
+            nj = self.nj(0)
+            self.o("sub %s, %s, %s" % (D[0], v[0], nj))
+            self.o("sltu %s, %s, %s" % (C, v[0], nj))
+            for j in range(1, n):
+                nj = self.nj(j)
+                self.o("sub %s, %s, %s" % (LO, v[j], nj))
+                self.o("sltu %s, %s, %s" % (HI, v[j], nj))
+                self.o("sub %s, %s, %s" % (D[j], LO, C))
+                self.o("sltu %s, %s, %s" % (TMP, LO, C))
+                self.o("or %s, %s, %s" % (C, HI, TMP))
+            # Keep t when there is a borrow and no carry word
+            self.o("sltu %s, %s, %s" % (C, hi, C))
+            self.o("neg %s, %s" % (C, C))
+            for j in range(n):
+                self.o("xor %s, %s, %s" % (LO, v[j], D[j]))
+                self.o("and %s, %s, %s" % (LO, LO, C))
+                if self.keep:
+                    # The result stays in D, and is stored when rd is
+                    # not None
+                    self.o("xor %s, %s, %s" % (D[j], D[j], LO))
+                    if rb is not None:
+                        self.o("sd %s, %d(%s)" % (D[j], ro + 8 * j, rb))
+                    continue
+                self.o("xor %s, %s, %s" % (LO, D[j], LO))
+                self.o("sd %s, %d(%s)" % (LO, ro + 8 * j, rb))
+            return
+        # t - N in rd, using k0 (now dead) as a scratch register
+        X = self.K0
+        assert X is not None
+        nj = self.nj(0)
+        self.o("sub %s, %s, %s" % (LO, v[0], nj))
+        self.o("sltu %s, %s, %s" % (C, v[0], nj))
+        self.o("sd %s, %d(%s)" % (LO, ro, rb))
+        for j in range(1, n):
+            nj = self.nj(j)
+            self.o("sub %s, %s, %s" % (LO, v[j], nj))
+            self.o("sltu %s, %s, %s" % (HI, v[j], nj))
+            self.o("sub %s, %s, %s" % (X, LO, C))
+            self.o("sltu %s, %s, %s" % (TMP, LO, C))
+            self.o("or %s, %s, %s" % (C, HI, TMP))
+            self.o("sd %s, %d(%s)" % (X, ro + 8 * j, rb))
+        self.o("sltu %s, %s, %s" % (C, hi, C))
+        self.o("neg %s, %s" % (C, C))
+        for j in range(n):
+            self.o("ld %s, %d(%s)" % (LO, ro + 8 * j, rb))
+            self.o("xor %s, %s, %s" % (HI, LO, v[j]))
+            self.o("and %s, %s, %s" % (HI, HI, C))
+            self.o("xor %s, %s, %s" % (LO, LO, HI))
+            self.o("sd %s, %d(%s)" % (LO, ro + 8 * j, rb))
+
+    def sqr_body(self, t, top):
+        # SOS squaring of a (in A) in t[0 .. 2n - 1] and top, followed by
+        # the Montgomery reduction rounds: the result is left in t[n:] with
+        # its carry word in top
+        n = self.n
+        A = self.A
+        # Cross products a[i] * a[j], i < j, in t[1 .. 2n - 2]
+        self.o("# t = sum of a[i] * a[j] * 2^(64 * (i + j)), i < j")
+        self.wide(t[1], C, A[0], A[1])
+        for j in range(2, n):
+            self.mul_set(t[j], A[0], A[j])
+        self.o("mv %s, %s" % (t[n], C))
+        for i in range(1, n - 1):
+            self.mac_first(t[2 * i + 1], A[i], A[i + 1])
+            for j in range(i + 2, n):
+                self.mac(t[i + j], A[i], A[j])
+            self.o("mv %s, %s" % (t[i + n], C))
+        # Doubled
+        self.o("# t = 2 * t")
+        self.o("srli %s, %s, 63" % (t[2 * n - 1], t[2 * n - 2]))
+        for j in range(2 * n - 2, 1, -1):
+            self.o("slli %s, %s, 1" % (t[j], t[j]))
+            self.o("srli %s, %s, 63" % (TMP, t[j - 1]))
+            self.o("or %s, %s, %s" % (t[j], t[j], TMP))
+        self.o("slli %s, %s, 1" % (t[1], t[1]))
+        # Plus the diagonal products a[i]^2
+        self.o("# t += sum of a[i]^2 * 2^(128 * i)")
+        self.wide(t[0], HI, A[0], A[0])
+        self.o("add %s, %s, %s" % (t[1], t[1], HI))
+        self.o("sltu %s, %s, %s" % (C, t[1], HI))
+        for i in range(1, n):
+            self.wide(LO, HI, A[i], A[i])
+            self.o("add %s, %s, %s" % (t[2 * i], t[2 * i], C))
+            self.o("sltu %s, %s, %s" % (TMP, t[2 * i], C))
+            self.o("add %s, %s, %s" % (HI, HI, TMP))
+            self.o("add %s, %s, %s" % (t[2 * i], t[2 * i], LO))
+            self.o("sltu %s, %s, %s" % (TMP, t[2 * i], LO))
+            self.o("add %s, %s, %s" % (HI, HI, TMP))
+            self.o("add %s, %s, %s" % (t[2 * i + 1], t[2 * i + 1], HI))
+            if i < n - 1:
+                self.o("sltu %s, %s, %s" % (C, t[2 * i + 1], HI))
+        # a being dead, N is loaded in its registers when not already in
+        # registers
+        if self.N is None:
+            self.o("# N in the registers of a")
+            for j in range(n):
+                self.o("ld %s, %d(%s)" % (A[j], 8 * j, self.nd))
+            self.N = A
+            self.A = []
+        self.sqr_reduce(t, top)
+
+    def sqr_spill_body(self):
+        # Same as sqr_body() with 2n + 2 registers only: a (in A) and the
+        # free ones (in X). The cross products are accumulated in a window
+        # of n registers sliding along t, and doubled and added to the
+        # diagonal products two words at a time, as soon as these words
+        # are final. Only t[0 .. n] stays in registers, t[n + 1 .. 2n - 1]
+        # being spilled, and reloaded by the reduction rounds in the
+        # registers of the words they zero. Returns the registers of the
+        # result (left in t[n:]), of its carry word, and a spare one.
+        n = self.n
+        A = self.A
+        free = list(self.X)
+        t = [ None ] * (2 * n)
+        def spill(j):
+            return self.spill_off + 8 * (j - n - 1)
+        def pair(k, cy):
+            # t[2k, 2k + 1] = 2 * t[2k, 2k + 1] + a[k]^2 + cy, the top bit
+            # of t[2k - 1] being in cy. Returns the carry for the next
+            # pair (0, 1 or 2, the top bit of t[2k + 1] included).
+            (x, y) = (t[2 * k], t[2 * k + 1])
+            self.o("# t[%d, %d] = 2 * t[%d, %d] + a[%d]^2" % (2 * k, 2 * k + 1, 2 * k, 2 * k + 1, k))
+            if y is None:
+                y = t[2 * k + 1] = free.pop(0)
+                self.o("srli %s, %s, 63" % (y, x))
+            else:
+                self.o("srli %s, %s, 63" % (BI, y))
+                self.o("slli %s, %s, 1" % (y, y))
+                if x is not None:
+                    self.o("srli %s, %s, 63" % (TMP, x))
+                    self.o("or %s, %s, %s" % (y, y, TMP))
+            if x is None:
+                x = t[2 * k] = free.pop(0)
+                self.wide(x, HI, A[k], A[k])
+            else:
+                self.o("slli %s, %s, 1" % (x, x))
+                self.wide(LO, HI, A[k], A[k])
+                self.o("add %s, %s, %s" % (x, x, LO))
+                self.o("sltu %s, %s, %s" % (TMP, x, LO))
+                self.o("add %s, %s, %s" % (HI, HI, TMP))
+            free.append(A[k])
+            if cy is not None:
+                self.o("add %s, %s, %s" % (x, x, cy))
+                self.o("sltu %s, %s, %s" % (TMP, x, cy))
+                self.o("add %s, %s, %s" % (HI, HI, TMP))
+            self.o("add %s, %s, %s" % (y, y, HI))
+            if k < n - 1:
+                if cy is None:
+                    cy = free.pop(0)
+                self.o("sltu %s, %s, %s" % (TMP, y, HI))
+                self.o("add %s, %s, %s" % (cy, BI, TMP))
+            elif cy is not None:
+                free.append(cy)
+            for j in (2 * k, 2 * k + 1):
+                if j > n:
+                    self.o("sd %s, %d(sp)" % (t[j], spill(j)))
+                    free.append(t[j])
+                    t[j] = None
+            return cy
+        self.o("# t = sum of a[i] * a[j] * 2^(64 * (i + j)), i < j, "
+               "doubled, plus sum of a[i]^2 * 2^(128 * i)")
+        for j in range(1, n):
+            t[j] = free.pop(0)
+        self.wide(t[1], C, A[0], A[1])
+        for j in range(2, n):
+            self.mul_set(t[j], A[0], A[j])
+        t[n] = free.pop(0)
+        self.o("mv %s, %s" % (t[n], C))
+        cy = pair(0, None)
+        for i in range(1, n - 1):
+            self.mac_first(t[2 * i + 1], A[i], A[i + 1])
+            for j in range(i + 2, n):
+                self.mac(t[i + j], A[i], A[j])
+            t[i + n] = free.pop(0)
+            self.o("mv %s, %s" % (t[i + n], C))
+            cy = pair(i, cy)
+        pair(n - 1, cy)
+        # N in the free registers, and the carry word of the reduction
+        self.o("# N in registers")
+        self.N = [ free.pop(0) for _ in range(n) ]
+        for j in range(n):
+            self.o("ld %s, %d(%s)" % (self.N[j], 8 * j, self.nd))
+        self.A = []
+        top = free.pop(0)
+        self.sqr_reduce(t, top, spill)
+        return (t[n:], top, t[n - 1])
+
+    def sqr_reduce(self, t, top, spill=None):
+        # Montgomery reduction rounds: t[i + 1 .. i + n] += m * N / 2^64, the
+        # carry out of t[i + n] being kept in top for the next round. The
+        # spilled words of t are loaded, from their slot spill(j), in the
+        # register of the word zeroed by the previous round.
+        n = self.n
+        for i in range(n):
+            if t[i + n] is None:
+                t[i + n] = t[i - 1]
+                self.o("ld %s, %d(sp)" % (t[i + n], spill(i + n)))
+            self.o("# t += m * N * 2^(64 * %d), m = t[%d] * k0" % (i, i))
+            self.m(t[i])
+            n0 = self.nj(0)
+            self.o("mulhu %s, %s, %s" % (C, BI, n0))
+            self.o("snez %s, %s" % (TMP, t[i]))
+            self.o("add %s, %s, %s" % (C, C, TMP))
+            for j in range(1, n):
+                self.mac(t[i + j], BI, self.nj(j))
+            self.o("add %s, %s, %s" % (t[i + n], t[i + n], C))
+            if i == 0:
+                self.o("sltu %s, %s, %s" % (top, t[i + n], C))
+            else:
+                self.o("sltu %s, %s, %s" % (TMP, t[i + n], C))
+                self.o("add %s, %s, %s" % (t[i + n], t[i + n], top))
+                self.o("sltu %s, %s, %s" % (BI, t[i + n], top))
+                self.o("add %s, %s, %s" % (top, TMP, BI))
+
+    def result(self):
+        # Value, carry word and spare register after the last row
+        n = self.n
+        return [ self.t(j) for j in range(n) ], self.t(n), self.t(n + 1)
+
+def sqr_fits(n):
+    # a, the 2n words square and the carry word of the reduction
+    return (3 * n) + 1 <= len(POOL)
+
+def sqr_spill_fits(n):
+    # a, t[1 .. n] and the carry of the diagonal products, then N, the
+    # n + 1 words of t being reduced and their carry word (see
+    # sqr_spill_body())
+    return (2 * n) + 2 <= len(POOL)
+
+def gen_mul(name, n):
+    # void name_mul(u64 rd[n], const u64 ad[n], const u64 bd[n],
+    #               const u64 Nd[n], u64 k0)
+    g = Gen(n, n, n + 2, 0, "a2", "a3", "a4")
+    g.out.append("")
+    g.out.append("# void %s_mul(u64 rd[%d], const u64 ad[%d], const u64 bd[%d], const u64 Nd[%d], u64 k0)" % (name, n, n, n, n))
+    g.prologue(name + "_mul")
+    g.load_a("a1", g.A)
+    for i in range(n):
+        if i == 0:
+            g.mul_row_first()
+        else:
+            g.mul_row(i)
+        g.red_row()
+    g.final_sub(*g.result())
+    g.epilogue()
+    g.out.append(".size %s_mul, .-%s_mul" % (name, name))
+    return "\n".join(g.out) + "\n"
+
+def gen_sqr(name, n):
+    # void name_sqr(u64 rd[n], const u64 ad[n], const u64 Nd[n], u64 k0)
+    if sqr_fits(n):
+        g = Gen(n, n, 2 * n, 1, None, "a2", "a3", with_n=False)
+    else:
+        assert sqr_spill_fits(n)
+        g = Gen(n, n, 0, n + 2, None, "a2", "a3", with_n=False,
+                n_spill=n - 1)
+    g.out.append("")
+    g.out.append("# void %s_sqr(u64 rd[%d], const u64 ad[%d], const u64 Nd[%d], u64 k0)" % (name, n, n, n))
+    g.prologue(name + "_sqr")
+    g.load_a("a1", g.A)
+    if sqr_fits(n):
+        t, top = g.T, g.X[0]
+        g.sqr_body(t, top)
+        g.final_sub(t[n:], top, t[0])
+    else:
+        g.final_sub(*g.sqr_spill_body())
+    g.epilogue()
+    g.out.append(".size %s_sqr, .-%s_sqr" % (name, name))
+    return "\n".join(g.out) + "\n"
+
+def gen_reduce(name, n):
+    # void name_reduce(u64 rd[n], const u64 ad[n], const u64 Nd[n], u64 k0)
+    g = Gen(n, 0, n + 2, 0, None, "a2", "a3")
+    g.out.append("")
+    g.out.append("# void %s_reduce(u64 rd[%d], const u64 ad[%d], const u64 Nd[%d], u64 k0)" % (name, n, n, n))
+    g.prologue(name + "_reduce")
+    g.load_a("a1", g.T[:n])
+    g.o("li %s, 0" % g.t(n))
+    for i in range(n):
+        # The accumulator stays below 2^(64 * (n + 1)): no carry word
+        # above t[n]
+        g.red_row(top_zero=True)
+    g.final_sub(*g.result())
+    g.epilogue()
+    g.out.append(".size %s_reduce, .-%s_reduce" % (name, name))
+    return "\n".join(g.out) + "\n"
+
+##########################################################
+# Modular addition and friends: inputs < N, fully reduced results, rd
+# possibly aliasing the inputs, no branch. Only caller saved registers
+# are used: a (or the sum) in MA, b (or N, or the difference) in MB.
+MA = [ "t0", "t1", "t2", "t3" ]
+MB = [ "t4", "t5", "t6", "a4" ]
+MC, MBW, MT = "a5", "a6", "a7"
+
+class ModGen(object):
+    def __init__(self, n, name, proto, x):
+        assert n == len(MA)
+        self.n = n
+        self.x = x
+        self.out = [ "", "# " + proto, ".globl  " + name, ".align  4",
+                     name + ":" ]
+        self.name = name
+
+    def o(self, s):
+        self.out.append("    " + s)
+
+    def load(self, regs, ptr, off=0):
+        for j in range(self.n):
+            self.o("ld %s, %d(%s)" % (regs[j], off + 8 * j, ptr))
+
+    def store(self, regs, ptr="a0", off=0):
+        for j in range(self.n):
+            self.o("sd %s, %d(%s)" % (regs[j], off + 8 * j, ptr))
+
+    def add(self, s, b, c):
+        # (c, s) = s + b
+        self.o("add %s, %s, %s" % (s[0], s[0], b[0]))
+        self.o("sltu %s, %s, %s" % (c, s[0], b[0]))
+        for j in range(1, self.n):
+            self.o("add %s, %s, %s" % (s[j], s[j], b[j]))
+            self.o("sltu %s, %s, %s" % (MT, s[j], b[j]))
+            self.o("add %s, %s, %s" % (s[j], s[j], c))
+            self.o("sltu %s, %s, %s" % (c, s[j], c))
+            self.o("or %s, %s, %s" % (c, c, MT))
+
+    def dbl(self, s, c):
+        # (c, s) = 2 * s
+        n = self.n
+        self.o("srli %s, %s, 63" % (c, s[n - 1]))
+        for j in range(n - 1, 0, -1):
+            self.o("slli %s, %s, 1" % (s[j], s[j]))
+            self.o("srli %s, %s, 63" % (MT, s[j - 1]))
+            self.o("or %s, %s, %s" % (s[j], s[j], MT))
+        self.o("slli %s, %s, 1" % (s[0], s[0]))
+
+    def sub_n(self, s, d, nd):
+        # (borrow, d) = s - N, N being loaded in d (when nd is a pointer)
+        # or already in the registers nd
+        x = self.x
+        if not isinstance(nd, str):
+            self.o("sub %s, %s, %s" % (d[0], s[0], nd[0]))
+            self.o("sltu %s, %s, %s" % (MBW, s[0], nd[0]))
+            for j in range(1, self.n):
+                self.o("sub %s, %s, %s" % (x, s[j], nd[j]))
+                self.o("sltu %s, %s, %s" % (MT, s[j], nd[j]))
+                self.o("sub %s, %s, %s" % (d[j], x, MBW))
+                self.o("sltu %s, %s, %s" % (MBW, x, MBW))
+                self.o("or %s, %s, %s" % (MBW, MBW, MT))
+            return
+        self.o("ld %s, 0(%s)" % (x, nd))
+        self.o("sub %s, %s, %s" % (d[0], s[0], x))
+        self.o("sltu %s, %s, %s" % (MBW, s[0], x))
+        for j in range(1, self.n):
+            self.o("ld %s, %d(%s)" % (d[j], 8 * j, nd))
+            self.o("sub %s, %s, %s" % (x, s[j], d[j]))
+            self.o("sltu %s, %s, %s" % (MT, s[j], d[j]))
+            self.o("sub %s, %s, %s" % (d[j], x, MBW))
+            self.o("sltu %s, %s, %s" % (MBW, x, MBW))
+            self.o("or %s, %s, %s" % (MBW, MBW, MT))
+
+    def reduce(self, s, d, nd, c):
+        # s = (c, s) - N if this is >= 0, s otherwise, (c, s) being < 2N
+        self.o("# (c, s) - N")
+        self.sub_n(s, d, nd)
+        # Keep s when there is a borrow and no carry
+        self.o("sltu %s, %s, %s" % (c, c, MBW))
+        self.o("neg %s, %s" % (c, c))
+        for j in range(self.n):
+            self.o("xor %s, %s, %s" % (s[j], s[j], d[j]))
+            self.o("and %s, %s, %s" % (s[j], s[j], c))
+            self.o("xor %s, %s, %s" % (s[j], s[j], d[j]))
+
+    def end(self):
+        self.o("ret")
+        self.out.append(".size %s, .-%s" % (self.name, self.name))
+        return "\n".join(self.out) + "\n"
+
+def gen_mod_add(name, n):
+    g = ModGen(n, name + "_add", "void %s_add(u64 rd[%d], const u64 ad[%d], const u64 bd[%d], const u64 Nd[%d])" % (name, n, n, n, n), "a2")
+    g.load(MA, "a1")
+    g.load(MB, "a2")
+    g.o("# (c, s) = a + b")
+    g.add(MA, MB, MC)
+    g.reduce(MA, MB, "a3", MC)
+    g.store(MA)
+    return g.end()
+
+def gen_mod_dbl(name, n):
+    g = ModGen(n, name + "_dbl", "void %s_dbl(u64 rd[%d], const u64 ad[%d], const u64 Nd[%d])" % (name, n, n, n), "a3")
+    g.load(MA, "a1")
+    g.o("# (c, s) = 2 * a")
+    g.dbl(MA, MC)
+    g.reduce(MA, MB, "a2", MC)
+    g.store(MA)
+    return g.end()
+
+def gen_mod_tpl(name, n):
+    g = ModGen(n, name + "_tpl", "void %s_tpl(u64 rd[%d], const u64 ad[%d], const u64 Nd[%d])" % (name, n, n, n), "a3")
+    g.load(MA, "a1")
+    g.o("# s = 2 * a mod N")
+    g.dbl(MA, MC)
+    g.reduce(MA, MB, "a2", MC)
+    g.o("# s = s + a mod N")
+    g.load(MB, "a1")
+    g.add(MA, MB, MC)
+    g.reduce(MA, MB, "a2", MC)
+    g.store(MA)
+    return g.end()
+
+def gen_mod_sub(name, n):
+    g = ModGen(n, name + "_sub", "void %s_sub(u64 rd[%d], const u64 ad[%d], const u64 bd[%d], const u64 Nd[%d])" % (name, n, n, n, n), "a2")
+    g.load(MA, "a1")
+    g.load(MB, "a2")
+    # The difference goes in c, a[1], a[2], ..., the carry of the
+    # addition of N in a[0]
+    d = [ MC ] + MA[1:]
+    x = g.x
+    g.o("# (borrow, d) = a - b")
+    g.o("sub %s, %s, %s" % (d[0], MA[0], MB[0]))
+    g.o("sltu %s, %s, %s" % (MBW, MA[0], MB[0]))
+    for j in range(1, n):
+        g.o("sub %s, %s, %s" % (x, MA[j], MB[j]))
+        g.o("sltu %s, %s, %s" % (MT, MA[j], MB[j]))
+        g.o("sub %s, %s, %s" % (d[j], x, MBW))
+        g.o("sltu %s, %s, %s" % (MBW, x, MBW))
+        g.o("or %s, %s, %s" % (MBW, MBW, MT))
+    g.o("# d += N if there is a borrow")
+    g.o("neg %s, %s" % (MBW, MBW))
+    for j in range(n):
+        g.o("ld %s, %d(a3)" % (MB[j], 8 * j))
+        g.o("and %s, %s, %s" % (MB[j], MB[j], MBW))
+    c = MA[0]
+    g.o("add %s, %s, %s" % (d[0], d[0], MB[0]))
+    g.o("sltu %s, %s, %s" % (c, d[0], MB[0]))
+    for j in range(1, n):
+        g.o("add %s, %s, %s" % (d[j], d[j], MB[j]))
+        if j < n - 1:
+            g.o("sltu %s, %s, %s" % (MT, d[j], MB[j]))
+        g.o("add %s, %s, %s" % (d[j], d[j], c))
+        if j < n - 1:
+            g.o("sltu %s, %s, %s" % (c, d[j], c))
+            g.o("or %s, %s, %s" % (c, c, MT))
+    g.store(d)
+    return g.end()
+
+def gen_mod_neg(name, n):
+    g = ModGen(n, name + "_neg", "void %s_neg(u64 rd[%d], const u64 ad[%d], const u64 Nd[%d])" % (name, n, n, n), "a3")
+    g.load(MA, "a1")
+    g.load(MB, "a2")
+    # N - a, masked out when a is zero
+    g.o("# mask = (a != 0) ? all ones : 0")
+    g.o("or %s, %s, %s" % (MC, MA[0], MA[1]))
+    for j in range(2, n):
+        g.o("or %s, %s, %s" % (MC, MC, MA[j]))
+    g.o("snez %s, %s" % (MC, MC))
+    g.o("neg %s, %s" % (MC, MC))
+    g.o("# rd = (N - a) & mask")
+    x = g.x
+    g.o("sub %s, %s, %s" % (x, MB[0], MA[0]))
+    g.o("sltu %s, %s, %s" % (MBW, MB[0], MA[0]))
+    g.o("and %s, %s, %s" % (x, x, MC))
+    g.o("sd %s, 0(a0)" % x)
+    for j in range(1, n):
+        g.o("sub %s, %s, %s" % (x, MB[j], MA[j]))
+        if j < n - 1:
+            g.o("sltu %s, %s, %s" % (MT, MB[j], MA[j]))
+        g.o("sub %s, %s, %s" % (MA[j], x, MBW))
+        if j < n - 1:
+            g.o("sltu %s, %s, %s" % (MBW, x, MBW))
+            g.o("or %s, %s, %s" % (MBW, MBW, MT))
+        g.o("and %s, %s, %s" % (MA[j], MA[j], MC))
+        g.o("sd %s, %d(a0)" % (MA[j], 8 * j))
+    return g.end()
+
+##########################################################
+# Whole point formulas on 4 limbs: the field operations are inlined, N
+# and k0 being kept in registers all along (and the point pointers in
+# a0, a1, a2). Each operand is a 4 words slot: a coordinate of rd (a0),
+# ad (a1) or bd (a2), or a temporary in the stack frame. The
+# multiplications and squarings are the ones of Gen, with the registers
+# below, and the modular additions the ones of ModGen, which only use
+# t0 - t6 and a3 - a7.
+PN = [ "s0", "s1", "s2", "s3" ]
+PK0 = "s4"
+PA = [ "t5", "t6", "a3", "a4" ]
+PT = [ "a5", "a6", "a7", "s5", "s6", "s7", "s8", "s9" ]
+PTOP = "s10"
+PSAVED = PN + [ PK0, "s5", "s6", "s7", "s8", "s9", "s10" ]
+
+class PtMulGen(Gen):
+    def __init__(self, out):
+        self.n = 4
+        self.out = out
+        self.shift = 0
+        self.A = PA
+        self.T = PT[:6]
+        self.X = []
+        self.N = PN
+        self.K0 = PK0
+        self.D = None
+        self.keep = True
+        self.rd = None
+
+    def dst(self):
+        return self.rd
+
+# Operations of the formulas: (op, d, a, b), the registers the operand a
+# is loaded in, and the ones holding the result
+MUL_OPS = ( "mul", "sqr" )
+COMMUTATIVE = ( "mul", "add" )
+
+class PtGen(object):
+    # The formula is first recorded, then emitted by end(). The result of
+    # an operation stays in registers (PA for mul and sqr, MA for the
+    # other ones), so that when it is the operand a of the next one it is
+    # not reloaded, and its store is dropped when it is a temporary not
+    # read again from memory.
+    def __init__(self, name, proto, nd_reg, k0_reg, temps):
+        self.name = name
+        self.ag = ModGen(4, name, proto, "a3")
+        self.out = self.ag.out
+        self.mg = PtMulGen(self.out)
+        self.prog = []
+        self.tmp_off = 8 * len(PSAVED)
+        self.frame = ((self.tmp_off + 32 * temps + 15) // 16) * 16
+        self.o("addi sp, sp, -%d" % self.frame)
+        for (i, r) in enumerate(PSAVED):
+            self.o("sd %s, %d(sp)" % (r, 8 * i))
+        for j in range(4):
+            self.o("ld %s, %d(%s)" % (PN[j], 8 * j, nd_reg))
+        self.o("mv %s, %s" % (PK0, k0_reg))
+
+    def o(self, s):
+        self.out.append("    " + s)
+
+    # Recording
+    def mul(self, d, a, b):
+        self.prog.append(("mul", d, a, b))
+
+    def sqr(self, d, a):
+        self.prog.append(("sqr", d, a, None))
+
+    def add(self, d, a, b):
+        self.prog.append(("add", d, a, b))
+
+    def sub(self, d, a, b):
+        self.prog.append(("sub", d, a, b))
+
+    def dbl(self, d, a):
+        self.prog.append(("dbl", d, a, None))
+
+    def tpl(self, d, a):
+        self.prog.append(("tpl", d, a, None))
+
+    def or_zero(self, vs, label):
+        # Go to label unless all the words of the slots vs are zero
+        self.prog.append(("chk", None, vs, label))
+
+    def label(self, label):
+        self.prog.append(("label", None, None, label))
+
+    def ret(self, v=None):
+        self.prog.append(("ret", None, None, v))
+
+    # Emission
+    def slot(self, v):
+        # X1, Y1, Z1 (ad), x2, y2 (bd), X3, Y3, Z3 (rd) or t<i>
+        if v[0] == "t":
+            return ("sp", self.tmp_off + 32 * int(v[1:]))
+        (base, i) = { "1": ("a1", "XYZ"), "2": ("a2", "xy"),
+                      "3": ("a0", "XYZ") }[v[1]]
+        return (base, 32 * i.index(v[0]))
+
+    def forwarded(self, i):
+        # Whether the operand a of operation i is the result of operation
+        # i - 1, still in registers
+        if i == 0:
+            return False
+        (op, d, a, b) = self.prog[i]
+        (pop, pd, pa, pb) = self.prog[i - 1]
+        return pd is not None and op not in ( "chk", "label", "ret" ) and \
+            a == pd
+
+    def stored(self, i):
+        # Whether the result of operation i must be stored
+        d = self.prog[i][1]
+        if d[0] != "t":
+            return True
+        for j in range(i + 1, len(self.prog)):
+            (op, dj, a, b) = self.prog[j]
+            if op == "chk":
+                if d in a:
+                    return True
+                continue
+            if op == "tpl" and a == d:
+                # Its second read of a is from memory
+                return True
+            if (a == d and not (j == i + 1 and self.forwarded(j))) or \
+               b == d:
+                return True
+            if dj == d:
+                return False
+        return False
+
+    def load(self, regs, v, fwd):
+        if fwd is not None:
+            if fwd != regs:
+                for j in range(4):
+                    self.o("mv %s, %s" % (regs[j], fwd[j]))
+            return
+        (b, off) = self.slot(v)
+        for j in range(4):
+            self.o("ld %s, %d(%s)" % (regs[j], off + 8 * j, b))
+
+    def emit_mul(self, d, a, b, fwd, st):
+        self.o("# %s = %s * %s" % (d, a, b))
+        g = self.mg
+        g.shift = 0
+        self.load(PA, a, fwd)
+        (g.bd, g.bd_off) = self.slot(b)
+        g.rd = self.slot(d) if st else None
+        for i in range(4):
+            if i == 0:
+                g.mul_row_first()
+            else:
+                g.mul_row(i)
+            g.red_row()
+        g.final_sub(*g.result())
+
+    def emit_sqr(self, d, a, fwd, st):
+        self.o("# %s = %s^2" % (d, a))
+        g = self.mg
+        g.rd = self.slot(d) if st else None
+        self.load(PA, a, fwd)
+        t = PT
+        g.sqr_body(t, PTOP)
+        g.final_sub(t[4:], PTOP, t[0])
+
+    def store(self, d, st):
+        if st:
+            self.ag.store(MA, *self.slot(d))
+
+    def emit_add(self, d, a, b, fwd, st):
+        self.o("# %s = %s + %s" % (d, a, b))
+        self.load(MA, a, fwd)
+        self.load(MB, b, None)
+        self.ag.add(MA, MB, MC)
+        self.ag.reduce(MA, MB, PN, MC)
+        self.store(d, st)
+
+    def emit_dbl(self, d, a, fwd, st):
+        self.o("# %s = 2 * %s" % (d, a))
+        self.load(MA, a, fwd)
+        self.ag.dbl(MA, MC)
+        self.ag.reduce(MA, MB, PN, MC)
+        self.store(d, st)
+
+    def emit_tpl(self, d, a, fwd, st):
+        self.o("# %s = 3 * %s" % (d, a))
+        self.load(MA, a, fwd)
+        self.ag.dbl(MA, MC)
+        self.ag.reduce(MA, MB, PN, MC)
+        self.load(MB, a, None)
+        self.ag.add(MA, MB, MC)
+        self.ag.reduce(MA, MB, PN, MC)
+        self.store(d, st)
+
+    def emit_sub(self, d, a, b, fwd, st):
+        # As gen_mod_sub(), N being in registers and the result in MA
+        self.o("# %s = %s - %s" % (d, a, b))
+        self.load(MA, a, fwd)
+        self.load(MB, b, None)
+        x = self.ag.x
+        self.o("sub %s, %s, %s" % (MC, MA[0], MB[0]))
+        self.o("sltu %s, %s, %s" % (MBW, MA[0], MB[0]))
+        for j in range(1, 4):
+            self.o("sub %s, %s, %s" % (x, MA[j], MB[j]))
+            self.o("sltu %s, %s, %s" % (MT, MA[j], MB[j]))
+            self.o("sub %s, %s, %s" % (MA[j], x, MBW))
+            self.o("sltu %s, %s, %s" % (MBW, x, MBW))
+            self.o("or %s, %s, %s" % (MBW, MBW, MT))
+        self.o("# + N if there is a borrow")
+        self.o("neg %s, %s" % (MBW, MBW))
+        for j in range(4):
+            self.o("and %s, %s, %s" % (MB[j], PN[j], MBW))
+        self.o("add %s, %s, %s" % (MA[0], MC, MB[0]))
+        self.o("sltu %s, %s, %s" % (MC, MA[0], MB[0]))
+        for j in range(1, 4):
+            self.o("add %s, %s, %s" % (MA[j], MA[j], MB[j]))
+            if j < 3:
+                self.o("sltu %s, %s, %s" % (MT, MA[j], MB[j]))
+            self.o("add %s, %s, %s" % (MA[j], MA[j], MC))
+            if j < 3:
+                self.o("sltu %s, %s, %s" % (MC, MA[j], MC))
+                self.o("or %s, %s, %s" % (MC, MC, MT))
+        self.store(d, st)
+
+    def emit_chk(self, vs, label):
+        self.o("# %s == 0 ?" % " and ".join(vs))
+        self.o("li %s, 0" % MC)
+        for v in vs:
+            self.load(MA, v, None)
+            for j in range(4):
+                self.o("or %s, %s, %s" % (MC, MC, MA[j]))
+        self.o("bnez %s, %s" % (MC, label))
+
+    def emit_ret(self, v):
+        if v is not None:
+            self.o("li a0, %d" % v)
+        for (i, r) in enumerate(PSAVED):
+            self.o("ld %s, %d(sp)" % (r, 8 * i))
+        self.o("addi sp, sp, %d" % self.frame)
+        self.o("ret")
+
+    def end(self):
+        # Commutative operations get the previous result as operand a
+        for i in range(1, len(self.prog)):
+            (op, d, a, b) = self.prog[i]
+            pd = self.prog[i - 1][1]
+            if op in COMMUTATIVE and b == pd and a != pd:
+                self.prog[i] = (op, d, b, a)
+        for (i, (op, d, a, b)) in enumerate(self.prog):
+            if op == "chk":
+                self.emit_chk(a, b)
+                continue
+            if op == "label":
+                self.out.append(b + ":")
+                continue
+            if op == "ret":
+                self.emit_ret(b)
+                continue
+            fwd = None
+            if self.forwarded(i):
+                fwd = PA if self.prog[i - 1][0] in MUL_OPS else MA
+            st = self.stored(i)
+            if op == "mul":
+                self.emit_mul(d, a, b, fwd, st)
+            elif op == "sqr":
+                self.emit_sqr(d, a, fwd, st)
+            else:
+                getattr(self, "emit_" + op)(d, a, fwd, st) if b is None \
+                    else getattr(self, "emit_" + op)(d, a, b, fwd, st)
+        self.out.append(".size %s, .-%s" % (self.name, self.name))
+        return "\n".join(self.out) + "\n"
+
+def gen_jprj_dbl_a3(name):
+    # Jacobian doubling for a = -3, as _jprj_pt_dbl_monty()
+    g = PtGen(name + "_dbl_a3", "void %s_dbl_a3(u64 rd[12], const u64 ad[12], const u64 Nd[4], u64 k0)" % name, "a2", "a3", 5)
+    # M = 3 * (X1 - Z1^2) * (X1 + Z1^2)
+    g.sqr("t0", "Z1")
+    g.add("t1", "X1", "t0")
+    g.sub("t2", "X1", "t0")
+    g.mul("t1", "t1", "t2")
+    g.tpl("t1", "t1")
+    g.sqr("t2", "t1")
+    # t3 = 4 * Y1^2, t4 = 8 * Y1^4
+    g.sqr("t3", "Y1")
+    g.dbl("t3", "t3")
+    g.sqr("t4", "t3")
+    g.dbl("t4", "t4")
+    g.dbl("t3", "t3")
+    # S = 4 * X1 * Y1^2
+    g.mul("t3", "t3", "X1")
+    # Z3 = 2 * Y1 * Z1, the last use of the inputs (rd may alias ad)
+    g.mul("Z3", "Z1", "Y1")
+    g.dbl("Z3", "Z3")
+    # X3 = M^2 - 2 * S, Y3 = M * (S - X3) - 8 * Y1^4
+    g.sub("X3", "t2", "t3")
+    g.sub("X3", "X3", "t3")
+    g.sub("Y3", "t3", "X3")
+    g.mul("Y3", "Y3", "t1")
+    g.sub("Y3", "Y3", "t4")
+    g.ret()
+    return g.end()
+
+def gen_jprj_add_mixed(name):
+    # Jacobian plus affine (Z2 = 1) addition, as _jprj_pt_add_monty() with
+    # Z2 = 1. Returns 1 without touching rd when the points are equal.
+    g = PtGen(name + "_add_mixed", "int %s_add_mixed(u64 rd[12], const u64 ad[12], const u64 bd[8], const u64 Nd[4], u64 k0)" % name, "a3", "a4", 10)
+    # H = x2 * Z1^2 - X1, R = y2 * Z1^3 - Y1
+    g.sqr("t0", "Z1")
+    g.mul("t1", "x2", "t0")
+    g.mul("t0", "t0", "Z1")
+    g.mul("t2", "y2", "t0")
+    g.sub("t3", "t1", "X1")
+    g.sub("t4", "t2", "Y1")
+    label = ".L%s_add_mixed_ne" % name
+    g.or_zero([ "t3", "t4" ], label)
+    g.ret(1)
+    g.label(label)
+    g.sqr("t5", "t4")
+    g.sqr("t6", "t3")
+    g.mul("t7", "t6", "t3")
+    g.mul("t8", "X1", "t6")
+    g.mul("t9", "Y1", "t7")
+    # Z3 = Z1 * H, the last use of the inputs (rd may alias ad)
+    g.mul("Z3", "Z1", "t3")
+    # X3 = R^2 - H^3 - 2 * X1 * H^2
+    g.sub("X3", "t5", "t7")
+    g.sub("X3", "X3", "t8")
+    g.sub("X3", "X3", "t8")
+    # Y3 = R * (X1 * H^2 - X3) - Y1 * H^3
+    g.sub("Y3", "t8", "X3")
+    g.mul("Y3", "Y3", "t4")
+    g.sub("Y3", "Y3", "t9")
+    g.ret(0)
+    return g.end()
+
+if __name__ == "__main__":
+    if len(sys.argv) > 1 and sys.argv[1] == "u256mod":
+        sys.stdout.write(HEADER_U256_MOD)
+        for (name, n) in KERNELS_U256:
+            sys.stdout.write(gen_mod_add(name, n))
+            sys.stdout.write(gen_mod_sub(name, n))
+            sys.stdout.write(gen_mod_dbl(name, n))
+            sys.stdout.write(gen_mod_tpl(name, n))
+            sys.stdout.write(gen_mod_neg(name, n))
+        sys.exit(0)
+    if len(sys.argv) > 1 and sys.argv[1] == "u256pt":
+        sys.stdout.write(HEADER_U256_PT)
+        sys.stdout.write(gen_jprj_dbl_a3("ll_u256_jprj"))
+        sys.stdout.write(gen_jprj_add_mixed("ll_u256_jprj"))
+        sys.exit(0)
+    if len(sys.argv) > 1 and sys.argv[1] == "u256":
+        (header, kernels) = (HEADER_U256, KERNELS_U256)
+    else:
+        (header, kernels) = (HEADER, KERNELS)
+    sys.stdout.write(header)
+    for (name, n) in kernels:
+        sys.stdout.write(gen_mul(name, n))
+        sys.stdout.write(gen_sqr(name, n))
+        sys.stdout.write(gen_reduce(name, n))
@@ -0,0 +1,324 @@
+#/*
+# *  Copyright (C) 2017 - This file is part of libecc project
+# *
+# *  Authors:
+# *      Ryad BENADJILA <ryadbenadjila@gmail.com>
+# *      Arnaud EBALARD <arnaud.ebalard@ssi.gouv.fr>
+# *      Jean-Pierre FLORI <jean-pierre.flori@ssi.gouv.fr>
+# *
+# *  Contributors:
+# *      Nicolas VIVET <nicolas.vivet@ssi.gouv.fr>
+# *      Karim KHALFALLAH <karim.khalfallah@ssi.gouv.fr>
+# *
+# *  This software is licensed under a dual BSD and GPL v2 license.
+# *  See LICENSE file at the root folder of the project.
+# */
+#! /usr/bin/env python
+#
+# Generator of src/nn/ll_mont-x86_64.S, the x86-64 BMI2/ADX Montgomery
+# kernels (see src/nn/ll_mont_x86_64.h):
+#
+#   python scripts/ll_mont_x86_64.py > src/nn/ll_mont-x86_64.S
+#
+# Each kernel is a fully unrolled CIOS Montgomery multiplication on n
+# limbs. A row t += a * b[i] (or t += m * N) is computed with mulx, the
+# low halves of the products being accumulated with adox (OF carry chain)
+# and the high halves with adcx (CF carry chain), so that both chains run
+# in parallel. The n + 2 words accumulator t lives in registers; since t
+# is shifted by one word after each reduction row, the registers are
+# renamed instead of moved. The inputs a and N are copied on the stack,
+# so that mulx can read them with rsp relative addressing whatever n (up
+# to 9 limbs, which uses all the general purpose registers).
+#
+# The squaring kernels compute each cross product a[i] * a[j] (i < j)
+# once, double their sum and add the squares a[i]^2 with the two carry
+# chains, and then reduce the 2n words square with n rows t += m * N.
+# This is (n^2 + n) / 2 multiplications for the square instead of n^2.
+import sys
+
+SIZES = [ 4, 6, 9 ]
+
+# Accumulator registers, the other ones being:
+#   rdx: mulx multiplier, rbx/rcx: low/high product, rax: zero
+ACC_REGS = [ "%rsi", "%rdi", "%rbp", "%r8", "%r9", "%r10", "%r11",
+             "%r12", "%r13", "%r14", "%r15" ]
+
+HEADER = """/*
+ *  Copyright (C) 2017 - This file is part of libecc project
+ *
+ *  Authors:
+ *      Ryad BENADJILA <ryadbenadjila@gmail.com>
+ *      Arnaud EBALARD <arnaud.ebalard@ssi.gouv.fr>
+ *      Jean-Pierre FLORI <jean-pierre.flori@ssi.gouv.fr>
+ *
+ *  Contributors:
+ *      Nicolas VIVET <nicolas.vivet@ssi.gouv.fr>
+ *      Karim KHALFALLAH <karim.khalfallah@ssi.gouv.fr>
+ *
+ *  This software is licensed under a dual BSD and GPL v2 license.
+ *  See LICENSE file at the root folder of the project.
+ */
+
+/*
+ * x86-64 BMI2/ADX Montgomery kernels, see ll_mont_x86_64.h. This file is
+ * generated by scripts/ll_mont_x86_64.py, do not edit. The kernels use the
+ * System V calling convention and ELF directives, and are left out on the
+ * other targets.
+ */
+#if defined(__ELF__) && !defined(_WIN64)
+
+	.text
+
+/*
+ * int ll_mont_x86_64_cpu_ok(void): non zero when CPUID reports BMI2
+ * (leaf 7, ebx bit 8) and ADX (leaf 7, ebx bit 19).
+ */
+	.globl	ll_mont_x86_64_cpu_ok
+	.type	ll_mont_x86_64_cpu_ok, @function
+	.p2align 4
+ll_mont_x86_64_cpu_ok:
+	pushq	%rbx
+	xorl	%eax, %eax
+	cpuid
+	cmpl	$7, %eax
+	jb	.Lcpu_no
+	movl	$7, %eax
+	xorl	%ecx, %ecx
+	cpuid
+	andl	$0x80100, %ebx
+	cmpl	$0x80100, %ebx
+	jne	.Lcpu_no
+	movl	$1, %eax
+	popq	%rbx
+	ret
+.Lcpu_no:
+	xorl	%eax, %eax
+	popq	%rbx
+	ret
+	.size	ll_mont_x86_64_cpu_ok, .-ll_mont_x86_64_cpu_ok
+"""
+
+FOOTER = """
+#if defined(__linux__)
+	.section .note.GNU-stack,"",%progbits
+#endif
+
+#endif /* __ELF__ && !_WIN64 */
+"""
+
+def reg32(r):
+    # 32-bit name of a 64-bit register (whose upper half is then zeroed)
+    if r[2] in "0123456789":
+        return r + "d"
+    return "%e" + r[2:]
+
+SAVED_REGS = [ "%rbx", "%rbp", "%r12", "%r13", "%r14", "%r15" ]
+
+def gen_mul(n):
+    # Stack frame: a[n], N[n], then the saved rd pointer, bd pointer and k0
+    a_off = 0
+    n_off = 8 * n
+    rd_off = 16 * n
+    bd_off = rd_off + 8
+    k0_off = rd_off + 16
+    frame = k0_off + 8
+    acc = ACC_REGS[:n + 2]
+    name = "ll_mont_mulx_%d" % n
+    out = []
+    def o(s):
+        out.append("\t" + s)
+    out.append("")
+    out.append("/*")
+    out.append(" * void %s(u64 rd[%d], const u64 ad[%d], const u64 bd[%d]," % (name, n, n, n))
+    out.append(" *                     const u64 Nd[%d], u64 k0)" % n)
+    out.append(" */")
+    out.append("\t.globl\t" + name)
+    out.append("\t.type\t%s, @function" % name)
+    out.append("\t.p2align 4")
+    out.append(name + ":")
+    for r in SAVED_REGS:
+        o("pushq\t" + r)
+    o("subq\t$%d, %%rsp" % frame)
+    o("movq\t%%rdi, %d(%%rsp)" % rd_off)
+    o("movq\t%%rdx, %d(%%rsp)" % bd_off)
+    o("movq\t%%r8, %d(%%rsp)" % k0_off)
+    # Copy a and N
+    for j in range(n):
+        o("movq\t%d(%%rsi), %%rax" % (8 * j))
+        o("movq\t%%rax, %d(%%rsp)" % (a_off + 8 * j))
+        o("movq\t%d(%%rcx), %%rax" % (8 * j))
+        o("movq\t%%rax, %d(%%rsp)" % (n_off + 8 * j))
+    for r in acc:
+        o("xorl\t%s, %s" % (reg32(r), reg32(r)))
+    shift = 0
+    def t(j):
+        return acc[(j + shift) % (n + 2)]
+    for i in range(n):
+        # t += a * b[i]
+        o("/* t += a * b[%d] */" % i)
+        o("movq\t%d(%%rsp), %%rdx" % bd_off)
+        o("movq\t%d(%%rdx), %%rdx" % (8 * i))
+        o("xorl\t%eax, %eax")
+        for j in range(n):
+            o("mulxq\t%d(%%rsp), %%rbx, %%rcx" % (a_off + 8 * j))
+            o("adoxq\t%%rbx, %s" % t(j))
+            o("adcxq\t%%rcx, %s" % t(j + 1))
+        o("adoxq\t%%rax, %s" % t(n))
+        o("adcxq\t%%rax, %s" % t(n + 1))
+        o("adoxq\t%%rax, %s" % t(n + 1))
+        # t = (t + m * N) / B
+        o("/* t = (t + m * N) / B, m = t[0] * k0 */")
+        o("movq\t%s, %%rdx" % t(0))
+        o("imulq\t%d(%%rsp), %%rdx" % k0_off)
+        o("xorl\t%eax, %eax")
+        for j in range(n):
+            o("mulxq\t%d(%%rsp), %%rbx, %%rcx" % (n_off + 8 * j))
+            o("adoxq\t%%rbx, %s" % t(j))
+            o("adcxq\t%%rcx, %s" % t(j + 1))
+        o("adoxq\t%%rax, %s" % t(n))
+        o("adcxq\t%%rax, %s" % t(n + 1))
+        o("adoxq\t%%rax, %s" % t(n + 1))
+        # t[0] is now zero: it becomes the new top word
+        shift += 1
+    # Final subtraction: rd = t - N, then t is put back when t < N
+    o("/* rd = t - N if t >= N, t otherwise (constant time) */")
+    o("movq\t%d(%%rsp), %%rdx" % rd_off)
+    for j in range(n):
+        o("movq\t%s, %%rbx" % t(j))
+        o("%s\t%d(%%rsp), %%rbx" % ("subq" if j == 0 else "sbbq", n_off + 8 * j))
+        o("movq\t%%rbx, %d(%%rdx)" % (8 * j))
+    o("sbbq\t$0, %s" % t(n))
+    for j in range(n):
+        o("cmovncq\t%d(%%rdx), %s" % (8 * j, t(j)))
+        o("movq\t%s, %d(%%rdx)" % (t(j), 8 * j))
+    o("addq\t$%d, %%rsp" % frame)
+    for r in reversed(SAVED_REGS):
+        o("popq\t" + r)
+    o("ret")
+    out.append("\t.size\t%s, .-%s" % (name, name))
+    return "\n".join(out) + "\n"
+
+def gen_sqr(n):
+    # Stack frame: a[n], N[n], t[2n], then the saved rd pointer and k0
+    a_off = 0
+    n_off = 8 * n
+    t_off = 16 * n
+    rd_off = 32 * n
+    k0_off = rd_off + 8
+    frame = k0_off + 8
+    name = "ll_mont_sqrx_%d" % n
+    out = []
+    def o(s):
+        out.append("\t" + s)
+    out.append("")
+    out.append("/*")
+    out.append(" * void %s(u64 rd[%d], const u64 ad[%d], const u64 Nd[%d], u64 k0)" % (name, n, n, n))
+    out.append(" */")
+    out.append("\t.globl\t" + name)
+    out.append("\t.type\t%s, @function" % name)
+    out.append("\t.p2align 4")
+    out.append(name + ":")
+    for r in SAVED_REGS:
+        o("pushq\t" + r)
+    o("subq\t$%d, %%rsp" % frame)
+    o("movq\t%%rdi, %d(%%rsp)" % rd_off)
+    o("movq\t%%rcx, %d(%%rsp)" % k0_off)
+    # Copy a and N
+    for j in range(n):
+        o("movq\t%d(%%rsi), %%rax" % (8 * j))
+        o("movq\t%%rax, %d(%%rsp)" % (a_off + 8 * j))
+        o("movq\t%d(%%rdx), %%rax" % (8 * j))
+        o("movq\t%%rax, %d(%%rsp)" % (n_off + 8 * j))
+    # Cross products: row i adds the a[i] * a[j], j > i, to the words
+    # 2i + 1 to i + n of t, which are kept in registers. The words 2i + 1
+    # and 2i + 2 are final after row i and are stored, their registers
+    # being used for the new top words of the next rows.
+    o("/* t = sum of the a[i] * a[j] * B^(i + j), i < j */")
+    o("xorl\t%eax, %eax")
+    o("movq\t%%rax, %d(%%rsp)" % t_off)
+    o("movq\t%%rax, %d(%%rsp)" % (t_off + 8 * (2 * n - 1)))
+    free = list(ACC_REGS)
+    reg = {}
+    for pos in range(1, n + 1):
+        reg[pos] = free.pop(0)
+        o("xorl\t%s, %s" % (reg32(reg[pos]), reg32(reg[pos])))
+    for i in range(n - 1):
+        if i > 0:
+            reg[i + n] = free.pop(0)
+            o("xorl\t%s, %s" % (reg32(reg[i + n]), reg32(reg[i + n])))
+        o("movq\t%d(%%rsp), %%rdx" % (a_off + 8 * i))
+        o("xorl\t%eax, %eax")
+        for j in range(i + 1, n):
+            o("mulxq\t%d(%%rsp), %%rbx, %%rcx" % (a_off + 8 * j))
+            o("adoxq\t%%rbx, %s" % reg[i + j])
+            o("adcxq\t%%rcx, %s" % reg[i + j + 1])
+        o("adoxq\t%%rax, %s" % reg[i + n])
+        for pos in (2 * i + 1, 2 * i + 2):
+            o("movq\t%s, %d(%%rsp)" % (reg[pos], t_off + 8 * pos))
+            free.append(reg.pop(pos))
+    # Doubling (CF chain) and squares (OF chain)
+    o("/* t = 2 * t + sum of the a[i]^2 * B^(2i) */")
+    (r0, r1) = ACC_REGS[:2]
+    o("xorl\t%eax, %eax")
+    for k in range(n):
+        o("movq\t%d(%%rsp), %%rdx" % (a_off + 8 * k))
+        o("mulxq\t%rdx, %rbx, %rcx")
+        o("movq\t%d(%%rsp), %s" % (t_off + 16 * k, r0))
+        o("movq\t%d(%%rsp), %s" % (t_off + 16 * k + 8, r1))
+        o("adcxq\t%s, %s" % (r0, r0))
+        o("adcxq\t%s, %s" % (r1, r1))
+        o("adoxq\t%%rbx, %s" % r0)
+        o("adoxq\t%%rcx, %s" % r1)
+        o("movq\t%s, %d(%%rsp)" % (r0, t_off + 16 * k))
+        o("movq\t%s, %d(%%rsp)" % (r1, t_off + 16 * k + 8))
+    # Reduction: the n + 1 words window of t in registers slides by one
+    # word per row (the registers being renamed), the carries out of its
+    # top word being kept in cy (at most 2) for the next row.
+    o("/* t = t / B^n mod N, one m = t[i] * k0 row at a time */")
+    w = ACC_REGS[:n + 1]
+    cy = ACC_REGS[n + 1]
+    for j in range(n):
+        o("movq\t%d(%%rsp), %s" % (t_off + 8 * j, w[j]))
+    o("xorl\t%s, %s" % (reg32(cy), reg32(cy)))
+    shift = 0
+    def tw(j):
+        return w[(j + shift) % (n + 1)]
+    for i in range(n):
+        o("movq\t%d(%%rsp), %s" % (t_off + 8 * (i + n), tw(n)))
+        o("movq\t%s, %%rdx" % tw(0))
+        o("imulq\t%d(%%rsp), %%rdx" % k0_off)
+        o("xorl\t%eax, %eax")
+        for j in range(n):
+            o("mulxq\t%d(%%rsp), %%rbx, %%rcx" % (n_off + 8 * j))
+            o("adoxq\t%%rbx, %s" % tw(j))
+            o("adcxq\t%%rcx, %s" % tw(j + 1))
+        o("adoxq\t%s, %s" % (cy, tw(n)))
+        o("movl\t$0, %s" % reg32(cy))
+        o("adcxq\t%%rax, %s" % cy)
+        o("adoxq\t%%rax, %s" % cy)
+        # t[i] is now zero: its register holds the next top word
+        shift += 1
+    # Final subtraction, cy being the top word of t
+    o("/* rd = t - N if t >= N, t otherwise (constant time) */")
+    o("movq\t%d(%%rsp), %%rdx" % rd_off)
+    for j in range(n):
+        o("movq\t%s, %%rbx" % tw(j))
+        o("%s\t%d(%%rsp), %%rbx" % ("subq" if j == 0 else "sbbq", n_off + 8 * j))
+        o("movq\t%%rbx, %d(%%rdx)" % (8 * j))
+    o("sbbq\t$0, %s" % cy)
+    for j in range(n):
+        o("cmovncq\t%d(%%rdx), %s" % (8 * j, tw(j)))
+        o("movq\t%s, %d(%%rdx)" % (tw(j), 8 * j))
+    o("addq\t$%d, %%rsp" % frame)
+    for r in reversed(SAVED_REGS):
+        o("popq\t" + r)
+    o("ret")
+    out.append("\t.size\t%s, .-%s" % (name, name))
+    return "\n".join(out) + "\n"
+
+if __name__ == "__main__":
+    sys.stdout.write(HEADER)
+    for n in SIZES:
+        sys.stdout.write(gen_mul(n))
+        sys.stdout.write(gen_sqr(n))
+    sys.stdout.write(FOOTER)
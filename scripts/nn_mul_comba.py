@@ -0,0 +1,145 @@
+#/*
+# *  Copyright (C) 2017 - This file is part of libecc project
+# *
+# *  Authors:
+# *      Ryad BENADJILA <ryadbenadjila@gmail.com>
+# *      Arnaud EBALARD <arnaud.ebalard@ssi.gouv.fr>
+# *      Jean-Pierre FLORI <jean-pierre.flori@ssi.gouv.fr>
+# *
+# *  Contributors:
+# *      Nicolas VIVET <nicolas.vivet@ssi.gouv.fr>
+# *      Karim KHALFALLAH <karim.khalfallah@ssi.gouv.fr>
+# *
+# *  This software is licensed under a dual BSD and GPL v2 license.
+# *  See LICENSE file at the root folder of the project.
+# */
+#! /usr/bin/env python
+#
+# Generator of src/nn/nn_mul_comba.h, the fully unrolled Comba (product
+# scanning) multiplication and squaring used by nn_mul.c for the limb
+# counts of the enabled curves:
+#
+#   python scripts/nn_mul_comba.py > src/nn/nn_mul_comba.h
+#
+# Compilers do not completely unroll the triangular loops of the generic
+# Comba routines (whose inner bounds depend on the column), while the
+# unrolled version keeps the three words accumulator in registers and
+# only does the loads of the operands and the stores of the result. Each
+# size is only compiled when a curve uses it (FP_FIXED_WLEN_<n>_USED, see
+# src/fp/fp_fixed.h), the accumulation macros being the ones of nn_mul.c.
+import sys
+
+# Limb counts, the same as the fixed limbs field backend
+SIZES = range(2, 18)
+
+HEADER = """/*
+ *  Copyright (C) 2017 - This file is part of libecc project
+ *
+ *  Authors:
+ *      Ryad BENADJILA <ryadbenadjila@gmail.com>
+ *      Arnaud EBALARD <arnaud.ebalard@ssi.gouv.fr>
+ *      Jean-Pierre FLORI <jean-pierre.flori@ssi.gouv.fr>
+ *
+ *  Contributors:
+ *      Nicolas VIVET <nicolas.vivet@ssi.gouv.fr>
+ *      Karim KHALFALLAH <karim.khalfallah@ssi.gouv.fr>
+ *
+ *  This software is licensed under a dual BSD and GPL v2 license.
+ *  See LICENSE file at the root folder of the project.
+ */
+
+/*
+ * Fully unrolled Comba multiplication and squaring for the limb counts of
+ * the enabled curves, only included by nn_mul.c (which defines the
+ * COMBA_* macros). This file is generated by scripts/nn_mul_comba.py, do
+ * not edit.
+ */
+#ifndef __NN_MUL_COMBA_H__
+#define __NN_MUL_COMBA_H__
+"""
+
+def gen_mul(n):
+    out = []
+    out.append("")
+    out.append("/* out = in1 * in2 on %d words, in1 and in2 being %d words */" % (2 * n, n))
+    out.append("static void _nn_mul_comba_%d(word_t *out, const word_t *in1," % n)
+    out.append("%sconst word_t *in2)" % ("\t\t\t     " if n < 10 else "\t\t\t      "))
+    out.append("{")
+    out.append("\tword_t c0 = 0, c1 = 0, c2 = 0;")
+    out.append("")
+    for k in range(2 * n - 1):
+        for i in range(max(0, k - n + 1), min(k, n - 1) + 1):
+            out.append("\tCOMBA_MULADD(c2, c1, c0, in1[%d], in2[%d]);" % (i, k - i))
+        out.append("\tCOMBA_NEXT(out[%d], c2, c1, c0);" % k)
+    out.append("\tout[%d] = c0;" % (2 * n - 1))
+    out.append("}")
+    return out
+
+def gen_sqr(n):
+    out = []
+    out.append("")
+    out.append("/* out = in^2 on %d words, in being %d words */" % (2 * n, n))
+    out.append("static void _nn_sqr_comba_%d(word_t *out, const word_t *in)" % n)
+    out.append("{")
+    out.append("\tword_t c0 = 0, c1 = 0, c2 = 0, d0, d1, d2;")
+    out.append("")
+    for k in range(2 * n - 1):
+        cross = [ (i, k - i) for i in range(max(0, k - n + 1), n) if i < k - i ]
+        if cross:
+            out.append("\td0 = d1 = d2 = 0;")
+            for (i, j) in cross:
+                out.append("\tCOMBA_MULADD(d2, d1, d0, in[%d], in[%d]);" % (i, j))
+            out.append("\tCOMBA_DBLADD(c2, c1, c0, d2, d1, d0);")
+        if k % 2 == 0:
+            out.append("\tCOMBA_MULADD(c2, c1, c0, in[%d], in[%d]);" % (k // 2, k // 2))
+        out.append("\tCOMBA_NEXT(out[%d], c2, c1, c0);" % k)
+    out.append("\tout[%d] = c0;" % (2 * n - 1))
+    out.append("}")
+    return out
+
+def gen_dispatch():
+    out = []
+    out.append("")
+    out.append("/*")
+    out.append(" * out = in1 * in2 on 2 * len words (in1^2 when in2 is NULL) when len is")
+    out.append(" * one of the above limb counts, returns 0 otherwise.")
+    out.append(" */")
+    out.append("static int _nn_mul_comba_fixed(word_t *out, const word_t *in1,")
+    out.append("\t\t\t       const word_t *in2, u8 len)")
+    out.append("{")
+    out.append("\tswitch (len) {")
+    for n in SIZES:
+        out.append("#ifdef FP_FIXED_WLEN_%d_USED" % n)
+        out.append("\tcase %d:" % n)
+        out.append("\t\tif (in2 == NULL) {")
+        out.append("\t\t\t_nn_sqr_comba_%d(out, in1);" % n)
+        out.append("\t\t} else {")
+        out.append("\t\t\t_nn_mul_comba_%d(out, in1, in2);" % n)
+        out.append("\t\t}")
+        out.append("\t\treturn 1;")
+        out.append("#endif")
+    out.append("\tdefault:")
+    out.append("\t\tbreak;")
+    out.append("\t}")
+    out.append("")
+    out.append("\t/* Avoid unused parameter warnings when no size is used */")
+    out.append("\t(void)out;")
+    out.append("\t(void)in1;")
+    out.append("\t(void)in2;")
+    out.append("")
+    out.append("\treturn 0;")
+    out.append("}")
+    return out
+
+if __name__ == "__main__":
+    lines = [ HEADER ]
+    for n in SIZES:
+        lines.append("#ifdef FP_FIXED_WLEN_%d_USED" % n)
+        lines.extend(gen_mul(n))
+        lines.extend(gen_sqr(n))
+        lines.append("#endif")
+        lines.append("")
+    lines.extend(gen_dispatch())
+    lines.append("")
+    lines.append("#endif /* __NN_MUL_COMBA_H__ */")
+    sys.stdout.write("\n".join(lines) + "\n")
@@ -0,0 +1,489 @@
+#/*
+# *  Copyright (C) 2017 - This file is part of libecc project
+# *
+# *  Authors:
+# *      Ryad BENADJILA <ryadbenadjila@gmail.com>
+# *      Arnaud EBALARD <arnaud.ebalard@ssi.gouv.fr>
+# *      Jean-Pierre FLORI <jean-pierre.flori@ssi.gouv.fr>
+# *
+# *  Contributors:
+# *      Nicolas VIVET <nicolas.vivet@ssi.gouv.fr>
+# *      Karim KHALFALLAH <karim.khalfallah@ssi.gouv.fr>
+# *
+# *  This software is licensed under a dual BSD and GPL v2 license.
+# *  See LICENSE file at the root folder of the project.
+# */
+#! /usr/bin/env python
+#
+# Instruction and macro-op fusion counter for the rv64 Montgomery kernels
+# (ll_u256_mont-riscv64.S, ll_u256_mont_fused-riscv64.S,
+# ll_u256_mod-riscv64.S and ll_mont-riscv64.S) and point formulas
+# (ll_u256_pt-riscv64.S).
+#
+# Kernels mode: the given assembly files are assembled, and each
+# ll_u<bits>_mont_{mul,sqr,reduce,add,sub,dbl,tpl,neg} kernel they define
+# is run by a small RV64IM interpreter on random and edge (0 and N - 1)
+# inputs for some curve primes of its size. So are the
+# ll_u256_jprj_{dbl_a3,add_mixed} point formulas, on random coordinates
+# as well as equal and opposite points, with and without rd aliasing ad.
+# The results are checked against Python integers, and the dynamic
+# instruction, fused pair and macro-op counts per call are reported:
+#
+#   python scripts/rv_mont_count.py src/nn/ll_u256_mont-riscv64.S \
+#          src/nn/ll_u256_mont_fused-riscv64.S
+#
+# The assembler is $RV_CC (e.g. riscv64-unknown-linux-gnu-gcc) when set,
+# or else the host C preprocessor followed by llvm-mc. The disassembler is
+# $RV_OBJDUMP, or llvm-objdump.
+#
+# Trace mode: the same counts are computed from the log of the QEMU
+# execlog plugin, e.g. for a binary calling nn_mul_redc1() 1000 times:
+#
+#   qemu-riscv64 -plugin libexeclog.so -d plugin -D trace.txt ./prog
+#   python scripts/rv_mont_count.py --trace trace.txt --calls 1000
+#
+# The fused pairs are the ones CKB-VM turns into a single macro-op, i.e.
+# two adjacent instructions of the form:
+#
+#   mulhu h, x, y ; mul l, x, y    h not in (x, y, l)     wide multiply
+#   add d, x, y   ; sltu c, d, z   z in (x, y), d not in (z, c), carry
+#   sub d, x, y   ; sltu c, x, y   d not in (x, y)        borrow
+#
+# (mulh and mulhsu pair the same way as mulhu). The stream is scanned from
+# the start, an instruction being part of at most one pair. The cycles are
+# estimated with the CKB-VM instruction costs: 2 for loads and stores, 3
+# for branches and jumps, 5 for multiplications and 1 otherwise, a fused
+# pair costing as its most expensive instruction.
+import sys, os, re, random, subprocess, tempfile, getopt
+
+M64 = (1 << 64) - 1
+
+ABI = [ "zero", "ra", "sp", "gp", "tp", "t0", "t1", "t2", "s0", "s1",
+        "a0", "a1", "a2", "a3", "a4", "a5", "a6", "a7", "s2", "s3", "s4",
+        "s5", "s6", "s7", "s8", "s9", "s10", "s11", "t3", "t4", "t5", "t6" ]
+RIDX = dict((r, i) for (i, r) in enumerate(ABI))
+RIDX["fp"] = 8
+for i in range(32):
+    RIDX["x%d" % i] = i
+CALLEE_SAVED = [ 8, 9 ] + list(range(18, 28))
+
+# Curve primes used to exercise the kernels, by limb count
+PRIMES = {
+    4: [ 2**256 - 2**224 + 2**192 + 2**96 - 1,
+         2**256 - 2**32 - 977,
+         0xA9FB57DBA1EEA9BC3E660A909D838D726E3BF623D52620282013481D1F6E5377 ],
+    6: [ 2**384 - 2**128 - 2**96 + 2**32 - 1,
+         0x8CB91E82A3386D280F5D6F7E50E641DF152F7109ED5456B412B1DA197FB71123ACD3A729901D1A71874700133107EC53 ],
+    8: [ 0xAADD9DB8DBE9C48B3FD4E6AE33C9FC07CB308DB3B3C9D20ED6639CCA703308717D4D9B009BC66842AECDA12AE6A380E62881FF2F2D82C68528AA6056583A48F3,
+         2**512 - 569 ],
+    9: [ 2**521 - 1 ],
+}
+LIMBS = { 256: 4, 384: 6, 512: 8, 521: 9 }
+
+def modinv(a, m):
+    # Extended Euclid, m being coprime with a
+    r0, r1, u0, u1 = m, a % m, 0, 1
+    while r1:
+        q = r0 // r1
+        r0, r1, u0, u1 = r1, r0 - q * r1, u1, u0 - q * u1
+    return u0 % m
+
+def sx(v):
+    v &= M64
+    return v - (1 << 64) if (v >> 63) else v
+
+##########################################################
+# Fusion counting
+def is_pair(i0, i1):
+    (op0, a0), (op1, a1) = i0, i1
+    if len(a0) != 3 or len(a1) != 3:
+        return False
+    if op0 in ("mulhu", "mulh", "mulhsu") and op1 == "mul":
+        return (a0[1:] == a1[1:] and a0[0] not in a0[1:]
+                and a0[0] != a1[0])
+    if op0 == "add" and op1 == "sltu":
+        (d, x, y), (c, d1, z) = a0, a1
+        return d1 == d and z in (x, y) and z != d and c != d
+    if op0 == "sub" and op1 == "sltu":
+        (d, x, y) = a0
+        return a1[1:] == [ x, y ] and d not in (x, y)
+    return False
+
+# CKB-VM cycles per instruction, a fused pair costing as its most
+# expensive instruction
+CYCLES = { "ld": 2, "sd": 2, "jal": 3, "jalr": 3, "beq": 3, "bne": 3,
+           "bltu": 3, "bgeu": 3, "blt": 3, "bge": 3, "mul": 5, "mulh": 5,
+           "mulhu": 5, "mulhsu": 5 }
+
+class Counter(object):
+    def __init__(self):
+        self.insns = 0
+        self.pairs = 0
+        self.cycles = 0
+        self.prev = None
+
+    def feed(self, insn):
+        self.insns += 1
+        cost = CYCLES.get(insn[0], 1)
+        if self.prev is not None and is_pair(self.prev, insn):
+            self.pairs += 1
+            self.cycles += max(0, cost - CYCLES.get(self.prev[0], 1))
+            self.prev = None
+        else:
+            self.cycles += cost
+            self.prev = insn
+
+    def report(self, name, calls):
+        print("%-36s %8.1f %8.1f %8.1f %8.1f" % (name,
+              float(self.insns) / calls, float(self.pairs) / calls,
+              float(self.insns - self.pairs) / calls,
+              float(self.cycles) / calls))
+
+##########################################################
+# Assembly and disassembly
+def canon(op, args):
+    # Back to the base instructions for the aliases objdump may print
+    if op == "mv":
+        return "addi", [ args[0], args[1], "0" ]
+    if op == "snez":
+        return "sltu", [ args[0], "zero", args[1] ]
+    if op == "seqz":
+        return "sltiu", [ args[0], args[1], "1" ]
+    if op == "neg":
+        return "sub", [ args[0], "zero", args[1] ]
+    if op == "not":
+        return "xori", [ args[0], args[1], "-1" ]
+    if op == "li":
+        return "addi", [ args[0], "zero", args[1] ]
+    return op, args
+
+def assemble(src, obj):
+    rv_cc = os.environ.get("RV_CC")
+    if rv_cc:
+        subprocess.check_call(rv_cc.split() + [ "-c", "-march=rv64im",
+                              "-mabi=lp64", "-o", obj, src ])
+        return
+    pre = obj + ".s"
+    subprocess.check_call([ os.environ.get("CC", "cc"), "-E", "-P", "-x",
+                            "assembler-with-cpp", "-o", pre, src ])
+    subprocess.check_call([ "llvm-mc", "-triple=riscv64", "-mattr=+m",
+                            "-filetype=obj", "-o", obj, pre ])
+
+def disassemble(obj):
+    objdump = os.environ.get("RV_OBJDUMP", "llvm-objdump")
+    cmd = [ objdump, "-d", "--no-show-raw-insn", "-M", "no-aliases", obj ]
+    if "llvm" in os.path.basename(objdump):
+        cmd.insert(1, "--mattr=+m")
+    out = subprocess.check_output(cmd)
+    insns = {}
+    syms = {}
+    for line in out.decode().splitlines():
+        m = re.match(r"^([0-9a-f]+) <([^>]+)>:", line)
+        if m:
+            syms[m.group(2)] = int(m.group(1), 16)
+            continue
+        m = re.match(r"^\s+([0-9a-f]+):\s+(\S+)\s*(.*)$", line)
+        if m:
+            ops = m.group(3).split("<")[0].split("#")[0].strip()
+            args = [ s.strip() for s in ops.split(",") ] if ops else []
+            insns[int(m.group(1), 16)] = canon(m.group(2), args)
+    return insns, syms
+
+##########################################################
+# RV64IM interpreter, enough for the kernels
+class Cpu(object):
+    RET = 0xdead0000
+
+    def __init__(self, insns):
+        self.insns = insns
+        self.r = [ 0 ] * 32
+        self.mem = {}
+
+    def load(self, addr, size):
+        return sum(self.mem.get(addr + i, 0) << (8 * i) for i in range(size))
+
+    def store(self, addr, v, size):
+        for i in range(size):
+            self.mem[addr + i] = (v >> (8 * i)) & 0xff
+
+    def call(self, pc, args, counter):
+        self.r = [ 0 ] * 32
+        self.r[1] = self.RET
+        self.r[2] = 0x7fff0000
+        for (i, a) in enumerate(args):
+            self.r[10 + i] = a & M64
+        for i in CALLEE_SAVED:
+            self.r[i] = (0x0101010101010101 * i) & M64
+        saved = list(self.r)
+        while pc != self.RET:
+            (op, a) = self.insns[pc]
+            counter.feed((op, a))
+            pc = self.step(pc, op, a)
+        for i in CALLEE_SAVED + [ 2 ]:
+            if self.r[i] != saved[i]:
+                raise Exception("%s is not preserved" % ABI[i])
+
+    def step(self, pc, op, a):
+        r = self.r
+        def R(n):
+            return r[RIDX[n]]
+        def W(n, v):
+            if RIDX[n] != 0:
+                r[RIDX[n]] = v & M64
+        def addr(opnd):
+            m = re.match(r"(-?\d+)\((\w+)\)", opnd)
+            return (int(m.group(1)) + R(m.group(2))) & M64
+        npc = pc + 4
+        if op == "add":
+            W(a[0], R(a[1]) + R(a[2]))
+        elif op == "addi":
+            W(a[0], R(a[1]) + int(a[2], 0))
+        elif op == "sub":
+            W(a[0], R(a[1]) - R(a[2]))
+        elif op == "sltu":
+            W(a[0], int(R(a[1]) < R(a[2])))
+        elif op == "sltiu":
+            W(a[0], int(R(a[1]) < (int(a[2], 0) & M64)))
+        elif op == "and":
+            W(a[0], R(a[1]) & R(a[2]))
+        elif op == "andi":
+            W(a[0], R(a[1]) & int(a[2], 0))
+        elif op == "or":
+            W(a[0], R(a[1]) | R(a[2]))
+        elif op == "ori":
+            W(a[0], R(a[1]) | int(a[2], 0))
+        elif op == "xor":
+            W(a[0], R(a[1]) ^ R(a[2]))
+        elif op == "xori":
+            W(a[0], R(a[1]) ^ int(a[2], 0))
+        elif op == "slli":
+            W(a[0], R(a[1]) << int(a[2], 0))
+        elif op == "srli":
+            W(a[0], R(a[1]) >> int(a[2], 0))
+        elif op == "srai":
+            W(a[0], sx(R(a[1])) >> int(a[2], 0))
+        elif op == "mul":
+            W(a[0], R(a[1]) * R(a[2]))
+        elif op == "mulhu":
+            W(a[0], (R(a[1]) * R(a[2])) >> 64)
+        elif op == "lui":
+            W(a[0], sx(int(a[1], 0) << 12))
+        elif op == "ld":
+            W(a[0], self.load(addr(a[1]), 8))
+        elif op == "sd":
+            self.store(addr(a[1]), R(a[0]), 8)
+        elif op == "jal":
+            W(a[0], npc)
+            npc = int(a[1], 16)
+        elif op == "jalr":
+            if len(a) == 3:
+                tgt = (R(a[1]) + int(a[2], 0)) & ~1
+            else:
+                tgt = addr(a[1]) & ~1
+            W(a[0], npc)
+            npc = tgt
+        elif op in ("beq", "bne", "bltu", "bgeu", "blt", "bge"):
+            (x, y) = (R(a[0]), R(a[1]))
+            taken = { "beq": x == y, "bne": x != y, "bltu": x < y,
+                      "bgeu": x >= y, "blt": sx(x) < sx(y),
+                      "bge": sx(x) >= sx(y) }[op]
+            if taken:
+                npc = int(a[2], 16)
+        else:
+            raise Exception("unsupported instruction %s %s" % (op, a))
+        return npc
+
+##########################################################
+def run_kernel(cpu, pc, kind, n, N, x, y, counter):
+    (RD, AD, BD, ND) = (0x1000, 0x2000, 0x3000, 0x4000)
+    def put(addr, v):
+        for i in range(n):
+            cpu.store(addr + 8 * i, (v >> (64 * i)) & M64, 8)
+    k0 = (-modinv(N, 1 << 64)) & M64
+    put(RD, 0)
+    put(AD, x)
+    put(BD, y)
+    put(ND, N)
+    if kind == "mul":
+        cpu.call(pc, [ RD, AD, BD, ND, k0 ], counter)
+    elif kind in ("add", "sub"):
+        cpu.call(pc, [ RD, AD, BD, ND ], counter)
+    elif kind in ("dbl", "tpl", "neg"):
+        cpu.call(pc, [ RD, AD, ND ], counter)
+    else:
+        cpu.call(pc, [ RD, AD, ND, k0 ], counter)
+    return sum(cpu.load(RD + 8 * i, 8) << (64 * i) for i in range(n))
+
+def jprj_ref(kind, N, P, Q):
+    # The point formulas of ll_u256_pt.h on Montgomery representations
+    Rinv = modinv(1 << 256, N)
+    def mul(a, b):
+        return a * b * Rinv % N
+    (X1, Y1, Z1) = P
+    if kind == "dbl_a3":
+        z2 = mul(Z1, Z1)
+        M = 3 * mul(X1 + z2, X1 - z2) % N
+        y2 = 2 * mul(Y1, Y1) % N
+        y4 = 2 * mul(y2, y2) % N
+        S = mul(2 * y2, X1)
+        X3 = (mul(M, M) - 2 * S) % N
+        Y3 = (mul(S - X3, M) - y4) % N
+        return (0, (X3, Y3, 2 * mul(Z1, Y1) % N))
+    (x2, y2) = Q
+    tz1 = mul(Z1, Z1)
+    h = (mul(x2, tz1) - X1) % N
+    r = (mul(y2, mul(tz1, Z1)) - Y1) % N
+    if h == 0 and r == 0:
+        return (1, None)
+    h2 = mul(h, h)
+    h3 = mul(h2, h)
+    u1 = mul(X1, h2)
+    X3 = (mul(r, r) - h3 - 2 * u1) % N
+    Y3 = (mul(u1 - X3, r) - mul(Y1, h3)) % N
+    return (0, (X3, Y3, mul(Z1, h)))
+
+def run_jprj(cpu, pc, kind, N, P, Q, alias, counter):
+    # Points as consecutive 4 limbs coordinates, rd being ad when alias
+    (RD, AD, BD, ND) = (0x1000, 0x2000, 0x3000, 0x4000)
+    if alias:
+        RD = AD
+    def put(addr, vs):
+        for (k, v) in enumerate(vs):
+            for i in range(4):
+                cpu.store(addr + 32 * k + 8 * i, (v >> (64 * i)) & M64, 8)
+    k0 = (-modinv(N, 1 << 64)) & M64
+    put(RD, [ 0, 0, 0 ])
+    put(AD, P)
+    put(BD, Q)
+    put(ND, [ N ])
+    if kind == "dbl_a3":
+        cpu.call(pc, [ RD, AD, ND, k0 ], counter)
+        ret = 0
+    else:
+        cpu.call(pc, [ RD, AD, BD, ND, k0 ], counter)
+        ret = cpu.r[10]
+    if ret != 0:
+        return (ret, None)
+    return (ret, tuple(sum(cpu.load(RD + 32 * k + 8 * i, 8) << (64 * i)
+                           for i in range(4)) for k in range(3)))
+
+def count_jprj(cpu, name, pc, kind, iters):
+    counter = Counter()
+    calls = 0
+    ret = 0
+    for N in PRIMES[4]:
+        one = (1 << 256) % N
+        for it in range(iters):
+            P = [ random.randrange(N) for _ in range(3) ]
+            Q = [ random.randrange(N) for _ in range(2) ]
+            if it == 1:
+                # Same points (doubling case), then opposite ones
+                P = [ Q[0], Q[1], one ]
+            elif it == 2:
+                P = [ Q[0], (N - Q[1]) % N, one ]
+            exp = jprj_ref(kind, N, P, Q)
+            got = run_jprj(cpu, pc, kind, N, P, Q, it & 1, counter)
+            calls += 1
+            if got != exp:
+                print("[-] %s mismatch for N = %x" % (name, N))
+                ret = 1
+                break
+    return (ret, counter, calls)
+
+def count_kernels(files, iters):
+    tmp = tempfile.mkdtemp()
+    random.seed(0)
+    ret = 0
+    print("%-36s %8s %8s %8s %8s" % ("kernel", "insns", "fused", "macro-ops",
+                                     "cycles"))
+    for (k, src) in enumerate(files):
+        obj = os.path.join(tmp, "k%d.o" % k)
+        assemble(src, obj)
+        (insns, syms) = disassemble(obj)
+        cpu = Cpu(insns)
+        for name in sorted(syms, key=lambda s: syms[s]):
+            m = re.match(r"^ll_u256_jprj_(dbl_a3|add_mixed)$", name)
+            if m:
+                (r, counter, calls) = count_jprj(cpu, name, syms[name],
+                                                 m.group(1), iters)
+                ret |= r
+                counter.report(os.path.basename(src) + ":" + name[3:], calls)
+                continue
+            m = re.match(r"^ll_u(\d+)_mont_(mul|sqr|reduce|add|sub|dbl|tpl|neg)$", name)
+            if not m or int(m.group(1)) not in LIMBS:
+                continue
+            n = LIMBS[int(m.group(1))]
+            kind = m.group(2)
+            counter = Counter()
+            calls = 0
+            for N in PRIMES[n]:
+                Rinv = modinv(1 << (64 * n), N)
+                for it in range(iters):
+                    x = random.randrange(N)
+                    y = random.randrange(N)
+                    if it < 4:
+                        (x, y) = ((0, N - 1)[it & 1], (0, N - 1)[it >> 1])
+                    exp = {
+                        "mul": lambda: x * y * Rinv,
+                        "sqr": lambda: x * x * Rinv,
+                        "reduce": lambda: x * Rinv,
+                        "add": lambda: x + y,
+                        "sub": lambda: x - y,
+                        "dbl": lambda: 2 * x,
+                        "tpl": lambda: 3 * x,
+                        "neg": lambda: -x,
+                    }[kind]() % N
+                    got = run_kernel(cpu, syms[name], kind, n, N, x, y,
+                                     counter)
+                    calls += 1
+                    if got != exp:
+                        print("[-] %s mismatch for N = %x" % (name, N))
+                        ret = 1
+                        break
+            counter.report(os.path.basename(src) + ":" + name[3:], calls)
+    return ret
+
+def count_trace(path, calls):
+    # QEMU execlog lines: cpu, pc, opcode, "disassembly"[, memory access]
+    counter = Counter()
+    with open(path) as f:
+        for line in f:
+            m = re.search(r'"([a-z.]+)\s*([^"]*)"', line)
+            if not m:
+                continue
+            ops = m.group(2).strip()
+            args = [ s.strip() for s in ops.split(",") ] if ops else []
+            counter.feed(canon(m.group(1), args))
+    print("instructions: %.1f" % (float(counter.insns) / calls))
+    print("fused pairs:  %.1f" % (float(counter.pairs) / calls))
+    print("macro-ops:    %.1f" % (float(counter.insns - counter.pairs) / calls))
+    print("cycles:       %.1f" % (float(counter.cycles) / calls))
+    return 0
+
+def usage():
+    print("Usage: %s [--iters n] file.S ..." % sys.argv[0])
+    print("       %s --trace execlog.txt [--calls n]" % sys.argv[0])
+    sys.exit(1)
+
+if __name__ == "__main__":
+    try:
+        (opts, args) = getopt.getopt(sys.argv[1:], "h", [ "trace=", "calls=", "iters=" ])
+    except getopt.GetoptError:
+        usage()
+    trace = None
+    calls = 1
+    iters = 20
+    for (o, v) in opts:
+        if o == "--trace":
+            trace = v
+        elif o == "--calls":
+            calls = int(v)
+        elif o == "--iters":
+            iters = int(v)
+        else:
+            usage()
+    if trace is not None:
+        sys.exit(count_trace(trace, calls))
+    if len(args) == 0:
+        usage()
+    sys.exit(count_kernels(args, iters))
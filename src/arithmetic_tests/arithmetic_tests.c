@@ -405,7 +405,7 @@ struct dispatch_table {
 				nn_print(&(parameters_string_names[str_pos]), &(FP_CTX_T_GENERIC_IN(j)->p)); \
 			}\
 			if(parameters_types[j] == 'f'){\
-				nn_print(&(parameters_string_names[str_pos]), &(FP_T_GENERIC_IN(j)->fp_val)); \
+				fp_print(&(parameters_string_names[str_pos]), FP_T_GENERIC_IN(j)); \
 			}\
 			if(parameters_types[j] == 'n'){\
 				nn_print(&(parameters_string_names[str_pos]), NN_T_GENERIC_IN(j));\
@@ -429,8 +429,8 @@ struct dispatch_table {
 		if(parameters_io[j] == 'o'){\
 			/* This is an input that is an output */\
 			if(parameters_types[j] == 'f'){\
-				nn_print(real_modified_string_names, &(fp_out_ptr[j]->fp_val)); \
-				nn_print(expected_modified_string_names, &(FP_T_GENERIC_IN(j)->fp_val)); \
+				fp_print(real_modified_string_names, fp_out_ptr[j]); \
+				fp_print(expected_modified_string_names, FP_T_GENERIC_IN(j)); \
 				fp_out_local_cnt++;\
 			}\
 			if(parameters_types[j] == 'n'){\
@@ -495,7 +495,7 @@ int test_##test_name(const char ATTRIBUTE_UNUSED *op, void **params, int test_nu
 	/* If we find an fp or nn, assume its length is the common length. */\
 	for(i=0; i<sizeof(parameters_io)-1; i++){\
 		if((parameters_io[i] == 'o') && (parameters_types[i] == 'f')){\
-			n_len = (FP_T_GENERIC_IN(i))->fp_val.wlen;\
+			n_len = (FP_T_GENERIC_IN(i))->ctx->p.wlen;\
 			break;\
 		}\
 		if((parameters_io[i] == 'o') && (parameters_types[i] == 'n')){\
@@ -825,7 +825,7 @@ int main(int argc, char *argv[])
 	unsigned int nn_len;
 	char op[1024];
 	char *ibuf, *rec;
-	nn *tmp;
+	nn *tmp, fp_val_tmp;
 	fp *fp_tmp;
 	int (*curr_test_fun) (const char *, void **, int);
 	unsigned long p_tmp;
@@ -1031,10 +1031,12 @@ int main(int argc, char *argv[])
 				       fp_ctx_param.p.wlen);
 				fp_tmp = fp_params_ptr[fp_local_cnt++];
 				fp_tmp->ctx = &fp_ctx_param;
-				tmp = &(fp_tmp->fp_val);
+				tmp = &fp_val_tmp;
+				nn_init(tmp, 0);
 				nn_set_wlen(tmp, (u8)(nn_len / WORD_BYTES));
 				nn_import_from_hexbuf(tmp, rec, 2 * nn_len);
-				nn_set_wlen(tmp, fp_ctx_param.p.wlen);
+				fp_set_nn(fp_tmp, tmp);
+				nn_uninit(tmp);
 				params[i] = fp_tmp;
 				ADD_TO_BACKTRACE("'f' param: %s\n", rec);
 				break;
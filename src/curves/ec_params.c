@@ -70,6 +70,11 @@ void import_params(ec_params *out_params, const ec_str_params *in_str_params)
 		    &tmp_r, &tmp_r_square,
 		    tmp_mpinv.val[0], (bitcnt_t)tmp_p_shift.val[0],
 		    &tmp_p_normalized, tmp_p_reciprocal.val[0]);
+	fp_ctx_set_chains(&(out_params->ec_fp),
+			  EC_CHAIN_PARAM_PTR(in_str_params->p_inv_chain),
+			  EC_CHAIN_PARAM_LEN(in_str_params->p_inv_chain),
+			  EC_CHAIN_PARAM_PTR(in_str_params->p_sqrt_chain),
+			  EC_CHAIN_PARAM_LEN(in_str_params->p_sqrt_chain));
 
 	/*
 	 * Having Fp context, we can import a and b, the coefficient of
@@ -91,6 +96,13 @@ void import_params(ec_params *out_params, const ec_str_params *in_str_params)
 			 PARAM_BUF_LEN(in_str_params->order));
 	nn_init(&(out_params->ec_gen_order), tmp_order.wlen * WORD_BYTES);
 	nn_copy(&(out_params->ec_gen_order), &tmp_order);
+	nn_mod_ctx_init(&(out_params->ec_gen_order_ctx), &tmp_order);
+	nn_barrett_ctx_init(&(out_params->ec_gen_order_barrett), &tmp_order);
+	if (in_str_params->q_inv_chain != NULL) {
+		nn_mod_ctx_set_inv_chain(&(out_params->ec_gen_order_ctx),
+					 PARAM_BUF_PTR(in_str_params->q_inv_chain),
+					 PARAM_BUF_LEN(in_str_params->q_inv_chain));
+	}
 
 	nn_init_from_buf(&tmp_order_bitlen,
 			 PARAM_BUF_PTR(in_str_params->order_bitlen),
@@ -128,6 +140,20 @@ void import_params(ec_params *out_params, const ec_str_params *in_str_params)
 				&(out_params->ec_curve),
 				&tmp_gx, &tmp_gy, &tmp_gz);
 
+	/* And attach its precomputed multiples, if any */
+	if (in_str_params->gen_wnaf_table != NULL) {
+		ec_shortw_crv_set_gen_tables(&(out_params->ec_curve),
+			PARAM_BUF_PTR(in_str_params->gen_wnaf_table),
+			PARAM_BUF_LEN(in_str_params->gen_wnaf_table),
+			in_str_params->gen_wnaf_table->window);
+		if (in_str_params->gen_comb_table != NULL) {
+			ec_shortw_crv_set_gen_comb(&(out_params->ec_curve),
+				PARAM_BUF_PTR(in_str_params->gen_comb_table),
+				PARAM_BUF_LEN(in_str_params->gen_comb_table),
+				in_str_params->gen_comb_table->window);
+		}
+	}
+
 	/* Import a local copy of curve OID */
 	local_memset(out_params->curve_oid, 0, MAX_CURVE_OID_LEN);
 	local_strncpy((char *)out_params->curve_oid,
@@ -68,6 +68,11 @@ typedef struct {
 	nn ec_gen_order;
 	bitcnt_t ec_gen_order_bitlen;
 
+	/* Montgomery context for scalar computations modulo the order */
+	nn_mod_ctx ec_gen_order_ctx;
+	/* Barrett context for reductions (digests, products) modulo the order */
+	nn_barrett_ctx ec_gen_order_barrett;
+
 	/* Curve cofactor */
 	nn ec_gen_cofactor;
 
@@ -32,6 +32,9 @@ void ec_shortw_crv_check_initialized(ec_shortw_crv_src_t crv)
  */
 void ec_shortw_crv_init(ec_shortw_crv_t crv, fp_src_t a, fp_src_t b, nn_src_t order)
 {
+	nn three;
+	fp tmp;
+
 	MUST_HAVE(crv != NULL);
 
 	fp_check_initialized(a);
@@ -48,8 +51,29 @@ void ec_shortw_crv_init(ec_shortw_crv_t crv, fp_src_t a, fp_src_t b, nn_src_t or
 	fp_copy(&(crv->b), b);
 	fp_redcify(&(crv->a_monty), a);
 
+	/* Select the Jacobian doubling, a = -3 being checked as a + 3 = 0 */
+	nn_init(&three, 0);
+	nn_set_word_value(&three, WORD(3));
+	fp_init(&tmp, a->ctx);
+	fp_set_nn(&tmp, &three);
+	fp_add(&tmp, &tmp, a);
+	if (fp_iszero(a)) {
+		crv->a_type = EC_SHORTW_A_ZERO;
+	} else if (fp_iszero(&tmp)) {
+		crv->a_type = EC_SHORTW_A_MINUS_3;
+	} else {
+		crv->a_type = EC_SHORTW_A_GENERIC;
+	}
+	fp_uninit(&tmp);
+	nn_uninit(&three);
+
 	nn_copy(&(crv->order), order);
 
+	crv->gen_wnaf_table = NULL;
+	crv->gen_wnaf_window = 0;
+	crv->gen_comb_table = NULL;
+	crv->gen_comb_teeth = 0;
+
 #ifndef NO_USE_COMPLETE_FORMULAS
 	fp_init(&(crv->b3), b->ctx);
 	fp_init(&(crv->b_monty), b->ctx);
@@ -63,3 +87,63 @@ void ec_shortw_crv_init(ec_shortw_crv_t crv, fp_src_t a, fp_src_t b, nn_src_t or
 
 	crv->magic = EC_SHORTW_CRV_MAGIC;
 }
+
+/*
+ * Attach to the curve the precomputed odd multiples G, 3G, ...,
+ * (2^(wnaf_window - 1) - 1)G of its generator G used by
+ * prj_pt_ec_mult_wnaf(), given as words in the internal representation
+ * of the fp layer (see ec_params_external.h). wnaf_table_len is the
+ * number of words of the table. It can be NULL, the odd multiples being
+ * then computed at each multiplication.
+ */
+void ec_shortw_crv_set_gen_tables(ec_shortw_crv_t crv, const word_t *wnaf_table,
+				  u16 wnaf_table_len, u8 wnaf_window)
+{
+	ec_shortw_crv_check_initialized(crv);
+
+	crv->gen_wnaf_table = NULL;
+	crv->gen_wnaf_window = 0;
+	if (wnaf_table == NULL) {
+		return;
+	}
+
+	/* 2^(w - 2) points, each being two elements of Fp */
+	MUST_HAVE((wnaf_window >= 2) && (wnaf_window <= 8));
+	MUST_HAVE(wnaf_table_len == ((u16)(1 << (wnaf_window - 2)) * 2 *
+				     crv->a.ctx->p.wlen));
+
+	crv->gen_wnaf_table = wnaf_table;
+	crv->gen_wnaf_window = wnaf_window;
+}
+
+/*
+ * Attach to the curve the precomputed signed comb of its generator G with
+ * comb_teeth teeth used by the fixed base multiplications of
+ * prj_pt_mul_monty() and prj_pt_mul_monty_blind(): with
+ * d = ceil(bitlen(q) / comb_teeth), point v of the table is
+ * (1 + e_1 2^d + ... + e_(comb_teeth - 1) 2^((comb_teeth - 1)d))G, e_t being
+ * 1 when bit t - 1 of v is set and -1 otherwise (see
+ * scripts/ec_gen_table.py). The generator is recognized through the first
+ * point of the wNAF table, which must then have been attached first. It
+ * can be NULL, the multiplications by G then using the generic ladder.
+ */
+void ec_shortw_crv_set_gen_comb(ec_shortw_crv_t crv, const word_t *comb_table,
+				u16 comb_table_len, u8 comb_teeth)
+{
+	ec_shortw_crv_check_initialized(crv);
+
+	crv->gen_comb_table = NULL;
+	crv->gen_comb_teeth = 0;
+	if (comb_table == NULL) {
+		return;
+	}
+
+	/* 2^(teeth - 1) points, each being two elements of Fp */
+	MUST_HAVE(crv->gen_wnaf_table != NULL);
+	MUST_HAVE((comb_teeth >= 2) && (comb_teeth <= 8));
+	MUST_HAVE(comb_table_len == ((u16)(1 << (comb_teeth - 1)) * 2 *
+				     crv->a.ctx->p.wlen));
+
+	crv->gen_comb_table = comb_table;
+	crv->gen_comb_teeth = comb_teeth;
+}
@@ -22,16 +22,40 @@
 #include "../fp/fp_mul.h"
 #include "../fp/fp_mul_redc1.h"
 
+/*
+ * Shape of the coefficient a, which selects the Jacobian doubling used by
+ * the wNAF multiplications (see _jprj_pt_dbl_monty()): a = -3 and a = 0
+ * have dedicated formulas, any other a using the generic one with a_monty.
+ */
+typedef enum {
+	EC_SHORTW_A_GENERIC = 0,
+	EC_SHORTW_A_MINUS_3 = 1,
+	EC_SHORTW_A_ZERO = 2,
+} ec_shortw_a_type;
+
 typedef struct {
 	fp a;
 	fp b;
 	fp a_monty;
+	ec_shortw_a_type a_type;
 #ifndef NO_USE_COMPLETE_FORMULAS
 	fp b3;
 	fp b_monty;
 	fp b3_monty;
 #endif
 	nn order;
+	/*
+	 * Optional odd multiples of the generator for the wNAF of window
+	 * gen_wnaf_window (see ec_shortw_crv_set_gen_tables()), NULL if none.
+	 */
+	const word_t *gen_wnaf_table;
+	u8 gen_wnaf_window;
+	/*
+	 * Optional signed comb of the generator with gen_comb_teeth teeth
+	 * (see ec_shortw_crv_set_gen_comb()), NULL if none.
+	 */
+	const word_t *gen_comb_table;
+	u8 gen_comb_teeth;
 	word_t magic;
 } ec_shortw_crv;
 
@@ -40,5 +64,9 @@ typedef const ec_shortw_crv *ec_shortw_crv_src_t;
 
 void ec_shortw_crv_check_initialized(ec_shortw_crv_src_t crv);
 void ec_shortw_crv_init(ec_shortw_crv_t crv, fp_src_t a, fp_src_t b, nn_src_t order);
+void ec_shortw_crv_set_gen_tables(ec_shortw_crv_t crv, const word_t *wnaf_table,
+				  u16 wnaf_table_len, u8 wnaf_window);
+void ec_shortw_crv_set_gen_comb(ec_shortw_crv_t crv, const word_t *comb_table,
+				u16 comb_table_len, u8 comb_teeth);
 
 #endif /* __EC_SHORTW_H__ */
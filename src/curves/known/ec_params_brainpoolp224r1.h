@@ -221,6 +221,1239 @@ TO_EC_STR_PARAM(brainpoolp224r1_oid);
 static const u8 brainpoolp224r1_name[] = "BRAINPOOLP224R1";
 TO_EC_STR_PARAM(brainpoolp224r1_name);
 
+/* x^(p - 2): 221 squarings and 51 multiplications */
+static const u8 brainpoolp224r1_p_inv[] = {
+	0x10, 0x01, 0xff,
+	0x20, 0x00, 0x01,
+	0x32, 0x00, 0x01,
+	0x43, 0x00, 0x01,
+	0x54, 0x00, 0x01,
+	0x65, 0x00, 0x01,
+	0x76, 0x00, 0x01,
+	0x87, 0x00, 0x01,
+	0x97, 0x05, 0x08,
+	0x99, 0x01, 0x00,
+	0x99, 0x09, 0x05,
+	0x99, 0x03, 0x03,
+	0x99, 0x05, 0x03,
+	0x99, 0x04, 0x03,
+	0x99, 0x07, 0x05,
+	0x99, 0x04, 0x05,
+	0x99, 0x08, 0x07,
+	0x99, 0x04, 0x05,
+	0x99, 0x03, 0x03,
+	0x99, 0x06, 0x02,
+	0x99, 0x06, 0x03,
+	0x99, 0x02, 0x00,
+	0x99, 0x06, 0x02,
+	0x99, 0x07, 0x02,
+	0x99, 0x0a, 0x05,
+	0x99, 0x05, 0x06,
+	0x99, 0x03, 0x03,
+	0x99, 0x04, 0x04,
+	0x99, 0x02, 0x00,
+	0x99, 0x06, 0x04,
+	0x99, 0x05, 0x06,
+	0x99, 0x02, 0x02,
+	0x99, 0x08, 0x08,
+	0x99, 0x03, 0x02,
+	0x99, 0x08, 0x05,
+	0x99, 0x04, 0x08,
+	0x99, 0x08, 0x04,
+	0x99, 0x04, 0x03,
+	0x99, 0x05, 0x08,
+	0x99, 0x06, 0x06,
+	0x99, 0x03, 0x04,
+	0x99, 0x05, 0x07,
+	0x99, 0x02, 0x00,
+	0x99, 0x07, 0x05,
+	0x99, 0x04, 0x08,
+	0x99, 0x04, 0x03,
+	0x99, 0x05, 0x08,
+	0x99, 0x04, 0x07,
+	0x99, 0x04, 0x05,
+	0x99, 0x05, 0x02,
+	0x99, 0x0a, 0x08,
+	0x99, 0x04, 0x07,
+};
+TO_EC_CHAIN_PARAM(brainpoolp224r1_p_inv);
+
+/* x^((p + 1) / 4): 219 squarings and 50 multiplications */
+static const u8 brainpoolp224r1_p_sqrt[] = {
+	0x10, 0x01, 0xff,
+	0x20, 0x00, 0x01,
+	0x32, 0x00, 0x01,
+	0x43, 0x00, 0x01,
+	0x54, 0x00, 0x01,
+	0x65, 0x00, 0x01,
+	0x76, 0x00, 0x01,
+	0x87, 0x00, 0x01,
+	0x97, 0x05, 0x08,
+	0x99, 0x01, 0x00,
+	0x99, 0x09, 0x05,
+	0x99, 0x03, 0x03,
+	0x99, 0x05, 0x03,
+	0x99, 0x04, 0x03,
+	0x99, 0x07, 0x05,
+	0x99, 0x04, 0x05,
+	0x99, 0x08, 0x07,
+	0x99, 0x04, 0x05,
+	0x99, 0x03, 0x03,
+	0x99, 0x06, 0x02,
+	0x99, 0x06, 0x03,
+	0x99, 0x02, 0x00,
+	0x99, 0x06, 0x02,
+	0x99, 0x07, 0x02,
+	0x99, 0x0a, 0x05,
+	0x99, 0x05, 0x06,
+	0x99, 0x03, 0x03,
+	0x99, 0x04, 0x04,
+	0x99, 0x02, 0x00,
+	0x99, 0x06, 0x04,
+	0x99, 0x05, 0x06,
+	0x99, 0x02, 0x02,
+	0x99, 0x08, 0x08,
+	0x99, 0x03, 0x02,
+	0x99, 0x08, 0x05,
+	0x99, 0x04, 0x08,
+	0x99, 0x08, 0x04,
+	0x99, 0x04, 0x03,
+	0x99, 0x05, 0x08,
+	0x99, 0x06, 0x06,
+	0x99, 0x03, 0x04,
+	0x99, 0x05, 0x07,
+	0x99, 0x02, 0x00,
+	0x99, 0x07, 0x05,
+	0x99, 0x04, 0x08,
+	0x99, 0x04, 0x03,
+	0x99, 0x05, 0x08,
+	0x99, 0x04, 0x07,
+	0x99, 0x04, 0x05,
+	0x99, 0x05, 0x02,
+	0x99, 0x06, 0x00,
+	0x99, 0x06, 0xff,
+};
+TO_EC_CHAIN_PARAM(brainpoolp224r1_p_sqrt);
+
+/* x^(q - 2): 221 squarings and 53 multiplications */
+static const u8 brainpoolp224r1_q_inv[] = {
+	0x10, 0x01, 0xff,
+	0x20, 0x00, 0x01,
+	0x32, 0x00, 0x01,
+	0x43, 0x00, 0x01,
+	0x54, 0x00, 0x01,
+	0x65, 0x00, 0x01,
+	0x76, 0x00, 0x01,
+	0x87, 0x00, 0x01,
+	0x97, 0x05, 0x08,
+	0x99, 0x01, 0x00,
+	0x99, 0x09, 0x05,
+	0x99, 0x03, 0x03,
+	0x99, 0x05, 0x03,
+	0x99, 0x04, 0x03,
+	0x99, 0x07, 0x05,
+	0x99, 0x04, 0x05,
+	0x99, 0x08, 0x07,
+	0x99, 0x04, 0x05,
+	0x99, 0x03, 0x03,
+	0x99, 0x06, 0x02,
+	0x99, 0x06, 0x03,
+	0x99, 0x02, 0x00,
+	0x99, 0x06, 0x02,
+	0x99, 0x07, 0x02,
+	0x99, 0x0a, 0x05,
+	0x99, 0x05, 0x06,
+	0x99, 0x03, 0x03,
+	0x99, 0x04, 0x04,
+	0x99, 0x02, 0x00,
+	0x99, 0x08, 0x08,
+	0x99, 0x04, 0x06,
+	0x99, 0x04, 0x05,
+	0x99, 0x01, 0x00,
+	0x99, 0x07, 0x07,
+	0x99, 0x04, 0x00,
+	0x99, 0x07, 0x06,
+	0x99, 0x05, 0x06,
+	0x99, 0x02, 0x02,
+	0x99, 0x07, 0x05,
+	0x99, 0x05, 0x07,
+	0x99, 0x04, 0x06,
+	0x99, 0x04, 0x04,
+	0x99, 0x05, 0x08,
+	0x99, 0x05, 0x06,
+	0x99, 0x02, 0x02,
+	0x99, 0x05, 0x03,
+	0x99, 0x06, 0x04,
+	0x99, 0x05, 0x05,
+	0x99, 0x05, 0x07,
+	0x99, 0x06, 0x08,
+	0x99, 0x06, 0x05,
+	0x99, 0x02, 0x02,
+	0x99, 0x05, 0x04,
+	0x99, 0x02, 0x00,
+};
+TO_EC_CHAIN_PARAM(brainpoolp224r1_q_inv);
+
+/*
+ * Odd multiples G, 3G, ..., 63G of the generator for the wNAF
+ * multiplications (window 7), affine x and y in Montgomery representation
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+static const word_t brainpoolp224r1_gen_wnaf[] = {
+	/* G */
+	WORD(0x7993ea716ad29d1b), WORD(0x4d402109cf9a7441),
+	WORD(0x5ddc6352bebd634f), WORD(0x000000000211cad8),
+	WORD(0xc4e76c808e956e51), WORD(0x8f3e2bd5f943b361),
+	WORD(0xcac7fbecf98919fa), WORD(0x00000000285b6e63),
+	/* 3G */
+	WORD(0x929caf015f363d4a), WORD(0xebfd3ec8bb2fe170),
+	WORD(0xf81289b151f8ae31), WORD(0x000000001a81c1fc),
+	WORD(0x833e51a0e68b4258), WORD(0x925921a6f8efd4fd),
+	WORD(0xcd540e0bd249f2c6), WORD(0x000000008e3e3682),
+	/* 5G */
+	WORD(0xdbbe8a9c6f4fb1bb), WORD(0xa34777c76a8098e4),
+	WORD(0xed3269d56907192b), WORD(0x00000000bd078750),
+	WORD(0xaf65dad4cfcfb971), WORD(0xa9f5b81b773da6b8),
+	WORD(0x7a901d4bc3543acc), WORD(0x0000000021ba7b85),
+	/* 7G */
+	WORD(0xeb37b68c1b6c8469), WORD(0x6c6e664fe9bd4564),
+	WORD(0xec6b495532ab74ae), WORD(0x000000009a2a984c),
+	WORD(0xc530680eacae8fd4), WORD(0x0de26e4dd9f89777),
+	WORD(0x3e229debee52646c), WORD(0x000000007912bb5e),
+	/* 9G */
+	WORD(0x9e41952526224992), WORD(0x9a3adad6206cd132),
+	WORD(0x7548bf73bf3c9672), WORD(0x000000009fc109c1),
+	WORD(0x3206212b83541135), WORD(0xb77294bc83ad3e36),
+	WORD(0x5e0e646b36f9c3ff), WORD(0x000000001009a828),
+	/* 11G */
+	WORD(0x550d584fc31728c7), WORD(0x739638cb62a05845),
+	WORD(0xe30fcb65ea60f3a4), WORD(0x000000009c33bba5),
+	WORD(0x307c0777459ced23), WORD(0x4b7b7375e6ddce9d),
+	WORD(0x1a78078f7f1896c1), WORD(0x000000005930885a),
+	/* 13G */
+	WORD(0x7c041693fc7f350a), WORD(0x0c003d3380b6f524),
+	WORD(0x4f5fad1a0baf8521), WORD(0x00000000be34acc9),
+	WORD(0xad8f1e98ce2a027f), WORD(0xfce621cd5733c501),
+	WORD(0xa14b0e5c16d9dbad), WORD(0x0000000061a162e6),
+	/* 15G */
+	WORD(0xb7c981623327d9ba), WORD(0xb86447dff54885c8),
+	WORD(0xf305828d768c19ac), WORD(0x00000000b587f0fe),
+	WORD(0x699b7cf3e16afaee), WORD(0x89a95d59830910af),
+	WORD(0x8cd3d2f455a07ae7), WORD(0x00000000366fba9b),
+	/* 17G */
+	WORD(0x7a3657019f22e87e), WORD(0x4bfe1c9ba89b717b),
+	WORD(0xcc7ca289a703375c), WORD(0x000000008780a363),
+	WORD(0xa714797656f58b82), WORD(0x11ac0b4b3aac4467),
+	WORD(0x74a31d9a0bdaebb4), WORD(0x00000000a578c0bc),
+	/* 19G */
+	WORD(0x4dbd426d66a70803), WORD(0x69068ea3fdb583c3),
+	WORD(0x68c47e9bbf74c6e4), WORD(0x00000000c552edd8),
+	WORD(0x07fd1f6cfd7671a0), WORD(0x1a037ea3066f426c),
+	WORD(0x3d7172dd82a32048), WORD(0x000000003a8c8a75),
+	/* 21G */
+	WORD(0xce442640ae31b332), WORD(0x74eb569f60d40402),
+	WORD(0x3b029d3d44c979c5), WORD(0x000000009b278854),
+	WORD(0xa6603115671d4737), WORD(0x025bb39723a2676c),
+	WORD(0x32be53cba8519870), WORD(0x00000000c8e35f8a),
+	/* 23G */
+	WORD(0x2535ea7a4f7eb818), WORD(0xcdf784602b1f49f2),
+	WORD(0xe06851102fc640de), WORD(0x000000000837fcdf),
+	WORD(0xc9ec545c558bf92b), WORD(0x39bb3a9550b49aa9),
+	WORD(0x28a0c0f2c2b6738a), WORD(0x00000000721bd78b),
+	/* 25G */
+	WORD(0xadc02dddf79786af), WORD(0x04419ce0aa2bd448),
+	WORD(0xbc9b94f91edc2b26), WORD(0x0000000075850023),
+	WORD(0xc47ef9c4306591a8), WORD(0xe2e2bc26bfd3f75b),
+	WORD(0xef0adb4c9e3f4259), WORD(0x00000000a973243d),
+	/* 27G */
+	WORD(0x23b4f9ca572ec652), WORD(0x9d80bfa801d49a68),
+	WORD(0x8c8a57bbc85a18bf), WORD(0x000000006081547f),
+	WORD(0x8f214205bf42d7bb), WORD(0x010c8b1c7bcff974),
+	WORD(0x3330409c1bc3a025), WORD(0x000000000e3be426),
+	/* 29G */
+	WORD(0x6523fb1303510834), WORD(0x405a3158b3463d84),
+	WORD(0x0fe14e9a96ca3d9f), WORD(0x00000000655564f2),
+	WORD(0x448dd80fdf15bfd0), WORD(0x07461ce8e13b8a5e),
+	WORD(0xf8756e0c12b5c603), WORD(0x000000000542f6f1),
+	/* 31G */
+	WORD(0x016d02a7ab83af2b), WORD(0x2ef373ee636fc6f8),
+	WORD(0xd9c61dfdfd3fefcd), WORD(0x0000000059d9ae1a),
+	WORD(0xd734eaeebc9f40eb), WORD(0x2e0e179f15b81b4c),
+	WORD(0x5a09c112d80f629e), WORD(0x000000006b5e04bc),
+	/* 33G */
+	WORD(0xd302fdcc0ed63670), WORD(0xa50509164ee5ffc0),
+	WORD(0xa51763c4a71dae53), WORD(0x000000004fd7f0b8),
+	WORD(0x368a2bef926e44bd), WORD(0x557ec8ccc22c17ca),
+	WORD(0x180db9b458ad1582), WORD(0x000000003abfe050),
+	/* 35G */
+	WORD(0x7412c231aeac092f), WORD(0x7bfe44f858524778),
+	WORD(0x41ef82f4de9aec1a), WORD(0x000000007845fb95),
+	WORD(0x0d2c0a554a95ece9), WORD(0x9f94b1382e7752e8),
+	WORD(0x3ed78557810f3799), WORD(0x000000003e4a9c26),
+	/* 37G */
+	WORD(0xa0929af01754b66e), WORD(0x24ba6209b161cbf0),
+	WORD(0x909cb0e0ae3b82d1), WORD(0x000000000216c995),
+	WORD(0x8f15ea2789c8e7e0), WORD(0x7dc4f4d2f8446344),
+	WORD(0x221ac78e3e7eed58), WORD(0x00000000b2371342),
+	/* 39G */
+	WORD(0xfca6f8f909776fe6), WORD(0x8a56e9ab57e0f304),
+	WORD(0xcaf2040eb04bf779), WORD(0x00000000433b3446),
+	WORD(0xf183c364f407c0f7), WORD(0x86b02979c90a2808),
+	WORD(0x62944f6fb2c6053b), WORD(0x00000000c67c8e05),
+	/* 41G */
+	WORD(0xb4bfe7c6cb3b4a3c), WORD(0xcc1fe1da77170ed3),
+	WORD(0xa37877f2030a56a8), WORD(0x00000000c9142a1c),
+	WORD(0x403e74207fe37e0f), WORD(0x843452153240077b),
+	WORD(0xf21c91f51ed8d214), WORD(0x000000006605b4df),
+	/* 43G */
+	WORD(0xb206d2c9de57991c), WORD(0xfd5222a230fa177c),
+	WORD(0x10f9d1711307b81a), WORD(0x000000001d2968f2),
+	WORD(0x1428e0919c2ceedf), WORD(0xf0993662d69ddcbd),
+	WORD(0x7b3363c6bdde1cc9), WORD(0x000000006a2bd7a3),
+	/* 45G */
+	WORD(0x278ce4cfc5c789a1), WORD(0xcc13c3e48cc6d430),
+	WORD(0x5d1c62a7f8397ab0), WORD(0x0000000026159ad5),
+	WORD(0xb099a20fae312384), WORD(0x5ce9e1205d2dadb5),
+	WORD(0x704b2152020284c0), WORD(0x0000000000775c41),
+	/* 47G */
+	WORD(0xcf8775e03a39e09b), WORD(0xccd4b924281d5427),
+	WORD(0xdcc84cf1caeb9b19), WORD(0x00000000ad58beb6),
+	WORD(0xf483621b8a3abb33), WORD(0x769b80dcbf8006ca),
+	WORD(0xe4cef15b8b441fd6), WORD(0x0000000015db6dcd),
+	/* 49G */
+	WORD(0x1110c62c6c119ceb), WORD(0x4ae8d6697cb785a8),
+	WORD(0x175f3935985c3474), WORD(0x000000007c0c1184),
+	WORD(0x7dbf8fedc7e7a1b5), WORD(0x8bc10084cb4979df),
+	WORD(0x0ec105abdcd96a78), WORD(0x000000002e9c9a36),
+	/* 51G */
+	WORD(0x077d633d9114c6a1), WORD(0x7fe5e78f359e70b6),
+	WORD(0xa767e41ba7df3714), WORD(0x0000000060d72d35),
+	WORD(0x24447b1de1b0bf33), WORD(0x2a7c613db18c2905),
+	WORD(0x857440937774c3e3), WORD(0x00000000b0ecbb9a),
+	/* 53G */
+	WORD(0x184bb06b49e2685d), WORD(0x85eaed5177ebd1f7),
+	WORD(0x817aced779399ca8), WORD(0x000000000d4d7462),
+	WORD(0x7ba0fa248c02d1a4), WORD(0xbd1eb16dce79906b),
+	WORD(0x730e608c33cfc96a), WORD(0x00000000c436c619),
+	/* 55G */
+	WORD(0x42016665b7d42f27), WORD(0xa915b271213a8234),
+	WORD(0x54c027c60d024eae), WORD(0x00000000d4ed51d8),
+	WORD(0x2293959b39904b99), WORD(0x98792a2493405659),
+	WORD(0x78d59c56864db8e1), WORD(0x000000006f000097),
+	/* 57G */
+	WORD(0xc410b036e3ffb904), WORD(0xe579c0f984958300),
+	WORD(0x3ace9eb6eca2fdc4), WORD(0x00000000d0333743),
+	WORD(0x88157ac58604f991), WORD(0x0132349a6d48215b),
+	WORD(0xad43f81924084a39), WORD(0x00000000400113c5),
+	/* 59G */
+	WORD(0x0f752f6feffcccbf), WORD(0x98e7c2eb2949148b),
+	WORD(0x1b9e0f7113cfe2b4), WORD(0x00000000a9e28284),
+	WORD(0x73e30444e14eba83), WORD(0xedf3c918068ce36a),
+	WORD(0x08b7ec7db0c28d35), WORD(0x00000000200a5d51),
+	/* 61G */
+	WORD(0xe505638aef068c65), WORD(0x9566c7bce94ca9f8),
+	WORD(0x2ebe4ab9840b0f7f), WORD(0x00000000c9b0c87b),
+	WORD(0x47d7c92debff4286), WORD(0x43720cbdff4068cd),
+	WORD(0x2e9e7e4e966846ec), WORD(0x0000000053190c02),
+	/* 63G */
+	WORD(0x3af5cc595fab3c80), WORD(0x59bde53d94911302),
+	WORD(0x588381ee4f7696be), WORD(0x00000000750d98d5),
+	WORD(0xa4ea117d57ff484d), WORD(0x4aa2500e89b12f62),
+	WORD(0x88ba9d922055ef47), WORD(0x00000000134cd1c7),
+};
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+static const word_t brainpoolp224r1_gen_wnaf[] = {
+	/* G */
+	WORD(0x234bfb4b), WORD(0x31fdc9d7), WORD(0xb5e4939a), WORD(0x19886fa3),
+	WORD(0xb1cc327a), WORD(0x29c4eb1d), WORD(0x9d928506), WORD(0x258adb1a),
+	WORD(0x3ff9013c), WORD(0x3e5d0f80), WORD(0x4c141f60), WORD(0x89de7323),
+	WORD(0x22b9dc72), WORD(0xba215755),
+	/* 3G */
+	WORD(0xf3a732c2), WORD(0x09e82bb0), WORD(0x2b54a32a), WORD(0x4853f3ce),
+	WORD(0x6dc8839e), WORD(0x60efe7ee), WORD(0xa8274d75), WORD(0x9d52ede5),
+	WORD(0x24b38c7d), WORD(0x0bdeab60), WORD(0xcf7e0a69), WORD(0x4bf10e69),
+	WORD(0x8f03a334), WORD(0x2093eeef),
+	/* 5G */
+	WORD(0x0d5611e4), WORD(0x1cfc167a), WORD(0x21750d00), WORD(0x2259a68e),
+	WORD(0x225a13c1), WORD(0xc7f65ae8), WORD(0x775cd456), WORD(0x65717782),
+	WORD(0x4de811f1), WORD(0x55a66fdb), WORD(0x872015c8), WORD(0x6fd4ee8d),
+	WORD(0xadb3506b), WORD(0x842edd2f),
+	/* 7G */
+	WORD(0xa8f1e204), WORD(0x5f45f37c), WORD(0x5b506e32), WORD(0xd55e411f),
+	WORD(0x4ff4239b), WORD(0x09ac1f1a), WORD(0xcf7caefc), WORD(0xb1d14e36),
+	WORD(0xd5d76fa8), WORD(0x98df9494), WORD(0x88e7fee2), WORD(0xde922cb8),
+	WORD(0xb46d6a85), WORD(0x85a3c712),
+	/* 9G */
+	WORD(0x952658c9), WORD(0x15000474), WORD(0x5839ecd6), WORD(0x91c1d00a),
+	WORD(0xb295cacc), WORD(0x003c625d), WORD(0x403f6257), WORD(0xe6310238),
+	WORD(0x09947faa), WORD(0xaf0cc599), WORD(0xa043e811), WORD(0x27ea5b70),
+	WORD(0x8938ee09), WORD(0x5219902f),
+	/* 11G */
+	WORD(0x6046853b), WORD(0xd11fd40d), WORD(0xef300e24), WORD(0x020ac05a),
+	WORD(0xe6699983), WORD(0xdb1f94cb), WORD(0xa24dcb76), WORD(0x5868919b),
+	WORD(0xa45489b6), WORD(0x5999ae46), WORD(0xac913ead), WORD(0x5df5d64c),
+	WORD(0x44f8df1a), WORD(0xcfa3fcd8),
+	/* 13G */
+	WORD(0xdc857ef7), WORD(0xa21704e5), WORD(0x6e7de2f5), WORD(0xb85681c3),
+	WORD(0x91c12055), WORD(0x0f2e5b75), WORD(0xad0dfb55), WORD(0xd7caa7c8),
+	WORD(0x93004ed6), WORD(0xec497a35), WORD(0xe9130976), WORD(0x57a679d1),
+	WORD(0x3bfd276f), WORD(0xaead7c79),
+	/* 15G */
+	WORD(0xb34297b0), WORD(0x1155d1fa), WORD(0x5516f086), WORD(0x593bc262),
+	WORD(0x8e11ba1e), WORD(0x9f6e12dd), WORD(0xade6dbaa), WORD(0x2ba93e7e),
+	WORD(0xf8938530), WORD(0xb5c48480), WORD(0x703c8191), WORD(0x662978b9),
+	WORD(0xc20b5aa3), WORD(0x39b31d7a),
+	/* 17G */
+	WORD(0x2ff6f071), WORD(0x8089c705), WORD(0x92826d4a), WORD(0x0bf68871),
+	WORD(0x0c798fa1), WORD(0x5d1a408a), WORD(0xd2fcc259), WORD(0xf1ce177b),
+	WORD(0x7499805a), WORD(0x921fff6c), WORD(0x1bb7092a), WORD(0x64779fb7),
+	WORD(0xbb226bc4), WORD(0x6b3523a2),
+	/* 19G */
+	WORD(0xf82c89bb), WORD(0x38ff16bd), WORD(0x874c8fc0), WORD(0xe05363a5),
+	WORD(0xb052f996), WORD(0x937be823), WORD(0x358ec8d7), WORD(0xadfbb067),
+	WORD(0x82defeba), WORD(0x31bfc0b5), WORD(0x1867d369), WORD(0xecfd7883),
+	WORD(0xe9384087), WORD(0x43367f02),
+	/* 21G */
+	WORD(0x1ee6b5f3), WORD(0x65c0e1f3), WORD(0x18f2ff2e), WORD(0x888b4195),
+	WORD(0x0b0d387e), WORD(0x570ac624), WORD(0x29c24e07), WORD(0x05fbc189),
+	WORD(0x47110282), WORD(0xe48485bf), WORD(0x82a938ab), WORD(0x59663f68),
+	WORD(0xa588aa8e), WORD(0x1a898746),
+	/* 23G */
+	WORD(0xa2733548), WORD(0xd5c9e2ac), WORD(0x1f4d00a9), WORD(0x0bedeacb),
+	WORD(0x370cafbe), WORD(0x98fb2dcb), WORD(0x5da86d5d), WORD(0xcfc5c191),
+	WORD(0x828a5e1c), WORD(0xd56728e4), WORD(0x3702091b), WORD(0x87a403a7),
+	WORD(0x5ab2a763), WORD(0x9841c43e),
+	/* 25G */
+	WORD(0x48db8e92), WORD(0xec71f80e), WORD(0xe944f364), WORD(0x1cd0973e),
+	WORD(0xfa5368ce), WORD(0x02f921e5), WORD(0x5a34e23c), WORD(0xb247e0cb),
+	WORD(0x627bc8e6), WORD(0xac4bf889), WORD(0xc9618c5d), WORD(0x8a6bd558),
+	WORD(0x68b629c6), WORD(0xcdbcc7ad),
+	/* 27G */
+	WORD(0xef86511d), WORD(0x6c6056f4), WORD(0x874e2e13), WORD(0xe04e81ed),
+	WORD(0x3b059c7f), WORD(0xdd9f7c36), WORD(0x30f32166), WORD(0x5914ff50),
+	WORD(0x9d489048), WORD(0xc86a7a9b), WORD(0xdba63767), WORD(0xd6e3db17),
+	WORD(0xdde63f08), WORD(0x02b7ff3c),
+	/* 29G */
+	WORD(0x35be286c), WORD(0xeafcac8c), WORD(0xb28ab68b), WORD(0x054ec9d9),
+	WORD(0xa9b4e29e), WORD(0x60484468), WORD(0x1f75eabf), WORD(0x18b19e28),
+	WORD(0x55ede875), WORD(0x4afd5625), WORD(0x17fd659f), WORD(0x66bca417),
+	WORD(0xb7115786), WORD(0xa7b880e5),
+	/* 31G */
+	WORD(0xcf871e45), WORD(0x908417a2), WORD(0xbdf169a5), WORD(0x848495a6),
+	WORD(0x1099c81f), WORD(0x37312166), WORD(0x950945c5), WORD(0xda69ece8),
+	WORD(0x7e61c125), WORD(0x5a167f92), WORD(0x243a9648), WORD(0xc4a5b6b7),
+	WORD(0x5d05d8ed), WORD(0xb836c5be),
+	/* 33G */
+	WORD(0xaf6c4749), WORD(0x7d1c38b3), WORD(0xd03632f2), WORD(0x0aa524e6),
+	WORD(0x0b9bd20d), WORD(0xd858e433), WORD(0x6f17b733), WORD(0xa15d5672),
+	WORD(0xb83ed730), WORD(0x6257332f), WORD(0x467d9b67), WORD(0x0d17c21c),
+	WORD(0xe7adbc5f), WORD(0x5a4d9337),
+	/* 35G */
+	WORD(0xfe079e78), WORD(0x517a8873), WORD(0x8285d451), WORD(0x4ed39de6),
+	WORD(0xe0d58615), WORD(0xf2930f21), WORD(0x42942cc9), WORD(0xd36c4003),
+	WORD(0xf7285a61), WORD(0xf57a95ff), WORD(0x1794ed57), WORD(0xbf8c870b),
+	WORD(0xb7b9489d), WORD(0x8ef7925f),
+	/* 37G */
+	WORD(0xc7a31e91), WORD(0xa3427ac2), WORD(0xeb25fcf5), WORD(0xf16c0f31),
+	WORD(0xdbcc44a9), WORD(0x492b7805), WORD(0x8dc90eab), WORD(0x83e9dcdd),
+	WORD(0xd371c4d0), WORD(0xe47538b4), WORD(0xc3016cc2), WORD(0xb4989af7),
+	WORD(0xd7147e99), WORD(0xd74f3e7a),
+	/* 39G */
+	WORD(0x65cea0c0), WORD(0x548d968f), WORD(0xf0ffa2c3), WORD(0x808f67b1),
+	WORD(0xa496541f), WORD(0xb8a6ffa4), WORD(0x1dd89cb7), WORD(0x17065073),
+	WORD(0x3de40582), WORD(0x3a115b94), WORD(0xe1eb0ff2), WORD(0x8f9f27fe),
+	WORD(0x980dc09b), WORD(0xc529ef0c),
+	/* 41G */
+	WORD(0x940092fd), WORD(0xe5ce1ddb), WORD(0x7425fa74), WORD(0xfcceeb14),
+	WORD(0x0e6b17c9), WORD(0xa8ddd201), WORD(0x556167c7), WORD(0x32c3d46b),
+	WORD(0x54a8bb9d), WORD(0xf2458927), WORD(0xab63cce4), WORD(0xeda4b4ed),
+	WORD(0x82a4e1ed), WORD(0x1dab1283),
+	/* 43G */
+	WORD(0xfad65b8e), WORD(0xe14ab970), WORD(0x9500c188), WORD(0xa9ab2e97),
+	WORD(0xc861e093), WORD(0xed882a71), WORD(0x2690378d), WORD(0xb2ddae67),
+	WORD(0x0745c6c3), WORD(0x54c0ad56), WORD(0xe13ce111), WORD(0x335cb7f7),
+	WORD(0x0ac1f611), WORD(0x80d27d7d),
+	/* 45G */
+	WORD(0xd641db71), WORD(0xbf3e6de3), WORD(0x02d2917c), WORD(0xb26c78d1),
+	WORD(0x91144c2b), WORD(0x10f8888c), WORD(0xce04fffa), WORD(0xf8ddc544),
+	WORD(0x94b00fe3), WORD(0x2b085ff6), WORD(0x20be16e2), WORD(0x8ea9fa5b),
+	WORD(0xb9a520aa), WORD(0xbb9cbad4),
+	/* 47G */
+	WORD(0xf60958dd), WORD(0xc5901ebb), WORD(0x75c43c35), WORD(0x5e15a283),
+	WORD(0xe6626bbe), WORD(0x684dfb83), WORD(0x1e22b0f9), WORD(0xc1d64db7),
+	WORD(0xd881856b), WORD(0xc6074d45), WORD(0x73d6dc07), WORD(0xc28aee6a),
+	WORD(0xa1175665), WORD(0x04f99c4d),
+	/* 49G */
+	WORD(0x3c3cb0e3), WORD(0x96abde41), WORD(0x550b40c7), WORD(0x4d9f8bf1),
+	WORD(0x0c607bd6), WORD(0xd6a0c950), WORD(0xd58c59be), WORD(0x98df71c2),
+	WORD(0x2f57e8bf), WORD(0x1e319b62), WORD(0xed0f88e7), WORD(0xaa30ad80),
+	WORD(0x50de726f), WORD(0x822701d6),
+	/* 51G */
+	WORD(0xc73da6c8), WORD(0x70c59c78), WORD(0x0a6c88ef), WORD(0x42cc0e7e),
+	WORD(0x7715dc9f), WORD(0x86307ada), WORD(0x50b01d95), WORD(0x58309fd4),
+	WORD(0x77386aae), WORD(0xf3f88786), WORD(0xac055195), WORD(0x17cd5ba2),
+	WORD(0x7368135f), WORD(0x6723fd9d),
+	/* 53G */
+	WORD(0x1beb6bea), WORD(0x990f995a), WORD(0xb06cfeea), WORD(0x223f3b67),
+	WORD(0xc54bbc61), WORD(0x370b3e76), WORD(0x66e43658), WORD(0x27ce77a9),
+	WORD(0x5a795d6f), WORD(0xcd12287b), WORD(0x00aea258), WORD(0x67805612),
+	WORD(0x0ddd919d), WORD(0x7ff52d75),
+	/* 55G */
+	WORD(0x9d6db715), WORD(0x71e710fc), WORD(0x9c68437a), WORD(0xbd5a4a15),
+	WORD(0x04c0186f), WORD(0x282c6746), WORD(0x581204cb), WORD(0xcf976cf2),
+	WORD(0xc803417d), WORD(0x4fc58ade), WORD(0x7b1552b1), WORD(0x951281cf),
+	WORD(0x77f1232c), WORD(0x0895b340),
+	/* 57G */
+	WORD(0x27a62d4a), WORD(0xbba0e7b5), WORD(0xda7e9242), WORD(0x0c1f9518),
+	WORD(0x240078cd), WORD(0xb53fa9c0), WORD(0xce2ac67f), WORD(0x9dc2669c),
+	WORD(0x351bfbcd), WORD(0xc98d58f7), WORD(0xb9849220), WORD(0x9d40c90b),
+	WORD(0x01060f11), WORD(0xbe104dc1),
+	/* 59G */
+	WORD(0x09f75b7d), WORD(0x11a0af43), WORD(0xa7639982), WORD(0xb6e9e64c),
+	WORD(0x4b68c7e7), WORD(0xb11f0f00), WORD(0xa86650e1), WORD(0xc38881bf),
+	WORD(0xa6b228aa), WORD(0xe1a4d653), WORD(0xfc3e17d6), WORD(0xfa4dd304),
+	WORD(0xa65f3e5d), WORD(0x77e893d2),
+	/* 61G */
+	WORD(0xffcb1fd3), WORD(0x4da76330), WORD(0x4983748c), WORD(0x2d0ea4b7),
+	WORD(0x811edf44), WORD(0xfdb10bf8), WORD(0x918682f2), WORD(0xb3a1c7d7),
+	WORD(0x0d0d8272), WORD(0xb84b465e), WORD(0xad7f7ccf), WORD(0x29639224),
+	WORD(0x783953de), WORD(0x170f271c),
+	/* 63G */
+	WORD(0x971c887a), WORD(0x8bc7eb61), WORD(0x960e6404), WORD(0xbdcea943),
+	WORD(0x05014f42), WORD(0x60f75ed4), WORD(0x2fda9993), WORD(0x7c7f560e),
+	WORD(0x0f92f5d1), WORD(0x786a8381), WORD(0x85e8d598), WORD(0x41d4ab90),
+	WORD(0x58ea1c57), WORD(0x149dd7e2),
+};
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+static const word_t brainpoolp224r1_gen_wnaf[] = {
+	/* G */
+	WORD(0xfb4b), WORD(0x234b), WORD(0xc9d7), WORD(0x31fd), WORD(0x939a), WORD(0xb5e4),
+	WORD(0x6fa3), WORD(0x1988), WORD(0x327a), WORD(0xb1cc), WORD(0xeb1d), WORD(0x29c4),
+	WORD(0x8506), WORD(0x9d92), WORD(0xdb1a), WORD(0x258a), WORD(0x013c), WORD(0x3ff9),
+	WORD(0x0f80), WORD(0x3e5d), WORD(0x1f60), WORD(0x4c14), WORD(0x7323), WORD(0x89de),
+	WORD(0xdc72), WORD(0x22b9), WORD(0x5755), WORD(0xba21),
+	/* 3G */
+	WORD(0x32c2), WORD(0xf3a7), WORD(0x2bb0), WORD(0x09e8), WORD(0xa32a), WORD(0x2b54),
+	WORD(0xf3ce), WORD(0x4853), WORD(0x839e), WORD(0x6dc8), WORD(0xe7ee), WORD(0x60ef),
+	WORD(0x4d75), WORD(0xa827), WORD(0xede5), WORD(0x9d52), WORD(0x8c7d), WORD(0x24b3),
+	WORD(0xab60), WORD(0x0bde), WORD(0x0a69), WORD(0xcf7e), WORD(0x0e69), WORD(0x4bf1),
+	WORD(0xa334), WORD(0x8f03), WORD(0xeeef), WORD(0x2093),
+	/* 5G */
+	WORD(0x11e4), WORD(0x0d56), WORD(0x167a), WORD(0x1cfc), WORD(0x0d00), WORD(0x2175),
+	WORD(0xa68e), WORD(0x2259), WORD(0x13c1), WORD(0x225a), WORD(0x5ae8), WORD(0xc7f6),
+	WORD(0xd456), WORD(0x775c), WORD(0x7782), WORD(0x6571), WORD(0x11f1), WORD(0x4de8),
+	WORD(0x6fdb), WORD(0x55a6), WORD(0x15c8), WORD(0x8720), WORD(0xee8d), WORD(0x6fd4),
+	WORD(0x506b), WORD(0xadb3), WORD(0xdd2f), WORD(0x842e),
+	/* 7G */
+	WORD(0xe204), WORD(0xa8f1), WORD(0xf37c), WORD(0x5f45), WORD(0x6e32), WORD(0x5b50),
+	WORD(0x411f), WORD(0xd55e), WORD(0x239b), WORD(0x4ff4), WORD(0x1f1a), WORD(0x09ac),
+	WORD(0xaefc), WORD(0xcf7c), WORD(0x4e36), WORD(0xb1d1), WORD(0x6fa8), WORD(0xd5d7),
+	WORD(0x9494), WORD(0x98df), WORD(0xfee2), WORD(0x88e7), WORD(0x2cb8), WORD(0xde92),
+	WORD(0x6a85), WORD(0xb46d), WORD(0xc712), WORD(0x85a3),
+	/* 9G */
+	WORD(0x58c9), WORD(0x9526), WORD(0x0474), WORD(0x1500), WORD(0xecd6), WORD(0x5839),
+	WORD(0xd00a), WORD(0x91c1), WORD(0xcacc), WORD(0xb295), WORD(0x625d), WORD(0x003c),
+	WORD(0x6257), WORD(0x403f), WORD(0x0238), WORD(0xe631), WORD(0x7faa), WORD(0x0994),
+	WORD(0xc599), WORD(0xaf0c), WORD(0xe811), WORD(0xa043), WORD(0x5b70), WORD(0x27ea),
+	WORD(0xee09), WORD(0x8938), WORD(0x902f), WORD(0x5219),
+	/* 11G */
+	WORD(0x853b), WORD(0x6046), WORD(0xd40d), WORD(0xd11f), WORD(0x0e24), WORD(0xef30),
+	WORD(0xc05a), WORD(0x020a), WORD(0x9983), WORD(0xe669), WORD(0x94cb), WORD(0xdb1f),
+	WORD(0xcb76), WORD(0xa24d), WORD(0x919b), WORD(0x5868), WORD(0x89b6), WORD(0xa454),
+	WORD(0xae46), WORD(0x5999), WORD(0x3ead), WORD(0xac91), WORD(0xd64c), WORD(0x5df5),
+	WORD(0xdf1a), WORD(0x44f8), WORD(0xfcd8), WORD(0xcfa3),
+	/* 13G */
+	WORD(0x7ef7), WORD(0xdc85), WORD(0x04e5), WORD(0xa217), WORD(0xe2f5), WORD(0x6e7d),
+	WORD(0x81c3), WORD(0xb856), WORD(0x2055), WORD(0x91c1), WORD(0x5b75), WORD(0x0f2e),
+	WORD(0xfb55), WORD(0xad0d), WORD(0xa7c8), WORD(0xd7ca), WORD(0x4ed6), WORD(0x9300),
+	WORD(0x7a35), WORD(0xec49), WORD(0x0976), WORD(0xe913), WORD(0x79d1), WORD(0x57a6),
+	WORD(0x276f), WORD(0x3bfd), WORD(0x7c79), WORD(0xaead),
+	/* 15G */
+	WORD(0x97b0), WORD(0xb342), WORD(0xd1fa), WORD(0x1155), WORD(0xf086), WORD(0x5516),
+	WORD(0xc262), WORD(0x593b), WORD(0xba1e), WORD(0x8e11), WORD(0x12dd), WORD(0x9f6e),
+	WORD(0xdbaa), WORD(0xade6), WORD(0x3e7e), WORD(0x2ba9), WORD(0x8530), WORD(0xf893),
+	WORD(0x8480), WORD(0xb5c4), WORD(0x8191), WORD(0x703c), WORD(0x78b9), WORD(0x6629),
+	WORD(0x5aa3), WORD(0xc20b), WORD(0x1d7a), WORD(0x39b3),
+	/* 17G */
+	WORD(0xf071), WORD(0x2ff6), WORD(0xc705), WORD(0x8089), WORD(0x6d4a), WORD(0x9282),
+	WORD(0x8871), WORD(0x0bf6), WORD(0x8fa1), WORD(0x0c79), WORD(0x408a), WORD(0x5d1a),
+	WORD(0xc259), WORD(0xd2fc), WORD(0x177b), WORD(0xf1ce), WORD(0x805a), WORD(0x7499),
+	WORD(0xff6c), WORD(0x921f), WORD(0x092a), WORD(0x1bb7), WORD(0x9fb7), WORD(0x6477),
+	WORD(0x6bc4), WORD(0xbb22), WORD(0x23a2), WORD(0x6b35),
+	/* 19G */
+	WORD(0x89bb), WORD(0xf82c), WORD(0x16bd), WORD(0x38ff), WORD(0x8fc0), WORD(0x874c),
+	WORD(0x63a5), WORD(0xe053), WORD(0xf996), WORD(0xb052), WORD(0xe823), WORD(0x937b),
+	WORD(0xc8d7), WORD(0x358e), WORD(0xb067), WORD(0xadfb), WORD(0xfeba), WORD(0x82de),
+	WORD(0xc0b5), WORD(0x31bf), WORD(0xd369), WORD(0x1867), WORD(0x7883), WORD(0xecfd),
+	WORD(0x4087), WORD(0xe938), WORD(0x7f02), WORD(0x4336),
+	/* 21G */
+	WORD(0xb5f3), WORD(0x1ee6), WORD(0xe1f3), WORD(0x65c0), WORD(0xff2e), WORD(0x18f2),
+	WORD(0x4195), WORD(0x888b), WORD(0x387e), WORD(0x0b0d), WORD(0xc624), WORD(0x570a),
+	WORD(0x4e07), WORD(0x29c2), WORD(0xc189), WORD(0x05fb), WORD(0x0282), WORD(0x4711),
+	WORD(0x85bf), WORD(0xe484), WORD(0x38ab), WORD(0x82a9), WORD(0x3f68), WORD(0x5966),
+	WORD(0xaa8e), WORD(0xa588), WORD(0x8746), WORD(0x1a89),
+	/* 23G */
+	WORD(0x3548), WORD(0xa273), WORD(0xe2ac), WORD(0xd5c9), WORD(0x00a9), WORD(0x1f4d),
+	WORD(0xeacb), WORD(0x0bed), WORD(0xafbe), WORD(0x370c), WORD(0x2dcb), WORD(0x98fb),
+	WORD(0x6d5d), WORD(0x5da8), WORD(0xc191), WORD(0xcfc5), WORD(0x5e1c), WORD(0x828a),
+	WORD(0x28e4), WORD(0xd567), WORD(0x091b), WORD(0x3702), WORD(0x03a7), WORD(0x87a4),
+	WORD(0xa763), WORD(0x5ab2), WORD(0xc43e), WORD(0x9841),
+	/* 25G */
+	WORD(0x8e92), WORD(0x48db), WORD(0xf80e), WORD(0xec71), WORD(0xf364), WORD(0xe944),
+	WORD(0x973e), WORD(0x1cd0), WORD(0x68ce), WORD(0xfa53), WORD(0x21e5), WORD(0x02f9),
+	WORD(0xe23c), WORD(0x5a34), WORD(0xe0cb), WORD(0xb247), WORD(0xc8e6), WORD(0x627b),
+	WORD(0xf889), WORD(0xac4b), WORD(0x8c5d), WORD(0xc961), WORD(0xd558), WORD(0x8a6b),
+	WORD(0x29c6), WORD(0x68b6), WORD(0xc7ad), WORD(0xcdbc),
+	/* 27G */
+	WORD(0x511d), WORD(0xef86), WORD(0x56f4), WORD(0x6c60), WORD(0x2e13), WORD(0x874e),
+	WORD(0x81ed), WORD(0xe04e), WORD(0x9c7f), WORD(0x3b05), WORD(0x7c36), WORD(0xdd9f),
+	WORD(0x2166), WORD(0x30f3), WORD(0xff50), WORD(0x5914), WORD(0x9048), WORD(0x9d48),
+	WORD(0x7a9b), WORD(0xc86a), WORD(0x3767), WORD(0xdba6), WORD(0xdb17), WORD(0xd6e3),
+	WORD(0x3f08), WORD(0xdde6), WORD(0xff3c), WORD(0x02b7),
+	/* 29G */
+	WORD(0x286c), WORD(0x35be), WORD(0xac8c), WORD(0xeafc), WORD(0xb68b), WORD(0xb28a),
+	WORD(0xc9d9), WORD(0x054e), WORD(0xe29e), WORD(0xa9b4), WORD(0x4468), WORD(0x6048),
+	WORD(0xeabf), WORD(0x1f75), WORD(0x9e28), WORD(0x18b1), WORD(0xe875), WORD(0x55ed),
+	WORD(0x5625), WORD(0x4afd), WORD(0x659f), WORD(0x17fd), WORD(0xa417), WORD(0x66bc),
+	WORD(0x5786), WORD(0xb711), WORD(0x80e5), WORD(0xa7b8),
+	/* 31G */
+	WORD(0x1e45), WORD(0xcf87), WORD(0x17a2), WORD(0x9084), WORD(0x69a5), WORD(0xbdf1),
+	WORD(0x95a6), WORD(0x8484), WORD(0xc81f), WORD(0x1099), WORD(0x2166), WORD(0x3731),
+	WORD(0x45c5), WORD(0x9509), WORD(0xece8), WORD(0xda69), WORD(0xc125), WORD(0x7e61),
+	WORD(0x7f92), WORD(0x5a16), WORD(0x9648), WORD(0x243a), WORD(0xb6b7), WORD(0xc4a5),
+	WORD(0xd8ed), WORD(0x5d05), WORD(0xc5be), WORD(0xb836),
+	/* 33G */
+	WORD(0x4749), WORD(0xaf6c), WORD(0x38b3), WORD(0x7d1c), WORD(0x32f2), WORD(0xd036),
+	WORD(0x24e6), WORD(0x0aa5), WORD(0xd20d), WORD(0x0b9b), WORD(0xe433), WORD(0xd858),
+	WORD(0xb733), WORD(0x6f17), WORD(0x5672), WORD(0xa15d), WORD(0xd730), WORD(0xb83e),
+	WORD(0x332f), WORD(0x6257), WORD(0x9b67), WORD(0x467d), WORD(0xc21c), WORD(0x0d17),
+	WORD(0xbc5f), WORD(0xe7ad), WORD(0x9337), WORD(0x5a4d),
+	/* 35G */
+	WORD(0x9e78), WORD(0xfe07), WORD(0x8873), WORD(0x517a), WORD(0xd451), WORD(0x8285),
+	WORD(0x9de6), WORD(0x4ed3), WORD(0x8615), WORD(0xe0d5), WORD(0x0f21), WORD(0xf293),
+	WORD(0x2cc9), WORD(0x4294), WORD(0x4003), WORD(0xd36c), WORD(0x5a61), WORD(0xf728),
+	WORD(0x95ff), WORD(0xf57a), WORD(0xed57), WORD(0x1794), WORD(0x870b), WORD(0xbf8c),
+	WORD(0x489d), WORD(0xb7b9), WORD(0x925f), WORD(0x8ef7),
+	/* 37G */
+	WORD(0x1e91), WORD(0xc7a3), WORD(0x7ac2), WORD(0xa342), WORD(0xfcf5), WORD(0xeb25),
+	WORD(0x0f31), WORD(0xf16c), WORD(0x44a9), WORD(0xdbcc), WORD(0x7805), WORD(0x492b),
+	WORD(0x0eab), WORD(0x8dc9), WORD(0xdcdd), WORD(0x83e9), WORD(0xc4d0), WORD(0xd371),
+	WORD(0x38b4), WORD(0xe475), WORD(0x6cc2), WORD(0xc301), WORD(0x9af7), WORD(0xb498),
+	WORD(0x7e99), WORD(0xd714), WORD(0x3e7a), WORD(0xd74f),
+	/* 39G */
+	WORD(0xa0c0), WORD(0x65ce), WORD(0x968f), WORD(0x548d), WORD(0xa2c3), WORD(0xf0ff),
+	WORD(0x67b1), WORD(0x808f), WORD(0x541f), WORD(0xa496), WORD(0xffa4), WORD(0xb8a6),
+	WORD(0x9cb7), WORD(0x1dd8), WORD(0x5073), WORD(0x1706), WORD(0x0582), WORD(0x3de4),
+	WORD(0x5b94), WORD(0x3a11), WORD(0x0ff2), WORD(0xe1eb), WORD(0x27fe), WORD(0x8f9f),
+	WORD(0xc09b), WORD(0x980d), WORD(0xef0c), WORD(0xc529),
+	/* 41G */
+	WORD(0x92fd), WORD(0x9400), WORD(0x1ddb), WORD(0xe5ce), WORD(0xfa74), WORD(0x7425),
+	WORD(0xeb14), WORD(0xfcce), WORD(0x17c9), WORD(0x0e6b), WORD(0xd201), WORD(0xa8dd),
+	WORD(0x67c7), WORD(0x5561), WORD(0xd46b), WORD(0x32c3), WORD(0xbb9d), WORD(0x54a8),
+	WORD(0x8927), WORD(0xf245), WORD(0xcce4), WORD(0xab63), WORD(0xb4ed), WORD(0xeda4),
+	WORD(0xe1ed), WORD(0x82a4), WORD(0x1283), WORD(0x1dab),
+	/* 43G */
+	WORD(0x5b8e), WORD(0xfad6), WORD(0xb970), WORD(0xe14a), WORD(0xc188), WORD(0x9500),
+	WORD(0x2e97), WORD(0xa9ab), WORD(0xe093), WORD(0xc861), WORD(0x2a71), WORD(0xed88),
+	WORD(0x378d), WORD(0x2690), WORD(0xae67), WORD(0xb2dd), WORD(0xc6c3), WORD(0x0745),
+	WORD(0xad56), WORD(0x54c0), WORD(0xe111), WORD(0xe13c), WORD(0xb7f7), WORD(0x335c),
+	WORD(0xf611), WORD(0x0ac1), WORD(0x7d7d), WORD(0x80d2),
+	/* 45G */
+	WORD(0xdb71), WORD(0xd641), WORD(0x6de3), WORD(0xbf3e), WORD(0x917c), WORD(0x02d2),
+	WORD(0x78d1), WORD(0xb26c), WORD(0x4c2b), WORD(0x9114), WORD(0x888c), WORD(0x10f8),
+	WORD(0xfffa), WORD(0xce04), WORD(0xc544), WORD(0xf8dd), WORD(0x0fe3), WORD(0x94b0),
+	WORD(0x5ff6), WORD(0x2b08), WORD(0x16e2), WORD(0x20be), WORD(0xfa5b), WORD(0x8ea9),
+	WORD(0x20aa), WORD(0xb9a5), WORD(0xbad4), WORD(0xbb9c),
+	/* 47G */
+	WORD(0x58dd), WORD(0xf609), WORD(0x1ebb), WORD(0xc590), WORD(0x3c35), WORD(0x75c4),
+	WORD(0xa283), WORD(0x5e15), WORD(0x6bbe), WORD(0xe662), WORD(0xfb83), WORD(0x684d),
+	WORD(0xb0f9), WORD(0x1e22), WORD(0x4db7), WORD(0xc1d6), WORD(0x856b), WORD(0xd881),
+	WORD(0x4d45), WORD(0xc607), WORD(0xdc07), WORD(0x73d6), WORD(0xee6a), WORD(0xc28a),
+	WORD(0x5665), WORD(0xa117), WORD(0x9c4d), WORD(0x04f9),
+	/* 49G */
+	WORD(0xb0e3), WORD(0x3c3c), WORD(0xde41), WORD(0x96ab), WORD(0x40c7), WORD(0x550b),
+	WORD(0x8bf1), WORD(0x4d9f), WORD(0x7bd6), WORD(0x0c60), WORD(0xc950), WORD(0xd6a0),
+	WORD(0x59be), WORD(0xd58c), WORD(0x71c2), WORD(0x98df), WORD(0xe8bf), WORD(0x2f57),
+	WORD(0x9b62), WORD(0x1e31), WORD(0x88e7), WORD(0xed0f), WORD(0xad80), WORD(0xaa30),
+	WORD(0x726f), WORD(0x50de), WORD(0x01d6), WORD(0x8227),
+	/* 51G */
+	WORD(0xa6c8), WORD(0xc73d), WORD(0x9c78), WORD(0x70c5), WORD(0x88ef), WORD(0x0a6c),
+	WORD(0x0e7e), WORD(0x42cc), WORD(0xdc9f), WORD(0x7715), WORD(0x7ada), WORD(0x8630),
+	WORD(0x1d95), WORD(0x50b0), WORD(0x9fd4), WORD(0x5830), WORD(0x6aae), WORD(0x7738),
+	WORD(0x8786), WORD(0xf3f8), WORD(0x5195), WORD(0xac05), WORD(0x5ba2), WORD(0x17cd),
+	WORD(0x135f), WORD(0x7368), WORD(0xfd9d), WORD(0x6723),
+	/* 53G */
+	WORD(0x6bea), WORD(0x1beb), WORD(0x995a), WORD(0x990f), WORD(0xfeea), WORD(0xb06c),
+	WORD(0x3b67), WORD(0x223f), WORD(0xbc61), WORD(0xc54b), WORD(0x3e76), WORD(0x370b),
+	WORD(0x3658), WORD(0x66e4), WORD(0x77a9), WORD(0x27ce), WORD(0x5d6f), WORD(0x5a79),
+	WORD(0x287b), WORD(0xcd12), WORD(0xa258), WORD(0x00ae), WORD(0x5612), WORD(0x6780),
+	WORD(0x919d), WORD(0x0ddd), WORD(0x2d75), WORD(0x7ff5),
+	/* 55G */
+	WORD(0xb715), WORD(0x9d6d), WORD(0x10fc), WORD(0x71e7), WORD(0x437a), WORD(0x9c68),
+	WORD(0x4a15), WORD(0xbd5a), WORD(0x186f), WORD(0x04c0), WORD(0x6746), WORD(0x282c),
+	WORD(0x04cb), WORD(0x5812), WORD(0x6cf2), WORD(0xcf97), WORD(0x417d), WORD(0xc803),
+	WORD(0x8ade), WORD(0x4fc5), WORD(0x52b1), WORD(0x7b15), WORD(0x81cf), WORD(0x9512),
+	WORD(0x232c), WORD(0x77f1), WORD(0xb340), WORD(0x0895),
+	/* 57G */
+	WORD(0x2d4a), WORD(0x27a6), WORD(0xe7b5), WORD(0xbba0), WORD(0x9242), WORD(0xda7e),
+	WORD(0x9518), WORD(0x0c1f), WORD(0x78cd), WORD(0x2400), WORD(0xa9c0), WORD(0xb53f),
+	WORD(0xc67f), WORD(0xce2a), WORD(0x669c), WORD(0x9dc2), WORD(0xfbcd), WORD(0x351b),
+	WORD(0x58f7), WORD(0xc98d), WORD(0x9220), WORD(0xb984), WORD(0xc90b), WORD(0x9d40),
+	WORD(0x0f11), WORD(0x0106), WORD(0x4dc1), WORD(0xbe10),
+	/* 59G */
+	WORD(0x5b7d), WORD(0x09f7), WORD(0xaf43), WORD(0x11a0), WORD(0x9982), WORD(0xa763),
+	WORD(0xe64c), WORD(0xb6e9), WORD(0xc7e7), WORD(0x4b68), WORD(0x0f00), WORD(0xb11f),
+	WORD(0x50e1), WORD(0xa866), WORD(0x81bf), WORD(0xc388), WORD(0x28aa), WORD(0xa6b2),
+	WORD(0xd653), WORD(0xe1a4), WORD(0x17d6), WORD(0xfc3e), WORD(0xd304), WORD(0xfa4d),
+	WORD(0x3e5d), WORD(0xa65f), WORD(0x93d2), WORD(0x77e8),
+	/* 61G */
+	WORD(0x1fd3), WORD(0xffcb), WORD(0x6330), WORD(0x4da7), WORD(0x748c), WORD(0x4983),
+	WORD(0xa4b7), WORD(0x2d0e), WORD(0xdf44), WORD(0x811e), WORD(0x0bf8), WORD(0xfdb1),
+	WORD(0x82f2), WORD(0x9186), WORD(0xc7d7), WORD(0xb3a1), WORD(0x8272), WORD(0x0d0d),
+	WORD(0x465e), WORD(0xb84b), WORD(0x7ccf), WORD(0xad7f), WORD(0x9224), WORD(0x2963),
+	WORD(0x53de), WORD(0x7839), WORD(0x271c), WORD(0x170f),
+	/* 63G */
+	WORD(0x887a), WORD(0x971c), WORD(0xeb61), WORD(0x8bc7), WORD(0x6404), WORD(0x960e),
+	WORD(0xa943), WORD(0xbdce), WORD(0x4f42), WORD(0x0501), WORD(0x5ed4), WORD(0x60f7),
+	WORD(0x9993), WORD(0x2fda), WORD(0x560e), WORD(0x7c7f), WORD(0xf5d1), WORD(0x0f92),
+	WORD(0x8381), WORD(0x786a), WORD(0xd598), WORD(0x85e8), WORD(0xab90), WORD(0x41d4),
+	WORD(0x1c57), WORD(0x58ea), WORD(0xd7e2), WORD(0x149d),
+};
+#else                     /* unknown word size */
+#error "Unsupported word size"
+#endif
+TO_EC_GEN_TABLE_PARAM(brainpoolp224r1_gen_wnaf, 7);
+
+/*
+ * Signed comb of the generator for the fixed base multiplications (6
+ * teeth, spacing 38), affine x and y in Montgomery representation
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+static const word_t brainpoolp224r1_gen_comb[] = {
+	/* T[0] */
+	WORD(0x975cfa57ca41b055), WORD(0xcff42b2c6f082473),
+	WORD(0xbe7ba1256819f7dd), WORD(0x000000008fe81650),
+	WORD(0xb25a01e0b80e587e), WORD(0x00f75316d8d9e913),
+	WORD(0x45749e6bf7e3848c), WORD(0x000000009b0d6b1c),
+	/* T[1] */
+	WORD(0xe74d66aed7c8cc58), WORD(0xb429503c2852c254),
+	WORD(0xc261c3b7171cf662), WORD(0x00000000160b3113),
+	WORD(0xcbadfe701339fccb), WORD(0x735f1092913a9dd8),
+	WORD(0x21d0e386b37cd7f4), WORD(0x0000000004e85483),
+	/* T[2] */
+	WORD(0x87425fb767b91e3e), WORD(0xa846751c2f3da1cc),
+	WORD(0xf9993d99be1b02e3), WORD(0x00000000a3e78779),
+	WORD(0x844693a6574741c2), WORD(0x4e55ddb49dd7ec6f),
+	WORD(0x405e52f45ba0f042), WORD(0x000000003ce260ac),
+	/* T[3] */
+	WORD(0x14e1b34ca8a8f8e5), WORD(0x877bb2eb0dcea7c7),
+	WORD(0xe3c7b18d37559870), WORD(0x0000000079cc3503),
+	WORD(0x94231ca25e34d3e5), WORD(0x5079a1b0ee101c64),
+	WORD(0x19e7ed0977829019), WORD(0x000000005d14a3d1),
+	/* T[4] */
+	WORD(0xb489335e949877aa), WORD(0x6d1bf4aa97e19187),
+	WORD(0xe0d673d0f5901dcd), WORD(0x00000000b9aaa189),
+	WORD(0xa289a8f94837683d), WORD(0x485cef77496360f7),
+	WORD(0x268cfdedf0c122ef), WORD(0x0000000016336f51),
+	/* T[5] */
+	WORD(0x1d727cf6242123d5), WORD(0xd639fab27abe130b),
+	WORD(0xcba6b320570dc6cd), WORD(0x000000006eb10419),
+	WORD(0x3c445d1259a35e15), WORD(0x5a08b8015af0d7df),
+	WORD(0xce5322cf3e208fd7), WORD(0x000000006de6a91e),
+	/* T[6] */
+	WORD(0x1892659af96dda2f), WORD(0xfcccc7f401f0ee02),
+	WORD(0xe85e52cc3a67f9e9), WORD(0x0000000010b2a10b),
+	WORD(0xa5263b9845112f55), WORD(0x734b97b5c4e2c995),
+	WORD(0xb6ad4f5433cb5108), WORD(0x000000009fe033a8),
+	/* T[7] */
+	WORD(0xf153f31d6bfd59d6), WORD(0x64c45f2b1d048043),
+	WORD(0xa30c3bc1e255d4fe), WORD(0x000000004409d043),
+	WORD(0x5c3cb084353613b9), WORD(0xaa2b3544fdbdbe01),
+	WORD(0xec9b081b72e10d83), WORD(0x00000000846fcf95),
+	/* T[8] */
+	WORD(0x52b1493d1f7d84eb), WORD(0x7ed8b9b8eec0d626),
+	WORD(0xf46efc4cd6f86cbd), WORD(0x0000000022df2292),
+	WORD(0x5934a4d57e67e07d), WORD(0x4c59f2e7c3610ccf),
+	WORD(0xa624aa380905bce7), WORD(0x00000000c36e0291),
+	/* T[9] */
+	WORD(0x17a5d41292e36ad5), WORD(0x16dd7dfdd3afdca1),
+	WORD(0xcbd408dad15806d2), WORD(0x000000000339e2ed),
+	WORD(0xa7c45cd91ee53f5c), WORD(0x6310b58b01ea47cb),
+	WORD(0xc13f4ffd87797d67), WORD(0x00000000966fcaba),
+	/* T[10] */
+	WORD(0xbaf70cd99821c3e2), WORD(0xb5f9b1873e204f75),
+	WORD(0x0aab5d7dea4d664e), WORD(0x00000000d7a476e3),
+	WORD(0xa05be935bcb05cf7), WORD(0xee8fbe25933540ae),
+	WORD(0x1a5fd1615414d38a), WORD(0x000000002e5dee65),
+	/* T[11] */
+	WORD(0xd6e112a52d331c95), WORD(0x9bfe8366ef819d9f),
+	WORD(0x24e7a964412228b2), WORD(0x000000001ec4031a),
+	WORD(0xa719f3bbbe1f295e), WORD(0xd0c9e5f588f95b5b),
+	WORD(0x40db09ea6cba3596), WORD(0x0000000098465be5),
+	/* T[12] */
+	WORD(0x5c8ca4fe7836348e), WORD(0x2cfbc47a6ff88a1b),
+	WORD(0x47cf947b2fe77fc2), WORD(0x00000000ba37b48a),
+	WORD(0x69821c537bb673c8), WORD(0xaa117dde37b426c7),
+	WORD(0x5fc3e553982e5581), WORD(0x000000002ca6a5a9),
+	/* T[13] */
+	WORD(0x61751f01e22ecc73), WORD(0x0d62d8732d0ae391),
+	WORD(0xf98ef85a06f066b1), WORD(0x000000003695e0bd),
+	WORD(0x4f9656365f81f784), WORD(0x3b75af240740499c),
+	WORD(0x6fbb63df78613971), WORD(0x00000000cd52354d),
+	/* T[14] */
+	WORD(0x7b797b8b4a4d820b), WORD(0x71f5a9786516728f),
+	WORD(0x7e7ba280b699880d), WORD(0x0000000032c24d68),
+	WORD(0xc701d3ad5d159231), WORD(0xa9771a837be07ad7),
+	WORD(0xd2fccd8bdeb1f986), WORD(0x000000003cf3cf6b),
+	/* T[15] */
+	WORD(0x26e3b92ebe6857dd), WORD(0x8811568d51b7a0fb),
+	WORD(0x6a341856ac71fe57), WORD(0x000000004ba4b319),
+	WORD(0x7c988927194f852f), WORD(0x38392649e132560c),
+	WORD(0x10395008a059aecf), WORD(0x00000000d216437b),
+	/* T[16] */
+	WORD(0xf78d844834c8501f), WORD(0x8384c6ee3a60a77d),
+	WORD(0x4225a48dc9f64547), WORD(0x000000003c671a52),
+	WORD(0x244b9f4d04529bf0), WORD(0xda179e5bcfcade17),
+	WORD(0x92b8ffb992c3ce2d), WORD(0x000000006b31a0dc),
+	/* T[17] */
+	WORD(0xd4dccbbf26052ab8), WORD(0x779a6ad7124663d9),
+	WORD(0x970a1eeac8442d27), WORD(0x0000000064026b1f),
+	WORD(0xdef907b4e1293d2e), WORD(0x53820c7d79224019),
+	WORD(0x0a329afb98b21d95), WORD(0x0000000007e8d938),
+	/* T[18] */
+	WORD(0xe6ab850add4240fa), WORD(0x6fec40a0c9286b2e),
+	WORD(0x3352b96cff87afa8), WORD(0x00000000b4e7b8d6),
+	WORD(0x9117cad8426cfbd4), WORD(0x02d026c8407debdd),
+	WORD(0xb7c1d9504c50d1a7), WORD(0x000000008b016746),
+	/* T[19] */
+	WORD(0xde947b63af742670), WORD(0xe89aadb49f28313c),
+	WORD(0x382f73e5e10e8744), WORD(0x00000000281e04a8),
+	WORD(0xe19abbcfffc1f40d), WORD(0x75793b99a39923d0),
+	WORD(0x8cfa270f6cb93c69), WORD(0x000000006bd8c24f),
+	/* T[20] */
+	WORD(0xefe6ab5fcbda6e6b), WORD(0x703bebecf5b3b941),
+	WORD(0x7bbbec5a1a391f94), WORD(0x000000007a43ddac),
+	WORD(0x8f8f78875e91a38b), WORD(0xb3bbdf429977be35),
+	WORD(0x6cad496181b85dae), WORD(0x0000000033b5f764),
+	/* T[21] */
+	WORD(0x95578ccd74e9d4a4), WORD(0x95bc6ef2c6c7c8e8),
+	WORD(0x6cb94ea1726680bc), WORD(0x0000000043ff7c85),
+	WORD(0xa8fe6ecc9d203a52), WORD(0x269e69f85db9f997),
+	WORD(0x252676d3bf29bc35), WORD(0x000000008ae624c2),
+	/* T[22] */
+	WORD(0x156542eeb26968c5), WORD(0xf0f6c838afe7f692),
+	WORD(0x3988d7a80bee6b51), WORD(0x00000000433aea51),
+	WORD(0xa14a9807bd0d3803), WORD(0x665b51d0ed88705b),
+	WORD(0x5e2a94a1d248536d), WORD(0x000000007a6a5259),
+	/* T[23] */
+	WORD(0x25c147b0453f533a), WORD(0x8449efbfd61640bf),
+	WORD(0x084a0a32a6627a8c), WORD(0x000000000627f328),
+	WORD(0x9bfe4606df19e0aa), WORD(0xdddde6ab9408b762),
+	WORD(0x8135aa9daacb4c73), WORD(0x00000000ac792e32),
+	/* T[24] */
+	WORD(0xd7426f5e9fdcb5ff), WORD(0x1cb46141711c0c42),
+	WORD(0x57e58be061518be6), WORD(0x00000000cf83e204),
+	WORD(0x132ea78f42da29a8), WORD(0xecc38cb0ceeaa82b),
+	WORD(0x0decd82795d117d4), WORD(0x0000000020b9975d),
+	/* T[25] */
+	WORD(0xf1aa58f78f5c69c7), WORD(0x1120e4a9eb577a68),
+	WORD(0x2a846e8d20d512e3), WORD(0x00000000bbe9ffaf),
+	WORD(0xf73dd8a363679fc0), WORD(0xb8010f3a65348d55),
+	WORD(0x61dbca14200092cc), WORD(0x000000005067ca6c),
+	/* T[26] */
+	WORD(0x1352096450f1d76a), WORD(0xaafe8ee72312e244),
+	WORD(0xc08a912e55531728), WORD(0x00000000be43273e),
+	WORD(0x2353ca33e269fc55), WORD(0xb6a35fe1e71e4482),
+	WORD(0xa1e390cad0eeb999), WORD(0x00000000bed34554),
+	/* T[27] */
+	WORD(0x98fdd7f17765e4d3), WORD(0xd58e4d368510c227),
+	WORD(0x81db17a9eab2c1ba), WORD(0x000000000f27b9b5),
+	WORD(0x3a6b40cd78ad090b), WORD(0xa26ec14ebf549657),
+	WORD(0x0a4d9a6c649d1559), WORD(0x00000000a54b3cfe),
+	/* T[28] */
+	WORD(0x9503a1a03626fc48), WORD(0x11da46cd75f2aee8),
+	WORD(0x8507e53b2d135cdb), WORD(0x0000000025b8e793),
+	WORD(0xa8d9a85f0949e7b0), WORD(0x36899a3c13ebc01d),
+	WORD(0x6a9b8f8df3b949de), WORD(0x0000000062c429a7),
+	/* T[29] */
+	WORD(0x1f6ae60de4266a3a), WORD(0x5ec44c39f973b1dc),
+	WORD(0x0d50b33695e51858), WORD(0x000000009ea2b22b),
+	WORD(0x211ce126aa4a6b64), WORD(0xa2169a73660d9cf4),
+	WORD(0x44b57d11f6134abf), WORD(0x00000000d6d72e49),
+	/* T[30] */
+	WORD(0x54fce3b97519b3ae), WORD(0x9101ef1219d2851b),
+	WORD(0x4e1838ea7b9df38f), WORD(0x000000006cce25bd),
+	WORD(0xc792b6cb3fa7bbf4), WORD(0x12f1599a7d0d33b2),
+	WORD(0x2b4106496d9dab4e), WORD(0x0000000085cb16a6),
+	/* T[31] */
+	WORD(0x6eba1167cc836ac5), WORD(0x56ba762daff8d699),
+	WORD(0x7e09feaebfa57786), WORD(0x0000000072ed602a),
+	WORD(0x2aa65bd436c9c0a8), WORD(0x5b18444201cc7e50),
+	WORD(0x03bd109b17602849), WORD(0x0000000058aeb889),
+};
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+static const word_t brainpoolp224r1_gen_comb[] = {
+	/* T[0] */
+	WORD(0x4db58fbb), WORD(0xf4cbf7ca), WORD(0xd5e9dfae), WORD(0xf3b785f6),
+	WORD(0xb91146f5), WORD(0xaf34390d), WORD(0x4142782b), WORD(0xfb4bf9ad),
+	WORD(0xd0f31b10), WORD(0x18383e21), WORD(0x7ffdbdbd), WORD(0x9041ddf5),
+	WORD(0xee3d7ae6), WORD(0x6e2741bb),
+	/* T[1] */
+	WORD(0xda0087a8), WORD(0x4fbd0e25), WORD(0x5bed5052), WORD(0x39a930e8),
+	WORD(0x42696495), WORD(0xd2b34993), WORD(0xb5250e07), WORD(0x089612b4),
+	WORD(0xbced71d4), WORD(0x3ac114b9), WORD(0x318c71ee), WORD(0xe8af35fd),
+	WORD(0xdb121861), WORD(0x3fcba555),
+	/* T[2] */
+	WORD(0xbc0d7bf4), WORD(0x45f8dd5d), WORD(0x97d67f0a), WORD(0x63778cb2),
+	WORD(0x9835bd09), WORD(0x60fda867), WORD(0x11de8e6e), WORD(0xc549d7e4),
+	WORD(0x28cf6945), WORD(0x7a8aed99), WORD(0xe8c60f0a), WORD(0x5573a7be),
+	WORD(0x28bf859e), WORD(0x4541671f),
+	/* T[3] */
+	WORD(0xe64ef736), WORD(0x5027769a), WORD(0x7e0dee67), WORD(0x7f172bbd),
+	WORD(0xe8d2ffd9), WORD(0xd4572add), WORD(0x3ee02885), WORD(0x920cccc6),
+	WORD(0x00a713bf), WORD(0x1d47e4c0), WORD(0xe6b32d3b), WORD(0xeba5a99d),
+	WORD(0x2cb9fcfa), WORD(0xbf877fa5),
+	/* T[4] */
+	WORD(0xab59e870), WORD(0x76927e23), WORD(0x93bcb8a8), WORD(0x31f35c15),
+	WORD(0x4bf66d4a), WORD(0x28ffbc38), WORD(0x0dba21a3), WORD(0xe1839217),
+	WORD(0xc39ab652), WORD(0x3ee47168), WORD(0x8cda5e85), WORD(0x4ab50609),
+	WORD(0x7931ea2b), WORD(0x5471f1a1),
+	/* T[5] */
+	WORD(0x0b89f156), WORD(0x175e1e97), WORD(0x53950954), WORD(0x8d2411f4),
+	WORD(0x8e5ba899), WORD(0x26c49e7a), WORD(0x76bbe563), WORD(0x61e1e39e),
+	WORD(0x660b4677), WORD(0x80322062), WORD(0x125e8b88), WORD(0x273de5fc),
+	WORD(0x6b1ccfc9), WORD(0xac65ce30),
+	/* T[6] */
+	WORD(0x28c8dc33), WORD(0xd9560b0b), WORD(0x6d21ef7d), WORD(0x20daa1cc),
+	WORD(0x71458a6a), WORD(0x79cb6639), WORD(0x44897b3a), WORD(0xfbf5065c),
+	WORD(0x34dc9db8), WORD(0x168575f8), WORD(0x22cd09eb), WORD(0xc4cde376),
+	WORD(0x13766594), WORD(0x5cb2b6f5),
+	/* T[7] */
+	WORD(0xd069ca57), WORD(0xd69ff1e1), WORD(0x69c592a8), WORD(0xd5d9e6b6),
+	WORD(0x28c9c08f), WORD(0xd8f2d33b), WORD(0x1b98046a), WORD(0x58a256fd),
+	WORD(0xd037fb20), WORD(0x65132eaa), WORD(0x78de58b5), WORD(0xf13b3d9c),
+	WORD(0x24e6eb92), WORD(0x2ad7b6a4),
+	/* T[8] */
+	WORD(0x99f298e6), WORD(0x135880d2), WORD(0xfc3e44e4), WORD(0x5f958420),
+	WORD(0xd8784cbd), WORD(0xbc010299), WORD(0x2abcdc26), WORD(0x7d2231d0),
+	WORD(0x0c54701d), WORD(0x7fb803c7), WORD(0x0acd745a), WORD(0xb7bfca7f),
+	WORD(0xbdbd48d0), WORD(0x93bc6175),
+	/* T[9] */
+	WORD(0x745489c0), WORD(0x4c46168c), WORD(0xd9378804), WORD(0xe17ea2a2),
+	WORD(0xe04fb3db), WORD(0xecf554f4), WORD(0x962893ed), WORD(0xc35fa74a),
+	WORD(0xfabd036b), WORD(0x4ee576ec), WORD(0x25eb7a80), WORD(0x6b643575),
+	WORD(0x1870f10b), WORD(0xbd8a90d9),
+	/* T[10] */
+	WORD(0xbd82bbe9), WORD(0x3badd097), WORD(0xec0a262e), WORD(0xfda359de),
+	WORD(0xeabefe1c), WORD(0x54a59901), WORD(0x74850e60), WORD(0x12e5d5bc),
+	WORD(0xd413f398), WORD(0x02506396), WORD(0xebcc7ac5), WORD(0xc78cac4c),
+	WORD(0xb59b60ec), WORD(0x403a8356),
+	/* T[11] */
+	WORD(0x7204581c), WORD(0x29cf8f7c), WORD(0x1a43149b), WORD(0x4c6ea5a6),
+	WORD(0xba332b09), WORD(0x3b94c385), WORD(0xb057ad01), WORD(0x3423dc3b),
+	WORD(0x5df55be3), WORD(0x37a1e063), WORD(0x49915418), WORD(0xc1e6ce4a),
+	WORD(0x65be6388), WORD(0x8bffbf3f),
+	/* T[12] */
+	WORD(0x59c7a911), WORD(0xbc74bef1), WORD(0x780471c1), WORD(0x109b4ae3),
+	WORD(0xe463b59d), WORD(0x8ee99d73), WORD(0x1b3e5251), WORD(0xfc327731),
+	WORD(0xf6b8a6d2), WORD(0xb4dffba8), WORD(0xba5fdbcf), WORD(0xa2445aa8),
+	WORD(0x79e247d1), WORD(0xb38ab13d),
+	/* T[13] */
+	WORD(0x7043f82e), WORD(0x6e900e85), WORD(0xcca00660), WORD(0x654c9e1a),
+	WORD(0x23103a1a), WORD(0x76bd76cc), WORD(0x74662aef), WORD(0x1c061279),
+	WORD(0x289d7d98), WORD(0x40a26e35), WORD(0x76ea9955), WORD(0xcb533f1e),
+	WORD(0xe32dca49), WORD(0xcd6e9dfe),
+	/* T[14] */
+	WORD(0xca424e83), WORD(0x3b519147), WORD(0x64b6eafe), WORD(0x8abbede2),
+	WORD(0x624ff842), WORD(0xb467e8f0), WORD(0x6661d0c6), WORD(0xe0a418c8),
+	WORD(0xd638717d), WORD(0x196aa782), WORD(0x79b3a036), WORD(0x1b769787),
+	WORD(0x113dcf95), WORD(0x51faca99),
+	/* T[15] */
+	WORD(0xceb75f37), WORD(0x7d5919eb), WORD(0x404036c5), WORD(0x3b793a07),
+	WORD(0x94a25802), WORD(0xa55fdfe6), WORD(0x976c2c7e), WORD(0x4c92266d),
+	WORD(0x2aab61d2), WORD(0xb2692ba5), WORD(0xa2a686fa), WORD(0x6a2e11cb),
+	WORD(0xe98c3b87), WORD(0x4894fe21),
+	/* T[16] */
+	WORD(0xa8318873), WORD(0x36c120ad), WORD(0x36541726), WORD(0x66f5dd78),
+	WORD(0xd1db6960), WORD(0x81e50419), WORD(0x4449c3c8), WORD(0x025e3c8b),
+	WORD(0x571ac220), WORD(0x28ce1f8a), WORD(0xc8f6bf30), WORD(0xb0fc5bc5),
+	WORD(0x6f2cc56d), WORD(0x9721a9a6),
+	/* T[17] */
+	WORD(0x66d2549d), WORD(0xf293b8d7), WORD(0x28c9f227), WORD(0xf1f8dc14),
+	WORD(0xc862208e), WORD(0x9f086350), WORD(0xcbb2ce3d), WORD(0xdfac1408),
+	WORD(0x0679dfb6), WORD(0x7d26e390), WORD(0x279326ee), WORD(0xd6655dfe),
+	WORD(0xb40c9e46), WORD(0xb661c19f),
+	/* T[18] */
+	WORD(0x92294c5e), WORD(0x87696a50), WORD(0x7841b56f), WORD(0xbedb72a2),
+	WORD(0xe9b44b13), WORD(0x0ec79469), WORD(0x0ec710b9), WORD(0xefc54c1d),
+	WORD(0x65eed3e3), WORD(0x7da4343b), WORD(0xcf74429e), WORD(0xbcfd7f04),
+	WORD(0xf440329f), WORD(0x792335b4),
+	/* T[19] */
+	WORD(0x336169f1), WORD(0x91aa323d), WORD(0x890c73b6), WORD(0x7000df80),
+	WORD(0x184e0f5c), WORD(0x6cca82bf), WORD(0x8c36ffe1), WORD(0x5c291ad1),
+	WORD(0xb3156ea5), WORD(0xa3306674), WORD(0x8a4c4f94), WORD(0xbb84580a),
+	WORD(0x71941bc4), WORD(0x33cb6fcc),
+	/* T[20] */
+	WORD(0xd15090b3), WORD(0xc943e1de), WORD(0x83ace2cb), WORD(0x65dcb39d),
+	WORD(0x88ac8747), WORD(0x9dd8cf99), WORD(0x00838f28), WORD(0xb811bca5),
+	WORD(0x5be000ef), WORD(0x0e3a9274), WORD(0x1e68cc5d), WORD(0x6530150d),
+	WORD(0x8863193d), WORD(0xd16f68c9),
+	/* T[21] */
+	WORD(0x3b00d16b), WORD(0xe3f74e51), WORD(0x655da99d), WORD(0xa63c8b7a),
+	WORD(0x0841f30a), WORD(0xd4578cef), WORD(0x70153ec5), WORD(0xe3b6e2a8),
+	WORD(0x4549f8fb), WORD(0x203ae3f9), WORD(0x22d0ef12), WORD(0x2d2264a4),
+	WORD(0x7da84ba6), WORD(0x83e0988d),
+	/* T[22] */
+	WORD(0x0292dd26), WORD(0x18ea6e86), WORD(0xb4ca2f32), WORD(0x2b1cde77),
+	WORD(0x2b8f6481), WORD(0x6eba28f0), WORD(0x28184d3f), WORD(0x735cbccc),
+	WORD(0xc103127b), WORD(0xa19631ae), WORD(0x097e1cb2), WORD(0xbe3064b0),
+	WORD(0x0089d5b7), WORD(0x43896fcb),
+	/* T[23] */
+	WORD(0x63d1a61d), WORD(0xc92b1c8f), WORD(0xe4ceca38), WORD(0xeae4b468),
+	WORD(0x054bd42f), WORD(0xfd7f4b25), WORD(0x9b8587a3), WORD(0x7df40e73),
+	WORD(0x0251b3cc), WORD(0xcf0eb688), WORD(0x803b8b50), WORD(0x09dbcd98),
+	WORD(0x3fbceda1), WORD(0xb95ff531),
+	/* T[24] */
+	WORD(0xceaff35f), WORD(0xc3492ad4), WORD(0xa15ef941), WORD(0x4bb5a206),
+	WORD(0x830c483a), WORD(0xff6fc73b), WORD(0x083f2846), WORD(0x68b80758),
+	WORD(0x553b35cf), WORD(0xa6c4eb61), WORD(0xc3c0b34d), WORD(0xc5b0eb6a),
+	WORD(0xbf135bb0), WORD(0x3a4a51d5),
+	/* T[25] */
+	WORD(0x0019c5c4), WORD(0xb440d874), WORD(0xbfd5cafc), WORD(0x681db263),
+	WORD(0x0258c1f6), WORD(0xac3eb51f), WORD(0x3fedb401), WORD(0xcb285008),
+	WORD(0x603fb260), WORD(0x54e8734e), WORD(0x81d59382), WORD(0x92caf3b5),
+	WORD(0x234dc34a), WORD(0xafcc8e73),
+	/* T[26] */
+	WORD(0xf80bd099), WORD(0x8968ee72), WORD(0xd8767aa1), WORD(0x1727d2d7),
+	WORD(0xccf5bf5c), WORD(0xfcd2979c), WORD(0x32353655), WORD(0xb931b817),
+	WORD(0x9fb37de4), WORD(0x4e9860f2), WORD(0xc5d81de9), WORD(0x77c99d05),
+	WORD(0xae62ffc9), WORD(0x60d36861),
+	/* T[27] */
+	WORD(0x833f717e), WORD(0x4d34b7e3), WORD(0xf965847e), WORD(0x65d8e404),
+	WORD(0xc0b8fa0c), WORD(0xb3817cca), WORD(0xd473040b), WORD(0x75c430a0),
+	WORD(0xd92ada8b), WORD(0xe42c5456), WORD(0xb5ccc9ca), WORD(0xd049914c),
+	WORD(0x034fb777), WORD(0x24c56b30),
+	/* T[28] */
+	WORD(0xf9e4c11c), WORD(0xaf2dc01f), WORD(0xaf439fac), WORD(0x7c3d8aeb),
+	WORD(0x59ab34e6), WORD(0x02fbd4ef), WORD(0xb1ba578f), WORD(0x915593f4),
+	WORD(0xd95b638c), WORD(0x0b3c1969), WORD(0x23ff12e5), WORD(0x6d2f8c91),
+	WORD(0xb1ae7d01), WORD(0x6dafcb82),
+	/* T[29] */
+	WORD(0xbb104364), WORD(0x4c0ebc40), WORD(0x2c4373aa), WORD(0x26ecfcf5),
+	WORD(0x37b42fe1), WORD(0x57e60c3e), WORD(0x19efa223), WORD(0xd3a5ce8c),
+	WORD(0x3ce20913), WORD(0x82e57717), WORD(0x5c459ced), WORD(0xf17f0d93),
+	WORD(0x84ed9620), WORD(0x3d543586),
+	/* T[30] */
+	WORD(0xdeeeb64e), WORD(0x35c33085), WORD(0xf6eabb7c), WORD(0xd0f54f75),
+	WORD(0x9299395a), WORD(0x235236dd), WORD(0x0026ab2a), WORD(0x497f75d6),
+	WORD(0x0ff828a2), WORD(0xf5e60206), WORD(0xf0c61548), WORD(0xa6e1bb88),
+	WORD(0xcfd3b888), WORD(0xa29a1169),
+	/* T[31] */
+	WORD(0x38be8679), WORD(0x1b88232c), WORD(0xb6e8a87a), WORD(0xc9b5343d),
+	WORD(0xa64bf3f3), WORD(0x6921f597), WORD(0x64725e46), WORD(0x6b296b8d),
+	WORD(0xc8e14f64), WORD(0xf3a288cc), WORD(0xa0b398c8), WORD(0x358c3c0f),
+	WORD(0xff0f5bd7), WORD(0xc451b50f),
+};
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+static const word_t brainpoolp224r1_gen_comb[] = {
+	/* T[0] */
+	WORD(0x8fbb), WORD(0x4db5), WORD(0xf7ca), WORD(0xf4cb), WORD(0xdfae), WORD(0xd5e9),
+	WORD(0x85f6), WORD(0xf3b7), WORD(0x46f5), WORD(0xb911), WORD(0x390d), WORD(0xaf34),
+	WORD(0x782b), WORD(0x4142), WORD(0xf9ad), WORD(0xfb4b), WORD(0x1b10), WORD(0xd0f3),
+	WORD(0x3e21), WORD(0x1838), WORD(0xbdbd), WORD(0x7ffd), WORD(0xddf5), WORD(0x9041),
+	WORD(0x7ae6), WORD(0xee3d), WORD(0x41bb), WORD(0x6e27),
+	/* T[1] */
+	WORD(0x87a8), WORD(0xda00), WORD(0x0e25), WORD(0x4fbd), WORD(0x5052), WORD(0x5bed),
+	WORD(0x30e8), WORD(0x39a9), WORD(0x6495), WORD(0x4269), WORD(0x4993), WORD(0xd2b3),
+	WORD(0x0e07), WORD(0xb525), WORD(0x12b4), WORD(0x0896), WORD(0x71d4), WORD(0xbced),
+	WORD(0x14b9), WORD(0x3ac1), WORD(0x71ee), WORD(0x318c), WORD(0x35fd), WORD(0xe8af),
+	WORD(0x1861), WORD(0xdb12), WORD(0xa555), WORD(0x3fcb),
+	/* T[2] */
+	WORD(0x7bf4), WORD(0xbc0d), WORD(0xdd5d), WORD(0x45f8), WORD(0x7f0a), WORD(0x97d6),
+	WORD(0x8cb2), WORD(0x6377), WORD(0xbd09), WORD(0x9835), WORD(0xa867), WORD(0x60fd),
+	WORD(0x8e6e), WORD(0x11de), WORD(0xd7e4), WORD(0xc549), WORD(0x6945), WORD(0x28cf),
+	WORD(0xed99), WORD(0x7a8a), WORD(0x0f0a), WORD(0xe8c6), WORD(0xa7be), WORD(0x5573),
+	WORD(0x859e), WORD(0x28bf), WORD(0x671f), WORD(0x4541),
+	/* T[3] */
+	WORD(0xf736), WORD(0xe64e), WORD(0x769a), WORD(0x5027), WORD(0xee67), WORD(0x7e0d),
+	WORD(0x2bbd), WORD(0x7f17), WORD(0xffd9), WORD(0xe8d2), WORD(0x2add), WORD(0xd457),
+	WORD(0x2885), WORD(0x3ee0), WORD(0xccc6), WORD(0x920c), WORD(0x13bf), WORD(0x00a7),
+	WORD(0xe4c0), WORD(0x1d47), WORD(0x2d3b), WORD(0xe6b3), WORD(0xa99d), WORD(0xeba5),
+	WORD(0xfcfa), WORD(0x2cb9), WORD(0x7fa5), WORD(0xbf87),
+	/* T[4] */
+	WORD(0xe870), WORD(0xab59), WORD(0x7e23), WORD(0x7692), WORD(0xb8a8), WORD(0x93bc),
+	WORD(0x5c15), WORD(0x31f3), WORD(0x6d4a), WORD(0x4bf6), WORD(0xbc38), WORD(0x28ff),
+	WORD(0x21a3), WORD(0x0dba), WORD(0x9217), WORD(0xe183), WORD(0xb652), WORD(0xc39a),
+	WORD(0x7168), WORD(0x3ee4), WORD(0x5e85), WORD(0x8cda), WORD(0x0609), WORD(0x4ab5),
+	WORD(0xea2b), WORD(0x7931), WORD(0xf1a1), WORD(0x5471),
+	/* T[5] */
+	WORD(0xf156), WORD(0x0b89), WORD(0x1e97), WORD(0x175e), WORD(0x0954), WORD(0x5395),
+	WORD(0x11f4), WORD(0x8d24), WORD(0xa899), WORD(0x8e5b), WORD(0x9e7a), WORD(0x26c4),
+	WORD(0xe563), WORD(0x76bb), WORD(0xe39e), WORD(0x61e1), WORD(0x4677), WORD(0x660b),
+	WORD(0x2062), WORD(0x8032), WORD(0x8b88), WORD(0x125e), WORD(0xe5fc), WORD(0x273d),
+	WORD(0xcfc9), WORD(0x6b1c), WORD(0xce30), WORD(0xac65),
+	/* T[6] */
+	WORD(0xdc33), WORD(0x28c8), WORD(0x0b0b), WORD(0xd956), WORD(0xef7d), WORD(0x6d21),
+	WORD(0xa1cc), WORD(0x20da), WORD(0x8a6a), WORD(0x7145), WORD(0x6639), WORD(0x79cb),
+	WORD(0x7b3a), WORD(0x4489), WORD(0x065c), WORD(0xfbf5), WORD(0x9db8), WORD(0x34dc),
+	WORD(0x75f8), WORD(0x1685), WORD(0x09eb), WORD(0x22cd), WORD(0xe376), WORD(0xc4cd),
+	WORD(0x6594), WORD(0x1376), WORD(0xb6f5), WORD(0x5cb2),
+	/* T[7] */
+	WORD(0xca57), WORD(0xd069), WORD(0xf1e1), WORD(0xd69f), WORD(0x92a8), WORD(0x69c5),
+	WORD(0xe6b6), WORD(0xd5d9), WORD(0xc08f), WORD(0x28c9), WORD(0xd33b), WORD(0xd8f2),
+	WORD(0x046a), WORD(0x1b98), WORD(0x56fd), WORD(0x58a2), WORD(0xfb20), WORD(0xd037),
+	WORD(0x2eaa), WORD(0x6513), WORD(0x58b5), WORD(0x78de), WORD(0x3d9c), WORD(0xf13b),
+	WORD(0xeb92), WORD(0x24e6), WORD(0xb6a4), WORD(0x2ad7),
+	/* T[8] */
+	WORD(0x98e6), WORD(0x99f2), WORD(0x80d2), WORD(0x1358), WORD(0x44e4), WORD(0xfc3e),
+	WORD(0x8420), WORD(0x5f95), WORD(0x4cbd), WORD(0xd878), WORD(0x0299), WORD(0xbc01),
+	WORD(0xdc26), WORD(0x2abc), WORD(0x31d0), WORD(0x7d22), WORD(0x701d), WORD(0x0c54),
+	WORD(0x03c7), WORD(0x7fb8), WORD(0x745a), WORD(0x0acd), WORD(0xca7f), WORD(0xb7bf),
+	WORD(0x48d0), WORD(0xbdbd), WORD(0x6175), WORD(0x93bc),
+	/* T[9] */
+	WORD(0x89c0), WORD(0x7454), WORD(0x168c), WORD(0x4c46), WORD(0x8804), WORD(0xd937),
+	WORD(0xa2a2), WORD(0xe17e), WORD(0xb3db), WORD(0xe04f), WORD(0x54f4), WORD(0xecf5),
+	WORD(0x93ed), WORD(0x9628), WORD(0xa74a), WORD(0xc35f), WORD(0x036b), WORD(0xfabd),
+	WORD(0x76ec), WORD(0x4ee5), WORD(0x7a80), WORD(0x25eb), WORD(0x3575), WORD(0x6b64),
+	WORD(0xf10b), WORD(0x1870), WORD(0x90d9), WORD(0xbd8a),
+	/* T[10] */
+	WORD(0xbbe9), WORD(0xbd82), WORD(0xd097), WORD(0x3bad), WORD(0x262e), WORD(0xec0a),
+	WORD(0x59de), WORD(0xfda3), WORD(0xfe1c), WORD(0xeabe), WORD(0x9901), WORD(0x54a5),
+	WORD(0x0e60), WORD(0x7485), WORD(0xd5bc), WORD(0x12e5), WORD(0xf398), WORD(0xd413),
+	WORD(0x6396), WORD(0x0250), WORD(0x7ac5), WORD(0xebcc), WORD(0xac4c), WORD(0xc78c),
+	WORD(0x60ec), WORD(0xb59b), WORD(0x8356), WORD(0x403a),
+	/* T[11] */
+	WORD(0x581c), WORD(0x7204), WORD(0x8f7c), WORD(0x29cf), WORD(0x149b), WORD(0x1a43),
+	WORD(0xa5a6), WORD(0x4c6e), WORD(0x2b09), WORD(0xba33), WORD(0xc385), WORD(0x3b94),
+	WORD(0xad01), WORD(0xb057), WORD(0xdc3b), WORD(0x3423), WORD(0x5be3), WORD(0x5df5),
+	WORD(0xe063), WORD(0x37a1), WORD(0x5418), WORD(0x4991), WORD(0xce4a), WORD(0xc1e6),
+	WORD(0x6388), WORD(0x65be), WORD(0xbf3f), WORD(0x8bff),
+	/* T[12] */
+	WORD(0xa911), WORD(0x59c7), WORD(0xbef1), WORD(0xbc74), WORD(0x71c1), WORD(0x7804),
+	WORD(0x4ae3), WORD(0x109b), WORD(0xb59d), WORD(0xe463), WORD(0x9d73), WORD(0x8ee9),
+	WORD(0x5251), WORD(0x1b3e), WORD(0x7731), WORD(0xfc32), WORD(0xa6d2), WORD(0xf6b8),
+	WORD(0xfba8), WORD(0xb4df), WORD(0xdbcf), WORD(0xba5f), WORD(0x5aa8), WORD(0xa244),
+	WORD(0x47d1), WORD(0x79e2), WORD(0xb13d), WORD(0xb38a),
+	/* T[13] */
+	WORD(0xf82e), WORD(0x7043), WORD(0x0e85), WORD(0x6e90), WORD(0x0660), WORD(0xcca0),
+	WORD(0x9e1a), WORD(0x654c), WORD(0x3a1a), WORD(0x2310), WORD(0x76cc), WORD(0x76bd),
+	WORD(0x2aef), WORD(0x7466), WORD(0x1279), WORD(0x1c06), WORD(0x7d98), WORD(0x289d),
+	WORD(0x6e35), WORD(0x40a2), WORD(0x9955), WORD(0x76ea), WORD(0x3f1e), WORD(0xcb53),
+	WORD(0xca49), WORD(0xe32d), WORD(0x9dfe), WORD(0xcd6e),
+	/* T[14] */
+	WORD(0x4e83), WORD(0xca42), WORD(0x9147), WORD(0x3b51), WORD(0xeafe), WORD(0x64b6),
+	WORD(0xede2), WORD(0x8abb), WORD(0xf842), WORD(0x624f), WORD(0xe8f0), WORD(0xb467),
+	WORD(0xd0c6), WORD(0x6661), WORD(0x18c8), WORD(0xe0a4), WORD(0x717d), WORD(0xd638),
+	WORD(0xa782), WORD(0x196a), WORD(0xa036), WORD(0x79b3), WORD(0x9787), WORD(0x1b76),
+	WORD(0xcf95), WORD(0x113d), WORD(0xca99), WORD(0x51fa),
+	/* T[15] */
+	WORD(0x5f37), WORD(0xceb7), WORD(0x19eb), WORD(0x7d59), WORD(0x36c5), WORD(0x4040),
+	WORD(0x3a07), WORD(0x3b79), WORD(0x5802), WORD(0x94a2), WORD(0xdfe6), WORD(0xa55f),
+	WORD(0x2c7e), WORD(0x976c), WORD(0x266d), WORD(0x4c92), WORD(0x61d2), WORD(0x2aab),
+	WORD(0x2ba5), WORD(0xb269), WORD(0x86fa), WORD(0xa2a6), WORD(0x11cb), WORD(0x6a2e),
+	WORD(0x3b87), WORD(0xe98c), WORD(0xfe21), WORD(0x4894),
+	/* T[16] */
+	WORD(0x8873), WORD(0xa831), WORD(0x20ad), WORD(0x36c1), WORD(0x1726), WORD(0x3654),
+	WORD(0xdd78), WORD(0x66f5), WORD(0x6960), WORD(0xd1db), WORD(0x0419), WORD(0x81e5),
+	WORD(0xc3c8), WORD(0x4449), WORD(0x3c8b), WORD(0x025e), WORD(0xc220), WORD(0x571a),
+	WORD(0x1f8a), WORD(0x28ce), WORD(0xbf30), WORD(0xc8f6), WORD(0x5bc5), WORD(0xb0fc),
+	WORD(0xc56d), WORD(0x6f2c), WORD(0xa9a6), WORD(0x9721),
+	/* T[17] */
+	WORD(0x549d), WORD(0x66d2), WORD(0xb8d7), WORD(0xf293), WORD(0xf227), WORD(0x28c9),
+	WORD(0xdc14), WORD(0xf1f8), WORD(0x208e), WORD(0xc862), WORD(0x6350), WORD(0x9f08),
+	WORD(0xce3d), WORD(0xcbb2), WORD(0x1408), WORD(0xdfac), WORD(0xdfb6), WORD(0x0679),
+	WORD(0xe390), WORD(0x7d26), WORD(0x26ee), WORD(0x2793), WORD(0x5dfe), WORD(0xd665),
+	WORD(0x9e46), WORD(0xb40c), WORD(0xc19f), WORD(0xb661),
+	/* T[18] */
+	WORD(0x4c5e), WORD(0x9229), WORD(0x6a50), WORD(0x8769), WORD(0xb56f), WORD(0x7841),
+	WORD(0x72a2), WORD(0xbedb), WORD(0x4b13), WORD(0xe9b4), WORD(0x9469), WORD(0x0ec7),
+	WORD(0x10b9), WORD(0x0ec7), WORD(0x4c1d), WORD(0xefc5), WORD(0xd3e3), WORD(0x65ee),
+	WORD(0x343b), WORD(0x7da4), WORD(0x429e), WORD(0xcf74), WORD(0x7f04), WORD(0xbcfd),
+	WORD(0x329f), WORD(0xf440), WORD(0x35b4), WORD(0x7923),
+	/* T[19] */
+	WORD(0x69f1), WORD(0x3361), WORD(0x323d), WORD(0x91aa), WORD(0x73b6), WORD(0x890c),
+	WORD(0xdf80), WORD(0x7000), WORD(0x0f5c), WORD(0x184e), WORD(0x82bf), WORD(0x6cca),
+	WORD(0xffe1), WORD(0x8c36), WORD(0x1ad1), WORD(0x5c29), WORD(0x6ea5), WORD(0xb315),
+	WORD(0x6674), WORD(0xa330), WORD(0x4f94), WORD(0x8a4c), WORD(0x580a), WORD(0xbb84),
+	WORD(0x1bc4), WORD(0x7194), WORD(0x6fcc), WORD(0x33cb),
+	/* T[20] */
+	WORD(0x90b3), WORD(0xd150), WORD(0xe1de), WORD(0xc943), WORD(0xe2cb), WORD(0x83ac),
+	WORD(0xb39d), WORD(0x65dc), WORD(0x8747), WORD(0x88ac), WORD(0xcf99), WORD(0x9dd8),
+	WORD(0x8f28), WORD(0x0083), WORD(0xbca5), WORD(0xb811), WORD(0x00ef), WORD(0x5be0),
+	WORD(0x9274), WORD(0x0e3a), WORD(0xcc5d), WORD(0x1e68), WORD(0x150d), WORD(0x6530),
+	WORD(0x193d), WORD(0x8863), WORD(0x68c9), WORD(0xd16f),
+	/* T[21] */
+	WORD(0xd16b), WORD(0x3b00), WORD(0x4e51), WORD(0xe3f7), WORD(0xa99d), WORD(0x655d),
+	WORD(0x8b7a), WORD(0xa63c), WORD(0xf30a), WORD(0x0841), WORD(0x8cef), WORD(0xd457),
+	WORD(0x3ec5), WORD(0x7015), WORD(0xe2a8), WORD(0xe3b6), WORD(0xf8fb), WORD(0x4549),
+	WORD(0xe3f9), WORD(0x203a), WORD(0xef12), WORD(0x22d0), WORD(0x64a4), WORD(0x2d22),
+	WORD(0x4ba6), WORD(0x7da8), WORD(0x988d), WORD(0x83e0),
+	/* T[22] */
+	WORD(0xdd26), WORD(0x0292), WORD(0x6e86), WORD(0x18ea), WORD(0x2f32), WORD(0xb4ca),
+	WORD(0xde77), WORD(0x2b1c), WORD(0x6481), WORD(0x2b8f), WORD(0x28f0), WORD(0x6eba),
+	WORD(0x4d3f), WORD(0x2818), WORD(0xbccc), WORD(0x735c), WORD(0x127b), WORD(0xc103),
+	WORD(0x31ae), WORD(0xa196), WORD(0x1cb2), WORD(0x097e), WORD(0x64b0), WORD(0xbe30),
+	WORD(0xd5b7), WORD(0x0089), WORD(0x6fcb), WORD(0x4389),
+	/* T[23] */
+	WORD(0xa61d), WORD(0x63d1), WORD(0x1c8f), WORD(0xc92b), WORD(0xca38), WORD(0xe4ce),
+	WORD(0xb468), WORD(0xeae4), WORD(0xd42f), WORD(0x054b), WORD(0x4b25), WORD(0xfd7f),
+	WORD(0x87a3), WORD(0x9b85), WORD(0x0e73), WORD(0x7df4), WORD(0xb3cc), WORD(0x0251),
+	WORD(0xb688), WORD(0xcf0e), WORD(0x8b50), WORD(0x803b), WORD(0xcd98), WORD(0x09db),
+	WORD(0xeda1), WORD(0x3fbc), WORD(0xf531), WORD(0xb95f),
+	/* T[24] */
+	WORD(0xf35f), WORD(0xceaf), WORD(0x2ad4), WORD(0xc349), WORD(0xf941), WORD(0xa15e),
+	WORD(0xa206), WORD(0x4bb5), WORD(0x483a), WORD(0x830c), WORD(0xc73b), WORD(0xff6f),
+	WORD(0x2846), WORD(0x083f), WORD(0x0758), WORD(0x68b8), WORD(0x35cf), WORD(0x553b),
+	WORD(0xeb61), WORD(0xa6c4), WORD(0xb34d), WORD(0xc3c0), WORD(0xeb6a), WORD(0xc5b0),
+	WORD(0x5bb0), WORD(0xbf13), WORD(0x51d5), WORD(0x3a4a),
+	/* T[25] */
+	WORD(0xc5c4), WORD(0x0019), WORD(0xd874), WORD(0xb440), WORD(0xcafc), WORD(0xbfd5),
+	WORD(0xb263), WORD(0x681d), WORD(0xc1f6), WORD(0x0258), WORD(0xb51f), WORD(0xac3e),
+	WORD(0xb401), WORD(0x3fed), WORD(0x5008), WORD(0xcb28), WORD(0xb260), WORD(0x603f),
+	WORD(0x734e), WORD(0x54e8), WORD(0x9382), WORD(0x81d5), WORD(0xf3b5), WORD(0x92ca),
+	WORD(0xc34a), WORD(0x234d), WORD(0x8e73), WORD(0xafcc),
+	/* T[26] */
+	WORD(0xd099), WORD(0xf80b), WORD(0xee72), WORD(0x8968), WORD(0x7aa1), WORD(0xd876),
+	WORD(0xd2d7), WORD(0x1727), WORD(0xbf5c), WORD(0xccf5), WORD(0x979c), WORD(0xfcd2),
+	WORD(0x3655), WORD(0x3235), WORD(0xb817), WORD(0xb931), WORD(0x7de4), WORD(0x9fb3),
+	WORD(0x60f2), WORD(0x4e98), WORD(0x1de9), WORD(0xc5d8), WORD(0x9d05), WORD(0x77c9),
+	WORD(0xffc9), WORD(0xae62), WORD(0x6861), WORD(0x60d3),
+	/* T[27] */
+	WORD(0x717e), WORD(0x833f), WORD(0xb7e3), WORD(0x4d34), WORD(0x847e), WORD(0xf965),
+	WORD(0xe404), WORD(0x65d8), WORD(0xfa0c), WORD(0xc0b8), WORD(0x7cca), WORD(0xb381),
+	WORD(0x040b), WORD(0xd473), WORD(0x30a0), WORD(0x75c4), WORD(0xda8b), WORD(0xd92a),
+	WORD(0x5456), WORD(0xe42c), WORD(0xc9ca), WORD(0xb5cc), WORD(0x914c), WORD(0xd049),
+	WORD(0xb777), WORD(0x034f), WORD(0x6b30), WORD(0x24c5),
+	/* T[28] */
+	WORD(0xc11c), WORD(0xf9e4), WORD(0xc01f), WORD(0xaf2d), WORD(0x9fac), WORD(0xaf43),
+	WORD(0x8aeb), WORD(0x7c3d), WORD(0x34e6), WORD(0x59ab), WORD(0xd4ef), WORD(0x02fb),
+	WORD(0x578f), WORD(0xb1ba), WORD(0x93f4), WORD(0x9155), WORD(0x638c), WORD(0xd95b),
+	WORD(0x1969), WORD(0x0b3c), WORD(0x12e5), WORD(0x23ff), WORD(0x8c91), WORD(0x6d2f),
+	WORD(0x7d01), WORD(0xb1ae), WORD(0xcb82), WORD(0x6daf),
+	/* T[29] */
+	WORD(0x4364), WORD(0xbb10), WORD(0xbc40), WORD(0x4c0e), WORD(0x73aa), WORD(0x2c43),
+	WORD(0xfcf5), WORD(0x26ec), WORD(0x2fe1), WORD(0x37b4), WORD(0x0c3e), WORD(0x57e6),
+	WORD(0xa223), WORD(0x19ef), WORD(0xce8c), WORD(0xd3a5), WORD(0x0913), WORD(0x3ce2),
+	WORD(0x7717), WORD(0x82e5), WORD(0x9ced), WORD(0x5c45), WORD(0x0d93), WORD(0xf17f),
+	WORD(0x9620), WORD(0x84ed), WORD(0x3586), WORD(0x3d54),
+	/* T[30] */
+	WORD(0xb64e), WORD(0xdeee), WORD(0x3085), WORD(0x35c3), WORD(0xbb7c), WORD(0xf6ea),
+	WORD(0x4f75), WORD(0xd0f5), WORD(0x395a), WORD(0x9299), WORD(0x36dd), WORD(0x2352),
+	WORD(0xab2a), WORD(0x0026), WORD(0x75d6), WORD(0x497f), WORD(0x28a2), WORD(0x0ff8),
+	WORD(0x0206), WORD(0xf5e6), WORD(0x1548), WORD(0xf0c6), WORD(0xbb88), WORD(0xa6e1),
+	WORD(0xb888), WORD(0xcfd3), WORD(0x1169), WORD(0xa29a),
+	/* T[31] */
+	WORD(0x8679), WORD(0x38be), WORD(0x232c), WORD(0x1b88), WORD(0xa87a), WORD(0xb6e8),
+	WORD(0x343d), WORD(0xc9b5), WORD(0xf3f3), WORD(0xa64b), WORD(0xf597), WORD(0x6921),
+	WORD(0x5e46), WORD(0x6472), WORD(0x6b8d), WORD(0x6b29), WORD(0x4f64), WORD(0xc8e1),
+	WORD(0x88cc), WORD(0xf3a2), WORD(0x98c8), WORD(0xa0b3), WORD(0x3c0f), WORD(0x358c),
+	WORD(0x5bd7), WORD(0xff0f), WORD(0xb50f), WORD(0xc451),
+};
+#else                     /* unknown word size */
+#error "Unsupported word size"
+#endif
+TO_EC_GEN_TABLE_PARAM(brainpoolp224r1_gen_comb, 6);
+
 static const ec_str_params brainpoolp224r1_str_params = {
 	.p = &brainpoolp224r1_p_str_param,
 	.p_bitlen = &brainpoolp224r1_p_bitlen_str_param,
@@ -241,6 +1474,11 @@ static const ec_str_params brainpoolp224r1_str_params = {
 	.cofactor = &brainpoolp224r1_cofactor_str_param,
 	.oid = &brainpoolp224r1_oid_str_param,
 	.name = &brainpoolp224r1_name_str_param,
+	.p_inv_chain = &brainpoolp224r1_p_inv_chain_param,
+	.p_sqrt_chain = &brainpoolp224r1_p_sqrt_chain_param,
+	.q_inv_chain = &brainpoolp224r1_q_inv_chain_param,
+	.gen_wnaf_table = &brainpoolp224r1_gen_wnaf_table_param,
+	.gen_comb_table = &brainpoolp224r1_gen_comb_table_param,
 };
 
 /*
@@ -261,6 +1499,17 @@ static const ec_str_params brainpoolp224r1_str_params = {
 #define CURVES_MAX_Q_BIT_LEN CURVE_BRAINPOOLP224R1_Q_BITLEN
 #endif
 
+/*
+ * Limb count of p for the fixed limbs field backend (see fp_fixed.h)
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+#define FP_FIXED_WLEN_4_USED
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+#define FP_FIXED_WLEN_7_USED
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+#define FP_FIXED_WLEN_14_USED
+#endif
+
 #endif /* __EC_PARAMS_BRAINPOOLP224R1_H__ */
 
 #endif /* WITH_CURVE_BRAINPOOLP224R1 */
@@ -153,6 +153,1326 @@ TO_EC_STR_PARAM(brainpoolp256r1_oid);
 static const u8 brainpoolp256r1_name[] = "BRAINPOOLP256R1";
 TO_EC_STR_PARAM(brainpoolp256r1_name);
 
+/* x^(p - 2): 254 squarings and 60 multiplications */
+static const u8 brainpoolp256r1_p_inv[] = {
+	0x10, 0x01, 0xff,
+	0x20, 0x00, 0x01,
+	0x32, 0x00, 0x01,
+	0x43, 0x00, 0x01,
+	0x54, 0x00, 0x01,
+	0x65, 0x00, 0x01,
+	0x76, 0x00, 0x01,
+	0x87, 0x00, 0x01,
+	0x93, 0x05, 0x05,
+	0x99, 0x04, 0x08,
+	0x99, 0x04, 0x06,
+	0x99, 0x04, 0x03,
+	0x99, 0x05, 0x08,
+	0x99, 0x04, 0x06,
+	0x99, 0x04, 0x04,
+	0x99, 0x02, 0x00,
+	0x99, 0x08, 0x08,
+	0x99, 0x04, 0x04,
+	0x99, 0x04, 0x03,
+	0x99, 0x05, 0x05,
+	0x99, 0x04, 0x06,
+	0x99, 0x02, 0x02,
+	0x99, 0x08, 0x08,
+	0x99, 0x04, 0x05,
+	0x99, 0x04, 0x05,
+	0x99, 0x01, 0x00,
+	0x99, 0x08, 0x03,
+	0x99, 0x05, 0x05,
+	0x99, 0x08, 0x05,
+	0x99, 0x04, 0x07,
+	0x99, 0x01, 0x00,
+	0x99, 0x08, 0x04,
+	0x99, 0x07, 0x07,
+	0x99, 0x04, 0x04,
+	0x99, 0x06, 0x05,
+	0x99, 0x04, 0x06,
+	0x99, 0x01, 0x00,
+	0x99, 0x06, 0x04,
+	0x99, 0x05, 0x08,
+	0x99, 0x02, 0x02,
+	0x99, 0x03, 0x02,
+	0x99, 0x04, 0x00,
+	0x99, 0x07, 0x08,
+	0x99, 0x04, 0x03,
+	0x99, 0x05, 0x05,
+	0x99, 0x04, 0x02,
+	0x99, 0x04, 0x00,
+	0x99, 0x0a, 0x03,
+	0x99, 0x06, 0x00,
+	0x99, 0x0c, 0x05,
+	0x99, 0x03, 0x03,
+	0x99, 0x03, 0x00,
+	0x99, 0x09, 0x04,
+	0x99, 0x02, 0x00,
+	0x99, 0x07, 0x08,
+	0x99, 0x04, 0x06,
+	0x99, 0x04, 0x04,
+	0x99, 0x05, 0x03,
+	0x99, 0x06, 0x07,
+	0x99, 0x04, 0x07,
+	0x99, 0x02, 0x00,
+};
+TO_EC_CHAIN_PARAM(brainpoolp256r1_p_inv);
+
+/* x^((p + 1) / 4): 252 squarings and 59 multiplications */
+static const u8 brainpoolp256r1_p_sqrt[] = {
+	0x10, 0x01, 0xff,
+	0x20, 0x00, 0x01,
+	0x32, 0x00, 0x01,
+	0x43, 0x00, 0x01,
+	0x54, 0x00, 0x01,
+	0x65, 0x00, 0x01,
+	0x76, 0x00, 0x01,
+	0x87, 0x00, 0x01,
+	0x93, 0x05, 0x05,
+	0x99, 0x04, 0x08,
+	0x99, 0x04, 0x06,
+	0x99, 0x04, 0x03,
+	0x99, 0x05, 0x08,
+	0x99, 0x04, 0x06,
+	0x99, 0x04, 0x04,
+	0x99, 0x02, 0x00,
+	0x99, 0x08, 0x08,
+	0x99, 0x04, 0x04,
+	0x99, 0x04, 0x03,
+	0x99, 0x05, 0x05,
+	0x99, 0x04, 0x06,
+	0x99, 0x02, 0x02,
+	0x99, 0x08, 0x08,
+	0x99, 0x04, 0x05,
+	0x99, 0x04, 0x05,
+	0x99, 0x01, 0x00,
+	0x99, 0x08, 0x03,
+	0x99, 0x05, 0x05,
+	0x99, 0x08, 0x05,
+	0x99, 0x04, 0x07,
+	0x99, 0x01, 0x00,
+	0x99, 0x08, 0x04,
+	0x99, 0x07, 0x07,
+	0x99, 0x04, 0x04,
+	0x99, 0x06, 0x05,
+	0x99, 0x04, 0x06,
+	0x99, 0x01, 0x00,
+	0x99, 0x06, 0x04,
+	0x99, 0x05, 0x08,
+	0x99, 0x02, 0x02,
+	0x99, 0x03, 0x02,
+	0x99, 0x04, 0x00,
+	0x99, 0x07, 0x08,
+	0x99, 0x04, 0x03,
+	0x99, 0x05, 0x05,
+	0x99, 0x04, 0x02,
+	0x99, 0x04, 0x00,
+	0x99, 0x0a, 0x03,
+	0x99, 0x06, 0x00,
+	0x99, 0x0c, 0x05,
+	0x99, 0x03, 0x03,
+	0x99, 0x03, 0x00,
+	0x99, 0x09, 0x04,
+	0x99, 0x02, 0x00,
+	0x99, 0x07, 0x08,
+	0x99, 0x04, 0x06,
+	0x99, 0x04, 0x04,
+	0x99, 0x05, 0x03,
+	0x99, 0x06, 0x07,
+	0x99, 0x03, 0x04,
+	0x99, 0x01, 0xff,
+};
+TO_EC_CHAIN_PARAM(brainpoolp256r1_p_sqrt);
+
+/* x^(q - 2): 254 squarings and 58 multiplications */
+static const u8 brainpoolp256r1_q_inv[] = {
+	0x10, 0x01, 0xff,
+	0x20, 0x00, 0x01,
+	0x32, 0x00, 0x01,
+	0x43, 0x00, 0x01,
+	0x54, 0x00, 0x01,
+	0x65, 0x00, 0x01,
+	0x76, 0x00, 0x01,
+	0x87, 0x00, 0x01,
+	0x93, 0x05, 0x05,
+	0x99, 0x04, 0x08,
+	0x99, 0x04, 0x06,
+	0x99, 0x04, 0x03,
+	0x99, 0x05, 0x08,
+	0x99, 0x04, 0x06,
+	0x99, 0x04, 0x04,
+	0x99, 0x02, 0x00,
+	0x99, 0x08, 0x08,
+	0x99, 0x04, 0x04,
+	0x99, 0x04, 0x03,
+	0x99, 0x05, 0x05,
+	0x99, 0x04, 0x06,
+	0x99, 0x02, 0x02,
+	0x99, 0x08, 0x08,
+	0x99, 0x04, 0x05,
+	0x99, 0x04, 0x05,
+	0x99, 0x01, 0x00,
+	0x99, 0x08, 0x03,
+	0x99, 0x05, 0x05,
+	0x99, 0x08, 0x05,
+	0x99, 0x04, 0x07,
+	0x99, 0x01, 0x00,
+	0x99, 0x08, 0x04,
+	0x99, 0x07, 0x07,
+	0x99, 0x04, 0x04,
+	0x99, 0x05, 0x02,
+	0x99, 0x05, 0x02,
+	0x99, 0x07, 0x04,
+	0x99, 0x06, 0x06,
+	0x99, 0x04, 0x07,
+	0x99, 0x04, 0x03,
+	0x99, 0x06, 0x04,
+	0x99, 0x05, 0x07,
+	0x99, 0x05, 0x06,
+	0x99, 0x08, 0x07,
+	0x99, 0x06, 0x07,
+	0x99, 0x03, 0x04,
+	0x99, 0x05, 0x08,
+	0x99, 0x03, 0x00,
+	0x99, 0x0b, 0x08,
+	0x99, 0x08, 0x04,
+	0x99, 0x02, 0x00,
+	0x99, 0x08, 0x03,
+	0x99, 0x06, 0x06,
+	0x99, 0x03, 0x03,
+	0x99, 0x03, 0x00,
+	0x99, 0x07, 0x03,
+	0x99, 0x05, 0x07,
+	0x99, 0x05, 0x05,
+	0x99, 0x02, 0x00,
+};
+TO_EC_CHAIN_PARAM(brainpoolp256r1_q_inv);
+
+/*
+ * Odd multiples G, 3G, ..., 63G of the generator for the wNAF
+ * multiplications (window 7), affine x and y in Montgomery representation
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+static const word_t brainpoolp256r1_gen_wnaf[] = {
+	/* G */
+	WORD(0x27c0d92d351fd10c), WORD(0x80de4d9ab97cf30a),
+	WORD(0x704c311d6b892ad3), WORD(0x8e1f767a9e119bdf),
+	WORD(0x9a4fe948a0917a17), WORD(0xa618f259cd950162),
+	WORD(0x16fdf6e8dfbd8b03), WORD(0x14eb78c6026eb0a2),
+	/* 3G */
+	WORD(0xaa507f5cfa406636), WORD(0xe517f879886aa273),
+	WORD(0x4f660096a8eb1afa), WORD(0x8f8f3eec9755935e),
+	WORD(0x849dff286297f4e2), WORD(0x2bb4487ecd0ed256),
+	WORD(0x8b19494dc6abd8ed), WORD(0x3516f65c464340db),
+	/* 5G */
+	WORD(0xe74500cb345c1284), WORD(0x729f8232134e92cf),
+	WORD(0xb9fcffbd6686a595), WORD(0xa0ab5ddae6838b67),
+	WORD(0x2a6ab774f9a5f7a4), WORD(0x0f9d609261dd9e56),
+	WORD(0x5663e73d8b25b304), WORD(0x11742af4bd639ade),
+	/* 7G */
+	WORD(0x01ce34a7f2fd1b8a), WORD(0x6edc83eed18dc9f7),
+	WORD(0xbfeb8f85e2dd5f00), WORD(0x1e03b6ef1fe3dda2),
+	WORD(0x49dc8184d7366bf7), WORD(0x91225523930a87db),
+	WORD(0x5c283cba6afc3baf), WORD(0x09de2cbc78fba28d),
+	/* 9G */
+	WORD(0xa4ea2b45f77b8821), WORD(0x7a69e7e18fa9bc50),
+	WORD(0xf8c396e79e035008), WORD(0x63c9a8386f4f43db),
+	WORD(0x8174716a362876a6), WORD(0xd8b9f0a4049bae5c),
+	WORD(0xfde5604ad5c671ef), WORD(0x84e49f6a21b4721f),
+	/* 11G */
+	WORD(0x74bf8246fceaa339), WORD(0xf3cf7204fa6486f3),
+	WORD(0xc9009944edac98a7), WORD(0x11a9e27dbacc3348),
+	WORD(0x1f19bf74307f4ab1), WORD(0x15821bdb3671c086),
+	WORD(0x34a20009be634c5c), WORD(0x4f6e11be4ce431f6),
+	/* 13G */
+	WORD(0xb281261783c9c95e), WORD(0x1c0e92062c9e7c3e),
+	WORD(0xc60e9a7f7d11072d), WORD(0x8ac66c9179879b49),
+	WORD(0x0d8058c31473fd6c), WORD(0x77480d4afa62d061),
+	WORD(0x4cf615d41aebc5ff), WORD(0x3f04f1f713df5fd5),
+	/* 15G */
+	WORD(0x2caa81c4c5e7e832), WORD(0xb6bb1a3e3010ef7e),
+	WORD(0xb7f0406534cf426c), WORD(0x2097833ebbc098a2),
+	WORD(0x15e01042f6af51cc), WORD(0x60f4ba3aac4bbb9b),
+	WORD(0xe91961b785817239), WORD(0x6628b3235363c415),
+	/* 17G */
+	WORD(0x2767ab03196e2e27), WORD(0xef8bdb4470342182),
+	WORD(0xe23020accb3d64f0), WORD(0x19559810165aff4f),
+	WORD(0x27cfee619745e8df), WORD(0xcbb56f7d120a9820),
+	WORD(0x9cd6da6b4b051834), WORD(0xa8055fb19a008d53),
+	/* 19G */
+	WORD(0xd0124f0182822b3d), WORD(0xc57c10b6c8680ac6),
+	WORD(0xfa60ee47d7ccecd2), WORD(0x36d2215e83155f4c),
+	WORD(0x1607c49d69f39012), WORD(0xd2ec910e04a44798),
+	WORD(0xafac93d4a3ee685a), WORD(0x56d2b936b762f1fc),
+	/* 21G */
+	WORD(0x7a8d3ac31a582ade), WORD(0x37d8f386b359f1d8),
+	WORD(0x3a6ac3cd28c2db03), WORD(0xa77b56cf3c61b4cb),
+	WORD(0x7e7fdd0e21546b20), WORD(0x4e83f37f823b4be6),
+	WORD(0x9826d565708a72e7), WORD(0x7cdb0be38250214a),
+	/* 23G */
+	WORD(0x312530759a1e62a3), WORD(0x67dccdf893dab9d6),
+	WORD(0x4e1523d87b10cdd8), WORD(0x5eb29555c8b1e9c2),
+	WORD(0xc50a7ca419987c5f), WORD(0x307ecba42fdad1b3),
+	WORD(0x8672b97a4f3db907), WORD(0x8a986f156409fdbb),
+	/* 25G */
+	WORD(0x648a8accc6b7e18c), WORD(0xe3c3041e0756f833),
+	WORD(0xe081d7255fb04406), WORD(0x94992f4d1b32f528),
+	WORD(0xc3f555d8ed812ff4), WORD(0xc24685d7cfcf8521),
+	WORD(0xe07c9c7e06ff9ba5), WORD(0xa0cf403d5c615019),
+	/* 27G */
+	WORD(0x0fdbb75a1aab6ac7), WORD(0x56724e68972159f2),
+	WORD(0xc353e00f5f7f5f84), WORD(0x33eef9ff206a6c13),
+	WORD(0xddacd2be927288f3), WORD(0xf3d6d5248a242176),
+	WORD(0x901cf86922fb0e35), WORD(0x566d26dfb099c464),
+	/* 29G */
+	WORD(0x98628a359ddb3637), WORD(0xc936a511c983aa44),
+	WORD(0x26bd58c4dbe4126a), WORD(0x998f8a8a5780745f),
+	WORD(0xfa690a4193626da9), WORD(0xf2a25e1ecdb4c90b),
+	WORD(0x2eef3d4255a5479f), WORD(0x462847ec3303243e),
+	/* 31G */
+	WORD(0xcb9693a287be0c89), WORD(0x958e83d2adffcc57),
+	WORD(0x02352fca3f8262e4), WORD(0x73d8d51c35b74eb4),
+	WORD(0xb60ec74a78fad415), WORD(0xd86dad3ee95443f6),
+	WORD(0x349d285325c669b2), WORD(0x34f55f5ea551ba89),
+	/* 33G */
+	WORD(0xdaa29729b449369a), WORD(0x8d72c36e29490ca9),
+	WORD(0x332d3ea6a589afdc), WORD(0x47385308e969ff44),
+	WORD(0x6884328dfa6f1613), WORD(0xbac34bcfcf1aeb1e),
+	WORD(0x3c6af865a6c7148e), WORD(0x2a98293c8bafb2eb),
+	/* 35G */
+	WORD(0xe2b6c46c9bb6070e), WORD(0x43303c89fe04b1aa),
+	WORD(0x87b425853a384ddd), WORD(0x1f5bcb2c6cda4e44),
+	WORD(0xb4151d93a8ca8ab7), WORD(0xa686ddcb3b5daefa),
+	WORD(0x97e1823143be1625), WORD(0x954b70efda2df323),
+	/* 37G */
+	WORD(0xf30b0db911ebac9e), WORD(0x90eba66a47e985f0),
+	WORD(0x671fcc3a2e8be80a), WORD(0x0b9f9f07f8e79edf),
+	WORD(0xf193f19a7134b789), WORD(0x2d2264d087087516),
+	WORD(0x322f1d6995e773bb), WORD(0x370dc8a839cf8da8),
+	/* 39G */
+	WORD(0xe34a97cc6dfafa06), WORD(0xaaeda87b85fa6232),
+	WORD(0xc390a559a3150e69), WORD(0x26df3a1f58c5c05e),
+	WORD(0x4ebba2f18245a453), WORD(0x3fb99f0c71e4ad8f),
+	WORD(0x96d73cf301b7ed36), WORD(0x4e3a5d57472c8831),
+	/* 41G */
+	WORD(0x75ea87f30bdc768a), WORD(0x7c27dc6f05767419),
+	WORD(0xbd39026a5e558743), WORD(0x3e935fba6dc9c33b),
+	WORD(0xd3c9a40ded099fab), WORD(0xe65884a64bde6772),
+	WORD(0xd6dd6f9ebc17e7e4), WORD(0x4f83e6cfb8e64998),
+	/* 43G */
+	WORD(0xb2974499f1f6fb2c), WORD(0x09b8aca831272af9),
+	WORD(0xc60f05f704a4e0ea), WORD(0x2ff3a30d2af79218),
+	WORD(0xd95513641c5af7a2), WORD(0x2cc2f604c773f002),
+	WORD(0x17bd747b16369b3c), WORD(0x623e39674fc423c3),
+	/* 45G */
+	WORD(0x73fb3e697ed87dfa), WORD(0x24f1ee8acb7745c0),
+	WORD(0xaf9617173bab879d), WORD(0x1e91b1e10ef9aa03),
+	WORD(0x6806204b889d31de), WORD(0xc6ed3e193ae90a88),
+	WORD(0xc0ed1b8f57006e63), WORD(0x6cb96056e3c9843d),
+	/* 47G */
+	WORD(0x5daf64df676863bb), WORD(0x9daabf2047679099),
+	WORD(0x084f22096f3ec9eb), WORD(0x8ed41e8d66a2f365),
+	WORD(0x8d43bd6b1a4cb31b), WORD(0x71b80152145f3512),
+	WORD(0xc957445377a50f1d), WORD(0x70b1df3107fe1f51),
+	/* 49G */
+	WORD(0x6aa2be5004555cd0), WORD(0xc749a6de55c3489a),
+	WORD(0xe5dead8d749b43f9), WORD(0x5cca3f9ffcd743ad),
+	WORD(0x19d3b815b69daea2), WORD(0xb0e161b79a0eac25),
+	WORD(0x22cf09ed1355c262), WORD(0x5a9b9f9bb9abade6),
+	/* 51G */
+	WORD(0x86efc2647b66d740), WORD(0x1bb0049579e6c228),
+	WORD(0x3e450f39c671437b), WORD(0x84f644422fe57a59),
+	WORD(0xbe128daa563b1225), WORD(0xceeee1b1c0005eec),
+	WORD(0xdc30996637f21309), WORD(0x4f3f211b48e3b120),
+	/* 53G */
+	WORD(0x6952b2e39d6cbcb9), WORD(0xee6151847deda3e0),
+	WORD(0x68e16255499ea6b0), WORD(0x781c6bec2ed54236),
+	WORD(0xe8f1374f0405f1c4), WORD(0x7432dc1621ed83f3),
+	WORD(0x093f9f9c25782771), WORD(0x8c4220b87d9ba60a),
+	/* 55G */
+	WORD(0x3bd097ec087e0354), WORD(0x4c6da8058d8d266c),
+	WORD(0x2e38b3a59c1a8837), WORD(0x1a622e4eaa1629ca),
+	WORD(0xb941f4d93086f890), WORD(0x55fa1ab39ff7d4e4),
+	WORD(0xe2576b7f3e5feb75), WORD(0x3e8c612356282ce5),
+	/* 57G */
+	WORD(0x578baa48532d1612), WORD(0xbb2d9659abe3131c),
+	WORD(0x88eb4e7845fb00d3), WORD(0x01a0866edae26ebe),
+	WORD(0x9830fa11365db105), WORD(0x95f51a78a165c212),
+	WORD(0x48e3d000bc460fcb), WORD(0x95c4bf1eca032c58),
+	/* 59G */
+	WORD(0x7155991e8e4f621f), WORD(0xeed68b1bd64ab98d),
+	WORD(0x04e5f245b479155c), WORD(0x9f80e6392825945d),
+	WORD(0x1e253294c0d689f9), WORD(0x0422ddba28132e4e),
+	WORD(0xdac660bad0ad2d7b), WORD(0x899e0fe7dda85300),
+	/* 61G */
+	WORD(0xc5337237118c295b), WORD(0x81c84375ad4068d5),
+	WORD(0xf5cefb805b884049), WORD(0xa3e0431000412af1),
+	WORD(0xfd40487ea26e9696), WORD(0x4352758436fec6f1),
+	WORD(0x343c24bd5e89bb5e), WORD(0xa6077405d23c8c0b),
+	/* 63G */
+	WORD(0x773554597b4386e4), WORD(0x32b52214e2cbe766),
+	WORD(0x88430973ab789194), WORD(0x772870a06034d407),
+	WORD(0x3cf868384da8feb1), WORD(0xbe6ea4169b0bd03b),
+	WORD(0x1c0af721b19abe4f), WORD(0x7f95fa5bee3e1f8e),
+};
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+static const word_t brainpoolp256r1_gen_wnaf[] = {
+	/* G */
+	WORD(0x351fd10c), WORD(0x27c0d92d), WORD(0xb97cf30a), WORD(0x80de4d9a),
+	WORD(0x6b892ad3), WORD(0x704c311d), WORD(0x9e119bdf), WORD(0x8e1f767a),
+	WORD(0xa0917a17), WORD(0x9a4fe948), WORD(0xcd950162), WORD(0xa618f259),
+	WORD(0xdfbd8b03), WORD(0x16fdf6e8), WORD(0x026eb0a2), WORD(0x14eb78c6),
+	/* 3G */
+	WORD(0xfa406636), WORD(0xaa507f5c), WORD(0x886aa273), WORD(0xe517f879),
+	WORD(0xa8eb1afa), WORD(0x4f660096), WORD(0x9755935e), WORD(0x8f8f3eec),
+	WORD(0x6297f4e2), WORD(0x849dff28), WORD(0xcd0ed256), WORD(0x2bb4487e),
+	WORD(0xc6abd8ed), WORD(0x8b19494d), WORD(0x464340db), WORD(0x3516f65c),
+	/* 5G */
+	WORD(0x345c1284), WORD(0xe74500cb), WORD(0x134e92cf), WORD(0x729f8232),
+	WORD(0x6686a595), WORD(0xb9fcffbd), WORD(0xe6838b67), WORD(0xa0ab5dda),
+	WORD(0xf9a5f7a4), WORD(0x2a6ab774), WORD(0x61dd9e56), WORD(0x0f9d6092),
+	WORD(0x8b25b304), WORD(0x5663e73d), WORD(0xbd639ade), WORD(0x11742af4),
+	/* 7G */
+	WORD(0xf2fd1b8a), WORD(0x01ce34a7), WORD(0xd18dc9f7), WORD(0x6edc83ee),
+	WORD(0xe2dd5f00), WORD(0xbfeb8f85), WORD(0x1fe3dda2), WORD(0x1e03b6ef),
+	WORD(0xd7366bf7), WORD(0x49dc8184), WORD(0x930a87db), WORD(0x91225523),
+	WORD(0x6afc3baf), WORD(0x5c283cba), WORD(0x78fba28d), WORD(0x09de2cbc),
+	/* 9G */
+	WORD(0xf77b8821), WORD(0xa4ea2b45), WORD(0x8fa9bc50), WORD(0x7a69e7e1),
+	WORD(0x9e035008), WORD(0xf8c396e7), WORD(0x6f4f43db), WORD(0x63c9a838),
+	WORD(0x362876a6), WORD(0x8174716a), WORD(0x049bae5c), WORD(0xd8b9f0a4),
+	WORD(0xd5c671ef), WORD(0xfde5604a), WORD(0x21b4721f), WORD(0x84e49f6a),
+	/* 11G */
+	WORD(0xfceaa339), WORD(0x74bf8246), WORD(0xfa6486f3), WORD(0xf3cf7204),
+	WORD(0xedac98a7), WORD(0xc9009944), WORD(0xbacc3348), WORD(0x11a9e27d),
+	WORD(0x307f4ab1), WORD(0x1f19bf74), WORD(0x3671c086), WORD(0x15821bdb),
+	WORD(0xbe634c5c), WORD(0x34a20009), WORD(0x4ce431f6), WORD(0x4f6e11be),
+	/* 13G */
+	WORD(0x83c9c95e), WORD(0xb2812617), WORD(0x2c9e7c3e), WORD(0x1c0e9206),
+	WORD(0x7d11072d), WORD(0xc60e9a7f), WORD(0x79879b49), WORD(0x8ac66c91),
+	WORD(0x1473fd6c), WORD(0x0d8058c3), WORD(0xfa62d061), WORD(0x77480d4a),
+	WORD(0x1aebc5ff), WORD(0x4cf615d4), WORD(0x13df5fd5), WORD(0x3f04f1f7),
+	/* 15G */
+	WORD(0xc5e7e832), WORD(0x2caa81c4), WORD(0x3010ef7e), WORD(0xb6bb1a3e),
+	WORD(0x34cf426c), WORD(0xb7f04065), WORD(0xbbc098a2), WORD(0x2097833e),
+	WORD(0xf6af51cc), WORD(0x15e01042), WORD(0xac4bbb9b), WORD(0x60f4ba3a),
+	WORD(0x85817239), WORD(0xe91961b7), WORD(0x5363c415), WORD(0x6628b323),
+	/* 17G */
+	WORD(0x196e2e27), WORD(0x2767ab03), WORD(0x70342182), WORD(0xef8bdb44),
+	WORD(0xcb3d64f0), WORD(0xe23020ac), WORD(0x165aff4f), WORD(0x19559810),
+	WORD(0x9745e8df), WORD(0x27cfee61), WORD(0x120a9820), WORD(0xcbb56f7d),
+	WORD(0x4b051834), WORD(0x9cd6da6b), WORD(0x9a008d53), WORD(0xa8055fb1),
+	/* 19G */
+	WORD(0x82822b3d), WORD(0xd0124f01), WORD(0xc8680ac6), WORD(0xc57c10b6),
+	WORD(0xd7ccecd2), WORD(0xfa60ee47), WORD(0x83155f4c), WORD(0x36d2215e),
+	WORD(0x69f39012), WORD(0x1607c49d), WORD(0x04a44798), WORD(0xd2ec910e),
+	WORD(0xa3ee685a), WORD(0xafac93d4), WORD(0xb762f1fc), WORD(0x56d2b936),
+	/* 21G */
+	WORD(0x1a582ade), WORD(0x7a8d3ac3), WORD(0xb359f1d8), WORD(0x37d8f386),
+	WORD(0x28c2db03), WORD(0x3a6ac3cd), WORD(0x3c61b4cb), WORD(0xa77b56cf),
+	WORD(0x21546b20), WORD(0x7e7fdd0e), WORD(0x823b4be6), WORD(0x4e83f37f),
+	WORD(0x708a72e7), WORD(0x9826d565), WORD(0x8250214a), WORD(0x7cdb0be3),
+	/* 23G */
+	WORD(0x9a1e62a3), WORD(0x31253075), WORD(0x93dab9d6), WORD(0x67dccdf8),
+	WORD(0x7b10cdd8), WORD(0x4e1523d8), WORD(0xc8b1e9c2), WORD(0x5eb29555),
+	WORD(0x19987c5f), WORD(0xc50a7ca4), WORD(0x2fdad1b3), WORD(0x307ecba4),
+	WORD(0x4f3db907), WORD(0x8672b97a), WORD(0x6409fdbb), WORD(0x8a986f15),
+	/* 25G */
+	WORD(0xc6b7e18c), WORD(0x648a8acc), WORD(0x0756f833), WORD(0xe3c3041e),
+	WORD(0x5fb04406), WORD(0xe081d725), WORD(0x1b32f528), WORD(0x94992f4d),
+	WORD(0xed812ff4), WORD(0xc3f555d8), WORD(0xcfcf8521), WORD(0xc24685d7),
+	WORD(0x06ff9ba5), WORD(0xe07c9c7e), WORD(0x5c615019), WORD(0xa0cf403d),
+	/* 27G */
+	WORD(0x1aab6ac7), WORD(0x0fdbb75a), WORD(0x972159f2), WORD(0x56724e68),
+	WORD(0x5f7f5f84), WORD(0xc353e00f), WORD(0x206a6c13), WORD(0x33eef9ff),
+	WORD(0x927288f3), WORD(0xddacd2be), WORD(0x8a242176), WORD(0xf3d6d524),
+	WORD(0x22fb0e35), WORD(0x901cf869), WORD(0xb099c464), WORD(0x566d26df),
+	/* 29G */
+	WORD(0x9ddb3637), WORD(0x98628a35), WORD(0xc983aa44), WORD(0xc936a511),
+	WORD(0xdbe4126a), WORD(0x26bd58c4), WORD(0x5780745f), WORD(0x998f8a8a),
+	WORD(0x93626da9), WORD(0xfa690a41), WORD(0xcdb4c90b), WORD(0xf2a25e1e),
+	WORD(0x55a5479f), WORD(0x2eef3d42), WORD(0x3303243e), WORD(0x462847ec),
+	/* 31G */
+	WORD(0x87be0c89), WORD(0xcb9693a2), WORD(0xadffcc57), WORD(0x958e83d2),
+	WORD(0x3f8262e4), WORD(0x02352fca), WORD(0x35b74eb4), WORD(0x73d8d51c),
+	WORD(0x78fad415), WORD(0xb60ec74a), WORD(0xe95443f6), WORD(0xd86dad3e),
+	WORD(0x25c669b2), WORD(0x349d2853), WORD(0xa551ba89), WORD(0x34f55f5e),
+	/* 33G */
+	WORD(0xb449369a), WORD(0xdaa29729), WORD(0x29490ca9), WORD(0x8d72c36e),
+	WORD(0xa589afdc), WORD(0x332d3ea6), WORD(0xe969ff44), WORD(0x47385308),
+	WORD(0xfa6f1613), WORD(0x6884328d), WORD(0xcf1aeb1e), WORD(0xbac34bcf),
+	WORD(0xa6c7148e), WORD(0x3c6af865), WORD(0x8bafb2eb), WORD(0x2a98293c),
+	/* 35G */
+	WORD(0x9bb6070e), WORD(0xe2b6c46c), WORD(0xfe04b1aa), WORD(0x43303c89),
+	WORD(0x3a384ddd), WORD(0x87b42585), WORD(0x6cda4e44), WORD(0x1f5bcb2c),
+	WORD(0xa8ca8ab7), WORD(0xb4151d93), WORD(0x3b5daefa), WORD(0xa686ddcb),
+	WORD(0x43be1625), WORD(0x97e18231), WORD(0xda2df323), WORD(0x954b70ef),
+	/* 37G */
+	WORD(0x11ebac9e), WORD(0xf30b0db9), WORD(0x47e985f0), WORD(0x90eba66a),
+	WORD(0x2e8be80a), WORD(0x671fcc3a), WORD(0xf8e79edf), WORD(0x0b9f9f07),
+	WORD(0x7134b789), WORD(0xf193f19a), WORD(0x87087516), WORD(0x2d2264d0),
+	WORD(0x95e773bb), WORD(0x322f1d69), WORD(0x39cf8da8), WORD(0x370dc8a8),
+	/* 39G */
+	WORD(0x6dfafa06), WORD(0xe34a97cc), WORD(0x85fa6232), WORD(0xaaeda87b),
+	WORD(0xa3150e69), WORD(0xc390a559), WORD(0x58c5c05e), WORD(0x26df3a1f),
+	WORD(0x8245a453), WORD(0x4ebba2f1), WORD(0x71e4ad8f), WORD(0x3fb99f0c),
+	WORD(0x01b7ed36), WORD(0x96d73cf3), WORD(0x472c8831), WORD(0x4e3a5d57),
+	/* 41G */
+	WORD(0x0bdc768a), WORD(0x75ea87f3), WORD(0x05767419), WORD(0x7c27dc6f),
+	WORD(0x5e558743), WORD(0xbd39026a), WORD(0x6dc9c33b), WORD(0x3e935fba),
+	WORD(0xed099fab), WORD(0xd3c9a40d), WORD(0x4bde6772), WORD(0xe65884a6),
+	WORD(0xbc17e7e4), WORD(0xd6dd6f9e), WORD(0xb8e64998), WORD(0x4f83e6cf),
+	/* 43G */
+	WORD(0xf1f6fb2c), WORD(0xb2974499), WORD(0x31272af9), WORD(0x09b8aca8),
+	WORD(0x04a4e0ea), WORD(0xc60f05f7), WORD(0x2af79218), WORD(0x2ff3a30d),
+	WORD(0x1c5af7a2), WORD(0xd9551364), WORD(0xc773f002), WORD(0x2cc2f604),
+	WORD(0x16369b3c), WORD(0x17bd747b), WORD(0x4fc423c3), WORD(0x623e3967),
+	/* 45G */
+	WORD(0x7ed87dfa), WORD(0x73fb3e69), WORD(0xcb7745c0), WORD(0x24f1ee8a),
+	WORD(0x3bab879d), WORD(0xaf961717), WORD(0x0ef9aa03), WORD(0x1e91b1e1),
+	WORD(0x889d31de), WORD(0x6806204b), WORD(0x3ae90a88), WORD(0xc6ed3e19),
+	WORD(0x57006e63), WORD(0xc0ed1b8f), WORD(0xe3c9843d), WORD(0x6cb96056),
+	/* 47G */
+	WORD(0x676863bb), WORD(0x5daf64df), WORD(0x47679099), WORD(0x9daabf20),
+	WORD(0x6f3ec9eb), WORD(0x084f2209), WORD(0x66a2f365), WORD(0x8ed41e8d),
+	WORD(0x1a4cb31b), WORD(0x8d43bd6b), WORD(0x145f3512), WORD(0x71b80152),
+	WORD(0x77a50f1d), WORD(0xc9574453), WORD(0x07fe1f51), WORD(0x70b1df31),
+	/* 49G */
+	WORD(0x04555cd0), WORD(0x6aa2be50), WORD(0x55c3489a), WORD(0xc749a6de),
+	WORD(0x749b43f9), WORD(0xe5dead8d), WORD(0xfcd743ad), WORD(0x5cca3f9f),
+	WORD(0xb69daea2), WORD(0x19d3b815), WORD(0x9a0eac25), WORD(0xb0e161b7),
+	WORD(0x1355c262), WORD(0x22cf09ed), WORD(0xb9abade6), WORD(0x5a9b9f9b),
+	/* 51G */
+	WORD(0x7b66d740), WORD(0x86efc264), WORD(0x79e6c228), WORD(0x1bb00495),
+	WORD(0xc671437b), WORD(0x3e450f39), WORD(0x2fe57a59), WORD(0x84f64442),
+	WORD(0x563b1225), WORD(0xbe128daa), WORD(0xc0005eec), WORD(0xceeee1b1),
+	WORD(0x37f21309), WORD(0xdc309966), WORD(0x48e3b120), WORD(0x4f3f211b),
+	/* 53G */
+	WORD(0x9d6cbcb9), WORD(0x6952b2e3), WORD(0x7deda3e0), WORD(0xee615184),
+	WORD(0x499ea6b0), WORD(0x68e16255), WORD(0x2ed54236), WORD(0x781c6bec),
+	WORD(0x0405f1c4), WORD(0xe8f1374f), WORD(0x21ed83f3), WORD(0x7432dc16),
+	WORD(0x25782771), WORD(0x093f9f9c), WORD(0x7d9ba60a), WORD(0x8c4220b8),
+	/* 55G */
+	WORD(0x087e0354), WORD(0x3bd097ec), WORD(0x8d8d266c), WORD(0x4c6da805),
+	WORD(0x9c1a8837), WORD(0x2e38b3a5), WORD(0xaa1629ca), WORD(0x1a622e4e),
+	WORD(0x3086f890), WORD(0xb941f4d9), WORD(0x9ff7d4e4), WORD(0x55fa1ab3),
+	WORD(0x3e5feb75), WORD(0xe2576b7f), WORD(0x56282ce5), WORD(0x3e8c6123),
+	/* 57G */
+	WORD(0x532d1612), WORD(0x578baa48), WORD(0xabe3131c), WORD(0xbb2d9659),
+	WORD(0x45fb00d3), WORD(0x88eb4e78), WORD(0xdae26ebe), WORD(0x01a0866e),
+	WORD(0x365db105), WORD(0x9830fa11), WORD(0xa165c212), WORD(0x95f51a78),
+	WORD(0xbc460fcb), WORD(0x48e3d000), WORD(0xca032c58), WORD(0x95c4bf1e),
+	/* 59G */
+	WORD(0x8e4f621f), WORD(0x7155991e), WORD(0xd64ab98d), WORD(0xeed68b1b),
+	WORD(0xb479155c), WORD(0x04e5f245), WORD(0x2825945d), WORD(0x9f80e639),
+	WORD(0xc0d689f9), WORD(0x1e253294), WORD(0x28132e4e), WORD(0x0422ddba),
+	WORD(0xd0ad2d7b), WORD(0xdac660ba), WORD(0xdda85300), WORD(0x899e0fe7),
+	/* 61G */
+	WORD(0x118c295b), WORD(0xc5337237), WORD(0xad4068d5), WORD(0x81c84375),
+	WORD(0x5b884049), WORD(0xf5cefb80), WORD(0x00412af1), WORD(0xa3e04310),
+	WORD(0xa26e9696), WORD(0xfd40487e), WORD(0x36fec6f1), WORD(0x43527584),
+	WORD(0x5e89bb5e), WORD(0x343c24bd), WORD(0xd23c8c0b), WORD(0xa6077405),
+	/* 63G */
+	WORD(0x7b4386e4), WORD(0x77355459), WORD(0xe2cbe766), WORD(0x32b52214),
+	WORD(0xab789194), WORD(0x88430973), WORD(0x6034d407), WORD(0x772870a0),
+	WORD(0x4da8feb1), WORD(0x3cf86838), WORD(0x9b0bd03b), WORD(0xbe6ea416),
+	WORD(0xb19abe4f), WORD(0x1c0af721), WORD(0xee3e1f8e), WORD(0x7f95fa5b),
+};
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+static const word_t brainpoolp256r1_gen_wnaf[] = {
+	/* G */
+	WORD(0xd10c), WORD(0x351f), WORD(0xd92d), WORD(0x27c0), WORD(0xf30a), WORD(0xb97c),
+	WORD(0x4d9a), WORD(0x80de), WORD(0x2ad3), WORD(0x6b89), WORD(0x311d), WORD(0x704c),
+	WORD(0x9bdf), WORD(0x9e11), WORD(0x767a), WORD(0x8e1f), WORD(0x7a17), WORD(0xa091),
+	WORD(0xe948), WORD(0x9a4f), WORD(0x0162), WORD(0xcd95), WORD(0xf259), WORD(0xa618),
+	WORD(0x8b03), WORD(0xdfbd), WORD(0xf6e8), WORD(0x16fd), WORD(0xb0a2), WORD(0x026e),
+	WORD(0x78c6), WORD(0x14eb),
+	/* 3G */
+	WORD(0x6636), WORD(0xfa40), WORD(0x7f5c), WORD(0xaa50), WORD(0xa273), WORD(0x886a),
+	WORD(0xf879), WORD(0xe517), WORD(0x1afa), WORD(0xa8eb), WORD(0x0096), WORD(0x4f66),
+	WORD(0x935e), WORD(0x9755), WORD(0x3eec), WORD(0x8f8f), WORD(0xf4e2), WORD(0x6297),
+	WORD(0xff28), WORD(0x849d), WORD(0xd256), WORD(0xcd0e), WORD(0x487e), WORD(0x2bb4),
+	WORD(0xd8ed), WORD(0xc6ab), WORD(0x494d), WORD(0x8b19), WORD(0x40db), WORD(0x4643),
+	WORD(0xf65c), WORD(0x3516),
+	/* 5G */
+	WORD(0x1284), WORD(0x345c), WORD(0x00cb), WORD(0xe745), WORD(0x92cf), WORD(0x134e),
+	WORD(0x8232), WORD(0x729f), WORD(0xa595), WORD(0x6686), WORD(0xffbd), WORD(0xb9fc),
+	WORD(0x8b67), WORD(0xe683), WORD(0x5dda), WORD(0xa0ab), WORD(0xf7a4), WORD(0xf9a5),
+	WORD(0xb774), WORD(0x2a6a), WORD(0x9e56), WORD(0x61dd), WORD(0x6092), WORD(0x0f9d),
+	WORD(0xb304), WORD(0x8b25), WORD(0xe73d), WORD(0x5663), WORD(0x9ade), WORD(0xbd63),
+	WORD(0x2af4), WORD(0x1174),
+	/* 7G */
+	WORD(0x1b8a), WORD(0xf2fd), WORD(0x34a7), WORD(0x01ce), WORD(0xc9f7), WORD(0xd18d),
+	WORD(0x83ee), WORD(0x6edc), WORD(0x5f00), WORD(0xe2dd), WORD(0x8f85), WORD(0xbfeb),
+	WORD(0xdda2), WORD(0x1fe3), WORD(0xb6ef), WORD(0x1e03), WORD(0x6bf7), WORD(0xd736),
+	WORD(0x8184), WORD(0x49dc), WORD(0x87db), WORD(0x930a), WORD(0x5523), WORD(0x9122),
+	WORD(0x3baf), WORD(0x6afc), WORD(0x3cba), WORD(0x5c28), WORD(0xa28d), WORD(0x78fb),
+	WORD(0x2cbc), WORD(0x09de),
+	/* 9G */
+	WORD(0x8821), WORD(0xf77b), WORD(0x2b45), WORD(0xa4ea), WORD(0xbc50), WORD(0x8fa9),
+	WORD(0xe7e1), WORD(0x7a69), WORD(0x5008), WORD(0x9e03), WORD(0x96e7), WORD(0xf8c3),
+	WORD(0x43db), WORD(0x6f4f), WORD(0xa838), WORD(0x63c9), WORD(0x76a6), WORD(0x3628),
+	WORD(0x716a), WORD(0x8174), WORD(0xae5c), WORD(0x049b), WORD(0xf0a4), WORD(0xd8b9),
+	WORD(0x71ef), WORD(0xd5c6), WORD(0x604a), WORD(0xfde5), WORD(0x721f), WORD(0x21b4),
+	WORD(0x9f6a), WORD(0x84e4),
+	/* 11G */
+	WORD(0xa339), WORD(0xfcea), WORD(0x8246), WORD(0x74bf), WORD(0x86f3), WORD(0xfa64),
+	WORD(0x7204), WORD(0xf3cf), WORD(0x98a7), WORD(0xedac), WORD(0x9944), WORD(0xc900),
+	WORD(0x3348), WORD(0xbacc), WORD(0xe27d), WORD(0x11a9), WORD(0x4ab1), WORD(0x307f),
+	WORD(0xbf74), WORD(0x1f19), WORD(0xc086), WORD(0x3671), WORD(0x1bdb), WORD(0x1582),
+	WORD(0x4c5c), WORD(0xbe63), WORD(0x0009), WORD(0x34a2), WORD(0x31f6), WORD(0x4ce4),
+	WORD(0x11be), WORD(0x4f6e),
+	/* 13G */
+	WORD(0xc95e), WORD(0x83c9), WORD(0x2617), WORD(0xb281), WORD(0x7c3e), WORD(0x2c9e),
+	WORD(0x9206), WORD(0x1c0e), WORD(0x072d), WORD(0x7d11), WORD(0x9a7f), WORD(0xc60e),
+	WORD(0x9b49), WORD(0x7987), WORD(0x6c91), WORD(0x8ac6), WORD(0xfd6c), WORD(0x1473),
+	WORD(0x58c3), WORD(0x0d80), WORD(0xd061), WORD(0xfa62), WORD(0x0d4a), WORD(0x7748),
+	WORD(0xc5ff), WORD(0x1aeb), WORD(0x15d4), WORD(0x4cf6), WORD(0x5fd5), WORD(0x13df),
+	WORD(0xf1f7), WORD(0x3f04),
+	/* 15G */
+	WORD(0xe832), WORD(0xc5e7), WORD(0x81c4), WORD(0x2caa), WORD(0xef7e), WORD(0x3010),
+	WORD(0x1a3e), WORD(0xb6bb), WORD(0x426c), WORD(0x34cf), WORD(0x4065), WORD(0xb7f0),
+	WORD(0x98a2), WORD(0xbbc0), WORD(0x833e), WORD(0x2097), WORD(0x51cc), WORD(0xf6af),
+	WORD(0x1042), WORD(0x15e0), WORD(0xbb9b), WORD(0xac4b), WORD(0xba3a), WORD(0x60f4),
+	WORD(0x7239), WORD(0x8581), WORD(0x61b7), WORD(0xe919), WORD(0xc415), WORD(0x5363),
+	WORD(0xb323), WORD(0x6628),
+	/* 17G */
+	WORD(0x2e27), WORD(0x196e), WORD(0xab03), WORD(0x2767), WORD(0x2182), WORD(0x7034),
+	WORD(0xdb44), WORD(0xef8b), WORD(0x64f0), WORD(0xcb3d), WORD(0x20ac), WORD(0xe230),
+	WORD(0xff4f), WORD(0x165a), WORD(0x9810), WORD(0x1955), WORD(0xe8df), WORD(0x9745),
+	WORD(0xee61), WORD(0x27cf), WORD(0x9820), WORD(0x120a), WORD(0x6f7d), WORD(0xcbb5),
+	WORD(0x1834), WORD(0x4b05), WORD(0xda6b), WORD(0x9cd6), WORD(0x8d53), WORD(0x9a00),
+	WORD(0x5fb1), WORD(0xa805),
+	/* 19G */
+	WORD(0x2b3d), WORD(0x8282), WORD(0x4f01), WORD(0xd012), WORD(0x0ac6), WORD(0xc868),
+	WORD(0x10b6), WORD(0xc57c), WORD(0xecd2), WORD(0xd7cc), WORD(0xee47), WORD(0xfa60),
+	WORD(0x5f4c), WORD(0x8315), WORD(0x215e), WORD(0x36d2), WORD(0x9012), WORD(0x69f3),
+	WORD(0xc49d), WORD(0x1607), WORD(0x4798), WORD(0x04a4), WORD(0x910e), WORD(0xd2ec),
+	WORD(0x685a), WORD(0xa3ee), WORD(0x93d4), WORD(0xafac), WORD(0xf1fc), WORD(0xb762),
+	WORD(0xb936), WORD(0x56d2),
+	/* 21G */
+	WORD(0x2ade), WORD(0x1a58), WORD(0x3ac3), WORD(0x7a8d), WORD(0xf1d8), WORD(0xb359),
+	WORD(0xf386), WORD(0x37d8), WORD(0xdb03), WORD(0x28c2), WORD(0xc3cd), WORD(0x3a6a),
+	WORD(0xb4cb), WORD(0x3c61), WORD(0x56cf), WORD(0xa77b), WORD(0x6b20), WORD(0x2154),
+	WORD(0xdd0e), WORD(0x7e7f), WORD(0x4be6), WORD(0x823b), WORD(0xf37f), WORD(0x4e83),
+	WORD(0x72e7), WORD(0x708a), WORD(0xd565), WORD(0x9826), WORD(0x214a), WORD(0x8250),
+	WORD(0x0be3), WORD(0x7cdb),
+	/* 23G */
+	WORD(0x62a3), WORD(0x9a1e), WORD(0x3075), WORD(0x3125), WORD(0xb9d6), WORD(0x93da),
+	WORD(0xcdf8), WORD(0x67dc), WORD(0xcdd8), WORD(0x7b10), WORD(0x23d8), WORD(0x4e15),
+	WORD(0xe9c2), WORD(0xc8b1), WORD(0x9555), WORD(0x5eb2), WORD(0x7c5f), WORD(0x1998),
+	WORD(0x7ca4), WORD(0xc50a), WORD(0xd1b3), WORD(0x2fda), WORD(0xcba4), WORD(0x307e),
+	WORD(0xb907), WORD(0x4f3d), WORD(0xb97a), WORD(0x8672), WORD(0xfdbb), WORD(0x6409),
+	WORD(0x6f15), WORD(0x8a98),
+	/* 25G */
+	WORD(0xe18c), WORD(0xc6b7), WORD(0x8acc), WORD(0x648a), WORD(0xf833), WORD(0x0756),
+	WORD(0x041e), WORD(0xe3c3), WORD(0x4406), WORD(0x5fb0), WORD(0xd725), WORD(0xe081),
+	WORD(0xf528), WORD(0x1b32), WORD(0x2f4d), WORD(0x9499), WORD(0x2ff4), WORD(0xed81),
+	WORD(0x55d8), WORD(0xc3f5), WORD(0x8521), WORD(0xcfcf), WORD(0x85d7), WORD(0xc246),
+	WORD(0x9ba5), WORD(0x06ff), WORD(0x9c7e), WORD(0xe07c), WORD(0x5019), WORD(0x5c61),
+	WORD(0x403d), WORD(0xa0cf),
+	/* 27G */
+	WORD(0x6ac7), WORD(0x1aab), WORD(0xb75a), WORD(0x0fdb), WORD(0x59f2), WORD(0x9721),
+	WORD(0x4e68), WORD(0x5672), WORD(0x5f84), WORD(0x5f7f), WORD(0xe00f), WORD(0xc353),
+	WORD(0x6c13), WORD(0x206a), WORD(0xf9ff), WORD(0x33ee), WORD(0x88f3), WORD(0x9272),
+	WORD(0xd2be), WORD(0xddac), WORD(0x2176), WORD(0x8a24), WORD(0xd524), WORD(0xf3d6),
+	WORD(0x0e35), WORD(0x22fb), WORD(0xf869), WORD(0x901c), WORD(0xc464), WORD(0xb099),
+	WORD(0x26df), WORD(0x566d),
+	/* 29G */
+	WORD(0x3637), WORD(0x9ddb), WORD(0x8a35), WORD(0x9862), WORD(0xaa44), WORD(0xc983),
+	WORD(0xa511), WORD(0xc936), WORD(0x126a), WORD(0xdbe4), WORD(0x58c4), WORD(0x26bd),
+	WORD(0x745f), WORD(0x5780), WORD(0x8a8a), WORD(0x998f), WORD(0x6da9), WORD(0x9362),
+	WORD(0x0a41), WORD(0xfa69), WORD(0xc90b), WORD(0xcdb4), WORD(0x5e1e), WORD(0xf2a2),
+	WORD(0x479f), WORD(0x55a5), WORD(0x3d42), WORD(0x2eef), WORD(0x243e), WORD(0x3303),
+	WORD(0x47ec), WORD(0x4628),
+	/* 31G */
+	WORD(0x0c89), WORD(0x87be), WORD(0x93a2), WORD(0xcb96), WORD(0xcc57), WORD(0xadff),
+	WORD(0x83d2), WORD(0x958e), WORD(0x62e4), WORD(0x3f82), WORD(0x2fca), WORD(0x0235),
+	WORD(0x4eb4), WORD(0x35b7), WORD(0xd51c), WORD(0x73d8), WORD(0xd415), WORD(0x78fa),
+	WORD(0xc74a), WORD(0xb60e), WORD(0x43f6), WORD(0xe954), WORD(0xad3e), WORD(0xd86d),
+	WORD(0x69b2), WORD(0x25c6), WORD(0x2853), WORD(0x349d), WORD(0xba89), WORD(0xa551),
+	WORD(0x5f5e), WORD(0x34f5),
+	/* 33G */
+	WORD(0x369a), WORD(0xb449), WORD(0x9729), WORD(0xdaa2), WORD(0x0ca9), WORD(0x2949),
+	WORD(0xc36e), WORD(0x8d72), WORD(0xafdc), WORD(0xa589), WORD(0x3ea6), WORD(0x332d),
+	WORD(0xff44), WORD(0xe969), WORD(0x5308), WORD(0x4738), WORD(0x1613), WORD(0xfa6f),
+	WORD(0x328d), WORD(0x6884), WORD(0xeb1e), WORD(0xcf1a), WORD(0x4bcf), WORD(0xbac3),
+	WORD(0x148e), WORD(0xa6c7), WORD(0xf865), WORD(0x3c6a), WORD(0xb2eb), WORD(0x8baf),
+	WORD(0x293c), WORD(0x2a98),
+	/* 35G */
+	WORD(0x070e), WORD(0x9bb6), WORD(0xc46c), WORD(0xe2b6), WORD(0xb1aa), WORD(0xfe04),
+	WORD(0x3c89), WORD(0x4330), WORD(0x4ddd), WORD(0x3a38), WORD(0x2585), WORD(0x87b4),
+	WORD(0x4e44), WORD(0x6cda), WORD(0xcb2c), WORD(0x1f5b), WORD(0x8ab7), WORD(0xa8ca),
+	WORD(0x1d93), WORD(0xb415), WORD(0xaefa), WORD(0x3b5d), WORD(0xddcb), WORD(0xa686),
+	WORD(0x1625), WORD(0x43be), WORD(0x8231), WORD(0x97e1), WORD(0xf323), WORD(0xda2d),
+	WORD(0x70ef), WORD(0x954b),
+	/* 37G */
+	WORD(0xac9e), WORD(0x11eb), WORD(0x0db9), WORD(0xf30b), WORD(0x85f0), WORD(0x47e9),
+	WORD(0xa66a), WORD(0x90eb), WORD(0xe80a), WORD(0x2e8b), WORD(0xcc3a), WORD(0x671f),
+	WORD(0x9edf), WORD(0xf8e7), WORD(0x9f07), WORD(0x0b9f), WORD(0xb789), WORD(0x7134),
+	WORD(0xf19a), WORD(0xf193), WORD(0x7516), WORD(0x8708), WORD(0x64d0), WORD(0x2d22),
+	WORD(0x73bb), WORD(0x95e7), WORD(0x1d69), WORD(0x322f), WORD(0x8da8), WORD(0x39cf),
+	WORD(0xc8a8), WORD(0x370d),
+	/* 39G */
+	WORD(0xfa06), WORD(0x6dfa), WORD(0x97cc), WORD(0xe34a), WORD(0x6232), WORD(0x85fa),
+	WORD(0xa87b), WORD(0xaaed), WORD(0x0e69), WORD(0xa315), WORD(0xa559), WORD(0xc390),
+	WORD(0xc05e), WORD(0x58c5), WORD(0x3a1f), WORD(0x26df), WORD(0xa453), WORD(0x8245),
+	WORD(0xa2f1), WORD(0x4ebb), WORD(0xad8f), WORD(0x71e4), WORD(0x9f0c), WORD(0x3fb9),
+	WORD(0xed36), WORD(0x01b7), WORD(0x3cf3), WORD(0x96d7), WORD(0x8831), WORD(0x472c),
+	WORD(0x5d57), WORD(0x4e3a),
+	/* 41G */
+	WORD(0x768a), WORD(0x0bdc), WORD(0x87f3), WORD(0x75ea), WORD(0x7419), WORD(0x0576),
+	WORD(0xdc6f), WORD(0x7c27), WORD(0x8743), WORD(0x5e55), WORD(0x026a), WORD(0xbd39),
+	WORD(0xc33b), WORD(0x6dc9), WORD(0x5fba), WORD(0x3e93), WORD(0x9fab), WORD(0xed09),
+	WORD(0xa40d), WORD(0xd3c9), WORD(0x6772), WORD(0x4bde), WORD(0x84a6), WORD(0xe658),
+	WORD(0xe7e4), WORD(0xbc17), WORD(0x6f9e), WORD(0xd6dd), WORD(0x4998), WORD(0xb8e6),
+	WORD(0xe6cf), WORD(0x4f83),
+	/* 43G */
+	WORD(0xfb2c), WORD(0xf1f6), WORD(0x4499), WORD(0xb297), WORD(0x2af9), WORD(0x3127),
+	WORD(0xaca8), WORD(0x09b8), WORD(0xe0ea), WORD(0x04a4), WORD(0x05f7), WORD(0xc60f),
+	WORD(0x9218), WORD(0x2af7), WORD(0xa30d), WORD(0x2ff3), WORD(0xf7a2), WORD(0x1c5a),
+	WORD(0x1364), WORD(0xd955), WORD(0xf002), WORD(0xc773), WORD(0xf604), WORD(0x2cc2),
+	WORD(0x9b3c), WORD(0x1636), WORD(0x747b), WORD(0x17bd), WORD(0x23c3), WORD(0x4fc4),
+	WORD(0x3967), WORD(0x623e),
+	/* 45G */
+	WORD(0x7dfa), WORD(0x7ed8), WORD(0x3e69), WORD(0x73fb), WORD(0x45c0), WORD(0xcb77),
+	WORD(0xee8a), WORD(0x24f1), WORD(0x879d), WORD(0x3bab), WORD(0x1717), WORD(0xaf96),
+	WORD(0xaa03), WORD(0x0ef9), WORD(0xb1e1), WORD(0x1e91), WORD(0x31de), WORD(0x889d),
+	WORD(0x204b), WORD(0x6806), WORD(0x0a88), WORD(0x3ae9), WORD(0x3e19), WORD(0xc6ed),
+	WORD(0x6e63), WORD(0x5700), WORD(0x1b8f), WORD(0xc0ed), WORD(0x843d), WORD(0xe3c9),
+	WORD(0x6056), WORD(0x6cb9),
+	/* 47G */
+	WORD(0x63bb), WORD(0x6768), WORD(0x64df), WORD(0x5daf), WORD(0x9099), WORD(0x4767),
+	WORD(0xbf20), WORD(0x9daa), WORD(0xc9eb), WORD(0x6f3e), WORD(0x2209), WORD(0x084f),
+	WORD(0xf365), WORD(0x66a2), WORD(0x1e8d), WORD(0x8ed4), WORD(0xb31b), WORD(0x1a4c),
+	WORD(0xbd6b), WORD(0x8d43), WORD(0x3512), WORD(0x145f), WORD(0x0152), WORD(0x71b8),
+	WORD(0x0f1d), WORD(0x77a5), WORD(0x4453), WORD(0xc957), WORD(0x1f51), WORD(0x07fe),
+	WORD(0xdf31), WORD(0x70b1),
+	/* 49G */
+	WORD(0x5cd0), WORD(0x0455), WORD(0xbe50), WORD(0x6aa2), WORD(0x489a), WORD(0x55c3),
+	WORD(0xa6de), WORD(0xc749), WORD(0x43f9), WORD(0x749b), WORD(0xad8d), WORD(0xe5de),
+	WORD(0x43ad), WORD(0xfcd7), WORD(0x3f9f), WORD(0x5cca), WORD(0xaea2), WORD(0xb69d),
+	WORD(0xb815), WORD(0x19d3), WORD(0xac25), WORD(0x9a0e), WORD(0x61b7), WORD(0xb0e1),
+	WORD(0xc262), WORD(0x1355), WORD(0x09ed), WORD(0x22cf), WORD(0xade6), WORD(0xb9ab),
+	WORD(0x9f9b), WORD(0x5a9b),
+	/* 51G */
+	WORD(0xd740), WORD(0x7b66), WORD(0xc264), WORD(0x86ef), WORD(0xc228), WORD(0x79e6),
+	WORD(0x0495), WORD(0x1bb0), WORD(0x437b), WORD(0xc671), WORD(0x0f39), WORD(0x3e45),
+	WORD(0x7a59), WORD(0x2fe5), WORD(0x4442), WORD(0x84f6), WORD(0x1225), WORD(0x563b),
+	WORD(0x8daa), WORD(0xbe12), WORD(0x5eec), WORD(0xc000), WORD(0xe1b1), WORD(0xceee),
+	WORD(0x1309), WORD(0x37f2), WORD(0x9966), WORD(0xdc30), WORD(0xb120), WORD(0x48e3),
+	WORD(0x211b), WORD(0x4f3f),
+	/* 53G */
+	WORD(0xbcb9), WORD(0x9d6c), WORD(0xb2e3), WORD(0x6952), WORD(0xa3e0), WORD(0x7ded),
+	WORD(0x5184), WORD(0xee61), WORD(0xa6b0), WORD(0x499e), WORD(0x6255), WORD(0x68e1),
+	WORD(0x4236), WORD(0x2ed5), WORD(0x6bec), WORD(0x781c), WORD(0xf1c4), WORD(0x0405),
+	WORD(0x374f), WORD(0xe8f1), WORD(0x83f3), WORD(0x21ed), WORD(0xdc16), WORD(0x7432),
+	WORD(0x2771), WORD(0x2578), WORD(0x9f9c), WORD(0x093f), WORD(0xa60a), WORD(0x7d9b),
+	WORD(0x20b8), WORD(0x8c42),
+	/* 55G */
+	WORD(0x0354), WORD(0x087e), WORD(0x97ec), WORD(0x3bd0), WORD(0x266c), WORD(0x8d8d),
+	WORD(0xa805), WORD(0x4c6d), WORD(0x8837), WORD(0x9c1a), WORD(0xb3a5), WORD(0x2e38),
+	WORD(0x29ca), WORD(0xaa16), WORD(0x2e4e), WORD(0x1a62), WORD(0xf890), WORD(0x3086),
+	WORD(0xf4d9), WORD(0xb941), WORD(0xd4e4), WORD(0x9ff7), WORD(0x1ab3), WORD(0x55fa),
+	WORD(0xeb75), WORD(0x3e5f), WORD(0x6b7f), WORD(0xe257), WORD(0x2ce5), WORD(0x5628),
+	WORD(0x6123), WORD(0x3e8c),
+	/* 57G */
+	WORD(0x1612), WORD(0x532d), WORD(0xaa48), WORD(0x578b), WORD(0x131c), WORD(0xabe3),
+	WORD(0x9659), WORD(0xbb2d), WORD(0x00d3), WORD(0x45fb), WORD(0x4e78), WORD(0x88eb),
+	WORD(0x6ebe), WORD(0xdae2), WORD(0x866e), WORD(0x01a0), WORD(0xb105), WORD(0x365d),
+	WORD(0xfa11), WORD(0x9830), WORD(0xc212), WORD(0xa165), WORD(0x1a78), WORD(0x95f5),
+	WORD(0x0fcb), WORD(0xbc46), WORD(0xd000), WORD(0x48e3), WORD(0x2c58), WORD(0xca03),
+	WORD(0xbf1e), WORD(0x95c4),
+	/* 59G */
+	WORD(0x621f), WORD(0x8e4f), WORD(0x991e), WORD(0x7155), WORD(0xb98d), WORD(0xd64a),
+	WORD(0x8b1b), WORD(0xeed6), WORD(0x155c), WORD(0xb479), WORD(0xf245), WORD(0x04e5),
+	WORD(0x945d), WORD(0x2825), WORD(0xe639), WORD(0x9f80), WORD(0x89f9), WORD(0xc0d6),
+	WORD(0x3294), WORD(0x1e25), WORD(0x2e4e), WORD(0x2813), WORD(0xddba), WORD(0x0422),
+	WORD(0x2d7b), WORD(0xd0ad), WORD(0x60ba), WORD(0xdac6), WORD(0x5300), WORD(0xdda8),
+	WORD(0x0fe7), WORD(0x899e),
+	/* 61G */
+	WORD(0x295b), WORD(0x118c), WORD(0x7237), WORD(0xc533), WORD(0x68d5), WORD(0xad40),
+	WORD(0x4375), WORD(0x81c8), WORD(0x4049), WORD(0x5b88), WORD(0xfb80), WORD(0xf5ce),
+	WORD(0x2af1), WORD(0x0041), WORD(0x4310), WORD(0xa3e0), WORD(0x9696), WORD(0xa26e),
+	WORD(0x487e), WORD(0xfd40), WORD(0xc6f1), WORD(0x36fe), WORD(0x7584), WORD(0x4352),
+	WORD(0xbb5e), WORD(0x5e89), WORD(0x24bd), WORD(0x343c), WORD(0x8c0b), WORD(0xd23c),
+	WORD(0x7405), WORD(0xa607),
+	/* 63G */
+	WORD(0x86e4), WORD(0x7b43), WORD(0x5459), WORD(0x7735), WORD(0xe766), WORD(0xe2cb),
+	WORD(0x2214), WORD(0x32b5), WORD(0x9194), WORD(0xab78), WORD(0x0973), WORD(0x8843),
+	WORD(0xd407), WORD(0x6034), WORD(0x70a0), WORD(0x7728), WORD(0xfeb1), WORD(0x4da8),
+	WORD(0x6838), WORD(0x3cf8), WORD(0xd03b), WORD(0x9b0b), WORD(0xa416), WORD(0xbe6e),
+	WORD(0xbe4f), WORD(0xb19a), WORD(0xf721), WORD(0x1c0a), WORD(0x1f8e), WORD(0xee3e),
+	WORD(0xfa5b), WORD(0x7f95),
+};
+#else                     /* unknown word size */
+#error "Unsupported word size"
+#endif
+TO_EC_GEN_TABLE_PARAM(brainpoolp256r1_gen_wnaf, 7);
+
+/*
+ * Signed comb of the generator for the fixed base multiplications (6
+ * teeth, spacing 43), affine x and y in Montgomery representation
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+static const word_t brainpoolp256r1_gen_comb[] = {
+	/* T[0] */
+	WORD(0x86f21fd8fe1629f1), WORD(0x72060e7353e9dcc6),
+	WORD(0xe878f3a91aa6c42b), WORD(0x77be4932419ada75),
+	WORD(0x050ba786a3e8e4f1), WORD(0x346fdd45c12d6b44),
+	WORD(0xb87d7473cce51524), WORD(0x00c87dbc726d77c1),
+	/* T[1] */
+	WORD(0x41804ba3d6ebab62), WORD(0x0070fc16d4465c1b),
+	WORD(0xc9bde0c8ef2722b6), WORD(0x4c291f0ddda20980),
+	WORD(0xce5c1420155cc284), WORD(0xbb3f035d0f01e720),
+	WORD(0x8a9deea2259d3467), WORD(0x06d360cd25f13453),
+	/* T[2] */
+	WORD(0x73697eaba0efe6ab), WORD(0x3894dbd90b8da57b),
+	WORD(0x365860b3353c70e5), WORD(0x05ed63727be48be8),
+	WORD(0x717f484f7a11ec09), WORD(0xbc35e2f098ab069c),
+	WORD(0xf664b04a4782175f), WORD(0x8258b01b293b4d54),
+	/* T[3] */
+	WORD(0x386689599e8ab106), WORD(0x6235cd897fcbd114),
+	WORD(0x24f4ad9f764dde65), WORD(0x226a4d44f4b21e75),
+	WORD(0x2daf2bbfa32e1798), WORD(0xc170032ba21ae776),
+	WORD(0x48ff4b8d38ce4c11), WORD(0x82a7fc420c4a3cb9),
+	/* T[4] */
+	WORD(0x1b6f1f490455df70), WORD(0xc7fd8eeb6514c2b2),
+	WORD(0x469b32159df712f0), WORD(0x25090e8da6da51fd),
+	WORD(0xcf293cce6538d6ad), WORD(0xbf0ee05665a8447c),
+	WORD(0xbb1e9562715e53ee), WORD(0x287b0afa71770d07),
+	/* T[5] */
+	WORD(0x3314c7ff4336679f), WORD(0xc63a3b63c5c68348),
+	WORD(0x78bf9508ce05d463), WORD(0x0988cbd37c876417),
+	WORD(0x68848c8929bcf855), WORD(0xea7ac8cd79fd1dbb),
+	WORD(0x807628799179eeaf), WORD(0x627cc574589b8b4f),
+	/* T[6] */
+	WORD(0xf8552c61754f67c6), WORD(0x41a0799c4488d289),
+	WORD(0xdc8ef45c06046644), WORD(0x2d073a1c566a0064),
+	WORD(0x272b8cc07a6080dc), WORD(0x3ef3787e1e49acea),
+	WORD(0xa8d16b1da5939b5a), WORD(0x149542c59389026a),
+	/* T[7] */
+	WORD(0x786cd67fc71c5fd9), WORD(0xe60457db9caa65c5),
+	WORD(0xe905201503ff2fc4), WORD(0x2c71ec83fb9f109c),
+	WORD(0x688b6577e2b842b4), WORD(0x9d384095d31c6fa5),
+	WORD(0xb80099917610f0a8), WORD(0x2386d39288053891),
+	/* T[8] */
+	WORD(0x5bb03705657de0de), WORD(0xa57edcf003610919),
+	WORD(0x83842fe3974086b1), WORD(0x7bfefe7321e81440),
+	WORD(0x4bc1dfe7a1e9b8b0), WORD(0xae1f33e592b4a05f),
+	WORD(0x3b8f52a7f975e5f0), WORD(0x4430436f56814fa9),
+	/* T[9] */
+	WORD(0x5306ecfb1cc35322), WORD(0xefd5fb5753a7569c),
+	WORD(0x06a183af60521829), WORD(0x6e9a73beed52a5ca),
+	WORD(0xe7e9465e1807a063), WORD(0x516f6202afa7e288),
+	WORD(0xe534485de7a036e0), WORD(0x58edb03c06f89938),
+	/* T[10] */
+	WORD(0xeb6776df58d4792c), WORD(0x5059a07283e87f6c),
+	WORD(0x071015fd8d0e239b), WORD(0x3bcc364acaebd510),
+	WORD(0x05c6e63097f2beeb), WORD(0x6f91aa96c0272680),
+	WORD(0xe75014eaf0f93aca), WORD(0x6b803d2ef5555442),
+	/* T[11] */
+	WORD(0x61454cdb1b0b949a), WORD(0x45207b7092829035),
+	WORD(0xa0435b64658f5dec), WORD(0x93ba5f333366d17f),
+	WORD(0x2b53f25ded4f7b72), WORD(0xe4cfeea3ed6580f5),
+	WORD(0xfe870621a44b33ff), WORD(0x743370c05219ab5d),
+	/* T[12] */
+	WORD(0x2033ecd412cf8387), WORD(0x026845a9f93f6e08),
+	WORD(0x85e1f087fd28abde), WORD(0x4af9ff141d738df6),
+	WORD(0xb12202f860dc16b6), WORD(0x4b3b719bf2e9e40e),
+	WORD(0xc9db5516d2b68953), WORD(0x7135b901efcf01f5),
+	/* T[13] */
+	WORD(0xd58dc5b6eff2dcf0), WORD(0xe33f3e4522cde229),
+	WORD(0xb582504272eaf2f1), WORD(0x6fd0a482846f9cc9),
+	WORD(0xbbf3021d94f722a1), WORD(0x797c7453d5dbce3f),
+	WORD(0x484c0eb06205d6dc), WORD(0xa26ea4f4b9d6b253),
+	/* T[14] */
+	WORD(0xf9190c1fa38be239), WORD(0x642832b310309452),
+	WORD(0xe45d252ace0d88d8), WORD(0x6fa52cc168182b87),
+	WORD(0x5aa504ef794be9df), WORD(0x6c6d8f159007e383),
+	WORD(0xcf7fd9c4532441ba), WORD(0x1048b1a754f86ed7),
+	/* T[15] */
+	WORD(0xe7289decf8457e09), WORD(0xf5d47ef80a60243e),
+	WORD(0x83ef9277dcc177d4), WORD(0x31fe9730e910aa1c),
+	WORD(0xc92654356f78fb10), WORD(0x365b5855f82a93b7),
+	WORD(0x1106dec53a1e45c8), WORD(0x14ff45fe4936fef0),
+	/* T[16] */
+	WORD(0x94c14683844df76d), WORD(0x74d74b4b1548977d),
+	WORD(0x96e3366123791b9d), WORD(0x4349c1f5e22974fa),
+	WORD(0x5cafebaa4e791768), WORD(0xfa5a97f3647e3939),
+	WORD(0xd09d9b08c0e63b7e), WORD(0x52762c2890624529),
+	/* T[17] */
+	WORD(0x55210a678dd6d43a), WORD(0xc6fffc3b2426c76b),
+	WORD(0x5e5995bdaea936fd), WORD(0x2c8f78f3350c55aa),
+	WORD(0x06dd2aaca24d3c3a), WORD(0x446262f5661d6bc4),
+	WORD(0x3704f23957eb8fa3), WORD(0x81a44a328f98a789),
+	/* T[18] */
+	WORD(0x355d543df61590d5), WORD(0x212e5156be4976c0),
+	WORD(0xb38f0c855adaa214), WORD(0x279581211ff19243),
+	WORD(0x1a41c1b21fdd9529), WORD(0x149a57d57f038d9d),
+	WORD(0xd4c5361eb2a39838), WORD(0x344b2d8dfe95648e),
+	/* T[19] */
+	WORD(0xb48c37af3dcb9c60), WORD(0x4a873f6908da566d),
+	WORD(0xa68ec00d5b4f2a81), WORD(0x1ae4597de37f21be),
+	WORD(0x0304701171de8570), WORD(0x1b7fbd4266a77d52),
+	WORD(0x8aa06caa9942960d), WORD(0x790bbc83bd3517a3),
+	/* T[20] */
+	WORD(0x772641ad0cda71dd), WORD(0x209444ffca6884fe),
+	WORD(0xb2314ec71f416b0a), WORD(0x3bcbe75234e09013),
+	WORD(0x848cd562d487accb), WORD(0x3351685e8d23bf62),
+	WORD(0xdf8284ace57971d7), WORD(0x887552ad1b97ffc7),
+	/* T[21] */
+	WORD(0x6e7a6a8cb8f68387), WORD(0x05a37d30cbe567b1),
+	WORD(0xf02bfbe46553c181), WORD(0x0f26bb6153c4ce31),
+	WORD(0xd7e8ac482164669a), WORD(0x8a046735fbd5b88f),
+	WORD(0x0c51216ced05e85f), WORD(0x5feb4855b2ed44b6),
+	/* T[22] */
+	WORD(0x38dd967e0bb3bf1d), WORD(0xccbedf0bb47e811c),
+	WORD(0x8ca52a477c60b15a), WORD(0x2e1d733f09a23835),
+	WORD(0x4da9d3ffd94aa2b4), WORD(0x37ad3e83bc2f8524),
+	WORD(0x5365efe1321f05a8), WORD(0x0459236ceb32d0d7),
+	/* T[23] */
+	WORD(0xc6e749192a766a08), WORD(0x8cb3e78d866e959f),
+	WORD(0xd25ababad53aa7f6), WORD(0x714b490fa770a721),
+	WORD(0xd6140a2d8d2a2981), WORD(0xa205405aef27362f),
+	WORD(0x0d2ff119b70d0d04), WORD(0x232e95ac99994016),
+	/* T[24] */
+	WORD(0x0b364caf1b726fc9), WORD(0x4021b5747b243e53),
+	WORD(0x5b5d3b79e54c086e), WORD(0x99a8da6ca66c1449),
+	WORD(0x024dbc771968222e), WORD(0x2567a5eeff2e45c2),
+	WORD(0xc45ef9a85ad6d6ab), WORD(0x9ffc8dcc89fbfc5a),
+	/* T[25] */
+	WORD(0xc642c15073b1f7a4), WORD(0x4a941d9f3c7a9df1),
+	WORD(0xe769fa9a5963270b), WORD(0x2eccadf68afadd49),
+	WORD(0xbc1e7f7d761e3939), WORD(0xf089f661f493bdb4),
+	WORD(0xd4189e4547f1d115), WORD(0x4bb76bc6b728f262),
+	/* T[26] */
+	WORD(0x73e3e84fdb4b196f), WORD(0x18591a2a30121bfe),
+	WORD(0xaef43fec6685f991), WORD(0x73daed1002e0216d),
+	WORD(0xe963200440f19266), WORD(0x6ac79939bf0546c0),
+	WORD(0x4788319f9e004b00), WORD(0x9b1490fbda7bb413),
+	/* T[27] */
+	WORD(0x174535263024a578), WORD(0x74b43c34b791a928),
+	WORD(0x9b54f782ca829df5), WORD(0x826667033fcfe7fb),
+	WORD(0xb3e0789c719c7d6c), WORD(0xfba2a11b70dbc92e),
+	WORD(0xd4546c9d3d82e38f), WORD(0x586692b8a07f54a7),
+	/* T[28] */
+	WORD(0x46ea9dff2bed430d), WORD(0x9a007c348d924c3b),
+	WORD(0x566f13e929efd827), WORD(0x6db405a22bf83300),
+	WORD(0xdb9969c56078fab4), WORD(0x45466891c2956a52),
+	WORD(0x861c563408829f0e), WORD(0x9383657c8be8e977),
+	/* T[29] */
+	WORD(0x6819870c00d482cf), WORD(0xa7831b12d304e582),
+	WORD(0x42674cef5ded388c), WORD(0x08308cf999bf274d),
+	WORD(0xc2015f09aacc6762), WORD(0xd906f13abc0149b5),
+	WORD(0x0a05f81f095b24ab), WORD(0x91bbc5aaf34f10e9),
+	/* T[30] */
+	WORD(0xa08e94e6a2b6e833), WORD(0x412d57028ca17792),
+	WORD(0x51f68ebfadaccb08), WORD(0x1d64ca38fb8013dc),
+	WORD(0x70aff2d30748cff6), WORD(0x749235c83f5ff067),
+	WORD(0x63b559f9c4e5b5c9), WORD(0x92a3f94744a521b7),
+	/* T[31] */
+	WORD(0x573a1083f50a0550), WORD(0x72505c90b3fe22ec),
+	WORD(0x387e3347acb20389), WORD(0x1af9c96793f6494b),
+	WORD(0xfcb3e635cccf6f93), WORD(0x75cc098ab62b6948),
+	WORD(0x6c613a595c75d78b), WORD(0x7ec64c79ad9f6189),
+};
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+static const word_t brainpoolp256r1_gen_comb[] = {
+	/* T[0] */
+	WORD(0xfe1629f1), WORD(0x86f21fd8), WORD(0x53e9dcc6), WORD(0x72060e73),
+	WORD(0x1aa6c42b), WORD(0xe878f3a9), WORD(0x419ada75), WORD(0x77be4932),
+	WORD(0xa3e8e4f1), WORD(0x050ba786), WORD(0xc12d6b44), WORD(0x346fdd45),
+	WORD(0xcce51524), WORD(0xb87d7473), WORD(0x726d77c1), WORD(0x00c87dbc),
+	/* T[1] */
+	WORD(0xd6ebab62), WORD(0x41804ba3), WORD(0xd4465c1b), WORD(0x0070fc16),
+	WORD(0xef2722b6), WORD(0xc9bde0c8), WORD(0xdda20980), WORD(0x4c291f0d),
+	WORD(0x155cc284), WORD(0xce5c1420), WORD(0x0f01e720), WORD(0xbb3f035d),
+	WORD(0x259d3467), WORD(0x8a9deea2), WORD(0x25f13453), WORD(0x06d360cd),
+	/* T[2] */
+	WORD(0xa0efe6ab), WORD(0x73697eab), WORD(0x0b8da57b), WORD(0x3894dbd9),
+	WORD(0x353c70e5), WORD(0x365860b3), WORD(0x7be48be8), WORD(0x05ed6372),
+	WORD(0x7a11ec09), WORD(0x717f484f), WORD(0x98ab069c), WORD(0xbc35e2f0),
+	WORD(0x4782175f), WORD(0xf664b04a), WORD(0x293b4d54), WORD(0x8258b01b),
+	/* T[3] */
+	WORD(0x9e8ab106), WORD(0x38668959), WORD(0x7fcbd114), WORD(0x6235cd89),
+	WORD(0x764dde65), WORD(0x24f4ad9f), WORD(0xf4b21e75), WORD(0x226a4d44),
+	WORD(0xa32e1798), WORD(0x2daf2bbf), WORD(0xa21ae776), WORD(0xc170032b),
+	WORD(0x38ce4c11), WORD(0x48ff4b8d), WORD(0x0c4a3cb9), WORD(0x82a7fc42),
+	/* T[4] */
+	WORD(0x0455df70), WORD(0x1b6f1f49), WORD(0x6514c2b2), WORD(0xc7fd8eeb),
+	WORD(0x9df712f0), WORD(0x469b3215), WORD(0xa6da51fd), WORD(0x25090e8d),
+	WORD(0x6538d6ad), WORD(0xcf293cce), WORD(0x65a8447c), WORD(0xbf0ee056),
+	WORD(0x715e53ee), WORD(0xbb1e9562), WORD(0x71770d07), WORD(0x287b0afa),
+	/* T[5] */
+	WORD(0x4336679f), WORD(0x3314c7ff), WORD(0xc5c68348), WORD(0xc63a3b63),
+	WORD(0xce05d463), WORD(0x78bf9508), WORD(0x7c876417), WORD(0x0988cbd3),
+	WORD(0x29bcf855), WORD(0x68848c89), WORD(0x79fd1dbb), WORD(0xea7ac8cd),
+	WORD(0x9179eeaf), WORD(0x80762879), WORD(0x589b8b4f), WORD(0x627cc574),
+	/* T[6] */
+	WORD(0x754f67c6), WORD(0xf8552c61), WORD(0x4488d289), WORD(0x41a0799c),
+	WORD(0x06046644), WORD(0xdc8ef45c), WORD(0x566a0064), WORD(0x2d073a1c),
+	WORD(0x7a6080dc), WORD(0x272b8cc0), WORD(0x1e49acea), WORD(0x3ef3787e),
+	WORD(0xa5939b5a), WORD(0xa8d16b1d), WORD(0x9389026a), WORD(0x149542c5),
+	/* T[7] */
+	WORD(0xc71c5fd9), WORD(0x786cd67f), WORD(0x9caa65c5), WORD(0xe60457db),
+	WORD(0x03ff2fc4), WORD(0xe9052015), WORD(0xfb9f109c), WORD(0x2c71ec83),
+	WORD(0xe2b842b4), WORD(0x688b6577), WORD(0xd31c6fa5), WORD(0x9d384095),
+	WORD(0x7610f0a8), WORD(0xb8009991), WORD(0x88053891), WORD(0x2386d392),
+	/* T[8] */
+	WORD(0x657de0de), WORD(0x5bb03705), WORD(0x03610919), WORD(0xa57edcf0),
+	WORD(0x974086b1), WORD(0x83842fe3), WORD(0x21e81440), WORD(0x7bfefe73),
+	WORD(0xa1e9b8b0), WORD(0x4bc1dfe7), WORD(0x92b4a05f), WORD(0xae1f33e5),
+	WORD(0xf975e5f0), WORD(0x3b8f52a7), WORD(0x56814fa9), WORD(0x4430436f),
+	/* T[9] */
+	WORD(0x1cc35322), WORD(0x5306ecfb), WORD(0x53a7569c), WORD(0xefd5fb57),
+	WORD(0x60521829), WORD(0x06a183af), WORD(0xed52a5ca), WORD(0x6e9a73be),
+	WORD(0x1807a063), WORD(0xe7e9465e), WORD(0xafa7e288), WORD(0x516f6202),
+	WORD(0xe7a036e0), WORD(0xe534485d), WORD(0x06f89938), WORD(0x58edb03c),
+	/* T[10] */
+	WORD(0x58d4792c), WORD(0xeb6776df), WORD(0x83e87f6c), WORD(0x5059a072),
+	WORD(0x8d0e239b), WORD(0x071015fd), WORD(0xcaebd510), WORD(0x3bcc364a),
+	WORD(0x97f2beeb), WORD(0x05c6e630), WORD(0xc0272680), WORD(0x6f91aa96),
+	WORD(0xf0f93aca), WORD(0xe75014ea), WORD(0xf5555442), WORD(0x6b803d2e),
+	/* T[11] */
+	WORD(0x1b0b949a), WORD(0x61454cdb), WORD(0x92829035), WORD(0x45207b70),
+	WORD(0x658f5dec), WORD(0xa0435b64), WORD(0x3366d17f), WORD(0x93ba5f33),
+	WORD(0xed4f7b72), WORD(0x2b53f25d), WORD(0xed6580f5), WORD(0xe4cfeea3),
+	WORD(0xa44b33ff), WORD(0xfe870621), WORD(0x5219ab5d), WORD(0x743370c0),
+	/* T[12] */
+	WORD(0x12cf8387), WORD(0x2033ecd4), WORD(0xf93f6e08), WORD(0x026845a9),
+	WORD(0xfd28abde), WORD(0x85e1f087), WORD(0x1d738df6), WORD(0x4af9ff14),
+	WORD(0x60dc16b6), WORD(0xb12202f8), WORD(0xf2e9e40e), WORD(0x4b3b719b),
+	WORD(0xd2b68953), WORD(0xc9db5516), WORD(0xefcf01f5), WORD(0x7135b901),
+	/* T[13] */
+	WORD(0xeff2dcf0), WORD(0xd58dc5b6), WORD(0x22cde229), WORD(0xe33f3e45),
+	WORD(0x72eaf2f1), WORD(0xb5825042), WORD(0x846f9cc9), WORD(0x6fd0a482),
+	WORD(0x94f722a1), WORD(0xbbf3021d), WORD(0xd5dbce3f), WORD(0x797c7453),
+	WORD(0x6205d6dc), WORD(0x484c0eb0), WORD(0xb9d6b253), WORD(0xa26ea4f4),
+	/* T[14] */
+	WORD(0xa38be239), WORD(0xf9190c1f), WORD(0x10309452), WORD(0x642832b3),
+	WORD(0xce0d88d8), WORD(0xe45d252a), WORD(0x68182b87), WORD(0x6fa52cc1),
+	WORD(0x794be9df), WORD(0x5aa504ef), WORD(0x9007e383), WORD(0x6c6d8f15),
+	WORD(0x532441ba), WORD(0xcf7fd9c4), WORD(0x54f86ed7), WORD(0x1048b1a7),
+	/* T[15] */
+	WORD(0xf8457e09), WORD(0xe7289dec), WORD(0x0a60243e), WORD(0xf5d47ef8),
+	WORD(0xdcc177d4), WORD(0x83ef9277), WORD(0xe910aa1c), WORD(0x31fe9730),
+	WORD(0x6f78fb10), WORD(0xc9265435), WORD(0xf82a93b7), WORD(0x365b5855),
+	WORD(0x3a1e45c8), WORD(0x1106dec5), WORD(0x4936fef0), WORD(0x14ff45fe),
+	/* T[16] */
+	WORD(0x844df76d), WORD(0x94c14683), WORD(0x1548977d), WORD(0x74d74b4b),
+	WORD(0x23791b9d), WORD(0x96e33661), WORD(0xe22974fa), WORD(0x4349c1f5),
+	WORD(0x4e791768), WORD(0x5cafebaa), WORD(0x647e3939), WORD(0xfa5a97f3),
+	WORD(0xc0e63b7e), WORD(0xd09d9b08), WORD(0x90624529), WORD(0x52762c28),
+	/* T[17] */
+	WORD(0x8dd6d43a), WORD(0x55210a67), WORD(0x2426c76b), WORD(0xc6fffc3b),
+	WORD(0xaea936fd), WORD(0x5e5995bd), WORD(0x350c55aa), WORD(0x2c8f78f3),
+	WORD(0xa24d3c3a), WORD(0x06dd2aac), WORD(0x661d6bc4), WORD(0x446262f5),
+	WORD(0x57eb8fa3), WORD(0x3704f239), WORD(0x8f98a789), WORD(0x81a44a32),
+	/* T[18] */
+	WORD(0xf61590d5), WORD(0x355d543d), WORD(0xbe4976c0), WORD(0x212e5156),
+	WORD(0x5adaa214), WORD(0xb38f0c85), WORD(0x1ff19243), WORD(0x27958121),
+	WORD(0x1fdd9529), WORD(0x1a41c1b2), WORD(0x7f038d9d), WORD(0x149a57d5),
+	WORD(0xb2a39838), WORD(0xd4c5361e), WORD(0xfe95648e), WORD(0x344b2d8d),
+	/* T[19] */
+	WORD(0x3dcb9c60), WORD(0xb48c37af), WORD(0x08da566d), WORD(0x4a873f69),
+	WORD(0x5b4f2a81), WORD(0xa68ec00d), WORD(0xe37f21be), WORD(0x1ae4597d),
+	WORD(0x71de8570), WORD(0x03047011), WORD(0x66a77d52), WORD(0x1b7fbd42),
+	WORD(0x9942960d), WORD(0x8aa06caa), WORD(0xbd3517a3), WORD(0x790bbc83),
+	/* T[20] */
+	WORD(0x0cda71dd), WORD(0x772641ad), WORD(0xca6884fe), WORD(0x209444ff),
+	WORD(0x1f416b0a), WORD(0xb2314ec7), WORD(0x34e09013), WORD(0x3bcbe752),
+	WORD(0xd487accb), WORD(0x848cd562), WORD(0x8d23bf62), WORD(0x3351685e),
+	WORD(0xe57971d7), WORD(0xdf8284ac), WORD(0x1b97ffc7), WORD(0x887552ad),
+	/* T[21] */
+	WORD(0xb8f68387), WORD(0x6e7a6a8c), WORD(0xcbe567b1), WORD(0x05a37d30),
+	WORD(0x6553c181), WORD(0xf02bfbe4), WORD(0x53c4ce31), WORD(0x0f26bb61),
+	WORD(0x2164669a), WORD(0xd7e8ac48), WORD(0xfbd5b88f), WORD(0x8a046735),
+	WORD(0xed05e85f), WORD(0x0c51216c), WORD(0xb2ed44b6), WORD(0x5feb4855),
+	/* T[22] */
+	WORD(0x0bb3bf1d), WORD(0x38dd967e), WORD(0xb47e811c), WORD(0xccbedf0b),
+	WORD(0x7c60b15a), WORD(0x8ca52a47), WORD(0x09a23835), WORD(0x2e1d733f),
+	WORD(0xd94aa2b4), WORD(0x4da9d3ff), WORD(0xbc2f8524), WORD(0x37ad3e83),
+	WORD(0x321f05a8), WORD(0x5365efe1), WORD(0xeb32d0d7), WORD(0x0459236c),
+	/* T[23] */
+	WORD(0x2a766a08), WORD(0xc6e74919), WORD(0x866e959f), WORD(0x8cb3e78d),
+	WORD(0xd53aa7f6), WORD(0xd25ababa), WORD(0xa770a721), WORD(0x714b490f),
+	WORD(0x8d2a2981), WORD(0xd6140a2d), WORD(0xef27362f), WORD(0xa205405a),
+	WORD(0xb70d0d04), WORD(0x0d2ff119), WORD(0x99994016), WORD(0x232e95ac),
+	/* T[24] */
+	WORD(0x1b726fc9), WORD(0x0b364caf), WORD(0x7b243e53), WORD(0x4021b574),
+	WORD(0xe54c086e), WORD(0x5b5d3b79), WORD(0xa66c1449), WORD(0x99a8da6c),
+	WORD(0x1968222e), WORD(0x024dbc77), WORD(0xff2e45c2), WORD(0x2567a5ee),
+	WORD(0x5ad6d6ab), WORD(0xc45ef9a8), WORD(0x89fbfc5a), WORD(0x9ffc8dcc),
+	/* T[25] */
+	WORD(0x73b1f7a4), WORD(0xc642c150), WORD(0x3c7a9df1), WORD(0x4a941d9f),
+	WORD(0x5963270b), WORD(0xe769fa9a), WORD(0x8afadd49), WORD(0x2eccadf6),
+	WORD(0x761e3939), WORD(0xbc1e7f7d), WORD(0xf493bdb4), WORD(0xf089f661),
+	WORD(0x47f1d115), WORD(0xd4189e45), WORD(0xb728f262), WORD(0x4bb76bc6),
+	/* T[26] */
+	WORD(0xdb4b196f), WORD(0x73e3e84f), WORD(0x30121bfe), WORD(0x18591a2a),
+	WORD(0x6685f991), WORD(0xaef43fec), WORD(0x02e0216d), WORD(0x73daed10),
+	WORD(0x40f19266), WORD(0xe9632004), WORD(0xbf0546c0), WORD(0x6ac79939),
+	WORD(0x9e004b00), WORD(0x4788319f), WORD(0xda7bb413), WORD(0x9b1490fb),
+	/* T[27] */
+	WORD(0x3024a578), WORD(0x17453526), WORD(0xb791a928), WORD(0x74b43c34),
+	WORD(0xca829df5), WORD(0x9b54f782), WORD(0x3fcfe7fb), WORD(0x82666703),
+	WORD(0x719c7d6c), WORD(0xb3e0789c), WORD(0x70dbc92e), WORD(0xfba2a11b),
+	WORD(0x3d82e38f), WORD(0xd4546c9d), WORD(0xa07f54a7), WORD(0x586692b8),
+	/* T[28] */
+	WORD(0x2bed430d), WORD(0x46ea9dff), WORD(0x8d924c3b), WORD(0x9a007c34),
+	WORD(0x29efd827), WORD(0x566f13e9), WORD(0x2bf83300), WORD(0x6db405a2),
+	WORD(0x6078fab4), WORD(0xdb9969c5), WORD(0xc2956a52), WORD(0x45466891),
+	WORD(0x08829f0e), WORD(0x861c5634), WORD(0x8be8e977), WORD(0x9383657c),
+	/* T[29] */
+	WORD(0x00d482cf), WORD(0x6819870c), WORD(0xd304e582), WORD(0xa7831b12),
+	WORD(0x5ded388c), WORD(0x42674cef), WORD(0x99bf274d), WORD(0x08308cf9),
+	WORD(0xaacc6762), WORD(0xc2015f09), WORD(0xbc0149b5), WORD(0xd906f13a),
+	WORD(0x095b24ab), WORD(0x0a05f81f), WORD(0xf34f10e9), WORD(0x91bbc5aa),
+	/* T[30] */
+	WORD(0xa2b6e833), WORD(0xa08e94e6), WORD(0x8ca17792), WORD(0x412d5702),
+	WORD(0xadaccb08), WORD(0x51f68ebf), WORD(0xfb8013dc), WORD(0x1d64ca38),
+	WORD(0x0748cff6), WORD(0x70aff2d3), WORD(0x3f5ff067), WORD(0x749235c8),
+	WORD(0xc4e5b5c9), WORD(0x63b559f9), WORD(0x44a521b7), WORD(0x92a3f947),
+	/* T[31] */
+	WORD(0xf50a0550), WORD(0x573a1083), WORD(0xb3fe22ec), WORD(0x72505c90),
+	WORD(0xacb20389), WORD(0x387e3347), WORD(0x93f6494b), WORD(0x1af9c967),
+	WORD(0xcccf6f93), WORD(0xfcb3e635), WORD(0xb62b6948), WORD(0x75cc098a),
+	WORD(0x5c75d78b), WORD(0x6c613a59), WORD(0xad9f6189), WORD(0x7ec64c79),
+};
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+static const word_t brainpoolp256r1_gen_comb[] = {
+	/* T[0] */
+	WORD(0x29f1), WORD(0xfe16), WORD(0x1fd8), WORD(0x86f2), WORD(0xdcc6), WORD(0x53e9),
+	WORD(0x0e73), WORD(0x7206), WORD(0xc42b), WORD(0x1aa6), WORD(0xf3a9), WORD(0xe878),
+	WORD(0xda75), WORD(0x419a), WORD(0x4932), WORD(0x77be), WORD(0xe4f1), WORD(0xa3e8),
+	WORD(0xa786), WORD(0x050b), WORD(0x6b44), WORD(0xc12d), WORD(0xdd45), WORD(0x346f),
+	WORD(0x1524), WORD(0xcce5), WORD(0x7473), WORD(0xb87d), WORD(0x77c1), WORD(0x726d),
+	WORD(0x7dbc), WORD(0x00c8),
+	/* T[1] */
+	WORD(0xab62), WORD(0xd6eb), WORD(0x4ba3), WORD(0x4180), WORD(0x5c1b), WORD(0xd446),
+	WORD(0xfc16), WORD(0x0070), WORD(0x22b6), WORD(0xef27), WORD(0xe0c8), WORD(0xc9bd),
+	WORD(0x0980), WORD(0xdda2), WORD(0x1f0d), WORD(0x4c29), WORD(0xc284), WORD(0x155c),
+	WORD(0x1420), WORD(0xce5c), WORD(0xe720), WORD(0x0f01), WORD(0x035d), WORD(0xbb3f),
+	WORD(0x3467), WORD(0x259d), WORD(0xeea2), WORD(0x8a9d), WORD(0x3453), WORD(0x25f1),
+	WORD(0x60cd), WORD(0x06d3),
+	/* T[2] */
+	WORD(0xe6ab), WORD(0xa0ef), WORD(0x7eab), WORD(0x7369), WORD(0xa57b), WORD(0x0b8d),
+	WORD(0xdbd9), WORD(0x3894), WORD(0x70e5), WORD(0x353c), WORD(0x60b3), WORD(0x3658),
+	WORD(0x8be8), WORD(0x7be4), WORD(0x6372), WORD(0x05ed), WORD(0xec09), WORD(0x7a11),
+	WORD(0x484f), WORD(0x717f), WORD(0x069c), WORD(0x98ab), WORD(0xe2f0), WORD(0xbc35),
+	WORD(0x175f), WORD(0x4782), WORD(0xb04a), WORD(0xf664), WORD(0x4d54), WORD(0x293b),
+	WORD(0xb01b), WORD(0x8258),
+	/* T[3] */
+	WORD(0xb106), WORD(0x9e8a), WORD(0x8959), WORD(0x3866), WORD(0xd114), WORD(0x7fcb),
+	WORD(0xcd89), WORD(0x6235), WORD(0xde65), WORD(0x764d), WORD(0xad9f), WORD(0x24f4),
+	WORD(0x1e75), WORD(0xf4b2), WORD(0x4d44), WORD(0x226a), WORD(0x1798), WORD(0xa32e),
+	WORD(0x2bbf), WORD(0x2daf), WORD(0xe776), WORD(0xa21a), WORD(0x032b), WORD(0xc170),
+	WORD(0x4c11), WORD(0x38ce), WORD(0x4b8d), WORD(0x48ff), WORD(0x3cb9), WORD(0x0c4a),
+	WORD(0xfc42), WORD(0x82a7),
+	/* T[4] */
+	WORD(0xdf70), WORD(0x0455), WORD(0x1f49), WORD(0x1b6f), WORD(0xc2b2), WORD(0x6514),
+	WORD(0x8eeb), WORD(0xc7fd), WORD(0x12f0), WORD(0x9df7), WORD(0x3215), WORD(0x469b),
+	WORD(0x51fd), WORD(0xa6da), WORD(0x0e8d), WORD(0x2509), WORD(0xd6ad), WORD(0x6538),
+	WORD(0x3cce), WORD(0xcf29), WORD(0x447c), WORD(0x65a8), WORD(0xe056), WORD(0xbf0e),
+	WORD(0x53ee), WORD(0x715e), WORD(0x9562), WORD(0xbb1e), WORD(0x0d07), WORD(0x7177),
+	WORD(0x0afa), WORD(0x287b),
+	/* T[5] */
+	WORD(0x679f), WORD(0x4336), WORD(0xc7ff), WORD(0x3314), WORD(0x8348), WORD(0xc5c6),
+	WORD(0x3b63), WORD(0xc63a), WORD(0xd463), WORD(0xce05), WORD(0x9508), WORD(0x78bf),
+	WORD(0x6417), WORD(0x7c87), WORD(0xcbd3), WORD(0x0988), WORD(0xf855), WORD(0x29bc),
+	WORD(0x8c89), WORD(0x6884), WORD(0x1dbb), WORD(0x79fd), WORD(0xc8cd), WORD(0xea7a),
+	WORD(0xeeaf), WORD(0x9179), WORD(0x2879), WORD(0x8076), WORD(0x8b4f), WORD(0x589b),
+	WORD(0xc574), WORD(0x627c),
+	/* T[6] */
+	WORD(0x67c6), WORD(0x754f), WORD(0x2c61), WORD(0xf855), WORD(0xd289), WORD(0x4488),
+	WORD(0x799c), WORD(0x41a0), WORD(0x6644), WORD(0x0604), WORD(0xf45c), WORD(0xdc8e),
+	WORD(0x0064), WORD(0x566a), WORD(0x3a1c), WORD(0x2d07), WORD(0x80dc), WORD(0x7a60),
+	WORD(0x8cc0), WORD(0x272b), WORD(0xacea), WORD(0x1e49), WORD(0x787e), WORD(0x3ef3),
+	WORD(0x9b5a), WORD(0xa593), WORD(0x6b1d), WORD(0xa8d1), WORD(0x026a), WORD(0x9389),
+	WORD(0x42c5), WORD(0x1495),
+	/* T[7] */
+	WORD(0x5fd9), WORD(0xc71c), WORD(0xd67f), WORD(0x786c), WORD(0x65c5), WORD(0x9caa),
+	WORD(0x57db), WORD(0xe604), WORD(0x2fc4), WORD(0x03ff), WORD(0x2015), WORD(0xe905),
+	WORD(0x109c), WORD(0xfb9f), WORD(0xec83), WORD(0x2c71), WORD(0x42b4), WORD(0xe2b8),
+	WORD(0x6577), WORD(0x688b), WORD(0x6fa5), WORD(0xd31c), WORD(0x4095), WORD(0x9d38),
+	WORD(0xf0a8), WORD(0x7610), WORD(0x9991), WORD(0xb800), WORD(0x3891), WORD(0x8805),
+	WORD(0xd392), WORD(0x2386),
+	/* T[8] */
+	WORD(0xe0de), WORD(0x657d), WORD(0x3705), WORD(0x5bb0), WORD(0x0919), WORD(0x0361),
+	WORD(0xdcf0), WORD(0xa57e), WORD(0x86b1), WORD(0x9740), WORD(0x2fe3), WORD(0x8384),
+	WORD(0x1440), WORD(0x21e8), WORD(0xfe73), WORD(0x7bfe), WORD(0xb8b0), WORD(0xa1e9),
+	WORD(0xdfe7), WORD(0x4bc1), WORD(0xa05f), WORD(0x92b4), WORD(0x33e5), WORD(0xae1f),
+	WORD(0xe5f0), WORD(0xf975), WORD(0x52a7), WORD(0x3b8f), WORD(0x4fa9), WORD(0x5681),
+	WORD(0x436f), WORD(0x4430),
+	/* T[9] */
+	WORD(0x5322), WORD(0x1cc3), WORD(0xecfb), WORD(0x5306), WORD(0x569c), WORD(0x53a7),
+	WORD(0xfb57), WORD(0xefd5), WORD(0x1829), WORD(0x6052), WORD(0x83af), WORD(0x06a1),
+	WORD(0xa5ca), WORD(0xed52), WORD(0x73be), WORD(0x6e9a), WORD(0xa063), WORD(0x1807),
+	WORD(0x465e), WORD(0xe7e9), WORD(0xe288), WORD(0xafa7), WORD(0x6202), WORD(0x516f),
+	WORD(0x36e0), WORD(0xe7a0), WORD(0x485d), WORD(0xe534), WORD(0x9938), WORD(0x06f8),
+	WORD(0xb03c), WORD(0x58ed),
+	/* T[10] */
+	WORD(0x792c), WORD(0x58d4), WORD(0x76df), WORD(0xeb67), WORD(0x7f6c), WORD(0x83e8),
+	WORD(0xa072), WORD(0x5059), WORD(0x239b), WORD(0x8d0e), WORD(0x15fd), WORD(0x0710),
+	WORD(0xd510), WORD(0xcaeb), WORD(0x364a), WORD(0x3bcc), WORD(0xbeeb), WORD(0x97f2),
+	WORD(0xe630), WORD(0x05c6), WORD(0x2680), WORD(0xc027), WORD(0xaa96), WORD(0x6f91),
+	WORD(0x3aca), WORD(0xf0f9), WORD(0x14ea), WORD(0xe750), WORD(0x5442), WORD(0xf555),
+	WORD(0x3d2e), WORD(0x6b80),
+	/* T[11] */
+	WORD(0x949a), WORD(0x1b0b), WORD(0x4cdb), WORD(0x6145), WORD(0x9035), WORD(0x9282),
+	WORD(0x7b70), WORD(0x4520), WORD(0x5dec), WORD(0x658f), WORD(0x5b64), WORD(0xa043),
+	WORD(0xd17f), WORD(0x3366), WORD(0x5f33), WORD(0x93ba), WORD(0x7b72), WORD(0xed4f),
+	WORD(0xf25d), WORD(0x2b53), WORD(0x80f5), WORD(0xed65), WORD(0xeea3), WORD(0xe4cf),
+	WORD(0x33ff), WORD(0xa44b), WORD(0x0621), WORD(0xfe87), WORD(0xab5d), WORD(0x5219),
+	WORD(0x70c0), WORD(0x7433),
+	/* T[12] */
+	WORD(0x8387), WORD(0x12cf), WORD(0xecd4), WORD(0x2033), WORD(0x6e08), WORD(0xf93f),
+	WORD(0x45a9), WORD(0x0268), WORD(0xabde), WORD(0xfd28), WORD(0xf087), WORD(0x85e1),
+	WORD(0x8df6), WORD(0x1d73), WORD(0xff14), WORD(0x4af9), WORD(0x16b6), WORD(0x60dc),
+	WORD(0x02f8), WORD(0xb122), WORD(0xe40e), WORD(0xf2e9), WORD(0x719b), WORD(0x4b3b),
+	WORD(0x8953), WORD(0xd2b6), WORD(0x5516), WORD(0xc9db), WORD(0x01f5), WORD(0xefcf),
+	WORD(0xb901), WORD(0x7135),
+	/* T[13] */
+	WORD(0xdcf0), WORD(0xeff2), WORD(0xc5b6), WORD(0xd58d), WORD(0xe229), WORD(0x22cd),
+	WORD(0x3e45), WORD(0xe33f), WORD(0xf2f1), WORD(0x72ea), WORD(0x5042), WORD(0xb582),
+	WORD(0x9cc9), WORD(0x846f), WORD(0xa482), WORD(0x6fd0), WORD(0x22a1), WORD(0x94f7),
+	WORD(0x021d), WORD(0xbbf3), WORD(0xce3f), WORD(0xd5db), WORD(0x7453), WORD(0x797c),
+	WORD(0xd6dc), WORD(0x6205), WORD(0x0eb0), WORD(0x484c), WORD(0xb253), WORD(0xb9d6),
+	WORD(0xa4f4), WORD(0xa26e),
+	/* T[14] */
+	WORD(0xe239), WORD(0xa38b), WORD(0x0c1f), WORD(0xf919), WORD(0x9452), WORD(0x1030),
+	WORD(0x32b3), WORD(0x6428), WORD(0x88d8), WORD(0xce0d), WORD(0x252a), WORD(0xe45d),
+	WORD(0x2b87), WORD(0x6818), WORD(0x2cc1), WORD(0x6fa5), WORD(0xe9df), WORD(0x794b),
+	WORD(0x04ef), WORD(0x5aa5), WORD(0xe383), WORD(0x9007), WORD(0x8f15), WORD(0x6c6d),
+	WORD(0x41ba), WORD(0x5324), WORD(0xd9c4), WORD(0xcf7f), WORD(0x6ed7), WORD(0x54f8),
+	WORD(0xb1a7), WORD(0x1048),
+	/* T[15] */
+	WORD(0x7e09), WORD(0xf845), WORD(0x9dec), WORD(0xe728), WORD(0x243e), WORD(0x0a60),
+	WORD(0x7ef8), WORD(0xf5d4), WORD(0x77d4), WORD(0xdcc1), WORD(0x9277), WORD(0x83ef),
+	WORD(0xaa1c), WORD(0xe910), WORD(0x9730), WORD(0x31fe), WORD(0xfb10), WORD(0x6f78),
+	WORD(0x5435), WORD(0xc926), WORD(0x93b7), WORD(0xf82a), WORD(0x5855), WORD(0x365b),
+	WORD(0x45c8), WORD(0x3a1e), WORD(0xdec5), WORD(0x1106), WORD(0xfef0), WORD(0x4936),
+	WORD(0x45fe), WORD(0x14ff),
+	/* T[16] */
+	WORD(0xf76d), WORD(0x844d), WORD(0x4683), WORD(0x94c1), WORD(0x977d), WORD(0x1548),
+	WORD(0x4b4b), WORD(0x74d7), WORD(0x1b9d), WORD(0x2379), WORD(0x3661), WORD(0x96e3),
+	WORD(0x74fa), WORD(0xe229), WORD(0xc1f5), WORD(0x4349), WORD(0x1768), WORD(0x4e79),
+	WORD(0xebaa), WORD(0x5caf), WORD(0x3939), WORD(0x647e), WORD(0x97f3), WORD(0xfa5a),
+	WORD(0x3b7e), WORD(0xc0e6), WORD(0x9b08), WORD(0xd09d), WORD(0x4529), WORD(0x9062),
+	WORD(0x2c28), WORD(0x5276),
+	/* T[17] */
+	WORD(0xd43a), WORD(0x8dd6), WORD(0x0a67), WORD(0x5521), WORD(0xc76b), WORD(0x2426),
+	WORD(0xfc3b), WORD(0xc6ff), WORD(0x36fd), WORD(0xaea9), WORD(0x95bd), WORD(0x5e59),
+	WORD(0x55aa), WORD(0x350c), WORD(0x78f3), WORD(0x2c8f), WORD(0x3c3a), WORD(0xa24d),
+	WORD(0x2aac), WORD(0x06dd), WORD(0x6bc4), WORD(0x661d), WORD(0x62f5), WORD(0x4462),
+	WORD(0x8fa3), WORD(0x57eb), WORD(0xf239), WORD(0x3704), WORD(0xa789), WORD(0x8f98),
+	WORD(0x4a32), WORD(0x81a4),
+	/* T[18] */
+	WORD(0x90d5), WORD(0xf615), WORD(0x543d), WORD(0x355d), WORD(0x76c0), WORD(0xbe49),
+	WORD(0x5156), WORD(0x212e), WORD(0xa214), WORD(0x5ada), WORD(0x0c85), WORD(0xb38f),
+	WORD(0x9243), WORD(0x1ff1), WORD(0x8121), WORD(0x2795), WORD(0x9529), WORD(0x1fdd),
+	WORD(0xc1b2), WORD(0x1a41), WORD(0x8d9d), WORD(0x7f03), WORD(0x57d5), WORD(0x149a),
+	WORD(0x9838), WORD(0xb2a3), WORD(0x361e), WORD(0xd4c5), WORD(0x648e), WORD(0xfe95),
+	WORD(0x2d8d), WORD(0x344b),
+	/* T[19] */
+	WORD(0x9c60), WORD(0x3dcb), WORD(0x37af), WORD(0xb48c), WORD(0x566d), WORD(0x08da),
+	WORD(0x3f69), WORD(0x4a87), WORD(0x2a81), WORD(0x5b4f), WORD(0xc00d), WORD(0xa68e),
+	WORD(0x21be), WORD(0xe37f), WORD(0x597d), WORD(0x1ae4), WORD(0x8570), WORD(0x71de),
+	WORD(0x7011), WORD(0x0304), WORD(0x7d52), WORD(0x66a7), WORD(0xbd42), WORD(0x1b7f),
+	WORD(0x960d), WORD(0x9942), WORD(0x6caa), WORD(0x8aa0), WORD(0x17a3), WORD(0xbd35),
+	WORD(0xbc83), WORD(0x790b),
+	/* T[20] */
+	WORD(0x71dd), WORD(0x0cda), WORD(0x41ad), WORD(0x7726), WORD(0x84fe), WORD(0xca68),
+	WORD(0x44ff), WORD(0x2094), WORD(0x6b0a), WORD(0x1f41), WORD(0x4ec7), WORD(0xb231),
+	WORD(0x9013), WORD(0x34e0), WORD(0xe752), WORD(0x3bcb), WORD(0xaccb), WORD(0xd487),
+	WORD(0xd562), WORD(0x848c), WORD(0xbf62), WORD(0x8d23), WORD(0x685e), WORD(0x3351),
+	WORD(0x71d7), WORD(0xe579), WORD(0x84ac), WORD(0xdf82), WORD(0xffc7), WORD(0x1b97),
+	WORD(0x52ad), WORD(0x8875),
+	/* T[21] */
+	WORD(0x8387), WORD(0xb8f6), WORD(0x6a8c), WORD(0x6e7a), WORD(0x67b1), WORD(0xcbe5),
+	WORD(0x7d30), WORD(0x05a3), WORD(0xc181), WORD(0x6553), WORD(0xfbe4), WORD(0xf02b),
+	WORD(0xce31), WORD(0x53c4), WORD(0xbb61), WORD(0x0f26), WORD(0x669a), WORD(0x2164),
+	WORD(0xac48), WORD(0xd7e8), WORD(0xb88f), WORD(0xfbd5), WORD(0x6735), WORD(0x8a04),
+	WORD(0xe85f), WORD(0xed05), WORD(0x216c), WORD(0x0c51), WORD(0x44b6), WORD(0xb2ed),
+	WORD(0x4855), WORD(0x5feb),
+	/* T[22] */
+	WORD(0xbf1d), WORD(0x0bb3), WORD(0x967e), WORD(0x38dd), WORD(0x811c), WORD(0xb47e),
+	WORD(0xdf0b), WORD(0xccbe), WORD(0xb15a), WORD(0x7c60), WORD(0x2a47), WORD(0x8ca5),
+	WORD(0x3835), WORD(0x09a2), WORD(0x733f), WORD(0x2e1d), WORD(0xa2b4), WORD(0xd94a),
+	WORD(0xd3ff), WORD(0x4da9), WORD(0x8524), WORD(0xbc2f), WORD(0x3e83), WORD(0x37ad),
+	WORD(0x05a8), WORD(0x321f), WORD(0xefe1), WORD(0x5365), WORD(0xd0d7), WORD(0xeb32),
+	WORD(0x236c), WORD(0x0459),
+	/* T[23] */
+	WORD(0x6a08), WORD(0x2a76), WORD(0x4919), WORD(0xc6e7), WORD(0x959f), WORD(0x866e),
+	WORD(0xe78d), WORD(0x8cb3), WORD(0xa7f6), WORD(0xd53a), WORD(0xbaba), WORD(0xd25a),
+	WORD(0xa721), WORD(0xa770), WORD(0x490f), WORD(0x714b), WORD(0x2981), WORD(0x8d2a),
+	WORD(0x0a2d), WORD(0xd614), WORD(0x362f), WORD(0xef27), WORD(0x405a), WORD(0xa205),
+	WORD(0x0d04), WORD(0xb70d), WORD(0xf119), WORD(0x0d2f), WORD(0x4016), WORD(0x9999),
+	WORD(0x95ac), WORD(0x232e),
+	/* T[24] */
+	WORD(0x6fc9), WORD(0x1b72), WORD(0x4caf), WORD(0x0b36), WORD(0x3e53), WORD(0x7b24),
+	WORD(0xb574), WORD(0x4021), WORD(0x086e), WORD(0xe54c), WORD(0x3b79), WORD(0x5b5d),
+	WORD(0x1449), WORD(0xa66c), WORD(0xda6c), WORD(0x99a8), WORD(0x222e), WORD(0x1968),
+	WORD(0xbc77), WORD(0x024d), WORD(0x45c2), WORD(0xff2e), WORD(0xa5ee), WORD(0x2567),
+	WORD(0xd6ab), WORD(0x5ad6), WORD(0xf9a8), WORD(0xc45e), WORD(0xfc5a), WORD(0x89fb),
+	WORD(0x8dcc), WORD(0x9ffc),
+	/* T[25] */
+	WORD(0xf7a4), WORD(0x73b1), WORD(0xc150), WORD(0xc642), WORD(0x9df1), WORD(0x3c7a),
+	WORD(0x1d9f), WORD(0x4a94), WORD(0x270b), WORD(0x5963), WORD(0xfa9a), WORD(0xe769),
+	WORD(0xdd49), WORD(0x8afa), WORD(0xadf6), WORD(0x2ecc), WORD(0x3939), WORD(0x761e),
+	WORD(0x7f7d), WORD(0xbc1e), WORD(0xbdb4), WORD(0xf493), WORD(0xf661), WORD(0xf089),
+	WORD(0xd115), WORD(0x47f1), WORD(0x9e45), WORD(0xd418), WORD(0xf262), WORD(0xb728),
+	WORD(0x6bc6), WORD(0x4bb7),
+	/* T[26] */
+	WORD(0x196f), WORD(0xdb4b), WORD(0xe84f), WORD(0x73e3), WORD(0x1bfe), WORD(0x3012),
+	WORD(0x1a2a), WORD(0x1859), WORD(0xf991), WORD(0x6685), WORD(0x3fec), WORD(0xaef4),
+	WORD(0x216d), WORD(0x02e0), WORD(0xed10), WORD(0x73da), WORD(0x9266), WORD(0x40f1),
+	WORD(0x2004), WORD(0xe963), WORD(0x46c0), WORD(0xbf05), WORD(0x9939), WORD(0x6ac7),
+	WORD(0x4b00), WORD(0x9e00), WORD(0x319f), WORD(0x4788), WORD(0xb413), WORD(0xda7b),
+	WORD(0x90fb), WORD(0x9b14),
+	/* T[27] */
+	WORD(0xa578), WORD(0x3024), WORD(0x3526), WORD(0x1745), WORD(0xa928), WORD(0xb791),
+	WORD(0x3c34), WORD(0x74b4), WORD(0x9df5), WORD(0xca82), WORD(0xf782), WORD(0x9b54),
+	WORD(0xe7fb), WORD(0x3fcf), WORD(0x6703), WORD(0x8266), WORD(0x7d6c), WORD(0x719c),
+	WORD(0x789c), WORD(0xb3e0), WORD(0xc92e), WORD(0x70db), WORD(0xa11b), WORD(0xfba2),
+	WORD(0xe38f), WORD(0x3d82), WORD(0x6c9d), WORD(0xd454), WORD(0x54a7), WORD(0xa07f),
+	WORD(0x92b8), WORD(0x5866),
+	/* T[28] */
+	WORD(0x430d), WORD(0x2bed), WORD(0x9dff), WORD(0x46ea), WORD(0x4c3b), WORD(0x8d92),
+	WORD(0x7c34), WORD(0x9a00), WORD(0xd827), WORD(0x29ef), WORD(0x13e9), WORD(0x566f),
+	WORD(0x3300), WORD(0x2bf8), WORD(0x05a2), WORD(0x6db4), WORD(0xfab4), WORD(0x6078),
+	WORD(0x69c5), WORD(0xdb99), WORD(0x6a52), WORD(0xc295), WORD(0x6891), WORD(0x4546),
+	WORD(0x9f0e), WORD(0x0882), WORD(0x5634), WORD(0x861c), WORD(0xe977), WORD(0x8be8),
+	WORD(0x657c), WORD(0x9383),
+	/* T[29] */
+	WORD(0x82cf), WORD(0x00d4), WORD(0x870c), WORD(0x6819), WORD(0xe582), WORD(0xd304),
+	WORD(0x1b12), WORD(0xa783), WORD(0x388c), WORD(0x5ded), WORD(0x4cef), WORD(0x4267),
+	WORD(0x274d), WORD(0x99bf), WORD(0x8cf9), WORD(0x0830), WORD(0x6762), WORD(0xaacc),
+	WORD(0x5f09), WORD(0xc201), WORD(0x49b5), WORD(0xbc01), WORD(0xf13a), WORD(0xd906),
+	WORD(0x24ab), WORD(0x095b), WORD(0xf81f), WORD(0x0a05), WORD(0x10e9), WORD(0xf34f),
+	WORD(0xc5aa), WORD(0x91bb),
+	/* T[30] */
+	WORD(0xe833), WORD(0xa2b6), WORD(0x94e6), WORD(0xa08e), WORD(0x7792), WORD(0x8ca1),
+	WORD(0x5702), WORD(0x412d), WORD(0xcb08), WORD(0xadac), WORD(0x8ebf), WORD(0x51f6),
+	WORD(0x13dc), WORD(0xfb80), WORD(0xca38), WORD(0x1d64), WORD(0xcff6), WORD(0x0748),
+	WORD(0xf2d3), WORD(0x70af), WORD(0xf067), WORD(0x3f5f), WORD(0x35c8), WORD(0x7492),
+	WORD(0xb5c9), WORD(0xc4e5), WORD(0x59f9), WORD(0x63b5), WORD(0x21b7), WORD(0x44a5),
+	WORD(0xf947), WORD(0x92a3),
+	/* T[31] */
+	WORD(0x0550), WORD(0xf50a), WORD(0x1083), WORD(0x573a), WORD(0x22ec), WORD(0xb3fe),
+	WORD(0x5c90), WORD(0x7250), WORD(0x0389), WORD(0xacb2), WORD(0x3347), WORD(0x387e),
+	WORD(0x494b), WORD(0x93f6), WORD(0xc967), WORD(0x1af9), WORD(0x6f93), WORD(0xcccf),
+	WORD(0xe635), WORD(0xfcb3), WORD(0x6948), WORD(0xb62b), WORD(0x098a), WORD(0x75cc),
+	WORD(0xd78b), WORD(0x5c75), WORD(0x3a59), WORD(0x6c61), WORD(0x6189), WORD(0xad9f),
+	WORD(0x4c79), WORD(0x7ec6),
+};
+#else                     /* unknown word size */
+#error "Unsupported word size"
+#endif
+TO_EC_GEN_TABLE_PARAM(brainpoolp256r1_gen_comb, 6);
+
 static const ec_str_params brainpoolp256r1_str_params = {
 	.p = &brainpoolp256r1_p_str_param,
 	.p_bitlen = &brainpoolp256r1_p_bitlen_str_param,
@@ -173,6 +1493,11 @@ static const ec_str_params brainpoolp256r1_str_params = {
 	.cofactor = &brainpoolp256r1_cofactor_str_param,
 	.oid = &brainpoolp256r1_oid_str_param,
 	.name = &brainpoolp256r1_name_str_param,
+	.p_inv_chain = &brainpoolp256r1_p_inv_chain_param,
+	.p_sqrt_chain = &brainpoolp256r1_p_sqrt_chain_param,
+	.q_inv_chain = &brainpoolp256r1_q_inv_chain_param,
+	.gen_wnaf_table = &brainpoolp256r1_gen_wnaf_table_param,
+	.gen_comb_table = &brainpoolp256r1_gen_comb_table_param,
 };
 
 /*
@@ -193,6 +1518,17 @@ static const ec_str_params brainpoolp256r1_str_params = {
 #define CURVES_MAX_Q_BIT_LEN CURVE_BRAINPOOLP256R1_Q_BITLEN
 #endif
 
+/*
+ * Limb count of p for the fixed limbs field backend (see fp_fixed.h)
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+#define FP_FIXED_WLEN_4_USED
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+#define FP_FIXED_WLEN_8_USED
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+#define FP_FIXED_WLEN_16_USED
+#endif
+
 #endif /* __EC_PARAMS_BRAINPOOLP256R1_H__ */
 
 #endif /* WITH_CURVE_BRAINPOOLP256R1 */
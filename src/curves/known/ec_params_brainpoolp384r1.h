@@ -191,6 +191,1786 @@ TO_EC_STR_PARAM(brainpoolp384r1_oid);
 static const u8 brainpoolp384r1_name[] = "BRAINPOOLP384R1";
 TO_EC_STR_PARAM(brainpoolp384r1_name);
 
+/* x^(p - 2): 384 squarings and 84 multiplications */
+static const u8 brainpoolp384r1_p_inv[] = {
+	0x10, 0x01, 0xff,
+	0x20, 0x00, 0x01,
+	0x32, 0x00, 0x01,
+	0x43, 0x00, 0x01,
+	0x54, 0x00, 0x01,
+	0x65, 0x00, 0x01,
+	0x76, 0x00, 0x01,
+	0x87, 0x00, 0x01,
+	0x90, 0x05, 0x02,
+	0x99, 0x06, 0x06,
+	0x99, 0x04, 0x05,
+	0x99, 0x07, 0x08,
+	0x99, 0x02, 0x00,
+	0x99, 0x08, 0x03,
+	0x99, 0x02, 0x00,
+	0x99, 0x05, 0x02,
+	0x99, 0x05, 0x04,
+	0x99, 0x08, 0x07,
+	0x99, 0x03, 0x03,
+	0x99, 0x05, 0x03,
+	0x99, 0x0b, 0x08,
+	0x99, 0x05, 0x06,
+	0x99, 0x03, 0x03,
+	0x99, 0x05, 0x07,
+	0x99, 0x03, 0x04,
+	0x99, 0x05, 0x08,
+	0x99, 0x02, 0x02,
+	0x99, 0x05, 0x03,
+	0x99, 0x07, 0x04,
+	0x99, 0x04, 0x02,
+	0x99, 0x03, 0x00,
+	0x99, 0x08, 0x04,
+	0x99, 0x05, 0x08,
+	0x99, 0x01, 0x00,
+	0x99, 0x06, 0x03,
+	0x99, 0x05, 0x05,
+	0x99, 0x05, 0x08,
+	0x99, 0x04, 0x04,
+	0x99, 0x04, 0x00,
+	0x99, 0x08, 0x05,
+	0x99, 0x03, 0x04,
+	0x99, 0x05, 0x07,
+	0x99, 0x04, 0x03,
+	0x99, 0x02, 0x00,
+	0x99, 0x06, 0x03,
+	0x99, 0x05, 0x07,
+	0x99, 0x05, 0x07,
+	0x99, 0x09, 0x05,
+	0x99, 0x05, 0x06,
+	0x99, 0x06, 0x04,
+	0x99, 0x05, 0x07,
+	0x99, 0x06, 0x02,
+	0x99, 0x06, 0x06,
+	0x99, 0x04, 0x08,
+	0x99, 0x02, 0x02,
+	0x99, 0x05, 0x07,
+	0x99, 0x02, 0x02,
+	0x99, 0x04, 0x00,
+	0x99, 0x07, 0x05,
+	0x99, 0x06, 0x04,
+	0x99, 0x05, 0x06,
+	0x99, 0x06, 0x07,
+	0x99, 0x05, 0x04,
+	0x99, 0x05, 0x05,
+	0x99, 0x02, 0x02,
+	0x99, 0x05, 0x03,
+	0x99, 0x04, 0x02,
+	0x99, 0x03, 0x00,
+	0x99, 0x0a, 0x04,
+	0x99, 0x02, 0x00,
+	0x99, 0x07, 0x07,
+	0x99, 0x05, 0x04,
+	0x99, 0x05, 0x02,
+	0x99, 0x07, 0x04,
+	0x99, 0x02, 0x00,
+	0x99, 0x06, 0x04,
+	0x99, 0x0f, 0x05,
+	0x99, 0x04, 0x05,
+	0x99, 0x01, 0x00,
+	0x99, 0x04, 0x00,
+	0x99, 0x09, 0x08,
+	0x99, 0x02, 0x02,
+	0x99, 0x03, 0x02,
+	0x99, 0x06, 0x03,
+	0x99, 0x04, 0x00,
+};
+TO_EC_CHAIN_PARAM(brainpoolp384r1_p_inv);
+
+/* x^((p + 1) / 4): 382 squarings and 84 multiplications */
+static const u8 brainpoolp384r1_p_sqrt[] = {
+	0x10, 0x01, 0xff,
+	0x20, 0x00, 0x01,
+	0x32, 0x00, 0x01,
+	0x43, 0x00, 0x01,
+	0x54, 0x00, 0x01,
+	0x65, 0x00, 0x01,
+	0x76, 0x00, 0x01,
+	0x87, 0x00, 0x01,
+	0x90, 0x05, 0x02,
+	0x99, 0x06, 0x06,
+	0x99, 0x04, 0x05,
+	0x99, 0x07, 0x08,
+	0x99, 0x02, 0x00,
+	0x99, 0x08, 0x03,
+	0x99, 0x02, 0x00,
+	0x99, 0x05, 0x02,
+	0x99, 0x05, 0x04,
+	0x99, 0x08, 0x07,
+	0x99, 0x03, 0x03,
+	0x99, 0x05, 0x03,
+	0x99, 0x0b, 0x08,
+	0x99, 0x05, 0x06,
+	0x99, 0x03, 0x03,
+	0x99, 0x05, 0x07,
+	0x99, 0x03, 0x04,
+	0x99, 0x05, 0x08,
+	0x99, 0x02, 0x02,
+	0x99, 0x05, 0x03,
+	0x99, 0x07, 0x04,
+	0x99, 0x04, 0x02,
+	0x99, 0x03, 0x00,
+	0x99, 0x08, 0x04,
+	0x99, 0x05, 0x08,
+	0x99, 0x01, 0x00,
+	0x99, 0x06, 0x03,
+	0x99, 0x05, 0x05,
+	0x99, 0x05, 0x08,
+	0x99, 0x04, 0x04,
+	0x99, 0x04, 0x00,
+	0x99, 0x08, 0x05,
+	0x99, 0x03, 0x04,
+	0x99, 0x05, 0x07,
+	0x99, 0x04, 0x03,
+	0x99, 0x02, 0x00,
+	0x99, 0x06, 0x03,
+	0x99, 0x05, 0x07,
+	0x99, 0x05, 0x07,
+	0x99, 0x09, 0x05,
+	0x99, 0x05, 0x06,
+	0x99, 0x06, 0x04,
+	0x99, 0x05, 0x07,
+	0x99, 0x06, 0x02,
+	0x99, 0x06, 0x06,
+	0x99, 0x04, 0x08,
+	0x99, 0x02, 0x02,
+	0x99, 0x05, 0x07,
+	0x99, 0x02, 0x02,
+	0x99, 0x04, 0x00,
+	0x99, 0x07, 0x05,
+	0x99, 0x06, 0x04,
+	0x99, 0x05, 0x06,
+	0x99, 0x06, 0x07,
+	0x99, 0x05, 0x04,
+	0x99, 0x05, 0x05,
+	0x99, 0x02, 0x02,
+	0x99, 0x05, 0x03,
+	0x99, 0x04, 0x02,
+	0x99, 0x03, 0x00,
+	0x99, 0x0a, 0x04,
+	0x99, 0x02, 0x00,
+	0x99, 0x07, 0x07,
+	0x99, 0x05, 0x04,
+	0x99, 0x05, 0x02,
+	0x99, 0x07, 0x04,
+	0x99, 0x02, 0x00,
+	0x99, 0x06, 0x04,
+	0x99, 0x0f, 0x05,
+	0x99, 0x04, 0x05,
+	0x99, 0x01, 0x00,
+	0x99, 0x04, 0x00,
+	0x99, 0x09, 0x08,
+	0x99, 0x02, 0x02,
+	0x99, 0x03, 0x02,
+	0x99, 0x06, 0x03,
+	0x99, 0x02, 0x00,
+};
+TO_EC_CHAIN_PARAM(brainpoolp384r1_p_sqrt);
+
+/* x^(q - 2): 384 squarings and 86 multiplications */
+static const u8 brainpoolp384r1_q_inv[] = {
+	0x10, 0x01, 0xff,
+	0x20, 0x00, 0x01,
+	0x32, 0x00, 0x01,
+	0x43, 0x00, 0x01,
+	0x54, 0x00, 0x01,
+	0x65, 0x00, 0x01,
+	0x76, 0x00, 0x01,
+	0x87, 0x00, 0x01,
+	0x90, 0x05, 0x02,
+	0x99, 0x06, 0x06,
+	0x99, 0x04, 0x05,
+	0x99, 0x07, 0x08,
+	0x99, 0x02, 0x00,
+	0x99, 0x08, 0x03,
+	0x99, 0x02, 0x00,
+	0x99, 0x05, 0x02,
+	0x99, 0x05, 0x04,
+	0x99, 0x08, 0x07,
+	0x99, 0x03, 0x03,
+	0x99, 0x05, 0x03,
+	0x99, 0x0b, 0x08,
+	0x99, 0x05, 0x06,
+	0x99, 0x03, 0x03,
+	0x99, 0x05, 0x07,
+	0x99, 0x03, 0x04,
+	0x99, 0x05, 0x08,
+	0x99, 0x02, 0x02,
+	0x99, 0x05, 0x03,
+	0x99, 0x07, 0x04,
+	0x99, 0x04, 0x02,
+	0x99, 0x03, 0x00,
+	0x99, 0x08, 0x04,
+	0x99, 0x05, 0x08,
+	0x99, 0x01, 0x00,
+	0x99, 0x06, 0x03,
+	0x99, 0x05, 0x05,
+	0x99, 0x05, 0x08,
+	0x99, 0x04, 0x04,
+	0x99, 0x04, 0x00,
+	0x99, 0x08, 0x05,
+	0x99, 0x03, 0x04,
+	0x99, 0x05, 0x07,
+	0x99, 0x04, 0x03,
+	0x99, 0x02, 0x00,
+	0x99, 0x06, 0x03,
+	0x99, 0x05, 0x07,
+	0x99, 0x03, 0x02,
+	0x99, 0x04, 0x02,
+	0x99, 0x07, 0x08,
+	0x99, 0x01, 0x00,
+	0x99, 0x07, 0x06,
+	0x99, 0x06, 0x07,
+	0x99, 0x02, 0x02,
+	0x99, 0x06, 0x07,
+	0x99, 0x04, 0x05,
+	0x99, 0x05, 0x06,
+	0x99, 0x08, 0x00,
+	0x99, 0x08, 0x05,
+	0x99, 0x05, 0x07,
+	0x99, 0x06, 0x08,
+	0x99, 0x04, 0x05,
+	0x99, 0x03, 0x04,
+	0x99, 0x05, 0x04,
+	0x99, 0x04, 0x03,
+	0x99, 0x05, 0x07,
+	0x99, 0x03, 0x03,
+	0x99, 0x05, 0x06,
+	0x99, 0x04, 0x07,
+	0x99, 0x03, 0x03,
+	0x99, 0x05, 0x07,
+	0x99, 0x04, 0x08,
+	0x99, 0x04, 0x08,
+	0x99, 0x06, 0x02,
+	0x99, 0x04, 0x00,
+	0x99, 0x09, 0x04,
+	0x99, 0x04, 0x04,
+	0x99, 0x04, 0x00,
+	0x99, 0x07, 0x02,
+	0x99, 0x03, 0x00,
+	0x99, 0x0b, 0x06,
+	0x99, 0x03, 0x03,
+	0x99, 0x03, 0x00,
+	0x99, 0x06, 0x00,
+	0x99, 0x05, 0x02,
+	0x99, 0x05, 0x03,
+	0x99, 0x03, 0x02,
+	0x99, 0x05, 0x02,
+};
+TO_EC_CHAIN_PARAM(brainpoolp384r1_q_inv);
+
+/*
+ * Odd multiples G, 3G, ..., 63G of the generator for the wNAF
+ * multiplications (window 7), affine x and y in Montgomery representation
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+static const word_t brainpoolp384r1_gen_wnaf[] = {
+	/* G */
+	WORD(0xa189deebd438fbc1), WORD(0x66fc80e8d5a886bf),
+	WORD(0x94c378e99d202f23), WORD(0x068b264ef95c2164),
+	WORD(0x9cdd0dcfbacd0099), WORD(0x8500753388f53fc1),
+	WORD(0xe738b3310de140a5), WORD(0xf5e0d246c7996f55),
+	WORD(0xf88309a38f0737fc), WORD(0xa180acd4d5719217),
+	WORD(0xc61625664f21ddb6), WORD(0x2cf4a062458968b5),
+	/* 3G */
+	WORD(0x2e87b6b5ce7d7224), WORD(0xad2c4af75a72461a),
+	WORD(0x3a5656812ced5d1d), WORD(0xc7e3c8556d3d9c10),
+	WORD(0x93e8454e7f326e2f), WORD(0x4bd131bd7606782a),
+	WORD(0x744eeef4576498af), WORD(0x463253b57dd5d130),
+	WORD(0x148579c7ddfd1d1d), WORD(0x1c61f51394ab2f14),
+	WORD(0x6d85b8ee9fe98583), WORD(0x42b06ef36abef61d),
+	/* 5G */
+	WORD(0xb41f442ad8ce9c49), WORD(0x74989913f2c28de5),
+	WORD(0x3ccf2b6ec0e32761), WORD(0xa4bc3eecc78ef5b1),
+	WORD(0xf17642077106ddb6), WORD(0x01ef19cba3a80cfc),
+	WORD(0xdeb8cd3c92d1018d), WORD(0xbc9bba0ee0af7013),
+	WORD(0xb31eadb3f6e97434), WORD(0xdff2df918101041f),
+	WORD(0xa14e010330cacb07), WORD(0x40db7c90ca03a002),
+	/* 7G */
+	WORD(0x768422bff6835c16), WORD(0xd4d9a16888742837),
+	WORD(0x5f0d3ec25a8fa33a), WORD(0x0cc3ed0b2661924d),
+	WORD(0x98857089a9902452), WORD(0x091be5a4a48e18bd),
+	WORD(0x04b8bd3717ef7556), WORD(0x1dad241b002db12e),
+	WORD(0x099ca996a0566f74), WORD(0x077aa1f32c5117aa),
+	WORD(0x1830b286165a0713), WORD(0x48116bda93701b12),
+	/* 9G */
+	WORD(0x0066aa18923440de), WORD(0xa3b775c63364d7d5),
+	WORD(0xcbc1a12427c58e01), WORD(0xac2ad5a583d2dff0),
+	WORD(0x39d8efce43620769), WORD(0x8802607da6501595),
+	WORD(0xa2aa414b7e3b2101), WORD(0xe7cd4887f0597f95),
+	WORD(0x392d8a2c9dc8df84), WORD(0xedd53d57a93a3ada),
+	WORD(0x8b57c36c8ae63e94), WORD(0x80c18d38b31a5c75),
+	/* 11G */
+	WORD(0xf9cd0728edb12cd2), WORD(0x6eaca41bdffddb84),
+	WORD(0x79f5c417bf3e8831), WORD(0x119e9f8dc798afce),
+	WORD(0x528a6f859111fe9e), WORD(0x21d8ef4ebee8180c),
+	WORD(0x75362a33dcaff317), WORD(0x023e4bb8af3c4ff7),
+	WORD(0x3b5e01b474aaf7ae), WORD(0xf321ef25cb04ef2b),
+	WORD(0x5c2268589e886c70), WORD(0x2528faa003941651),
+	/* 13G */
+	WORD(0x3b6a1968b89357cc), WORD(0xbe74477bb7232c2e),
+	WORD(0xa76e871e80b79318), WORD(0xc9c1678ed49cb174),
+	WORD(0x1f139b238168c1b7), WORD(0x850e6136a145267a),
+	WORD(0xf62495c5da4e01a2), WORD(0xd38b4f0116389a64),
+	WORD(0xa7d3478530dc4590), WORD(0x617067491e8e8f55),
+	WORD(0xe40157b1b83eda1b), WORD(0x546e48bc32e2ebb2),
+	/* 15G */
+	WORD(0xcf37576fa216bcfe), WORD(0xf0b7726338c71258),
+	WORD(0x14f5e71a268e074c), WORD(0xf06395a1578c607e),
+	WORD(0x351c810092dcb441), WORD(0x09d85c457724cb80),
+	WORD(0xd3ac38673a3ab69a), WORD(0x2cf4d2e544ce2e34),
+	WORD(0xeb2ea010956c6dee), WORD(0x784c963e04ac5a40),
+	WORD(0xd0de76aae553ff54), WORD(0x0f5e7fee0c7df359),
+	/* 17G */
+	WORD(0x9b987fa826642091), WORD(0x2998f9f7956e01f9),
+	WORD(0x3a5f27d139c9d012), WORD(0xb0d1bb99db13b227),
+	WORD(0xbe72b18f5ecffc23), WORD(0x2608190501820a55),
+	WORD(0x1702f527319b7954), WORD(0x6b10087087e36107),
+	WORD(0xc3908198b5f73e3c), WORD(0xb4ccc0ca9d16a93a),
+	WORD(0xf26bf177a547b486), WORD(0x2f9361c19019bec3),
+	/* 19G */
+	WORD(0xa9a7fe16d0c35a70), WORD(0x87a183003b3ab2cc),
+	WORD(0xd0289819baf327ca), WORD(0x3e1219c77a132366),
+	WORD(0x9b684c7cae86cdad), WORD(0x4931be163c474ea0),
+	WORD(0x591c6ee852e48066), WORD(0xb6ee45e257981b70),
+	WORD(0x98345453d576ebc0), WORD(0x3a1b223495e7824f),
+	WORD(0xa86cfd0297062328), WORD(0x0fc7a992eca9631e),
+	/* 21G */
+	WORD(0xdfdd0d1cc3639a4f), WORD(0x07137489d3bf79e4),
+	WORD(0xbdf8bb0bf8793c9f), WORD(0xb248ba22b0cc5765),
+	WORD(0xe7b8bb9618cec1d1), WORD(0x76235aad3481431c),
+	WORD(0x885e1dc38e4869ce), WORD(0x1761bd3416fe4753),
+	WORD(0xcd996c0e6e96653d), WORD(0x35b2bfd062734c54),
+	WORD(0x32d1e454ca11dec9), WORD(0x71840f9483971184),
+	/* 23G */
+	WORD(0xbb5d1a40c5fb226b), WORD(0x36e8f8d6b32998f9),
+	WORD(0x9d655e702665bb92), WORD(0x96eb0f257fbfaf39),
+	WORD(0xa4fb933430019d53), WORD(0x706691b334deabab),
+	WORD(0x798354f302668ee1), WORD(0x2b500a07cfee1393),
+	WORD(0xf58fe3dc50c76533), WORD(0xa1dff4c4b6022fbc),
+	WORD(0xd48fdd60b8160ad8), WORD(0x4303ddbb3f90d1de),
+	/* 25G */
+	WORD(0xa4d06ac5485839b0), WORD(0x8a70b93a2fdb835a),
+	WORD(0x05f26bf1e42e23ef), WORD(0xaab0992a9d4c2c4b),
+	WORD(0x148a0ab7f591eeb4), WORD(0x6489356de57bf322),
+	WORD(0x7766e4d59df3f403), WORD(0xcecb18ac2a342484),
+	WORD(0x3b0250c11f31ba09), WORD(0xeaca0655ce530fad),
+	WORD(0x0c477e90542e0df0), WORD(0x6687dad26400cdf1),
+	/* 27G */
+	WORD(0x85c721a14b25279e), WORD(0xd489f9d0fa415463),
+	WORD(0x0423ddf510c3542c), WORD(0x109624a9d528ac78),
+	WORD(0x9bfbc530b79417ad), WORD(0x08edc385d4af6102),
+	WORD(0x63f679131e52029a), WORD(0xc965510b6f5992e8),
+	WORD(0x3671585824ba8a16), WORD(0x74508dba95675d9e),
+	WORD(0xcd1b8842eca4e50f), WORD(0x4787c5bfb3791661),
+	/* 29G */
+	WORD(0x0a9be6902eb516de), WORD(0x39517cd7d44b3ef2),
+	WORD(0x48764dbbf120b877), WORD(0x13ce4f95ce43cb90),
+	WORD(0x51c6f0ce14be271e), WORD(0x6d886ef54395c025),
+	WORD(0xf9a76c6a1896a9f3), WORD(0xeb1cf2ee25185555),
+	WORD(0x5fb5cf029b75f3f2), WORD(0x07b10155800665ee),
+	WORD(0x7357b3734ce8d13b), WORD(0x6de8ed1f53d5871b),
+	/* 31G */
+	WORD(0x1d17f7daab74a3b8), WORD(0x1fbd10835e5dff09),
+	WORD(0xd52cb03a71e53185), WORD(0xf5f52d7bf37db9ab),
+	WORD(0x961567bd652bd75d), WORD(0x885a2ddf0aefc05e),
+	WORD(0xf83e945ce6e49f6d), WORD(0x87f407e128e7476c),
+	WORD(0x0be6a18692ce937e), WORD(0xa378cec975b114c7),
+	WORD(0x97878d694358a9a9), WORD(0x06f7f4acc581aba5),
+	/* 33G */
+	WORD(0x936c8c825942b6ce), WORD(0x0439ebb0a78b7b67),
+	WORD(0xfd34928d9c8f961e), WORD(0x7c6c6b1fead100aa),
+	WORD(0xe50a45b56d90f520), WORD(0x1d94bcfe92c270e9),
+	WORD(0x864ffce1ac6522c2), WORD(0x8265aa450b75ebf3),
+	WORD(0x53220586a0e8a3a8), WORD(0x6fa6ec6015a114f0),
+	WORD(0x7739f6de1ea8b048), WORD(0x5d8e8decff655b6e),
+	/* 35G */
+	WORD(0x3e3661938fcc55f6), WORD(0x83d32ffcb59e0ef0),
+	WORD(0x04a507c8c72026af), WORD(0x9ec77692a9dc6633),
+	WORD(0xc9e2e46af6483bfa), WORD(0x0b28bd9fb3698bb0),
+	WORD(0x5f4904685c463d91), WORD(0x0f7cfd23c19946ff),
+	WORD(0x713e67338465360b), WORD(0xadd4b6c6e8d4673f),
+	WORD(0x0f82929afbced3b5), WORD(0x404f047b5d03850d),
+	/* 37G */
+	WORD(0x21a73ecd93af73d9), WORD(0x469f410e77d01aaf),
+	WORD(0x0eae649ceb4eebcc), WORD(0x8d9f9e0fa821bbf8),
+	WORD(0x1374f8cb10d831ac), WORD(0x8c60d25c608a16b5),
+	WORD(0xd45d518daba7d415), WORD(0xa431583cf93225ee),
+	WORD(0x47e2a67ecd024a85), WORD(0x26bb09a4f5602b2a),
+	WORD(0xc14eba9534dc37a9), WORD(0x7baa536f01305670),
+	/* 39G */
+	WORD(0x0269b08ebeeaaa78), WORD(0xc3f84406e4cd1c2b),
+	WORD(0xeb4577fad3a909f6), WORD(0x071634da97c17397),
+	WORD(0x3cbef3ed7b822a4d), WORD(0x2b07a47f941bfa59),
+	WORD(0xa8f66b926b65d48c), WORD(0x3c4856d2761e2508),
+	WORD(0x5b48708ed3d60d4b), WORD(0x29e551fbe6e77020),
+	WORD(0xa9ae05960a09530b), WORD(0x40a53a87649403e8),
+	/* 41G */
+	WORD(0x302cf2ac3688a101), WORD(0xc1337e5a3ddbc78b),
+	WORD(0x511336708697dc5b), WORD(0x1086da6826e7bbab),
+	WORD(0x6d12ccbd170c1a9f), WORD(0x6e8156005aca9925),
+	WORD(0x3d65572e1874f9f4), WORD(0x7586baff1bfa10cd),
+	WORD(0x815564ec68056a14), WORD(0xf1259cb657cb4de4),
+	WORD(0xa15b5ff07df7a75d), WORD(0x27cb8d4f2a6cf4de),
+	/* 43G */
+	WORD(0xfb763bec95869f4e), WORD(0x0dac06c53515d350),
+	WORD(0x24aafd6781c18704), WORD(0xc96f176e56a8629b),
+	WORD(0x3c5a7bf435427dc8), WORD(0x23c40f1a9a1d0713),
+	WORD(0xe02ef22f4e5e1c54), WORD(0x74c4ff0629943efd),
+	WORD(0xdda12e48caeccf96), WORD(0x6e01e10f80b8d82a),
+	WORD(0xeb7b77a81f2421c6), WORD(0x268ac18c3621daee),
+	/* 45G */
+	WORD(0xecb8f40a8a2a483a), WORD(0xbd8412936ee8d716),
+	WORD(0xcf0a340e06cbb4f1), WORD(0x39a97d21e1557de1),
+	WORD(0x4eb58e59e637e23a), WORD(0x44590d7ae8b4945d),
+	WORD(0xecf08e8688bedcc9), WORD(0x37be99f740f30fa3),
+	WORD(0x709fe684da269945), WORD(0xc2f50bdd1aff1b94),
+	WORD(0x9d946608584e2712), WORD(0x342b813a26f5da63),
+	/* 47G */
+	WORD(0x62f6a26d4680a1f8), WORD(0xbe4276ef0e6edc98),
+	WORD(0xc1e2e8790da5639b), WORD(0x8452a0be72dcc6ea),
+	WORD(0x05c2a6f5cbea6dfe), WORD(0x3a5557499a1aaf56),
+	WORD(0xc7ea8266d2c71e6e), WORD(0x17861e709888e481),
+	WORD(0xa9821530527b8025), WORD(0xff4383f3de9a2619),
+	WORD(0x0d55bd61086818b8), WORD(0x2acd63ffde971668),
+	/* 49G */
+	WORD(0x7038a44995399b1a), WORD(0x05486c7b36d10a29),
+	WORD(0x6bbcef6bae38126d), WORD(0x6795d541f81ed677),
+	WORD(0x3931edc46aa3406e), WORD(0x528a1f5297d659c3),
+	WORD(0xc93bb4f4c4ca48c2), WORD(0x4820c1351d6589c2),
+	WORD(0xf7baaa27d598ba24), WORD(0xb1838232e52076b2),
+	WORD(0xd97ccf7501a43aac), WORD(0x01ba62b3fd819bb4),
+	/* 51G */
+	WORD(0xcf5602bdddc9637e), WORD(0xb821f0bb42bcab9d),
+	WORD(0xdc0de6ae71bd5ba2), WORD(0x20792635689e3fd3),
+	WORD(0x88b4ccbbcf61423f), WORD(0x8486d0dcfd7ccdce),
+	WORD(0xf7a4edfd1feaf619), WORD(0x7a3fe5125c9e28db),
+	WORD(0x9077144ca8f15a0c), WORD(0x66bcfd2c987420b1),
+	WORD(0x5d826d8578e84a92), WORD(0x477d4f33b31c371e),
+	/* 53G */
+	WORD(0x3768343ba91c39bf), WORD(0xb6ffbc8441e79ca0),
+	WORD(0x3c7e2ce86df885f9), WORD(0xdb94352778ee37db),
+	WORD(0x281e5a07b84aa744), WORD(0x3c60135367fc1992),
+	WORD(0x89eb6aec0d6d4ab3), WORD(0x9ef7c3b85aef5074),
+	WORD(0xa5a84b32d0944a8d), WORD(0xd52eba1ab91626e8),
+	WORD(0xb616f0da2f543f29), WORD(0x636b3a7ee9195b51),
+	/* 55G */
+	WORD(0xa46e61f6067003d3), WORD(0x10ee43f120534a46),
+	WORD(0x791318f84d8e7427), WORD(0x7b0e0562bd472168),
+	WORD(0xf7e1060d605aff2e), WORD(0x4140f6855fdfab45),
+	WORD(0xbd618e081a61c437), WORD(0x71b978a3b0284922),
+	WORD(0x6781088441cdb612), WORD(0x2e2b83ffc6a1161f),
+	WORD(0x880eee4f707002d1), WORD(0x5f150ba2eefa9b6c),
+	/* 57G */
+	WORD(0xd0aae6d9bc6fcf55), WORD(0x4c75280e956d15b9),
+	WORD(0xe69dbe59e75f76b8), WORD(0x91da59e6043342b8),
+	WORD(0x6e5a4d904aa258a5), WORD(0x15e7720b83503c8a),
+	WORD(0xa88cb3e67f6b5802), WORD(0x6063c135bd8b4214),
+	WORD(0xfeb6a4f1713d176d), WORD(0x1d49cb5288aa65e1),
+	WORD(0x9127cba1373ba239), WORD(0x5601adac02d673e1),
+	/* 59G */
+	WORD(0xc2bef0bd424a01d7), WORD(0xe03045b6333ada1f),
+	WORD(0xe1d87309adda578c), WORD(0x0db7b14fc25ae4fb),
+	WORD(0x29d792b7f581766d), WORD(0x77b7a24042cc1333),
+	WORD(0x1b88fbf2ab9d15e1), WORD(0xe180f23842f23957),
+	WORD(0x69c4112c254e2609), WORD(0x92c0ca817605cefd),
+	WORD(0x58ab960371a0957c), WORD(0x5fc7949a2e0a167d),
+	/* 61G */
+	WORD(0x73a4017ceb210b74), WORD(0x8073cb26e3a2635d),
+	WORD(0x9c6c5680f3ca7a10), WORD(0x8d8094c79c897139),
+	WORD(0x3ee95508a5f8d242), WORD(0x22e83bdd31dbfea8),
+	WORD(0x4167a61bac69ed4f), WORD(0xd3e6e6bf495d8472),
+	WORD(0x607937f91c9d7fc2), WORD(0x7e159da5055a61eb),
+	WORD(0x884ed86add78fa99), WORD(0x38e88473494e0691),
+	/* 63G */
+	WORD(0xdd41c4d99d0c1ff1), WORD(0xd7e47365b3a9ec4b),
+	WORD(0x3e0f174e1744b3be), WORD(0xa51fe15bca50d64b),
+	WORD(0x03f5354345866552), WORD(0x144cb570a94f4232),
+	WORD(0xa3dfdd557f2c5709), WORD(0x191c6239ad561bd0),
+	WORD(0xbfcb768e34da1186), WORD(0x3bbbc21723377926),
+	WORD(0x9e3ab5d856fbfc9f), WORD(0x340f707817fffd7c),
+};
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+static const word_t brainpoolp384r1_gen_wnaf[] = {
+	/* G */
+	WORD(0xd438fbc1), WORD(0xa189deeb), WORD(0xd5a886bf), WORD(0x66fc80e8),
+	WORD(0x9d202f23), WORD(0x94c378e9), WORD(0xf95c2164), WORD(0x068b264e),
+	WORD(0xbacd0099), WORD(0x9cdd0dcf), WORD(0x88f53fc1), WORD(0x85007533),
+	WORD(0x0de140a5), WORD(0xe738b331), WORD(0xc7996f55), WORD(0xf5e0d246),
+	WORD(0x8f0737fc), WORD(0xf88309a3), WORD(0xd5719217), WORD(0xa180acd4),
+	WORD(0x4f21ddb6), WORD(0xc6162566), WORD(0x458968b5), WORD(0x2cf4a062),
+	/* 3G */
+	WORD(0xce7d7224), WORD(0x2e87b6b5), WORD(0x5a72461a), WORD(0xad2c4af7),
+	WORD(0x2ced5d1d), WORD(0x3a565681), WORD(0x6d3d9c10), WORD(0xc7e3c855),
+	WORD(0x7f326e2f), WORD(0x93e8454e), WORD(0x7606782a), WORD(0x4bd131bd),
+	WORD(0x576498af), WORD(0x744eeef4), WORD(0x7dd5d130), WORD(0x463253b5),
+	WORD(0xddfd1d1d), WORD(0x148579c7), WORD(0x94ab2f14), WORD(0x1c61f513),
+	WORD(0x9fe98583), WORD(0x6d85b8ee), WORD(0x6abef61d), WORD(0x42b06ef3),
+	/* 5G */
+	WORD(0xd8ce9c49), WORD(0xb41f442a), WORD(0xf2c28de5), WORD(0x74989913),
+	WORD(0xc0e32761), WORD(0x3ccf2b6e), WORD(0xc78ef5b1), WORD(0xa4bc3eec),
+	WORD(0x7106ddb6), WORD(0xf1764207), WORD(0xa3a80cfc), WORD(0x01ef19cb),
+	WORD(0x92d1018d), WORD(0xdeb8cd3c), WORD(0xe0af7013), WORD(0xbc9bba0e),
+	WORD(0xf6e97434), WORD(0xb31eadb3), WORD(0x8101041f), WORD(0xdff2df91),
+	WORD(0x30cacb07), WORD(0xa14e0103), WORD(0xca03a002), WORD(0x40db7c90),
+	/* 7G */
+	WORD(0xf6835c16), WORD(0x768422bf), WORD(0x88742837), WORD(0xd4d9a168),
+	WORD(0x5a8fa33a), WORD(0x5f0d3ec2), WORD(0x2661924d), WORD(0x0cc3ed0b),
+	WORD(0xa9902452), WORD(0x98857089), WORD(0xa48e18bd), WORD(0x091be5a4),
+	WORD(0x17ef7556), WORD(0x04b8bd37), WORD(0x002db12e), WORD(0x1dad241b),
+	WORD(0xa0566f74), WORD(0x099ca996), WORD(0x2c5117aa), WORD(0x077aa1f3),
+	WORD(0x165a0713), WORD(0x1830b286), WORD(0x93701b12), WORD(0x48116bda),
+	/* 9G */
+	WORD(0x923440de), WORD(0x0066aa18), WORD(0x3364d7d5), WORD(0xa3b775c6),
+	WORD(0x27c58e01), WORD(0xcbc1a124), WORD(0x83d2dff0), WORD(0xac2ad5a5),
+	WORD(0x43620769), WORD(0x39d8efce), WORD(0xa6501595), WORD(0x8802607d),
+	WORD(0x7e3b2101), WORD(0xa2aa414b), WORD(0xf0597f95), WORD(0xe7cd4887),
+	WORD(0x9dc8df84), WORD(0x392d8a2c), WORD(0xa93a3ada), WORD(0xedd53d57),
+	WORD(0x8ae63e94), WORD(0x8b57c36c), WORD(0xb31a5c75), WORD(0x80c18d38),
+	/* 11G */
+	WORD(0xedb12cd2), WORD(0xf9cd0728), WORD(0xdffddb84), WORD(0x6eaca41b),
+	WORD(0xbf3e8831), WORD(0x79f5c417), WORD(0xc798afce), WORD(0x119e9f8d),
+	WORD(0x9111fe9e), WORD(0x528a6f85), WORD(0xbee8180c), WORD(0x21d8ef4e),
+	WORD(0xdcaff317), WORD(0x75362a33), WORD(0xaf3c4ff7), WORD(0x023e4bb8),
+	WORD(0x74aaf7ae), WORD(0x3b5e01b4), WORD(0xcb04ef2b), WORD(0xf321ef25),
+	WORD(0x9e886c70), WORD(0x5c226858), WORD(0x03941651), WORD(0x2528faa0),
+	/* 13G */
+	WORD(0xb89357cc), WORD(0x3b6a1968), WORD(0xb7232c2e), WORD(0xbe74477b),
+	WORD(0x80b79318), WORD(0xa76e871e), WORD(0xd49cb174), WORD(0xc9c1678e),
+	WORD(0x8168c1b7), WORD(0x1f139b23), WORD(0xa145267a), WORD(0x850e6136),
+	WORD(0xda4e01a2), WORD(0xf62495c5), WORD(0x16389a64), WORD(0xd38b4f01),
+	WORD(0x30dc4590), WORD(0xa7d34785), WORD(0x1e8e8f55), WORD(0x61706749),
+	WORD(0xb83eda1b), WORD(0xe40157b1), WORD(0x32e2ebb2), WORD(0x546e48bc),
+	/* 15G */
+	WORD(0xa216bcfe), WORD(0xcf37576f), WORD(0x38c71258), WORD(0xf0b77263),
+	WORD(0x268e074c), WORD(0x14f5e71a), WORD(0x578c607e), WORD(0xf06395a1),
+	WORD(0x92dcb441), WORD(0x351c8100), WORD(0x7724cb80), WORD(0x09d85c45),
+	WORD(0x3a3ab69a), WORD(0xd3ac3867), WORD(0x44ce2e34), WORD(0x2cf4d2e5),
+	WORD(0x956c6dee), WORD(0xeb2ea010), WORD(0x04ac5a40), WORD(0x784c963e),
+	WORD(0xe553ff54), WORD(0xd0de76aa), WORD(0x0c7df359), WORD(0x0f5e7fee),
+	/* 17G */
+	WORD(0x26642091), WORD(0x9b987fa8), WORD(0x956e01f9), WORD(0x2998f9f7),
+	WORD(0x39c9d012), WORD(0x3a5f27d1), WORD(0xdb13b227), WORD(0xb0d1bb99),
+	WORD(0x5ecffc23), WORD(0xbe72b18f), WORD(0x01820a55), WORD(0x26081905),
+	WORD(0x319b7954), WORD(0x1702f527), WORD(0x87e36107), WORD(0x6b100870),
+	WORD(0xb5f73e3c), WORD(0xc3908198), WORD(0x9d16a93a), WORD(0xb4ccc0ca),
+	WORD(0xa547b486), WORD(0xf26bf177), WORD(0x9019bec3), WORD(0x2f9361c1),
+	/* 19G */
+	WORD(0xd0c35a70), WORD(0xa9a7fe16), WORD(0x3b3ab2cc), WORD(0x87a18300),
+	WORD(0xbaf327ca), WORD(0xd0289819), WORD(0x7a132366), WORD(0x3e1219c7),
+	WORD(0xae86cdad), WORD(0x9b684c7c), WORD(0x3c474ea0), WORD(0x4931be16),
+	WORD(0x52e48066), WORD(0x591c6ee8), WORD(0x57981b70), WORD(0xb6ee45e2),
+	WORD(0xd576ebc0), WORD(0x98345453), WORD(0x95e7824f), WORD(0x3a1b2234),
+	WORD(0x97062328), WORD(0xa86cfd02), WORD(0xeca9631e), WORD(0x0fc7a992),
+	/* 21G */
+	WORD(0xc3639a4f), WORD(0xdfdd0d1c), WORD(0xd3bf79e4), WORD(0x07137489),
+	WORD(0xf8793c9f), WORD(0xbdf8bb0b), WORD(0xb0cc5765), WORD(0xb248ba22),
+	WORD(0x18cec1d1), WORD(0xe7b8bb96), WORD(0x3481431c), WORD(0x76235aad),
+	WORD(0x8e4869ce), WORD(0x885e1dc3), WORD(0x16fe4753), WORD(0x1761bd34),
+	WORD(0x6e96653d), WORD(0xcd996c0e), WORD(0x62734c54), WORD(0x35b2bfd0),
+	WORD(0xca11dec9), WORD(0x32d1e454), WORD(0x83971184), WORD(0x71840f94),
+	/* 23G */
+	WORD(0xc5fb226b), WORD(0xbb5d1a40), WORD(0xb32998f9), WORD(0x36e8f8d6),
+	WORD(0x2665bb92), WORD(0x9d655e70), WORD(0x7fbfaf39), WORD(0x96eb0f25),
+	WORD(0x30019d53), WORD(0xa4fb9334), WORD(0x34deabab), WORD(0x706691b3),
+	WORD(0x02668ee1), WORD(0x798354f3), WORD(0xcfee1393), WORD(0x2b500a07),
+	WORD(0x50c76533), WORD(0xf58fe3dc), WORD(0xb6022fbc), WORD(0xa1dff4c4),
+	WORD(0xb8160ad8), WORD(0xd48fdd60), WORD(0x3f90d1de), WORD(0x4303ddbb),
+	/* 25G */
+	WORD(0x485839b0), WORD(0xa4d06ac5), WORD(0x2fdb835a), WORD(0x8a70b93a),
+	WORD(0xe42e23ef), WORD(0x05f26bf1), WORD(0x9d4c2c4b), WORD(0xaab0992a),
+	WORD(0xf591eeb4), WORD(0x148a0ab7), WORD(0xe57bf322), WORD(0x6489356d),
+	WORD(0x9df3f403), WORD(0x7766e4d5), WORD(0x2a342484), WORD(0xcecb18ac),
+	WORD(0x1f31ba09), WORD(0x3b0250c1), WORD(0xce530fad), WORD(0xeaca0655),
+	WORD(0x542e0df0), WORD(0x0c477e90), WORD(0x6400cdf1), WORD(0x6687dad2),
+	/* 27G */
+	WORD(0x4b25279e), WORD(0x85c721a1), WORD(0xfa415463), WORD(0xd489f9d0),
+	WORD(0x10c3542c), WORD(0x0423ddf5), WORD(0xd528ac78), WORD(0x109624a9),
+	WORD(0xb79417ad), WORD(0x9bfbc530), WORD(0xd4af6102), WORD(0x08edc385),
+	WORD(0x1e52029a), WORD(0x63f67913), WORD(0x6f5992e8), WORD(0xc965510b),
+	WORD(0x24ba8a16), WORD(0x36715858), WORD(0x95675d9e), WORD(0x74508dba),
+	WORD(0xeca4e50f), WORD(0xcd1b8842), WORD(0xb3791661), WORD(0x4787c5bf),
+	/* 29G */
+	WORD(0x2eb516de), WORD(0x0a9be690), WORD(0xd44b3ef2), WORD(0x39517cd7),
+	WORD(0xf120b877), WORD(0x48764dbb), WORD(0xce43cb90), WORD(0x13ce4f95),
+	WORD(0x14be271e), WORD(0x51c6f0ce), WORD(0x4395c025), WORD(0x6d886ef5),
+	WORD(0x1896a9f3), WORD(0xf9a76c6a), WORD(0x25185555), WORD(0xeb1cf2ee),
+	WORD(0x9b75f3f2), WORD(0x5fb5cf02), WORD(0x800665ee), WORD(0x07b10155),
+	WORD(0x4ce8d13b), WORD(0x7357b373), WORD(0x53d5871b), WORD(0x6de8ed1f),
+	/* 31G */
+	WORD(0xab74a3b8), WORD(0x1d17f7da), WORD(0x5e5dff09), WORD(0x1fbd1083),
+	WORD(0x71e53185), WORD(0xd52cb03a), WORD(0xf37db9ab), WORD(0xf5f52d7b),
+	WORD(0x652bd75d), WORD(0x961567bd), WORD(0x0aefc05e), WORD(0x885a2ddf),
+	WORD(0xe6e49f6d), WORD(0xf83e945c), WORD(0x28e7476c), WORD(0x87f407e1),
+	WORD(0x92ce937e), WORD(0x0be6a186), WORD(0x75b114c7), WORD(0xa378cec9),
+	WORD(0x4358a9a9), WORD(0x97878d69), WORD(0xc581aba5), WORD(0x06f7f4ac),
+	/* 33G */
+	WORD(0x5942b6ce), WORD(0x936c8c82), WORD(0xa78b7b67), WORD(0x0439ebb0),
+	WORD(0x9c8f961e), WORD(0xfd34928d), WORD(0xead100aa), WORD(0x7c6c6b1f),
+	WORD(0x6d90f520), WORD(0xe50a45b5), WORD(0x92c270e9), WORD(0x1d94bcfe),
+	WORD(0xac6522c2), WORD(0x864ffce1), WORD(0x0b75ebf3), WORD(0x8265aa45),
+	WORD(0xa0e8a3a8), WORD(0x53220586), WORD(0x15a114f0), WORD(0x6fa6ec60),
+	WORD(0x1ea8b048), WORD(0x7739f6de), WORD(0xff655b6e), WORD(0x5d8e8dec),
+	/* 35G */
+	WORD(0x8fcc55f6), WORD(0x3e366193), WORD(0xb59e0ef0), WORD(0x83d32ffc),
+	WORD(0xc72026af), WORD(0x04a507c8), WORD(0xa9dc6633), WORD(0x9ec77692),
+	WORD(0xf6483bfa), WORD(0xc9e2e46a), WORD(0xb3698bb0), WORD(0x0b28bd9f),
+	WORD(0x5c463d91), WORD(0x5f490468), WORD(0xc19946ff), WORD(0x0f7cfd23),
+	WORD(0x8465360b), WORD(0x713e6733), WORD(0xe8d4673f), WORD(0xadd4b6c6),
+	WORD(0xfbced3b5), WORD(0x0f82929a), WORD(0x5d03850d), WORD(0x404f047b),
+	/* 37G */
+	WORD(0x93af73d9), WORD(0x21a73ecd), WORD(0x77d01aaf), WORD(0x469f410e),
+	WORD(0xeb4eebcc), WORD(0x0eae649c), WORD(0xa821bbf8), WORD(0x8d9f9e0f),
+	WORD(0x10d831ac), WORD(0x1374f8cb), WORD(0x608a16b5), WORD(0x8c60d25c),
+	WORD(0xaba7d415), WORD(0xd45d518d), WORD(0xf93225ee), WORD(0xa431583c),
+	WORD(0xcd024a85), WORD(0x47e2a67e), WORD(0xf5602b2a), WORD(0x26bb09a4),
+	WORD(0x34dc37a9), WORD(0xc14eba95), WORD(0x01305670), WORD(0x7baa536f),
+	/* 39G */
+	WORD(0xbeeaaa78), WORD(0x0269b08e), WORD(0xe4cd1c2b), WORD(0xc3f84406),
+	WORD(0xd3a909f6), WORD(0xeb4577fa), WORD(0x97c17397), WORD(0x071634da),
+	WORD(0x7b822a4d), WORD(0x3cbef3ed), WORD(0x941bfa59), WORD(0x2b07a47f),
+	WORD(0x6b65d48c), WORD(0xa8f66b92), WORD(0x761e2508), WORD(0x3c4856d2),
+	WORD(0xd3d60d4b), WORD(0x5b48708e), WORD(0xe6e77020), WORD(0x29e551fb),
+	WORD(0x0a09530b), WORD(0xa9ae0596), WORD(0x649403e8), WORD(0x40a53a87),
+	/* 41G */
+	WORD(0x3688a101), WORD(0x302cf2ac), WORD(0x3ddbc78b), WORD(0xc1337e5a),
+	WORD(0x8697dc5b), WORD(0x51133670), WORD(0x26e7bbab), WORD(0x1086da68),
+	WORD(0x170c1a9f), WORD(0x6d12ccbd), WORD(0x5aca9925), WORD(0x6e815600),
+	WORD(0x1874f9f4), WORD(0x3d65572e), WORD(0x1bfa10cd), WORD(0x7586baff),
+	WORD(0x68056a14), WORD(0x815564ec), WORD(0x57cb4de4), WORD(0xf1259cb6),
+	WORD(0x7df7a75d), WORD(0xa15b5ff0), WORD(0x2a6cf4de), WORD(0x27cb8d4f),
+	/* 43G */
+	WORD(0x95869f4e), WORD(0xfb763bec), WORD(0x3515d350), WORD(0x0dac06c5),
+	WORD(0x81c18704), WORD(0x24aafd67), WORD(0x56a8629b), WORD(0xc96f176e),
+	WORD(0x35427dc8), WORD(0x3c5a7bf4), WORD(0x9a1d0713), WORD(0x23c40f1a),
+	WORD(0x4e5e1c54), WORD(0xe02ef22f), WORD(0x29943efd), WORD(0x74c4ff06),
+	WORD(0xcaeccf96), WORD(0xdda12e48), WORD(0x80b8d82a), WORD(0x6e01e10f),
+	WORD(0x1f2421c6), WORD(0xeb7b77a8), WORD(0x3621daee), WORD(0x268ac18c),
+	/* 45G */
+	WORD(0x8a2a483a), WORD(0xecb8f40a), WORD(0x6ee8d716), WORD(0xbd841293),
+	WORD(0x06cbb4f1), WORD(0xcf0a340e), WORD(0xe1557de1), WORD(0x39a97d21),
+	WORD(0xe637e23a), WORD(0x4eb58e59), WORD(0xe8b4945d), WORD(0x44590d7a),
+	WORD(0x88bedcc9), WORD(0xecf08e86), WORD(0x40f30fa3), WORD(0x37be99f7),
+	WORD(0xda269945), WORD(0x709fe684), WORD(0x1aff1b94), WORD(0xc2f50bdd),
+	WORD(0x584e2712), WORD(0x9d946608), WORD(0x26f5da63), WORD(0x342b813a),
+	/* 47G */
+	WORD(0x4680a1f8), WORD(0x62f6a26d), WORD(0x0e6edc98), WORD(0xbe4276ef),
+	WORD(0x0da5639b), WORD(0xc1e2e879), WORD(0x72dcc6ea), WORD(0x8452a0be),
+	WORD(0xcbea6dfe), WORD(0x05c2a6f5), WORD(0x9a1aaf56), WORD(0x3a555749),
+	WORD(0xd2c71e6e), WORD(0xc7ea8266), WORD(0x9888e481), WORD(0x17861e70),
+	WORD(0x527b8025), WORD(0xa9821530), WORD(0xde9a2619), WORD(0xff4383f3),
+	WORD(0x086818b8), WORD(0x0d55bd61), WORD(0xde971668), WORD(0x2acd63ff),
+	/* 49G */
+	WORD(0x95399b1a), WORD(0x7038a449), WORD(0x36d10a29), WORD(0x05486c7b),
+	WORD(0xae38126d), WORD(0x6bbcef6b), WORD(0xf81ed677), WORD(0x6795d541),
+	WORD(0x6aa3406e), WORD(0x3931edc4), WORD(0x97d659c3), WORD(0x528a1f52),
+	WORD(0xc4ca48c2), WORD(0xc93bb4f4), WORD(0x1d6589c2), WORD(0x4820c135),
+	WORD(0xd598ba24), WORD(0xf7baaa27), WORD(0xe52076b2), WORD(0xb1838232),
+	WORD(0x01a43aac), WORD(0xd97ccf75), WORD(0xfd819bb4), WORD(0x01ba62b3),
+	/* 51G */
+	WORD(0xddc9637e), WORD(0xcf5602bd), WORD(0x42bcab9d), WORD(0xb821f0bb),
+	WORD(0x71bd5ba2), WORD(0xdc0de6ae), WORD(0x689e3fd3), WORD(0x20792635),
+	WORD(0xcf61423f), WORD(0x88b4ccbb), WORD(0xfd7ccdce), WORD(0x8486d0dc),
+	WORD(0x1feaf619), WORD(0xf7a4edfd), WORD(0x5c9e28db), WORD(0x7a3fe512),
+	WORD(0xa8f15a0c), WORD(0x9077144c), WORD(0x987420b1), WORD(0x66bcfd2c),
+	WORD(0x78e84a92), WORD(0x5d826d85), WORD(0xb31c371e), WORD(0x477d4f33),
+	/* 53G */
+	WORD(0xa91c39bf), WORD(0x3768343b), WORD(0x41e79ca0), WORD(0xb6ffbc84),
+	WORD(0x6df885f9), WORD(0x3c7e2ce8), WORD(0x78ee37db), WORD(0xdb943527),
+	WORD(0xb84aa744), WORD(0x281e5a07), WORD(0x67fc1992), WORD(0x3c601353),
+	WORD(0x0d6d4ab3), WORD(0x89eb6aec), WORD(0x5aef5074), WORD(0x9ef7c3b8),
+	WORD(0xd0944a8d), WORD(0xa5a84b32), WORD(0xb91626e8), WORD(0xd52eba1a),
+	WORD(0x2f543f29), WORD(0xb616f0da), WORD(0xe9195b51), WORD(0x636b3a7e),
+	/* 55G */
+	WORD(0x067003d3), WORD(0xa46e61f6), WORD(0x20534a46), WORD(0x10ee43f1),
+	WORD(0x4d8e7427), WORD(0x791318f8), WORD(0xbd472168), WORD(0x7b0e0562),
+	WORD(0x605aff2e), WORD(0xf7e1060d), WORD(0x5fdfab45), WORD(0x4140f685),
+	WORD(0x1a61c437), WORD(0xbd618e08), WORD(0xb0284922), WORD(0x71b978a3),
+	WORD(0x41cdb612), WORD(0x67810884), WORD(0xc6a1161f), WORD(0x2e2b83ff),
+	WORD(0x707002d1), WORD(0x880eee4f), WORD(0xeefa9b6c), WORD(0x5f150ba2),
+	/* 57G */
+	WORD(0xbc6fcf55), WORD(0xd0aae6d9), WORD(0x956d15b9), WORD(0x4c75280e),
+	WORD(0xe75f76b8), WORD(0xe69dbe59), WORD(0x043342b8), WORD(0x91da59e6),
+	WORD(0x4aa258a5), WORD(0x6e5a4d90), WORD(0x83503c8a), WORD(0x15e7720b),
+	WORD(0x7f6b5802), WORD(0xa88cb3e6), WORD(0xbd8b4214), WORD(0x6063c135),
+	WORD(0x713d176d), WORD(0xfeb6a4f1), WORD(0x88aa65e1), WORD(0x1d49cb52),
+	WORD(0x373ba239), WORD(0x9127cba1), WORD(0x02d673e1), WORD(0x5601adac),
+	/* 59G */
+	WORD(0x424a01d7), WORD(0xc2bef0bd), WORD(0x333ada1f), WORD(0xe03045b6),
+	WORD(0xadda578c), WORD(0xe1d87309), WORD(0xc25ae4fb), WORD(0x0db7b14f),
+	WORD(0xf581766d), WORD(0x29d792b7), WORD(0x42cc1333), WORD(0x77b7a240),
+	WORD(0xab9d15e1), WORD(0x1b88fbf2), WORD(0x42f23957), WORD(0xe180f238),
+	WORD(0x254e2609), WORD(0x69c4112c), WORD(0x7605cefd), WORD(0x92c0ca81),
+	WORD(0x71a0957c), WORD(0x58ab9603), WORD(0x2e0a167d), WORD(0x5fc7949a),
+	/* 61G */
+	WORD(0xeb210b74), WORD(0x73a4017c), WORD(0xe3a2635d), WORD(0x8073cb26),
+	WORD(0xf3ca7a10), WORD(0x9c6c5680), WORD(0x9c897139), WORD(0x8d8094c7),
+	WORD(0xa5f8d242), WORD(0x3ee95508), WORD(0x31dbfea8), WORD(0x22e83bdd),
+	WORD(0xac69ed4f), WORD(0x4167a61b), WORD(0x495d8472), WORD(0xd3e6e6bf),
+	WORD(0x1c9d7fc2), WORD(0x607937f9), WORD(0x055a61eb), WORD(0x7e159da5),
+	WORD(0xdd78fa99), WORD(0x884ed86a), WORD(0x494e0691), WORD(0x38e88473),
+	/* 63G */
+	WORD(0x9d0c1ff1), WORD(0xdd41c4d9), WORD(0xb3a9ec4b), WORD(0xd7e47365),
+	WORD(0x1744b3be), WORD(0x3e0f174e), WORD(0xca50d64b), WORD(0xa51fe15b),
+	WORD(0x45866552), WORD(0x03f53543), WORD(0xa94f4232), WORD(0x144cb570),
+	WORD(0x7f2c5709), WORD(0xa3dfdd55), WORD(0xad561bd0), WORD(0x191c6239),
+	WORD(0x34da1186), WORD(0xbfcb768e), WORD(0x23377926), WORD(0x3bbbc217),
+	WORD(0x56fbfc9f), WORD(0x9e3ab5d8), WORD(0x17fffd7c), WORD(0x340f7078),
+};
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+static const word_t brainpoolp384r1_gen_wnaf[] = {
+	/* G */
+	WORD(0xfbc1), WORD(0xd438), WORD(0xdeeb), WORD(0xa189), WORD(0x86bf), WORD(0xd5a8),
+	WORD(0x80e8), WORD(0x66fc), WORD(0x2f23), WORD(0x9d20), WORD(0x78e9), WORD(0x94c3),
+	WORD(0x2164), WORD(0xf95c), WORD(0x264e), WORD(0x068b), WORD(0x0099), WORD(0xbacd),
+	WORD(0x0dcf), WORD(0x9cdd), WORD(0x3fc1), WORD(0x88f5), WORD(0x7533), WORD(0x8500),
+	WORD(0x40a5), WORD(0x0de1), WORD(0xb331), WORD(0xe738), WORD(0x6f55), WORD(0xc799),
+	WORD(0xd246), WORD(0xf5e0), WORD(0x37fc), WORD(0x8f07), WORD(0x09a3), WORD(0xf883),
+	WORD(0x9217), WORD(0xd571), WORD(0xacd4), WORD(0xa180), WORD(0xddb6), WORD(0x4f21),
+	WORD(0x2566), WORD(0xc616), WORD(0x68b5), WORD(0x4589), WORD(0xa062), WORD(0x2cf4),
+	/* 3G */
+	WORD(0x7224), WORD(0xce7d), WORD(0xb6b5), WORD(0x2e87), WORD(0x461a), WORD(0x5a72),
+	WORD(0x4af7), WORD(0xad2c), WORD(0x5d1d), WORD(0x2ced), WORD(0x5681), WORD(0x3a56),
+	WORD(0x9c10), WORD(0x6d3d), WORD(0xc855), WORD(0xc7e3), WORD(0x6e2f), WORD(0x7f32),
+	WORD(0x454e), WORD(0x93e8), WORD(0x782a), WORD(0x7606), WORD(0x31bd), WORD(0x4bd1),
+	WORD(0x98af), WORD(0x5764), WORD(0xeef4), WORD(0x744e), WORD(0xd130), WORD(0x7dd5),
+	WORD(0x53b5), WORD(0x4632), WORD(0x1d1d), WORD(0xddfd), WORD(0x79c7), WORD(0x1485),
+	WORD(0x2f14), WORD(0x94ab), WORD(0xf513), WORD(0x1c61), WORD(0x8583), WORD(0x9fe9),
+	WORD(0xb8ee), WORD(0x6d85), WORD(0xf61d), WORD(0x6abe), WORD(0x6ef3), WORD(0x42b0),
+	/* 5G */
+	WORD(0x9c49), WORD(0xd8ce), WORD(0x442a), WORD(0xb41f), WORD(0x8de5), WORD(0xf2c2),
+	WORD(0x9913), WORD(0x7498), WORD(0x2761), WORD(0xc0e3), WORD(0x2b6e), WORD(0x3ccf),
+	WORD(0xf5b1), WORD(0xc78e), WORD(0x3eec), WORD(0xa4bc), WORD(0xddb6), WORD(0x7106),
+	WORD(0x4207), WORD(0xf176), WORD(0x0cfc), WORD(0xa3a8), WORD(0x19cb), WORD(0x01ef),
+	WORD(0x018d), WORD(0x92d1), WORD(0xcd3c), WORD(0xdeb8), WORD(0x7013), WORD(0xe0af),
+	WORD(0xba0e), WORD(0xbc9b), WORD(0x7434), WORD(0xf6e9), WORD(0xadb3), WORD(0xb31e),
+	WORD(0x041f), WORD(0x8101), WORD(0xdf91), WORD(0xdff2), WORD(0xcb07), WORD(0x30ca),
+	WORD(0x0103), WORD(0xa14e), WORD(0xa002), WORD(0xca03), WORD(0x7c90), WORD(0x40db),
+	/* 7G */
+	WORD(0x5c16), WORD(0xf683), WORD(0x22bf), WORD(0x7684), WORD(0x2837), WORD(0x8874),
+	WORD(0xa168), WORD(0xd4d9), WORD(0xa33a), WORD(0x5a8f), WORD(0x3ec2), WORD(0x5f0d),
+	WORD(0x924d), WORD(0x2661), WORD(0xed0b), WORD(0x0cc3), WORD(0x2452), WORD(0xa990),
+	WORD(0x7089), WORD(0x9885), WORD(0x18bd), WORD(0xa48e), WORD(0xe5a4), WORD(0x091b),
+	WORD(0x7556), WORD(0x17ef), WORD(0xbd37), WORD(0x04b8), WORD(0xb12e), WORD(0x002d),
+	WORD(0x241b), WORD(0x1dad), WORD(0x6f74), WORD(0xa056), WORD(0xa996), WORD(0x099c),
+	WORD(0x17aa), WORD(0x2c51), WORD(0xa1f3), WORD(0x077a), WORD(0x0713), WORD(0x165a),
+	WORD(0xb286), WORD(0x1830), WORD(0x1b12), WORD(0x9370), WORD(0x6bda), WORD(0x4811),
+	/* 9G */
+	WORD(0x40de), WORD(0x9234), WORD(0xaa18), WORD(0x0066), WORD(0xd7d5), WORD(0x3364),
+	WORD(0x75c6), WORD(0xa3b7), WORD(0x8e01), WORD(0x27c5), WORD(0xa124), WORD(0xcbc1),
+	WORD(0xdff0), WORD(0x83d2), WORD(0xd5a5), WORD(0xac2a), WORD(0x0769), WORD(0x4362),
+	WORD(0xefce), WORD(0x39d8), WORD(0x1595), WORD(0xa650), WORD(0x607d), WORD(0x8802),
+	WORD(0x2101), WORD(0x7e3b), WORD(0x414b), WORD(0xa2aa), WORD(0x7f95), WORD(0xf059),
+	WORD(0x4887), WORD(0xe7cd), WORD(0xdf84), WORD(0x9dc8), WORD(0x8a2c), WORD(0x392d),
+	WORD(0x3ada), WORD(0xa93a), WORD(0x3d57), WORD(0xedd5), WORD(0x3e94), WORD(0x8ae6),
+	WORD(0xc36c), WORD(0x8b57), WORD(0x5c75), WORD(0xb31a), WORD(0x8d38), WORD(0x80c1),
+	/* 11G */
+	WORD(0x2cd2), WORD(0xedb1), WORD(0x0728), WORD(0xf9cd), WORD(0xdb84), WORD(0xdffd),
+	WORD(0xa41b), WORD(0x6eac), WORD(0x8831), WORD(0xbf3e), WORD(0xc417), WORD(0x79f5),
+	WORD(0xafce), WORD(0xc798), WORD(0x9f8d), WORD(0x119e), WORD(0xfe9e), WORD(0x9111),
+	WORD(0x6f85), WORD(0x528a), WORD(0x180c), WORD(0xbee8), WORD(0xef4e), WORD(0x21d8),
+	WORD(0xf317), WORD(0xdcaf), WORD(0x2a33), WORD(0x7536), WORD(0x4ff7), WORD(0xaf3c),
+	WORD(0x4bb8), WORD(0x023e), WORD(0xf7ae), WORD(0x74aa), WORD(0x01b4), WORD(0x3b5e),
+	WORD(0xef2b), WORD(0xcb04), WORD(0xef25), WORD(0xf321), WORD(0x6c70), WORD(0x9e88),
+	WORD(0x6858), WORD(0x5c22), WORD(0x1651), WORD(0x0394), WORD(0xfaa0), WORD(0x2528),
+	/* 13G */
+	WORD(0x57cc), WORD(0xb893), WORD(0x1968), WORD(0x3b6a), WORD(0x2c2e), WORD(0xb723),
+	WORD(0x477b), WORD(0xbe74), WORD(0x9318), WORD(0x80b7), WORD(0x871e), WORD(0xa76e),
+	WORD(0xb174), WORD(0xd49c), WORD(0x678e), WORD(0xc9c1), WORD(0xc1b7), WORD(0x8168),
+	WORD(0x9b23), WORD(0x1f13), WORD(0x267a), WORD(0xa145), WORD(0x6136), WORD(0x850e),
+	WORD(0x01a2), WORD(0xda4e), WORD(0x95c5), WORD(0xf624), WORD(0x9a64), WORD(0x1638),
+	WORD(0x4f01), WORD(0xd38b), WORD(0x4590), WORD(0x30dc), WORD(0x4785), WORD(0xa7d3),
+	WORD(0x8f55), WORD(0x1e8e), WORD(0x6749), WORD(0x6170), WORD(0xda1b), WORD(0xb83e),
+	WORD(0x57b1), WORD(0xe401), WORD(0xebb2), WORD(0x32e2), WORD(0x48bc), WORD(0x546e),
+	/* 15G */
+	WORD(0xbcfe), WORD(0xa216), WORD(0x576f), WORD(0xcf37), WORD(0x1258), WORD(0x38c7),
+	WORD(0x7263), WORD(0xf0b7), WORD(0x074c), WORD(0x268e), WORD(0xe71a), WORD(0x14f5),
+	WORD(0x607e), WORD(0x578c), WORD(0x95a1), WORD(0xf063), WORD(0xb441), WORD(0x92dc),
+	WORD(0x8100), WORD(0x351c), WORD(0xcb80), WORD(0x7724), WORD(0x5c45), WORD(0x09d8),
+	WORD(0xb69a), WORD(0x3a3a), WORD(0x3867), WORD(0xd3ac), WORD(0x2e34), WORD(0x44ce),
+	WORD(0xd2e5), WORD(0x2cf4), WORD(0x6dee), WORD(0x956c), WORD(0xa010), WORD(0xeb2e),
+	WORD(0x5a40), WORD(0x04ac), WORD(0x963e), WORD(0x784c), WORD(0xff54), WORD(0xe553),
+	WORD(0x76aa), WORD(0xd0de), WORD(0xf359), WORD(0x0c7d), WORD(0x7fee), WORD(0x0f5e),
+	/* 17G */
+	WORD(0x2091), WORD(0x2664), WORD(0x7fa8), WORD(0x9b98), WORD(0x01f9), WORD(0x956e),
+	WORD(0xf9f7), WORD(0x2998), WORD(0xd012), WORD(0x39c9), WORD(0x27d1), WORD(0x3a5f),
+	WORD(0xb227), WORD(0xdb13), WORD(0xbb99), WORD(0xb0d1), WORD(0xfc23), WORD(0x5ecf),
+	WORD(0xb18f), WORD(0xbe72), WORD(0x0a55), WORD(0x0182), WORD(0x1905), WORD(0x2608),
+	WORD(0x7954), WORD(0x319b), WORD(0xf527), WORD(0x1702), WORD(0x6107), WORD(0x87e3),
+	WORD(0x0870), WORD(0x6b10), WORD(0x3e3c), WORD(0xb5f7), WORD(0x8198), WORD(0xc390),
+	WORD(0xa93a), WORD(0x9d16), WORD(0xc0ca), WORD(0xb4cc), WORD(0xb486), WORD(0xa547),
+	WORD(0xf177), WORD(0xf26b), WORD(0xbec3), WORD(0x9019), WORD(0x61c1), WORD(0x2f93),
+	/* 19G */
+	WORD(0x5a70), WORD(0xd0c3), WORD(0xfe16), WORD(0xa9a7), WORD(0xb2cc), WORD(0x3b3a),
+	WORD(0x8300), WORD(0x87a1), WORD(0x27ca), WORD(0xbaf3), WORD(0x9819), WORD(0xd028),
+	WORD(0x2366), WORD(0x7a13), WORD(0x19c7), WORD(0x3e12), WORD(0xcdad), WORD(0xae86),
+	WORD(0x4c7c), WORD(0x9b68), WORD(0x4ea0), WORD(0x3c47), WORD(0xbe16), WORD(0x4931),
+	WORD(0x8066), WORD(0x52e4), WORD(0x6ee8), WORD(0x591c), WORD(0x1b70), WORD(0x5798),
+	WORD(0x45e2), WORD(0xb6ee), WORD(0xebc0), WORD(0xd576), WORD(0x5453), WORD(0x9834),
+	WORD(0x824f), WORD(0x95e7), WORD(0x2234), WORD(0x3a1b), WORD(0x2328), WORD(0x9706),
+	WORD(0xfd02), WORD(0xa86c), WORD(0x631e), WORD(0xeca9), WORD(0xa992), WORD(0x0fc7),
+	/* 21G */
+	WORD(0x9a4f), WORD(0xc363), WORD(0x0d1c), WORD(0xdfdd), WORD(0x79e4), WORD(0xd3bf),
+	WORD(0x7489), WORD(0x0713), WORD(0x3c9f), WORD(0xf879), WORD(0xbb0b), WORD(0xbdf8),
+	WORD(0x5765), WORD(0xb0cc), WORD(0xba22), WORD(0xb248), WORD(0xc1d1), WORD(0x18ce),
+	WORD(0xbb96), WORD(0xe7b8), WORD(0x431c), WORD(0x3481), WORD(0x5aad), WORD(0x7623),
+	WORD(0x69ce), WORD(0x8e48), WORD(0x1dc3), WORD(0x885e), WORD(0x4753), WORD(0x16fe),
+	WORD(0xbd34), WORD(0x1761), WORD(0x653d), WORD(0x6e96), WORD(0x6c0e), WORD(0xcd99),
+	WORD(0x4c54), WORD(0x6273), WORD(0xbfd0), WORD(0x35b2), WORD(0xdec9), WORD(0xca11),
+	WORD(0xe454), WORD(0x32d1), WORD(0x1184), WORD(0x8397), WORD(0x0f94), WORD(0x7184),
+	/* 23G */
+	WORD(0x226b), WORD(0xc5fb), WORD(0x1a40), WORD(0xbb5d), WORD(0x98f9), WORD(0xb329),
+	WORD(0xf8d6), WORD(0x36e8), WORD(0xbb92), WORD(0x2665), WORD(0x5e70), WORD(0x9d65),
+	WORD(0xaf39), WORD(0x7fbf), WORD(0x0f25), WORD(0x96eb), WORD(0x9d53), WORD(0x3001),
+	WORD(0x9334), WORD(0xa4fb), WORD(0xabab), WORD(0x34de), WORD(0x91b3), WORD(0x7066),
+	WORD(0x8ee1), WORD(0x0266), WORD(0x54f3), WORD(0x7983), WORD(0x1393), WORD(0xcfee),
+	WORD(0x0a07), WORD(0x2b50), WORD(0x6533), WORD(0x50c7), WORD(0xe3dc), WORD(0xf58f),
+	WORD(0x2fbc), WORD(0xb602), WORD(0xf4c4), WORD(0xa1df), WORD(0x0ad8), WORD(0xb816),
+	WORD(0xdd60), WORD(0xd48f), WORD(0xd1de), WORD(0x3f90), WORD(0xddbb), WORD(0x4303),
+	/* 25G */
+	WORD(0x39b0), WORD(0x4858), WORD(0x6ac5), WORD(0xa4d0), WORD(0x835a), WORD(0x2fdb),
+	WORD(0xb93a), WORD(0x8a70), WORD(0x23ef), WORD(0xe42e), WORD(0x6bf1), WORD(0x05f2),
+	WORD(0x2c4b), WORD(0x9d4c), WORD(0x992a), WORD(0xaab0), WORD(0xeeb4), WORD(0xf591),
+	WORD(0x0ab7), WORD(0x148a), WORD(0xf322), WORD(0xe57b), WORD(0x356d), WORD(0x6489),
+	WORD(0xf403), WORD(0x9df3), WORD(0xe4d5), WORD(0x7766), WORD(0x2484), WORD(0x2a34),
+	WORD(0x18ac), WORD(0xcecb), WORD(0xba09), WORD(0x1f31), WORD(0x50c1), WORD(0x3b02),
+	WORD(0x0fad), WORD(0xce53), WORD(0x0655), WORD(0xeaca), WORD(0x0df0), WORD(0x542e),
+	WORD(0x7e90), WORD(0x0c47), WORD(0xcdf1), WORD(0x6400), WORD(0xdad2), WORD(0x6687),
+	/* 27G */
+	WORD(0x279e), WORD(0x4b25), WORD(0x21a1), WORD(0x85c7), WORD(0x5463), WORD(0xfa41),
+	WORD(0xf9d0), WORD(0xd489), WORD(0x542c), WORD(0x10c3), WORD(0xddf5), WORD(0x0423),
+	WORD(0xac78), WORD(0xd528), WORD(0x24a9), WORD(0x1096), WORD(0x17ad), WORD(0xb794),
+	WORD(0xc530), WORD(0x9bfb), WORD(0x6102), WORD(0xd4af), WORD(0xc385), WORD(0x08ed),
+	WORD(0x029a), WORD(0x1e52), WORD(0x7913), WORD(0x63f6), WORD(0x92e8), WORD(0x6f59),
+	WORD(0x510b), WORD(0xc965), WORD(0x8a16), WORD(0x24ba), WORD(0x5858), WORD(0x3671),
+	WORD(0x5d9e), WORD(0x9567), WORD(0x8dba), WORD(0x7450), WORD(0xe50f), WORD(0xeca4),
+	WORD(0x8842), WORD(0xcd1b), WORD(0x1661), WORD(0xb379), WORD(0xc5bf), WORD(0x4787),
+	/* 29G */
+	WORD(0x16de), WORD(0x2eb5), WORD(0xe690), WORD(0x0a9b), WORD(0x3ef2), WORD(0xd44b),
+	WORD(0x7cd7), WORD(0x3951), WORD(0xb877), WORD(0xf120), WORD(0x4dbb), WORD(0x4876),
+	WORD(0xcb90), WORD(0xce43), WORD(0x4f95), WORD(0x13ce), WORD(0x271e), WORD(0x14be),
+	WORD(0xf0ce), WORD(0x51c6), WORD(0xc025), WORD(0x4395), WORD(0x6ef5), WORD(0x6d88),
+	WORD(0xa9f3), WORD(0x1896), WORD(0x6c6a), WORD(0xf9a7), WORD(0x5555), WORD(0x2518),
+	WORD(0xf2ee), WORD(0xeb1c), WORD(0xf3f2), WORD(0x9b75), WORD(0xcf02), WORD(0x5fb5),
+	WORD(0x65ee), WORD(0x8006), WORD(0x0155), WORD(0x07b1), WORD(0xd13b), WORD(0x4ce8),
+	WORD(0xb373), WORD(0x7357), WORD(0x871b), WORD(0x53d5), WORD(0xed1f), WORD(0x6de8),
+	/* 31G */
+	WORD(0xa3b8), WORD(0xab74), WORD(0xf7da), WORD(0x1d17), WORD(0xff09), WORD(0x5e5d),
+	WORD(0x1083), WORD(0x1fbd), WORD(0x3185), WORD(0x71e5), WORD(0xb03a), WORD(0xd52c),
+	WORD(0xb9ab), WORD(0xf37d), WORD(0x2d7b), WORD(0xf5f5), WORD(0xd75d), WORD(0x652b),
+	WORD(0x67bd), WORD(0x9615), WORD(0xc05e), WORD(0x0aef), WORD(0x2ddf), WORD(0x885a),
+	WORD(0x9f6d), WORD(0xe6e4), WORD(0x945c), WORD(0xf83e), WORD(0x476c), WORD(0x28e7),
+	WORD(0x07e1), WORD(0x87f4), WORD(0x937e), WORD(0x92ce), WORD(0xa186), WORD(0x0be6),
+	WORD(0x14c7), WORD(0x75b1), WORD(0xcec9), WORD(0xa378), WORD(0xa9a9), WORD(0x4358),
+	WORD(0x8d69), WORD(0x9787), WORD(0xaba5), WORD(0xc581), WORD(0xf4ac), WORD(0x06f7),
+	/* 33G */
+	WORD(0xb6ce), WORD(0x5942), WORD(0x8c82), WORD(0x936c), WORD(0x7b67), WORD(0xa78b),
+	WORD(0xebb0), WORD(0x0439), WORD(0x961e), WORD(0x9c8f), WORD(0x928d), WORD(0xfd34),
+	WORD(0x00aa), WORD(0xead1), WORD(0x6b1f), WORD(0x7c6c), WORD(0xf520), WORD(0x6d90),
+	WORD(0x45b5), WORD(0xe50a), WORD(0x70e9), WORD(0x92c2), WORD(0xbcfe), WORD(0x1d94),
+	WORD(0x22c2), WORD(0xac65), WORD(0xfce1), WORD(0x864f), WORD(0xebf3), WORD(0x0b75),
+	WORD(0xaa45), WORD(0x8265), WORD(0xa3a8), WORD(0xa0e8), WORD(0x0586), WORD(0x5322),
+	WORD(0x14f0), WORD(0x15a1), WORD(0xec60), WORD(0x6fa6), WORD(0xb048), WORD(0x1ea8),
+	WORD(0xf6de), WORD(0x7739), WORD(0x5b6e), WORD(0xff65), WORD(0x8dec), WORD(0x5d8e),
+	/* 35G */
+	WORD(0x55f6), WORD(0x8fcc), WORD(0x6193), WORD(0x3e36), WORD(0x0ef0), WORD(0xb59e),
+	WORD(0x2ffc), WORD(0x83d3), WORD(0x26af), WORD(0xc720), WORD(0x07c8), WORD(0x04a5),
+	WORD(0x6633), WORD(0xa9dc), WORD(0x7692), WORD(0x9ec7), WORD(0x3bfa), WORD(0xf648),
+	WORD(0xe46a), WORD(0xc9e2), WORD(0x8bb0), WORD(0xb369), WORD(0xbd9f), WORD(0x0b28),
+	WORD(0x3d91), WORD(0x5c46), WORD(0x0468), WORD(0x5f49), WORD(0x46ff), WORD(0xc199),
+	WORD(0xfd23), WORD(0x0f7c), WORD(0x360b), WORD(0x8465), WORD(0x6733), WORD(0x713e),
+	WORD(0x673f), WORD(0xe8d4), WORD(0xb6c6), WORD(0xadd4), WORD(0xd3b5), WORD(0xfbce),
+	WORD(0x929a), WORD(0x0f82), WORD(0x850d), WORD(0x5d03), WORD(0x047b), WORD(0x404f),
+	/* 37G */
+	WORD(0x73d9), WORD(0x93af), WORD(0x3ecd), WORD(0x21a7), WORD(0x1aaf), WORD(0x77d0),
+	WORD(0x410e), WORD(0x469f), WORD(0xebcc), WORD(0xeb4e), WORD(0x649c), WORD(0x0eae),
+	WORD(0xbbf8), WORD(0xa821), WORD(0x9e0f), WORD(0x8d9f), WORD(0x31ac), WORD(0x10d8),
+	WORD(0xf8cb), WORD(0x1374), WORD(0x16b5), WORD(0x608a), WORD(0xd25c), WORD(0x8c60),
+	WORD(0xd415), WORD(0xaba7), WORD(0x518d), WORD(0xd45d), WORD(0x25ee), WORD(0xf932),
+	WORD(0x583c), WORD(0xa431), WORD(0x4a85), WORD(0xcd02), WORD(0xa67e), WORD(0x47e2),
+	WORD(0x2b2a), WORD(0xf560), WORD(0x09a4), WORD(0x26bb), WORD(0x37a9), WORD(0x34dc),
+	WORD(0xba95), WORD(0xc14e), WORD(0x5670), WORD(0x0130), WORD(0x536f), WORD(0x7baa),
+	/* 39G */
+	WORD(0xaa78), WORD(0xbeea), WORD(0xb08e), WORD(0x0269), WORD(0x1c2b), WORD(0xe4cd),
+	WORD(0x4406), WORD(0xc3f8), WORD(0x09f6), WORD(0xd3a9), WORD(0x77fa), WORD(0xeb45),
+	WORD(0x7397), WORD(0x97c1), WORD(0x34da), WORD(0x0716), WORD(0x2a4d), WORD(0x7b82),
+	WORD(0xf3ed), WORD(0x3cbe), WORD(0xfa59), WORD(0x941b), WORD(0xa47f), WORD(0x2b07),
+	WORD(0xd48c), WORD(0x6b65), WORD(0x6b92), WORD(0xa8f6), WORD(0x2508), WORD(0x761e),
+	WORD(0x56d2), WORD(0x3c48), WORD(0x0d4b), WORD(0xd3d6), WORD(0x708e), WORD(0x5b48),
+	WORD(0x7020), WORD(0xe6e7), WORD(0x51fb), WORD(0x29e5), WORD(0x530b), WORD(0x0a09),
+	WORD(0x0596), WORD(0xa9ae), WORD(0x03e8), WORD(0x6494), WORD(0x3a87), WORD(0x40a5),
+	/* 41G */
+	WORD(0xa101), WORD(0x3688), WORD(0xf2ac), WORD(0x302c), WORD(0xc78b), WORD(0x3ddb),
+	WORD(0x7e5a), WORD(0xc133), WORD(0xdc5b), WORD(0x8697), WORD(0x3670), WORD(0x5113),
+	WORD(0xbbab), WORD(0x26e7), WORD(0xda68), WORD(0x1086), WORD(0x1a9f), WORD(0x170c),
+	WORD(0xccbd), WORD(0x6d12), WORD(0x9925), WORD(0x5aca), WORD(0x5600), WORD(0x6e81),
+	WORD(0xf9f4), WORD(0x1874), WORD(0x572e), WORD(0x3d65), WORD(0x10cd), WORD(0x1bfa),
+	WORD(0xbaff), WORD(0x7586), WORD(0x6a14), WORD(0x6805), WORD(0x64ec), WORD(0x8155),
+	WORD(0x4de4), WORD(0x57cb), WORD(0x9cb6), WORD(0xf125), WORD(0xa75d), WORD(0x7df7),
+	WORD(0x5ff0), WORD(0xa15b), WORD(0xf4de), WORD(0x2a6c), WORD(0x8d4f), WORD(0x27cb),
+	/* 43G */
+	WORD(0x9f4e), WORD(0x9586), WORD(0x3bec), WORD(0xfb76), WORD(0xd350), WORD(0x3515),
+	WORD(0x06c5), WORD(0x0dac), WORD(0x8704), WORD(0x81c1), WORD(0xfd67), WORD(0x24aa),
+	WORD(0x629b), WORD(0x56a8), WORD(0x176e), WORD(0xc96f), WORD(0x7dc8), WORD(0x3542),
+	WORD(0x7bf4), WORD(0x3c5a), WORD(0x0713), WORD(0x9a1d), WORD(0x0f1a), WORD(0x23c4),
+	WORD(0x1c54), WORD(0x4e5e), WORD(0xf22f), WORD(0xe02e), WORD(0x3efd), WORD(0x2994),
+	WORD(0xff06), WORD(0x74c4), WORD(0xcf96), WORD(0xcaec), WORD(0x2e48), WORD(0xdda1),
+	WORD(0xd82a), WORD(0x80b8), WORD(0xe10f), WORD(0x6e01), WORD(0x21c6), WORD(0x1f24),
+	WORD(0x77a8), WORD(0xeb7b), WORD(0xdaee), WORD(0x3621), WORD(0xc18c), WORD(0x268a),
+	/* 45G */
+	WORD(0x483a), WORD(0x8a2a), WORD(0xf40a), WORD(0xecb8), WORD(0xd716), WORD(0x6ee8),
+	WORD(0x1293), WORD(0xbd84), WORD(0xb4f1), WORD(0x06cb), WORD(0x340e), WORD(0xcf0a),
+	WORD(0x7de1), WORD(0xe155), WORD(0x7d21), WORD(0x39a9), WORD(0xe23a), WORD(0xe637),
+	WORD(0x8e59), WORD(0x4eb5), WORD(0x945d), WORD(0xe8b4), WORD(0x0d7a), WORD(0x4459),
+	WORD(0xdcc9), WORD(0x88be), WORD(0x8e86), WORD(0xecf0), WORD(0x0fa3), WORD(0x40f3),
+	WORD(0x99f7), WORD(0x37be), WORD(0x9945), WORD(0xda26), WORD(0xe684), WORD(0x709f),
+	WORD(0x1b94), WORD(0x1aff), WORD(0x0bdd), WORD(0xc2f5), WORD(0x2712), WORD(0x584e),
+	WORD(0x6608), WORD(0x9d94), WORD(0xda63), WORD(0x26f5), WORD(0x813a), WORD(0x342b),
+	/* 47G */
+	WORD(0xa1f8), WORD(0x4680), WORD(0xa26d), WORD(0x62f6), WORD(0xdc98), WORD(0x0e6e),
+	WORD(0x76ef), WORD(0xbe42), WORD(0x639b), WORD(0x0da5), WORD(0xe879), WORD(0xc1e2),
+	WORD(0xc6ea), WORD(0x72dc), WORD(0xa0be), WORD(0x8452), WORD(0x6dfe), WORD(0xcbea),
+	WORD(0xa6f5), WORD(0x05c2), WORD(0xaf56), WORD(0x9a1a), WORD(0x5749), WORD(0x3a55),
+	WORD(0x1e6e), WORD(0xd2c7), WORD(0x8266), WORD(0xc7ea), WORD(0xe481), WORD(0x9888),
+	WORD(0x1e70), WORD(0x1786), WORD(0x8025), WORD(0x527b), WORD(0x1530), WORD(0xa982),
+	WORD(0x2619), WORD(0xde9a), WORD(0x83f3), WORD(0xff43), WORD(0x18b8), WORD(0x0868),
+	WORD(0xbd61), WORD(0x0d55), WORD(0x1668), WORD(0xde97), WORD(0x63ff), WORD(0x2acd),
+	/* 49G */
+	WORD(0x9b1a), WORD(0x9539), WORD(0xa449), WORD(0x7038), WORD(0x0a29), WORD(0x36d1),
+	WORD(0x6c7b), WORD(0x0548), WORD(0x126d), WORD(0xae38), WORD(0xef6b), WORD(0x6bbc),
+	WORD(0xd677), WORD(0xf81e), WORD(0xd541), WORD(0x6795), WORD(0x406e), WORD(0x6aa3),
+	WORD(0xedc4), WORD(0x3931), WORD(0x59c3), WORD(0x97d6), WORD(0x1f52), WORD(0x528a),
+	WORD(0x48c2), WORD(0xc4ca), WORD(0xb4f4), WORD(0xc93b), WORD(0x89c2), WORD(0x1d65),
+	WORD(0xc135), WORD(0x4820), WORD(0xba24), WORD(0xd598), WORD(0xaa27), WORD(0xf7ba),
+	WORD(0x76b2), WORD(0xe520), WORD(0x8232), WORD(0xb183), WORD(0x3aac), WORD(0x01a4),
+	WORD(0xcf75), WORD(0xd97c), WORD(0x9bb4), WORD(0xfd81), WORD(0x62b3), WORD(0x01ba),
+	/* 51G */
+	WORD(0x637e), WORD(0xddc9), WORD(0x02bd), WORD(0xcf56), WORD(0xab9d), WORD(0x42bc),
+	WORD(0xf0bb), WORD(0xb821), WORD(0x5ba2), WORD(0x71bd), WORD(0xe6ae), WORD(0xdc0d),
+	WORD(0x3fd3), WORD(0x689e), WORD(0x2635), WORD(0x2079), WORD(0x423f), WORD(0xcf61),
+	WORD(0xccbb), WORD(0x88b4), WORD(0xcdce), WORD(0xfd7c), WORD(0xd0dc), WORD(0x8486),
+	WORD(0xf619), WORD(0x1fea), WORD(0xedfd), WORD(0xf7a4), WORD(0x28db), WORD(0x5c9e),
+	WORD(0xe512), WORD(0x7a3f), WORD(0x5a0c), WORD(0xa8f1), WORD(0x144c), WORD(0x9077),
+	WORD(0x20b1), WORD(0x9874), WORD(0xfd2c), WORD(0x66bc), WORD(0x4a92), WORD(0x78e8),
+	WORD(0x6d85), WORD(0x5d82), WORD(0x371e), WORD(0xb31c), WORD(0x4f33), WORD(0x477d),
+	/* 53G */
+	WORD(0x39bf), WORD(0xa91c), WORD(0x343b), WORD(0x3768), WORD(0x9ca0), WORD(0x41e7),
+	WORD(0xbc84), WORD(0xb6ff), WORD(0x85f9), WORD(0x6df8), WORD(0x2ce8), WORD(0x3c7e),
+	WORD(0x37db), WORD(0x78ee), WORD(0x3527), WORD(0xdb94), WORD(0xa744), WORD(0xb84a),
+	WORD(0x5a07), WORD(0x281e), WORD(0x1992), WORD(0x67fc), WORD(0x1353), WORD(0x3c60),
+	WORD(0x4ab3), WORD(0x0d6d), WORD(0x6aec), WORD(0x89eb), WORD(0x5074), WORD(0x5aef),
+	WORD(0xc3b8), WORD(0x9ef7), WORD(0x4a8d), WORD(0xd094), WORD(0x4b32), WORD(0xa5a8),
+	WORD(0x26e8), WORD(0xb916), WORD(0xba1a), WORD(0xd52e), WORD(0x3f29), WORD(0x2f54),
+	WORD(0xf0da), WORD(0xb616), WORD(0x5b51), WORD(0xe919), WORD(0x3a7e), WORD(0x636b),
+	/* 55G */
+	WORD(0x03d3), WORD(0x0670), WORD(0x61f6), WORD(0xa46e), WORD(0x4a46), WORD(0x2053),
+	WORD(0x43f1), WORD(0x10ee), WORD(0x7427), WORD(0x4d8e), WORD(0x18f8), WORD(0x7913),
+	WORD(0x2168), WORD(0xbd47), WORD(0x0562), WORD(0x7b0e), WORD(0xff2e), WORD(0x605a),
+	WORD(0x060d), WORD(0xf7e1), WORD(0xab45), WORD(0x5fdf), WORD(0xf685), WORD(0x4140),
+	WORD(0xc437), WORD(0x1a61), WORD(0x8e08), WORD(0xbd61), WORD(0x4922), WORD(0xb028),
+	WORD(0x78a3), WORD(0x71b9), WORD(0xb612), WORD(0x41cd), WORD(0x0884), WORD(0x6781),
+	WORD(0x161f), WORD(0xc6a1), WORD(0x83ff), WORD(0x2e2b), WORD(0x02d1), WORD(0x7070),
+	WORD(0xee4f), WORD(0x880e), WORD(0x9b6c), WORD(0xeefa), WORD(0x0ba2), WORD(0x5f15),
+	/* 57G */
+	WORD(0xcf55), WORD(0xbc6f), WORD(0xe6d9), WORD(0xd0aa), WORD(0x15b9), WORD(0x956d),
+	WORD(0x280e), WORD(0x4c75), WORD(0x76b8), WORD(0xe75f), WORD(0xbe59), WORD(0xe69d),
+	WORD(0x42b8), WORD(0x0433), WORD(0x59e6), WORD(0x91da), WORD(0x58a5), WORD(0x4aa2),
+	WORD(0x4d90), WORD(0x6e5a), WORD(0x3c8a), WORD(0x8350), WORD(0x720b), WORD(0x15e7),
+	WORD(0x5802), WORD(0x7f6b), WORD(0xb3e6), WORD(0xa88c), WORD(0x4214), WORD(0xbd8b),
+	WORD(0xc135), WORD(0x6063), WORD(0x176d), WORD(0x713d), WORD(0xa4f1), WORD(0xfeb6),
+	WORD(0x65e1), WORD(0x88aa), WORD(0xcb52), WORD(0x1d49), WORD(0xa239), WORD(0x373b),
+	WORD(0xcba1), WORD(0x9127), WORD(0x73e1), WORD(0x02d6), WORD(0xadac), WORD(0x5601),
+	/* 59G */
+	WORD(0x01d7), WORD(0x424a), WORD(0xf0bd), WORD(0xc2be), WORD(0xda1f), WORD(0x333a),
+	WORD(0x45b6), WORD(0xe030), WORD(0x578c), WORD(0xadda), WORD(0x7309), WORD(0xe1d8),
+	WORD(0xe4fb), WORD(0xc25a), WORD(0xb14f), WORD(0x0db7), WORD(0x766d), WORD(0xf581),
+	WORD(0x92b7), WORD(0x29d7), WORD(0x1333), WORD(0x42cc), WORD(0xa240), WORD(0x77b7),
+	WORD(0x15e1), WORD(0xab9d), WORD(0xfbf2), WORD(0x1b88), WORD(0x3957), WORD(0x42f2),
+	WORD(0xf238), WORD(0xe180), WORD(0x2609), WORD(0x254e), WORD(0x112c), WORD(0x69c4),
+	WORD(0xcefd), WORD(0x7605), WORD(0xca81), WORD(0x92c0), WORD(0x957c), WORD(0x71a0),
+	WORD(0x9603), WORD(0x58ab), WORD(0x167d), WORD(0x2e0a), WORD(0x949a), WORD(0x5fc7),
+	/* 61G */
+	WORD(0x0b74), WORD(0xeb21), WORD(0x017c), WORD(0x73a4), WORD(0x635d), WORD(0xe3a2),
+	WORD(0xcb26), WORD(0x8073), WORD(0x7a10), WORD(0xf3ca), WORD(0x5680), WORD(0x9c6c),
+	WORD(0x7139), WORD(0x9c89), WORD(0x94c7), WORD(0x8d80), WORD(0xd242), WORD(0xa5f8),
+	WORD(0x5508), WORD(0x3ee9), WORD(0xfea8), WORD(0x31db), WORD(0x3bdd), WORD(0x22e8),
+	WORD(0xed4f), WORD(0xac69), WORD(0xa61b), WORD(0x4167), WORD(0x8472), WORD(0x495d),
+	WORD(0xe6bf), WORD(0xd3e6), WORD(0x7fc2), WORD(0x1c9d), WORD(0x37f9), WORD(0x6079),
+	WORD(0x61eb), WORD(0x055a), WORD(0x9da5), WORD(0x7e15), WORD(0xfa99), WORD(0xdd78),
+	WORD(0xd86a), WORD(0x884e), WORD(0x0691), WORD(0x494e), WORD(0x8473), WORD(0x38e8),
+	/* 63G */
+	WORD(0x1ff1), WORD(0x9d0c), WORD(0xc4d9), WORD(0xdd41), WORD(0xec4b), WORD(0xb3a9),
+	WORD(0x7365), WORD(0xd7e4), WORD(0xb3be), WORD(0x1744), WORD(0x174e), WORD(0x3e0f),
+	WORD(0xd64b), WORD(0xca50), WORD(0xe15b), WORD(0xa51f), WORD(0x6552), WORD(0x4586),
+	WORD(0x3543), WORD(0x03f5), WORD(0x4232), WORD(0xa94f), WORD(0xb570), WORD(0x144c),
+	WORD(0x5709), WORD(0x7f2c), WORD(0xdd55), WORD(0xa3df), WORD(0x1bd0), WORD(0xad56),
+	WORD(0x6239), WORD(0x191c), WORD(0x1186), WORD(0x34da), WORD(0x768e), WORD(0xbfcb),
+	WORD(0x7926), WORD(0x2337), WORD(0xc217), WORD(0x3bbb), WORD(0xfc9f), WORD(0x56fb),
+	WORD(0xb5d8), WORD(0x9e3a), WORD(0xfd7c), WORD(0x17ff), WORD(0x7078), WORD(0x340f),
+};
+#else                     /* unknown word size */
+#error "Unsupported word size"
+#endif
+TO_EC_GEN_TABLE_PARAM(brainpoolp384r1_gen_wnaf, 7);
+
+/*
+ * Signed comb of the generator for the fixed base multiplications (6
+ * teeth, spacing 64), affine x and y in Montgomery representation
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+static const word_t brainpoolp384r1_gen_comb[] = {
+	/* T[0] */
+	WORD(0x5d823207f3f85c45), WORD(0x71e43b2062ff301e),
+	WORD(0x80f3133b93d19300), WORD(0x8e8909d14fdea70b),
+	WORD(0x237742499cde1ab0), WORD(0x48c53599b0c00265),
+	WORD(0x25a317eac210a382), WORD(0xb0f77a5c20e9dae3),
+	WORD(0xb54b5b603eb8ba03), WORD(0xd6968a11e881f176),
+	WORD(0x5deccda260abd60b), WORD(0x6d2d78dd4da93d4c),
+	/* T[1] */
+	WORD(0x33f5b41fd974c733), WORD(0xa200d6c9620ee320),
+	WORD(0x84b90bf8069a5be4), WORD(0x829ab6b3037353a1),
+	WORD(0x403ecc749296306a), WORD(0x40160fee22e935d9),
+	WORD(0x2ae7ce4d03abc246), WORD(0x9755ff4421dee949),
+	WORD(0x86472b234c32e65f), WORD(0x2f236b5659fdc027),
+	WORD(0x4a880675d9e19f5d), WORD(0x46f2293616535f6e),
+	/* T[2] */
+	WORD(0xf44756c351ee32c2), WORD(0x86ee80d22941e593),
+	WORD(0x5fa3d364455ebb1d), WORD(0x41757fc41db6f827),
+	WORD(0x53476567d8b55c62), WORD(0x0a14983d1d6e7113),
+	WORD(0x1e67803e4d560ea7), WORD(0x635945d0c49ca7ab),
+	WORD(0x54de4cdb9bdeda83), WORD(0x3283469c89ca667d),
+	WORD(0xdfe4f50017bb49c7), WORD(0x281b3a31cb8f59df),
+	/* T[3] */
+	WORD(0x199ed6dd6b1e0419), WORD(0x12b7653c4fcae1fc),
+	WORD(0x7f153ac655536caa), WORD(0xb2b42678b905f988),
+	WORD(0x7d6c053553cb305c), WORD(0x6d8340f64f42eb84),
+	WORD(0x58362e48dae44239), WORD(0x965e7dc68c0b946a),
+	WORD(0x5040119b86da07fe), WORD(0x4aaf3d2ccf815715),
+	WORD(0x7b5969397a21f6e5), WORD(0x43ead9494cbb22c8),
+	/* T[4] */
+	WORD(0x1fc28ffb166795f5), WORD(0x083250dc9b9af590),
+	WORD(0xef500027df359996), WORD(0x8150c407797e8908),
+	WORD(0x25388d486f89f6ab), WORD(0x32d8f46ea479585c),
+	WORD(0x69123f23db66a2a1), WORD(0xc554be80b34a3a1d),
+	WORD(0x99e13ab80ee0c979), WORD(0xd8f885a15db00ad3),
+	WORD(0xbd0d2aecf67df4bf), WORD(0x4c09e74225473a68),
+	/* T[5] */
+	WORD(0x75a7924fe1e0e08b), WORD(0x8a9465a256896b4f),
+	WORD(0x1e6454c96ce2fe3a), WORD(0xe85a07b37e4b60e1),
+	WORD(0xce6f1d81179db201), WORD(0x2aff49013ac88c83),
+	WORD(0x80e1e5c50dae9043), WORD(0x10ec78f79a66c55d),
+	WORD(0x3a936aee965fffb8), WORD(0x38f1a27cc5968108),
+	WORD(0x01d0e3f050e5e5a0), WORD(0x771e00b23fbce271),
+	/* T[6] */
+	WORD(0xfb74233b94a52dd7), WORD(0xd68e37d8e1e0aedf),
+	WORD(0x897ad6edf19a1e0a), WORD(0x9104b0918ac9b4b1),
+	WORD(0x19157a49d04870d9), WORD(0x459e31d78b17fadb),
+	WORD(0x3473972e014c7e8c), WORD(0x47524956a0e83c17),
+	WORD(0x9f420e5fba465245), WORD(0x3e81402e50e3fa32),
+	WORD(0x243d9723a1b7013a), WORD(0x16285aab87e37a6b),
+	/* T[7] */
+	WORD(0x31cb4a29ef0785e2), WORD(0x5b6f71b9479b4b56),
+	WORD(0x959508177a3502e0), WORD(0x1989ebb77f1494d4),
+	WORD(0x0c4c15f0535abd54), WORD(0x82f230ab88d2a815),
+	WORD(0x6a98af86cf1f27cb), WORD(0x98000acaed6cbb19),
+	WORD(0xc058786dd8411bc3), WORD(0xa679aa20dbc1a322),
+	WORD(0x103a82f31a13fb9d), WORD(0x363aa80a9c7fde0f),
+	/* T[8] */
+	WORD(0x9606d62e1a3ae46c), WORD(0xdb294e426d3eb38e),
+	WORD(0x15c45e6956c0deb8), WORD(0x1007ef6cf01dd6dc),
+	WORD(0xca718e9f999049da), WORD(0x4db1647da9d0fc71),
+	WORD(0xe5f6f61fbb83a223), WORD(0x209179a74d4f214c),
+	WORD(0xe10b81a0e1c99aad), WORD(0xe1389cabcee1a7f4),
+	WORD(0x450b8cf027b19ea0), WORD(0x1f712aa1601d3592),
+	/* T[9] */
+	WORD(0xedbe2c047f86eae4), WORD(0x73dcd71298628f09),
+	WORD(0xcc85e3f86f596f2f), WORD(0x3c34e3307e67d31e),
+	WORD(0x9e2540e8c38992a1), WORD(0x1cfe0db57f02af4c),
+	WORD(0x1859aac2812daf9e), WORD(0xda73c949bb9f0191),
+	WORD(0x6ea008c5c18cd3bc), WORD(0x80394bdf8b4fca04),
+	WORD(0xccd6fbd3deb739f0), WORD(0x6a6548926c11ba2a),
+	/* T[10] */
+	WORD(0x455de88aa5b1ba52), WORD(0x43715ac57d6418ca),
+	WORD(0x29233cb043d65125), WORD(0x0923f968d7aa007c),
+	WORD(0x453852f25de30695), WORD(0x8668c4a8bce0f04b),
+	WORD(0x40ff4ca6f66d5dde), WORD(0x324354c517f7766d),
+	WORD(0x6eb84cb629241871), WORD(0x14766ec9517221c8),
+	WORD(0x059663bddc25f829), WORD(0x5445933259605663),
+	/* T[11] */
+	WORD(0xc96d1dad6dca2f29), WORD(0x5434a329522bf61b),
+	WORD(0xe3202cadfef74e6e), WORD(0x21eedef26d4740ac),
+	WORD(0x7e0db352e0c76a08), WORD(0x0fa8f72339122fd1),
+	WORD(0x59533f16ba8beba4), WORD(0x08579235d8080fcb),
+	WORD(0x6faf6bafca1cbc3d), WORD(0x6c47f4d47b496da9),
+	WORD(0x3f34a3978fec8b1f), WORD(0x87177e7b224d5245),
+	/* T[12] */
+	WORD(0x60d9adba4883a864), WORD(0x44186fe7d1584cf3),
+	WORD(0x86843c51b7f3eefe), WORD(0x4e7fe777e1d4821b),
+	WORD(0x3bd483a70bf4ad85), WORD(0x81f59b3107a301f3),
+	WORD(0x21e7bfcf950542f5), WORD(0x8d61580108161c7e),
+	WORD(0x6a0a8dfd083939b2), WORD(0xfdc282a61667fc01),
+	WORD(0x9ab20bee436724bc), WORD(0x4a84ad0c0bce2972),
+	/* T[13] */
+	WORD(0x31606dacd4bb0c80), WORD(0x570649df59d3d681),
+	WORD(0xdab44e98666ed3c5), WORD(0x4bc79e2a9dd32bd7),
+	WORD(0x1842bf4a82e9f784), WORD(0x66177638940f450a),
+	WORD(0x2877b35960f74976), WORD(0x1e006bb8f9469c98),
+	WORD(0x5e5fe5807f35d643), WORD(0x407cbee9d3c43787),
+	WORD(0x5aae7d06ec33c2dc), WORD(0x7ae135c4a1d457f4),
+	/* T[14] */
+	WORD(0x872cbd9de45003b2), WORD(0x0633a3cc47af6d08),
+	WORD(0xfc028dd7a91d2d27), WORD(0x3001515edb902757),
+	WORD(0x5620372289d5f7ca), WORD(0x13376154c6ef4548),
+	WORD(0x86d96865ac9fb6ac), WORD(0x3d2b5bfe7c3f7c7b),
+	WORD(0xec83e1bfea7f6e94), WORD(0x003629b7af74157b),
+	WORD(0x217fc354446fbfb0), WORD(0x05b38306f4f4c214),
+	/* T[15] */
+	WORD(0xed554386a59df7cd), WORD(0x286e3775811541af),
+	WORD(0x40d86deaec12948a), WORD(0x289198e1f6c90876),
+	WORD(0x41fceaf85c084c63), WORD(0x229cbbcca4510bf5),
+	WORD(0x94b0147623c0525e), WORD(0xf2632c641787d466),
+	WORD(0x2b6f87f0f3551365), WORD(0x35eb15a7da097fb3),
+	WORD(0x1107fa7ce94d46b1), WORD(0x88f8616ea3dd92cb),
+	/* T[16] */
+	WORD(0xbdede1e0f1acd259), WORD(0x28dc6a5ad32abe8f),
+	WORD(0x4a23c50211aba5b8), WORD(0x133e7d7ab2078caf),
+	WORD(0x012ba873c86c42b5), WORD(0x2d18e4e4f03a70ab),
+	WORD(0xa6d05d505f9d01a1), WORD(0x6efd504a6362fa08),
+	WORD(0xea93c3629b0286a5), WORD(0x68da01aba7053d81),
+	WORD(0x10898c992478d73c), WORD(0x7a106501c7f5156f),
+	/* T[17] */
+	WORD(0x78c26bdde286817f), WORD(0xb539f34a2e8a23a5),
+	WORD(0xc07b9689dd0924b8), WORD(0x092293a70a54676b),
+	WORD(0xe25cbc8a243148f4), WORD(0x3e7914ab190015e8),
+	WORD(0xda3a85e739bb0bd2), WORD(0xa8eafb3b7b68b720),
+	WORD(0xc9cca6564c075072), WORD(0x523610f12d7c7d51),
+	WORD(0xee10633649f67b6f), WORD(0x333914b40911023c),
+	/* T[18] */
+	WORD(0xc2b94d052d345cea), WORD(0x8484cbedd3a68625),
+	WORD(0x97df4aa3537d2dee), WORD(0x4559bff008118112),
+	WORD(0x7c5129fc20a59596), WORD(0x364bf7fc3444a9ea),
+	WORD(0x9539d7514431a7c9), WORD(0x8c172f1799911107),
+	WORD(0xcac132a2609aa784), WORD(0x5edea789d0d841c1),
+	WORD(0xfada01878572ac3e), WORD(0x7666ea386f166735),
+	/* T[19] */
+	WORD(0xd80a288ac307d820), WORD(0xe44e163d75e698b2),
+	WORD(0x627287ce4d1be8da), WORD(0x502a4f55d7dcb65f),
+	WORD(0x75a266f37c3d6696), WORD(0x597efcd9cec1d729),
+	WORD(0xf7c6f0afd148065a), WORD(0x0e95485203493d2b),
+	WORD(0x8799ed452639e376), WORD(0x12c1472f8a966270),
+	WORD(0xcd7e0a3c0c72843c), WORD(0x4f7503870b2a255a),
+	/* T[20] */
+	WORD(0x08be784d5ca6ec0c), WORD(0xa47108465cb0cd44),
+	WORD(0xcb4c29490064aa25), WORD(0x5ddaa186f53669e7),
+	WORD(0x813e3dfb9c2abfc5), WORD(0x3f16cfaa54c09ac1),
+	WORD(0x247dcb85b83d52c2), WORD(0xe7743c82b88cbcb1),
+	WORD(0x5a159df3a5dc44eb), WORD(0xbe588fc49cca0b30),
+	WORD(0x2ee06dde1b87ab30), WORD(0x0c9951c77c564ce4),
+	/* T[21] */
+	WORD(0xfc7605630d1fba7a), WORD(0xd95996592347ce1a),
+	WORD(0xc9d178acc4d8ccc1), WORD(0xed2dac93ec0e5a0a),
+	WORD(0x9044d97da6d55cc8), WORD(0x68c6a8a602d852af),
+	WORD(0xbea781ef2fcfde05), WORD(0x510d16ae1a755efe),
+	WORD(0xa01943b5c630694f), WORD(0x8f897ff223bc09ec),
+	WORD(0xcd1490220e7bd6c3), WORD(0x1951337c1263f70f),
+	/* T[22] */
+	WORD(0xc4e8bf16910a9bdc), WORD(0x2ee6f54cca8b103e),
+	WORD(0x79f38d3b30f47c40), WORD(0x9ab89a2676526c1a),
+	WORD(0x06d374bcdf162aa5), WORD(0x5edda2f972ff6439),
+	WORD(0x10eeef96e39e66e2), WORD(0x430aa499989a14af),
+	WORD(0xadaaf1abd5124d80), WORD(0xb6d8f2c241b59f4a),
+	WORD(0xb10583885fc274d9), WORD(0x073b916ee120e0c3),
+	/* T[23] */
+	WORD(0x2530df4f9853046f), WORD(0x22fe885aa4516bcc),
+	WORD(0x274cca89b8fef106), WORD(0xb8907b576d20442e),
+	WORD(0x1d8e88ffa7a5b093), WORD(0x81afa22efee89fa8),
+	WORD(0x786e73af64d21c0a), WORD(0x52f43665f9117eb7),
+	WORD(0xe7bb5d4286f2df8f), WORD(0x652e59c479249e04),
+	WORD(0x9fdc121660b51f0c), WORD(0x43c9144b54ccaa20),
+	/* T[24] */
+	WORD(0x76edbb401d6ff19b), WORD(0x058c984a120293ab),
+	WORD(0x2a1d5dee01b7b6f6), WORD(0x2f7cb0ca0117d608),
+	WORD(0x2afc4ac2ab656bd9), WORD(0x73cabc1588d78d41),
+	WORD(0x5698933df50d685e), WORD(0x51248e3c8cab3342),
+	WORD(0xcbbca1943f360e0d), WORD(0xf1461969c7e59c24),
+	WORD(0xcef5ec44a73523c2), WORD(0x7e038a1db5bb410a),
+	/* T[25] */
+	WORD(0x332e4a7d9c914f20), WORD(0x2524930db999a35f),
+	WORD(0x66624d4085d108c2), WORD(0x7b486f1d76d3ad9f),
+	WORD(0x191c37e69e026ce3), WORD(0x0a093d8c66ac442c),
+	WORD(0x2391cbdb97a59478), WORD(0xcf44579f2e285af0),
+	WORD(0xcbdd4a9db60633c1), WORD(0x53193b2719801f3f),
+	WORD(0xaeb24501ff524c98), WORD(0x8be1077895e3d1f0),
+	/* T[26] */
+	WORD(0xbd841666f3947c24), WORD(0x8400b1dc5a92272f),
+	WORD(0x9f7f4dd32c998354), WORD(0x6e0c84d2c3d24e96),
+	WORD(0x6204ee61aed04bfc), WORD(0x656380949af8e54d),
+	WORD(0x89529f8500adb50b), WORD(0x22f321322d15b79f),
+	WORD(0x6c4e20fc3d0012be), WORD(0xa4c4521f582fd197),
+	WORD(0x2e2b26b664c9521e), WORD(0x6ecc6de8f76675b7),
+	/* T[27] */
+	WORD(0x0c6d676673b467de), WORD(0x5aaf596305b017ed),
+	WORD(0x7b25f923a1cc5088), WORD(0x7690d039cab5a7b2),
+	WORD(0x50be98b39b0f224b), WORD(0x531319561382dfc5),
+	WORD(0x7117bbe3db9d21e1), WORD(0xed74ce39f3e98b77),
+	WORD(0x688d02328266a4dd), WORD(0x038c5d1674aafbdc),
+	WORD(0x71b374a4a0aee647), WORD(0x62b6f9af70c1195e),
+	/* T[28] */
+	WORD(0x27a88ab1e887ce04), WORD(0x73665632f5738564),
+	WORD(0x82fd5c44ba33e94b), WORD(0x3929427c775d4034),
+	WORD(0x7c220ae7a93011be), WORD(0x086eb886b8aec40a),
+	WORD(0xfd846eabc225ec4a), WORD(0x7493a89aa5b3e6ae),
+	WORD(0xe56597fa52941f92), WORD(0x9d5c766a2e937fea),
+	WORD(0x5020435734e03d4f), WORD(0x1ab46463f822d937),
+	/* T[29] */
+	WORD(0x41de61116affcaba), WORD(0xe33df98ff07d9831),
+	WORD(0xbe3f34918ddb8ad6), WORD(0xd09a224f6b2d9a28),
+	WORD(0x21734bc048b96ffd), WORD(0x7d15f695911e26e0),
+	WORD(0x19fe51175b1c549f), WORD(0x97692c5925b4c7dc),
+	WORD(0x34c84046169d6ace), WORD(0x40ffba315b0615a3),
+	WORD(0x32341300777375d5), WORD(0x7726b0d20ee99724),
+	/* T[30] */
+	WORD(0x18df7bcd81e333f4), WORD(0x6b78af93060d6525),
+	WORD(0x66ec2757c625220b), WORD(0x0e10447bc79adf88),
+	WORD(0x31e38428165ae015), WORD(0x8bb6c6a137b5b8cc),
+	WORD(0x00e76eaeb2e8f1c1), WORD(0xc6b8a904c23fd224),
+	WORD(0xf58c3d05ef1dd56a), WORD(0x00cdde01469b43b6),
+	WORD(0x91a04de7ddeea1a6), WORD(0x7a6a8da61f122c63),
+	/* T[31] */
+	WORD(0xb0aec98ed2e395e2), WORD(0x572bcc81aa53a372),
+	WORD(0xc294d15172d4e8f9), WORD(0xf8652b0eddafe4d5),
+	WORD(0xeefc9ce47c2369e0), WORD(0x4183a54ea66ff303),
+	WORD(0xdf37960fdd997d74), WORD(0xc2d29548d8164798),
+	WORD(0xbe94f487f003c8b0), WORD(0xdc7a43e430b6799a),
+	WORD(0xe0ec94ed61e91a50), WORD(0x3e50202cf0ea059a),
+};
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+static const word_t brainpoolp384r1_gen_comb[] = {
+	/* T[0] */
+	WORD(0xf3f85c45), WORD(0x5d823207), WORD(0x62ff301e), WORD(0x71e43b20),
+	WORD(0x93d19300), WORD(0x80f3133b), WORD(0x4fdea70b), WORD(0x8e8909d1),
+	WORD(0x9cde1ab0), WORD(0x23774249), WORD(0xb0c00265), WORD(0x48c53599),
+	WORD(0xc210a382), WORD(0x25a317ea), WORD(0x20e9dae3), WORD(0xb0f77a5c),
+	WORD(0x3eb8ba03), WORD(0xb54b5b60), WORD(0xe881f176), WORD(0xd6968a11),
+	WORD(0x60abd60b), WORD(0x5deccda2), WORD(0x4da93d4c), WORD(0x6d2d78dd),
+	/* T[1] */
+	WORD(0xd974c733), WORD(0x33f5b41f), WORD(0x620ee320), WORD(0xa200d6c9),
+	WORD(0x069a5be4), WORD(0x84b90bf8), WORD(0x037353a1), WORD(0x829ab6b3),
+	WORD(0x9296306a), WORD(0x403ecc74), WORD(0x22e935d9), WORD(0x40160fee),
+	WORD(0x03abc246), WORD(0x2ae7ce4d), WORD(0x21dee949), WORD(0x9755ff44),
+	WORD(0x4c32e65f), WORD(0x86472b23), WORD(0x59fdc027), WORD(0x2f236b56),
+	WORD(0xd9e19f5d), WORD(0x4a880675), WORD(0x16535f6e), WORD(0x46f22936),
+	/* T[2] */
+	WORD(0x51ee32c2), WORD(0xf44756c3), WORD(0x2941e593), WORD(0x86ee80d2),
+	WORD(0x455ebb1d), WORD(0x5fa3d364), WORD(0x1db6f827), WORD(0x41757fc4),
+	WORD(0xd8b55c62), WORD(0x53476567), WORD(0x1d6e7113), WORD(0x0a14983d),
+	WORD(0x4d560ea7), WORD(0x1e67803e), WORD(0xc49ca7ab), WORD(0x635945d0),
+	WORD(0x9bdeda83), WORD(0x54de4cdb), WORD(0x89ca667d), WORD(0x3283469c),
+	WORD(0x17bb49c7), WORD(0xdfe4f500), WORD(0xcb8f59df), WORD(0x281b3a31),
+	/* T[3] */
+	WORD(0x6b1e0419), WORD(0x199ed6dd), WORD(0x4fcae1fc), WORD(0x12b7653c),
+	WORD(0x55536caa), WORD(0x7f153ac6), WORD(0xb905f988), WORD(0xb2b42678),
+	WORD(0x53cb305c), WORD(0x7d6c0535), WORD(0x4f42eb84), WORD(0x6d8340f6),
+	WORD(0xdae44239), WORD(0x58362e48), WORD(0x8c0b946a), WORD(0x965e7dc6),
+	WORD(0x86da07fe), WORD(0x5040119b), WORD(0xcf815715), WORD(0x4aaf3d2c),
+	WORD(0x7a21f6e5), WORD(0x7b596939), WORD(0x4cbb22c8), WORD(0x43ead949),
+	/* T[4] */
+	WORD(0x166795f5), WORD(0x1fc28ffb), WORD(0x9b9af590), WORD(0x083250dc),
+	WORD(0xdf359996), WORD(0xef500027), WORD(0x797e8908), WORD(0x8150c407),
+	WORD(0x6f89f6ab), WORD(0x25388d48), WORD(0xa479585c), WORD(0x32d8f46e),
+	WORD(0xdb66a2a1), WORD(0x69123f23), WORD(0xb34a3a1d), WORD(0xc554be80),
+	WORD(0x0ee0c979), WORD(0x99e13ab8), WORD(0x5db00ad3), WORD(0xd8f885a1),
+	WORD(0xf67df4bf), WORD(0xbd0d2aec), WORD(0x25473a68), WORD(0x4c09e742),
+	/* T[5] */
+	WORD(0xe1e0e08b), WORD(0x75a7924f), WORD(0x56896b4f), WORD(0x8a9465a2),
+	WORD(0x6ce2fe3a), WORD(0x1e6454c9), WORD(0x7e4b60e1), WORD(0xe85a07b3),
+	WORD(0x179db201), WORD(0xce6f1d81), WORD(0x3ac88c83), WORD(0x2aff4901),
+	WORD(0x0dae9043), WORD(0x80e1e5c5), WORD(0x9a66c55d), WORD(0x10ec78f7),
+	WORD(0x965fffb8), WORD(0x3a936aee), WORD(0xc5968108), WORD(0x38f1a27c),
+	WORD(0x50e5e5a0), WORD(0x01d0e3f0), WORD(0x3fbce271), WORD(0x771e00b2),
+	/* T[6] */
+	WORD(0x94a52dd7), WORD(0xfb74233b), WORD(0xe1e0aedf), WORD(0xd68e37d8),
+	WORD(0xf19a1e0a), WORD(0x897ad6ed), WORD(0x8ac9b4b1), WORD(0x9104b091),
+	WORD(0xd04870d9), WORD(0x19157a49), WORD(0x8b17fadb), WORD(0x459e31d7),
+	WORD(0x014c7e8c), WORD(0x3473972e), WORD(0xa0e83c17), WORD(0x47524956),
+	WORD(0xba465245), WORD(0x9f420e5f), WORD(0x50e3fa32), WORD(0x3e81402e),
+	WORD(0xa1b7013a), WORD(0x243d9723), WORD(0x87e37a6b), WORD(0x16285aab),
+	/* T[7] */
+	WORD(0xef0785e2), WORD(0x31cb4a29), WORD(0x479b4b56), WORD(0x5b6f71b9),
+	WORD(0x7a3502e0), WORD(0x95950817), WORD(0x7f1494d4), WORD(0x1989ebb7),
+	WORD(0x535abd54), WORD(0x0c4c15f0), WORD(0x88d2a815), WORD(0x82f230ab),
+	WORD(0xcf1f27cb), WORD(0x6a98af86), WORD(0xed6cbb19), WORD(0x98000aca),
+	WORD(0xd8411bc3), WORD(0xc058786d), WORD(0xdbc1a322), WORD(0xa679aa20),
+	WORD(0x1a13fb9d), WORD(0x103a82f3), WORD(0x9c7fde0f), WORD(0x363aa80a),
+	/* T[8] */
+	WORD(0x1a3ae46c), WORD(0x9606d62e), WORD(0x6d3eb38e), WORD(0xdb294e42),
+	WORD(0x56c0deb8), WORD(0x15c45e69), WORD(0xf01dd6dc), WORD(0x1007ef6c),
+	WORD(0x999049da), WORD(0xca718e9f), WORD(0xa9d0fc71), WORD(0x4db1647d),
+	WORD(0xbb83a223), WORD(0xe5f6f61f), WORD(0x4d4f214c), WORD(0x209179a7),
+	WORD(0xe1c99aad), WORD(0xe10b81a0), WORD(0xcee1a7f4), WORD(0xe1389cab),
+	WORD(0x27b19ea0), WORD(0x450b8cf0), WORD(0x601d3592), WORD(0x1f712aa1),
+	/* T[9] */
+	WORD(0x7f86eae4), WORD(0xedbe2c04), WORD(0x98628f09), WORD(0x73dcd712),
+	WORD(0x6f596f2f), WORD(0xcc85e3f8), WORD(0x7e67d31e), WORD(0x3c34e330),
+	WORD(0xc38992a1), WORD(0x9e2540e8), WORD(0x7f02af4c), WORD(0x1cfe0db5),
+	WORD(0x812daf9e), WORD(0x1859aac2), WORD(0xbb9f0191), WORD(0xda73c949),
+	WORD(0xc18cd3bc), WORD(0x6ea008c5), WORD(0x8b4fca04), WORD(0x80394bdf),
+	WORD(0xdeb739f0), WORD(0xccd6fbd3), WORD(0x6c11ba2a), WORD(0x6a654892),
+	/* T[10] */
+	WORD(0xa5b1ba52), WORD(0x455de88a), WORD(0x7d6418ca), WORD(0x43715ac5),
+	WORD(0x43d65125), WORD(0x29233cb0), WORD(0xd7aa007c), WORD(0x0923f968),
+	WORD(0x5de30695), WORD(0x453852f2), WORD(0xbce0f04b), WORD(0x8668c4a8),
+	WORD(0xf66d5dde), WORD(0x40ff4ca6), WORD(0x17f7766d), WORD(0x324354c5),
+	WORD(0x29241871), WORD(0x6eb84cb6), WORD(0x517221c8), WORD(0x14766ec9),
+	WORD(0xdc25f829), WORD(0x059663bd), WORD(0x59605663), WORD(0x54459332),
+	/* T[11] */
+	WORD(0x6dca2f29), WORD(0xc96d1dad), WORD(0x522bf61b), WORD(0x5434a329),
+	WORD(0xfef74e6e), WORD(0xe3202cad), WORD(0x6d4740ac), WORD(0x21eedef2),
+	WORD(0xe0c76a08), WORD(0x7e0db352), WORD(0x39122fd1), WORD(0x0fa8f723),
+	WORD(0xba8beba4), WORD(0x59533f16), WORD(0xd8080fcb), WORD(0x08579235),
+	WORD(0xca1cbc3d), WORD(0x6faf6baf), WORD(0x7b496da9), WORD(0x6c47f4d4),
+	WORD(0x8fec8b1f), WORD(0x3f34a397), WORD(0x224d5245), WORD(0x87177e7b),
+	/* T[12] */
+	WORD(0x4883a864), WORD(0x60d9adba), WORD(0xd1584cf3), WORD(0x44186fe7),
+	WORD(0xb7f3eefe), WORD(0x86843c51), WORD(0xe1d4821b), WORD(0x4e7fe777),
+	WORD(0x0bf4ad85), WORD(0x3bd483a7), WORD(0x07a301f3), WORD(0x81f59b31),
+	WORD(0x950542f5), WORD(0x21e7bfcf), WORD(0x08161c7e), WORD(0x8d615801),
+	WORD(0x083939b2), WORD(0x6a0a8dfd), WORD(0x1667fc01), WORD(0xfdc282a6),
+	WORD(0x436724bc), WORD(0x9ab20bee), WORD(0x0bce2972), WORD(0x4a84ad0c),
+	/* T[13] */
+	WORD(0xd4bb0c80), WORD(0x31606dac), WORD(0x59d3d681), WORD(0x570649df),
+	WORD(0x666ed3c5), WORD(0xdab44e98), WORD(0x9dd32bd7), WORD(0x4bc79e2a),
+	WORD(0x82e9f784), WORD(0x1842bf4a), WORD(0x940f450a), WORD(0x66177638),
+	WORD(0x60f74976), WORD(0x2877b359), WORD(0xf9469c98), WORD(0x1e006bb8),
+	WORD(0x7f35d643), WORD(0x5e5fe580), WORD(0xd3c43787), WORD(0x407cbee9),
+	WORD(0xec33c2dc), WORD(0x5aae7d06), WORD(0xa1d457f4), WORD(0x7ae135c4),
+	/* T[14] */
+	WORD(0xe45003b2), WORD(0x872cbd9d), WORD(0x47af6d08), WORD(0x0633a3cc),
+	WORD(0xa91d2d27), WORD(0xfc028dd7), WORD(0xdb902757), WORD(0x3001515e),
+	WORD(0x89d5f7ca), WORD(0x56203722), WORD(0xc6ef4548), WORD(0x13376154),
+	WORD(0xac9fb6ac), WORD(0x86d96865), WORD(0x7c3f7c7b), WORD(0x3d2b5bfe),
+	WORD(0xea7f6e94), WORD(0xec83e1bf), WORD(0xaf74157b), WORD(0x003629b7),
+	WORD(0x446fbfb0), WORD(0x217fc354), WORD(0xf4f4c214), WORD(0x05b38306),
+	/* T[15] */
+	WORD(0xa59df7cd), WORD(0xed554386), WORD(0x811541af), WORD(0x286e3775),
+	WORD(0xec12948a), WORD(0x40d86dea), WORD(0xf6c90876), WORD(0x289198e1),
+	WORD(0x5c084c63), WORD(0x41fceaf8), WORD(0xa4510bf5), WORD(0x229cbbcc),
+	WORD(0x23c0525e), WORD(0x94b01476), WORD(0x1787d466), WORD(0xf2632c64),
+	WORD(0xf3551365), WORD(0x2b6f87f0), WORD(0xda097fb3), WORD(0x35eb15a7),
+	WORD(0xe94d46b1), WORD(0x1107fa7c), WORD(0xa3dd92cb), WORD(0x88f8616e),
+	/* T[16] */
+	WORD(0xf1acd259), WORD(0xbdede1e0), WORD(0xd32abe8f), WORD(0x28dc6a5a),
+	WORD(0x11aba5b8), WORD(0x4a23c502), WORD(0xb2078caf), WORD(0x133e7d7a),
+	WORD(0xc86c42b5), WORD(0x012ba873), WORD(0xf03a70ab), WORD(0x2d18e4e4),
+	WORD(0x5f9d01a1), WORD(0xa6d05d50), WORD(0x6362fa08), WORD(0x6efd504a),
+	WORD(0x9b0286a5), WORD(0xea93c362), WORD(0xa7053d81), WORD(0x68da01ab),
+	WORD(0x2478d73c), WORD(0x10898c99), WORD(0xc7f5156f), WORD(0x7a106501),
+	/* T[17] */
+	WORD(0xe286817f), WORD(0x78c26bdd), WORD(0x2e8a23a5), WORD(0xb539f34a),
+	WORD(0xdd0924b8), WORD(0xc07b9689), WORD(0x0a54676b), WORD(0x092293a7),
+	WORD(0x243148f4), WORD(0xe25cbc8a), WORD(0x190015e8), WORD(0x3e7914ab),
+	WORD(0x39bb0bd2), WORD(0xda3a85e7), WORD(0x7b68b720), WORD(0xa8eafb3b),
+	WORD(0x4c075072), WORD(0xc9cca656), WORD(0x2d7c7d51), WORD(0x523610f1),
+	WORD(0x49f67b6f), WORD(0xee106336), WORD(0x0911023c), WORD(0x333914b4),
+	/* T[18] */
+	WORD(0x2d345cea), WORD(0xc2b94d05), WORD(0xd3a68625), WORD(0x8484cbed),
+	WORD(0x537d2dee), WORD(0x97df4aa3), WORD(0x08118112), WORD(0x4559bff0),
+	WORD(0x20a59596), WORD(0x7c5129fc), WORD(0x3444a9ea), WORD(0x364bf7fc),
+	WORD(0x4431a7c9), WORD(0x9539d751), WORD(0x99911107), WORD(0x8c172f17),
+	WORD(0x609aa784), WORD(0xcac132a2), WORD(0xd0d841c1), WORD(0x5edea789),
+	WORD(0x8572ac3e), WORD(0xfada0187), WORD(0x6f166735), WORD(0x7666ea38),
+	/* T[19] */
+	WORD(0xc307d820), WORD(0xd80a288a), WORD(0x75e698b2), WORD(0xe44e163d),
+	WORD(0x4d1be8da), WORD(0x627287ce), WORD(0xd7dcb65f), WORD(0x502a4f55),
+	WORD(0x7c3d6696), WORD(0x75a266f3), WORD(0xcec1d729), WORD(0x597efcd9),
+	WORD(0xd148065a), WORD(0xf7c6f0af), WORD(0x03493d2b), WORD(0x0e954852),
+	WORD(0x2639e376), WORD(0x8799ed45), WORD(0x8a966270), WORD(0x12c1472f),
+	WORD(0x0c72843c), WORD(0xcd7e0a3c), WORD(0x0b2a255a), WORD(0x4f750387),
+	/* T[20] */
+	WORD(0x5ca6ec0c), WORD(0x08be784d), WORD(0x5cb0cd44), WORD(0xa4710846),
+	WORD(0x0064aa25), WORD(0xcb4c2949), WORD(0xf53669e7), WORD(0x5ddaa186),
+	WORD(0x9c2abfc5), WORD(0x813e3dfb), WORD(0x54c09ac1), WORD(0x3f16cfaa),
+	WORD(0xb83d52c2), WORD(0x247dcb85), WORD(0xb88cbcb1), WORD(0xe7743c82),
+	WORD(0xa5dc44eb), WORD(0x5a159df3), WORD(0x9cca0b30), WORD(0xbe588fc4),
+	WORD(0x1b87ab30), WORD(0x2ee06dde), WORD(0x7c564ce4), WORD(0x0c9951c7),
+	/* T[21] */
+	WORD(0x0d1fba7a), WORD(0xfc760563), WORD(0x2347ce1a), WORD(0xd9599659),
+	WORD(0xc4d8ccc1), WORD(0xc9d178ac), WORD(0xec0e5a0a), WORD(0xed2dac93),
+	WORD(0xa6d55cc8), WORD(0x9044d97d), WORD(0x02d852af), WORD(0x68c6a8a6),
+	WORD(0x2fcfde05), WORD(0xbea781ef), WORD(0x1a755efe), WORD(0x510d16ae),
+	WORD(0xc630694f), WORD(0xa01943b5), WORD(0x23bc09ec), WORD(0x8f897ff2),
+	WORD(0x0e7bd6c3), WORD(0xcd149022), WORD(0x1263f70f), WORD(0x1951337c),
+	/* T[22] */
+	WORD(0x910a9bdc), WORD(0xc4e8bf16), WORD(0xca8b103e), WORD(0x2ee6f54c),
+	WORD(0x30f47c40), WORD(0x79f38d3b), WORD(0x76526c1a), WORD(0x9ab89a26),
+	WORD(0xdf162aa5), WORD(0x06d374bc), WORD(0x72ff6439), WORD(0x5edda2f9),
+	WORD(0xe39e66e2), WORD(0x10eeef96), WORD(0x989a14af), WORD(0x430aa499),
+	WORD(0xd5124d80), WORD(0xadaaf1ab), WORD(0x41b59f4a), WORD(0xb6d8f2c2),
+	WORD(0x5fc274d9), WORD(0xb1058388), WORD(0xe120e0c3), WORD(0x073b916e),
+	/* T[23] */
+	WORD(0x9853046f), WORD(0x2530df4f), WORD(0xa4516bcc), WORD(0x22fe885a),
+	WORD(0xb8fef106), WORD(0x274cca89), WORD(0x6d20442e), WORD(0xb8907b57),
+	WORD(0xa7a5b093), WORD(0x1d8e88ff), WORD(0xfee89fa8), WORD(0x81afa22e),
+	WORD(0x64d21c0a), WORD(0x786e73af), WORD(0xf9117eb7), WORD(0x52f43665),
+	WORD(0x86f2df8f), WORD(0xe7bb5d42), WORD(0x79249e04), WORD(0x652e59c4),
+	WORD(0x60b51f0c), WORD(0x9fdc1216), WORD(0x54ccaa20), WORD(0x43c9144b),
+	/* T[24] */
+	WORD(0x1d6ff19b), WORD(0x76edbb40), WORD(0x120293ab), WORD(0x058c984a),
+	WORD(0x01b7b6f6), WORD(0x2a1d5dee), WORD(0x0117d608), WORD(0x2f7cb0ca),
+	WORD(0xab656bd9), WORD(0x2afc4ac2), WORD(0x88d78d41), WORD(0x73cabc15),
+	WORD(0xf50d685e), WORD(0x5698933d), WORD(0x8cab3342), WORD(0x51248e3c),
+	WORD(0x3f360e0d), WORD(0xcbbca194), WORD(0xc7e59c24), WORD(0xf1461969),
+	WORD(0xa73523c2), WORD(0xcef5ec44), WORD(0xb5bb410a), WORD(0x7e038a1d),
+	/* T[25] */
+	WORD(0x9c914f20), WORD(0x332e4a7d), WORD(0xb999a35f), WORD(0x2524930d),
+	WORD(0x85d108c2), WORD(0x66624d40), WORD(0x76d3ad9f), WORD(0x7b486f1d),
+	WORD(0x9e026ce3), WORD(0x191c37e6), WORD(0x66ac442c), WORD(0x0a093d8c),
+	WORD(0x97a59478), WORD(0x2391cbdb), WORD(0x2e285af0), WORD(0xcf44579f),
+	WORD(0xb60633c1), WORD(0xcbdd4a9d), WORD(0x19801f3f), WORD(0x53193b27),
+	WORD(0xff524c98), WORD(0xaeb24501), WORD(0x95e3d1f0), WORD(0x8be10778),
+	/* T[26] */
+	WORD(0xf3947c24), WORD(0xbd841666), WORD(0x5a92272f), WORD(0x8400b1dc),
+	WORD(0x2c998354), WORD(0x9f7f4dd3), WORD(0xc3d24e96), WORD(0x6e0c84d2),
+	WORD(0xaed04bfc), WORD(0x6204ee61), WORD(0x9af8e54d), WORD(0x65638094),
+	WORD(0x00adb50b), WORD(0x89529f85), WORD(0x2d15b79f), WORD(0x22f32132),
+	WORD(0x3d0012be), WORD(0x6c4e20fc), WORD(0x582fd197), WORD(0xa4c4521f),
+	WORD(0x64c9521e), WORD(0x2e2b26b6), WORD(0xf76675b7), WORD(0x6ecc6de8),
+	/* T[27] */
+	WORD(0x73b467de), WORD(0x0c6d6766), WORD(0x05b017ed), WORD(0x5aaf5963),
+	WORD(0xa1cc5088), WORD(0x7b25f923), WORD(0xcab5a7b2), WORD(0x7690d039),
+	WORD(0x9b0f224b), WORD(0x50be98b3), WORD(0x1382dfc5), WORD(0x53131956),
+	WORD(0xdb9d21e1), WORD(0x7117bbe3), WORD(0xf3e98b77), WORD(0xed74ce39),
+	WORD(0x8266a4dd), WORD(0x688d0232), WORD(0x74aafbdc), WORD(0x038c5d16),
+	WORD(0xa0aee647), WORD(0x71b374a4), WORD(0x70c1195e), WORD(0x62b6f9af),
+	/* T[28] */
+	WORD(0xe887ce04), WORD(0x27a88ab1), WORD(0xf5738564), WORD(0x73665632),
+	WORD(0xba33e94b), WORD(0x82fd5c44), WORD(0x775d4034), WORD(0x3929427c),
+	WORD(0xa93011be), WORD(0x7c220ae7), WORD(0xb8aec40a), WORD(0x086eb886),
+	WORD(0xc225ec4a), WORD(0xfd846eab), WORD(0xa5b3e6ae), WORD(0x7493a89a),
+	WORD(0x52941f92), WORD(0xe56597fa), WORD(0x2e937fea), WORD(0x9d5c766a),
+	WORD(0x34e03d4f), WORD(0x50204357), WORD(0xf822d937), WORD(0x1ab46463),
+	/* T[29] */
+	WORD(0x6affcaba), WORD(0x41de6111), WORD(0xf07d9831), WORD(0xe33df98f),
+	WORD(0x8ddb8ad6), WORD(0xbe3f3491), WORD(0x6b2d9a28), WORD(0xd09a224f),
+	WORD(0x48b96ffd), WORD(0x21734bc0), WORD(0x911e26e0), WORD(0x7d15f695),
+	WORD(0x5b1c549f), WORD(0x19fe5117), WORD(0x25b4c7dc), WORD(0x97692c59),
+	WORD(0x169d6ace), WORD(0x34c84046), WORD(0x5b0615a3), WORD(0x40ffba31),
+	WORD(0x777375d5), WORD(0x32341300), WORD(0x0ee99724), WORD(0x7726b0d2),
+	/* T[30] */
+	WORD(0x81e333f4), WORD(0x18df7bcd), WORD(0x060d6525), WORD(0x6b78af93),
+	WORD(0xc625220b), WORD(0x66ec2757), WORD(0xc79adf88), WORD(0x0e10447b),
+	WORD(0x165ae015), WORD(0x31e38428), WORD(0x37b5b8cc), WORD(0x8bb6c6a1),
+	WORD(0xb2e8f1c1), WORD(0x00e76eae), WORD(0xc23fd224), WORD(0xc6b8a904),
+	WORD(0xef1dd56a), WORD(0xf58c3d05), WORD(0x469b43b6), WORD(0x00cdde01),
+	WORD(0xddeea1a6), WORD(0x91a04de7), WORD(0x1f122c63), WORD(0x7a6a8da6),
+	/* T[31] */
+	WORD(0xd2e395e2), WORD(0xb0aec98e), WORD(0xaa53a372), WORD(0x572bcc81),
+	WORD(0x72d4e8f9), WORD(0xc294d151), WORD(0xddafe4d5), WORD(0xf8652b0e),
+	WORD(0x7c2369e0), WORD(0xeefc9ce4), WORD(0xa66ff303), WORD(0x4183a54e),
+	WORD(0xdd997d74), WORD(0xdf37960f), WORD(0xd8164798), WORD(0xc2d29548),
+	WORD(0xf003c8b0), WORD(0xbe94f487), WORD(0x30b6799a), WORD(0xdc7a43e4),
+	WORD(0x61e91a50), WORD(0xe0ec94ed), WORD(0xf0ea059a), WORD(0x3e50202c),
+};
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+static const word_t brainpoolp384r1_gen_comb[] = {
+	/* T[0] */
+	WORD(0x5c45), WORD(0xf3f8), WORD(0x3207), WORD(0x5d82), WORD(0x301e), WORD(0x62ff),
+	WORD(0x3b20), WORD(0x71e4), WORD(0x9300), WORD(0x93d1), WORD(0x133b), WORD(0x80f3),
+	WORD(0xa70b), WORD(0x4fde), WORD(0x09d1), WORD(0x8e89), WORD(0x1ab0), WORD(0x9cde),
+	WORD(0x4249), WORD(0x2377), WORD(0x0265), WORD(0xb0c0), WORD(0x3599), WORD(0x48c5),
+	WORD(0xa382), WORD(0xc210), WORD(0x17ea), WORD(0x25a3), WORD(0xdae3), WORD(0x20e9),
+	WORD(0x7a5c), WORD(0xb0f7), WORD(0xba03), WORD(0x3eb8), WORD(0x5b60), WORD(0xb54b),
+	WORD(0xf176), WORD(0xe881), WORD(0x8a11), WORD(0xd696), WORD(0xd60b), WORD(0x60ab),
+	WORD(0xcda2), WORD(0x5dec), WORD(0x3d4c), WORD(0x4da9), WORD(0x78dd), WORD(0x6d2d),
+	/* T[1] */
+	WORD(0xc733), WORD(0xd974), WORD(0xb41f), WORD(0x33f5), WORD(0xe320), WORD(0x620e),
+	WORD(0xd6c9), WORD(0xa200), WORD(0x5be4), WORD(0x069a), WORD(0x0bf8), WORD(0x84b9),
+	WORD(0x53a1), WORD(0x0373), WORD(0xb6b3), WORD(0x829a), WORD(0x306a), WORD(0x9296),
+	WORD(0xcc74), WORD(0x403e), WORD(0x35d9), WORD(0x22e9), WORD(0x0fee), WORD(0x4016),
+	WORD(0xc246), WORD(0x03ab), WORD(0xce4d), WORD(0x2ae7), WORD(0xe949), WORD(0x21de),
+	WORD(0xff44), WORD(0x9755), WORD(0xe65f), WORD(0x4c32), WORD(0x2b23), WORD(0x8647),
+	WORD(0xc027), WORD(0x59fd), WORD(0x6b56), WORD(0x2f23), WORD(0x9f5d), WORD(0xd9e1),
+	WORD(0x0675), WORD(0x4a88), WORD(0x5f6e), WORD(0x1653), WORD(0x2936), WORD(0x46f2),
+	/* T[2] */
+	WORD(0x32c2), WORD(0x51ee), WORD(0x56c3), WORD(0xf447), WORD(0xe593), WORD(0x2941),
+	WORD(0x80d2), WORD(0x86ee), WORD(0xbb1d), WORD(0x455e), WORD(0xd364), WORD(0x5fa3),
+	WORD(0xf827), WORD(0x1db6), WORD(0x7fc4), WORD(0x4175), WORD(0x5c62), WORD(0xd8b5),
+	WORD(0x6567), WORD(0x5347), WORD(0x7113), WORD(0x1d6e), WORD(0x983d), WORD(0x0a14),
+	WORD(0x0ea7), WORD(0x4d56), WORD(0x803e), WORD(0x1e67), WORD(0xa7ab), WORD(0xc49c),
+	WORD(0x45d0), WORD(0x6359), WORD(0xda83), WORD(0x9bde), WORD(0x4cdb), WORD(0x54de),
+	WORD(0x667d), WORD(0x89ca), WORD(0x469c), WORD(0x3283), WORD(0x49c7), WORD(0x17bb),
+	WORD(0xf500), WORD(0xdfe4), WORD(0x59df), WORD(0xcb8f), WORD(0x3a31), WORD(0x281b),
+	/* T[3] */
+	WORD(0x0419), WORD(0x6b1e), WORD(0xd6dd), WORD(0x199e), WORD(0xe1fc), WORD(0x4fca),
+	WORD(0x653c), WORD(0x12b7), WORD(0x6caa), WORD(0x5553), WORD(0x3ac6), WORD(0x7f15),
+	WORD(0xf988), WORD(0xb905), WORD(0x2678), WORD(0xb2b4), WORD(0x305c), WORD(0x53cb),
+	WORD(0x0535), WORD(0x7d6c), WORD(0xeb84), WORD(0x4f42), WORD(0x40f6), WORD(0x6d83),
+	WORD(0x4239), WORD(0xdae4), WORD(0x2e48), WORD(0x5836), WORD(0x946a), WORD(0x8c0b),
+	WORD(0x7dc6), WORD(0x965e), WORD(0x07fe), WORD(0x86da), WORD(0x119b), WORD(0x5040),
+	WORD(0x5715), WORD(0xcf81), WORD(0x3d2c), WORD(0x4aaf), WORD(0xf6e5), WORD(0x7a21),
+	WORD(0x6939), WORD(0x7b59), WORD(0x22c8), WORD(0x4cbb), WORD(0xd949), WORD(0x43ea),
+	/* T[4] */
+	WORD(0x95f5), WORD(0x1667), WORD(0x8ffb), WORD(0x1fc2), WORD(0xf590), WORD(0x9b9a),
+	WORD(0x50dc), WORD(0x0832), WORD(0x9996), WORD(0xdf35), WORD(0x0027), WORD(0xef50),
+	WORD(0x8908), WORD(0x797e), WORD(0xc407), WORD(0x8150), WORD(0xf6ab), WORD(0x6f89),
+	WORD(0x8d48), WORD(0x2538), WORD(0x585c), WORD(0xa479), WORD(0xf46e), WORD(0x32d8),
+	WORD(0xa2a1), WORD(0xdb66), WORD(0x3f23), WORD(0x6912), WORD(0x3a1d), WORD(0xb34a),
+	WORD(0xbe80), WORD(0xc554), WORD(0xc979), WORD(0x0ee0), WORD(0x3ab8), WORD(0x99e1),
+	WORD(0x0ad3), WORD(0x5db0), WORD(0x85a1), WORD(0xd8f8), WORD(0xf4bf), WORD(0xf67d),
+	WORD(0x2aec), WORD(0xbd0d), WORD(0x3a68), WORD(0x2547), WORD(0xe742), WORD(0x4c09),
+	/* T[5] */
+	WORD(0xe08b), WORD(0xe1e0), WORD(0x924f), WORD(0x75a7), WORD(0x6b4f), WORD(0x5689),
+	WORD(0x65a2), WORD(0x8a94), WORD(0xfe3a), WORD(0x6ce2), WORD(0x54c9), WORD(0x1e64),
+	WORD(0x60e1), WORD(0x7e4b), WORD(0x07b3), WORD(0xe85a), WORD(0xb201), WORD(0x179d),
+	WORD(0x1d81), WORD(0xce6f), WORD(0x8c83), WORD(0x3ac8), WORD(0x4901), WORD(0x2aff),
+	WORD(0x9043), WORD(0x0dae), WORD(0xe5c5), WORD(0x80e1), WORD(0xc55d), WORD(0x9a66),
+	WORD(0x78f7), WORD(0x10ec), WORD(0xffb8), WORD(0x965f), WORD(0x6aee), WORD(0x3a93),
+	WORD(0x8108), WORD(0xc596), WORD(0xa27c), WORD(0x38f1), WORD(0xe5a0), WORD(0x50e5),
+	WORD(0xe3f0), WORD(0x01d0), WORD(0xe271), WORD(0x3fbc), WORD(0x00b2), WORD(0x771e),
+	/* T[6] */
+	WORD(0x2dd7), WORD(0x94a5), WORD(0x233b), WORD(0xfb74), WORD(0xaedf), WORD(0xe1e0),
+	WORD(0x37d8), WORD(0xd68e), WORD(0x1e0a), WORD(0xf19a), WORD(0xd6ed), WORD(0x897a),
+	WORD(0xb4b1), WORD(0x8ac9), WORD(0xb091), WORD(0x9104), WORD(0x70d9), WORD(0xd048),
+	WORD(0x7a49), WORD(0x1915), WORD(0xfadb), WORD(0x8b17), WORD(0x31d7), WORD(0x459e),
+	WORD(0x7e8c), WORD(0x014c), WORD(0x972e), WORD(0x3473), WORD(0x3c17), WORD(0xa0e8),
+	WORD(0x4956), WORD(0x4752), WORD(0x5245), WORD(0xba46), WORD(0x0e5f), WORD(0x9f42),
+	WORD(0xfa32), WORD(0x50e3), WORD(0x402e), WORD(0x3e81), WORD(0x013a), WORD(0xa1b7),
+	WORD(0x9723), WORD(0x243d), WORD(0x7a6b), WORD(0x87e3), WORD(0x5aab), WORD(0x1628),
+	/* T[7] */
+	WORD(0x85e2), WORD(0xef07), WORD(0x4a29), WORD(0x31cb), WORD(0x4b56), WORD(0x479b),
+	WORD(0x71b9), WORD(0x5b6f), WORD(0x02e0), WORD(0x7a35), WORD(0x0817), WORD(0x9595),
+	WORD(0x94d4), WORD(0x7f14), WORD(0xebb7), WORD(0x1989), WORD(0xbd54), WORD(0x535a),
+	WORD(0x15f0), WORD(0x0c4c), WORD(0xa815), WORD(0x88d2), WORD(0x30ab), WORD(0x82f2),
+	WORD(0x27cb), WORD(0xcf1f), WORD(0xaf86), WORD(0x6a98), WORD(0xbb19), WORD(0xed6c),
+	WORD(0x0aca), WORD(0x9800), WORD(0x1bc3), WORD(0xd841), WORD(0x786d), WORD(0xc058),
+	WORD(0xa322), WORD(0xdbc1), WORD(0xaa20), WORD(0xa679), WORD(0xfb9d), WORD(0x1a13),
+	WORD(0x82f3), WORD(0x103a), WORD(0xde0f), WORD(0x9c7f), WORD(0xa80a), WORD(0x363a),
+	/* T[8] */
+	WORD(0xe46c), WORD(0x1a3a), WORD(0xd62e), WORD(0x9606), WORD(0xb38e), WORD(0x6d3e),
+	WORD(0x4e42), WORD(0xdb29), WORD(0xdeb8), WORD(0x56c0), WORD(0x5e69), WORD(0x15c4),
+	WORD(0xd6dc), WORD(0xf01d), WORD(0xef6c), WORD(0x1007), WORD(0x49da), WORD(0x9990),
+	WORD(0x8e9f), WORD(0xca71), WORD(0xfc71), WORD(0xa9d0), WORD(0x647d), WORD(0x4db1),
+	WORD(0xa223), WORD(0xbb83), WORD(0xf61f), WORD(0xe5f6), WORD(0x214c), WORD(0x4d4f),
+	WORD(0x79a7), WORD(0x2091), WORD(0x9aad), WORD(0xe1c9), WORD(0x81a0), WORD(0xe10b),
+	WORD(0xa7f4), WORD(0xcee1), WORD(0x9cab), WORD(0xe138), WORD(0x9ea0), WORD(0x27b1),
+	WORD(0x8cf0), WORD(0x450b), WORD(0x3592), WORD(0x601d), WORD(0x2aa1), WORD(0x1f71),
+	/* T[9] */
+	WORD(0xeae4), WORD(0x7f86), WORD(0x2c04), WORD(0xedbe), WORD(0x8f09), WORD(0x9862),
+	WORD(0xd712), WORD(0x73dc), WORD(0x6f2f), WORD(0x6f59), WORD(0xe3f8), WORD(0xcc85),
+	WORD(0xd31e), WORD(0x7e67), WORD(0xe330), WORD(0x3c34), WORD(0x92a1), WORD(0xc389),
+	WORD(0x40e8), WORD(0x9e25), WORD(0xaf4c), WORD(0x7f02), WORD(0x0db5), WORD(0x1cfe),
+	WORD(0xaf9e), WORD(0x812d), WORD(0xaac2), WORD(0x1859), WORD(0x0191), WORD(0xbb9f),
+	WORD(0xc949), WORD(0xda73), WORD(0xd3bc), WORD(0xc18c), WORD(0x08c5), WORD(0x6ea0),
+	WORD(0xca04), WORD(0x8b4f), WORD(0x4bdf), WORD(0x8039), WORD(0x39f0), WORD(0xdeb7),
+	WORD(0xfbd3), WORD(0xccd6), WORD(0xba2a), WORD(0x6c11), WORD(0x4892), WORD(0x6a65),
+	/* T[10] */
+	WORD(0xba52), WORD(0xa5b1), WORD(0xe88a), WORD(0x455d), WORD(0x18ca), WORD(0x7d64),
+	WORD(0x5ac5), WORD(0x4371), WORD(0x5125), WORD(0x43d6), WORD(0x3cb0), WORD(0x2923),
+	WORD(0x007c), WORD(0xd7aa), WORD(0xf968), WORD(0x0923), WORD(0x0695), WORD(0x5de3),
+	WORD(0x52f2), WORD(0x4538), WORD(0xf04b), WORD(0xbce0), WORD(0xc4a8), WORD(0x8668),
+	WORD(0x5dde), WORD(0xf66d), WORD(0x4ca6), WORD(0x40ff), WORD(0x766d), WORD(0x17f7),
+	WORD(0x54c5), WORD(0x3243), WORD(0x1871), WORD(0x2924), WORD(0x4cb6), WORD(0x6eb8),
+	WORD(0x21c8), WORD(0x5172), WORD(0x6ec9), WORD(0x1476), WORD(0xf829), WORD(0xdc25),
+	WORD(0x63bd), WORD(0x0596), WORD(0x5663), WORD(0x5960), WORD(0x9332), WORD(0x5445),
+	/* T[11] */
+	WORD(0x2f29), WORD(0x6dca), WORD(0x1dad), WORD(0xc96d), WORD(0xf61b), WORD(0x522b),
+	WORD(0xa329), WORD(0x5434), WORD(0x4e6e), WORD(0xfef7), WORD(0x2cad), WORD(0xe320),
+	WORD(0x40ac), WORD(0x6d47), WORD(0xdef2), WORD(0x21ee), WORD(0x6a08), WORD(0xe0c7),
+	WORD(0xb352), WORD(0x7e0d), WORD(0x2fd1), WORD(0x3912), WORD(0xf723), WORD(0x0fa8),
+	WORD(0xeba4), WORD(0xba8b), WORD(0x3f16), WORD(0x5953), WORD(0x0fcb), WORD(0xd808),
+	WORD(0x9235), WORD(0x0857), WORD(0xbc3d), WORD(0xca1c), WORD(0x6baf), WORD(0x6faf),
+	WORD(0x6da9), WORD(0x7b49), WORD(0xf4d4), WORD(0x6c47), WORD(0x8b1f), WORD(0x8fec),
+	WORD(0xa397), WORD(0x3f34), WORD(0x5245), WORD(0x224d), WORD(0x7e7b), WORD(0x8717),
+	/* T[12] */
+	WORD(0xa864), WORD(0x4883), WORD(0xadba), WORD(0x60d9), WORD(0x4cf3), WORD(0xd158),
+	WORD(0x6fe7), WORD(0x4418), WORD(0xeefe), WORD(0xb7f3), WORD(0x3c51), WORD(0x8684),
+	WORD(0x821b), WORD(0xe1d4), WORD(0xe777), WORD(0x4e7f), WORD(0xad85), WORD(0x0bf4),
+	WORD(0x83a7), WORD(0x3bd4), WORD(0x01f3), WORD(0x07a3), WORD(0x9b31), WORD(0x81f5),
+	WORD(0x42f5), WORD(0x9505), WORD(0xbfcf), WORD(0x21e7), WORD(0x1c7e), WORD(0x0816),
+	WORD(0x5801), WORD(0x8d61), WORD(0x39b2), WORD(0x0839), WORD(0x8dfd), WORD(0x6a0a),
+	WORD(0xfc01), WORD(0x1667), WORD(0x82a6), WORD(0xfdc2), WORD(0x24bc), WORD(0x4367),
+	WORD(0x0bee), WORD(0x9ab2), WORD(0x2972), WORD(0x0bce), WORD(0xad0c), WORD(0x4a84),
+	/* T[13] */
+	WORD(0x0c80), WORD(0xd4bb), WORD(0x6dac), WORD(0x3160), WORD(0xd681), WORD(0x59d3),
+	WORD(0x49df), WORD(0x5706), WORD(0xd3c5), WORD(0x666e), WORD(0x4e98), WORD(0xdab4),
+	WORD(0x2bd7), WORD(0x9dd3), WORD(0x9e2a), WORD(0x4bc7), WORD(0xf784), WORD(0x82e9),
+	WORD(0xbf4a), WORD(0x1842), WORD(0x450a), WORD(0x940f), WORD(0x7638), WORD(0x6617),
+	WORD(0x4976), WORD(0x60f7), WORD(0xb359), WORD(0x2877), WORD(0x9c98), WORD(0xf946),
+	WORD(0x6bb8), WORD(0x1e00), WORD(0xd643), WORD(0x7f35), WORD(0xe580), WORD(0x5e5f),
+	WORD(0x3787), WORD(0xd3c4), WORD(0xbee9), WORD(0x407c), WORD(0xc2dc), WORD(0xec33),
+	WORD(0x7d06), WORD(0x5aae), WORD(0x57f4), WORD(0xa1d4), WORD(0x35c4), WORD(0x7ae1),
+	/* T[14] */
+	WORD(0x03b2), WORD(0xe450), WORD(0xbd9d), WORD(0x872c), WORD(0x6d08), WORD(0x47af),
+	WORD(0xa3cc), WORD(0x0633), WORD(0x2d27), WORD(0xa91d), WORD(0x8dd7), WORD(0xfc02),
+	WORD(0x2757), WORD(0xdb90), WORD(0x515e), WORD(0x3001), WORD(0xf7ca), WORD(0x89d5),
+	WORD(0x3722), WORD(0x5620), WORD(0x4548), WORD(0xc6ef), WORD(0x6154), WORD(0x1337),
+	WORD(0xb6ac), WORD(0xac9f), WORD(0x6865), WORD(0x86d9), WORD(0x7c7b), WORD(0x7c3f),
+	WORD(0x5bfe), WORD(0x3d2b), WORD(0x6e94), WORD(0xea7f), WORD(0xe1bf), WORD(0xec83),
+	WORD(0x157b), WORD(0xaf74), WORD(0x29b7), WORD(0x0036), WORD(0xbfb0), WORD(0x446f),
+	WORD(0xc354), WORD(0x217f), WORD(0xc214), WORD(0xf4f4), WORD(0x8306), WORD(0x05b3),
+	/* T[15] */
+	WORD(0xf7cd), WORD(0xa59d), WORD(0x4386), WORD(0xed55), WORD(0x41af), WORD(0x8115),
+	WORD(0x3775), WORD(0x286e), WORD(0x948a), WORD(0xec12), WORD(0x6dea), WORD(0x40d8),
+	WORD(0x0876), WORD(0xf6c9), WORD(0x98e1), WORD(0x2891), WORD(0x4c63), WORD(0x5c08),
+	WORD(0xeaf8), WORD(0x41fc), WORD(0x0bf5), WORD(0xa451), WORD(0xbbcc), WORD(0x229c),
+	WORD(0x525e), WORD(0x23c0), WORD(0x1476), WORD(0x94b0), WORD(0xd466), WORD(0x1787),
+	WORD(0x2c64), WORD(0xf263), WORD(0x1365), WORD(0xf355), WORD(0x87f0), WORD(0x2b6f),
+	WORD(0x7fb3), WORD(0xda09), WORD(0x15a7), WORD(0x35eb), WORD(0x46b1), WORD(0xe94d),
+	WORD(0xfa7c), WORD(0x1107), WORD(0x92cb), WORD(0xa3dd), WORD(0x616e), WORD(0x88f8),
+	/* T[16] */
+	WORD(0xd259), WORD(0xf1ac), WORD(0xe1e0), WORD(0xbded), WORD(0xbe8f), WORD(0xd32a),
+	WORD(0x6a5a), WORD(0x28dc), WORD(0xa5b8), WORD(0x11ab), WORD(0xc502), WORD(0x4a23),
+	WORD(0x8caf), WORD(0xb207), WORD(0x7d7a), WORD(0x133e), WORD(0x42b5), WORD(0xc86c),
+	WORD(0xa873), WORD(0x012b), WORD(0x70ab), WORD(0xf03a), WORD(0xe4e4), WORD(0x2d18),
+	WORD(0x01a1), WORD(0x5f9d), WORD(0x5d50), WORD(0xa6d0), WORD(0xfa08), WORD(0x6362),
+	WORD(0x504a), WORD(0x6efd), WORD(0x86a5), WORD(0x9b02), WORD(0xc362), WORD(0xea93),
+	WORD(0x3d81), WORD(0xa705), WORD(0x01ab), WORD(0x68da), WORD(0xd73c), WORD(0x2478),
+	WORD(0x8c99), WORD(0x1089), WORD(0x156f), WORD(0xc7f5), WORD(0x6501), WORD(0x7a10),
+	/* T[17] */
+	WORD(0x817f), WORD(0xe286), WORD(0x6bdd), WORD(0x78c2), WORD(0x23a5), WORD(0x2e8a),
+	WORD(0xf34a), WORD(0xb539), WORD(0x24b8), WORD(0xdd09), WORD(0x9689), WORD(0xc07b),
+	WORD(0x676b), WORD(0x0a54), WORD(0x93a7), WORD(0x0922), WORD(0x48f4), WORD(0x2431),
+	WORD(0xbc8a), WORD(0xe25c), WORD(0x15e8), WORD(0x1900), WORD(0x14ab), WORD(0x3e79),
+	WORD(0x0bd2), WORD(0x39bb), WORD(0x85e7), WORD(0xda3a), WORD(0xb720), WORD(0x7b68),
+	WORD(0xfb3b), WORD(0xa8ea), WORD(0x5072), WORD(0x4c07), WORD(0xa656), WORD(0xc9cc),
+	WORD(0x7d51), WORD(0x2d7c), WORD(0x10f1), WORD(0x5236), WORD(0x7b6f), WORD(0x49f6),
+	WORD(0x6336), WORD(0xee10), WORD(0x023c), WORD(0x0911), WORD(0x14b4), WORD(0x3339),
+	/* T[18] */
+	WORD(0x5cea), WORD(0x2d34), WORD(0x4d05), WORD(0xc2b9), WORD(0x8625), WORD(0xd3a6),
+	WORD(0xcbed), WORD(0x8484), WORD(0x2dee), WORD(0x537d), WORD(0x4aa3), WORD(0x97df),
+	WORD(0x8112), WORD(0x0811), WORD(0xbff0), WORD(0x4559), WORD(0x9596), WORD(0x20a5),
+	WORD(0x29fc), WORD(0x7c51), WORD(0xa9ea), WORD(0x3444), WORD(0xf7fc), WORD(0x364b),
+	WORD(0xa7c9), WORD(0x4431), WORD(0xd751), WORD(0x9539), WORD(0x1107), WORD(0x9991),
+	WORD(0x2f17), WORD(0x8c17), WORD(0xa784), WORD(0x609a), WORD(0x32a2), WORD(0xcac1),
+	WORD(0x41c1), WORD(0xd0d8), WORD(0xa789), WORD(0x5ede), WORD(0xac3e), WORD(0x8572),
+	WORD(0x0187), WORD(0xfada), WORD(0x6735), WORD(0x6f16), WORD(0xea38), WORD(0x7666),
+	/* T[19] */
+	WORD(0xd820), WORD(0xc307), WORD(0x288a), WORD(0xd80a), WORD(0x98b2), WORD(0x75e6),
+	WORD(0x163d), WORD(0xe44e), WORD(0xe8da), WORD(0x4d1b), WORD(0x87ce), WORD(0x6272),
+	WORD(0xb65f), WORD(0xd7dc), WORD(0x4f55), WORD(0x502a), WORD(0x6696), WORD(0x7c3d),
+	WORD(0x66f3), WORD(0x75a2), WORD(0xd729), WORD(0xcec1), WORD(0xfcd9), WORD(0x597e),
+	WORD(0x065a), WORD(0xd148), WORD(0xf0af), WORD(0xf7c6), WORD(0x3d2b), WORD(0x0349),
+	WORD(0x4852), WORD(0x0e95), WORD(0xe376), WORD(0x2639), WORD(0xed45), WORD(0x8799),
+	WORD(0x6270), WORD(0x8a96), WORD(0x472f), WORD(0x12c1), WORD(0x843c), WORD(0x0c72),
+	WORD(0x0a3c), WORD(0xcd7e), WORD(0x255a), WORD(0x0b2a), WORD(0x0387), WORD(0x4f75),
+	/* T[20] */
+	WORD(0xec0c), WORD(0x5ca6), WORD(0x784d), WORD(0x08be), WORD(0xcd44), WORD(0x5cb0),
+	WORD(0x0846), WORD(0xa471), WORD(0xaa25), WORD(0x0064), WORD(0x2949), WORD(0xcb4c),
+	WORD(0x69e7), WORD(0xf536), WORD(0xa186), WORD(0x5dda), WORD(0xbfc5), WORD(0x9c2a),
+	WORD(0x3dfb), WORD(0x813e), WORD(0x9ac1), WORD(0x54c0), WORD(0xcfaa), WORD(0x3f16),
+	WORD(0x52c2), WORD(0xb83d), WORD(0xcb85), WORD(0x247d), WORD(0xbcb1), WORD(0xb88c),
+	WORD(0x3c82), WORD(0xe774), WORD(0x44eb), WORD(0xa5dc), WORD(0x9df3), WORD(0x5a15),
+	WORD(0x0b30), WORD(0x9cca), WORD(0x8fc4), WORD(0xbe58), WORD(0xab30), WORD(0x1b87),
+	WORD(0x6dde), WORD(0x2ee0), WORD(0x4ce4), WORD(0x7c56), WORD(0x51c7), WORD(0x0c99),
+	/* T[21] */
+	WORD(0xba7a), WORD(0x0d1f), WORD(0x0563), WORD(0xfc76), WORD(0xce1a), WORD(0x2347),
+	WORD(0x9659), WORD(0xd959), WORD(0xccc1), WORD(0xc4d8), WORD(0x78ac), WORD(0xc9d1),
+	WORD(0x5a0a), WORD(0xec0e), WORD(0xac93), WORD(0xed2d), WORD(0x5cc8), WORD(0xa6d5),
+	WORD(0xd97d), WORD(0x9044), WORD(0x52af), WORD(0x02d8), WORD(0xa8a6), WORD(0x68c6),
+	WORD(0xde05), WORD(0x2fcf), WORD(0x81ef), WORD(0xbea7), WORD(0x5efe), WORD(0x1a75),
+	WORD(0x16ae), WORD(0x510d), WORD(0x694f), WORD(0xc630), WORD(0x43b5), WORD(0xa019),
+	WORD(0x09ec), WORD(0x23bc), WORD(0x7ff2), WORD(0x8f89), WORD(0xd6c3), WORD(0x0e7b),
+	WORD(0x9022), WORD(0xcd14), WORD(0xf70f), WORD(0x1263), WORD(0x337c), WORD(0x1951),
+	/* T[22] */
+	WORD(0x9bdc), WORD(0x910a), WORD(0xbf16), WORD(0xc4e8), WORD(0x103e), WORD(0xca8b),
+	WORD(0xf54c), WORD(0x2ee6), WORD(0x7c40), WORD(0x30f4), WORD(0x8d3b), WORD(0x79f3),
+	WORD(0x6c1a), WORD(0x7652), WORD(0x9a26), WORD(0x9ab8), WORD(0x2aa5), WORD(0xdf16),
+	WORD(0x74bc), WORD(0x06d3), WORD(0x6439), WORD(0x72ff), WORD(0xa2f9), WORD(0x5edd),
+	WORD(0x66e2), WORD(0xe39e), WORD(0xef96), WORD(0x10ee), WORD(0x14af), WORD(0x989a),
+	WORD(0xa499), WORD(0x430a), WORD(0x4d80), WORD(0xd512), WORD(0xf1ab), WORD(0xadaa),
+	WORD(0x9f4a), WORD(0x41b5), WORD(0xf2c2), WORD(0xb6d8), WORD(0x74d9), WORD(0x5fc2),
+	WORD(0x8388), WORD(0xb105), WORD(0xe0c3), WORD(0xe120), WORD(0x916e), WORD(0x073b),
+	/* T[23] */
+	WORD(0x046f), WORD(0x9853), WORD(0xdf4f), WORD(0x2530), WORD(0x6bcc), WORD(0xa451),
+	WORD(0x885a), WORD(0x22fe), WORD(0xf106), WORD(0xb8fe), WORD(0xca89), WORD(0x274c),
+	WORD(0x442e), WORD(0x6d20), WORD(0x7b57), WORD(0xb890), WORD(0xb093), WORD(0xa7a5),
+	WORD(0x88ff), WORD(0x1d8e), WORD(0x9fa8), WORD(0xfee8), WORD(0xa22e), WORD(0x81af),
+	WORD(0x1c0a), WORD(0x64d2), WORD(0x73af), WORD(0x786e), WORD(0x7eb7), WORD(0xf911),
+	WORD(0x3665), WORD(0x52f4), WORD(0xdf8f), WORD(0x86f2), WORD(0x5d42), WORD(0xe7bb),
+	WORD(0x9e04), WORD(0x7924), WORD(0x59c4), WORD(0x652e), WORD(0x1f0c), WORD(0x60b5),
+	WORD(0x1216), WORD(0x9fdc), WORD(0xaa20), WORD(0x54cc), WORD(0x144b), WORD(0x43c9),
+	/* T[24] */
+	WORD(0xf19b), WORD(0x1d6f), WORD(0xbb40), WORD(0x76ed), WORD(0x93ab), WORD(0x1202),
+	WORD(0x984a), WORD(0x058c), WORD(0xb6f6), WORD(0x01b7), WORD(0x5dee), WORD(0x2a1d),
+	WORD(0xd608), WORD(0x0117), WORD(0xb0ca), WORD(0x2f7c), WORD(0x6bd9), WORD(0xab65),
+	WORD(0x4ac2), WORD(0x2afc), WORD(0x8d41), WORD(0x88d7), WORD(0xbc15), WORD(0x73ca),
+	WORD(0x685e), WORD(0xf50d), WORD(0x933d), WORD(0x5698), WORD(0x3342), WORD(0x8cab),
+	WORD(0x8e3c), WORD(0x5124), WORD(0x0e0d), WORD(0x3f36), WORD(0xa194), WORD(0xcbbc),
+	WORD(0x9c24), WORD(0xc7e5), WORD(0x1969), WORD(0xf146), WORD(0x23c2), WORD(0xa735),
+	WORD(0xec44), WORD(0xcef5), WORD(0x410a), WORD(0xb5bb), WORD(0x8a1d), WORD(0x7e03),
+	/* T[25] */
+	WORD(0x4f20), WORD(0x9c91), WORD(0x4a7d), WORD(0x332e), WORD(0xa35f), WORD(0xb999),
+	WORD(0x930d), WORD(0x2524), WORD(0x08c2), WORD(0x85d1), WORD(0x4d40), WORD(0x6662),
+	WORD(0xad9f), WORD(0x76d3), WORD(0x6f1d), WORD(0x7b48), WORD(0x6ce3), WORD(0x9e02),
+	WORD(0x37e6), WORD(0x191c), WORD(0x442c), WORD(0x66ac), WORD(0x3d8c), WORD(0x0a09),
+	WORD(0x9478), WORD(0x97a5), WORD(0xcbdb), WORD(0x2391), WORD(0x5af0), WORD(0x2e28),
+	WORD(0x579f), WORD(0xcf44), WORD(0x33c1), WORD(0xb606), WORD(0x4a9d), WORD(0xcbdd),
+	WORD(0x1f3f), WORD(0x1980), WORD(0x3b27), WORD(0x5319), WORD(0x4c98), WORD(0xff52),
+	WORD(0x4501), WORD(0xaeb2), WORD(0xd1f0), WORD(0x95e3), WORD(0x0778), WORD(0x8be1),
+	/* T[26] */
+	WORD(0x7c24), WORD(0xf394), WORD(0x1666), WORD(0xbd84), WORD(0x272f), WORD(0x5a92),
+	WORD(0xb1dc), WORD(0x8400), WORD(0x8354), WORD(0x2c99), WORD(0x4dd3), WORD(0x9f7f),
+	WORD(0x4e96), WORD(0xc3d2), WORD(0x84d2), WORD(0x6e0c), WORD(0x4bfc), WORD(0xaed0),
+	WORD(0xee61), WORD(0x6204), WORD(0xe54d), WORD(0x9af8), WORD(0x8094), WORD(0x6563),
+	WORD(0xb50b), WORD(0x00ad), WORD(0x9f85), WORD(0x8952), WORD(0xb79f), WORD(0x2d15),
+	WORD(0x2132), WORD(0x22f3), WORD(0x12be), WORD(0x3d00), WORD(0x20fc), WORD(0x6c4e),
+	WORD(0xd197), WORD(0x582f), WORD(0x521f), WORD(0xa4c4), WORD(0x521e), WORD(0x64c9),
+	WORD(0x26b6), WORD(0x2e2b), WORD(0x75b7), WORD(0xf766), WORD(0x6de8), WORD(0x6ecc),
+	/* T[27] */
+	WORD(0x67de), WORD(0x73b4), WORD(0x6766), WORD(0x0c6d), WORD(0x17ed), WORD(0x05b0),
+	WORD(0x5963), WORD(0x5aaf), WORD(0x5088), WORD(0xa1cc), WORD(0xf923), WORD(0x7b25),
+	WORD(0xa7b2), WORD(0xcab5), WORD(0xd039), WORD(0x7690), WORD(0x224b), WORD(0x9b0f),
+	WORD(0x98b3), WORD(0x50be), WORD(0xdfc5), WORD(0x1382), WORD(0x1956), WORD(0x5313),
+	WORD(0x21e1), WORD(0xdb9d), WORD(0xbbe3), WORD(0x7117), WORD(0x8b77), WORD(0xf3e9),
+	WORD(0xce39), WORD(0xed74), WORD(0xa4dd), WORD(0x8266), WORD(0x0232), WORD(0x688d),
+	WORD(0xfbdc), WORD(0x74aa), WORD(0x5d16), WORD(0x038c), WORD(0xe647), WORD(0xa0ae),
+	WORD(0x74a4), WORD(0x71b3), WORD(0x195e), WORD(0x70c1), WORD(0xf9af), WORD(0x62b6),
+	/* T[28] */
+	WORD(0xce04), WORD(0xe887), WORD(0x8ab1), WORD(0x27a8), WORD(0x8564), WORD(0xf573),
+	WORD(0x5632), WORD(0x7366), WORD(0xe94b), WORD(0xba33), WORD(0x5c44), WORD(0x82fd),
+	WORD(0x4034), WORD(0x775d), WORD(0x427c), WORD(0x3929), WORD(0x11be), WORD(0xa930),
+	WORD(0x0ae7), WORD(0x7c22), WORD(0xc40a), WORD(0xb8ae), WORD(0xb886), WORD(0x086e),
+	WORD(0xec4a), WORD(0xc225), WORD(0x6eab), WORD(0xfd84), WORD(0xe6ae), WORD(0xa5b3),
+	WORD(0xa89a), WORD(0x7493), WORD(0x1f92), WORD(0x5294), WORD(0x97fa), WORD(0xe565),
+	WORD(0x7fea), WORD(0x2e93), WORD(0x766a), WORD(0x9d5c), WORD(0x3d4f), WORD(0x34e0),
+	WORD(0x4357), WORD(0x5020), WORD(0xd937), WORD(0xf822), WORD(0x6463), WORD(0x1ab4),
+	/* T[29] */
+	WORD(0xcaba), WORD(0x6aff), WORD(0x6111), WORD(0x41de), WORD(0x9831), WORD(0xf07d),
+	WORD(0xf98f), WORD(0xe33d), WORD(0x8ad6), WORD(0x8ddb), WORD(0x3491), WORD(0xbe3f),
+	WORD(0x9a28), WORD(0x6b2d), WORD(0x224f), WORD(0xd09a), WORD(0x6ffd), WORD(0x48b9),
+	WORD(0x4bc0), WORD(0x2173), WORD(0x26e0), WORD(0x911e), WORD(0xf695), WORD(0x7d15),
+	WORD(0x549f), WORD(0x5b1c), WORD(0x5117), WORD(0x19fe), WORD(0xc7dc), WORD(0x25b4),
+	WORD(0x2c59), WORD(0x9769), WORD(0x6ace), WORD(0x169d), WORD(0x4046), WORD(0x34c8),
+	WORD(0x15a3), WORD(0x5b06), WORD(0xba31), WORD(0x40ff), WORD(0x75d5), WORD(0x7773),
+	WORD(0x1300), WORD(0x3234), WORD(0x9724), WORD(0x0ee9), WORD(0xb0d2), WORD(0x7726),
+	/* T[30] */
+	WORD(0x33f4), WORD(0x81e3), WORD(0x7bcd), WORD(0x18df), WORD(0x6525), WORD(0x060d),
+	WORD(0xaf93), WORD(0x6b78), WORD(0x220b), WORD(0xc625), WORD(0x2757), WORD(0x66ec),
+	WORD(0xdf88), WORD(0xc79a), WORD(0x447b), WORD(0x0e10), WORD(0xe015), WORD(0x165a),
+	WORD(0x8428), WORD(0x31e3), WORD(0xb8cc), WORD(0x37b5), WORD(0xc6a1), WORD(0x8bb6),
+	WORD(0xf1c1), WORD(0xb2e8), WORD(0x6eae), WORD(0x00e7), WORD(0xd224), WORD(0xc23f),
+	WORD(0xa904), WORD(0xc6b8), WORD(0xd56a), WORD(0xef1d), WORD(0x3d05), WORD(0xf58c),
+	WORD(0x43b6), WORD(0x469b), WORD(0xde01), WORD(0x00cd), WORD(0xa1a6), WORD(0xddee),
+	WORD(0x4de7), WORD(0x91a0), WORD(0x2c63), WORD(0x1f12), WORD(0x8da6), WORD(0x7a6a),
+	/* T[31] */
+	WORD(0x95e2), WORD(0xd2e3), WORD(0xc98e), WORD(0xb0ae), WORD(0xa372), WORD(0xaa53),
+	WORD(0xcc81), WORD(0x572b), WORD(0xe8f9), WORD(0x72d4), WORD(0xd151), WORD(0xc294),
+	WORD(0xe4d5), WORD(0xddaf), WORD(0x2b0e), WORD(0xf865), WORD(0x69e0), WORD(0x7c23),
+	WORD(0x9ce4), WORD(0xeefc), WORD(0xf303), WORD(0xa66f), WORD(0xa54e), WORD(0x4183),
+	WORD(0x7d74), WORD(0xdd99), WORD(0x960f), WORD(0xdf37), WORD(0x4798), WORD(0xd816),
+	WORD(0x9548), WORD(0xc2d2), WORD(0xc8b0), WORD(0xf003), WORD(0xf487), WORD(0xbe94),
+	WORD(0x799a), WORD(0x30b6), WORD(0x43e4), WORD(0xdc7a), WORD(0x1a50), WORD(0x61e9),
+	WORD(0x94ed), WORD(0xe0ec), WORD(0x059a), WORD(0xf0ea), WORD(0x202c), WORD(0x3e50),
+};
+#else                     /* unknown word size */
+#error "Unsupported word size"
+#endif
+TO_EC_GEN_TABLE_PARAM(brainpoolp384r1_gen_comb, 6);
+
 static const ec_str_params brainpoolp384r1_str_params = {
 	.p = &brainpoolp384r1_p_str_param,
 	.p_bitlen = &brainpoolp384r1_p_bitlen_str_param,
@@ -211,6 +1991,11 @@ static const ec_str_params brainpoolp384r1_str_params = {
 	.cofactor = &brainpoolp384r1_cofactor_str_param,
 	.oid = &brainpoolp384r1_oid_str_param,
 	.name = &brainpoolp384r1_name_str_param,
+	.p_inv_chain = &brainpoolp384r1_p_inv_chain_param,
+	.p_sqrt_chain = &brainpoolp384r1_p_sqrt_chain_param,
+	.q_inv_chain = &brainpoolp384r1_q_inv_chain_param,
+	.gen_wnaf_table = &brainpoolp384r1_gen_wnaf_table_param,
+	.gen_comb_table = &brainpoolp384r1_gen_comb_table_param,
 };
 
 /*
@@ -231,6 +2016,17 @@ static const ec_str_params brainpoolp384r1_str_params = {
 #define CURVES_MAX_Q_BIT_LEN CURVE_BRAINPOOLP384R1_Q_BITLEN
 #endif
 
+/*
+ * Limb count of p for the fixed limbs field backend (see fp_fixed.h)
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+#define FP_FIXED_WLEN_6_USED
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+#define FP_FIXED_WLEN_12_USED
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+/* More than 17 limbs: generic field code */
+#endif
+
 #endif /* __EC_PARAMS_BRAINPOOLP384R1_H__ */
 
 #endif /* WITH_CURVE_BRAINPOOLP384R1 */
@@ -203,6 +203,2304 @@ TO_EC_STR_PARAM(brainpoolp512r1_oid);
 static const u8 brainpoolp512r1_name[] = "BRAINPOOLP512R1";
 TO_EC_STR_PARAM(brainpoolp512r1_name);
 
+/* x^(p - 2): 510 squarings and 107 multiplications */
+static const u8 brainpoolp512r1_p_inv[] = {
+	0x10, 0x01, 0xff,
+	0x20, 0x00, 0x01,
+	0x32, 0x00, 0x01,
+	0x43, 0x00, 0x01,
+	0x54, 0x00, 0x01,
+	0x65, 0x00, 0x01,
+	0x76, 0x00, 0x01,
+	0x87, 0x00, 0x01,
+	0x93, 0x04, 0x03,
+	0x99, 0x05, 0x07,
+	0x99, 0x04, 0x07,
+	0x99, 0x04, 0x05,
+	0x99, 0x04, 0x07,
+	0x99, 0x04, 0x06,
+	0x99, 0x01, 0x00,
+	0x99, 0x07, 0x07,
+	0x99, 0x04, 0x06,
+	0x99, 0x03, 0x04,
+	0x99, 0x05, 0x05,
+	0x99, 0x02, 0x02,
+	0x99, 0x07, 0x05,
+	0x99, 0x07, 0x06,
+	0x99, 0x06, 0x08,
+	0x99, 0x04, 0x08,
+	0x99, 0x04, 0x03,
+	0x99, 0x05, 0x04,
+	0x99, 0x06, 0x07,
+	0x99, 0x05, 0x06,
+	0x99, 0x01, 0x00,
+	0x99, 0x05, 0x02,
+	0x99, 0x06, 0x08,
+	0x99, 0x06, 0x05,
+	0x99, 0x04, 0x08,
+	0x99, 0x02, 0x02,
+	0x99, 0x0b, 0x08,
+	0x99, 0x04, 0x05,
+	0x99, 0x03, 0x02,
+	0x99, 0x04, 0x02,
+	0x99, 0x05, 0x00,
+	0x99, 0x07, 0x07,
+	0x99, 0x04, 0x06,
+	0x99, 0x05, 0x04,
+	0x99, 0x03, 0x02,
+	0x99, 0x06, 0x08,
+	0x99, 0x06, 0x05,
+	0x99, 0x04, 0x07,
+	0x99, 0x03, 0x00,
+	0x99, 0x08, 0x04,
+	0x99, 0x05, 0x07,
+	0x99, 0x03, 0x02,
+	0x99, 0x04, 0x02,
+	0x99, 0x06, 0x04,
+	0x99, 0x05, 0x04,
+	0x99, 0x04, 0x02,
+	0x99, 0x05, 0x03,
+	0x99, 0x05, 0x04,
+	0x99, 0x08, 0x02,
+	0x99, 0x04, 0x02,
+	0x99, 0x05, 0x00,
+	0x99, 0x07, 0x04,
+	0x99, 0x07, 0x06,
+	0x99, 0x03, 0x04,
+	0x99, 0x04, 0x03,
+	0x99, 0x06, 0x07,
+	0x99, 0x04, 0x05,
+	0x99, 0x04, 0x06,
+	0x99, 0x0c, 0x05,
+	0x99, 0x04, 0x06,
+	0x99, 0x02, 0x02,
+	0x99, 0x05, 0x02,
+	0x99, 0x06, 0x07,
+	0x99, 0x05, 0x00,
+	0x99, 0x07, 0x03,
+	0x99, 0x05, 0x06,
+	0x99, 0x04, 0x06,
+	0x99, 0x06, 0x07,
+	0x99, 0x03, 0x03,
+	0x99, 0x08, 0x05,
+	0x99, 0x04, 0x03,
+	0x99, 0x04, 0x04,
+	0x99, 0x06, 0x07,
+	0x99, 0x02, 0x00,
+	0x99, 0x06, 0x04,
+	0x99, 0x0a, 0x04,
+	0x99, 0x04, 0x02,
+	0x99, 0x06, 0x03,
+	0x99, 0x04, 0x00,
+	0x99, 0x0a, 0x08,
+	0x99, 0x04, 0x08,
+	0x99, 0x04, 0x05,
+	0x99, 0x05, 0x08,
+	0x99, 0x06, 0x06,
+	0x99, 0x03, 0x02,
+	0x99, 0x09, 0x06,
+	0x99, 0x07, 0x07,
+	0x99, 0x07, 0x03,
+	0x99, 0x05, 0x03,
+	0x99, 0x06, 0x03,
+	0x99, 0x04, 0x03,
+	0x99, 0x04, 0x02,
+	0x99, 0x09, 0x03,
+	0x99, 0x03, 0x02,
+	0x99, 0x06, 0x06,
+	0x99, 0x08, 0x04,
+	0x99, 0x05, 0x05,
+	0x99, 0x03, 0x00,
+	0x99, 0x07, 0x08,
+	0x99, 0x04, 0x00,
+};
+TO_EC_CHAIN_PARAM(brainpoolp512r1_p_inv);
+
+/* x^((p + 1) / 4): 508 squarings and 107 multiplications */
+static const u8 brainpoolp512r1_p_sqrt[] = {
+	0x10, 0x01, 0xff,
+	0x20, 0x00, 0x01,
+	0x32, 0x00, 0x01,
+	0x43, 0x00, 0x01,
+	0x54, 0x00, 0x01,
+	0x65, 0x00, 0x01,
+	0x76, 0x00, 0x01,
+	0x87, 0x00, 0x01,
+	0x93, 0x04, 0x03,
+	0x99, 0x05, 0x07,
+	0x99, 0x04, 0x07,
+	0x99, 0x04, 0x05,
+	0x99, 0x04, 0x07,
+	0x99, 0x04, 0x06,
+	0x99, 0x01, 0x00,
+	0x99, 0x07, 0x07,
+	0x99, 0x04, 0x06,
+	0x99, 0x03, 0x04,
+	0x99, 0x05, 0x05,
+	0x99, 0x02, 0x02,
+	0x99, 0x07, 0x05,
+	0x99, 0x07, 0x06,
+	0x99, 0x06, 0x08,
+	0x99, 0x04, 0x08,
+	0x99, 0x04, 0x03,
+	0x99, 0x05, 0x04,
+	0x99, 0x06, 0x07,
+	0x99, 0x05, 0x06,
+	0x99, 0x01, 0x00,
+	0x99, 0x05, 0x02,
+	0x99, 0x06, 0x08,
+	0x99, 0x06, 0x05,
+	0x99, 0x04, 0x08,
+	0x99, 0x02, 0x02,
+	0x99, 0x0b, 0x08,
+	0x99, 0x04, 0x05,
+	0x99, 0x03, 0x02,
+	0x99, 0x04, 0x02,
+	0x99, 0x05, 0x00,
+	0x99, 0x07, 0x07,
+	0x99, 0x04, 0x06,
+	0x99, 0x05, 0x04,
+	0x99, 0x03, 0x02,
+	0x99, 0x06, 0x08,
+	0x99, 0x06, 0x05,
+	0x99, 0x04, 0x07,
+	0x99, 0x03, 0x00,
+	0x99, 0x08, 0x04,
+	0x99, 0x05, 0x07,
+	0x99, 0x03, 0x02,
+	0x99, 0x04, 0x02,
+	0x99, 0x06, 0x04,
+	0x99, 0x05, 0x04,
+	0x99, 0x04, 0x02,
+	0x99, 0x05, 0x03,
+	0x99, 0x05, 0x04,
+	0x99, 0x08, 0x02,
+	0x99, 0x04, 0x02,
+	0x99, 0x05, 0x00,
+	0x99, 0x07, 0x04,
+	0x99, 0x07, 0x06,
+	0x99, 0x03, 0x04,
+	0x99, 0x04, 0x03,
+	0x99, 0x06, 0x07,
+	0x99, 0x04, 0x05,
+	0x99, 0x04, 0x06,
+	0x99, 0x0c, 0x05,
+	0x99, 0x04, 0x06,
+	0x99, 0x02, 0x02,
+	0x99, 0x05, 0x02,
+	0x99, 0x06, 0x07,
+	0x99, 0x05, 0x00,
+	0x99, 0x07, 0x03,
+	0x99, 0x05, 0x06,
+	0x99, 0x04, 0x06,
+	0x99, 0x06, 0x07,
+	0x99, 0x03, 0x03,
+	0x99, 0x08, 0x05,
+	0x99, 0x04, 0x03,
+	0x99, 0x04, 0x04,
+	0x99, 0x06, 0x07,
+	0x99, 0x02, 0x00,
+	0x99, 0x06, 0x04,
+	0x99, 0x0a, 0x04,
+	0x99, 0x04, 0x02,
+	0x99, 0x06, 0x03,
+	0x99, 0x04, 0x00,
+	0x99, 0x0a, 0x08,
+	0x99, 0x04, 0x08,
+	0x99, 0x04, 0x05,
+	0x99, 0x05, 0x08,
+	0x99, 0x06, 0x06,
+	0x99, 0x03, 0x02,
+	0x99, 0x09, 0x06,
+	0x99, 0x07, 0x07,
+	0x99, 0x07, 0x03,
+	0x99, 0x05, 0x03,
+	0x99, 0x06, 0x03,
+	0x99, 0x04, 0x03,
+	0x99, 0x04, 0x02,
+	0x99, 0x09, 0x03,
+	0x99, 0x03, 0x02,
+	0x99, 0x06, 0x06,
+	0x99, 0x08, 0x04,
+	0x99, 0x05, 0x05,
+	0x99, 0x03, 0x00,
+	0x99, 0x07, 0x08,
+	0x99, 0x02, 0x00,
+};
+TO_EC_CHAIN_PARAM(brainpoolp512r1_p_sqrt);
+
+/* x^(q - 2): 510 squarings and 110 multiplications */
+static const u8 brainpoolp512r1_q_inv[] = {
+	0x10, 0x01, 0xff,
+	0x20, 0x00, 0x01,
+	0x32, 0x00, 0x01,
+	0x43, 0x00, 0x01,
+	0x54, 0x00, 0x01,
+	0x65, 0x00, 0x01,
+	0x76, 0x00, 0x01,
+	0x87, 0x00, 0x01,
+	0x93, 0x04, 0x03,
+	0x99, 0x05, 0x07,
+	0x99, 0x04, 0x07,
+	0x99, 0x04, 0x05,
+	0x99, 0x04, 0x07,
+	0x99, 0x04, 0x06,
+	0x99, 0x01, 0x00,
+	0x99, 0x07, 0x07,
+	0x99, 0x04, 0x06,
+	0x99, 0x03, 0x04,
+	0x99, 0x05, 0x05,
+	0x99, 0x02, 0x02,
+	0x99, 0x07, 0x05,
+	0x99, 0x07, 0x06,
+	0x99, 0x06, 0x08,
+	0x99, 0x04, 0x08,
+	0x99, 0x04, 0x03,
+	0x99, 0x05, 0x04,
+	0x99, 0x06, 0x07,
+	0x99, 0x05, 0x06,
+	0x99, 0x01, 0x00,
+	0x99, 0x05, 0x02,
+	0x99, 0x06, 0x08,
+	0x99, 0x06, 0x05,
+	0x99, 0x04, 0x08,
+	0x99, 0x02, 0x02,
+	0x99, 0x0b, 0x08,
+	0x99, 0x04, 0x05,
+	0x99, 0x03, 0x02,
+	0x99, 0x04, 0x02,
+	0x99, 0x05, 0x00,
+	0x99, 0x07, 0x07,
+	0x99, 0x04, 0x06,
+	0x99, 0x05, 0x04,
+	0x99, 0x03, 0x02,
+	0x99, 0x06, 0x08,
+	0x99, 0x06, 0x05,
+	0x99, 0x04, 0x07,
+	0x99, 0x03, 0x00,
+	0x99, 0x08, 0x04,
+	0x99, 0x05, 0x07,
+	0x99, 0x03, 0x02,
+	0x99, 0x04, 0x02,
+	0x99, 0x06, 0x04,
+	0x99, 0x05, 0x04,
+	0x99, 0x04, 0x02,
+	0x99, 0x05, 0x03,
+	0x99, 0x05, 0x04,
+	0x99, 0x08, 0x02,
+	0x99, 0x04, 0x02,
+	0x99, 0x05, 0x00,
+	0x99, 0x07, 0x04,
+	0x99, 0x08, 0x03,
+	0x99, 0x04, 0x03,
+	0x99, 0x06, 0x08,
+	0x99, 0x04, 0x05,
+	0x99, 0x04, 0x04,
+	0x99, 0x04, 0x00,
+	0x99, 0x08, 0x03,
+	0x99, 0x04, 0x02,
+	0x99, 0x05, 0x03,
+	0x99, 0x05, 0x05,
+	0x99, 0x06, 0x05,
+	0x99, 0x01, 0x00,
+	0x99, 0x06, 0x02,
+	0x99, 0x05, 0x03,
+	0x99, 0x07, 0x02,
+	0x99, 0x06, 0x02,
+	0x99, 0x04, 0x02,
+	0x99, 0x05, 0x00,
+	0x99, 0x05, 0x02,
+	0x99, 0x06, 0x06,
+	0x99, 0x04, 0x08,
+	0x99, 0x04, 0x07,
+	0x99, 0x03, 0x02,
+	0x99, 0x06, 0x00,
+	0x99, 0x06, 0x00,
+	0x99, 0x06, 0x04,
+	0x99, 0x06, 0x04,
+	0x99, 0x05, 0x07,
+	0x99, 0x01, 0x00,
+	0x99, 0x06, 0x04,
+	0x99, 0x05, 0x05,
+	0x99, 0x02, 0x02,
+	0x99, 0x07, 0x00,
+	0x99, 0x05, 0x00,
+	0x99, 0x08, 0x06,
+	0x99, 0x04, 0x06,
+	0x99, 0x04, 0x06,
+	0x99, 0x05, 0x06,
+	0x99, 0x04, 0x04,
+	0x99, 0x05, 0x07,
+	0x99, 0x03, 0x03,
+	0x99, 0x03, 0x02,
+	0x99, 0x08, 0x08,
+	0x99, 0x06, 0x06,
+	0x99, 0x02, 0x00,
+	0x99, 0x08, 0x03,
+	0x99, 0x05, 0x04,
+	0x99, 0x05, 0x03,
+	0x99, 0x05, 0x05,
+	0x99, 0x0b, 0x02,
+	0x99, 0x05, 0x04,
+};
+TO_EC_CHAIN_PARAM(brainpoolp512r1_q_inv);
+
+/*
+ * Odd multiples G, 3G, ..., 63G of the generator for the wNAF
+ * multiplications (window 7), affine x and y in Montgomery representation
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+static const word_t brainpoolp512r1_gen_wnaf[] = {
+	/* G */
+	WORD(0xc4ce96095161d9d3), WORD(0x683e4d64272c02a4),
+	WORD(0x34ab04146df55e8f), WORD(0x8550539514c01fc8),
+	WORD(0x2433d76f905c8737), WORD(0xb2b6ea37f36d3cf7),
+	WORD(0x871cb5ca006d4573), WORD(0x5a2ba14c0994e981),
+	WORD(0x2f90662925042a6d), WORD(0x7518df6f4742f325),
+	WORD(0xbf8455534c859490), WORD(0x360ec775598ecc3e),
+	WORD(0x7c170b888fe62fdc), WORD(0x585d2b77cd9d3f8c),
+	WORD(0x9a5ed7da870f3f9b), WORD(0x8c50c9d12acb7281),
+	/* 3G */
+	WORD(0x3268d7bbcb0d8637), WORD(0x92da56dc40df5b05),
+	WORD(0x442130c80827a868), WORD(0xdafb3eda039303bc),
+	WORD(0xd6fdb6ec7a5d9f35), WORD(0xf0d8962dea8731cd),
+	WORD(0x4dd3948303ab788e), WORD(0x5bc5646e75319656),
+	WORD(0x85096254bb99cc94), WORD(0xa2cf949e38d72780),
+	WORD(0x50622be900dff70c), WORD(0x70aeeea25bdba693),
+	WORD(0xcf882ecb4c30e348), WORD(0x4062151a27559c49),
+	WORD(0xe0e46caac924cbb6), WORD(0x89cdcbd93a486f6f),
+	/* 5G */
+	WORD(0xfad0299b772c3539), WORD(0xb7b38c1e97895fbb),
+	WORD(0x2a432f403f5d91c6), WORD(0x8c11e21f68b5ecaf),
+	WORD(0x4183a7232736d040), WORD(0x163face685b80667),
+	WORD(0x8ea7c40934a7280a), WORD(0x7bff0e10a75544a0),
+	WORD(0xc1fd6edcbf0f4503), WORD(0x8bb5f2f9ca09252c),
+	WORD(0x06c2616d275ae481), WORD(0x663169eb7a4eefb6),
+	WORD(0xda4693ef09e0b9f8), WORD(0x38ce89161d132626),
+	WORD(0x4637c39a9e57e3c4), WORD(0x2753741fd5254403),
+	/* 7G */
+	WORD(0x28c2f620f7ada902), WORD(0x744ea1f769ba0274),
+	WORD(0xb76d01983279c77a), WORD(0x114bd98ba29af32c),
+	WORD(0xda43d2d0bc566a94), WORD(0xd19954e0e23e2942),
+	WORD(0xa63186e8fd6f6880), WORD(0x1332b24a388dafb7),
+	WORD(0x29bd2318f3ff92e1), WORD(0xed05887cb3deb540),
+	WORD(0x83ad0b4ba7c3a0be), WORD(0xddea71719d48e7ac),
+	WORD(0x1e39af8235c41d61), WORD(0xedf1ae72603f5da9),
+	WORD(0xd902d4bd73e95335), WORD(0x5fe552f888dec030),
+	/* 9G */
+	WORD(0xc2e9955562a71e83), WORD(0x2cfff414989b6387),
+	WORD(0x067dadec08f3b023), WORD(0xac9ba4c5ca1ec374),
+	WORD(0xa6d48f9cd5120d40), WORD(0xa228e7f1af63395a),
+	WORD(0xd27f719844c36207), WORD(0x67f90ca413d73ad6),
+	WORD(0x00032e6becc4b389), WORD(0x4c311fed43774a08),
+	WORD(0xc7f78d5107927d82), WORD(0xdc19f486d3a074c4),
+	WORD(0xbf22ff9b5b2600c1), WORD(0xedbb095b87797110),
+	WORD(0xda3305dae1a0f016), WORD(0x9fb1bb3360f6521f),
+	/* 11G */
+	WORD(0x5d1cabb2c62a7560), WORD(0x07f0d6b7be963232),
+	WORD(0x6c9d3640a38257c4), WORD(0x2d100493a51221e1),
+	WORD(0x92affa8fcc662506), WORD(0x07cfb3f0516a9bd4),
+	WORD(0x738d68dc6742c553), WORD(0x2b270cab60276031),
+	WORD(0xfa1a3c0ba58281a7), WORD(0xd62e30750c425744),
+	WORD(0x2c6f1cf28ad5f944), WORD(0x7ec349b6bc132154),
+	WORD(0xcb7d1ad757fd4b5f), WORD(0xb2a3e3873c301a2c),
+	WORD(0x258d9e108c12f4d7), WORD(0x9f9f045b8180a7ed),
+	/* 13G */
+	WORD(0x470ce5def304f233), WORD(0xc0e290082da24861),
+	WORD(0x9576221bc2428f53), WORD(0x4f2a1e268b97d540),
+	WORD(0x50a88a7b9a023a77), WORD(0x9023ac994a66529f),
+	WORD(0xcc4984a7f5aad75f), WORD(0x9841f6216f7780a7),
+	WORD(0x05cb1fc35fb2bf2b), WORD(0xb0cf1abafef00376),
+	WORD(0x6ff197bb9fd0e022), WORD(0x8e65364fbbe0c4d4),
+	WORD(0x9ea0bf8da3973feb), WORD(0xb95842a93e6f8e66),
+	WORD(0xc82fd3207ba1dbd5), WORD(0x92602e44e2c8495c),
+	/* 15G */
+	WORD(0xf555480b34a32c3d), WORD(0xac5f3192a814fcef),
+	WORD(0x62393bfaf2e73758), WORD(0x035d11be25aaa89f),
+	WORD(0x68f7172d33d269ea), WORD(0x8ea0689f384d88a9),
+	WORD(0xa5d5bc2d799a4fc4), WORD(0x8aa8cea67b95e487),
+	WORD(0x92300bdc2919db9a), WORD(0x8dfe8f658bfe1dd2),
+	WORD(0xf6cb0ae80753b9e7), WORD(0x619e4ced59b9d3e6),
+	WORD(0x6401717e370fec1d), WORD(0x4d61a50f61869a04),
+	WORD(0x8b51fda7e0a331c0), WORD(0x9ea097b869ffe00d),
+	/* 17G */
+	WORD(0xf22f9ff204ea4984), WORD(0xa243dfcb86faaeae),
+	WORD(0xf863111886916063), WORD(0xca0eee4fb2e15c19),
+	WORD(0xa0db6b5c8fedbc5e), WORD(0xa510d13f7287a27e),
+	WORD(0x170a1eccab13e3d6), WORD(0x9f87a98defa8e26f),
+	WORD(0x48d6e5034904ed45), WORD(0x54ba0fe88e8463be),
+	WORD(0xfdbf034119f25195), WORD(0x4203dc9ab932c629),
+	WORD(0x8ab16328728388c6), WORD(0x858bf449684cff48),
+	WORD(0x2676b14904486e75), WORD(0x8d6660517edf3d8b),
+	/* 19G */
+	WORD(0xaacea96f334f2ff0), WORD(0x3f85dc3a1d84f1e6),
+	WORD(0x87096a9c9b83cea8), WORD(0x504b779edb0ed9e7),
+	WORD(0xde2ff469bfc17187), WORD(0x8f4a4665a70a5022),
+	WORD(0x8ce355507c6cedc6), WORD(0x88a00ddc6779c571),
+	WORD(0x6909d7c78cc09534), WORD(0x55c932082a972cbe),
+	WORD(0xf2b54c4eb68967d2), WORD(0x4965e1bc116e31bc),
+	WORD(0x50e889ea653ec646), WORD(0x7aae9635f59ac727),
+	WORD(0x6e6e10d0f9773d11), WORD(0x86d678a12e1445f5),
+	/* 21G */
+	WORD(0xcf91b04b96e5f875), WORD(0x4d512494913e4815),
+	WORD(0x3d9958bd93a2686d), WORD(0xa6b713918774d432),
+	WORD(0x225f13bc6f796e48), WORD(0x4a554960812acb37),
+	WORD(0x74d4c148086c8320), WORD(0x12ed2a900c8d5c7b),
+	WORD(0x0325eb6d47a16426), WORD(0x5a778cb13b59953f),
+	WORD(0x616f37eb53adc403), WORD(0xdd36d5a7db0c7830),
+	WORD(0xf0a4707740ec2102), WORD(0xee4cbadda16f2a95),
+	WORD(0x0dac0a67933f83ff), WORD(0xa4f32fba70622139),
+	/* 23G */
+	WORD(0x3142bf189be0c5da), WORD(0x47ad910bee0ef19f),
+	WORD(0x8961f9c1cf1c00d1), WORD(0x1e2be3db66ffc1d4),
+	WORD(0x9899a219b30c70fe), WORD(0x5be39c4553cdba9c),
+	WORD(0x8899092a6a6b75e0), WORD(0x510355b99e09b518),
+	WORD(0x0a7c0ea81344cd62), WORD(0xd812df0b442453e4),
+	WORD(0xbdb9f0eceb96b5e0), WORD(0x6251c3b6301f6439),
+	WORD(0x44e4fe72bca336dd), WORD(0x3927cb346b401af2),
+	WORD(0xe6b063ecbc901abd), WORD(0x78ec8de1d03dc84b),
+	/* 25G */
+	WORD(0x451deb34abb1403c), WORD(0xec2031acce57eee8),
+	WORD(0x4cbe3a7d1bf7e990), WORD(0x4c4c623c6caca7f2),
+	WORD(0x9bde877f34fdc886), WORD(0x3931903f5954d37f),
+	WORD(0xdd506b54a23edc52), WORD(0x0caf091b5db5b83c),
+	WORD(0x34d5248197b8cf66), WORD(0x73ea031cbc80070b),
+	WORD(0x57628c5dead04843), WORD(0x7ca1b9c0ca9f727a),
+	WORD(0x60a4c84ca1dd3065), WORD(0xd73681f7ca19c73f),
+	WORD(0x9d3b53a148634b73), WORD(0x107edd66674e13ba),
+	/* 27G */
+	WORD(0xa1d62823e1de81a1), WORD(0x1844bcf68eb3ab0d),
+	WORD(0xefd209cd6b98753d), WORD(0x5ca56729b1272672),
+	WORD(0xaeae16000e6c9207), WORD(0x8ce0b5cb41df5eba),
+	WORD(0x2d3dc2bd7ae93698), WORD(0x18f9406e5300647b),
+	WORD(0xbb928bcac65efece), WORD(0xc963e4f818431439),
+	WORD(0x43cb9b4e6214aa12), WORD(0x0298651393026e7c),
+	WORD(0x2acc14d3e9635e54), WORD(0x33db165573087ec1),
+	WORD(0x1ed8314a95def550), WORD(0x21c735c8a87455cb),
+	/* 29G */
+	WORD(0xe5554836e7af8c20), WORD(0x0799d40cacc5e14b),
+	WORD(0x0c5315deb163b21a), WORD(0x67d8dbd45bd58ca2),
+	WORD(0xb6aea1fac419a3fe), WORD(0xb8c718cd06e5cacb),
+	WORD(0x49061ef6406b30d6), WORD(0x3d60a1e526be98fa),
+	WORD(0x2e58648e8bd25771), WORD(0x8ee17af1ef79ec21),
+	WORD(0xb0543a458f86d087), WORD(0x9935d6602e0bf4fb),
+	WORD(0x018093f0b5337216), WORD(0xe879305274dc59f9),
+	WORD(0xc59d19df3eba9e98), WORD(0x4c8d582dfb34c660),
+	/* 31G */
+	WORD(0xe6afd2531985842b), WORD(0x72aaca539f4b4805),
+	WORD(0xd994abbcbbc0af11), WORD(0xdef6784bc23a9911),
+	WORD(0x37abe4e00cc75f43), WORD(0x948b8a3bd570af35),
+	WORD(0x28ba74c969da7c4c), WORD(0x0f91b2fbfd8d5010),
+	WORD(0x06969960ce66eea0), WORD(0x6c2f6ac6e99c515b),
+	WORD(0x8175083df3121fef), WORD(0x4c6540ca180595c3),
+	WORD(0xce1b4fe6544c4f48), WORD(0xcdf37d9579aa283f),
+	WORD(0x74d1939577f596b9), WORD(0x95d4b47b405234e6),
+	/* 33G */
+	WORD(0x056b2c66d64643e2), WORD(0x5c4a51f16f35507e),
+	WORD(0x9e848126b18f1929), WORD(0x5dbb0f9200f62280),
+	WORD(0xb3a4e66bd7eb5da7), WORD(0x1394a7558529382b),
+	WORD(0xe64fea1fe1b61a38), WORD(0x5dacdd47f0c03ae2),
+	WORD(0x62c9cc62d272c5a8), WORD(0x93dbbba0d713d261),
+	WORD(0x537084384ecaff08), WORD(0x1e967206286ccb2e),
+	WORD(0x3dfccdcec082fcde), WORD(0x6ba109fb0ee55cb3),
+	WORD(0xaf98dfe1c2e903b4), WORD(0x27aa6703b0d0a0b6),
+	/* 35G */
+	WORD(0xd5a6efab7c96082a), WORD(0x876ceeed44c676e5),
+	WORD(0x1e57e081701effd1), WORD(0x161a9ae5ff2f6efc),
+	WORD(0x5352ac1249ed828a), WORD(0x0d2248462429f5a5),
+	WORD(0xedb216e5d5904312), WORD(0x66de36b71a7d52fd),
+	WORD(0xadff479b7b7ed858), WORD(0x9f883b1dc87e55eb),
+	WORD(0x2631fed9090c4a47), WORD(0x4c1190259bdb772e),
+	WORD(0x2e2d5c727ea80e71), WORD(0x20c16a6cbee56fd9),
+	WORD(0x08e20ea5f956986e), WORD(0x71da23e0773a2576),
+	/* 37G */
+	WORD(0x8d5e3ede7fd4c4eb), WORD(0x99e2b145cd5299d2),
+	WORD(0x920a596bd315d692), WORD(0xce3b110605153d29),
+	WORD(0x8903b6e001691a96), WORD(0xc9272318e764302c),
+	WORD(0xf302f59faa251d0a), WORD(0x01dd39db84d63d6b),
+	WORD(0xf8e688c87e21fd04), WORD(0x6d02248bdfe4af48),
+	WORD(0x40199849220e3131), WORD(0x22b024129093f17f),
+	WORD(0x24a42a3b5208885b), WORD(0x03713bc2003b46d8),
+	WORD(0x90bf8d15c1d1a7ae), WORD(0x0bc5390224a1de30),
+	/* 39G */
+	WORD(0x1bf9e4b997bd3bf0), WORD(0xa938379d4ca5522f),
+	WORD(0x81417a3542b7b1dd), WORD(0x0d520ebd6f75cf46),
+	WORD(0xd40585e493d39dd8), WORD(0x6f31064fcd385a3c),
+	WORD(0x18f964d03e2fad4d), WORD(0x951add3ebf48e602),
+	WORD(0x601c7a3f14437570), WORD(0x7fd8055650cad500),
+	WORD(0xe4b28d80ed09c44e), WORD(0x134e3e2c1c7921d6),
+	WORD(0x38d6b095c0d7d1dc), WORD(0x932814fc90e9ba56),
+	WORD(0x609f996f4b39802c), WORD(0x9223aff588f8da30),
+	/* 41G */
+	WORD(0x6ca1cd3e9bfb2f9a), WORD(0xce122217ceb5c60d),
+	WORD(0x8f6da10b71522223), WORD(0x07c88bca5aad7ede),
+	WORD(0x7f76a7774e79dccf), WORD(0xe3b740fb4ca52223),
+	WORD(0x7e07db2b8e656063), WORD(0x54277a1ef8625575),
+	WORD(0x1ceb6c58ecbcf3f4), WORD(0xe71b04e2fd53f818),
+	WORD(0x53b1553112b0e95c), WORD(0x8354efa23938c645),
+	WORD(0x95ddd78365e7b527), WORD(0xc12408cd3291032e),
+	WORD(0x0b45ac38e37bedb9), WORD(0x005ad62b1d51290e),
+	/* 43G */
+	WORD(0xd909b600a4d4fea1), WORD(0x4d1edb4e9024282d),
+	WORD(0x552e66a4c3244a60), WORD(0xd16f50ee9ee9b45b),
+	WORD(0xa5402d828f16ed5e), WORD(0xa4bb82674a5079b9),
+	WORD(0x1d6133b0291be752), WORD(0x2943448c94e693b2),
+	WORD(0xc407bc525bb3ae45), WORD(0xaf63a44538b5935d),
+	WORD(0x1f27a1ea949ff811), WORD(0xe5c10c6f64b99b0a),
+	WORD(0x14fad0a6acaab21f), WORD(0xba02a4aeaa088eac),
+	WORD(0xd045bb678b06d5cc), WORD(0x6c6fb5bdba589616),
+	/* 45G */
+	WORD(0xb22d6a5a833aedb9), WORD(0x38d6e155534f7c1b),
+	WORD(0x52087cbc616a4cce), WORD(0x18a89585aec5029d),
+	WORD(0x68a0f51d0c605ace), WORD(0x5c804ae3d3038ec3),
+	WORD(0xa77c6d8926acbdcb), WORD(0x9ceb5a9803a8efad),
+	WORD(0x44a5b8aec2291a7a), WORD(0x920f44b02359d5b6),
+	WORD(0x5a769d21f44a9b7b), WORD(0x5bad531d6f1137c6),
+	WORD(0x6833c71a9667367e), WORD(0x8c4ff35d2479b53e),
+	WORD(0x5deb45b431cf3f9a), WORD(0x5eff7dac89e37b23),
+	/* 47G */
+	WORD(0x0f1654e7fdcf4752), WORD(0x032809be84c40072),
+	WORD(0x452337ab9697efdb), WORD(0xe788a47a9b588f16),
+	WORD(0x02e8972cc5bd6532), WORD(0xcc256ccfb1b9a672),
+	WORD(0x328eb0cdd1c9e4fb), WORD(0x1f485a265322f716),
+	WORD(0x8493bdb29f15536e), WORD(0x2aee18540d9d0298),
+	WORD(0x3e3001c93ebca2fd), WORD(0xe16c407e3e5376c3),
+	WORD(0xb67bb781f072bb4d), WORD(0x09efa38aee81439f),
+	WORD(0x45d74dcf968bec91), WORD(0x189154f90984550d),
+	/* 49G */
+	WORD(0x2ac8c11ccaa919c8), WORD(0x6b65602d3a74f754),
+	WORD(0xee56d872096685f8), WORD(0x07882a8eb06e255c),
+	WORD(0x2ff5939e12870de2), WORD(0x2fc25c131621eef9),
+	WORD(0xebaee82526907a79), WORD(0x417afa3ffa6deec6),
+	WORD(0x5ad54384d9116303), WORD(0x8ddadc56fb01f599),
+	WORD(0xe7600a2487b268d1), WORD(0xc7c29708386db00f),
+	WORD(0xe98a1c036d5e1e9f), WORD(0xd3639a5828bb0234),
+	WORD(0x6b6f9bbbe5c10d3d), WORD(0xa34292e03c6e87ca),
+	/* 51G */
+	WORD(0xf61736d754a52893), WORD(0x247c94a1612d4daa),
+	WORD(0x64f350d60e290f7d), WORD(0x88e6b8a5c3a6f177),
+	WORD(0x62ef25918f465ee3), WORD(0xadeaeb60b64353fa),
+	WORD(0xcb40538bb1f201b7), WORD(0x291bd8996879ec45),
+	WORD(0x7ee1d1b10a445601), WORD(0x164f62fa050c2835),
+	WORD(0x77741fd72435a6e8), WORD(0x9fa27c6cb58bc452),
+	WORD(0xbc6cb3d30a445df2), WORD(0x211e5021869fb555),
+	WORD(0xaf31d9325ede2976), WORD(0x97c641dfce91a857),
+	/* 53G */
+	WORD(0x91518f0123d2c157), WORD(0xf2cc4815f53444ef),
+	WORD(0x0038e3a9b922535a), WORD(0xfb6b120c9f9f8e4f),
+	WORD(0x1cfa790b0342d817), WORD(0x3ea3268d1ab22cef),
+	WORD(0x9c04ae581b490f67), WORD(0x03f5206e83dc5da1),
+	WORD(0x14eb324abc9a2192), WORD(0x344d737e4548ae62),
+	WORD(0x739db92eb5fc6eff), WORD(0x46c3e990873b69db),
+	WORD(0x89a733c78930c805), WORD(0x5a3d7419eff7850a),
+	WORD(0x8a848621a7f5a2a2), WORD(0x4ceffb70da6eb8d1),
+	/* 55G */
+	WORD(0x30555d287d0239f1), WORD(0x9a7bc6c60039e989),
+	WORD(0x70bf5928e91795b1), WORD(0x6c587abd797eefe6),
+	WORD(0xc52c95d0858796e6), WORD(0x7ecdc090bfaa6552),
+	WORD(0xdb121f73169c2042), WORD(0x4b13a8cfddf22a97),
+	WORD(0x3eb27a2d6f13508d), WORD(0xebcd060bd5208157),
+	WORD(0x1e96772d875b7c1e), WORD(0x6f35f5a7ee825d81),
+	WORD(0xe0aae09264cab86f), WORD(0x52e3087c5b9b8167),
+	WORD(0x96e03796a5df0644), WORD(0x13de84be17129eba),
+	/* 57G */
+	WORD(0x6f71c960db440406), WORD(0xed888d056a9df029),
+	WORD(0x21ec74ae8978605d), WORD(0x13a8c8494487f1b9),
+	WORD(0xd1453ad96947ebe7), WORD(0xd6d19cc30c7f9c5a),
+	WORD(0xdca36d95f1003473), WORD(0x4a9184f2de194cbe),
+	WORD(0xbf81737b1e839cb6), WORD(0x0ac9a59dd18f644e),
+	WORD(0x4be63d84aa2f606c), WORD(0xa09e5439af23318c),
+	WORD(0xa4c2a71c48d1caa9), WORD(0xa7d3886f2f2c753e),
+	WORD(0xe61410d2c35edc41), WORD(0x9b433b085ffdce16),
+	/* 59G */
+	WORD(0xe553d2ea56c9e8a4), WORD(0x9073f3b44aceea2c),
+	WORD(0xccb5a14281d8ed7b), WORD(0x25bc2c7d0d028956),
+	WORD(0x4af2493906897c03), WORD(0x56445b3565d9d0c2),
+	WORD(0x265963388e04e376), WORD(0x9e6e002dcff49606),
+	WORD(0xafed852d2498379c), WORD(0x54662eabae730982),
+	WORD(0xce320963e4e6ebcf), WORD(0x6f6a42bd900d8dc3),
+	WORD(0xc59d21202c25e235), WORD(0x88cbfcaf095ca35e),
+	WORD(0xeb2ef231c7cd93bf), WORD(0x0877f88150ff6936),
+	/* 61G */
+	WORD(0xbddb9ef6ff0b425f), WORD(0xec83409003b1c4c2),
+	WORD(0xde37cec2ede8a676), WORD(0xbd788280dfadeb0a),
+	WORD(0x05147d56c9d493a1), WORD(0x8181d6dacd23907e),
+	WORD(0xa124fb12ec9cd237), WORD(0x4bd93bac4004c7b2),
+	WORD(0x3e6742a00717d896), WORD(0xe1d729c3cb675ad5),
+	WORD(0xa514b143f84310a6), WORD(0x91b21130fe06b757),
+	WORD(0x55540ab1e50498a9), WORD(0xff89a1a81997ea23),
+	WORD(0xdd44fc49b01e9833), WORD(0x701a4b663917edbb),
+	/* 63G */
+	WORD(0xc7d6f35bb6667c2f), WORD(0xcb6d7b7fa380a69d),
+	WORD(0x7b53e8fe77a3b554), WORD(0x663db46528e23e5b),
+	WORD(0x137107ba52e78560), WORD(0x9968f8fdc8b6f9f5),
+	WORD(0x29f042c00df78e48), WORD(0x8e52e10b316f493f),
+	WORD(0xbdafb9ea89cf19b1), WORD(0xe4d7265e4902426a),
+	WORD(0xd1162410907dde71), WORD(0x15f6d83fd4760ae5),
+	WORD(0xc33568d00df40c5f), WORD(0x99c4fc94df8ecb9d),
+	WORD(0x842201311400de15), WORD(0x9a19bc3c419af14e),
+};
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+static const word_t brainpoolp512r1_gen_wnaf[] = {
+	/* G */
+	WORD(0x5161d9d3), WORD(0xc4ce9609), WORD(0x272c02a4), WORD(0x683e4d64),
+	WORD(0x6df55e8f), WORD(0x34ab0414), WORD(0x14c01fc8), WORD(0x85505395),
+	WORD(0x905c8737), WORD(0x2433d76f), WORD(0xf36d3cf7), WORD(0xb2b6ea37),
+	WORD(0x006d4573), WORD(0x871cb5ca), WORD(0x0994e981), WORD(0x5a2ba14c),
+	WORD(0x25042a6d), WORD(0x2f906629), WORD(0x4742f325), WORD(0x7518df6f),
+	WORD(0x4c859490), WORD(0xbf845553), WORD(0x598ecc3e), WORD(0x360ec775),
+	WORD(0x8fe62fdc), WORD(0x7c170b88), WORD(0xcd9d3f8c), WORD(0x585d2b77),
+	WORD(0x870f3f9b), WORD(0x9a5ed7da), WORD(0x2acb7281), WORD(0x8c50c9d1),
+	/* 3G */
+	WORD(0xcb0d8637), WORD(0x3268d7bb), WORD(0x40df5b05), WORD(0x92da56dc),
+	WORD(0x0827a868), WORD(0x442130c8), WORD(0x039303bc), WORD(0xdafb3eda),
+	WORD(0x7a5d9f35), WORD(0xd6fdb6ec), WORD(0xea8731cd), WORD(0xf0d8962d),
+	WORD(0x03ab788e), WORD(0x4dd39483), WORD(0x75319656), WORD(0x5bc5646e),
+	WORD(0xbb99cc94), WORD(0x85096254), WORD(0x38d72780), WORD(0xa2cf949e),
+	WORD(0x00dff70c), WORD(0x50622be9), WORD(0x5bdba693), WORD(0x70aeeea2),
+	WORD(0x4c30e348), WORD(0xcf882ecb), WORD(0x27559c49), WORD(0x4062151a),
+	WORD(0xc924cbb6), WORD(0xe0e46caa), WORD(0x3a486f6f), WORD(0x89cdcbd9),
+	/* 5G */
+	WORD(0x772c3539), WORD(0xfad0299b), WORD(0x97895fbb), WORD(0xb7b38c1e),
+	WORD(0x3f5d91c6), WORD(0x2a432f40), WORD(0x68b5ecaf), WORD(0x8c11e21f),
+	WORD(0x2736d040), WORD(0x4183a723), WORD(0x85b80667), WORD(0x163face6),
+	WORD(0x34a7280a), WORD(0x8ea7c409), WORD(0xa75544a0), WORD(0x7bff0e10),
+	WORD(0xbf0f4503), WORD(0xc1fd6edc), WORD(0xca09252c), WORD(0x8bb5f2f9),
+	WORD(0x275ae481), WORD(0x06c2616d), WORD(0x7a4eefb6), WORD(0x663169eb),
+	WORD(0x09e0b9f8), WORD(0xda4693ef), WORD(0x1d132626), WORD(0x38ce8916),
+	WORD(0x9e57e3c4), WORD(0x4637c39a), WORD(0xd5254403), WORD(0x2753741f),
+	/* 7G */
+	WORD(0xf7ada902), WORD(0x28c2f620), WORD(0x69ba0274), WORD(0x744ea1f7),
+	WORD(0x3279c77a), WORD(0xb76d0198), WORD(0xa29af32c), WORD(0x114bd98b),
+	WORD(0xbc566a94), WORD(0xda43d2d0), WORD(0xe23e2942), WORD(0xd19954e0),
+	WORD(0xfd6f6880), WORD(0xa63186e8), WORD(0x388dafb7), WORD(0x1332b24a),
+	WORD(0xf3ff92e1), WORD(0x29bd2318), WORD(0xb3deb540), WORD(0xed05887c),
+	WORD(0xa7c3a0be), WORD(0x83ad0b4b), WORD(0x9d48e7ac), WORD(0xddea7171),
+	WORD(0x35c41d61), WORD(0x1e39af82), WORD(0x603f5da9), WORD(0xedf1ae72),
+	WORD(0x73e95335), WORD(0xd902d4bd), WORD(0x88dec030), WORD(0x5fe552f8),
+	/* 9G */
+	WORD(0x62a71e83), WORD(0xc2e99555), WORD(0x989b6387), WORD(0x2cfff414),
+	WORD(0x08f3b023), WORD(0x067dadec), WORD(0xca1ec374), WORD(0xac9ba4c5),
+	WORD(0xd5120d40), WORD(0xa6d48f9c), WORD(0xaf63395a), WORD(0xa228e7f1),
+	WORD(0x44c36207), WORD(0xd27f7198), WORD(0x13d73ad6), WORD(0x67f90ca4),
+	WORD(0xecc4b389), WORD(0x00032e6b), WORD(0x43774a08), WORD(0x4c311fed),
+	WORD(0x07927d82), WORD(0xc7f78d51), WORD(0xd3a074c4), WORD(0xdc19f486),
+	WORD(0x5b2600c1), WORD(0xbf22ff9b), WORD(0x87797110), WORD(0xedbb095b),
+	WORD(0xe1a0f016), WORD(0xda3305da), WORD(0x60f6521f), WORD(0x9fb1bb33),
+	/* 11G */
+	WORD(0xc62a7560), WORD(0x5d1cabb2), WORD(0xbe963232), WORD(0x07f0d6b7),
+	WORD(0xa38257c4), WORD(0x6c9d3640), WORD(0xa51221e1), WORD(0x2d100493),
+	WORD(0xcc662506), WORD(0x92affa8f), WORD(0x516a9bd4), WORD(0x07cfb3f0),
+	WORD(0x6742c553), WORD(0x738d68dc), WORD(0x60276031), WORD(0x2b270cab),
+	WORD(0xa58281a7), WORD(0xfa1a3c0b), WORD(0x0c425744), WORD(0xd62e3075),
+	WORD(0x8ad5f944), WORD(0x2c6f1cf2), WORD(0xbc132154), WORD(0x7ec349b6),
+	WORD(0x57fd4b5f), WORD(0xcb7d1ad7), WORD(0x3c301a2c), WORD(0xb2a3e387),
+	WORD(0x8c12f4d7), WORD(0x258d9e10), WORD(0x8180a7ed), WORD(0x9f9f045b),
+	/* 13G */
+	WORD(0xf304f233), WORD(0x470ce5de), WORD(0x2da24861), WORD(0xc0e29008),
+	WORD(0xc2428f53), WORD(0x9576221b), WORD(0x8b97d540), WORD(0x4f2a1e26),
+	WORD(0x9a023a77), WORD(0x50a88a7b), WORD(0x4a66529f), WORD(0x9023ac99),
+	WORD(0xf5aad75f), WORD(0xcc4984a7), WORD(0x6f7780a7), WORD(0x9841f621),
+	WORD(0x5fb2bf2b), WORD(0x05cb1fc3), WORD(0xfef00376), WORD(0xb0cf1aba),
+	WORD(0x9fd0e022), WORD(0x6ff197bb), WORD(0xbbe0c4d4), WORD(0x8e65364f),
+	WORD(0xa3973feb), WORD(0x9ea0bf8d), WORD(0x3e6f8e66), WORD(0xb95842a9),
+	WORD(0x7ba1dbd5), WORD(0xc82fd320), WORD(0xe2c8495c), WORD(0x92602e44),
+	/* 15G */
+	WORD(0x34a32c3d), WORD(0xf555480b), WORD(0xa814fcef), WORD(0xac5f3192),
+	WORD(0xf2e73758), WORD(0x62393bfa), WORD(0x25aaa89f), WORD(0x035d11be),
+	WORD(0x33d269ea), WORD(0x68f7172d), WORD(0x384d88a9), WORD(0x8ea0689f),
+	WORD(0x799a4fc4), WORD(0xa5d5bc2d), WORD(0x7b95e487), WORD(0x8aa8cea6),
+	WORD(0x2919db9a), WORD(0x92300bdc), WORD(0x8bfe1dd2), WORD(0x8dfe8f65),
+	WORD(0x0753b9e7), WORD(0xf6cb0ae8), WORD(0x59b9d3e6), WORD(0x619e4ced),
+	WORD(0x370fec1d), WORD(0x6401717e), WORD(0x61869a04), WORD(0x4d61a50f),
+	WORD(0xe0a331c0), WORD(0x8b51fda7), WORD(0x69ffe00d), WORD(0x9ea097b8),
+	/* 17G */
+	WORD(0x04ea4984), WORD(0xf22f9ff2), WORD(0x86faaeae), WORD(0xa243dfcb),
+	WORD(0x86916063), WORD(0xf8631118), WORD(0xb2e15c19), WORD(0xca0eee4f),
+	WORD(0x8fedbc5e), WORD(0xa0db6b5c), WORD(0x7287a27e), WORD(0xa510d13f),
+	WORD(0xab13e3d6), WORD(0x170a1ecc), WORD(0xefa8e26f), WORD(0x9f87a98d),
+	WORD(0x4904ed45), WORD(0x48d6e503), WORD(0x8e8463be), WORD(0x54ba0fe8),
+	WORD(0x19f25195), WORD(0xfdbf0341), WORD(0xb932c629), WORD(0x4203dc9a),
+	WORD(0x728388c6), WORD(0x8ab16328), WORD(0x684cff48), WORD(0x858bf449),
+	WORD(0x04486e75), WORD(0x2676b149), WORD(0x7edf3d8b), WORD(0x8d666051),
+	/* 19G */
+	WORD(0x334f2ff0), WORD(0xaacea96f), WORD(0x1d84f1e6), WORD(0x3f85dc3a),
+	WORD(0x9b83cea8), WORD(0x87096a9c), WORD(0xdb0ed9e7), WORD(0x504b779e),
+	WORD(0xbfc17187), WORD(0xde2ff469), WORD(0xa70a5022), WORD(0x8f4a4665),
+	WORD(0x7c6cedc6), WORD(0x8ce35550), WORD(0x6779c571), WORD(0x88a00ddc),
+	WORD(0x8cc09534), WORD(0x6909d7c7), WORD(0x2a972cbe), WORD(0x55c93208),
+	WORD(0xb68967d2), WORD(0xf2b54c4e), WORD(0x116e31bc), WORD(0x4965e1bc),
+	WORD(0x653ec646), WORD(0x50e889ea), WORD(0xf59ac727), WORD(0x7aae9635),
+	WORD(0xf9773d11), WORD(0x6e6e10d0), WORD(0x2e1445f5), WORD(0x86d678a1),
+	/* 21G */
+	WORD(0x96e5f875), WORD(0xcf91b04b), WORD(0x913e4815), WORD(0x4d512494),
+	WORD(0x93a2686d), WORD(0x3d9958bd), WORD(0x8774d432), WORD(0xa6b71391),
+	WORD(0x6f796e48), WORD(0x225f13bc), WORD(0x812acb37), WORD(0x4a554960),
+	WORD(0x086c8320), WORD(0x74d4c148), WORD(0x0c8d5c7b), WORD(0x12ed2a90),
+	WORD(0x47a16426), WORD(0x0325eb6d), WORD(0x3b59953f), WORD(0x5a778cb1),
+	WORD(0x53adc403), WORD(0x616f37eb), WORD(0xdb0c7830), WORD(0xdd36d5a7),
+	WORD(0x40ec2102), WORD(0xf0a47077), WORD(0xa16f2a95), WORD(0xee4cbadd),
+	WORD(0x933f83ff), WORD(0x0dac0a67), WORD(0x70622139), WORD(0xa4f32fba),
+	/* 23G */
+	WORD(0x9be0c5da), WORD(0x3142bf18), WORD(0xee0ef19f), WORD(0x47ad910b),
+	WORD(0xcf1c00d1), WORD(0x8961f9c1), WORD(0x66ffc1d4), WORD(0x1e2be3db),
+	WORD(0xb30c70fe), WORD(0x9899a219), WORD(0x53cdba9c), WORD(0x5be39c45),
+	WORD(0x6a6b75e0), WORD(0x8899092a), WORD(0x9e09b518), WORD(0x510355b9),
+	WORD(0x1344cd62), WORD(0x0a7c0ea8), WORD(0x442453e4), WORD(0xd812df0b),
+	WORD(0xeb96b5e0), WORD(0xbdb9f0ec), WORD(0x301f6439), WORD(0x6251c3b6),
+	WORD(0xbca336dd), WORD(0x44e4fe72), WORD(0x6b401af2), WORD(0x3927cb34),
+	WORD(0xbc901abd), WORD(0xe6b063ec), WORD(0xd03dc84b), WORD(0x78ec8de1),
+	/* 25G */
+	WORD(0xabb1403c), WORD(0x451deb34), WORD(0xce57eee8), WORD(0xec2031ac),
+	WORD(0x1bf7e990), WORD(0x4cbe3a7d), WORD(0x6caca7f2), WORD(0x4c4c623c),
+	WORD(0x34fdc886), WORD(0x9bde877f), WORD(0x5954d37f), WORD(0x3931903f),
+	WORD(0xa23edc52), WORD(0xdd506b54), WORD(0x5db5b83c), WORD(0x0caf091b),
+	WORD(0x97b8cf66), WORD(0x34d52481), WORD(0xbc80070b), WORD(0x73ea031c),
+	WORD(0xead04843), WORD(0x57628c5d), WORD(0xca9f727a), WORD(0x7ca1b9c0),
+	WORD(0xa1dd3065), WORD(0x60a4c84c), WORD(0xca19c73f), WORD(0xd73681f7),
+	WORD(0x48634b73), WORD(0x9d3b53a1), WORD(0x674e13ba), WORD(0x107edd66),
+	/* 27G */
+	WORD(0xe1de81a1), WORD(0xa1d62823), WORD(0x8eb3ab0d), WORD(0x1844bcf6),
+	WORD(0x6b98753d), WORD(0xefd209cd), WORD(0xb1272672), WORD(0x5ca56729),
+	WORD(0x0e6c9207), WORD(0xaeae1600), WORD(0x41df5eba), WORD(0x8ce0b5cb),
+	WORD(0x7ae93698), WORD(0x2d3dc2bd), WORD(0x5300647b), WORD(0x18f9406e),
+	WORD(0xc65efece), WORD(0xbb928bca), WORD(0x18431439), WORD(0xc963e4f8),
+	WORD(0x6214aa12), WORD(0x43cb9b4e), WORD(0x93026e7c), WORD(0x02986513),
+	WORD(0xe9635e54), WORD(0x2acc14d3), WORD(0x73087ec1), WORD(0x33db1655),
+	WORD(0x95def550), WORD(0x1ed8314a), WORD(0xa87455cb), WORD(0x21c735c8),
+	/* 29G */
+	WORD(0xe7af8c20), WORD(0xe5554836), WORD(0xacc5e14b), WORD(0x0799d40c),
+	WORD(0xb163b21a), WORD(0x0c5315de), WORD(0x5bd58ca2), WORD(0x67d8dbd4),
+	WORD(0xc419a3fe), WORD(0xb6aea1fa), WORD(0x06e5cacb), WORD(0xb8c718cd),
+	WORD(0x406b30d6), WORD(0x49061ef6), WORD(0x26be98fa), WORD(0x3d60a1e5),
+	WORD(0x8bd25771), WORD(0x2e58648e), WORD(0xef79ec21), WORD(0x8ee17af1),
+	WORD(0x8f86d087), WORD(0xb0543a45), WORD(0x2e0bf4fb), WORD(0x9935d660),
+	WORD(0xb5337216), WORD(0x018093f0), WORD(0x74dc59f9), WORD(0xe8793052),
+	WORD(0x3eba9e98), WORD(0xc59d19df), WORD(0xfb34c660), WORD(0x4c8d582d),
+	/* 31G */
+	WORD(0x1985842b), WORD(0xe6afd253), WORD(0x9f4b4805), WORD(0x72aaca53),
+	WORD(0xbbc0af11), WORD(0xd994abbc), WORD(0xc23a9911), WORD(0xdef6784b),
+	WORD(0x0cc75f43), WORD(0x37abe4e0), WORD(0xd570af35), WORD(0x948b8a3b),
+	WORD(0x69da7c4c), WORD(0x28ba74c9), WORD(0xfd8d5010), WORD(0x0f91b2fb),
+	WORD(0xce66eea0), WORD(0x06969960), WORD(0xe99c515b), WORD(0x6c2f6ac6),
+	WORD(0xf3121fef), WORD(0x8175083d), WORD(0x180595c3), WORD(0x4c6540ca),
+	WORD(0x544c4f48), WORD(0xce1b4fe6), WORD(0x79aa283f), WORD(0xcdf37d95),
+	WORD(0x77f596b9), WORD(0x74d19395), WORD(0x405234e6), WORD(0x95d4b47b),
+	/* 33G */
+	WORD(0xd64643e2), WORD(0x056b2c66), WORD(0x6f35507e), WORD(0x5c4a51f1),
+	WORD(0xb18f1929), WORD(0x9e848126), WORD(0x00f62280), WORD(0x5dbb0f92),
+	WORD(0xd7eb5da7), WORD(0xb3a4e66b), WORD(0x8529382b), WORD(0x1394a755),
+	WORD(0xe1b61a38), WORD(0xe64fea1f), WORD(0xf0c03ae2), WORD(0x5dacdd47),
+	WORD(0xd272c5a8), WORD(0x62c9cc62), WORD(0xd713d261), WORD(0x93dbbba0),
+	WORD(0x4ecaff08), WORD(0x53708438), WORD(0x286ccb2e), WORD(0x1e967206),
+	WORD(0xc082fcde), WORD(0x3dfccdce), WORD(0x0ee55cb3), WORD(0x6ba109fb),
+	WORD(0xc2e903b4), WORD(0xaf98dfe1), WORD(0xb0d0a0b6), WORD(0x27aa6703),
+	/* 35G */
+	WORD(0x7c96082a), WORD(0xd5a6efab), WORD(0x44c676e5), WORD(0x876ceeed),
+	WORD(0x701effd1), WORD(0x1e57e081), WORD(0xff2f6efc), WORD(0x161a9ae5),
+	WORD(0x49ed828a), WORD(0x5352ac12), WORD(0x2429f5a5), WORD(0x0d224846),
+	WORD(0xd5904312), WORD(0xedb216e5), WORD(0x1a7d52fd), WORD(0x66de36b7),
+	WORD(0x7b7ed858), WORD(0xadff479b), WORD(0xc87e55eb), WORD(0x9f883b1d),
+	WORD(0x090c4a47), WORD(0x2631fed9), WORD(0x9bdb772e), WORD(0x4c119025),
+	WORD(0x7ea80e71), WORD(0x2e2d5c72), WORD(0xbee56fd9), WORD(0x20c16a6c),
+	WORD(0xf956986e), WORD(0x08e20ea5), WORD(0x773a2576), WORD(0x71da23e0),
+	/* 37G */
+	WORD(0x7fd4c4eb), WORD(0x8d5e3ede), WORD(0xcd5299d2), WORD(0x99e2b145),
+	WORD(0xd315d692), WORD(0x920a596b), WORD(0x05153d29), WORD(0xce3b1106),
+	WORD(0x01691a96), WORD(0x8903b6e0), WORD(0xe764302c), WORD(0xc9272318),
+	WORD(0xaa251d0a), WORD(0xf302f59f), WORD(0x84d63d6b), WORD(0x01dd39db),
+	WORD(0x7e21fd04), WORD(0xf8e688c8), WORD(0xdfe4af48), WORD(0x6d02248b),
+	WORD(0x220e3131), WORD(0x40199849), WORD(0x9093f17f), WORD(0x22b02412),
+	WORD(0x5208885b), WORD(0x24a42a3b), WORD(0x003b46d8), WORD(0x03713bc2),
+	WORD(0xc1d1a7ae), WORD(0x90bf8d15), WORD(0x24a1de30), WORD(0x0bc53902),
+	/* 39G */
+	WORD(0x97bd3bf0), WORD(0x1bf9e4b9), WORD(0x4ca5522f), WORD(0xa938379d),
+	WORD(0x42b7b1dd), WORD(0x81417a35), WORD(0x6f75cf46), WORD(0x0d520ebd),
+	WORD(0x93d39dd8), WORD(0xd40585e4), WORD(0xcd385a3c), WORD(0x6f31064f),
+	WORD(0x3e2fad4d), WORD(0x18f964d0), WORD(0xbf48e602), WORD(0x951add3e),
+	WORD(0x14437570), WORD(0x601c7a3f), WORD(0x50cad500), WORD(0x7fd80556),
+	WORD(0xed09c44e), WORD(0xe4b28d80), WORD(0x1c7921d6), WORD(0x134e3e2c),
+	WORD(0xc0d7d1dc), WORD(0x38d6b095), WORD(0x90e9ba56), WORD(0x932814fc),
+	WORD(0x4b39802c), WORD(0x609f996f), WORD(0x88f8da30), WORD(0x9223aff5),
+	/* 41G */
+	WORD(0x9bfb2f9a), WORD(0x6ca1cd3e), WORD(0xceb5c60d), WORD(0xce122217),
+	WORD(0x71522223), WORD(0x8f6da10b), WORD(0x5aad7ede), WORD(0x07c88bca),
+	WORD(0x4e79dccf), WORD(0x7f76a777), WORD(0x4ca52223), WORD(0xe3b740fb),
+	WORD(0x8e656063), WORD(0x7e07db2b), WORD(0xf8625575), WORD(0x54277a1e),
+	WORD(0xecbcf3f4), WORD(0x1ceb6c58), WORD(0xfd53f818), WORD(0xe71b04e2),
+	WORD(0x12b0e95c), WORD(0x53b15531), WORD(0x3938c645), WORD(0x8354efa2),
+	WORD(0x65e7b527), WORD(0x95ddd783), WORD(0x3291032e), WORD(0xc12408cd),
+	WORD(0xe37bedb9), WORD(0x0b45ac38), WORD(0x1d51290e), WORD(0x005ad62b),
+	/* 43G */
+	WORD(0xa4d4fea1), WORD(0xd909b600), WORD(0x9024282d), WORD(0x4d1edb4e),
+	WORD(0xc3244a60), WORD(0x552e66a4), WORD(0x9ee9b45b), WORD(0xd16f50ee),
+	WORD(0x8f16ed5e), WORD(0xa5402d82), WORD(0x4a5079b9), WORD(0xa4bb8267),
+	WORD(0x291be752), WORD(0x1d6133b0), WORD(0x94e693b2), WORD(0x2943448c),
+	WORD(0x5bb3ae45), WORD(0xc407bc52), WORD(0x38b5935d), WORD(0xaf63a445),
+	WORD(0x949ff811), WORD(0x1f27a1ea), WORD(0x64b99b0a), WORD(0xe5c10c6f),
+	WORD(0xacaab21f), WORD(0x14fad0a6), WORD(0xaa088eac), WORD(0xba02a4ae),
+	WORD(0x8b06d5cc), WORD(0xd045bb67), WORD(0xba589616), WORD(0x6c6fb5bd),
+	/* 45G */
+	WORD(0x833aedb9), WORD(0xb22d6a5a), WORD(0x534f7c1b), WORD(0x38d6e155),
+	WORD(0x616a4cce), WORD(0x52087cbc), WORD(0xaec5029d), WORD(0x18a89585),
+	WORD(0x0c605ace), WORD(0x68a0f51d), WORD(0xd3038ec3), WORD(0x5c804ae3),
+	WORD(0x26acbdcb), WORD(0xa77c6d89), WORD(0x03a8efad), WORD(0x9ceb5a98),
+	WORD(0xc2291a7a), WORD(0x44a5b8ae), WORD(0x2359d5b6), WORD(0x920f44b0),
+	WORD(0xf44a9b7b), WORD(0x5a769d21), WORD(0x6f1137c6), WORD(0x5bad531d),
+	WORD(0x9667367e), WORD(0x6833c71a), WORD(0x2479b53e), WORD(0x8c4ff35d),
+	WORD(0x31cf3f9a), WORD(0x5deb45b4), WORD(0x89e37b23), WORD(0x5eff7dac),
+	/* 47G */
+	WORD(0xfdcf4752), WORD(0x0f1654e7), WORD(0x84c40072), WORD(0x032809be),
+	WORD(0x9697efdb), WORD(0x452337ab), WORD(0x9b588f16), WORD(0xe788a47a),
+	WORD(0xc5bd6532), WORD(0x02e8972c), WORD(0xb1b9a672), WORD(0xcc256ccf),
+	WORD(0xd1c9e4fb), WORD(0x328eb0cd), WORD(0x5322f716), WORD(0x1f485a26),
+	WORD(0x9f15536e), WORD(0x8493bdb2), WORD(0x0d9d0298), WORD(0x2aee1854),
+	WORD(0x3ebca2fd), WORD(0x3e3001c9), WORD(0x3e5376c3), WORD(0xe16c407e),
+	WORD(0xf072bb4d), WORD(0xb67bb781), WORD(0xee81439f), WORD(0x09efa38a),
+	WORD(0x968bec91), WORD(0x45d74dcf), WORD(0x0984550d), WORD(0x189154f9),
+	/* 49G */
+	WORD(0xcaa919c8), WORD(0x2ac8c11c), WORD(0x3a74f754), WORD(0x6b65602d),
+	WORD(0x096685f8), WORD(0xee56d872), WORD(0xb06e255c), WORD(0x07882a8e),
+	WORD(0x12870de2), WORD(0x2ff5939e), WORD(0x1621eef9), WORD(0x2fc25c13),
+	WORD(0x26907a79), WORD(0xebaee825), WORD(0xfa6deec6), WORD(0x417afa3f),
+	WORD(0xd9116303), WORD(0x5ad54384), WORD(0xfb01f599), WORD(0x8ddadc56),
+	WORD(0x87b268d1), WORD(0xe7600a24), WORD(0x386db00f), WORD(0xc7c29708),
+	WORD(0x6d5e1e9f), WORD(0xe98a1c03), WORD(0x28bb0234), WORD(0xd3639a58),
+	WORD(0xe5c10d3d), WORD(0x6b6f9bbb), WORD(0x3c6e87ca), WORD(0xa34292e0),
+	/* 51G */
+	WORD(0x54a52893), WORD(0xf61736d7), WORD(0x612d4daa), WORD(0x247c94a1),
+	WORD(0x0e290f7d), WORD(0x64f350d6), WORD(0xc3a6f177), WORD(0x88e6b8a5),
+	WORD(0x8f465ee3), WORD(0x62ef2591), WORD(0xb64353fa), WORD(0xadeaeb60),
+	WORD(0xb1f201b7), WORD(0xcb40538b), WORD(0x6879ec45), WORD(0x291bd899),
+	WORD(0x0a445601), WORD(0x7ee1d1b1), WORD(0x050c2835), WORD(0x164f62fa),
+	WORD(0x2435a6e8), WORD(0x77741fd7), WORD(0xb58bc452), WORD(0x9fa27c6c),
+	WORD(0x0a445df2), WORD(0xbc6cb3d3), WORD(0x869fb555), WORD(0x211e5021),
+	WORD(0x5ede2976), WORD(0xaf31d932), WORD(0xce91a857), WORD(0x97c641df),
+	/* 53G */
+	WORD(0x23d2c157), WORD(0x91518f01), WORD(0xf53444ef), WORD(0xf2cc4815),
+	WORD(0xb922535a), WORD(0x0038e3a9), WORD(0x9f9f8e4f), WORD(0xfb6b120c),
+	WORD(0x0342d817), WORD(0x1cfa790b), WORD(0x1ab22cef), WORD(0x3ea3268d),
+	WORD(0x1b490f67), WORD(0x9c04ae58), WORD(0x83dc5da1), WORD(0x03f5206e),
+	WORD(0xbc9a2192), WORD(0x14eb324a), WORD(0x4548ae62), WORD(0x344d737e),
+	WORD(0xb5fc6eff), WORD(0x739db92e), WORD(0x873b69db), WORD(0x46c3e990),
+	WORD(0x8930c805), WORD(0x89a733c7), WORD(0xeff7850a), WORD(0x5a3d7419),
+	WORD(0xa7f5a2a2), WORD(0x8a848621), WORD(0xda6eb8d1), WORD(0x4ceffb70),
+	/* 55G */
+	WORD(0x7d0239f1), WORD(0x30555d28), WORD(0x0039e989), WORD(0x9a7bc6c6),
+	WORD(0xe91795b1), WORD(0x70bf5928), WORD(0x797eefe6), WORD(0x6c587abd),
+	WORD(0x858796e6), WORD(0xc52c95d0), WORD(0xbfaa6552), WORD(0x7ecdc090),
+	WORD(0x169c2042), WORD(0xdb121f73), WORD(0xddf22a97), WORD(0x4b13a8cf),
+	WORD(0x6f13508d), WORD(0x3eb27a2d), WORD(0xd5208157), WORD(0xebcd060b),
+	WORD(0x875b7c1e), WORD(0x1e96772d), WORD(0xee825d81), WORD(0x6f35f5a7),
+	WORD(0x64cab86f), WORD(0xe0aae092), WORD(0x5b9b8167), WORD(0x52e3087c),
+	WORD(0xa5df0644), WORD(0x96e03796), WORD(0x17129eba), WORD(0x13de84be),
+	/* 57G */
+	WORD(0xdb440406), WORD(0x6f71c960), WORD(0x6a9df029), WORD(0xed888d05),
+	WORD(0x8978605d), WORD(0x21ec74ae), WORD(0x4487f1b9), WORD(0x13a8c849),
+	WORD(0x6947ebe7), WORD(0xd1453ad9), WORD(0x0c7f9c5a), WORD(0xd6d19cc3),
+	WORD(0xf1003473), WORD(0xdca36d95), WORD(0xde194cbe), WORD(0x4a9184f2),
+	WORD(0x1e839cb6), WORD(0xbf81737b), WORD(0xd18f644e), WORD(0x0ac9a59d),
+	WORD(0xaa2f606c), WORD(0x4be63d84), WORD(0xaf23318c), WORD(0xa09e5439),
+	WORD(0x48d1caa9), WORD(0xa4c2a71c), WORD(0x2f2c753e), WORD(0xa7d3886f),
+	WORD(0xc35edc41), WORD(0xe61410d2), WORD(0x5ffdce16), WORD(0x9b433b08),
+	/* 59G */
+	WORD(0x56c9e8a4), WORD(0xe553d2ea), WORD(0x4aceea2c), WORD(0x9073f3b4),
+	WORD(0x81d8ed7b), WORD(0xccb5a142), WORD(0x0d028956), WORD(0x25bc2c7d),
+	WORD(0x06897c03), WORD(0x4af24939), WORD(0x65d9d0c2), WORD(0x56445b35),
+	WORD(0x8e04e376), WORD(0x26596338), WORD(0xcff49606), WORD(0x9e6e002d),
+	WORD(0x2498379c), WORD(0xafed852d), WORD(0xae730982), WORD(0x54662eab),
+	WORD(0xe4e6ebcf), WORD(0xce320963), WORD(0x900d8dc3), WORD(0x6f6a42bd),
+	WORD(0x2c25e235), WORD(0xc59d2120), WORD(0x095ca35e), WORD(0x88cbfcaf),
+	WORD(0xc7cd93bf), WORD(0xeb2ef231), WORD(0x50ff6936), WORD(0x0877f881),
+	/* 61G */
+	WORD(0xff0b425f), WORD(0xbddb9ef6), WORD(0x03b1c4c2), WORD(0xec834090),
+	WORD(0xede8a676), WORD(0xde37cec2), WORD(0xdfadeb0a), WORD(0xbd788280),
+	WORD(0xc9d493a1), WORD(0x05147d56), WORD(0xcd23907e), WORD(0x8181d6da),
+	WORD(0xec9cd237), WORD(0xa124fb12), WORD(0x4004c7b2), WORD(0x4bd93bac),
+	WORD(0x0717d896), WORD(0x3e6742a0), WORD(0xcb675ad5), WORD(0xe1d729c3),
+	WORD(0xf84310a6), WORD(0xa514b143), WORD(0xfe06b757), WORD(0x91b21130),
+	WORD(0xe50498a9), WORD(0x55540ab1), WORD(0x1997ea23), WORD(0xff89a1a8),
+	WORD(0xb01e9833), WORD(0xdd44fc49), WORD(0x3917edbb), WORD(0x701a4b66),
+	/* 63G */
+	WORD(0xb6667c2f), WORD(0xc7d6f35b), WORD(0xa380a69d), WORD(0xcb6d7b7f),
+	WORD(0x77a3b554), WORD(0x7b53e8fe), WORD(0x28e23e5b), WORD(0x663db465),
+	WORD(0x52e78560), WORD(0x137107ba), WORD(0xc8b6f9f5), WORD(0x9968f8fd),
+	WORD(0x0df78e48), WORD(0x29f042c0), WORD(0x316f493f), WORD(0x8e52e10b),
+	WORD(0x89cf19b1), WORD(0xbdafb9ea), WORD(0x4902426a), WORD(0xe4d7265e),
+	WORD(0x907dde71), WORD(0xd1162410), WORD(0xd4760ae5), WORD(0x15f6d83f),
+	WORD(0x0df40c5f), WORD(0xc33568d0), WORD(0xdf8ecb9d), WORD(0x99c4fc94),
+	WORD(0x1400de15), WORD(0x84220131), WORD(0x419af14e), WORD(0x9a19bc3c),
+};
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+static const word_t brainpoolp512r1_gen_wnaf[] = {
+	/* G */
+	WORD(0xd9d3), WORD(0x5161), WORD(0x9609), WORD(0xc4ce), WORD(0x02a4), WORD(0x272c),
+	WORD(0x4d64), WORD(0x683e), WORD(0x5e8f), WORD(0x6df5), WORD(0x0414), WORD(0x34ab),
+	WORD(0x1fc8), WORD(0x14c0), WORD(0x5395), WORD(0x8550), WORD(0x8737), WORD(0x905c),
+	WORD(0xd76f), WORD(0x2433), WORD(0x3cf7), WORD(0xf36d), WORD(0xea37), WORD(0xb2b6),
+	WORD(0x4573), WORD(0x006d), WORD(0xb5ca), WORD(0x871c), WORD(0xe981), WORD(0x0994),
+	WORD(0xa14c), WORD(0x5a2b), WORD(0x2a6d), WORD(0x2504), WORD(0x6629), WORD(0x2f90),
+	WORD(0xf325), WORD(0x4742), WORD(0xdf6f), WORD(0x7518), WORD(0x9490), WORD(0x4c85),
+	WORD(0x5553), WORD(0xbf84), WORD(0xcc3e), WORD(0x598e), WORD(0xc775), WORD(0x360e),
+	WORD(0x2fdc), WORD(0x8fe6), WORD(0x0b88), WORD(0x7c17), WORD(0x3f8c), WORD(0xcd9d),
+	WORD(0x2b77), WORD(0x585d), WORD(0x3f9b), WORD(0x870f), WORD(0xd7da), WORD(0x9a5e),
+	WORD(0x7281), WORD(0x2acb), WORD(0xc9d1), WORD(0x8c50),
+	/* 3G */
+	WORD(0x8637), WORD(0xcb0d), WORD(0xd7bb), WORD(0x3268), WORD(0x5b05), WORD(0x40df),
+	WORD(0x56dc), WORD(0x92da), WORD(0xa868), WORD(0x0827), WORD(0x30c8), WORD(0x4421),
+	WORD(0x03bc), WORD(0x0393), WORD(0x3eda), WORD(0xdafb), WORD(0x9f35), WORD(0x7a5d),
+	WORD(0xb6ec), WORD(0xd6fd), WORD(0x31cd), WORD(0xea87), WORD(0x962d), WORD(0xf0d8),
+	WORD(0x788e), WORD(0x03ab), WORD(0x9483), WORD(0x4dd3), WORD(0x9656), WORD(0x7531),
+	WORD(0x646e), WORD(0x5bc5), WORD(0xcc94), WORD(0xbb99), WORD(0x6254), WORD(0x8509),
+	WORD(0x2780), WORD(0x38d7), WORD(0x949e), WORD(0xa2cf), WORD(0xf70c), WORD(0x00df),
+	WORD(0x2be9), WORD(0x5062), WORD(0xa693), WORD(0x5bdb), WORD(0xeea2), WORD(0x70ae),
+	WORD(0xe348), WORD(0x4c30), WORD(0x2ecb), WORD(0xcf88), WORD(0x9c49), WORD(0x2755),
+	WORD(0x151a), WORD(0x4062), WORD(0xcbb6), WORD(0xc924), WORD(0x6caa), WORD(0xe0e4),
+	WORD(0x6f6f), WORD(0x3a48), WORD(0xcbd9), WORD(0x89cd),
+	/* 5G */
+	WORD(0x3539), WORD(0x772c), WORD(0x299b), WORD(0xfad0), WORD(0x5fbb), WORD(0x9789),
+	WORD(0x8c1e), WORD(0xb7b3), WORD(0x91c6), WORD(0x3f5d), WORD(0x2f40), WORD(0x2a43),
+	WORD(0xecaf), WORD(0x68b5), WORD(0xe21f), WORD(0x8c11), WORD(0xd040), WORD(0x2736),
+	WORD(0xa723), WORD(0x4183), WORD(0x0667), WORD(0x85b8), WORD(0xace6), WORD(0x163f),
+	WORD(0x280a), WORD(0x34a7), WORD(0xc409), WORD(0x8ea7), WORD(0x44a0), WORD(0xa755),
+	WORD(0x0e10), WORD(0x7bff), WORD(0x4503), WORD(0xbf0f), WORD(0x6edc), WORD(0xc1fd),
+	WORD(0x252c), WORD(0xca09), WORD(0xf2f9), WORD(0x8bb5), WORD(0xe481), WORD(0x275a),
+	WORD(0x616d), WORD(0x06c2), WORD(0xefb6), WORD(0x7a4e), WORD(0x69eb), WORD(0x6631),
+	WORD(0xb9f8), WORD(0x09e0), WORD(0x93ef), WORD(0xda46), WORD(0x2626), WORD(0x1d13),
+	WORD(0x8916), WORD(0x38ce), WORD(0xe3c4), WORD(0x9e57), WORD(0xc39a), WORD(0x4637),
+	WORD(0x4403), WORD(0xd525), WORD(0x741f), WORD(0x2753),
+	/* 7G */
+	WORD(0xa902), WORD(0xf7ad), WORD(0xf620), WORD(0x28c2), WORD(0x0274), WORD(0x69ba),
+	WORD(0xa1f7), WORD(0x744e), WORD(0xc77a), WORD(0x3279), WORD(0x0198), WORD(0xb76d),
+	WORD(0xf32c), WORD(0xa29a), WORD(0xd98b), WORD(0x114b), WORD(0x6a94), WORD(0xbc56),
+	WORD(0xd2d0), WORD(0xda43), WORD(0x2942), WORD(0xe23e), WORD(0x54e0), WORD(0xd199),
+	WORD(0x6880), WORD(0xfd6f), WORD(0x86e8), WORD(0xa631), WORD(0xafb7), WORD(0x388d),
+	WORD(0xb24a), WORD(0x1332), WORD(0x92e1), WORD(0xf3ff), WORD(0x2318), WORD(0x29bd),
+	WORD(0xb540), WORD(0xb3de), WORD(0x887c), WORD(0xed05), WORD(0xa0be), WORD(0xa7c3),
+	WORD(0x0b4b), WORD(0x83ad), WORD(0xe7ac), WORD(0x9d48), WORD(0x7171), WORD(0xddea),
+	WORD(0x1d61), WORD(0x35c4), WORD(0xaf82), WORD(0x1e39), WORD(0x5da9), WORD(0x603f),
+	WORD(0xae72), WORD(0xedf1), WORD(0x5335), WORD(0x73e9), WORD(0xd4bd), WORD(0xd902),
+	WORD(0xc030), WORD(0x88de), WORD(0x52f8), WORD(0x5fe5),
+	/* 9G */
+	WORD(0x1e83), WORD(0x62a7), WORD(0x9555), WORD(0xc2e9), WORD(0x6387), WORD(0x989b),
+	WORD(0xf414), WORD(0x2cff), WORD(0xb023), WORD(0x08f3), WORD(0xadec), WORD(0x067d),
+	WORD(0xc374), WORD(0xca1e), WORD(0xa4c5), WORD(0xac9b), WORD(0x0d40), WORD(0xd512),
+	WORD(0x8f9c), WORD(0xa6d4), WORD(0x395a), WORD(0xaf63), WORD(0xe7f1), WORD(0xa228),
+	WORD(0x6207), WORD(0x44c3), WORD(0x7198), WORD(0xd27f), WORD(0x3ad6), WORD(0x13d7),
+	WORD(0x0ca4), WORD(0x67f9), WORD(0xb389), WORD(0xecc4), WORD(0x2e6b), WORD(0x0003),
+	WORD(0x4a08), WORD(0x4377), WORD(0x1fed), WORD(0x4c31), WORD(0x7d82), WORD(0x0792),
+	WORD(0x8d51), WORD(0xc7f7), WORD(0x74c4), WORD(0xd3a0), WORD(0xf486), WORD(0xdc19),
+	WORD(0x00c1), WORD(0x5b26), WORD(0xff9b), WORD(0xbf22), WORD(0x7110), WORD(0x8779),
+	WORD(0x095b), WORD(0xedbb), WORD(0xf016), WORD(0xe1a0), WORD(0x05da), WORD(0xda33),
+	WORD(0x521f), WORD(0x60f6), WORD(0xbb33), WORD(0x9fb1),
+	/* 11G */
+	WORD(0x7560), WORD(0xc62a), WORD(0xabb2), WORD(0x5d1c), WORD(0x3232), WORD(0xbe96),
+	WORD(0xd6b7), WORD(0x07f0), WORD(0x57c4), WORD(0xa382), WORD(0x3640), WORD(0x6c9d),
+	WORD(0x21e1), WORD(0xa512), WORD(0x0493), WORD(0x2d10), WORD(0x2506), WORD(0xcc66),
+	WORD(0xfa8f), WORD(0x92af), WORD(0x9bd4), WORD(0x516a), WORD(0xb3f0), WORD(0x07cf),
+	WORD(0xc553), WORD(0x6742), WORD(0x68dc), WORD(0x738d), WORD(0x6031), WORD(0x6027),
+	WORD(0x0cab), WORD(0x2b27), WORD(0x81a7), WORD(0xa582), WORD(0x3c0b), WORD(0xfa1a),
+	WORD(0x5744), WORD(0x0c42), WORD(0x3075), WORD(0xd62e), WORD(0xf944), WORD(0x8ad5),
+	WORD(0x1cf2), WORD(0x2c6f), WORD(0x2154), WORD(0xbc13), WORD(0x49b6), WORD(0x7ec3),
+	WORD(0x4b5f), WORD(0x57fd), WORD(0x1ad7), WORD(0xcb7d), WORD(0x1a2c), WORD(0x3c30),
+	WORD(0xe387), WORD(0xb2a3), WORD(0xf4d7), WORD(0x8c12), WORD(0x9e10), WORD(0x258d),
+	WORD(0xa7ed), WORD(0x8180), WORD(0x045b), WORD(0x9f9f),
+	/* 13G */
+	WORD(0xf233), WORD(0xf304), WORD(0xe5de), WORD(0x470c), WORD(0x4861), WORD(0x2da2),
+	WORD(0x9008), WORD(0xc0e2), WORD(0x8f53), WORD(0xc242), WORD(0x221b), WORD(0x9576),
+	WORD(0xd540), WORD(0x8b97), WORD(0x1e26), WORD(0x4f2a), WORD(0x3a77), WORD(0x9a02),
+	WORD(0x8a7b), WORD(0x50a8), WORD(0x529f), WORD(0x4a66), WORD(0xac99), WORD(0x9023),
+	WORD(0xd75f), WORD(0xf5aa), WORD(0x84a7), WORD(0xcc49), WORD(0x80a7), WORD(0x6f77),
+	WORD(0xf621), WORD(0x9841), WORD(0xbf2b), WORD(0x5fb2), WORD(0x1fc3), WORD(0x05cb),
+	WORD(0x0376), WORD(0xfef0), WORD(0x1aba), WORD(0xb0cf), WORD(0xe022), WORD(0x9fd0),
+	WORD(0x97bb), WORD(0x6ff1), WORD(0xc4d4), WORD(0xbbe0), WORD(0x364f), WORD(0x8e65),
+	WORD(0x3feb), WORD(0xa397), WORD(0xbf8d), WORD(0x9ea0), WORD(0x8e66), WORD(0x3e6f),
+	WORD(0x42a9), WORD(0xb958), WORD(0xdbd5), WORD(0x7ba1), WORD(0xd320), WORD(0xc82f),
+	WORD(0x495c), WORD(0xe2c8), WORD(0x2e44), WORD(0x9260),
+	/* 15G */
+	WORD(0x2c3d), WORD(0x34a3), WORD(0x480b), WORD(0xf555), WORD(0xfcef), WORD(0xa814),
+	WORD(0x3192), WORD(0xac5f), WORD(0x3758), WORD(0xf2e7), WORD(0x3bfa), WORD(0x6239),
+	WORD(0xa89f), WORD(0x25aa), WORD(0x11be), WORD(0x035d), WORD(0x69ea), WORD(0x33d2),
+	WORD(0x172d), WORD(0x68f7), WORD(0x88a9), WORD(0x384d), WORD(0x689f), WORD(0x8ea0),
+	WORD(0x4fc4), WORD(0x799a), WORD(0xbc2d), WORD(0xa5d5), WORD(0xe487), WORD(0x7b95),
+	WORD(0xcea6), WORD(0x8aa8), WORD(0xdb9a), WORD(0x2919), WORD(0x0bdc), WORD(0x9230),
+	WORD(0x1dd2), WORD(0x8bfe), WORD(0x8f65), WORD(0x8dfe), WORD(0xb9e7), WORD(0x0753),
+	WORD(0x0ae8), WORD(0xf6cb), WORD(0xd3e6), WORD(0x59b9), WORD(0x4ced), WORD(0x619e),
+	WORD(0xec1d), WORD(0x370f), WORD(0x717e), WORD(0x6401), WORD(0x9a04), WORD(0x6186),
+	WORD(0xa50f), WORD(0x4d61), WORD(0x31c0), WORD(0xe0a3), WORD(0xfda7), WORD(0x8b51),
+	WORD(0xe00d), WORD(0x69ff), WORD(0x97b8), WORD(0x9ea0),
+	/* 17G */
+	WORD(0x4984), WORD(0x04ea), WORD(0x9ff2), WORD(0xf22f), WORD(0xaeae), WORD(0x86fa),
+	WORD(0xdfcb), WORD(0xa243), WORD(0x6063), WORD(0x8691), WORD(0x1118), WORD(0xf863),
+	WORD(0x5c19), WORD(0xb2e1), WORD(0xee4f), WORD(0xca0e), WORD(0xbc5e), WORD(0x8fed),
+	WORD(0x6b5c), WORD(0xa0db), WORD(0xa27e), WORD(0x7287), WORD(0xd13f), WORD(0xa510),
+	WORD(0xe3d6), WORD(0xab13), WORD(0x1ecc), WORD(0x170a), WORD(0xe26f), WORD(0xefa8),
+	WORD(0xa98d), WORD(0x9f87), WORD(0xed45), WORD(0x4904), WORD(0xe503), WORD(0x48d6),
+	WORD(0x63be), WORD(0x8e84), WORD(0x0fe8), WORD(0x54ba), WORD(0x5195), WORD(0x19f2),
+	WORD(0x0341), WORD(0xfdbf), WORD(0xc629), WORD(0xb932), WORD(0xdc9a), WORD(0x4203),
+	WORD(0x88c6), WORD(0x7283), WORD(0x6328), WORD(0x8ab1), WORD(0xff48), WORD(0x684c),
+	WORD(0xf449), WORD(0x858b), WORD(0x6e75), WORD(0x0448), WORD(0xb149), WORD(0x2676),
+	WORD(0x3d8b), WORD(0x7edf), WORD(0x6051), WORD(0x8d66),
+	/* 19G */
+	WORD(0x2ff0), WORD(0x334f), WORD(0xa96f), WORD(0xaace), WORD(0xf1e6), WORD(0x1d84),
+	WORD(0xdc3a), WORD(0x3f85), WORD(0xcea8), WORD(0x9b83), WORD(0x6a9c), WORD(0x8709),
+	WORD(0xd9e7), WORD(0xdb0e), WORD(0x779e), WORD(0x504b), WORD(0x7187), WORD(0xbfc1),
+	WORD(0xf469), WORD(0xde2f), WORD(0x5022), WORD(0xa70a), WORD(0x4665), WORD(0x8f4a),
+	WORD(0xedc6), WORD(0x7c6c), WORD(0x5550), WORD(0x8ce3), WORD(0xc571), WORD(0x6779),
+	WORD(0x0ddc), WORD(0x88a0), WORD(0x9534), WORD(0x8cc0), WORD(0xd7c7), WORD(0x6909),
+	WORD(0x2cbe), WORD(0x2a97), WORD(0x3208), WORD(0x55c9), WORD(0x67d2), WORD(0xb689),
+	WORD(0x4c4e), WORD(0xf2b5), WORD(0x31bc), WORD(0x116e), WORD(0xe1bc), WORD(0x4965),
+	WORD(0xc646), WORD(0x653e), WORD(0x89ea), WORD(0x50e8), WORD(0xc727), WORD(0xf59a),
+	WORD(0x9635), WORD(0x7aae), WORD(0x3d11), WORD(0xf977), WORD(0x10d0), WORD(0x6e6e),
+	WORD(0x45f5), WORD(0x2e14), WORD(0x78a1), WORD(0x86d6),
+	/* 21G */
+	WORD(0xf875), WORD(0x96e5), WORD(0xb04b), WORD(0xcf91), WORD(0x4815), WORD(0x913e),
+	WORD(0x2494), WORD(0x4d51), WORD(0x686d), WORD(0x93a2), WORD(0x58bd), WORD(0x3d99),
+	WORD(0xd432), WORD(0x8774), WORD(0x1391), WORD(0xa6b7), WORD(0x6e48), WORD(0x6f79),
+	WORD(0x13bc), WORD(0x225f), WORD(0xcb37), WORD(0x812a), WORD(0x4960), WORD(0x4a55),
+	WORD(0x8320), WORD(0x086c), WORD(0xc148), WORD(0x74d4), WORD(0x5c7b), WORD(0x0c8d),
+	WORD(0x2a90), WORD(0x12ed), WORD(0x6426), WORD(0x47a1), WORD(0xeb6d), WORD(0x0325),
+	WORD(0x953f), WORD(0x3b59), WORD(0x8cb1), WORD(0x5a77), WORD(0xc403), WORD(0x53ad),
+	WORD(0x37eb), WORD(0x616f), WORD(0x7830), WORD(0xdb0c), WORD(0xd5a7), WORD(0xdd36),
+	WORD(0x2102), WORD(0x40ec), WORD(0x7077), WORD(0xf0a4), WORD(0x2a95), WORD(0xa16f),
+	WORD(0xbadd), WORD(0xee4c), WORD(0x83ff), WORD(0x933f), WORD(0x0a67), WORD(0x0dac),
+	WORD(0x2139), WORD(0x7062), WORD(0x2fba), WORD(0xa4f3),
+	/* 23G */
+	WORD(0xc5da), WORD(0x9be0), WORD(0xbf18), WORD(0x3142), WORD(0xf19f), WORD(0xee0e),
+	WORD(0x910b), WORD(0x47ad), WORD(0x00d1), WORD(0xcf1c), WORD(0xf9c1), WORD(0x8961),
+	WORD(0xc1d4), WORD(0x66ff), WORD(0xe3db), WORD(0x1e2b), WORD(0x70fe), WORD(0xb30c),
+	WORD(0xa219), WORD(0x9899), WORD(0xba9c), WORD(0x53cd), WORD(0x9c45), WORD(0x5be3),
+	WORD(0x75e0), WORD(0x6a6b), WORD(0x092a), WORD(0x8899), WORD(0xb518), WORD(0x9e09),
+	WORD(0x55b9), WORD(0x5103), WORD(0xcd62), WORD(0x1344), WORD(0x0ea8), WORD(0x0a7c),
+	WORD(0x53e4), WORD(0x4424), WORD(0xdf0b), WORD(0xd812), WORD(0xb5e0), WORD(0xeb96),
+	WORD(0xf0ec), WORD(0xbdb9), WORD(0x6439), WORD(0x301f), WORD(0xc3b6), WORD(0x6251),
+	WORD(0x36dd), WORD(0xbca3), WORD(0xfe72), WORD(0x44e4), WORD(0x1af2), WORD(0x6b40),
+	WORD(0xcb34), WORD(0x3927), WORD(0x1abd), WORD(0xbc90), WORD(0x63ec), WORD(0xe6b0),
+	WORD(0xc84b), WORD(0xd03d), WORD(0x8de1), WORD(0x78ec),
+	/* 25G */
+	WORD(0x403c), WORD(0xabb1), WORD(0xeb34), WORD(0x451d), WORD(0xeee8), WORD(0xce57),
+	WORD(0x31ac), WORD(0xec20), WORD(0xe990), WORD(0x1bf7), WORD(0x3a7d), WORD(0x4cbe),
+	WORD(0xa7f2), WORD(0x6cac), WORD(0x623c), WORD(0x4c4c), WORD(0xc886), WORD(0x34fd),
+	WORD(0x877f), WORD(0x9bde), WORD(0xd37f), WORD(0x5954), WORD(0x903f), WORD(0x3931),
+	WORD(0xdc52), WORD(0xa23e), WORD(0x6b54), WORD(0xdd50), WORD(0xb83c), WORD(0x5db5),
+	WORD(0x091b), WORD(0x0caf), WORD(0xcf66), WORD(0x97b8), WORD(0x2481), WORD(0x34d5),
+	WORD(0x070b), WORD(0xbc80), WORD(0x031c), WORD(0x73ea), WORD(0x4843), WORD(0xead0),
+	WORD(0x8c5d), WORD(0x5762), WORD(0x727a), WORD(0xca9f), WORD(0xb9c0), WORD(0x7ca1),
+	WORD(0x3065), WORD(0xa1dd), WORD(0xc84c), WORD(0x60a4), WORD(0xc73f), WORD(0xca19),
+	WORD(0x81f7), WORD(0xd736), WORD(0x4b73), WORD(0x4863), WORD(0x53a1), WORD(0x9d3b),
+	WORD(0x13ba), WORD(0x674e), WORD(0xdd66), WORD(0x107e),
+	/* 27G */
+	WORD(0x81a1), WORD(0xe1de), WORD(0x2823), WORD(0xa1d6), WORD(0xab0d), WORD(0x8eb3),
+	WORD(0xbcf6), WORD(0x1844), WORD(0x753d), WORD(0x6b98), WORD(0x09cd), WORD(0xefd2),
+	WORD(0x2672), WORD(0xb127), WORD(0x6729), WORD(0x5ca5), WORD(0x9207), WORD(0x0e6c),
+	WORD(0x1600), WORD(0xaeae), WORD(0x5eba), WORD(0x41df), WORD(0xb5cb), WORD(0x8ce0),
+	WORD(0x3698), WORD(0x7ae9), WORD(0xc2bd), WORD(0x2d3d), WORD(0x647b), WORD(0x5300),
+	WORD(0x406e), WORD(0x18f9), WORD(0xfece), WORD(0xc65e), WORD(0x8bca), WORD(0xbb92),
+	WORD(0x1439), WORD(0x1843), WORD(0xe4f8), WORD(0xc963), WORD(0xaa12), WORD(0x6214),
+	WORD(0x9b4e), WORD(0x43cb), WORD(0x6e7c), WORD(0x9302), WORD(0x6513), WORD(0x0298),
+	WORD(0x5e54), WORD(0xe963), WORD(0x14d3), WORD(0x2acc), WORD(0x7ec1), WORD(0x7308),
+	WORD(0x1655), WORD(0x33db), WORD(0xf550), WORD(0x95de), WORD(0x314a), WORD(0x1ed8),
+	WORD(0x55cb), WORD(0xa874), WORD(0x35c8), WORD(0x21c7),
+	/* 29G */
+	WORD(0x8c20), WORD(0xe7af), WORD(0x4836), WORD(0xe555), WORD(0xe14b), WORD(0xacc5),
+	WORD(0xd40c), WORD(0x0799), WORD(0xb21a), WORD(0xb163), WORD(0x15de), WORD(0x0c53),
+	WORD(0x8ca2), WORD(0x5bd5), WORD(0xdbd4), WORD(0x67d8), WORD(0xa3fe), WORD(0xc419),
+	WORD(0xa1fa), WORD(0xb6ae), WORD(0xcacb), WORD(0x06e5), WORD(0x18cd), WORD(0xb8c7),
+	WORD(0x30d6), WORD(0x406b), WORD(0x1ef6), WORD(0x4906), WORD(0x98fa), WORD(0x26be),
+	WORD(0xa1e5), WORD(0x3d60), WORD(0x5771), WORD(0x8bd2), WORD(0x648e), WORD(0x2e58),
+	WORD(0xec21), WORD(0xef79), WORD(0x7af1), WORD(0x8ee1), WORD(0xd087), WORD(0x8f86),
+	WORD(0x3a45), WORD(0xb054), WORD(0xf4fb), WORD(0x2e0b), WORD(0xd660), WORD(0x9935),
+	WORD(0x7216), WORD(0xb533), WORD(0x93f0), WORD(0x0180), WORD(0x59f9), WORD(0x74dc),
+	WORD(0x3052), WORD(0xe879), WORD(0x9e98), WORD(0x3eba), WORD(0x19df), WORD(0xc59d),
+	WORD(0xc660), WORD(0xfb34), WORD(0x582d), WORD(0x4c8d),
+	/* 31G */
+	WORD(0x842b), WORD(0x1985), WORD(0xd253), WORD(0xe6af), WORD(0x4805), WORD(0x9f4b),
+	WORD(0xca53), WORD(0x72aa), WORD(0xaf11), WORD(0xbbc0), WORD(0xabbc), WORD(0xd994),
+	WORD(0x9911), WORD(0xc23a), WORD(0x784b), WORD(0xdef6), WORD(0x5f43), WORD(0x0cc7),
+	WORD(0xe4e0), WORD(0x37ab), WORD(0xaf35), WORD(0xd570), WORD(0x8a3b), WORD(0x948b),
+	WORD(0x7c4c), WORD(0x69da), WORD(0x74c9), WORD(0x28ba), WORD(0x5010), WORD(0xfd8d),
+	WORD(0xb2fb), WORD(0x0f91), WORD(0xeea0), WORD(0xce66), WORD(0x9960), WORD(0x0696),
+	WORD(0x515b), WORD(0xe99c), WORD(0x6ac6), WORD(0x6c2f), WORD(0x1fef), WORD(0xf312),
+	WORD(0x083d), WORD(0x8175), WORD(0x95c3), WORD(0x1805), WORD(0x40ca), WORD(0x4c65),
+	WORD(0x4f48), WORD(0x544c), WORD(0x4fe6), WORD(0xce1b), WORD(0x283f), WORD(0x79aa),
+	WORD(0x7d95), WORD(0xcdf3), WORD(0x96b9), WORD(0x77f5), WORD(0x9395), WORD(0x74d1),
+	WORD(0x34e6), WORD(0x4052), WORD(0xb47b), WORD(0x95d4),
+	/* 33G */
+	WORD(0x43e2), WORD(0xd646), WORD(0x2c66), WORD(0x056b), WORD(0x507e), WORD(0x6f35),
+	WORD(0x51f1), WORD(0x5c4a), WORD(0x1929), WORD(0xb18f), WORD(0x8126), WORD(0x9e84),
+	WORD(0x2280), WORD(0x00f6), WORD(0x0f92), WORD(0x5dbb), WORD(0x5da7), WORD(0xd7eb),
+	WORD(0xe66b), WORD(0xb3a4), WORD(0x382b), WORD(0x8529), WORD(0xa755), WORD(0x1394),
+	WORD(0x1a38), WORD(0xe1b6), WORD(0xea1f), WORD(0xe64f), WORD(0x3ae2), WORD(0xf0c0),
+	WORD(0xdd47), WORD(0x5dac), WORD(0xc5a8), WORD(0xd272), WORD(0xcc62), WORD(0x62c9),
+	WORD(0xd261), WORD(0xd713), WORD(0xbba0), WORD(0x93db), WORD(0xff08), WORD(0x4eca),
+	WORD(0x8438), WORD(0x5370), WORD(0xcb2e), WORD(0x286c), WORD(0x7206), WORD(0x1e96),
+	WORD(0xfcde), WORD(0xc082), WORD(0xcdce), WORD(0x3dfc), WORD(0x5cb3), WORD(0x0ee5),
+	WORD(0x09fb), WORD(0x6ba1), WORD(0x03b4), WORD(0xc2e9), WORD(0xdfe1), WORD(0xaf98),
+	WORD(0xa0b6), WORD(0xb0d0), WORD(0x6703), WORD(0x27aa),
+	/* 35G */
+	WORD(0x082a), WORD(0x7c96), WORD(0xefab), WORD(0xd5a6), WORD(0x76e5), WORD(0x44c6),
+	WORD(0xeeed), WORD(0x876c), WORD(0xffd1), WORD(0x701e), WORD(0xe081), WORD(0x1e57),
+	WORD(0x6efc), WORD(0xff2f), WORD(0x9ae5), WORD(0x161a), WORD(0x828a), WORD(0x49ed),
+	WORD(0xac12), WORD(0x5352), WORD(0xf5a5), WORD(0x2429), WORD(0x4846), WORD(0x0d22),
+	WORD(0x4312), WORD(0xd590), WORD(0x16e5), WORD(0xedb2), WORD(0x52fd), WORD(0x1a7d),
+	WORD(0x36b7), WORD(0x66de), WORD(0xd858), WORD(0x7b7e), WORD(0x479b), WORD(0xadff),
+	WORD(0x55eb), WORD(0xc87e), WORD(0x3b1d), WORD(0x9f88), WORD(0x4a47), WORD(0x090c),
+	WORD(0xfed9), WORD(0x2631), WORD(0x772e), WORD(0x9bdb), WORD(0x9025), WORD(0x4c11),
+	WORD(0x0e71), WORD(0x7ea8), WORD(0x5c72), WORD(0x2e2d), WORD(0x6fd9), WORD(0xbee5),
+	WORD(0x6a6c), WORD(0x20c1), WORD(0x986e), WORD(0xf956), WORD(0x0ea5), WORD(0x08e2),
+	WORD(0x2576), WORD(0x773a), WORD(0x23e0), WORD(0x71da),
+	/* 37G */
+	WORD(0xc4eb), WORD(0x7fd4), WORD(0x3ede), WORD(0x8d5e), WORD(0x99d2), WORD(0xcd52),
+	WORD(0xb145), WORD(0x99e2), WORD(0xd692), WORD(0xd315), WORD(0x596b), WORD(0x920a),
+	WORD(0x3d29), WORD(0x0515), WORD(0x1106), WORD(0xce3b), WORD(0x1a96), WORD(0x0169),
+	WORD(0xb6e0), WORD(0x8903), WORD(0x302c), WORD(0xe764), WORD(0x2318), WORD(0xc927),
+	WORD(0x1d0a), WORD(0xaa25), WORD(0xf59f), WORD(0xf302), WORD(0x3d6b), WORD(0x84d6),
+	WORD(0x39db), WORD(0x01dd), WORD(0xfd04), WORD(0x7e21), WORD(0x88c8), WORD(0xf8e6),
+	WORD(0xaf48), WORD(0xdfe4), WORD(0x248b), WORD(0x6d02), WORD(0x3131), WORD(0x220e),
+	WORD(0x9849), WORD(0x4019), WORD(0xf17f), WORD(0x9093), WORD(0x2412), WORD(0x22b0),
+	WORD(0x885b), WORD(0x5208), WORD(0x2a3b), WORD(0x24a4), WORD(0x46d8), WORD(0x003b),
+	WORD(0x3bc2), WORD(0x0371), WORD(0xa7ae), WORD(0xc1d1), WORD(0x8d15), WORD(0x90bf),
+	WORD(0xde30), WORD(0x24a1), WORD(0x3902), WORD(0x0bc5),
+	/* 39G */
+	WORD(0x3bf0), WORD(0x97bd), WORD(0xe4b9), WORD(0x1bf9), WORD(0x522f), WORD(0x4ca5),
+	WORD(0x379d), WORD(0xa938), WORD(0xb1dd), WORD(0x42b7), WORD(0x7a35), WORD(0x8141),
+	WORD(0xcf46), WORD(0x6f75), WORD(0x0ebd), WORD(0x0d52), WORD(0x9dd8), WORD(0x93d3),
+	WORD(0x85e4), WORD(0xd405), WORD(0x5a3c), WORD(0xcd38), WORD(0x064f), WORD(0x6f31),
+	WORD(0xad4d), WORD(0x3e2f), WORD(0x64d0), WORD(0x18f9), WORD(0xe602), WORD(0xbf48),
+	WORD(0xdd3e), WORD(0x951a), WORD(0x7570), WORD(0x1443), WORD(0x7a3f), WORD(0x601c),
+	WORD(0xd500), WORD(0x50ca), WORD(0x0556), WORD(0x7fd8), WORD(0xc44e), WORD(0xed09),
+	WORD(0x8d80), WORD(0xe4b2), WORD(0x21d6), WORD(0x1c79), WORD(0x3e2c), WORD(0x134e),
+	WORD(0xd1dc), WORD(0xc0d7), WORD(0xb095), WORD(0x38d6), WORD(0xba56), WORD(0x90e9),
+	WORD(0x14fc), WORD(0x9328), WORD(0x802c), WORD(0x4b39), WORD(0x996f), WORD(0x609f),
+	WORD(0xda30), WORD(0x88f8), WORD(0xaff5), WORD(0x9223),
+	/* 41G */
+	WORD(0x2f9a), WORD(0x9bfb), WORD(0xcd3e), WORD(0x6ca1), WORD(0xc60d), WORD(0xceb5),
+	WORD(0x2217), WORD(0xce12), WORD(0x2223), WORD(0x7152), WORD(0xa10b), WORD(0x8f6d),
+	WORD(0x7ede), WORD(0x5aad), WORD(0x8bca), WORD(0x07c8), WORD(0xdccf), WORD(0x4e79),
+	WORD(0xa777), WORD(0x7f76), WORD(0x2223), WORD(0x4ca5), WORD(0x40fb), WORD(0xe3b7),
+	WORD(0x6063), WORD(0x8e65), WORD(0xdb2b), WORD(0x7e07), WORD(0x5575), WORD(0xf862),
+	WORD(0x7a1e), WORD(0x5427), WORD(0xf3f4), WORD(0xecbc), WORD(0x6c58), WORD(0x1ceb),
+	WORD(0xf818), WORD(0xfd53), WORD(0x04e2), WORD(0xe71b), WORD(0xe95c), WORD(0x12b0),
+	WORD(0x5531), WORD(0x53b1), WORD(0xc645), WORD(0x3938), WORD(0xefa2), WORD(0x8354),
+	WORD(0xb527), WORD(0x65e7), WORD(0xd783), WORD(0x95dd), WORD(0x032e), WORD(0x3291),
+	WORD(0x08cd), WORD(0xc124), WORD(0xedb9), WORD(0xe37b), WORD(0xac38), WORD(0x0b45),
+	WORD(0x290e), WORD(0x1d51), WORD(0xd62b), WORD(0x005a),
+	/* 43G */
+	WORD(0xfea1), WORD(0xa4d4), WORD(0xb600), WORD(0xd909), WORD(0x282d), WORD(0x9024),
+	WORD(0xdb4e), WORD(0x4d1e), WORD(0x4a60), WORD(0xc324), WORD(0x66a4), WORD(0x552e),
+	WORD(0xb45b), WORD(0x9ee9), WORD(0x50ee), WORD(0xd16f), WORD(0xed5e), WORD(0x8f16),
+	WORD(0x2d82), WORD(0xa540), WORD(0x79b9), WORD(0x4a50), WORD(0x8267), WORD(0xa4bb),
+	WORD(0xe752), WORD(0x291b), WORD(0x33b0), WORD(0x1d61), WORD(0x93b2), WORD(0x94e6),
+	WORD(0x448c), WORD(0x2943), WORD(0xae45), WORD(0x5bb3), WORD(0xbc52), WORD(0xc407),
+	WORD(0x935d), WORD(0x38b5), WORD(0xa445), WORD(0xaf63), WORD(0xf811), WORD(0x949f),
+	WORD(0xa1ea), WORD(0x1f27), WORD(0x9b0a), WORD(0x64b9), WORD(0x0c6f), WORD(0xe5c1),
+	WORD(0xb21f), WORD(0xacaa), WORD(0xd0a6), WORD(0x14fa), WORD(0x8eac), WORD(0xaa08),
+	WORD(0xa4ae), WORD(0xba02), WORD(0xd5cc), WORD(0x8b06), WORD(0xbb67), WORD(0xd045),
+	WORD(0x9616), WORD(0xba58), WORD(0xb5bd), WORD(0x6c6f),
+	/* 45G */
+	WORD(0xedb9), WORD(0x833a), WORD(0x6a5a), WORD(0xb22d), WORD(0x7c1b), WORD(0x534f),
+	WORD(0xe155), WORD(0x38d6), WORD(0x4cce), WORD(0x616a), WORD(0x7cbc), WORD(0x5208),
+	WORD(0x029d), WORD(0xaec5), WORD(0x9585), WORD(0x18a8), WORD(0x5ace), WORD(0x0c60),
+	WORD(0xf51d), WORD(0x68a0), WORD(0x8ec3), WORD(0xd303), WORD(0x4ae3), WORD(0x5c80),
+	WORD(0xbdcb), WORD(0x26ac), WORD(0x6d89), WORD(0xa77c), WORD(0xefad), WORD(0x03a8),
+	WORD(0x5a98), WORD(0x9ceb), WORD(0x1a7a), WORD(0xc229), WORD(0xb8ae), WORD(0x44a5),
+	WORD(0xd5b6), WORD(0x2359), WORD(0x44b0), WORD(0x920f), WORD(0x9b7b), WORD(0xf44a),
+	WORD(0x9d21), WORD(0x5a76), WORD(0x37c6), WORD(0x6f11), WORD(0x531d), WORD(0x5bad),
+	WORD(0x367e), WORD(0x9667), WORD(0xc71a), WORD(0x6833), WORD(0xb53e), WORD(0x2479),
+	WORD(0xf35d), WORD(0x8c4f), WORD(0x3f9a), WORD(0x31cf), WORD(0x45b4), WORD(0x5deb),
+	WORD(0x7b23), WORD(0x89e3), WORD(0x7dac), WORD(0x5eff),
+	/* 47G */
+	WORD(0x4752), WORD(0xfdcf), WORD(0x54e7), WORD(0x0f16), WORD(0x0072), WORD(0x84c4),
+	WORD(0x09be), WORD(0x0328), WORD(0xefdb), WORD(0x9697), WORD(0x37ab), WORD(0x4523),
+	WORD(0x8f16), WORD(0x9b58), WORD(0xa47a), WORD(0xe788), WORD(0x6532), WORD(0xc5bd),
+	WORD(0x972c), WORD(0x02e8), WORD(0xa672), WORD(0xb1b9), WORD(0x6ccf), WORD(0xcc25),
+	WORD(0xe4fb), WORD(0xd1c9), WORD(0xb0cd), WORD(0x328e), WORD(0xf716), WORD(0x5322),
+	WORD(0x5a26), WORD(0x1f48), WORD(0x536e), WORD(0x9f15), WORD(0xbdb2), WORD(0x8493),
+	WORD(0x0298), WORD(0x0d9d), WORD(0x1854), WORD(0x2aee), WORD(0xa2fd), WORD(0x3ebc),
+	WORD(0x01c9), WORD(0x3e30), WORD(0x76c3), WORD(0x3e53), WORD(0x407e), WORD(0xe16c),
+	WORD(0xbb4d), WORD(0xf072), WORD(0xb781), WORD(0xb67b), WORD(0x439f), WORD(0xee81),
+	WORD(0xa38a), WORD(0x09ef), WORD(0xec91), WORD(0x968b), WORD(0x4dcf), WORD(0x45d7),
+	WORD(0x550d), WORD(0x0984), WORD(0x54f9), WORD(0x1891),
+	/* 49G */
+	WORD(0x19c8), WORD(0xcaa9), WORD(0xc11c), WORD(0x2ac8), WORD(0xf754), WORD(0x3a74),
+	WORD(0x602d), WORD(0x6b65), WORD(0x85f8), WORD(0x0966), WORD(0xd872), WORD(0xee56),
+	WORD(0x255c), WORD(0xb06e), WORD(0x2a8e), WORD(0x0788), WORD(0x0de2), WORD(0x1287),
+	WORD(0x939e), WORD(0x2ff5), WORD(0xeef9), WORD(0x1621), WORD(0x5c13), WORD(0x2fc2),
+	WORD(0x7a79), WORD(0x2690), WORD(0xe825), WORD(0xebae), WORD(0xeec6), WORD(0xfa6d),
+	WORD(0xfa3f), WORD(0x417a), WORD(0x6303), WORD(0xd911), WORD(0x4384), WORD(0x5ad5),
+	WORD(0xf599), WORD(0xfb01), WORD(0xdc56), WORD(0x8dda), WORD(0x68d1), WORD(0x87b2),
+	WORD(0x0a24), WORD(0xe760), WORD(0xb00f), WORD(0x386d), WORD(0x9708), WORD(0xc7c2),
+	WORD(0x1e9f), WORD(0x6d5e), WORD(0x1c03), WORD(0xe98a), WORD(0x0234), WORD(0x28bb),
+	WORD(0x9a58), WORD(0xd363), WORD(0x0d3d), WORD(0xe5c1), WORD(0x9bbb), WORD(0x6b6f),
+	WORD(0x87ca), WORD(0x3c6e), WORD(0x92e0), WORD(0xa342),
+	/* 51G */
+	WORD(0x2893), WORD(0x54a5), WORD(0x36d7), WORD(0xf617), WORD(0x4daa), WORD(0x612d),
+	WORD(0x94a1), WORD(0x247c), WORD(0x0f7d), WORD(0x0e29), WORD(0x50d6), WORD(0x64f3),
+	WORD(0xf177), WORD(0xc3a6), WORD(0xb8a5), WORD(0x88e6), WORD(0x5ee3), WORD(0x8f46),
+	WORD(0x2591), WORD(0x62ef), WORD(0x53fa), WORD(0xb643), WORD(0xeb60), WORD(0xadea),
+	WORD(0x01b7), WORD(0xb1f2), WORD(0x538b), WORD(0xcb40), WORD(0xec45), WORD(0x6879),
+	WORD(0xd899), WORD(0x291b), WORD(0x5601), WORD(0x0a44), WORD(0xd1b1), WORD(0x7ee1),
+	WORD(0x2835), WORD(0x050c), WORD(0x62fa), WORD(0x164f), WORD(0xa6e8), WORD(0x2435),
+	WORD(0x1fd7), WORD(0x7774), WORD(0xc452), WORD(0xb58b), WORD(0x7c6c), WORD(0x9fa2),
+	WORD(0x5df2), WORD(0x0a44), WORD(0xb3d3), WORD(0xbc6c), WORD(0xb555), WORD(0x869f),
+	WORD(0x5021), WORD(0x211e), WORD(0x2976), WORD(0x5ede), WORD(0xd932), WORD(0xaf31),
+	WORD(0xa857), WORD(0xce91), WORD(0x41df), WORD(0x97c6),
+	/* 53G */
+	WORD(0xc157), WORD(0x23d2), WORD(0x8f01), WORD(0x9151), WORD(0x44ef), WORD(0xf534),
+	WORD(0x4815), WORD(0xf2cc), WORD(0x535a), WORD(0xb922), WORD(0xe3a9), WORD(0x0038),
+	WORD(0x8e4f), WORD(0x9f9f), WORD(0x120c), WORD(0xfb6b), WORD(0xd817), WORD(0x0342),
+	WORD(0x790b), WORD(0x1cfa), WORD(0x2cef), WORD(0x1ab2), WORD(0x268d), WORD(0x3ea3),
+	WORD(0x0f67), WORD(0x1b49), WORD(0xae58), WORD(0x9c04), WORD(0x5da1), WORD(0x83dc),
+	WORD(0x206e), WORD(0x03f5), WORD(0x2192), WORD(0xbc9a), WORD(0x324a), WORD(0x14eb),
+	WORD(0xae62), WORD(0x4548), WORD(0x737e), WORD(0x344d), WORD(0x6eff), WORD(0xb5fc),
+	WORD(0xb92e), WORD(0x739d), WORD(0x69db), WORD(0x873b), WORD(0xe990), WORD(0x46c3),
+	WORD(0xc805), WORD(0x8930), WORD(0x33c7), WORD(0x89a7), WORD(0x850a), WORD(0xeff7),
+	WORD(0x7419), WORD(0x5a3d), WORD(0xa2a2), WORD(0xa7f5), WORD(0x8621), WORD(0x8a84),
+	WORD(0xb8d1), WORD(0xda6e), WORD(0xfb70), WORD(0x4cef),
+	/* 55G */
+	WORD(0x39f1), WORD(0x7d02), WORD(0x5d28), WORD(0x3055), WORD(0xe989), WORD(0x0039),
+	WORD(0xc6c6), WORD(0x9a7b), WORD(0x95b1), WORD(0xe917), WORD(0x5928), WORD(0x70bf),
+	WORD(0xefe6), WORD(0x797e), WORD(0x7abd), WORD(0x6c58), WORD(0x96e6), WORD(0x8587),
+	WORD(0x95d0), WORD(0xc52c), WORD(0x6552), WORD(0xbfaa), WORD(0xc090), WORD(0x7ecd),
+	WORD(0x2042), WORD(0x169c), WORD(0x1f73), WORD(0xdb12), WORD(0x2a97), WORD(0xddf2),
+	WORD(0xa8cf), WORD(0x4b13), WORD(0x508d), WORD(0x6f13), WORD(0x7a2d), WORD(0x3eb2),
+	WORD(0x8157), WORD(0xd520), WORD(0x060b), WORD(0xebcd), WORD(0x7c1e), WORD(0x875b),
+	WORD(0x772d), WORD(0x1e96), WORD(0x5d81), WORD(0xee82), WORD(0xf5a7), WORD(0x6f35),
+	WORD(0xb86f), WORD(0x64ca), WORD(0xe092), WORD(0xe0aa), WORD(0x8167), WORD(0x5b9b),
+	WORD(0x087c), WORD(0x52e3), WORD(0x0644), WORD(0xa5df), WORD(0x3796), WORD(0x96e0),
+	WORD(0x9eba), WORD(0x1712), WORD(0x84be), WORD(0x13de),
+	/* 57G */
+	WORD(0x0406), WORD(0xdb44), WORD(0xc960), WORD(0x6f71), WORD(0xf029), WORD(0x6a9d),
+	WORD(0x8d05), WORD(0xed88), WORD(0x605d), WORD(0x8978), WORD(0x74ae), WORD(0x21ec),
+	WORD(0xf1b9), WORD(0x4487), WORD(0xc849), WORD(0x13a8), WORD(0xebe7), WORD(0x6947),
+	WORD(0x3ad9), WORD(0xd145), WORD(0x9c5a), WORD(0x0c7f), WORD(0x9cc3), WORD(0xd6d1),
+	WORD(0x3473), WORD(0xf100), WORD(0x6d95), WORD(0xdca3), WORD(0x4cbe), WORD(0xde19),
+	WORD(0x84f2), WORD(0x4a91), WORD(0x9cb6), WORD(0x1e83), WORD(0x737b), WORD(0xbf81),
+	WORD(0x644e), WORD(0xd18f), WORD(0xa59d), WORD(0x0ac9), WORD(0x606c), WORD(0xaa2f),
+	WORD(0x3d84), WORD(0x4be6), WORD(0x318c), WORD(0xaf23), WORD(0x5439), WORD(0xa09e),
+	WORD(0xcaa9), WORD(0x48d1), WORD(0xa71c), WORD(0xa4c2), WORD(0x753e), WORD(0x2f2c),
+	WORD(0x886f), WORD(0xa7d3), WORD(0xdc41), WORD(0xc35e), WORD(0x10d2), WORD(0xe614),
+	WORD(0xce16), WORD(0x5ffd), WORD(0x3b08), WORD(0x9b43),
+	/* 59G */
+	WORD(0xe8a4), WORD(0x56c9), WORD(0xd2ea), WORD(0xe553), WORD(0xea2c), WORD(0x4ace),
+	WORD(0xf3b4), WORD(0x9073), WORD(0xed7b), WORD(0x81d8), WORD(0xa142), WORD(0xccb5),
+	WORD(0x8956), WORD(0x0d02), WORD(0x2c7d), WORD(0x25bc), WORD(0x7c03), WORD(0x0689),
+	WORD(0x4939), WORD(0x4af2), WORD(0xd0c2), WORD(0x65d9), WORD(0x5b35), WORD(0x5644),
+	WORD(0xe376), WORD(0x8e04), WORD(0x6338), WORD(0x2659), WORD(0x9606), WORD(0xcff4),
+	WORD(0x002d), WORD(0x9e6e), WORD(0x379c), WORD(0x2498), WORD(0x852d), WORD(0xafed),
+	WORD(0x0982), WORD(0xae73), WORD(0x2eab), WORD(0x5466), WORD(0xebcf), WORD(0xe4e6),
+	WORD(0x0963), WORD(0xce32), WORD(0x8dc3), WORD(0x900d), WORD(0x42bd), WORD(0x6f6a),
+	WORD(0xe235), WORD(0x2c25), WORD(0x2120), WORD(0xc59d), WORD(0xa35e), WORD(0x095c),
+	WORD(0xfcaf), WORD(0x88cb), WORD(0x93bf), WORD(0xc7cd), WORD(0xf231), WORD(0xeb2e),
+	WORD(0x6936), WORD(0x50ff), WORD(0xf881), WORD(0x0877),
+	/* 61G */
+	WORD(0x425f), WORD(0xff0b), WORD(0x9ef6), WORD(0xbddb), WORD(0xc4c2), WORD(0x03b1),
+	WORD(0x4090), WORD(0xec83), WORD(0xa676), WORD(0xede8), WORD(0xcec2), WORD(0xde37),
+	WORD(0xeb0a), WORD(0xdfad), WORD(0x8280), WORD(0xbd78), WORD(0x93a1), WORD(0xc9d4),
+	WORD(0x7d56), WORD(0x0514), WORD(0x907e), WORD(0xcd23), WORD(0xd6da), WORD(0x8181),
+	WORD(0xd237), WORD(0xec9c), WORD(0xfb12), WORD(0xa124), WORD(0xc7b2), WORD(0x4004),
+	WORD(0x3bac), WORD(0x4bd9), WORD(0xd896), WORD(0x0717), WORD(0x42a0), WORD(0x3e67),
+	WORD(0x5ad5), WORD(0xcb67), WORD(0x29c3), WORD(0xe1d7), WORD(0x10a6), WORD(0xf843),
+	WORD(0xb143), WORD(0xa514), WORD(0xb757), WORD(0xfe06), WORD(0x1130), WORD(0x91b2),
+	WORD(0x98a9), WORD(0xe504), WORD(0x0ab1), WORD(0x5554), WORD(0xea23), WORD(0x1997),
+	WORD(0xa1a8), WORD(0xff89), WORD(0x9833), WORD(0xb01e), WORD(0xfc49), WORD(0xdd44),
+	WORD(0xedbb), WORD(0x3917), WORD(0x4b66), WORD(0x701a),
+	/* 63G */
+	WORD(0x7c2f), WORD(0xb666), WORD(0xf35b), WORD(0xc7d6), WORD(0xa69d), WORD(0xa380),
+	WORD(0x7b7f), WORD(0xcb6d), WORD(0xb554), WORD(0x77a3), WORD(0xe8fe), WORD(0x7b53),
+	WORD(0x3e5b), WORD(0x28e2), WORD(0xb465), WORD(0x663d), WORD(0x8560), WORD(0x52e7),
+	WORD(0x07ba), WORD(0x1371), WORD(0xf9f5), WORD(0xc8b6), WORD(0xf8fd), WORD(0x9968),
+	WORD(0x8e48), WORD(0x0df7), WORD(0x42c0), WORD(0x29f0), WORD(0x493f), WORD(0x316f),
+	WORD(0xe10b), WORD(0x8e52), WORD(0x19b1), WORD(0x89cf), WORD(0xb9ea), WORD(0xbdaf),
+	WORD(0x426a), WORD(0x4902), WORD(0x265e), WORD(0xe4d7), WORD(0xde71), WORD(0x907d),
+	WORD(0x2410), WORD(0xd116), WORD(0x0ae5), WORD(0xd476), WORD(0xd83f), WORD(0x15f6),
+	WORD(0x0c5f), WORD(0x0df4), WORD(0x68d0), WORD(0xc335), WORD(0xcb9d), WORD(0xdf8e),
+	WORD(0xfc94), WORD(0x99c4), WORD(0xde15), WORD(0x1400), WORD(0x0131), WORD(0x8422),
+	WORD(0xf14e), WORD(0x419a), WORD(0xbc3c), WORD(0x9a19),
+};
+#else                     /* unknown word size */
+#error "Unsupported word size"
+#endif
+TO_EC_GEN_TABLE_PARAM(brainpoolp512r1_gen_wnaf, 7);
+
+/*
+ * Signed comb of the generator for the fixed base multiplications (6
+ * teeth, spacing 86), affine x and y in Montgomery representation
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+static const word_t brainpoolp512r1_gen_comb[] = {
+	/* T[0] */
+	WORD(0x5c01c684863f6e81), WORD(0xfedc7d06c372b749),
+	WORD(0x5e62d9841e92077b), WORD(0xd846892511ca7906),
+	WORD(0x812283c32c098cc2), WORD(0xbc75d220dbb143fb),
+	WORD(0xd0e88bc54dc3effa), WORD(0x6e2eb1c335ffc3e2),
+	WORD(0x2139a64bea779d68), WORD(0xbba52ea3a36fbd22),
+	WORD(0x71ea0850b032268d), WORD(0xcc86a93544ced60d),
+	WORD(0x025ceb293e639f48), WORD(0x20347f776704ca89),
+	WORD(0x79ed57e969094679), WORD(0x3cf407e99c0987e4),
+	/* T[1] */
+	WORD(0x4ce2349d0052677e), WORD(0x16bc5af36f756318),
+	WORD(0x608ed6859f75842e), WORD(0xa814c4931d657856),
+	WORD(0x7ad3e1e53df58471), WORD(0x4d75ca93b068cb16),
+	WORD(0xa8ff4789c1260c03), WORD(0x76f07fb603689c07),
+	WORD(0xc5f1a55863f1a5fb), WORD(0x0f4032c36a3ce182),
+	WORD(0x46fab9b35e34afca), WORD(0x8a42a7d2a4b82fac),
+	WORD(0xe24197ef42abddfa), WORD(0x81b5d33b72351a55),
+	WORD(0x9a6a96eef3df681f), WORD(0x711514b5e19f92de),
+	/* T[2] */
+	WORD(0xa5ff223ee7000cf0), WORD(0xd960fc54d84b1488),
+	WORD(0xeee93a965e57159c), WORD(0x7451267e11c4b00a),
+	WORD(0x29f687e1d14b72d6), WORD(0x611d8a8c6ee48cb4),
+	WORD(0xc12b87b66d54f4d7), WORD(0x0093c4e56771dc2d),
+	WORD(0x30fb13fcdfb88d04), WORD(0xd16ff138c950bbaf),
+	WORD(0xc81a8ec1f596ef86), WORD(0x992c08d7f680c7d6),
+	WORD(0x0b905e8204358dee), WORD(0xea68281b2e74f00a),
+	WORD(0x506aeb996ce02a70), WORD(0x634419ac7e0eec25),
+	/* T[3] */
+	WORD(0x755e7765e9860a9a), WORD(0x4f012d7cee9a5d4e),
+	WORD(0x3f7553926496b21d), WORD(0x63e5833e98aa9956),
+	WORD(0xe07434e8b81a31de), WORD(0xe2690076dcf69e2e),
+	WORD(0x4613e42f416f25f7), WORD(0x402abfa40a321215),
+	WORD(0x46f81d3ba7c359ad), WORD(0x1b80e03b524dcc32),
+	WORD(0x02161e53e3553e88), WORD(0x19a95413a07f8234),
+	WORD(0x6c03e409f060575a), WORD(0x85151e459bcbb7f0),
+	WORD(0x8fa98a4779f76561), WORD(0x3dddee71543e8ddb),
+	/* T[4] */
+	WORD(0x5db8f57af3e98173), WORD(0x18a26651d91dad3f),
+	WORD(0x316151bc849a1c53), WORD(0x8bdc52f062a73156),
+	WORD(0xffd648ba58c40ea5), WORD(0xd49d6089afff9023),
+	WORD(0x70a23191d2758cf0), WORD(0x2b2c400982596af5),
+	WORD(0x0e7e8af87193f5ee), WORD(0x8c0c7689691f81d4),
+	WORD(0xf291eb303128784e), WORD(0x5df86e47137ae91c),
+	WORD(0xe2e100873e0395df), WORD(0xcc49db18a3fd81f7),
+	WORD(0xfef107ed334dba43), WORD(0x94c4b62afa63b505),
+	/* T[5] */
+	WORD(0x1797f71650d8c640), WORD(0x3680e641ca939046),
+	WORD(0x6ab9043c6415dea2), WORD(0x00e65fc2430cc452),
+	WORD(0xd7ef1e87f8e28a68), WORD(0x78a71bb605640a8b),
+	WORD(0x1606012ecd28feed), WORD(0x31ebe6c3e296c5e7),
+	WORD(0x968d9dbe7d86bc99), WORD(0x63af411546a12ecb),
+	WORD(0xbacae53e9458842d), WORD(0x83c476f512a20737),
+	WORD(0x68ac95a7bda02512), WORD(0xe36214eb4f68fff9),
+	WORD(0xffbb4ec5cb6ff116), WORD(0x33e1ba021d39f1bc),
+	/* T[6] */
+	WORD(0x450e1be2a1806ec0), WORD(0x69226ba3bc27c844),
+	WORD(0xcfb9f51996c96407), WORD(0x3fb0549b9859d556),
+	WORD(0x12d9771e785eea95), WORD(0xf271cb946235f826),
+	WORD(0x2bd71229740ecff4), WORD(0xa8b70ae4f0a59f70),
+	WORD(0xec589dcd79e3f3a1), WORD(0x39941f9cbd8f0044),
+	WORD(0xf64e330c0a45a340), WORD(0x323b66652e5f4ddc),
+	WORD(0x510f08032aff32a2), WORD(0xf7f03cd8c66d170d),
+	WORD(0x1e7d170669153793), WORD(0x555a933052bdf7ab),
+	/* T[7] */
+	WORD(0x3df908f90c58f42c), WORD(0x5425d2538b800911),
+	WORD(0x765790999c4321f6), WORD(0x60864632848d86ab),
+	WORD(0xb272da93be9265fd), WORD(0x3af05d8ac9035c81),
+	WORD(0xbfbac28f990becf2), WORD(0x250e17f9dc8e31fc),
+	WORD(0x6a5fcbcf9e378f55), WORD(0x0b2fb9e6a85e196d),
+	WORD(0xa96646a1db06f6c3), WORD(0x9eedba3629bca478),
+	WORD(0xefbf9bd8dddc721a), WORD(0x8f22f1b7753e3937),
+	WORD(0xbeb3e2e957b214b3), WORD(0x8fda7ed7a515e83f),
+	/* T[8] */
+	WORD(0x74b9323dafe303ac), WORD(0x6f93077661a81181),
+	WORD(0x6db343d2df80f46f), WORD(0xd0e794159b309897),
+	WORD(0xb0c5d5e90dc96ada), WORD(0x28c974c123bb5beb),
+	WORD(0xf51a91cec678e659), WORD(0x59f9668554ac9984),
+	WORD(0xe22d3b0332e97272), WORD(0xd45b1810a8b0d568),
+	WORD(0xec5d8853df282036), WORD(0xf82434980d08aa5e),
+	WORD(0x67c7cb38f015fcf4), WORD(0x053ff50c1e960993),
+	WORD(0x06dd745a4c4edac5), WORD(0x84d63eb945e90d4b),
+	/* T[9] */
+	WORD(0x6232bfe813ae4491), WORD(0x3141c0377f83f6a3),
+	WORD(0xe940ad7221132955), WORD(0xa0ba70451643c1ab),
+	WORD(0x9888da2ab7a2065e), WORD(0xdc6d34ecf4722e33),
+	WORD(0x638568c9a9ffd419), WORD(0xa57ff4c3db3cf0bd),
+	WORD(0xfe272c0616f2a860), WORD(0x377993cd5f2f6cdc),
+	WORD(0xe079322d733b06e9), WORD(0xbf4b7c48458a535e),
+	WORD(0x5b0328f47aba8e4c), WORD(0xb957c5e36d873921),
+	WORD(0x3c5ff201ba4d39ee), WORD(0x65295b132524a53e),
+	/* T[10] */
+	WORD(0x1fc8ecefb112903a), WORD(0x17809e2765351768),
+	WORD(0xdaed7af13354df05), WORD(0x67a640fdd10e8dce),
+	WORD(0xf27e50f03da73760), WORD(0x689dd7a023e8bea0),
+	WORD(0xe47552ec0dc92dc9), WORD(0x10eb21a77761b5fc),
+	WORD(0x0a168e5d0068f897), WORD(0x999c9f2e19a2a70a),
+	WORD(0xa018772208a6f077), WORD(0xb1a2e0134c7ea9ed),
+	WORD(0x6fe2615ab3209dc4), WORD(0xc0520b4240e3bf88),
+	WORD(0xd5307b1565c295d3), WORD(0x10cb900812960bb0),
+	/* T[11] */
+	WORD(0x5dedba553d771c0f), WORD(0xfefdb14ccb1a08ba),
+	WORD(0x4cb8e30ec13ff389), WORD(0xaf6d9a36e9f13ec3),
+	WORD(0x81894ed1225a1b48), WORD(0xbc9186f6d543cd30),
+	WORD(0x862c0791aa454d4e), WORD(0x45a27404f5cba7f4),
+	WORD(0xe88e8b65c92e4bf3), WORD(0xb6dedc444f0fcf8d),
+	WORD(0x3e824ab5a8fccc56), WORD(0x6dbc0f3e41509986),
+	WORD(0xf8ebd4dad6de77b4), WORD(0x49f9d72a0e3d372a),
+	WORD(0x475f4162333fe771), WORD(0x9ea32886359b19aa),
+	/* T[12] */
+	WORD(0x496c3d1b7b7e532d), WORD(0x154542c4c5f33338),
+	WORD(0x2c8c4bda9ef90f9b), WORD(0xea2766d69229f146),
+	WORD(0xdbbb69071e6e2c60), WORD(0xf12512b1631a4f7a),
+	WORD(0x4dc24d2306b348da), WORD(0x31dde1a69377728c),
+	WORD(0x26af213e8c6cee83), WORD(0xd06f24fd6334995d),
+	WORD(0x30665aace3b84066), WORD(0xdba2f0ff6a1f37c7),
+	WORD(0x2c8d8f1536a28a46), WORD(0x41426891e277f805),
+	WORD(0x2e815bbdd8302c24), WORD(0x2806d565c3f462ef),
+	/* T[13] */
+	WORD(0xbbfb106778620930), WORD(0x7a2a8063668c5dca),
+	WORD(0x09069b9d75bfe90e), WORD(0x228aa5a3ab76e6bd),
+	WORD(0x80468181c4694325), WORD(0x99eaa0d6cb963f91),
+	WORD(0x4e88883920caadb2), WORD(0x3156400f9992be87),
+	WORD(0x6f760b06e4e972b3), WORD(0x3e0492aaaa7bc795),
+	WORD(0xe2c4b3c2c0ef7907), WORD(0xe07d052daa92322d),
+	WORD(0x2dc44ab0187eb488), WORD(0x0afb9e4eb6b217fd),
+	WORD(0xc874dbb7b290d9ad), WORD(0x14e9f145a3fe64da),
+	/* T[14] */
+	WORD(0x538ae6585bcb796d), WORD(0x58af445d41b825ce),
+	WORD(0x35c55aeba447fa2e), WORD(0xa34407245604543e),
+	WORD(0x0998c061aba7bb1e), WORD(0x8bc9f0265f672b21),
+	WORD(0xa82727f6cda419fe), WORD(0xa3c6d01eae6d5698),
+	WORD(0x35464aa7e3bd9f24), WORD(0x44948eb768b48442),
+	WORD(0xfe2aa482fed02384), WORD(0xac402992d45b8f5c),
+	WORD(0x620fe689c3dcc365), WORD(0x86f7c802ffea8835),
+	WORD(0xf0a8ac95c42ff1a5), WORD(0x3966e8df530ea535),
+	/* T[15] */
+	WORD(0xb892380199981827), WORD(0xb70c5e2a3bbb3ef1),
+	WORD(0x076e2faf5314977e), WORD(0xe441b97f623cf144),
+	WORD(0xe9d46a93a4b2ba7e), WORD(0x2beecf272e0d4e4d),
+	WORD(0xb1c963ab47fe19a5), WORD(0x1dc8b5822c96bab2),
+	WORD(0x323fec316a424602), WORD(0x26fc8426d8282163),
+	WORD(0x992aa8725e64b6e7), WORD(0x054ba956084c423a),
+	WORD(0x7ab431969b685fcf), WORD(0x3b7233e7837b5780),
+	WORD(0xe6906de5d69f5b13), WORD(0x805d45b9dd2b86b2),
+	/* T[16] */
+	WORD(0x88ba18907de864ff), WORD(0xa2388e50b74b661a),
+	WORD(0xbb8a8d55bce16a1a), WORD(0x0110b19f9671a9cd),
+	WORD(0x7a37ec945d5a624b), WORD(0x7bab7d538a2266cf),
+	WORD(0x416b0f99c8bca098), WORD(0x2daa8923e3324115),
+	WORD(0x11fad39a82e80eb4), WORD(0x944c4dcd1b8c749c),
+	WORD(0x02f2d54669d7a658), WORD(0x058582b27b4b92cc),
+	WORD(0x5ce6f26bd217e8ac), WORD(0x18a925cedbfbb56c),
+	WORD(0xe81c712494a830ad), WORD(0x204989658b623c18),
+	/* T[17] */
+	WORD(0x378e238138585718), WORD(0xadbbb5f1ba2fe0fe),
+	WORD(0x536e1107c5ea09f1), WORD(0xa6fcedaec42824dd),
+	WORD(0xbba30dcd2667ac10), WORD(0xadd90aaae2efa582),
+	WORD(0x934388ffaf38af18), WORD(0x35f3cbceb4cfc28e),
+	WORD(0xc20302f55d0e9b89), WORD(0x62a71ca23652e06e),
+	WORD(0x4e39a31ea9137dcf), WORD(0x94f6ed7ca9aa7e7a),
+	WORD(0xbb39b090434144a6), WORD(0x823b79aacff857ca),
+	WORD(0xbbd630c4a360f9b4), WORD(0x90ff990fbf24f3e1),
+	/* T[18] */
+	WORD(0x6bc82f5c38107758), WORD(0x38f37205f8f70f4f),
+	WORD(0x1dc1e71f53aaee2c), WORD(0x96deba0b3e9a3546),
+	WORD(0x98e415fb13b5082b), WORD(0x58e1f7a5a8859d1d),
+	WORD(0x47ae83aebbd6de67), WORD(0x31e8c759fdf0c50f),
+	WORD(0xbfd25bc182a42fc8), WORD(0xe06c4d4505b520f6),
+	WORD(0xa3cd27eae43dc39e), WORD(0xe9355689347b7fc2),
+	WORD(0xf488e68251ff7163), WORD(0xc47b045ac9123f76),
+	WORD(0xda84deb1af2b4342), WORD(0xa64e9238008da573),
+	/* T[19] */
+	WORD(0xd62cc471646d8555), WORD(0x7f153c839e97f25b),
+	WORD(0x264890f4b75ef1c8), WORD(0x7be5323a790ddc4c),
+	WORD(0x75cc6a7bea3183e9), WORD(0x8f5fd4801b017869),
+	WORD(0x9e0024e372ce4595), WORD(0x2e7c183d7c6ba7ef),
+	WORD(0x3aa3510b57a1fef3), WORD(0xce13d2adabe05268),
+	WORD(0x1b36b45b56ebd732), WORD(0x3bc69294a551919f),
+	WORD(0xe3646c62b1cd16ba), WORD(0xba40e282fa9566c5),
+	WORD(0x4591c592be3d82a2), WORD(0x88e6ffff1fa6be21),
+	/* T[20] */
+	WORD(0x826692d0da2a0243), WORD(0x37dd74125db03199),
+	WORD(0xccbcb434f9b0a251), WORD(0x20487687c9f196e0),
+	WORD(0x7b79ebc119107ab2), WORD(0xd3b189006bdc0448),
+	WORD(0x45d7387345daf577), WORD(0x3c1ef30da09d6875),
+	WORD(0x662e9e94c18b2eab), WORD(0x37428c432fb55823),
+	WORD(0x9d76a6b91c4ca350), WORD(0x21d97980d183f598),
+	WORD(0x9ebfcaa7d0ef0c44), WORD(0x5cf22bd6a2070fa0),
+	WORD(0x861d0f4527516063), WORD(0x44d5f071b55301ab),
+	/* T[21] */
+	WORD(0xb8130ab758947213), WORD(0x886b03903fe96323),
+	WORD(0x703291ff1117dd66), WORD(0x3610e524a83bef5d),
+	WORD(0x40ee560cd4b3abf2), WORD(0x8d492f7eb341dd19),
+	WORD(0x10c690c8b1bf9b5c), WORD(0x2a54e876f740d3b5),
+	WORD(0x5bcd0af576615c20), WORD(0x2e0c0cfb09e2eccf),
+	WORD(0x757c33c9743c1bc9), WORD(0x2719a5764b49e9e5),
+	WORD(0x75cf429f6ba184e0), WORD(0x1840ba42bfda2ba3),
+	WORD(0xebf4d20b5a7e571f), WORD(0x2ca9330c71c0cf6f),
+	/* T[22] */
+	WORD(0xa0307a5f65eee028), WORD(0x8cc2846bf37a5001),
+	WORD(0x758fad5f4f6e32e2), WORD(0xa869400dc5cdcdfc),
+	WORD(0x422958eba8e78430), WORD(0x8f9002997be4ead3),
+	WORD(0x3925ff612c62a129), WORD(0x884e87fdd9d67ad5),
+	WORD(0xe6b52f3f4759c619), WORD(0xfd18ac6e0ebe5aea),
+	WORD(0x5402465e72231771), WORD(0x35b75edb6341f889),
+	WORD(0xd66c7ed9f269c62e), WORD(0x17a44946175438ab),
+	WORD(0xa43f0f7e1322437f), WORD(0xa3300b15404deb18),
+	/* T[23] */
+	WORD(0x48a5e8d0fb2faa2e), WORD(0x37f3f46427fe32d6),
+	WORD(0xb74882e2094c5fa7), WORD(0xe0d837fe4ddec41b),
+	WORD(0x9e556cbf9d3850d5), WORD(0x95cf19ff5272012b),
+	WORD(0x115c4d20ec979058), WORD(0x374f6a883eebc80f),
+	WORD(0x47ed971dbe28bde0), WORD(0x67e48045b3219979),
+	WORD(0xcd133d2d18c051e1), WORD(0x31660cd7690b7ee3),
+	WORD(0xa0e4e6f4f19dabc6), WORD(0x5451765f4bc866ef),
+	WORD(0x48c9c5f4689188fb), WORD(0x24a58618cb2c178e),
+	/* T[24] */
+	WORD(0x4b3a8e42938c99e2), WORD(0x5347c9930c86507f),
+	WORD(0x86a06621bcb30321), WORD(0x7c3b65b315536068),
+	WORD(0x45a74ef615583527), WORD(0x7647da422f398987),
+	WORD(0x0418700136c3088d), WORD(0x5fe7e3dc09fd7cfc),
+	WORD(0x68492dffcf06a869), WORD(0xc701376b60d40fa3),
+	WORD(0x7108519adef47bd2), WORD(0x1737c117f4547db9),
+	WORD(0x45fc412606336f06), WORD(0x16cd3023859fe8d8),
+	WORD(0x7560776622060f63), WORD(0xa9f9252d131aedba),
+	/* T[25] */
+	WORD(0x4a892cbbb180640c), WORD(0x4a62a73a127848ad),
+	WORD(0xcaf8e24c05145204), WORD(0x9aa34cb09d8eabf5),
+	WORD(0x5288feef560819f4), WORD(0xc3b8e0eefa1fa4fa),
+	WORD(0xac8503927a122b5a), WORD(0x09f253eaba2ab0ef),
+	WORD(0x261b58866ccab014), WORD(0x3ef71c79dc10b512),
+	WORD(0xdaec93768a10d055), WORD(0x67285bec4b72be91),
+	WORD(0x4d441a3a33270c6e), WORD(0xe130af7832680595),
+	WORD(0xd8e5c197af1c5c32), WORD(0x69a0d819e6381300),
+	/* T[26] */
+	WORD(0xd2dbad6bd45fa0e6), WORD(0x299581916916d449),
+	WORD(0x378621df39ab596f), WORD(0xa9fb4a74a2373a6e),
+	WORD(0x2fedcfaefc577ded), WORD(0x8fa043416100ca32),
+	WORD(0x5c8aa00eba5050bb), WORD(0x5d1129a0492203cb),
+	WORD(0x218d44cbedfe1e77), WORD(0x3d62da574dc99718),
+	WORD(0xf94b3d5c8ac1b4f2), WORD(0xed94c580421f2ab7),
+	WORD(0x5cf268304bf71012), WORD(0x1c9be4cc1bc3b76f),
+	WORD(0x44d670109094f420), WORD(0x8ac6bd8041696c6c),
+	/* T[27] */
+	WORD(0x025989a42ccc7a31), WORD(0x764e9d2f6e8455ac),
+	WORD(0xf08a2d2c5f416f92), WORD(0x04040b40b2c32411),
+	WORD(0x86314aa0c2013726), WORD(0xcfc592747c5d9d5f),
+	WORD(0x8f2c42c112946e31), WORD(0x64d659f08fe7f668),
+	WORD(0xc5762744dc92b936), WORD(0xf5bc7410f4f378ee),
+	WORD(0x284e3e8b92f99a8d), WORD(0x482c4862462f9f14),
+	WORD(0x2900ed3b2363d85a), WORD(0x9868f084b7e1995f),
+	WORD(0x2325672c77ff2a7d), WORD(0x8a69390ed1ce1127),
+	/* T[28] */
+	WORD(0x7de344f2bd12f451), WORD(0x4ab509031895a859),
+	WORD(0x1f14a2ec8a0fc2d9), WORD(0xeb314706cf3919e1),
+	WORD(0x593cbed793cecb9c), WORD(0x36208f9372283bef),
+	WORD(0x09408e7c9a3458a8), WORD(0x54661f314e8d355b),
+	WORD(0xe34fcb6e512cc2f8), WORD(0xe7a968368adf6783),
+	WORD(0x7ef7d7a79e40d644), WORD(0xe31c97950b8be7d4),
+	WORD(0x2652511f95a0c3c4), WORD(0x1e1b8fb6d61e2c5a),
+	WORD(0x8732ba736e7b08e7), WORD(0x1f8a593a642f9f48),
+	/* T[29] */
+	WORD(0xbc887aed5bdda824), WORD(0x0b74e41c651182ad),
+	WORD(0x50014a70f747e58c), WORD(0xb0022f879d4beb32),
+	WORD(0x4af4e68aca0de1b7), WORD(0xdf1926b4e19b5b36),
+	WORD(0xeb086a02e422f1d8), WORD(0x27f7ec65997a68bc),
+	WORD(0x284e930faaa44775), WORD(0x0686fc26ed6a639c),
+	WORD(0x50a1e31689b8196c), WORD(0xe9e41ac4e3a2a9cb),
+	WORD(0x6db86fa2dd650509), WORD(0x06ff9706ced327db),
+	WORD(0x3148cc4eb405dd40), WORD(0xa09960c5917fff65),
+	/* T[30] */
+	WORD(0x2d9c65fd9c0d64d4), WORD(0x03f68744fbd2eb0e),
+	WORD(0x1181012bb9a3b68e), WORD(0x9489dac9e147debd),
+	WORD(0x842fbf4113cd8d5b), WORD(0x35276505695725fe),
+	WORD(0xade11e1b57a36482), WORD(0x1b4434c3e7ac8826),
+	WORD(0x0f69b0556c947949), WORD(0xa9955f903856c8c5),
+	WORD(0xc936a8a711385ea7), WORD(0x4f4ba82af265a98b),
+	WORD(0xfa9977ae6b17fb1f), WORD(0x407a606a2dca0bb3),
+	WORD(0x55dc56107399ca26), WORD(0x1821ec9092108393),
+	/* T[31] */
+	WORD(0xdb8347bb3888b646), WORD(0x83d8fc362b5dbd27),
+	WORD(0x005d586a05ecac5f), WORD(0xd3d055556a45521a),
+	WORD(0x3b75130a33e28eb6), WORD(0x87d2a306660e1f23),
+	WORD(0xa7cefd79b87851b9), WORD(0x29738861f09f7088),
+	WORD(0x6bce71f5bbe9356b), WORD(0x2e7ac7660f12f8e5),
+	WORD(0xa8ba4ee106daac43), WORD(0x0f477c317e82f26b),
+	WORD(0x9fb298e88ab34a21), WORD(0x6ef33ef84344bcae),
+	WORD(0xb7de22e3058f9d09), WORD(0x184b50f3dc249657),
+};
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+static const word_t brainpoolp512r1_gen_comb[] = {
+	/* T[0] */
+	WORD(0x863f6e81), WORD(0x5c01c684), WORD(0xc372b749), WORD(0xfedc7d06),
+	WORD(0x1e92077b), WORD(0x5e62d984), WORD(0x11ca7906), WORD(0xd8468925),
+	WORD(0x2c098cc2), WORD(0x812283c3), WORD(0xdbb143fb), WORD(0xbc75d220),
+	WORD(0x4dc3effa), WORD(0xd0e88bc5), WORD(0x35ffc3e2), WORD(0x6e2eb1c3),
+	WORD(0xea779d68), WORD(0x2139a64b), WORD(0xa36fbd22), WORD(0xbba52ea3),
+	WORD(0xb032268d), WORD(0x71ea0850), WORD(0x44ced60d), WORD(0xcc86a935),
+	WORD(0x3e639f48), WORD(0x025ceb29), WORD(0x6704ca89), WORD(0x20347f77),
+	WORD(0x69094679), WORD(0x79ed57e9), WORD(0x9c0987e4), WORD(0x3cf407e9),
+	/* T[1] */
+	WORD(0x0052677e), WORD(0x4ce2349d), WORD(0x6f756318), WORD(0x16bc5af3),
+	WORD(0x9f75842e), WORD(0x608ed685), WORD(0x1d657856), WORD(0xa814c493),
+	WORD(0x3df58471), WORD(0x7ad3e1e5), WORD(0xb068cb16), WORD(0x4d75ca93),
+	WORD(0xc1260c03), WORD(0xa8ff4789), WORD(0x03689c07), WORD(0x76f07fb6),
+	WORD(0x63f1a5fb), WORD(0xc5f1a558), WORD(0x6a3ce182), WORD(0x0f4032c3),
+	WORD(0x5e34afca), WORD(0x46fab9b3), WORD(0xa4b82fac), WORD(0x8a42a7d2),
+	WORD(0x42abddfa), WORD(0xe24197ef), WORD(0x72351a55), WORD(0x81b5d33b),
+	WORD(0xf3df681f), WORD(0x9a6a96ee), WORD(0xe19f92de), WORD(0x711514b5),
+	/* T[2] */
+	WORD(0xe7000cf0), WORD(0xa5ff223e), WORD(0xd84b1488), WORD(0xd960fc54),
+	WORD(0x5e57159c), WORD(0xeee93a96), WORD(0x11c4b00a), WORD(0x7451267e),
+	WORD(0xd14b72d6), WORD(0x29f687e1), WORD(0x6ee48cb4), WORD(0x611d8a8c),
+	WORD(0x6d54f4d7), WORD(0xc12b87b6), WORD(0x6771dc2d), WORD(0x0093c4e5),
+	WORD(0xdfb88d04), WORD(0x30fb13fc), WORD(0xc950bbaf), WORD(0xd16ff138),
+	WORD(0xf596ef86), WORD(0xc81a8ec1), WORD(0xf680c7d6), WORD(0x992c08d7),
+	WORD(0x04358dee), WORD(0x0b905e82), WORD(0x2e74f00a), WORD(0xea68281b),
+	WORD(0x6ce02a70), WORD(0x506aeb99), WORD(0x7e0eec25), WORD(0x634419ac),
+	/* T[3] */
+	WORD(0xe9860a9a), WORD(0x755e7765), WORD(0xee9a5d4e), WORD(0x4f012d7c),
+	WORD(0x6496b21d), WORD(0x3f755392), WORD(0x98aa9956), WORD(0x63e5833e),
+	WORD(0xb81a31de), WORD(0xe07434e8), WORD(0xdcf69e2e), WORD(0xe2690076),
+	WORD(0x416f25f7), WORD(0x4613e42f), WORD(0x0a321215), WORD(0x402abfa4),
+	WORD(0xa7c359ad), WORD(0x46f81d3b), WORD(0x524dcc32), WORD(0x1b80e03b),
+	WORD(0xe3553e88), WORD(0x02161e53), WORD(0xa07f8234), WORD(0x19a95413),
+	WORD(0xf060575a), WORD(0x6c03e409), WORD(0x9bcbb7f0), WORD(0x85151e45),
+	WORD(0x79f76561), WORD(0x8fa98a47), WORD(0x543e8ddb), WORD(0x3dddee71),
+	/* T[4] */
+	WORD(0xf3e98173), WORD(0x5db8f57a), WORD(0xd91dad3f), WORD(0x18a26651),
+	WORD(0x849a1c53), WORD(0x316151bc), WORD(0x62a73156), WORD(0x8bdc52f0),
+	WORD(0x58c40ea5), WORD(0xffd648ba), WORD(0xafff9023), WORD(0xd49d6089),
+	WORD(0xd2758cf0), WORD(0x70a23191), WORD(0x82596af5), WORD(0x2b2c4009),
+	WORD(0x7193f5ee), WORD(0x0e7e8af8), WORD(0x691f81d4), WORD(0x8c0c7689),
+	WORD(0x3128784e), WORD(0xf291eb30), WORD(0x137ae91c), WORD(0x5df86e47),
+	WORD(0x3e0395df), WORD(0xe2e10087), WORD(0xa3fd81f7), WORD(0xcc49db18),
+	WORD(0x334dba43), WORD(0xfef107ed), WORD(0xfa63b505), WORD(0x94c4b62a),
+	/* T[5] */
+	WORD(0x50d8c640), WORD(0x1797f716), WORD(0xca939046), WORD(0x3680e641),
+	WORD(0x6415dea2), WORD(0x6ab9043c), WORD(0x430cc452), WORD(0x00e65fc2),
+	WORD(0xf8e28a68), WORD(0xd7ef1e87), WORD(0x05640a8b), WORD(0x78a71bb6),
+	WORD(0xcd28feed), WORD(0x1606012e), WORD(0xe296c5e7), WORD(0x31ebe6c3),
+	WORD(0x7d86bc99), WORD(0x968d9dbe), WORD(0x46a12ecb), WORD(0x63af4115),
+	WORD(0x9458842d), WORD(0xbacae53e), WORD(0x12a20737), WORD(0x83c476f5),
+	WORD(0xbda02512), WORD(0x68ac95a7), WORD(0x4f68fff9), WORD(0xe36214eb),
+	WORD(0xcb6ff116), WORD(0xffbb4ec5), WORD(0x1d39f1bc), WORD(0x33e1ba02),
+	/* T[6] */
+	WORD(0xa1806ec0), WORD(0x450e1be2), WORD(0xbc27c844), WORD(0x69226ba3),
+	WORD(0x96c96407), WORD(0xcfb9f519), WORD(0x9859d556), WORD(0x3fb0549b),
+	WORD(0x785eea95), WORD(0x12d9771e), WORD(0x6235f826), WORD(0xf271cb94),
+	WORD(0x740ecff4), WORD(0x2bd71229), WORD(0xf0a59f70), WORD(0xa8b70ae4),
+	WORD(0x79e3f3a1), WORD(0xec589dcd), WORD(0xbd8f0044), WORD(0x39941f9c),
+	WORD(0x0a45a340), WORD(0xf64e330c), WORD(0x2e5f4ddc), WORD(0x323b6665),
+	WORD(0x2aff32a2), WORD(0x510f0803), WORD(0xc66d170d), WORD(0xf7f03cd8),
+	WORD(0x69153793), WORD(0x1e7d1706), WORD(0x52bdf7ab), WORD(0x555a9330),
+	/* T[7] */
+	WORD(0x0c58f42c), WORD(0x3df908f9), WORD(0x8b800911), WORD(0x5425d253),
+	WORD(0x9c4321f6), WORD(0x76579099), WORD(0x848d86ab), WORD(0x60864632),
+	WORD(0xbe9265fd), WORD(0xb272da93), WORD(0xc9035c81), WORD(0x3af05d8a),
+	WORD(0x990becf2), WORD(0xbfbac28f), WORD(0xdc8e31fc), WORD(0x250e17f9),
+	WORD(0x9e378f55), WORD(0x6a5fcbcf), WORD(0xa85e196d), WORD(0x0b2fb9e6),
+	WORD(0xdb06f6c3), WORD(0xa96646a1), WORD(0x29bca478), WORD(0x9eedba36),
+	WORD(0xdddc721a), WORD(0xefbf9bd8), WORD(0x753e3937), WORD(0x8f22f1b7),
+	WORD(0x57b214b3), WORD(0xbeb3e2e9), WORD(0xa515e83f), WORD(0x8fda7ed7),
+	/* T[8] */
+	WORD(0xafe303ac), WORD(0x74b9323d), WORD(0x61a81181), WORD(0x6f930776),
+	WORD(0xdf80f46f), WORD(0x6db343d2), WORD(0x9b309897), WORD(0xd0e79415),
+	WORD(0x0dc96ada), WORD(0xb0c5d5e9), WORD(0x23bb5beb), WORD(0x28c974c1),
+	WORD(0xc678e659), WORD(0xf51a91ce), WORD(0x54ac9984), WORD(0x59f96685),
+	WORD(0x32e97272), WORD(0xe22d3b03), WORD(0xa8b0d568), WORD(0xd45b1810),
+	WORD(0xdf282036), WORD(0xec5d8853), WORD(0x0d08aa5e), WORD(0xf8243498),
+	WORD(0xf015fcf4), WORD(0x67c7cb38), WORD(0x1e960993), WORD(0x053ff50c),
+	WORD(0x4c4edac5), WORD(0x06dd745a), WORD(0x45e90d4b), WORD(0x84d63eb9),
+	/* T[9] */
+	WORD(0x13ae4491), WORD(0x6232bfe8), WORD(0x7f83f6a3), WORD(0x3141c037),
+	WORD(0x21132955), WORD(0xe940ad72), WORD(0x1643c1ab), WORD(0xa0ba7045),
+	WORD(0xb7a2065e), WORD(0x9888da2a), WORD(0xf4722e33), WORD(0xdc6d34ec),
+	WORD(0xa9ffd419), WORD(0x638568c9), WORD(0xdb3cf0bd), WORD(0xa57ff4c3),
+	WORD(0x16f2a860), WORD(0xfe272c06), WORD(0x5f2f6cdc), WORD(0x377993cd),
+	WORD(0x733b06e9), WORD(0xe079322d), WORD(0x458a535e), WORD(0xbf4b7c48),
+	WORD(0x7aba8e4c), WORD(0x5b0328f4), WORD(0x6d873921), WORD(0xb957c5e3),
+	WORD(0xba4d39ee), WORD(0x3c5ff201), WORD(0x2524a53e), WORD(0x65295b13),
+	/* T[10] */
+	WORD(0xb112903a), WORD(0x1fc8ecef), WORD(0x65351768), WORD(0x17809e27),
+	WORD(0x3354df05), WORD(0xdaed7af1), WORD(0xd10e8dce), WORD(0x67a640fd),
+	WORD(0x3da73760), WORD(0xf27e50f0), WORD(0x23e8bea0), WORD(0x689dd7a0),
+	WORD(0x0dc92dc9), WORD(0xe47552ec), WORD(0x7761b5fc), WORD(0x10eb21a7),
+	WORD(0x0068f897), WORD(0x0a168e5d), WORD(0x19a2a70a), WORD(0x999c9f2e),
+	WORD(0x08a6f077), WORD(0xa0187722), WORD(0x4c7ea9ed), WORD(0xb1a2e013),
+	WORD(0xb3209dc4), WORD(0x6fe2615a), WORD(0x40e3bf88), WORD(0xc0520b42),
+	WORD(0x65c295d3), WORD(0xd5307b15), WORD(0x12960bb0), WORD(0x10cb9008),
+	/* T[11] */
+	WORD(0x3d771c0f), WORD(0x5dedba55), WORD(0xcb1a08ba), WORD(0xfefdb14c),
+	WORD(0xc13ff389), WORD(0x4cb8e30e), WORD(0xe9f13ec3), WORD(0xaf6d9a36),
+	WORD(0x225a1b48), WORD(0x81894ed1), WORD(0xd543cd30), WORD(0xbc9186f6),
+	WORD(0xaa454d4e), WORD(0x862c0791), WORD(0xf5cba7f4), WORD(0x45a27404),
+	WORD(0xc92e4bf3), WORD(0xe88e8b65), WORD(0x4f0fcf8d), WORD(0xb6dedc44),
+	WORD(0xa8fccc56), WORD(0x3e824ab5), WORD(0x41509986), WORD(0x6dbc0f3e),
+	WORD(0xd6de77b4), WORD(0xf8ebd4da), WORD(0x0e3d372a), WORD(0x49f9d72a),
+	WORD(0x333fe771), WORD(0x475f4162), WORD(0x359b19aa), WORD(0x9ea32886),
+	/* T[12] */
+	WORD(0x7b7e532d), WORD(0x496c3d1b), WORD(0xc5f33338), WORD(0x154542c4),
+	WORD(0x9ef90f9b), WORD(0x2c8c4bda), WORD(0x9229f146), WORD(0xea2766d6),
+	WORD(0x1e6e2c60), WORD(0xdbbb6907), WORD(0x631a4f7a), WORD(0xf12512b1),
+	WORD(0x06b348da), WORD(0x4dc24d23), WORD(0x9377728c), WORD(0x31dde1a6),
+	WORD(0x8c6cee83), WORD(0x26af213e), WORD(0x6334995d), WORD(0xd06f24fd),
+	WORD(0xe3b84066), WORD(0x30665aac), WORD(0x6a1f37c7), WORD(0xdba2f0ff),
+	WORD(0x36a28a46), WORD(0x2c8d8f15), WORD(0xe277f805), WORD(0x41426891),
+	WORD(0xd8302c24), WORD(0x2e815bbd), WORD(0xc3f462ef), WORD(0x2806d565),
+	/* T[13] */
+	WORD(0x78620930), WORD(0xbbfb1067), WORD(0x668c5dca), WORD(0x7a2a8063),
+	WORD(0x75bfe90e), WORD(0x09069b9d), WORD(0xab76e6bd), WORD(0x228aa5a3),
+	WORD(0xc4694325), WORD(0x80468181), WORD(0xcb963f91), WORD(0x99eaa0d6),
+	WORD(0x20caadb2), WORD(0x4e888839), WORD(0x9992be87), WORD(0x3156400f),
+	WORD(0xe4e972b3), WORD(0x6f760b06), WORD(0xaa7bc795), WORD(0x3e0492aa),
+	WORD(0xc0ef7907), WORD(0xe2c4b3c2), WORD(0xaa92322d), WORD(0xe07d052d),
+	WORD(0x187eb488), WORD(0x2dc44ab0), WORD(0xb6b217fd), WORD(0x0afb9e4e),
+	WORD(0xb290d9ad), WORD(0xc874dbb7), WORD(0xa3fe64da), WORD(0x14e9f145),
+	/* T[14] */
+	WORD(0x5bcb796d), WORD(0x538ae658), WORD(0x41b825ce), WORD(0x58af445d),
+	WORD(0xa447fa2e), WORD(0x35c55aeb), WORD(0x5604543e), WORD(0xa3440724),
+	WORD(0xaba7bb1e), WORD(0x0998c061), WORD(0x5f672b21), WORD(0x8bc9f026),
+	WORD(0xcda419fe), WORD(0xa82727f6), WORD(0xae6d5698), WORD(0xa3c6d01e),
+	WORD(0xe3bd9f24), WORD(0x35464aa7), WORD(0x68b48442), WORD(0x44948eb7),
+	WORD(0xfed02384), WORD(0xfe2aa482), WORD(0xd45b8f5c), WORD(0xac402992),
+	WORD(0xc3dcc365), WORD(0x620fe689), WORD(0xffea8835), WORD(0x86f7c802),
+	WORD(0xc42ff1a5), WORD(0xf0a8ac95), WORD(0x530ea535), WORD(0x3966e8df),
+	/* T[15] */
+	WORD(0x99981827), WORD(0xb8923801), WORD(0x3bbb3ef1), WORD(0xb70c5e2a),
+	WORD(0x5314977e), WORD(0x076e2faf), WORD(0x623cf144), WORD(0xe441b97f),
+	WORD(0xa4b2ba7e), WORD(0xe9d46a93), WORD(0x2e0d4e4d), WORD(0x2beecf27),
+	WORD(0x47fe19a5), WORD(0xb1c963ab), WORD(0x2c96bab2), WORD(0x1dc8b582),
+	WORD(0x6a424602), WORD(0x323fec31), WORD(0xd8282163), WORD(0x26fc8426),
+	WORD(0x5e64b6e7), WORD(0x992aa872), WORD(0x084c423a), WORD(0x054ba956),
+	WORD(0x9b685fcf), WORD(0x7ab43196), WORD(0x837b5780), WORD(0x3b7233e7),
+	WORD(0xd69f5b13), WORD(0xe6906de5), WORD(0xdd2b86b2), WORD(0x805d45b9),
+	/* T[16] */
+	WORD(0x7de864ff), WORD(0x88ba1890), WORD(0xb74b661a), WORD(0xa2388e50),
+	WORD(0xbce16a1a), WORD(0xbb8a8d55), WORD(0x9671a9cd), WORD(0x0110b19f),
+	WORD(0x5d5a624b), WORD(0x7a37ec94), WORD(0x8a2266cf), WORD(0x7bab7d53),
+	WORD(0xc8bca098), WORD(0x416b0f99), WORD(0xe3324115), WORD(0x2daa8923),
+	WORD(0x82e80eb4), WORD(0x11fad39a), WORD(0x1b8c749c), WORD(0x944c4dcd),
+	WORD(0x69d7a658), WORD(0x02f2d546), WORD(0x7b4b92cc), WORD(0x058582b2),
+	WORD(0xd217e8ac), WORD(0x5ce6f26b), WORD(0xdbfbb56c), WORD(0x18a925ce),
+	WORD(0x94a830ad), WORD(0xe81c7124), WORD(0x8b623c18), WORD(0x20498965),
+	/* T[17] */
+	WORD(0x38585718), WORD(0x378e2381), WORD(0xba2fe0fe), WORD(0xadbbb5f1),
+	WORD(0xc5ea09f1), WORD(0x536e1107), WORD(0xc42824dd), WORD(0xa6fcedae),
+	WORD(0x2667ac10), WORD(0xbba30dcd), WORD(0xe2efa582), WORD(0xadd90aaa),
+	WORD(0xaf38af18), WORD(0x934388ff), WORD(0xb4cfc28e), WORD(0x35f3cbce),
+	WORD(0x5d0e9b89), WORD(0xc20302f5), WORD(0x3652e06e), WORD(0x62a71ca2),
+	WORD(0xa9137dcf), WORD(0x4e39a31e), WORD(0xa9aa7e7a), WORD(0x94f6ed7c),
+	WORD(0x434144a6), WORD(0xbb39b090), WORD(0xcff857ca), WORD(0x823b79aa),
+	WORD(0xa360f9b4), WORD(0xbbd630c4), WORD(0xbf24f3e1), WORD(0x90ff990f),
+	/* T[18] */
+	WORD(0x38107758), WORD(0x6bc82f5c), WORD(0xf8f70f4f), WORD(0x38f37205),
+	WORD(0x53aaee2c), WORD(0x1dc1e71f), WORD(0x3e9a3546), WORD(0x96deba0b),
+	WORD(0x13b5082b), WORD(0x98e415fb), WORD(0xa8859d1d), WORD(0x58e1f7a5),
+	WORD(0xbbd6de67), WORD(0x47ae83ae), WORD(0xfdf0c50f), WORD(0x31e8c759),
+	WORD(0x82a42fc8), WORD(0xbfd25bc1), WORD(0x05b520f6), WORD(0xe06c4d45),
+	WORD(0xe43dc39e), WORD(0xa3cd27ea), WORD(0x347b7fc2), WORD(0xe9355689),
+	WORD(0x51ff7163), WORD(0xf488e682), WORD(0xc9123f76), WORD(0xc47b045a),
+	WORD(0xaf2b4342), WORD(0xda84deb1), WORD(0x008da573), WORD(0xa64e9238),
+	/* T[19] */
+	WORD(0x646d8555), WORD(0xd62cc471), WORD(0x9e97f25b), WORD(0x7f153c83),
+	WORD(0xb75ef1c8), WORD(0x264890f4), WORD(0x790ddc4c), WORD(0x7be5323a),
+	WORD(0xea3183e9), WORD(0x75cc6a7b), WORD(0x1b017869), WORD(0x8f5fd480),
+	WORD(0x72ce4595), WORD(0x9e0024e3), WORD(0x7c6ba7ef), WORD(0x2e7c183d),
+	WORD(0x57a1fef3), WORD(0x3aa3510b), WORD(0xabe05268), WORD(0xce13d2ad),
+	WORD(0x56ebd732), WORD(0x1b36b45b), WORD(0xa551919f), WORD(0x3bc69294),
+	WORD(0xb1cd16ba), WORD(0xe3646c62), WORD(0xfa9566c5), WORD(0xba40e282),
+	WORD(0xbe3d82a2), WORD(0x4591c592), WORD(0x1fa6be21), WORD(0x88e6ffff),
+	/* T[20] */
+	WORD(0xda2a0243), WORD(0x826692d0), WORD(0x5db03199), WORD(0x37dd7412),
+	WORD(0xf9b0a251), WORD(0xccbcb434), WORD(0xc9f196e0), WORD(0x20487687),
+	WORD(0x19107ab2), WORD(0x7b79ebc1), WORD(0x6bdc0448), WORD(0xd3b18900),
+	WORD(0x45daf577), WORD(0x45d73873), WORD(0xa09d6875), WORD(0x3c1ef30d),
+	WORD(0xc18b2eab), WORD(0x662e9e94), WORD(0x2fb55823), WORD(0x37428c43),
+	WORD(0x1c4ca350), WORD(0x9d76a6b9), WORD(0xd183f598), WORD(0x21d97980),
+	WORD(0xd0ef0c44), WORD(0x9ebfcaa7), WORD(0xa2070fa0), WORD(0x5cf22bd6),
+	WORD(0x27516063), WORD(0x861d0f45), WORD(0xb55301ab), WORD(0x44d5f071),
+	/* T[21] */
+	WORD(0x58947213), WORD(0xb8130ab7), WORD(0x3fe96323), WORD(0x886b0390),
+	WORD(0x1117dd66), WORD(0x703291ff), WORD(0xa83bef5d), WORD(0x3610e524),
+	WORD(0xd4b3abf2), WORD(0x40ee560c), WORD(0xb341dd19), WORD(0x8d492f7e),
+	WORD(0xb1bf9b5c), WORD(0x10c690c8), WORD(0xf740d3b5), WORD(0x2a54e876),
+	WORD(0x76615c20), WORD(0x5bcd0af5), WORD(0x09e2eccf), WORD(0x2e0c0cfb),
+	WORD(0x743c1bc9), WORD(0x757c33c9), WORD(0x4b49e9e5), WORD(0x2719a576),
+	WORD(0x6ba184e0), WORD(0x75cf429f), WORD(0xbfda2ba3), WORD(0x1840ba42),
+	WORD(0x5a7e571f), WORD(0xebf4d20b), WORD(0x71c0cf6f), WORD(0x2ca9330c),
+	/* T[22] */
+	WORD(0x65eee028), WORD(0xa0307a5f), WORD(0xf37a5001), WORD(0x8cc2846b),
+	WORD(0x4f6e32e2), WORD(0x758fad5f), WORD(0xc5cdcdfc), WORD(0xa869400d),
+	WORD(0xa8e78430), WORD(0x422958eb), WORD(0x7be4ead3), WORD(0x8f900299),
+	WORD(0x2c62a129), WORD(0x3925ff61), WORD(0xd9d67ad5), WORD(0x884e87fd),
+	WORD(0x4759c619), WORD(0xe6b52f3f), WORD(0x0ebe5aea), WORD(0xfd18ac6e),
+	WORD(0x72231771), WORD(0x5402465e), WORD(0x6341f889), WORD(0x35b75edb),
+	WORD(0xf269c62e), WORD(0xd66c7ed9), WORD(0x175438ab), WORD(0x17a44946),
+	WORD(0x1322437f), WORD(0xa43f0f7e), WORD(0x404deb18), WORD(0xa3300b15),
+	/* T[23] */
+	WORD(0xfb2faa2e), WORD(0x48a5e8d0), WORD(0x27fe32d6), WORD(0x37f3f464),
+	WORD(0x094c5fa7), WORD(0xb74882e2), WORD(0x4ddec41b), WORD(0xe0d837fe),
+	WORD(0x9d3850d5), WORD(0x9e556cbf), WORD(0x5272012b), WORD(0x95cf19ff),
+	WORD(0xec979058), WORD(0x115c4d20), WORD(0x3eebc80f), WORD(0x374f6a88),
+	WORD(0xbe28bde0), WORD(0x47ed971d), WORD(0xb3219979), WORD(0x67e48045),
+	WORD(0x18c051e1), WORD(0xcd133d2d), WORD(0x690b7ee3), WORD(0x31660cd7),
+	WORD(0xf19dabc6), WORD(0xa0e4e6f4), WORD(0x4bc866ef), WORD(0x5451765f),
+	WORD(0x689188fb), WORD(0x48c9c5f4), WORD(0xcb2c178e), WORD(0x24a58618),
+	/* T[24] */
+	WORD(0x938c99e2), WORD(0x4b3a8e42), WORD(0x0c86507f), WORD(0x5347c993),
+	WORD(0xbcb30321), WORD(0x86a06621), WORD(0x15536068), WORD(0x7c3b65b3),
+	WORD(0x15583527), WORD(0x45a74ef6), WORD(0x2f398987), WORD(0x7647da42),
+	WORD(0x36c3088d), WORD(0x04187001), WORD(0x09fd7cfc), WORD(0x5fe7e3dc),
+	WORD(0xcf06a869), WORD(0x68492dff), WORD(0x60d40fa3), WORD(0xc701376b),
+	WORD(0xdef47bd2), WORD(0x7108519a), WORD(0xf4547db9), WORD(0x1737c117),
+	WORD(0x06336f06), WORD(0x45fc4126), WORD(0x859fe8d8), WORD(0x16cd3023),
+	WORD(0x22060f63), WORD(0x75607766), WORD(0x131aedba), WORD(0xa9f9252d),
+	/* T[25] */
+	WORD(0xb180640c), WORD(0x4a892cbb), WORD(0x127848ad), WORD(0x4a62a73a),
+	WORD(0x05145204), WORD(0xcaf8e24c), WORD(0x9d8eabf5), WORD(0x9aa34cb0),
+	WORD(0x560819f4), WORD(0x5288feef), WORD(0xfa1fa4fa), WORD(0xc3b8e0ee),
+	WORD(0x7a122b5a), WORD(0xac850392), WORD(0xba2ab0ef), WORD(0x09f253ea),
+	WORD(0x6ccab014), WORD(0x261b5886), WORD(0xdc10b512), WORD(0x3ef71c79),
+	WORD(0x8a10d055), WORD(0xdaec9376), WORD(0x4b72be91), WORD(0x67285bec),
+	WORD(0x33270c6e), WORD(0x4d441a3a), WORD(0x32680595), WORD(0xe130af78),
+	WORD(0xaf1c5c32), WORD(0xd8e5c197), WORD(0xe6381300), WORD(0x69a0d819),
+	/* T[26] */
+	WORD(0xd45fa0e6), WORD(0xd2dbad6b), WORD(0x6916d449), WORD(0x29958191),
+	WORD(0x39ab596f), WORD(0x378621df), WORD(0xa2373a6e), WORD(0xa9fb4a74),
+	WORD(0xfc577ded), WORD(0x2fedcfae), WORD(0x6100ca32), WORD(0x8fa04341),
+	WORD(0xba5050bb), WORD(0x5c8aa00e), WORD(0x492203cb), WORD(0x5d1129a0),
+	WORD(0xedfe1e77), WORD(0x218d44cb), WORD(0x4dc99718), WORD(0x3d62da57),
+	WORD(0x8ac1b4f2), WORD(0xf94b3d5c), WORD(0x421f2ab7), WORD(0xed94c580),
+	WORD(0x4bf71012), WORD(0x5cf26830), WORD(0x1bc3b76f), WORD(0x1c9be4cc),
+	WORD(0x9094f420), WORD(0x44d67010), WORD(0x41696c6c), WORD(0x8ac6bd80),
+	/* T[27] */
+	WORD(0x2ccc7a31), WORD(0x025989a4), WORD(0x6e8455ac), WORD(0x764e9d2f),
+	WORD(0x5f416f92), WORD(0xf08a2d2c), WORD(0xb2c32411), WORD(0x04040b40),
+	WORD(0xc2013726), WORD(0x86314aa0), WORD(0x7c5d9d5f), WORD(0xcfc59274),
+	WORD(0x12946e31), WORD(0x8f2c42c1), WORD(0x8fe7f668), WORD(0x64d659f0),
+	WORD(0xdc92b936), WORD(0xc5762744), WORD(0xf4f378ee), WORD(0xf5bc7410),
+	WORD(0x92f99a8d), WORD(0x284e3e8b), WORD(0x462f9f14), WORD(0x482c4862),
+	WORD(0x2363d85a), WORD(0x2900ed3b), WORD(0xb7e1995f), WORD(0x9868f084),
+	WORD(0x77ff2a7d), WORD(0x2325672c), WORD(0xd1ce1127), WORD(0x8a69390e),
+	/* T[28] */
+	WORD(0xbd12f451), WORD(0x7de344f2), WORD(0x1895a859), WORD(0x4ab50903),
+	WORD(0x8a0fc2d9), WORD(0x1f14a2ec), WORD(0xcf3919e1), WORD(0xeb314706),
+	WORD(0x93cecb9c), WORD(0x593cbed7), WORD(0x72283bef), WORD(0x36208f93),
+	WORD(0x9a3458a8), WORD(0x09408e7c), WORD(0x4e8d355b), WORD(0x54661f31),
+	WORD(0x512cc2f8), WORD(0xe34fcb6e), WORD(0x8adf6783), WORD(0xe7a96836),
+	WORD(0x9e40d644), WORD(0x7ef7d7a7), WORD(0x0b8be7d4), WORD(0xe31c9795),
+	WORD(0x95a0c3c4), WORD(0x2652511f), WORD(0xd61e2c5a), WORD(0x1e1b8fb6),
+	WORD(0x6e7b08e7), WORD(0x8732ba73), WORD(0x642f9f48), WORD(0x1f8a593a),
+	/* T[29] */
+	WORD(0x5bdda824), WORD(0xbc887aed), WORD(0x651182ad), WORD(0x0b74e41c),
+	WORD(0xf747e58c), WORD(0x50014a70), WORD(0x9d4beb32), WORD(0xb0022f87),
+	WORD(0xca0de1b7), WORD(0x4af4e68a), WORD(0xe19b5b36), WORD(0xdf1926b4),
+	WORD(0xe422f1d8), WORD(0xeb086a02), WORD(0x997a68bc), WORD(0x27f7ec65),
+	WORD(0xaaa44775), WORD(0x284e930f), WORD(0xed6a639c), WORD(0x0686fc26),
+	WORD(0x89b8196c), WORD(0x50a1e316), WORD(0xe3a2a9cb), WORD(0xe9e41ac4),
+	WORD(0xdd650509), WORD(0x6db86fa2), WORD(0xced327db), WORD(0x06ff9706),
+	WORD(0xb405dd40), WORD(0x3148cc4e), WORD(0x917fff65), WORD(0xa09960c5),
+	/* T[30] */
+	WORD(0x9c0d64d4), WORD(0x2d9c65fd), WORD(0xfbd2eb0e), WORD(0x03f68744),
+	WORD(0xb9a3b68e), WORD(0x1181012b), WORD(0xe147debd), WORD(0x9489dac9),
+	WORD(0x13cd8d5b), WORD(0x842fbf41), WORD(0x695725fe), WORD(0x35276505),
+	WORD(0x57a36482), WORD(0xade11e1b), WORD(0xe7ac8826), WORD(0x1b4434c3),
+	WORD(0x6c947949), WORD(0x0f69b055), WORD(0x3856c8c5), WORD(0xa9955f90),
+	WORD(0x11385ea7), WORD(0xc936a8a7), WORD(0xf265a98b), WORD(0x4f4ba82a),
+	WORD(0x6b17fb1f), WORD(0xfa9977ae), WORD(0x2dca0bb3), WORD(0x407a606a),
+	WORD(0x7399ca26), WORD(0x55dc5610), WORD(0x92108393), WORD(0x1821ec90),
+	/* T[31] */
+	WORD(0x3888b646), WORD(0xdb8347bb), WORD(0x2b5dbd27), WORD(0x83d8fc36),
+	WORD(0x05ecac5f), WORD(0x005d586a), WORD(0x6a45521a), WORD(0xd3d05555),
+	WORD(0x33e28eb6), WORD(0x3b75130a), WORD(0x660e1f23), WORD(0x87d2a306),
+	WORD(0xb87851b9), WORD(0xa7cefd79), WORD(0xf09f7088), WORD(0x29738861),
+	WORD(0xbbe9356b), WORD(0x6bce71f5), WORD(0x0f12f8e5), WORD(0x2e7ac766),
+	WORD(0x06daac43), WORD(0xa8ba4ee1), WORD(0x7e82f26b), WORD(0x0f477c31),
+	WORD(0x8ab34a21), WORD(0x9fb298e8), WORD(0x4344bcae), WORD(0x6ef33ef8),
+	WORD(0x058f9d09), WORD(0xb7de22e3), WORD(0xdc249657), WORD(0x184b50f3),
+};
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+static const word_t brainpoolp512r1_gen_comb[] = {
+	/* T[0] */
+	WORD(0x6e81), WORD(0x863f), WORD(0xc684), WORD(0x5c01), WORD(0xb749), WORD(0xc372),
+	WORD(0x7d06), WORD(0xfedc), WORD(0x077b), WORD(0x1e92), WORD(0xd984), WORD(0x5e62),
+	WORD(0x7906), WORD(0x11ca), WORD(0x8925), WORD(0xd846), WORD(0x8cc2), WORD(0x2c09),
+	WORD(0x83c3), WORD(0x8122), WORD(0x43fb), WORD(0xdbb1), WORD(0xd220), WORD(0xbc75),
+	WORD(0xeffa), WORD(0x4dc3), WORD(0x8bc5), WORD(0xd0e8), WORD(0xc3e2), WORD(0x35ff),
+	WORD(0xb1c3), WORD(0x6e2e), WORD(0x9d68), WORD(0xea77), WORD(0xa64b), WORD(0x2139),
+	WORD(0xbd22), WORD(0xa36f), WORD(0x2ea3), WORD(0xbba5), WORD(0x268d), WORD(0xb032),
+	WORD(0x0850), WORD(0x71ea), WORD(0xd60d), WORD(0x44ce), WORD(0xa935), WORD(0xcc86),
+	WORD(0x9f48), WORD(0x3e63), WORD(0xeb29), WORD(0x025c), WORD(0xca89), WORD(0x6704),
+	WORD(0x7f77), WORD(0x2034), WORD(0x4679), WORD(0x6909), WORD(0x57e9), WORD(0x79ed),
+	WORD(0x87e4), WORD(0x9c09), WORD(0x07e9), WORD(0x3cf4),
+	/* T[1] */
+	WORD(0x677e), WORD(0x0052), WORD(0x349d), WORD(0x4ce2), WORD(0x6318), WORD(0x6f75),
+	WORD(0x5af3), WORD(0x16bc), WORD(0x842e), WORD(0x9f75), WORD(0xd685), WORD(0x608e),
+	WORD(0x7856), WORD(0x1d65), WORD(0xc493), WORD(0xa814), WORD(0x8471), WORD(0x3df5),
+	WORD(0xe1e5), WORD(0x7ad3), WORD(0xcb16), WORD(0xb068), WORD(0xca93), WORD(0x4d75),
+	WORD(0x0c03), WORD(0xc126), WORD(0x4789), WORD(0xa8ff), WORD(0x9c07), WORD(0x0368),
+	WORD(0x7fb6), WORD(0x76f0), WORD(0xa5fb), WORD(0x63f1), WORD(0xa558), WORD(0xc5f1),
+	WORD(0xe182), WORD(0x6a3c), WORD(0x32c3), WORD(0x0f40), WORD(0xafca), WORD(0x5e34),
+	WORD(0xb9b3), WORD(0x46fa), WORD(0x2fac), WORD(0xa4b8), WORD(0xa7d2), WORD(0x8a42),
+	WORD(0xddfa), WORD(0x42ab), WORD(0x97ef), WORD(0xe241), WORD(0x1a55), WORD(0x7235),
+	WORD(0xd33b), WORD(0x81b5), WORD(0x681f), WORD(0xf3df), WORD(0x96ee), WORD(0x9a6a),
+	WORD(0x92de), WORD(0xe19f), WORD(0x14b5), WORD(0x7115),
+	/* T[2] */
+	WORD(0x0cf0), WORD(0xe700), WORD(0x223e), WORD(0xa5ff), WORD(0x1488), WORD(0xd84b),
+	WORD(0xfc54), WORD(0xd960), WORD(0x159c), WORD(0x5e57), WORD(0x3a96), WORD(0xeee9),
+	WORD(0xb00a), WORD(0x11c4), WORD(0x267e), WORD(0x7451), WORD(0x72d6), WORD(0xd14b),
+	WORD(0x87e1), WORD(0x29f6), WORD(0x8cb4), WORD(0x6ee4), WORD(0x8a8c), WORD(0x611d),
+	WORD(0xf4d7), WORD(0x6d54), WORD(0x87b6), WORD(0xc12b), WORD(0xdc2d), WORD(0x6771),
+	WORD(0xc4e5), WORD(0x0093), WORD(0x8d04), WORD(0xdfb8), WORD(0x13fc), WORD(0x30fb),
+	WORD(0xbbaf), WORD(0xc950), WORD(0xf138), WORD(0xd16f), WORD(0xef86), WORD(0xf596),
+	WORD(0x8ec1), WORD(0xc81a), WORD(0xc7d6), WORD(0xf680), WORD(0x08d7), WORD(0x992c),
+	WORD(0x8dee), WORD(0x0435), WORD(0x5e82), WORD(0x0b90), WORD(0xf00a), WORD(0x2e74),
+	WORD(0x281b), WORD(0xea68), WORD(0x2a70), WORD(0x6ce0), WORD(0xeb99), WORD(0x506a),
+	WORD(0xec25), WORD(0x7e0e), WORD(0x19ac), WORD(0x6344),
+	/* T[3] */
+	WORD(0x0a9a), WORD(0xe986), WORD(0x7765), WORD(0x755e), WORD(0x5d4e), WORD(0xee9a),
+	WORD(0x2d7c), WORD(0x4f01), WORD(0xb21d), WORD(0x6496), WORD(0x5392), WORD(0x3f75),
+	WORD(0x9956), WORD(0x98aa), WORD(0x833e), WORD(0x63e5), WORD(0x31de), WORD(0xb81a),
+	WORD(0x34e8), WORD(0xe074), WORD(0x9e2e), WORD(0xdcf6), WORD(0x0076), WORD(0xe269),
+	WORD(0x25f7), WORD(0x416f), WORD(0xe42f), WORD(0x4613), WORD(0x1215), WORD(0x0a32),
+	WORD(0xbfa4), WORD(0x402a), WORD(0x59ad), WORD(0xa7c3), WORD(0x1d3b), WORD(0x46f8),
+	WORD(0xcc32), WORD(0x524d), WORD(0xe03b), WORD(0x1b80), WORD(0x3e88), WORD(0xe355),
+	WORD(0x1e53), WORD(0x0216), WORD(0x8234), WORD(0xa07f), WORD(0x5413), WORD(0x19a9),
+	WORD(0x575a), WORD(0xf060), WORD(0xe409), WORD(0x6c03), WORD(0xb7f0), WORD(0x9bcb),
+	WORD(0x1e45), WORD(0x8515), WORD(0x6561), WORD(0x79f7), WORD(0x8a47), WORD(0x8fa9),
+	WORD(0x8ddb), WORD(0x543e), WORD(0xee71), WORD(0x3ddd),
+	/* T[4] */
+	WORD(0x8173), WORD(0xf3e9), WORD(0xf57a), WORD(0x5db8), WORD(0xad3f), WORD(0xd91d),
+	WORD(0x6651), WORD(0x18a2), WORD(0x1c53), WORD(0x849a), WORD(0x51bc), WORD(0x3161),
+	WORD(0x3156), WORD(0x62a7), WORD(0x52f0), WORD(0x8bdc), WORD(0x0ea5), WORD(0x58c4),
+	WORD(0x48ba), WORD(0xffd6), WORD(0x9023), WORD(0xafff), WORD(0x6089), WORD(0xd49d),
+	WORD(0x8cf0), WORD(0xd275), WORD(0x3191), WORD(0x70a2), WORD(0x6af5), WORD(0x8259),
+	WORD(0x4009), WORD(0x2b2c), WORD(0xf5ee), WORD(0x7193), WORD(0x8af8), WORD(0x0e7e),
+	WORD(0x81d4), WORD(0x691f), WORD(0x7689), WORD(0x8c0c), WORD(0x784e), WORD(0x3128),
+	WORD(0xeb30), WORD(0xf291), WORD(0xe91c), WORD(0x137a), WORD(0x6e47), WORD(0x5df8),
+	WORD(0x95df), WORD(0x3e03), WORD(0x0087), WORD(0xe2e1), WORD(0x81f7), WORD(0xa3fd),
+	WORD(0xdb18), WORD(0xcc49), WORD(0xba43), WORD(0x334d), WORD(0x07ed), WORD(0xfef1),
+	WORD(0xb505), WORD(0xfa63), WORD(0xb62a), WORD(0x94c4),
+	/* T[5] */
+	WORD(0xc640), WORD(0x50d8), WORD(0xf716), WORD(0x1797), WORD(0x9046), WORD(0xca93),
+	WORD(0xe641), WORD(0x3680), WORD(0xdea2), WORD(0x6415), WORD(0x043c), WORD(0x6ab9),
+	WORD(0xc452), WORD(0x430c), WORD(0x5fc2), WORD(0x00e6), WORD(0x8a68), WORD(0xf8e2),
+	WORD(0x1e87), WORD(0xd7ef), WORD(0x0a8b), WORD(0x0564), WORD(0x1bb6), WORD(0x78a7),
+	WORD(0xfeed), WORD(0xcd28), WORD(0x012e), WORD(0x1606), WORD(0xc5e7), WORD(0xe296),
+	WORD(0xe6c3), WORD(0x31eb), WORD(0xbc99), WORD(0x7d86), WORD(0x9dbe), WORD(0x968d),
+	WORD(0x2ecb), WORD(0x46a1), WORD(0x4115), WORD(0x63af), WORD(0x842d), WORD(0x9458),
+	WORD(0xe53e), WORD(0xbaca), WORD(0x0737), WORD(0x12a2), WORD(0x76f5), WORD(0x83c4),
+	WORD(0x2512), WORD(0xbda0), WORD(0x95a7), WORD(0x68ac), WORD(0xfff9), WORD(0x4f68),
+	WORD(0x14eb), WORD(0xe362), WORD(0xf116), WORD(0xcb6f), WORD(0x4ec5), WORD(0xffbb),
+	WORD(0xf1bc), WORD(0x1d39), WORD(0xba02), WORD(0x33e1),
+	/* T[6] */
+	WORD(0x6ec0), WORD(0xa180), WORD(0x1be2), WORD(0x450e), WORD(0xc844), WORD(0xbc27),
+	WORD(0x6ba3), WORD(0x6922), WORD(0x6407), WORD(0x96c9), WORD(0xf519), WORD(0xcfb9),
+	WORD(0xd556), WORD(0x9859), WORD(0x549b), WORD(0x3fb0), WORD(0xea95), WORD(0x785e),
+	WORD(0x771e), WORD(0x12d9), WORD(0xf826), WORD(0x6235), WORD(0xcb94), WORD(0xf271),
+	WORD(0xcff4), WORD(0x740e), WORD(0x1229), WORD(0x2bd7), WORD(0x9f70), WORD(0xf0a5),
+	WORD(0x0ae4), WORD(0xa8b7), WORD(0xf3a1), WORD(0x79e3), WORD(0x9dcd), WORD(0xec58),
+	WORD(0x0044), WORD(0xbd8f), WORD(0x1f9c), WORD(0x3994), WORD(0xa340), WORD(0x0a45),
+	WORD(0x330c), WORD(0xf64e), WORD(0x4ddc), WORD(0x2e5f), WORD(0x6665), WORD(0x323b),
+	WORD(0x32a2), WORD(0x2aff), WORD(0x0803), WORD(0x510f), WORD(0x170d), WORD(0xc66d),
+	WORD(0x3cd8), WORD(0xf7f0), WORD(0x3793), WORD(0x6915), WORD(0x1706), WORD(0x1e7d),
+	WORD(0xf7ab), WORD(0x52bd), WORD(0x9330), WORD(0x555a),
+	/* T[7] */
+	WORD(0xf42c), WORD(0x0c58), WORD(0x08f9), WORD(0x3df9), WORD(0x0911), WORD(0x8b80),
+	WORD(0xd253), WORD(0x5425), WORD(0x21f6), WORD(0x9c43), WORD(0x9099), WORD(0x7657),
+	WORD(0x86ab), WORD(0x848d), WORD(0x4632), WORD(0x6086), WORD(0x65fd), WORD(0xbe92),
+	WORD(0xda93), WORD(0xb272), WORD(0x5c81), WORD(0xc903), WORD(0x5d8a), WORD(0x3af0),
+	WORD(0xecf2), WORD(0x990b), WORD(0xc28f), WORD(0xbfba), WORD(0x31fc), WORD(0xdc8e),
+	WORD(0x17f9), WORD(0x250e), WORD(0x8f55), WORD(0x9e37), WORD(0xcbcf), WORD(0x6a5f),
+	WORD(0x196d), WORD(0xa85e), WORD(0xb9e6), WORD(0x0b2f), WORD(0xf6c3), WORD(0xdb06),
+	WORD(0x46a1), WORD(0xa966), WORD(0xa478), WORD(0x29bc), WORD(0xba36), WORD(0x9eed),
+	WORD(0x721a), WORD(0xdddc), WORD(0x9bd8), WORD(0xefbf), WORD(0x3937), WORD(0x753e),
+	WORD(0xf1b7), WORD(0x8f22), WORD(0x14b3), WORD(0x57b2), WORD(0xe2e9), WORD(0xbeb3),
+	WORD(0xe83f), WORD(0xa515), WORD(0x7ed7), WORD(0x8fda),
+	/* T[8] */
+	WORD(0x03ac), WORD(0xafe3), WORD(0x323d), WORD(0x74b9), WORD(0x1181), WORD(0x61a8),
+	WORD(0x0776), WORD(0x6f93), WORD(0xf46f), WORD(0xdf80), WORD(0x43d2), WORD(0x6db3),
+	WORD(0x9897), WORD(0x9b30), WORD(0x9415), WORD(0xd0e7), WORD(0x6ada), WORD(0x0dc9),
+	WORD(0xd5e9), WORD(0xb0c5), WORD(0x5beb), WORD(0x23bb), WORD(0x74c1), WORD(0x28c9),
+	WORD(0xe659), WORD(0xc678), WORD(0x91ce), WORD(0xf51a), WORD(0x9984), WORD(0x54ac),
+	WORD(0x6685), WORD(0x59f9), WORD(0x7272), WORD(0x32e9), WORD(0x3b03), WORD(0xe22d),
+	WORD(0xd568), WORD(0xa8b0), WORD(0x1810), WORD(0xd45b), WORD(0x2036), WORD(0xdf28),
+	WORD(0x8853), WORD(0xec5d), WORD(0xaa5e), WORD(0x0d08), WORD(0x3498), WORD(0xf824),
+	WORD(0xfcf4), WORD(0xf015), WORD(0xcb38), WORD(0x67c7), WORD(0x0993), WORD(0x1e96),
+	WORD(0xf50c), WORD(0x053f), WORD(0xdac5), WORD(0x4c4e), WORD(0x745a), WORD(0x06dd),
+	WORD(0x0d4b), WORD(0x45e9), WORD(0x3eb9), WORD(0x84d6),
+	/* T[9] */
+	WORD(0x4491), WORD(0x13ae), WORD(0xbfe8), WORD(0x6232), WORD(0xf6a3), WORD(0x7f83),
+	WORD(0xc037), WORD(0x3141), WORD(0x2955), WORD(0x2113), WORD(0xad72), WORD(0xe940),
+	WORD(0xc1ab), WORD(0x1643), WORD(0x7045), WORD(0xa0ba), WORD(0x065e), WORD(0xb7a2),
+	WORD(0xda2a), WORD(0x9888), WORD(0x2e33), WORD(0xf472), WORD(0x34ec), WORD(0xdc6d),
+	WORD(0xd419), WORD(0xa9ff), WORD(0x68c9), WORD(0x6385), WORD(0xf0bd), WORD(0xdb3c),
+	WORD(0xf4c3), WORD(0xa57f), WORD(0xa860), WORD(0x16f2), WORD(0x2c06), WORD(0xfe27),
+	WORD(0x6cdc), WORD(0x5f2f), WORD(0x93cd), WORD(0x3779), WORD(0x06e9), WORD(0x733b),
+	WORD(0x322d), WORD(0xe079), WORD(0x535e), WORD(0x458a), WORD(0x7c48), WORD(0xbf4b),
+	WORD(0x8e4c), WORD(0x7aba), WORD(0x28f4), WORD(0x5b03), WORD(0x3921), WORD(0x6d87),
+	WORD(0xc5e3), WORD(0xb957), WORD(0x39ee), WORD(0xba4d), WORD(0xf201), WORD(0x3c5f),
+	WORD(0xa53e), WORD(0x2524), WORD(0x5b13), WORD(0x6529),
+	/* T[10] */
+	WORD(0x903a), WORD(0xb112), WORD(0xecef), WORD(0x1fc8), WORD(0x1768), WORD(0x6535),
+	WORD(0x9e27), WORD(0x1780), WORD(0xdf05), WORD(0x3354), WORD(0x7af1), WORD(0xdaed),
+	WORD(0x8dce), WORD(0xd10e), WORD(0x40fd), WORD(0x67a6), WORD(0x3760), WORD(0x3da7),
+	WORD(0x50f0), WORD(0xf27e), WORD(0xbea0), WORD(0x23e8), WORD(0xd7a0), WORD(0x689d),
+	WORD(0x2dc9), WORD(0x0dc9), WORD(0x52ec), WORD(0xe475), WORD(0xb5fc), WORD(0x7761),
+	WORD(0x21a7), WORD(0x10eb), WORD(0xf897), WORD(0x0068), WORD(0x8e5d), WORD(0x0a16),
+	WORD(0xa70a), WORD(0x19a2), WORD(0x9f2e), WORD(0x999c), WORD(0xf077), WORD(0x08a6),
+	WORD(0x7722), WORD(0xa018), WORD(0xa9ed), WORD(0x4c7e), WORD(0xe013), WORD(0xb1a2),
+	WORD(0x9dc4), WORD(0xb320), WORD(0x615a), WORD(0x6fe2), WORD(0xbf88), WORD(0x40e3),
+	WORD(0x0b42), WORD(0xc052), WORD(0x95d3), WORD(0x65c2), WORD(0x7b15), WORD(0xd530),
+	WORD(0x0bb0), WORD(0x1296), WORD(0x9008), WORD(0x10cb),
+	/* T[11] */
+	WORD(0x1c0f), WORD(0x3d77), WORD(0xba55), WORD(0x5ded), WORD(0x08ba), WORD(0xcb1a),
+	WORD(0xb14c), WORD(0xfefd), WORD(0xf389), WORD(0xc13f), WORD(0xe30e), WORD(0x4cb8),
+	WORD(0x3ec3), WORD(0xe9f1), WORD(0x9a36), WORD(0xaf6d), WORD(0x1b48), WORD(0x225a),
+	WORD(0x4ed1), WORD(0x8189), WORD(0xcd30), WORD(0xd543), WORD(0x86f6), WORD(0xbc91),
+	WORD(0x4d4e), WORD(0xaa45), WORD(0x0791), WORD(0x862c), WORD(0xa7f4), WORD(0xf5cb),
+	WORD(0x7404), WORD(0x45a2), WORD(0x4bf3), WORD(0xc92e), WORD(0x8b65), WORD(0xe88e),
+	WORD(0xcf8d), WORD(0x4f0f), WORD(0xdc44), WORD(0xb6de), WORD(0xcc56), WORD(0xa8fc),
+	WORD(0x4ab5), WORD(0x3e82), WORD(0x9986), WORD(0x4150), WORD(0x0f3e), WORD(0x6dbc),
+	WORD(0x77b4), WORD(0xd6de), WORD(0xd4da), WORD(0xf8eb), WORD(0x372a), WORD(0x0e3d),
+	WORD(0xd72a), WORD(0x49f9), WORD(0xe771), WORD(0x333f), WORD(0x4162), WORD(0x475f),
+	WORD(0x19aa), WORD(0x359b), WORD(0x2886), WORD(0x9ea3),
+	/* T[12] */
+	WORD(0x532d), WORD(0x7b7e), WORD(0x3d1b), WORD(0x496c), WORD(0x3338), WORD(0xc5f3),
+	WORD(0x42c4), WORD(0x1545), WORD(0x0f9b), WORD(0x9ef9), WORD(0x4bda), WORD(0x2c8c),
+	WORD(0xf146), WORD(0x9229), WORD(0x66d6), WORD(0xea27), WORD(0x2c60), WORD(0x1e6e),
+	WORD(0x6907), WORD(0xdbbb), WORD(0x4f7a), WORD(0x631a), WORD(0x12b1), WORD(0xf125),
+	WORD(0x48da), WORD(0x06b3), WORD(0x4d23), WORD(0x4dc2), WORD(0x728c), WORD(0x9377),
+	WORD(0xe1a6), WORD(0x31dd), WORD(0xee83), WORD(0x8c6c), WORD(0x213e), WORD(0x26af),
+	WORD(0x995d), WORD(0x6334), WORD(0x24fd), WORD(0xd06f), WORD(0x4066), WORD(0xe3b8),
+	WORD(0x5aac), WORD(0x3066), WORD(0x37c7), WORD(0x6a1f), WORD(0xf0ff), WORD(0xdba2),
+	WORD(0x8a46), WORD(0x36a2), WORD(0x8f15), WORD(0x2c8d), WORD(0xf805), WORD(0xe277),
+	WORD(0x6891), WORD(0x4142), WORD(0x2c24), WORD(0xd830), WORD(0x5bbd), WORD(0x2e81),
+	WORD(0x62ef), WORD(0xc3f4), WORD(0xd565), WORD(0x2806),
+	/* T[13] */
+	WORD(0x0930), WORD(0x7862), WORD(0x1067), WORD(0xbbfb), WORD(0x5dca), WORD(0x668c),
+	WORD(0x8063), WORD(0x7a2a), WORD(0xe90e), WORD(0x75bf), WORD(0x9b9d), WORD(0x0906),
+	WORD(0xe6bd), WORD(0xab76), WORD(0xa5a3), WORD(0x228a), WORD(0x4325), WORD(0xc469),
+	WORD(0x8181), WORD(0x8046), WORD(0x3f91), WORD(0xcb96), WORD(0xa0d6), WORD(0x99ea),
+	WORD(0xadb2), WORD(0x20ca), WORD(0x8839), WORD(0x4e88), WORD(0xbe87), WORD(0x9992),
+	WORD(0x400f), WORD(0x3156), WORD(0x72b3), WORD(0xe4e9), WORD(0x0b06), WORD(0x6f76),
+	WORD(0xc795), WORD(0xaa7b), WORD(0x92aa), WORD(0x3e04), WORD(0x7907), WORD(0xc0ef),
+	WORD(0xb3c2), WORD(0xe2c4), WORD(0x322d), WORD(0xaa92), WORD(0x052d), WORD(0xe07d),
+	WORD(0xb488), WORD(0x187e), WORD(0x4ab0), WORD(0x2dc4), WORD(0x17fd), WORD(0xb6b2),
+	WORD(0x9e4e), WORD(0x0afb), WORD(0xd9ad), WORD(0xb290), WORD(0xdbb7), WORD(0xc874),
+	WORD(0x64da), WORD(0xa3fe), WORD(0xf145), WORD(0x14e9),
+	/* T[14] */
+	WORD(0x796d), WORD(0x5bcb), WORD(0xe658), WORD(0x538a), WORD(0x25ce), WORD(0x41b8),
+	WORD(0x445d), WORD(0x58af), WORD(0xfa2e), WORD(0xa447), WORD(0x5aeb), WORD(0x35c5),
+	WORD(0x543e), WORD(0x5604), WORD(0x0724), WORD(0xa344), WORD(0xbb1e), WORD(0xaba7),
+	WORD(0xc061), WORD(0x0998), WORD(0x2b21), WORD(0x5f67), WORD(0xf026), WORD(0x8bc9),
+	WORD(0x19fe), WORD(0xcda4), WORD(0x27f6), WORD(0xa827), WORD(0x5698), WORD(0xae6d),
+	WORD(0xd01e), WORD(0xa3c6), WORD(0x9f24), WORD(0xe3bd), WORD(0x4aa7), WORD(0x3546),
+	WORD(0x8442), WORD(0x68b4), WORD(0x8eb7), WORD(0x4494), WORD(0x2384), WORD(0xfed0),
+	WORD(0xa482), WORD(0xfe2a), WORD(0x8f5c), WORD(0xd45b), WORD(0x2992), WORD(0xac40),
+	WORD(0xc365), WORD(0xc3dc), WORD(0xe689), WORD(0x620f), WORD(0x8835), WORD(0xffea),
+	WORD(0xc802), WORD(0x86f7), WORD(0xf1a5), WORD(0xc42f), WORD(0xac95), WORD(0xf0a8),
+	WORD(0xa535), WORD(0x530e), WORD(0xe8df), WORD(0x3966),
+	/* T[15] */
+	WORD(0x1827), WORD(0x9998), WORD(0x3801), WORD(0xb892), WORD(0x3ef1), WORD(0x3bbb),
+	WORD(0x5e2a), WORD(0xb70c), WORD(0x977e), WORD(0x5314), WORD(0x2faf), WORD(0x076e),
+	WORD(0xf144), WORD(0x623c), WORD(0xb97f), WORD(0xe441), WORD(0xba7e), WORD(0xa4b2),
+	WORD(0x6a93), WORD(0xe9d4), WORD(0x4e4d), WORD(0x2e0d), WORD(0xcf27), WORD(0x2bee),
+	WORD(0x19a5), WORD(0x47fe), WORD(0x63ab), WORD(0xb1c9), WORD(0xbab2), WORD(0x2c96),
+	WORD(0xb582), WORD(0x1dc8), WORD(0x4602), WORD(0x6a42), WORD(0xec31), WORD(0x323f),
+	WORD(0x2163), WORD(0xd828), WORD(0x8426), WORD(0x26fc), WORD(0xb6e7), WORD(0x5e64),
+	WORD(0xa872), WORD(0x992a), WORD(0x423a), WORD(0x084c), WORD(0xa956), WORD(0x054b),
+	WORD(0x5fcf), WORD(0x9b68), WORD(0x3196), WORD(0x7ab4), WORD(0x5780), WORD(0x837b),
+	WORD(0x33e7), WORD(0x3b72), WORD(0x5b13), WORD(0xd69f), WORD(0x6de5), WORD(0xe690),
+	WORD(0x86b2), WORD(0xdd2b), WORD(0x45b9), WORD(0x805d),
+	/* T[16] */
+	WORD(0x64ff), WORD(0x7de8), WORD(0x1890), WORD(0x88ba), WORD(0x661a), WORD(0xb74b),
+	WORD(0x8e50), WORD(0xa238), WORD(0x6a1a), WORD(0xbce1), WORD(0x8d55), WORD(0xbb8a),
+	WORD(0xa9cd), WORD(0x9671), WORD(0xb19f), WORD(0x0110), WORD(0x624b), WORD(0x5d5a),
+	WORD(0xec94), WORD(0x7a37), WORD(0x66cf), WORD(0x8a22), WORD(0x7d53), WORD(0x7bab),
+	WORD(0xa098), WORD(0xc8bc), WORD(0x0f99), WORD(0x416b), WORD(0x4115), WORD(0xe332),
+	WORD(0x8923), WORD(0x2daa), WORD(0x0eb4), WORD(0x82e8), WORD(0xd39a), WORD(0x11fa),
+	WORD(0x749c), WORD(0x1b8c), WORD(0x4dcd), WORD(0x944c), WORD(0xa658), WORD(0x69d7),
+	WORD(0xd546), WORD(0x02f2), WORD(0x92cc), WORD(0x7b4b), WORD(0x82b2), WORD(0x0585),
+	WORD(0xe8ac), WORD(0xd217), WORD(0xf26b), WORD(0x5ce6), WORD(0xb56c), WORD(0xdbfb),
+	WORD(0x25ce), WORD(0x18a9), WORD(0x30ad), WORD(0x94a8), WORD(0x7124), WORD(0xe81c),
+	WORD(0x3c18), WORD(0x8b62), WORD(0x8965), WORD(0x2049),
+	/* T[17] */
+	WORD(0x5718), WORD(0x3858), WORD(0x2381), WORD(0x378e), WORD(0xe0fe), WORD(0xba2f),
+	WORD(0xb5f1), WORD(0xadbb), WORD(0x09f1), WORD(0xc5ea), WORD(0x1107), WORD(0x536e),
+	WORD(0x24dd), WORD(0xc428), WORD(0xedae), WORD(0xa6fc), WORD(0xac10), WORD(0x2667),
+	WORD(0x0dcd), WORD(0xbba3), WORD(0xa582), WORD(0xe2ef), WORD(0x0aaa), WORD(0xadd9),
+	WORD(0xaf18), WORD(0xaf38), WORD(0x88ff), WORD(0x9343), WORD(0xc28e), WORD(0xb4cf),
+	WORD(0xcbce), WORD(0x35f3), WORD(0x9b89), WORD(0x5d0e), WORD(0x02f5), WORD(0xc203),
+	WORD(0xe06e), WORD(0x3652), WORD(0x1ca2), WORD(0x62a7), WORD(0x7dcf), WORD(0xa913),
+	WORD(0xa31e), WORD(0x4e39), WORD(0x7e7a), WORD(0xa9aa), WORD(0xed7c), WORD(0x94f6),
+	WORD(0x44a6), WORD(0x4341), WORD(0xb090), WORD(0xbb39), WORD(0x57ca), WORD(0xcff8),
+	WORD(0x79aa), WORD(0x823b), WORD(0xf9b4), WORD(0xa360), WORD(0x30c4), WORD(0xbbd6),
+	WORD(0xf3e1), WORD(0xbf24), WORD(0x990f), WORD(0x90ff),
+	/* T[18] */
+	WORD(0x7758), WORD(0x3810), WORD(0x2f5c), WORD(0x6bc8), WORD(0x0f4f), WORD(0xf8f7),
+	WORD(0x7205), WORD(0x38f3), WORD(0xee2c), WORD(0x53aa), WORD(0xe71f), WORD(0x1dc1),
+	WORD(0x3546), WORD(0x3e9a), WORD(0xba0b), WORD(0x96de), WORD(0x082b), WORD(0x13b5),
+	WORD(0x15fb), WORD(0x98e4), WORD(0x9d1d), WORD(0xa885), WORD(0xf7a5), WORD(0x58e1),
+	WORD(0xde67), WORD(0xbbd6), WORD(0x83ae), WORD(0x47ae), WORD(0xc50f), WORD(0xfdf0),
+	WORD(0xc759), WORD(0x31e8), WORD(0x2fc8), WORD(0x82a4), WORD(0x5bc1), WORD(0xbfd2),
+	WORD(0x20f6), WORD(0x05b5), WORD(0x4d45), WORD(0xe06c), WORD(0xc39e), WORD(0xe43d),
+	WORD(0x27ea), WORD(0xa3cd), WORD(0x7fc2), WORD(0x347b), WORD(0x5689), WORD(0xe935),
+	WORD(0x7163), WORD(0x51ff), WORD(0xe682), WORD(0xf488), WORD(0x3f76), WORD(0xc912),
+	WORD(0x045a), WORD(0xc47b), WORD(0x4342), WORD(0xaf2b), WORD(0xdeb1), WORD(0xda84),
+	WORD(0xa573), WORD(0x008d), WORD(0x9238), WORD(0xa64e),
+	/* T[19] */
+	WORD(0x8555), WORD(0x646d), WORD(0xc471), WORD(0xd62c), WORD(0xf25b), WORD(0x9e97),
+	WORD(0x3c83), WORD(0x7f15), WORD(0xf1c8), WORD(0xb75e), WORD(0x90f4), WORD(0x2648),
+	WORD(0xdc4c), WORD(0x790d), WORD(0x323a), WORD(0x7be5), WORD(0x83e9), WORD(0xea31),
+	WORD(0x6a7b), WORD(0x75cc), WORD(0x7869), WORD(0x1b01), WORD(0xd480), WORD(0x8f5f),
+	WORD(0x4595), WORD(0x72ce), WORD(0x24e3), WORD(0x9e00), WORD(0xa7ef), WORD(0x7c6b),
+	WORD(0x183d), WORD(0x2e7c), WORD(0xfef3), WORD(0x57a1), WORD(0x510b), WORD(0x3aa3),
+	WORD(0x5268), WORD(0xabe0), WORD(0xd2ad), WORD(0xce13), WORD(0xd732), WORD(0x56eb),
+	WORD(0xb45b), WORD(0x1b36), WORD(0x919f), WORD(0xa551), WORD(0x9294), WORD(0x3bc6),
+	WORD(0x16ba), WORD(0xb1cd), WORD(0x6c62), WORD(0xe364), WORD(0x66c5), WORD(0xfa95),
+	WORD(0xe282), WORD(0xba40), WORD(0x82a2), WORD(0xbe3d), WORD(0xc592), WORD(0x4591),
+	WORD(0xbe21), WORD(0x1fa6), WORD(0xffff), WORD(0x88e6),
+	/* T[20] */
+	WORD(0x0243), WORD(0xda2a), WORD(0x92d0), WORD(0x8266), WORD(0x3199), WORD(0x5db0),
+	WORD(0x7412), WORD(0x37dd), WORD(0xa251), WORD(0xf9b0), WORD(0xb434), WORD(0xccbc),
+	WORD(0x96e0), WORD(0xc9f1), WORD(0x7687), WORD(0x2048), WORD(0x7ab2), WORD(0x1910),
+	WORD(0xebc1), WORD(0x7b79), WORD(0x0448), WORD(0x6bdc), WORD(0x8900), WORD(0xd3b1),
+	WORD(0xf577), WORD(0x45da), WORD(0x3873), WORD(0x45d7), WORD(0x6875), WORD(0xa09d),
+	WORD(0xf30d), WORD(0x3c1e), WORD(0x2eab), WORD(0xc18b), WORD(0x9e94), WORD(0x662e),
+	WORD(0x5823), WORD(0x2fb5), WORD(0x8c43), WORD(0x3742), WORD(0xa350), WORD(0x1c4c),
+	WORD(0xa6b9), WORD(0x9d76), WORD(0xf598), WORD(0xd183), WORD(0x7980), WORD(0x21d9),
+	WORD(0x0c44), WORD(0xd0ef), WORD(0xcaa7), WORD(0x9ebf), WORD(0x0fa0), WORD(0xa207),
+	WORD(0x2bd6), WORD(0x5cf2), WORD(0x6063), WORD(0x2751), WORD(0x0f45), WORD(0x861d),
+	WORD(0x01ab), WORD(0xb553), WORD(0xf071), WORD(0x44d5),
+	/* T[21] */
+	WORD(0x7213), WORD(0x5894), WORD(0x0ab7), WORD(0xb813), WORD(0x6323), WORD(0x3fe9),
+	WORD(0x0390), WORD(0x886b), WORD(0xdd66), WORD(0x1117), WORD(0x91ff), WORD(0x7032),
+	WORD(0xef5d), WORD(0xa83b), WORD(0xe524), WORD(0x3610), WORD(0xabf2), WORD(0xd4b3),
+	WORD(0x560c), WORD(0x40ee), WORD(0xdd19), WORD(0xb341), WORD(0x2f7e), WORD(0x8d49),
+	WORD(0x9b5c), WORD(0xb1bf), WORD(0x90c8), WORD(0x10c6), WORD(0xd3b5), WORD(0xf740),
+	WORD(0xe876), WORD(0x2a54), WORD(0x5c20), WORD(0x7661), WORD(0x0af5), WORD(0x5bcd),
+	WORD(0xeccf), WORD(0x09e2), WORD(0x0cfb), WORD(0x2e0c), WORD(0x1bc9), WORD(0x743c),
+	WORD(0x33c9), WORD(0x757c), WORD(0xe9e5), WORD(0x4b49), WORD(0xa576), WORD(0x2719),
+	WORD(0x84e0), WORD(0x6ba1), WORD(0x429f), WORD(0x75cf), WORD(0x2ba3), WORD(0xbfda),
+	WORD(0xba42), WORD(0x1840), WORD(0x571f), WORD(0x5a7e), WORD(0xd20b), WORD(0xebf4),
+	WORD(0xcf6f), WORD(0x71c0), WORD(0x330c), WORD(0x2ca9),
+	/* T[22] */
+	WORD(0xe028), WORD(0x65ee), WORD(0x7a5f), WORD(0xa030), WORD(0x5001), WORD(0xf37a),
+	WORD(0x846b), WORD(0x8cc2), WORD(0x32e2), WORD(0x4f6e), WORD(0xad5f), WORD(0x758f),
+	WORD(0xcdfc), WORD(0xc5cd), WORD(0x400d), WORD(0xa869), WORD(0x8430), WORD(0xa8e7),
+	WORD(0x58eb), WORD(0x4229), WORD(0xead3), WORD(0x7be4), WORD(0x0299), WORD(0x8f90),
+	WORD(0xa129), WORD(0x2c62), WORD(0xff61), WORD(0x3925), WORD(0x7ad5), WORD(0xd9d6),
+	WORD(0x87fd), WORD(0x884e), WORD(0xc619), WORD(0x4759), WORD(0x2f3f), WORD(0xe6b5),
+	WORD(0x5aea), WORD(0x0ebe), WORD(0xac6e), WORD(0xfd18), WORD(0x1771), WORD(0x7223),
+	WORD(0x465e), WORD(0x5402), WORD(0xf889), WORD(0x6341), WORD(0x5edb), WORD(0x35b7),
+	WORD(0xc62e), WORD(0xf269), WORD(0x7ed9), WORD(0xd66c), WORD(0x38ab), WORD(0x1754),
+	WORD(0x4946), WORD(0x17a4), WORD(0x437f), WORD(0x1322), WORD(0x0f7e), WORD(0xa43f),
+	WORD(0xeb18), WORD(0x404d), WORD(0x0b15), WORD(0xa330),
+	/* T[23] */
+	WORD(0xaa2e), WORD(0xfb2f), WORD(0xe8d0), WORD(0x48a5), WORD(0x32d6), WORD(0x27fe),
+	WORD(0xf464), WORD(0x37f3), WORD(0x5fa7), WORD(0x094c), WORD(0x82e2), WORD(0xb748),
+	WORD(0xc41b), WORD(0x4dde), WORD(0x37fe), WORD(0xe0d8), WORD(0x50d5), WORD(0x9d38),
+	WORD(0x6cbf), WORD(0x9e55), WORD(0x012b), WORD(0x5272), WORD(0x19ff), WORD(0x95cf),
+	WORD(0x9058), WORD(0xec97), WORD(0x4d20), WORD(0x115c), WORD(0xc80f), WORD(0x3eeb),
+	WORD(0x6a88), WORD(0x374f), WORD(0xbde0), WORD(0xbe28), WORD(0x971d), WORD(0x47ed),
+	WORD(0x9979), WORD(0xb321), WORD(0x8045), WORD(0x67e4), WORD(0x51e1), WORD(0x18c0),
+	WORD(0x3d2d), WORD(0xcd13), WORD(0x7ee3), WORD(0x690b), WORD(0x0cd7), WORD(0x3166),
+	WORD(0xabc6), WORD(0xf19d), WORD(0xe6f4), WORD(0xa0e4), WORD(0x66ef), WORD(0x4bc8),
+	WORD(0x765f), WORD(0x5451), WORD(0x88fb), WORD(0x6891), WORD(0xc5f4), WORD(0x48c9),
+	WORD(0x178e), WORD(0xcb2c), WORD(0x8618), WORD(0x24a5),
+	/* T[24] */
+	WORD(0x99e2), WORD(0x938c), WORD(0x8e42), WORD(0x4b3a), WORD(0x507f), WORD(0x0c86),
+	WORD(0xc993), WORD(0x5347), WORD(0x0321), WORD(0xbcb3), WORD(0x6621), WORD(0x86a0),
+	WORD(0x6068), WORD(0x1553), WORD(0x65b3), WORD(0x7c3b), WORD(0x3527), WORD(0x1558),
+	WORD(0x4ef6), WORD(0x45a7), WORD(0x8987), WORD(0x2f39), WORD(0xda42), WORD(0x7647),
+	WORD(0x088d), WORD(0x36c3), WORD(0x7001), WORD(0x0418), WORD(0x7cfc), WORD(0x09fd),
+	WORD(0xe3dc), WORD(0x5fe7), WORD(0xa869), WORD(0xcf06), WORD(0x2dff), WORD(0x6849),
+	WORD(0x0fa3), WORD(0x60d4), WORD(0x376b), WORD(0xc701), WORD(0x7bd2), WORD(0xdef4),
+	WORD(0x519a), WORD(0x7108), WORD(0x7db9), WORD(0xf454), WORD(0xc117), WORD(0x1737),
+	WORD(0x6f06), WORD(0x0633), WORD(0x4126), WORD(0x45fc), WORD(0xe8d8), WORD(0x859f),
+	WORD(0x3023), WORD(0x16cd), WORD(0x0f63), WORD(0x2206), WORD(0x7766), WORD(0x7560),
+	WORD(0xedba), WORD(0x131a), WORD(0x252d), WORD(0xa9f9),
+	/* T[25] */
+	WORD(0x640c), WORD(0xb180), WORD(0x2cbb), WORD(0x4a89), WORD(0x48ad), WORD(0x1278),
+	WORD(0xa73a), WORD(0x4a62), WORD(0x5204), WORD(0x0514), WORD(0xe24c), WORD(0xcaf8),
+	WORD(0xabf5), WORD(0x9d8e), WORD(0x4cb0), WORD(0x9aa3), WORD(0x19f4), WORD(0x5608),
+	WORD(0xfeef), WORD(0x5288), WORD(0xa4fa), WORD(0xfa1f), WORD(0xe0ee), WORD(0xc3b8),
+	WORD(0x2b5a), WORD(0x7a12), WORD(0x0392), WORD(0xac85), WORD(0xb0ef), WORD(0xba2a),
+	WORD(0x53ea), WORD(0x09f2), WORD(0xb014), WORD(0x6cca), WORD(0x5886), WORD(0x261b),
+	WORD(0xb512), WORD(0xdc10), WORD(0x1c79), WORD(0x3ef7), WORD(0xd055), WORD(0x8a10),
+	WORD(0x9376), WORD(0xdaec), WORD(0xbe91), WORD(0x4b72), WORD(0x5bec), WORD(0x6728),
+	WORD(0x0c6e), WORD(0x3327), WORD(0x1a3a), WORD(0x4d44), WORD(0x0595), WORD(0x3268),
+	WORD(0xaf78), WORD(0xe130), WORD(0x5c32), WORD(0xaf1c), WORD(0xc197), WORD(0xd8e5),
+	WORD(0x1300), WORD(0xe638), WORD(0xd819), WORD(0x69a0),
+	/* T[26] */
+	WORD(0xa0e6), WORD(0xd45f), WORD(0xad6b), WORD(0xd2db), WORD(0xd449), WORD(0x6916),
+	WORD(0x8191), WORD(0x2995), WORD(0x596f), WORD(0x39ab), WORD(0x21df), WORD(0x3786),
+	WORD(0x3a6e), WORD(0xa237), WORD(0x4a74), WORD(0xa9fb), WORD(0x7ded), WORD(0xfc57),
+	WORD(0xcfae), WORD(0x2fed), WORD(0xca32), WORD(0x6100), WORD(0x4341), WORD(0x8fa0),
+	WORD(0x50bb), WORD(0xba50), WORD(0xa00e), WORD(0x5c8a), WORD(0x03cb), WORD(0x4922),
+	WORD(0x29a0), WORD(0x5d11), WORD(0x1e77), WORD(0xedfe), WORD(0x44cb), WORD(0x218d),
+	WORD(0x9718), WORD(0x4dc9), WORD(0xda57), WORD(0x3d62), WORD(0xb4f2), WORD(0x8ac1),
+	WORD(0x3d5c), WORD(0xf94b), WORD(0x2ab7), WORD(0x421f), WORD(0xc580), WORD(0xed94),
+	WORD(0x1012), WORD(0x4bf7), WORD(0x6830), WORD(0x5cf2), WORD(0xb76f), WORD(0x1bc3),
+	WORD(0xe4cc), WORD(0x1c9b), WORD(0xf420), WORD(0x9094), WORD(0x7010), WORD(0x44d6),
+	WORD(0x6c6c), WORD(0x4169), WORD(0xbd80), WORD(0x8ac6),
+	/* T[27] */
+	WORD(0x7a31), WORD(0x2ccc), WORD(0x89a4), WORD(0x0259), WORD(0x55ac), WORD(0x6e84),
+	WORD(0x9d2f), WORD(0x764e), WORD(0x6f92), WORD(0x5f41), WORD(0x2d2c), WORD(0xf08a),
+	WORD(0x2411), WORD(0xb2c3), WORD(0x0b40), WORD(0x0404), WORD(0x3726), WORD(0xc201),
+	WORD(0x4aa0), WORD(0x8631), WORD(0x9d5f), WORD(0x7c5d), WORD(0x9274), WORD(0xcfc5),
+	WORD(0x6e31), WORD(0x1294), WORD(0x42c1), WORD(0x8f2c), WORD(0xf668), WORD(0x8fe7),
+	WORD(0x59f0), WORD(0x64d6), WORD(0xb936), WORD(0xdc92), WORD(0x2744), WORD(0xc576),
+	WORD(0x78ee), WORD(0xf4f3), WORD(0x7410), WORD(0xf5bc), WORD(0x9a8d), WORD(0x92f9),
+	WORD(0x3e8b), WORD(0x284e), WORD(0x9f14), WORD(0x462f), WORD(0x4862), WORD(0x482c),
+	WORD(0xd85a), WORD(0x2363), WORD(0xed3b), WORD(0x2900), WORD(0x995f), WORD(0xb7e1),
+	WORD(0xf084), WORD(0x9868), WORD(0x2a7d), WORD(0x77ff), WORD(0x672c), WORD(0x2325),
+	WORD(0x1127), WORD(0xd1ce), WORD(0x390e), WORD(0x8a69),
+	/* T[28] */
+	WORD(0xf451), WORD(0xbd12), WORD(0x44f2), WORD(0x7de3), WORD(0xa859), WORD(0x1895),
+	WORD(0x0903), WORD(0x4ab5), WORD(0xc2d9), WORD(0x8a0f), WORD(0xa2ec), WORD(0x1f14),
+	WORD(0x19e1), WORD(0xcf39), WORD(0x4706), WORD(0xeb31), WORD(0xcb9c), WORD(0x93ce),
+	WORD(0xbed7), WORD(0x593c), WORD(0x3bef), WORD(0x7228), WORD(0x8f93), WORD(0x3620),
+	WORD(0x58a8), WORD(0x9a34), WORD(0x8e7c), WORD(0x0940), WORD(0x355b), WORD(0x4e8d),
+	WORD(0x1f31), WORD(0x5466), WORD(0xc2f8), WORD(0x512c), WORD(0xcb6e), WORD(0xe34f),
+	WORD(0x6783), WORD(0x8adf), WORD(0x6836), WORD(0xe7a9), WORD(0xd644), WORD(0x9e40),
+	WORD(0xd7a7), WORD(0x7ef7), WORD(0xe7d4), WORD(0x0b8b), WORD(0x9795), WORD(0xe31c),
+	WORD(0xc3c4), WORD(0x95a0), WORD(0x511f), WORD(0x2652), WORD(0x2c5a), WORD(0xd61e),
+	WORD(0x8fb6), WORD(0x1e1b), WORD(0x08e7), WORD(0x6e7b), WORD(0xba73), WORD(0x8732),
+	WORD(0x9f48), WORD(0x642f), WORD(0x593a), WORD(0x1f8a),
+	/* T[29] */
+	WORD(0xa824), WORD(0x5bdd), WORD(0x7aed), WORD(0xbc88), WORD(0x82ad), WORD(0x6511),
+	WORD(0xe41c), WORD(0x0b74), WORD(0xe58c), WORD(0xf747), WORD(0x4a70), WORD(0x5001),
+	WORD(0xeb32), WORD(0x9d4b), WORD(0x2f87), WORD(0xb002), WORD(0xe1b7), WORD(0xca0d),
+	WORD(0xe68a), WORD(0x4af4), WORD(0x5b36), WORD(0xe19b), WORD(0x26b4), WORD(0xdf19),
+	WORD(0xf1d8), WORD(0xe422), WORD(0x6a02), WORD(0xeb08), WORD(0x68bc), WORD(0x997a),
+	WORD(0xec65), WORD(0x27f7), WORD(0x4775), WORD(0xaaa4), WORD(0x930f), WORD(0x284e),
+	WORD(0x639c), WORD(0xed6a), WORD(0xfc26), WORD(0x0686), WORD(0x196c), WORD(0x89b8),
+	WORD(0xe316), WORD(0x50a1), WORD(0xa9cb), WORD(0xe3a2), WORD(0x1ac4), WORD(0xe9e4),
+	WORD(0x0509), WORD(0xdd65), WORD(0x6fa2), WORD(0x6db8), WORD(0x27db), WORD(0xced3),
+	WORD(0x9706), WORD(0x06ff), WORD(0xdd40), WORD(0xb405), WORD(0xcc4e), WORD(0x3148),
+	WORD(0xff65), WORD(0x917f), WORD(0x60c5), WORD(0xa099),
+	/* T[30] */
+	WORD(0x64d4), WORD(0x9c0d), WORD(0x65fd), WORD(0x2d9c), WORD(0xeb0e), WORD(0xfbd2),
+	WORD(0x8744), WORD(0x03f6), WORD(0xb68e), WORD(0xb9a3), WORD(0x012b), WORD(0x1181),
+	WORD(0xdebd), WORD(0xe147), WORD(0xdac9), WORD(0x9489), WORD(0x8d5b), WORD(0x13cd),
+	WORD(0xbf41), WORD(0x842f), WORD(0x25fe), WORD(0x6957), WORD(0x6505), WORD(0x3527),
+	WORD(0x6482), WORD(0x57a3), WORD(0x1e1b), WORD(0xade1), WORD(0x8826), WORD(0xe7ac),
+	WORD(0x34c3), WORD(0x1b44), WORD(0x7949), WORD(0x6c94), WORD(0xb055), WORD(0x0f69),
+	WORD(0xc8c5), WORD(0x3856), WORD(0x5f90), WORD(0xa995), WORD(0x5ea7), WORD(0x1138),
+	WORD(0xa8a7), WORD(0xc936), WORD(0xa98b), WORD(0xf265), WORD(0xa82a), WORD(0x4f4b),
+	WORD(0xfb1f), WORD(0x6b17), WORD(0x77ae), WORD(0xfa99), WORD(0x0bb3), WORD(0x2dca),
+	WORD(0x606a), WORD(0x407a), WORD(0xca26), WORD(0x7399), WORD(0x5610), WORD(0x55dc),
+	WORD(0x8393), WORD(0x9210), WORD(0xec90), WORD(0x1821),
+	/* T[31] */
+	WORD(0xb646), WORD(0x3888), WORD(0x47bb), WORD(0xdb83), WORD(0xbd27), WORD(0x2b5d),
+	WORD(0xfc36), WORD(0x83d8), WORD(0xac5f), WORD(0x05ec), WORD(0x586a), WORD(0x005d),
+	WORD(0x521a), WORD(0x6a45), WORD(0x5555), WORD(0xd3d0), WORD(0x8eb6), WORD(0x33e2),
+	WORD(0x130a), WORD(0x3b75), WORD(0x1f23), WORD(0x660e), WORD(0xa306), WORD(0x87d2),
+	WORD(0x51b9), WORD(0xb878), WORD(0xfd79), WORD(0xa7ce), WORD(0x7088), WORD(0xf09f),
+	WORD(0x8861), WORD(0x2973), WORD(0x356b), WORD(0xbbe9), WORD(0x71f5), WORD(0x6bce),
+	WORD(0xf8e5), WORD(0x0f12), WORD(0xc766), WORD(0x2e7a), WORD(0xac43), WORD(0x06da),
+	WORD(0x4ee1), WORD(0xa8ba), WORD(0xf26b), WORD(0x7e82), WORD(0x7c31), WORD(0x0f47),
+	WORD(0x4a21), WORD(0x8ab3), WORD(0x98e8), WORD(0x9fb2), WORD(0xbcae), WORD(0x4344),
+	WORD(0x3ef8), WORD(0x6ef3), WORD(0x9d09), WORD(0x058f), WORD(0x22e3), WORD(0xb7de),
+	WORD(0x9657), WORD(0xdc24), WORD(0x50f3), WORD(0x184b),
+};
+#else                     /* unknown word size */
+#error "Unsupported word size"
+#endif
+TO_EC_GEN_TABLE_PARAM(brainpoolp512r1_gen_comb, 6);
+
 static const ec_str_params brainpoolp512r1_str_params = {
 	.p = &brainpoolp512r1_p_str_param,
 	.p_bitlen = &brainpoolp512r1_p_bitlen_str_param,
@@ -223,6 +2521,11 @@ static const ec_str_params brainpoolp512r1_str_params = {
 	.cofactor = &brainpoolp512r1_cofactor_str_param,
 	.oid = &brainpoolp512r1_oid_str_param,
 	.name = &brainpoolp512r1_name_str_param,
+	.p_inv_chain = &brainpoolp512r1_p_inv_chain_param,
+	.p_sqrt_chain = &brainpoolp512r1_p_sqrt_chain_param,
+	.q_inv_chain = &brainpoolp512r1_q_inv_chain_param,
+	.gen_wnaf_table = &brainpoolp512r1_gen_wnaf_table_param,
+	.gen_comb_table = &brainpoolp512r1_gen_comb_table_param,
 };
 
 /*
@@ -243,5 +2546,16 @@ static const ec_str_params brainpoolp512r1_str_params = {
 #define CURVES_MAX_Q_BIT_LEN CURVE_BRAINPOOLP512R1_Q_BITLEN
 #endif
 
+/*
+ * Limb count of p for the fixed limbs field backend (see fp_fixed.h)
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+#define FP_FIXED_WLEN_8_USED
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+#define FP_FIXED_WLEN_16_USED
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+/* More than 17 limbs: generic field code */
+#endif
+
 #endif /* __EC_PARAMS_BRAINPOOLP512R1_H__ */
 #endif /* WITH_CURVE_BRAINPOOLP512R1 */
@@ -31,6 +31,45 @@ typedef struct {
 #define PARAM_BUF_LEN(param) ((param)->buflen)
 #define PARAM_BUF_PTR(param) ((param)->buf)
 
+/*
+ * Addition chain for a fixed exponent, in the format expected by
+ * nn_pow_redc1_chain() (see scripts/addchain.py). Chains may be longer
+ * than 255 bytes, hence a dedicated type.
+ */
+typedef struct {
+	const u8 *buf;
+	const u16 buflen;
+} ec_chain_param;
+
+#define TO_EC_CHAIN_PARAM(pname) \
+	static const ec_chain_param pname##_chain_param = { \
+		.buf = pname,				\
+		.buflen = sizeof(pname)                 \
+	}
+
+/* Buffer and length of an optional (possibly NULL) chain */
+#define EC_CHAIN_PARAM_PTR(param) (((param) == NULL) ? NULL : (param)->buf)
+#define EC_CHAIN_PARAM_LEN(param) (((param) == NULL) ? 0 : (param)->buflen)
+
+/*
+ * Precomputed multiples of the generator (see scripts/ec_gen_table.py),
+ * as words in the internal representation of the fp layer: for each
+ * point, its affine coordinates x and y in Montgomery representation,
+ * each on the number of words of p. buflen is in words.
+ */
+typedef struct {
+	const word_t *buf;
+	const u16 buflen;
+	const u8 window;
+} ec_gen_table_param;
+
+#define TO_EC_GEN_TABLE_PARAM(pname, w) \
+	static const ec_gen_table_param pname##_table_param = { \
+		.buf = pname,				\
+		.buflen = sizeof(pname) / sizeof(word_t), \
+		.window = (w)				\
+	}
+
 typedef struct {
 	/*
 	 * Prime p:
@@ -80,6 +119,26 @@ typedef struct {
 	/* OID and pretty name */
 	const ec_str_param *oid;
 	const ec_str_param *name;
+
+	/*
+	 * Optional addition chains (NULL when not provided):
+	 *  o p_inv_chain: exponent p - 2 (inversion in Fp)
+	 *  o p_sqrt_chain: exponent (p + 1) / 4 (square root, p = 3 mod 4)
+	 *  o q_inv_chain: exponent q - 2 (inversion modulo the order)
+	 */
+	const ec_chain_param *p_inv_chain;
+	const ec_chain_param *p_sqrt_chain;
+	const ec_chain_param *q_inv_chain;
+
+	/*
+	 * Optional generator table (NULL when not provided):
+	 *  o gen_wnaf_table: odd multiples G, 3G, ..., (2^(w - 1) - 1)G
+	 *    for the wNAF of window w of the scalar multiplying G
+	 *  o gen_comb_table: the 2^(w - 1) points of the signed comb of G
+	 *    with w teeth (window being w), only used along gen_wnaf_table
+	 */
+	const ec_gen_table_param *gen_wnaf_table;
+	const ec_gen_table_param *gen_comb_table;
 } ec_str_params;
 
 #endif /* __EC_PARAMS_EXTERNAL_H__ */
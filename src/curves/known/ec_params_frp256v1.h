@@ -159,6 +159,1319 @@ TO_EC_STR_PARAM(frp256v1_oid);
 static const u8 frp256v1_name[] = "FRP256V1";
 TO_EC_STR_PARAM(frp256v1_name);
 
+/* x^(p - 2): 253 squarings and 57 multiplications */
+static const u8 frp256v1_p_inv[] = {
+	0x10, 0x01, 0xff,
+	0x20, 0x00, 0x01,
+	0x32, 0x00, 0x01,
+	0x43, 0x00, 0x01,
+	0x54, 0x00, 0x01,
+	0x65, 0x00, 0x01,
+	0x76, 0x00, 0x01,
+	0x87, 0x00, 0x01,
+	0x98, 0x07, 0x08,
+	0x99, 0x03, 0x04,
+	0x99, 0x02, 0x00,
+	0x99, 0x07, 0x06,
+	0x99, 0x02, 0x02,
+	0x99, 0x05, 0x02,
+	0x99, 0x0a, 0x06,
+	0x99, 0x05, 0x04,
+	0x99, 0x05, 0x06,
+	0x99, 0x04, 0x03,
+	0x99, 0x03, 0x02,
+	0x99, 0x07, 0x08,
+	0x99, 0x04, 0x00,
+	0x99, 0x0b, 0x05,
+	0x99, 0x06, 0x07,
+	0x99, 0x04, 0x06,
+	0x99, 0x04, 0x07,
+	0x99, 0x05, 0x02,
+	0x99, 0x05, 0x04,
+	0x99, 0x03, 0x00,
+	0x99, 0x08, 0x05,
+	0x99, 0x08, 0x07,
+	0x99, 0x05, 0x07,
+	0x99, 0x04, 0x05,
+	0x99, 0x02, 0x02,
+	0x99, 0x06, 0x06,
+	0x99, 0x08, 0x07,
+	0x99, 0x05, 0x07,
+	0x99, 0x04, 0x06,
+	0x99, 0x02, 0x02,
+	0x99, 0x05, 0x03,
+	0x99, 0x05, 0x06,
+	0x99, 0x02, 0x02,
+	0x99, 0x03, 0x00,
+	0x99, 0x05, 0x02,
+	0x99, 0x05, 0x03,
+	0x99, 0x06, 0x07,
+	0x99, 0x04, 0x06,
+	0x99, 0x04, 0x07,
+	0x99, 0x07, 0x08,
+	0x99, 0x02, 0x02,
+	0x99, 0x06, 0x08,
+	0x99, 0x06, 0x07,
+	0x99, 0x05, 0x05,
+	0x99, 0x03, 0x04,
+	0x99, 0x03, 0x02,
+	0x99, 0x08, 0x07,
+	0x99, 0x04, 0x07,
+	0x99, 0x05, 0x04,
+	0x99, 0x0a, 0x00,
+};
+TO_EC_CHAIN_PARAM(frp256v1_p_inv);
+
+/* x^((p + 1) / 4): 251 squarings and 57 multiplications */
+static const u8 frp256v1_p_sqrt[] = {
+	0x10, 0x01, 0xff,
+	0x20, 0x00, 0x01,
+	0x32, 0x00, 0x01,
+	0x43, 0x00, 0x01,
+	0x54, 0x00, 0x01,
+	0x65, 0x00, 0x01,
+	0x76, 0x00, 0x01,
+	0x87, 0x00, 0x01,
+	0x98, 0x07, 0x08,
+	0x99, 0x03, 0x04,
+	0x99, 0x02, 0x00,
+	0x99, 0x07, 0x06,
+	0x99, 0x02, 0x02,
+	0x99, 0x05, 0x02,
+	0x99, 0x0a, 0x06,
+	0x99, 0x05, 0x04,
+	0x99, 0x05, 0x06,
+	0x99, 0x04, 0x03,
+	0x99, 0x03, 0x02,
+	0x99, 0x07, 0x08,
+	0x99, 0x04, 0x00,
+	0x99, 0x0b, 0x05,
+	0x99, 0x06, 0x07,
+	0x99, 0x04, 0x06,
+	0x99, 0x04, 0x07,
+	0x99, 0x05, 0x02,
+	0x99, 0x05, 0x04,
+	0x99, 0x03, 0x00,
+	0x99, 0x08, 0x05,
+	0x99, 0x08, 0x07,
+	0x99, 0x05, 0x07,
+	0x99, 0x04, 0x05,
+	0x99, 0x02, 0x02,
+	0x99, 0x06, 0x06,
+	0x99, 0x08, 0x07,
+	0x99, 0x05, 0x07,
+	0x99, 0x04, 0x06,
+	0x99, 0x02, 0x02,
+	0x99, 0x05, 0x03,
+	0x99, 0x05, 0x06,
+	0x99, 0x02, 0x02,
+	0x99, 0x03, 0x00,
+	0x99, 0x05, 0x02,
+	0x99, 0x05, 0x03,
+	0x99, 0x06, 0x07,
+	0x99, 0x04, 0x06,
+	0x99, 0x04, 0x07,
+	0x99, 0x07, 0x08,
+	0x99, 0x02, 0x02,
+	0x99, 0x06, 0x08,
+	0x99, 0x06, 0x07,
+	0x99, 0x05, 0x05,
+	0x99, 0x03, 0x04,
+	0x99, 0x03, 0x02,
+	0x99, 0x08, 0x07,
+	0x99, 0x04, 0x07,
+	0x99, 0x05, 0x04,
+	0x99, 0x08, 0x00,
+};
+TO_EC_CHAIN_PARAM(frp256v1_p_sqrt);
+
+/* x^(q - 2): 253 squarings and 57 multiplications */
+static const u8 frp256v1_q_inv[] = {
+	0x10, 0x01, 0xff,
+	0x20, 0x00, 0x01,
+	0x32, 0x00, 0x01,
+	0x43, 0x00, 0x01,
+	0x54, 0x00, 0x01,
+	0x65, 0x00, 0x01,
+	0x76, 0x00, 0x01,
+	0x87, 0x00, 0x01,
+	0x98, 0x07, 0x08,
+	0x99, 0x03, 0x04,
+	0x99, 0x02, 0x00,
+	0x99, 0x07, 0x06,
+	0x99, 0x02, 0x02,
+	0x99, 0x05, 0x02,
+	0x99, 0x0a, 0x06,
+	0x99, 0x05, 0x04,
+	0x99, 0x05, 0x06,
+	0x99, 0x04, 0x03,
+	0x99, 0x03, 0x02,
+	0x99, 0x07, 0x08,
+	0x99, 0x04, 0x00,
+	0x99, 0x0b, 0x05,
+	0x99, 0x06, 0x07,
+	0x99, 0x04, 0x06,
+	0x99, 0x04, 0x07,
+	0x99, 0x05, 0x02,
+	0x99, 0x05, 0x04,
+	0x99, 0x03, 0x00,
+	0x99, 0x08, 0x05,
+	0x99, 0x08, 0x07,
+	0x99, 0x05, 0x07,
+	0x99, 0x03, 0x03,
+	0x99, 0x05, 0x05,
+	0x99, 0x03, 0x04,
+	0x99, 0x04, 0x04,
+	0x99, 0x05, 0x02,
+	0x99, 0x06, 0x08,
+	0x99, 0x02, 0x02,
+	0x99, 0x07, 0x03,
+	0x99, 0x0a, 0x07,
+	0x99, 0x05, 0x03,
+	0x99, 0x05, 0x08,
+	0x99, 0x03, 0x04,
+	0x99, 0x05, 0x03,
+	0x99, 0x09, 0x08,
+	0x99, 0x04, 0x08,
+	0x99, 0x03, 0x04,
+	0x99, 0x04, 0x04,
+	0x99, 0x04, 0x03,
+	0x99, 0x07, 0x06,
+	0x99, 0x05, 0x04,
+	0x99, 0x07, 0x07,
+	0x99, 0x03, 0x03,
+	0x99, 0x03, 0x02,
+	0x99, 0x05, 0x03,
+	0x99, 0x05, 0x06,
+	0x99, 0x04, 0x06,
+	0x99, 0x03, 0x04,
+};
+TO_EC_CHAIN_PARAM(frp256v1_q_inv);
+
+/*
+ * Odd multiples G, 3G, ..., 63G of the generator for the wNAF
+ * multiplications (window 7), affine x and y in Montgomery representation
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+static const word_t frp256v1_gen_wnaf[] = {
+	/* G */
+	WORD(0x439f9765bc60dadf), WORD(0xaa9c2e9515127d45),
+	WORD(0xca4d4c55492a4c99), WORD(0x9c0a06c3b87a3296),
+	WORD(0xf632a0a386ba31e8), WORD(0x742efd111abdd91b),
+	WORD(0x8748d1df4d6d6e05), WORD(0x5862d17c999a5d68),
+	/* 3G */
+	WORD(0x2404a464848a7d8d), WORD(0xf0a7f6771d01eedb),
+	WORD(0x4a515c7b40c13e07), WORD(0x5cc1733a17db4f85),
+	WORD(0x8c1ef527c8e58c85), WORD(0xbc9e6f349bb3752c),
+	WORD(0x0953915f40a9a80b), WORD(0x8a37991e2bf12731),
+	/* 5G */
+	WORD(0xcfc59a531aeecbb4), WORD(0x3d65c52ac0143be4),
+	WORD(0x3c65b5865bfcbe8a), WORD(0x7181f350ffbd7477),
+	WORD(0xc303afa548fc3509), WORD(0xc57deb25769a3c36),
+	WORD(0x25d2bb27e5485073), WORD(0x7eac9e795a75dfb2),
+	/* 7G */
+	WORD(0x7bd3c9cecd458227), WORD(0xef0c52df5fc9758a),
+	WORD(0x55a79fb09bdcddd3), WORD(0xac9b72295a8007aa),
+	WORD(0x95db519d43666756), WORD(0xebe13512b4fdde9c),
+	WORD(0x487957ae9f0e389e), WORD(0x9660a77c30146984),
+	/* 9G */
+	WORD(0x2d1d64357b471086), WORD(0xe3155dd0ee4ce47e),
+	WORD(0xd5155e6a301a452a), WORD(0x6610ebbd621ffe94),
+	WORD(0xc170a399fef7f47d), WORD(0xb68ee2cbb2825ec4),
+	WORD(0xcdd4f251b6ce64b2), WORD(0xe5f5e141492f5aac),
+	/* 11G */
+	WORD(0x73c406c9be890c58), WORD(0x7321d8c357fa4e71),
+	WORD(0xf47d927733f260f2), WORD(0xe9e7fe5e6cbba42c),
+	WORD(0x4e651eef2d547328), WORD(0xc666a22f0c125f9c),
+	WORD(0x1aed886c132c2484), WORD(0x1454dd9aec3c31f7),
+	/* 13G */
+	WORD(0xf4c8c47e104953d7), WORD(0xa123a03fea40cd30),
+	WORD(0x755a245e0f559939), WORD(0x290c099e358e26ab),
+	WORD(0xb95464bf5e226aed), WORD(0x94d724126702c6f2),
+	WORD(0x663725e14f83a044), WORD(0x974b7b3e3bac536c),
+	/* 15G */
+	WORD(0xddab81d3e6168805), WORD(0x0b159c591079baed),
+	WORD(0x87d7710a5ff671cc), WORD(0xbb86f3c42a2b2921),
+	WORD(0xb101db4e1831e26d), WORD(0x0df0ff6476cc4fd6),
+	WORD(0xc775bcc3110a8aae), WORD(0x111245e7d0946b26),
+	/* 17G */
+	WORD(0x35f79a1bf478f246), WORD(0x70ac5d2b14bcce3b),
+	WORD(0x9ec8999e6ec56867), WORD(0x89ca5780517297e3),
+	WORD(0x10b85bb26d3fe2f0), WORD(0x3a19c246a1ad5d20),
+	WORD(0xeb07cb3f5ae8a73b), WORD(0xc53d9174134acba6),
+	/* 19G */
+	WORD(0x192337bc3870ab89), WORD(0xc55ee2fbe30ef8a2),
+	WORD(0x92b7325f1bd09b80), WORD(0x0e91735cf05cced8),
+	WORD(0xa80bae35953349d6), WORD(0xf2ca79c01719c621),
+	WORD(0x98b4127f0430ee94), WORD(0x48252eeb9d542fb6),
+	/* 21G */
+	WORD(0x4aa99502e731531b), WORD(0x70ee643a7699f687),
+	WORD(0x6aedba5d74dd584a), WORD(0x3ec1eab71b4942b4),
+	WORD(0xa34e24cff0c093e4), WORD(0xe001232811fe7c22),
+	WORD(0xea140fbfc0c6fc1d), WORD(0x2eb984561e914ac2),
+	/* 23G */
+	WORD(0x169bb67d210d9dca), WORD(0x9c1ec78ef54b86e4),
+	WORD(0xf52dbd1f94e5ed77), WORD(0x2db6e34bfa1b8b5d),
+	WORD(0x668f4155d09c820c), WORD(0x45eac0783caffeb5),
+	WORD(0x6c0b53b642d1cad7), WORD(0x0b882fb64f43cb54),
+	/* 25G */
+	WORD(0xc938c269d09bc343), WORD(0x050a2a9702e9a501),
+	WORD(0x7d8dbfcfa7730e92), WORD(0x89d5ecc3ce5ff4d0),
+	WORD(0xd48b173641fa1571), WORD(0x3ec4c2bee950d16e),
+	WORD(0x5cc880c85b2a5ffa), WORD(0x3120aa5d37dd9e3d),
+	/* 27G */
+	WORD(0xf4b839c7c336cb34), WORD(0x9bc788c0562f8ca6),
+	WORD(0x304f4d0af58622be), WORD(0xab87f6f51fe9ffd8),
+	WORD(0x49ac034eafef17e6), WORD(0xc56fb9b5aa0cdf67),
+	WORD(0x066240d309a2def9), WORD(0x6b7afa7e7b3e0da5),
+	/* 29G */
+	WORD(0x74034e0aed1e9ecf), WORD(0xa68e7ad82753f128),
+	WORD(0xbd8e882602d51cac), WORD(0x1ba9b552595e7a51),
+	WORD(0x09540b72d8800879), WORD(0x7491f3bbf2d00c0b),
+	WORD(0x57279e3c6af273fa), WORD(0x49bb7e327d60317e),
+	/* 31G */
+	WORD(0xb9f7f05a12174233), WORD(0xe59554fa07f4962a),
+	WORD(0xdf52641ecf99baa9), WORD(0xc4a209de44c699db),
+	WORD(0x2f4d398e3d9d6f73), WORD(0x3eb56f366dd268e5),
+	WORD(0xfdbec447eed22577), WORD(0xa7ce492cd8c7446f),
+	/* 33G */
+	WORD(0x7e77a3bf6241981d), WORD(0x358a31a381c8dc54),
+	WORD(0xfec9e127611807e8), WORD(0xa80a8c7d87b7ef00),
+	WORD(0xb146059287512b86), WORD(0x645346edd3966a2d),
+	WORD(0x9ebffd6083b768c4), WORD(0x8a5f8bdc9f36138b),
+	/* 35G */
+	WORD(0x2abcf78597335794), WORD(0xdd7f5621dcdbad54),
+	WORD(0x35cf8d224a0075b2), WORD(0x62fc06b63fcfc404),
+	WORD(0x0246bed2257a9cac), WORD(0x874b1d568604df59),
+	WORD(0x6fd3ed3fb387666c), WORD(0xba1fa40a4639bd8b),
+	/* 37G */
+	WORD(0x369f94a1143eb4bd), WORD(0x301d8558e14a8e48),
+	WORD(0xb20012aaa6c240f3), WORD(0x8e0b334a6c4a455c),
+	WORD(0x324357848881e9db), WORD(0x9bc25c55dd285031),
+	WORD(0xbb977a2380816d71), WORD(0xb3c3611e30628435),
+	/* 39G */
+	WORD(0x9d10b07d0bca249f), WORD(0x328706f8f950c87a),
+	WORD(0x9fddda95956e0400), WORD(0x3ee14b599f36ce5c),
+	WORD(0x3b31757448933cef), WORD(0xf55815259a9f1f4d),
+	WORD(0x8b776113cfdfdbb0), WORD(0x693399b4981ce889),
+	/* 41G */
+	WORD(0xe7f2310d39b9a976), WORD(0x20b3d90dca382c1a),
+	WORD(0x80aa490dc945a94c), WORD(0x461461b10b641048),
+	WORD(0xf14348430c8ed7e4), WORD(0x6dfa05705e6fefe3),
+	WORD(0x1b029fafedc6f286), WORD(0x388e2dff337a4676),
+	/* 43G */
+	WORD(0xbfa4005e7ce1741e), WORD(0xc0cf161b5abfa3a5),
+	WORD(0x8982971bb165236a), WORD(0x2f3a740710cf5a1b),
+	WORD(0xd4b25461e1944542), WORD(0xdf3a48c5c3943f89),
+	WORD(0xc1491a7d1f2c4eff), WORD(0xe96bdda541c1e34a),
+	/* 45G */
+	WORD(0xc5eb24280892ad71), WORD(0x9da0244a7f8af212),
+	WORD(0x5e20d0198eb92a8a), WORD(0x96242093c1cf8d09),
+	WORD(0x6a68d2fbac00b954), WORD(0xcc41c89a95ebce3b),
+	WORD(0xd3cf23d729a2bada), WORD(0xaa7abe742e0d56e3),
+	/* 47G */
+	WORD(0x4c3e3ec02313c6c7), WORD(0xee4a6c707c9528e6),
+	WORD(0xa40d1ea799b182eb), WORD(0x5ea0f0a4cbcafb11),
+	WORD(0xc8a8572429c5ed7f), WORD(0xa9a4c96d938cc689),
+	WORD(0x9ca53cddcd6e8422), WORD(0x9e4287a6918fbc8f),
+	/* 49G */
+	WORD(0xbb2603c4ce5b206a), WORD(0x7ec4b641a723a9c9),
+	WORD(0xfa994e91fa4eaba1), WORD(0x5dbda4663cbe41d5),
+	WORD(0xa3d476ba50aa2e9f), WORD(0xd2c9fcc497372bb6),
+	WORD(0x588c0c70702c0885), WORD(0x01e955236a7c62eb),
+	/* 51G */
+	WORD(0xf57b19e6700f63eb), WORD(0xabf211908ef44cc6),
+	WORD(0xc7ef42d495f6dacb), WORD(0xd538ede8d566181e),
+	WORD(0x972a7d8dc0dac145), WORD(0xafdd81a1470b4b37),
+	WORD(0xe4fdc5f1fb56d799), WORD(0x12cc08b77ef57b5a),
+	/* 53G */
+	WORD(0xce11ca763fc0127e), WORD(0xc6c2f303d2fb031a),
+	WORD(0x2dfcafcad7b1b154), WORD(0x075a9230fe3a7675),
+	WORD(0xd01a8c87c3449338), WORD(0x0ea23bef50f9bd70),
+	WORD(0x1fa6364d7525f584), WORD(0x8b68d84ce0e9367a),
+	/* 55G */
+	WORD(0x870cfaefab8cef50), WORD(0x9ed003f42199127b),
+	WORD(0x674243aef00e24b0), WORD(0x0af8c6bd51d49143),
+	WORD(0x2498737595d21d0d), WORD(0xa077dbce308454f8),
+	WORD(0x9bfc4753688d8589), WORD(0x0ff1f4ac855c8665),
+	/* 57G */
+	WORD(0x3e2994e669cbd286), WORD(0x59c46190603a6dcf),
+	WORD(0xdb7a253165753b33), WORD(0x3f751320bc5c0df6),
+	WORD(0x90cef59ccb25a398), WORD(0x404ef32a1826d5d8),
+	WORD(0xde92b63eefe67066), WORD(0x968ad9bdb11409f6),
+	/* 59G */
+	WORD(0xc7ec87d34b573a36), WORD(0x6aaa74fd9e1caa11),
+	WORD(0xc224e8521331be1d), WORD(0x44436b019d052b38),
+	WORD(0x5838afa751ddf775), WORD(0x64533121ceb8263a),
+	WORD(0xc91e49d1030cdc4c), WORD(0xdb2bd18d782dd525),
+	/* 61G */
+	WORD(0xb5241afca82ec720), WORD(0xafa9536d6c19d443),
+	WORD(0x266bedb483fe2ae9), WORD(0x9e28e959650937ba),
+	WORD(0xdf11c0309abf4da8), WORD(0xbe4477a5354a1beb),
+	WORD(0x7cde7e0a8e09f498), WORD(0x74f6931aa167f4cd),
+	/* 63G */
+	WORD(0xfd12a59cad3bbabd), WORD(0x341f1a75c8aed29c),
+	WORD(0x473e65b008cd3569), WORD(0x9cb79b586b0adf65),
+	WORD(0xda7b1aa2a4acd2a8), WORD(0xce4cffaeaca0b6ef),
+	WORD(0x34f2a9ba156c70b4), WORD(0xb61754f98d4b64cd),
+};
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+static const word_t frp256v1_gen_wnaf[] = {
+	/* G */
+	WORD(0xbc60dadf), WORD(0x439f9765), WORD(0x15127d45), WORD(0xaa9c2e95),
+	WORD(0x492a4c99), WORD(0xca4d4c55), WORD(0xb87a3296), WORD(0x9c0a06c3),
+	WORD(0x86ba31e8), WORD(0xf632a0a3), WORD(0x1abdd91b), WORD(0x742efd11),
+	WORD(0x4d6d6e05), WORD(0x8748d1df), WORD(0x999a5d68), WORD(0x5862d17c),
+	/* 3G */
+	WORD(0x848a7d8d), WORD(0x2404a464), WORD(0x1d01eedb), WORD(0xf0a7f677),
+	WORD(0x40c13e07), WORD(0x4a515c7b), WORD(0x17db4f85), WORD(0x5cc1733a),
+	WORD(0xc8e58c85), WORD(0x8c1ef527), WORD(0x9bb3752c), WORD(0xbc9e6f34),
+	WORD(0x40a9a80b), WORD(0x0953915f), WORD(0x2bf12731), WORD(0x8a37991e),
+	/* 5G */
+	WORD(0x1aeecbb4), WORD(0xcfc59a53), WORD(0xc0143be4), WORD(0x3d65c52a),
+	WORD(0x5bfcbe8a), WORD(0x3c65b586), WORD(0xffbd7477), WORD(0x7181f350),
+	WORD(0x48fc3509), WORD(0xc303afa5), WORD(0x769a3c36), WORD(0xc57deb25),
+	WORD(0xe5485073), WORD(0x25d2bb27), WORD(0x5a75dfb2), WORD(0x7eac9e79),
+	/* 7G */
+	WORD(0xcd458227), WORD(0x7bd3c9ce), WORD(0x5fc9758a), WORD(0xef0c52df),
+	WORD(0x9bdcddd3), WORD(0x55a79fb0), WORD(0x5a8007aa), WORD(0xac9b7229),
+	WORD(0x43666756), WORD(0x95db519d), WORD(0xb4fdde9c), WORD(0xebe13512),
+	WORD(0x9f0e389e), WORD(0x487957ae), WORD(0x30146984), WORD(0x9660a77c),
+	/* 9G */
+	WORD(0x7b471086), WORD(0x2d1d6435), WORD(0xee4ce47e), WORD(0xe3155dd0),
+	WORD(0x301a452a), WORD(0xd5155e6a), WORD(0x621ffe94), WORD(0x6610ebbd),
+	WORD(0xfef7f47d), WORD(0xc170a399), WORD(0xb2825ec4), WORD(0xb68ee2cb),
+	WORD(0xb6ce64b2), WORD(0xcdd4f251), WORD(0x492f5aac), WORD(0xe5f5e141),
+	/* 11G */
+	WORD(0xbe890c58), WORD(0x73c406c9), WORD(0x57fa4e71), WORD(0x7321d8c3),
+	WORD(0x33f260f2), WORD(0xf47d9277), WORD(0x6cbba42c), WORD(0xe9e7fe5e),
+	WORD(0x2d547328), WORD(0x4e651eef), WORD(0x0c125f9c), WORD(0xc666a22f),
+	WORD(0x132c2484), WORD(0x1aed886c), WORD(0xec3c31f7), WORD(0x1454dd9a),
+	/* 13G */
+	WORD(0x104953d7), WORD(0xf4c8c47e), WORD(0xea40cd30), WORD(0xa123a03f),
+	WORD(0x0f559939), WORD(0x755a245e), WORD(0x358e26ab), WORD(0x290c099e),
+	WORD(0x5e226aed), WORD(0xb95464bf), WORD(0x6702c6f2), WORD(0x94d72412),
+	WORD(0x4f83a044), WORD(0x663725e1), WORD(0x3bac536c), WORD(0x974b7b3e),
+	/* 15G */
+	WORD(0xe6168805), WORD(0xddab81d3), WORD(0x1079baed), WORD(0x0b159c59),
+	WORD(0x5ff671cc), WORD(0x87d7710a), WORD(0x2a2b2921), WORD(0xbb86f3c4),
+	WORD(0x1831e26d), WORD(0xb101db4e), WORD(0x76cc4fd6), WORD(0x0df0ff64),
+	WORD(0x110a8aae), WORD(0xc775bcc3), WORD(0xd0946b26), WORD(0x111245e7),
+	/* 17G */
+	WORD(0xf478f246), WORD(0x35f79a1b), WORD(0x14bcce3b), WORD(0x70ac5d2b),
+	WORD(0x6ec56867), WORD(0x9ec8999e), WORD(0x517297e3), WORD(0x89ca5780),
+	WORD(0x6d3fe2f0), WORD(0x10b85bb2), WORD(0xa1ad5d20), WORD(0x3a19c246),
+	WORD(0x5ae8a73b), WORD(0xeb07cb3f), WORD(0x134acba6), WORD(0xc53d9174),
+	/* 19G */
+	WORD(0x3870ab89), WORD(0x192337bc), WORD(0xe30ef8a2), WORD(0xc55ee2fb),
+	WORD(0x1bd09b80), WORD(0x92b7325f), WORD(0xf05cced8), WORD(0x0e91735c),
+	WORD(0x953349d6), WORD(0xa80bae35), WORD(0x1719c621), WORD(0xf2ca79c0),
+	WORD(0x0430ee94), WORD(0x98b4127f), WORD(0x9d542fb6), WORD(0x48252eeb),
+	/* 21G */
+	WORD(0xe731531b), WORD(0x4aa99502), WORD(0x7699f687), WORD(0x70ee643a),
+	WORD(0x74dd584a), WORD(0x6aedba5d), WORD(0x1b4942b4), WORD(0x3ec1eab7),
+	WORD(0xf0c093e4), WORD(0xa34e24cf), WORD(0x11fe7c22), WORD(0xe0012328),
+	WORD(0xc0c6fc1d), WORD(0xea140fbf), WORD(0x1e914ac2), WORD(0x2eb98456),
+	/* 23G */
+	WORD(0x210d9dca), WORD(0x169bb67d), WORD(0xf54b86e4), WORD(0x9c1ec78e),
+	WORD(0x94e5ed77), WORD(0xf52dbd1f), WORD(0xfa1b8b5d), WORD(0x2db6e34b),
+	WORD(0xd09c820c), WORD(0x668f4155), WORD(0x3caffeb5), WORD(0x45eac078),
+	WORD(0x42d1cad7), WORD(0x6c0b53b6), WORD(0x4f43cb54), WORD(0x0b882fb6),
+	/* 25G */
+	WORD(0xd09bc343), WORD(0xc938c269), WORD(0x02e9a501), WORD(0x050a2a97),
+	WORD(0xa7730e92), WORD(0x7d8dbfcf), WORD(0xce5ff4d0), WORD(0x89d5ecc3),
+	WORD(0x41fa1571), WORD(0xd48b1736), WORD(0xe950d16e), WORD(0x3ec4c2be),
+	WORD(0x5b2a5ffa), WORD(0x5cc880c8), WORD(0x37dd9e3d), WORD(0x3120aa5d),
+	/* 27G */
+	WORD(0xc336cb34), WORD(0xf4b839c7), WORD(0x562f8ca6), WORD(0x9bc788c0),
+	WORD(0xf58622be), WORD(0x304f4d0a), WORD(0x1fe9ffd8), WORD(0xab87f6f5),
+	WORD(0xafef17e6), WORD(0x49ac034e), WORD(0xaa0cdf67), WORD(0xc56fb9b5),
+	WORD(0x09a2def9), WORD(0x066240d3), WORD(0x7b3e0da5), WORD(0x6b7afa7e),
+	/* 29G */
+	WORD(0xed1e9ecf), WORD(0x74034e0a), WORD(0x2753f128), WORD(0xa68e7ad8),
+	WORD(0x02d51cac), WORD(0xbd8e8826), WORD(0x595e7a51), WORD(0x1ba9b552),
+	WORD(0xd8800879), WORD(0x09540b72), WORD(0xf2d00c0b), WORD(0x7491f3bb),
+	WORD(0x6af273fa), WORD(0x57279e3c), WORD(0x7d60317e), WORD(0x49bb7e32),
+	/* 31G */
+	WORD(0x12174233), WORD(0xb9f7f05a), WORD(0x07f4962a), WORD(0xe59554fa),
+	WORD(0xcf99baa9), WORD(0xdf52641e), WORD(0x44c699db), WORD(0xc4a209de),
+	WORD(0x3d9d6f73), WORD(0x2f4d398e), WORD(0x6dd268e5), WORD(0x3eb56f36),
+	WORD(0xeed22577), WORD(0xfdbec447), WORD(0xd8c7446f), WORD(0xa7ce492c),
+	/* 33G */
+	WORD(0x6241981d), WORD(0x7e77a3bf), WORD(0x81c8dc54), WORD(0x358a31a3),
+	WORD(0x611807e8), WORD(0xfec9e127), WORD(0x87b7ef00), WORD(0xa80a8c7d),
+	WORD(0x87512b86), WORD(0xb1460592), WORD(0xd3966a2d), WORD(0x645346ed),
+	WORD(0x83b768c4), WORD(0x9ebffd60), WORD(0x9f36138b), WORD(0x8a5f8bdc),
+	/* 35G */
+	WORD(0x97335794), WORD(0x2abcf785), WORD(0xdcdbad54), WORD(0xdd7f5621),
+	WORD(0x4a0075b2), WORD(0x35cf8d22), WORD(0x3fcfc404), WORD(0x62fc06b6),
+	WORD(0x257a9cac), WORD(0x0246bed2), WORD(0x8604df59), WORD(0x874b1d56),
+	WORD(0xb387666c), WORD(0x6fd3ed3f), WORD(0x4639bd8b), WORD(0xba1fa40a),
+	/* 37G */
+	WORD(0x143eb4bd), WORD(0x369f94a1), WORD(0xe14a8e48), WORD(0x301d8558),
+	WORD(0xa6c240f3), WORD(0xb20012aa), WORD(0x6c4a455c), WORD(0x8e0b334a),
+	WORD(0x8881e9db), WORD(0x32435784), WORD(0xdd285031), WORD(0x9bc25c55),
+	WORD(0x80816d71), WORD(0xbb977a23), WORD(0x30628435), WORD(0xb3c3611e),
+	/* 39G */
+	WORD(0x0bca249f), WORD(0x9d10b07d), WORD(0xf950c87a), WORD(0x328706f8),
+	WORD(0x956e0400), WORD(0x9fddda95), WORD(0x9f36ce5c), WORD(0x3ee14b59),
+	WORD(0x48933cef), WORD(0x3b317574), WORD(0x9a9f1f4d), WORD(0xf5581525),
+	WORD(0xcfdfdbb0), WORD(0x8b776113), WORD(0x981ce889), WORD(0x693399b4),
+	/* 41G */
+	WORD(0x39b9a976), WORD(0xe7f2310d), WORD(0xca382c1a), WORD(0x20b3d90d),
+	WORD(0xc945a94c), WORD(0x80aa490d), WORD(0x0b641048), WORD(0x461461b1),
+	WORD(0x0c8ed7e4), WORD(0xf1434843), WORD(0x5e6fefe3), WORD(0x6dfa0570),
+	WORD(0xedc6f286), WORD(0x1b029faf), WORD(0x337a4676), WORD(0x388e2dff),
+	/* 43G */
+	WORD(0x7ce1741e), WORD(0xbfa4005e), WORD(0x5abfa3a5), WORD(0xc0cf161b),
+	WORD(0xb165236a), WORD(0x8982971b), WORD(0x10cf5a1b), WORD(0x2f3a7407),
+	WORD(0xe1944542), WORD(0xd4b25461), WORD(0xc3943f89), WORD(0xdf3a48c5),
+	WORD(0x1f2c4eff), WORD(0xc1491a7d), WORD(0x41c1e34a), WORD(0xe96bdda5),
+	/* 45G */
+	WORD(0x0892ad71), WORD(0xc5eb2428), WORD(0x7f8af212), WORD(0x9da0244a),
+	WORD(0x8eb92a8a), WORD(0x5e20d019), WORD(0xc1cf8d09), WORD(0x96242093),
+	WORD(0xac00b954), WORD(0x6a68d2fb), WORD(0x95ebce3b), WORD(0xcc41c89a),
+	WORD(0x29a2bada), WORD(0xd3cf23d7), WORD(0x2e0d56e3), WORD(0xaa7abe74),
+	/* 47G */
+	WORD(0x2313c6c7), WORD(0x4c3e3ec0), WORD(0x7c9528e6), WORD(0xee4a6c70),
+	WORD(0x99b182eb), WORD(0xa40d1ea7), WORD(0xcbcafb11), WORD(0x5ea0f0a4),
+	WORD(0x29c5ed7f), WORD(0xc8a85724), WORD(0x938cc689), WORD(0xa9a4c96d),
+	WORD(0xcd6e8422), WORD(0x9ca53cdd), WORD(0x918fbc8f), WORD(0x9e4287a6),
+	/* 49G */
+	WORD(0xce5b206a), WORD(0xbb2603c4), WORD(0xa723a9c9), WORD(0x7ec4b641),
+	WORD(0xfa4eaba1), WORD(0xfa994e91), WORD(0x3cbe41d5), WORD(0x5dbda466),
+	WORD(0x50aa2e9f), WORD(0xa3d476ba), WORD(0x97372bb6), WORD(0xd2c9fcc4),
+	WORD(0x702c0885), WORD(0x588c0c70), WORD(0x6a7c62eb), WORD(0x01e95523),
+	/* 51G */
+	WORD(0x700f63eb), WORD(0xf57b19e6), WORD(0x8ef44cc6), WORD(0xabf21190),
+	WORD(0x95f6dacb), WORD(0xc7ef42d4), WORD(0xd566181e), WORD(0xd538ede8),
+	WORD(0xc0dac145), WORD(0x972a7d8d), WORD(0x470b4b37), WORD(0xafdd81a1),
+	WORD(0xfb56d799), WORD(0xe4fdc5f1), WORD(0x7ef57b5a), WORD(0x12cc08b7),
+	/* 53G */
+	WORD(0x3fc0127e), WORD(0xce11ca76), WORD(0xd2fb031a), WORD(0xc6c2f303),
+	WORD(0xd7b1b154), WORD(0x2dfcafca), WORD(0xfe3a7675), WORD(0x075a9230),
+	WORD(0xc3449338), WORD(0xd01a8c87), WORD(0x50f9bd70), WORD(0x0ea23bef),
+	WORD(0x7525f584), WORD(0x1fa6364d), WORD(0xe0e9367a), WORD(0x8b68d84c),
+	/* 55G */
+	WORD(0xab8cef50), WORD(0x870cfaef), WORD(0x2199127b), WORD(0x9ed003f4),
+	WORD(0xf00e24b0), WORD(0x674243ae), WORD(0x51d49143), WORD(0x0af8c6bd),
+	WORD(0x95d21d0d), WORD(0x24987375), WORD(0x308454f8), WORD(0xa077dbce),
+	WORD(0x688d8589), WORD(0x9bfc4753), WORD(0x855c8665), WORD(0x0ff1f4ac),
+	/* 57G */
+	WORD(0x69cbd286), WORD(0x3e2994e6), WORD(0x603a6dcf), WORD(0x59c46190),
+	WORD(0x65753b33), WORD(0xdb7a2531), WORD(0xbc5c0df6), WORD(0x3f751320),
+	WORD(0xcb25a398), WORD(0x90cef59c), WORD(0x1826d5d8), WORD(0x404ef32a),
+	WORD(0xefe67066), WORD(0xde92b63e), WORD(0xb11409f6), WORD(0x968ad9bd),
+	/* 59G */
+	WORD(0x4b573a36), WORD(0xc7ec87d3), WORD(0x9e1caa11), WORD(0x6aaa74fd),
+	WORD(0x1331be1d), WORD(0xc224e852), WORD(0x9d052b38), WORD(0x44436b01),
+	WORD(0x51ddf775), WORD(0x5838afa7), WORD(0xceb8263a), WORD(0x64533121),
+	WORD(0x030cdc4c), WORD(0xc91e49d1), WORD(0x782dd525), WORD(0xdb2bd18d),
+	/* 61G */
+	WORD(0xa82ec720), WORD(0xb5241afc), WORD(0x6c19d443), WORD(0xafa9536d),
+	WORD(0x83fe2ae9), WORD(0x266bedb4), WORD(0x650937ba), WORD(0x9e28e959),
+	WORD(0x9abf4da8), WORD(0xdf11c030), WORD(0x354a1beb), WORD(0xbe4477a5),
+	WORD(0x8e09f498), WORD(0x7cde7e0a), WORD(0xa167f4cd), WORD(0x74f6931a),
+	/* 63G */
+	WORD(0xad3bbabd), WORD(0xfd12a59c), WORD(0xc8aed29c), WORD(0x341f1a75),
+	WORD(0x08cd3569), WORD(0x473e65b0), WORD(0x6b0adf65), WORD(0x9cb79b58),
+	WORD(0xa4acd2a8), WORD(0xda7b1aa2), WORD(0xaca0b6ef), WORD(0xce4cffae),
+	WORD(0x156c70b4), WORD(0x34f2a9ba), WORD(0x8d4b64cd), WORD(0xb61754f9),
+};
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+static const word_t frp256v1_gen_wnaf[] = {
+	/* G */
+	WORD(0xdadf), WORD(0xbc60), WORD(0x9765), WORD(0x439f), WORD(0x7d45), WORD(0x1512),
+	WORD(0x2e95), WORD(0xaa9c), WORD(0x4c99), WORD(0x492a), WORD(0x4c55), WORD(0xca4d),
+	WORD(0x3296), WORD(0xb87a), WORD(0x06c3), WORD(0x9c0a), WORD(0x31e8), WORD(0x86ba),
+	WORD(0xa0a3), WORD(0xf632), WORD(0xd91b), WORD(0x1abd), WORD(0xfd11), WORD(0x742e),
+	WORD(0x6e05), WORD(0x4d6d), WORD(0xd1df), WORD(0x8748), WORD(0x5d68), WORD(0x999a),
+	WORD(0xd17c), WORD(0x5862),
+	/* 3G */
+	WORD(0x7d8d), WORD(0x848a), WORD(0xa464), WORD(0x2404), WORD(0xeedb), WORD(0x1d01),
+	WORD(0xf677), WORD(0xf0a7), WORD(0x3e07), WORD(0x40c1), WORD(0x5c7b), WORD(0x4a51),
+	WORD(0x4f85), WORD(0x17db), WORD(0x733a), WORD(0x5cc1), WORD(0x8c85), WORD(0xc8e5),
+	WORD(0xf527), WORD(0x8c1e), WORD(0x752c), WORD(0x9bb3), WORD(0x6f34), WORD(0xbc9e),
+	WORD(0xa80b), WORD(0x40a9), WORD(0x915f), WORD(0x0953), WORD(0x2731), WORD(0x2bf1),
+	WORD(0x991e), WORD(0x8a37),
+	/* 5G */
+	WORD(0xcbb4), WORD(0x1aee), WORD(0x9a53), WORD(0xcfc5), WORD(0x3be4), WORD(0xc014),
+	WORD(0xc52a), WORD(0x3d65), WORD(0xbe8a), WORD(0x5bfc), WORD(0xb586), WORD(0x3c65),
+	WORD(0x7477), WORD(0xffbd), WORD(0xf350), WORD(0x7181), WORD(0x3509), WORD(0x48fc),
+	WORD(0xafa5), WORD(0xc303), WORD(0x3c36), WORD(0x769a), WORD(0xeb25), WORD(0xc57d),
+	WORD(0x5073), WORD(0xe548), WORD(0xbb27), WORD(0x25d2), WORD(0xdfb2), WORD(0x5a75),
+	WORD(0x9e79), WORD(0x7eac),
+	/* 7G */
+	WORD(0x8227), WORD(0xcd45), WORD(0xc9ce), WORD(0x7bd3), WORD(0x758a), WORD(0x5fc9),
+	WORD(0x52df), WORD(0xef0c), WORD(0xddd3), WORD(0x9bdc), WORD(0x9fb0), WORD(0x55a7),
+	WORD(0x07aa), WORD(0x5a80), WORD(0x7229), WORD(0xac9b), WORD(0x6756), WORD(0x4366),
+	WORD(0x519d), WORD(0x95db), WORD(0xde9c), WORD(0xb4fd), WORD(0x3512), WORD(0xebe1),
+	WORD(0x389e), WORD(0x9f0e), WORD(0x57ae), WORD(0x4879), WORD(0x6984), WORD(0x3014),
+	WORD(0xa77c), WORD(0x9660),
+	/* 9G */
+	WORD(0x1086), WORD(0x7b47), WORD(0x6435), WORD(0x2d1d), WORD(0xe47e), WORD(0xee4c),
+	WORD(0x5dd0), WORD(0xe315), WORD(0x452a), WORD(0x301a), WORD(0x5e6a), WORD(0xd515),
+	WORD(0xfe94), WORD(0x621f), WORD(0xebbd), WORD(0x6610), WORD(0xf47d), WORD(0xfef7),
+	WORD(0xa399), WORD(0xc170), WORD(0x5ec4), WORD(0xb282), WORD(0xe2cb), WORD(0xb68e),
+	WORD(0x64b2), WORD(0xb6ce), WORD(0xf251), WORD(0xcdd4), WORD(0x5aac), WORD(0x492f),
+	WORD(0xe141), WORD(0xe5f5),
+	/* 11G */
+	WORD(0x0c58), WORD(0xbe89), WORD(0x06c9), WORD(0x73c4), WORD(0x4e71), WORD(0x57fa),
+	WORD(0xd8c3), WORD(0x7321), WORD(0x60f2), WORD(0x33f2), WORD(0x9277), WORD(0xf47d),
+	WORD(0xa42c), WORD(0x6cbb), WORD(0xfe5e), WORD(0xe9e7), WORD(0x7328), WORD(0x2d54),
+	WORD(0x1eef), WORD(0x4e65), WORD(0x5f9c), WORD(0x0c12), WORD(0xa22f), WORD(0xc666),
+	WORD(0x2484), WORD(0x132c), WORD(0x886c), WORD(0x1aed), WORD(0x31f7), WORD(0xec3c),
+	WORD(0xdd9a), WORD(0x1454),
+	/* 13G */
+	WORD(0x53d7), WORD(0x1049), WORD(0xc47e), WORD(0xf4c8), WORD(0xcd30), WORD(0xea40),
+	WORD(0xa03f), WORD(0xa123), WORD(0x9939), WORD(0x0f55), WORD(0x245e), WORD(0x755a),
+	WORD(0x26ab), WORD(0x358e), WORD(0x099e), WORD(0x290c), WORD(0x6aed), WORD(0x5e22),
+	WORD(0x64bf), WORD(0xb954), WORD(0xc6f2), WORD(0x6702), WORD(0x2412), WORD(0x94d7),
+	WORD(0xa044), WORD(0x4f83), WORD(0x25e1), WORD(0x6637), WORD(0x536c), WORD(0x3bac),
+	WORD(0x7b3e), WORD(0x974b),
+	/* 15G */
+	WORD(0x8805), WORD(0xe616), WORD(0x81d3), WORD(0xddab), WORD(0xbaed), WORD(0x1079),
+	WORD(0x9c59), WORD(0x0b15), WORD(0x71cc), WORD(0x5ff6), WORD(0x710a), WORD(0x87d7),
+	WORD(0x2921), WORD(0x2a2b), WORD(0xf3c4), WORD(0xbb86), WORD(0xe26d), WORD(0x1831),
+	WORD(0xdb4e), WORD(0xb101), WORD(0x4fd6), WORD(0x76cc), WORD(0xff64), WORD(0x0df0),
+	WORD(0x8aae), WORD(0x110a), WORD(0xbcc3), WORD(0xc775), WORD(0x6b26), WORD(0xd094),
+	WORD(0x45e7), WORD(0x1112),
+	/* 17G */
+	WORD(0xf246), WORD(0xf478), WORD(0x9a1b), WORD(0x35f7), WORD(0xce3b), WORD(0x14bc),
+	WORD(0x5d2b), WORD(0x70ac), WORD(0x6867), WORD(0x6ec5), WORD(0x999e), WORD(0x9ec8),
+	WORD(0x97e3), WORD(0x5172), WORD(0x5780), WORD(0x89ca), WORD(0xe2f0), WORD(0x6d3f),
+	WORD(0x5bb2), WORD(0x10b8), WORD(0x5d20), WORD(0xa1ad), WORD(0xc246), WORD(0x3a19),
+	WORD(0xa73b), WORD(0x5ae8), WORD(0xcb3f), WORD(0xeb07), WORD(0xcba6), WORD(0x134a),
+	WORD(0x9174), WORD(0xc53d),
+	/* 19G */
+	WORD(0xab89), WORD(0x3870), WORD(0x37bc), WORD(0x1923), WORD(0xf8a2), WORD(0xe30e),
+	WORD(0xe2fb), WORD(0xc55e), WORD(0x9b80), WORD(0x1bd0), WORD(0x325f), WORD(0x92b7),
+	WORD(0xced8), WORD(0xf05c), WORD(0x735c), WORD(0x0e91), WORD(0x49d6), WORD(0x9533),
+	WORD(0xae35), WORD(0xa80b), WORD(0xc621), WORD(0x1719), WORD(0x79c0), WORD(0xf2ca),
+	WORD(0xee94), WORD(0x0430), WORD(0x127f), WORD(0x98b4), WORD(0x2fb6), WORD(0x9d54),
+	WORD(0x2eeb), WORD(0x4825),
+	/* 21G */
+	WORD(0x531b), WORD(0xe731), WORD(0x9502), WORD(0x4aa9), WORD(0xf687), WORD(0x7699),
+	WORD(0x643a), WORD(0x70ee), WORD(0x584a), WORD(0x74dd), WORD(0xba5d), WORD(0x6aed),
+	WORD(0x42b4), WORD(0x1b49), WORD(0xeab7), WORD(0x3ec1), WORD(0x93e4), WORD(0xf0c0),
+	WORD(0x24cf), WORD(0xa34e), WORD(0x7c22), WORD(0x11fe), WORD(0x2328), WORD(0xe001),
+	WORD(0xfc1d), WORD(0xc0c6), WORD(0x0fbf), WORD(0xea14), WORD(0x4ac2), WORD(0x1e91),
+	WORD(0x8456), WORD(0x2eb9),
+	/* 23G */
+	WORD(0x9dca), WORD(0x210d), WORD(0xb67d), WORD(0x169b), WORD(0x86e4), WORD(0xf54b),
+	WORD(0xc78e), WORD(0x9c1e), WORD(0xed77), WORD(0x94e5), WORD(0xbd1f), WORD(0xf52d),
+	WORD(0x8b5d), WORD(0xfa1b), WORD(0xe34b), WORD(0x2db6), WORD(0x820c), WORD(0xd09c),
+	WORD(0x4155), WORD(0x668f), WORD(0xfeb5), WORD(0x3caf), WORD(0xc078), WORD(0x45ea),
+	WORD(0xcad7), WORD(0x42d1), WORD(0x53b6), WORD(0x6c0b), WORD(0xcb54), WORD(0x4f43),
+	WORD(0x2fb6), WORD(0x0b88),
+	/* 25G */
+	WORD(0xc343), WORD(0xd09b), WORD(0xc269), WORD(0xc938), WORD(0xa501), WORD(0x02e9),
+	WORD(0x2a97), WORD(0x050a), WORD(0x0e92), WORD(0xa773), WORD(0xbfcf), WORD(0x7d8d),
+	WORD(0xf4d0), WORD(0xce5f), WORD(0xecc3), WORD(0x89d5), WORD(0x1571), WORD(0x41fa),
+	WORD(0x1736), WORD(0xd48b), WORD(0xd16e), WORD(0xe950), WORD(0xc2be), WORD(0x3ec4),
+	WORD(0x5ffa), WORD(0x5b2a), WORD(0x80c8), WORD(0x5cc8), WORD(0x9e3d), WORD(0x37dd),
+	WORD(0xaa5d), WORD(0x3120),
+	/* 27G */
+	WORD(0xcb34), WORD(0xc336), WORD(0x39c7), WORD(0xf4b8), WORD(0x8ca6), WORD(0x562f),
+	WORD(0x88c0), WORD(0x9bc7), WORD(0x22be), WORD(0xf586), WORD(0x4d0a), WORD(0x304f),
+	WORD(0xffd8), WORD(0x1fe9), WORD(0xf6f5), WORD(0xab87), WORD(0x17e6), WORD(0xafef),
+	WORD(0x034e), WORD(0x49ac), WORD(0xdf67), WORD(0xaa0c), WORD(0xb9b5), WORD(0xc56f),
+	WORD(0xdef9), WORD(0x09a2), WORD(0x40d3), WORD(0x0662), WORD(0x0da5), WORD(0x7b3e),
+	WORD(0xfa7e), WORD(0x6b7a),
+	/* 29G */
+	WORD(0x9ecf), WORD(0xed1e), WORD(0x4e0a), WORD(0x7403), WORD(0xf128), WORD(0x2753),
+	WORD(0x7ad8), WORD(0xa68e), WORD(0x1cac), WORD(0x02d5), WORD(0x8826), WORD(0xbd8e),
+	WORD(0x7a51), WORD(0x595e), WORD(0xb552), WORD(0x1ba9), WORD(0x0879), WORD(0xd880),
+	WORD(0x0b72), WORD(0x0954), WORD(0x0c0b), WORD(0xf2d0), WORD(0xf3bb), WORD(0x7491),
+	WORD(0x73fa), WORD(0x6af2), WORD(0x9e3c), WORD(0x5727), WORD(0x317e), WORD(0x7d60),
+	WORD(0x7e32), WORD(0x49bb),
+	/* 31G */
+	WORD(0x4233), WORD(0x1217), WORD(0xf05a), WORD(0xb9f7), WORD(0x962a), WORD(0x07f4),
+	WORD(0x54fa), WORD(0xe595), WORD(0xbaa9), WORD(0xcf99), WORD(0x641e), WORD(0xdf52),
+	WORD(0x99db), WORD(0x44c6), WORD(0x09de), WORD(0xc4a2), WORD(0x6f73), WORD(0x3d9d),
+	WORD(0x398e), WORD(0x2f4d), WORD(0x68e5), WORD(0x6dd2), WORD(0x6f36), WORD(0x3eb5),
+	WORD(0x2577), WORD(0xeed2), WORD(0xc447), WORD(0xfdbe), WORD(0x446f), WORD(0xd8c7),
+	WORD(0x492c), WORD(0xa7ce),
+	/* 33G */
+	WORD(0x981d), WORD(0x6241), WORD(0xa3bf), WORD(0x7e77), WORD(0xdc54), WORD(0x81c8),
+	WORD(0x31a3), WORD(0x358a), WORD(0x07e8), WORD(0x6118), WORD(0xe127), WORD(0xfec9),
+	WORD(0xef00), WORD(0x87b7), WORD(0x8c7d), WORD(0xa80a), WORD(0x2b86), WORD(0x8751),
+	WORD(0x0592), WORD(0xb146), WORD(0x6a2d), WORD(0xd396), WORD(0x46ed), WORD(0x6453),
+	WORD(0x68c4), WORD(0x83b7), WORD(0xfd60), WORD(0x9ebf), WORD(0x138b), WORD(0x9f36),
+	WORD(0x8bdc), WORD(0x8a5f),
+	/* 35G */
+	WORD(0x5794), WORD(0x9733), WORD(0xf785), WORD(0x2abc), WORD(0xad54), WORD(0xdcdb),
+	WORD(0x5621), WORD(0xdd7f), WORD(0x75b2), WORD(0x4a00), WORD(0x8d22), WORD(0x35cf),
+	WORD(0xc404), WORD(0x3fcf), WORD(0x06b6), WORD(0x62fc), WORD(0x9cac), WORD(0x257a),
+	WORD(0xbed2), WORD(0x0246), WORD(0xdf59), WORD(0x8604), WORD(0x1d56), WORD(0x874b),
+	WORD(0x666c), WORD(0xb387), WORD(0xed3f), WORD(0x6fd3), WORD(0xbd8b), WORD(0x4639),
+	WORD(0xa40a), WORD(0xba1f),
+	/* 37G */
+	WORD(0xb4bd), WORD(0x143e), WORD(0x94a1), WORD(0x369f), WORD(0x8e48), WORD(0xe14a),
+	WORD(0x8558), WORD(0x301d), WORD(0x40f3), WORD(0xa6c2), WORD(0x12aa), WORD(0xb200),
+	WORD(0x455c), WORD(0x6c4a), WORD(0x334a), WORD(0x8e0b), WORD(0xe9db), WORD(0x8881),
+	WORD(0x5784), WORD(0x3243), WORD(0x5031), WORD(0xdd28), WORD(0x5c55), WORD(0x9bc2),
+	WORD(0x6d71), WORD(0x8081), WORD(0x7a23), WORD(0xbb97), WORD(0x8435), WORD(0x3062),
+	WORD(0x611e), WORD(0xb3c3),
+	/* 39G */
+	WORD(0x249f), WORD(0x0bca), WORD(0xb07d), WORD(0x9d10), WORD(0xc87a), WORD(0xf950),
+	WORD(0x06f8), WORD(0x3287), WORD(0x0400), WORD(0x956e), WORD(0xda95), WORD(0x9fdd),
+	WORD(0xce5c), WORD(0x9f36), WORD(0x4b59), WORD(0x3ee1), WORD(0x3cef), WORD(0x4893),
+	WORD(0x7574), WORD(0x3b31), WORD(0x1f4d), WORD(0x9a9f), WORD(0x1525), WORD(0xf558),
+	WORD(0xdbb0), WORD(0xcfdf), WORD(0x6113), WORD(0x8b77), WORD(0xe889), WORD(0x981c),
+	WORD(0x99b4), WORD(0x6933),
+	/* 41G */
+	WORD(0xa976), WORD(0x39b9), WORD(0x310d), WORD(0xe7f2), WORD(0x2c1a), WORD(0xca38),
+	WORD(0xd90d), WORD(0x20b3), WORD(0xa94c), WORD(0xc945), WORD(0x490d), WORD(0x80aa),
+	WORD(0x1048), WORD(0x0b64), WORD(0x61b1), WORD(0x4614), WORD(0xd7e4), WORD(0x0c8e),
+	WORD(0x4843), WORD(0xf143), WORD(0xefe3), WORD(0x5e6f), WORD(0x0570), WORD(0x6dfa),
+	WORD(0xf286), WORD(0xedc6), WORD(0x9faf), WORD(0x1b02), WORD(0x4676), WORD(0x337a),
+	WORD(0x2dff), WORD(0x388e),
+	/* 43G */
+	WORD(0x741e), WORD(0x7ce1), WORD(0x005e), WORD(0xbfa4), WORD(0xa3a5), WORD(0x5abf),
+	WORD(0x161b), WORD(0xc0cf), WORD(0x236a), WORD(0xb165), WORD(0x971b), WORD(0x8982),
+	WORD(0x5a1b), WORD(0x10cf), WORD(0x7407), WORD(0x2f3a), WORD(0x4542), WORD(0xe194),
+	WORD(0x5461), WORD(0xd4b2), WORD(0x3f89), WORD(0xc394), WORD(0x48c5), WORD(0xdf3a),
+	WORD(0x4eff), WORD(0x1f2c), WORD(0x1a7d), WORD(0xc149), WORD(0xe34a), WORD(0x41c1),
+	WORD(0xdda5), WORD(0xe96b),
+	/* 45G */
+	WORD(0xad71), WORD(0x0892), WORD(0x2428), WORD(0xc5eb), WORD(0xf212), WORD(0x7f8a),
+	WORD(0x244a), WORD(0x9da0), WORD(0x2a8a), WORD(0x8eb9), WORD(0xd019), WORD(0x5e20),
+	WORD(0x8d09), WORD(0xc1cf), WORD(0x2093), WORD(0x9624), WORD(0xb954), WORD(0xac00),
+	WORD(0xd2fb), WORD(0x6a68), WORD(0xce3b), WORD(0x95eb), WORD(0xc89a), WORD(0xcc41),
+	WORD(0xbada), WORD(0x29a2), WORD(0x23d7), WORD(0xd3cf), WORD(0x56e3), WORD(0x2e0d),
+	WORD(0xbe74), WORD(0xaa7a),
+	/* 47G */
+	WORD(0xc6c7), WORD(0x2313), WORD(0x3ec0), WORD(0x4c3e), WORD(0x28e6), WORD(0x7c95),
+	WORD(0x6c70), WORD(0xee4a), WORD(0x82eb), WORD(0x99b1), WORD(0x1ea7), WORD(0xa40d),
+	WORD(0xfb11), WORD(0xcbca), WORD(0xf0a4), WORD(0x5ea0), WORD(0xed7f), WORD(0x29c5),
+	WORD(0x5724), WORD(0xc8a8), WORD(0xc689), WORD(0x938c), WORD(0xc96d), WORD(0xa9a4),
+	WORD(0x8422), WORD(0xcd6e), WORD(0x3cdd), WORD(0x9ca5), WORD(0xbc8f), WORD(0x918f),
+	WORD(0x87a6), WORD(0x9e42),
+	/* 49G */
+	WORD(0x206a), WORD(0xce5b), WORD(0x03c4), WORD(0xbb26), WORD(0xa9c9), WORD(0xa723),
+	WORD(0xb641), WORD(0x7ec4), WORD(0xaba1), WORD(0xfa4e), WORD(0x4e91), WORD(0xfa99),
+	WORD(0x41d5), WORD(0x3cbe), WORD(0xa466), WORD(0x5dbd), WORD(0x2e9f), WORD(0x50aa),
+	WORD(0x76ba), WORD(0xa3d4), WORD(0x2bb6), WORD(0x9737), WORD(0xfcc4), WORD(0xd2c9),
+	WORD(0x0885), WORD(0x702c), WORD(0x0c70), WORD(0x588c), WORD(0x62eb), WORD(0x6a7c),
+	WORD(0x5523), WORD(0x01e9),
+	/* 51G */
+	WORD(0x63eb), WORD(0x700f), WORD(0x19e6), WORD(0xf57b), WORD(0x4cc6), WORD(0x8ef4),
+	WORD(0x1190), WORD(0xabf2), WORD(0xdacb), WORD(0x95f6), WORD(0x42d4), WORD(0xc7ef),
+	WORD(0x181e), WORD(0xd566), WORD(0xede8), WORD(0xd538), WORD(0xc145), WORD(0xc0da),
+	WORD(0x7d8d), WORD(0x972a), WORD(0x4b37), WORD(0x470b), WORD(0x81a1), WORD(0xafdd),
+	WORD(0xd799), WORD(0xfb56), WORD(0xc5f1), WORD(0xe4fd), WORD(0x7b5a), WORD(0x7ef5),
+	WORD(0x08b7), WORD(0x12cc),
+	/* 53G */
+	WORD(0x127e), WORD(0x3fc0), WORD(0xca76), WORD(0xce11), WORD(0x031a), WORD(0xd2fb),
+	WORD(0xf303), WORD(0xc6c2), WORD(0xb154), WORD(0xd7b1), WORD(0xafca), WORD(0x2dfc),
+	WORD(0x7675), WORD(0xfe3a), WORD(0x9230), WORD(0x075a), WORD(0x9338), WORD(0xc344),
+	WORD(0x8c87), WORD(0xd01a), WORD(0xbd70), WORD(0x50f9), WORD(0x3bef), WORD(0x0ea2),
+	WORD(0xf584), WORD(0x7525), WORD(0x364d), WORD(0x1fa6), WORD(0x367a), WORD(0xe0e9),
+	WORD(0xd84c), WORD(0x8b68),
+	/* 55G */
+	WORD(0xef50), WORD(0xab8c), WORD(0xfaef), WORD(0x870c), WORD(0x127b), WORD(0x2199),
+	WORD(0x03f4), WORD(0x9ed0), WORD(0x24b0), WORD(0xf00e), WORD(0x43ae), WORD(0x6742),
+	WORD(0x9143), WORD(0x51d4), WORD(0xc6bd), WORD(0x0af8), WORD(0x1d0d), WORD(0x95d2),
+	WORD(0x7375), WORD(0x2498), WORD(0x54f8), WORD(0x3084), WORD(0xdbce), WORD(0xa077),
+	WORD(0x8589), WORD(0x688d), WORD(0x4753), WORD(0x9bfc), WORD(0x8665), WORD(0x855c),
+	WORD(0xf4ac), WORD(0x0ff1),
+	/* 57G */
+	WORD(0xd286), WORD(0x69cb), WORD(0x94e6), WORD(0x3e29), WORD(0x6dcf), WORD(0x603a),
+	WORD(0x6190), WORD(0x59c4), WORD(0x3b33), WORD(0x6575), WORD(0x2531), WORD(0xdb7a),
+	WORD(0x0df6), WORD(0xbc5c), WORD(0x1320), WORD(0x3f75), WORD(0xa398), WORD(0xcb25),
+	WORD(0xf59c), WORD(0x90ce), WORD(0xd5d8), WORD(0x1826), WORD(0xf32a), WORD(0x404e),
+	WORD(0x7066), WORD(0xefe6), WORD(0xb63e), WORD(0xde92), WORD(0x09f6), WORD(0xb114),
+	WORD(0xd9bd), WORD(0x968a),
+	/* 59G */
+	WORD(0x3a36), WORD(0x4b57), WORD(0x87d3), WORD(0xc7ec), WORD(0xaa11), WORD(0x9e1c),
+	WORD(0x74fd), WORD(0x6aaa), WORD(0xbe1d), WORD(0x1331), WORD(0xe852), WORD(0xc224),
+	WORD(0x2b38), WORD(0x9d05), WORD(0x6b01), WORD(0x4443), WORD(0xf775), WORD(0x51dd),
+	WORD(0xafa7), WORD(0x5838), WORD(0x263a), WORD(0xceb8), WORD(0x3121), WORD(0x6453),
+	WORD(0xdc4c), WORD(0x030c), WORD(0x49d1), WORD(0xc91e), WORD(0xd525), WORD(0x782d),
+	WORD(0xd18d), WORD(0xdb2b),
+	/* 61G */
+	WORD(0xc720), WORD(0xa82e), WORD(0x1afc), WORD(0xb524), WORD(0xd443), WORD(0x6c19),
+	WORD(0x536d), WORD(0xafa9), WORD(0x2ae9), WORD(0x83fe), WORD(0xedb4), WORD(0x266b),
+	WORD(0x37ba), WORD(0x6509), WORD(0xe959), WORD(0x9e28), WORD(0x4da8), WORD(0x9abf),
+	WORD(0xc030), WORD(0xdf11), WORD(0x1beb), WORD(0x354a), WORD(0x77a5), WORD(0xbe44),
+	WORD(0xf498), WORD(0x8e09), WORD(0x7e0a), WORD(0x7cde), WORD(0xf4cd), WORD(0xa167),
+	WORD(0x931a), WORD(0x74f6),
+	/* 63G */
+	WORD(0xbabd), WORD(0xad3b), WORD(0xa59c), WORD(0xfd12), WORD(0xd29c), WORD(0xc8ae),
+	WORD(0x1a75), WORD(0x341f), WORD(0x3569), WORD(0x08cd), WORD(0x65b0), WORD(0x473e),
+	WORD(0xdf65), WORD(0x6b0a), WORD(0x9b58), WORD(0x9cb7), WORD(0xd2a8), WORD(0xa4ac),
+	WORD(0x1aa2), WORD(0xda7b), WORD(0xb6ef), WORD(0xaca0), WORD(0xffae), WORD(0xce4c),
+	WORD(0x70b4), WORD(0x156c), WORD(0xa9ba), WORD(0x34f2), WORD(0x64cd), WORD(0x8d4b),
+	WORD(0x54f9), WORD(0xb617),
+};
+#else                     /* unknown word size */
+#error "Unsupported word size"
+#endif
+TO_EC_GEN_TABLE_PARAM(frp256v1_gen_wnaf, 7);
+
+/*
+ * Signed comb of the generator for the fixed base multiplications (6
+ * teeth, spacing 43), affine x and y in Montgomery representation
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+static const word_t frp256v1_gen_comb[] = {
+	/* T[0] */
+	WORD(0xe3680a6ed9b551ae), WORD(0x0014ff67d9084cf6),
+	WORD(0xef9f52fa3ce20409), WORD(0x0f373843bc101468),
+	WORD(0x3ae72e6a74e04eee), WORD(0x9bc9fce0f7431a1b),
+	WORD(0xe17c7b29190e5b0f), WORD(0x1e13c2eda1ceb1a8),
+	/* T[1] */
+	WORD(0xfa9e4e03d4eba04c), WORD(0x73963c80b046f3ab),
+	WORD(0x3694901674ab0fae), WORD(0xddf3349acf1e585f),
+	WORD(0x27dff5d1abdefda5), WORD(0xc9937a1d192d8dee),
+	WORD(0x27ded5310f37b03c), WORD(0x5359244d420fed10),
+	/* T[2] */
+	WORD(0xbf7c76ec0cb59d34), WORD(0x0c08e4e02d03b71c),
+	WORD(0x619715b113d1ad0d), WORD(0x2e3c21aa5c99aef0),
+	WORD(0xb8562a77ccb9a76c), WORD(0xc640d08aea50db28),
+	WORD(0x5c0bb0968343127d), WORD(0x3088b8e055313e61),
+	/* T[3] */
+	WORD(0xf89bca8ce8d9f5c6), WORD(0xded482cc3e3729a1),
+	WORD(0x767145d47180ee38), WORD(0x2d9ed263884e05f4),
+	WORD(0xe7afcdaaf8f6a135), WORD(0xf197a73691a9d3ef),
+	WORD(0xca75fb32901c35d2), WORD(0x1790c75781106e74),
+	/* T[4] */
+	WORD(0x46bee19d1c2d6ff5), WORD(0xd63fed2247781e34),
+	WORD(0xb1ec7981913802d6), WORD(0xdeebb814020f41eb),
+	WORD(0xc9c49ff24e330e64), WORD(0x8d17af5e86687bdb),
+	WORD(0x5c4d7b25b618643d), WORD(0x605dbc28f30834d5),
+	/* T[5] */
+	WORD(0xd5c5862ef2110a1d), WORD(0xae89bafa1f9a80b1),
+	WORD(0xf6117f3ddd882e5a), WORD(0x960179d4f45dc787),
+	WORD(0x483a7eea555c23e5), WORD(0x6f64f3698489aadb),
+	WORD(0x98b16a7ea8d7474c), WORD(0xd5ed3859db901e90),
+	/* T[6] */
+	WORD(0xb9a000cbb510d6ad), WORD(0x97484da4a3fe15bb),
+	WORD(0x9765df15aa590d61), WORD(0x34df9b9bfd695991),
+	WORD(0x10c9c7de2c35bf38), WORD(0xcf5e43742a7ce3d6),
+	WORD(0xc8e595a8880d0791), WORD(0x7a4391b8264b0ee5),
+	/* T[7] */
+	WORD(0x977916de59002c5b), WORD(0xa7e61e7d1333ecba),
+	WORD(0xcfdf6405e8407792), WORD(0x45965389f48ff678),
+	WORD(0xc77cb6025b18944f), WORD(0xaa761225aff6524c),
+	WORD(0x5e27866654500f48), WORD(0x823805750394ca8b),
+	/* T[8] */
+	WORD(0x91d6f03172caaf2c), WORD(0xb9d5fa1c74c56e6a),
+	WORD(0x94b78320d957f45d), WORD(0x39ee1e7029a4be75),
+	WORD(0x29042eb13ba63abd), WORD(0xfcb6ca7b5007c3b8),
+	WORD(0x9a4fddf201ac5231), WORD(0x1eeb85cb0c8877a1),
+	/* T[9] */
+	WORD(0xf6cdc0e349e1e47d), WORD(0x75a76b0a51b81b05),
+	WORD(0x1ed1e631aa29fe14), WORD(0xaffcd1059e9e204b),
+	WORD(0x47dd01d738fdae72), WORD(0xc5ab33fd32514b94),
+	WORD(0x1be222c789773061), WORD(0x60ad7e96bf8aa6ef),
+	/* T[10] */
+	WORD(0x81ac13714041b869), WORD(0x40fabb1b11c0d2cf),
+	WORD(0x400da1ffc0d2a1e6), WORD(0x0e77ee539ae2c74f),
+	WORD(0x22b06c38ac0fd1b4), WORD(0x914b12824997aefa),
+	WORD(0x997c76b8388c1ebc), WORD(0xaacd1476e587c6e0),
+	/* T[11] */
+	WORD(0x29bee833ba6089da), WORD(0xf3cc53fed654f92c),
+	WORD(0x7adf994ff7e99370), WORD(0x6886552477525321),
+	WORD(0xb4c396134bcd1e48), WORD(0x8b755e16037b5368),
+	WORD(0x6b0a112118d1a31f), WORD(0x2f799dd9ad36865e),
+	/* T[12] */
+	WORD(0x7b78db30eaa6cb79), WORD(0xd39c174b5a0aef21),
+	WORD(0x97954666fe2d2020), WORD(0x25fe3bf325e584b5),
+	WORD(0x9a9ce0267e535057), WORD(0x45f3510040b2728b),
+	WORD(0x05d09308fef60e18), WORD(0x1cf65015ccceae32),
+	/* T[13] */
+	WORD(0xd0871b4b919b3e0a), WORD(0x58f0c3393e2ed995),
+	WORD(0x08af3f2e56e10b3b), WORD(0x9913fcff080a72dd),
+	WORD(0x1d5221ea3e3faf03), WORD(0x8bcd4f2e9be730a1),
+	WORD(0xf5cef2e170c6dff2), WORD(0x338b6f20cc4b1025),
+	/* T[14] */
+	WORD(0xdc8faae5590000df), WORD(0x8b03b976458014ae),
+	WORD(0x4f5b9da4483e8c8c), WORD(0x467047c89950ad77),
+	WORD(0x28a73bc4cce56b37), WORD(0x099f4c716ff3e503),
+	WORD(0xcf71ceacf5404311), WORD(0xe28908d124a1c658),
+	/* T[15] */
+	WORD(0x7cccc8e2530b6ac2), WORD(0x396c703233ba466e),
+	WORD(0x48f54108090baac6), WORD(0xaa6a7b92167d58f0),
+	WORD(0x8e952bda63abf005), WORD(0x9685165e00a8014c),
+	WORD(0xf364b19010946937), WORD(0x0dd426c10fc2b8bf),
+	/* T[16] */
+	WORD(0x4c44476acf6da417), WORD(0x3d9a4aa779e70ad7),
+	WORD(0xb333d377727bafc6), WORD(0xa66cdc631a401a86),
+	WORD(0x05f5bbc5a1fedbff), WORD(0x6c580a3dca872ece),
+	WORD(0xd382b44d2cdd4a12), WORD(0xbce210df2a1c24cc),
+	/* T[17] */
+	WORD(0xba806a213604285a), WORD(0x871a96643ff8324e),
+	WORD(0x64a540315bd85941), WORD(0x128de181cc211346),
+	WORD(0xd065de5ab90f8877), WORD(0x8236f406c9c318a6),
+	WORD(0x11c4a72a16f6252c), WORD(0xeca372c526412205),
+	/* T[18] */
+	WORD(0x2df12ebf0e54f281), WORD(0xe3141793828f8004),
+	WORD(0x52005c9a4447025a), WORD(0x5d93a13c04663c6e),
+	WORD(0x68ec6de5992a5c63), WORD(0xdd6fec46eafd2edc),
+	WORD(0xb2f2f9b3ab013082), WORD(0xb48abb7ae2f88a11),
+	/* T[19] */
+	WORD(0x5b46cb1fcc6a4a44), WORD(0x221222610915dc69),
+	WORD(0xf88a107fc25a020f), WORD(0xac772f29630c5d11),
+	WORD(0xa81aedb720427239), WORD(0xb30295ef8559f1af),
+	WORD(0x66763f1b6b775ad5), WORD(0x1026987866790400),
+	/* T[20] */
+	WORD(0x79f9e6ca7bc98c66), WORD(0xe04587f423c81f06),
+	WORD(0x55038e6a13ef33b2), WORD(0x768ac4227f3336f2),
+	WORD(0xf34ef64bb767d8fd), WORD(0x98cf564bd9acd73e),
+	WORD(0xeabcbe37c5f2caf5), WORD(0x9cbd5edc1e562b53),
+	/* T[21] */
+	WORD(0x39e0401d3fd726c0), WORD(0x8907be233c3625ad),
+	WORD(0xc580e5dca53a2e80), WORD(0xdeea913408a74a6b),
+	WORD(0x3db400211c48479d), WORD(0xf73a7c732ea8a07c),
+	WORD(0x449cdfaaedab6c36), WORD(0x316c18631e9ad02d),
+	/* T[22] */
+	WORD(0xdf090f1cfba7b0fc), WORD(0xed7555457db39305),
+	WORD(0x98f6ddfb78cc7f6e), WORD(0x509e4eb9b3c0497e),
+	WORD(0x57c1f8b7c004280f), WORD(0x6f47e68a4955db61),
+	WORD(0xeed395e74e6fee0b), WORD(0x5bab0b66a9f7286d),
+	/* T[23] */
+	WORD(0x73f694d4372f8290), WORD(0x6afbacca10eb54e0),
+	WORD(0xfe19faf956f478a1), WORD(0xe416b9ceef014d78),
+	WORD(0x1e93f2c2d4bc5bd5), WORD(0x674ba08cc2a39acf),
+	WORD(0x467aa8b56e2742b7), WORD(0x1e39b12d21c8ec2c),
+	/* T[24] */
+	WORD(0x8a7674fdbbe5b254), WORD(0x93fcf78e80527260),
+	WORD(0x0c675993f28eb9da), WORD(0xba81bde21346be67),
+	WORD(0x04fe7e508786793f), WORD(0x06ee1ab412dd402a),
+	WORD(0x079ebfd4935267f0), WORD(0xd5f02414be261a3c),
+	/* T[25] */
+	WORD(0x50ad0831d25657ca), WORD(0xbfc913f37726937a),
+	WORD(0x38485bc6823fb16e), WORD(0x785034c28d162356),
+	WORD(0x6b9b74290ad6fcca), WORD(0xac6f1f9069a468de),
+	WORD(0x2b7e9bcd11e6ba2e), WORD(0xbb2bcd64fba67620),
+	/* T[26] */
+	WORD(0x4d12af4471977b3f), WORD(0xdb49532afb84c761),
+	WORD(0xadeeff4d749e7b88), WORD(0xa7fce1e296b455ec),
+	WORD(0x4b74b338af91c7b3), WORD(0x44c28350d46bf0f1),
+	WORD(0x280dc786cf390bd2), WORD(0xb51a2da9f4fec715),
+	/* T[27] */
+	WORD(0xeacf9e25f99e5ad7), WORD(0x17a8241961a811f7),
+	WORD(0xb60ce492ae9f10d0), WORD(0xf11968a7eeaea777),
+	WORD(0x28c89ef6ba06324a), WORD(0x314775a33c3bd7e4),
+	WORD(0x05c394396c328aba), WORD(0x2b01a88546337172),
+	/* T[28] */
+	WORD(0x00d6cb5e0ed0183c), WORD(0x87db1c150e64dccb),
+	WORD(0x0deaeba5f65db543), WORD(0xc921fce689ee2deb),
+	WORD(0xc3dd41b2a3c9ee84), WORD(0x7eaf82250323fae9),
+	WORD(0xa4b1faa0aa8364a1), WORD(0xa8e8d8a9fdeff2ee),
+	/* T[29] */
+	WORD(0x7b37439479eebc42), WORD(0x5c2710d29e349439),
+	WORD(0x48eb55a872f1ba48), WORD(0xcdcb2027cd7af601),
+	WORD(0x31df0f52c5cb436f), WORD(0x3bd57e5f8d49c61d),
+	WORD(0x38c3400c94f67c91), WORD(0x599903de9a80234f),
+	/* T[30] */
+	WORD(0x412f519790414722), WORD(0x7b50f5cda30ae02e),
+	WORD(0xd6ea5d03664dbd2b), WORD(0xe1d75a3a4f616d57),
+	WORD(0x1b9adc1331231752), WORD(0x865403028775c693),
+	WORD(0x09faba7d0d2a4af0), WORD(0xec70d223d5bbf4ba),
+	/* T[31] */
+	WORD(0x735eda4020f801dd), WORD(0x0611cf38a3b1d14c),
+	WORD(0xe8c10437058b4677), WORD(0xeedcc5cd6689bc61),
+	WORD(0x9bc3a8c5e1060c39), WORD(0x2c402b84a570853f),
+	WORD(0x9fb551a98a843de0), WORD(0xa4922cda49181482),
+};
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+static const word_t frp256v1_gen_comb[] = {
+	/* T[0] */
+	WORD(0xd9b551ae), WORD(0xe3680a6e), WORD(0xd9084cf6), WORD(0x0014ff67),
+	WORD(0x3ce20409), WORD(0xef9f52fa), WORD(0xbc101468), WORD(0x0f373843),
+	WORD(0x74e04eee), WORD(0x3ae72e6a), WORD(0xf7431a1b), WORD(0x9bc9fce0),
+	WORD(0x190e5b0f), WORD(0xe17c7b29), WORD(0xa1ceb1a8), WORD(0x1e13c2ed),
+	/* T[1] */
+	WORD(0xd4eba04c), WORD(0xfa9e4e03), WORD(0xb046f3ab), WORD(0x73963c80),
+	WORD(0x74ab0fae), WORD(0x36949016), WORD(0xcf1e585f), WORD(0xddf3349a),
+	WORD(0xabdefda5), WORD(0x27dff5d1), WORD(0x192d8dee), WORD(0xc9937a1d),
+	WORD(0x0f37b03c), WORD(0x27ded531), WORD(0x420fed10), WORD(0x5359244d),
+	/* T[2] */
+	WORD(0x0cb59d34), WORD(0xbf7c76ec), WORD(0x2d03b71c), WORD(0x0c08e4e0),
+	WORD(0x13d1ad0d), WORD(0x619715b1), WORD(0x5c99aef0), WORD(0x2e3c21aa),
+	WORD(0xccb9a76c), WORD(0xb8562a77), WORD(0xea50db28), WORD(0xc640d08a),
+	WORD(0x8343127d), WORD(0x5c0bb096), WORD(0x55313e61), WORD(0x3088b8e0),
+	/* T[3] */
+	WORD(0xe8d9f5c6), WORD(0xf89bca8c), WORD(0x3e3729a1), WORD(0xded482cc),
+	WORD(0x7180ee38), WORD(0x767145d4), WORD(0x884e05f4), WORD(0x2d9ed263),
+	WORD(0xf8f6a135), WORD(0xe7afcdaa), WORD(0x91a9d3ef), WORD(0xf197a736),
+	WORD(0x901c35d2), WORD(0xca75fb32), WORD(0x81106e74), WORD(0x1790c757),
+	/* T[4] */
+	WORD(0x1c2d6ff5), WORD(0x46bee19d), WORD(0x47781e34), WORD(0xd63fed22),
+	WORD(0x913802d6), WORD(0xb1ec7981), WORD(0x020f41eb), WORD(0xdeebb814),
+	WORD(0x4e330e64), WORD(0xc9c49ff2), WORD(0x86687bdb), WORD(0x8d17af5e),
+	WORD(0xb618643d), WORD(0x5c4d7b25), WORD(0xf30834d5), WORD(0x605dbc28),
+	/* T[5] */
+	WORD(0xf2110a1d), WORD(0xd5c5862e), WORD(0x1f9a80b1), WORD(0xae89bafa),
+	WORD(0xdd882e5a), WORD(0xf6117f3d), WORD(0xf45dc787), WORD(0x960179d4),
+	WORD(0x555c23e5), WORD(0x483a7eea), WORD(0x8489aadb), WORD(0x6f64f369),
+	WORD(0xa8d7474c), WORD(0x98b16a7e), WORD(0xdb901e90), WORD(0xd5ed3859),
+	/* T[6] */
+	WORD(0xb510d6ad), WORD(0xb9a000cb), WORD(0xa3fe15bb), WORD(0x97484da4),
+	WORD(0xaa590d61), WORD(0x9765df15), WORD(0xfd695991), WORD(0x34df9b9b),
+	WORD(0x2c35bf38), WORD(0x10c9c7de), WORD(0x2a7ce3d6), WORD(0xcf5e4374),
+	WORD(0x880d0791), WORD(0xc8e595a8), WORD(0x264b0ee5), WORD(0x7a4391b8),
+	/* T[7] */
+	WORD(0x59002c5b), WORD(0x977916de), WORD(0x1333ecba), WORD(0xa7e61e7d),
+	WORD(0xe8407792), WORD(0xcfdf6405), WORD(0xf48ff678), WORD(0x45965389),
+	WORD(0x5b18944f), WORD(0xc77cb602), WORD(0xaff6524c), WORD(0xaa761225),
+	WORD(0x54500f48), WORD(0x5e278666), WORD(0x0394ca8b), WORD(0x82380575),
+	/* T[8] */
+	WORD(0x72caaf2c), WORD(0x91d6f031), WORD(0x74c56e6a), WORD(0xb9d5fa1c),
+	WORD(0xd957f45d), WORD(0x94b78320), WORD(0x29a4be75), WORD(0x39ee1e70),
+	WORD(0x3ba63abd), WORD(0x29042eb1), WORD(0x5007c3b8), WORD(0xfcb6ca7b),
+	WORD(0x01ac5231), WORD(0x9a4fddf2), WORD(0x0c8877a1), WORD(0x1eeb85cb),
+	/* T[9] */
+	WORD(0x49e1e47d), WORD(0xf6cdc0e3), WORD(0x51b81b05), WORD(0x75a76b0a),
+	WORD(0xaa29fe14), WORD(0x1ed1e631), WORD(0x9e9e204b), WORD(0xaffcd105),
+	WORD(0x38fdae72), WORD(0x47dd01d7), WORD(0x32514b94), WORD(0xc5ab33fd),
+	WORD(0x89773061), WORD(0x1be222c7), WORD(0xbf8aa6ef), WORD(0x60ad7e96),
+	/* T[10] */
+	WORD(0x4041b869), WORD(0x81ac1371), WORD(0x11c0d2cf), WORD(0x40fabb1b),
+	WORD(0xc0d2a1e6), WORD(0x400da1ff), WORD(0x9ae2c74f), WORD(0x0e77ee53),
+	WORD(0xac0fd1b4), WORD(0x22b06c38), WORD(0x4997aefa), WORD(0x914b1282),
+	WORD(0x388c1ebc), WORD(0x997c76b8), WORD(0xe587c6e0), WORD(0xaacd1476),
+	/* T[11] */
+	WORD(0xba6089da), WORD(0x29bee833), WORD(0xd654f92c), WORD(0xf3cc53fe),
+	WORD(0xf7e99370), WORD(0x7adf994f), WORD(0x77525321), WORD(0x68865524),
+	WORD(0x4bcd1e48), WORD(0xb4c39613), WORD(0x037b5368), WORD(0x8b755e16),
+	WORD(0x18d1a31f), WORD(0x6b0a1121), WORD(0xad36865e), WORD(0x2f799dd9),
+	/* T[12] */
+	WORD(0xeaa6cb79), WORD(0x7b78db30), WORD(0x5a0aef21), WORD(0xd39c174b),
+	WORD(0xfe2d2020), WORD(0x97954666), WORD(0x25e584b5), WORD(0x25fe3bf3),
+	WORD(0x7e535057), WORD(0x9a9ce026), WORD(0x40b2728b), WORD(0x45f35100),
+	WORD(0xfef60e18), WORD(0x05d09308), WORD(0xccceae32), WORD(0x1cf65015),
+	/* T[13] */
+	WORD(0x919b3e0a), WORD(0xd0871b4b), WORD(0x3e2ed995), WORD(0x58f0c339),
+	WORD(0x56e10b3b), WORD(0x08af3f2e), WORD(0x080a72dd), WORD(0x9913fcff),
+	WORD(0x3e3faf03), WORD(0x1d5221ea), WORD(0x9be730a1), WORD(0x8bcd4f2e),
+	WORD(0x70c6dff2), WORD(0xf5cef2e1), WORD(0xcc4b1025), WORD(0x338b6f20),
+	/* T[14] */
+	WORD(0x590000df), WORD(0xdc8faae5), WORD(0x458014ae), WORD(0x8b03b976),
+	WORD(0x483e8c8c), WORD(0x4f5b9da4), WORD(0x9950ad77), WORD(0x467047c8),
+	WORD(0xcce56b37), WORD(0x28a73bc4), WORD(0x6ff3e503), WORD(0x099f4c71),
+	WORD(0xf5404311), WORD(0xcf71ceac), WORD(0x24a1c658), WORD(0xe28908d1),
+	/* T[15] */
+	WORD(0x530b6ac2), WORD(0x7cccc8e2), WORD(0x33ba466e), WORD(0x396c7032),
+	WORD(0x090baac6), WORD(0x48f54108), WORD(0x167d58f0), WORD(0xaa6a7b92),
+	WORD(0x63abf005), WORD(0x8e952bda), WORD(0x00a8014c), WORD(0x9685165e),
+	WORD(0x10946937), WORD(0xf364b190), WORD(0x0fc2b8bf), WORD(0x0dd426c1),
+	/* T[16] */
+	WORD(0xcf6da417), WORD(0x4c44476a), WORD(0x79e70ad7), WORD(0x3d9a4aa7),
+	WORD(0x727bafc6), WORD(0xb333d377), WORD(0x1a401a86), WORD(0xa66cdc63),
+	WORD(0xa1fedbff), WORD(0x05f5bbc5), WORD(0xca872ece), WORD(0x6c580a3d),
+	WORD(0x2cdd4a12), WORD(0xd382b44d), WORD(0x2a1c24cc), WORD(0xbce210df),
+	/* T[17] */
+	WORD(0x3604285a), WORD(0xba806a21), WORD(0x3ff8324e), WORD(0x871a9664),
+	WORD(0x5bd85941), WORD(0x64a54031), WORD(0xcc211346), WORD(0x128de181),
+	WORD(0xb90f8877), WORD(0xd065de5a), WORD(0xc9c318a6), WORD(0x8236f406),
+	WORD(0x16f6252c), WORD(0x11c4a72a), WORD(0x26412205), WORD(0xeca372c5),
+	/* T[18] */
+	WORD(0x0e54f281), WORD(0x2df12ebf), WORD(0x828f8004), WORD(0xe3141793),
+	WORD(0x4447025a), WORD(0x52005c9a), WORD(0x04663c6e), WORD(0x5d93a13c),
+	WORD(0x992a5c63), WORD(0x68ec6de5), WORD(0xeafd2edc), WORD(0xdd6fec46),
+	WORD(0xab013082), WORD(0xb2f2f9b3), WORD(0xe2f88a11), WORD(0xb48abb7a),
+	/* T[19] */
+	WORD(0xcc6a4a44), WORD(0x5b46cb1f), WORD(0x0915dc69), WORD(0x22122261),
+	WORD(0xc25a020f), WORD(0xf88a107f), WORD(0x630c5d11), WORD(0xac772f29),
+	WORD(0x20427239), WORD(0xa81aedb7), WORD(0x8559f1af), WORD(0xb30295ef),
+	WORD(0x6b775ad5), WORD(0x66763f1b), WORD(0x66790400), WORD(0x10269878),
+	/* T[20] */
+	WORD(0x7bc98c66), WORD(0x79f9e6ca), WORD(0x23c81f06), WORD(0xe04587f4),
+	WORD(0x13ef33b2), WORD(0x55038e6a), WORD(0x7f3336f2), WORD(0x768ac422),
+	WORD(0xb767d8fd), WORD(0xf34ef64b), WORD(0xd9acd73e), WORD(0x98cf564b),
+	WORD(0xc5f2caf5), WORD(0xeabcbe37), WORD(0x1e562b53), WORD(0x9cbd5edc),
+	/* T[21] */
+	WORD(0x3fd726c0), WORD(0x39e0401d), WORD(0x3c3625ad), WORD(0x8907be23),
+	WORD(0xa53a2e80), WORD(0xc580e5dc), WORD(0x08a74a6b), WORD(0xdeea9134),
+	WORD(0x1c48479d), WORD(0x3db40021), WORD(0x2ea8a07c), WORD(0xf73a7c73),
+	WORD(0xedab6c36), WORD(0x449cdfaa), WORD(0x1e9ad02d), WORD(0x316c1863),
+	/* T[22] */
+	WORD(0xfba7b0fc), WORD(0xdf090f1c), WORD(0x7db39305), WORD(0xed755545),
+	WORD(0x78cc7f6e), WORD(0x98f6ddfb), WORD(0xb3c0497e), WORD(0x509e4eb9),
+	WORD(0xc004280f), WORD(0x57c1f8b7), WORD(0x4955db61), WORD(0x6f47e68a),
+	WORD(0x4e6fee0b), WORD(0xeed395e7), WORD(0xa9f7286d), WORD(0x5bab0b66),
+	/* T[23] */
+	WORD(0x372f8290), WORD(0x73f694d4), WORD(0x10eb54e0), WORD(0x6afbacca),
+	WORD(0x56f478a1), WORD(0xfe19faf9), WORD(0xef014d78), WORD(0xe416b9ce),
+	WORD(0xd4bc5bd5), WORD(0x1e93f2c2), WORD(0xc2a39acf), WORD(0x674ba08c),
+	WORD(0x6e2742b7), WORD(0x467aa8b5), WORD(0x21c8ec2c), WORD(0x1e39b12d),
+	/* T[24] */
+	WORD(0xbbe5b254), WORD(0x8a7674fd), WORD(0x80527260), WORD(0x93fcf78e),
+	WORD(0xf28eb9da), WORD(0x0c675993), WORD(0x1346be67), WORD(0xba81bde2),
+	WORD(0x8786793f), WORD(0x04fe7e50), WORD(0x12dd402a), WORD(0x06ee1ab4),
+	WORD(0x935267f0), WORD(0x079ebfd4), WORD(0xbe261a3c), WORD(0xd5f02414),
+	/* T[25] */
+	WORD(0xd25657ca), WORD(0x50ad0831), WORD(0x7726937a), WORD(0xbfc913f3),
+	WORD(0x823fb16e), WORD(0x38485bc6), WORD(0x8d162356), WORD(0x785034c2),
+	WORD(0x0ad6fcca), WORD(0x6b9b7429), WORD(0x69a468de), WORD(0xac6f1f90),
+	WORD(0x11e6ba2e), WORD(0x2b7e9bcd), WORD(0xfba67620), WORD(0xbb2bcd64),
+	/* T[26] */
+	WORD(0x71977b3f), WORD(0x4d12af44), WORD(0xfb84c761), WORD(0xdb49532a),
+	WORD(0x749e7b88), WORD(0xadeeff4d), WORD(0x96b455ec), WORD(0xa7fce1e2),
+	WORD(0xaf91c7b3), WORD(0x4b74b338), WORD(0xd46bf0f1), WORD(0x44c28350),
+	WORD(0xcf390bd2), WORD(0x280dc786), WORD(0xf4fec715), WORD(0xb51a2da9),
+	/* T[27] */
+	WORD(0xf99e5ad7), WORD(0xeacf9e25), WORD(0x61a811f7), WORD(0x17a82419),
+	WORD(0xae9f10d0), WORD(0xb60ce492), WORD(0xeeaea777), WORD(0xf11968a7),
+	WORD(0xba06324a), WORD(0x28c89ef6), WORD(0x3c3bd7e4), WORD(0x314775a3),
+	WORD(0x6c328aba), WORD(0x05c39439), WORD(0x46337172), WORD(0x2b01a885),
+	/* T[28] */
+	WORD(0x0ed0183c), WORD(0x00d6cb5e), WORD(0x0e64dccb), WORD(0x87db1c15),
+	WORD(0xf65db543), WORD(0x0deaeba5), WORD(0x89ee2deb), WORD(0xc921fce6),
+	WORD(0xa3c9ee84), WORD(0xc3dd41b2), WORD(0x0323fae9), WORD(0x7eaf8225),
+	WORD(0xaa8364a1), WORD(0xa4b1faa0), WORD(0xfdeff2ee), WORD(0xa8e8d8a9),
+	/* T[29] */
+	WORD(0x79eebc42), WORD(0x7b374394), WORD(0x9e349439), WORD(0x5c2710d2),
+	WORD(0x72f1ba48), WORD(0x48eb55a8), WORD(0xcd7af601), WORD(0xcdcb2027),
+	WORD(0xc5cb436f), WORD(0x31df0f52), WORD(0x8d49c61d), WORD(0x3bd57e5f),
+	WORD(0x94f67c91), WORD(0x38c3400c), WORD(0x9a80234f), WORD(0x599903de),
+	/* T[30] */
+	WORD(0x90414722), WORD(0x412f5197), WORD(0xa30ae02e), WORD(0x7b50f5cd),
+	WORD(0x664dbd2b), WORD(0xd6ea5d03), WORD(0x4f616d57), WORD(0xe1d75a3a),
+	WORD(0x31231752), WORD(0x1b9adc13), WORD(0x8775c693), WORD(0x86540302),
+	WORD(0x0d2a4af0), WORD(0x09faba7d), WORD(0xd5bbf4ba), WORD(0xec70d223),
+	/* T[31] */
+	WORD(0x20f801dd), WORD(0x735eda40), WORD(0xa3b1d14c), WORD(0x0611cf38),
+	WORD(0x058b4677), WORD(0xe8c10437), WORD(0x6689bc61), WORD(0xeedcc5cd),
+	WORD(0xe1060c39), WORD(0x9bc3a8c5), WORD(0xa570853f), WORD(0x2c402b84),
+	WORD(0x8a843de0), WORD(0x9fb551a9), WORD(0x49181482), WORD(0xa4922cda),
+};
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+static const word_t frp256v1_gen_comb[] = {
+	/* T[0] */
+	WORD(0x51ae), WORD(0xd9b5), WORD(0x0a6e), WORD(0xe368), WORD(0x4cf6), WORD(0xd908),
+	WORD(0xff67), WORD(0x0014), WORD(0x0409), WORD(0x3ce2), WORD(0x52fa), WORD(0xef9f),
+	WORD(0x1468), WORD(0xbc10), WORD(0x3843), WORD(0x0f37), WORD(0x4eee), WORD(0x74e0),
+	WORD(0x2e6a), WORD(0x3ae7), WORD(0x1a1b), WORD(0xf743), WORD(0xfce0), WORD(0x9bc9),
+	WORD(0x5b0f), WORD(0x190e), WORD(0x7b29), WORD(0xe17c), WORD(0xb1a8), WORD(0xa1ce),
+	WORD(0xc2ed), WORD(0x1e13),
+	/* T[1] */
+	WORD(0xa04c), WORD(0xd4eb), WORD(0x4e03), WORD(0xfa9e), WORD(0xf3ab), WORD(0xb046),
+	WORD(0x3c80), WORD(0x7396), WORD(0x0fae), WORD(0x74ab), WORD(0x9016), WORD(0x3694),
+	WORD(0x585f), WORD(0xcf1e), WORD(0x349a), WORD(0xddf3), WORD(0xfda5), WORD(0xabde),
+	WORD(0xf5d1), WORD(0x27df), WORD(0x8dee), WORD(0x192d), WORD(0x7a1d), WORD(0xc993),
+	WORD(0xb03c), WORD(0x0f37), WORD(0xd531), WORD(0x27de), WORD(0xed10), WORD(0x420f),
+	WORD(0x244d), WORD(0x5359),
+	/* T[2] */
+	WORD(0x9d34), WORD(0x0cb5), WORD(0x76ec), WORD(0xbf7c), WORD(0xb71c), WORD(0x2d03),
+	WORD(0xe4e0), WORD(0x0c08), WORD(0xad0d), WORD(0x13d1), WORD(0x15b1), WORD(0x6197),
+	WORD(0xaef0), WORD(0x5c99), WORD(0x21aa), WORD(0x2e3c), WORD(0xa76c), WORD(0xccb9),
+	WORD(0x2a77), WORD(0xb856), WORD(0xdb28), WORD(0xea50), WORD(0xd08a), WORD(0xc640),
+	WORD(0x127d), WORD(0x8343), WORD(0xb096), WORD(0x5c0b), WORD(0x3e61), WORD(0x5531),
+	WORD(0xb8e0), WORD(0x3088),
+	/* T[3] */
+	WORD(0xf5c6), WORD(0xe8d9), WORD(0xca8c), WORD(0xf89b), WORD(0x29a1), WORD(0x3e37),
+	WORD(0x82cc), WORD(0xded4), WORD(0xee38), WORD(0x7180), WORD(0x45d4), WORD(0x7671),
+	WORD(0x05f4), WORD(0x884e), WORD(0xd263), WORD(0x2d9e), WORD(0xa135), WORD(0xf8f6),
+	WORD(0xcdaa), WORD(0xe7af), WORD(0xd3ef), WORD(0x91a9), WORD(0xa736), WORD(0xf197),
+	WORD(0x35d2), WORD(0x901c), WORD(0xfb32), WORD(0xca75), WORD(0x6e74), WORD(0x8110),
+	WORD(0xc757), WORD(0x1790),
+	/* T[4] */
+	WORD(0x6ff5), WORD(0x1c2d), WORD(0xe19d), WORD(0x46be), WORD(0x1e34), WORD(0x4778),
+	WORD(0xed22), WORD(0xd63f), WORD(0x02d6), WORD(0x9138), WORD(0x7981), WORD(0xb1ec),
+	WORD(0x41eb), WORD(0x020f), WORD(0xb814), WORD(0xdeeb), WORD(0x0e64), WORD(0x4e33),
+	WORD(0x9ff2), WORD(0xc9c4), WORD(0x7bdb), WORD(0x8668), WORD(0xaf5e), WORD(0x8d17),
+	WORD(0x643d), WORD(0xb618), WORD(0x7b25), WORD(0x5c4d), WORD(0x34d5), WORD(0xf308),
+	WORD(0xbc28), WORD(0x605d),
+	/* T[5] */
+	WORD(0x0a1d), WORD(0xf211), WORD(0x862e), WORD(0xd5c5), WORD(0x80b1), WORD(0x1f9a),
+	WORD(0xbafa), WORD(0xae89), WORD(0x2e5a), WORD(0xdd88), WORD(0x7f3d), WORD(0xf611),
+	WORD(0xc787), WORD(0xf45d), WORD(0x79d4), WORD(0x9601), WORD(0x23e5), WORD(0x555c),
+	WORD(0x7eea), WORD(0x483a), WORD(0xaadb), WORD(0x8489), WORD(0xf369), WORD(0x6f64),
+	WORD(0x474c), WORD(0xa8d7), WORD(0x6a7e), WORD(0x98b1), WORD(0x1e90), WORD(0xdb90),
+	WORD(0x3859), WORD(0xd5ed),
+	/* T[6] */
+	WORD(0xd6ad), WORD(0xb510), WORD(0x00cb), WORD(0xb9a0), WORD(0x15bb), WORD(0xa3fe),
+	WORD(0x4da4), WORD(0x9748), WORD(0x0d61), WORD(0xaa59), WORD(0xdf15), WORD(0x9765),
+	WORD(0x5991), WORD(0xfd69), WORD(0x9b9b), WORD(0x34df), WORD(0xbf38), WORD(0x2c35),
+	WORD(0xc7de), WORD(0x10c9), WORD(0xe3d6), WORD(0x2a7c), WORD(0x4374), WORD(0xcf5e),
+	WORD(0x0791), WORD(0x880d), WORD(0x95a8), WORD(0xc8e5), WORD(0x0ee5), WORD(0x264b),
+	WORD(0x91b8), WORD(0x7a43),
+	/* T[7] */
+	WORD(0x2c5b), WORD(0x5900), WORD(0x16de), WORD(0x9779), WORD(0xecba), WORD(0x1333),
+	WORD(0x1e7d), WORD(0xa7e6), WORD(0x7792), WORD(0xe840), WORD(0x6405), WORD(0xcfdf),
+	WORD(0xf678), WORD(0xf48f), WORD(0x5389), WORD(0x4596), WORD(0x944f), WORD(0x5b18),
+	WORD(0xb602), WORD(0xc77c), WORD(0x524c), WORD(0xaff6), WORD(0x1225), WORD(0xaa76),
+	WORD(0x0f48), WORD(0x5450), WORD(0x8666), WORD(0x5e27), WORD(0xca8b), WORD(0x0394),
+	WORD(0x0575), WORD(0x8238),
+	/* T[8] */
+	WORD(0xaf2c), WORD(0x72ca), WORD(0xf031), WORD(0x91d6), WORD(0x6e6a), WORD(0x74c5),
+	WORD(0xfa1c), WORD(0xb9d5), WORD(0xf45d), WORD(0xd957), WORD(0x8320), WORD(0x94b7),
+	WORD(0xbe75), WORD(0x29a4), WORD(0x1e70), WORD(0x39ee), WORD(0x3abd), WORD(0x3ba6),
+	WORD(0x2eb1), WORD(0x2904), WORD(0xc3b8), WORD(0x5007), WORD(0xca7b), WORD(0xfcb6),
+	WORD(0x5231), WORD(0x01ac), WORD(0xddf2), WORD(0x9a4f), WORD(0x77a1), WORD(0x0c88),
+	WORD(0x85cb), WORD(0x1eeb),
+	/* T[9] */
+	WORD(0xe47d), WORD(0x49e1), WORD(0xc0e3), WORD(0xf6cd), WORD(0x1b05), WORD(0x51b8),
+	WORD(0x6b0a), WORD(0x75a7), WORD(0xfe14), WORD(0xaa29), WORD(0xe631), WORD(0x1ed1),
+	WORD(0x204b), WORD(0x9e9e), WORD(0xd105), WORD(0xaffc), WORD(0xae72), WORD(0x38fd),
+	WORD(0x01d7), WORD(0x47dd), WORD(0x4b94), WORD(0x3251), WORD(0x33fd), WORD(0xc5ab),
+	WORD(0x3061), WORD(0x8977), WORD(0x22c7), WORD(0x1be2), WORD(0xa6ef), WORD(0xbf8a),
+	WORD(0x7e96), WORD(0x60ad),
+	/* T[10] */
+	WORD(0xb869), WORD(0x4041), WORD(0x1371), WORD(0x81ac), WORD(0xd2cf), WORD(0x11c0),
+	WORD(0xbb1b), WORD(0x40fa), WORD(0xa1e6), WORD(0xc0d2), WORD(0xa1ff), WORD(0x400d),
+	WORD(0xc74f), WORD(0x9ae2), WORD(0xee53), WORD(0x0e77), WORD(0xd1b4), WORD(0xac0f),
+	WORD(0x6c38), WORD(0x22b0), WORD(0xaefa), WORD(0x4997), WORD(0x1282), WORD(0x914b),
+	WORD(0x1ebc), WORD(0x388c), WORD(0x76b8), WORD(0x997c), WORD(0xc6e0), WORD(0xe587),
+	WORD(0x1476), WORD(0xaacd),
+	/* T[11] */
+	WORD(0x89da), WORD(0xba60), WORD(0xe833), WORD(0x29be), WORD(0xf92c), WORD(0xd654),
+	WORD(0x53fe), WORD(0xf3cc), WORD(0x9370), WORD(0xf7e9), WORD(0x994f), WORD(0x7adf),
+	WORD(0x5321), WORD(0x7752), WORD(0x5524), WORD(0x6886), WORD(0x1e48), WORD(0x4bcd),
+	WORD(0x9613), WORD(0xb4c3), WORD(0x5368), WORD(0x037b), WORD(0x5e16), WORD(0x8b75),
+	WORD(0xa31f), WORD(0x18d1), WORD(0x1121), WORD(0x6b0a), WORD(0x865e), WORD(0xad36),
+	WORD(0x9dd9), WORD(0x2f79),
+	/* T[12] */
+	WORD(0xcb79), WORD(0xeaa6), WORD(0xdb30), WORD(0x7b78), WORD(0xef21), WORD(0x5a0a),
+	WORD(0x174b), WORD(0xd39c), WORD(0x2020), WORD(0xfe2d), WORD(0x4666), WORD(0x9795),
+	WORD(0x84b5), WORD(0x25e5), WORD(0x3bf3), WORD(0x25fe), WORD(0x5057), WORD(0x7e53),
+	WORD(0xe026), WORD(0x9a9c), WORD(0x728b), WORD(0x40b2), WORD(0x5100), WORD(0x45f3),
+	WORD(0x0e18), WORD(0xfef6), WORD(0x9308), WORD(0x05d0), WORD(0xae32), WORD(0xccce),
+	WORD(0x5015), WORD(0x1cf6),
+	/* T[13] */
+	WORD(0x3e0a), WORD(0x919b), WORD(0x1b4b), WORD(0xd087), WORD(0xd995), WORD(0x3e2e),
+	WORD(0xc339), WORD(0x58f0), WORD(0x0b3b), WORD(0x56e1), WORD(0x3f2e), WORD(0x08af),
+	WORD(0x72dd), WORD(0x080a), WORD(0xfcff), WORD(0x9913), WORD(0xaf03), WORD(0x3e3f),
+	WORD(0x21ea), WORD(0x1d52), WORD(0x30a1), WORD(0x9be7), WORD(0x4f2e), WORD(0x8bcd),
+	WORD(0xdff2), WORD(0x70c6), WORD(0xf2e1), WORD(0xf5ce), WORD(0x1025), WORD(0xcc4b),
+	WORD(0x6f20), WORD(0x338b),
+	/* T[14] */
+	WORD(0x00df), WORD(0x5900), WORD(0xaae5), WORD(0xdc8f), WORD(0x14ae), WORD(0x4580),
+	WORD(0xb976), WORD(0x8b03), WORD(0x8c8c), WORD(0x483e), WORD(0x9da4), WORD(0x4f5b),
+	WORD(0xad77), WORD(0x9950), WORD(0x47c8), WORD(0x4670), WORD(0x6b37), WORD(0xcce5),
+	WORD(0x3bc4), WORD(0x28a7), WORD(0xe503), WORD(0x6ff3), WORD(0x4c71), WORD(0x099f),
+	WORD(0x4311), WORD(0xf540), WORD(0xceac), WORD(0xcf71), WORD(0xc658), WORD(0x24a1),
+	WORD(0x08d1), WORD(0xe289),
+	/* T[15] */
+	WORD(0x6ac2), WORD(0x530b), WORD(0xc8e2), WORD(0x7ccc), WORD(0x466e), WORD(0x33ba),
+	WORD(0x7032), WORD(0x396c), WORD(0xaac6), WORD(0x090b), WORD(0x4108), WORD(0x48f5),
+	WORD(0x58f0), WORD(0x167d), WORD(0x7b92), WORD(0xaa6a), WORD(0xf005), WORD(0x63ab),
+	WORD(0x2bda), WORD(0x8e95), WORD(0x014c), WORD(0x00a8), WORD(0x165e), WORD(0x9685),
+	WORD(0x6937), WORD(0x1094), WORD(0xb190), WORD(0xf364), WORD(0xb8bf), WORD(0x0fc2),
+	WORD(0x26c1), WORD(0x0dd4),
+	/* T[16] */
+	WORD(0xa417), WORD(0xcf6d), WORD(0x476a), WORD(0x4c44), WORD(0x0ad7), WORD(0x79e7),
+	WORD(0x4aa7), WORD(0x3d9a), WORD(0xafc6), WORD(0x727b), WORD(0xd377), WORD(0xb333),
+	WORD(0x1a86), WORD(0x1a40), WORD(0xdc63), WORD(0xa66c), WORD(0xdbff), WORD(0xa1fe),
+	WORD(0xbbc5), WORD(0x05f5), WORD(0x2ece), WORD(0xca87), WORD(0x0a3d), WORD(0x6c58),
+	WORD(0x4a12), WORD(0x2cdd), WORD(0xb44d), WORD(0xd382), WORD(0x24cc), WORD(0x2a1c),
+	WORD(0x10df), WORD(0xbce2),
+	/* T[17] */
+	WORD(0x285a), WORD(0x3604), WORD(0x6a21), WORD(0xba80), WORD(0x324e), WORD(0x3ff8),
+	WORD(0x9664), WORD(0x871a), WORD(0x5941), WORD(0x5bd8), WORD(0x4031), WORD(0x64a5),
+	WORD(0x1346), WORD(0xcc21), WORD(0xe181), WORD(0x128d), WORD(0x8877), WORD(0xb90f),
+	WORD(0xde5a), WORD(0xd065), WORD(0x18a6), WORD(0xc9c3), WORD(0xf406), WORD(0x8236),
+	WORD(0x252c), WORD(0x16f6), WORD(0xa72a), WORD(0x11c4), WORD(0x2205), WORD(0x2641),
+	WORD(0x72c5), WORD(0xeca3),
+	/* T[18] */
+	WORD(0xf281), WORD(0x0e54), WORD(0x2ebf), WORD(0x2df1), WORD(0x8004), WORD(0x828f),
+	WORD(0x1793), WORD(0xe314), WORD(0x025a), WORD(0x4447), WORD(0x5c9a), WORD(0x5200),
+	WORD(0x3c6e), WORD(0x0466), WORD(0xa13c), WORD(0x5d93), WORD(0x5c63), WORD(0x992a),
+	WORD(0x6de5), WORD(0x68ec), WORD(0x2edc), WORD(0xeafd), WORD(0xec46), WORD(0xdd6f),
+	WORD(0x3082), WORD(0xab01), WORD(0xf9b3), WORD(0xb2f2), WORD(0x8a11), WORD(0xe2f8),
+	WORD(0xbb7a), WORD(0xb48a),
+	/* T[19] */
+	WORD(0x4a44), WORD(0xcc6a), WORD(0xcb1f), WORD(0x5b46), WORD(0xdc69), WORD(0x0915),
+	WORD(0x2261), WORD(0x2212), WORD(0x020f), WORD(0xc25a), WORD(0x107f), WORD(0xf88a),
+	WORD(0x5d11), WORD(0x630c), WORD(0x2f29), WORD(0xac77), WORD(0x7239), WORD(0x2042),
+	WORD(0xedb7), WORD(0xa81a), WORD(0xf1af), WORD(0x8559), WORD(0x95ef), WORD(0xb302),
+	WORD(0x5ad5), WORD(0x6b77), WORD(0x3f1b), WORD(0x6676), WORD(0x0400), WORD(0x6679),
+	WORD(0x9878), WORD(0x1026),
+	/* T[20] */
+	WORD(0x8c66), WORD(0x7bc9), WORD(0xe6ca), WORD(0x79f9), WORD(0x1f06), WORD(0x23c8),
+	WORD(0x87f4), WORD(0xe045), WORD(0x33b2), WORD(0x13ef), WORD(0x8e6a), WORD(0x5503),
+	WORD(0x36f2), WORD(0x7f33), WORD(0xc422), WORD(0x768a), WORD(0xd8fd), WORD(0xb767),
+	WORD(0xf64b), WORD(0xf34e), WORD(0xd73e), WORD(0xd9ac), WORD(0x564b), WORD(0x98cf),
+	WORD(0xcaf5), WORD(0xc5f2), WORD(0xbe37), WORD(0xeabc), WORD(0x2b53), WORD(0x1e56),
+	WORD(0x5edc), WORD(0x9cbd),
+	/* T[21] */
+	WORD(0x26c0), WORD(0x3fd7), WORD(0x401d), WORD(0x39e0), WORD(0x25ad), WORD(0x3c36),
+	WORD(0xbe23), WORD(0x8907), WORD(0x2e80), WORD(0xa53a), WORD(0xe5dc), WORD(0xc580),
+	WORD(0x4a6b), WORD(0x08a7), WORD(0x9134), WORD(0xdeea), WORD(0x479d), WORD(0x1c48),
+	WORD(0x0021), WORD(0x3db4), WORD(0xa07c), WORD(0x2ea8), WORD(0x7c73), WORD(0xf73a),
+	WORD(0x6c36), WORD(0xedab), WORD(0xdfaa), WORD(0x449c), WORD(0xd02d), WORD(0x1e9a),
+	WORD(0x1863), WORD(0x316c),
+	/* T[22] */
+	WORD(0xb0fc), WORD(0xfba7), WORD(0x0f1c), WORD(0xdf09), WORD(0x9305), WORD(0x7db3),
+	WORD(0x5545), WORD(0xed75), WORD(0x7f6e), WORD(0x78cc), WORD(0xddfb), WORD(0x98f6),
+	WORD(0x497e), WORD(0xb3c0), WORD(0x4eb9), WORD(0x509e), WORD(0x280f), WORD(0xc004),
+	WORD(0xf8b7), WORD(0x57c1), WORD(0xdb61), WORD(0x4955), WORD(0xe68a), WORD(0x6f47),
+	WORD(0xee0b), WORD(0x4e6f), WORD(0x95e7), WORD(0xeed3), WORD(0x286d), WORD(0xa9f7),
+	WORD(0x0b66), WORD(0x5bab),
+	/* T[23] */
+	WORD(0x8290), WORD(0x372f), WORD(0x94d4), WORD(0x73f6), WORD(0x54e0), WORD(0x10eb),
+	WORD(0xacca), WORD(0x6afb), WORD(0x78a1), WORD(0x56f4), WORD(0xfaf9), WORD(0xfe19),
+	WORD(0x4d78), WORD(0xef01), WORD(0xb9ce), WORD(0xe416), WORD(0x5bd5), WORD(0xd4bc),
+	WORD(0xf2c2), WORD(0x1e93), WORD(0x9acf), WORD(0xc2a3), WORD(0xa08c), WORD(0x674b),
+	WORD(0x42b7), WORD(0x6e27), WORD(0xa8b5), WORD(0x467a), WORD(0xec2c), WORD(0x21c8),
+	WORD(0xb12d), WORD(0x1e39),
+	/* T[24] */
+	WORD(0xb254), WORD(0xbbe5), WORD(0x74fd), WORD(0x8a76), WORD(0x7260), WORD(0x8052),
+	WORD(0xf78e), WORD(0x93fc), WORD(0xb9da), WORD(0xf28e), WORD(0x5993), WORD(0x0c67),
+	WORD(0xbe67), WORD(0x1346), WORD(0xbde2), WORD(0xba81), WORD(0x793f), WORD(0x8786),
+	WORD(0x7e50), WORD(0x04fe), WORD(0x402a), WORD(0x12dd), WORD(0x1ab4), WORD(0x06ee),
+	WORD(0x67f0), WORD(0x9352), WORD(0xbfd4), WORD(0x079e), WORD(0x1a3c), WORD(0xbe26),
+	WORD(0x2414), WORD(0xd5f0),
+	/* T[25] */
+	WORD(0x57ca), WORD(0xd256), WORD(0x0831), WORD(0x50ad), WORD(0x937a), WORD(0x7726),
+	WORD(0x13f3), WORD(0xbfc9), WORD(0xb16e), WORD(0x823f), WORD(0x5bc6), WORD(0x3848),
+	WORD(0x2356), WORD(0x8d16), WORD(0x34c2), WORD(0x7850), WORD(0xfcca), WORD(0x0ad6),
+	WORD(0x7429), WORD(0x6b9b), WORD(0x68de), WORD(0x69a4), WORD(0x1f90), WORD(0xac6f),
+	WORD(0xba2e), WORD(0x11e6), WORD(0x9bcd), WORD(0x2b7e), WORD(0x7620), WORD(0xfba6),
+	WORD(0xcd64), WORD(0xbb2b),
+	/* T[26] */
+	WORD(0x7b3f), WORD(0x7197), WORD(0xaf44), WORD(0x4d12), WORD(0xc761), WORD(0xfb84),
+	WORD(0x532a), WORD(0xdb49), WORD(0x7b88), WORD(0x749e), WORD(0xff4d), WORD(0xadee),
+	WORD(0x55ec), WORD(0x96b4), WORD(0xe1e2), WORD(0xa7fc), WORD(0xc7b3), WORD(0xaf91),
+	WORD(0xb338), WORD(0x4b74), WORD(0xf0f1), WORD(0xd46b), WORD(0x8350), WORD(0x44c2),
+	WORD(0x0bd2), WORD(0xcf39), WORD(0xc786), WORD(0x280d), WORD(0xc715), WORD(0xf4fe),
+	WORD(0x2da9), WORD(0xb51a),
+	/* T[27] */
+	WORD(0x5ad7), WORD(0xf99e), WORD(0x9e25), WORD(0xeacf), WORD(0x11f7), WORD(0x61a8),
+	WORD(0x2419), WORD(0x17a8), WORD(0x10d0), WORD(0xae9f), WORD(0xe492), WORD(0xb60c),
+	WORD(0xa777), WORD(0xeeae), WORD(0x68a7), WORD(0xf119), WORD(0x324a), WORD(0xba06),
+	WORD(0x9ef6), WORD(0x28c8), WORD(0xd7e4), WORD(0x3c3b), WORD(0x75a3), WORD(0x3147),
+	WORD(0x8aba), WORD(0x6c32), WORD(0x9439), WORD(0x05c3), WORD(0x7172), WORD(0x4633),
+	WORD(0xa885), WORD(0x2b01),
+	/* T[28] */
+	WORD(0x183c), WORD(0x0ed0), WORD(0xcb5e), WORD(0x00d6), WORD(0xdccb), WORD(0x0e64),
+	WORD(0x1c15), WORD(0x87db), WORD(0xb543), WORD(0xf65d), WORD(0xeba5), WORD(0x0dea),
+	WORD(0x2deb), WORD(0x89ee), WORD(0xfce6), WORD(0xc921), WORD(0xee84), WORD(0xa3c9),
+	WORD(0x41b2), WORD(0xc3dd), WORD(0xfae9), WORD(0x0323), WORD(0x8225), WORD(0x7eaf),
+	WORD(0x64a1), WORD(0xaa83), WORD(0xfaa0), WORD(0xa4b1), WORD(0xf2ee), WORD(0xfdef),
+	WORD(0xd8a9), WORD(0xa8e8),
+	/* T[29] */
+	WORD(0xbc42), WORD(0x79ee), WORD(0x4394), WORD(0x7b37), WORD(0x9439), WORD(0x9e34),
+	WORD(0x10d2), WORD(0x5c27), WORD(0xba48), WORD(0x72f1), WORD(0x55a8), WORD(0x48eb),
+	WORD(0xf601), WORD(0xcd7a), WORD(0x2027), WORD(0xcdcb), WORD(0x436f), WORD(0xc5cb),
+	WORD(0x0f52), WORD(0x31df), WORD(0xc61d), WORD(0x8d49), WORD(0x7e5f), WORD(0x3bd5),
+	WORD(0x7c91), WORD(0x94f6), WORD(0x400c), WORD(0x38c3), WORD(0x234f), WORD(0x9a80),
+	WORD(0x03de), WORD(0x5999),
+	/* T[30] */
+	WORD(0x4722), WORD(0x9041), WORD(0x5197), WORD(0x412f), WORD(0xe02e), WORD(0xa30a),
+	WORD(0xf5cd), WORD(0x7b50), WORD(0xbd2b), WORD(0x664d), WORD(0x5d03), WORD(0xd6ea),
+	WORD(0x6d57), WORD(0x4f61), WORD(0x5a3a), WORD(0xe1d7), WORD(0x1752), WORD(0x3123),
+	WORD(0xdc13), WORD(0x1b9a), WORD(0xc693), WORD(0x8775), WORD(0x0302), WORD(0x8654),
+	WORD(0x4af0), WORD(0x0d2a), WORD(0xba7d), WORD(0x09fa), WORD(0xf4ba), WORD(0xd5bb),
+	WORD(0xd223), WORD(0xec70),
+	/* T[31] */
+	WORD(0x01dd), WORD(0x20f8), WORD(0xda40), WORD(0x735e), WORD(0xd14c), WORD(0xa3b1),
+	WORD(0xcf38), WORD(0x0611), WORD(0x4677), WORD(0x058b), WORD(0x0437), WORD(0xe8c1),
+	WORD(0xbc61), WORD(0x6689), WORD(0xc5cd), WORD(0xeedc), WORD(0x0c39), WORD(0xe106),
+	WORD(0xa8c5), WORD(0x9bc3), WORD(0x853f), WORD(0xa570), WORD(0x2b84), WORD(0x2c40),
+	WORD(0x3de0), WORD(0x8a84), WORD(0x51a9), WORD(0x9fb5), WORD(0x1482), WORD(0x4918),
+	WORD(0x2cda), WORD(0xa492),
+};
+#else                     /* unknown word size */
+#error "Unsupported word size"
+#endif
+TO_EC_GEN_TABLE_PARAM(frp256v1_gen_comb, 6);
+
 static const ec_str_params frp256v1_str_params = {
 	.p = &frp256v1_p_str_param,
 	.p_bitlen = &frp256v1_p_bitlen_str_param,
@@ -179,6 +1492,11 @@ static const ec_str_params frp256v1_str_params = {
 	.cofactor = &frp256v1_cofactor_str_param,
 	.oid = &frp256v1_oid_str_param,
 	.name = &frp256v1_name_str_param,
+	.p_inv_chain = &frp256v1_p_inv_chain_param,
+	.p_sqrt_chain = &frp256v1_p_sqrt_chain_param,
+	.q_inv_chain = &frp256v1_q_inv_chain_param,
+	.gen_wnaf_table = &frp256v1_gen_wnaf_table_param,
+	.gen_comb_table = &frp256v1_gen_comb_table_param,
 };
 
 /*
@@ -199,6 +1517,17 @@ static const ec_str_params frp256v1_str_params = {
 #define CURVES_MAX_Q_BIT_LEN CURVE_FRP256V1_Q_BITLEN
 #endif
 
+/*
+ * Limb count of p for the fixed limbs field backend (see fp_fixed.h)
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+#define FP_FIXED_WLEN_4_USED
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+#define FP_FIXED_WLEN_8_USED
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+#define FP_FIXED_WLEN_16_USED
+#endif
+
 #endif /* __EC_PARAMS_FRP256V1_H__ */
 
 #endif /* WITH_CURVE_FRP256V1 */
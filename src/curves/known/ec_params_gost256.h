@@ -159,6 +159,1180 @@ TO_EC_STR_PARAM(GOST_256bits_curve_oid);
 static const u8 GOST_256bits_curve_name[] = "GOST256";
 TO_EC_STR_PARAM(GOST_256bits_curve_name);
 
+/* x^(p - 2): 256 squarings and 5 multiplications */
+static const u8 GOST_256bits_curve_p_inv[] = {
+	0x10, 0x01, 0x00,
+	0x20, 0xf5, 0x00,
+	0x22, 0x05, 0x00,
+	0x22, 0x03, 0x01,
+	0x22, 0x02, 0x01,
+};
+TO_EC_CHAIN_PARAM(GOST_256bits_curve_p_inv);
+
+/* x^(q - 2): 256 squarings and 34 multiplications */
+static const u8 GOST_256bits_curve_q_inv[] = {
+	0x10, 0x01, 0xff,
+	0x20, 0x00, 0x01,
+	0x32, 0x00, 0x01,
+	0x43, 0x00, 0x01,
+	0x54, 0x00, 0x01,
+	0x65, 0x00, 0x01,
+	0x76, 0x00, 0x01,
+	0x87, 0x00, 0x01,
+	0x90, 0x81, 0x03,
+	0x99, 0x02, 0x00,
+	0x99, 0x08, 0x08,
+	0x99, 0x03, 0x04,
+	0x99, 0x02, 0x00,
+	0x99, 0x06, 0x03,
+	0x99, 0x06, 0x02,
+	0x99, 0x07, 0x05,
+	0x99, 0x05, 0x03,
+	0x99, 0x06, 0x06,
+	0x99, 0x04, 0x06,
+	0x99, 0x07, 0x03,
+	0x99, 0x04, 0x03,
+	0x99, 0x04, 0x02,
+	0x99, 0x07, 0x06,
+	0x99, 0x05, 0x04,
+	0x99, 0x06, 0x08,
+	0x99, 0x02, 0x02,
+	0x99, 0x07, 0x02,
+	0x99, 0x06, 0x05,
+	0x99, 0x04, 0x07,
+	0x99, 0x03, 0x02,
+	0x99, 0x04, 0x02,
+	0x99, 0x06, 0x08,
+	0x99, 0x05, 0x06,
+	0x99, 0x03, 0x02,
+	0x99, 0x04, 0x00,
+};
+TO_EC_CHAIN_PARAM(GOST_256bits_curve_q_inv);
+
+/*
+ * Odd multiples G, 3G, ..., 63G of the generator for the wNAF
+ * multiplications (window 7), affine x and y in Montgomery representation
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+static const word_t GOST_256bits_curve_gen_wnaf[] = {
+	/* G */
+	WORD(0xfffffffffffff36d), WORD(0xffffffffffffffff),
+	WORD(0xffffffffffffffff), WORD(0x7fffffffffffffff),
+	WORD(0x9af45a5a471125f5), WORD(0x7ce5090af69bf9ae),
+	WORD(0x67617a63e4b6dde6), WORD(0x03f66b354aa3daa4),
+	/* 3G */
+	WORD(0xb39bdc16149b5d15), WORD(0x87ce978a7309454f),
+	WORD(0xd22f32ef315a7a56), WORD(0x4c7de232b69a6b57),
+	WORD(0x9e2daf6d466dc64d), WORD(0x758c27b14b1c8a55),
+	WORD(0x74a0cb23bd647f1a), WORD(0x27e748682c2f4c70),
+	/* 5G */
+	WORD(0xf2d8f32e55a62594), WORD(0x8323d57036bc547a),
+	WORD(0x497679eb98d4b25a), WORD(0x061167f2b87e0534),
+	WORD(0xe1fffdce223e4df8), WORD(0x7c83ae78dcd891e9),
+	WORD(0x743985863c1b95d0), WORD(0x11d7320574b3f5ab),
+	/* 7G */
+	WORD(0x34b9c048acb97f7c), WORD(0x8232e73ce3b9bcc6),
+	WORD(0x81f4b63fda2db71d), WORD(0x4eee5393a2df4c84),
+	WORD(0xca6e63aeac469c69), WORD(0x27bc807c428e4f01),
+	WORD(0x4a2c23ba5f4ec124), WORD(0x74847cfcaae2668b),
+	/* 9G */
+	WORD(0x4435585f6716af4e), WORD(0xb872d8b71cdb965f),
+	WORD(0x662f1962746ffad0), WORD(0x52761a24db5d0187),
+	WORD(0xf6a09922a57e0e3d), WORD(0x86c69342a9c12b63),
+	WORD(0x91ff20b65af190c5), WORD(0x10db7a2a4eeee1ae),
+	/* 11G */
+	WORD(0xbb464a5374628b90), WORD(0x6e7a1227057a4f25),
+	WORD(0x4c309d690b0fa41f), WORD(0x7548260777fe7b93),
+	WORD(0xf2583ec70b612421), WORD(0xff2cfc835e2b15ed),
+	WORD(0x1e97a7db8cabc5cf), WORD(0x1ec08faa925c149f),
+	/* 13G */
+	WORD(0xba0170e30e9fcba9), WORD(0x8976df7c70d9939b),
+	WORD(0xeae6e74b21af14dd), WORD(0x09f098680d0861f9),
+	WORD(0x4f7fe26e21a781ff), WORD(0x1725b8d0d73dcef7),
+	WORD(0x9da632177e743498), WORD(0x0f51d42c1b828b99),
+	/* 15G */
+	WORD(0xbabb076b9afe09bd), WORD(0x4ac8922317c4050d),
+	WORD(0xca3ea6e3da3e57e8), WORD(0x20aaa384a33242c0),
+	WORD(0x6d3a1f2def929bf5), WORD(0xb34e2605e751a62d),
+	WORD(0xe1ac629fb8cf1f99), WORD(0x7152d4e3f0bba01a),
+	/* 17G */
+	WORD(0xa97a6ce3943e5b8e), WORD(0x1c0f6c7f2d053a9d),
+	WORD(0x9d4a91de64457de4), WORD(0x1e19ea8fc6140057),
+	WORD(0xd4766cb6500995c8), WORD(0xa019d41de70cd7ee),
+	WORD(0xba1828aa7ab0a162), WORD(0x0caca0630b7a4e93),
+	/* 19G */
+	WORD(0x1e68315ca1b3fe03), WORD(0x21fb277e1aab6b20),
+	WORD(0x210305d76a90fb22), WORD(0x4c3d3eea2e51b9bc),
+	WORD(0xc5662c6d89c3a2e8), WORD(0x66ea48181712bf9b),
+	WORD(0x417f8f042254fbab), WORD(0x2f57df29b057eec1),
+	/* 21G */
+	WORD(0xf6975c9f6509ae4f), WORD(0x58300438dc89c220),
+	WORD(0xe81da879907ff785), WORD(0x68d600e30910ed2f),
+	WORD(0xfbb25113b43bf686), WORD(0x8b391e3f50a64fae),
+	WORD(0x8c1190d23112b7ed), WORD(0x617bcd41ccb4ca50),
+	/* 23G */
+	WORD(0x75036e69dd780aca), WORD(0xc90a01de6fbcd996),
+	WORD(0x75e1a8e80c851cef), WORD(0x7225d38af71bdcc6),
+	WORD(0x74ae6935868b78d2), WORD(0xe70570f31cdb5a1e),
+	WORD(0x3e700c48bebd2fa4), WORD(0x3e483638325d3214),
+	/* 25G */
+	WORD(0x9f272cd5c0e6d8ad), WORD(0x9e29687ce09743a2),
+	WORD(0xbe0e0d5993cd64b3), WORD(0x5d57a75d504b58f0),
+	WORD(0x81a1a6e35d44b092), WORD(0x38ad0169310d7868),
+	WORD(0xc8d3c9a6cc297b73), WORD(0x34d98a19908e0814),
+	/* 27G */
+	WORD(0xffb946ade5a57e1f), WORD(0xf7ea0aa2191b6c5f),
+	WORD(0x52d070588df529c1), WORD(0x06b7bde52afda727),
+	WORD(0x651e6dc990658555), WORD(0x8f910d891fc416ce),
+	WORD(0x0ba4d84ecbf086d5), WORD(0x73da158c0c4a4b4a),
+	/* 29G */
+	WORD(0xe22420a6521db62c), WORD(0x8ebc1a21bc90eb6f),
+	WORD(0xe1529aace50f6eb4), WORD(0x4025bf278be235db),
+	WORD(0x406077109ffe2b82), WORD(0x7a6bb75b696b4634),
+	WORD(0x0cef27a92b2f25d3), WORD(0x6c9cffd7ca0b7112),
+	/* 31G */
+	WORD(0x12b39ff0eda5c43b), WORD(0x2e1fc66c54e0fe3f),
+	WORD(0xfb2dea80248a9167), WORD(0x11bcda103b2bb322),
+	WORD(0xfddf6e8416d2c928), WORD(0x99ddf6a136e887f4),
+	WORD(0x1e56d2f3920092d6), WORD(0x67433bf42d77ae5a),
+	/* 33G */
+	WORD(0xe2302bc009a3859f), WORD(0x0d9b32676ad0f1fe),
+	WORD(0x87651c91486a9752), WORD(0x66a385ea6c118858),
+	WORD(0xb38bf93a342318b6), WORD(0xa510e87ef2aa4cf0),
+	WORD(0xdfcbf047391f89c2), WORD(0x4f92b4f1d8905aed),
+	/* 35G */
+	WORD(0xd3c860842053c424), WORD(0x5297e9aebd2a9ac7),
+	WORD(0x3c1611817b4d98bf), WORD(0x355d2a0228b723eb),
+	WORD(0x4bac36cda8f1797f), WORD(0x1f3d6c770de85340),
+	WORD(0x05936831dd90f333), WORD(0x1a8953010946501e),
+	/* 37G */
+	WORD(0x25ddf77e63d49a61), WORD(0x483340dd00e97a08),
+	WORD(0x5cc3e1b8d1852755), WORD(0x01514a8cfda8fea4),
+	WORD(0x642305b0efd18f64), WORD(0x72c6dd8eb9818ebd),
+	WORD(0x96e0304ac0dcb25f), WORD(0x2f1a774faf2b5814),
+	/* 39G */
+	WORD(0x781032715a5c9776), WORD(0x5910e727abc7ddca),
+	WORD(0xec0cba599a5c5969), WORD(0x38af663a3c4cde0c),
+	WORD(0xde1df7f60ad5482c), WORD(0x2c18294cb4f1c116),
+	WORD(0x049b71f4067fba92), WORD(0x30a84c8ad7527ace),
+	/* 41G */
+	WORD(0xc3ef39742c8c4eac), WORD(0xf0717508892a9cec),
+	WORD(0x81c35a44287f83bd), WORD(0x1b789020155f8966),
+	WORD(0x3b92b3de876065ee), WORD(0x0043971742f771c8),
+	WORD(0xd4d2eb1c5116cf9c), WORD(0x032ab36c0a889706),
+	/* 43G */
+	WORD(0x59a71ec75a6bfb88), WORD(0x0fd82100cec6d1e7),
+	WORD(0x9a53ba4e562276cc), WORD(0x3a41912bba3ca862),
+	WORD(0xe89ed89bd65be16f), WORD(0x3df293f9c7e5cff2),
+	WORD(0xcefa0c1477f36bfd), WORD(0x75f2b4074dca03fa),
+	/* 45G */
+	WORD(0x8b08f0a52d578bf5), WORD(0x812dc5b9bc95e9bc),
+	WORD(0x38693ad9f94504df), WORD(0x3218cdd109ed7ef6),
+	WORD(0xd56529b1320bdd0a), WORD(0xc974f108ff5449d6),
+	WORD(0x557c69c74ea853ff), WORD(0x29fb8869525021f4),
+	/* 47G */
+	WORD(0xa10605371e9fd3cb), WORD(0xfc81a7d07a394c39),
+	WORD(0x1a9c76661bf94364), WORD(0x709ebfc5804ee583),
+	WORD(0xdcfd596e016d2602), WORD(0x336db13f3b3881fb),
+	WORD(0x0b83eb365d220431), WORD(0x6e6c8506b7218179),
+	/* 49G */
+	WORD(0x4dc3036a1e647c9e), WORD(0xc92f3eb00f78b2f7),
+	WORD(0xaa591b3d046c10c9), WORD(0x5ff771e9a2854c75),
+	WORD(0x5c98ff6fb2cc3721), WORD(0xb01c1715ea9b04b8),
+	WORD(0x21aba4f5c1b710e9), WORD(0x789004911a188f44),
+	/* 51G */
+	WORD(0xc1d0bd333e947c15), WORD(0x4be734ffbd67b21c),
+	WORD(0xc9f0706ada13d33a), WORD(0x6661c48959b829a4),
+	WORD(0xf2fad5fa9b2ff762), WORD(0xd8fad51ff58062e8),
+	WORD(0x62ab46cefc99e4a2), WORD(0x1b3ad7741b25cfdc),
+	/* 53G */
+	WORD(0x66d12171eac42125), WORD(0x89e80293393b1a27),
+	WORD(0x16c762b7fc7865fa), WORD(0x2e1a386c77e45d44),
+	WORD(0x701be1acc3869164), WORD(0x4a62034f1656155c),
+	WORD(0xc7d9de3e2af9856a), WORD(0x420384a23102073d),
+	/* 55G */
+	WORD(0x1c54b1221e4fc3e2), WORD(0x3dd0c7d2d7970512),
+	WORD(0x6b5b15ff3c43e041), WORD(0x583b7a791cc50688),
+	WORD(0x0db0798b3b31a40d), WORD(0x9305990d64a1ed19),
+	WORD(0xa63292bd0bc5fda0), WORD(0x7c9f61ec00a4e292),
+	/* 57G */
+	WORD(0x903e8434713f85a2), WORD(0xd912256ade13948e),
+	WORD(0xb485f80a0a7c4189), WORD(0x2f3a1dd81881ecdc),
+	WORD(0x184f2bebef5061b6), WORD(0xfc796ad2c2cb07ea),
+	WORD(0x267b06cb787a2b21), WORD(0x5cca68978cb863dd),
+	/* 59G */
+	WORD(0x4423c915b1bf187f), WORD(0xe8b665699830156a),
+	WORD(0xecea59e74fe86596), WORD(0x350412f2668d808b),
+	WORD(0xc592139be29f3208), WORD(0xfcd43b2424dfb715),
+	WORD(0xd1ee42b1cb4e0125), WORD(0x0e70ae3fa6220f09),
+	/* 61G */
+	WORD(0x712ffe470d012b6f), WORD(0x6a7789dc029c0c9a),
+	WORD(0xfbf1c59988d992b0), WORD(0x20eacfc8f625e569),
+	WORD(0xe6138ed79841bafa), WORD(0x3329a3a65a515f0f),
+	WORD(0x8e6740d82dce83c9), WORD(0x4a83f691d071bb74),
+	/* 63G */
+	WORD(0xdb9cb7f4b5900ed1), WORD(0x467d9696fd10ce2e),
+	WORD(0xa7197bbd077cc0a3), WORD(0x517b44a0d7c0c43c),
+	WORD(0xfa060317ba716c5b), WORD(0x68c8cc7cc4a41162),
+	WORD(0x752d7bc6eb13f1da), WORD(0x059dc184b2d8f365),
+};
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+static const word_t GOST_256bits_curve_gen_wnaf[] = {
+	/* G */
+	WORD(0xfffff36d), WORD(0xffffffff), WORD(0xffffffff), WORD(0xffffffff),
+	WORD(0xffffffff), WORD(0xffffffff), WORD(0xffffffff), WORD(0x7fffffff),
+	WORD(0x471125f5), WORD(0x9af45a5a), WORD(0xf69bf9ae), WORD(0x7ce5090a),
+	WORD(0xe4b6dde6), WORD(0x67617a63), WORD(0x4aa3daa4), WORD(0x03f66b35),
+	/* 3G */
+	WORD(0x149b5d15), WORD(0xb39bdc16), WORD(0x7309454f), WORD(0x87ce978a),
+	WORD(0x315a7a56), WORD(0xd22f32ef), WORD(0xb69a6b57), WORD(0x4c7de232),
+	WORD(0x466dc64d), WORD(0x9e2daf6d), WORD(0x4b1c8a55), WORD(0x758c27b1),
+	WORD(0xbd647f1a), WORD(0x74a0cb23), WORD(0x2c2f4c70), WORD(0x27e74868),
+	/* 5G */
+	WORD(0x55a62594), WORD(0xf2d8f32e), WORD(0x36bc547a), WORD(0x8323d570),
+	WORD(0x98d4b25a), WORD(0x497679eb), WORD(0xb87e0534), WORD(0x061167f2),
+	WORD(0x223e4df8), WORD(0xe1fffdce), WORD(0xdcd891e9), WORD(0x7c83ae78),
+	WORD(0x3c1b95d0), WORD(0x74398586), WORD(0x74b3f5ab), WORD(0x11d73205),
+	/* 7G */
+	WORD(0xacb97f7c), WORD(0x34b9c048), WORD(0xe3b9bcc6), WORD(0x8232e73c),
+	WORD(0xda2db71d), WORD(0x81f4b63f), WORD(0xa2df4c84), WORD(0x4eee5393),
+	WORD(0xac469c69), WORD(0xca6e63ae), WORD(0x428e4f01), WORD(0x27bc807c),
+	WORD(0x5f4ec124), WORD(0x4a2c23ba), WORD(0xaae2668b), WORD(0x74847cfc),
+	/* 9G */
+	WORD(0x6716af4e), WORD(0x4435585f), WORD(0x1cdb965f), WORD(0xb872d8b7),
+	WORD(0x746ffad0), WORD(0x662f1962), WORD(0xdb5d0187), WORD(0x52761a24),
+	WORD(0xa57e0e3d), WORD(0xf6a09922), WORD(0xa9c12b63), WORD(0x86c69342),
+	WORD(0x5af190c5), WORD(0x91ff20b6), WORD(0x4eeee1ae), WORD(0x10db7a2a),
+	/* 11G */
+	WORD(0x74628b90), WORD(0xbb464a53), WORD(0x057a4f25), WORD(0x6e7a1227),
+	WORD(0x0b0fa41f), WORD(0x4c309d69), WORD(0x77fe7b93), WORD(0x75482607),
+	WORD(0x0b612421), WORD(0xf2583ec7), WORD(0x5e2b15ed), WORD(0xff2cfc83),
+	WORD(0x8cabc5cf), WORD(0x1e97a7db), WORD(0x925c149f), WORD(0x1ec08faa),
+	/* 13G */
+	WORD(0x0e9fcba9), WORD(0xba0170e3), WORD(0x70d9939b), WORD(0x8976df7c),
+	WORD(0x21af14dd), WORD(0xeae6e74b), WORD(0x0d0861f9), WORD(0x09f09868),
+	WORD(0x21a781ff), WORD(0x4f7fe26e), WORD(0xd73dcef7), WORD(0x1725b8d0),
+	WORD(0x7e743498), WORD(0x9da63217), WORD(0x1b828b99), WORD(0x0f51d42c),
+	/* 15G */
+	WORD(0x9afe09bd), WORD(0xbabb076b), WORD(0x17c4050d), WORD(0x4ac89223),
+	WORD(0xda3e57e8), WORD(0xca3ea6e3), WORD(0xa33242c0), WORD(0x20aaa384),
+	WORD(0xef929bf5), WORD(0x6d3a1f2d), WORD(0xe751a62d), WORD(0xb34e2605),
+	WORD(0xb8cf1f99), WORD(0xe1ac629f), WORD(0xf0bba01a), WORD(0x7152d4e3),
+	/* 17G */
+	WORD(0x943e5b8e), WORD(0xa97a6ce3), WORD(0x2d053a9d), WORD(0x1c0f6c7f),
+	WORD(0x64457de4), WORD(0x9d4a91de), WORD(0xc6140057), WORD(0x1e19ea8f),
+	WORD(0x500995c8), WORD(0xd4766cb6), WORD(0xe70cd7ee), WORD(0xa019d41d),
+	WORD(0x7ab0a162), WORD(0xba1828aa), WORD(0x0b7a4e93), WORD(0x0caca063),
+	/* 19G */
+	WORD(0xa1b3fe03), WORD(0x1e68315c), WORD(0x1aab6b20), WORD(0x21fb277e),
+	WORD(0x6a90fb22), WORD(0x210305d7), WORD(0x2e51b9bc), WORD(0x4c3d3eea),
+	WORD(0x89c3a2e8), WORD(0xc5662c6d), WORD(0x1712bf9b), WORD(0x66ea4818),
+	WORD(0x2254fbab), WORD(0x417f8f04), WORD(0xb057eec1), WORD(0x2f57df29),
+	/* 21G */
+	WORD(0x6509ae4f), WORD(0xf6975c9f), WORD(0xdc89c220), WORD(0x58300438),
+	WORD(0x907ff785), WORD(0xe81da879), WORD(0x0910ed2f), WORD(0x68d600e3),
+	WORD(0xb43bf686), WORD(0xfbb25113), WORD(0x50a64fae), WORD(0x8b391e3f),
+	WORD(0x3112b7ed), WORD(0x8c1190d2), WORD(0xccb4ca50), WORD(0x617bcd41),
+	/* 23G */
+	WORD(0xdd780aca), WORD(0x75036e69), WORD(0x6fbcd996), WORD(0xc90a01de),
+	WORD(0x0c851cef), WORD(0x75e1a8e8), WORD(0xf71bdcc6), WORD(0x7225d38a),
+	WORD(0x868b78d2), WORD(0x74ae6935), WORD(0x1cdb5a1e), WORD(0xe70570f3),
+	WORD(0xbebd2fa4), WORD(0x3e700c48), WORD(0x325d3214), WORD(0x3e483638),
+	/* 25G */
+	WORD(0xc0e6d8ad), WORD(0x9f272cd5), WORD(0xe09743a2), WORD(0x9e29687c),
+	WORD(0x93cd64b3), WORD(0xbe0e0d59), WORD(0x504b58f0), WORD(0x5d57a75d),
+	WORD(0x5d44b092), WORD(0x81a1a6e3), WORD(0x310d7868), WORD(0x38ad0169),
+	WORD(0xcc297b73), WORD(0xc8d3c9a6), WORD(0x908e0814), WORD(0x34d98a19),
+	/* 27G */
+	WORD(0xe5a57e1f), WORD(0xffb946ad), WORD(0x191b6c5f), WORD(0xf7ea0aa2),
+	WORD(0x8df529c1), WORD(0x52d07058), WORD(0x2afda727), WORD(0x06b7bde5),
+	WORD(0x90658555), WORD(0x651e6dc9), WORD(0x1fc416ce), WORD(0x8f910d89),
+	WORD(0xcbf086d5), WORD(0x0ba4d84e), WORD(0x0c4a4b4a), WORD(0x73da158c),
+	/* 29G */
+	WORD(0x521db62c), WORD(0xe22420a6), WORD(0xbc90eb6f), WORD(0x8ebc1a21),
+	WORD(0xe50f6eb4), WORD(0xe1529aac), WORD(0x8be235db), WORD(0x4025bf27),
+	WORD(0x9ffe2b82), WORD(0x40607710), WORD(0x696b4634), WORD(0x7a6bb75b),
+	WORD(0x2b2f25d3), WORD(0x0cef27a9), WORD(0xca0b7112), WORD(0x6c9cffd7),
+	/* 31G */
+	WORD(0xeda5c43b), WORD(0x12b39ff0), WORD(0x54e0fe3f), WORD(0x2e1fc66c),
+	WORD(0x248a9167), WORD(0xfb2dea80), WORD(0x3b2bb322), WORD(0x11bcda10),
+	WORD(0x16d2c928), WORD(0xfddf6e84), WORD(0x36e887f4), WORD(0x99ddf6a1),
+	WORD(0x920092d6), WORD(0x1e56d2f3), WORD(0x2d77ae5a), WORD(0x67433bf4),
+	/* 33G */
+	WORD(0x09a3859f), WORD(0xe2302bc0), WORD(0x6ad0f1fe), WORD(0x0d9b3267),
+	WORD(0x486a9752), WORD(0x87651c91), WORD(0x6c118858), WORD(0x66a385ea),
+	WORD(0x342318b6), WORD(0xb38bf93a), WORD(0xf2aa4cf0), WORD(0xa510e87e),
+	WORD(0x391f89c2), WORD(0xdfcbf047), WORD(0xd8905aed), WORD(0x4f92b4f1),
+	/* 35G */
+	WORD(0x2053c424), WORD(0xd3c86084), WORD(0xbd2a9ac7), WORD(0x5297e9ae),
+	WORD(0x7b4d98bf), WORD(0x3c161181), WORD(0x28b723eb), WORD(0x355d2a02),
+	WORD(0xa8f1797f), WORD(0x4bac36cd), WORD(0x0de85340), WORD(0x1f3d6c77),
+	WORD(0xdd90f333), WORD(0x05936831), WORD(0x0946501e), WORD(0x1a895301),
+	/* 37G */
+	WORD(0x63d49a61), WORD(0x25ddf77e), WORD(0x00e97a08), WORD(0x483340dd),
+	WORD(0xd1852755), WORD(0x5cc3e1b8), WORD(0xfda8fea4), WORD(0x01514a8c),
+	WORD(0xefd18f64), WORD(0x642305b0), WORD(0xb9818ebd), WORD(0x72c6dd8e),
+	WORD(0xc0dcb25f), WORD(0x96e0304a), WORD(0xaf2b5814), WORD(0x2f1a774f),
+	/* 39G */
+	WORD(0x5a5c9776), WORD(0x78103271), WORD(0xabc7ddca), WORD(0x5910e727),
+	WORD(0x9a5c5969), WORD(0xec0cba59), WORD(0x3c4cde0c), WORD(0x38af663a),
+	WORD(0x0ad5482c), WORD(0xde1df7f6), WORD(0xb4f1c116), WORD(0x2c18294c),
+	WORD(0x067fba92), WORD(0x049b71f4), WORD(0xd7527ace), WORD(0x30a84c8a),
+	/* 41G */
+	WORD(0x2c8c4eac), WORD(0xc3ef3974), WORD(0x892a9cec), WORD(0xf0717508),
+	WORD(0x287f83bd), WORD(0x81c35a44), WORD(0x155f8966), WORD(0x1b789020),
+	WORD(0x876065ee), WORD(0x3b92b3de), WORD(0x42f771c8), WORD(0x00439717),
+	WORD(0x5116cf9c), WORD(0xd4d2eb1c), WORD(0x0a889706), WORD(0x032ab36c),
+	/* 43G */
+	WORD(0x5a6bfb88), WORD(0x59a71ec7), WORD(0xcec6d1e7), WORD(0x0fd82100),
+	WORD(0x562276cc), WORD(0x9a53ba4e), WORD(0xba3ca862), WORD(0x3a41912b),
+	WORD(0xd65be16f), WORD(0xe89ed89b), WORD(0xc7e5cff2), WORD(0x3df293f9),
+	WORD(0x77f36bfd), WORD(0xcefa0c14), WORD(0x4dca03fa), WORD(0x75f2b407),
+	/* 45G */
+	WORD(0x2d578bf5), WORD(0x8b08f0a5), WORD(0xbc95e9bc), WORD(0x812dc5b9),
+	WORD(0xf94504df), WORD(0x38693ad9), WORD(0x09ed7ef6), WORD(0x3218cdd1),
+	WORD(0x320bdd0a), WORD(0xd56529b1), WORD(0xff5449d6), WORD(0xc974f108),
+	WORD(0x4ea853ff), WORD(0x557c69c7), WORD(0x525021f4), WORD(0x29fb8869),
+	/* 47G */
+	WORD(0x1e9fd3cb), WORD(0xa1060537), WORD(0x7a394c39), WORD(0xfc81a7d0),
+	WORD(0x1bf94364), WORD(0x1a9c7666), WORD(0x804ee583), WORD(0x709ebfc5),
+	WORD(0x016d2602), WORD(0xdcfd596e), WORD(0x3b3881fb), WORD(0x336db13f),
+	WORD(0x5d220431), WORD(0x0b83eb36), WORD(0xb7218179), WORD(0x6e6c8506),
+	/* 49G */
+	WORD(0x1e647c9e), WORD(0x4dc3036a), WORD(0x0f78b2f7), WORD(0xc92f3eb0),
+	WORD(0x046c10c9), WORD(0xaa591b3d), WORD(0xa2854c75), WORD(0x5ff771e9),
+	WORD(0xb2cc3721), WORD(0x5c98ff6f), WORD(0xea9b04b8), WORD(0xb01c1715),
+	WORD(0xc1b710e9), WORD(0x21aba4f5), WORD(0x1a188f44), WORD(0x78900491),
+	/* 51G */
+	WORD(0x3e947c15), WORD(0xc1d0bd33), WORD(0xbd67b21c), WORD(0x4be734ff),
+	WORD(0xda13d33a), WORD(0xc9f0706a), WORD(0x59b829a4), WORD(0x6661c489),
+	WORD(0x9b2ff762), WORD(0xf2fad5fa), WORD(0xf58062e8), WORD(0xd8fad51f),
+	WORD(0xfc99e4a2), WORD(0x62ab46ce), WORD(0x1b25cfdc), WORD(0x1b3ad774),
+	/* 53G */
+	WORD(0xeac42125), WORD(0x66d12171), WORD(0x393b1a27), WORD(0x89e80293),
+	WORD(0xfc7865fa), WORD(0x16c762b7), WORD(0x77e45d44), WORD(0x2e1a386c),
+	WORD(0xc3869164), WORD(0x701be1ac), WORD(0x1656155c), WORD(0x4a62034f),
+	WORD(0x2af9856a), WORD(0xc7d9de3e), WORD(0x3102073d), WORD(0x420384a2),
+	/* 55G */
+	WORD(0x1e4fc3e2), WORD(0x1c54b122), WORD(0xd7970512), WORD(0x3dd0c7d2),
+	WORD(0x3c43e041), WORD(0x6b5b15ff), WORD(0x1cc50688), WORD(0x583b7a79),
+	WORD(0x3b31a40d), WORD(0x0db0798b), WORD(0x64a1ed19), WORD(0x9305990d),
+	WORD(0x0bc5fda0), WORD(0xa63292bd), WORD(0x00a4e292), WORD(0x7c9f61ec),
+	/* 57G */
+	WORD(0x713f85a2), WORD(0x903e8434), WORD(0xde13948e), WORD(0xd912256a),
+	WORD(0x0a7c4189), WORD(0xb485f80a), WORD(0x1881ecdc), WORD(0x2f3a1dd8),
+	WORD(0xef5061b6), WORD(0x184f2beb), WORD(0xc2cb07ea), WORD(0xfc796ad2),
+	WORD(0x787a2b21), WORD(0x267b06cb), WORD(0x8cb863dd), WORD(0x5cca6897),
+	/* 59G */
+	WORD(0xb1bf187f), WORD(0x4423c915), WORD(0x9830156a), WORD(0xe8b66569),
+	WORD(0x4fe86596), WORD(0xecea59e7), WORD(0x668d808b), WORD(0x350412f2),
+	WORD(0xe29f3208), WORD(0xc592139b), WORD(0x24dfb715), WORD(0xfcd43b24),
+	WORD(0xcb4e0125), WORD(0xd1ee42b1), WORD(0xa6220f09), WORD(0x0e70ae3f),
+	/* 61G */
+	WORD(0x0d012b6f), WORD(0x712ffe47), WORD(0x029c0c9a), WORD(0x6a7789dc),
+	WORD(0x88d992b0), WORD(0xfbf1c599), WORD(0xf625e569), WORD(0x20eacfc8),
+	WORD(0x9841bafa), WORD(0xe6138ed7), WORD(0x5a515f0f), WORD(0x3329a3a6),
+	WORD(0x2dce83c9), WORD(0x8e6740d8), WORD(0xd071bb74), WORD(0x4a83f691),
+	/* 63G */
+	WORD(0xb5900ed1), WORD(0xdb9cb7f4), WORD(0xfd10ce2e), WORD(0x467d9696),
+	WORD(0x077cc0a3), WORD(0xa7197bbd), WORD(0xd7c0c43c), WORD(0x517b44a0),
+	WORD(0xba716c5b), WORD(0xfa060317), WORD(0xc4a41162), WORD(0x68c8cc7c),
+	WORD(0xeb13f1da), WORD(0x752d7bc6), WORD(0xb2d8f365), WORD(0x059dc184),
+};
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+static const word_t GOST_256bits_curve_gen_wnaf[] = {
+	/* G */
+	WORD(0xf36d), WORD(0xffff), WORD(0xffff), WORD(0xffff), WORD(0xffff), WORD(0xffff),
+	WORD(0xffff), WORD(0xffff), WORD(0xffff), WORD(0xffff), WORD(0xffff), WORD(0xffff),
+	WORD(0xffff), WORD(0xffff), WORD(0xffff), WORD(0x7fff), WORD(0x25f5), WORD(0x4711),
+	WORD(0x5a5a), WORD(0x9af4), WORD(0xf9ae), WORD(0xf69b), WORD(0x090a), WORD(0x7ce5),
+	WORD(0xdde6), WORD(0xe4b6), WORD(0x7a63), WORD(0x6761), WORD(0xdaa4), WORD(0x4aa3),
+	WORD(0x6b35), WORD(0x03f6),
+	/* 3G */
+	WORD(0x5d15), WORD(0x149b), WORD(0xdc16), WORD(0xb39b), WORD(0x454f), WORD(0x7309),
+	WORD(0x978a), WORD(0x87ce), WORD(0x7a56), WORD(0x315a), WORD(0x32ef), WORD(0xd22f),
+	WORD(0x6b57), WORD(0xb69a), WORD(0xe232), WORD(0x4c7d), WORD(0xc64d), WORD(0x466d),
+	WORD(0xaf6d), WORD(0x9e2d), WORD(0x8a55), WORD(0x4b1c), WORD(0x27b1), WORD(0x758c),
+	WORD(0x7f1a), WORD(0xbd64), WORD(0xcb23), WORD(0x74a0), WORD(0x4c70), WORD(0x2c2f),
+	WORD(0x4868), WORD(0x27e7),
+	/* 5G */
+	WORD(0x2594), WORD(0x55a6), WORD(0xf32e), WORD(0xf2d8), WORD(0x547a), WORD(0x36bc),
+	WORD(0xd570), WORD(0x8323), WORD(0xb25a), WORD(0x98d4), WORD(0x79eb), WORD(0x4976),
+	WORD(0x0534), WORD(0xb87e), WORD(0x67f2), WORD(0x0611), WORD(0x4df8), WORD(0x223e),
+	WORD(0xfdce), WORD(0xe1ff), WORD(0x91e9), WORD(0xdcd8), WORD(0xae78), WORD(0x7c83),
+	WORD(0x95d0), WORD(0x3c1b), WORD(0x8586), WORD(0x7439), WORD(0xf5ab), WORD(0x74b3),
+	WORD(0x3205), WORD(0x11d7),
+	/* 7G */
+	WORD(0x7f7c), WORD(0xacb9), WORD(0xc048), WORD(0x34b9), WORD(0xbcc6), WORD(0xe3b9),
+	WORD(0xe73c), WORD(0x8232), WORD(0xb71d), WORD(0xda2d), WORD(0xb63f), WORD(0x81f4),
+	WORD(0x4c84), WORD(0xa2df), WORD(0x5393), WORD(0x4eee), WORD(0x9c69), WORD(0xac46),
+	WORD(0x63ae), WORD(0xca6e), WORD(0x4f01), WORD(0x428e), WORD(0x807c), WORD(0x27bc),
+	WORD(0xc124), WORD(0x5f4e), WORD(0x23ba), WORD(0x4a2c), WORD(0x668b), WORD(0xaae2),
+	WORD(0x7cfc), WORD(0x7484),
+	/* 9G */
+	WORD(0xaf4e), WORD(0x6716), WORD(0x585f), WORD(0x4435), WORD(0x965f), WORD(0x1cdb),
+	WORD(0xd8b7), WORD(0xb872), WORD(0xfad0), WORD(0x746f), WORD(0x1962), WORD(0x662f),
+	WORD(0x0187), WORD(0xdb5d), WORD(0x1a24), WORD(0x5276), WORD(0x0e3d), WORD(0xa57e),
+	WORD(0x9922), WORD(0xf6a0), WORD(0x2b63), WORD(0xa9c1), WORD(0x9342), WORD(0x86c6),
+	WORD(0x90c5), WORD(0x5af1), WORD(0x20b6), WORD(0x91ff), WORD(0xe1ae), WORD(0x4eee),
+	WORD(0x7a2a), WORD(0x10db),
+	/* 11G */
+	WORD(0x8b90), WORD(0x7462), WORD(0x4a53), WORD(0xbb46), WORD(0x4f25), WORD(0x057a),
+	WORD(0x1227), WORD(0x6e7a), WORD(0xa41f), WORD(0x0b0f), WORD(0x9d69), WORD(0x4c30),
+	WORD(0x7b93), WORD(0x77fe), WORD(0x2607), WORD(0x7548), WORD(0x2421), WORD(0x0b61),
+	WORD(0x3ec7), WORD(0xf258), WORD(0x15ed), WORD(0x5e2b), WORD(0xfc83), WORD(0xff2c),
+	WORD(0xc5cf), WORD(0x8cab), WORD(0xa7db), WORD(0x1e97), WORD(0x149f), WORD(0x925c),
+	WORD(0x8faa), WORD(0x1ec0),
+	/* 13G */
+	WORD(0xcba9), WORD(0x0e9f), WORD(0x70e3), WORD(0xba01), WORD(0x939b), WORD(0x70d9),
+	WORD(0xdf7c), WORD(0x8976), WORD(0x14dd), WORD(0x21af), WORD(0xe74b), WORD(0xeae6),
+	WORD(0x61f9), WORD(0x0d08), WORD(0x9868), WORD(0x09f0), WORD(0x81ff), WORD(0x21a7),
+	WORD(0xe26e), WORD(0x4f7f), WORD(0xcef7), WORD(0xd73d), WORD(0xb8d0), WORD(0x1725),
+	WORD(0x3498), WORD(0x7e74), WORD(0x3217), WORD(0x9da6), WORD(0x8b99), WORD(0x1b82),
+	WORD(0xd42c), WORD(0x0f51),
+	/* 15G */
+	WORD(0x09bd), WORD(0x9afe), WORD(0x076b), WORD(0xbabb), WORD(0x050d), WORD(0x17c4),
+	WORD(0x9223), WORD(0x4ac8), WORD(0x57e8), WORD(0xda3e), WORD(0xa6e3), WORD(0xca3e),
+	WORD(0x42c0), WORD(0xa332), WORD(0xa384), WORD(0x20aa), WORD(0x9bf5), WORD(0xef92),
+	WORD(0x1f2d), WORD(0x6d3a), WORD(0xa62d), WORD(0xe751), WORD(0x2605), WORD(0xb34e),
+	WORD(0x1f99), WORD(0xb8cf), WORD(0x629f), WORD(0xe1ac), WORD(0xa01a), WORD(0xf0bb),
+	WORD(0xd4e3), WORD(0x7152),
+	/* 17G */
+	WORD(0x5b8e), WORD(0x943e), WORD(0x6ce3), WORD(0xa97a), WORD(0x3a9d), WORD(0x2d05),
+	WORD(0x6c7f), WORD(0x1c0f), WORD(0x7de4), WORD(0x6445), WORD(0x91de), WORD(0x9d4a),
+	WORD(0x0057), WORD(0xc614), WORD(0xea8f), WORD(0x1e19), WORD(0x95c8), WORD(0x5009),
+	WORD(0x6cb6), WORD(0xd476), WORD(0xd7ee), WORD(0xe70c), WORD(0xd41d), WORD(0xa019),
+	WORD(0xa162), WORD(0x7ab0), WORD(0x28aa), WORD(0xba18), WORD(0x4e93), WORD(0x0b7a),
+	WORD(0xa063), WORD(0x0cac),
+	/* 19G */
+	WORD(0xfe03), WORD(0xa1b3), WORD(0x315c), WORD(0x1e68), WORD(0x6b20), WORD(0x1aab),
+	WORD(0x277e), WORD(0x21fb), WORD(0xfb22), WORD(0x6a90), WORD(0x05d7), WORD(0x2103),
+	WORD(0xb9bc), WORD(0x2e51), WORD(0x3eea), WORD(0x4c3d), WORD(0xa2e8), WORD(0x89c3),
+	WORD(0x2c6d), WORD(0xc566), WORD(0xbf9b), WORD(0x1712), WORD(0x4818), WORD(0x66ea),
+	WORD(0xfbab), WORD(0x2254), WORD(0x8f04), WORD(0x417f), WORD(0xeec1), WORD(0xb057),
+	WORD(0xdf29), WORD(0x2f57),
+	/* 21G */
+	WORD(0xae4f), WORD(0x6509), WORD(0x5c9f), WORD(0xf697), WORD(0xc220), WORD(0xdc89),
+	WORD(0x0438), WORD(0x5830), WORD(0xf785), WORD(0x907f), WORD(0xa879), WORD(0xe81d),
+	WORD(0xed2f), WORD(0x0910), WORD(0x00e3), WORD(0x68d6), WORD(0xf686), WORD(0xb43b),
+	WORD(0x5113), WORD(0xfbb2), WORD(0x4fae), WORD(0x50a6), WORD(0x1e3f), WORD(0x8b39),
+	WORD(0xb7ed), WORD(0x3112), WORD(0x90d2), WORD(0x8c11), WORD(0xca50), WORD(0xccb4),
+	WORD(0xcd41), WORD(0x617b),
+	/* 23G */
+	WORD(0x0aca), WORD(0xdd78), WORD(0x6e69), WORD(0x7503), WORD(0xd996), WORD(0x6fbc),
+	WORD(0x01de), WORD(0xc90a), WORD(0x1cef), WORD(0x0c85), WORD(0xa8e8), WORD(0x75e1),
+	WORD(0xdcc6), WORD(0xf71b), WORD(0xd38a), WORD(0x7225), WORD(0x78d2), WORD(0x868b),
+	WORD(0x6935), WORD(0x74ae), WORD(0x5a1e), WORD(0x1cdb), WORD(0x70f3), WORD(0xe705),
+	WORD(0x2fa4), WORD(0xbebd), WORD(0x0c48), WORD(0x3e70), WORD(0x3214), WORD(0x325d),
+	WORD(0x3638), WORD(0x3e48),
+	/* 25G */
+	WORD(0xd8ad), WORD(0xc0e6), WORD(0x2cd5), WORD(0x9f27), WORD(0x43a2), WORD(0xe097),
+	WORD(0x687c), WORD(0x9e29), WORD(0x64b3), WORD(0x93cd), WORD(0x0d59), WORD(0xbe0e),
+	WORD(0x58f0), WORD(0x504b), WORD(0xa75d), WORD(0x5d57), WORD(0xb092), WORD(0x5d44),
+	WORD(0xa6e3), WORD(0x81a1), WORD(0x7868), WORD(0x310d), WORD(0x0169), WORD(0x38ad),
+	WORD(0x7b73), WORD(0xcc29), WORD(0xc9a6), WORD(0xc8d3), WORD(0x0814), WORD(0x908e),
+	WORD(0x8a19), WORD(0x34d9),
+	/* 27G */
+	WORD(0x7e1f), WORD(0xe5a5), WORD(0x46ad), WORD(0xffb9), WORD(0x6c5f), WORD(0x191b),
+	WORD(0x0aa2), WORD(0xf7ea), WORD(0x29c1), WORD(0x8df5), WORD(0x7058), WORD(0x52d0),
+	WORD(0xa727), WORD(0x2afd), WORD(0xbde5), WORD(0x06b7), WORD(0x8555), WORD(0x9065),
+	WORD(0x6dc9), WORD(0x651e), WORD(0x16ce), WORD(0x1fc4), WORD(0x0d89), WORD(0x8f91),
+	WORD(0x86d5), WORD(0xcbf0), WORD(0xd84e), WORD(0x0ba4), WORD(0x4b4a), WORD(0x0c4a),
+	WORD(0x158c), WORD(0x73da),
+	/* 29G */
+	WORD(0xb62c), WORD(0x521d), WORD(0x20a6), WORD(0xe224), WORD(0xeb6f), WORD(0xbc90),
+	WORD(0x1a21), WORD(0x8ebc), WORD(0x6eb4), WORD(0xe50f), WORD(0x9aac), WORD(0xe152),
+	WORD(0x35db), WORD(0x8be2), WORD(0xbf27), WORD(0x4025), WORD(0x2b82), WORD(0x9ffe),
+	WORD(0x7710), WORD(0x4060), WORD(0x4634), WORD(0x696b), WORD(0xb75b), WORD(0x7a6b),
+	WORD(0x25d3), WORD(0x2b2f), WORD(0x27a9), WORD(0x0cef), WORD(0x7112), WORD(0xca0b),
+	WORD(0xffd7), WORD(0x6c9c),
+	/* 31G */
+	WORD(0xc43b), WORD(0xeda5), WORD(0x9ff0), WORD(0x12b3), WORD(0xfe3f), WORD(0x54e0),
+	WORD(0xc66c), WORD(0x2e1f), WORD(0x9167), WORD(0x248a), WORD(0xea80), WORD(0xfb2d),
+	WORD(0xb322), WORD(0x3b2b), WORD(0xda10), WORD(0x11bc), WORD(0xc928), WORD(0x16d2),
+	WORD(0x6e84), WORD(0xfddf), WORD(0x87f4), WORD(0x36e8), WORD(0xf6a1), WORD(0x99dd),
+	WORD(0x92d6), WORD(0x9200), WORD(0xd2f3), WORD(0x1e56), WORD(0xae5a), WORD(0x2d77),
+	WORD(0x3bf4), WORD(0x6743),
+	/* 33G */
+	WORD(0x859f), WORD(0x09a3), WORD(0x2bc0), WORD(0xe230), WORD(0xf1fe), WORD(0x6ad0),
+	WORD(0x3267), WORD(0x0d9b), WORD(0x9752), WORD(0x486a), WORD(0x1c91), WORD(0x8765),
+	WORD(0x8858), WORD(0x6c11), WORD(0x85ea), WORD(0x66a3), WORD(0x18b6), WORD(0x3423),
+	WORD(0xf93a), WORD(0xb38b), WORD(0x4cf0), WORD(0xf2aa), WORD(0xe87e), WORD(0xa510),
+	WORD(0x89c2), WORD(0x391f), WORD(0xf047), WORD(0xdfcb), WORD(0x5aed), WORD(0xd890),
+	WORD(0xb4f1), WORD(0x4f92),
+	/* 35G */
+	WORD(0xc424), WORD(0x2053), WORD(0x6084), WORD(0xd3c8), WORD(0x9ac7), WORD(0xbd2a),
+	WORD(0xe9ae), WORD(0x5297), WORD(0x98bf), WORD(0x7b4d), WORD(0x1181), WORD(0x3c16),
+	WORD(0x23eb), WORD(0x28b7), WORD(0x2a02), WORD(0x355d), WORD(0x797f), WORD(0xa8f1),
+	WORD(0x36cd), WORD(0x4bac), WORD(0x5340), WORD(0x0de8), WORD(0x6c77), WORD(0x1f3d),
+	WORD(0xf333), WORD(0xdd90), WORD(0x6831), WORD(0x0593), WORD(0x501e), WORD(0x0946),
+	WORD(0x5301), WORD(0x1a89),
+	/* 37G */
+	WORD(0x9a61), WORD(0x63d4), WORD(0xf77e), WORD(0x25dd), WORD(0x7a08), WORD(0x00e9),
+	WORD(0x40dd), WORD(0x4833), WORD(0x2755), WORD(0xd185), WORD(0xe1b8), WORD(0x5cc3),
+	WORD(0xfea4), WORD(0xfda8), WORD(0x4a8c), WORD(0x0151), WORD(0x8f64), WORD(0xefd1),
+	WORD(0x05b0), WORD(0x6423), WORD(0x8ebd), WORD(0xb981), WORD(0xdd8e), WORD(0x72c6),
+	WORD(0xb25f), WORD(0xc0dc), WORD(0x304a), WORD(0x96e0), WORD(0x5814), WORD(0xaf2b),
+	WORD(0x774f), WORD(0x2f1a),
+	/* 39G */
+	WORD(0x9776), WORD(0x5a5c), WORD(0x3271), WORD(0x7810), WORD(0xddca), WORD(0xabc7),
+	WORD(0xe727), WORD(0x5910), WORD(0x5969), WORD(0x9a5c), WORD(0xba59), WORD(0xec0c),
+	WORD(0xde0c), WORD(0x3c4c), WORD(0x663a), WORD(0x38af), WORD(0x482c), WORD(0x0ad5),
+	WORD(0xf7f6), WORD(0xde1d), WORD(0xc116), WORD(0xb4f1), WORD(0x294c), WORD(0x2c18),
+	WORD(0xba92), WORD(0x067f), WORD(0x71f4), WORD(0x049b), WORD(0x7ace), WORD(0xd752),
+	WORD(0x4c8a), WORD(0x30a8),
+	/* 41G */
+	WORD(0x4eac), WORD(0x2c8c), WORD(0x3974), WORD(0xc3ef), WORD(0x9cec), WORD(0x892a),
+	WORD(0x7508), WORD(0xf071), WORD(0x83bd), WORD(0x287f), WORD(0x5a44), WORD(0x81c3),
+	WORD(0x8966), WORD(0x155f), WORD(0x9020), WORD(0x1b78), WORD(0x65ee), WORD(0x8760),
+	WORD(0xb3de), WORD(0x3b92), WORD(0x71c8), WORD(0x42f7), WORD(0x9717), WORD(0x0043),
+	WORD(0xcf9c), WORD(0x5116), WORD(0xeb1c), WORD(0xd4d2), WORD(0x9706), WORD(0x0a88),
+	WORD(0xb36c), WORD(0x032a),
+	/* 43G */
+	WORD(0xfb88), WORD(0x5a6b), WORD(0x1ec7), WORD(0x59a7), WORD(0xd1e7), WORD(0xcec6),
+	WORD(0x2100), WORD(0x0fd8), WORD(0x76cc), WORD(0x5622), WORD(0xba4e), WORD(0x9a53),
+	WORD(0xa862), WORD(0xba3c), WORD(0x912b), WORD(0x3a41), WORD(0xe16f), WORD(0xd65b),
+	WORD(0xd89b), WORD(0xe89e), WORD(0xcff2), WORD(0xc7e5), WORD(0x93f9), WORD(0x3df2),
+	WORD(0x6bfd), WORD(0x77f3), WORD(0x0c14), WORD(0xcefa), WORD(0x03fa), WORD(0x4dca),
+	WORD(0xb407), WORD(0x75f2),
+	/* 45G */
+	WORD(0x8bf5), WORD(0x2d57), WORD(0xf0a5), WORD(0x8b08), WORD(0xe9bc), WORD(0xbc95),
+	WORD(0xc5b9), WORD(0x812d), WORD(0x04df), WORD(0xf945), WORD(0x3ad9), WORD(0x3869),
+	WORD(0x7ef6), WORD(0x09ed), WORD(0xcdd1), WORD(0x3218), WORD(0xdd0a), WORD(0x320b),
+	WORD(0x29b1), WORD(0xd565), WORD(0x49d6), WORD(0xff54), WORD(0xf108), WORD(0xc974),
+	WORD(0x53ff), WORD(0x4ea8), WORD(0x69c7), WORD(0x557c), WORD(0x21f4), WORD(0x5250),
+	WORD(0x8869), WORD(0x29fb),
+	/* 47G */
+	WORD(0xd3cb), WORD(0x1e9f), WORD(0x0537), WORD(0xa106), WORD(0x4c39), WORD(0x7a39),
+	WORD(0xa7d0), WORD(0xfc81), WORD(0x4364), WORD(0x1bf9), WORD(0x7666), WORD(0x1a9c),
+	WORD(0xe583), WORD(0x804e), WORD(0xbfc5), WORD(0x709e), WORD(0x2602), WORD(0x016d),
+	WORD(0x596e), WORD(0xdcfd), WORD(0x81fb), WORD(0x3b38), WORD(0xb13f), WORD(0x336d),
+	WORD(0x0431), WORD(0x5d22), WORD(0xeb36), WORD(0x0b83), WORD(0x8179), WORD(0xb721),
+	WORD(0x8506), WORD(0x6e6c),
+	/* 49G */
+	WORD(0x7c9e), WORD(0x1e64), WORD(0x036a), WORD(0x4dc3), WORD(0xb2f7), WORD(0x0f78),
+	WORD(0x3eb0), WORD(0xc92f), WORD(0x10c9), WORD(0x046c), WORD(0x1b3d), WORD(0xaa59),
+	WORD(0x4c75), WORD(0xa285), WORD(0x71e9), WORD(0x5ff7), WORD(0x3721), WORD(0xb2cc),
+	WORD(0xff6f), WORD(0x5c98), WORD(0x04b8), WORD(0xea9b), WORD(0x1715), WORD(0xb01c),
+	WORD(0x10e9), WORD(0xc1b7), WORD(0xa4f5), WORD(0x21ab), WORD(0x8f44), WORD(0x1a18),
+	WORD(0x0491), WORD(0x7890),
+	/* 51G */
+	WORD(0x7c15), WORD(0x3e94), WORD(0xbd33), WORD(0xc1d0), WORD(0xb21c), WORD(0xbd67),
+	WORD(0x34ff), WORD(0x4be7), WORD(0xd33a), WORD(0xda13), WORD(0x706a), WORD(0xc9f0),
+	WORD(0x29a4), WORD(0x59b8), WORD(0xc489), WORD(0x6661), WORD(0xf762), WORD(0x9b2f),
+	WORD(0xd5fa), WORD(0xf2fa), WORD(0x62e8), WORD(0xf580), WORD(0xd51f), WORD(0xd8fa),
+	WORD(0xe4a2), WORD(0xfc99), WORD(0x46ce), WORD(0x62ab), WORD(0xcfdc), WORD(0x1b25),
+	WORD(0xd774), WORD(0x1b3a),
+	/* 53G */
+	WORD(0x2125), WORD(0xeac4), WORD(0x2171), WORD(0x66d1), WORD(0x1a27), WORD(0x393b),
+	WORD(0x0293), WORD(0x89e8), WORD(0x65fa), WORD(0xfc78), WORD(0x62b7), WORD(0x16c7),
+	WORD(0x5d44), WORD(0x77e4), WORD(0x386c), WORD(0x2e1a), WORD(0x9164), WORD(0xc386),
+	WORD(0xe1ac), WORD(0x701b), WORD(0x155c), WORD(0x1656), WORD(0x034f), WORD(0x4a62),
+	WORD(0x856a), WORD(0x2af9), WORD(0xde3e), WORD(0xc7d9), WORD(0x073d), WORD(0x3102),
+	WORD(0x84a2), WORD(0x4203),
+	/* 55G */
+	WORD(0xc3e2), WORD(0x1e4f), WORD(0xb122), WORD(0x1c54), WORD(0x0512), WORD(0xd797),
+	WORD(0xc7d2), WORD(0x3dd0), WORD(0xe041), WORD(0x3c43), WORD(0x15ff), WORD(0x6b5b),
+	WORD(0x0688), WORD(0x1cc5), WORD(0x7a79), WORD(0x583b), WORD(0xa40d), WORD(0x3b31),
+	WORD(0x798b), WORD(0x0db0), WORD(0xed19), WORD(0x64a1), WORD(0x990d), WORD(0x9305),
+	WORD(0xfda0), WORD(0x0bc5), WORD(0x92bd), WORD(0xa632), WORD(0xe292), WORD(0x00a4),
+	WORD(0x61ec), WORD(0x7c9f),
+	/* 57G */
+	WORD(0x85a2), WORD(0x713f), WORD(0x8434), WORD(0x903e), WORD(0x948e), WORD(0xde13),
+	WORD(0x256a), WORD(0xd912), WORD(0x4189), WORD(0x0a7c), WORD(0xf80a), WORD(0xb485),
+	WORD(0xecdc), WORD(0x1881), WORD(0x1dd8), WORD(0x2f3a), WORD(0x61b6), WORD(0xef50),
+	WORD(0x2beb), WORD(0x184f), WORD(0x07ea), WORD(0xc2cb), WORD(0x6ad2), WORD(0xfc79),
+	WORD(0x2b21), WORD(0x787a), WORD(0x06cb), WORD(0x267b), WORD(0x63dd), WORD(0x8cb8),
+	WORD(0x6897), WORD(0x5cca),
+	/* 59G */
+	WORD(0x187f), WORD(0xb1bf), WORD(0xc915), WORD(0x4423), WORD(0x156a), WORD(0x9830),
+	WORD(0x6569), WORD(0xe8b6), WORD(0x6596), WORD(0x4fe8), WORD(0x59e7), WORD(0xecea),
+	WORD(0x808b), WORD(0x668d), WORD(0x12f2), WORD(0x3504), WORD(0x3208), WORD(0xe29f),
+	WORD(0x139b), WORD(0xc592), WORD(0xb715), WORD(0x24df), WORD(0x3b24), WORD(0xfcd4),
+	WORD(0x0125), WORD(0xcb4e), WORD(0x42b1), WORD(0xd1ee), WORD(0x0f09), WORD(0xa622),
+	WORD(0xae3f), WORD(0x0e70),
+	/* 61G */
+	WORD(0x2b6f), WORD(0x0d01), WORD(0xfe47), WORD(0x712f), WORD(0x0c9a), WORD(0x029c),
+	WORD(0x89dc), WORD(0x6a77), WORD(0x92b0), WORD(0x88d9), WORD(0xc599), WORD(0xfbf1),
+	WORD(0xe569), WORD(0xf625), WORD(0xcfc8), WORD(0x20ea), WORD(0xbafa), WORD(0x9841),
+	WORD(0x8ed7), WORD(0xe613), WORD(0x5f0f), WORD(0x5a51), WORD(0xa3a6), WORD(0x3329),
+	WORD(0x83c9), WORD(0x2dce), WORD(0x40d8), WORD(0x8e67), WORD(0xbb74), WORD(0xd071),
+	WORD(0xf691), WORD(0x4a83),
+	/* 63G */
+	WORD(0x0ed1), WORD(0xb590), WORD(0xb7f4), WORD(0xdb9c), WORD(0xce2e), WORD(0xfd10),
+	WORD(0x9696), WORD(0x467d), WORD(0xc0a3), WORD(0x077c), WORD(0x7bbd), WORD(0xa719),
+	WORD(0xc43c), WORD(0xd7c0), WORD(0x44a0), WORD(0x517b), WORD(0x6c5b), WORD(0xba71),
+	WORD(0x0317), WORD(0xfa06), WORD(0x1162), WORD(0xc4a4), WORD(0xcc7c), WORD(0x68c8),
+	WORD(0xf1da), WORD(0xeb13), WORD(0x7bc6), WORD(0x752d), WORD(0xf365), WORD(0xb2d8),
+	WORD(0xc184), WORD(0x059d),
+};
+#else                     /* unknown word size */
+#error "Unsupported word size"
+#endif
+TO_EC_GEN_TABLE_PARAM(GOST_256bits_curve_gen_wnaf, 7);
+
+/*
+ * Signed comb of the generator for the fixed base multiplications (6
+ * teeth, spacing 43), affine x and y in Montgomery representation
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+static const word_t GOST_256bits_curve_gen_comb[] = {
+	/* T[0] */
+	WORD(0xe831c01cdcd42c56), WORD(0x5c873feee69ef535),
+	WORD(0x88b8ed0fb702a017), WORD(0x55c7992c4f2f5ebd),
+	WORD(0x61423aae4aff38a4), WORD(0xb3e76eecf7ad7ce0),
+	WORD(0x7a8be0b8608ba0b9), WORD(0x5eb4d519d721ffc1),
+	/* T[1] */
+	WORD(0x25185e261a25bbd2), WORD(0x0b991905341c8b0a),
+	WORD(0xc608cdce9b9774d9), WORD(0x3e8158c5d03eb494),
+	WORD(0xe1fdb29dd2693968), WORD(0x1bf902c526708d52),
+	WORD(0x69b4c982f83c931f), WORD(0x3b49af9ad1d5b332),
+	/* T[2] */
+	WORD(0xcce022c9e3619e33), WORD(0x71e7e330a1c858ef),
+	WORD(0x5ad82bef18104133), WORD(0x258532469a124763),
+	WORD(0x63ef997fae6aa9e8), WORD(0xd48c236723f38cda),
+	WORD(0x4ba2b568de18a64e), WORD(0x2cb833fd9b0ad37e),
+	/* T[3] */
+	WORD(0x5c0692374b29db70), WORD(0xd8ec0a21e021d7f3),
+	WORD(0xf08d699f6b7c59c6), WORD(0x1032907bceb53b64),
+	WORD(0xcf92a720c00f34a6), WORD(0x3f6418ab6f8da133),
+	WORD(0x6b282eefc5052ec0), WORD(0x54b15b0575f25dfd),
+	/* T[4] */
+	WORD(0xd9fcd72ea574857a), WORD(0xaf655c008399046e),
+	WORD(0x611e0dea61119885), WORD(0x6ec94b4c060281e0),
+	WORD(0x18c26f5cdfea08bc), WORD(0xde89f33c65a90c36),
+	WORD(0x67c4b50e2d659d0a), WORD(0x6454805f6befb7c6),
+	/* T[5] */
+	WORD(0x15333bfcbb380375), WORD(0x6890957aee96673b),
+	WORD(0xc47611d76a28b793), WORD(0x133697ee3b243e97),
+	WORD(0x8ba08633a4e69e42), WORD(0xe1b6fbfbeec6823f),
+	WORD(0x6d2d2a0f940d49c5), WORD(0x2b129dc9d9078327),
+	/* T[6] */
+	WORD(0x0c7c09237a343236), WORD(0x531d94fdd7ac8650),
+	WORD(0x8e8e3764bec94b76), WORD(0x15ac53cc7e7b4c73),
+	WORD(0x99af5d5052c1be9f), WORD(0x9243f4375d1d84a9),
+	WORD(0x271ceb158cbc6176), WORD(0x7add1856338f3d19),
+	/* T[7] */
+	WORD(0x16deb3b11c39fb3e), WORD(0x32ca9b69b6cd3fd6),
+	WORD(0x8b7d2720d45481c1), WORD(0x23af336596512e61),
+	WORD(0x86ecba38fd5a2fa0), WORD(0xd29ced0528a28f86),
+	WORD(0xd2764ad4aa14c097), WORD(0x27356edf929790e8),
+	/* T[8] */
+	WORD(0x344ed11994349706), WORD(0xebdf06b3e530ca42),
+	WORD(0x9a7d24b7ab24c950), WORD(0x0a4c160c56026237),
+	WORD(0xdc4cda1380f46bdb), WORD(0x58c9ac6927a19ffd),
+	WORD(0x851a864a410b8a91), WORD(0x233e450c811c1660),
+	/* T[9] */
+	WORD(0x4cc5bfa5fb82957d), WORD(0x54eccf486c952231),
+	WORD(0x94261a6d7435960e), WORD(0x2ca422752de5a3f8),
+	WORD(0x6e4a03f7da30e142), WORD(0x602f088168396c21),
+	WORD(0xca1625ad572ec01a), WORD(0x3543114c14ca218f),
+	/* T[10] */
+	WORD(0x47b2f51ce88fca28), WORD(0x489343eccf808440),
+	WORD(0x5e5b3ec7ffe3428e), WORD(0x3f7941ca2bf17f0e),
+	WORD(0x0cd6ec1c35203162), WORD(0xc2121d8652c32e75),
+	WORD(0x53b09c595ecc8d5f), WORD(0x3068662f7483cb29),
+	/* T[11] */
+	WORD(0x439fc79a6fcf5d1e), WORD(0x8bf3f5e106ec2d89),
+	WORD(0xffee92fa041315e3), WORD(0x098d222e6a6e52e5),
+	WORD(0x75f8c1f36e7e1573), WORD(0xd0a4433814af5e68),
+	WORD(0x9f5b6dde80667ea4), WORD(0x7adbbed4885dbe8f),
+	/* T[12] */
+	WORD(0xcccdd111961a92b0), WORD(0xd9245b7743041b9f),
+	WORD(0xf822f2c2e2a6a8ed), WORD(0x78078555e029a705),
+	WORD(0x1b0210e0c70a7f35), WORD(0x2bf9ab5d764435b3),
+	WORD(0xbde2619874b80e5b), WORD(0x2f9abb272968bb90),
+	/* T[13] */
+	WORD(0xcb5c77d07372b216), WORD(0x8a27f0b0c28cb032),
+	WORD(0x5061c670db284170), WORD(0x10a3b639430551a1),
+	WORD(0xee2239d790d9cc75), WORD(0xc40b0f863551797a),
+	WORD(0x16e1b108def13847), WORD(0x307c0e9d243bde27),
+	/* T[14] */
+	WORD(0x06d41b8e95e2262c), WORD(0x910bf3e6861026b3),
+	WORD(0x850ae66f1349b668), WORD(0x79240510c6a767a3),
+	WORD(0xc13b27423a6d8e37), WORD(0x5cbfbd9a34ba93c3),
+	WORD(0x0290e98497b57921), WORD(0x2e0b67962a9a670e),
+	/* T[15] */
+	WORD(0xe5d84c6918cb51f3), WORD(0x93a3528237aa95b0),
+	WORD(0xc4493a060a5b95fa), WORD(0x158050fdf51fa737),
+	WORD(0x4e1e415fbc5fb046), WORD(0x527910286e318cab),
+	WORD(0x476214d16c20204c), WORD(0x7216f15a2f4ca908),
+	/* T[16] */
+	WORD(0x061f645081825a2c), WORD(0xdbdd32646f69ce13),
+	WORD(0x6c7f2ad0bf8dc3d2), WORD(0x6ef10ad1d59e01fe),
+	WORD(0x80db9c8f4489776d), WORD(0x2d3e2d9bd919315d),
+	WORD(0xa02e4fb2d31dd530), WORD(0x509f4728244157cf),
+	/* T[17] */
+	WORD(0xd2ca1726fb040f35), WORD(0xb988abd904a41501),
+	WORD(0x86e43d4f9fe5d2ae), WORD(0x4ea819c080ccc176),
+	WORD(0xa99b8a901de47bc5), WORD(0x403f821c5a2ae5d5),
+	WORD(0x47597057a4c73e51), WORD(0x7917cd08a5e62934),
+	/* T[18] */
+	WORD(0xc4207cedcef2ffd8), WORD(0x147349bb879afb50),
+	WORD(0xe879cfe783753a45), WORD(0x3b901617d5cb33e9),
+	WORD(0x530577c2a1b43034), WORD(0x35ce2407114a6888),
+	WORD(0x891ea606e8530fc7), WORD(0x4d0648eb812b220e),
+	/* T[19] */
+	WORD(0x9a28a32143339ffb), WORD(0x066882f244ddaa05),
+	WORD(0x562f5c86754c955d), WORD(0x0ab02b37183fa313),
+	WORD(0x66ca8ac0c50870b9), WORD(0xf75981b1380a4946),
+	WORD(0x6f6a926c741f722c), WORD(0x6a41254ae9e366db),
+	/* T[20] */
+	WORD(0x565ff5cb55f729b4), WORD(0x48462fa5f43ebac1),
+	WORD(0x1b79e3868db75e74), WORD(0x51079df8eef2bada),
+	WORD(0x57f8d3d8af15ab99), WORD(0x0b5ddf851f14307f),
+	WORD(0x019aafbbcb1fc288), WORD(0x510bc0f720b018d4),
+	/* T[21] */
+	WORD(0xb3b3c3b4226703e7), WORD(0x97def3f3bfdcf567),
+	WORD(0xbebb35ff68fd7463), WORD(0x1de8d06548716d53),
+	WORD(0x1fda4cea067b1695), WORD(0xfb233c346b621234),
+	WORD(0x431f4ae228443503), WORD(0x1dc1f844b815974b),
+	/* T[22] */
+	WORD(0x000671a1da5e6169), WORD(0x70cab6c94b293899),
+	WORD(0x64ff28f51a49319a), WORD(0x7c7339f4053e8159),
+	WORD(0x4a73a3b8206ba1b8), WORD(0xa0df23add5aa479c),
+	WORD(0x7a0fc38e2fd2f833), WORD(0x590fab0c98a28ce9),
+	/* T[23] */
+	WORD(0x74507ac0682fb332), WORD(0x9bef3acd9eaf08f5),
+	WORD(0xeeff72aaca3b982d), WORD(0x5dd8a6ee930de950),
+	WORD(0xb8f42c12b5de23fa), WORD(0x3bf8927fb57019cb),
+	WORD(0x8635d497577eac6b), WORD(0x7793b12ef0d27595),
+	/* T[24] */
+	WORD(0x11e4ce6077365954), WORD(0x612231646b3a8152),
+	WORD(0xef30bc926a07c30c), WORD(0x4966183a98f52f05),
+	WORD(0x9ad3a313e8c3da97), WORD(0x755498ec6c3115cb),
+	WORD(0xa69bbb473bb3845b), WORD(0x019d6463ac350814),
+	/* T[25] */
+	WORD(0x075fb520a629ed4c), WORD(0x9bbea4a035f9a7aa),
+	WORD(0x404c08b8d56d1898), WORD(0x7bea957c67bb40ff),
+	WORD(0x7e3b5f55b678aaa3), WORD(0xdadf0da2e285316d),
+	WORD(0x98b385bd563a102b), WORD(0x57cdf7d18a01930f),
+	/* T[26] */
+	WORD(0x733c8ddbcad5edbf), WORD(0x11d2d428d7ed1ac0),
+	WORD(0x1d41379f17929801), WORD(0x5a5c9c17fae07376),
+	WORD(0xf24ac4fd4ea99106), WORD(0x71f5461cdaaa6b23),
+	WORD(0xc2daa8fdef7decdd), WORD(0x53a2b97b1467ee4f),
+	/* T[27] */
+	WORD(0x2f1a9ee7ebb4c23b), WORD(0x87505c88e17197ce),
+	WORD(0x7d3df8e6ae65cab6), WORD(0x2339ea45060ee4f0),
+	WORD(0x7bab660d46a7a6c9), WORD(0x04ce25151307f389),
+	WORD(0x77408d9a4e5ea021), WORD(0x34c7c5d3cdc43071),
+	/* T[28] */
+	WORD(0x5ded80cade3be088), WORD(0x2ce42dd9f5bd5d1b),
+	WORD(0x12d5f05c6f434705), WORD(0x5d3d4337a33befe7),
+	WORD(0xe95722cfa07eb7bc), WORD(0xa198a10a1a7369d8),
+	WORD(0xf9f10225de5d5801), WORD(0x5a3556c99411fb97),
+	/* T[29] */
+	WORD(0xea3ac97167255908), WORD(0xc07b09aaef312fbf),
+	WORD(0xa191ad8e3c9a0651), WORD(0x4c68fb38e1a29e26),
+	WORD(0x4f92c3388ac88cf9), WORD(0x2e5f6d458d62f6bd),
+	WORD(0x6a6ab2d7ffadafdd), WORD(0x03ebae6b82b51982),
+	/* T[30] */
+	WORD(0x178aa8cf1c1f99d2), WORD(0x337419b303d43a79),
+	WORD(0x1b466c5dce1981ee), WORD(0x7abfc09c98b485de),
+	WORD(0x74dc67b4c3df7e40), WORD(0x01bcdee5a00a4187),
+	WORD(0xc29f4e4d1cf9ba28), WORD(0x3a5f728bc8b0bc57),
+	/* T[31] */
+	WORD(0x57ee8f25bc445646), WORD(0x54bb32f58a1eb616),
+	WORD(0xc2e8c1f4a87e9f3f), WORD(0x0716ae17c99d22dc),
+	WORD(0x728591733b3b2eb5), WORD(0xfc4cb247b3cd3647),
+	WORD(0x1fc39f24f08266a7), WORD(0x44fdc2b9e064c681),
+};
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+static const word_t GOST_256bits_curve_gen_comb[] = {
+	/* T[0] */
+	WORD(0xdcd42c56), WORD(0xe831c01c), WORD(0xe69ef535), WORD(0x5c873fee),
+	WORD(0xb702a017), WORD(0x88b8ed0f), WORD(0x4f2f5ebd), WORD(0x55c7992c),
+	WORD(0x4aff38a4), WORD(0x61423aae), WORD(0xf7ad7ce0), WORD(0xb3e76eec),
+	WORD(0x608ba0b9), WORD(0x7a8be0b8), WORD(0xd721ffc1), WORD(0x5eb4d519),
+	/* T[1] */
+	WORD(0x1a25bbd2), WORD(0x25185e26), WORD(0x341c8b0a), WORD(0x0b991905),
+	WORD(0x9b9774d9), WORD(0xc608cdce), WORD(0xd03eb494), WORD(0x3e8158c5),
+	WORD(0xd2693968), WORD(0xe1fdb29d), WORD(0x26708d52), WORD(0x1bf902c5),
+	WORD(0xf83c931f), WORD(0x69b4c982), WORD(0xd1d5b332), WORD(0x3b49af9a),
+	/* T[2] */
+	WORD(0xe3619e33), WORD(0xcce022c9), WORD(0xa1c858ef), WORD(0x71e7e330),
+	WORD(0x18104133), WORD(0x5ad82bef), WORD(0x9a124763), WORD(0x25853246),
+	WORD(0xae6aa9e8), WORD(0x63ef997f), WORD(0x23f38cda), WORD(0xd48c2367),
+	WORD(0xde18a64e), WORD(0x4ba2b568), WORD(0x9b0ad37e), WORD(0x2cb833fd),
+	/* T[3] */
+	WORD(0x4b29db70), WORD(0x5c069237), WORD(0xe021d7f3), WORD(0xd8ec0a21),
+	WORD(0x6b7c59c6), WORD(0xf08d699f), WORD(0xceb53b64), WORD(0x1032907b),
+	WORD(0xc00f34a6), WORD(0xcf92a720), WORD(0x6f8da133), WORD(0x3f6418ab),
+	WORD(0xc5052ec0), WORD(0x6b282eef), WORD(0x75f25dfd), WORD(0x54b15b05),
+	/* T[4] */
+	WORD(0xa574857a), WORD(0xd9fcd72e), WORD(0x8399046e), WORD(0xaf655c00),
+	WORD(0x61119885), WORD(0x611e0dea), WORD(0x060281e0), WORD(0x6ec94b4c),
+	WORD(0xdfea08bc), WORD(0x18c26f5c), WORD(0x65a90c36), WORD(0xde89f33c),
+	WORD(0x2d659d0a), WORD(0x67c4b50e), WORD(0x6befb7c6), WORD(0x6454805f),
+	/* T[5] */
+	WORD(0xbb380375), WORD(0x15333bfc), WORD(0xee96673b), WORD(0x6890957a),
+	WORD(0x6a28b793), WORD(0xc47611d7), WORD(0x3b243e97), WORD(0x133697ee),
+	WORD(0xa4e69e42), WORD(0x8ba08633), WORD(0xeec6823f), WORD(0xe1b6fbfb),
+	WORD(0x940d49c5), WORD(0x6d2d2a0f), WORD(0xd9078327), WORD(0x2b129dc9),
+	/* T[6] */
+	WORD(0x7a343236), WORD(0x0c7c0923), WORD(0xd7ac8650), WORD(0x531d94fd),
+	WORD(0xbec94b76), WORD(0x8e8e3764), WORD(0x7e7b4c73), WORD(0x15ac53cc),
+	WORD(0x52c1be9f), WORD(0x99af5d50), WORD(0x5d1d84a9), WORD(0x9243f437),
+	WORD(0x8cbc6176), WORD(0x271ceb15), WORD(0x338f3d19), WORD(0x7add1856),
+	/* T[7] */
+	WORD(0x1c39fb3e), WORD(0x16deb3b1), WORD(0xb6cd3fd6), WORD(0x32ca9b69),
+	WORD(0xd45481c1), WORD(0x8b7d2720), WORD(0x96512e61), WORD(0x23af3365),
+	WORD(0xfd5a2fa0), WORD(0x86ecba38), WORD(0x28a28f86), WORD(0xd29ced05),
+	WORD(0xaa14c097), WORD(0xd2764ad4), WORD(0x929790e8), WORD(0x27356edf),
+	/* T[8] */
+	WORD(0x94349706), WORD(0x344ed119), WORD(0xe530ca42), WORD(0xebdf06b3),
+	WORD(0xab24c950), WORD(0x9a7d24b7), WORD(0x56026237), WORD(0x0a4c160c),
+	WORD(0x80f46bdb), WORD(0xdc4cda13), WORD(0x27a19ffd), WORD(0x58c9ac69),
+	WORD(0x410b8a91), WORD(0x851a864a), WORD(0x811c1660), WORD(0x233e450c),
+	/* T[9] */
+	WORD(0xfb82957d), WORD(0x4cc5bfa5), WORD(0x6c952231), WORD(0x54eccf48),
+	WORD(0x7435960e), WORD(0x94261a6d), WORD(0x2de5a3f8), WORD(0x2ca42275),
+	WORD(0xda30e142), WORD(0x6e4a03f7), WORD(0x68396c21), WORD(0x602f0881),
+	WORD(0x572ec01a), WORD(0xca1625ad), WORD(0x14ca218f), WORD(0x3543114c),
+	/* T[10] */
+	WORD(0xe88fca28), WORD(0x47b2f51c), WORD(0xcf808440), WORD(0x489343ec),
+	WORD(0xffe3428e), WORD(0x5e5b3ec7), WORD(0x2bf17f0e), WORD(0x3f7941ca),
+	WORD(0x35203162), WORD(0x0cd6ec1c), WORD(0x52c32e75), WORD(0xc2121d86),
+	WORD(0x5ecc8d5f), WORD(0x53b09c59), WORD(0x7483cb29), WORD(0x3068662f),
+	/* T[11] */
+	WORD(0x6fcf5d1e), WORD(0x439fc79a), WORD(0x06ec2d89), WORD(0x8bf3f5e1),
+	WORD(0x041315e3), WORD(0xffee92fa), WORD(0x6a6e52e5), WORD(0x098d222e),
+	WORD(0x6e7e1573), WORD(0x75f8c1f3), WORD(0x14af5e68), WORD(0xd0a44338),
+	WORD(0x80667ea4), WORD(0x9f5b6dde), WORD(0x885dbe8f), WORD(0x7adbbed4),
+	/* T[12] */
+	WORD(0x961a92b0), WORD(0xcccdd111), WORD(0x43041b9f), WORD(0xd9245b77),
+	WORD(0xe2a6a8ed), WORD(0xf822f2c2), WORD(0xe029a705), WORD(0x78078555),
+	WORD(0xc70a7f35), WORD(0x1b0210e0), WORD(0x764435b3), WORD(0x2bf9ab5d),
+	WORD(0x74b80e5b), WORD(0xbde26198), WORD(0x2968bb90), WORD(0x2f9abb27),
+	/* T[13] */
+	WORD(0x7372b216), WORD(0xcb5c77d0), WORD(0xc28cb032), WORD(0x8a27f0b0),
+	WORD(0xdb284170), WORD(0x5061c670), WORD(0x430551a1), WORD(0x10a3b639),
+	WORD(0x90d9cc75), WORD(0xee2239d7), WORD(0x3551797a), WORD(0xc40b0f86),
+	WORD(0xdef13847), WORD(0x16e1b108), WORD(0x243bde27), WORD(0x307c0e9d),
+	/* T[14] */
+	WORD(0x95e2262c), WORD(0x06d41b8e), WORD(0x861026b3), WORD(0x910bf3e6),
+	WORD(0x1349b668), WORD(0x850ae66f), WORD(0xc6a767a3), WORD(0x79240510),
+	WORD(0x3a6d8e37), WORD(0xc13b2742), WORD(0x34ba93c3), WORD(0x5cbfbd9a),
+	WORD(0x97b57921), WORD(0x0290e984), WORD(0x2a9a670e), WORD(0x2e0b6796),
+	/* T[15] */
+	WORD(0x18cb51f3), WORD(0xe5d84c69), WORD(0x37aa95b0), WORD(0x93a35282),
+	WORD(0x0a5b95fa), WORD(0xc4493a06), WORD(0xf51fa737), WORD(0x158050fd),
+	WORD(0xbc5fb046), WORD(0x4e1e415f), WORD(0x6e318cab), WORD(0x52791028),
+	WORD(0x6c20204c), WORD(0x476214d1), WORD(0x2f4ca908), WORD(0x7216f15a),
+	/* T[16] */
+	WORD(0x81825a2c), WORD(0x061f6450), WORD(0x6f69ce13), WORD(0xdbdd3264),
+	WORD(0xbf8dc3d2), WORD(0x6c7f2ad0), WORD(0xd59e01fe), WORD(0x6ef10ad1),
+	WORD(0x4489776d), WORD(0x80db9c8f), WORD(0xd919315d), WORD(0x2d3e2d9b),
+	WORD(0xd31dd530), WORD(0xa02e4fb2), WORD(0x244157cf), WORD(0x509f4728),
+	/* T[17] */
+	WORD(0xfb040f35), WORD(0xd2ca1726), WORD(0x04a41501), WORD(0xb988abd9),
+	WORD(0x9fe5d2ae), WORD(0x86e43d4f), WORD(0x80ccc176), WORD(0x4ea819c0),
+	WORD(0x1de47bc5), WORD(0xa99b8a90), WORD(0x5a2ae5d5), WORD(0x403f821c),
+	WORD(0xa4c73e51), WORD(0x47597057), WORD(0xa5e62934), WORD(0x7917cd08),
+	/* T[18] */
+	WORD(0xcef2ffd8), WORD(0xc4207ced), WORD(0x879afb50), WORD(0x147349bb),
+	WORD(0x83753a45), WORD(0xe879cfe7), WORD(0xd5cb33e9), WORD(0x3b901617),
+	WORD(0xa1b43034), WORD(0x530577c2), WORD(0x114a6888), WORD(0x35ce2407),
+	WORD(0xe8530fc7), WORD(0x891ea606), WORD(0x812b220e), WORD(0x4d0648eb),
+	/* T[19] */
+	WORD(0x43339ffb), WORD(0x9a28a321), WORD(0x44ddaa05), WORD(0x066882f2),
+	WORD(0x754c955d), WORD(0x562f5c86), WORD(0x183fa313), WORD(0x0ab02b37),
+	WORD(0xc50870b9), WORD(0x66ca8ac0), WORD(0x380a4946), WORD(0xf75981b1),
+	WORD(0x741f722c), WORD(0x6f6a926c), WORD(0xe9e366db), WORD(0x6a41254a),
+	/* T[20] */
+	WORD(0x55f729b4), WORD(0x565ff5cb), WORD(0xf43ebac1), WORD(0x48462fa5),
+	WORD(0x8db75e74), WORD(0x1b79e386), WORD(0xeef2bada), WORD(0x51079df8),
+	WORD(0xaf15ab99), WORD(0x57f8d3d8), WORD(0x1f14307f), WORD(0x0b5ddf85),
+	WORD(0xcb1fc288), WORD(0x019aafbb), WORD(0x20b018d4), WORD(0x510bc0f7),
+	/* T[21] */
+	WORD(0x226703e7), WORD(0xb3b3c3b4), WORD(0xbfdcf567), WORD(0x97def3f3),
+	WORD(0x68fd7463), WORD(0xbebb35ff), WORD(0x48716d53), WORD(0x1de8d065),
+	WORD(0x067b1695), WORD(0x1fda4cea), WORD(0x6b621234), WORD(0xfb233c34),
+	WORD(0x28443503), WORD(0x431f4ae2), WORD(0xb815974b), WORD(0x1dc1f844),
+	/* T[22] */
+	WORD(0xda5e6169), WORD(0x000671a1), WORD(0x4b293899), WORD(0x70cab6c9),
+	WORD(0x1a49319a), WORD(0x64ff28f5), WORD(0x053e8159), WORD(0x7c7339f4),
+	WORD(0x206ba1b8), WORD(0x4a73a3b8), WORD(0xd5aa479c), WORD(0xa0df23ad),
+	WORD(0x2fd2f833), WORD(0x7a0fc38e), WORD(0x98a28ce9), WORD(0x590fab0c),
+	/* T[23] */
+	WORD(0x682fb332), WORD(0x74507ac0), WORD(0x9eaf08f5), WORD(0x9bef3acd),
+	WORD(0xca3b982d), WORD(0xeeff72aa), WORD(0x930de950), WORD(0x5dd8a6ee),
+	WORD(0xb5de23fa), WORD(0xb8f42c12), WORD(0xb57019cb), WORD(0x3bf8927f),
+	WORD(0x577eac6b), WORD(0x8635d497), WORD(0xf0d27595), WORD(0x7793b12e),
+	/* T[24] */
+	WORD(0x77365954), WORD(0x11e4ce60), WORD(0x6b3a8152), WORD(0x61223164),
+	WORD(0x6a07c30c), WORD(0xef30bc92), WORD(0x98f52f05), WORD(0x4966183a),
+	WORD(0xe8c3da97), WORD(0x9ad3a313), WORD(0x6c3115cb), WORD(0x755498ec),
+	WORD(0x3bb3845b), WORD(0xa69bbb47), WORD(0xac350814), WORD(0x019d6463),
+	/* T[25] */
+	WORD(0xa629ed4c), WORD(0x075fb520), WORD(0x35f9a7aa), WORD(0x9bbea4a0),
+	WORD(0xd56d1898), WORD(0x404c08b8), WORD(0x67bb40ff), WORD(0x7bea957c),
+	WORD(0xb678aaa3), WORD(0x7e3b5f55), WORD(0xe285316d), WORD(0xdadf0da2),
+	WORD(0x563a102b), WORD(0x98b385bd), WORD(0x8a01930f), WORD(0x57cdf7d1),
+	/* T[26] */
+	WORD(0xcad5edbf), WORD(0x733c8ddb), WORD(0xd7ed1ac0), WORD(0x11d2d428),
+	WORD(0x17929801), WORD(0x1d41379f), WORD(0xfae07376), WORD(0x5a5c9c17),
+	WORD(0x4ea99106), WORD(0xf24ac4fd), WORD(0xdaaa6b23), WORD(0x71f5461c),
+	WORD(0xef7decdd), WORD(0xc2daa8fd), WORD(0x1467ee4f), WORD(0x53a2b97b),
+	/* T[27] */
+	WORD(0xebb4c23b), WORD(0x2f1a9ee7), WORD(0xe17197ce), WORD(0x87505c88),
+	WORD(0xae65cab6), WORD(0x7d3df8e6), WORD(0x060ee4f0), WORD(0x2339ea45),
+	WORD(0x46a7a6c9), WORD(0x7bab660d), WORD(0x1307f389), WORD(0x04ce2515),
+	WORD(0x4e5ea021), WORD(0x77408d9a), WORD(0xcdc43071), WORD(0x34c7c5d3),
+	/* T[28] */
+	WORD(0xde3be088), WORD(0x5ded80ca), WORD(0xf5bd5d1b), WORD(0x2ce42dd9),
+	WORD(0x6f434705), WORD(0x12d5f05c), WORD(0xa33befe7), WORD(0x5d3d4337),
+	WORD(0xa07eb7bc), WORD(0xe95722cf), WORD(0x1a7369d8), WORD(0xa198a10a),
+	WORD(0xde5d5801), WORD(0xf9f10225), WORD(0x9411fb97), WORD(0x5a3556c9),
+	/* T[29] */
+	WORD(0x67255908), WORD(0xea3ac971), WORD(0xef312fbf), WORD(0xc07b09aa),
+	WORD(0x3c9a0651), WORD(0xa191ad8e), WORD(0xe1a29e26), WORD(0x4c68fb38),
+	WORD(0x8ac88cf9), WORD(0x4f92c338), WORD(0x8d62f6bd), WORD(0x2e5f6d45),
+	WORD(0xffadafdd), WORD(0x6a6ab2d7), WORD(0x82b51982), WORD(0x03ebae6b),
+	/* T[30] */
+	WORD(0x1c1f99d2), WORD(0x178aa8cf), WORD(0x03d43a79), WORD(0x337419b3),
+	WORD(0xce1981ee), WORD(0x1b466c5d), WORD(0x98b485de), WORD(0x7abfc09c),
+	WORD(0xc3df7e40), WORD(0x74dc67b4), WORD(0xa00a4187), WORD(0x01bcdee5),
+	WORD(0x1cf9ba28), WORD(0xc29f4e4d), WORD(0xc8b0bc57), WORD(0x3a5f728b),
+	/* T[31] */
+	WORD(0xbc445646), WORD(0x57ee8f25), WORD(0x8a1eb616), WORD(0x54bb32f5),
+	WORD(0xa87e9f3f), WORD(0xc2e8c1f4), WORD(0xc99d22dc), WORD(0x0716ae17),
+	WORD(0x3b3b2eb5), WORD(0x72859173), WORD(0xb3cd3647), WORD(0xfc4cb247),
+	WORD(0xf08266a7), WORD(0x1fc39f24), WORD(0xe064c681), WORD(0x44fdc2b9),
+};
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+static const word_t GOST_256bits_curve_gen_comb[] = {
+	/* T[0] */
+	WORD(0x2c56), WORD(0xdcd4), WORD(0xc01c), WORD(0xe831), WORD(0xf535), WORD(0xe69e),
+	WORD(0x3fee), WORD(0x5c87), WORD(0xa017), WORD(0xb702), WORD(0xed0f), WORD(0x88b8),
+	WORD(0x5ebd), WORD(0x4f2f), WORD(0x992c), WORD(0x55c7), WORD(0x38a4), WORD(0x4aff),
+	WORD(0x3aae), WORD(0x6142), WORD(0x7ce0), WORD(0xf7ad), WORD(0x6eec), WORD(0xb3e7),
+	WORD(0xa0b9), WORD(0x608b), WORD(0xe0b8), WORD(0x7a8b), WORD(0xffc1), WORD(0xd721),
+	WORD(0xd519), WORD(0x5eb4),
+	/* T[1] */
+	WORD(0xbbd2), WORD(0x1a25), WORD(0x5e26), WORD(0x2518), WORD(0x8b0a), WORD(0x341c),
+	WORD(0x1905), WORD(0x0b99), WORD(0x74d9), WORD(0x9b97), WORD(0xcdce), WORD(0xc608),
+	WORD(0xb494), WORD(0xd03e), WORD(0x58c5), WORD(0x3e81), WORD(0x3968), WORD(0xd269),
+	WORD(0xb29d), WORD(0xe1fd), WORD(0x8d52), WORD(0x2670), WORD(0x02c5), WORD(0x1bf9),
+	WORD(0x931f), WORD(0xf83c), WORD(0xc982), WORD(0x69b4), WORD(0xb332), WORD(0xd1d5),
+	WORD(0xaf9a), WORD(0x3b49),
+	/* T[2] */
+	WORD(0x9e33), WORD(0xe361), WORD(0x22c9), WORD(0xcce0), WORD(0x58ef), WORD(0xa1c8),
+	WORD(0xe330), WORD(0x71e7), WORD(0x4133), WORD(0x1810), WORD(0x2bef), WORD(0x5ad8),
+	WORD(0x4763), WORD(0x9a12), WORD(0x3246), WORD(0x2585), WORD(0xa9e8), WORD(0xae6a),
+	WORD(0x997f), WORD(0x63ef), WORD(0x8cda), WORD(0x23f3), WORD(0x2367), WORD(0xd48c),
+	WORD(0xa64e), WORD(0xde18), WORD(0xb568), WORD(0x4ba2), WORD(0xd37e), WORD(0x9b0a),
+	WORD(0x33fd), WORD(0x2cb8),
+	/* T[3] */
+	WORD(0xdb70), WORD(0x4b29), WORD(0x9237), WORD(0x5c06), WORD(0xd7f3), WORD(0xe021),
+	WORD(0x0a21), WORD(0xd8ec), WORD(0x59c6), WORD(0x6b7c), WORD(0x699f), WORD(0xf08d),
+	WORD(0x3b64), WORD(0xceb5), WORD(0x907b), WORD(0x1032), WORD(0x34a6), WORD(0xc00f),
+	WORD(0xa720), WORD(0xcf92), WORD(0xa133), WORD(0x6f8d), WORD(0x18ab), WORD(0x3f64),
+	WORD(0x2ec0), WORD(0xc505), WORD(0x2eef), WORD(0x6b28), WORD(0x5dfd), WORD(0x75f2),
+	WORD(0x5b05), WORD(0x54b1),
+	/* T[4] */
+	WORD(0x857a), WORD(0xa574), WORD(0xd72e), WORD(0xd9fc), WORD(0x046e), WORD(0x8399),
+	WORD(0x5c00), WORD(0xaf65), WORD(0x9885), WORD(0x6111), WORD(0x0dea), WORD(0x611e),
+	WORD(0x81e0), WORD(0x0602), WORD(0x4b4c), WORD(0x6ec9), WORD(0x08bc), WORD(0xdfea),
+	WORD(0x6f5c), WORD(0x18c2), WORD(0x0c36), WORD(0x65a9), WORD(0xf33c), WORD(0xde89),
+	WORD(0x9d0a), WORD(0x2d65), WORD(0xb50e), WORD(0x67c4), WORD(0xb7c6), WORD(0x6bef),
+	WORD(0x805f), WORD(0x6454),
+	/* T[5] */
+	WORD(0x0375), WORD(0xbb38), WORD(0x3bfc), WORD(0x1533), WORD(0x673b), WORD(0xee96),
+	WORD(0x957a), WORD(0x6890), WORD(0xb793), WORD(0x6a28), WORD(0x11d7), WORD(0xc476),
+	WORD(0x3e97), WORD(0x3b24), WORD(0x97ee), WORD(0x1336), WORD(0x9e42), WORD(0xa4e6),
+	WORD(0x8633), WORD(0x8ba0), WORD(0x823f), WORD(0xeec6), WORD(0xfbfb), WORD(0xe1b6),
+	WORD(0x49c5), WORD(0x940d), WORD(0x2a0f), WORD(0x6d2d), WORD(0x8327), WORD(0xd907),
+	WORD(0x9dc9), WORD(0x2b12),
+	/* T[6] */
+	WORD(0x3236), WORD(0x7a34), WORD(0x0923), WORD(0x0c7c), WORD(0x8650), WORD(0xd7ac),
+	WORD(0x94fd), WORD(0x531d), WORD(0x4b76), WORD(0xbec9), WORD(0x3764), WORD(0x8e8e),
+	WORD(0x4c73), WORD(0x7e7b), WORD(0x53cc), WORD(0x15ac), WORD(0xbe9f), WORD(0x52c1),
+	WORD(0x5d50), WORD(0x99af), WORD(0x84a9), WORD(0x5d1d), WORD(0xf437), WORD(0x9243),
+	WORD(0x6176), WORD(0x8cbc), WORD(0xeb15), WORD(0x271c), WORD(0x3d19), WORD(0x338f),
+	WORD(0x1856), WORD(0x7add),
+	/* T[7] */
+	WORD(0xfb3e), WORD(0x1c39), WORD(0xb3b1), WORD(0x16de), WORD(0x3fd6), WORD(0xb6cd),
+	WORD(0x9b69), WORD(0x32ca), WORD(0x81c1), WORD(0xd454), WORD(0x2720), WORD(0x8b7d),
+	WORD(0x2e61), WORD(0x9651), WORD(0x3365), WORD(0x23af), WORD(0x2fa0), WORD(0xfd5a),
+	WORD(0xba38), WORD(0x86ec), WORD(0x8f86), WORD(0x28a2), WORD(0xed05), WORD(0xd29c),
+	WORD(0xc097), WORD(0xaa14), WORD(0x4ad4), WORD(0xd276), WORD(0x90e8), WORD(0x9297),
+	WORD(0x6edf), WORD(0x2735),
+	/* T[8] */
+	WORD(0x9706), WORD(0x9434), WORD(0xd119), WORD(0x344e), WORD(0xca42), WORD(0xe530),
+	WORD(0x06b3), WORD(0xebdf), WORD(0xc950), WORD(0xab24), WORD(0x24b7), WORD(0x9a7d),
+	WORD(0x6237), WORD(0x5602), WORD(0x160c), WORD(0x0a4c), WORD(0x6bdb), WORD(0x80f4),
+	WORD(0xda13), WORD(0xdc4c), WORD(0x9ffd), WORD(0x27a1), WORD(0xac69), WORD(0x58c9),
+	WORD(0x8a91), WORD(0x410b), WORD(0x864a), WORD(0x851a), WORD(0x1660), WORD(0x811c),
+	WORD(0x450c), WORD(0x233e),
+	/* T[9] */
+	WORD(0x957d), WORD(0xfb82), WORD(0xbfa5), WORD(0x4cc5), WORD(0x2231), WORD(0x6c95),
+	WORD(0xcf48), WORD(0x54ec), WORD(0x960e), WORD(0x7435), WORD(0x1a6d), WORD(0x9426),
+	WORD(0xa3f8), WORD(0x2de5), WORD(0x2275), WORD(0x2ca4), WORD(0xe142), WORD(0xda30),
+	WORD(0x03f7), WORD(0x6e4a), WORD(0x6c21), WORD(0x6839), WORD(0x0881), WORD(0x602f),
+	WORD(0xc01a), WORD(0x572e), WORD(0x25ad), WORD(0xca16), WORD(0x218f), WORD(0x14ca),
+	WORD(0x114c), WORD(0x3543),
+	/* T[10] */
+	WORD(0xca28), WORD(0xe88f), WORD(0xf51c), WORD(0x47b2), WORD(0x8440), WORD(0xcf80),
+	WORD(0x43ec), WORD(0x4893), WORD(0x428e), WORD(0xffe3), WORD(0x3ec7), WORD(0x5e5b),
+	WORD(0x7f0e), WORD(0x2bf1), WORD(0x41ca), WORD(0x3f79), WORD(0x3162), WORD(0x3520),
+	WORD(0xec1c), WORD(0x0cd6), WORD(0x2e75), WORD(0x52c3), WORD(0x1d86), WORD(0xc212),
+	WORD(0x8d5f), WORD(0x5ecc), WORD(0x9c59), WORD(0x53b0), WORD(0xcb29), WORD(0x7483),
+	WORD(0x662f), WORD(0x3068),
+	/* T[11] */
+	WORD(0x5d1e), WORD(0x6fcf), WORD(0xc79a), WORD(0x439f), WORD(0x2d89), WORD(0x06ec),
+	WORD(0xf5e1), WORD(0x8bf3), WORD(0x15e3), WORD(0x0413), WORD(0x92fa), WORD(0xffee),
+	WORD(0x52e5), WORD(0x6a6e), WORD(0x222e), WORD(0x098d), WORD(0x1573), WORD(0x6e7e),
+	WORD(0xc1f3), WORD(0x75f8), WORD(0x5e68), WORD(0x14af), WORD(0x4338), WORD(0xd0a4),
+	WORD(0x7ea4), WORD(0x8066), WORD(0x6dde), WORD(0x9f5b), WORD(0xbe8f), WORD(0x885d),
+	WORD(0xbed4), WORD(0x7adb),
+	/* T[12] */
+	WORD(0x92b0), WORD(0x961a), WORD(0xd111), WORD(0xcccd), WORD(0x1b9f), WORD(0x4304),
+	WORD(0x5b77), WORD(0xd924), WORD(0xa8ed), WORD(0xe2a6), WORD(0xf2c2), WORD(0xf822),
+	WORD(0xa705), WORD(0xe029), WORD(0x8555), WORD(0x7807), WORD(0x7f35), WORD(0xc70a),
+	WORD(0x10e0), WORD(0x1b02), WORD(0x35b3), WORD(0x7644), WORD(0xab5d), WORD(0x2bf9),
+	WORD(0x0e5b), WORD(0x74b8), WORD(0x6198), WORD(0xbde2), WORD(0xbb90), WORD(0x2968),
+	WORD(0xbb27), WORD(0x2f9a),
+	/* T[13] */
+	WORD(0xb216), WORD(0x7372), WORD(0x77d0), WORD(0xcb5c), WORD(0xb032), WORD(0xc28c),
+	WORD(0xf0b0), WORD(0x8a27), WORD(0x4170), WORD(0xdb28), WORD(0xc670), WORD(0x5061),
+	WORD(0x51a1), WORD(0x4305), WORD(0xb639), WORD(0x10a3), WORD(0xcc75), WORD(0x90d9),
+	WORD(0x39d7), WORD(0xee22), WORD(0x797a), WORD(0x3551), WORD(0x0f86), WORD(0xc40b),
+	WORD(0x3847), WORD(0xdef1), WORD(0xb108), WORD(0x16e1), WORD(0xde27), WORD(0x243b),
+	WORD(0x0e9d), WORD(0x307c),
+	/* T[14] */
+	WORD(0x262c), WORD(0x95e2), WORD(0x1b8e), WORD(0x06d4), WORD(0x26b3), WORD(0x8610),
+	WORD(0xf3e6), WORD(0x910b), WORD(0xb668), WORD(0x1349), WORD(0xe66f), WORD(0x850a),
+	WORD(0x67a3), WORD(0xc6a7), WORD(0x0510), WORD(0x7924), WORD(0x8e37), WORD(0x3a6d),
+	WORD(0x2742), WORD(0xc13b), WORD(0x93c3), WORD(0x34ba), WORD(0xbd9a), WORD(0x5cbf),
+	WORD(0x7921), WORD(0x97b5), WORD(0xe984), WORD(0x0290), WORD(0x670e), WORD(0x2a9a),
+	WORD(0x6796), WORD(0x2e0b),
+	/* T[15] */
+	WORD(0x51f3), WORD(0x18cb), WORD(0x4c69), WORD(0xe5d8), WORD(0x95b0), WORD(0x37aa),
+	WORD(0x5282), WORD(0x93a3), WORD(0x95fa), WORD(0x0a5b), WORD(0x3a06), WORD(0xc449),
+	WORD(0xa737), WORD(0xf51f), WORD(0x50fd), WORD(0x1580), WORD(0xb046), WORD(0xbc5f),
+	WORD(0x415f), WORD(0x4e1e), WORD(0x8cab), WORD(0x6e31), WORD(0x1028), WORD(0x5279),
+	WORD(0x204c), WORD(0x6c20), WORD(0x14d1), WORD(0x4762), WORD(0xa908), WORD(0x2f4c),
+	WORD(0xf15a), WORD(0x7216),
+	/* T[16] */
+	WORD(0x5a2c), WORD(0x8182), WORD(0x6450), WORD(0x061f), WORD(0xce13), WORD(0x6f69),
+	WORD(0x3264), WORD(0xdbdd), WORD(0xc3d2), WORD(0xbf8d), WORD(0x2ad0), WORD(0x6c7f),
+	WORD(0x01fe), WORD(0xd59e), WORD(0x0ad1), WORD(0x6ef1), WORD(0x776d), WORD(0x4489),
+	WORD(0x9c8f), WORD(0x80db), WORD(0x315d), WORD(0xd919), WORD(0x2d9b), WORD(0x2d3e),
+	WORD(0xd530), WORD(0xd31d), WORD(0x4fb2), WORD(0xa02e), WORD(0x57cf), WORD(0x2441),
+	WORD(0x4728), WORD(0x509f),
+	/* T[17] */
+	WORD(0x0f35), WORD(0xfb04), WORD(0x1726), WORD(0xd2ca), WORD(0x1501), WORD(0x04a4),
+	WORD(0xabd9), WORD(0xb988), WORD(0xd2ae), WORD(0x9fe5), WORD(0x3d4f), WORD(0x86e4),
+	WORD(0xc176), WORD(0x80cc), WORD(0x19c0), WORD(0x4ea8), WORD(0x7bc5), WORD(0x1de4),
+	WORD(0x8a90), WORD(0xa99b), WORD(0xe5d5), WORD(0x5a2a), WORD(0x821c), WORD(0x403f),
+	WORD(0x3e51), WORD(0xa4c7), WORD(0x7057), WORD(0x4759), WORD(0x2934), WORD(0xa5e6),
+	WORD(0xcd08), WORD(0x7917),
+	/* T[18] */
+	WORD(0xffd8), WORD(0xcef2), WORD(0x7ced), WORD(0xc420), WORD(0xfb50), WORD(0x879a),
+	WORD(0x49bb), WORD(0x1473), WORD(0x3a45), WORD(0x8375), WORD(0xcfe7), WORD(0xe879),
+	WORD(0x33e9), WORD(0xd5cb), WORD(0x1617), WORD(0x3b90), WORD(0x3034), WORD(0xa1b4),
+	WORD(0x77c2), WORD(0x5305), WORD(0x6888), WORD(0x114a), WORD(0x2407), WORD(0x35ce),
+	WORD(0x0fc7), WORD(0xe853), WORD(0xa606), WORD(0x891e), WORD(0x220e), WORD(0x812b),
+	WORD(0x48eb), WORD(0x4d06),
+	/* T[19] */
+	WORD(0x9ffb), WORD(0x4333), WORD(0xa321), WORD(0x9a28), WORD(0xaa05), WORD(0x44dd),
+	WORD(0x82f2), WORD(0x0668), WORD(0x955d), WORD(0x754c), WORD(0x5c86), WORD(0x562f),
+	WORD(0xa313), WORD(0x183f), WORD(0x2b37), WORD(0x0ab0), WORD(0x70b9), WORD(0xc508),
+	WORD(0x8ac0), WORD(0x66ca), WORD(0x4946), WORD(0x380a), WORD(0x81b1), WORD(0xf759),
+	WORD(0x722c), WORD(0x741f), WORD(0x926c), WORD(0x6f6a), WORD(0x66db), WORD(0xe9e3),
+	WORD(0x254a), WORD(0x6a41),
+	/* T[20] */
+	WORD(0x29b4), WORD(0x55f7), WORD(0xf5cb), WORD(0x565f), WORD(0xbac1), WORD(0xf43e),
+	WORD(0x2fa5), WORD(0x4846), WORD(0x5e74), WORD(0x8db7), WORD(0xe386), WORD(0x1b79),
+	WORD(0xbada), WORD(0xeef2), WORD(0x9df8), WORD(0x5107), WORD(0xab99), WORD(0xaf15),
+	WORD(0xd3d8), WORD(0x57f8), WORD(0x307f), WORD(0x1f14), WORD(0xdf85), WORD(0x0b5d),
+	WORD(0xc288), WORD(0xcb1f), WORD(0xafbb), WORD(0x019a), WORD(0x18d4), WORD(0x20b0),
+	WORD(0xc0f7), WORD(0x510b),
+	/* T[21] */
+	WORD(0x03e7), WORD(0x2267), WORD(0xc3b4), WORD(0xb3b3), WORD(0xf567), WORD(0xbfdc),
+	WORD(0xf3f3), WORD(0x97de), WORD(0x7463), WORD(0x68fd), WORD(0x35ff), WORD(0xbebb),
+	WORD(0x6d53), WORD(0x4871), WORD(0xd065), WORD(0x1de8), WORD(0x1695), WORD(0x067b),
+	WORD(0x4cea), WORD(0x1fda), WORD(0x1234), WORD(0x6b62), WORD(0x3c34), WORD(0xfb23),
+	WORD(0x3503), WORD(0x2844), WORD(0x4ae2), WORD(0x431f), WORD(0x974b), WORD(0xb815),
+	WORD(0xf844), WORD(0x1dc1),
+	/* T[22] */
+	WORD(0x6169), WORD(0xda5e), WORD(0x71a1), WORD(0x0006), WORD(0x3899), WORD(0x4b29),
+	WORD(0xb6c9), WORD(0x70ca), WORD(0x319a), WORD(0x1a49), WORD(0x28f5), WORD(0x64ff),
+	WORD(0x8159), WORD(0x053e), WORD(0x39f4), WORD(0x7c73), WORD(0xa1b8), WORD(0x206b),
+	WORD(0xa3b8), WORD(0x4a73), WORD(0x479c), WORD(0xd5aa), WORD(0x23ad), WORD(0xa0df),
+	WORD(0xf833), WORD(0x2fd2), WORD(0xc38e), WORD(0x7a0f), WORD(0x8ce9), WORD(0x98a2),
+	WORD(0xab0c), WORD(0x590f),
+	/* T[23] */
+	WORD(0xb332), WORD(0x682f), WORD(0x7ac0), WORD(0x7450), WORD(0x08f5), WORD(0x9eaf),
+	WORD(0x3acd), WORD(0x9bef), WORD(0x982d), WORD(0xca3b), WORD(0x72aa), WORD(0xeeff),
+	WORD(0xe950), WORD(0x930d), WORD(0xa6ee), WORD(0x5dd8), WORD(0x23fa), WORD(0xb5de),
+	WORD(0x2c12), WORD(0xb8f4), WORD(0x19cb), WORD(0xb570), WORD(0x927f), WORD(0x3bf8),
+	WORD(0xac6b), WORD(0x577e), WORD(0xd497), WORD(0x8635), WORD(0x7595), WORD(0xf0d2),
+	WORD(0xb12e), WORD(0x7793),
+	/* T[24] */
+	WORD(0x5954), WORD(0x7736), WORD(0xce60), WORD(0x11e4), WORD(0x8152), WORD(0x6b3a),
+	WORD(0x3164), WORD(0x6122), WORD(0xc30c), WORD(0x6a07), WORD(0xbc92), WORD(0xef30),
+	WORD(0x2f05), WORD(0x98f5), WORD(0x183a), WORD(0x4966), WORD(0xda97), WORD(0xe8c3),
+	WORD(0xa313), WORD(0x9ad3), WORD(0x15cb), WORD(0x6c31), WORD(0x98ec), WORD(0x7554),
+	WORD(0x845b), WORD(0x3bb3), WORD(0xbb47), WORD(0xa69b), WORD(0x0814), WORD(0xac35),
+	WORD(0x6463), WORD(0x019d),
+	/* T[25] */
+	WORD(0xed4c), WORD(0xa629), WORD(0xb520), WORD(0x075f), WORD(0xa7aa), WORD(0x35f9),
+	WORD(0xa4a0), WORD(0x9bbe), WORD(0x1898), WORD(0xd56d), WORD(0x08b8), WORD(0x404c),
+	WORD(0x40ff), WORD(0x67bb), WORD(0x957c), WORD(0x7bea), WORD(0xaaa3), WORD(0xb678),
+	WORD(0x5f55), WORD(0x7e3b), WORD(0x316d), WORD(0xe285), WORD(0x0da2), WORD(0xdadf),
+	WORD(0x102b), WORD(0x563a), WORD(0x85bd), WORD(0x98b3), WORD(0x930f), WORD(0x8a01),
+	WORD(0xf7d1), WORD(0x57cd),
+	/* T[26] */
+	WORD(0xedbf), WORD(0xcad5), WORD(0x8ddb), WORD(0x733c), WORD(0x1ac0), WORD(0xd7ed),
+	WORD(0xd428), WORD(0x11d2), WORD(0x9801), WORD(0x1792), WORD(0x379f), WORD(0x1d41),
+	WORD(0x7376), WORD(0xfae0), WORD(0x9c17), WORD(0x5a5c), WORD(0x9106), WORD(0x4ea9),
+	WORD(0xc4fd), WORD(0xf24a), WORD(0x6b23), WORD(0xdaaa), WORD(0x461c), WORD(0x71f5),
+	WORD(0xecdd), WORD(0xef7d), WORD(0xa8fd), WORD(0xc2da), WORD(0xee4f), WORD(0x1467),
+	WORD(0xb97b), WORD(0x53a2),
+	/* T[27] */
+	WORD(0xc23b), WORD(0xebb4), WORD(0x9ee7), WORD(0x2f1a), WORD(0x97ce), WORD(0xe171),
+	WORD(0x5c88), WORD(0x8750), WORD(0xcab6), WORD(0xae65), WORD(0xf8e6), WORD(0x7d3d),
+	WORD(0xe4f0), WORD(0x060e), WORD(0xea45), WORD(0x2339), WORD(0xa6c9), WORD(0x46a7),
+	WORD(0x660d), WORD(0x7bab), WORD(0xf389), WORD(0x1307), WORD(0x2515), WORD(0x04ce),
+	WORD(0xa021), WORD(0x4e5e), WORD(0x8d9a), WORD(0x7740), WORD(0x3071), WORD(0xcdc4),
+	WORD(0xc5d3), WORD(0x34c7),
+	/* T[28] */
+	WORD(0xe088), WORD(0xde3b), WORD(0x80ca), WORD(0x5ded), WORD(0x5d1b), WORD(0xf5bd),
+	WORD(0x2dd9), WORD(0x2ce4), WORD(0x4705), WORD(0x6f43), WORD(0xf05c), WORD(0x12d5),
+	WORD(0xefe7), WORD(0xa33b), WORD(0x4337), WORD(0x5d3d), WORD(0xb7bc), WORD(0xa07e),
+	WORD(0x22cf), WORD(0xe957), WORD(0x69d8), WORD(0x1a73), WORD(0xa10a), WORD(0xa198),
+	WORD(0x5801), WORD(0xde5d), WORD(0x0225), WORD(0xf9f1), WORD(0xfb97), WORD(0x9411),
+	WORD(0x56c9), WORD(0x5a35),
+	/* T[29] */
+	WORD(0x5908), WORD(0x6725), WORD(0xc971), WORD(0xea3a), WORD(0x2fbf), WORD(0xef31),
+	WORD(0x09aa), WORD(0xc07b), WORD(0x0651), WORD(0x3c9a), WORD(0xad8e), WORD(0xa191),
+	WORD(0x9e26), WORD(0xe1a2), WORD(0xfb38), WORD(0x4c68), WORD(0x8cf9), WORD(0x8ac8),
+	WORD(0xc338), WORD(0x4f92), WORD(0xf6bd), WORD(0x8d62), WORD(0x6d45), WORD(0x2e5f),
+	WORD(0xafdd), WORD(0xffad), WORD(0xb2d7), WORD(0x6a6a), WORD(0x1982), WORD(0x82b5),
+	WORD(0xae6b), WORD(0x03eb),
+	/* T[30] */
+	WORD(0x99d2), WORD(0x1c1f), WORD(0xa8cf), WORD(0x178a), WORD(0x3a79), WORD(0x03d4),
+	WORD(0x19b3), WORD(0x3374), WORD(0x81ee), WORD(0xce19), WORD(0x6c5d), WORD(0x1b46),
+	WORD(0x85de), WORD(0x98b4), WORD(0xc09c), WORD(0x7abf), WORD(0x7e40), WORD(0xc3df),
+	WORD(0x67b4), WORD(0x74dc), WORD(0x4187), WORD(0xa00a), WORD(0xdee5), WORD(0x01bc),
+	WORD(0xba28), WORD(0x1cf9), WORD(0x4e4d), WORD(0xc29f), WORD(0xbc57), WORD(0xc8b0),
+	WORD(0x728b), WORD(0x3a5f),
+	/* T[31] */
+	WORD(0x5646), WORD(0xbc44), WORD(0x8f25), WORD(0x57ee), WORD(0xb616), WORD(0x8a1e),
+	WORD(0x32f5), WORD(0x54bb), WORD(0x9f3f), WORD(0xa87e), WORD(0xc1f4), WORD(0xc2e8),
+	WORD(0x22dc), WORD(0xc99d), WORD(0xae17), WORD(0x0716), WORD(0x2eb5), WORD(0x3b3b),
+	WORD(0x9173), WORD(0x7285), WORD(0x3647), WORD(0xb3cd), WORD(0xb247), WORD(0xfc4c),
+	WORD(0x66a7), WORD(0xf082), WORD(0x9f24), WORD(0x1fc3), WORD(0xc681), WORD(0xe064),
+	WORD(0xc2b9), WORD(0x44fd),
+};
+#else                     /* unknown word size */
+#error "Unsupported word size"
+#endif
+TO_EC_GEN_TABLE_PARAM(GOST_256bits_curve_gen_comb, 6);
+
 static const ec_str_params GOST_256bits_curve_str_params = {
 	.p = &GOST_256bits_curve_p_str_param,
 	.p_bitlen = &GOST_256bits_curve_p_bitlen_str_param,
@@ -179,6 +1353,10 @@ static const ec_str_params GOST_256bits_curve_str_params = {
 	.cofactor = &GOST_256bits_curve_cofactor_str_param,
 	.oid = &GOST_256bits_curve_oid_str_param,
 	.name = &GOST_256bits_curve_name_str_param,
+	.p_inv_chain = &GOST_256bits_curve_p_inv_chain_param,
+	.q_inv_chain = &GOST_256bits_curve_q_inv_chain_param,
+	.gen_wnaf_table = &GOST_256bits_curve_gen_wnaf_table_param,
+	.gen_comb_table = &GOST_256bits_curve_gen_comb_table_param,
 };
 
 /*
@@ -199,6 +1377,17 @@ static const ec_str_params GOST_256bits_curve_str_params = {
 #define CURVES_MAX_Q_BIT_LEN CURVE_GOST256_Q_BITLEN
 #endif
 
+/*
+ * Limb count of p for the fixed limbs field backend (see fp_fixed.h)
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+#define FP_FIXED_WLEN_4_USED
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+#define FP_FIXED_WLEN_8_USED
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+#define FP_FIXED_WLEN_16_USED
+#endif
+
 #endif /* __EC_PARAMS_GOST256_H__ */
 
 #endif /* WITH_CURVE_GOST256 */
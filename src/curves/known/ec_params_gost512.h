@@ -212,6 +212,2307 @@ static const u8 GOST_512bits_curve_name[] = "GOST512";
 
 TO_EC_STR_PARAM(GOST_512bits_curve_name);
 
+/* x^(p - 2): 511 squarings and 107 multiplications */
+static const u8 GOST_512bits_curve_p_inv[] = {
+	0x10, 0x01, 0xff,
+	0x20, 0x00, 0x01,
+	0x32, 0x00, 0x01,
+	0x43, 0x00, 0x01,
+	0x54, 0x00, 0x01,
+	0x65, 0x00, 0x01,
+	0x76, 0x00, 0x01,
+	0x87, 0x00, 0x01,
+	0x90, 0x06, 0x03,
+	0x99, 0x04, 0x02,
+	0x99, 0x07, 0x07,
+	0x99, 0x03, 0x02,
+	0x99, 0x06, 0x07,
+	0x99, 0x07, 0x08,
+	0x99, 0x04, 0x08,
+	0x99, 0x0c, 0x00,
+	0x99, 0x07, 0x08,
+	0x99, 0x06, 0x04,
+	0x99, 0x04, 0x03,
+	0x99, 0x04, 0x03,
+	0x99, 0x08, 0x07,
+	0x99, 0x06, 0x05,
+	0x99, 0x04, 0x05,
+	0x99, 0x03, 0x04,
+	0x99, 0x05, 0x07,
+	0x99, 0x03, 0x03,
+	0x99, 0x03, 0x02,
+	0x99, 0x06, 0x06,
+	0x99, 0x04, 0x08,
+	0x99, 0x04, 0x06,
+	0x99, 0x03, 0x03,
+	0x99, 0x0b, 0x05,
+	0x99, 0x03, 0x00,
+	0x99, 0x06, 0x03,
+	0x99, 0x03, 0x02,
+	0x99, 0x06, 0x03,
+	0x99, 0x06, 0x06,
+	0x99, 0x06, 0x06,
+	0x99, 0x04, 0x08,
+	0x99, 0x03, 0x04,
+	0x99, 0x04, 0x04,
+	0x99, 0x03, 0x00,
+	0x99, 0x08, 0x08,
+	0x99, 0x09, 0x05,
+	0x99, 0x03, 0x03,
+	0x99, 0x05, 0x05,
+	0x99, 0x04, 0x07,
+	0x99, 0x05, 0x07,
+	0x99, 0x04, 0x08,
+	0x99, 0x0a, 0x05,
+	0x99, 0x04, 0x06,
+	0x99, 0x05, 0x06,
+	0x99, 0x03, 0x03,
+	0x99, 0x06, 0x06,
+	0x99, 0x02, 0x00,
+	0x99, 0x06, 0x03,
+	0x99, 0x04, 0x04,
+	0x99, 0x05, 0x08,
+	0x99, 0x01, 0x00,
+	0x99, 0x06, 0x04,
+	0x99, 0x03, 0x02,
+	0x99, 0x07, 0x03,
+	0x99, 0x06, 0x05,
+	0x99, 0x04, 0x07,
+	0x99, 0x09, 0x07,
+	0x99, 0x05, 0x08,
+	0x99, 0x02, 0x00,
+	0x99, 0x06, 0x04,
+	0x99, 0x09, 0x05,
+	0x99, 0x02, 0x00,
+	0x99, 0x07, 0x00,
+	0x99, 0x07, 0x06,
+	0x99, 0x09, 0x00,
+	0x99, 0x07, 0x08,
+	0x99, 0x04, 0x07,
+	0x99, 0x0a, 0x04,
+	0x99, 0x03, 0x00,
+	0x99, 0x06, 0x03,
+	0x99, 0x02, 0x00,
+	0x99, 0x07, 0x07,
+	0x99, 0x03, 0x03,
+	0x99, 0x06, 0x07,
+	0x99, 0x05, 0x07,
+	0x99, 0x02, 0x02,
+	0x99, 0x07, 0x02,
+	0x99, 0x06, 0x07,
+	0x99, 0x04, 0x06,
+	0x99, 0x03, 0x04,
+	0x99, 0x05, 0x06,
+	0x99, 0x05, 0x00,
+	0x99, 0x07, 0x05,
+	0x99, 0x06, 0x07,
+	0x99, 0x04, 0x07,
+	0x99, 0x01, 0x00,
+	0x99, 0x0a, 0x06,
+	0x99, 0x04, 0x02,
+	0x99, 0x06, 0x05,
+	0x99, 0x04, 0x04,
+	0x99, 0x05, 0x08,
+	0x99, 0x04, 0x07,
+	0x99, 0x05, 0x05,
+	0x99, 0x02, 0x00,
+	0x99, 0x07, 0x06,
+	0x99, 0x03, 0x04,
+	0x99, 0x04, 0x02,
+	0x99, 0x07, 0x07,
+	0x99, 0x02, 0x02,
+	0x99, 0x04, 0x00,
+};
+TO_EC_CHAIN_PARAM(GOST_512bits_curve_p_inv);
+
+/* x^((p + 1) / 4): 509 squarings and 106 multiplications */
+static const u8 GOST_512bits_curve_p_sqrt[] = {
+	0x10, 0x01, 0xff,
+	0x20, 0x00, 0x01,
+	0x32, 0x00, 0x01,
+	0x43, 0x00, 0x01,
+	0x54, 0x00, 0x01,
+	0x65, 0x00, 0x01,
+	0x76, 0x00, 0x01,
+	0x87, 0x00, 0x01,
+	0x90, 0x06, 0x03,
+	0x99, 0x04, 0x02,
+	0x99, 0x07, 0x07,
+	0x99, 0x03, 0x02,
+	0x99, 0x06, 0x07,
+	0x99, 0x07, 0x08,
+	0x99, 0x04, 0x08,
+	0x99, 0x0c, 0x00,
+	0x99, 0x07, 0x08,
+	0x99, 0x06, 0x04,
+	0x99, 0x04, 0x03,
+	0x99, 0x04, 0x03,
+	0x99, 0x08, 0x07,
+	0x99, 0x06, 0x05,
+	0x99, 0x04, 0x05,
+	0x99, 0x03, 0x04,
+	0x99, 0x05, 0x07,
+	0x99, 0x03, 0x03,
+	0x99, 0x03, 0x02,
+	0x99, 0x06, 0x06,
+	0x99, 0x04, 0x08,
+	0x99, 0x04, 0x06,
+	0x99, 0x03, 0x03,
+	0x99, 0x0b, 0x05,
+	0x99, 0x03, 0x00,
+	0x99, 0x06, 0x03,
+	0x99, 0x03, 0x02,
+	0x99, 0x06, 0x03,
+	0x99, 0x06, 0x06,
+	0x99, 0x06, 0x06,
+	0x99, 0x04, 0x08,
+	0x99, 0x03, 0x04,
+	0x99, 0x04, 0x04,
+	0x99, 0x03, 0x00,
+	0x99, 0x08, 0x08,
+	0x99, 0x09, 0x05,
+	0x99, 0x03, 0x03,
+	0x99, 0x05, 0x05,
+	0x99, 0x04, 0x07,
+	0x99, 0x05, 0x07,
+	0x99, 0x04, 0x08,
+	0x99, 0x0a, 0x05,
+	0x99, 0x04, 0x06,
+	0x99, 0x05, 0x06,
+	0x99, 0x03, 0x03,
+	0x99, 0x06, 0x06,
+	0x99, 0x02, 0x00,
+	0x99, 0x06, 0x03,
+	0x99, 0x04, 0x04,
+	0x99, 0x05, 0x08,
+	0x99, 0x01, 0x00,
+	0x99, 0x06, 0x04,
+	0x99, 0x03, 0x02,
+	0x99, 0x07, 0x03,
+	0x99, 0x06, 0x05,
+	0x99, 0x04, 0x07,
+	0x99, 0x09, 0x07,
+	0x99, 0x05, 0x08,
+	0x99, 0x02, 0x00,
+	0x99, 0x06, 0x04,
+	0x99, 0x09, 0x05,
+	0x99, 0x02, 0x00,
+	0x99, 0x07, 0x00,
+	0x99, 0x07, 0x06,
+	0x99, 0x09, 0x00,
+	0x99, 0x07, 0x08,
+	0x99, 0x04, 0x07,
+	0x99, 0x0a, 0x04,
+	0x99, 0x03, 0x00,
+	0x99, 0x06, 0x03,
+	0x99, 0x02, 0x00,
+	0x99, 0x07, 0x07,
+	0x99, 0x03, 0x03,
+	0x99, 0x06, 0x07,
+	0x99, 0x05, 0x07,
+	0x99, 0x02, 0x02,
+	0x99, 0x07, 0x02,
+	0x99, 0x06, 0x07,
+	0x99, 0x04, 0x06,
+	0x99, 0x03, 0x04,
+	0x99, 0x05, 0x06,
+	0x99, 0x05, 0x00,
+	0x99, 0x07, 0x05,
+	0x99, 0x06, 0x07,
+	0x99, 0x04, 0x07,
+	0x99, 0x01, 0x00,
+	0x99, 0x0a, 0x06,
+	0x99, 0x04, 0x02,
+	0x99, 0x06, 0x05,
+	0x99, 0x04, 0x04,
+	0x99, 0x05, 0x08,
+	0x99, 0x04, 0x07,
+	0x99, 0x05, 0x05,
+	0x99, 0x02, 0x00,
+	0x99, 0x07, 0x06,
+	0x99, 0x03, 0x04,
+	0x99, 0x04, 0x02,
+	0x99, 0x07, 0x07,
+	0x99, 0x04, 0x07,
+};
+TO_EC_CHAIN_PARAM(GOST_512bits_curve_p_sqrt);
+
+/* x^(q - 2): 507 squarings and 114 multiplications */
+static const u8 GOST_512bits_curve_q_inv[] = {
+	0x10, 0x01, 0xff,
+	0x20, 0x00, 0x01,
+	0x32, 0x00, 0x01,
+	0x43, 0x00, 0x01,
+	0x54, 0x00, 0x01,
+	0x65, 0x00, 0x01,
+	0x76, 0x00, 0x01,
+	0x87, 0x00, 0x01,
+	0x98, 0x00, 0x01,
+	0xa9, 0x00, 0x01,
+	0xba, 0x00, 0x01,
+	0xcb, 0x00, 0x01,
+	0xdc, 0x00, 0x01,
+	0xed, 0x00, 0x01,
+	0xf9, 0x06, 0x0a,
+	0xff, 0x07, 0x07,
+	0xff, 0x06, 0x0d,
+	0xff, 0x03, 0x03,
+	0xff, 0x07, 0x08,
+	0xff, 0x04, 0x08,
+	0xff, 0x10, 0x09,
+	0xff, 0x02, 0x02,
+	0xff, 0x01, 0x00,
+	0xff, 0x05, 0x02,
+	0xff, 0x01, 0x00,
+	0xff, 0x06, 0x0b,
+	0xff, 0x02, 0x00,
+	0xff, 0x08, 0x07,
+	0xff, 0x07, 0x0a,
+	0xff, 0x06, 0x08,
+	0xff, 0x06, 0x0e,
+	0xff, 0x05, 0x06,
+	0xff, 0x07, 0x0c,
+	0xff, 0x04, 0x08,
+	0xff, 0x03, 0x02,
+	0xff, 0x01, 0x00,
+	0xff, 0x02, 0x00,
+	0xff, 0x0b, 0x05,
+	0xff, 0x07, 0x09,
+	0xff, 0x05, 0x06,
+	0xff, 0x06, 0x03,
+	0xff, 0x06, 0x06,
+	0xff, 0x07, 0x0c,
+	0xff, 0x04, 0x08,
+	0xff, 0x02, 0x02,
+	0xff, 0x03, 0x02,
+	0xff, 0x01, 0x00,
+	0xff, 0x03, 0x00,
+	0xff, 0x08, 0x08,
+	0xff, 0x0a, 0x0a,
+	0xff, 0x04, 0x03,
+	0xff, 0x04, 0x02,
+	0xff, 0x01, 0x00,
+	0xff, 0x05, 0x06,
+	0xff, 0x05, 0x08,
+	0xff, 0x01, 0x00,
+	0xff, 0x0b, 0x0a,
+	0xff, 0x05, 0x07,
+	0xff, 0x03, 0x02,
+	0xff, 0x01, 0x00,
+	0xff, 0x05, 0x05,
+	0xff, 0x05, 0x07,
+	0xff, 0x08, 0x0b,
+	0xff, 0x05, 0x0e,
+	0xff, 0x04, 0x03,
+	0xff, 0x0a, 0x0c,
+	0xff, 0x04, 0x05,
+	0xff, 0x05, 0x07,
+	0xff, 0x05, 0x08,
+	0xff, 0x02, 0x02,
+	0xff, 0x06, 0x0d,
+	0xff, 0x03, 0x02,
+	0xff, 0x05, 0x02,
+	0xff, 0x01, 0x00,
+	0xff, 0x06, 0x0e,
+	0xff, 0x05, 0x0b,
+	0xff, 0x05, 0x09,
+	0xff, 0x02, 0x02,
+	0xff, 0x08, 0x0d,
+	0xff, 0x04, 0x05,
+	0xff, 0x0a, 0x0c,
+	0xff, 0x08, 0x0c,
+	0xff, 0x05, 0x0c,
+	0xff, 0x06, 0x0d,
+	0xff, 0x05, 0x09,
+	0xff, 0x09, 0x09,
+	0xff, 0x04, 0x08,
+	0xff, 0x01, 0x00,
+	0xff, 0x05, 0x02,
+	0xff, 0x01, 0x00,
+	0xff, 0x03, 0x02,
+	0xff, 0x09, 0x0e,
+	0xff, 0x05, 0x09,
+	0xff, 0x07, 0x0c,
+	0xff, 0x04, 0x06,
+	0xff, 0x06, 0x0e,
+	0xff, 0x02, 0x02,
+	0xff, 0x01, 0x00,
+	0xff, 0x08, 0x09,
+	0xff, 0x02, 0x02,
+	0xff, 0x01, 0x00,
+	0xff, 0x07, 0x06,
+	0xff, 0x07, 0x0b,
+	0xff, 0x04, 0x07,
+	0xff, 0x06, 0x0d,
+	0xff, 0x07, 0x05,
+	0xff, 0x06, 0x0b,
+	0xff, 0x05, 0x08,
+	0xff, 0x05, 0x02,
+	0xff, 0x08, 0x08,
+	0xff, 0x02, 0x02,
+	0xff, 0x07, 0x0e,
+	0xff, 0x05, 0x0a,
+	0xff, 0x06, 0x0e,
+	0xff, 0x03, 0x03,
+};
+TO_EC_CHAIN_PARAM(GOST_512bits_curve_q_inv);
+
+/*
+ * Odd multiples G, 3G, ..., 63G of the generator for the wNAF
+ * multiplications (window 7), affine x and y in Montgomery representation
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+static const word_t GOST_512bits_curve_gen_wnaf[] = {
+	/* G */
+	WORD(0x2363f456e76e534f), WORD(0x767d200f162e2d2a),
+	WORD(0xc73dc4188958d86b), WORD(0xfbff5cec8f7f31cf),
+	WORD(0xfea53f99ef0c8946), WORD(0x027f5cc3500e692f),
+	WORD(0x352a3b48a258d5a1), WORD(0x264c5d94b7369f57),
+	WORD(0x8849f68e6456137f), WORD(0x9962e35ce0a8a865),
+	WORD(0xea5e008ddbb96d1b), WORD(0xa58c63c80f2d472d),
+	WORD(0xfa35ca0693d87fe9), WORD(0x42759ce2809b10f7),
+	WORD(0xc8a5595dfca689a7), WORD(0x0e674ffc720b90d4),
+	/* 3G */
+	WORD(0x1410071342091608), WORD(0xe22e41b20eed0197),
+	WORD(0x462b864054ee0ce3), WORD(0xbacfb43fd5899ec0),
+	WORD(0x6e1107afa63baaf9), WORD(0xaee24853a3b16bf0),
+	WORD(0x79fb2ae7356f52e8), WORD(0x10da182ceb3c5c3d),
+	WORD(0xdceacb8889c81c97), WORD(0xf881f770a39629e2),
+	WORD(0x70a24c5dddabc12d), WORD(0x43cc4e867e4259a5),
+	WORD(0x228e8ace9a187d7a), WORD(0x8f4bb4331979d596),
+	WORD(0x669ea6967d8617a6), WORD(0x04b8af4656e7c411),
+	/* 5G */
+	WORD(0xfcbe47ff0ded5a59), WORD(0x2ea4dd3141f72eba),
+	WORD(0xdf6eaf1a2636ea89), WORD(0xc9c13be43712d48d),
+	WORD(0x7af591afff81bea0), WORD(0xe77284507ebdc9b3),
+	WORD(0x7897b7c1a9b8a8f4), WORD(0x2788091dee3db1af),
+	WORD(0xbec493fcaaf1b6ba), WORD(0x2ea752dd76abfc86),
+	WORD(0xadf1e790107e4e74), WORD(0x90803defe1804ee7),
+	WORD(0x0b6d3a3bea9f81f7), WORD(0x3e5f0e4a42727373),
+	WORD(0xab4903868f94cede), WORD(0x388a115f13a17de4),
+	/* 7G */
+	WORD(0xdb5fa40d29377c21), WORD(0x74d04f0e39129b48),
+	WORD(0xe227a45c6739ea32), WORD(0xb36292d85962f116),
+	WORD(0x74dd20b4a1bd160e), WORD(0xaa82174e8f386a1a),
+	WORD(0x3b05edf8d13a6aa9), WORD(0x198f88afe6fbe19b),
+	WORD(0x9e5a33b06cdfa509), WORD(0x968be802288a1d04),
+	WORD(0xe9dad27a6101e31b), WORD(0x3245827667d8d654),
+	WORD(0x2b1db9d4fea87036), WORD(0x54423a3a2abe9ac6),
+	WORD(0x38c3431647555aba), WORD(0x0cfb8f779d74fcfc),
+	/* 9G */
+	WORD(0xb62fe7574a81cb19), WORD(0xab2c0782a0aed4f8),
+	WORD(0x953b675ff880074c), WORD(0xfa28d9352a828814),
+	WORD(0x94d6c8b6cbde5c0b), WORD(0xd3360d481af79a1a),
+	WORD(0x3e233ca985087e02), WORD(0x0c642f8e3079ee01),
+	WORD(0x7d4f540a37a60ea1), WORD(0xc4b9eae00378fdbb),
+	WORD(0x4e4cf1c99eaa6d0a), WORD(0x50c0a22a719decb0),
+	WORD(0xb362b003da9dd1ee), WORD(0x709ba6a0ce177102),
+	WORD(0x7e93cea89207e7b5), WORD(0x001965f984c26c85),
+	/* 11G */
+	WORD(0xf3dc0f4cbd005285), WORD(0xb735de141e219ba3),
+	WORD(0xb2b570d9d5ec40a7), WORD(0xbb7aa1daeb4bb114),
+	WORD(0xfb0057c88ea6ea77), WORD(0xc866d7bc4b616c57),
+	WORD(0x9b298af732240a1b), WORD(0x346c82040461d191),
+	WORD(0x41295e37c0748f02), WORD(0xbc1026639323e4de),
+	WORD(0xe6e916a817673915), WORD(0x81de67da708778b4),
+	WORD(0x9e1963a4e817151b), WORD(0x2fd6509d0809a47d),
+	WORD(0x3c4891ba42754ac0), WORD(0x3e2710fb152ffce1),
+	/* 13G */
+	WORD(0x6c502eb641eea60b), WORD(0xad369e42b469ab26),
+	WORD(0x3ad216e93682b7ed), WORD(0x2bd40ef4485f207a),
+	WORD(0xcd4e135e509d4fab), WORD(0x5f55fd6cefbdde6b),
+	WORD(0xdb1042e4af1e61e7), WORD(0x419b6415faf19b00),
+	WORD(0xc6b9609af9115ff9), WORD(0xbe070e86ca54e81e),
+	WORD(0x6ec8fc22a0c4ea6a), WORD(0x8fc40ce31090e163),
+	WORD(0xfc11774493b42b02), WORD(0x5128a551862bfb85),
+	WORD(0x925e04da2dc1dbf7), WORD(0x344e0de5e0ce0bff),
+	/* 15G */
+	WORD(0x56c366d08ddabc28), WORD(0x520cef4221fce7b0),
+	WORD(0xa9ec36fc41caf784), WORD(0x2978699944f3ed88),
+	WORD(0x928270c74bfb1c34), WORD(0xf333f93608d03cc5),
+	WORD(0x077f375c5a589870), WORD(0x2a0d5e92a62ace49),
+	WORD(0xc4f47a03042f643f), WORD(0xe49c0281fdb8ee94),
+	WORD(0x1cfe6bd120209382), WORD(0x4f36613927b29ae1),
+	WORD(0x350753146e21f96f), WORD(0x5a7e069840fa6a45),
+	WORD(0x901fa72522981294), WORD(0x0f5d917cf9778cd4),
+	/* 17G */
+	WORD(0x27c85efa2b056ddd), WORD(0xb142d7433467cf6d),
+	WORD(0xd0f0aa1e1b5d1cd5), WORD(0x126e0b86f1c99884),
+	WORD(0xcd4d39e2cb597def), WORD(0x8ee0be884e93158c),
+	WORD(0xf4fea6904a349746), WORD(0x395437d993631746),
+	WORD(0xbf16230d9ebbef2f), WORD(0xc94236921d5133bd),
+	WORD(0xd1ef8ecd3c7dbd4b), WORD(0x776ce91afa929a83),
+	WORD(0xf45abf2157c98676), WORD(0xfdca8b8987686916),
+	WORD(0x397690db00bfdb0b), WORD(0x213ba58ee127f31e),
+	/* 19G */
+	WORD(0xb5bc40e13d0f1140), WORD(0xaca35766447793f1),
+	WORD(0x0bbbc87ad4ae1260), WORD(0xfe0b6f6a96331528),
+	WORD(0x325e316996554316), WORD(0xd9becf518f6cc700),
+	WORD(0xb14445eef8bf3791), WORD(0x1b42f4cd9e31f87d),
+	WORD(0xb51dd6017185e208), WORD(0x3719a47432ce96c8),
+	WORD(0xf320bcb35fc52faa), WORD(0x9adff72a2fdccb6d),
+	WORD(0x4d8aacdf868aa3e9), WORD(0x99254210291f0ca6),
+	WORD(0x5dbbfb2ffe1497a6), WORD(0x10961811c5dbf162),
+	/* 21G */
+	WORD(0x18c3d501032ee3bc), WORD(0x328170f160b08fe9),
+	WORD(0x3705f06c45623777), WORD(0xc0eec0ae41d8e929),
+	WORD(0x8db469f7214d11c4), WORD(0x770541e3a478eb66),
+	WORD(0x8bcd9598d39dccbc), WORD(0x0f3512cc8664ded7),
+	WORD(0x5d6901a5d5d8c433), WORD(0x7285c9bbe9980728),
+	WORD(0xaccab671a450bc0f), WORD(0x2a35bc5085d2a7b5),
+	WORD(0x48a76c29af56a849), WORD(0xbdeab707a1529702),
+	WORD(0x15597df20d93eeec), WORD(0x3c196801b768a66a),
+	/* 23G */
+	WORD(0x0f17e43220e1e33d), WORD(0xb9c8fbfbc51880bc),
+	WORD(0xb447798b704ad44b), WORD(0xf3b020339595321e),
+	WORD(0x9b00d6dc2a23fa07), WORD(0xde2274bd269dd646),
+	WORD(0x05985095481e2cd5), WORD(0x430d8be2d8ea3e5c),
+	WORD(0xfd0d2c7f6141db09), WORD(0xcea589f8b26121e1),
+	WORD(0x0a7783f9d0d28e6c), WORD(0xf3e43cfe0766b4aa),
+	WORD(0xb0b07b07b9fda024), WORD(0xc61beccc7d796183),
+	WORD(0x5c412057808ad971), WORD(0x35da3bc4dc301876),
+	/* 25G */
+	WORD(0x8c5896f0092c5ca0), WORD(0xffc6d06d5b22caf8),
+	WORD(0x9cf5367dcb5d94de), WORD(0x15cc6b30d39c36c2),
+	WORD(0x5138dcfe2421752d), WORD(0xe88d5d1dac9be5da),
+	WORD(0xe917eba641151ef9), WORD(0x01a51ac87fadd3e9),
+	WORD(0xa5ea6652f2af4eeb), WORD(0x2600441dde661844),
+	WORD(0xebc2fec2f249de59), WORD(0x86d712437c0b21d2),
+	WORD(0x09b5e4e14d2dfbb3), WORD(0x0658dda2dfe031ce),
+	WORD(0x2a6bc023271d91a7), WORD(0x2dbec4e5434155bb),
+	/* 27G */
+	WORD(0xb337c19a7e33624d), WORD(0x44eb723b2921efb6),
+	WORD(0xcf57be93e7329cda), WORD(0xe118cb2c9a46434a),
+	WORD(0x7c67fad9744eb422), WORD(0xa9c8f622fc3b3caf),
+	WORD(0x41b36a19ee1dac17), WORD(0x202bbf849fd1de2b),
+	WORD(0x13d5c880f0af18d2), WORD(0x29842f34a942d690),
+	WORD(0x34599f703170abee), WORD(0x487d5ccb40b3d471),
+	WORD(0xcd26b612eb3e0070), WORD(0xf776eb5ffdf04383),
+	WORD(0xc0cf7ad5fe6a1859), WORD(0x06fa1b5b4e54994d),
+	/* 29G */
+	WORD(0xbb6ec52b20f28717), WORD(0x8723d107af71953a),
+	WORD(0x64e0d8117a5305bb), WORD(0xb103099c0f279119),
+	WORD(0xb8004c1641cb8e54), WORD(0xd8e1ee2eb329e8a8),
+	WORD(0x205c0b9687343d96), WORD(0x148334ff3757aa30),
+	WORD(0x855aebbac1fd526b), WORD(0xeb801f8ba8c23b35),
+	WORD(0x92404a5fb338c8c8), WORD(0xef32c0e4cc9710f2),
+	WORD(0xd676980309621287), WORD(0x7534630d7aa7a92e),
+	WORD(0x74ef467d35a41164), WORD(0x2f69d4070a1cc6d2),
+	/* 31G */
+	WORD(0x257c4fbcf1a14cdd), WORD(0x3ac93e08d6ac4d30),
+	WORD(0xc896875ca1c613c1), WORD(0x350d0b9f59fc190f),
+	WORD(0x46c38a88122d7a3a), WORD(0xa03785ed1e1161b8),
+	WORD(0xfec8aeaa19c9f5b6), WORD(0x3e8627630ae8c096),
+	WORD(0xe083277f70d2f2a8), WORD(0x8d8ada1046d0f439),
+	WORD(0x0172ef6f1bc931e7), WORD(0xda18ace11c65f93f),
+	WORD(0x62a699985bfa714d), WORD(0xc612dce587abea72),
+	WORD(0xa4b149a0087a9914), WORD(0x3159a83ccf059d0e),
+	/* 33G */
+	WORD(0xe956da3e63252dc3), WORD(0xfdbe3d10e8db8c82),
+	WORD(0xb3144c5a139431db), WORD(0x13b1849379974677),
+	WORD(0xd73cf316b8a8242a), WORD(0xc9d5db1f1830ac23),
+	WORD(0x62778f13d83f80ee), WORD(0x3a54c7728814a302),
+	WORD(0x6467d41497ba5513), WORD(0xac8c91f2af5d96a2),
+	WORD(0xfd72a93af85d4932), WORD(0x5ab6e43889a56833),
+	WORD(0x749449b416a11ca6), WORD(0x084a6f7674eb0b3c),
+	WORD(0xd50a7a24fa1a1852), WORD(0x10b9a0efe1847a6e),
+	/* 35G */
+	WORD(0xf035552dc99bc4cb), WORD(0x412aa0694452020b),
+	WORD(0x8c09eb9696482fd7), WORD(0xf3c6a503246122f2),
+	WORD(0xcf744baf73f3e2db), WORD(0x65cc845234fb78c7),
+	WORD(0xca100f7023afca01), WORD(0x00105244df163d0e),
+	WORD(0xe9aeabb064bfdfa5), WORD(0x2e8c93c9a42fb7fb),
+	WORD(0xa3fd3c886a9ac8a9), WORD(0xfb5d07bd7a2359f3),
+	WORD(0x9f55a022a6c7355d), WORD(0x5a23a987cdacb485),
+	WORD(0x7dcfaf2c72f815b3), WORD(0x2f2b19583a9f2b0a),
+	/* 37G */
+	WORD(0x8df2ffb43140e8d5), WORD(0x345d0d402a74a341),
+	WORD(0xf9c6784d9ba9fbd8), WORD(0xbb9aedec915a5606),
+	WORD(0x686f3cda6c4d1b57), WORD(0x5fcc81f6f15cc570),
+	WORD(0xfc1081be11847823), WORD(0x17c2a7cb8ec39ddb),
+	WORD(0x74d6c8a61ac36828), WORD(0x7027b387cc8d8141),
+	WORD(0xcf41f07ff366c98c), WORD(0xb47ed7b1feee94d5),
+	WORD(0x17741a6a4c8b151b), WORD(0xe701514602457555),
+	WORD(0x070e87d6f7c90242), WORD(0x1e2112b12a271e5d),
+	/* 39G */
+	WORD(0x6cd09e09ffa9b64f), WORD(0xaf8de311bdada46b),
+	WORD(0xb1914a605c6b62b9), WORD(0xd4e278745d42966b),
+	WORD(0xc06b9bb0cb4e9218), WORD(0x8151de892a2c4e2a),
+	WORD(0x5ae813a213ad4293), WORD(0x0a970ae608f70376),
+	WORD(0x146b2b84062b523c), WORD(0x6fbe510f06e47140),
+	WORD(0x31590282a84ac90c), WORD(0x685344f2f2ef6a84),
+	WORD(0xdd13d150900ea0fb), WORD(0x0b19fe2f85f0cf14),
+	WORD(0xc098aa12beaae093), WORD(0x23b295fa03b92fda),
+	/* 41G */
+	WORD(0x9b7b8a9ba3d03509), WORD(0xaff8e964a97900cd),
+	WORD(0xbdc47fd8aac7189a), WORD(0x413c43b13b665758),
+	WORD(0x55582fc7d7963b62), WORD(0x23def385ea8f34bc),
+	WORD(0xc195d70fca6edb33), WORD(0x1cc9cdcf9533ed45),
+	WORD(0xd85cd9e29a172417), WORD(0xdcd5e40b76313256),
+	WORD(0x1d76f7c692a631f8), WORD(0x696b988c21e28c80),
+	WORD(0x244eef309b6327f7), WORD(0xbc492b988b2df74b),
+	WORD(0xfab3de61f3a7c940), WORD(0x0d0a5af2cbb95382),
+	/* 43G */
+	WORD(0x94df4770d4d0521c), WORD(0x58eba86c05ea58ef),
+	WORD(0x81ed06245f35f8dc), WORD(0xd220c5e25ccc4086),
+	WORD(0x50cd1a162b920025), WORD(0xee21a9b6053b1bae),
+	WORD(0x3c6bfaf5a6fe2a1a), WORD(0x11b35f793aa7574b),
+	WORD(0x048070487b72c8ad), WORD(0xd07f27868d641cae),
+	WORD(0xc7a7fc5ba57002e9), WORD(0x6e0f43b03d2e2492),
+	WORD(0x3ed9a884bee1bac3), WORD(0x337bac17a8851341),
+	WORD(0x05053a4d88035f57), WORD(0x3c62f5d87ef4fb49),
+	/* 45G */
+	WORD(0x14c1d5c5190a3ead), WORD(0x609988fd10b395c3),
+	WORD(0x41586f41e650a92a), WORD(0xe5b49f9a9758a538),
+	WORD(0x73d2b7debcc0159c), WORD(0x5dde72f4de1e262c),
+	WORD(0xddf907221c7cd389), WORD(0x212dea42f4539321),
+	WORD(0x6ec2bda5659b7d1b), WORD(0x6c67a67c7a75ad48),
+	WORD(0xf56a03d1fe0c8a41), WORD(0x690dfca6e6ce1f5f),
+	WORD(0x5025e54475df00c4), WORD(0xec0f8bc38eee873e),
+	WORD(0x5d406d19c3ed0522), WORD(0x245176ef23ecb753),
+	/* 47G */
+	WORD(0x71f71f1b2e576b9c), WORD(0x0ea99c5d2875b564),
+	WORD(0x29ae99e2be52c775), WORD(0x9267661557c61a99),
+	WORD(0xcef81407f608a695), WORD(0x9935a1b31aaded9c),
+	WORD(0xcce9f302d569c0d2), WORD(0x3a877c3fed0ac71b),
+	WORD(0x92043b2c7bd244f4), WORD(0xa2d621587a764898),
+	WORD(0x57f15a84a69f485f), WORD(0xbf5e21c01064f217),
+	WORD(0x4bb701a94e9d6809), WORD(0xde080fbc69dd7712),
+	WORD(0x114ac34a2a7775b1), WORD(0x3094608c29b9f58f),
+	/* 49G */
+	WORD(0xc4f9d38803f2fe8b), WORD(0x1cf7a0e1d582a579),
+	WORD(0xae02d4667197801b), WORD(0x8d4c1c325fc5f8a4),
+	WORD(0xba025726acab50f5), WORD(0xcc30c05473612e02),
+	WORD(0x19bf36fed803dce7), WORD(0x3ea9712ff7830b30),
+	WORD(0x5c5bd59976e844c9), WORD(0x4bf5abb3f61f4f40),
+	WORD(0xf10fdddeb44f984a), WORD(0xfc3e500259c7af48),
+	WORD(0x05807f59648eb6de), WORD(0xf225e3f509e0f31a),
+	WORD(0x4059f5edf9ca83d1), WORD(0x22c8fcd4716dfdfc),
+	/* 51G */
+	WORD(0x0ad5d548ca3f6f47), WORD(0xc3df68dc7cb4e859),
+	WORD(0x8c6324cd85505682), WORD(0x181a8d798fd5998d),
+	WORD(0x838fa9945e027840), WORD(0x12c302060a342ce0),
+	WORD(0x6b8fafdc4a89df4c), WORD(0x38665c784ddf5801),
+	WORD(0xfbe5e55c6eef57a1), WORD(0xcd480bd78ef33d7c),
+	WORD(0x7bad8c9175384575), WORD(0x565e7dd96b4471ad),
+	WORD(0x0ad77fe95b1feac9), WORD(0x88acab535d875b48),
+	WORD(0x2f0337e2f4228966), WORD(0x2c67c8b1338b1f7b),
+	/* 53G */
+	WORD(0x12fbc6bc1b0616e6), WORD(0xca4e72dab0b46ab4),
+	WORD(0x3d232b25f47b74d4), WORD(0x670f7b480edf2822),
+	WORD(0x1bfdb1d49f5b0298), WORD(0x9785833436459cf8),
+	WORD(0x1aaad094cf0fbd27), WORD(0x1057c7e363c620bc),
+	WORD(0x17a05486b51a4c71), WORD(0x1bb7d6d6aa313651),
+	WORD(0x5d4908650f2ce789), WORD(0xcf7b8f1ff3ab93f7),
+	WORD(0x588aad6c498051c6), WORD(0x7df27e38149e3900),
+	WORD(0xf1db6ee2d177bfd5), WORD(0x43fea57bd67ea8fe),
+	/* 55G */
+	WORD(0x2b76ed3d3d61bd4b), WORD(0x5f2980d091f12c89),
+	WORD(0xa36723bf96b4a6c6), WORD(0xebf9d0be6ef453c9),
+	WORD(0x6b7b70110e3151a9), WORD(0x90dea9c1ee418f31),
+	WORD(0xc72c07fb1341a4f7), WORD(0x011e5e86642bc73a),
+	WORD(0xb00f5cc34e92c83f), WORD(0x789de643286a6992),
+	WORD(0x5681f284f55afc3d), WORD(0xe6305351cb7ea903),
+	WORD(0x3aabf673435eb863), WORD(0x9dbb07d6bb97596e),
+	WORD(0xe66135875b728b42), WORD(0x268fcfca61d015c6),
+	/* 57G */
+	WORD(0xcfc5ae910b712c54), WORD(0x712f0b37f886fab6),
+	WORD(0x9565d256ea3cd888), WORD(0x528d03e7faea94e5),
+	WORD(0x953f6a4448bcf734), WORD(0x817988933651e31d),
+	WORD(0x680d53e7be13aa45), WORD(0x3cd6a181f3dc5ac7),
+	WORD(0xe7107fc4d134ec42), WORD(0xe937fa38ecaac574),
+	WORD(0x05aa2bb0c65106c5), WORD(0x2a2b0f45b6c0f9cf),
+	WORD(0x7878c54fe8b09563), WORD(0xd9fe251f48b86514),
+	WORD(0xef765336c5a3319a), WORD(0x3b29f0b99cde9095),
+	/* 59G */
+	WORD(0x7a7df9ee43bc7341), WORD(0x30a2050480bb9db3),
+	WORD(0xd2412a44afb66147), WORD(0xbfdad95fa7f208d9),
+	WORD(0x0e1c91c81ab59997), WORD(0x0adc04e1db391362),
+	WORD(0x98af78bce5006cba), WORD(0x1b0c065d4f8f49c7),
+	WORD(0x654e7abcc67bc4bd), WORD(0xfaf1582a6136ed48),
+	WORD(0xf0ac49566951366b), WORD(0xb56e454164b538e6),
+	WORD(0xec3f9d105bf163ce), WORD(0xd921a422ef02ed80),
+	WORD(0xc1390ae18278b734), WORD(0x27f0c45f8fa69442),
+	/* 61G */
+	WORD(0x8b6c63a33319e823), WORD(0xc7ea88b967931fea),
+	WORD(0xd6c26401d5a68372), WORD(0x311c3039c405fa0c),
+	WORD(0xc0562d48689b6de6), WORD(0x4c407ede17d0a05e),
+	WORD(0x0bf3803ec6cae937), WORD(0x2051a6ecab1eb8aa),
+	WORD(0xa7269d5f9c3058dd), WORD(0xcbd810bc55bf533c),
+	WORD(0x25ca61c8f3d798f2), WORD(0xf0193c466af5cfbd),
+	WORD(0xe5f5499b160433ab), WORD(0xb693274f1e285116),
+	WORD(0x59facd0e6627d151), WORD(0x200fb784f46d067c),
+	/* 63G */
+	WORD(0x5d7e864ed39b84ab), WORD(0x3671339ea0b51b46),
+	WORD(0xb3454ecef345aa04), WORD(0x8ab56b99f91767a8),
+	WORD(0xf60623b1f6d7ad45), WORD(0x665c7c908cbf9e53),
+	WORD(0x264a3553d87949d5), WORD(0x26f9ec99b1cef387),
+	WORD(0x18ecbfddc17b99bf), WORD(0xc76e6539a49149d6),
+	WORD(0xf8610f86c3b83d95), WORD(0x93467e4b07259d60),
+	WORD(0x74aeef1a47a05d72), WORD(0x4002977c77a9e187),
+	WORD(0x1cf6f24a7660ed3c), WORD(0x111b42cfd16e4aa1),
+};
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+static const word_t GOST_512bits_curve_gen_wnaf[] = {
+	/* G */
+	WORD(0xe76e534f), WORD(0x2363f456), WORD(0x162e2d2a), WORD(0x767d200f),
+	WORD(0x8958d86b), WORD(0xc73dc418), WORD(0x8f7f31cf), WORD(0xfbff5cec),
+	WORD(0xef0c8946), WORD(0xfea53f99), WORD(0x500e692f), WORD(0x027f5cc3),
+	WORD(0xa258d5a1), WORD(0x352a3b48), WORD(0xb7369f57), WORD(0x264c5d94),
+	WORD(0x6456137f), WORD(0x8849f68e), WORD(0xe0a8a865), WORD(0x9962e35c),
+	WORD(0xdbb96d1b), WORD(0xea5e008d), WORD(0x0f2d472d), WORD(0xa58c63c8),
+	WORD(0x93d87fe9), WORD(0xfa35ca06), WORD(0x809b10f7), WORD(0x42759ce2),
+	WORD(0xfca689a7), WORD(0xc8a5595d), WORD(0x720b90d4), WORD(0x0e674ffc),
+	/* 3G */
+	WORD(0x42091608), WORD(0x14100713), WORD(0x0eed0197), WORD(0xe22e41b2),
+	WORD(0x54ee0ce3), WORD(0x462b8640), WORD(0xd5899ec0), WORD(0xbacfb43f),
+	WORD(0xa63baaf9), WORD(0x6e1107af), WORD(0xa3b16bf0), WORD(0xaee24853),
+	WORD(0x356f52e8), WORD(0x79fb2ae7), WORD(0xeb3c5c3d), WORD(0x10da182c),
+	WORD(0x89c81c97), WORD(0xdceacb88), WORD(0xa39629e2), WORD(0xf881f770),
+	WORD(0xddabc12d), WORD(0x70a24c5d), WORD(0x7e4259a5), WORD(0x43cc4e86),
+	WORD(0x9a187d7a), WORD(0x228e8ace), WORD(0x1979d596), WORD(0x8f4bb433),
+	WORD(0x7d8617a6), WORD(0x669ea696), WORD(0x56e7c411), WORD(0x04b8af46),
+	/* 5G */
+	WORD(0x0ded5a59), WORD(0xfcbe47ff), WORD(0x41f72eba), WORD(0x2ea4dd31),
+	WORD(0x2636ea89), WORD(0xdf6eaf1a), WORD(0x3712d48d), WORD(0xc9c13be4),
+	WORD(0xff81bea0), WORD(0x7af591af), WORD(0x7ebdc9b3), WORD(0xe7728450),
+	WORD(0xa9b8a8f4), WORD(0x7897b7c1), WORD(0xee3db1af), WORD(0x2788091d),
+	WORD(0xaaf1b6ba), WORD(0xbec493fc), WORD(0x76abfc86), WORD(0x2ea752dd),
+	WORD(0x107e4e74), WORD(0xadf1e790), WORD(0xe1804ee7), WORD(0x90803def),
+	WORD(0xea9f81f7), WORD(0x0b6d3a3b), WORD(0x42727373), WORD(0x3e5f0e4a),
+	WORD(0x8f94cede), WORD(0xab490386), WORD(0x13a17de4), WORD(0x388a115f),
+	/* 7G */
+	WORD(0x29377c21), WORD(0xdb5fa40d), WORD(0x39129b48), WORD(0x74d04f0e),
+	WORD(0x6739ea32), WORD(0xe227a45c), WORD(0x5962f116), WORD(0xb36292d8),
+	WORD(0xa1bd160e), WORD(0x74dd20b4), WORD(0x8f386a1a), WORD(0xaa82174e),
+	WORD(0xd13a6aa9), WORD(0x3b05edf8), WORD(0xe6fbe19b), WORD(0x198f88af),
+	WORD(0x6cdfa509), WORD(0x9e5a33b0), WORD(0x288a1d04), WORD(0x968be802),
+	WORD(0x6101e31b), WORD(0xe9dad27a), WORD(0x67d8d654), WORD(0x32458276),
+	WORD(0xfea87036), WORD(0x2b1db9d4), WORD(0x2abe9ac6), WORD(0x54423a3a),
+	WORD(0x47555aba), WORD(0x38c34316), WORD(0x9d74fcfc), WORD(0x0cfb8f77),
+	/* 9G */
+	WORD(0x4a81cb19), WORD(0xb62fe757), WORD(0xa0aed4f8), WORD(0xab2c0782),
+	WORD(0xf880074c), WORD(0x953b675f), WORD(0x2a828814), WORD(0xfa28d935),
+	WORD(0xcbde5c0b), WORD(0x94d6c8b6), WORD(0x1af79a1a), WORD(0xd3360d48),
+	WORD(0x85087e02), WORD(0x3e233ca9), WORD(0x3079ee01), WORD(0x0c642f8e),
+	WORD(0x37a60ea1), WORD(0x7d4f540a), WORD(0x0378fdbb), WORD(0xc4b9eae0),
+	WORD(0x9eaa6d0a), WORD(0x4e4cf1c9), WORD(0x719decb0), WORD(0x50c0a22a),
+	WORD(0xda9dd1ee), WORD(0xb362b003), WORD(0xce177102), WORD(0x709ba6a0),
+	WORD(0x9207e7b5), WORD(0x7e93cea8), WORD(0x84c26c85), WORD(0x001965f9),
+	/* 11G */
+	WORD(0xbd005285), WORD(0xf3dc0f4c), WORD(0x1e219ba3), WORD(0xb735de14),
+	WORD(0xd5ec40a7), WORD(0xb2b570d9), WORD(0xeb4bb114), WORD(0xbb7aa1da),
+	WORD(0x8ea6ea77), WORD(0xfb0057c8), WORD(0x4b616c57), WORD(0xc866d7bc),
+	WORD(0x32240a1b), WORD(0x9b298af7), WORD(0x0461d191), WORD(0x346c8204),
+	WORD(0xc0748f02), WORD(0x41295e37), WORD(0x9323e4de), WORD(0xbc102663),
+	WORD(0x17673915), WORD(0xe6e916a8), WORD(0x708778b4), WORD(0x81de67da),
+	WORD(0xe817151b), WORD(0x9e1963a4), WORD(0x0809a47d), WORD(0x2fd6509d),
+	WORD(0x42754ac0), WORD(0x3c4891ba), WORD(0x152ffce1), WORD(0x3e2710fb),
+	/* 13G */
+	WORD(0x41eea60b), WORD(0x6c502eb6), WORD(0xb469ab26), WORD(0xad369e42),
+	WORD(0x3682b7ed), WORD(0x3ad216e9), WORD(0x485f207a), WORD(0x2bd40ef4),
+	WORD(0x509d4fab), WORD(0xcd4e135e), WORD(0xefbdde6b), WORD(0x5f55fd6c),
+	WORD(0xaf1e61e7), WORD(0xdb1042e4), WORD(0xfaf19b00), WORD(0x419b6415),
+	WORD(0xf9115ff9), WORD(0xc6b9609a), WORD(0xca54e81e), WORD(0xbe070e86),
+	WORD(0xa0c4ea6a), WORD(0x6ec8fc22), WORD(0x1090e163), WORD(0x8fc40ce3),
+	WORD(0x93b42b02), WORD(0xfc117744), WORD(0x862bfb85), WORD(0x5128a551),
+	WORD(0x2dc1dbf7), WORD(0x925e04da), WORD(0xe0ce0bff), WORD(0x344e0de5),
+	/* 15G */
+	WORD(0x8ddabc28), WORD(0x56c366d0), WORD(0x21fce7b0), WORD(0x520cef42),
+	WORD(0x41caf784), WORD(0xa9ec36fc), WORD(0x44f3ed88), WORD(0x29786999),
+	WORD(0x4bfb1c34), WORD(0x928270c7), WORD(0x08d03cc5), WORD(0xf333f936),
+	WORD(0x5a589870), WORD(0x077f375c), WORD(0xa62ace49), WORD(0x2a0d5e92),
+	WORD(0x042f643f), WORD(0xc4f47a03), WORD(0xfdb8ee94), WORD(0xe49c0281),
+	WORD(0x20209382), WORD(0x1cfe6bd1), WORD(0x27b29ae1), WORD(0x4f366139),
+	WORD(0x6e21f96f), WORD(0x35075314), WORD(0x40fa6a45), WORD(0x5a7e0698),
+	WORD(0x22981294), WORD(0x901fa725), WORD(0xf9778cd4), WORD(0x0f5d917c),
+	/* 17G */
+	WORD(0x2b056ddd), WORD(0x27c85efa), WORD(0x3467cf6d), WORD(0xb142d743),
+	WORD(0x1b5d1cd5), WORD(0xd0f0aa1e), WORD(0xf1c99884), WORD(0x126e0b86),
+	WORD(0xcb597def), WORD(0xcd4d39e2), WORD(0x4e93158c), WORD(0x8ee0be88),
+	WORD(0x4a349746), WORD(0xf4fea690), WORD(0x93631746), WORD(0x395437d9),
+	WORD(0x9ebbef2f), WORD(0xbf16230d), WORD(0x1d5133bd), WORD(0xc9423692),
+	WORD(0x3c7dbd4b), WORD(0xd1ef8ecd), WORD(0xfa929a83), WORD(0x776ce91a),
+	WORD(0x57c98676), WORD(0xf45abf21), WORD(0x87686916), WORD(0xfdca8b89),
+	WORD(0x00bfdb0b), WORD(0x397690db), WORD(0xe127f31e), WORD(0x213ba58e),
+	/* 19G */
+	WORD(0x3d0f1140), WORD(0xb5bc40e1), WORD(0x447793f1), WORD(0xaca35766),
+	WORD(0xd4ae1260), WORD(0x0bbbc87a), WORD(0x96331528), WORD(0xfe0b6f6a),
+	WORD(0x96554316), WORD(0x325e3169), WORD(0x8f6cc700), WORD(0xd9becf51),
+	WORD(0xf8bf3791), WORD(0xb14445ee), WORD(0x9e31f87d), WORD(0x1b42f4cd),
+	WORD(0x7185e208), WORD(0xb51dd601), WORD(0x32ce96c8), WORD(0x3719a474),
+	WORD(0x5fc52faa), WORD(0xf320bcb3), WORD(0x2fdccb6d), WORD(0x9adff72a),
+	WORD(0x868aa3e9), WORD(0x4d8aacdf), WORD(0x291f0ca6), WORD(0x99254210),
+	WORD(0xfe1497a6), WORD(0x5dbbfb2f), WORD(0xc5dbf162), WORD(0x10961811),
+	/* 21G */
+	WORD(0x032ee3bc), WORD(0x18c3d501), WORD(0x60b08fe9), WORD(0x328170f1),
+	WORD(0x45623777), WORD(0x3705f06c), WORD(0x41d8e929), WORD(0xc0eec0ae),
+	WORD(0x214d11c4), WORD(0x8db469f7), WORD(0xa478eb66), WORD(0x770541e3),
+	WORD(0xd39dccbc), WORD(0x8bcd9598), WORD(0x8664ded7), WORD(0x0f3512cc),
+	WORD(0xd5d8c433), WORD(0x5d6901a5), WORD(0xe9980728), WORD(0x7285c9bb),
+	WORD(0xa450bc0f), WORD(0xaccab671), WORD(0x85d2a7b5), WORD(0x2a35bc50),
+	WORD(0xaf56a849), WORD(0x48a76c29), WORD(0xa1529702), WORD(0xbdeab707),
+	WORD(0x0d93eeec), WORD(0x15597df2), WORD(0xb768a66a), WORD(0x3c196801),
+	/* 23G */
+	WORD(0x20e1e33d), WORD(0x0f17e432), WORD(0xc51880bc), WORD(0xb9c8fbfb),
+	WORD(0x704ad44b), WORD(0xb447798b), WORD(0x9595321e), WORD(0xf3b02033),
+	WORD(0x2a23fa07), WORD(0x9b00d6dc), WORD(0x269dd646), WORD(0xde2274bd),
+	WORD(0x481e2cd5), WORD(0x05985095), WORD(0xd8ea3e5c), WORD(0x430d8be2),
+	WORD(0x6141db09), WORD(0xfd0d2c7f), WORD(0xb26121e1), WORD(0xcea589f8),
+	WORD(0xd0d28e6c), WORD(0x0a7783f9), WORD(0x0766b4aa), WORD(0xf3e43cfe),
+	WORD(0xb9fda024), WORD(0xb0b07b07), WORD(0x7d796183), WORD(0xc61beccc),
+	WORD(0x808ad971), WORD(0x5c412057), WORD(0xdc301876), WORD(0x35da3bc4),
+	/* 25G */
+	WORD(0x092c5ca0), WORD(0x8c5896f0), WORD(0x5b22caf8), WORD(0xffc6d06d),
+	WORD(0xcb5d94de), WORD(0x9cf5367d), WORD(0xd39c36c2), WORD(0x15cc6b30),
+	WORD(0x2421752d), WORD(0x5138dcfe), WORD(0xac9be5da), WORD(0xe88d5d1d),
+	WORD(0x41151ef9), WORD(0xe917eba6), WORD(0x7fadd3e9), WORD(0x01a51ac8),
+	WORD(0xf2af4eeb), WORD(0xa5ea6652), WORD(0xde661844), WORD(0x2600441d),
+	WORD(0xf249de59), WORD(0xebc2fec2), WORD(0x7c0b21d2), WORD(0x86d71243),
+	WORD(0x4d2dfbb3), WORD(0x09b5e4e1), WORD(0xdfe031ce), WORD(0x0658dda2),
+	WORD(0x271d91a7), WORD(0x2a6bc023), WORD(0x434155bb), WORD(0x2dbec4e5),
+	/* 27G */
+	WORD(0x7e33624d), WORD(0xb337c19a), WORD(0x2921efb6), WORD(0x44eb723b),
+	WORD(0xe7329cda), WORD(0xcf57be93), WORD(0x9a46434a), WORD(0xe118cb2c),
+	WORD(0x744eb422), WORD(0x7c67fad9), WORD(0xfc3b3caf), WORD(0xa9c8f622),
+	WORD(0xee1dac17), WORD(0x41b36a19), WORD(0x9fd1de2b), WORD(0x202bbf84),
+	WORD(0xf0af18d2), WORD(0x13d5c880), WORD(0xa942d690), WORD(0x29842f34),
+	WORD(0x3170abee), WORD(0x34599f70), WORD(0x40b3d471), WORD(0x487d5ccb),
+	WORD(0xeb3e0070), WORD(0xcd26b612), WORD(0xfdf04383), WORD(0xf776eb5f),
+	WORD(0xfe6a1859), WORD(0xc0cf7ad5), WORD(0x4e54994d), WORD(0x06fa1b5b),
+	/* 29G */
+	WORD(0x20f28717), WORD(0xbb6ec52b), WORD(0xaf71953a), WORD(0x8723d107),
+	WORD(0x7a5305bb), WORD(0x64e0d811), WORD(0x0f279119), WORD(0xb103099c),
+	WORD(0x41cb8e54), WORD(0xb8004c16), WORD(0xb329e8a8), WORD(0xd8e1ee2e),
+	WORD(0x87343d96), WORD(0x205c0b96), WORD(0x3757aa30), WORD(0x148334ff),
+	WORD(0xc1fd526b), WORD(0x855aebba), WORD(0xa8c23b35), WORD(0xeb801f8b),
+	WORD(0xb338c8c8), WORD(0x92404a5f), WORD(0xcc9710f2), WORD(0xef32c0e4),
+	WORD(0x09621287), WORD(0xd6769803), WORD(0x7aa7a92e), WORD(0x7534630d),
+	WORD(0x35a41164), WORD(0x74ef467d), WORD(0x0a1cc6d2), WORD(0x2f69d407),
+	/* 31G */
+	WORD(0xf1a14cdd), WORD(0x257c4fbc), WORD(0xd6ac4d30), WORD(0x3ac93e08),
+	WORD(0xa1c613c1), WORD(0xc896875c), WORD(0x59fc190f), WORD(0x350d0b9f),
+	WORD(0x122d7a3a), WORD(0x46c38a88), WORD(0x1e1161b8), WORD(0xa03785ed),
+	WORD(0x19c9f5b6), WORD(0xfec8aeaa), WORD(0x0ae8c096), WORD(0x3e862763),
+	WORD(0x70d2f2a8), WORD(0xe083277f), WORD(0x46d0f439), WORD(0x8d8ada10),
+	WORD(0x1bc931e7), WORD(0x0172ef6f), WORD(0x1c65f93f), WORD(0xda18ace1),
+	WORD(0x5bfa714d), WORD(0x62a69998), WORD(0x87abea72), WORD(0xc612dce5),
+	WORD(0x087a9914), WORD(0xa4b149a0), WORD(0xcf059d0e), WORD(0x3159a83c),
+	/* 33G */
+	WORD(0x63252dc3), WORD(0xe956da3e), WORD(0xe8db8c82), WORD(0xfdbe3d10),
+	WORD(0x139431db), WORD(0xb3144c5a), WORD(0x79974677), WORD(0x13b18493),
+	WORD(0xb8a8242a), WORD(0xd73cf316), WORD(0x1830ac23), WORD(0xc9d5db1f),
+	WORD(0xd83f80ee), WORD(0x62778f13), WORD(0x8814a302), WORD(0x3a54c772),
+	WORD(0x97ba5513), WORD(0x6467d414), WORD(0xaf5d96a2), WORD(0xac8c91f2),
+	WORD(0xf85d4932), WORD(0xfd72a93a), WORD(0x89a56833), WORD(0x5ab6e438),
+	WORD(0x16a11ca6), WORD(0x749449b4), WORD(0x74eb0b3c), WORD(0x084a6f76),
+	WORD(0xfa1a1852), WORD(0xd50a7a24), WORD(0xe1847a6e), WORD(0x10b9a0ef),
+	/* 35G */
+	WORD(0xc99bc4cb), WORD(0xf035552d), WORD(0x4452020b), WORD(0x412aa069),
+	WORD(0x96482fd7), WORD(0x8c09eb96), WORD(0x246122f2), WORD(0xf3c6a503),
+	WORD(0x73f3e2db), WORD(0xcf744baf), WORD(0x34fb78c7), WORD(0x65cc8452),
+	WORD(0x23afca01), WORD(0xca100f70), WORD(0xdf163d0e), WORD(0x00105244),
+	WORD(0x64bfdfa5), WORD(0xe9aeabb0), WORD(0xa42fb7fb), WORD(0x2e8c93c9),
+	WORD(0x6a9ac8a9), WORD(0xa3fd3c88), WORD(0x7a2359f3), WORD(0xfb5d07bd),
+	WORD(0xa6c7355d), WORD(0x9f55a022), WORD(0xcdacb485), WORD(0x5a23a987),
+	WORD(0x72f815b3), WORD(0x7dcfaf2c), WORD(0x3a9f2b0a), WORD(0x2f2b1958),
+	/* 37G */
+	WORD(0x3140e8d5), WORD(0x8df2ffb4), WORD(0x2a74a341), WORD(0x345d0d40),
+	WORD(0x9ba9fbd8), WORD(0xf9c6784d), WORD(0x915a5606), WORD(0xbb9aedec),
+	WORD(0x6c4d1b57), WORD(0x686f3cda), WORD(0xf15cc570), WORD(0x5fcc81f6),
+	WORD(0x11847823), WORD(0xfc1081be), WORD(0x8ec39ddb), WORD(0x17c2a7cb),
+	WORD(0x1ac36828), WORD(0x74d6c8a6), WORD(0xcc8d8141), WORD(0x7027b387),
+	WORD(0xf366c98c), WORD(0xcf41f07f), WORD(0xfeee94d5), WORD(0xb47ed7b1),
+	WORD(0x4c8b151b), WORD(0x17741a6a), WORD(0x02457555), WORD(0xe7015146),
+	WORD(0xf7c90242), WORD(0x070e87d6), WORD(0x2a271e5d), WORD(0x1e2112b1),
+	/* 39G */
+	WORD(0xffa9b64f), WORD(0x6cd09e09), WORD(0xbdada46b), WORD(0xaf8de311),
+	WORD(0x5c6b62b9), WORD(0xb1914a60), WORD(0x5d42966b), WORD(0xd4e27874),
+	WORD(0xcb4e9218), WORD(0xc06b9bb0), WORD(0x2a2c4e2a), WORD(0x8151de89),
+	WORD(0x13ad4293), WORD(0x5ae813a2), WORD(0x08f70376), WORD(0x0a970ae6),
+	WORD(0x062b523c), WORD(0x146b2b84), WORD(0x06e47140), WORD(0x6fbe510f),
+	WORD(0xa84ac90c), WORD(0x31590282), WORD(0xf2ef6a84), WORD(0x685344f2),
+	WORD(0x900ea0fb), WORD(0xdd13d150), WORD(0x85f0cf14), WORD(0x0b19fe2f),
+	WORD(0xbeaae093), WORD(0xc098aa12), WORD(0x03b92fda), WORD(0x23b295fa),
+	/* 41G */
+	WORD(0xa3d03509), WORD(0x9b7b8a9b), WORD(0xa97900cd), WORD(0xaff8e964),
+	WORD(0xaac7189a), WORD(0xbdc47fd8), WORD(0x3b665758), WORD(0x413c43b1),
+	WORD(0xd7963b62), WORD(0x55582fc7), WORD(0xea8f34bc), WORD(0x23def385),
+	WORD(0xca6edb33), WORD(0xc195d70f), WORD(0x9533ed45), WORD(0x1cc9cdcf),
+	WORD(0x9a172417), WORD(0xd85cd9e2), WORD(0x76313256), WORD(0xdcd5e40b),
+	WORD(0x92a631f8), WORD(0x1d76f7c6), WORD(0x21e28c80), WORD(0x696b988c),
+	WORD(0x9b6327f7), WORD(0x244eef30), WORD(0x8b2df74b), WORD(0xbc492b98),
+	WORD(0xf3a7c940), WORD(0xfab3de61), WORD(0xcbb95382), WORD(0x0d0a5af2),
+	/* 43G */
+	WORD(0xd4d0521c), WORD(0x94df4770), WORD(0x05ea58ef), WORD(0x58eba86c),
+	WORD(0x5f35f8dc), WORD(0x81ed0624), WORD(0x5ccc4086), WORD(0xd220c5e2),
+	WORD(0x2b920025), WORD(0x50cd1a16), WORD(0x053b1bae), WORD(0xee21a9b6),
+	WORD(0xa6fe2a1a), WORD(0x3c6bfaf5), WORD(0x3aa7574b), WORD(0x11b35f79),
+	WORD(0x7b72c8ad), WORD(0x04807048), WORD(0x8d641cae), WORD(0xd07f2786),
+	WORD(0xa57002e9), WORD(0xc7a7fc5b), WORD(0x3d2e2492), WORD(0x6e0f43b0),
+	WORD(0xbee1bac3), WORD(0x3ed9a884), WORD(0xa8851341), WORD(0x337bac17),
+	WORD(0x88035f57), WORD(0x05053a4d), WORD(0x7ef4fb49), WORD(0x3c62f5d8),
+	/* 45G */
+	WORD(0x190a3ead), WORD(0x14c1d5c5), WORD(0x10b395c3), WORD(0x609988fd),
+	WORD(0xe650a92a), WORD(0x41586f41), WORD(0x9758a538), WORD(0xe5b49f9a),
+	WORD(0xbcc0159c), WORD(0x73d2b7de), WORD(0xde1e262c), WORD(0x5dde72f4),
+	WORD(0x1c7cd389), WORD(0xddf90722), WORD(0xf4539321), WORD(0x212dea42),
+	WORD(0x659b7d1b), WORD(0x6ec2bda5), WORD(0x7a75ad48), WORD(0x6c67a67c),
+	WORD(0xfe0c8a41), WORD(0xf56a03d1), WORD(0xe6ce1f5f), WORD(0x690dfca6),
+	WORD(0x75df00c4), WORD(0x5025e544), WORD(0x8eee873e), WORD(0xec0f8bc3),
+	WORD(0xc3ed0522), WORD(0x5d406d19), WORD(0x23ecb753), WORD(0x245176ef),
+	/* 47G */
+	WORD(0x2e576b9c), WORD(0x71f71f1b), WORD(0x2875b564), WORD(0x0ea99c5d),
+	WORD(0xbe52c775), WORD(0x29ae99e2), WORD(0x57c61a99), WORD(0x92676615),
+	WORD(0xf608a695), WORD(0xcef81407), WORD(0x1aaded9c), WORD(0x9935a1b3),
+	WORD(0xd569c0d2), WORD(0xcce9f302), WORD(0xed0ac71b), WORD(0x3a877c3f),
+	WORD(0x7bd244f4), WORD(0x92043b2c), WORD(0x7a764898), WORD(0xa2d62158),
+	WORD(0xa69f485f), WORD(0x57f15a84), WORD(0x1064f217), WORD(0xbf5e21c0),
+	WORD(0x4e9d6809), WORD(0x4bb701a9), WORD(0x69dd7712), WORD(0xde080fbc),
+	WORD(0x2a7775b1), WORD(0x114ac34a), WORD(0x29b9f58f), WORD(0x3094608c),
+	/* 49G */
+	WORD(0x03f2fe8b), WORD(0xc4f9d388), WORD(0xd582a579), WORD(0x1cf7a0e1),
+	WORD(0x7197801b), WORD(0xae02d466), WORD(0x5fc5f8a4), WORD(0x8d4c1c32),
+	WORD(0xacab50f5), WORD(0xba025726), WORD(0x73612e02), WORD(0xcc30c054),
+	WORD(0xd803dce7), WORD(0x19bf36fe), WORD(0xf7830b30), WORD(0x3ea9712f),
+	WORD(0x76e844c9), WORD(0x5c5bd599), WORD(0xf61f4f40), WORD(0x4bf5abb3),
+	WORD(0xb44f984a), WORD(0xf10fddde), WORD(0x59c7af48), WORD(0xfc3e5002),
+	WORD(0x648eb6de), WORD(0x05807f59), WORD(0x09e0f31a), WORD(0xf225e3f5),
+	WORD(0xf9ca83d1), WORD(0x4059f5ed), WORD(0x716dfdfc), WORD(0x22c8fcd4),
+	/* 51G */
+	WORD(0xca3f6f47), WORD(0x0ad5d548), WORD(0x7cb4e859), WORD(0xc3df68dc),
+	WORD(0x85505682), WORD(0x8c6324cd), WORD(0x8fd5998d), WORD(0x181a8d79),
+	WORD(0x5e027840), WORD(0x838fa994), WORD(0x0a342ce0), WORD(0x12c30206),
+	WORD(0x4a89df4c), WORD(0x6b8fafdc), WORD(0x4ddf5801), WORD(0x38665c78),
+	WORD(0x6eef57a1), WORD(0xfbe5e55c), WORD(0x8ef33d7c), WORD(0xcd480bd7),
+	WORD(0x75384575), WORD(0x7bad8c91), WORD(0x6b4471ad), WORD(0x565e7dd9),
+	WORD(0x5b1feac9), WORD(0x0ad77fe9), WORD(0x5d875b48), WORD(0x88acab53),
+	WORD(0xf4228966), WORD(0x2f0337e2), WORD(0x338b1f7b), WORD(0x2c67c8b1),
+	/* 53G */
+	WORD(0x1b0616e6), WORD(0x12fbc6bc), WORD(0xb0b46ab4), WORD(0xca4e72da),
+	WORD(0xf47b74d4), WORD(0x3d232b25), WORD(0x0edf2822), WORD(0x670f7b48),
+	WORD(0x9f5b0298), WORD(0x1bfdb1d4), WORD(0x36459cf8), WORD(0x97858334),
+	WORD(0xcf0fbd27), WORD(0x1aaad094), WORD(0x63c620bc), WORD(0x1057c7e3),
+	WORD(0xb51a4c71), WORD(0x17a05486), WORD(0xaa313651), WORD(0x1bb7d6d6),
+	WORD(0x0f2ce789), WORD(0x5d490865), WORD(0xf3ab93f7), WORD(0xcf7b8f1f),
+	WORD(0x498051c6), WORD(0x588aad6c), WORD(0x149e3900), WORD(0x7df27e38),
+	WORD(0xd177bfd5), WORD(0xf1db6ee2), WORD(0xd67ea8fe), WORD(0x43fea57b),
+	/* 55G */
+	WORD(0x3d61bd4b), WORD(0x2b76ed3d), WORD(0x91f12c89), WORD(0x5f2980d0),
+	WORD(0x96b4a6c6), WORD(0xa36723bf), WORD(0x6ef453c9), WORD(0xebf9d0be),
+	WORD(0x0e3151a9), WORD(0x6b7b7011), WORD(0xee418f31), WORD(0x90dea9c1),
+	WORD(0x1341a4f7), WORD(0xc72c07fb), WORD(0x642bc73a), WORD(0x011e5e86),
+	WORD(0x4e92c83f), WORD(0xb00f5cc3), WORD(0x286a6992), WORD(0x789de643),
+	WORD(0xf55afc3d), WORD(0x5681f284), WORD(0xcb7ea903), WORD(0xe6305351),
+	WORD(0x435eb863), WORD(0x3aabf673), WORD(0xbb97596e), WORD(0x9dbb07d6),
+	WORD(0x5b728b42), WORD(0xe6613587), WORD(0x61d015c6), WORD(0x268fcfca),
+	/* 57G */
+	WORD(0x0b712c54), WORD(0xcfc5ae91), WORD(0xf886fab6), WORD(0x712f0b37),
+	WORD(0xea3cd888), WORD(0x9565d256), WORD(0xfaea94e5), WORD(0x528d03e7),
+	WORD(0x48bcf734), WORD(0x953f6a44), WORD(0x3651e31d), WORD(0x81798893),
+	WORD(0xbe13aa45), WORD(0x680d53e7), WORD(0xf3dc5ac7), WORD(0x3cd6a181),
+	WORD(0xd134ec42), WORD(0xe7107fc4), WORD(0xecaac574), WORD(0xe937fa38),
+	WORD(0xc65106c5), WORD(0x05aa2bb0), WORD(0xb6c0f9cf), WORD(0x2a2b0f45),
+	WORD(0xe8b09563), WORD(0x7878c54f), WORD(0x48b86514), WORD(0xd9fe251f),
+	WORD(0xc5a3319a), WORD(0xef765336), WORD(0x9cde9095), WORD(0x3b29f0b9),
+	/* 59G */
+	WORD(0x43bc7341), WORD(0x7a7df9ee), WORD(0x80bb9db3), WORD(0x30a20504),
+	WORD(0xafb66147), WORD(0xd2412a44), WORD(0xa7f208d9), WORD(0xbfdad95f),
+	WORD(0x1ab59997), WORD(0x0e1c91c8), WORD(0xdb391362), WORD(0x0adc04e1),
+	WORD(0xe5006cba), WORD(0x98af78bc), WORD(0x4f8f49c7), WORD(0x1b0c065d),
+	WORD(0xc67bc4bd), WORD(0x654e7abc), WORD(0x6136ed48), WORD(0xfaf1582a),
+	WORD(0x6951366b), WORD(0xf0ac4956), WORD(0x64b538e6), WORD(0xb56e4541),
+	WORD(0x5bf163ce), WORD(0xec3f9d10), WORD(0xef02ed80), WORD(0xd921a422),
+	WORD(0x8278b734), WORD(0xc1390ae1), WORD(0x8fa69442), WORD(0x27f0c45f),
+	/* 61G */
+	WORD(0x3319e823), WORD(0x8b6c63a3), WORD(0x67931fea), WORD(0xc7ea88b9),
+	WORD(0xd5a68372), WORD(0xd6c26401), WORD(0xc405fa0c), WORD(0x311c3039),
+	WORD(0x689b6de6), WORD(0xc0562d48), WORD(0x17d0a05e), WORD(0x4c407ede),
+	WORD(0xc6cae937), WORD(0x0bf3803e), WORD(0xab1eb8aa), WORD(0x2051a6ec),
+	WORD(0x9c3058dd), WORD(0xa7269d5f), WORD(0x55bf533c), WORD(0xcbd810bc),
+	WORD(0xf3d798f2), WORD(0x25ca61c8), WORD(0x6af5cfbd), WORD(0xf0193c46),
+	WORD(0x160433ab), WORD(0xe5f5499b), WORD(0x1e285116), WORD(0xb693274f),
+	WORD(0x6627d151), WORD(0x59facd0e), WORD(0xf46d067c), WORD(0x200fb784),
+	/* 63G */
+	WORD(0xd39b84ab), WORD(0x5d7e864e), WORD(0xa0b51b46), WORD(0x3671339e),
+	WORD(0xf345aa04), WORD(0xb3454ece), WORD(0xf91767a8), WORD(0x8ab56b99),
+	WORD(0xf6d7ad45), WORD(0xf60623b1), WORD(0x8cbf9e53), WORD(0x665c7c90),
+	WORD(0xd87949d5), WORD(0x264a3553), WORD(0xb1cef387), WORD(0x26f9ec99),
+	WORD(0xc17b99bf), WORD(0x18ecbfdd), WORD(0xa49149d6), WORD(0xc76e6539),
+	WORD(0xc3b83d95), WORD(0xf8610f86), WORD(0x07259d60), WORD(0x93467e4b),
+	WORD(0x47a05d72), WORD(0x74aeef1a), WORD(0x77a9e187), WORD(0x4002977c),
+	WORD(0x7660ed3c), WORD(0x1cf6f24a), WORD(0xd16e4aa1), WORD(0x111b42cf),
+};
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+static const word_t GOST_512bits_curve_gen_wnaf[] = {
+	/* G */
+	WORD(0x534f), WORD(0xe76e), WORD(0xf456), WORD(0x2363), WORD(0x2d2a), WORD(0x162e),
+	WORD(0x200f), WORD(0x767d), WORD(0xd86b), WORD(0x8958), WORD(0xc418), WORD(0xc73d),
+	WORD(0x31cf), WORD(0x8f7f), WORD(0x5cec), WORD(0xfbff), WORD(0x8946), WORD(0xef0c),
+	WORD(0x3f99), WORD(0xfea5), WORD(0x692f), WORD(0x500e), WORD(0x5cc3), WORD(0x027f),
+	WORD(0xd5a1), WORD(0xa258), WORD(0x3b48), WORD(0x352a), WORD(0x9f57), WORD(0xb736),
+	WORD(0x5d94), WORD(0x264c), WORD(0x137f), WORD(0x6456), WORD(0xf68e), WORD(0x8849),
+	WORD(0xa865), WORD(0xe0a8), WORD(0xe35c), WORD(0x9962), WORD(0x6d1b), WORD(0xdbb9),
+	WORD(0x008d), WORD(0xea5e), WORD(0x472d), WORD(0x0f2d), WORD(0x63c8), WORD(0xa58c),
+	WORD(0x7fe9), WORD(0x93d8), WORD(0xca06), WORD(0xfa35), WORD(0x10f7), WORD(0x809b),
+	WORD(0x9ce2), WORD(0x4275), WORD(0x89a7), WORD(0xfca6), WORD(0x595d), WORD(0xc8a5),
+	WORD(0x90d4), WORD(0x720b), WORD(0x4ffc), WORD(0x0e67),
+	/* 3G */
+	WORD(0x1608), WORD(0x4209), WORD(0x0713), WORD(0x1410), WORD(0x0197), WORD(0x0eed),
+	WORD(0x41b2), WORD(0xe22e), WORD(0x0ce3), WORD(0x54ee), WORD(0x8640), WORD(0x462b),
+	WORD(0x9ec0), WORD(0xd589), WORD(0xb43f), WORD(0xbacf), WORD(0xaaf9), WORD(0xa63b),
+	WORD(0x07af), WORD(0x6e11), WORD(0x6bf0), WORD(0xa3b1), WORD(0x4853), WORD(0xaee2),
+	WORD(0x52e8), WORD(0x356f), WORD(0x2ae7), WORD(0x79fb), WORD(0x5c3d), WORD(0xeb3c),
+	WORD(0x182c), WORD(0x10da), WORD(0x1c97), WORD(0x89c8), WORD(0xcb88), WORD(0xdcea),
+	WORD(0x29e2), WORD(0xa396), WORD(0xf770), WORD(0xf881), WORD(0xc12d), WORD(0xddab),
+	WORD(0x4c5d), WORD(0x70a2), WORD(0x59a5), WORD(0x7e42), WORD(0x4e86), WORD(0x43cc),
+	WORD(0x7d7a), WORD(0x9a18), WORD(0x8ace), WORD(0x228e), WORD(0xd596), WORD(0x1979),
+	WORD(0xb433), WORD(0x8f4b), WORD(0x17a6), WORD(0x7d86), WORD(0xa696), WORD(0x669e),
+	WORD(0xc411), WORD(0x56e7), WORD(0xaf46), WORD(0x04b8),
+	/* 5G */
+	WORD(0x5a59), WORD(0x0ded), WORD(0x47ff), WORD(0xfcbe), WORD(0x2eba), WORD(0x41f7),
+	WORD(0xdd31), WORD(0x2ea4), WORD(0xea89), WORD(0x2636), WORD(0xaf1a), WORD(0xdf6e),
+	WORD(0xd48d), WORD(0x3712), WORD(0x3be4), WORD(0xc9c1), WORD(0xbea0), WORD(0xff81),
+	WORD(0x91af), WORD(0x7af5), WORD(0xc9b3), WORD(0x7ebd), WORD(0x8450), WORD(0xe772),
+	WORD(0xa8f4), WORD(0xa9b8), WORD(0xb7c1), WORD(0x7897), WORD(0xb1af), WORD(0xee3d),
+	WORD(0x091d), WORD(0x2788), WORD(0xb6ba), WORD(0xaaf1), WORD(0x93fc), WORD(0xbec4),
+	WORD(0xfc86), WORD(0x76ab), WORD(0x52dd), WORD(0x2ea7), WORD(0x4e74), WORD(0x107e),
+	WORD(0xe790), WORD(0xadf1), WORD(0x4ee7), WORD(0xe180), WORD(0x3def), WORD(0x9080),
+	WORD(0x81f7), WORD(0xea9f), WORD(0x3a3b), WORD(0x0b6d), WORD(0x7373), WORD(0x4272),
+	WORD(0x0e4a), WORD(0x3e5f), WORD(0xcede), WORD(0x8f94), WORD(0x0386), WORD(0xab49),
+	WORD(0x7de4), WORD(0x13a1), WORD(0x115f), WORD(0x388a),
+	/* 7G */
+	WORD(0x7c21), WORD(0x2937), WORD(0xa40d), WORD(0xdb5f), WORD(0x9b48), WORD(0x3912),
+	WORD(0x4f0e), WORD(0x74d0), WORD(0xea32), WORD(0x6739), WORD(0xa45c), WORD(0xe227),
+	WORD(0xf116), WORD(0x5962), WORD(0x92d8), WORD(0xb362), WORD(0x160e), WORD(0xa1bd),
+	WORD(0x20b4), WORD(0x74dd), WORD(0x6a1a), WORD(0x8f38), WORD(0x174e), WORD(0xaa82),
+	WORD(0x6aa9), WORD(0xd13a), WORD(0xedf8), WORD(0x3b05), WORD(0xe19b), WORD(0xe6fb),
+	WORD(0x88af), WORD(0x198f), WORD(0xa509), WORD(0x6cdf), WORD(0x33b0), WORD(0x9e5a),
+	WORD(0x1d04), WORD(0x288a), WORD(0xe802), WORD(0x968b), WORD(0xe31b), WORD(0x6101),
+	WORD(0xd27a), WORD(0xe9da), WORD(0xd654), WORD(0x67d8), WORD(0x8276), WORD(0x3245),
+	WORD(0x7036), WORD(0xfea8), WORD(0xb9d4), WORD(0x2b1d), WORD(0x9ac6), WORD(0x2abe),
+	WORD(0x3a3a), WORD(0x5442), WORD(0x5aba), WORD(0x4755), WORD(0x4316), WORD(0x38c3),
+	WORD(0xfcfc), WORD(0x9d74), WORD(0x8f77), WORD(0x0cfb),
+	/* 9G */
+	WORD(0xcb19), WORD(0x4a81), WORD(0xe757), WORD(0xb62f), WORD(0xd4f8), WORD(0xa0ae),
+	WORD(0x0782), WORD(0xab2c), WORD(0x074c), WORD(0xf880), WORD(0x675f), WORD(0x953b),
+	WORD(0x8814), WORD(0x2a82), WORD(0xd935), WORD(0xfa28), WORD(0x5c0b), WORD(0xcbde),
+	WORD(0xc8b6), WORD(0x94d6), WORD(0x9a1a), WORD(0x1af7), WORD(0x0d48), WORD(0xd336),
+	WORD(0x7e02), WORD(0x8508), WORD(0x3ca9), WORD(0x3e23), WORD(0xee01), WORD(0x3079),
+	WORD(0x2f8e), WORD(0x0c64), WORD(0x0ea1), WORD(0x37a6), WORD(0x540a), WORD(0x7d4f),
+	WORD(0xfdbb), WORD(0x0378), WORD(0xeae0), WORD(0xc4b9), WORD(0x6d0a), WORD(0x9eaa),
+	WORD(0xf1c9), WORD(0x4e4c), WORD(0xecb0), WORD(0x719d), WORD(0xa22a), WORD(0x50c0),
+	WORD(0xd1ee), WORD(0xda9d), WORD(0xb003), WORD(0xb362), WORD(0x7102), WORD(0xce17),
+	WORD(0xa6a0), WORD(0x709b), WORD(0xe7b5), WORD(0x9207), WORD(0xcea8), WORD(0x7e93),
+	WORD(0x6c85), WORD(0x84c2), WORD(0x65f9), WORD(0x0019),
+	/* 11G */
+	WORD(0x5285), WORD(0xbd00), WORD(0x0f4c), WORD(0xf3dc), WORD(0x9ba3), WORD(0x1e21),
+	WORD(0xde14), WORD(0xb735), WORD(0x40a7), WORD(0xd5ec), WORD(0x70d9), WORD(0xb2b5),
+	WORD(0xb114), WORD(0xeb4b), WORD(0xa1da), WORD(0xbb7a), WORD(0xea77), WORD(0x8ea6),
+	WORD(0x57c8), WORD(0xfb00), WORD(0x6c57), WORD(0x4b61), WORD(0xd7bc), WORD(0xc866),
+	WORD(0x0a1b), WORD(0x3224), WORD(0x8af7), WORD(0x9b29), WORD(0xd191), WORD(0x0461),
+	WORD(0x8204), WORD(0x346c), WORD(0x8f02), WORD(0xc074), WORD(0x5e37), WORD(0x4129),
+	WORD(0xe4de), WORD(0x9323), WORD(0x2663), WORD(0xbc10), WORD(0x3915), WORD(0x1767),
+	WORD(0x16a8), WORD(0xe6e9), WORD(0x78b4), WORD(0x7087), WORD(0x67da), WORD(0x81de),
+	WORD(0x151b), WORD(0xe817), WORD(0x63a4), WORD(0x9e19), WORD(0xa47d), WORD(0x0809),
+	WORD(0x509d), WORD(0x2fd6), WORD(0x4ac0), WORD(0x4275), WORD(0x91ba), WORD(0x3c48),
+	WORD(0xfce1), WORD(0x152f), WORD(0x10fb), WORD(0x3e27),
+	/* 13G */
+	WORD(0xa60b), WORD(0x41ee), WORD(0x2eb6), WORD(0x6c50), WORD(0xab26), WORD(0xb469),
+	WORD(0x9e42), WORD(0xad36), WORD(0xb7ed), WORD(0x3682), WORD(0x16e9), WORD(0x3ad2),
+	WORD(0x207a), WORD(0x485f), WORD(0x0ef4), WORD(0x2bd4), WORD(0x4fab), WORD(0x509d),
+	WORD(0x135e), WORD(0xcd4e), WORD(0xde6b), WORD(0xefbd), WORD(0xfd6c), WORD(0x5f55),
+	WORD(0x61e7), WORD(0xaf1e), WORD(0x42e4), WORD(0xdb10), WORD(0x9b00), WORD(0xfaf1),
+	WORD(0x6415), WORD(0x419b), WORD(0x5ff9), WORD(0xf911), WORD(0x609a), WORD(0xc6b9),
+	WORD(0xe81e), WORD(0xca54), WORD(0x0e86), WORD(0xbe07), WORD(0xea6a), WORD(0xa0c4),
+	WORD(0xfc22), WORD(0x6ec8), WORD(0xe163), WORD(0x1090), WORD(0x0ce3), WORD(0x8fc4),
+	WORD(0x2b02), WORD(0x93b4), WORD(0x7744), WORD(0xfc11), WORD(0xfb85), WORD(0x862b),
+	WORD(0xa551), WORD(0x5128), WORD(0xdbf7), WORD(0x2dc1), WORD(0x04da), WORD(0x925e),
+	WORD(0x0bff), WORD(0xe0ce), WORD(0x0de5), WORD(0x344e),
+	/* 15G */
+	WORD(0xbc28), WORD(0x8dda), WORD(0x66d0), WORD(0x56c3), WORD(0xe7b0), WORD(0x21fc),
+	WORD(0xef42), WORD(0x520c), WORD(0xf784), WORD(0x41ca), WORD(0x36fc), WORD(0xa9ec),
+	WORD(0xed88), WORD(0x44f3), WORD(0x6999), WORD(0x2978), WORD(0x1c34), WORD(0x4bfb),
+	WORD(0x70c7), WORD(0x9282), WORD(0x3cc5), WORD(0x08d0), WORD(0xf936), WORD(0xf333),
+	WORD(0x9870), WORD(0x5a58), WORD(0x375c), WORD(0x077f), WORD(0xce49), WORD(0xa62a),
+	WORD(0x5e92), WORD(0x2a0d), WORD(0x643f), WORD(0x042f), WORD(0x7a03), WORD(0xc4f4),
+	WORD(0xee94), WORD(0xfdb8), WORD(0x0281), WORD(0xe49c), WORD(0x9382), WORD(0x2020),
+	WORD(0x6bd1), WORD(0x1cfe), WORD(0x9ae1), WORD(0x27b2), WORD(0x6139), WORD(0x4f36),
+	WORD(0xf96f), WORD(0x6e21), WORD(0x5314), WORD(0x3507), WORD(0x6a45), WORD(0x40fa),
+	WORD(0x0698), WORD(0x5a7e), WORD(0x1294), WORD(0x2298), WORD(0xa725), WORD(0x901f),
+	WORD(0x8cd4), WORD(0xf977), WORD(0x917c), WORD(0x0f5d),
+	/* 17G */
+	WORD(0x6ddd), WORD(0x2b05), WORD(0x5efa), WORD(0x27c8), WORD(0xcf6d), WORD(0x3467),
+	WORD(0xd743), WORD(0xb142), WORD(0x1cd5), WORD(0x1b5d), WORD(0xaa1e), WORD(0xd0f0),
+	WORD(0x9884), WORD(0xf1c9), WORD(0x0b86), WORD(0x126e), WORD(0x7def), WORD(0xcb59),
+	WORD(0x39e2), WORD(0xcd4d), WORD(0x158c), WORD(0x4e93), WORD(0xbe88), WORD(0x8ee0),
+	WORD(0x9746), WORD(0x4a34), WORD(0xa690), WORD(0xf4fe), WORD(0x1746), WORD(0x9363),
+	WORD(0x37d9), WORD(0x3954), WORD(0xef2f), WORD(0x9ebb), WORD(0x230d), WORD(0xbf16),
+	WORD(0x33bd), WORD(0x1d51), WORD(0x3692), WORD(0xc942), WORD(0xbd4b), WORD(0x3c7d),
+	WORD(0x8ecd), WORD(0xd1ef), WORD(0x9a83), WORD(0xfa92), WORD(0xe91a), WORD(0x776c),
+	WORD(0x8676), WORD(0x57c9), WORD(0xbf21), WORD(0xf45a), WORD(0x6916), WORD(0x8768),
+	WORD(0x8b89), WORD(0xfdca), WORD(0xdb0b), WORD(0x00bf), WORD(0x90db), WORD(0x3976),
+	WORD(0xf31e), WORD(0xe127), WORD(0xa58e), WORD(0x213b),
+	/* 19G */
+	WORD(0x1140), WORD(0x3d0f), WORD(0x40e1), WORD(0xb5bc), WORD(0x93f1), WORD(0x4477),
+	WORD(0x5766), WORD(0xaca3), WORD(0x1260), WORD(0xd4ae), WORD(0xc87a), WORD(0x0bbb),
+	WORD(0x1528), WORD(0x9633), WORD(0x6f6a), WORD(0xfe0b), WORD(0x4316), WORD(0x9655),
+	WORD(0x3169), WORD(0x325e), WORD(0xc700), WORD(0x8f6c), WORD(0xcf51), WORD(0xd9be),
+	WORD(0x3791), WORD(0xf8bf), WORD(0x45ee), WORD(0xb144), WORD(0xf87d), WORD(0x9e31),
+	WORD(0xf4cd), WORD(0x1b42), WORD(0xe208), WORD(0x7185), WORD(0xd601), WORD(0xb51d),
+	WORD(0x96c8), WORD(0x32ce), WORD(0xa474), WORD(0x3719), WORD(0x2faa), WORD(0x5fc5),
+	WORD(0xbcb3), WORD(0xf320), WORD(0xcb6d), WORD(0x2fdc), WORD(0xf72a), WORD(0x9adf),
+	WORD(0xa3e9), WORD(0x868a), WORD(0xacdf), WORD(0x4d8a), WORD(0x0ca6), WORD(0x291f),
+	WORD(0x4210), WORD(0x9925), WORD(0x97a6), WORD(0xfe14), WORD(0xfb2f), WORD(0x5dbb),
+	WORD(0xf162), WORD(0xc5db), WORD(0x1811), WORD(0x1096),
+	/* 21G */
+	WORD(0xe3bc), WORD(0x032e), WORD(0xd501), WORD(0x18c3), WORD(0x8fe9), WORD(0x60b0),
+	WORD(0x70f1), WORD(0x3281), WORD(0x3777), WORD(0x4562), WORD(0xf06c), WORD(0x3705),
+	WORD(0xe929), WORD(0x41d8), WORD(0xc0ae), WORD(0xc0ee), WORD(0x11c4), WORD(0x214d),
+	WORD(0x69f7), WORD(0x8db4), WORD(0xeb66), WORD(0xa478), WORD(0x41e3), WORD(0x7705),
+	WORD(0xccbc), WORD(0xd39d), WORD(0x9598), WORD(0x8bcd), WORD(0xded7), WORD(0x8664),
+	WORD(0x12cc), WORD(0x0f35), WORD(0xc433), WORD(0xd5d8), WORD(0x01a5), WORD(0x5d69),
+	WORD(0x0728), WORD(0xe998), WORD(0xc9bb), WORD(0x7285), WORD(0xbc0f), WORD(0xa450),
+	WORD(0xb671), WORD(0xacca), WORD(0xa7b5), WORD(0x85d2), WORD(0xbc50), WORD(0x2a35),
+	WORD(0xa849), WORD(0xaf56), WORD(0x6c29), WORD(0x48a7), WORD(0x9702), WORD(0xa152),
+	WORD(0xb707), WORD(0xbdea), WORD(0xeeec), WORD(0x0d93), WORD(0x7df2), WORD(0x1559),
+	WORD(0xa66a), WORD(0xb768), WORD(0x6801), WORD(0x3c19),
+	/* 23G */
+	WORD(0xe33d), WORD(0x20e1), WORD(0xe432), WORD(0x0f17), WORD(0x80bc), WORD(0xc518),
+	WORD(0xfbfb), WORD(0xb9c8), WORD(0xd44b), WORD(0x704a), WORD(0x798b), WORD(0xb447),
+	WORD(0x321e), WORD(0x9595), WORD(0x2033), WORD(0xf3b0), WORD(0xfa07), WORD(0x2a23),
+	WORD(0xd6dc), WORD(0x9b00), WORD(0xd646), WORD(0x269d), WORD(0x74bd), WORD(0xde22),
+	WORD(0x2cd5), WORD(0x481e), WORD(0x5095), WORD(0x0598), WORD(0x3e5c), WORD(0xd8ea),
+	WORD(0x8be2), WORD(0x430d), WORD(0xdb09), WORD(0x6141), WORD(0x2c7f), WORD(0xfd0d),
+	WORD(0x21e1), WORD(0xb261), WORD(0x89f8), WORD(0xcea5), WORD(0x8e6c), WORD(0xd0d2),
+	WORD(0x83f9), WORD(0x0a77), WORD(0xb4aa), WORD(0x0766), WORD(0x3cfe), WORD(0xf3e4),
+	WORD(0xa024), WORD(0xb9fd), WORD(0x7b07), WORD(0xb0b0), WORD(0x6183), WORD(0x7d79),
+	WORD(0xeccc), WORD(0xc61b), WORD(0xd971), WORD(0x808a), WORD(0x2057), WORD(0x5c41),
+	WORD(0x1876), WORD(0xdc30), WORD(0x3bc4), WORD(0x35da),
+	/* 25G */
+	WORD(0x5ca0), WORD(0x092c), WORD(0x96f0), WORD(0x8c58), WORD(0xcaf8), WORD(0x5b22),
+	WORD(0xd06d), WORD(0xffc6), WORD(0x94de), WORD(0xcb5d), WORD(0x367d), WORD(0x9cf5),
+	WORD(0x36c2), WORD(0xd39c), WORD(0x6b30), WORD(0x15cc), WORD(0x752d), WORD(0x2421),
+	WORD(0xdcfe), WORD(0x5138), WORD(0xe5da), WORD(0xac9b), WORD(0x5d1d), WORD(0xe88d),
+	WORD(0x1ef9), WORD(0x4115), WORD(0xeba6), WORD(0xe917), WORD(0xd3e9), WORD(0x7fad),
+	WORD(0x1ac8), WORD(0x01a5), WORD(0x4eeb), WORD(0xf2af), WORD(0x6652), WORD(0xa5ea),
+	WORD(0x1844), WORD(0xde66), WORD(0x441d), WORD(0x2600), WORD(0xde59), WORD(0xf249),
+	WORD(0xfec2), WORD(0xebc2), WORD(0x21d2), WORD(0x7c0b), WORD(0x1243), WORD(0x86d7),
+	WORD(0xfbb3), WORD(0x4d2d), WORD(0xe4e1), WORD(0x09b5), WORD(0x31ce), WORD(0xdfe0),
+	WORD(0xdda2), WORD(0x0658), WORD(0x91a7), WORD(0x271d), WORD(0xc023), WORD(0x2a6b),
+	WORD(0x55bb), WORD(0x4341), WORD(0xc4e5), WORD(0x2dbe),
+	/* 27G */
+	WORD(0x624d), WORD(0x7e33), WORD(0xc19a), WORD(0xb337), WORD(0xefb6), WORD(0x2921),
+	WORD(0x723b), WORD(0x44eb), WORD(0x9cda), WORD(0xe732), WORD(0xbe93), WORD(0xcf57),
+	WORD(0x434a), WORD(0x9a46), WORD(0xcb2c), WORD(0xe118), WORD(0xb422), WORD(0x744e),
+	WORD(0xfad9), WORD(0x7c67), WORD(0x3caf), WORD(0xfc3b), WORD(0xf622), WORD(0xa9c8),
+	WORD(0xac17), WORD(0xee1d), WORD(0x6a19), WORD(0x41b3), WORD(0xde2b), WORD(0x9fd1),
+	WORD(0xbf84), WORD(0x202b), WORD(0x18d2), WORD(0xf0af), WORD(0xc880), WORD(0x13d5),
+	WORD(0xd690), WORD(0xa942), WORD(0x2f34), WORD(0x2984), WORD(0xabee), WORD(0x3170),
+	WORD(0x9f70), WORD(0x3459), WORD(0xd471), WORD(0x40b3), WORD(0x5ccb), WORD(0x487d),
+	WORD(0x0070), WORD(0xeb3e), WORD(0xb612), WORD(0xcd26), WORD(0x4383), WORD(0xfdf0),
+	WORD(0xeb5f), WORD(0xf776), WORD(0x1859), WORD(0xfe6a), WORD(0x7ad5), WORD(0xc0cf),
+	WORD(0x994d), WORD(0x4e54), WORD(0x1b5b), WORD(0x06fa),
+	/* 29G */
+	WORD(0x8717), WORD(0x20f2), WORD(0xc52b), WORD(0xbb6e), WORD(0x953a), WORD(0xaf71),
+	WORD(0xd107), WORD(0x8723), WORD(0x05bb), WORD(0x7a53), WORD(0xd811), WORD(0x64e0),
+	WORD(0x9119), WORD(0x0f27), WORD(0x099c), WORD(0xb103), WORD(0x8e54), WORD(0x41cb),
+	WORD(0x4c16), WORD(0xb800), WORD(0xe8a8), WORD(0xb329), WORD(0xee2e), WORD(0xd8e1),
+	WORD(0x3d96), WORD(0x8734), WORD(0x0b96), WORD(0x205c), WORD(0xaa30), WORD(0x3757),
+	WORD(0x34ff), WORD(0x1483), WORD(0x526b), WORD(0xc1fd), WORD(0xebba), WORD(0x855a),
+	WORD(0x3b35), WORD(0xa8c2), WORD(0x1f8b), WORD(0xeb80), WORD(0xc8c8), WORD(0xb338),
+	WORD(0x4a5f), WORD(0x9240), WORD(0x10f2), WORD(0xcc97), WORD(0xc0e4), WORD(0xef32),
+	WORD(0x1287), WORD(0x0962), WORD(0x9803), WORD(0xd676), WORD(0xa92e), WORD(0x7aa7),
+	WORD(0x630d), WORD(0x7534), WORD(0x1164), WORD(0x35a4), WORD(0x467d), WORD(0x74ef),
+	WORD(0xc6d2), WORD(0x0a1c), WORD(0xd407), WORD(0x2f69),
+	/* 31G */
+	WORD(0x4cdd), WORD(0xf1a1), WORD(0x4fbc), WORD(0x257c), WORD(0x4d30), WORD(0xd6ac),
+	WORD(0x3e08), WORD(0x3ac9), WORD(0x13c1), WORD(0xa1c6), WORD(0x875c), WORD(0xc896),
+	WORD(0x190f), WORD(0x59fc), WORD(0x0b9f), WORD(0x350d), WORD(0x7a3a), WORD(0x122d),
+	WORD(0x8a88), WORD(0x46c3), WORD(0x61b8), WORD(0x1e11), WORD(0x85ed), WORD(0xa037),
+	WORD(0xf5b6), WORD(0x19c9), WORD(0xaeaa), WORD(0xfec8), WORD(0xc096), WORD(0x0ae8),
+	WORD(0x2763), WORD(0x3e86), WORD(0xf2a8), WORD(0x70d2), WORD(0x277f), WORD(0xe083),
+	WORD(0xf439), WORD(0x46d0), WORD(0xda10), WORD(0x8d8a), WORD(0x31e7), WORD(0x1bc9),
+	WORD(0xef6f), WORD(0x0172), WORD(0xf93f), WORD(0x1c65), WORD(0xace1), WORD(0xda18),
+	WORD(0x714d), WORD(0x5bfa), WORD(0x9998), WORD(0x62a6), WORD(0xea72), WORD(0x87ab),
+	WORD(0xdce5), WORD(0xc612), WORD(0x9914), WORD(0x087a), WORD(0x49a0), WORD(0xa4b1),
+	WORD(0x9d0e), WORD(0xcf05), WORD(0xa83c), WORD(0x3159),
+	/* 33G */
+	WORD(0x2dc3), WORD(0x6325), WORD(0xda3e), WORD(0xe956), WORD(0x8c82), WORD(0xe8db),
+	WORD(0x3d10), WORD(0xfdbe), WORD(0x31db), WORD(0x1394), WORD(0x4c5a), WORD(0xb314),
+	WORD(0x4677), WORD(0x7997), WORD(0x8493), WORD(0x13b1), WORD(0x242a), WORD(0xb8a8),
+	WORD(0xf316), WORD(0xd73c), WORD(0xac23), WORD(0x1830), WORD(0xdb1f), WORD(0xc9d5),
+	WORD(0x80ee), WORD(0xd83f), WORD(0x8f13), WORD(0x6277), WORD(0xa302), WORD(0x8814),
+	WORD(0xc772), WORD(0x3a54), WORD(0x5513), WORD(0x97ba), WORD(0xd414), WORD(0x6467),
+	WORD(0x96a2), WORD(0xaf5d), WORD(0x91f2), WORD(0xac8c), WORD(0x4932), WORD(0xf85d),
+	WORD(0xa93a), WORD(0xfd72), WORD(0x6833), WORD(0x89a5), WORD(0xe438), WORD(0x5ab6),
+	WORD(0x1ca6), WORD(0x16a1), WORD(0x49b4), WORD(0x7494), WORD(0x0b3c), WORD(0x74eb),
+	WORD(0x6f76), WORD(0x084a), WORD(0x1852), WORD(0xfa1a), WORD(0x7a24), WORD(0xd50a),
+	WORD(0x7a6e), WORD(0xe184), WORD(0xa0ef), WORD(0x10b9),
+	/* 35G */
+	WORD(0xc4cb), WORD(0xc99b), WORD(0x552d), WORD(0xf035), WORD(0x020b), WORD(0x4452),
+	WORD(0xa069), WORD(0x412a), WORD(0x2fd7), WORD(0x9648), WORD(0xeb96), WORD(0x8c09),
+	WORD(0x22f2), WORD(0x2461), WORD(0xa503), WORD(0xf3c6), WORD(0xe2db), WORD(0x73f3),
+	WORD(0x4baf), WORD(0xcf74), WORD(0x78c7), WORD(0x34fb), WORD(0x8452), WORD(0x65cc),
+	WORD(0xca01), WORD(0x23af), WORD(0x0f70), WORD(0xca10), WORD(0x3d0e), WORD(0xdf16),
+	WORD(0x5244), WORD(0x0010), WORD(0xdfa5), WORD(0x64bf), WORD(0xabb0), WORD(0xe9ae),
+	WORD(0xb7fb), WORD(0xa42f), WORD(0x93c9), WORD(0x2e8c), WORD(0xc8a9), WORD(0x6a9a),
+	WORD(0x3c88), WORD(0xa3fd), WORD(0x59f3), WORD(0x7a23), WORD(0x07bd), WORD(0xfb5d),
+	WORD(0x355d), WORD(0xa6c7), WORD(0xa022), WORD(0x9f55), WORD(0xb485), WORD(0xcdac),
+	WORD(0xa987), WORD(0x5a23), WORD(0x15b3), WORD(0x72f8), WORD(0xaf2c), WORD(0x7dcf),
+	WORD(0x2b0a), WORD(0x3a9f), WORD(0x1958), WORD(0x2f2b),
+	/* 37G */
+	WORD(0xe8d5), WORD(0x3140), WORD(0xffb4), WORD(0x8df2), WORD(0xa341), WORD(0x2a74),
+	WORD(0x0d40), WORD(0x345d), WORD(0xfbd8), WORD(0x9ba9), WORD(0x784d), WORD(0xf9c6),
+	WORD(0x5606), WORD(0x915a), WORD(0xedec), WORD(0xbb9a), WORD(0x1b57), WORD(0x6c4d),
+	WORD(0x3cda), WORD(0x686f), WORD(0xc570), WORD(0xf15c), WORD(0x81f6), WORD(0x5fcc),
+	WORD(0x7823), WORD(0x1184), WORD(0x81be), WORD(0xfc10), WORD(0x9ddb), WORD(0x8ec3),
+	WORD(0xa7cb), WORD(0x17c2), WORD(0x6828), WORD(0x1ac3), WORD(0xc8a6), WORD(0x74d6),
+	WORD(0x8141), WORD(0xcc8d), WORD(0xb387), WORD(0x7027), WORD(0xc98c), WORD(0xf366),
+	WORD(0xf07f), WORD(0xcf41), WORD(0x94d5), WORD(0xfeee), WORD(0xd7b1), WORD(0xb47e),
+	WORD(0x151b), WORD(0x4c8b), WORD(0x1a6a), WORD(0x1774), WORD(0x7555), WORD(0x0245),
+	WORD(0x5146), WORD(0xe701), WORD(0x0242), WORD(0xf7c9), WORD(0x87d6), WORD(0x070e),
+	WORD(0x1e5d), WORD(0x2a27), WORD(0x12b1), WORD(0x1e21),
+	/* 39G */
+	WORD(0xb64f), WORD(0xffa9), WORD(0x9e09), WORD(0x6cd0), WORD(0xa46b), WORD(0xbdad),
+	WORD(0xe311), WORD(0xaf8d), WORD(0x62b9), WORD(0x5c6b), WORD(0x4a60), WORD(0xb191),
+	WORD(0x966b), WORD(0x5d42), WORD(0x7874), WORD(0xd4e2), WORD(0x9218), WORD(0xcb4e),
+	WORD(0x9bb0), WORD(0xc06b), WORD(0x4e2a), WORD(0x2a2c), WORD(0xde89), WORD(0x8151),
+	WORD(0x4293), WORD(0x13ad), WORD(0x13a2), WORD(0x5ae8), WORD(0x0376), WORD(0x08f7),
+	WORD(0x0ae6), WORD(0x0a97), WORD(0x523c), WORD(0x062b), WORD(0x2b84), WORD(0x146b),
+	WORD(0x7140), WORD(0x06e4), WORD(0x510f), WORD(0x6fbe), WORD(0xc90c), WORD(0xa84a),
+	WORD(0x0282), WORD(0x3159), WORD(0x6a84), WORD(0xf2ef), WORD(0x44f2), WORD(0x6853),
+	WORD(0xa0fb), WORD(0x900e), WORD(0xd150), WORD(0xdd13), WORD(0xcf14), WORD(0x85f0),
+	WORD(0xfe2f), WORD(0x0b19), WORD(0xe093), WORD(0xbeaa), WORD(0xaa12), WORD(0xc098),
+	WORD(0x2fda), WORD(0x03b9), WORD(0x95fa), WORD(0x23b2),
+	/* 41G */
+	WORD(0x3509), WORD(0xa3d0), WORD(0x8a9b), WORD(0x9b7b), WORD(0x00cd), WORD(0xa979),
+	WORD(0xe964), WORD(0xaff8), WORD(0x189a), WORD(0xaac7), WORD(0x7fd8), WORD(0xbdc4),
+	WORD(0x5758), WORD(0x3b66), WORD(0x43b1), WORD(0x413c), WORD(0x3b62), WORD(0xd796),
+	WORD(0x2fc7), WORD(0x5558), WORD(0x34bc), WORD(0xea8f), WORD(0xf385), WORD(0x23de),
+	WORD(0xdb33), WORD(0xca6e), WORD(0xd70f), WORD(0xc195), WORD(0xed45), WORD(0x9533),
+	WORD(0xcdcf), WORD(0x1cc9), WORD(0x2417), WORD(0x9a17), WORD(0xd9e2), WORD(0xd85c),
+	WORD(0x3256), WORD(0x7631), WORD(0xe40b), WORD(0xdcd5), WORD(0x31f8), WORD(0x92a6),
+	WORD(0xf7c6), WORD(0x1d76), WORD(0x8c80), WORD(0x21e2), WORD(0x988c), WORD(0x696b),
+	WORD(0x27f7), WORD(0x9b63), WORD(0xef30), WORD(0x244e), WORD(0xf74b), WORD(0x8b2d),
+	WORD(0x2b98), WORD(0xbc49), WORD(0xc940), WORD(0xf3a7), WORD(0xde61), WORD(0xfab3),
+	WORD(0x5382), WORD(0xcbb9), WORD(0x5af2), WORD(0x0d0a),
+	/* 43G */
+	WORD(0x521c), WORD(0xd4d0), WORD(0x4770), WORD(0x94df), WORD(0x58ef), WORD(0x05ea),
+	WORD(0xa86c), WORD(0x58eb), WORD(0xf8dc), WORD(0x5f35), WORD(0x0624), WORD(0x81ed),
+	WORD(0x4086), WORD(0x5ccc), WORD(0xc5e2), WORD(0xd220), WORD(0x0025), WORD(0x2b92),
+	WORD(0x1a16), WORD(0x50cd), WORD(0x1bae), WORD(0x053b), WORD(0xa9b6), WORD(0xee21),
+	WORD(0x2a1a), WORD(0xa6fe), WORD(0xfaf5), WORD(0x3c6b), WORD(0x574b), WORD(0x3aa7),
+	WORD(0x5f79), WORD(0x11b3), WORD(0xc8ad), WORD(0x7b72), WORD(0x7048), WORD(0x0480),
+	WORD(0x1cae), WORD(0x8d64), WORD(0x2786), WORD(0xd07f), WORD(0x02e9), WORD(0xa570),
+	WORD(0xfc5b), WORD(0xc7a7), WORD(0x2492), WORD(0x3d2e), WORD(0x43b0), WORD(0x6e0f),
+	WORD(0xbac3), WORD(0xbee1), WORD(0xa884), WORD(0x3ed9), WORD(0x1341), WORD(0xa885),
+	WORD(0xac17), WORD(0x337b), WORD(0x5f57), WORD(0x8803), WORD(0x3a4d), WORD(0x0505),
+	WORD(0xfb49), WORD(0x7ef4), WORD(0xf5d8), WORD(0x3c62),
+	/* 45G */
+	WORD(0x3ead), WORD(0x190a), WORD(0xd5c5), WORD(0x14c1), WORD(0x95c3), WORD(0x10b3),
+	WORD(0x88fd), WORD(0x6099), WORD(0xa92a), WORD(0xe650), WORD(0x6f41), WORD(0x4158),
+	WORD(0xa538), WORD(0x9758), WORD(0x9f9a), WORD(0xe5b4), WORD(0x159c), WORD(0xbcc0),
+	WORD(0xb7de), WORD(0x73d2), WORD(0x262c), WORD(0xde1e), WORD(0x72f4), WORD(0x5dde),
+	WORD(0xd389), WORD(0x1c7c), WORD(0x0722), WORD(0xddf9), WORD(0x9321), WORD(0xf453),
+	WORD(0xea42), WORD(0x212d), WORD(0x7d1b), WORD(0x659b), WORD(0xbda5), WORD(0x6ec2),
+	WORD(0xad48), WORD(0x7a75), WORD(0xa67c), WORD(0x6c67), WORD(0x8a41), WORD(0xfe0c),
+	WORD(0x03d1), WORD(0xf56a), WORD(0x1f5f), WORD(0xe6ce), WORD(0xfca6), WORD(0x690d),
+	WORD(0x00c4), WORD(0x75df), WORD(0xe544), WORD(0x5025), WORD(0x873e), WORD(0x8eee),
+	WORD(0x8bc3), WORD(0xec0f), WORD(0x0522), WORD(0xc3ed), WORD(0x6d19), WORD(0x5d40),
+	WORD(0xb753), WORD(0x23ec), WORD(0x76ef), WORD(0x2451),
+	/* 47G */
+	WORD(0x6b9c), WORD(0x2e57), WORD(0x1f1b), WORD(0x71f7), WORD(0xb564), WORD(0x2875),
+	WORD(0x9c5d), WORD(0x0ea9), WORD(0xc775), WORD(0xbe52), WORD(0x99e2), WORD(0x29ae),
+	WORD(0x1a99), WORD(0x57c6), WORD(0x6615), WORD(0x9267), WORD(0xa695), WORD(0xf608),
+	WORD(0x1407), WORD(0xcef8), WORD(0xed9c), WORD(0x1aad), WORD(0xa1b3), WORD(0x9935),
+	WORD(0xc0d2), WORD(0xd569), WORD(0xf302), WORD(0xcce9), WORD(0xc71b), WORD(0xed0a),
+	WORD(0x7c3f), WORD(0x3a87), WORD(0x44f4), WORD(0x7bd2), WORD(0x3b2c), WORD(0x9204),
+	WORD(0x4898), WORD(0x7a76), WORD(0x2158), WORD(0xa2d6), WORD(0x485f), WORD(0xa69f),
+	WORD(0x5a84), WORD(0x57f1), WORD(0xf217), WORD(0x1064), WORD(0x21c0), WORD(0xbf5e),
+	WORD(0x6809), WORD(0x4e9d), WORD(0x01a9), WORD(0x4bb7), WORD(0x7712), WORD(0x69dd),
+	WORD(0x0fbc), WORD(0xde08), WORD(0x75b1), WORD(0x2a77), WORD(0xc34a), WORD(0x114a),
+	WORD(0xf58f), WORD(0x29b9), WORD(0x608c), WORD(0x3094),
+	/* 49G */
+	WORD(0xfe8b), WORD(0x03f2), WORD(0xd388), WORD(0xc4f9), WORD(0xa579), WORD(0xd582),
+	WORD(0xa0e1), WORD(0x1cf7), WORD(0x801b), WORD(0x7197), WORD(0xd466), WORD(0xae02),
+	WORD(0xf8a4), WORD(0x5fc5), WORD(0x1c32), WORD(0x8d4c), WORD(0x50f5), WORD(0xacab),
+	WORD(0x5726), WORD(0xba02), WORD(0x2e02), WORD(0x7361), WORD(0xc054), WORD(0xcc30),
+	WORD(0xdce7), WORD(0xd803), WORD(0x36fe), WORD(0x19bf), WORD(0x0b30), WORD(0xf783),
+	WORD(0x712f), WORD(0x3ea9), WORD(0x44c9), WORD(0x76e8), WORD(0xd599), WORD(0x5c5b),
+	WORD(0x4f40), WORD(0xf61f), WORD(0xabb3), WORD(0x4bf5), WORD(0x984a), WORD(0xb44f),
+	WORD(0xddde), WORD(0xf10f), WORD(0xaf48), WORD(0x59c7), WORD(0x5002), WORD(0xfc3e),
+	WORD(0xb6de), WORD(0x648e), WORD(0x7f59), WORD(0x0580), WORD(0xf31a), WORD(0x09e0),
+	WORD(0xe3f5), WORD(0xf225), WORD(0x83d1), WORD(0xf9ca), WORD(0xf5ed), WORD(0x4059),
+	WORD(0xfdfc), WORD(0x716d), WORD(0xfcd4), WORD(0x22c8),
+	/* 51G */
+	WORD(0x6f47), WORD(0xca3f), WORD(0xd548), WORD(0x0ad5), WORD(0xe859), WORD(0x7cb4),
+	WORD(0x68dc), WORD(0xc3df), WORD(0x5682), WORD(0x8550), WORD(0x24cd), WORD(0x8c63),
+	WORD(0x998d), WORD(0x8fd5), WORD(0x8d79), WORD(0x181a), WORD(0x7840), WORD(0x5e02),
+	WORD(0xa994), WORD(0x838f), WORD(0x2ce0), WORD(0x0a34), WORD(0x0206), WORD(0x12c3),
+	WORD(0xdf4c), WORD(0x4a89), WORD(0xafdc), WORD(0x6b8f), WORD(0x5801), WORD(0x4ddf),
+	WORD(0x5c78), WORD(0x3866), WORD(0x57a1), WORD(0x6eef), WORD(0xe55c), WORD(0xfbe5),
+	WORD(0x3d7c), WORD(0x8ef3), WORD(0x0bd7), WORD(0xcd48), WORD(0x4575), WORD(0x7538),
+	WORD(0x8c91), WORD(0x7bad), WORD(0x71ad), WORD(0x6b44), WORD(0x7dd9), WORD(0x565e),
+	WORD(0xeac9), WORD(0x5b1f), WORD(0x7fe9), WORD(0x0ad7), WORD(0x5b48), WORD(0x5d87),
+	WORD(0xab53), WORD(0x88ac), WORD(0x8966), WORD(0xf422), WORD(0x37e2), WORD(0x2f03),
+	WORD(0x1f7b), WORD(0x338b), WORD(0xc8b1), WORD(0x2c67),
+	/* 53G */
+	WORD(0x16e6), WORD(0x1b06), WORD(0xc6bc), WORD(0x12fb), WORD(0x6ab4), WORD(0xb0b4),
+	WORD(0x72da), WORD(0xca4e), WORD(0x74d4), WORD(0xf47b), WORD(0x2b25), WORD(0x3d23),
+	WORD(0x2822), WORD(0x0edf), WORD(0x7b48), WORD(0x670f), WORD(0x0298), WORD(0x9f5b),
+	WORD(0xb1d4), WORD(0x1bfd), WORD(0x9cf8), WORD(0x3645), WORD(0x8334), WORD(0x9785),
+	WORD(0xbd27), WORD(0xcf0f), WORD(0xd094), WORD(0x1aaa), WORD(0x20bc), WORD(0x63c6),
+	WORD(0xc7e3), WORD(0x1057), WORD(0x4c71), WORD(0xb51a), WORD(0x5486), WORD(0x17a0),
+	WORD(0x3651), WORD(0xaa31), WORD(0xd6d6), WORD(0x1bb7), WORD(0xe789), WORD(0x0f2c),
+	WORD(0x0865), WORD(0x5d49), WORD(0x93f7), WORD(0xf3ab), WORD(0x8f1f), WORD(0xcf7b),
+	WORD(0x51c6), WORD(0x4980), WORD(0xad6c), WORD(0x588a), WORD(0x3900), WORD(0x149e),
+	WORD(0x7e38), WORD(0x7df2), WORD(0xbfd5), WORD(0xd177), WORD(0x6ee2), WORD(0xf1db),
+	WORD(0xa8fe), WORD(0xd67e), WORD(0xa57b), WORD(0x43fe),
+	/* 55G */
+	WORD(0xbd4b), WORD(0x3d61), WORD(0xed3d), WORD(0x2b76), WORD(0x2c89), WORD(0x91f1),
+	WORD(0x80d0), WORD(0x5f29), WORD(0xa6c6), WORD(0x96b4), WORD(0x23bf), WORD(0xa367),
+	WORD(0x53c9), WORD(0x6ef4), WORD(0xd0be), WORD(0xebf9), WORD(0x51a9), WORD(0x0e31),
+	WORD(0x7011), WORD(0x6b7b), WORD(0x8f31), WORD(0xee41), WORD(0xa9c1), WORD(0x90de),
+	WORD(0xa4f7), WORD(0x1341), WORD(0x07fb), WORD(0xc72c), WORD(0xc73a), WORD(0x642b),
+	WORD(0x5e86), WORD(0x011e), WORD(0xc83f), WORD(0x4e92), WORD(0x5cc3), WORD(0xb00f),
+	WORD(0x6992), WORD(0x286a), WORD(0xe643), WORD(0x789d), WORD(0xfc3d), WORD(0xf55a),
+	WORD(0xf284), WORD(0x5681), WORD(0xa903), WORD(0xcb7e), WORD(0x5351), WORD(0xe630),
+	WORD(0xb863), WORD(0x435e), WORD(0xf673), WORD(0x3aab), WORD(0x596e), WORD(0xbb97),
+	WORD(0x07d6), WORD(0x9dbb), WORD(0x8b42), WORD(0x5b72), WORD(0x3587), WORD(0xe661),
+	WORD(0x15c6), WORD(0x61d0), WORD(0xcfca), WORD(0x268f),
+	/* 57G */
+	WORD(0x2c54), WORD(0x0b71), WORD(0xae91), WORD(0xcfc5), WORD(0xfab6), WORD(0xf886),
+	WORD(0x0b37), WORD(0x712f), WORD(0xd888), WORD(0xea3c), WORD(0xd256), WORD(0x9565),
+	WORD(0x94e5), WORD(0xfaea), WORD(0x03e7), WORD(0x528d), WORD(0xf734), WORD(0x48bc),
+	WORD(0x6a44), WORD(0x953f), WORD(0xe31d), WORD(0x3651), WORD(0x8893), WORD(0x8179),
+	WORD(0xaa45), WORD(0xbe13), WORD(0x53e7), WORD(0x680d), WORD(0x5ac7), WORD(0xf3dc),
+	WORD(0xa181), WORD(0x3cd6), WORD(0xec42), WORD(0xd134), WORD(0x7fc4), WORD(0xe710),
+	WORD(0xc574), WORD(0xecaa), WORD(0xfa38), WORD(0xe937), WORD(0x06c5), WORD(0xc651),
+	WORD(0x2bb0), WORD(0x05aa), WORD(0xf9cf), WORD(0xb6c0), WORD(0x0f45), WORD(0x2a2b),
+	WORD(0x9563), WORD(0xe8b0), WORD(0xc54f), WORD(0x7878), WORD(0x6514), WORD(0x48b8),
+	WORD(0x251f), WORD(0xd9fe), WORD(0x319a), WORD(0xc5a3), WORD(0x5336), WORD(0xef76),
+	WORD(0x9095), WORD(0x9cde), WORD(0xf0b9), WORD(0x3b29),
+	/* 59G */
+	WORD(0x7341), WORD(0x43bc), WORD(0xf9ee), WORD(0x7a7d), WORD(0x9db3), WORD(0x80bb),
+	WORD(0x0504), WORD(0x30a2), WORD(0x6147), WORD(0xafb6), WORD(0x2a44), WORD(0xd241),
+	WORD(0x08d9), WORD(0xa7f2), WORD(0xd95f), WORD(0xbfda), WORD(0x9997), WORD(0x1ab5),
+	WORD(0x91c8), WORD(0x0e1c), WORD(0x1362), WORD(0xdb39), WORD(0x04e1), WORD(0x0adc),
+	WORD(0x6cba), WORD(0xe500), WORD(0x78bc), WORD(0x98af), WORD(0x49c7), WORD(0x4f8f),
+	WORD(0x065d), WORD(0x1b0c), WORD(0xc4bd), WORD(0xc67b), WORD(0x7abc), WORD(0x654e),
+	WORD(0xed48), WORD(0x6136), WORD(0x582a), WORD(0xfaf1), WORD(0x366b), WORD(0x6951),
+	WORD(0x4956), WORD(0xf0ac), WORD(0x38e6), WORD(0x64b5), WORD(0x4541), WORD(0xb56e),
+	WORD(0x63ce), WORD(0x5bf1), WORD(0x9d10), WORD(0xec3f), WORD(0xed80), WORD(0xef02),
+	WORD(0xa422), WORD(0xd921), WORD(0xb734), WORD(0x8278), WORD(0x0ae1), WORD(0xc139),
+	WORD(0x9442), WORD(0x8fa6), WORD(0xc45f), WORD(0x27f0),
+	/* 61G */
+	WORD(0xe823), WORD(0x3319), WORD(0x63a3), WORD(0x8b6c), WORD(0x1fea), WORD(0x6793),
+	WORD(0x88b9), WORD(0xc7ea), WORD(0x8372), WORD(0xd5a6), WORD(0x6401), WORD(0xd6c2),
+	WORD(0xfa0c), WORD(0xc405), WORD(0x3039), WORD(0x311c), WORD(0x6de6), WORD(0x689b),
+	WORD(0x2d48), WORD(0xc056), WORD(0xa05e), WORD(0x17d0), WORD(0x7ede), WORD(0x4c40),
+	WORD(0xe937), WORD(0xc6ca), WORD(0x803e), WORD(0x0bf3), WORD(0xb8aa), WORD(0xab1e),
+	WORD(0xa6ec), WORD(0x2051), WORD(0x58dd), WORD(0x9c30), WORD(0x9d5f), WORD(0xa726),
+	WORD(0x533c), WORD(0x55bf), WORD(0x10bc), WORD(0xcbd8), WORD(0x98f2), WORD(0xf3d7),
+	WORD(0x61c8), WORD(0x25ca), WORD(0xcfbd), WORD(0x6af5), WORD(0x3c46), WORD(0xf019),
+	WORD(0x33ab), WORD(0x1604), WORD(0x499b), WORD(0xe5f5), WORD(0x5116), WORD(0x1e28),
+	WORD(0x274f), WORD(0xb693), WORD(0xd151), WORD(0x6627), WORD(0xcd0e), WORD(0x59fa),
+	WORD(0x067c), WORD(0xf46d), WORD(0xb784), WORD(0x200f),
+	/* 63G */
+	WORD(0x84ab), WORD(0xd39b), WORD(0x864e), WORD(0x5d7e), WORD(0x1b46), WORD(0xa0b5),
+	WORD(0x339e), WORD(0x3671), WORD(0xaa04), WORD(0xf345), WORD(0x4ece), WORD(0xb345),
+	WORD(0x67a8), WORD(0xf917), WORD(0x6b99), WORD(0x8ab5), WORD(0xad45), WORD(0xf6d7),
+	WORD(0x23b1), WORD(0xf606), WORD(0x9e53), WORD(0x8cbf), WORD(0x7c90), WORD(0x665c),
+	WORD(0x49d5), WORD(0xd879), WORD(0x3553), WORD(0x264a), WORD(0xf387), WORD(0xb1ce),
+	WORD(0xec99), WORD(0x26f9), WORD(0x99bf), WORD(0xc17b), WORD(0xbfdd), WORD(0x18ec),
+	WORD(0x49d6), WORD(0xa491), WORD(0x6539), WORD(0xc76e), WORD(0x3d95), WORD(0xc3b8),
+	WORD(0x0f86), WORD(0xf861), WORD(0x9d60), WORD(0x0725), WORD(0x7e4b), WORD(0x9346),
+	WORD(0x5d72), WORD(0x47a0), WORD(0xef1a), WORD(0x74ae), WORD(0xe187), WORD(0x77a9),
+	WORD(0x977c), WORD(0x4002), WORD(0xed3c), WORD(0x7660), WORD(0xf24a), WORD(0x1cf6),
+	WORD(0x4aa1), WORD(0xd16e), WORD(0x42cf), WORD(0x111b),
+};
+#else                     /* unknown word size */
+#error "Unsupported word size"
+#endif
+TO_EC_GEN_TABLE_PARAM(GOST_512bits_curve_gen_wnaf, 7);
+
+/*
+ * Signed comb of the generator for the fixed base multiplications (6
+ * teeth, spacing 86), affine x and y in Montgomery representation
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+static const word_t GOST_512bits_curve_gen_comb[] = {
+	/* T[0] */
+	WORD(0x11db19cac19650ae), WORD(0xe9de9b52f62f3ee0),
+	WORD(0x8e9850dc269c4410), WORD(0xb5e0fa9f5f7043d3),
+	WORD(0x3cca0c89896e6a8f), WORD(0x7f8912837569aaf2),
+	WORD(0x56b0402923669699), WORD(0x0cd0f2dc0479aa15),
+	WORD(0xc3bb148c895a333a), WORD(0xcabbef9f40bd2089),
+	WORD(0xff18d585f358209c), WORD(0xbe8491c78deae2f0),
+	WORD(0xa4e77f21f2977048), WORD(0x6634adf2ace19114),
+	WORD(0x741a76cbe54d2104), WORD(0x1a3a0ebd357c95fd),
+	/* T[1] */
+	WORD(0xd6c17619727a2072), WORD(0x8e531b9fc9c2272c),
+	WORD(0xd0cb01950f47e45e), WORD(0xea6632e7a7948e67),
+	WORD(0xacedc73a9712f42f), WORD(0xa17058d3e2964ee4),
+	WORD(0xb9dd5063d40aabcf), WORD(0x12fc248469dd7d33),
+	WORD(0x07d154459641cb41), WORD(0x9d2a5bf8a1187e3d),
+	WORD(0xa5002bcba5122cc0), WORD(0x5ae6c36a1069cfd5),
+	WORD(0x6aa809c0b4c9af9a), WORD(0x2ff1276edf9f5701),
+	WORD(0x5c17faa17701e215), WORD(0x106da223097a5b7c),
+	/* T[2] */
+	WORD(0xaef00033426bf084), WORD(0xd702322eeee76b9f),
+	WORD(0x35ceceff85f145eb), WORD(0xd6e8314e1e8c5dd8),
+	WORD(0xb8f4dae55fdb24ec), WORD(0xa691ae95ef0e6f66),
+	WORD(0x477a51db22583f7e), WORD(0x149d7acf13af5090),
+	WORD(0x73a986b4ab1851fe), WORD(0xaa7b1b1a310d83bd),
+	WORD(0x9f6f4b688ec0d0cf), WORD(0x5cedf7c6bcaff18c),
+	WORD(0xc7c9ad5d06a47e93), WORD(0xa7cf2b3bdc1b5842),
+	WORD(0xbad60b18c1a68083), WORD(0x2754cdc1c3c61d93),
+	/* T[3] */
+	WORD(0xe14eef62db226c48), WORD(0x86a8ac59d7990f5b),
+	WORD(0x005f03ac7392e7d9), WORD(0x260d400e00003c33),
+	WORD(0x1d1a4c03e5852e12), WORD(0x6396b0cd88ee40ee),
+	WORD(0x66cd671a54182a49), WORD(0x39a64a9ff7d44132),
+	WORD(0x0d3a383ec56ed124), WORD(0x4a38b7f785cf5cba),
+	WORD(0x6ef8ace57c4eb191), WORD(0x5dcf919836296676),
+	WORD(0xddd7029259e49dcd), WORD(0x36e72103bc636de9),
+	WORD(0x46692b629126cff3), WORD(0x17f82850c2e3b2de),
+	/* T[4] */
+	WORD(0x2a884c5fd3278994), WORD(0x2f365f0f9df5db01),
+	WORD(0xd64e412b9cb74677), WORD(0x76e7ff9a5a718745),
+	WORD(0xb8f108f1d5594383), WORD(0xb7c54c91abe0711f),
+	WORD(0x3f5db771acba13df), WORD(0x0d4f4959ff3d4d2a),
+	WORD(0xa562624d1b202402), WORD(0x2ef329c370e5c671),
+	WORD(0x8865e47587285919), WORD(0x72650626d3edc7ed),
+	WORD(0x9ebf44c92ea2fab3), WORD(0x4791a7379e4dda8a),
+	WORD(0xce9fb393db6399dd), WORD(0x13b2428252ac27f9),
+	/* T[5] */
+	WORD(0x6fbf719548040c0f), WORD(0x3e91d604eb25ba9b),
+	WORD(0x7c7756a01dd7e247), WORD(0x1d12b9a399ca4f1d),
+	WORD(0xd22ad37da73a625b), WORD(0xcbf5aec60a80e7e8),
+	WORD(0xa48e567a23bbead0), WORD(0x33825eaaf3a937bf),
+	WORD(0xa608b2eb624a0f8a), WORD(0xad56a98a3bc8fb3e),
+	WORD(0xfaa3e8849d9c1b4f), WORD(0x2e6df822a6f69339),
+	WORD(0x2288c72148155bed), WORD(0x07ad58929c57d309),
+	WORD(0x742abcbfca03375e), WORD(0x2d3fd27e77a62e7e),
+	/* T[6] */
+	WORD(0xafd6fe28dfe86d82), WORD(0xeb704ba2299e4da0),
+	WORD(0x3631dc67be48093c), WORD(0x65e5d39cb4fc610b),
+	WORD(0x09445644ff5c9c0e), WORD(0x7e92068145c1a7a0),
+	WORD(0x14e2206b3657b591), WORD(0x41599aa32bd0c6d4),
+	WORD(0x495f27100cc07314), WORD(0xbf653056870644ae),
+	WORD(0xdbe645164ca2e10f), WORD(0x779445b8b55fa33d),
+	WORD(0x3c0cc2af103987b7), WORD(0xb19755e332894e5f),
+	WORD(0xdea225eb80c0d919), WORD(0x11d9120496ff2ec6),
+	/* T[7] */
+	WORD(0x0d091854917c0780), WORD(0xa49c6fa492c3bcb5),
+	WORD(0xdfda30d2f489046f), WORD(0x82bafd54f5a33f65),
+	WORD(0xc53fe74a7d2cf549), WORD(0xddc929f76d8c7f04),
+	WORD(0xeae0f7582ea6aa42), WORD(0x0f66b32f8b3cf458),
+	WORD(0xf689b9d6ec95f1d6), WORD(0xc5fde4d89b043ec9),
+	WORD(0x48fec5d0f53be693), WORD(0xc108706aae2717cd),
+	WORD(0x7e0a52d9aab1d6f7), WORD(0xf2be0566eefefb88),
+	WORD(0xe98c1e3aad203f23), WORD(0x059ee5a400cf1666),
+	/* T[8] */
+	WORD(0xf8992d43bc4c5005), WORD(0xfe5f735ffe08ca9d),
+	WORD(0x2edfd748b519ebd1), WORD(0x56f20bf59b743c81),
+	WORD(0xf9c19cc52250d7cc), WORD(0xa903a518d2021ca9),
+	WORD(0xf94e6c67c0fab7be), WORD(0x0ff3eaf26ce61449),
+	WORD(0x943c6df81aa8bbff), WORD(0xfde360a7ffffd00b),
+	WORD(0x7b3fd2e4ad378654), WORD(0x5a88778dbb57983f),
+	WORD(0x06256a6a660473c8), WORD(0x218a2248382109dd),
+	WORD(0x22bf8021958d9996), WORD(0x1c0fc17f28b43b49),
+	/* T[9] */
+	WORD(0x3fe254bb3260c263), WORD(0x32414f1fad2c9089),
+	WORD(0x766b6ab922d85132), WORD(0x90e43433e7a23d30),
+	WORD(0xd8dbe886e6a03ba0), WORD(0x139d8fbd7e6606cd),
+	WORD(0x358d14f8754960dc), WORD(0x1a236937a45c4ed9),
+	WORD(0xa04648ca0d5d97c3), WORD(0xf633e7562b19288e),
+	WORD(0x165c1fb35f2cc077), WORD(0x3210d49542bb7f3f),
+	WORD(0x00871755046b234e), WORD(0x5c9041851c1b4fd7),
+	WORD(0xc3260b46c3424d48), WORD(0x00c17e9c6ce94e18),
+	/* T[10] */
+	WORD(0xc24ab25c7bb1a339), WORD(0xbee4c8bb951ef251),
+	WORD(0xbc0f1148cb2d853d), WORD(0x7bad24ac2664a8af),
+	WORD(0xa6e1835c0826f195), WORD(0x502a92fc2d855dfe),
+	WORD(0xf09fa080ee0eaf36), WORD(0x0291d8924b1a4f89),
+	WORD(0x4f3489cefef3d4e0), WORD(0xaa3788ee5ee462b3),
+	WORD(0x4731b8fe832fbaa4), WORD(0x4ff79e12ad00f2b6),
+	WORD(0xb9c9cdaf6eb8277a), WORD(0x6ca45299720156d1),
+	WORD(0x1fe3ff0e84f2bf3f), WORD(0x1079643b77fde032),
+	/* T[11] */
+	WORD(0x964ef49907d3ca78), WORD(0xcb2d998bc1042564),
+	WORD(0x8eb0ada41566053f), WORD(0xb4f982884233d93d),
+	WORD(0x465e3c20a3afcc05), WORD(0xd0f4961320f41ab9),
+	WORD(0x34a601d320ef00db), WORD(0x0ebc8d865431e7d6),
+	WORD(0x3f27599b41c85076), WORD(0xf1b2af901ea8d059),
+	WORD(0xdeb96835b065341d), WORD(0x2827de601cfae46c),
+	WORD(0x740825bfa7aa613b), WORD(0x6c0db38a3e043afa),
+	WORD(0x6366ab753076549c), WORD(0x1354765099d1357c),
+	/* T[12] */
+	WORD(0x6ba1fb2be0f75a0e), WORD(0x7673c548dc10e1f7),
+	WORD(0x4900fed42558a98b), WORD(0x0005333ffb748712),
+	WORD(0xd28b7889a30ab442), WORD(0xaacaef24f72f84e2),
+	WORD(0xbf6c733887ab905e), WORD(0x369a9e29639ea3b6),
+	WORD(0x6201ff93d075de13), WORD(0x8750b2641ab8c20e),
+	WORD(0x5387c80f3712d360), WORD(0x2f453971c52187e6),
+	WORD(0xc29279e19feaa815), WORD(0x5840431301b4d88f),
+	WORD(0x6cb31353fd56ebb1), WORD(0x275674ae065ab048),
+	/* T[13] */
+	WORD(0x38ec30ecbf65087c), WORD(0x35ab5a829917afd3),
+	WORD(0x885d096f36fa31bc), WORD(0x7390065cfa242da9),
+	WORD(0x9a6db8d0a243e2b0), WORD(0x00c0f635c520f02e),
+	WORD(0x747f9e1306a0395d), WORD(0x365abe30b22148e9),
+	WORD(0x8093bb248ed5880b), WORD(0x4320fe7721b28f0f),
+	WORD(0x4a06ee1e5bc77c6d), WORD(0x92de967990f5cf43),
+	WORD(0x5ca99b6f8793f9c9), WORD(0x45dbe32215549ab3),
+	WORD(0x07ce961676e7e6ec), WORD(0x349efbd925c45868),
+	/* T[14] */
+	WORD(0x6271df9f3ce6d3bb), WORD(0x8306870aba0959a8),
+	WORD(0x5c97fd6e7e51ebf0), WORD(0x47f25abff24fbcfa),
+	WORD(0x6a688ea0dbdcea81), WORD(0x34ac1a999594d67d),
+	WORD(0x121347993703e6a3), WORD(0x01670491a204cc5d),
+	WORD(0x084a9906d1ad62ae), WORD(0xa2b2e726b9c05738),
+	WORD(0xeb43d994c0de976a), WORD(0xb54c221baaf3c522),
+	WORD(0xfe06ee07fcadbc82), WORD(0x3ef98decba91df1e),
+	WORD(0xb3adee85b9ac6207), WORD(0x432d5f1e943432e7),
+	/* T[15] */
+	WORD(0xb36fc272de763848), WORD(0x22d9dacace3d7e43),
+	WORD(0x053241634695814d), WORD(0x9a9e653066231d44),
+	WORD(0x85070e188abcbeb1), WORD(0xa38c02308b334032),
+	WORD(0x16d5a529e142eae6), WORD(0x39b8b21205e32ff7),
+	WORD(0x3bf6eaa9639fca01), WORD(0xa2c403256d0d4203),
+	WORD(0x44d75b1cd8853860), WORD(0xce2ebbe6f3be659e),
+	WORD(0x049304842624ea1a), WORD(0x19b25558ba13b4f1),
+	WORD(0x342ec49d01547a4b), WORD(0x1e8c0fbe20e96639),
+	/* T[16] */
+	WORD(0x23b2a994b2bce0e9), WORD(0x0c9011cba4d3e03b),
+	WORD(0x0279791b355d7342), WORD(0x0e3183b20eb27f7b),
+	WORD(0x0ff3417995014c65), WORD(0x0dede13bbea024af),
+	WORD(0x78667d970763484c), WORD(0x408a2c714ec9028b),
+	WORD(0xa18ce215497ea777), WORD(0x3246cd18dd7a6f9e),
+	WORD(0xd01373fc84a65bff), WORD(0x2b13ff64ab09ae05),
+	WORD(0x5046ef0a300e16b1), WORD(0x780c8e0586b1902f),
+	WORD(0x42d6a641bb74537d), WORD(0x3555d4760ceca9af),
+	/* T[17] */
+	WORD(0x9f3025cc17da6499), WORD(0xff5ea9e240193d7a),
+	WORD(0xec2c645965a87a27), WORD(0x1d34ec3e5b6d2f42),
+	WORD(0x225330e2b025ee4d), WORD(0x88fbf34157d8a51b),
+	WORD(0xb3b6918cec2ebbd0), WORD(0x20a88dca13234975),
+	WORD(0xed9c691a4b7f7566), WORD(0x219897d19e83908e),
+	WORD(0xdab9be5c9fb50ced), WORD(0x92ba05d467ac5188),
+	WORD(0x8e44a0a2d863c831), WORD(0x301495e589c785d0),
+	WORD(0x8c8335bd7e67821a), WORD(0x3e9d705068d7ad40),
+	/* T[18] */
+	WORD(0x40dc64d1b48e7978), WORD(0x227c1f78723af26b),
+	WORD(0x01b57cacc92eb910), WORD(0xb475b464c94cc8eb),
+	WORD(0x68692ea7ea2868be), WORD(0x32a62f414f6922ad),
+	WORD(0x5a5fc3dc77f58fb0), WORD(0x1e4e1abeaac8c970),
+	WORD(0x719f7d198ae0e71b), WORD(0x8d85f474d6bdd3c6),
+	WORD(0xba7bb9be95e80b68), WORD(0x9546fb6fe2672494),
+	WORD(0x8c9b5fc99c60b460), WORD(0xf69976409a3faa08),
+	WORD(0x82a6ad7256aa3c05), WORD(0x0a35df853bc47d7b),
+	/* T[19] */
+	WORD(0xbe1ac649d5a392b6), WORD(0x387d8e979d6db368),
+	WORD(0x5117cd2b95515dd7), WORD(0x4cca684da6239df4),
+	WORD(0x263aca451fa42985), WORD(0x187be73886c9ac12),
+	WORD(0x1eb1eb00babdf39b), WORD(0x2f065afebc5a5edb),
+	WORD(0xc84496d66798c80e), WORD(0xcc077d4c95c4f8f5),
+	WORD(0x546cc17b667e9eed), WORD(0xae8e6833fa65e77a),
+	WORD(0x8f8a25a0e9de8417), WORD(0x412d52b0007a38eb),
+	WORD(0x9d8ffde71c5b56a6), WORD(0x357ca1479921d8a3),
+	/* T[20] */
+	WORD(0x87f129dde31e9c4d), WORD(0xa1a015f0968ec08b),
+	WORD(0x48b3aaa900ccb55e), WORD(0x98871989d3fd2d29),
+	WORD(0xef5f473fe22b46f5), WORD(0x4fadf67b1bb5a9c2),
+	WORD(0xbb3b5a6f0a6f3d31), WORD(0x026233ca8891f99e),
+	WORD(0x34b500a4891b77c4), WORD(0x700d46d0d68852de),
+	WORD(0x6fc8a19ff3051479), WORD(0x6bcd402aefe76ad4),
+	WORD(0xbda501735f6beeb6), WORD(0x5d5e62fdada845bc),
+	WORD(0x69041100730ffe07), WORD(0x27d48117c6b3fd28),
+	/* T[21] */
+	WORD(0x39048534508b5b66), WORD(0x2c136be5d3d00052),
+	WORD(0x9bc2adeb9e893bca), WORD(0x5f450681f44bcb63),
+	WORD(0x8a7ee4ae5e1b7cf1), WORD(0xc1f28bb77b04e023),
+	WORD(0x52d36976594537f8), WORD(0x38b434f4a8e7b8f5),
+	WORD(0xddeb23167a985419), WORD(0x1e3e14e819c1560d),
+	WORD(0xacbddd36e96ebc8b), WORD(0x26d441ead0efb0eb),
+	WORD(0x006bdd840c58cb36), WORD(0x20d75ec4c9ac6721),
+	WORD(0xd4cdecaa42818292), WORD(0x409277c96158f2fb),
+	/* T[22] */
+	WORD(0x28d24e4fa49de9e5), WORD(0xa1dcd21bf74c41b4),
+	WORD(0xd8cdc3b7e238ea1e), WORD(0xac72651595f2cb08),
+	WORD(0x9972e7bf28e66bda), WORD(0x0f3e977ecaeb985f),
+	WORD(0x6f99ac0a79268f38), WORD(0x379db323e4cc8b78),
+	WORD(0xdcae57ceb21dd3dc), WORD(0x088419dcce0c7906),
+	WORD(0xe25ba46f79addbe6), WORD(0xcbec505721412f9f),
+	WORD(0xa9cb5c574c95a1c3), WORD(0x087910aca064c0a1),
+	WORD(0xe8c9b5d61d5f8aa2), WORD(0x2baf2b6f2bc131e2),
+	/* T[23] */
+	WORD(0xed20905c9b7d57f7), WORD(0xbe3edd33544ffc43),
+	WORD(0x0e77bb2b93e0d7dd), WORD(0x9517557ff3c8e831),
+	WORD(0x306b7d40052913a9), WORD(0x7055744f0b9c7f4b),
+	WORD(0xf293c0429a8484f2), WORD(0x3f8435c7f74aea44),
+	WORD(0x57b98fadb91902f3), WORD(0x51837c4432abf7a3),
+	WORD(0x35b546dd145c009c), WORD(0xf4656571ca497417),
+	WORD(0xb4dea7efaad3468e), WORD(0x72057992d547a073),
+	WORD(0xf8d69e588dcb16d1), WORD(0x0038fabedce68c87),
+	/* T[24] */
+	WORD(0x64c980cb4a974738), WORD(0x0b2f2cb812d787c2),
+	WORD(0x7b13df7e2d50a8c8), WORD(0x9de2fa54e94de604),
+	WORD(0x466669c3c5ac4816), WORD(0x685879671f04331f),
+	WORD(0x5662c02d23dfd2fe), WORD(0x14c32965b7edfc3e),
+	WORD(0xd385fa7396206313), WORD(0x52722759c71d2f95),
+	WORD(0xbe2ca9ec49646f49), WORD(0xf2d126856edc220d),
+	WORD(0x77007dcfca546339), WORD(0x9ba403ca1ae0b95c),
+	WORD(0x5b58e92b0f591cd8), WORD(0x0c677c09ca90f5e3),
+	/* T[25] */
+	WORD(0x5f4a01e6b3795a74), WORD(0x4e24ba930fc1623d),
+	WORD(0x65a9c59840c16885), WORD(0xba5b1e13f9ddabfa),
+	WORD(0xd31c51b11e40e79e), WORD(0xbd5bc732482cb960),
+	WORD(0xb795940f78c2e467), WORD(0x21ba8b1bc9fb3ed2),
+	WORD(0x42a3eeabaa455fe9), WORD(0x1b939b74cf394002),
+	WORD(0xd825acecc9577b70), WORD(0x5b0c057d68b6583f),
+	WORD(0x5994985d93125d5a), WORD(0x32fb30254d069dce),
+	WORD(0x5bb374bb0d091df9), WORD(0x3b6b84ca96b51ba4),
+	/* T[26] */
+	WORD(0x6385edf6df0146a7), WORD(0x5d6db2cc3bd795f9),
+	WORD(0xa5941aebda4b5bdc), WORD(0xfebf16966dec2a38),
+	WORD(0xfd14916be1eacb86), WORD(0x74a48c01c054e5bd),
+	WORD(0x89b4431ab0963fd3), WORD(0x1179653e4f6fdcc0),
+	WORD(0x6bc59fa63cbcd0c9), WORD(0x6384ed43fc5a0093),
+	WORD(0xca90ddf4f6eb80e5), WORD(0x0a239dd1dcfd836c),
+	WORD(0x6d36ac5914ff3132), WORD(0x7a93dbcaab38ad9e),
+	WORD(0x71736f2db184fb85), WORD(0x149f2ee0eecf885b),
+	/* T[27] */
+	WORD(0x7d9e4ea9314e6880), WORD(0xc2fec840428aede2),
+	WORD(0x04605937f975680f), WORD(0x7acee0ae450fa5d9),
+	WORD(0xf25505075f4eceb7), WORD(0x21e7aaf7f346dc0b),
+	WORD(0x9b47ada73b4df5bb), WORD(0x213bb23f5b8b7913),
+	WORD(0xc536e09785d43060), WORD(0xd975a6b54c083cb2),
+	WORD(0xd1e7aebf79432838), WORD(0xd44013d78cdcb257),
+	WORD(0x5e82946f27dc037a), WORD(0xd6f1f5d9546bb6ab),
+	WORD(0xaa8b96494bd45c63), WORD(0x1310e68db27424b2),
+	/* T[28] */
+	WORD(0x4e27f3f65fdbf6a7), WORD(0x666a154d0f376b32),
+	WORD(0x130804c6f331c680), WORD(0x3dbcb1c1a04cf99d),
+	WORD(0x372dbb9c516a8191), WORD(0x7498e8b73ca0c65f),
+	WORD(0x061ab95b62389dd3), WORD(0x0cacb399ece99327),
+	WORD(0x4e73a6e2e2a8c10d), WORD(0xbb30815e59841bb6),
+	WORD(0x4021e64f57303c42), WORD(0x475caa017e15dcd3),
+	WORD(0x31644416509e5319), WORD(0x155f6f92ea807b44),
+	WORD(0x2aafecb4d2e7b382), WORD(0x42d5d9a598ab305e),
+	/* T[29] */
+	WORD(0xa55403a35015b494), WORD(0xac286bde127deb3c),
+	WORD(0xbb0c9a3853ad9458), WORD(0x1add8c81b0b8159e),
+	WORD(0x629131dc98ea9d09), WORD(0xbdfb449b76327682),
+	WORD(0x15043190f4c901b7), WORD(0x0f4729642b08fe11),
+	WORD(0x6d958600a95d3079), WORD(0x801030b45367557e),
+	WORD(0xb6a0e5194e67d14d), WORD(0xfa9dde54831adf07),
+	WORD(0x886aff0a645d9787), WORD(0xdd59b5ec2e04cd6d),
+	WORD(0x92b5d235f1ba04e7), WORD(0x2c7c61e04560da70),
+	/* T[30] */
+	WORD(0x169a7b3a764b544f), WORD(0x44510222287072a7),
+	WORD(0x873f92ada4bb13a5), WORD(0x89f64bb58c5c06ca),
+	WORD(0x5eab29c093862a2b), WORD(0x2c44f98c666acf40),
+	WORD(0x376e875376b22ae2), WORD(0x0a078ebf5e8ec304),
+	WORD(0xf965e5253095282e), WORD(0xc873a98bc5266e61),
+	WORD(0xa6fac2515f77babb), WORD(0x607d827563380127),
+	WORD(0x70186c55c0e63d7a), WORD(0x646d0b17a49a0053),
+	WORD(0x2149ed119332585a), WORD(0x0212646d0ea2dca0),
+	/* T[31] */
+	WORD(0xce2c852dc559f374), WORD(0xb534c4d020c57399),
+	WORD(0xb01f80569a1c37f4), WORD(0x8c22fe7654f4ad76),
+	WORD(0x77eb03e57571318a), WORD(0x9b46e8701ae72d09),
+	WORD(0xdf6a8f9304c34157), WORD(0x3b4c736fd48eed15),
+	WORD(0x93e8412782fdf929), WORD(0x4add13678ed4abf4),
+	WORD(0x7b79cda05effd9a6), WORD(0xe344add8498e42bd),
+	WORD(0x774a4ba48bf0c7de), WORD(0x38f3dd898abf4c11),
+	WORD(0xcbed81d96c1fed88), WORD(0x0dffca8e85fa560c),
+};
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+static const word_t GOST_512bits_curve_gen_comb[] = {
+	/* T[0] */
+	WORD(0xc19650ae), WORD(0x11db19ca), WORD(0xf62f3ee0), WORD(0xe9de9b52),
+	WORD(0x269c4410), WORD(0x8e9850dc), WORD(0x5f7043d3), WORD(0xb5e0fa9f),
+	WORD(0x896e6a8f), WORD(0x3cca0c89), WORD(0x7569aaf2), WORD(0x7f891283),
+	WORD(0x23669699), WORD(0x56b04029), WORD(0x0479aa15), WORD(0x0cd0f2dc),
+	WORD(0x895a333a), WORD(0xc3bb148c), WORD(0x40bd2089), WORD(0xcabbef9f),
+	WORD(0xf358209c), WORD(0xff18d585), WORD(0x8deae2f0), WORD(0xbe8491c7),
+	WORD(0xf2977048), WORD(0xa4e77f21), WORD(0xace19114), WORD(0x6634adf2),
+	WORD(0xe54d2104), WORD(0x741a76cb), WORD(0x357c95fd), WORD(0x1a3a0ebd),
+	/* T[1] */
+	WORD(0x727a2072), WORD(0xd6c17619), WORD(0xc9c2272c), WORD(0x8e531b9f),
+	WORD(0x0f47e45e), WORD(0xd0cb0195), WORD(0xa7948e67), WORD(0xea6632e7),
+	WORD(0x9712f42f), WORD(0xacedc73a), WORD(0xe2964ee4), WORD(0xa17058d3),
+	WORD(0xd40aabcf), WORD(0xb9dd5063), WORD(0x69dd7d33), WORD(0x12fc2484),
+	WORD(0x9641cb41), WORD(0x07d15445), WORD(0xa1187e3d), WORD(0x9d2a5bf8),
+	WORD(0xa5122cc0), WORD(0xa5002bcb), WORD(0x1069cfd5), WORD(0x5ae6c36a),
+	WORD(0xb4c9af9a), WORD(0x6aa809c0), WORD(0xdf9f5701), WORD(0x2ff1276e),
+	WORD(0x7701e215), WORD(0x5c17faa1), WORD(0x097a5b7c), WORD(0x106da223),
+	/* T[2] */
+	WORD(0x426bf084), WORD(0xaef00033), WORD(0xeee76b9f), WORD(0xd702322e),
+	WORD(0x85f145eb), WORD(0x35ceceff), WORD(0x1e8c5dd8), WORD(0xd6e8314e),
+	WORD(0x5fdb24ec), WORD(0xb8f4dae5), WORD(0xef0e6f66), WORD(0xa691ae95),
+	WORD(0x22583f7e), WORD(0x477a51db), WORD(0x13af5090), WORD(0x149d7acf),
+	WORD(0xab1851fe), WORD(0x73a986b4), WORD(0x310d83bd), WORD(0xaa7b1b1a),
+	WORD(0x8ec0d0cf), WORD(0x9f6f4b68), WORD(0xbcaff18c), WORD(0x5cedf7c6),
+	WORD(0x06a47e93), WORD(0xc7c9ad5d), WORD(0xdc1b5842), WORD(0xa7cf2b3b),
+	WORD(0xc1a68083), WORD(0xbad60b18), WORD(0xc3c61d93), WORD(0x2754cdc1),
+	/* T[3] */
+	WORD(0xdb226c48), WORD(0xe14eef62), WORD(0xd7990f5b), WORD(0x86a8ac59),
+	WORD(0x7392e7d9), WORD(0x005f03ac), WORD(0x00003c33), WORD(0x260d400e),
+	WORD(0xe5852e12), WORD(0x1d1a4c03), WORD(0x88ee40ee), WORD(0x6396b0cd),
+	WORD(0x54182a49), WORD(0x66cd671a), WORD(0xf7d44132), WORD(0x39a64a9f),
+	WORD(0xc56ed124), WORD(0x0d3a383e), WORD(0x85cf5cba), WORD(0x4a38b7f7),
+	WORD(0x7c4eb191), WORD(0x6ef8ace5), WORD(0x36296676), WORD(0x5dcf9198),
+	WORD(0x59e49dcd), WORD(0xddd70292), WORD(0xbc636de9), WORD(0x36e72103),
+	WORD(0x9126cff3), WORD(0x46692b62), WORD(0xc2e3b2de), WORD(0x17f82850),
+	/* T[4] */
+	WORD(0xd3278994), WORD(0x2a884c5f), WORD(0x9df5db01), WORD(0x2f365f0f),
+	WORD(0x9cb74677), WORD(0xd64e412b), WORD(0x5a718745), WORD(0x76e7ff9a),
+	WORD(0xd5594383), WORD(0xb8f108f1), WORD(0xabe0711f), WORD(0xb7c54c91),
+	WORD(0xacba13df), WORD(0x3f5db771), WORD(0xff3d4d2a), WORD(0x0d4f4959),
+	WORD(0x1b202402), WORD(0xa562624d), WORD(0x70e5c671), WORD(0x2ef329c3),
+	WORD(0x87285919), WORD(0x8865e475), WORD(0xd3edc7ed), WORD(0x72650626),
+	WORD(0x2ea2fab3), WORD(0x9ebf44c9), WORD(0x9e4dda8a), WORD(0x4791a737),
+	WORD(0xdb6399dd), WORD(0xce9fb393), WORD(0x52ac27f9), WORD(0x13b24282),
+	/* T[5] */
+	WORD(0x48040c0f), WORD(0x6fbf7195), WORD(0xeb25ba9b), WORD(0x3e91d604),
+	WORD(0x1dd7e247), WORD(0x7c7756a0), WORD(0x99ca4f1d), WORD(0x1d12b9a3),
+	WORD(0xa73a625b), WORD(0xd22ad37d), WORD(0x0a80e7e8), WORD(0xcbf5aec6),
+	WORD(0x23bbead0), WORD(0xa48e567a), WORD(0xf3a937bf), WORD(0x33825eaa),
+	WORD(0x624a0f8a), WORD(0xa608b2eb), WORD(0x3bc8fb3e), WORD(0xad56a98a),
+	WORD(0x9d9c1b4f), WORD(0xfaa3e884), WORD(0xa6f69339), WORD(0x2e6df822),
+	WORD(0x48155bed), WORD(0x2288c721), WORD(0x9c57d309), WORD(0x07ad5892),
+	WORD(0xca03375e), WORD(0x742abcbf), WORD(0x77a62e7e), WORD(0x2d3fd27e),
+	/* T[6] */
+	WORD(0xdfe86d82), WORD(0xafd6fe28), WORD(0x299e4da0), WORD(0xeb704ba2),
+	WORD(0xbe48093c), WORD(0x3631dc67), WORD(0xb4fc610b), WORD(0x65e5d39c),
+	WORD(0xff5c9c0e), WORD(0x09445644), WORD(0x45c1a7a0), WORD(0x7e920681),
+	WORD(0x3657b591), WORD(0x14e2206b), WORD(0x2bd0c6d4), WORD(0x41599aa3),
+	WORD(0x0cc07314), WORD(0x495f2710), WORD(0x870644ae), WORD(0xbf653056),
+	WORD(0x4ca2e10f), WORD(0xdbe64516), WORD(0xb55fa33d), WORD(0x779445b8),
+	WORD(0x103987b7), WORD(0x3c0cc2af), WORD(0x32894e5f), WORD(0xb19755e3),
+	WORD(0x80c0d919), WORD(0xdea225eb), WORD(0x96ff2ec6), WORD(0x11d91204),
+	/* T[7] */
+	WORD(0x917c0780), WORD(0x0d091854), WORD(0x92c3bcb5), WORD(0xa49c6fa4),
+	WORD(0xf489046f), WORD(0xdfda30d2), WORD(0xf5a33f65), WORD(0x82bafd54),
+	WORD(0x7d2cf549), WORD(0xc53fe74a), WORD(0x6d8c7f04), WORD(0xddc929f7),
+	WORD(0x2ea6aa42), WORD(0xeae0f758), WORD(0x8b3cf458), WORD(0x0f66b32f),
+	WORD(0xec95f1d6), WORD(0xf689b9d6), WORD(0x9b043ec9), WORD(0xc5fde4d8),
+	WORD(0xf53be693), WORD(0x48fec5d0), WORD(0xae2717cd), WORD(0xc108706a),
+	WORD(0xaab1d6f7), WORD(0x7e0a52d9), WORD(0xeefefb88), WORD(0xf2be0566),
+	WORD(0xad203f23), WORD(0xe98c1e3a), WORD(0x00cf1666), WORD(0x059ee5a4),
+	/* T[8] */
+	WORD(0xbc4c5005), WORD(0xf8992d43), WORD(0xfe08ca9d), WORD(0xfe5f735f),
+	WORD(0xb519ebd1), WORD(0x2edfd748), WORD(0x9b743c81), WORD(0x56f20bf5),
+	WORD(0x2250d7cc), WORD(0xf9c19cc5), WORD(0xd2021ca9), WORD(0xa903a518),
+	WORD(0xc0fab7be), WORD(0xf94e6c67), WORD(0x6ce61449), WORD(0x0ff3eaf2),
+	WORD(0x1aa8bbff), WORD(0x943c6df8), WORD(0xffffd00b), WORD(0xfde360a7),
+	WORD(0xad378654), WORD(0x7b3fd2e4), WORD(0xbb57983f), WORD(0x5a88778d),
+	WORD(0x660473c8), WORD(0x06256a6a), WORD(0x382109dd), WORD(0x218a2248),
+	WORD(0x958d9996), WORD(0x22bf8021), WORD(0x28b43b49), WORD(0x1c0fc17f),
+	/* T[9] */
+	WORD(0x3260c263), WORD(0x3fe254bb), WORD(0xad2c9089), WORD(0x32414f1f),
+	WORD(0x22d85132), WORD(0x766b6ab9), WORD(0xe7a23d30), WORD(0x90e43433),
+	WORD(0xe6a03ba0), WORD(0xd8dbe886), WORD(0x7e6606cd), WORD(0x139d8fbd),
+	WORD(0x754960dc), WORD(0x358d14f8), WORD(0xa45c4ed9), WORD(0x1a236937),
+	WORD(0x0d5d97c3), WORD(0xa04648ca), WORD(0x2b19288e), WORD(0xf633e756),
+	WORD(0x5f2cc077), WORD(0x165c1fb3), WORD(0x42bb7f3f), WORD(0x3210d495),
+	WORD(0x046b234e), WORD(0x00871755), WORD(0x1c1b4fd7), WORD(0x5c904185),
+	WORD(0xc3424d48), WORD(0xc3260b46), WORD(0x6ce94e18), WORD(0x00c17e9c),
+	/* T[10] */
+	WORD(0x7bb1a339), WORD(0xc24ab25c), WORD(0x951ef251), WORD(0xbee4c8bb),
+	WORD(0xcb2d853d), WORD(0xbc0f1148), WORD(0x2664a8af), WORD(0x7bad24ac),
+	WORD(0x0826f195), WORD(0xa6e1835c), WORD(0x2d855dfe), WORD(0x502a92fc),
+	WORD(0xee0eaf36), WORD(0xf09fa080), WORD(0x4b1a4f89), WORD(0x0291d892),
+	WORD(0xfef3d4e0), WORD(0x4f3489ce), WORD(0x5ee462b3), WORD(0xaa3788ee),
+	WORD(0x832fbaa4), WORD(0x4731b8fe), WORD(0xad00f2b6), WORD(0x4ff79e12),
+	WORD(0x6eb8277a), WORD(0xb9c9cdaf), WORD(0x720156d1), WORD(0x6ca45299),
+	WORD(0x84f2bf3f), WORD(0x1fe3ff0e), WORD(0x77fde032), WORD(0x1079643b),
+	/* T[11] */
+	WORD(0x07d3ca78), WORD(0x964ef499), WORD(0xc1042564), WORD(0xcb2d998b),
+	WORD(0x1566053f), WORD(0x8eb0ada4), WORD(0x4233d93d), WORD(0xb4f98288),
+	WORD(0xa3afcc05), WORD(0x465e3c20), WORD(0x20f41ab9), WORD(0xd0f49613),
+	WORD(0x20ef00db), WORD(0x34a601d3), WORD(0x5431e7d6), WORD(0x0ebc8d86),
+	WORD(0x41c85076), WORD(0x3f27599b), WORD(0x1ea8d059), WORD(0xf1b2af90),
+	WORD(0xb065341d), WORD(0xdeb96835), WORD(0x1cfae46c), WORD(0x2827de60),
+	WORD(0xa7aa613b), WORD(0x740825bf), WORD(0x3e043afa), WORD(0x6c0db38a),
+	WORD(0x3076549c), WORD(0x6366ab75), WORD(0x99d1357c), WORD(0x13547650),
+	/* T[12] */
+	WORD(0xe0f75a0e), WORD(0x6ba1fb2b), WORD(0xdc10e1f7), WORD(0x7673c548),
+	WORD(0x2558a98b), WORD(0x4900fed4), WORD(0xfb748712), WORD(0x0005333f),
+	WORD(0xa30ab442), WORD(0xd28b7889), WORD(0xf72f84e2), WORD(0xaacaef24),
+	WORD(0x87ab905e), WORD(0xbf6c7338), WORD(0x639ea3b6), WORD(0x369a9e29),
+	WORD(0xd075de13), WORD(0x6201ff93), WORD(0x1ab8c20e), WORD(0x8750b264),
+	WORD(0x3712d360), WORD(0x5387c80f), WORD(0xc52187e6), WORD(0x2f453971),
+	WORD(0x9feaa815), WORD(0xc29279e1), WORD(0x01b4d88f), WORD(0x58404313),
+	WORD(0xfd56ebb1), WORD(0x6cb31353), WORD(0x065ab048), WORD(0x275674ae),
+	/* T[13] */
+	WORD(0xbf65087c), WORD(0x38ec30ec), WORD(0x9917afd3), WORD(0x35ab5a82),
+	WORD(0x36fa31bc), WORD(0x885d096f), WORD(0xfa242da9), WORD(0x7390065c),
+	WORD(0xa243e2b0), WORD(0x9a6db8d0), WORD(0xc520f02e), WORD(0x00c0f635),
+	WORD(0x06a0395d), WORD(0x747f9e13), WORD(0xb22148e9), WORD(0x365abe30),
+	WORD(0x8ed5880b), WORD(0x8093bb24), WORD(0x21b28f0f), WORD(0x4320fe77),
+	WORD(0x5bc77c6d), WORD(0x4a06ee1e), WORD(0x90f5cf43), WORD(0x92de9679),
+	WORD(0x8793f9c9), WORD(0x5ca99b6f), WORD(0x15549ab3), WORD(0x45dbe322),
+	WORD(0x76e7e6ec), WORD(0x07ce9616), WORD(0x25c45868), WORD(0x349efbd9),
+	/* T[14] */
+	WORD(0x3ce6d3bb), WORD(0x6271df9f), WORD(0xba0959a8), WORD(0x8306870a),
+	WORD(0x7e51ebf0), WORD(0x5c97fd6e), WORD(0xf24fbcfa), WORD(0x47f25abf),
+	WORD(0xdbdcea81), WORD(0x6a688ea0), WORD(0x9594d67d), WORD(0x34ac1a99),
+	WORD(0x3703e6a3), WORD(0x12134799), WORD(0xa204cc5d), WORD(0x01670491),
+	WORD(0xd1ad62ae), WORD(0x084a9906), WORD(0xb9c05738), WORD(0xa2b2e726),
+	WORD(0xc0de976a), WORD(0xeb43d994), WORD(0xaaf3c522), WORD(0xb54c221b),
+	WORD(0xfcadbc82), WORD(0xfe06ee07), WORD(0xba91df1e), WORD(0x3ef98dec),
+	WORD(0xb9ac6207), WORD(0xb3adee85), WORD(0x943432e7), WORD(0x432d5f1e),
+	/* T[15] */
+	WORD(0xde763848), WORD(0xb36fc272), WORD(0xce3d7e43), WORD(0x22d9daca),
+	WORD(0x4695814d), WORD(0x05324163), WORD(0x66231d44), WORD(0x9a9e6530),
+	WORD(0x8abcbeb1), WORD(0x85070e18), WORD(0x8b334032), WORD(0xa38c0230),
+	WORD(0xe142eae6), WORD(0x16d5a529), WORD(0x05e32ff7), WORD(0x39b8b212),
+	WORD(0x639fca01), WORD(0x3bf6eaa9), WORD(0x6d0d4203), WORD(0xa2c40325),
+	WORD(0xd8853860), WORD(0x44d75b1c), WORD(0xf3be659e), WORD(0xce2ebbe6),
+	WORD(0x2624ea1a), WORD(0x04930484), WORD(0xba13b4f1), WORD(0x19b25558),
+	WORD(0x01547a4b), WORD(0x342ec49d), WORD(0x20e96639), WORD(0x1e8c0fbe),
+	/* T[16] */
+	WORD(0xb2bce0e9), WORD(0x23b2a994), WORD(0xa4d3e03b), WORD(0x0c9011cb),
+	WORD(0x355d7342), WORD(0x0279791b), WORD(0x0eb27f7b), WORD(0x0e3183b2),
+	WORD(0x95014c65), WORD(0x0ff34179), WORD(0xbea024af), WORD(0x0dede13b),
+	WORD(0x0763484c), WORD(0x78667d97), WORD(0x4ec9028b), WORD(0x408a2c71),
+	WORD(0x497ea777), WORD(0xa18ce215), WORD(0xdd7a6f9e), WORD(0x3246cd18),
+	WORD(0x84a65bff), WORD(0xd01373fc), WORD(0xab09ae05), WORD(0x2b13ff64),
+	WORD(0x300e16b1), WORD(0x5046ef0a), WORD(0x86b1902f), WORD(0x780c8e05),
+	WORD(0xbb74537d), WORD(0x42d6a641), WORD(0x0ceca9af), WORD(0x3555d476),
+	/* T[17] */
+	WORD(0x17da6499), WORD(0x9f3025cc), WORD(0x40193d7a), WORD(0xff5ea9e2),
+	WORD(0x65a87a27), WORD(0xec2c6459), WORD(0x5b6d2f42), WORD(0x1d34ec3e),
+	WORD(0xb025ee4d), WORD(0x225330e2), WORD(0x57d8a51b), WORD(0x88fbf341),
+	WORD(0xec2ebbd0), WORD(0xb3b6918c), WORD(0x13234975), WORD(0x20a88dca),
+	WORD(0x4b7f7566), WORD(0xed9c691a), WORD(0x9e83908e), WORD(0x219897d1),
+	WORD(0x9fb50ced), WORD(0xdab9be5c), WORD(0x67ac5188), WORD(0x92ba05d4),
+	WORD(0xd863c831), WORD(0x8e44a0a2), WORD(0x89c785d0), WORD(0x301495e5),
+	WORD(0x7e67821a), WORD(0x8c8335bd), WORD(0x68d7ad40), WORD(0x3e9d7050),
+	/* T[18] */
+	WORD(0xb48e7978), WORD(0x40dc64d1), WORD(0x723af26b), WORD(0x227c1f78),
+	WORD(0xc92eb910), WORD(0x01b57cac), WORD(0xc94cc8eb), WORD(0xb475b464),
+	WORD(0xea2868be), WORD(0x68692ea7), WORD(0x4f6922ad), WORD(0x32a62f41),
+	WORD(0x77f58fb0), WORD(0x5a5fc3dc), WORD(0xaac8c970), WORD(0x1e4e1abe),
+	WORD(0x8ae0e71b), WORD(0x719f7d19), WORD(0xd6bdd3c6), WORD(0x8d85f474),
+	WORD(0x95e80b68), WORD(0xba7bb9be), WORD(0xe2672494), WORD(0x9546fb6f),
+	WORD(0x9c60b460), WORD(0x8c9b5fc9), WORD(0x9a3faa08), WORD(0xf6997640),
+	WORD(0x56aa3c05), WORD(0x82a6ad72), WORD(0x3bc47d7b), WORD(0x0a35df85),
+	/* T[19] */
+	WORD(0xd5a392b6), WORD(0xbe1ac649), WORD(0x9d6db368), WORD(0x387d8e97),
+	WORD(0x95515dd7), WORD(0x5117cd2b), WORD(0xa6239df4), WORD(0x4cca684d),
+	WORD(0x1fa42985), WORD(0x263aca45), WORD(0x86c9ac12), WORD(0x187be738),
+	WORD(0xbabdf39b), WORD(0x1eb1eb00), WORD(0xbc5a5edb), WORD(0x2f065afe),
+	WORD(0x6798c80e), WORD(0xc84496d6), WORD(0x95c4f8f5), WORD(0xcc077d4c),
+	WORD(0x667e9eed), WORD(0x546cc17b), WORD(0xfa65e77a), WORD(0xae8e6833),
+	WORD(0xe9de8417), WORD(0x8f8a25a0), WORD(0x007a38eb), WORD(0x412d52b0),
+	WORD(0x1c5b56a6), WORD(0x9d8ffde7), WORD(0x9921d8a3), WORD(0x357ca147),
+	/* T[20] */
+	WORD(0xe31e9c4d), WORD(0x87f129dd), WORD(0x968ec08b), WORD(0xa1a015f0),
+	WORD(0x00ccb55e), WORD(0x48b3aaa9), WORD(0xd3fd2d29), WORD(0x98871989),
+	WORD(0xe22b46f5), WORD(0xef5f473f), WORD(0x1bb5a9c2), WORD(0x4fadf67b),
+	WORD(0x0a6f3d31), WORD(0xbb3b5a6f), WORD(0x8891f99e), WORD(0x026233ca),
+	WORD(0x891b77c4), WORD(0x34b500a4), WORD(0xd68852de), WORD(0x700d46d0),
+	WORD(0xf3051479), WORD(0x6fc8a19f), WORD(0xefe76ad4), WORD(0x6bcd402a),
+	WORD(0x5f6beeb6), WORD(0xbda50173), WORD(0xada845bc), WORD(0x5d5e62fd),
+	WORD(0x730ffe07), WORD(0x69041100), WORD(0xc6b3fd28), WORD(0x27d48117),
+	/* T[21] */
+	WORD(0x508b5b66), WORD(0x39048534), WORD(0xd3d00052), WORD(0x2c136be5),
+	WORD(0x9e893bca), WORD(0x9bc2adeb), WORD(0xf44bcb63), WORD(0x5f450681),
+	WORD(0x5e1b7cf1), WORD(0x8a7ee4ae), WORD(0x7b04e023), WORD(0xc1f28bb7),
+	WORD(0x594537f8), WORD(0x52d36976), WORD(0xa8e7b8f5), WORD(0x38b434f4),
+	WORD(0x7a985419), WORD(0xddeb2316), WORD(0x19c1560d), WORD(0x1e3e14e8),
+	WORD(0xe96ebc8b), WORD(0xacbddd36), WORD(0xd0efb0eb), WORD(0x26d441ea),
+	WORD(0x0c58cb36), WORD(0x006bdd84), WORD(0xc9ac6721), WORD(0x20d75ec4),
+	WORD(0x42818292), WORD(0xd4cdecaa), WORD(0x6158f2fb), WORD(0x409277c9),
+	/* T[22] */
+	WORD(0xa49de9e5), WORD(0x28d24e4f), WORD(0xf74c41b4), WORD(0xa1dcd21b),
+	WORD(0xe238ea1e), WORD(0xd8cdc3b7), WORD(0x95f2cb08), WORD(0xac726515),
+	WORD(0x28e66bda), WORD(0x9972e7bf), WORD(0xcaeb985f), WORD(0x0f3e977e),
+	WORD(0x79268f38), WORD(0x6f99ac0a), WORD(0xe4cc8b78), WORD(0x379db323),
+	WORD(0xb21dd3dc), WORD(0xdcae57ce), WORD(0xce0c7906), WORD(0x088419dc),
+	WORD(0x79addbe6), WORD(0xe25ba46f), WORD(0x21412f9f), WORD(0xcbec5057),
+	WORD(0x4c95a1c3), WORD(0xa9cb5c57), WORD(0xa064c0a1), WORD(0x087910ac),
+	WORD(0x1d5f8aa2), WORD(0xe8c9b5d6), WORD(0x2bc131e2), WORD(0x2baf2b6f),
+	/* T[23] */
+	WORD(0x9b7d57f7), WORD(0xed20905c), WORD(0x544ffc43), WORD(0xbe3edd33),
+	WORD(0x93e0d7dd), WORD(0x0e77bb2b), WORD(0xf3c8e831), WORD(0x9517557f),
+	WORD(0x052913a9), WORD(0x306b7d40), WORD(0x0b9c7f4b), WORD(0x7055744f),
+	WORD(0x9a8484f2), WORD(0xf293c042), WORD(0xf74aea44), WORD(0x3f8435c7),
+	WORD(0xb91902f3), WORD(0x57b98fad), WORD(0x32abf7a3), WORD(0x51837c44),
+	WORD(0x145c009c), WORD(0x35b546dd), WORD(0xca497417), WORD(0xf4656571),
+	WORD(0xaad3468e), WORD(0xb4dea7ef), WORD(0xd547a073), WORD(0x72057992),
+	WORD(0x8dcb16d1), WORD(0xf8d69e58), WORD(0xdce68c87), WORD(0x0038fabe),
+	/* T[24] */
+	WORD(0x4a974738), WORD(0x64c980cb), WORD(0x12d787c2), WORD(0x0b2f2cb8),
+	WORD(0x2d50a8c8), WORD(0x7b13df7e), WORD(0xe94de604), WORD(0x9de2fa54),
+	WORD(0xc5ac4816), WORD(0x466669c3), WORD(0x1f04331f), WORD(0x68587967),
+	WORD(0x23dfd2fe), WORD(0x5662c02d), WORD(0xb7edfc3e), WORD(0x14c32965),
+	WORD(0x96206313), WORD(0xd385fa73), WORD(0xc71d2f95), WORD(0x52722759),
+	WORD(0x49646f49), WORD(0xbe2ca9ec), WORD(0x6edc220d), WORD(0xf2d12685),
+	WORD(0xca546339), WORD(0x77007dcf), WORD(0x1ae0b95c), WORD(0x9ba403ca),
+	WORD(0x0f591cd8), WORD(0x5b58e92b), WORD(0xca90f5e3), WORD(0x0c677c09),
+	/* T[25] */
+	WORD(0xb3795a74), WORD(0x5f4a01e6), WORD(0x0fc1623d), WORD(0x4e24ba93),
+	WORD(0x40c16885), WORD(0x65a9c598), WORD(0xf9ddabfa), WORD(0xba5b1e13),
+	WORD(0x1e40e79e), WORD(0xd31c51b1), WORD(0x482cb960), WORD(0xbd5bc732),
+	WORD(0x78c2e467), WORD(0xb795940f), WORD(0xc9fb3ed2), WORD(0x21ba8b1b),
+	WORD(0xaa455fe9), WORD(0x42a3eeab), WORD(0xcf394002), WORD(0x1b939b74),
+	WORD(0xc9577b70), WORD(0xd825acec), WORD(0x68b6583f), WORD(0x5b0c057d),
+	WORD(0x93125d5a), WORD(0x5994985d), WORD(0x4d069dce), WORD(0x32fb3025),
+	WORD(0x0d091df9), WORD(0x5bb374bb), WORD(0x96b51ba4), WORD(0x3b6b84ca),
+	/* T[26] */
+	WORD(0xdf0146a7), WORD(0x6385edf6), WORD(0x3bd795f9), WORD(0x5d6db2cc),
+	WORD(0xda4b5bdc), WORD(0xa5941aeb), WORD(0x6dec2a38), WORD(0xfebf1696),
+	WORD(0xe1eacb86), WORD(0xfd14916b), WORD(0xc054e5bd), WORD(0x74a48c01),
+	WORD(0xb0963fd3), WORD(0x89b4431a), WORD(0x4f6fdcc0), WORD(0x1179653e),
+	WORD(0x3cbcd0c9), WORD(0x6bc59fa6), WORD(0xfc5a0093), WORD(0x6384ed43),
+	WORD(0xf6eb80e5), WORD(0xca90ddf4), WORD(0xdcfd836c), WORD(0x0a239dd1),
+	WORD(0x14ff3132), WORD(0x6d36ac59), WORD(0xab38ad9e), WORD(0x7a93dbca),
+	WORD(0xb184fb85), WORD(0x71736f2d), WORD(0xeecf885b), WORD(0x149f2ee0),
+	/* T[27] */
+	WORD(0x314e6880), WORD(0x7d9e4ea9), WORD(0x428aede2), WORD(0xc2fec840),
+	WORD(0xf975680f), WORD(0x04605937), WORD(0x450fa5d9), WORD(0x7acee0ae),
+	WORD(0x5f4eceb7), WORD(0xf2550507), WORD(0xf346dc0b), WORD(0x21e7aaf7),
+	WORD(0x3b4df5bb), WORD(0x9b47ada7), WORD(0x5b8b7913), WORD(0x213bb23f),
+	WORD(0x85d43060), WORD(0xc536e097), WORD(0x4c083cb2), WORD(0xd975a6b5),
+	WORD(0x79432838), WORD(0xd1e7aebf), WORD(0x8cdcb257), WORD(0xd44013d7),
+	WORD(0x27dc037a), WORD(0x5e82946f), WORD(0x546bb6ab), WORD(0xd6f1f5d9),
+	WORD(0x4bd45c63), WORD(0xaa8b9649), WORD(0xb27424b2), WORD(0x1310e68d),
+	/* T[28] */
+	WORD(0x5fdbf6a7), WORD(0x4e27f3f6), WORD(0x0f376b32), WORD(0x666a154d),
+	WORD(0xf331c680), WORD(0x130804c6), WORD(0xa04cf99d), WORD(0x3dbcb1c1),
+	WORD(0x516a8191), WORD(0x372dbb9c), WORD(0x3ca0c65f), WORD(0x7498e8b7),
+	WORD(0x62389dd3), WORD(0x061ab95b), WORD(0xece99327), WORD(0x0cacb399),
+	WORD(0xe2a8c10d), WORD(0x4e73a6e2), WORD(0x59841bb6), WORD(0xbb30815e),
+	WORD(0x57303c42), WORD(0x4021e64f), WORD(0x7e15dcd3), WORD(0x475caa01),
+	WORD(0x509e5319), WORD(0x31644416), WORD(0xea807b44), WORD(0x155f6f92),
+	WORD(0xd2e7b382), WORD(0x2aafecb4), WORD(0x98ab305e), WORD(0x42d5d9a5),
+	/* T[29] */
+	WORD(0x5015b494), WORD(0xa55403a3), WORD(0x127deb3c), WORD(0xac286bde),
+	WORD(0x53ad9458), WORD(0xbb0c9a38), WORD(0xb0b8159e), WORD(0x1add8c81),
+	WORD(0x98ea9d09), WORD(0x629131dc), WORD(0x76327682), WORD(0xbdfb449b),
+	WORD(0xf4c901b7), WORD(0x15043190), WORD(0x2b08fe11), WORD(0x0f472964),
+	WORD(0xa95d3079), WORD(0x6d958600), WORD(0x5367557e), WORD(0x801030b4),
+	WORD(0x4e67d14d), WORD(0xb6a0e519), WORD(0x831adf07), WORD(0xfa9dde54),
+	WORD(0x645d9787), WORD(0x886aff0a), WORD(0x2e04cd6d), WORD(0xdd59b5ec),
+	WORD(0xf1ba04e7), WORD(0x92b5d235), WORD(0x4560da70), WORD(0x2c7c61e0),
+	/* T[30] */
+	WORD(0x764b544f), WORD(0x169a7b3a), WORD(0x287072a7), WORD(0x44510222),
+	WORD(0xa4bb13a5), WORD(0x873f92ad), WORD(0x8c5c06ca), WORD(0x89f64bb5),
+	WORD(0x93862a2b), WORD(0x5eab29c0), WORD(0x666acf40), WORD(0x2c44f98c),
+	WORD(0x76b22ae2), WORD(0x376e8753), WORD(0x5e8ec304), WORD(0x0a078ebf),
+	WORD(0x3095282e), WORD(0xf965e525), WORD(0xc5266e61), WORD(0xc873a98b),
+	WORD(0x5f77babb), WORD(0xa6fac251), WORD(0x63380127), WORD(0x607d8275),
+	WORD(0xc0e63d7a), WORD(0x70186c55), WORD(0xa49a0053), WORD(0x646d0b17),
+	WORD(0x9332585a), WORD(0x2149ed11), WORD(0x0ea2dca0), WORD(0x0212646d),
+	/* T[31] */
+	WORD(0xc559f374), WORD(0xce2c852d), WORD(0x20c57399), WORD(0xb534c4d0),
+	WORD(0x9a1c37f4), WORD(0xb01f8056), WORD(0x54f4ad76), WORD(0x8c22fe76),
+	WORD(0x7571318a), WORD(0x77eb03e5), WORD(0x1ae72d09), WORD(0x9b46e870),
+	WORD(0x04c34157), WORD(0xdf6a8f93), WORD(0xd48eed15), WORD(0x3b4c736f),
+	WORD(0x82fdf929), WORD(0x93e84127), WORD(0x8ed4abf4), WORD(0x4add1367),
+	WORD(0x5effd9a6), WORD(0x7b79cda0), WORD(0x498e42bd), WORD(0xe344add8),
+	WORD(0x8bf0c7de), WORD(0x774a4ba4), WORD(0x8abf4c11), WORD(0x38f3dd89),
+	WORD(0x6c1fed88), WORD(0xcbed81d9), WORD(0x85fa560c), WORD(0x0dffca8e),
+};
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+static const word_t GOST_512bits_curve_gen_comb[] = {
+	/* T[0] */
+	WORD(0x50ae), WORD(0xc196), WORD(0x19ca), WORD(0x11db), WORD(0x3ee0), WORD(0xf62f),
+	WORD(0x9b52), WORD(0xe9de), WORD(0x4410), WORD(0x269c), WORD(0x50dc), WORD(0x8e98),
+	WORD(0x43d3), WORD(0x5f70), WORD(0xfa9f), WORD(0xb5e0), WORD(0x6a8f), WORD(0x896e),
+	WORD(0x0c89), WORD(0x3cca), WORD(0xaaf2), WORD(0x7569), WORD(0x1283), WORD(0x7f89),
+	WORD(0x9699), WORD(0x2366), WORD(0x4029), WORD(0x56b0), WORD(0xaa15), WORD(0x0479),
+	WORD(0xf2dc), WORD(0x0cd0), WORD(0x333a), WORD(0x895a), WORD(0x148c), WORD(0xc3bb),
+	WORD(0x2089), WORD(0x40bd), WORD(0xef9f), WORD(0xcabb), WORD(0x209c), WORD(0xf358),
+	WORD(0xd585), WORD(0xff18), WORD(0xe2f0), WORD(0x8dea), WORD(0x91c7), WORD(0xbe84),
+	WORD(0x7048), WORD(0xf297), WORD(0x7f21), WORD(0xa4e7), WORD(0x9114), WORD(0xace1),
+	WORD(0xadf2), WORD(0x6634), WORD(0x2104), WORD(0xe54d), WORD(0x76cb), WORD(0x741a),
+	WORD(0x95fd), WORD(0x357c), WORD(0x0ebd), WORD(0x1a3a),
+	/* T[1] */
+	WORD(0x2072), WORD(0x727a), WORD(0x7619), WORD(0xd6c1), WORD(0x272c), WORD(0xc9c2),
+	WORD(0x1b9f), WORD(0x8e53), WORD(0xe45e), WORD(0x0f47), WORD(0x0195), WORD(0xd0cb),
+	WORD(0x8e67), WORD(0xa794), WORD(0x32e7), WORD(0xea66), WORD(0xf42f), WORD(0x9712),
+	WORD(0xc73a), WORD(0xaced), WORD(0x4ee4), WORD(0xe296), WORD(0x58d3), WORD(0xa170),
+	WORD(0xabcf), WORD(0xd40a), WORD(0x5063), WORD(0xb9dd), WORD(0x7d33), WORD(0x69dd),
+	WORD(0x2484), WORD(0x12fc), WORD(0xcb41), WORD(0x9641), WORD(0x5445), WORD(0x07d1),
+	WORD(0x7e3d), WORD(0xa118), WORD(0x5bf8), WORD(0x9d2a), WORD(0x2cc0), WORD(0xa512),
+	WORD(0x2bcb), WORD(0xa500), WORD(0xcfd5), WORD(0x1069), WORD(0xc36a), WORD(0x5ae6),
+	WORD(0xaf9a), WORD(0xb4c9), WORD(0x09c0), WORD(0x6aa8), WORD(0x5701), WORD(0xdf9f),
+	WORD(0x276e), WORD(0x2ff1), WORD(0xe215), WORD(0x7701), WORD(0xfaa1), WORD(0x5c17),
+	WORD(0x5b7c), WORD(0x097a), WORD(0xa223), WORD(0x106d),
+	/* T[2] */
+	WORD(0xf084), WORD(0x426b), WORD(0x0033), WORD(0xaef0), WORD(0x6b9f), WORD(0xeee7),
+	WORD(0x322e), WORD(0xd702), WORD(0x45eb), WORD(0x85f1), WORD(0xceff), WORD(0x35ce),
+	WORD(0x5dd8), WORD(0x1e8c), WORD(0x314e), WORD(0xd6e8), WORD(0x24ec), WORD(0x5fdb),
+	WORD(0xdae5), WORD(0xb8f4), WORD(0x6f66), WORD(0xef0e), WORD(0xae95), WORD(0xa691),
+	WORD(0x3f7e), WORD(0x2258), WORD(0x51db), WORD(0x477a), WORD(0x5090), WORD(0x13af),
+	WORD(0x7acf), WORD(0x149d), WORD(0x51fe), WORD(0xab18), WORD(0x86b4), WORD(0x73a9),
+	WORD(0x83bd), WORD(0x310d), WORD(0x1b1a), WORD(0xaa7b), WORD(0xd0cf), WORD(0x8ec0),
+	WORD(0x4b68), WORD(0x9f6f), WORD(0xf18c), WORD(0xbcaf), WORD(0xf7c6), WORD(0x5ced),
+	WORD(0x7e93), WORD(0x06a4), WORD(0xad5d), WORD(0xc7c9), WORD(0x5842), WORD(0xdc1b),
+	WORD(0x2b3b), WORD(0xa7cf), WORD(0x8083), WORD(0xc1a6), WORD(0x0b18), WORD(0xbad6),
+	WORD(0x1d93), WORD(0xc3c6), WORD(0xcdc1), WORD(0x2754),
+	/* T[3] */
+	WORD(0x6c48), WORD(0xdb22), WORD(0xef62), WORD(0xe14e), WORD(0x0f5b), WORD(0xd799),
+	WORD(0xac59), WORD(0x86a8), WORD(0xe7d9), WORD(0x7392), WORD(0x03ac), WORD(0x005f),
+	WORD(0x3c33), WORD(0x0000), WORD(0x400e), WORD(0x260d), WORD(0x2e12), WORD(0xe585),
+	WORD(0x4c03), WORD(0x1d1a), WORD(0x40ee), WORD(0x88ee), WORD(0xb0cd), WORD(0x6396),
+	WORD(0x2a49), WORD(0x5418), WORD(0x671a), WORD(0x66cd), WORD(0x4132), WORD(0xf7d4),
+	WORD(0x4a9f), WORD(0x39a6), WORD(0xd124), WORD(0xc56e), WORD(0x383e), WORD(0x0d3a),
+	WORD(0x5cba), WORD(0x85cf), WORD(0xb7f7), WORD(0x4a38), WORD(0xb191), WORD(0x7c4e),
+	WORD(0xace5), WORD(0x6ef8), WORD(0x6676), WORD(0x3629), WORD(0x9198), WORD(0x5dcf),
+	WORD(0x9dcd), WORD(0x59e4), WORD(0x0292), WORD(0xddd7), WORD(0x6de9), WORD(0xbc63),
+	WORD(0x2103), WORD(0x36e7), WORD(0xcff3), WORD(0x9126), WORD(0x2b62), WORD(0x4669),
+	WORD(0xb2de), WORD(0xc2e3), WORD(0x2850), WORD(0x17f8),
+	/* T[4] */
+	WORD(0x8994), WORD(0xd327), WORD(0x4c5f), WORD(0x2a88), WORD(0xdb01), WORD(0x9df5),
+	WORD(0x5f0f), WORD(0x2f36), WORD(0x4677), WORD(0x9cb7), WORD(0x412b), WORD(0xd64e),
+	WORD(0x8745), WORD(0x5a71), WORD(0xff9a), WORD(0x76e7), WORD(0x4383), WORD(0xd559),
+	WORD(0x08f1), WORD(0xb8f1), WORD(0x711f), WORD(0xabe0), WORD(0x4c91), WORD(0xb7c5),
+	WORD(0x13df), WORD(0xacba), WORD(0xb771), WORD(0x3f5d), WORD(0x4d2a), WORD(0xff3d),
+	WORD(0x4959), WORD(0x0d4f), WORD(0x2402), WORD(0x1b20), WORD(0x624d), WORD(0xa562),
+	WORD(0xc671), WORD(0x70e5), WORD(0x29c3), WORD(0x2ef3), WORD(0x5919), WORD(0x8728),
+	WORD(0xe475), WORD(0x8865), WORD(0xc7ed), WORD(0xd3ed), WORD(0x0626), WORD(0x7265),
+	WORD(0xfab3), WORD(0x2ea2), WORD(0x44c9), WORD(0x9ebf), WORD(0xda8a), WORD(0x9e4d),
+	WORD(0xa737), WORD(0x4791), WORD(0x99dd), WORD(0xdb63), WORD(0xb393), WORD(0xce9f),
+	WORD(0x27f9), WORD(0x52ac), WORD(0x4282), WORD(0x13b2),
+	/* T[5] */
+	WORD(0x0c0f), WORD(0x4804), WORD(0x7195), WORD(0x6fbf), WORD(0xba9b), WORD(0xeb25),
+	WORD(0xd604), WORD(0x3e91), WORD(0xe247), WORD(0x1dd7), WORD(0x56a0), WORD(0x7c77),
+	WORD(0x4f1d), WORD(0x99ca), WORD(0xb9a3), WORD(0x1d12), WORD(0x625b), WORD(0xa73a),
+	WORD(0xd37d), WORD(0xd22a), WORD(0xe7e8), WORD(0x0a80), WORD(0xaec6), WORD(0xcbf5),
+	WORD(0xead0), WORD(0x23bb), WORD(0x567a), WORD(0xa48e), WORD(0x37bf), WORD(0xf3a9),
+	WORD(0x5eaa), WORD(0x3382), WORD(0x0f8a), WORD(0x624a), WORD(0xb2eb), WORD(0xa608),
+	WORD(0xfb3e), WORD(0x3bc8), WORD(0xa98a), WORD(0xad56), WORD(0x1b4f), WORD(0x9d9c),
+	WORD(0xe884), WORD(0xfaa3), WORD(0x9339), WORD(0xa6f6), WORD(0xf822), WORD(0x2e6d),
+	WORD(0x5bed), WORD(0x4815), WORD(0xc721), WORD(0x2288), WORD(0xd309), WORD(0x9c57),
+	WORD(0x5892), WORD(0x07ad), WORD(0x375e), WORD(0xca03), WORD(0xbcbf), WORD(0x742a),
+	WORD(0x2e7e), WORD(0x77a6), WORD(0xd27e), WORD(0x2d3f),
+	/* T[6] */
+	WORD(0x6d82), WORD(0xdfe8), WORD(0xfe28), WORD(0xafd6), WORD(0x4da0), WORD(0x299e),
+	WORD(0x4ba2), WORD(0xeb70), WORD(0x093c), WORD(0xbe48), WORD(0xdc67), WORD(0x3631),
+	WORD(0x610b), WORD(0xb4fc), WORD(0xd39c), WORD(0x65e5), WORD(0x9c0e), WORD(0xff5c),
+	WORD(0x5644), WORD(0x0944), WORD(0xa7a0), WORD(0x45c1), WORD(0x0681), WORD(0x7e92),
+	WORD(0xb591), WORD(0x3657), WORD(0x206b), WORD(0x14e2), WORD(0xc6d4), WORD(0x2bd0),
+	WORD(0x9aa3), WORD(0x4159), WORD(0x7314), WORD(0x0cc0), WORD(0x2710), WORD(0x495f),
+	WORD(0x44ae), WORD(0x8706), WORD(0x3056), WORD(0xbf65), WORD(0xe10f), WORD(0x4ca2),
+	WORD(0x4516), WORD(0xdbe6), WORD(0xa33d), WORD(0xb55f), WORD(0x45b8), WORD(0x7794),
+	WORD(0x87b7), WORD(0x1039), WORD(0xc2af), WORD(0x3c0c), WORD(0x4e5f), WORD(0x3289),
+	WORD(0x55e3), WORD(0xb197), WORD(0xd919), WORD(0x80c0), WORD(0x25eb), WORD(0xdea2),
+	WORD(0x2ec6), WORD(0x96ff), WORD(0x1204), WORD(0x11d9),
+	/* T[7] */
+	WORD(0x0780), WORD(0x917c), WORD(0x1854), WORD(0x0d09), WORD(0xbcb5), WORD(0x92c3),
+	WORD(0x6fa4), WORD(0xa49c), WORD(0x046f), WORD(0xf489), WORD(0x30d2), WORD(0xdfda),
+	WORD(0x3f65), WORD(0xf5a3), WORD(0xfd54), WORD(0x82ba), WORD(0xf549), WORD(0x7d2c),
+	WORD(0xe74a), WORD(0xc53f), WORD(0x7f04), WORD(0x6d8c), WORD(0x29f7), WORD(0xddc9),
+	WORD(0xaa42), WORD(0x2ea6), WORD(0xf758), WORD(0xeae0), WORD(0xf458), WORD(0x8b3c),
+	WORD(0xb32f), WORD(0x0f66), WORD(0xf1d6), WORD(0xec95), WORD(0xb9d6), WORD(0xf689),
+	WORD(0x3ec9), WORD(0x9b04), WORD(0xe4d8), WORD(0xc5fd), WORD(0xe693), WORD(0xf53b),
+	WORD(0xc5d0), WORD(0x48fe), WORD(0x17cd), WORD(0xae27), WORD(0x706a), WORD(0xc108),
+	WORD(0xd6f7), WORD(0xaab1), WORD(0x52d9), WORD(0x7e0a), WORD(0xfb88), WORD(0xeefe),
+	WORD(0x0566), WORD(0xf2be), WORD(0x3f23), WORD(0xad20), WORD(0x1e3a), WORD(0xe98c),
+	WORD(0x1666), WORD(0x00cf), WORD(0xe5a4), WORD(0x059e),
+	/* T[8] */
+	WORD(0x5005), WORD(0xbc4c), WORD(0x2d43), WORD(0xf899), WORD(0xca9d), WORD(0xfe08),
+	WORD(0x735f), WORD(0xfe5f), WORD(0xebd1), WORD(0xb519), WORD(0xd748), WORD(0x2edf),
+	WORD(0x3c81), WORD(0x9b74), WORD(0x0bf5), WORD(0x56f2), WORD(0xd7cc), WORD(0x2250),
+	WORD(0x9cc5), WORD(0xf9c1), WORD(0x1ca9), WORD(0xd202), WORD(0xa518), WORD(0xa903),
+	WORD(0xb7be), WORD(0xc0fa), WORD(0x6c67), WORD(0xf94e), WORD(0x1449), WORD(0x6ce6),
+	WORD(0xeaf2), WORD(0x0ff3), WORD(0xbbff), WORD(0x1aa8), WORD(0x6df8), WORD(0x943c),
+	WORD(0xd00b), WORD(0xffff), WORD(0x60a7), WORD(0xfde3), WORD(0x8654), WORD(0xad37),
+	WORD(0xd2e4), WORD(0x7b3f), WORD(0x983f), WORD(0xbb57), WORD(0x778d), WORD(0x5a88),
+	WORD(0x73c8), WORD(0x6604), WORD(0x6a6a), WORD(0x0625), WORD(0x09dd), WORD(0x3821),
+	WORD(0x2248), WORD(0x218a), WORD(0x9996), WORD(0x958d), WORD(0x8021), WORD(0x22bf),
+	WORD(0x3b49), WORD(0x28b4), WORD(0xc17f), WORD(0x1c0f),
+	/* T[9] */
+	WORD(0xc263), WORD(0x3260), WORD(0x54bb), WORD(0x3fe2), WORD(0x9089), WORD(0xad2c),
+	WORD(0x4f1f), WORD(0x3241), WORD(0x5132), WORD(0x22d8), WORD(0x6ab9), WORD(0x766b),
+	WORD(0x3d30), WORD(0xe7a2), WORD(0x3433), WORD(0x90e4), WORD(0x3ba0), WORD(0xe6a0),
+	WORD(0xe886), WORD(0xd8db), WORD(0x06cd), WORD(0x7e66), WORD(0x8fbd), WORD(0x139d),
+	WORD(0x60dc), WORD(0x7549), WORD(0x14f8), WORD(0x358d), WORD(0x4ed9), WORD(0xa45c),
+	WORD(0x6937), WORD(0x1a23), WORD(0x97c3), WORD(0x0d5d), WORD(0x48ca), WORD(0xa046),
+	WORD(0x288e), WORD(0x2b19), WORD(0xe756), WORD(0xf633), WORD(0xc077), WORD(0x5f2c),
+	WORD(0x1fb3), WORD(0x165c), WORD(0x7f3f), WORD(0x42bb), WORD(0xd495), WORD(0x3210),
+	WORD(0x234e), WORD(0x046b), WORD(0x1755), WORD(0x0087), WORD(0x4fd7), WORD(0x1c1b),
+	WORD(0x4185), WORD(0x5c90), WORD(0x4d48), WORD(0xc342), WORD(0x0b46), WORD(0xc326),
+	WORD(0x4e18), WORD(0x6ce9), WORD(0x7e9c), WORD(0x00c1),
+	/* T[10] */
+	WORD(0xa339), WORD(0x7bb1), WORD(0xb25c), WORD(0xc24a), WORD(0xf251), WORD(0x951e),
+	WORD(0xc8bb), WORD(0xbee4), WORD(0x853d), WORD(0xcb2d), WORD(0x1148), WORD(0xbc0f),
+	WORD(0xa8af), WORD(0x2664), WORD(0x24ac), WORD(0x7bad), WORD(0xf195), WORD(0x0826),
+	WORD(0x835c), WORD(0xa6e1), WORD(0x5dfe), WORD(0x2d85), WORD(0x92fc), WORD(0x502a),
+	WORD(0xaf36), WORD(0xee0e), WORD(0xa080), WORD(0xf09f), WORD(0x4f89), WORD(0x4b1a),
+	WORD(0xd892), WORD(0x0291), WORD(0xd4e0), WORD(0xfef3), WORD(0x89ce), WORD(0x4f34),
+	WORD(0x62b3), WORD(0x5ee4), WORD(0x88ee), WORD(0xaa37), WORD(0xbaa4), WORD(0x832f),
+	WORD(0xb8fe), WORD(0x4731), WORD(0xf2b6), WORD(0xad00), WORD(0x9e12), WORD(0x4ff7),
+	WORD(0x277a), WORD(0x6eb8), WORD(0xcdaf), WORD(0xb9c9), WORD(0x56d1), WORD(0x7201),
+	WORD(0x5299), WORD(0x6ca4), WORD(0xbf3f), WORD(0x84f2), WORD(0xff0e), WORD(0x1fe3),
+	WORD(0xe032), WORD(0x77fd), WORD(0x643b), WORD(0x1079),
+	/* T[11] */
+	WORD(0xca78), WORD(0x07d3), WORD(0xf499), WORD(0x964e), WORD(0x2564), WORD(0xc104),
+	WORD(0x998b), WORD(0xcb2d), WORD(0x053f), WORD(0x1566), WORD(0xada4), WORD(0x8eb0),
+	WORD(0xd93d), WORD(0x4233), WORD(0x8288), WORD(0xb4f9), WORD(0xcc05), WORD(0xa3af),
+	WORD(0x3c20), WORD(0x465e), WORD(0x1ab9), WORD(0x20f4), WORD(0x9613), WORD(0xd0f4),
+	WORD(0x00db), WORD(0x20ef), WORD(0x01d3), WORD(0x34a6), WORD(0xe7d6), WORD(0x5431),
+	WORD(0x8d86), WORD(0x0ebc), WORD(0x5076), WORD(0x41c8), WORD(0x599b), WORD(0x3f27),
+	WORD(0xd059), WORD(0x1ea8), WORD(0xaf90), WORD(0xf1b2), WORD(0x341d), WORD(0xb065),
+	WORD(0x6835), WORD(0xdeb9), WORD(0xe46c), WORD(0x1cfa), WORD(0xde60), WORD(0x2827),
+	WORD(0x613b), WORD(0xa7aa), WORD(0x25bf), WORD(0x7408), WORD(0x3afa), WORD(0x3e04),
+	WORD(0xb38a), WORD(0x6c0d), WORD(0x549c), WORD(0x3076), WORD(0xab75), WORD(0x6366),
+	WORD(0x357c), WORD(0x99d1), WORD(0x7650), WORD(0x1354),
+	/* T[12] */
+	WORD(0x5a0e), WORD(0xe0f7), WORD(0xfb2b), WORD(0x6ba1), WORD(0xe1f7), WORD(0xdc10),
+	WORD(0xc548), WORD(0x7673), WORD(0xa98b), WORD(0x2558), WORD(0xfed4), WORD(0x4900),
+	WORD(0x8712), WORD(0xfb74), WORD(0x333f), WORD(0x0005), WORD(0xb442), WORD(0xa30a),
+	WORD(0x7889), WORD(0xd28b), WORD(0x84e2), WORD(0xf72f), WORD(0xef24), WORD(0xaaca),
+	WORD(0x905e), WORD(0x87ab), WORD(0x7338), WORD(0xbf6c), WORD(0xa3b6), WORD(0x639e),
+	WORD(0x9e29), WORD(0x369a), WORD(0xde13), WORD(0xd075), WORD(0xff93), WORD(0x6201),
+	WORD(0xc20e), WORD(0x1ab8), WORD(0xb264), WORD(0x8750), WORD(0xd360), WORD(0x3712),
+	WORD(0xc80f), WORD(0x5387), WORD(0x87e6), WORD(0xc521), WORD(0x3971), WORD(0x2f45),
+	WORD(0xa815), WORD(0x9fea), WORD(0x79e1), WORD(0xc292), WORD(0xd88f), WORD(0x01b4),
+	WORD(0x4313), WORD(0x5840), WORD(0xebb1), WORD(0xfd56), WORD(0x1353), WORD(0x6cb3),
+	WORD(0xb048), WORD(0x065a), WORD(0x74ae), WORD(0x2756),
+	/* T[13] */
+	WORD(0x087c), WORD(0xbf65), WORD(0x30ec), WORD(0x38ec), WORD(0xafd3), WORD(0x9917),
+	WORD(0x5a82), WORD(0x35ab), WORD(0x31bc), WORD(0x36fa), WORD(0x096f), WORD(0x885d),
+	WORD(0x2da9), WORD(0xfa24), WORD(0x065c), WORD(0x7390), WORD(0xe2b0), WORD(0xa243),
+	WORD(0xb8d0), WORD(0x9a6d), WORD(0xf02e), WORD(0xc520), WORD(0xf635), WORD(0x00c0),
+	WORD(0x395d), WORD(0x06a0), WORD(0x9e13), WORD(0x747f), WORD(0x48e9), WORD(0xb221),
+	WORD(0xbe30), WORD(0x365a), WORD(0x880b), WORD(0x8ed5), WORD(0xbb24), WORD(0x8093),
+	WORD(0x8f0f), WORD(0x21b2), WORD(0xfe77), WORD(0x4320), WORD(0x7c6d), WORD(0x5bc7),
+	WORD(0xee1e), WORD(0x4a06), WORD(0xcf43), WORD(0x90f5), WORD(0x9679), WORD(0x92de),
+	WORD(0xf9c9), WORD(0x8793), WORD(0x9b6f), WORD(0x5ca9), WORD(0x9ab3), WORD(0x1554),
+	WORD(0xe322), WORD(0x45db), WORD(0xe6ec), WORD(0x76e7), WORD(0x9616), WORD(0x07ce),
+	WORD(0x5868), WORD(0x25c4), WORD(0xfbd9), WORD(0x349e),
+	/* T[14] */
+	WORD(0xd3bb), WORD(0x3ce6), WORD(0xdf9f), WORD(0x6271), WORD(0x59a8), WORD(0xba09),
+	WORD(0x870a), WORD(0x8306), WORD(0xebf0), WORD(0x7e51), WORD(0xfd6e), WORD(0x5c97),
+	WORD(0xbcfa), WORD(0xf24f), WORD(0x5abf), WORD(0x47f2), WORD(0xea81), WORD(0xdbdc),
+	WORD(0x8ea0), WORD(0x6a68), WORD(0xd67d), WORD(0x9594), WORD(0x1a99), WORD(0x34ac),
+	WORD(0xe6a3), WORD(0x3703), WORD(0x4799), WORD(0x1213), WORD(0xcc5d), WORD(0xa204),
+	WORD(0x0491), WORD(0x0167), WORD(0x62ae), WORD(0xd1ad), WORD(0x9906), WORD(0x084a),
+	WORD(0x5738), WORD(0xb9c0), WORD(0xe726), WORD(0xa2b2), WORD(0x976a), WORD(0xc0de),
+	WORD(0xd994), WORD(0xeb43), WORD(0xc522), WORD(0xaaf3), WORD(0x221b), WORD(0xb54c),
+	WORD(0xbc82), WORD(0xfcad), WORD(0xee07), WORD(0xfe06), WORD(0xdf1e), WORD(0xba91),
+	WORD(0x8dec), WORD(0x3ef9), WORD(0x6207), WORD(0xb9ac), WORD(0xee85), WORD(0xb3ad),
+	WORD(0x32e7), WORD(0x9434), WORD(0x5f1e), WORD(0x432d),
+	/* T[15] */
+	WORD(0x3848), WORD(0xde76), WORD(0xc272), WORD(0xb36f), WORD(0x7e43), WORD(0xce3d),
+	WORD(0xdaca), WORD(0x22d9), WORD(0x814d), WORD(0x4695), WORD(0x4163), WORD(0x0532),
+	WORD(0x1d44), WORD(0x6623), WORD(0x6530), WORD(0x9a9e), WORD(0xbeb1), WORD(0x8abc),
+	WORD(0x0e18), WORD(0x8507), WORD(0x4032), WORD(0x8b33), WORD(0x0230), WORD(0xa38c),
+	WORD(0xeae6), WORD(0xe142), WORD(0xa529), WORD(0x16d5), WORD(0x2ff7), WORD(0x05e3),
+	WORD(0xb212), WORD(0x39b8), WORD(0xca01), WORD(0x639f), WORD(0xeaa9), WORD(0x3bf6),
+	WORD(0x4203), WORD(0x6d0d), WORD(0x0325), WORD(0xa2c4), WORD(0x3860), WORD(0xd885),
+	WORD(0x5b1c), WORD(0x44d7), WORD(0x659e), WORD(0xf3be), WORD(0xbbe6), WORD(0xce2e),
+	WORD(0xea1a), WORD(0x2624), WORD(0x0484), WORD(0x0493), WORD(0xb4f1), WORD(0xba13),
+	WORD(0x5558), WORD(0x19b2), WORD(0x7a4b), WORD(0x0154), WORD(0xc49d), WORD(0x342e),
+	WORD(0x6639), WORD(0x20e9), WORD(0x0fbe), WORD(0x1e8c),
+	/* T[16] */
+	WORD(0xe0e9), WORD(0xb2bc), WORD(0xa994), WORD(0x23b2), WORD(0xe03b), WORD(0xa4d3),
+	WORD(0x11cb), WORD(0x0c90), WORD(0x7342), WORD(0x355d), WORD(0x791b), WORD(0x0279),
+	WORD(0x7f7b), WORD(0x0eb2), WORD(0x83b2), WORD(0x0e31), WORD(0x4c65), WORD(0x9501),
+	WORD(0x4179), WORD(0x0ff3), WORD(0x24af), WORD(0xbea0), WORD(0xe13b), WORD(0x0ded),
+	WORD(0x484c), WORD(0x0763), WORD(0x7d97), WORD(0x7866), WORD(0x028b), WORD(0x4ec9),
+	WORD(0x2c71), WORD(0x408a), WORD(0xa777), WORD(0x497e), WORD(0xe215), WORD(0xa18c),
+	WORD(0x6f9e), WORD(0xdd7a), WORD(0xcd18), WORD(0x3246), WORD(0x5bff), WORD(0x84a6),
+	WORD(0x73fc), WORD(0xd013), WORD(0xae05), WORD(0xab09), WORD(0xff64), WORD(0x2b13),
+	WORD(0x16b1), WORD(0x300e), WORD(0xef0a), WORD(0x5046), WORD(0x902f), WORD(0x86b1),
+	WORD(0x8e05), WORD(0x780c), WORD(0x537d), WORD(0xbb74), WORD(0xa641), WORD(0x42d6),
+	WORD(0xa9af), WORD(0x0cec), WORD(0xd476), WORD(0x3555),
+	/* T[17] */
+	WORD(0x6499), WORD(0x17da), WORD(0x25cc), WORD(0x9f30), WORD(0x3d7a), WORD(0x4019),
+	WORD(0xa9e2), WORD(0xff5e), WORD(0x7a27), WORD(0x65a8), WORD(0x6459), WORD(0xec2c),
+	WORD(0x2f42), WORD(0x5b6d), WORD(0xec3e), WORD(0x1d34), WORD(0xee4d), WORD(0xb025),
+	WORD(0x30e2), WORD(0x2253), WORD(0xa51b), WORD(0x57d8), WORD(0xf341), WORD(0x88fb),
+	WORD(0xbbd0), WORD(0xec2e), WORD(0x918c), WORD(0xb3b6), WORD(0x4975), WORD(0x1323),
+	WORD(0x8dca), WORD(0x20a8), WORD(0x7566), WORD(0x4b7f), WORD(0x691a), WORD(0xed9c),
+	WORD(0x908e), WORD(0x9e83), WORD(0x97d1), WORD(0x2198), WORD(0x0ced), WORD(0x9fb5),
+	WORD(0xbe5c), WORD(0xdab9), WORD(0x5188), WORD(0x67ac), WORD(0x05d4), WORD(0x92ba),
+	WORD(0xc831), WORD(0xd863), WORD(0xa0a2), WORD(0x8e44), WORD(0x85d0), WORD(0x89c7),
+	WORD(0x95e5), WORD(0x3014), WORD(0x821a), WORD(0x7e67), WORD(0x35bd), WORD(0x8c83),
+	WORD(0xad40), WORD(0x68d7), WORD(0x7050), WORD(0x3e9d),
+	/* T[18] */
+	WORD(0x7978), WORD(0xb48e), WORD(0x64d1), WORD(0x40dc), WORD(0xf26b), WORD(0x723a),
+	WORD(0x1f78), WORD(0x227c), WORD(0xb910), WORD(0xc92e), WORD(0x7cac), WORD(0x01b5),
+	WORD(0xc8eb), WORD(0xc94c), WORD(0xb464), WORD(0xb475), WORD(0x68be), WORD(0xea28),
+	WORD(0x2ea7), WORD(0x6869), WORD(0x22ad), WORD(0x4f69), WORD(0x2f41), WORD(0x32a6),
+	WORD(0x8fb0), WORD(0x77f5), WORD(0xc3dc), WORD(0x5a5f), WORD(0xc970), WORD(0xaac8),
+	WORD(0x1abe), WORD(0x1e4e), WORD(0xe71b), WORD(0x8ae0), WORD(0x7d19), WORD(0x719f),
+	WORD(0xd3c6), WORD(0xd6bd), WORD(0xf474), WORD(0x8d85), WORD(0x0b68), WORD(0x95e8),
+	WORD(0xb9be), WORD(0xba7b), WORD(0x2494), WORD(0xe267), WORD(0xfb6f), WORD(0x9546),
+	WORD(0xb460), WORD(0x9c60), WORD(0x5fc9), WORD(0x8c9b), WORD(0xaa08), WORD(0x9a3f),
+	WORD(0x7640), WORD(0xf699), WORD(0x3c05), WORD(0x56aa), WORD(0xad72), WORD(0x82a6),
+	WORD(0x7d7b), WORD(0x3bc4), WORD(0xdf85), WORD(0x0a35),
+	/* T[19] */
+	WORD(0x92b6), WORD(0xd5a3), WORD(0xc649), WORD(0xbe1a), WORD(0xb368), WORD(0x9d6d),
+	WORD(0x8e97), WORD(0x387d), WORD(0x5dd7), WORD(0x9551), WORD(0xcd2b), WORD(0x5117),
+	WORD(0x9df4), WORD(0xa623), WORD(0x684d), WORD(0x4cca), WORD(0x2985), WORD(0x1fa4),
+	WORD(0xca45), WORD(0x263a), WORD(0xac12), WORD(0x86c9), WORD(0xe738), WORD(0x187b),
+	WORD(0xf39b), WORD(0xbabd), WORD(0xeb00), WORD(0x1eb1), WORD(0x5edb), WORD(0xbc5a),
+	WORD(0x5afe), WORD(0x2f06), WORD(0xc80e), WORD(0x6798), WORD(0x96d6), WORD(0xc844),
+	WORD(0xf8f5), WORD(0x95c4), WORD(0x7d4c), WORD(0xcc07), WORD(0x9eed), WORD(0x667e),
+	WORD(0xc17b), WORD(0x546c), WORD(0xe77a), WORD(0xfa65), WORD(0x6833), WORD(0xae8e),
+	WORD(0x8417), WORD(0xe9de), WORD(0x25a0), WORD(0x8f8a), WORD(0x38eb), WORD(0x007a),
+	WORD(0x52b0), WORD(0x412d), WORD(0x56a6), WORD(0x1c5b), WORD(0xfde7), WORD(0x9d8f),
+	WORD(0xd8a3), WORD(0x9921), WORD(0xa147), WORD(0x357c),
+	/* T[20] */
+	WORD(0x9c4d), WORD(0xe31e), WORD(0x29dd), WORD(0x87f1), WORD(0xc08b), WORD(0x968e),
+	WORD(0x15f0), WORD(0xa1a0), WORD(0xb55e), WORD(0x00cc), WORD(0xaaa9), WORD(0x48b3),
+	WORD(0x2d29), WORD(0xd3fd), WORD(0x1989), WORD(0x9887), WORD(0x46f5), WORD(0xe22b),
+	WORD(0x473f), WORD(0xef5f), WORD(0xa9c2), WORD(0x1bb5), WORD(0xf67b), WORD(0x4fad),
+	WORD(0x3d31), WORD(0x0a6f), WORD(0x5a6f), WORD(0xbb3b), WORD(0xf99e), WORD(0x8891),
+	WORD(0x33ca), WORD(0x0262), WORD(0x77c4), WORD(0x891b), WORD(0x00a4), WORD(0x34b5),
+	WORD(0x52de), WORD(0xd688), WORD(0x46d0), WORD(0x700d), WORD(0x1479), WORD(0xf305),
+	WORD(0xa19f), WORD(0x6fc8), WORD(0x6ad4), WORD(0xefe7), WORD(0x402a), WORD(0x6bcd),
+	WORD(0xeeb6), WORD(0x5f6b), WORD(0x0173), WORD(0xbda5), WORD(0x45bc), WORD(0xada8),
+	WORD(0x62fd), WORD(0x5d5e), WORD(0xfe07), WORD(0x730f), WORD(0x1100), WORD(0x6904),
+	WORD(0xfd28), WORD(0xc6b3), WORD(0x8117), WORD(0x27d4),
+	/* T[21] */
+	WORD(0x5b66), WORD(0x508b), WORD(0x8534), WORD(0x3904), WORD(0x0052), WORD(0xd3d0),
+	WORD(0x6be5), WORD(0x2c13), WORD(0x3bca), WORD(0x9e89), WORD(0xadeb), WORD(0x9bc2),
+	WORD(0xcb63), WORD(0xf44b), WORD(0x0681), WORD(0x5f45), WORD(0x7cf1), WORD(0x5e1b),
+	WORD(0xe4ae), WORD(0x8a7e), WORD(0xe023), WORD(0x7b04), WORD(0x8bb7), WORD(0xc1f2),
+	WORD(0x37f8), WORD(0x5945), WORD(0x6976), WORD(0x52d3), WORD(0xb8f5), WORD(0xa8e7),
+	WORD(0x34f4), WORD(0x38b4), WORD(0x5419), WORD(0x7a98), WORD(0x2316), WORD(0xddeb),
+	WORD(0x560d), WORD(0x19c1), WORD(0x14e8), WORD(0x1e3e), WORD(0xbc8b), WORD(0xe96e),
+	WORD(0xdd36), WORD(0xacbd), WORD(0xb0eb), WORD(0xd0ef), WORD(0x41ea), WORD(0x26d4),
+	WORD(0xcb36), WORD(0x0c58), WORD(0xdd84), WORD(0x006b), WORD(0x6721), WORD(0xc9ac),
+	WORD(0x5ec4), WORD(0x20d7), WORD(0x8292), WORD(0x4281), WORD(0xecaa), WORD(0xd4cd),
+	WORD(0xf2fb), WORD(0x6158), WORD(0x77c9), WORD(0x4092),
+	/* T[22] */
+	WORD(0xe9e5), WORD(0xa49d), WORD(0x4e4f), WORD(0x28d2), WORD(0x41b4), WORD(0xf74c),
+	WORD(0xd21b), WORD(0xa1dc), WORD(0xea1e), WORD(0xe238), WORD(0xc3b7), WORD(0xd8cd),
+	WORD(0xcb08), WORD(0x95f2), WORD(0x6515), WORD(0xac72), WORD(0x6bda), WORD(0x28e6),
+	WORD(0xe7bf), WORD(0x9972), WORD(0x985f), WORD(0xcaeb), WORD(0x977e), WORD(0x0f3e),
+	WORD(0x8f38), WORD(0x7926), WORD(0xac0a), WORD(0x6f99), WORD(0x8b78), WORD(0xe4cc),
+	WORD(0xb323), WORD(0x379d), WORD(0xd3dc), WORD(0xb21d), WORD(0x57ce), WORD(0xdcae),
+	WORD(0x7906), WORD(0xce0c), WORD(0x19dc), WORD(0x0884), WORD(0xdbe6), WORD(0x79ad),
+	WORD(0xa46f), WORD(0xe25b), WORD(0x2f9f), WORD(0x2141), WORD(0x5057), WORD(0xcbec),
+	WORD(0xa1c3), WORD(0x4c95), WORD(0x5c57), WORD(0xa9cb), WORD(0xc0a1), WORD(0xa064),
+	WORD(0x10ac), WORD(0x0879), WORD(0x8aa2), WORD(0x1d5f), WORD(0xb5d6), WORD(0xe8c9),
+	WORD(0x31e2), WORD(0x2bc1), WORD(0x2b6f), WORD(0x2baf),
+	/* T[23] */
+	WORD(0x57f7), WORD(0x9b7d), WORD(0x905c), WORD(0xed20), WORD(0xfc43), WORD(0x544f),
+	WORD(0xdd33), WORD(0xbe3e), WORD(0xd7dd), WORD(0x93e0), WORD(0xbb2b), WORD(0x0e77),
+	WORD(0xe831), WORD(0xf3c8), WORD(0x557f), WORD(0x9517), WORD(0x13a9), WORD(0x0529),
+	WORD(0x7d40), WORD(0x306b), WORD(0x7f4b), WORD(0x0b9c), WORD(0x744f), WORD(0x7055),
+	WORD(0x84f2), WORD(0x9a84), WORD(0xc042), WORD(0xf293), WORD(0xea44), WORD(0xf74a),
+	WORD(0x35c7), WORD(0x3f84), WORD(0x02f3), WORD(0xb919), WORD(0x8fad), WORD(0x57b9),
+	WORD(0xf7a3), WORD(0x32ab), WORD(0x7c44), WORD(0x5183), WORD(0x009c), WORD(0x145c),
+	WORD(0x46dd), WORD(0x35b5), WORD(0x7417), WORD(0xca49), WORD(0x6571), WORD(0xf465),
+	WORD(0x468e), WORD(0xaad3), WORD(0xa7ef), WORD(0xb4de), WORD(0xa073), WORD(0xd547),
+	WORD(0x7992), WORD(0x7205), WORD(0x16d1), WORD(0x8dcb), WORD(0x9e58), WORD(0xf8d6),
+	WORD(0x8c87), WORD(0xdce6), WORD(0xfabe), WORD(0x0038),
+	/* T[24] */
+	WORD(0x4738), WORD(0x4a97), WORD(0x80cb), WORD(0x64c9), WORD(0x87c2), WORD(0x12d7),
+	WORD(0x2cb8), WORD(0x0b2f), WORD(0xa8c8), WORD(0x2d50), WORD(0xdf7e), WORD(0x7b13),
+	WORD(0xe604), WORD(0xe94d), WORD(0xfa54), WORD(0x9de2), WORD(0x4816), WORD(0xc5ac),
+	WORD(0x69c3), WORD(0x4666), WORD(0x331f), WORD(0x1f04), WORD(0x7967), WORD(0x6858),
+	WORD(0xd2fe), WORD(0x23df), WORD(0xc02d), WORD(0x5662), WORD(0xfc3e), WORD(0xb7ed),
+	WORD(0x2965), WORD(0x14c3), WORD(0x6313), WORD(0x9620), WORD(0xfa73), WORD(0xd385),
+	WORD(0x2f95), WORD(0xc71d), WORD(0x2759), WORD(0x5272), WORD(0x6f49), WORD(0x4964),
+	WORD(0xa9ec), WORD(0xbe2c), WORD(0x220d), WORD(0x6edc), WORD(0x2685), WORD(0xf2d1),
+	WORD(0x6339), WORD(0xca54), WORD(0x7dcf), WORD(0x7700), WORD(0xb95c), WORD(0x1ae0),
+	WORD(0x03ca), WORD(0x9ba4), WORD(0x1cd8), WORD(0x0f59), WORD(0xe92b), WORD(0x5b58),
+	WORD(0xf5e3), WORD(0xca90), WORD(0x7c09), WORD(0x0c67),
+	/* T[25] */
+	WORD(0x5a74), WORD(0xb379), WORD(0x01e6), WORD(0x5f4a), WORD(0x623d), WORD(0x0fc1),
+	WORD(0xba93), WORD(0x4e24), WORD(0x6885), WORD(0x40c1), WORD(0xc598), WORD(0x65a9),
+	WORD(0xabfa), WORD(0xf9dd), WORD(0x1e13), WORD(0xba5b), WORD(0xe79e), WORD(0x1e40),
+	WORD(0x51b1), WORD(0xd31c), WORD(0xb960), WORD(0x482c), WORD(0xc732), WORD(0xbd5b),
+	WORD(0xe467), WORD(0x78c2), WORD(0x940f), WORD(0xb795), WORD(0x3ed2), WORD(0xc9fb),
+	WORD(0x8b1b), WORD(0x21ba), WORD(0x5fe9), WORD(0xaa45), WORD(0xeeab), WORD(0x42a3),
+	WORD(0x4002), WORD(0xcf39), WORD(0x9b74), WORD(0x1b93), WORD(0x7b70), WORD(0xc957),
+	WORD(0xacec), WORD(0xd825), WORD(0x583f), WORD(0x68b6), WORD(0x057d), WORD(0x5b0c),
+	WORD(0x5d5a), WORD(0x9312), WORD(0x985d), WORD(0x5994), WORD(0x9dce), WORD(0x4d06),
+	WORD(0x3025), WORD(0x32fb), WORD(0x1df9), WORD(0x0d09), WORD(0x74bb), WORD(0x5bb3),
+	WORD(0x1ba4), WORD(0x96b5), WORD(0x84ca), WORD(0x3b6b),
+	/* T[26] */
+	WORD(0x46a7), WORD(0xdf01), WORD(0xedf6), WORD(0x6385), WORD(0x95f9), WORD(0x3bd7),
+	WORD(0xb2cc), WORD(0x5d6d), WORD(0x5bdc), WORD(0xda4b), WORD(0x1aeb), WORD(0xa594),
+	WORD(0x2a38), WORD(0x6dec), WORD(0x1696), WORD(0xfebf), WORD(0xcb86), WORD(0xe1ea),
+	WORD(0x916b), WORD(0xfd14), WORD(0xe5bd), WORD(0xc054), WORD(0x8c01), WORD(0x74a4),
+	WORD(0x3fd3), WORD(0xb096), WORD(0x431a), WORD(0x89b4), WORD(0xdcc0), WORD(0x4f6f),
+	WORD(0x653e), WORD(0x1179), WORD(0xd0c9), WORD(0x3cbc), WORD(0x9fa6), WORD(0x6bc5),
+	WORD(0x0093), WORD(0xfc5a), WORD(0xed43), WORD(0x6384), WORD(0x80e5), WORD(0xf6eb),
+	WORD(0xddf4), WORD(0xca90), WORD(0x836c), WORD(0xdcfd), WORD(0x9dd1), WORD(0x0a23),
+	WORD(0x3132), WORD(0x14ff), WORD(0xac59), WORD(0x6d36), WORD(0xad9e), WORD(0xab38),
+	WORD(0xdbca), WORD(0x7a93), WORD(0xfb85), WORD(0xb184), WORD(0x6f2d), WORD(0x7173),
+	WORD(0x885b), WORD(0xeecf), WORD(0x2ee0), WORD(0x149f),
+	/* T[27] */
+	WORD(0x6880), WORD(0x314e), WORD(0x4ea9), WORD(0x7d9e), WORD(0xede2), WORD(0x428a),
+	WORD(0xc840), WORD(0xc2fe), WORD(0x680f), WORD(0xf975), WORD(0x5937), WORD(0x0460),
+	WORD(0xa5d9), WORD(0x450f), WORD(0xe0ae), WORD(0x7ace), WORD(0xceb7), WORD(0x5f4e),
+	WORD(0x0507), WORD(0xf255), WORD(0xdc0b), WORD(0xf346), WORD(0xaaf7), WORD(0x21e7),
+	WORD(0xf5bb), WORD(0x3b4d), WORD(0xada7), WORD(0x9b47), WORD(0x7913), WORD(0x5b8b),
+	WORD(0xb23f), WORD(0x213b), WORD(0x3060), WORD(0x85d4), WORD(0xe097), WORD(0xc536),
+	WORD(0x3cb2), WORD(0x4c08), WORD(0xa6b5), WORD(0xd975), WORD(0x2838), WORD(0x7943),
+	WORD(0xaebf), WORD(0xd1e7), WORD(0xb257), WORD(0x8cdc), WORD(0x13d7), WORD(0xd440),
+	WORD(0x037a), WORD(0x27dc), WORD(0x946f), WORD(0x5e82), WORD(0xb6ab), WORD(0x546b),
+	WORD(0xf5d9), WORD(0xd6f1), WORD(0x5c63), WORD(0x4bd4), WORD(0x9649), WORD(0xaa8b),
+	WORD(0x24b2), WORD(0xb274), WORD(0xe68d), WORD(0x1310),
+	/* T[28] */
+	WORD(0xf6a7), WORD(0x5fdb), WORD(0xf3f6), WORD(0x4e27), WORD(0x6b32), WORD(0x0f37),
+	WORD(0x154d), WORD(0x666a), WORD(0xc680), WORD(0xf331), WORD(0x04c6), WORD(0x1308),
+	WORD(0xf99d), WORD(0xa04c), WORD(0xb1c1), WORD(0x3dbc), WORD(0x8191), WORD(0x516a),
+	WORD(0xbb9c), WORD(0x372d), WORD(0xc65f), WORD(0x3ca0), WORD(0xe8b7), WORD(0x7498),
+	WORD(0x9dd3), WORD(0x6238), WORD(0xb95b), WORD(0x061a), WORD(0x9327), WORD(0xece9),
+	WORD(0xb399), WORD(0x0cac), WORD(0xc10d), WORD(0xe2a8), WORD(0xa6e2), WORD(0x4e73),
+	WORD(0x1bb6), WORD(0x5984), WORD(0x815e), WORD(0xbb30), WORD(0x3c42), WORD(0x5730),
+	WORD(0xe64f), WORD(0x4021), WORD(0xdcd3), WORD(0x7e15), WORD(0xaa01), WORD(0x475c),
+	WORD(0x5319), WORD(0x509e), WORD(0x4416), WORD(0x3164), WORD(0x7b44), WORD(0xea80),
+	WORD(0x6f92), WORD(0x155f), WORD(0xb382), WORD(0xd2e7), WORD(0xecb4), WORD(0x2aaf),
+	WORD(0x305e), WORD(0x98ab), WORD(0xd9a5), WORD(0x42d5),
+	/* T[29] */
+	WORD(0xb494), WORD(0x5015), WORD(0x03a3), WORD(0xa554), WORD(0xeb3c), WORD(0x127d),
+	WORD(0x6bde), WORD(0xac28), WORD(0x9458), WORD(0x53ad), WORD(0x9a38), WORD(0xbb0c),
+	WORD(0x159e), WORD(0xb0b8), WORD(0x8c81), WORD(0x1add), WORD(0x9d09), WORD(0x98ea),
+	WORD(0x31dc), WORD(0x6291), WORD(0x7682), WORD(0x7632), WORD(0x449b), WORD(0xbdfb),
+	WORD(0x01b7), WORD(0xf4c9), WORD(0x3190), WORD(0x1504), WORD(0xfe11), WORD(0x2b08),
+	WORD(0x2964), WORD(0x0f47), WORD(0x3079), WORD(0xa95d), WORD(0x8600), WORD(0x6d95),
+	WORD(0x557e), WORD(0x5367), WORD(0x30b4), WORD(0x8010), WORD(0xd14d), WORD(0x4e67),
+	WORD(0xe519), WORD(0xb6a0), WORD(0xdf07), WORD(0x831a), WORD(0xde54), WORD(0xfa9d),
+	WORD(0x9787), WORD(0x645d), WORD(0xff0a), WORD(0x886a), WORD(0xcd6d), WORD(0x2e04),
+	WORD(0xb5ec), WORD(0xdd59), WORD(0x04e7), WORD(0xf1ba), WORD(0xd235), WORD(0x92b5),
+	WORD(0xda70), WORD(0x4560), WORD(0x61e0), WORD(0x2c7c),
+	/* T[30] */
+	WORD(0x544f), WORD(0x764b), WORD(0x7b3a), WORD(0x169a), WORD(0x72a7), WORD(0x2870),
+	WORD(0x0222), WORD(0x4451), WORD(0x13a5), WORD(0xa4bb), WORD(0x92ad), WORD(0x873f),
+	WORD(0x06ca), WORD(0x8c5c), WORD(0x4bb5), WORD(0x89f6), WORD(0x2a2b), WORD(0x9386),
+	WORD(0x29c0), WORD(0x5eab), WORD(0xcf40), WORD(0x666a), WORD(0xf98c), WORD(0x2c44),
+	WORD(0x2ae2), WORD(0x76b2), WORD(0x8753), WORD(0x376e), WORD(0xc304), WORD(0x5e8e),
+	WORD(0x8ebf), WORD(0x0a07), WORD(0x282e), WORD(0x3095), WORD(0xe525), WORD(0xf965),
+	WORD(0x6e61), WORD(0xc526), WORD(0xa98b), WORD(0xc873), WORD(0xbabb), WORD(0x5f77),
+	WORD(0xc251), WORD(0xa6fa), WORD(0x0127), WORD(0x6338), WORD(0x8275), WORD(0x607d),
+	WORD(0x3d7a), WORD(0xc0e6), WORD(0x6c55), WORD(0x7018), WORD(0x0053), WORD(0xa49a),
+	WORD(0x0b17), WORD(0x646d), WORD(0x585a), WORD(0x9332), WORD(0xed11), WORD(0x2149),
+	WORD(0xdca0), WORD(0x0ea2), WORD(0x646d), WORD(0x0212),
+	/* T[31] */
+	WORD(0xf374), WORD(0xc559), WORD(0x852d), WORD(0xce2c), WORD(0x7399), WORD(0x20c5),
+	WORD(0xc4d0), WORD(0xb534), WORD(0x37f4), WORD(0x9a1c), WORD(0x8056), WORD(0xb01f),
+	WORD(0xad76), WORD(0x54f4), WORD(0xfe76), WORD(0x8c22), WORD(0x318a), WORD(0x7571),
+	WORD(0x03e5), WORD(0x77eb), WORD(0x2d09), WORD(0x1ae7), WORD(0xe870), WORD(0x9b46),
+	WORD(0x4157), WORD(0x04c3), WORD(0x8f93), WORD(0xdf6a), WORD(0xed15), WORD(0xd48e),
+	WORD(0x736f), WORD(0x3b4c), WORD(0xf929), WORD(0x82fd), WORD(0x4127), WORD(0x93e8),
+	WORD(0xabf4), WORD(0x8ed4), WORD(0x1367), WORD(0x4add), WORD(0xd9a6), WORD(0x5eff),
+	WORD(0xcda0), WORD(0x7b79), WORD(0x42bd), WORD(0x498e), WORD(0xadd8), WORD(0xe344),
+	WORD(0xc7de), WORD(0x8bf0), WORD(0x4ba4), WORD(0x774a), WORD(0x4c11), WORD(0x8abf),
+	WORD(0xdd89), WORD(0x38f3), WORD(0xed88), WORD(0x6c1f), WORD(0x81d9), WORD(0xcbed),
+	WORD(0x560c), WORD(0x85fa), WORD(0xca8e), WORD(0x0dff),
+};
+#else                     /* unknown word size */
+#error "Unsupported word size"
+#endif
+TO_EC_GEN_TABLE_PARAM(GOST_512bits_curve_gen_comb, 6);
+
 static const ec_str_params GOST_512bits_curve_str_params = {
 	.p = &GOST_512bits_curve_p_str_param,
 	.p_bitlen = &GOST_512bits_curve_p_bitlen_str_param,
@@ -232,6 +2533,11 @@ static const ec_str_params GOST_512bits_curve_str_params = {
 	.cofactor = &GOST_512bits_curve_cofactor_str_param,
 	.oid = &GOST_512bits_curve_oid_str_param,
 	.name = &GOST_512bits_curve_name_str_param,
+	.p_inv_chain = &GOST_512bits_curve_p_inv_chain_param,
+	.p_sqrt_chain = &GOST_512bits_curve_p_sqrt_chain_param,
+	.q_inv_chain = &GOST_512bits_curve_q_inv_chain_param,
+	.gen_wnaf_table = &GOST_512bits_curve_gen_wnaf_table_param,
+	.gen_comb_table = &GOST_512bits_curve_gen_comb_table_param,
 };
 
 /*
@@ -252,6 +2558,17 @@ static const ec_str_params GOST_512bits_curve_str_params = {
 #define CURVES_MAX_Q_BIT_LEN CURVE_GOST512_Q_BITLEN
 #endif
 
+/*
+ * Limb count of p for the fixed limbs field backend (see fp_fixed.h)
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+#define FP_FIXED_WLEN_8_USED
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+#define FP_FIXED_WLEN_16_USED
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+/* More than 17 limbs: generic field code */
+#endif
+
 #endif /* __EC_PARAMS_GOST512_H__ */
 
 #endif /* WITH_CURVE_GOST512 */
@@ -238,6 +238,948 @@ TO_EC_STR_PARAM(secp192r1_name);
 static const u8 secp192r1_oid[] = "1.2.840.10045.3.1.1";
 TO_EC_STR_PARAM(secp192r1_oid);
 
+/* x^(p - 2): 191 squarings and 18 multiplications */
+static const u8 secp192r1_p_inv[] = {
+	0x10, 0x01, 0x00,
+	0x21, 0x02, 0x01,
+	0x32, 0x04, 0x02,
+	0x43, 0x08, 0x03,
+	0x54, 0x10, 0x04,
+	0x65, 0x20, 0x05,
+	0x66, 0x20, 0x05,
+	0x66, 0x10, 0x04,
+	0x66, 0x08, 0x03,
+	0x66, 0x04, 0x02,
+	0x66, 0x02, 0x01,
+	0x66, 0x01, 0x00,
+	0x66, 0x21, 0x05,
+	0x66, 0x10, 0x04,
+	0x66, 0x08, 0x03,
+	0x66, 0x04, 0x02,
+	0x66, 0x02, 0x01,
+	0x66, 0x02, 0x00,
+};
+TO_EC_CHAIN_PARAM(secp192r1_p_inv);
+
+/* x^((p + 1) / 4): 189 squarings and 7 multiplications */
+static const u8 secp192r1_p_sqrt[] = {
+	0x10, 0x01, 0x00,
+	0x21, 0x02, 0x01,
+	0x32, 0x04, 0x02,
+	0x43, 0x08, 0x03,
+	0x54, 0x10, 0x04,
+	0x65, 0x20, 0x05,
+	0x76, 0x40, 0x06,
+	0x77, 0x3e, 0xff,
+};
+TO_EC_CHAIN_PARAM(secp192r1_p_sqrt);
+
+/* x^(q - 2): 192 squarings and 32 multiplications */
+static const u8 secp192r1_q_inv[] = {
+	0x10, 0x01, 0x00,
+	0x21, 0x02, 0x01,
+	0x32, 0x04, 0x02,
+	0x43, 0x08, 0x03,
+	0x54, 0x10, 0x04,
+	0x60, 0x01, 0xff,
+	0x71, 0x00, 0x06,
+	0x87, 0x00, 0x06,
+	0x98, 0x00, 0x06,
+	0xa9, 0x00, 0x06,
+	0xba, 0x00, 0x06,
+	0xc5, 0x20, 0x05,
+	0xcc, 0x20, 0x05,
+	0xcc, 0x01, 0x00,
+	0xcc, 0x04, 0x01,
+	0xcc, 0x05, 0x08,
+	0xcc, 0x05, 0x02,
+	0xcc, 0x05, 0x02,
+	0xcc, 0x01, 0x00,
+	0xcc, 0x09, 0x0b,
+	0xcc, 0x01, 0x00,
+	0xcc, 0x07, 0x07,
+	0xcc, 0x07, 0x0b,
+	0xcc, 0x05, 0x02,
+	0xcc, 0x06, 0x09,
+	0xcc, 0x04, 0x0a,
+	0xcc, 0x07, 0x0b,
+	0xcc, 0x03, 0x07,
+	0xcc, 0x06, 0x0b,
+	0xcc, 0x03, 0x00,
+	0xcc, 0x06, 0x07,
+	0xcc, 0x09, 0x0a,
+	0xcc, 0x02, 0x01,
+};
+TO_EC_CHAIN_PARAM(secp192r1_q_inv);
+
+/*
+ * Odd multiples G, 3G, ..., 63G of the generator for the wNAF
+ * multiplications (window 7), affine x and y in Montgomery representation
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+static const word_t secp192r1_gen_wnaf[] = {
+	/* G */
+	WORD(0x0d8cb30c332fa108), WORD(0x8a4bd3f776d12909),
+	WORD(0x954cc8f9f3d218f7), WORD(0x7b12a3371e422289),
+	WORD(0xde22b5248966f05e), WORD(0x6a293d836aeda84d),
+	/* 3G */
+	WORD(0x56b3fd7f230c0249), WORD(0x3386809f42bebbf4),
+	WORD(0x53b5ad45770c581a), WORD(0x6be17b497fb74b1e),
+	WORD(0x16445c4850d91fbd), WORD(0x228f18e243dc19c0),
+	/* 5G */
+	WORD(0x69bca7841d8490a8), WORD(0xa7c435204d92a6ad),
+	WORD(0x4ec31c347012b11d), WORD(0x6261825c843e401c),
+	WORD(0x102b7a936a65a2da), WORD(0xdf00083f2d96f43a),
+	/* 7G */
+	WORD(0xeb8ad91fe5efca73), WORD(0x4c83fc441650b841),
+	WORD(0xeea07d43a63ebb45), WORD(0x2c8262c8cc6ab309),
+	WORD(0x44a67081ca1e7327), WORD(0x6fef6d8866147372),
+	/* 9G */
+	WORD(0x9f27848b449ce446), WORD(0xedc613b6ed6f60e4),
+	WORD(0xd028dc5c33ef2855), WORD(0x32bbfe7f97566f06),
+	WORD(0xaee52dfc529bebe5), WORD(0x7dfad9dadbd304ac),
+	/* 11G */
+	WORD(0x44a299ccf19ed4f9), WORD(0x5ce790e33ec18b4b),
+	WORD(0x34de50ac3898e8a1), WORD(0xa2641e2f52948777),
+	WORD(0xa5037393538eff35), WORD(0xf1b6bb3238e46331),
+	/* 13G */
+	WORD(0x153f3b780f8904a9), WORD(0x44a7bd9614a75349),
+	WORD(0x4093735fd85d4a3f), WORD(0xed1d5ed03f7db015),
+	WORD(0x174975f71fff90b3), WORD(0x9838d562dcd47496),
+	/* 15G */
+	WORD(0xc373e084b0cf681b), WORD(0x7da927376610b602),
+	WORD(0x46cadc98f098041b), WORD(0xd3e0adf86cdec872),
+	WORD(0x50d43591a7842f28), WORD(0xa35efdc3cdf46778),
+	/* 17G */
+	WORD(0xcfdba265e7056d4e), WORD(0xc9d1189ca9b98e89),
+	WORD(0x3e1cd309a4a88eff), WORD(0x8b2429c3d040ec58),
+	WORD(0x6967afd67859d5e6), WORD(0xcdf1095ba5fbf616),
+	/* 19G */
+	WORD(0x37b23549417692ee), WORD(0x3fafb8db7a4db977),
+	WORD(0xc85fef615d550c5c), WORD(0x88f70525c591dfcc),
+	WORD(0x20d82c9eadbba7d1), WORD(0x34bdc1503bc105c7),
+	/* 21G */
+	WORD(0x09a14d89c7b622a0), WORD(0x719fb61104ac07cd),
+	WORD(0x487f1ad3485b1f75), WORD(0x6604b185f779459c),
+	WORD(0x633d924a79ffa446), WORD(0x0a48ac49e2ed4e42),
+	/* 23G */
+	WORD(0x791db75f8d76bd59), WORD(0x664088fba5c667f8),
+	WORD(0x7cc0335c5a1f032a), WORD(0xabb460b3bf031b03),
+	WORD(0xcb61b85ec8f559b0), WORD(0x282335bafed307dc),
+	/* 25G */
+	WORD(0x422b5a19bfd973a2), WORD(0xe637c08a7de885a1),
+	WORD(0x493d27a728af843c), WORD(0x0635af1627d0f709),
+	WORD(0xfaa0731da46b8241), WORD(0x30152936de8513de),
+	/* 27G */
+	WORD(0xeaa0614edea3626f), WORD(0xb077889951b201c7),
+	WORD(0xe1e17ccfbc24cf40), WORD(0x5b9a23566f6a4f09),
+	WORD(0x6b43dd8981b35be5), WORD(0x7134a9008eb6864b),
+	/* 29G */
+	WORD(0xb550886c267c3b3b), WORD(0xe4ef0b6a072ada2a),
+	WORD(0xefb23bc916cf9337), WORD(0xf4945a35035d6cdd),
+	WORD(0x7c2fbc7524d8682c), WORD(0xb4b6f148b35b5932),
+	/* 31G */
+	WORD(0xa5549752c1a83d71), WORD(0xe9b2c58f07c519da),
+	WORD(0x6f5e6aee286a27e2), WORD(0x99cece8d7cfc6dd4),
+	WORD(0x18c9b5f7bbc24c84), WORD(0x7e5875cad5a88338),
+	/* 33G */
+	WORD(0x41095e964fbffaeb), WORD(0x422337e28b3c6012),
+	WORD(0xb731e12b563eef5d), WORD(0x7e950bddc07cc789),
+	WORD(0xf97c27539d9cc3aa), WORD(0x7af21a9a5a7f7345),
+	/* 35G */
+	WORD(0xb35bcfb016036842), WORD(0x036d725decedc764),
+	WORD(0xcbcb01612c6f8668), WORD(0x0348f7191b04bc1a),
+	WORD(0x0b2d84f8e1e99a42), WORD(0xf098e97a9c1ec6e6),
+	/* 37G */
+	WORD(0x9d83fd012775c0c5), WORD(0x8658cc5a065da96c),
+	WORD(0x466cf509604210f1), WORD(0xdc4d8237e8fc750b),
+	WORD(0xb13663ff1477a111), WORD(0x6a0ef58f4252c38b),
+	/* 39G */
+	WORD(0x49b1bb22caa33960), WORD(0x45871855e647c5a4),
+	WORD(0x6d71e970167d6801), WORD(0xbbeae386a2764f1f),
+	WORD(0xc7df73b81284c39a), WORD(0x3ddc63bee8a8b423),
+	/* 41G */
+	WORD(0xc4bdbeb26709fe0c), WORD(0x86c2f2252aa46589),
+	WORD(0x6e215f981c6d96c6), WORD(0x3b1022551900c952),
+	WORD(0x09b6f4470b476bea), WORD(0x888773561643c833),
+	/* 43G */
+	WORD(0x111d94b70ee8588b), WORD(0x5f7ba2ed1cae2230),
+	WORD(0xd1119eb28b428b68), WORD(0x5ac72be9c5901d8a),
+	WORD(0xd11c39be1a7e213d), WORD(0x5eba5216ae1574db),
+	/* 45G */
+	WORD(0xbbb380870d359302), WORD(0xe0c552b53bf7212f),
+	WORD(0x6873aa54ce70eda4), WORD(0x42eb0476f0dcd6fe),
+	WORD(0xe354ae37202c6fba), WORD(0xd2eeb9a4bb182481),
+	/* 47G */
+	WORD(0x2e246f368959dc53), WORD(0xc6882bd23f449349),
+	WORD(0xfbcda06252d56c22), WORD(0xaf1525bc037c14b7),
+	WORD(0x79f2c364f51db774), WORD(0x51d5156e397c0db5),
+	/* 49G */
+	WORD(0x38f567042d623962), WORD(0x1d5927f2b8e018b4),
+	WORD(0x60f41495b7159417), WORD(0xa531058ee71a9c08),
+	WORD(0x038edfcfc4427fd5), WORD(0xf40f0c3f16bcd9b9),
+	/* 51G */
+	WORD(0xbc40bae0218251e9), WORD(0x86a6f175ff92ffab),
+	WORD(0xc538fbe815c92a68), WORD(0x94b037e5ce8e05fa),
+	WORD(0x1e23b8c738df007b), WORD(0xcf60919b6dfc21b0),
+	/* 53G */
+	WORD(0x6c66ac7c07b07222), WORD(0x7a2251bfabbb5a7e),
+	WORD(0x6898eec1ea506766), WORD(0x8ee773e90c8100c3),
+	WORD(0xe267812ab5ac1e10), WORD(0x51d3e17e45ea2616),
+	/* 55G */
+	WORD(0xe0cad6d0ab0c2496), WORD(0xad9d4a4b3e58a13e),
+	WORD(0xb4009b9fcb2f20c6), WORD(0xf586adaafbd04c92),
+	WORD(0x27f06af165e4a2c2), WORD(0x5efc658fe6ac820a),
+	/* 57G */
+	WORD(0xd072005c45111281), WORD(0xc38687f7c6dd923a),
+	WORD(0xc5493c3be7e55c30), WORD(0xc801a0dd1e7bcaf3),
+	WORD(0x7d89637866af003d), WORD(0x88c92d2e5c5fc040),
+	/* 59G */
+	WORD(0x752de436489578d4), WORD(0x0ade8b1c6c0f251c),
+	WORD(0x29b34ffc59ad5609), WORD(0xd4af9bf6857c870b),
+	WORD(0xb779fab3e6b0527e), WORD(0x20970dfe70ef261f),
+	/* 61G */
+	WORD(0x4af8089114729183), WORD(0x444581902650cc8e),
+	WORD(0x738c0bd4587ad69a), WORD(0xdab8713aefc4b5e7),
+	WORD(0x7d6d6ae3902363c0), WORD(0xad59389845acff6b),
+	/* 63G */
+	WORD(0xcc1674d5a5542c7d), WORD(0xc8ebdbdd1fb770dd),
+	WORD(0x7d70a1ed0a3b16ce), WORD(0xa74f8148685db534),
+	WORD(0xa0eab0ad37c0b157), WORD(0xcd8063a7a3971e22),
+};
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+static const word_t secp192r1_gen_wnaf[] = {
+	/* G */
+	WORD(0x332fa108), WORD(0x0d8cb30c), WORD(0x76d12909), WORD(0x8a4bd3f7),
+	WORD(0xf3d218f7), WORD(0x954cc8f9), WORD(0x1e422289), WORD(0x7b12a337),
+	WORD(0x8966f05e), WORD(0xde22b524), WORD(0x6aeda84d), WORD(0x6a293d83),
+	/* 3G */
+	WORD(0x230c0249), WORD(0x56b3fd7f), WORD(0x42bebbf4), WORD(0x3386809f),
+	WORD(0x770c581a), WORD(0x53b5ad45), WORD(0x7fb74b1e), WORD(0x6be17b49),
+	WORD(0x50d91fbd), WORD(0x16445c48), WORD(0x43dc19c0), WORD(0x228f18e2),
+	/* 5G */
+	WORD(0x1d8490a8), WORD(0x69bca784), WORD(0x4d92a6ad), WORD(0xa7c43520),
+	WORD(0x7012b11d), WORD(0x4ec31c34), WORD(0x843e401c), WORD(0x6261825c),
+	WORD(0x6a65a2da), WORD(0x102b7a93), WORD(0x2d96f43a), WORD(0xdf00083f),
+	/* 7G */
+	WORD(0xe5efca73), WORD(0xeb8ad91f), WORD(0x1650b841), WORD(0x4c83fc44),
+	WORD(0xa63ebb45), WORD(0xeea07d43), WORD(0xcc6ab309), WORD(0x2c8262c8),
+	WORD(0xca1e7327), WORD(0x44a67081), WORD(0x66147372), WORD(0x6fef6d88),
+	/* 9G */
+	WORD(0x449ce446), WORD(0x9f27848b), WORD(0xed6f60e4), WORD(0xedc613b6),
+	WORD(0x33ef2855), WORD(0xd028dc5c), WORD(0x97566f06), WORD(0x32bbfe7f),
+	WORD(0x529bebe5), WORD(0xaee52dfc), WORD(0xdbd304ac), WORD(0x7dfad9da),
+	/* 11G */
+	WORD(0xf19ed4f9), WORD(0x44a299cc), WORD(0x3ec18b4b), WORD(0x5ce790e3),
+	WORD(0x3898e8a1), WORD(0x34de50ac), WORD(0x52948777), WORD(0xa2641e2f),
+	WORD(0x538eff35), WORD(0xa5037393), WORD(0x38e46331), WORD(0xf1b6bb32),
+	/* 13G */
+	WORD(0x0f8904a9), WORD(0x153f3b78), WORD(0x14a75349), WORD(0x44a7bd96),
+	WORD(0xd85d4a3f), WORD(0x4093735f), WORD(0x3f7db015), WORD(0xed1d5ed0),
+	WORD(0x1fff90b3), WORD(0x174975f7), WORD(0xdcd47496), WORD(0x9838d562),
+	/* 15G */
+	WORD(0xb0cf681b), WORD(0xc373e084), WORD(0x6610b602), WORD(0x7da92737),
+	WORD(0xf098041b), WORD(0x46cadc98), WORD(0x6cdec872), WORD(0xd3e0adf8),
+	WORD(0xa7842f28), WORD(0x50d43591), WORD(0xcdf46778), WORD(0xa35efdc3),
+	/* 17G */
+	WORD(0xe7056d4e), WORD(0xcfdba265), WORD(0xa9b98e89), WORD(0xc9d1189c),
+	WORD(0xa4a88eff), WORD(0x3e1cd309), WORD(0xd040ec58), WORD(0x8b2429c3),
+	WORD(0x7859d5e6), WORD(0x6967afd6), WORD(0xa5fbf616), WORD(0xcdf1095b),
+	/* 19G */
+	WORD(0x417692ee), WORD(0x37b23549), WORD(0x7a4db977), WORD(0x3fafb8db),
+	WORD(0x5d550c5c), WORD(0xc85fef61), WORD(0xc591dfcc), WORD(0x88f70525),
+	WORD(0xadbba7d1), WORD(0x20d82c9e), WORD(0x3bc105c7), WORD(0x34bdc150),
+	/* 21G */
+	WORD(0xc7b622a0), WORD(0x09a14d89), WORD(0x04ac07cd), WORD(0x719fb611),
+	WORD(0x485b1f75), WORD(0x487f1ad3), WORD(0xf779459c), WORD(0x6604b185),
+	WORD(0x79ffa446), WORD(0x633d924a), WORD(0xe2ed4e42), WORD(0x0a48ac49),
+	/* 23G */
+	WORD(0x8d76bd59), WORD(0x791db75f), WORD(0xa5c667f8), WORD(0x664088fb),
+	WORD(0x5a1f032a), WORD(0x7cc0335c), WORD(0xbf031b03), WORD(0xabb460b3),
+	WORD(0xc8f559b0), WORD(0xcb61b85e), WORD(0xfed307dc), WORD(0x282335ba),
+	/* 25G */
+	WORD(0xbfd973a2), WORD(0x422b5a19), WORD(0x7de885a1), WORD(0xe637c08a),
+	WORD(0x28af843c), WORD(0x493d27a7), WORD(0x27d0f709), WORD(0x0635af16),
+	WORD(0xa46b8241), WORD(0xfaa0731d), WORD(0xde8513de), WORD(0x30152936),
+	/* 27G */
+	WORD(0xdea3626f), WORD(0xeaa0614e), WORD(0x51b201c7), WORD(0xb0778899),
+	WORD(0xbc24cf40), WORD(0xe1e17ccf), WORD(0x6f6a4f09), WORD(0x5b9a2356),
+	WORD(0x81b35be5), WORD(0x6b43dd89), WORD(0x8eb6864b), WORD(0x7134a900),
+	/* 29G */
+	WORD(0x267c3b3b), WORD(0xb550886c), WORD(0x072ada2a), WORD(0xe4ef0b6a),
+	WORD(0x16cf9337), WORD(0xefb23bc9), WORD(0x035d6cdd), WORD(0xf4945a35),
+	WORD(0x24d8682c), WORD(0x7c2fbc75), WORD(0xb35b5932), WORD(0xb4b6f148),
+	/* 31G */
+	WORD(0xc1a83d71), WORD(0xa5549752), WORD(0x07c519da), WORD(0xe9b2c58f),
+	WORD(0x286a27e2), WORD(0x6f5e6aee), WORD(0x7cfc6dd4), WORD(0x99cece8d),
+	WORD(0xbbc24c84), WORD(0x18c9b5f7), WORD(0xd5a88338), WORD(0x7e5875ca),
+	/* 33G */
+	WORD(0x4fbffaeb), WORD(0x41095e96), WORD(0x8b3c6012), WORD(0x422337e2),
+	WORD(0x563eef5d), WORD(0xb731e12b), WORD(0xc07cc789), WORD(0x7e950bdd),
+	WORD(0x9d9cc3aa), WORD(0xf97c2753), WORD(0x5a7f7345), WORD(0x7af21a9a),
+	/* 35G */
+	WORD(0x16036842), WORD(0xb35bcfb0), WORD(0xecedc764), WORD(0x036d725d),
+	WORD(0x2c6f8668), WORD(0xcbcb0161), WORD(0x1b04bc1a), WORD(0x0348f719),
+	WORD(0xe1e99a42), WORD(0x0b2d84f8), WORD(0x9c1ec6e6), WORD(0xf098e97a),
+	/* 37G */
+	WORD(0x2775c0c5), WORD(0x9d83fd01), WORD(0x065da96c), WORD(0x8658cc5a),
+	WORD(0x604210f1), WORD(0x466cf509), WORD(0xe8fc750b), WORD(0xdc4d8237),
+	WORD(0x1477a111), WORD(0xb13663ff), WORD(0x4252c38b), WORD(0x6a0ef58f),
+	/* 39G */
+	WORD(0xcaa33960), WORD(0x49b1bb22), WORD(0xe647c5a4), WORD(0x45871855),
+	WORD(0x167d6801), WORD(0x6d71e970), WORD(0xa2764f1f), WORD(0xbbeae386),
+	WORD(0x1284c39a), WORD(0xc7df73b8), WORD(0xe8a8b423), WORD(0x3ddc63be),
+	/* 41G */
+	WORD(0x6709fe0c), WORD(0xc4bdbeb2), WORD(0x2aa46589), WORD(0x86c2f225),
+	WORD(0x1c6d96c6), WORD(0x6e215f98), WORD(0x1900c952), WORD(0x3b102255),
+	WORD(0x0b476bea), WORD(0x09b6f447), WORD(0x1643c833), WORD(0x88877356),
+	/* 43G */
+	WORD(0x0ee8588b), WORD(0x111d94b7), WORD(0x1cae2230), WORD(0x5f7ba2ed),
+	WORD(0x8b428b68), WORD(0xd1119eb2), WORD(0xc5901d8a), WORD(0x5ac72be9),
+	WORD(0x1a7e213d), WORD(0xd11c39be), WORD(0xae1574db), WORD(0x5eba5216),
+	/* 45G */
+	WORD(0x0d359302), WORD(0xbbb38087), WORD(0x3bf7212f), WORD(0xe0c552b5),
+	WORD(0xce70eda4), WORD(0x6873aa54), WORD(0xf0dcd6fe), WORD(0x42eb0476),
+	WORD(0x202c6fba), WORD(0xe354ae37), WORD(0xbb182481), WORD(0xd2eeb9a4),
+	/* 47G */
+	WORD(0x8959dc53), WORD(0x2e246f36), WORD(0x3f449349), WORD(0xc6882bd2),
+	WORD(0x52d56c22), WORD(0xfbcda062), WORD(0x037c14b7), WORD(0xaf1525bc),
+	WORD(0xf51db774), WORD(0x79f2c364), WORD(0x397c0db5), WORD(0x51d5156e),
+	/* 49G */
+	WORD(0x2d623962), WORD(0x38f56704), WORD(0xb8e018b4), WORD(0x1d5927f2),
+	WORD(0xb7159417), WORD(0x60f41495), WORD(0xe71a9c08), WORD(0xa531058e),
+	WORD(0xc4427fd5), WORD(0x038edfcf), WORD(0x16bcd9b9), WORD(0xf40f0c3f),
+	/* 51G */
+	WORD(0x218251e9), WORD(0xbc40bae0), WORD(0xff92ffab), WORD(0x86a6f175),
+	WORD(0x15c92a68), WORD(0xc538fbe8), WORD(0xce8e05fa), WORD(0x94b037e5),
+	WORD(0x38df007b), WORD(0x1e23b8c7), WORD(0x6dfc21b0), WORD(0xcf60919b),
+	/* 53G */
+	WORD(0x07b07222), WORD(0x6c66ac7c), WORD(0xabbb5a7e), WORD(0x7a2251bf),
+	WORD(0xea506766), WORD(0x6898eec1), WORD(0x0c8100c3), WORD(0x8ee773e9),
+	WORD(0xb5ac1e10), WORD(0xe267812a), WORD(0x45ea2616), WORD(0x51d3e17e),
+	/* 55G */
+	WORD(0xab0c2496), WORD(0xe0cad6d0), WORD(0x3e58a13e), WORD(0xad9d4a4b),
+	WORD(0xcb2f20c6), WORD(0xb4009b9f), WORD(0xfbd04c92), WORD(0xf586adaa),
+	WORD(0x65e4a2c2), WORD(0x27f06af1), WORD(0xe6ac820a), WORD(0x5efc658f),
+	/* 57G */
+	WORD(0x45111281), WORD(0xd072005c), WORD(0xc6dd923a), WORD(0xc38687f7),
+	WORD(0xe7e55c30), WORD(0xc5493c3b), WORD(0x1e7bcaf3), WORD(0xc801a0dd),
+	WORD(0x66af003d), WORD(0x7d896378), WORD(0x5c5fc040), WORD(0x88c92d2e),
+	/* 59G */
+	WORD(0x489578d4), WORD(0x752de436), WORD(0x6c0f251c), WORD(0x0ade8b1c),
+	WORD(0x59ad5609), WORD(0x29b34ffc), WORD(0x857c870b), WORD(0xd4af9bf6),
+	WORD(0xe6b0527e), WORD(0xb779fab3), WORD(0x70ef261f), WORD(0x20970dfe),
+	/* 61G */
+	WORD(0x14729183), WORD(0x4af80891), WORD(0x2650cc8e), WORD(0x44458190),
+	WORD(0x587ad69a), WORD(0x738c0bd4), WORD(0xefc4b5e7), WORD(0xdab8713a),
+	WORD(0x902363c0), WORD(0x7d6d6ae3), WORD(0x45acff6b), WORD(0xad593898),
+	/* 63G */
+	WORD(0xa5542c7d), WORD(0xcc1674d5), WORD(0x1fb770dd), WORD(0xc8ebdbdd),
+	WORD(0x0a3b16ce), WORD(0x7d70a1ed), WORD(0x685db534), WORD(0xa74f8148),
+	WORD(0x37c0b157), WORD(0xa0eab0ad), WORD(0xa3971e22), WORD(0xcd8063a7),
+};
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+static const word_t secp192r1_gen_wnaf[] = {
+	/* G */
+	WORD(0xa108), WORD(0x332f), WORD(0xb30c), WORD(0x0d8c), WORD(0x2909), WORD(0x76d1),
+	WORD(0xd3f7), WORD(0x8a4b), WORD(0x18f7), WORD(0xf3d2), WORD(0xc8f9), WORD(0x954c),
+	WORD(0x2289), WORD(0x1e42), WORD(0xa337), WORD(0x7b12), WORD(0xf05e), WORD(0x8966),
+	WORD(0xb524), WORD(0xde22), WORD(0xa84d), WORD(0x6aed), WORD(0x3d83), WORD(0x6a29),
+	/* 3G */
+	WORD(0x0249), WORD(0x230c), WORD(0xfd7f), WORD(0x56b3), WORD(0xbbf4), WORD(0x42be),
+	WORD(0x809f), WORD(0x3386), WORD(0x581a), WORD(0x770c), WORD(0xad45), WORD(0x53b5),
+	WORD(0x4b1e), WORD(0x7fb7), WORD(0x7b49), WORD(0x6be1), WORD(0x1fbd), WORD(0x50d9),
+	WORD(0x5c48), WORD(0x1644), WORD(0x19c0), WORD(0x43dc), WORD(0x18e2), WORD(0x228f),
+	/* 5G */
+	WORD(0x90a8), WORD(0x1d84), WORD(0xa784), WORD(0x69bc), WORD(0xa6ad), WORD(0x4d92),
+	WORD(0x3520), WORD(0xa7c4), WORD(0xb11d), WORD(0x7012), WORD(0x1c34), WORD(0x4ec3),
+	WORD(0x401c), WORD(0x843e), WORD(0x825c), WORD(0x6261), WORD(0xa2da), WORD(0x6a65),
+	WORD(0x7a93), WORD(0x102b), WORD(0xf43a), WORD(0x2d96), WORD(0x083f), WORD(0xdf00),
+	/* 7G */
+	WORD(0xca73), WORD(0xe5ef), WORD(0xd91f), WORD(0xeb8a), WORD(0xb841), WORD(0x1650),
+	WORD(0xfc44), WORD(0x4c83), WORD(0xbb45), WORD(0xa63e), WORD(0x7d43), WORD(0xeea0),
+	WORD(0xb309), WORD(0xcc6a), WORD(0x62c8), WORD(0x2c82), WORD(0x7327), WORD(0xca1e),
+	WORD(0x7081), WORD(0x44a6), WORD(0x7372), WORD(0x6614), WORD(0x6d88), WORD(0x6fef),
+	/* 9G */
+	WORD(0xe446), WORD(0x449c), WORD(0x848b), WORD(0x9f27), WORD(0x60e4), WORD(0xed6f),
+	WORD(0x13b6), WORD(0xedc6), WORD(0x2855), WORD(0x33ef), WORD(0xdc5c), WORD(0xd028),
+	WORD(0x6f06), WORD(0x9756), WORD(0xfe7f), WORD(0x32bb), WORD(0xebe5), WORD(0x529b),
+	WORD(0x2dfc), WORD(0xaee5), WORD(0x04ac), WORD(0xdbd3), WORD(0xd9da), WORD(0x7dfa),
+	/* 11G */
+	WORD(0xd4f9), WORD(0xf19e), WORD(0x99cc), WORD(0x44a2), WORD(0x8b4b), WORD(0x3ec1),
+	WORD(0x90e3), WORD(0x5ce7), WORD(0xe8a1), WORD(0x3898), WORD(0x50ac), WORD(0x34de),
+	WORD(0x8777), WORD(0x5294), WORD(0x1e2f), WORD(0xa264), WORD(0xff35), WORD(0x538e),
+	WORD(0x7393), WORD(0xa503), WORD(0x6331), WORD(0x38e4), WORD(0xbb32), WORD(0xf1b6),
+	/* 13G */
+	WORD(0x04a9), WORD(0x0f89), WORD(0x3b78), WORD(0x153f), WORD(0x5349), WORD(0x14a7),
+	WORD(0xbd96), WORD(0x44a7), WORD(0x4a3f), WORD(0xd85d), WORD(0x735f), WORD(0x4093),
+	WORD(0xb015), WORD(0x3f7d), WORD(0x5ed0), WORD(0xed1d), WORD(0x90b3), WORD(0x1fff),
+	WORD(0x75f7), WORD(0x1749), WORD(0x7496), WORD(0xdcd4), WORD(0xd562), WORD(0x9838),
+	/* 15G */
+	WORD(0x681b), WORD(0xb0cf), WORD(0xe084), WORD(0xc373), WORD(0xb602), WORD(0x6610),
+	WORD(0x2737), WORD(0x7da9), WORD(0x041b), WORD(0xf098), WORD(0xdc98), WORD(0x46ca),
+	WORD(0xc872), WORD(0x6cde), WORD(0xadf8), WORD(0xd3e0), WORD(0x2f28), WORD(0xa784),
+	WORD(0x3591), WORD(0x50d4), WORD(0x6778), WORD(0xcdf4), WORD(0xfdc3), WORD(0xa35e),
+	/* 17G */
+	WORD(0x6d4e), WORD(0xe705), WORD(0xa265), WORD(0xcfdb), WORD(0x8e89), WORD(0xa9b9),
+	WORD(0x189c), WORD(0xc9d1), WORD(0x8eff), WORD(0xa4a8), WORD(0xd309), WORD(0x3e1c),
+	WORD(0xec58), WORD(0xd040), WORD(0x29c3), WORD(0x8b24), WORD(0xd5e6), WORD(0x7859),
+	WORD(0xafd6), WORD(0x6967), WORD(0xf616), WORD(0xa5fb), WORD(0x095b), WORD(0xcdf1),
+	/* 19G */
+	WORD(0x92ee), WORD(0x4176), WORD(0x3549), WORD(0x37b2), WORD(0xb977), WORD(0x7a4d),
+	WORD(0xb8db), WORD(0x3faf), WORD(0x0c5c), WORD(0x5d55), WORD(0xef61), WORD(0xc85f),
+	WORD(0xdfcc), WORD(0xc591), WORD(0x0525), WORD(0x88f7), WORD(0xa7d1), WORD(0xadbb),
+	WORD(0x2c9e), WORD(0x20d8), WORD(0x05c7), WORD(0x3bc1), WORD(0xc150), WORD(0x34bd),
+	/* 21G */
+	WORD(0x22a0), WORD(0xc7b6), WORD(0x4d89), WORD(0x09a1), WORD(0x07cd), WORD(0x04ac),
+	WORD(0xb611), WORD(0x719f), WORD(0x1f75), WORD(0x485b), WORD(0x1ad3), WORD(0x487f),
+	WORD(0x459c), WORD(0xf779), WORD(0xb185), WORD(0x6604), WORD(0xa446), WORD(0x79ff),
+	WORD(0x924a), WORD(0x633d), WORD(0x4e42), WORD(0xe2ed), WORD(0xac49), WORD(0x0a48),
+	/* 23G */
+	WORD(0xbd59), WORD(0x8d76), WORD(0xb75f), WORD(0x791d), WORD(0x67f8), WORD(0xa5c6),
+	WORD(0x88fb), WORD(0x6640), WORD(0x032a), WORD(0x5a1f), WORD(0x335c), WORD(0x7cc0),
+	WORD(0x1b03), WORD(0xbf03), WORD(0x60b3), WORD(0xabb4), WORD(0x59b0), WORD(0xc8f5),
+	WORD(0xb85e), WORD(0xcb61), WORD(0x07dc), WORD(0xfed3), WORD(0x35ba), WORD(0x2823),
+	/* 25G */
+	WORD(0x73a2), WORD(0xbfd9), WORD(0x5a19), WORD(0x422b), WORD(0x85a1), WORD(0x7de8),
+	WORD(0xc08a), WORD(0xe637), WORD(0x843c), WORD(0x28af), WORD(0x27a7), WORD(0x493d),
+	WORD(0xf709), WORD(0x27d0), WORD(0xaf16), WORD(0x0635), WORD(0x8241), WORD(0xa46b),
+	WORD(0x731d), WORD(0xfaa0), WORD(0x13de), WORD(0xde85), WORD(0x2936), WORD(0x3015),
+	/* 27G */
+	WORD(0x626f), WORD(0xdea3), WORD(0x614e), WORD(0xeaa0), WORD(0x01c7), WORD(0x51b2),
+	WORD(0x8899), WORD(0xb077), WORD(0xcf40), WORD(0xbc24), WORD(0x7ccf), WORD(0xe1e1),
+	WORD(0x4f09), WORD(0x6f6a), WORD(0x2356), WORD(0x5b9a), WORD(0x5be5), WORD(0x81b3),
+	WORD(0xdd89), WORD(0x6b43), WORD(0x864b), WORD(0x8eb6), WORD(0xa900), WORD(0x7134),
+	/* 29G */
+	WORD(0x3b3b), WORD(0x267c), WORD(0x886c), WORD(0xb550), WORD(0xda2a), WORD(0x072a),
+	WORD(0x0b6a), WORD(0xe4ef), WORD(0x9337), WORD(0x16cf), WORD(0x3bc9), WORD(0xefb2),
+	WORD(0x6cdd), WORD(0x035d), WORD(0x5a35), WORD(0xf494), WORD(0x682c), WORD(0x24d8),
+	WORD(0xbc75), WORD(0x7c2f), WORD(0x5932), WORD(0xb35b), WORD(0xf148), WORD(0xb4b6),
+	/* 31G */
+	WORD(0x3d71), WORD(0xc1a8), WORD(0x9752), WORD(0xa554), WORD(0x19da), WORD(0x07c5),
+	WORD(0xc58f), WORD(0xe9b2), WORD(0x27e2), WORD(0x286a), WORD(0x6aee), WORD(0x6f5e),
+	WORD(0x6dd4), WORD(0x7cfc), WORD(0xce8d), WORD(0x99ce), WORD(0x4c84), WORD(0xbbc2),
+	WORD(0xb5f7), WORD(0x18c9), WORD(0x8338), WORD(0xd5a8), WORD(0x75ca), WORD(0x7e58),
+	/* 33G */
+	WORD(0xfaeb), WORD(0x4fbf), WORD(0x5e96), WORD(0x4109), WORD(0x6012), WORD(0x8b3c),
+	WORD(0x37e2), WORD(0x4223), WORD(0xef5d), WORD(0x563e), WORD(0xe12b), WORD(0xb731),
+	WORD(0xc789), WORD(0xc07c), WORD(0x0bdd), WORD(0x7e95), WORD(0xc3aa), WORD(0x9d9c),
+	WORD(0x2753), WORD(0xf97c), WORD(0x7345), WORD(0x5a7f), WORD(0x1a9a), WORD(0x7af2),
+	/* 35G */
+	WORD(0x6842), WORD(0x1603), WORD(0xcfb0), WORD(0xb35b), WORD(0xc764), WORD(0xeced),
+	WORD(0x725d), WORD(0x036d), WORD(0x8668), WORD(0x2c6f), WORD(0x0161), WORD(0xcbcb),
+	WORD(0xbc1a), WORD(0x1b04), WORD(0xf719), WORD(0x0348), WORD(0x9a42), WORD(0xe1e9),
+	WORD(0x84f8), WORD(0x0b2d), WORD(0xc6e6), WORD(0x9c1e), WORD(0xe97a), WORD(0xf098),
+	/* 37G */
+	WORD(0xc0c5), WORD(0x2775), WORD(0xfd01), WORD(0x9d83), WORD(0xa96c), WORD(0x065d),
+	WORD(0xcc5a), WORD(0x8658), WORD(0x10f1), WORD(0x6042), WORD(0xf509), WORD(0x466c),
+	WORD(0x750b), WORD(0xe8fc), WORD(0x8237), WORD(0xdc4d), WORD(0xa111), WORD(0x1477),
+	WORD(0x63ff), WORD(0xb136), WORD(0xc38b), WORD(0x4252), WORD(0xf58f), WORD(0x6a0e),
+	/* 39G */
+	WORD(0x3960), WORD(0xcaa3), WORD(0xbb22), WORD(0x49b1), WORD(0xc5a4), WORD(0xe647),
+	WORD(0x1855), WORD(0x4587), WORD(0x6801), WORD(0x167d), WORD(0xe970), WORD(0x6d71),
+	WORD(0x4f1f), WORD(0xa276), WORD(0xe386), WORD(0xbbea), WORD(0xc39a), WORD(0x1284),
+	WORD(0x73b8), WORD(0xc7df), WORD(0xb423), WORD(0xe8a8), WORD(0x63be), WORD(0x3ddc),
+	/* 41G */
+	WORD(0xfe0c), WORD(0x6709), WORD(0xbeb2), WORD(0xc4bd), WORD(0x6589), WORD(0x2aa4),
+	WORD(0xf225), WORD(0x86c2), WORD(0x96c6), WORD(0x1c6d), WORD(0x5f98), WORD(0x6e21),
+	WORD(0xc952), WORD(0x1900), WORD(0x2255), WORD(0x3b10), WORD(0x6bea), WORD(0x0b47),
+	WORD(0xf447), WORD(0x09b6), WORD(0xc833), WORD(0x1643), WORD(0x7356), WORD(0x8887),
+	/* 43G */
+	WORD(0x588b), WORD(0x0ee8), WORD(0x94b7), WORD(0x111d), WORD(0x2230), WORD(0x1cae),
+	WORD(0xa2ed), WORD(0x5f7b), WORD(0x8b68), WORD(0x8b42), WORD(0x9eb2), WORD(0xd111),
+	WORD(0x1d8a), WORD(0xc590), WORD(0x2be9), WORD(0x5ac7), WORD(0x213d), WORD(0x1a7e),
+	WORD(0x39be), WORD(0xd11c), WORD(0x74db), WORD(0xae15), WORD(0x5216), WORD(0x5eba),
+	/* 45G */
+	WORD(0x9302), WORD(0x0d35), WORD(0x8087), WORD(0xbbb3), WORD(0x212f), WORD(0x3bf7),
+	WORD(0x52b5), WORD(0xe0c5), WORD(0xeda4), WORD(0xce70), WORD(0xaa54), WORD(0x6873),
+	WORD(0xd6fe), WORD(0xf0dc), WORD(0x0476), WORD(0x42eb), WORD(0x6fba), WORD(0x202c),
+	WORD(0xae37), WORD(0xe354), WORD(0x2481), WORD(0xbb18), WORD(0xb9a4), WORD(0xd2ee),
+	/* 47G */
+	WORD(0xdc53), WORD(0x8959), WORD(0x6f36), WORD(0x2e24), WORD(0x9349), WORD(0x3f44),
+	WORD(0x2bd2), WORD(0xc688), WORD(0x6c22), WORD(0x52d5), WORD(0xa062), WORD(0xfbcd),
+	WORD(0x14b7), WORD(0x037c), WORD(0x25bc), WORD(0xaf15), WORD(0xb774), WORD(0xf51d),
+	WORD(0xc364), WORD(0x79f2), WORD(0x0db5), WORD(0x397c), WORD(0x156e), WORD(0x51d5),
+	/* 49G */
+	WORD(0x3962), WORD(0x2d62), WORD(0x6704), WORD(0x38f5), WORD(0x18b4), WORD(0xb8e0),
+	WORD(0x27f2), WORD(0x1d59), WORD(0x9417), WORD(0xb715), WORD(0x1495), WORD(0x60f4),
+	WORD(0x9c08), WORD(0xe71a), WORD(0x058e), WORD(0xa531), WORD(0x7fd5), WORD(0xc442),
+	WORD(0xdfcf), WORD(0x038e), WORD(0xd9b9), WORD(0x16bc), WORD(0x0c3f), WORD(0xf40f),
+	/* 51G */
+	WORD(0x51e9), WORD(0x2182), WORD(0xbae0), WORD(0xbc40), WORD(0xffab), WORD(0xff92),
+	WORD(0xf175), WORD(0x86a6), WORD(0x2a68), WORD(0x15c9), WORD(0xfbe8), WORD(0xc538),
+	WORD(0x05fa), WORD(0xce8e), WORD(0x37e5), WORD(0x94b0), WORD(0x007b), WORD(0x38df),
+	WORD(0xb8c7), WORD(0x1e23), WORD(0x21b0), WORD(0x6dfc), WORD(0x919b), WORD(0xcf60),
+	/* 53G */
+	WORD(0x7222), WORD(0x07b0), WORD(0xac7c), WORD(0x6c66), WORD(0x5a7e), WORD(0xabbb),
+	WORD(0x51bf), WORD(0x7a22), WORD(0x6766), WORD(0xea50), WORD(0xeec1), WORD(0x6898),
+	WORD(0x00c3), WORD(0x0c81), WORD(0x73e9), WORD(0x8ee7), WORD(0x1e10), WORD(0xb5ac),
+	WORD(0x812a), WORD(0xe267), WORD(0x2616), WORD(0x45ea), WORD(0xe17e), WORD(0x51d3),
+	/* 55G */
+	WORD(0x2496), WORD(0xab0c), WORD(0xd6d0), WORD(0xe0ca), WORD(0xa13e), WORD(0x3e58),
+	WORD(0x4a4b), WORD(0xad9d), WORD(0x20c6), WORD(0xcb2f), WORD(0x9b9f), WORD(0xb400),
+	WORD(0x4c92), WORD(0xfbd0), WORD(0xadaa), WORD(0xf586), WORD(0xa2c2), WORD(0x65e4),
+	WORD(0x6af1), WORD(0x27f0), WORD(0x820a), WORD(0xe6ac), WORD(0x658f), WORD(0x5efc),
+	/* 57G */
+	WORD(0x1281), WORD(0x4511), WORD(0x005c), WORD(0xd072), WORD(0x923a), WORD(0xc6dd),
+	WORD(0x87f7), WORD(0xc386), WORD(0x5c30), WORD(0xe7e5), WORD(0x3c3b), WORD(0xc549),
+	WORD(0xcaf3), WORD(0x1e7b), WORD(0xa0dd), WORD(0xc801), WORD(0x003d), WORD(0x66af),
+	WORD(0x6378), WORD(0x7d89), WORD(0xc040), WORD(0x5c5f), WORD(0x2d2e), WORD(0x88c9),
+	/* 59G */
+	WORD(0x78d4), WORD(0x4895), WORD(0xe436), WORD(0x752d), WORD(0x251c), WORD(0x6c0f),
+	WORD(0x8b1c), WORD(0x0ade), WORD(0x5609), WORD(0x59ad), WORD(0x4ffc), WORD(0x29b3),
+	WORD(0x870b), WORD(0x857c), WORD(0x9bf6), WORD(0xd4af), WORD(0x527e), WORD(0xe6b0),
+	WORD(0xfab3), WORD(0xb779), WORD(0x261f), WORD(0x70ef), WORD(0x0dfe), WORD(0x2097),
+	/* 61G */
+	WORD(0x9183), WORD(0x1472), WORD(0x0891), WORD(0x4af8), WORD(0xcc8e), WORD(0x2650),
+	WORD(0x8190), WORD(0x4445), WORD(0xd69a), WORD(0x587a), WORD(0x0bd4), WORD(0x738c),
+	WORD(0xb5e7), WORD(0xefc4), WORD(0x713a), WORD(0xdab8), WORD(0x63c0), WORD(0x9023),
+	WORD(0x6ae3), WORD(0x7d6d), WORD(0xff6b), WORD(0x45ac), WORD(0x3898), WORD(0xad59),
+	/* 63G */
+	WORD(0x2c7d), WORD(0xa554), WORD(0x74d5), WORD(0xcc16), WORD(0x70dd), WORD(0x1fb7),
+	WORD(0xdbdd), WORD(0xc8eb), WORD(0x16ce), WORD(0x0a3b), WORD(0xa1ed), WORD(0x7d70),
+	WORD(0xb534), WORD(0x685d), WORD(0x8148), WORD(0xa74f), WORD(0xb157), WORD(0x37c0),
+	WORD(0xb0ad), WORD(0xa0ea), WORD(0x1e22), WORD(0xa397), WORD(0x63a7), WORD(0xcd80),
+};
+#else                     /* unknown word size */
+#error "Unsupported word size"
+#endif
+TO_EC_GEN_TABLE_PARAM(secp192r1_gen_wnaf, 7);
+
+/*
+ * Signed comb of the generator for the fixed base multiplications (6
+ * teeth, spacing 32), affine x and y in Montgomery representation
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+static const word_t secp192r1_gen_comb[] = {
+	/* T[0] */
+	WORD(0xfd68812f05f8b8ea), WORD(0x80e61c2d83dc8951),
+	WORD(0x8e7f47d19ac450be), WORD(0x06cf5e51426a4eba),
+	WORD(0xcb26c8ee8f29c779), WORD(0x74d7e2c0ddd6b3d3),
+	/* T[1] */
+	WORD(0x024d63fdddfe415e), WORD(0xbdac567e7f0cea84),
+	WORD(0xc0443ce1dfa4e909), WORD(0xdd13b2a2ebd9ab7a),
+	WORD(0x3997d7154dbfd9b6), WORD(0xc9d6029c4448b731),
+	/* T[2] */
+	WORD(0x2691e29a78656e91), WORD(0xa6deaecbdb85e7c7),
+	WORD(0xda1aa16a6adca02e), WORD(0xbfb8b978461863cd),
+	WORD(0x945ea0cef3553b39), WORD(0xa03ff18a94e7585c),
+	/* T[3] */
+	WORD(0xf9dec6b4cf641b9f), WORD(0x630986227ef7d9a2),
+	WORD(0xaa7ab924cdca899d), WORD(0x726678b22ea46ed1),
+	WORD(0xec9f497c375cefdc), WORD(0x1728c214f1d2292f),
+	/* T[4] */
+	WORD(0xcffaae8d2cd5e2a8), WORD(0x1abf02db807f9dfe),
+	WORD(0x49ffd3bc78d9063d), WORD(0xc65e60752db1242c),
+	WORD(0xf7546ab5ccefd3f2), WORD(0x2ded5ff0a46b8b34),
+	/* T[5] */
+	WORD(0xdc3f643ed84ce28e), WORD(0x836487496c58a71c),
+	WORD(0x8435bbfe80994eed), WORD(0x62b998bffdb8ce49),
+	WORD(0x0baf19ee363d21a6), WORD(0xfed29ab634f1e653),
+	/* T[6] */
+	WORD(0xa1ade2ffdb05a2b6), WORD(0x0f67ca131eb57ac8),
+	WORD(0x3ef84a9e1980c028), WORD(0xab8ba15288c5c022),
+	WORD(0x5609fc58789ae034), WORD(0xd65022f56eb45295),
+	/* T[7] */
+	WORD(0x62dd6bba209ee074), WORD(0x94ce8c04cbae509b),
+	WORD(0xbbc0b6c944f1adf7), WORD(0xabb515f05671b554),
+	WORD(0x0ce1b43f6969330a), WORD(0xc1925f1771742eb2),
+	/* T[8] */
+	WORD(0x309aefc39d404e6b), WORD(0x539c4f73c86b3a95),
+	WORD(0xfbebf775da5bb35a), WORD(0xc59664e3a4aadd26),
+	WORD(0xa6f3eceaca8899f2), WORD(0xb57ee55baf26b01a),
+	/* T[9] */
+	WORD(0x212c996a0c6439aa), WORD(0xc1844566f622a6a8),
+	WORD(0x8d066c5eff6a93a0), WORD(0xa5fdd872f5f8d06b),
+	WORD(0xe9eac28d774c3ae0), WORD(0xe316c32550293a90),
+	/* T[10] */
+	WORD(0x82d41985976380d9), WORD(0x9d9d67d9f2565719),
+	WORD(0x9c8cd9c959dedacf), WORD(0x6d3ea258d8c46992),
+	WORD(0x3c50749647bf6b27), WORD(0x4b87e353a846be6a),
+	/* T[11] */
+	WORD(0x61398a293c270e5b), WORD(0xaa02d125d1a2a1cd),
+	WORD(0xd71331f8c0a5ea6d), WORD(0x20465ceb69d0ed6f),
+	WORD(0x4ed7a7cda89c9e27), WORD(0xeca6749628078c19),
+	/* T[12] */
+	WORD(0xf961670a665d8d50), WORD(0xd46911e794bf77bc),
+	WORD(0x02da549ac714fb85), WORD(0x3790f93221a2c6ff),
+	WORD(0x393cd4bb34ce24ac), WORD(0xf3b404e74f9d829e),
+	/* T[13] */
+	WORD(0xeb7408ffd6d8348c), WORD(0x9587d94775daf76e),
+	WORD(0x70216201b0ced1df), WORD(0x6f92ebc786f8524c),
+	WORD(0x59aa98a98699ee7f), WORD(0x4263d35ec30a6035),
+	/* T[14] */
+	WORD(0x198a14415b7679a5), WORD(0xfa9c076cbf03cf3c),
+	WORD(0x956166cad59320ba), WORD(0x5003646a510b33aa),
+	WORD(0x4dee1f0e07fe6540), WORD(0xac3ce2d3f2e76d7e),
+	/* T[15] */
+	WORD(0xe4a8f462dc638f13), WORD(0xebadb21f8e2d32b8),
+	WORD(0xcccebfd95781840e), WORD(0x85a4ebc6e82ca51a),
+	WORD(0x41126f53ec474a78), WORD(0x8079f05965ae5734),
+	/* T[16] */
+	WORD(0x818f7884d71feeb6), WORD(0x8545cadb599e684e),
+	WORD(0xecd917f04b60e44c), WORD(0x6d45ad76b2d4177e),
+	WORD(0x909bbb3ca7033222), WORD(0x64ca33c5521dfb03),
+	/* T[17] */
+	WORD(0x76891c338b280cec), WORD(0xdcd8a7fbb7395ce4),
+	WORD(0x3a8edfe19778b5c5), WORD(0x45d82e9f4b6869aa),
+	WORD(0x9e8b78d568766cac), WORD(0x99e081208999cbee),
+	/* T[18] */
+	WORD(0x08268fd15b429cb5), WORD(0x0065c77a61eccdb0),
+	WORD(0xa60d4b0b08dc9538), WORD(0xefaac06c94f341d6),
+	WORD(0x5109e489dc044282), WORD(0x690f3dec2c53f5d9),
+	/* T[19] */
+	WORD(0x1ae03c7f1fb0bead), WORD(0x5b7c0429de17c1bc),
+	WORD(0xe376388759304ed9), WORD(0xc55c75766c29296c),
+	WORD(0x2759f0e7bddee231), WORD(0x6b9c5b7927947669),
+	/* T[20] */
+	WORD(0xdace0e8522d4bcc8), WORD(0xd763da868b67158b),
+	WORD(0x37c5858e80ef40b5), WORD(0xb8af3e06d84f69f5),
+	WORD(0xfb51a86ac0290809), WORD(0xb0a033e112138184),
+	/* T[21] */
+	WORD(0x456672a5a53caf72), WORD(0xe6616650e4e10f36),
+	WORD(0x52bf984d68ea49f3), WORD(0x3c4ce17752c252fc),
+	WORD(0x75f7ff9567406dc0), WORD(0x42d9adb5ca747323),
+	/* T[22] */
+	WORD(0x277e9e0470ad18f1), WORD(0xe9ce79ebf197bdf9),
+	WORD(0xca9aa814943d012a), WORD(0x09c0e123ee902415),
+	WORD(0x963048b79e186e76), WORD(0xdf65acdeed4b39f8),
+	/* T[23] */
+	WORD(0x4e94538e822662ac), WORD(0x6899d0df0eb93aca),
+	WORD(0xe9344d945152293c), WORD(0x07c6fcd8f6661522),
+	WORD(0x1036ce86eb92887c), WORD(0x1a60955d15069aab),
+	/* T[24] */
+	WORD(0x41aacab0e239b59f), WORD(0x1346545a62cda785),
+	WORD(0xa31b3b92e3432bb7), WORD(0x494184fee59df923),
+	WORD(0xa470ff72666ddd6b), WORD(0x095fad0ac988203d),
+	/* T[25] */
+	WORD(0x4aa260814cad93ea), WORD(0x3cdfbf24aa968fbc),
+	WORD(0xdfc3eb9e58443093), WORD(0x2b5cd0e02e1e2312),
+	WORD(0x8a1f57aebf573b19), WORD(0xe4a6c116af890552),
+	/* T[26] */
+	WORD(0xd36cc7e60002ad39), WORD(0x7d2155612b1e523b),
+	WORD(0x2aeba42cc7e02bb0), WORD(0xf0c6051430f188d6),
+	WORD(0xc9a025ed250e5186), WORD(0xc2bd6a0a853a461c),
+	/* T[27] */
+	WORD(0x2ad2bab982525153), WORD(0x57eb63959ebdc78a),
+	WORD(0x8d85a358c4baa9d5), WORD(0xeb2b30266770cdd1),
+	WORD(0xf374cda28c59fb58), WORD(0x09aeca816008b7d4),
+	/* T[28] */
+	WORD(0xc6c70e063658f7e4), WORD(0xe888f1ca2ece2128),
+	WORD(0x17f291d4c6dd5397), WORD(0xd1906b05bd708564),
+	WORD(0xf20d2a075c7d1ce9), WORD(0x1d1dc57d07d1b1d8),
+	/* T[29] */
+	WORD(0x3c1786bd199efc46), WORD(0x153a7249f10d14d8),
+	WORD(0xbd0783b0e5bd1898), WORD(0xb3f9040e9d0afc5b),
+	WORD(0x61171dc0b7aa79c5), WORD(0x1b016e9228434d55),
+	/* T[30] */
+	WORD(0xd8278bc6ec968e53), WORD(0x48ba4a762a0f2ebd),
+	WORD(0x6ce1f98c58ba1566), WORD(0x3138fee819600696),
+	WORD(0xbfa6206c6b0e6412), WORD(0xed61a391846eea05),
+	/* T[31] */
+	WORD(0xd65016252e92d0ba), WORD(0xe13954a781a32c44),
+	WORD(0x8a6be20becfb6302), WORD(0x2d554cb31970c57e),
+	WORD(0x2cdf57c32b6a8ff8), WORD(0x9fa4cbcc59f26c58),
+};
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+static const word_t secp192r1_gen_comb[] = {
+	/* T[0] */
+	WORD(0x05f8b8ea), WORD(0xfd68812f), WORD(0x83dc8951), WORD(0x80e61c2d),
+	WORD(0x9ac450be), WORD(0x8e7f47d1), WORD(0x426a4eba), WORD(0x06cf5e51),
+	WORD(0x8f29c779), WORD(0xcb26c8ee), WORD(0xddd6b3d3), WORD(0x74d7e2c0),
+	/* T[1] */
+	WORD(0xddfe415e), WORD(0x024d63fd), WORD(0x7f0cea84), WORD(0xbdac567e),
+	WORD(0xdfa4e909), WORD(0xc0443ce1), WORD(0xebd9ab7a), WORD(0xdd13b2a2),
+	WORD(0x4dbfd9b6), WORD(0x3997d715), WORD(0x4448b731), WORD(0xc9d6029c),
+	/* T[2] */
+	WORD(0x78656e91), WORD(0x2691e29a), WORD(0xdb85e7c7), WORD(0xa6deaecb),
+	WORD(0x6adca02e), WORD(0xda1aa16a), WORD(0x461863cd), WORD(0xbfb8b978),
+	WORD(0xf3553b39), WORD(0x945ea0ce), WORD(0x94e7585c), WORD(0xa03ff18a),
+	/* T[3] */
+	WORD(0xcf641b9f), WORD(0xf9dec6b4), WORD(0x7ef7d9a2), WORD(0x63098622),
+	WORD(0xcdca899d), WORD(0xaa7ab924), WORD(0x2ea46ed1), WORD(0x726678b2),
+	WORD(0x375cefdc), WORD(0xec9f497c), WORD(0xf1d2292f), WORD(0x1728c214),
+	/* T[4] */
+	WORD(0x2cd5e2a8), WORD(0xcffaae8d), WORD(0x807f9dfe), WORD(0x1abf02db),
+	WORD(0x78d9063d), WORD(0x49ffd3bc), WORD(0x2db1242c), WORD(0xc65e6075),
+	WORD(0xccefd3f2), WORD(0xf7546ab5), WORD(0xa46b8b34), WORD(0x2ded5ff0),
+	/* T[5] */
+	WORD(0xd84ce28e), WORD(0xdc3f643e), WORD(0x6c58a71c), WORD(0x83648749),
+	WORD(0x80994eed), WORD(0x8435bbfe), WORD(0xfdb8ce49), WORD(0x62b998bf),
+	WORD(0x363d21a6), WORD(0x0baf19ee), WORD(0x34f1e653), WORD(0xfed29ab6),
+	/* T[6] */
+	WORD(0xdb05a2b6), WORD(0xa1ade2ff), WORD(0x1eb57ac8), WORD(0x0f67ca13),
+	WORD(0x1980c028), WORD(0x3ef84a9e), WORD(0x88c5c022), WORD(0xab8ba152),
+	WORD(0x789ae034), WORD(0x5609fc58), WORD(0x6eb45295), WORD(0xd65022f5),
+	/* T[7] */
+	WORD(0x209ee074), WORD(0x62dd6bba), WORD(0xcbae509b), WORD(0x94ce8c04),
+	WORD(0x44f1adf7), WORD(0xbbc0b6c9), WORD(0x5671b554), WORD(0xabb515f0),
+	WORD(0x6969330a), WORD(0x0ce1b43f), WORD(0x71742eb2), WORD(0xc1925f17),
+	/* T[8] */
+	WORD(0x9d404e6b), WORD(0x309aefc3), WORD(0xc86b3a95), WORD(0x539c4f73),
+	WORD(0xda5bb35a), WORD(0xfbebf775), WORD(0xa4aadd26), WORD(0xc59664e3),
+	WORD(0xca8899f2), WORD(0xa6f3ecea), WORD(0xaf26b01a), WORD(0xb57ee55b),
+	/* T[9] */
+	WORD(0x0c6439aa), WORD(0x212c996a), WORD(0xf622a6a8), WORD(0xc1844566),
+	WORD(0xff6a93a0), WORD(0x8d066c5e), WORD(0xf5f8d06b), WORD(0xa5fdd872),
+	WORD(0x774c3ae0), WORD(0xe9eac28d), WORD(0x50293a90), WORD(0xe316c325),
+	/* T[10] */
+	WORD(0x976380d9), WORD(0x82d41985), WORD(0xf2565719), WORD(0x9d9d67d9),
+	WORD(0x59dedacf), WORD(0x9c8cd9c9), WORD(0xd8c46992), WORD(0x6d3ea258),
+	WORD(0x47bf6b27), WORD(0x3c507496), WORD(0xa846be6a), WORD(0x4b87e353),
+	/* T[11] */
+	WORD(0x3c270e5b), WORD(0x61398a29), WORD(0xd1a2a1cd), WORD(0xaa02d125),
+	WORD(0xc0a5ea6d), WORD(0xd71331f8), WORD(0x69d0ed6f), WORD(0x20465ceb),
+	WORD(0xa89c9e27), WORD(0x4ed7a7cd), WORD(0x28078c19), WORD(0xeca67496),
+	/* T[12] */
+	WORD(0x665d8d50), WORD(0xf961670a), WORD(0x94bf77bc), WORD(0xd46911e7),
+	WORD(0xc714fb85), WORD(0x02da549a), WORD(0x21a2c6ff), WORD(0x3790f932),
+	WORD(0x34ce24ac), WORD(0x393cd4bb), WORD(0x4f9d829e), WORD(0xf3b404e7),
+	/* T[13] */
+	WORD(0xd6d8348c), WORD(0xeb7408ff), WORD(0x75daf76e), WORD(0x9587d947),
+	WORD(0xb0ced1df), WORD(0x70216201), WORD(0x86f8524c), WORD(0x6f92ebc7),
+	WORD(0x8699ee7f), WORD(0x59aa98a9), WORD(0xc30a6035), WORD(0x4263d35e),
+	/* T[14] */
+	WORD(0x5b7679a5), WORD(0x198a1441), WORD(0xbf03cf3c), WORD(0xfa9c076c),
+	WORD(0xd59320ba), WORD(0x956166ca), WORD(0x510b33aa), WORD(0x5003646a),
+	WORD(0x07fe6540), WORD(0x4dee1f0e), WORD(0xf2e76d7e), WORD(0xac3ce2d3),
+	/* T[15] */
+	WORD(0xdc638f13), WORD(0xe4a8f462), WORD(0x8e2d32b8), WORD(0xebadb21f),
+	WORD(0x5781840e), WORD(0xcccebfd9), WORD(0xe82ca51a), WORD(0x85a4ebc6),
+	WORD(0xec474a78), WORD(0x41126f53), WORD(0x65ae5734), WORD(0x8079f059),
+	/* T[16] */
+	WORD(0xd71feeb6), WORD(0x818f7884), WORD(0x599e684e), WORD(0x8545cadb),
+	WORD(0x4b60e44c), WORD(0xecd917f0), WORD(0xb2d4177e), WORD(0x6d45ad76),
+	WORD(0xa7033222), WORD(0x909bbb3c), WORD(0x521dfb03), WORD(0x64ca33c5),
+	/* T[17] */
+	WORD(0x8b280cec), WORD(0x76891c33), WORD(0xb7395ce4), WORD(0xdcd8a7fb),
+	WORD(0x9778b5c5), WORD(0x3a8edfe1), WORD(0x4b6869aa), WORD(0x45d82e9f),
+	WORD(0x68766cac), WORD(0x9e8b78d5), WORD(0x8999cbee), WORD(0x99e08120),
+	/* T[18] */
+	WORD(0x5b429cb5), WORD(0x08268fd1), WORD(0x61eccdb0), WORD(0x0065c77a),
+	WORD(0x08dc9538), WORD(0xa60d4b0b), WORD(0x94f341d6), WORD(0xefaac06c),
+	WORD(0xdc044282), WORD(0x5109e489), WORD(0x2c53f5d9), WORD(0x690f3dec),
+	/* T[19] */
+	WORD(0x1fb0bead), WORD(0x1ae03c7f), WORD(0xde17c1bc), WORD(0x5b7c0429),
+	WORD(0x59304ed9), WORD(0xe3763887), WORD(0x6c29296c), WORD(0xc55c7576),
+	WORD(0xbddee231), WORD(0x2759f0e7), WORD(0x27947669), WORD(0x6b9c5b79),
+	/* T[20] */
+	WORD(0x22d4bcc8), WORD(0xdace0e85), WORD(0x8b67158b), WORD(0xd763da86),
+	WORD(0x80ef40b5), WORD(0x37c5858e), WORD(0xd84f69f5), WORD(0xb8af3e06),
+	WORD(0xc0290809), WORD(0xfb51a86a), WORD(0x12138184), WORD(0xb0a033e1),
+	/* T[21] */
+	WORD(0xa53caf72), WORD(0x456672a5), WORD(0xe4e10f36), WORD(0xe6616650),
+	WORD(0x68ea49f3), WORD(0x52bf984d), WORD(0x52c252fc), WORD(0x3c4ce177),
+	WORD(0x67406dc0), WORD(0x75f7ff95), WORD(0xca747323), WORD(0x42d9adb5),
+	/* T[22] */
+	WORD(0x70ad18f1), WORD(0x277e9e04), WORD(0xf197bdf9), WORD(0xe9ce79eb),
+	WORD(0x943d012a), WORD(0xca9aa814), WORD(0xee902415), WORD(0x09c0e123),
+	WORD(0x9e186e76), WORD(0x963048b7), WORD(0xed4b39f8), WORD(0xdf65acde),
+	/* T[23] */
+	WORD(0x822662ac), WORD(0x4e94538e), WORD(0x0eb93aca), WORD(0x6899d0df),
+	WORD(0x5152293c), WORD(0xe9344d94), WORD(0xf6661522), WORD(0x07c6fcd8),
+	WORD(0xeb92887c), WORD(0x1036ce86), WORD(0x15069aab), WORD(0x1a60955d),
+	/* T[24] */
+	WORD(0xe239b59f), WORD(0x41aacab0), WORD(0x62cda785), WORD(0x1346545a),
+	WORD(0xe3432bb7), WORD(0xa31b3b92), WORD(0xe59df923), WORD(0x494184fe),
+	WORD(0x666ddd6b), WORD(0xa470ff72), WORD(0xc988203d), WORD(0x095fad0a),
+	/* T[25] */
+	WORD(0x4cad93ea), WORD(0x4aa26081), WORD(0xaa968fbc), WORD(0x3cdfbf24),
+	WORD(0x58443093), WORD(0xdfc3eb9e), WORD(0x2e1e2312), WORD(0x2b5cd0e0),
+	WORD(0xbf573b19), WORD(0x8a1f57ae), WORD(0xaf890552), WORD(0xe4a6c116),
+	/* T[26] */
+	WORD(0x0002ad39), WORD(0xd36cc7e6), WORD(0x2b1e523b), WORD(0x7d215561),
+	WORD(0xc7e02bb0), WORD(0x2aeba42c), WORD(0x30f188d6), WORD(0xf0c60514),
+	WORD(0x250e5186), WORD(0xc9a025ed), WORD(0x853a461c), WORD(0xc2bd6a0a),
+	/* T[27] */
+	WORD(0x82525153), WORD(0x2ad2bab9), WORD(0x9ebdc78a), WORD(0x57eb6395),
+	WORD(0xc4baa9d5), WORD(0x8d85a358), WORD(0x6770cdd1), WORD(0xeb2b3026),
+	WORD(0x8c59fb58), WORD(0xf374cda2), WORD(0x6008b7d4), WORD(0x09aeca81),
+	/* T[28] */
+	WORD(0x3658f7e4), WORD(0xc6c70e06), WORD(0x2ece2128), WORD(0xe888f1ca),
+	WORD(0xc6dd5397), WORD(0x17f291d4), WORD(0xbd708564), WORD(0xd1906b05),
+	WORD(0x5c7d1ce9), WORD(0xf20d2a07), WORD(0x07d1b1d8), WORD(0x1d1dc57d),
+	/* T[29] */
+	WORD(0x199efc46), WORD(0x3c1786bd), WORD(0xf10d14d8), WORD(0x153a7249),
+	WORD(0xe5bd1898), WORD(0xbd0783b0), WORD(0x9d0afc5b), WORD(0xb3f9040e),
+	WORD(0xb7aa79c5), WORD(0x61171dc0), WORD(0x28434d55), WORD(0x1b016e92),
+	/* T[30] */
+	WORD(0xec968e53), WORD(0xd8278bc6), WORD(0x2a0f2ebd), WORD(0x48ba4a76),
+	WORD(0x58ba1566), WORD(0x6ce1f98c), WORD(0x19600696), WORD(0x3138fee8),
+	WORD(0x6b0e6412), WORD(0xbfa6206c), WORD(0x846eea05), WORD(0xed61a391),
+	/* T[31] */
+	WORD(0x2e92d0ba), WORD(0xd6501625), WORD(0x81a32c44), WORD(0xe13954a7),
+	WORD(0xecfb6302), WORD(0x8a6be20b), WORD(0x1970c57e), WORD(0x2d554cb3),
+	WORD(0x2b6a8ff8), WORD(0x2cdf57c3), WORD(0x59f26c58), WORD(0x9fa4cbcc),
+};
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+static const word_t secp192r1_gen_comb[] = {
+	/* T[0] */
+	WORD(0xb8ea), WORD(0x05f8), WORD(0x812f), WORD(0xfd68), WORD(0x8951), WORD(0x83dc),
+	WORD(0x1c2d), WORD(0x80e6), WORD(0x50be), WORD(0x9ac4), WORD(0x47d1), WORD(0x8e7f),
+	WORD(0x4eba), WORD(0x426a), WORD(0x5e51), WORD(0x06cf), WORD(0xc779), WORD(0x8f29),
+	WORD(0xc8ee), WORD(0xcb26), WORD(0xb3d3), WORD(0xddd6), WORD(0xe2c0), WORD(0x74d7),
+	/* T[1] */
+	WORD(0x415e), WORD(0xddfe), WORD(0x63fd), WORD(0x024d), WORD(0xea84), WORD(0x7f0c),
+	WORD(0x567e), WORD(0xbdac), WORD(0xe909), WORD(0xdfa4), WORD(0x3ce1), WORD(0xc044),
+	WORD(0xab7a), WORD(0xebd9), WORD(0xb2a2), WORD(0xdd13), WORD(0xd9b6), WORD(0x4dbf),
+	WORD(0xd715), WORD(0x3997), WORD(0xb731), WORD(0x4448), WORD(0x029c), WORD(0xc9d6),
+	/* T[2] */
+	WORD(0x6e91), WORD(0x7865), WORD(0xe29a), WORD(0x2691), WORD(0xe7c7), WORD(0xdb85),
+	WORD(0xaecb), WORD(0xa6de), WORD(0xa02e), WORD(0x6adc), WORD(0xa16a), WORD(0xda1a),
+	WORD(0x63cd), WORD(0x4618), WORD(0xb978), WORD(0xbfb8), WORD(0x3b39), WORD(0xf355),
+	WORD(0xa0ce), WORD(0x945e), WORD(0x585c), WORD(0x94e7), WORD(0xf18a), WORD(0xa03f),
+	/* T[3] */
+	WORD(0x1b9f), WORD(0xcf64), WORD(0xc6b4), WORD(0xf9de), WORD(0xd9a2), WORD(0x7ef7),
+	WORD(0x8622), WORD(0x6309), WORD(0x899d), WORD(0xcdca), WORD(0xb924), WORD(0xaa7a),
+	WORD(0x6ed1), WORD(0x2ea4), WORD(0x78b2), WORD(0x7266), WORD(0xefdc), WORD(0x375c),
+	WORD(0x497c), WORD(0xec9f), WORD(0x292f), WORD(0xf1d2), WORD(0xc214), WORD(0x1728),
+	/* T[4] */
+	WORD(0xe2a8), WORD(0x2cd5), WORD(0xae8d), WORD(0xcffa), WORD(0x9dfe), WORD(0x807f),
+	WORD(0x02db), WORD(0x1abf), WORD(0x063d), WORD(0x78d9), WORD(0xd3bc), WORD(0x49ff),
+	WORD(0x242c), WORD(0x2db1), WORD(0x6075), WORD(0xc65e), WORD(0xd3f2), WORD(0xccef),
+	WORD(0x6ab5), WORD(0xf754), WORD(0x8b34), WORD(0xa46b), WORD(0x5ff0), WORD(0x2ded),
+	/* T[5] */
+	WORD(0xe28e), WORD(0xd84c), WORD(0x643e), WORD(0xdc3f), WORD(0xa71c), WORD(0x6c58),
+	WORD(0x8749), WORD(0x8364), WORD(0x4eed), WORD(0x8099), WORD(0xbbfe), WORD(0x8435),
+	WORD(0xce49), WORD(0xfdb8), WORD(0x98bf), WORD(0x62b9), WORD(0x21a6), WORD(0x363d),
+	WORD(0x19ee), WORD(0x0baf), WORD(0xe653), WORD(0x34f1), WORD(0x9ab6), WORD(0xfed2),
+	/* T[6] */
+	WORD(0xa2b6), WORD(0xdb05), WORD(0xe2ff), WORD(0xa1ad), WORD(0x7ac8), WORD(0x1eb5),
+	WORD(0xca13), WORD(0x0f67), WORD(0xc028), WORD(0x1980), WORD(0x4a9e), WORD(0x3ef8),
+	WORD(0xc022), WORD(0x88c5), WORD(0xa152), WORD(0xab8b), WORD(0xe034), WORD(0x789a),
+	WORD(0xfc58), WORD(0x5609), WORD(0x5295), WORD(0x6eb4), WORD(0x22f5), WORD(0xd650),
+	/* T[7] */
+	WORD(0xe074), WORD(0x209e), WORD(0x6bba), WORD(0x62dd), WORD(0x509b), WORD(0xcbae),
+	WORD(0x8c04), WORD(0x94ce), WORD(0xadf7), WORD(0x44f1), WORD(0xb6c9), WORD(0xbbc0),
+	WORD(0xb554), WORD(0x5671), WORD(0x15f0), WORD(0xabb5), WORD(0x330a), WORD(0x6969),
+	WORD(0xb43f), WORD(0x0ce1), WORD(0x2eb2), WORD(0x7174), WORD(0x5f17), WORD(0xc192),
+	/* T[8] */
+	WORD(0x4e6b), WORD(0x9d40), WORD(0xefc3), WORD(0x309a), WORD(0x3a95), WORD(0xc86b),
+	WORD(0x4f73), WORD(0x539c), WORD(0xb35a), WORD(0xda5b), WORD(0xf775), WORD(0xfbeb),
+	WORD(0xdd26), WORD(0xa4aa), WORD(0x64e3), WORD(0xc596), WORD(0x99f2), WORD(0xca88),
+	WORD(0xecea), WORD(0xa6f3), WORD(0xb01a), WORD(0xaf26), WORD(0xe55b), WORD(0xb57e),
+	/* T[9] */
+	WORD(0x39aa), WORD(0x0c64), WORD(0x996a), WORD(0x212c), WORD(0xa6a8), WORD(0xf622),
+	WORD(0x4566), WORD(0xc184), WORD(0x93a0), WORD(0xff6a), WORD(0x6c5e), WORD(0x8d06),
+	WORD(0xd06b), WORD(0xf5f8), WORD(0xd872), WORD(0xa5fd), WORD(0x3ae0), WORD(0x774c),
+	WORD(0xc28d), WORD(0xe9ea), WORD(0x3a90), WORD(0x5029), WORD(0xc325), WORD(0xe316),
+	/* T[10] */
+	WORD(0x80d9), WORD(0x9763), WORD(0x1985), WORD(0x82d4), WORD(0x5719), WORD(0xf256),
+	WORD(0x67d9), WORD(0x9d9d), WORD(0xdacf), WORD(0x59de), WORD(0xd9c9), WORD(0x9c8c),
+	WORD(0x6992), WORD(0xd8c4), WORD(0xa258), WORD(0x6d3e), WORD(0x6b27), WORD(0x47bf),
+	WORD(0x7496), WORD(0x3c50), WORD(0xbe6a), WORD(0xa846), WORD(0xe353), WORD(0x4b87),
+	/* T[11] */
+	WORD(0x0e5b), WORD(0x3c27), WORD(0x8a29), WORD(0x6139), WORD(0xa1cd), WORD(0xd1a2),
+	WORD(0xd125), WORD(0xaa02), WORD(0xea6d), WORD(0xc0a5), WORD(0x31f8), WORD(0xd713),
+	WORD(0xed6f), WORD(0x69d0), WORD(0x5ceb), WORD(0x2046), WORD(0x9e27), WORD(0xa89c),
+	WORD(0xa7cd), WORD(0x4ed7), WORD(0x8c19), WORD(0x2807), WORD(0x7496), WORD(0xeca6),
+	/* T[12] */
+	WORD(0x8d50), WORD(0x665d), WORD(0x670a), WORD(0xf961), WORD(0x77bc), WORD(0x94bf),
+	WORD(0x11e7), WORD(0xd469), WORD(0xfb85), WORD(0xc714), WORD(0x549a), WORD(0x02da),
+	WORD(0xc6ff), WORD(0x21a2), WORD(0xf932), WORD(0x3790), WORD(0x24ac), WORD(0x34ce),
+	WORD(0xd4bb), WORD(0x393c), WORD(0x829e), WORD(0x4f9d), WORD(0x04e7), WORD(0xf3b4),
+	/* T[13] */
+	WORD(0x348c), WORD(0xd6d8), WORD(0x08ff), WORD(0xeb74), WORD(0xf76e), WORD(0x75da),
+	WORD(0xd947), WORD(0x9587), WORD(0xd1df), WORD(0xb0ce), WORD(0x6201), WORD(0x7021),
+	WORD(0x524c), WORD(0x86f8), WORD(0xebc7), WORD(0x6f92), WORD(0xee7f), WORD(0x8699),
+	WORD(0x98a9), WORD(0x59aa), WORD(0x6035), WORD(0xc30a), WORD(0xd35e), WORD(0x4263),
+	/* T[14] */
+	WORD(0x79a5), WORD(0x5b76), WORD(0x1441), WORD(0x198a), WORD(0xcf3c), WORD(0xbf03),
+	WORD(0x076c), WORD(0xfa9c), WORD(0x20ba), WORD(0xd593), WORD(0x66ca), WORD(0x9561),
+	WORD(0x33aa), WORD(0x510b), WORD(0x646a), WORD(0x5003), WORD(0x6540), WORD(0x07fe),
+	WORD(0x1f0e), WORD(0x4dee), WORD(0x6d7e), WORD(0xf2e7), WORD(0xe2d3), WORD(0xac3c),
+	/* T[15] */
+	WORD(0x8f13), WORD(0xdc63), WORD(0xf462), WORD(0xe4a8), WORD(0x32b8), WORD(0x8e2d),
+	WORD(0xb21f), WORD(0xebad), WORD(0x840e), WORD(0x5781), WORD(0xbfd9), WORD(0xccce),
+	WORD(0xa51a), WORD(0xe82c), WORD(0xebc6), WORD(0x85a4), WORD(0x4a78), WORD(0xec47),
+	WORD(0x6f53), WORD(0x4112), WORD(0x5734), WORD(0x65ae), WORD(0xf059), WORD(0x8079),
+	/* T[16] */
+	WORD(0xeeb6), WORD(0xd71f), WORD(0x7884), WORD(0x818f), WORD(0x684e), WORD(0x599e),
+	WORD(0xcadb), WORD(0x8545), WORD(0xe44c), WORD(0x4b60), WORD(0x17f0), WORD(0xecd9),
+	WORD(0x177e), WORD(0xb2d4), WORD(0xad76), WORD(0x6d45), WORD(0x3222), WORD(0xa703),
+	WORD(0xbb3c), WORD(0x909b), WORD(0xfb03), WORD(0x521d), WORD(0x33c5), WORD(0x64ca),
+	/* T[17] */
+	WORD(0x0cec), WORD(0x8b28), WORD(0x1c33), WORD(0x7689), WORD(0x5ce4), WORD(0xb739),
+	WORD(0xa7fb), WORD(0xdcd8), WORD(0xb5c5), WORD(0x9778), WORD(0xdfe1), WORD(0x3a8e),
+	WORD(0x69aa), WORD(0x4b68), WORD(0x2e9f), WORD(0x45d8), WORD(0x6cac), WORD(0x6876),
+	WORD(0x78d5), WORD(0x9e8b), WORD(0xcbee), WORD(0x8999), WORD(0x8120), WORD(0x99e0),
+	/* T[18] */
+	WORD(0x9cb5), WORD(0x5b42), WORD(0x8fd1), WORD(0x0826), WORD(0xcdb0), WORD(0x61ec),
+	WORD(0xc77a), WORD(0x0065), WORD(0x9538), WORD(0x08dc), WORD(0x4b0b), WORD(0xa60d),
+	WORD(0x41d6), WORD(0x94f3), WORD(0xc06c), WORD(0xefaa), WORD(0x4282), WORD(0xdc04),
+	WORD(0xe489), WORD(0x5109), WORD(0xf5d9), WORD(0x2c53), WORD(0x3dec), WORD(0x690f),
+	/* T[19] */
+	WORD(0xbead), WORD(0x1fb0), WORD(0x3c7f), WORD(0x1ae0), WORD(0xc1bc), WORD(0xde17),
+	WORD(0x0429), WORD(0x5b7c), WORD(0x4ed9), WORD(0x5930), WORD(0x3887), WORD(0xe376),
+	WORD(0x296c), WORD(0x6c29), WORD(0x7576), WORD(0xc55c), WORD(0xe231), WORD(0xbdde),
+	WORD(0xf0e7), WORD(0x2759), WORD(0x7669), WORD(0x2794), WORD(0x5b79), WORD(0x6b9c),
+	/* T[20] */
+	WORD(0xbcc8), WORD(0x22d4), WORD(0x0e85), WORD(0xdace), WORD(0x158b), WORD(0x8b67),
+	WORD(0xda86), WORD(0xd763), WORD(0x40b5), WORD(0x80ef), WORD(0x858e), WORD(0x37c5),
+	WORD(0x69f5), WORD(0xd84f), WORD(0x3e06), WORD(0xb8af), WORD(0x0809), WORD(0xc029),
+	WORD(0xa86a), WORD(0xfb51), WORD(0x8184), WORD(0x1213), WORD(0x33e1), WORD(0xb0a0),
+	/* T[21] */
+	WORD(0xaf72), WORD(0xa53c), WORD(0x72a5), WORD(0x4566), WORD(0x0f36), WORD(0xe4e1),
+	WORD(0x6650), WORD(0xe661), WORD(0x49f3), WORD(0x68ea), WORD(0x984d), WORD(0x52bf),
+	WORD(0x52fc), WORD(0x52c2), WORD(0xe177), WORD(0x3c4c), WORD(0x6dc0), WORD(0x6740),
+	WORD(0xff95), WORD(0x75f7), WORD(0x7323), WORD(0xca74), WORD(0xadb5), WORD(0x42d9),
+	/* T[22] */
+	WORD(0x18f1), WORD(0x70ad), WORD(0x9e04), WORD(0x277e), WORD(0xbdf9), WORD(0xf197),
+	WORD(0x79eb), WORD(0xe9ce), WORD(0x012a), WORD(0x943d), WORD(0xa814), WORD(0xca9a),
+	WORD(0x2415), WORD(0xee90), WORD(0xe123), WORD(0x09c0), WORD(0x6e76), WORD(0x9e18),
+	WORD(0x48b7), WORD(0x9630), WORD(0x39f8), WORD(0xed4b), WORD(0xacde), WORD(0xdf65),
+	/* T[23] */
+	WORD(0x62ac), WORD(0x8226), WORD(0x538e), WORD(0x4e94), WORD(0x3aca), WORD(0x0eb9),
+	WORD(0xd0df), WORD(0x6899), WORD(0x293c), WORD(0x5152), WORD(0x4d94), WORD(0xe934),
+	WORD(0x1522), WORD(0xf666), WORD(0xfcd8), WORD(0x07c6), WORD(0x887c), WORD(0xeb92),
+	WORD(0xce86), WORD(0x1036), WORD(0x9aab), WORD(0x1506), WORD(0x955d), WORD(0x1a60),
+	/* T[24] */
+	WORD(0xb59f), WORD(0xe239), WORD(0xcab0), WORD(0x41aa), WORD(0xa785), WORD(0x62cd),
+	WORD(0x545a), WORD(0x1346), WORD(0x2bb7), WORD(0xe343), WORD(0x3b92), WORD(0xa31b),
+	WORD(0xf923), WORD(0xe59d), WORD(0x84fe), WORD(0x4941), WORD(0xdd6b), WORD(0x666d),
+	WORD(0xff72), WORD(0xa470), WORD(0x203d), WORD(0xc988), WORD(0xad0a), WORD(0x095f),
+	/* T[25] */
+	WORD(0x93ea), WORD(0x4cad), WORD(0x6081), WORD(0x4aa2), WORD(0x8fbc), WORD(0xaa96),
+	WORD(0xbf24), WORD(0x3cdf), WORD(0x3093), WORD(0x5844), WORD(0xeb9e), WORD(0xdfc3),
+	WORD(0x2312), WORD(0x2e1e), WORD(0xd0e0), WORD(0x2b5c), WORD(0x3b19), WORD(0xbf57),
+	WORD(0x57ae), WORD(0x8a1f), WORD(0x0552), WORD(0xaf89), WORD(0xc116), WORD(0xe4a6),
+	/* T[26] */
+	WORD(0xad39), WORD(0x0002), WORD(0xc7e6), WORD(0xd36c), WORD(0x523b), WORD(0x2b1e),
+	WORD(0x5561), WORD(0x7d21), WORD(0x2bb0), WORD(0xc7e0), WORD(0xa42c), WORD(0x2aeb),
+	WORD(0x88d6), WORD(0x30f1), WORD(0x0514), WORD(0xf0c6), WORD(0x5186), WORD(0x250e),
+	WORD(0x25ed), WORD(0xc9a0), WORD(0x461c), WORD(0x853a), WORD(0x6a0a), WORD(0xc2bd),
+	/* T[27] */
+	WORD(0x5153), WORD(0x8252), WORD(0xbab9), WORD(0x2ad2), WORD(0xc78a), WORD(0x9ebd),
+	WORD(0x6395), WORD(0x57eb), WORD(0xa9d5), WORD(0xc4ba), WORD(0xa358), WORD(0x8d85),
+	WORD(0xcdd1), WORD(0x6770), WORD(0x3026), WORD(0xeb2b), WORD(0xfb58), WORD(0x8c59),
+	WORD(0xcda2), WORD(0xf374), WORD(0xb7d4), WORD(0x6008), WORD(0xca81), WORD(0x09ae),
+	/* T[28] */
+	WORD(0xf7e4), WORD(0x3658), WORD(0x0e06), WORD(0xc6c7), WORD(0x2128), WORD(0x2ece),
+	WORD(0xf1ca), WORD(0xe888), WORD(0x5397), WORD(0xc6dd), WORD(0x91d4), WORD(0x17f2),
+	WORD(0x8564), WORD(0xbd70), WORD(0x6b05), WORD(0xd190), WORD(0x1ce9), WORD(0x5c7d),
+	WORD(0x2a07), WORD(0xf20d), WORD(0xb1d8), WORD(0x07d1), WORD(0xc57d), WORD(0x1d1d),
+	/* T[29] */
+	WORD(0xfc46), WORD(0x199e), WORD(0x86bd), WORD(0x3c17), WORD(0x14d8), WORD(0xf10d),
+	WORD(0x7249), WORD(0x153a), WORD(0x1898), WORD(0xe5bd), WORD(0x83b0), WORD(0xbd07),
+	WORD(0xfc5b), WORD(0x9d0a), WORD(0x040e), WORD(0xb3f9), WORD(0x79c5), WORD(0xb7aa),
+	WORD(0x1dc0), WORD(0x6117), WORD(0x4d55), WORD(0x2843), WORD(0x6e92), WORD(0x1b01),
+	/* T[30] */
+	WORD(0x8e53), WORD(0xec96), WORD(0x8bc6), WORD(0xd827), WORD(0x2ebd), WORD(0x2a0f),
+	WORD(0x4a76), WORD(0x48ba), WORD(0x1566), WORD(0x58ba), WORD(0xf98c), WORD(0x6ce1),
+	WORD(0x0696), WORD(0x1960), WORD(0xfee8), WORD(0x3138), WORD(0x6412), WORD(0x6b0e),
+	WORD(0x206c), WORD(0xbfa6), WORD(0xea05), WORD(0x846e), WORD(0xa391), WORD(0xed61),
+	/* T[31] */
+	WORD(0xd0ba), WORD(0x2e92), WORD(0x1625), WORD(0xd650), WORD(0x2c44), WORD(0x81a3),
+	WORD(0x54a7), WORD(0xe139), WORD(0x6302), WORD(0xecfb), WORD(0xe20b), WORD(0x8a6b),
+	WORD(0xc57e), WORD(0x1970), WORD(0x4cb3), WORD(0x2d55), WORD(0x8ff8), WORD(0x2b6a),
+	WORD(0x57c3), WORD(0x2cdf), WORD(0x6c58), WORD(0x59f2), WORD(0xcbcc), WORD(0x9fa4),
+};
+#else                     /* unknown word size */
+#error "Unsupported word size"
+#endif
+TO_EC_GEN_TABLE_PARAM(secp192r1_gen_comb, 6);
+
 static const ec_str_params secp192r1_str_params = {
 	.p = &secp192r1_p_str_param,
 	.p_bitlen = &secp192r1_p_bitlen_str_param,
@@ -258,6 +1200,11 @@ static const ec_str_params secp192r1_str_params = {
 	.cofactor = &secp192r1_cofactor_str_param,
 	.oid = &secp192r1_oid_str_param,
 	.name = &secp192r1_name_str_param,
+	.p_inv_chain = &secp192r1_p_inv_chain_param,
+	.p_sqrt_chain = &secp192r1_p_sqrt_chain_param,
+	.q_inv_chain = &secp192r1_q_inv_chain_param,
+	.gen_wnaf_table = &secp192r1_gen_wnaf_table_param,
+	.gen_comb_table = &secp192r1_gen_comb_table_param,
 };
 
 /*
@@ -278,6 +1225,17 @@ static const ec_str_params secp192r1_str_params = {
 #define CURVES_MAX_Q_BIT_LEN CURVE_SECP192R1_Q_BITLEN
 #endif
 
+/*
+ * Limb count of p for the fixed limbs field backend (see fp_fixed.h)
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+#define FP_FIXED_WLEN_3_USED
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+#define FP_FIXED_WLEN_6_USED
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+#define FP_FIXED_WLEN_12_USED
+#endif
+
 #endif /* __EC_PARAMS_SECP192R1_H__ */
 
 #endif /* WITH_CURVE_SECP192R1 */
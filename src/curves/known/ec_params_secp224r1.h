@@ -214,6 +214,1126 @@ TO_EC_STR_PARAM(secp224r1_oid);
 static const u8 secp224r1_name[] = "SECP224R1";
 TO_EC_STR_PARAM(secp224r1_name);
 
+/* x^(p - 2): 223 squarings and 14 multiplications */
+static const u8 secp224r1_p_inv[] = {
+	0x10, 0x01, 0x00,
+	0x21, 0x02, 0x01,
+	0x32, 0x04, 0x02,
+	0x43, 0x08, 0x03,
+	0x54, 0x10, 0x04,
+	0x65, 0x20, 0x05,
+	0x76, 0x20, 0x05,
+	0x77, 0x10, 0x04,
+	0x77, 0x08, 0x03,
+	0x77, 0x04, 0x02,
+	0x77, 0x02, 0x01,
+	0x77, 0x01, 0x00,
+	0x77, 0x41, 0x06,
+	0x77, 0x20, 0x05,
+};
+TO_EC_CHAIN_PARAM(secp224r1_p_inv);
+
+/* x^(q - 2): 224 squarings and 35 multiplications */
+static const u8 secp224r1_q_inv[] = {
+	0x10, 0x01, 0x00,
+	0x21, 0x02, 0x01,
+	0x32, 0x04, 0x02,
+	0x43, 0x08, 0x03,
+	0x54, 0x10, 0x04,
+	0x60, 0x01, 0xff,
+	0x71, 0x00, 0x06,
+	0x87, 0x00, 0x06,
+	0x95, 0x20, 0x05,
+	0x99, 0x20, 0x05,
+	0x99, 0x10, 0x04,
+	0x99, 0x06, 0x07,
+	0x99, 0x03, 0x07,
+	0x99, 0x02, 0x00,
+	0x99, 0x06, 0x07,
+	0x99, 0x02, 0x01,
+	0x99, 0x08, 0x07,
+	0x99, 0x02, 0x01,
+	0x99, 0x07, 0x02,
+	0x99, 0x0a, 0x02,
+	0x99, 0x01, 0x00,
+	0x99, 0x05, 0x00,
+	0x99, 0x06, 0x02,
+	0x99, 0x04, 0x08,
+	0x99, 0x02, 0x00,
+	0x99, 0x05, 0x07,
+	0x99, 0x05, 0x07,
+	0x99, 0x06, 0x07,
+	0x99, 0x04, 0x07,
+	0x99, 0x02, 0x01,
+	0x99, 0x06, 0x07,
+	0x99, 0x02, 0x01,
+	0x99, 0x07, 0x07,
+	0x99, 0x02, 0x00,
+	0x99, 0x06, 0x08,
+	0x99, 0x03, 0x01,
+};
+TO_EC_CHAIN_PARAM(secp224r1_q_inv);
+
+/*
+ * Odd multiples G, 3G, ..., 63G of the generator for the wNAF
+ * multiplications (window 7), affine x and y in Montgomery representation
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+static const word_t secp224r1_gen_wnaf[] = {
+	/* G */
+	WORD(0xbc9052266d0a4aea), WORD(0x852597366018bfaa),
+	WORD(0x6dd3af9bf96bec05), WORD(0x00000000a21b5e60),
+	WORD(0x2edca1e5eff3ede8), WORD(0xf8cd672b05335a6b),
+	WORD(0xaea9c5ae03dfe878), WORD(0x00000000614786f1),
+	/* 3G */
+	WORD(0xe37710d786614a9a), WORD(0x24c17ffce0b02223),
+	WORD(0x00505bb6c3cf1c5b), WORD(0x00000000af8b6496),
+	WORD(0x9a73b17373e4e25d), WORD(0x7050163204144e62),
+	WORD(0xafe10c35357940ac), WORD(0x000000006dfa492c),
+	/* 5G */
+	WORD(0x0b10cc50d42fac58), WORD(0xd80cdd0af8dfc283),
+	WORD(0x39211b77975a451e), WORD(0x00000000f7f4fe95),
+	WORD(0x2b552e7364fade9e), WORD(0x5e5610f361a9e695),
+	WORD(0x42b54f7911bcf038), WORD(0x00000000c858da82),
+	/* 7G */
+	WORD(0x90462820899abac2), WORD(0xc6adf68368646e35),
+	WORD(0xc81df8121e2526ba), WORD(0x000000007ed50814),
+	WORD(0x610f21855dd6407c), WORD(0x3f3879aa1fb32889),
+	WORD(0xce5eb25eed8ceeee), WORD(0x000000000e5952e3),
+	/* 9G */
+	WORD(0x1c1ecc777b94d3c7), WORD(0x23767b5f743eda4a),
+	WORD(0x94f5e9ba2f993a50), WORD(0x0000000079d4095a),
+	WORD(0xe07e55b68f776409), WORD(0x2b57fa61909bf3f1),
+	WORD(0xe733d62777e1db6d), WORD(0x000000005114ac9d),
+	/* 11G */
+	WORD(0xac358ca86c6825d9), WORD(0x71f50674e1bdd5ca),
+	WORD(0x0f060758d0dee306), WORD(0x00000000d6d89093),
+	WORD(0x649ea142f1b7227e), WORD(0x87d166a208181c2c),
+	WORD(0xc1182bf06c63713a), WORD(0x0000000045e48d79),
+	/* 13G */
+	WORD(0x489c8db23a1f6a38), WORD(0x4943a5aeffbe563f),
+	WORD(0x68ade63cbc99fb0b), WORD(0x00000000398eacf0),
+	WORD(0x83fdacb5ed549cc4), WORD(0xb6ab4a8b800df824),
+	WORD(0xb4dc6bf8442ed616), WORD(0x000000003f8060b4),
+	/* 15G */
+	WORD(0x55bfd519e977f339), WORD(0x5cd307d1b16ed1af),
+	WORD(0xc5e26f62d91345bb), WORD(0x0000000064a35d22),
+	WORD(0x05015842a243f1ee), WORD(0x6fa10db370203aa0),
+	WORD(0xdaf3972b05a83a63), WORD(0x000000009422f10e),
+	/* 17G */
+	WORD(0x86ade48bf845831a), WORD(0x473e361f79cec3fb),
+	WORD(0x5523244bb9622253), WORD(0x00000000538d543e),
+	WORD(0x12bb38bff8570c03), WORD(0x784e1b25b4e20b8c),
+	WORD(0x2a2e7758e6873448), WORD(0x000000002954321a),
+	/* 19G */
+	WORD(0x716b6add1bfad739), WORD(0x0e68b721ea007122),
+	WORD(0x4e35e1f608a75056), WORD(0x00000000e28f8fa3),
+	WORD(0x7393ad1693c21468), WORD(0x4533e9284e27959e),
+	WORD(0xe5b33144433c708d), WORD(0x000000004c003b64),
+	/* 21G */
+	WORD(0x869c61a18738f5d4), WORD(0xe83f1dc18d8b998b),
+	WORD(0x1f2719895cc8116d), WORD(0x00000000a8992ade),
+	WORD(0xb2334f8e88f6e037), WORD(0x9fcaafe11fadf19a),
+	WORD(0x939bd9ec71d5904e), WORD(0x00000000534ec549),
+	/* 23G */
+	WORD(0x746daf5fd7a234b5), WORD(0x8d13c8a1210782c4),
+	WORD(0x1008fd0f358ace9d), WORD(0x00000000af231c63),
+	WORD(0x17203da0eedf77aa), WORD(0x0974abbe3534d554),
+	WORD(0xf7552ee730962d48), WORD(0x00000000a1ab0080),
+	/* 25G */
+	WORD(0xec729f5b2390b30d), WORD(0x5467eb45347bddd0),
+	WORD(0x79a42c594576657b), WORD(0x000000003a4d5c62),
+	WORD(0x72672c8d871cf39c), WORD(0x22af9ec134edf6de),
+	WORD(0x264b7c52c615c176), WORD(0x000000006b6c91f7),
+	/* 27G */
+	WORD(0xb5862dd8c8d94c12), WORD(0x3488de74fb7f7ec7),
+	WORD(0xf3fb356bf9ca08fd), WORD(0x00000000a3379ec2),
+	WORD(0x5680ab9427d39af3), WORD(0x4aa3a0131f4b780d),
+	WORD(0x9c77acf2181ad0f0), WORD(0x00000000c5ed6c19),
+	/* 29G */
+	WORD(0x3ff1d62069c717f0), WORD(0x975088a3b26ad028),
+	WORD(0xbb9b74533395a449), WORD(0x00000000ac8575b5),
+	WORD(0x19b522940cb11f18), WORD(0x84cd103861b7e04c),
+	WORD(0xb7e04864ea595a3a), WORD(0x00000000f641867a),
+	/* 31G */
+	WORD(0x5d150588382f2331), WORD(0xabac1d436e0c12f8),
+	WORD(0xe25d613acc4b0247), WORD(0x0000000098b62cd3),
+	WORD(0xca8e4ca9c09181c3), WORD(0xae6dcc271f7fb23f),
+	WORD(0x44527d4941da9f53), WORD(0x000000009e1f47c6),
+	/* 33G */
+	WORD(0x724287d605073659), WORD(0x266f173886eb5493),
+	WORD(0x72b46e9e70786420), WORD(0x000000000bd8afe8),
+	WORD(0xeea543b62e7a6b37), WORD(0x1221cd6e7400cd52),
+	WORD(0x9604a54b0a6c2e1c), WORD(0x00000000e2c2c60a),
+	/* 35G */
+	WORD(0x6ef3ab0521a4d862), WORD(0x7fe6fa59fbca1b97),
+	WORD(0x639e011cd8911f8e), WORD(0x00000000b731d607),
+	WORD(0x0706cd08654578a1), WORD(0x5d08a7fc8e5b6703),
+	WORD(0xdc2ea4684d443d17), WORD(0x00000000ccc5dbca),
+	/* 37G */
+	WORD(0x9afdccc14a1a48c2), WORD(0x9befe15bf2645ccf),
+	WORD(0xc06a289b170bc3de), WORD(0x000000008b3174cc),
+	WORD(0xc289c4c5cb55af1c), WORD(0x73ec1671fcbc66cf),
+	WORD(0xfdc7bcecea32e7fb), WORD(0x000000002d89d32d),
+	/* 39G */
+	WORD(0x4821f12515c4b334), WORD(0x3a67886843b3629d),
+	WORD(0xa3b3215133190540), WORD(0x000000004038845d),
+	WORD(0xedfaa06ccf5706d9), WORD(0x08de20a400044014),
+	WORD(0x1a8a108bd5eb20d6), WORD(0x0000000038cb0a6b),
+	/* 41G */
+	WORD(0x231d20c5b60e66c5), WORD(0x89bcc285a36c8848),
+	WORD(0xc4b2c9f8cb7e8b54), WORD(0x000000002f8b6de0),
+	WORD(0xb8860525243f2d3f), WORD(0x945673bffdcf530d),
+	WORD(0xefc627b649da0f6b), WORD(0x000000004e9fb807),
+	/* 43G */
+	WORD(0x687018fcba2c7ded), WORD(0xcc9d7b657c723f5d),
+	WORD(0x938287142221f721), WORD(0x0000000013d720d3),
+	WORD(0xe61c9b05e6d02ad4), WORD(0x72b115dec198db55),
+	WORD(0x621f284ebe38af8f), WORD(0x0000000018f09bf6),
+	/* 45G */
+	WORD(0xa178a33a13e6bef2), WORD(0x7d66c450dd724842),
+	WORD(0x30befc70a5d7a87c), WORD(0x0000000069874db8),
+	WORD(0xcfcdbfce3ef58d85), WORD(0x9fa94e38e3d6346a),
+	WORD(0xde39cef584c65476), WORD(0x00000000e4efb3c1),
+	/* 47G */
+	WORD(0x92f507cd4b30aee1), WORD(0xa95f03729137f80a),
+	WORD(0x2be56c53cb924116), WORD(0x000000000703cdda),
+	WORD(0x0b8faa7fbf64ed3a), WORD(0x9943cbedb73eae3f),
+	WORD(0xdbca2fc4f227ad25), WORD(0x0000000006231927),
+	/* 49G */
+	WORD(0x29e4a335c0aebb53), WORD(0x155e8020600e1a17),
+	WORD(0x556905e7a542f638), WORD(0x00000000c7209080),
+	WORD(0x0b55b0fdf57b447b), WORD(0xc37cde3ea6cf1f95),
+	WORD(0x1acfe8809d44e115), WORD(0x00000000e820af09),
+	/* 51G */
+	WORD(0x24f4b13593d07eac), WORD(0xfc097ef4f0524e07),
+	WORD(0x1770de3d138ee6ed), WORD(0x00000000edc6985e),
+	WORD(0x997ae14f34e15a3c), WORD(0xa168adf0b5a50098),
+	WORD(0xe84702e105ed2b31), WORD(0x000000004701e013),
+	/* 53G */
+	WORD(0xd7b84536009f6ea1), WORD(0x526440936ae52eb4),
+	WORD(0x58155fb24989ea92), WORD(0x0000000051865588),
+	WORD(0xb2f24a3ed29d86e0), WORD(0x6e88be4d4a65a557),
+	WORD(0x39d391fec5c558ab), WORD(0x0000000071637238),
+	/* 55G */
+	WORD(0x7d3144d7835832b0), WORD(0xca5729eeeeb7e587),
+	WORD(0x24b3127963105e87), WORD(0x00000000358ad95d),
+	WORD(0x8b96f12f44854e57), WORD(0x43d92d9ea1f8699a),
+	WORD(0x19da3cf736720d2f), WORD(0x000000000c3e259d),
+	/* 57G */
+	WORD(0x01ae0872a47a47e4), WORD(0x1ffda591f209f351),
+	WORD(0xfd2dee371c3d4f64), WORD(0x0000000023082359),
+	WORD(0x226bc4e492135e7e), WORD(0x68af001cc1dc2c14),
+	WORD(0xd11ebfc04a88888d), WORD(0x000000005bb60dfa),
+	/* 59G */
+	WORD(0x2fefa18a58d7da2d), WORD(0x28fd16890a5f6d1a),
+	WORD(0xe2cc44edaeecb1e4), WORD(0x000000001a3c357a),
+	WORD(0xe129986c0093ad3c), WORD(0x8691e9c278fb4e9b),
+	WORD(0x1f4566926b166a07), WORD(0x0000000055649b1b),
+	/* 61G */
+	WORD(0xffa27852d85db49c), WORD(0xebaf8c054d6d2499),
+	WORD(0x5a3e6570b5248259), WORD(0x00000000b7125d0c),
+	WORD(0x37979bfcf6311485), WORD(0x732a179e785afdfc),
+	WORD(0xe1b6b02f1a4c7732), WORD(0x00000000a84e1866),
+	/* 63G */
+	WORD(0xd6c61ac1ac4962cb), WORD(0xb7765b3a9d056208),
+	WORD(0x566c60a7a70e6aa2), WORD(0x00000000483b996a),
+	WORD(0xa38d32bc05f2cab3), WORD(0x21c5e288c38fefeb),
+	WORD(0x689ae7bd57f15c48), WORD(0x000000003e0d8010),
+};
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+static const word_t secp224r1_gen_wnaf[] = {
+	/* G */
+	WORD(0xbc905227), WORD(0x6018bfaa), WORD(0xf22fe220), WORD(0xf96bec04),
+	WORD(0x6dd3af9b), WORD(0xa21b5e60), WORD(0x92f5b516), WORD(0x2edca1e6),
+	WORD(0x05335a6b), WORD(0xe8c15513), WORD(0x03dfe878), WORD(0xaea9c5ae),
+	WORD(0x614786f1), WORD(0x100c1218),
+	/* 3G */
+	WORD(0xe37710d8), WORD(0xe0b02223), WORD(0xab22ca96), WORD(0xc3cf1c5a),
+	WORD(0x00505bb6), WORD(0xaf8b6496), WORD(0x799eb566), WORD(0x9a73b174),
+	WORD(0x04144e62), WORD(0xe434f88f), WORD(0x357940ab), WORD(0xafe10c35),
+	WORD(0x6dfa492c), WORD(0x8c1b1da3),
+	/* 5G */
+	WORD(0x0b10cc51), WORD(0xf8dfc283), WORD(0xac3c8962), WORD(0x975a451e),
+	WORD(0x39211b77), WORD(0xf7f4fe95), WORD(0x2bd053a8), WORD(0x2b552e74),
+	WORD(0x61a9e695), WORD(0xc350ef91), WORD(0x11bcf037), WORD(0x42b54f79),
+	WORD(0xc858da82), WORD(0x9b052162),
+	/* 7G */
+	WORD(0x90462821), WORD(0x68646e35), WORD(0x5048b145), WORD(0x1e2526ba),
+	WORD(0xc81df812), WORD(0x7ed50814), WORD(0x7665453e), WORD(0x610f2186),
+	WORD(0x1fb32889), WORD(0x9d0eba26), WORD(0xed8ceeed), WORD(0xce5eb25e),
+	WORD(0x0e5952e3), WORD(0xa229bf84),
+	/* 9G */
+	WORD(0x1c1ecc78), WORD(0x743eda4a), WORD(0x9f0b4f26), WORD(0x2f993a4f),
+	WORD(0x94f5e9ba), WORD(0x79d4095a), WORD(0x846b2c39), WORD(0xe07e55b7),
+	WORD(0x909bf3f1), WORD(0xbacf5e6a), WORD(0x77e1db6c), WORD(0xe733d627),
+	WORD(0x5114ac9d), WORD(0x70889bf7),
+	/* 11G */
+	WORD(0xac358ca9), WORD(0xe1bdd5ca), WORD(0xde5d2c4d), WORD(0xd0dee305),
+	WORD(0x0f060758), WORD(0xd6d89093), WORD(0x9397da27), WORD(0x649ea143),
+	WORD(0x08181c2c), WORD(0x79888920), WORD(0x6c63713a), WORD(0xc1182bf0),
+	WORD(0x45e48d79), WORD(0x0e48dd82),
+	/* 13G */
+	WORD(0x489c8db3), WORD(0xffbe563f), WORD(0x83630fe6), WORD(0xbc99fb0a),
+	WORD(0x68ade63c), WORD(0x398eacf0), WORD(0xc5e095c8), WORD(0x83fdacb6),
+	WORD(0x800df824), WORD(0xa3ffe74f), WORD(0x442ed616), WORD(0xb4dc6bf8),
+	WORD(0x3f8060b4), WORD(0x12ab633c),
+	/* 15G */
+	WORD(0x55bfd51a), WORD(0xb16ed1af), WORD(0x464afb0a), WORD(0xd91345bb),
+	WORD(0xc5e26f62), WORD(0x64a35d22), WORD(0x16880cc7), WORD(0x05015843),
+	WORD(0x70203aa0), WORD(0x11e4ffa1), WORD(0x05a83a63), WORD(0xdaf3972b),
+	WORD(0x9422f10e), WORD(0x5dbc0e12),
+	/* 17G */
+	WORD(0x86ade48c), WORD(0x79cec3fb), WORD(0x3f83b939), WORD(0xb9622253),
+	WORD(0x5523244b), WORD(0x538d543e), WORD(0x07ba7ce6), WORD(0x12bb38c0),
+	WORD(0xb4e20b8c), WORD(0x70a52728), WORD(0xe6873448), WORD(0x2a2e7758),
+	WORD(0x2954321a), WORD(0x07a8f3fd),
+	/* 19G */
+	WORD(0x716b6ade), WORD(0xea007122), WORD(0x2a638e5a), WORD(0x08a75055),
+	WORD(0x4e35e1f6), WORD(0xe28f8fa3), WORD(0xe40528c7), WORD(0x7393ad17),
+	WORD(0x4e27959e), WORD(0xd8f5fd90), WORD(0x433c708c), WORD(0xe5b33144),
+	WORD(0x4c003b64), WORD(0x6c3deb98),
+	/* 21G */
+	WORD(0x869c61a2), WORD(0x8d8b998b), WORD(0x6f781395), WORD(0x5cc8116d),
+	WORD(0x1f271989), WORD(0xa8992ade), WORD(0x78c70a2c), WORD(0xb2334f8f),
+	WORD(0x1fadf19a), WORD(0x28c19018), WORD(0x71d5904e), WORD(0x939bd9ec),
+	WORD(0x534ec549), WORD(0x77091fc9),
+	/* 23G */
+	WORD(0x746daf60), WORD(0x210782c4), WORD(0x64b5fd56), WORD(0x358ace9d),
+	WORD(0x1008fd0f), WORD(0xaf231c63), WORD(0x285dcb4b), WORD(0x17203da1),
+	WORD(0x3534d554), WORD(0xf8542368), WORD(0x30962d47), WORD(0xf7552ee7),
+	WORD(0xa1ab0080), WORD(0x11208856),
+	/* 25G */
+	WORD(0xec729f5c), WORD(0x347bddd0), WORD(0x77f89e52), WORD(0x4576657a),
+	WORD(0x79a42c59), WORD(0x3a4d5c62), WORD(0xdc6f4cf3), WORD(0x72672c8e),
+	WORD(0x34edf6de), WORD(0xa9cc925d), WORD(0xc615c175), WORD(0x264b7c52),
+	WORD(0x6b6c91f7), WORD(0x78e30c64),
+	/* 27G */
+	WORD(0xb5862dd9), WORD(0xfb7f7ec7), WORD(0xfd622a86), WORD(0xf9ca08fc),
+	WORD(0xf3fb356b), WORD(0xa3379ec2), WORD(0x3726b3ee), WORD(0x5680ab95),
+	WORD(0x1f4b780d), WORD(0x72773b06), WORD(0x181ad0ef), WORD(0x9c77acf2),
+	WORD(0xc5ed6c19), WORD(0xd82c650d),
+	/* 29G */
+	WORD(0x3ff1d621), WORD(0xb26ad028), WORD(0x0117a093), WORD(0x3395a449),
+	WORD(0xbb9b7453), WORD(0xac8575b5), WORD(0x9638e810), WORD(0x19b52295),
+	WORD(0x61b7e04c), WORD(0x917e2f50), WORD(0xea595a39), WORD(0xb7e04864),
+	WORD(0xf641867a), WORD(0xf34ee0e8),
+	/* 31G */
+	WORD(0x5d150589), WORD(0x6e0c12f8), WORD(0xe3db4074), WORD(0xcc4b0246),
+	WORD(0xe25d613a), WORD(0x98b62cd3), WORD(0xc7d0dccf), WORD(0xca8e4caa),
+	WORD(0x1f7fb23f), WORD(0x6eff4dea), WORD(0x41da9f53), WORD(0x44527d49),
+	WORD(0x9e1f47c6), WORD(0x3f6e7e3d),
+	/* 33G */
+	WORD(0x724287d7), WORD(0x86eb5493), WORD(0x2b764d91), WORD(0x7078641f),
+	WORD(0x72b46e9e), WORD(0x0bd8afe8), WORD(0xfaf8c9a7), WORD(0xeea543b7),
+	WORD(0x7400cd52), WORD(0x409c38a5), WORD(0x0a6c2e1b), WORD(0x9604a54b),
+	WORD(0xe2c2c60a), WORD(0xd18594c9),
+	/* 35G */
+	WORD(0x6ef3ab06), WORD(0xfbca1b97), WORD(0xa18bd2bb), WORD(0xd8911f8d),
+	WORD(0x639e011c), WORD(0xb731d607), WORD(0xde5b279e), WORD(0x0706cd09),
+	WORD(0x8e5b6703), WORD(0xc24e209d), WORD(0x4d443d16), WORD(0xdc2ea468),
+	WORD(0xccc5dbca), WORD(0x9aba875f),
+	/* 37G */
+	WORD(0x9afdccc2), WORD(0xf2645ccf), WORD(0xe60a2a1d), WORD(0x170bc3dd),
+	WORD(0xc06a289b), WORD(0x8b3174cc), WORD(0xb5e5b73e), WORD(0xc289c4c6),
+	WORD(0xfcbc66cf), WORD(0x3f41c58d), WORD(0xea32e7fb), WORD(0xfdc7bcec),
+	WORD(0x2d89d32d), WORD(0x34aa50e4),
+	/* 39G */
+	WORD(0x4821f126), WORD(0x43b3629d), WORD(0x502c3b9c), WORD(0x3319053f),
+	WORD(0xa3b32151), WORD(0x4038845d), WORD(0xea3b4ccc), WORD(0xedfaa06d),
+	WORD(0x00044014), WORD(0xd835277d), WORD(0xd5eb20d5), WORD(0x1a8a108b),
+	WORD(0x38cb0a6b), WORD(0x30a8f927),
+	/* 41G */
+	WORD(0x231d20c6), WORD(0xa36c8848), WORD(0x3fcb294a), WORD(0xcb7e8b54),
+	WORD(0xc4b2c9f8), WORD(0x2f8b6de0), WORD(0x49f1993b), WORD(0xb8860526),
+	WORD(0xfdcf530d), WORD(0xb895a0fe), WORD(0x49da0f6a), WORD(0xefc627b6),
+	WORD(0x4e9fb807), WORD(0xdbc0d2c1),
+	/* 43G */
+	WORD(0x687018fd), WORD(0x7c723f5d), WORD(0x86c9f952), WORD(0x2221f721),
+	WORD(0x93828714), WORD(0x13d720d3), WORD(0x45d38213), WORD(0xe61c9b06),
+	WORD(0xc198db55), WORD(0x598140b2), WORD(0xbe38af8f), WORD(0x621f284e),
+	WORD(0x18f09bf6), WORD(0x192fd52c),
+	/* 45G */
+	WORD(0xa178a33b), WORD(0xdd724842), WORD(0x914d8342), WORD(0xa5d7a87b),
+	WORD(0x30befc70), WORD(0x69874db8), WORD(0xec19410e), WORD(0xcfcdbfcf),
+	WORD(0xe3d6346a), WORD(0xde9edbbd), WORD(0x84c65475), WORD(0xde39cef5),
+	WORD(0xe4efb3c1), WORD(0xc10a727b),
+	/* 47G */
+	WORD(0x92f507ce), WORD(0x9137f80a), WORD(0xf48fb253), WORD(0xcb924115),
+	WORD(0x2be56c53), WORD(0x0703cdda), WORD(0xb4cf511f), WORD(0x0b8faa80),
+	WORD(0xb73eae3f), WORD(0x58a8b927), WORD(0xf227ad25), WORD(0xdbca2fc4),
+	WORD(0x06231927), WORD(0x409b12c6),
+	/* 49G */
+	WORD(0x29e4a336), WORD(0x600e1a17), WORD(0xd60d3b73), WORD(0xa542f637),
+	WORD(0x556905e7), WORD(0xc7209080), WORD(0x3f5144ad), WORD(0x0b55b0fe),
+	WORD(0xa6cf1f95), WORD(0xb8f822b9), WORD(0x9d44e115), WORD(0x1acfe880),
+	WORD(0xe820af09), WORD(0x0a84bb85),
+	/* 51G */
+	WORD(0x24f4b136), WORD(0xf0524e07), WORD(0x8fd9fda0), WORD(0x138ee6ed),
+	WORD(0x1770de3d), WORD(0xedc6985e), WORD(0x6c2f8154), WORD(0x997ae150),
+	WORD(0xb5a50098), WORD(0xd64a082c), WORD(0x05ed2b30), WORD(0xe84702e1),
+	WORD(0x4701e013), WORD(0xcb1ea5c4),
+	/* 53G */
+	WORD(0xd7b84537), WORD(0x6ae52eb4), WORD(0x5303af34), WORD(0x4989ea91),
+	WORD(0x58155fb2), WORD(0x51865588), WORD(0xff60915f), WORD(0xb2f24a3f),
+	WORD(0x4a65a557), WORD(0x4126452d), WORD(0xc5c558ab), WORD(0x39d391fe),
+	WORD(0x71637238), WORD(0x2d627920),
+	/* 55G */
+	WORD(0x7d3144d8), WORD(0xeeb7e587), WORD(0x4daf5c9e), WORD(0x63105e87),
+	WORD(0x24b31279), WORD(0x358ad95d), WORD(0x7ca7cd50), WORD(0x8b96f130),
+	WORD(0xa1f8699a), WORD(0x885e7bf5), WORD(0x36720d2e), WORD(0x19da3cf7),
+	WORD(0x0c3e259d), WORD(0xbb7ab1a9),
+	/* 57G */
+	WORD(0x01ae0873), WORD(0xf209f351), WORD(0xc477ed75), WORD(0x1c3d4f63),
+	WORD(0xfd2dee37), WORD(0x23082359), WORD(0x5b85b81c), WORD(0x226bc4e5),
+	WORD(0xc1dc2c14), WORD(0xfac25e9a), WORD(0x4a88888c), WORD(0xd11ebfc0),
+	WORD(0x5bb60dfa), WORD(0x6deca182),
+	/* 59G */
+	WORD(0x2fefa18b), WORD(0x0a5f6d1a), WORD(0x81d4f0b6), WORD(0xaeecb1e3),
+	WORD(0xe2cc44ed), WORD(0x1a3c357a), WORD(0xa72825d3), WORD(0xe129986d),
+	WORD(0x78fb4e9b), WORD(0x872596fe), WORD(0x6b166a06), WORD(0x1f456692),
+	WORD(0x55649b1b), WORD(0xff6c52c4),
+	/* 61G */
+	WORD(0xffa27853), WORD(0x4d6d2499), WORD(0xc40d40a1), WORD(0xb5248259),
+	WORD(0x5a3e6570), WORD(0xb7125d0c), WORD(0x27a24b64), WORD(0x37979bfd),
+	WORD(0x785afdfc), WORD(0x695b2c23), WORD(0x1a4c7732), WORD(0xe1b6b02f),
+	WORD(0xa84e1866), WORD(0x09ceeb7b),
+	/* 63G */
+	WORD(0xd6c61ac2), WORD(0x9d056208), WORD(0x63bfbe05), WORD(0xa70e6aa2),
+	WORD(0x566c60a7), WORD(0x483b996a), WORD(0x53b69d35), WORD(0xa38d32bd),
+	WORD(0xc38fefeb), WORD(0x27b8ad3b), WORD(0x57f15c47), WORD(0x689ae7bd),
+	WORD(0x3e0d8010), WORD(0xfa0d354d),
+};
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+static const word_t secp224r1_gen_wnaf[] = {
+	/* G */
+	WORD(0x5227), WORD(0xbc90), WORD(0xbfaa), WORD(0x6018), WORD(0xe220), WORD(0xf22f),
+	WORD(0xec04), WORD(0xf96b), WORD(0xaf9b), WORD(0x6dd3), WORD(0x5e60), WORD(0xa21b),
+	WORD(0xb516), WORD(0x92f5), WORD(0xa1e6), WORD(0x2edc), WORD(0x5a6b), WORD(0x0533),
+	WORD(0x5513), WORD(0xe8c1), WORD(0xe878), WORD(0x03df), WORD(0xc5ae), WORD(0xaea9),
+	WORD(0x86f1), WORD(0x6147), WORD(0x1218), WORD(0x100c),
+	/* 3G */
+	WORD(0x10d8), WORD(0xe377), WORD(0x2223), WORD(0xe0b0), WORD(0xca96), WORD(0xab22),
+	WORD(0x1c5a), WORD(0xc3cf), WORD(0x5bb6), WORD(0x0050), WORD(0x6496), WORD(0xaf8b),
+	WORD(0xb566), WORD(0x799e), WORD(0xb174), WORD(0x9a73), WORD(0x4e62), WORD(0x0414),
+	WORD(0xf88f), WORD(0xe434), WORD(0x40ab), WORD(0x3579), WORD(0x0c35), WORD(0xafe1),
+	WORD(0x492c), WORD(0x6dfa), WORD(0x1da3), WORD(0x8c1b),
+	/* 5G */
+	WORD(0xcc51), WORD(0x0b10), WORD(0xc283), WORD(0xf8df), WORD(0x8962), WORD(0xac3c),
+	WORD(0x451e), WORD(0x975a), WORD(0x1b77), WORD(0x3921), WORD(0xfe95), WORD(0xf7f4),
+	WORD(0x53a8), WORD(0x2bd0), WORD(0x2e74), WORD(0x2b55), WORD(0xe695), WORD(0x61a9),
+	WORD(0xef91), WORD(0xc350), WORD(0xf037), WORD(0x11bc), WORD(0x4f79), WORD(0x42b5),
+	WORD(0xda82), WORD(0xc858), WORD(0x2162), WORD(0x9b05),
+	/* 7G */
+	WORD(0x2821), WORD(0x9046), WORD(0x6e35), WORD(0x6864), WORD(0xb145), WORD(0x5048),
+	WORD(0x26ba), WORD(0x1e25), WORD(0xf812), WORD(0xc81d), WORD(0x0814), WORD(0x7ed5),
+	WORD(0x453e), WORD(0x7665), WORD(0x2186), WORD(0x610f), WORD(0x2889), WORD(0x1fb3),
+	WORD(0xba26), WORD(0x9d0e), WORD(0xeeed), WORD(0xed8c), WORD(0xb25e), WORD(0xce5e),
+	WORD(0x52e3), WORD(0x0e59), WORD(0xbf84), WORD(0xa229),
+	/* 9G */
+	WORD(0xcc78), WORD(0x1c1e), WORD(0xda4a), WORD(0x743e), WORD(0x4f26), WORD(0x9f0b),
+	WORD(0x3a4f), WORD(0x2f99), WORD(0xe9ba), WORD(0x94f5), WORD(0x095a), WORD(0x79d4),
+	WORD(0x2c39), WORD(0x846b), WORD(0x55b7), WORD(0xe07e), WORD(0xf3f1), WORD(0x909b),
+	WORD(0x5e6a), WORD(0xbacf), WORD(0xdb6c), WORD(0x77e1), WORD(0xd627), WORD(0xe733),
+	WORD(0xac9d), WORD(0x5114), WORD(0x9bf7), WORD(0x7088),
+	/* 11G */
+	WORD(0x8ca9), WORD(0xac35), WORD(0xd5ca), WORD(0xe1bd), WORD(0x2c4d), WORD(0xde5d),
+	WORD(0xe305), WORD(0xd0de), WORD(0x0758), WORD(0x0f06), WORD(0x9093), WORD(0xd6d8),
+	WORD(0xda27), WORD(0x9397), WORD(0xa143), WORD(0x649e), WORD(0x1c2c), WORD(0x0818),
+	WORD(0x8920), WORD(0x7988), WORD(0x713a), WORD(0x6c63), WORD(0x2bf0), WORD(0xc118),
+	WORD(0x8d79), WORD(0x45e4), WORD(0xdd82), WORD(0x0e48),
+	/* 13G */
+	WORD(0x8db3), WORD(0x489c), WORD(0x563f), WORD(0xffbe), WORD(0x0fe6), WORD(0x8363),
+	WORD(0xfb0a), WORD(0xbc99), WORD(0xe63c), WORD(0x68ad), WORD(0xacf0), WORD(0x398e),
+	WORD(0x95c8), WORD(0xc5e0), WORD(0xacb6), WORD(0x83fd), WORD(0xf824), WORD(0x800d),
+	WORD(0xe74f), WORD(0xa3ff), WORD(0xd616), WORD(0x442e), WORD(0x6bf8), WORD(0xb4dc),
+	WORD(0x60b4), WORD(0x3f80), WORD(0x633c), WORD(0x12ab),
+	/* 15G */
+	WORD(0xd51a), WORD(0x55bf), WORD(0xd1af), WORD(0xb16e), WORD(0xfb0a), WORD(0x464a),
+	WORD(0x45bb), WORD(0xd913), WORD(0x6f62), WORD(0xc5e2), WORD(0x5d22), WORD(0x64a3),
+	WORD(0x0cc7), WORD(0x1688), WORD(0x5843), WORD(0x0501), WORD(0x3aa0), WORD(0x7020),
+	WORD(0xffa1), WORD(0x11e4), WORD(0x3a63), WORD(0x05a8), WORD(0x972b), WORD(0xdaf3),
+	WORD(0xf10e), WORD(0x9422), WORD(0x0e12), WORD(0x5dbc),
+	/* 17G */
+	WORD(0xe48c), WORD(0x86ad), WORD(0xc3fb), WORD(0x79ce), WORD(0xb939), WORD(0x3f83),
+	WORD(0x2253), WORD(0xb962), WORD(0x244b), WORD(0x5523), WORD(0x543e), WORD(0x538d),
+	WORD(0x7ce6), WORD(0x07ba), WORD(0x38c0), WORD(0x12bb), WORD(0x0b8c), WORD(0xb4e2),
+	WORD(0x2728), WORD(0x70a5), WORD(0x3448), WORD(0xe687), WORD(0x7758), WORD(0x2a2e),
+	WORD(0x321a), WORD(0x2954), WORD(0xf3fd), WORD(0x07a8),
+	/* 19G */
+	WORD(0x6ade), WORD(0x716b), WORD(0x7122), WORD(0xea00), WORD(0x8e5a), WORD(0x2a63),
+	WORD(0x5055), WORD(0x08a7), WORD(0xe1f6), WORD(0x4e35), WORD(0x8fa3), WORD(0xe28f),
+	WORD(0x28c7), WORD(0xe405), WORD(0xad17), WORD(0x7393), WORD(0x959e), WORD(0x4e27),
+	WORD(0xfd90), WORD(0xd8f5), WORD(0x708c), WORD(0x433c), WORD(0x3144), WORD(0xe5b3),
+	WORD(0x3b64), WORD(0x4c00), WORD(0xeb98), WORD(0x6c3d),
+	/* 21G */
+	WORD(0x61a2), WORD(0x869c), WORD(0x998b), WORD(0x8d8b), WORD(0x1395), WORD(0x6f78),
+	WORD(0x116d), WORD(0x5cc8), WORD(0x1989), WORD(0x1f27), WORD(0x2ade), WORD(0xa899),
+	WORD(0x0a2c), WORD(0x78c7), WORD(0x4f8f), WORD(0xb233), WORD(0xf19a), WORD(0x1fad),
+	WORD(0x9018), WORD(0x28c1), WORD(0x904e), WORD(0x71d5), WORD(0xd9ec), WORD(0x939b),
+	WORD(0xc549), WORD(0x534e), WORD(0x1fc9), WORD(0x7709),
+	/* 23G */
+	WORD(0xaf60), WORD(0x746d), WORD(0x82c4), WORD(0x2107), WORD(0xfd56), WORD(0x64b5),
+	WORD(0xce9d), WORD(0x358a), WORD(0xfd0f), WORD(0x1008), WORD(0x1c63), WORD(0xaf23),
+	WORD(0xcb4b), WORD(0x285d), WORD(0x3da1), WORD(0x1720), WORD(0xd554), WORD(0x3534),
+	WORD(0x2368), WORD(0xf854), WORD(0x2d47), WORD(0x3096), WORD(0x2ee7), WORD(0xf755),
+	WORD(0x0080), WORD(0xa1ab), WORD(0x8856), WORD(0x1120),
+	/* 25G */
+	WORD(0x9f5c), WORD(0xec72), WORD(0xddd0), WORD(0x347b), WORD(0x9e52), WORD(0x77f8),
+	WORD(0x657a), WORD(0x4576), WORD(0x2c59), WORD(0x79a4), WORD(0x5c62), WORD(0x3a4d),
+	WORD(0x4cf3), WORD(0xdc6f), WORD(0x2c8e), WORD(0x7267), WORD(0xf6de), WORD(0x34ed),
+	WORD(0x925d), WORD(0xa9cc), WORD(0xc175), WORD(0xc615), WORD(0x7c52), WORD(0x264b),
+	WORD(0x91f7), WORD(0x6b6c), WORD(0x0c64), WORD(0x78e3),
+	/* 27G */
+	WORD(0x2dd9), WORD(0xb586), WORD(0x7ec7), WORD(0xfb7f), WORD(0x2a86), WORD(0xfd62),
+	WORD(0x08fc), WORD(0xf9ca), WORD(0x356b), WORD(0xf3fb), WORD(0x9ec2), WORD(0xa337),
+	WORD(0xb3ee), WORD(0x3726), WORD(0xab95), WORD(0x5680), WORD(0x780d), WORD(0x1f4b),
+	WORD(0x3b06), WORD(0x7277), WORD(0xd0ef), WORD(0x181a), WORD(0xacf2), WORD(0x9c77),
+	WORD(0x6c19), WORD(0xc5ed), WORD(0x650d), WORD(0xd82c),
+	/* 29G */
+	WORD(0xd621), WORD(0x3ff1), WORD(0xd028), WORD(0xb26a), WORD(0xa093), WORD(0x0117),
+	WORD(0xa449), WORD(0x3395), WORD(0x7453), WORD(0xbb9b), WORD(0x75b5), WORD(0xac85),
+	WORD(0xe810), WORD(0x9638), WORD(0x2295), WORD(0x19b5), WORD(0xe04c), WORD(0x61b7),
+	WORD(0x2f50), WORD(0x917e), WORD(0x5a39), WORD(0xea59), WORD(0x4864), WORD(0xb7e0),
+	WORD(0x867a), WORD(0xf641), WORD(0xe0e8), WORD(0xf34e),
+	/* 31G */
+	WORD(0x0589), WORD(0x5d15), WORD(0x12f8), WORD(0x6e0c), WORD(0x4074), WORD(0xe3db),
+	WORD(0x0246), WORD(0xcc4b), WORD(0x613a), WORD(0xe25d), WORD(0x2cd3), WORD(0x98b6),
+	WORD(0xdccf), WORD(0xc7d0), WORD(0x4caa), WORD(0xca8e), WORD(0xb23f), WORD(0x1f7f),
+	WORD(0x4dea), WORD(0x6eff), WORD(0x9f53), WORD(0x41da), WORD(0x7d49), WORD(0x4452),
+	WORD(0x47c6), WORD(0x9e1f), WORD(0x7e3d), WORD(0x3f6e),
+	/* 33G */
+	WORD(0x87d7), WORD(0x7242), WORD(0x5493), WORD(0x86eb), WORD(0x4d91), WORD(0x2b76),
+	WORD(0x641f), WORD(0x7078), WORD(0x6e9e), WORD(0x72b4), WORD(0xafe8), WORD(0x0bd8),
+	WORD(0xc9a7), WORD(0xfaf8), WORD(0x43b7), WORD(0xeea5), WORD(0xcd52), WORD(0x7400),
+	WORD(0x38a5), WORD(0x409c), WORD(0x2e1b), WORD(0x0a6c), WORD(0xa54b), WORD(0x9604),
+	WORD(0xc60a), WORD(0xe2c2), WORD(0x94c9), WORD(0xd185),
+	/* 35G */
+	WORD(0xab06), WORD(0x6ef3), WORD(0x1b97), WORD(0xfbca), WORD(0xd2bb), WORD(0xa18b),
+	WORD(0x1f8d), WORD(0xd891), WORD(0x011c), WORD(0x639e), WORD(0xd607), WORD(0xb731),
+	WORD(0x279e), WORD(0xde5b), WORD(0xcd09), WORD(0x0706), WORD(0x6703), WORD(0x8e5b),
+	WORD(0x209d), WORD(0xc24e), WORD(0x3d16), WORD(0x4d44), WORD(0xa468), WORD(0xdc2e),
+	WORD(0xdbca), WORD(0xccc5), WORD(0x875f), WORD(0x9aba),
+	/* 37G */
+	WORD(0xccc2), WORD(0x9afd), WORD(0x5ccf), WORD(0xf264), WORD(0x2a1d), WORD(0xe60a),
+	WORD(0xc3dd), WORD(0x170b), WORD(0x289b), WORD(0xc06a), WORD(0x74cc), WORD(0x8b31),
+	WORD(0xb73e), WORD(0xb5e5), WORD(0xc4c6), WORD(0xc289), WORD(0x66cf), WORD(0xfcbc),
+	WORD(0xc58d), WORD(0x3f41), WORD(0xe7fb), WORD(0xea32), WORD(0xbcec), WORD(0xfdc7),
+	WORD(0xd32d), WORD(0x2d89), WORD(0x50e4), WORD(0x34aa),
+	/* 39G */
+	WORD(0xf126), WORD(0x4821), WORD(0x629d), WORD(0x43b3), WORD(0x3b9c), WORD(0x502c),
+	WORD(0x053f), WORD(0x3319), WORD(0x2151), WORD(0xa3b3), WORD(0x845d), WORD(0x4038),
+	WORD(0x4ccc), WORD(0xea3b), WORD(0xa06d), WORD(0xedfa), WORD(0x4014), WORD(0x0004),
+	WORD(0x277d), WORD(0xd835), WORD(0x20d5), WORD(0xd5eb), WORD(0x108b), WORD(0x1a8a),
+	WORD(0x0a6b), WORD(0x38cb), WORD(0xf927), WORD(0x30a8),
+	/* 41G */
+	WORD(0x20c6), WORD(0x231d), WORD(0x8848), WORD(0xa36c), WORD(0x294a), WORD(0x3fcb),
+	WORD(0x8b54), WORD(0xcb7e), WORD(0xc9f8), WORD(0xc4b2), WORD(0x6de0), WORD(0x2f8b),
+	WORD(0x993b), WORD(0x49f1), WORD(0x0526), WORD(0xb886), WORD(0x530d), WORD(0xfdcf),
+	WORD(0xa0fe), WORD(0xb895), WORD(0x0f6a), WORD(0x49da), WORD(0x27b6), WORD(0xefc6),
+	WORD(0xb807), WORD(0x4e9f), WORD(0xd2c1), WORD(0xdbc0),
+	/* 43G */
+	WORD(0x18fd), WORD(0x6870), WORD(0x3f5d), WORD(0x7c72), WORD(0xf952), WORD(0x86c9),
+	WORD(0xf721), WORD(0x2221), WORD(0x8714), WORD(0x9382), WORD(0x20d3), WORD(0x13d7),
+	WORD(0x8213), WORD(0x45d3), WORD(0x9b06), WORD(0xe61c), WORD(0xdb55), WORD(0xc198),
+	WORD(0x40b2), WORD(0x5981), WORD(0xaf8f), WORD(0xbe38), WORD(0x284e), WORD(0x621f),
+	WORD(0x9bf6), WORD(0x18f0), WORD(0xd52c), WORD(0x192f),
+	/* 45G */
+	WORD(0xa33b), WORD(0xa178), WORD(0x4842), WORD(0xdd72), WORD(0x8342), WORD(0x914d),
+	WORD(0xa87b), WORD(0xa5d7), WORD(0xfc70), WORD(0x30be), WORD(0x4db8), WORD(0x6987),
+	WORD(0x410e), WORD(0xec19), WORD(0xbfcf), WORD(0xcfcd), WORD(0x346a), WORD(0xe3d6),
+	WORD(0xdbbd), WORD(0xde9e), WORD(0x5475), WORD(0x84c6), WORD(0xcef5), WORD(0xde39),
+	WORD(0xb3c1), WORD(0xe4ef), WORD(0x727b), WORD(0xc10a),
+	/* 47G */
+	WORD(0x07ce), WORD(0x92f5), WORD(0xf80a), WORD(0x9137), WORD(0xb253), WORD(0xf48f),
+	WORD(0x4115), WORD(0xcb92), WORD(0x6c53), WORD(0x2be5), WORD(0xcdda), WORD(0x0703),
+	WORD(0x511f), WORD(0xb4cf), WORD(0xaa80), WORD(0x0b8f), WORD(0xae3f), WORD(0xb73e),
+	WORD(0xb927), WORD(0x58a8), WORD(0xad25), WORD(0xf227), WORD(0x2fc4), WORD(0xdbca),
+	WORD(0x1927), WORD(0x0623), WORD(0x12c6), WORD(0x409b),
+	/* 49G */
+	WORD(0xa336), WORD(0x29e4), WORD(0x1a17), WORD(0x600e), WORD(0x3b73), WORD(0xd60d),
+	WORD(0xf637), WORD(0xa542), WORD(0x05e7), WORD(0x5569), WORD(0x9080), WORD(0xc720),
+	WORD(0x44ad), WORD(0x3f51), WORD(0xb0fe), WORD(0x0b55), WORD(0x1f95), WORD(0xa6cf),
+	WORD(0x22b9), WORD(0xb8f8), WORD(0xe115), WORD(0x9d44), WORD(0xe880), WORD(0x1acf),
+	WORD(0xaf09), WORD(0xe820), WORD(0xbb85), WORD(0x0a84),
+	/* 51G */
+	WORD(0xb136), WORD(0x24f4), WORD(0x4e07), WORD(0xf052), WORD(0xfda0), WORD(0x8fd9),
+	WORD(0xe6ed), WORD(0x138e), WORD(0xde3d), WORD(0x1770), WORD(0x985e), WORD(0xedc6),
+	WORD(0x8154), WORD(0x6c2f), WORD(0xe150), WORD(0x997a), WORD(0x0098), WORD(0xb5a5),
+	WORD(0x082c), WORD(0xd64a), WORD(0x2b30), WORD(0x05ed), WORD(0x02e1), WORD(0xe847),
+	WORD(0xe013), WORD(0x4701), WORD(0xa5c4), WORD(0xcb1e),
+	/* 53G */
+	WORD(0x4537), WORD(0xd7b8), WORD(0x2eb4), WORD(0x6ae5), WORD(0xaf34), WORD(0x5303),
+	WORD(0xea91), WORD(0x4989), WORD(0x5fb2), WORD(0x5815), WORD(0x5588), WORD(0x5186),
+	WORD(0x915f), WORD(0xff60), WORD(0x4a3f), WORD(0xb2f2), WORD(0xa557), WORD(0x4a65),
+	WORD(0x452d), WORD(0x4126), WORD(0x58ab), WORD(0xc5c5), WORD(0x91fe), WORD(0x39d3),
+	WORD(0x7238), WORD(0x7163), WORD(0x7920), WORD(0x2d62),
+	/* 55G */
+	WORD(0x44d8), WORD(0x7d31), WORD(0xe587), WORD(0xeeb7), WORD(0x5c9e), WORD(0x4daf),
+	WORD(0x5e87), WORD(0x6310), WORD(0x1279), WORD(0x24b3), WORD(0xd95d), WORD(0x358a),
+	WORD(0xcd50), WORD(0x7ca7), WORD(0xf130), WORD(0x8b96), WORD(0x699a), WORD(0xa1f8),
+	WORD(0x7bf5), WORD(0x885e), WORD(0x0d2e), WORD(0x3672), WORD(0x3cf7), WORD(0x19da),
+	WORD(0x259d), WORD(0x0c3e), WORD(0xb1a9), WORD(0xbb7a),
+	/* 57G */
+	WORD(0x0873), WORD(0x01ae), WORD(0xf351), WORD(0xf209), WORD(0xed75), WORD(0xc477),
+	WORD(0x4f63), WORD(0x1c3d), WORD(0xee37), WORD(0xfd2d), WORD(0x2359), WORD(0x2308),
+	WORD(0xb81c), WORD(0x5b85), WORD(0xc4e5), WORD(0x226b), WORD(0x2c14), WORD(0xc1dc),
+	WORD(0x5e9a), WORD(0xfac2), WORD(0x888c), WORD(0x4a88), WORD(0xbfc0), WORD(0xd11e),
+	WORD(0x0dfa), WORD(0x5bb6), WORD(0xa182), WORD(0x6dec),
+	/* 59G */
+	WORD(0xa18b), WORD(0x2fef), WORD(0x6d1a), WORD(0x0a5f), WORD(0xf0b6), WORD(0x81d4),
+	WORD(0xb1e3), WORD(0xaeec), WORD(0x44ed), WORD(0xe2cc), WORD(0x357a), WORD(0x1a3c),
+	WORD(0x25d3), WORD(0xa728), WORD(0x986d), WORD(0xe129), WORD(0x4e9b), WORD(0x78fb),
+	WORD(0x96fe), WORD(0x8725), WORD(0x6a06), WORD(0x6b16), WORD(0x6692), WORD(0x1f45),
+	WORD(0x9b1b), WORD(0x5564), WORD(0x52c4), WORD(0xff6c),
+	/* 61G */
+	WORD(0x7853), WORD(0xffa2), WORD(0x2499), WORD(0x4d6d), WORD(0x40a1), WORD(0xc40d),
+	WORD(0x8259), WORD(0xb524), WORD(0x6570), WORD(0x5a3e), WORD(0x5d0c), WORD(0xb712),
+	WORD(0x4b64), WORD(0x27a2), WORD(0x9bfd), WORD(0x3797), WORD(0xfdfc), WORD(0x785a),
+	WORD(0x2c23), WORD(0x695b), WORD(0x7732), WORD(0x1a4c), WORD(0xb02f), WORD(0xe1b6),
+	WORD(0x1866), WORD(0xa84e), WORD(0xeb7b), WORD(0x09ce),
+	/* 63G */
+	WORD(0x1ac2), WORD(0xd6c6), WORD(0x6208), WORD(0x9d05), WORD(0xbe05), WORD(0x63bf),
+	WORD(0x6aa2), WORD(0xa70e), WORD(0x60a7), WORD(0x566c), WORD(0x996a), WORD(0x483b),
+	WORD(0x9d35), WORD(0x53b6), WORD(0x32bd), WORD(0xa38d), WORD(0xefeb), WORD(0xc38f),
+	WORD(0xad3b), WORD(0x27b8), WORD(0x5c47), WORD(0x57f1), WORD(0xe7bd), WORD(0x689a),
+	WORD(0x8010), WORD(0x3e0d), WORD(0x354d), WORD(0xfa0d),
+};
+#else                     /* unknown word size */
+#error "Unsupported word size"
+#endif
+TO_EC_GEN_TABLE_PARAM(secp224r1_gen_wnaf, 7);
+
+/*
+ * Signed comb of the generator for the fixed base multiplications (6
+ * teeth, spacing 38), affine x and y in Montgomery representation
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+static const word_t secp224r1_gen_comb[] = {
+	/* T[0] */
+	WORD(0x481c1c5cb5ff8428), WORD(0xee8ea38d18744b74),
+	WORD(0x2906515c1ed9e35b), WORD(0x0000000080b85903),
+	WORD(0xd771febbbe22bd76), WORD(0xfc3590fc1962fa95),
+	WORD(0xf30ab6f665940aef), WORD(0x00000000a7ea17f1),
+	/* T[1] */
+	WORD(0x535db5ac4e2333c6), WORD(0xc6e31b6353af6f6d),
+	WORD(0xa38de91d267b9de9), WORD(0x000000008743a9c9),
+	WORD(0x8c2f201b653fa9e7), WORD(0x18c042d1eaf16bc3),
+	WORD(0x9764b1f7f7c4f21d), WORD(0x00000000891ddd54),
+	/* T[2] */
+	WORD(0xb90de769dfdce490), WORD(0x321bb7bf0e89c32d),
+	WORD(0xedf2ad227f99e9f4), WORD(0x0000000061a24177),
+	WORD(0xd9d50925e5e9385b), WORD(0xd094790ea889ad3c),
+	WORD(0xd0cd8b9d8f6c7697), WORD(0x00000000c14f0505),
+	/* T[3] */
+	WORD(0x5964249311296502), WORD(0x0ca94183d84b34df),
+	WORD(0xef8771d35d5d05de), WORD(0x000000001cf52ee7),
+	WORD(0xd74e314743473ccc), WORD(0x001bb806b5e67ffc),
+	WORD(0xd89c5a9195173099), WORD(0x00000000794ebda7),
+	/* T[4] */
+	WORD(0x86f9a0e33a03f086), WORD(0xa1a3bca360caa8f8),
+	WORD(0x1a434c87ce54ebed), WORD(0x0000000072c6a4d0),
+	WORD(0x70b5ffd787474ffa), WORD(0x1bad6c29ad04bee8),
+	WORD(0x8899e3d53c82c02a), WORD(0x000000005801370e),
+	/* T[5] */
+	WORD(0xc5b2989633c6729f), WORD(0xcd15001a9d7f654b),
+	WORD(0x5f5b78a6ab3dff41), WORD(0x0000000045d5feb1),
+	WORD(0x8591259e960f4fc3), WORD(0x6885cfb1673aeb66),
+	WORD(0xd09e24955e00e435), WORD(0x000000008aaaf036),
+	/* T[6] */
+	WORD(0xa590136d3abbcf89), WORD(0xc134fb097635507b),
+	WORD(0x8afbbc6e06aa1b84), WORD(0x00000000d1f5ad7a),
+	WORD(0xa272fa367c19dcbb), WORD(0x419865f9cee53103),
+	WORD(0x33195b1f4583a46f), WORD(0x000000001bf7eb12),
+	/* T[7] */
+	WORD(0xe9ae9947c26660ab), WORD(0x9b7d3bb085d6c428),
+	WORD(0x3ac73bd05f564ce4), WORD(0x00000000b3aea1f6),
+	WORD(0x54be3669f4ddc9ce), WORD(0x3f467a58e6df1fc8),
+	WORD(0x5f96156abb0418c8), WORD(0x000000001bac1573),
+	/* T[8] */
+	WORD(0x72914e7f87a8ee9f), WORD(0x76d706d36e0ace2f),
+	WORD(0xb9084cc44232e783), WORD(0x0000000089ba6a52),
+	WORD(0xc808fb0da6a058ba), WORD(0x86498aa9b4f189d6),
+	WORD(0x36222a0d2d29ba94), WORD(0x00000000011882ea),
+	/* T[9] */
+	WORD(0x0d4f33707287ec76), WORD(0x651dfe4095fda58e),
+	WORD(0x37ea46ddbf1d7e8f), WORD(0x0000000096e38de3),
+	WORD(0xbcd4612393496cf2), WORD(0x1ed9eeefa39980da),
+	WORD(0x1a383d7f548fc292), WORD(0x0000000067d2ddc6),
+	/* T[10] */
+	WORD(0x450c7a5da3f4c0bc), WORD(0x92157f004d870756),
+	WORD(0x814817478080944b), WORD(0x000000008a3ccf38),
+	WORD(0x776e1564c9c88c5c), WORD(0x7271c5989db08f3b),
+	WORD(0xd9d7c80fd1d87250), WORD(0x000000004f65abf5),
+	/* T[11] */
+	WORD(0x47b01cb59a9a9527), WORD(0x01f737b39bf986fe),
+	WORD(0xb16e7717aba537e0), WORD(0x0000000024694dba),
+	WORD(0x9782582708e03f84), WORD(0x2d2480cdbb28b6e3),
+	WORD(0x436d5c7eb42cf2b6), WORD(0x000000009fc890e3),
+	/* T[12] */
+	WORD(0x034b3b72fdc35f46), WORD(0x9ac09954e6c7bc07),
+	WORD(0x24c35d747328f404), WORD(0x000000005c6233a2),
+	WORD(0x8f45f70c3591107d), WORD(0x940e76c69a4851b7),
+	WORD(0x3cd4af5b2c65b844), WORD(0x00000000bf390daa),
+	/* T[13] */
+	WORD(0x6c5309be29d6f6f8), WORD(0x526661caf7e2967f),
+	WORD(0x8a42dd787be64f7f), WORD(0x0000000063661de2),
+	WORD(0xec6148e1a195444b), WORD(0x7cbdea17156386b4),
+	WORD(0x580b4db895e680e5), WORD(0x00000000aad78d79),
+	/* T[14] */
+	WORD(0x87289d95c07ed8b0), WORD(0xeeb7687b27b714a3),
+	WORD(0x8ccbcd3552d73a87), WORD(0x000000001403a865),
+	WORD(0x3543ad4dc1daa8be), WORD(0x8c066da432aeb2dd),
+	WORD(0x53a5b897f5603716), WORD(0x00000000cbff984b),
+	/* T[15] */
+	WORD(0x74159d6c88ca5255), WORD(0x9c5403e7804c4f88),
+	WORD(0xd6f1e650638f82a6), WORD(0x00000000a66062a0),
+	WORD(0x8382cc0c36ee6ccb), WORD(0x4ce44e1008c389c5),
+	WORD(0x486941e9432fccd9), WORD(0x00000000ca44a600),
+	/* T[16] */
+	WORD(0x97d9363abd2b96b2), WORD(0x9da6bbd5d5e8b550),
+	WORD(0xaf894570935bff64), WORD(0x0000000037f035f6),
+	WORD(0xa0b1f8fba784c464), WORD(0x368d3fc620b2ee05),
+	WORD(0x654b5190465f1936), WORD(0x000000009d9f81df),
+	/* T[17] */
+	WORD(0x43d35ff59b976480), WORD(0xec872e99753d3447),
+	WORD(0xfb0b4563a9dedc3a), WORD(0x0000000052354114),
+	WORD(0x516d0fef86b4878e), WORD(0x34b45f420d95f49f),
+	WORD(0xf20797d10d486e91), WORD(0x000000001f3adb53),
+	/* T[18] */
+	WORD(0x7dc5fc82d0fadad3), WORD(0x4ba230d0cfa87356),
+	WORD(0xb90e5b30f2fb83b5), WORD(0x000000004f00cb46),
+	WORD(0xa115ee2e7dbf2036), WORD(0x2ff0e3e4ab52fad9),
+	WORD(0xd1701af5030689d9), WORD(0x00000000a5f371f3),
+	/* T[19] */
+	WORD(0xb4fb411387c3158e), WORD(0x087f41c0e067166b),
+	WORD(0x9d1b3eb620f6c040), WORD(0x000000003c647750),
+	WORD(0x84efc61984817ed6), WORD(0xf23c81c82738b8a4),
+	WORD(0x9fa6951b15cb699e), WORD(0x0000000075523daa),
+	/* T[20] */
+	WORD(0x529f6ff4176709a7), WORD(0xf6bb562e1ba59908),
+	WORD(0x503d66176e9d1956), WORD(0x000000008b385143),
+	WORD(0x9d118e8b483602ad), WORD(0xa716b5299b4071b8),
+	WORD(0x2498c61ec9f7b820), WORD(0x0000000018661701),
+	/* T[21] */
+	WORD(0xa655980f64e6012e), WORD(0xd7b383d15e2992b1),
+	WORD(0xbc381cb14a6ce6ef), WORD(0x0000000069ba1754),
+	WORD(0xcb7745254df6b055), WORD(0x7831ea4367f101a5),
+	WORD(0xd9bdb1b399231acb), WORD(0x000000001a91d800),
+	/* T[22] */
+	WORD(0x4b0fef061b20a4c9), WORD(0xd6ae586e8c133c83),
+	WORD(0xfe58b621eeafee1f), WORD(0x00000000fbd4ff5b),
+	WORD(0xe58e0c8fcea0b905), WORD(0x9cbe0ff0b1f32f2d),
+	WORD(0x7a4c7f4d798888fd), WORD(0x00000000192c67c2),
+	/* T[23] */
+	WORD(0xf68333c3d75096f7), WORD(0xefd29ff8c8be2d58),
+	WORD(0x8e3777e67e623b5d), WORD(0x000000000697163a),
+	WORD(0x697a621e56fb856a), WORD(0x4b053247e80f10f2),
+	WORD(0x4aaf469a3b9eaf11), WORD(0x00000000ec339639),
+	/* T[24] */
+	WORD(0xcb445d3ecbf189c3), WORD(0x11dc50ab250a26c7),
+	WORD(0x6f70491cf3dabf3a), WORD(0x0000000088a8be4e),
+	WORD(0xc2b2f510789c7f1b), WORD(0x58ea4aca2fb5b659),
+	WORD(0xc5145933ebf032d2), WORD(0x000000008996d814),
+	/* T[25] */
+	WORD(0xbaac33afe67e4028), WORD(0x3d0de16f37c674dc),
+	WORD(0x29c75b4ea4f0443e), WORD(0x000000006c150025),
+	WORD(0x58c4125aa2264f9a), WORD(0xcd5288cb4b70b4a8),
+	WORD(0x81de2d5ad635d073), WORD(0x00000000f10a3a62),
+	/* T[26] */
+	WORD(0xd1e1ff96cb053d62), WORD(0x9275329d3c73ca9a),
+	WORD(0x879785ae86570b2e), WORD(0x000000000f23161a),
+	WORD(0x72f525e415e157d0), WORD(0xa912a2b11591fcd1),
+	WORD(0x6f229893b4b8a2b8), WORD(0x00000000090d4ad4),
+	/* T[27] */
+	WORD(0x04e46ee2bb011cde), WORD(0x1d974815ebd60088),
+	WORD(0x05c971f748c3b777), WORD(0x0000000094d01d03),
+	WORD(0xc82728847d8ffa18), WORD(0xd6a9db4b86930658),
+	WORD(0x73a29b29c812d16e), WORD(0x00000000fb92c889),
+	/* T[28] */
+	WORD(0x22df604a1f010277), WORD(0x0d4652b9d03009f7),
+	WORD(0x630d80a7d0380293), WORD(0x000000000da34428),
+	WORD(0x4f6db0c3cfe377fe), WORD(0x11400fb70ec1a4a6),
+	WORD(0xcbe927552ccdd32e), WORD(0x0000000037e0f254),
+	/* T[29] */
+	WORD(0x554db4accf18249f), WORD(0xf8e76f2098a1b3a0),
+	WORD(0x87762b1a40d90a61), WORD(0x00000000d2cb8e8d),
+	WORD(0x53aa4547a68c63db), WORD(0xfc40516d9fe452b6),
+	WORD(0x1075b536f971a99c), WORD(0x0000000046a1eef5),
+	/* T[30] */
+	WORD(0x9be5dae40e1576c4), WORD(0xb07b603ac5540a9c),
+	WORD(0xcd949c8b05788850), WORD(0x00000000db91501d),
+	WORD(0x20e08e3d39f4512f), WORD(0x91437b2730f4cebf),
+	WORD(0x37fdebcad056cd5f), WORD(0x000000000350e94a),
+	/* T[31] */
+	WORD(0x1537f5ddc4c8c9a0), WORD(0xe68f728d64a719f7),
+	WORD(0x566a3bebce3da41e), WORD(0x000000004aa51585),
+	WORD(0x875462954e3e2e8c), WORD(0x1a4838a2b5af982d),
+	WORD(0x3b5dbe43c9c056a8), WORD(0x000000000348cdd6),
+};
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+static const word_t secp224r1_gen_comb[] = {
+	/* T[0] */
+	WORD(0x481c1c5d), WORD(0x18744b74), WORD(0xa48e27b5), WORD(0x1ed9e35b),
+	WORD(0x2906515c), WORD(0x80b85903), WORD(0x4a007bd8), WORD(0xd771febc),
+	WORD(0x1962fa95), WORD(0xba584e72), WORD(0x65940aef), WORD(0xf30ab6f6),
+	WORD(0xa7ea17f1), WORD(0x41dd428a),
+	/* T[1] */
+	WORD(0x535db5ad), WORD(0x53af6f6d), WORD(0x15064f29), WORD(0x267b9de9),
+	WORD(0xa38de91d), WORD(0x8743a9c9), WORD(0xb1dccc3a), WORD(0x8c2f201c),
+	WORD(0xeaf16bc3), WORD(0x7dffecb8), WORD(0xf7c4f21c), WORD(0x9764b1f7),
+	WORD(0x891ddd54), WORD(0x9ac05619),
+	/* T[2] */
+	WORD(0xb90de76a), WORD(0x0e89c32d), WORD(0x11f89c4f), WORD(0x7f99e9f4),
+	WORD(0xedf2ad22), WORD(0x61a24177), WORD(0x20231b70), WORD(0xd9d50926),
+	WORD(0xa889ad3c), WORD(0xb67db169), WORD(0x8f6c7697), WORD(0xd0cd8b9d),
+	WORD(0xc14f0505), WORD(0x1a16c7a5),
+	/* T[3] */
+	WORD(0x59642494), WORD(0xd84b34df), WORD(0x1dd2a685), WORD(0x5d5d05dd),
+	WORD(0xef8771d3), WORD(0x1cf52ee7), WORD(0xeed69afe), WORD(0xd74e3148),
+	WORD(0xb5e67ffc), WORD(0x4362f4d2), WORD(0x95173098), WORD(0xd89c5a91),
+	WORD(0x794ebda7), WORD(0xbcb8c334),
+	/* T[4] */
+	WORD(0x86f9a0e4), WORD(0x60caa8f8), WORD(0xdba7ad29), WORD(0xce54ebec),
+	WORD(0x1a434c87), WORD(0x72c6a4d0), WORD(0xc5fc0f7a), WORD(0x70b5ffd8),
+	WORD(0xad04bee8), WORD(0xa2f4bc23), WORD(0x3c82c029), WORD(0x8899e3d5),
+	WORD(0x5801370e), WORD(0x78b8b006),
+	/* T[5] */
+	WORD(0xc5b29897), WORD(0x9d7f654b), WORD(0x00db72b9), WORD(0xab3dff41),
+	WORD(0x5f5b78a6), WORD(0x45d5feb1), WORD(0xcc398d61), WORD(0x8591259f),
+	WORD(0x673aeb66), WORD(0xfe951f74), WORD(0x5e00e434), WORD(0xd09e2495),
+	WORD(0x8aaaf036), WORD(0x69f0b03d),
+	/* T[6] */
+	WORD(0xa590136e), WORD(0x7635507b), WORD(0xfbf0ca92), WORD(0x06aa1b83),
+	WORD(0x8afbbc6e), WORD(0xd1f5ad7a), WORD(0xc5443077), WORD(0xa272fa37),
+	WORD(0xcee53103), WORD(0xbdb242b4), WORD(0x4583a46e), WORD(0x33195b1f),
+	WORD(0x1bf7eb12), WORD(0x83e62345),
+	/* T[7] */
+	WORD(0xe9ae9948), WORD(0x85d6c428), WORD(0x5de39c5b), WORD(0x5f564ce4),
+	WORD(0x3ac73bd0), WORD(0xb3aea1f6), WORD(0x3d999f55), WORD(0x54be366a),
+	WORD(0xe6df1fc8), WORD(0x34244426), WORD(0xbb0418c8), WORD(0x5f96156a),
+	WORD(0x1bac1573), WORD(0x0b223632),
+	/* T[8] */
+	WORD(0x72914e80), WORD(0x6e0ace2f), WORD(0xfe7ff572), WORD(0x4232e782),
+	WORD(0xb9084cc4), WORD(0x89ba6a52), WORD(0x78571161), WORD(0xc808fb0e),
+	WORD(0xb4f189d6), WORD(0x2ce9e363), WORD(0x2d29ba94), WORD(0x36222a0d),
+	WORD(0x011882ea), WORD(0x595fa746),
+	/* T[9] */
+	WORD(0x0d4f3371), WORD(0x95fda58e), WORD(0xd7a5eab6), WORD(0xbf1d7e8e),
+	WORD(0x37ea46dd), WORD(0x96e38de3), WORD(0x8d78138a), WORD(0xbcd46124),
+	WORD(0xa39980da), WORD(0xb2235be1), WORD(0x548fc291), WORD(0x1a383d7f),
+	WORD(0x67d2ddc6), WORD(0x6cb6930e),
+	/* T[10] */
+	WORD(0x450c7a5e), WORD(0x4d870756), WORD(0x360a3fbc), WORD(0x8080944b),
+	WORD(0x81481747), WORD(0x8a3ccf38), WORD(0x5c0b3f44), WORD(0x776e1565),
+	WORD(0x9db08f3b), WORD(0x3c3a51f4), WORD(0xd1d87250), WORD(0xd9d7c80f),
+	WORD(0x4f65abf5), WORD(0x363773a4),
+	/* T[11] */
+	WORD(0x47b01cb6), WORD(0x9bf986fe), WORD(0x9c91ccda), WORD(0xaba537df),
+	WORD(0xb16e7717), WORD(0x24694dba), WORD(0x65656ad9), WORD(0x97825828),
+	WORD(0xbb28b6e3), WORD(0x3604c051), WORD(0xb42cf2b5), WORD(0x436d5c7e),
+	WORD(0x9fc890e3), WORD(0xf71fc07c),
+	/* T[12] */
+	WORD(0x034b3b73), WORD(0xe6c7bc07), WORD(0x9883f89a), WORD(0x7328f404),
+	WORD(0x24c35d74), WORD(0x5c6233a2), WORD(0x023ca0ba), WORD(0x8f45f70d),
+	WORD(0x9a4851b7), WORD(0xc99f8743), WORD(0x2c65b843), WORD(0x3cd4af5b),
+	WORD(0xbf390daa), WORD(0xca6eef83),
+	/* T[13] */
+	WORD(0x6c5309bf), WORD(0xf7e2967f), WORD(0x7c3d58c2), WORD(0x7be64f7e),
+	WORD(0x8a42dd78), WORD(0x63661de2), WORD(0xd6290908), WORD(0xec6148e2),
+	WORD(0x156386b4), WORD(0x1e532e62), WORD(0x95e680e5), WORD(0x580b4db8),
+	WORD(0xaad78d79), WORD(0x5e6abbb5),
+	/* T[14] */
+	WORD(0x87289d96), WORD(0x27b714a3), WORD(0xaf36412b), WORD(0x52d73a87),
+	WORD(0x8ccbcd35), WORD(0x1403a865), WORD(0x3f812750), WORD(0x3543ad4e),
+	WORD(0x32aeb2dd), WORD(0x4de11662), WORD(0xf5603716), WORD(0x53a5b897),
+	WORD(0xcbff984b), WORD(0x3e255742),
+	/* T[15] */
+	WORD(0x74159d6d), WORD(0x804c4f88), WORD(0x251e563c), WORD(0x638f82a6),
+	WORD(0xd6f1e650), WORD(0xa66062a0), WORD(0x7735adab), WORD(0x8382cc0d),
+	WORD(0x08c389c5), WORD(0x83d2badb), WORD(0x432fccd8), WORD(0x486941e9),
+	WORD(0xca44a600), WORD(0xc9119335),
+	/* T[16] */
+	WORD(0x97d9363b), WORD(0xd5e8b550), WORD(0x5ad25287), WORD(0x935bff64),
+	WORD(0xaf894570), WORD(0x37f035f6), WORD(0x42d4694e), WORD(0xa0b1f8fc),
+	WORD(0x20b2ee05), WORD(0xde12042a), WORD(0x465f1935), WORD(0x654b5190),
+	WORD(0x9d9f81df), WORD(0x587b3b9c),
+	/* T[17] */
+	WORD(0x43d35ff6), WORD(0x753d3447), WORD(0x881e9319), WORD(0xa9dedc3a),
+	WORD(0xfb0b4563), WORD(0x52354114), WORD(0x64689b80), WORD(0x516d0ff0),
+	WORD(0x0d95f49f), WORD(0xbb68e6d0), WORD(0x0d486e90), WORD(0xf20797d1),
+	WORD(0x1f3adb53), WORD(0x794b7872),
+	/* T[18] */
+	WORD(0x7dc5fc83), WORD(0xcfa87356), WORD(0x1c9d0ba3), WORD(0xf2fb83b5),
+	WORD(0xb90e5b30), WORD(0x4f00cb46), WORD(0x2f05252d), WORD(0xa115ee2f),
+	WORD(0xab52fad9), WORD(0xadb0041a), WORD(0x030689d8), WORD(0xd1701af5),
+	WORD(0xa5f371f3), WORD(0x8240dfca),
+	/* T[19] */
+	WORD(0xb4fb4114), WORD(0xe067166b), WORD(0x9042574e), WORD(0x20f6c03f),
+	WORD(0x9d1b3eb6), WORD(0x3c647750), WORD(0x783cea72), WORD(0x84efc61a),
+	WORD(0x2738b8a4), WORD(0x76be009e), WORD(0x15cb699e), WORD(0x9fa6951b),
+	WORD(0x75523daa), WORD(0x7b7e812a),
+	/* T[20] */
+	WORD(0x529f6ff5), WORD(0x1ba59908), WORD(0x0e225fd5), WORD(0x6e9d1956),
+	WORD(0x503d6617), WORD(0x8b385143), WORD(0xe898f659), WORD(0x9d118e8c),
+	WORD(0x9b4071b8), WORD(0xef4cb7d6), WORD(0xc9f7b81f), WORD(0x2498c61e),
+	WORD(0x18661701), WORD(0xb7c9fd53),
+	/* T[21] */
+	WORD(0xa6559810), WORD(0x5e2992b1), WORD(0x3c9984ff), WORD(0x4a6ce6ef),
+	WORD(0xbc381cb1), WORD(0x69ba1754), WORD(0x9b19fed2), WORD(0xcb774526),
+	WORD(0x67f101a5), WORD(0xc6289a98), WORD(0x99231aca), WORD(0xd9bdb1b3),
+	WORD(0x1a91d800), WORD(0xb2094fab),
+	/* T[22] */
+	WORD(0x4b0fef07), WORD(0x8c133c83), WORD(0xf1cefd37), WORD(0xeeafee1e),
+	WORD(0xfe58b621), WORD(0xfbd4ff5b), WORD(0xe4df5b37), WORD(0xe58e0c90),
+	WORD(0xb1f32f2d), WORD(0x6b5ec8f5), WORD(0x798888fd), WORD(0x7a4c7f4d),
+	WORD(0x192c67c2), WORD(0x315f46fb),
+	/* T[23] */
+	WORD(0xf68333c4), WORD(0xc8be2d58), WORD(0xc72336ef), WORD(0x7e623b5d),
+	WORD(0x8e3777e6), WORD(0x0697163a), WORD(0x28af6909), WORD(0x697a621f),
+	WORD(0xe80f10f2), WORD(0xa200b7b1), WORD(0x3b9eaf10), WORD(0x4aaf469a),
+	WORD(0xec339639), WORD(0xa9047a96),
+	/* T[24] */
+	WORD(0xcb445d3f), WORD(0x250a26c7), WORD(0xddcdda6e), WORD(0xf3dabf39),
+	WORD(0x6f70491c), WORD(0x88a8be4e), WORD(0x340e763d), WORD(0xc2b2f511),
+	WORD(0x2fb5b659), WORD(0xd186c9e5), WORD(0xebf032d1), WORD(0xc5145933),
+	WORD(0x8996d814), WORD(0x876380e5),
+	/* T[25] */
+	WORD(0xbaac33b0), WORD(0x37c674dc), WORD(0x238c2197), WORD(0xa4f0443e),
+	WORD(0x29c75b4e), WORD(0x6c150025), WORD(0x1981bfd8), WORD(0x58c4125b),
+	WORD(0x4b70b4a8), WORD(0x6f78d865), WORD(0xd635d073), WORD(0x81de2d5a),
+	WORD(0xf10a3a62), WORD(0x5dd9b066),
+	/* T[26] */
+	WORD(0xd1e1ff97), WORD(0x3c73ca9a), WORD(0x5d7a6fff), WORD(0x86570b2e),
+	WORD(0x879785ae), WORD(0x0f23161a), WORD(0x34fac29e), WORD(0x72f525e5),
+	WORD(0x1591fcd1), WORD(0xbef3fa81), WORD(0xb4b8a2b7), WORD(0x6f229893),
+	WORD(0x090d4ad4), WORD(0xea1ea830),
+	/* T[27] */
+	WORD(0x04e46ee3), WORD(0xebd60088), WORD(0xd89864f3), WORD(0x48c3b776),
+	WORD(0x05c971f7), WORD(0x94d01d03), WORD(0x44fee322), WORD(0xc8272885),
+	WORD(0x86930658), WORD(0x5439d563), WORD(0xc812d16e), WORD(0x73a29b29),
+	WORD(0xfb92c889), WORD(0x827005e8),
+	/* T[28] */
+	WORD(0x22df604b), WORD(0xd03009f7), WORD(0x2c475530), WORD(0xd0380292),
+	WORD(0x630d80a7), WORD(0x0da34428), WORD(0xe0fefd89), WORD(0x4f6db0c4),
+	WORD(0x0ec1a4a6), WORD(0xe12387b5), WORD(0x2ccdd32d), WORD(0xcbe92755),
+	WORD(0x37e0f254), WORD(0x301c8802),
+	/* T[29] */
+	WORD(0x554db4ad), WORD(0x98a1b3a0), WORD(0xc7ff93bf), WORD(0x40d90a61),
+	WORD(0x87762b1a), WORD(0xd2cb8e8d), WORD(0x30e7db61), WORD(0x53aa4548),
+	WORD(0x9fe452b6), WORD(0xa2ccb548), WORD(0xf971a99c), WORD(0x1075b536),
+	WORD(0x46a1eef5), WORD(0x59739c25),
+	/* T[30] */
+	WORD(0x9be5dae5), WORD(0xc5540a9c), WORD(0xbe90d6fe), WORD(0x0578884f),
+	WORD(0xcd949c8b), WORD(0xdb91501d), WORD(0xf1ea893c), WORD(0x20e08e3e),
+	WORD(0x30f4cebf), WORD(0xcb37cc56), WORD(0xd056cd5e), WORD(0x37fdebca),
+	WORD(0x0350e94a), WORD(0xc60baed1),
+	/* T[31] */
+	WORD(0x1537f5de), WORD(0x64a719f7), WORD(0xab583c2d), WORD(0xce3da41e),
+	WORD(0x566a3beb), WORD(0x4aa51585), WORD(0x3b373660), WORD(0x87546296),
+	WORD(0xb5af982d), WORD(0x6886672e), WORD(0xc9c056a7), WORD(0x3b5dbe43),
+	WORD(0x0348cdd6), WORD(0xb1c1d174),
+};
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+static const word_t secp224r1_gen_comb[] = {
+	/* T[0] */
+	WORD(0x1c5d), WORD(0x481c), WORD(0x4b74), WORD(0x1874), WORD(0x27b5), WORD(0xa48e),
+	WORD(0xe35b), WORD(0x1ed9), WORD(0x515c), WORD(0x2906), WORD(0x5903), WORD(0x80b8),
+	WORD(0x7bd8), WORD(0x4a00), WORD(0xfebc), WORD(0xd771), WORD(0xfa95), WORD(0x1962),
+	WORD(0x4e72), WORD(0xba58), WORD(0x0aef), WORD(0x6594), WORD(0xb6f6), WORD(0xf30a),
+	WORD(0x17f1), WORD(0xa7ea), WORD(0x428a), WORD(0x41dd),
+	/* T[1] */
+	WORD(0xb5ad), WORD(0x535d), WORD(0x6f6d), WORD(0x53af), WORD(0x4f29), WORD(0x1506),
+	WORD(0x9de9), WORD(0x267b), WORD(0xe91d), WORD(0xa38d), WORD(0xa9c9), WORD(0x8743),
+	WORD(0xcc3a), WORD(0xb1dc), WORD(0x201c), WORD(0x8c2f), WORD(0x6bc3), WORD(0xeaf1),
+	WORD(0xecb8), WORD(0x7dff), WORD(0xf21c), WORD(0xf7c4), WORD(0xb1f7), WORD(0x9764),
+	WORD(0xdd54), WORD(0x891d), WORD(0x5619), WORD(0x9ac0),
+	/* T[2] */
+	WORD(0xe76a), WORD(0xb90d), WORD(0xc32d), WORD(0x0e89), WORD(0x9c4f), WORD(0x11f8),
+	WORD(0xe9f4), WORD(0x7f99), WORD(0xad22), WORD(0xedf2), WORD(0x4177), WORD(0x61a2),
+	WORD(0x1b70), WORD(0x2023), WORD(0x0926), WORD(0xd9d5), WORD(0xad3c), WORD(0xa889),
+	WORD(0xb169), WORD(0xb67d), WORD(0x7697), WORD(0x8f6c), WORD(0x8b9d), WORD(0xd0cd),
+	WORD(0x0505), WORD(0xc14f), WORD(0xc7a5), WORD(0x1a16),
+	/* T[3] */
+	WORD(0x2494), WORD(0x5964), WORD(0x34df), WORD(0xd84b), WORD(0xa685), WORD(0x1dd2),
+	WORD(0x05dd), WORD(0x5d5d), WORD(0x71d3), WORD(0xef87), WORD(0x2ee7), WORD(0x1cf5),
+	WORD(0x9afe), WORD(0xeed6), WORD(0x3148), WORD(0xd74e), WORD(0x7ffc), WORD(0xb5e6),
+	WORD(0xf4d2), WORD(0x4362), WORD(0x3098), WORD(0x9517), WORD(0x5a91), WORD(0xd89c),
+	WORD(0xbda7), WORD(0x794e), WORD(0xc334), WORD(0xbcb8),
+	/* T[4] */
+	WORD(0xa0e4), WORD(0x86f9), WORD(0xa8f8), WORD(0x60ca), WORD(0xad29), WORD(0xdba7),
+	WORD(0xebec), WORD(0xce54), WORD(0x4c87), WORD(0x1a43), WORD(0xa4d0), WORD(0x72c6),
+	WORD(0x0f7a), WORD(0xc5fc), WORD(0xffd8), WORD(0x70b5), WORD(0xbee8), WORD(0xad04),
+	WORD(0xbc23), WORD(0xa2f4), WORD(0xc029), WORD(0x3c82), WORD(0xe3d5), WORD(0x8899),
+	WORD(0x370e), WORD(0x5801), WORD(0xb006), WORD(0x78b8),
+	/* T[5] */
+	WORD(0x9897), WORD(0xc5b2), WORD(0x654b), WORD(0x9d7f), WORD(0x72b9), WORD(0x00db),
+	WORD(0xff41), WORD(0xab3d), WORD(0x78a6), WORD(0x5f5b), WORD(0xfeb1), WORD(0x45d5),
+	WORD(0x8d61), WORD(0xcc39), WORD(0x259f), WORD(0x8591), WORD(0xeb66), WORD(0x673a),
+	WORD(0x1f74), WORD(0xfe95), WORD(0xe434), WORD(0x5e00), WORD(0x2495), WORD(0xd09e),
+	WORD(0xf036), WORD(0x8aaa), WORD(0xb03d), WORD(0x69f0),
+	/* T[6] */
+	WORD(0x136e), WORD(0xa590), WORD(0x507b), WORD(0x7635), WORD(0xca92), WORD(0xfbf0),
+	WORD(0x1b83), WORD(0x06aa), WORD(0xbc6e), WORD(0x8afb), WORD(0xad7a), WORD(0xd1f5),
+	WORD(0x3077), WORD(0xc544), WORD(0xfa37), WORD(0xa272), WORD(0x3103), WORD(0xcee5),
+	WORD(0x42b4), WORD(0xbdb2), WORD(0xa46e), WORD(0x4583), WORD(0x5b1f), WORD(0x3319),
+	WORD(0xeb12), WORD(0x1bf7), WORD(0x2345), WORD(0x83e6),
+	/* T[7] */
+	WORD(0x9948), WORD(0xe9ae), WORD(0xc428), WORD(0x85d6), WORD(0x9c5b), WORD(0x5de3),
+	WORD(0x4ce4), WORD(0x5f56), WORD(0x3bd0), WORD(0x3ac7), WORD(0xa1f6), WORD(0xb3ae),
+	WORD(0x9f55), WORD(0x3d99), WORD(0x366a), WORD(0x54be), WORD(0x1fc8), WORD(0xe6df),
+	WORD(0x4426), WORD(0x3424), WORD(0x18c8), WORD(0xbb04), WORD(0x156a), WORD(0x5f96),
+	WORD(0x1573), WORD(0x1bac), WORD(0x3632), WORD(0x0b22),
+	/* T[8] */
+	WORD(0x4e80), WORD(0x7291), WORD(0xce2f), WORD(0x6e0a), WORD(0xf572), WORD(0xfe7f),
+	WORD(0xe782), WORD(0x4232), WORD(0x4cc4), WORD(0xb908), WORD(0x6a52), WORD(0x89ba),
+	WORD(0x1161), WORD(0x7857), WORD(0xfb0e), WORD(0xc808), WORD(0x89d6), WORD(0xb4f1),
+	WORD(0xe363), WORD(0x2ce9), WORD(0xba94), WORD(0x2d29), WORD(0x2a0d), WORD(0x3622),
+	WORD(0x82ea), WORD(0x0118), WORD(0xa746), WORD(0x595f),
+	/* T[9] */
+	WORD(0x3371), WORD(0x0d4f), WORD(0xa58e), WORD(0x95fd), WORD(0xeab6), WORD(0xd7a5),
+	WORD(0x7e8e), WORD(0xbf1d), WORD(0x46dd), WORD(0x37ea), WORD(0x8de3), WORD(0x96e3),
+	WORD(0x138a), WORD(0x8d78), WORD(0x6124), WORD(0xbcd4), WORD(0x80da), WORD(0xa399),
+	WORD(0x5be1), WORD(0xb223), WORD(0xc291), WORD(0x548f), WORD(0x3d7f), WORD(0x1a38),
+	WORD(0xddc6), WORD(0x67d2), WORD(0x930e), WORD(0x6cb6),
+	/* T[10] */
+	WORD(0x7a5e), WORD(0x450c), WORD(0x0756), WORD(0x4d87), WORD(0x3fbc), WORD(0x360a),
+	WORD(0x944b), WORD(0x8080), WORD(0x1747), WORD(0x8148), WORD(0xcf38), WORD(0x8a3c),
+	WORD(0x3f44), WORD(0x5c0b), WORD(0x1565), WORD(0x776e), WORD(0x8f3b), WORD(0x9db0),
+	WORD(0x51f4), WORD(0x3c3a), WORD(0x7250), WORD(0xd1d8), WORD(0xc80f), WORD(0xd9d7),
+	WORD(0xabf5), WORD(0x4f65), WORD(0x73a4), WORD(0x3637),
+	/* T[11] */
+	WORD(0x1cb6), WORD(0x47b0), WORD(0x86fe), WORD(0x9bf9), WORD(0xccda), WORD(0x9c91),
+	WORD(0x37df), WORD(0xaba5), WORD(0x7717), WORD(0xb16e), WORD(0x4dba), WORD(0x2469),
+	WORD(0x6ad9), WORD(0x6565), WORD(0x5828), WORD(0x9782), WORD(0xb6e3), WORD(0xbb28),
+	WORD(0xc051), WORD(0x3604), WORD(0xf2b5), WORD(0xb42c), WORD(0x5c7e), WORD(0x436d),
+	WORD(0x90e3), WORD(0x9fc8), WORD(0xc07c), WORD(0xf71f),
+	/* T[12] */
+	WORD(0x3b73), WORD(0x034b), WORD(0xbc07), WORD(0xe6c7), WORD(0xf89a), WORD(0x9883),
+	WORD(0xf404), WORD(0x7328), WORD(0x5d74), WORD(0x24c3), WORD(0x33a2), WORD(0x5c62),
+	WORD(0xa0ba), WORD(0x023c), WORD(0xf70d), WORD(0x8f45), WORD(0x51b7), WORD(0x9a48),
+	WORD(0x8743), WORD(0xc99f), WORD(0xb843), WORD(0x2c65), WORD(0xaf5b), WORD(0x3cd4),
+	WORD(0x0daa), WORD(0xbf39), WORD(0xef83), WORD(0xca6e),
+	/* T[13] */
+	WORD(0x09bf), WORD(0x6c53), WORD(0x967f), WORD(0xf7e2), WORD(0x58c2), WORD(0x7c3d),
+	WORD(0x4f7e), WORD(0x7be6), WORD(0xdd78), WORD(0x8a42), WORD(0x1de2), WORD(0x6366),
+	WORD(0x0908), WORD(0xd629), WORD(0x48e2), WORD(0xec61), WORD(0x86b4), WORD(0x1563),
+	WORD(0x2e62), WORD(0x1e53), WORD(0x80e5), WORD(0x95e6), WORD(0x4db8), WORD(0x580b),
+	WORD(0x8d79), WORD(0xaad7), WORD(0xbbb5), WORD(0x5e6a),
+	/* T[14] */
+	WORD(0x9d96), WORD(0x8728), WORD(0x14a3), WORD(0x27b7), WORD(0x412b), WORD(0xaf36),
+	WORD(0x3a87), WORD(0x52d7), WORD(0xcd35), WORD(0x8ccb), WORD(0xa865), WORD(0x1403),
+	WORD(0x2750), WORD(0x3f81), WORD(0xad4e), WORD(0x3543), WORD(0xb2dd), WORD(0x32ae),
+	WORD(0x1662), WORD(0x4de1), WORD(0x3716), WORD(0xf560), WORD(0xb897), WORD(0x53a5),
+	WORD(0x984b), WORD(0xcbff), WORD(0x5742), WORD(0x3e25),
+	/* T[15] */
+	WORD(0x9d6d), WORD(0x7415), WORD(0x4f88), WORD(0x804c), WORD(0x563c), WORD(0x251e),
+	WORD(0x82a6), WORD(0x638f), WORD(0xe650), WORD(0xd6f1), WORD(0x62a0), WORD(0xa660),
+	WORD(0xadab), WORD(0x7735), WORD(0xcc0d), WORD(0x8382), WORD(0x89c5), WORD(0x08c3),
+	WORD(0xbadb), WORD(0x83d2), WORD(0xccd8), WORD(0x432f), WORD(0x41e9), WORD(0x4869),
+	WORD(0xa600), WORD(0xca44), WORD(0x9335), WORD(0xc911),
+	/* T[16] */
+	WORD(0x363b), WORD(0x97d9), WORD(0xb550), WORD(0xd5e8), WORD(0x5287), WORD(0x5ad2),
+	WORD(0xff64), WORD(0x935b), WORD(0x4570), WORD(0xaf89), WORD(0x35f6), WORD(0x37f0),
+	WORD(0x694e), WORD(0x42d4), WORD(0xf8fc), WORD(0xa0b1), WORD(0xee05), WORD(0x20b2),
+	WORD(0x042a), WORD(0xde12), WORD(0x1935), WORD(0x465f), WORD(0x5190), WORD(0x654b),
+	WORD(0x81df), WORD(0x9d9f), WORD(0x3b9c), WORD(0x587b),
+	/* T[17] */
+	WORD(0x5ff6), WORD(0x43d3), WORD(0x3447), WORD(0x753d), WORD(0x9319), WORD(0x881e),
+	WORD(0xdc3a), WORD(0xa9de), WORD(0x4563), WORD(0xfb0b), WORD(0x4114), WORD(0x5235),
+	WORD(0x9b80), WORD(0x6468), WORD(0x0ff0), WORD(0x516d), WORD(0xf49f), WORD(0x0d95),
+	WORD(0xe6d0), WORD(0xbb68), WORD(0x6e90), WORD(0x0d48), WORD(0x97d1), WORD(0xf207),
+	WORD(0xdb53), WORD(0x1f3a), WORD(0x7872), WORD(0x794b),
+	/* T[18] */
+	WORD(0xfc83), WORD(0x7dc5), WORD(0x7356), WORD(0xcfa8), WORD(0x0ba3), WORD(0x1c9d),
+	WORD(0x83b5), WORD(0xf2fb), WORD(0x5b30), WORD(0xb90e), WORD(0xcb46), WORD(0x4f00),
+	WORD(0x252d), WORD(0x2f05), WORD(0xee2f), WORD(0xa115), WORD(0xfad9), WORD(0xab52),
+	WORD(0x041a), WORD(0xadb0), WORD(0x89d8), WORD(0x0306), WORD(0x1af5), WORD(0xd170),
+	WORD(0x71f3), WORD(0xa5f3), WORD(0xdfca), WORD(0x8240),
+	/* T[19] */
+	WORD(0x4114), WORD(0xb4fb), WORD(0x166b), WORD(0xe067), WORD(0x574e), WORD(0x9042),
+	WORD(0xc03f), WORD(0x20f6), WORD(0x3eb6), WORD(0x9d1b), WORD(0x7750), WORD(0x3c64),
+	WORD(0xea72), WORD(0x783c), WORD(0xc61a), WORD(0x84ef), WORD(0xb8a4), WORD(0x2738),
+	WORD(0x009e), WORD(0x76be), WORD(0x699e), WORD(0x15cb), WORD(0x951b), WORD(0x9fa6),
+	WORD(0x3daa), WORD(0x7552), WORD(0x812a), WORD(0x7b7e),
+	/* T[20] */
+	WORD(0x6ff5), WORD(0x529f), WORD(0x9908), WORD(0x1ba5), WORD(0x5fd5), WORD(0x0e22),
+	WORD(0x1956), WORD(0x6e9d), WORD(0x6617), WORD(0x503d), WORD(0x5143), WORD(0x8b38),
+	WORD(0xf659), WORD(0xe898), WORD(0x8e8c), WORD(0x9d11), WORD(0x71b8), WORD(0x9b40),
+	WORD(0xb7d6), WORD(0xef4c), WORD(0xb81f), WORD(0xc9f7), WORD(0xc61e), WORD(0x2498),
+	WORD(0x1701), WORD(0x1866), WORD(0xfd53), WORD(0xb7c9),
+	/* T[21] */
+	WORD(0x9810), WORD(0xa655), WORD(0x92b1), WORD(0x5e29), WORD(0x84ff), WORD(0x3c99),
+	WORD(0xe6ef), WORD(0x4a6c), WORD(0x1cb1), WORD(0xbc38), WORD(0x1754), WORD(0x69ba),
+	WORD(0xfed2), WORD(0x9b19), WORD(0x4526), WORD(0xcb77), WORD(0x01a5), WORD(0x67f1),
+	WORD(0x9a98), WORD(0xc628), WORD(0x1aca), WORD(0x9923), WORD(0xb1b3), WORD(0xd9bd),
+	WORD(0xd800), WORD(0x1a91), WORD(0x4fab), WORD(0xb209),
+	/* T[22] */
+	WORD(0xef07), WORD(0x4b0f), WORD(0x3c83), WORD(0x8c13), WORD(0xfd37), WORD(0xf1ce),
+	WORD(0xee1e), WORD(0xeeaf), WORD(0xb621), WORD(0xfe58), WORD(0xff5b), WORD(0xfbd4),
+	WORD(0x5b37), WORD(0xe4df), WORD(0x0c90), WORD(0xe58e), WORD(0x2f2d), WORD(0xb1f3),
+	WORD(0xc8f5), WORD(0x6b5e), WORD(0x88fd), WORD(0x7988), WORD(0x7f4d), WORD(0x7a4c),
+	WORD(0x67c2), WORD(0x192c), WORD(0x46fb), WORD(0x315f),
+	/* T[23] */
+	WORD(0x33c4), WORD(0xf683), WORD(0x2d58), WORD(0xc8be), WORD(0x36ef), WORD(0xc723),
+	WORD(0x3b5d), WORD(0x7e62), WORD(0x77e6), WORD(0x8e37), WORD(0x163a), WORD(0x0697),
+	WORD(0x6909), WORD(0x28af), WORD(0x621f), WORD(0x697a), WORD(0x10f2), WORD(0xe80f),
+	WORD(0xb7b1), WORD(0xa200), WORD(0xaf10), WORD(0x3b9e), WORD(0x469a), WORD(0x4aaf),
+	WORD(0x9639), WORD(0xec33), WORD(0x7a96), WORD(0xa904),
+	/* T[24] */
+	WORD(0x5d3f), WORD(0xcb44), WORD(0x26c7), WORD(0x250a), WORD(0xda6e), WORD(0xddcd),
+	WORD(0xbf39), WORD(0xf3da), WORD(0x491c), WORD(0x6f70), WORD(0xbe4e), WORD(0x88a8),
+	WORD(0x763d), WORD(0x340e), WORD(0xf511), WORD(0xc2b2), WORD(0xb659), WORD(0x2fb5),
+	WORD(0xc9e5), WORD(0xd186), WORD(0x32d1), WORD(0xebf0), WORD(0x5933), WORD(0xc514),
+	WORD(0xd814), WORD(0x8996), WORD(0x80e5), WORD(0x8763),
+	/* T[25] */
+	WORD(0x33b0), WORD(0xbaac), WORD(0x74dc), WORD(0x37c6), WORD(0x2197), WORD(0x238c),
+	WORD(0x443e), WORD(0xa4f0), WORD(0x5b4e), WORD(0x29c7), WORD(0x0025), WORD(0x6c15),
+	WORD(0xbfd8), WORD(0x1981), WORD(0x125b), WORD(0x58c4), WORD(0xb4a8), WORD(0x4b70),
+	WORD(0xd865), WORD(0x6f78), WORD(0xd073), WORD(0xd635), WORD(0x2d5a), WORD(0x81de),
+	WORD(0x3a62), WORD(0xf10a), WORD(0xb066), WORD(0x5dd9),
+	/* T[26] */
+	WORD(0xff97), WORD(0xd1e1), WORD(0xca9a), WORD(0x3c73), WORD(0x6fff), WORD(0x5d7a),
+	WORD(0x0b2e), WORD(0x8657), WORD(0x85ae), WORD(0x8797), WORD(0x161a), WORD(0x0f23),
+	WORD(0xc29e), WORD(0x34fa), WORD(0x25e5), WORD(0x72f5), WORD(0xfcd1), WORD(0x1591),
+	WORD(0xfa81), WORD(0xbef3), WORD(0xa2b7), WORD(0xb4b8), WORD(0x9893), WORD(0x6f22),
+	WORD(0x4ad4), WORD(0x090d), WORD(0xa830), WORD(0xea1e),
+	/* T[27] */
+	WORD(0x6ee3), WORD(0x04e4), WORD(0x0088), WORD(0xebd6), WORD(0x64f3), WORD(0xd898),
+	WORD(0xb776), WORD(0x48c3), WORD(0x71f7), WORD(0x05c9), WORD(0x1d03), WORD(0x94d0),
+	WORD(0xe322), WORD(0x44fe), WORD(0x2885), WORD(0xc827), WORD(0x0658), WORD(0x8693),
+	WORD(0xd563), WORD(0x5439), WORD(0xd16e), WORD(0xc812), WORD(0x9b29), WORD(0x73a2),
+	WORD(0xc889), WORD(0xfb92), WORD(0x05e8), WORD(0x8270),
+	/* T[28] */
+	WORD(0x604b), WORD(0x22df), WORD(0x09f7), WORD(0xd030), WORD(0x5530), WORD(0x2c47),
+	WORD(0x0292), WORD(0xd038), WORD(0x80a7), WORD(0x630d), WORD(0x4428), WORD(0x0da3),
+	WORD(0xfd89), WORD(0xe0fe), WORD(0xb0c4), WORD(0x4f6d), WORD(0xa4a6), WORD(0x0ec1),
+	WORD(0x87b5), WORD(0xe123), WORD(0xd32d), WORD(0x2ccd), WORD(0x2755), WORD(0xcbe9),
+	WORD(0xf254), WORD(0x37e0), WORD(0x8802), WORD(0x301c),
+	/* T[29] */
+	WORD(0xb4ad), WORD(0x554d), WORD(0xb3a0), WORD(0x98a1), WORD(0x93bf), WORD(0xc7ff),
+	WORD(0x0a61), WORD(0x40d9), WORD(0x2b1a), WORD(0x8776), WORD(0x8e8d), WORD(0xd2cb),
+	WORD(0xdb61), WORD(0x30e7), WORD(0x4548), WORD(0x53aa), WORD(0x52b6), WORD(0x9fe4),
+	WORD(0xb548), WORD(0xa2cc), WORD(0xa99c), WORD(0xf971), WORD(0xb536), WORD(0x1075),
+	WORD(0xeef5), WORD(0x46a1), WORD(0x9c25), WORD(0x5973),
+	/* T[30] */
+	WORD(0xdae5), WORD(0x9be5), WORD(0x0a9c), WORD(0xc554), WORD(0xd6fe), WORD(0xbe90),
+	WORD(0x884f), WORD(0x0578), WORD(0x9c8b), WORD(0xcd94), WORD(0x501d), WORD(0xdb91),
+	WORD(0x893c), WORD(0xf1ea), WORD(0x8e3e), WORD(0x20e0), WORD(0xcebf), WORD(0x30f4),
+	WORD(0xcc56), WORD(0xcb37), WORD(0xcd5e), WORD(0xd056), WORD(0xebca), WORD(0x37fd),
+	WORD(0xe94a), WORD(0x0350), WORD(0xaed1), WORD(0xc60b),
+	/* T[31] */
+	WORD(0xf5de), WORD(0x1537), WORD(0x19f7), WORD(0x64a7), WORD(0x3c2d), WORD(0xab58),
+	WORD(0xa41e), WORD(0xce3d), WORD(0x3beb), WORD(0x566a), WORD(0x1585), WORD(0x4aa5),
+	WORD(0x3660), WORD(0x3b37), WORD(0x6296), WORD(0x8754), WORD(0x982d), WORD(0xb5af),
+	WORD(0x672e), WORD(0x6886), WORD(0x56a7), WORD(0xc9c0), WORD(0xbe43), WORD(0x3b5d),
+	WORD(0xcdd6), WORD(0x0348), WORD(0xd174), WORD(0xb1c1),
+};
+#else                     /* unknown word size */
+#error "Unsupported word size"
+#endif
+TO_EC_GEN_TABLE_PARAM(secp224r1_gen_comb, 6);
+
 static const ec_str_params secp224r1_str_params = {
 	.p = &secp224r1_p_str_param,
 	.p_bitlen = &secp224r1_p_bitlen_str_param,
@@ -234,6 +1354,10 @@ static const ec_str_params secp224r1_str_params = {
 	.cofactor = &secp224r1_cofactor_str_param,
 	.oid = &secp224r1_oid_str_param,
 	.name = &secp224r1_name_str_param,
+	.p_inv_chain = &secp224r1_p_inv_chain_param,
+	.q_inv_chain = &secp224r1_q_inv_chain_param,
+	.gen_wnaf_table = &secp224r1_gen_wnaf_table_param,
+	.gen_comb_table = &secp224r1_gen_comb_table_param,
 };
 
 /*
@@ -248,6 +1372,17 @@ static const ec_str_params secp224r1_str_params = {
 #define CURVES_MAX_Q_BIT_LEN CURVE_SECP224R1_Q_BITLEN
 #endif
 
+/*
+ * Limb count of p for the fixed limbs field backend (see fp_fixed.h)
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+#define FP_FIXED_WLEN_4_USED
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+#define FP_FIXED_WLEN_7_USED
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+#define FP_FIXED_WLEN_14_USED
+#endif
+
 #endif /* __EC_PARAMS_SECP224R1_H__ */
 
 #endif /* WITH_CURVE_SECP224R1 */
@@ -153,6 +153,1206 @@ TO_EC_STR_PARAM(secp256r1_oid);
 static const u8 secp256r1_name[] = "SECP256R1";
 TO_EC_STR_PARAM(secp256r1_name);
 
+/* x^(p - 2): 255 squarings and 13 multiplications */
+static const u8 secp256r1_p_inv[] = {
+	0x10, 0x01, 0x00,
+	0x21, 0x02, 0x01,
+	0x32, 0x04, 0x02,
+	0x43, 0x08, 0x03,
+	0x54, 0x10, 0x04,
+	0x65, 0x20, 0x00,
+	0x66, 0x80, 0x05,
+	0x66, 0x20, 0x05,
+	0x66, 0x10, 0x04,
+	0x66, 0x08, 0x03,
+	0x66, 0x04, 0x02,
+	0x66, 0x02, 0x01,
+	0x66, 0x02, 0x00,
+};
+TO_EC_CHAIN_PARAM(secp256r1_p_inv);
+
+/* x^((p + 1) / 4): 253 squarings and 7 multiplications */
+static const u8 secp256r1_p_sqrt[] = {
+	0x10, 0x01, 0x00,
+	0x21, 0x02, 0x01,
+	0x32, 0x04, 0x02,
+	0x43, 0x08, 0x03,
+	0x54, 0x10, 0x04,
+	0x55, 0x20, 0x00,
+	0x55, 0x60, 0x00,
+	0x55, 0x5e, 0xff,
+};
+TO_EC_CHAIN_PARAM(secp256r1_p_sqrt);
+
+/* x^(q - 2): 256 squarings and 39 multiplications */
+static const u8 secp256r1_q_inv[] = {
+	0x10, 0x01, 0x00,
+	0x21, 0x02, 0x01,
+	0x32, 0x04, 0x02,
+	0x43, 0x08, 0x03,
+	0x54, 0x10, 0x04,
+	0x60, 0x01, 0xff,
+	0x71, 0x00, 0x06,
+	0x87, 0x00, 0x06,
+	0x98, 0x00, 0x06,
+	0xa9, 0x00, 0x06,
+	0xba, 0x00, 0x06,
+	0xc5, 0x40, 0x05,
+	0xcc, 0x20, 0x05,
+	0xcc, 0x01, 0x00,
+	0xcc, 0x05, 0x02,
+	0xcc, 0x05, 0x08,
+	0xcc, 0x06, 0x0b,
+	0xcc, 0x04, 0x02,
+	0xcc, 0x04, 0x07,
+	0xcc, 0x05, 0x0a,
+	0xcc, 0x05, 0x0b,
+	0xcc, 0x05, 0x08,
+	0xcc, 0x07, 0x0a,
+	0xcc, 0x02, 0x01,
+	0xcc, 0x06, 0x02,
+	0xcc, 0x02, 0x00,
+	0xcc, 0x08, 0x09,
+	0xcc, 0x03, 0x08,
+	0xcc, 0x05, 0x08,
+	0xcc, 0x04, 0x08,
+	0xcc, 0x05, 0x08,
+	0xcc, 0x05, 0x07,
+	0xcc, 0x03, 0x01,
+	0xcc, 0x08, 0x0a,
+	0xcc, 0x04, 0x02,
+	0xcc, 0x05, 0x01,
+	0xcc, 0x05, 0x01,
+	0xcc, 0x06, 0x09,
+	0xcc, 0x04, 0x07,
+	0xcc, 0x06, 0x02,
+};
+TO_EC_CHAIN_PARAM(secp256r1_q_inv);
+
+/*
+ * Odd multiples G, 3G, ..., 63G of the generator for the wNAF
+ * multiplications (window 7), affine x and y in Montgomery representation
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+static const word_t secp256r1_gen_wnaf[] = {
+	/* G */
+	WORD(0x79e730d418a9143c), WORD(0x75ba95fc5fedb601),
+	WORD(0x79fb732b77622510), WORD(0x18905f76a53755c6),
+	WORD(0xddf25357ce95560a), WORD(0x8b4ab8e4ba19e45c),
+	WORD(0xd2e88688dd21f325), WORD(0x8571ff1825885d85),
+	/* 3G */
+	WORD(0xffac3f904eebc127), WORD(0xb027f84a087d81fb),
+	WORD(0x66ad77dd87cbbc98), WORD(0x26936a3fb6ff747e),
+	WORD(0xb04c5c1fc983a7eb), WORD(0x583e47ad0861fe1a),
+	WORD(0x788208311a2ee98e), WORD(0xd5f06a29e587cc07),
+	/* 5G */
+	WORD(0xbe1b8aaec45c61f5), WORD(0x90ec649a94b9537d),
+	WORD(0x941cb5aad076c20c), WORD(0xc9079605890523c8),
+	WORD(0xeb309b4ae7ba4f10), WORD(0x73c568efe5eb882b),
+	WORD(0x3540a9877e7a1f68), WORD(0x73a076bb2dd1e916),
+	/* 7G */
+	WORD(0x0746354ea0173b4f), WORD(0x2bd20213d23c00f7),
+	WORD(0xf43eaab50c23bb08), WORD(0x13ba5119c3123e03),
+	WORD(0x2847d0303f5b9d4d), WORD(0x6742f2f25da67bdd),
+	WORD(0xef933bdc77c94195), WORD(0xeaedd9156e240867),
+	/* 9G */
+	WORD(0x75c96e8f264e20e8), WORD(0xabe6bfed59a7a841),
+	WORD(0x2cc09c0444c8eb00), WORD(0xe05b3080f0c4e16b),
+	WORD(0x1eb7777aa45f3314), WORD(0x56af7bedce5d45e3),
+	WORD(0x2b6e019a88b12f1a), WORD(0x086659cdfd835f9b),
+	/* 11G */
+	WORD(0xea7d260a6245e404), WORD(0x9de407956e7fdfe0),
+	WORD(0x1ff3a4158dac1ab5), WORD(0x3e7090f1649c9073),
+	WORD(0x1a7685612b944e88), WORD(0x250f939ee57f61c8),
+	WORD(0x0c0daa891ead643d), WORD(0x68930023e125b88e),
+	/* 13G */
+	WORD(0xccc425634b2ed709), WORD(0x0e356769856fd30d),
+	WORD(0xbcbcd43f559e9811), WORD(0x738477ac5395b759),
+	WORD(0x35752b90c00ee17f), WORD(0x68748390742ed2e3),
+	WORD(0x7cd06422bd1f5bc1), WORD(0xfbc08769c9e7b797),
+	/* 15G */
+	WORD(0x72bcd8b7bc60055b), WORD(0x03cc23ee56e27e4b),
+	WORD(0xee337424e4819370), WORD(0xe2aa0e430ad3da09),
+	WORD(0x40b8524f6383c45d), WORD(0xd766355442a41b25),
+	WORD(0x64efa6de778a4797), WORD(0x2042170a7079adf4),
+	/* 17G */
+	WORD(0x97091dcbd53c5c9d), WORD(0xf17624b6ac0a177b),
+	WORD(0xb0f139752cfe2dff), WORD(0xc1a35c0a6c7a574e),
+	WORD(0x227d314693e79987), WORD(0x0575bf30e89cb80e),
+	WORD(0x2f4e247f0d1883bb), WORD(0xebd512263274c3d0),
+	/* 19G */
+	WORD(0xfea912baa5659ae8), WORD(0x68363aba25e1a16e),
+	WORD(0xb8842277752c41ac), WORD(0xfe545c282897c3fc),
+	WORD(0x2d36e9e7dc4c696b), WORD(0x5806244afba977c5),
+	WORD(0x85665e9be39508c1), WORD(0xf720ee256d12597b),
+	/* 21G */
+	WORD(0x562e4cecc135b208), WORD(0x74e1b2654783f47d),
+	WORD(0x6d2a506c5a3f3b30), WORD(0xecead9f4c16762fc),
+	WORD(0xf29dd4b2e286e5b9), WORD(0x1b0fadc083bb3c61),
+	WORD(0x7a75023e7fac29a4), WORD(0xc086d5f1c9477fa3),
+	/* 23G */
+	WORD(0xf4f876532de45068), WORD(0x37c7a7e89e2e1f6e),
+	WORD(0xd0825fa2a3584069), WORD(0xaf2cea7c1727bf42),
+	WORD(0x0360a4fb9e4785a9), WORD(0xe5fda49c27299f4a),
+	WORD(0x48068e1371ac2f71), WORD(0x83d0687b9077666f),
+	/* 25G */
+	WORD(0xa4a319acd837879f), WORD(0x6fc1b49eed6b67b0),
+	WORD(0xe395993332f1f3af), WORD(0x966742eb65432a2e),
+	WORD(0x4b8dc9feb4966228), WORD(0x96cc631243f43950),
+	WORD(0x12068859c9b731ee), WORD(0x7b948dc356f79968),
+	/* 27G */
+	WORD(0x042c2af497e2feb4), WORD(0xd36a42d7aebf7313),
+	WORD(0x49d2c9eb084ffdd7), WORD(0x9f8aa54b2ef7c76a),
+	WORD(0x9200b7ba09895e70), WORD(0x3bd0c66fddb7fb58),
+	WORD(0x2d97d10878eb4cbb), WORD(0x2d431068d84bde31),
+	/* 29G */
+	WORD(0x5e5db46acb66e132), WORD(0xf1be963a0d925880),
+	WORD(0x944a70270317b9e2), WORD(0xe266f95948603d48),
+	WORD(0x98db66735c208899), WORD(0x90472447a2fb18a3),
+	WORD(0x8a966939777c619f), WORD(0x3798142a2a3be21b),
+	/* 31G */
+	WORD(0xe2f73c696755ff89), WORD(0xdd3cf7e7473017e6),
+	WORD(0x8ef5689d3cf7600d), WORD(0x948dc4f8b1fc87b4),
+	WORD(0xd9e9fe814ea53299), WORD(0x2d921ca298eb6028),
+	WORD(0xfaecedfd0c9803fc), WORD(0xf38ae8914d7b4745),
+	/* 33G */
+	WORD(0x871514560f664534), WORD(0x85ceae7c4b68f103),
+	WORD(0xac09c4ae65578ab9), WORD(0x33ec6868f044b10c),
+	WORD(0x6ac4832b3a8ec1f1), WORD(0x5509d1285847d5ef),
+	WORD(0xf909604f763f1574), WORD(0xb16c4303c32f63c4),
+	/* 35G */
+	WORD(0xfd16847fdec67ef5), WORD(0x742ee464233e76b7),
+	WORD(0x0b8e4134efc2b4c8), WORD(0xca640b8642a3e521),
+	WORD(0x653a01908ceb6aa9), WORD(0x313c300c547852d5),
+	WORD(0x24e4ab126b237af7), WORD(0x2ba901628bb47af8),
+	/* 37G */
+	WORD(0x00467bc58cce08b5), WORD(0xb636458c7f178d55),
+	WORD(0xc5748baea677d806), WORD(0x2763a387dfa394eb),
+	WORD(0xa12b448a7d3cebb6), WORD(0xe7adda3e6f20d850),
+	WORD(0xf63ebce51558462c), WORD(0x58b36143620088a8),
+	/* 39G */
+	WORD(0xa9d89488a059c142), WORD(0x6f5ae714ff0b9346),
+	WORD(0x068f237d16fb3664), WORD(0x5853e4c4363186ac),
+	WORD(0xe2d87d2363c52f98), WORD(0x2ec4a76681828876),
+	WORD(0x47b864fae14e7b1c), WORD(0x0c0bc0e569192408),
+	/* 41G */
+	WORD(0x624d60492ed22e91), WORD(0x6fdfe0b56f072822),
+	WORD(0xeeca111539ce2271), WORD(0x98100a4fdb01614f),
+	WORD(0xb6b0daa2a35c628f), WORD(0xb6f94d2ec87e9a47),
+	WORD(0xc67732591d57d9ce), WORD(0xf70bfeec03884a7b),
+	/* 43G */
+	WORD(0x4ff23ffd248a7d06), WORD(0x80c5bfb4878873fa),
+	WORD(0xb7d9ad9005745981), WORD(0x179c85db3db01994),
+	WORD(0xba41b06261a6966c), WORD(0x4d82d052eadce5a8),
+	WORD(0x9e91cd3ba5e6a318), WORD(0x47795f4f95b2dda0),
+	/* 45G */
+	WORD(0x1ee426ccd5cd79bf), WORD(0x0032940b946c6e18),
+	WORD(0x1b1e8ae057477f58), WORD(0xe94f7d346d823278),
+	WORD(0xc747cb96782ba21a), WORD(0xc5254469f72b33a5),
+	WORD(0x772ef6dec7f80c81), WORD(0xd73acbfe2cd9e6b5),
+	/* 47G */
+	WORD(0x283c7513caa76097), WORD(0x0a624fa936c83906),
+	WORD(0x6b20afec715af2c7), WORD(0x4b969974eba78bfd),
+	WORD(0x220755ccd921d60e), WORD(0x9b944e107baeca13),
+	WORD(0x04819d515ded93d4), WORD(0x9bbff86e6dddfd27),
+	/* 49G */
+	WORD(0x21950b421ff6acd3), WORD(0xffe7048453dc6909),
+	WORD(0xff4cd0b228766127), WORD(0xabdbe6084fb7db2b),
+	WORD(0x837c92285e1109e8), WORD(0x26147d27f4645b5a),
+	WORD(0x4d78f592f7818ed8), WORD(0xd394077ef247fa36),
+	/* 51G */
+	WORD(0x508cec1c3b3f64c9), WORD(0xe20bc0ba1e5edf3f),
+	WORD(0xda1deb852f4318d4), WORD(0xd20ebe0d5c3fa443),
+	WORD(0x370b4ea773241ea3), WORD(0x61f1511c5e1a5f65),
+	WORD(0x99a5e23d82681c62), WORD(0xd731e383a2f54c2d),
+	/* 53G */
+	WORD(0x97359638546c4d8d), WORD(0x5f9c3fc492f24679),
+	WORD(0x912e8beda8c8acd9), WORD(0xec3a318d306634b0),
+	WORD(0x80167f41c31cb264), WORD(0x3db82f6f522113f2),
+	WORD(0xb155bcd2dcafe197), WORD(0xfba1da5943465283),
+	/* 55G */
+	WORD(0x258bbbf9e7305683), WORD(0x31eea5bf07ef5be6),
+	WORD(0x0deb0e4a46c814c1), WORD(0x5cee8449a7b730dd),
+	WORD(0xeab495c5a0182bde), WORD(0xee759f879e27a6b4),
+	WORD(0xc2cf6a6880e518ca), WORD(0x25e8013ff14cf3f4),
+	/* 57G */
+	WORD(0x3ec832e77acaca28), WORD(0x1bfeea57c7385b29),
+	WORD(0x068212e3fd1eaf38), WORD(0xc13298306acf8ccc),
+	WORD(0xb909f2db2aac9e59), WORD(0x5748060db661782a),
+	WORD(0xc5ab2632c79b7a01), WORD(0xda44c6c600017626),
+	/* 59G */
+	WORD(0x69d44ed65c46aa8e), WORD(0x2100d5d3a8d063d1),
+	WORD(0xcb9727eaa2d17c36), WORD(0x4c2bab1b8add53b7),
+	WORD(0xa084e90c15426704), WORD(0x778afcd3a837ebea),
+	WORD(0x6651f7017ce477f8), WORD(0xa062499846fb7a8b),
+	/* 61G */
+	WORD(0x3667eb1a7f4c04cc), WORD(0x59556621a9404f84),
+	WORD(0x71cdf6537eceb50a), WORD(0x994a44a69b8335fa),
+	WORD(0xd7faf819dbeb9b69), WORD(0x473c5680eed4350d),
+	WORD(0xb6658466da44bba2), WORD(0x0d1bc780872bdbf3),
+	/* 63G */
+	WORD(0xb8d3d9319ff91fe5), WORD(0x039c4800f0518eed),
+	WORD(0x95c376329182cb26), WORD(0x0763a43482fc568d),
+	WORD(0x707c04d5383e76ba), WORD(0xac98b930824e8197),
+	WORD(0x92bf7c8f91230de0), WORD(0x90876a0140959b70),
+};
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+static const word_t secp256r1_gen_wnaf[] = {
+	/* G */
+	WORD(0x18a9143c), WORD(0x79e730d4), WORD(0x5fedb601), WORD(0x75ba95fc),
+	WORD(0x77622510), WORD(0x79fb732b), WORD(0xa53755c6), WORD(0x18905f76),
+	WORD(0xce95560a), WORD(0xddf25357), WORD(0xba19e45c), WORD(0x8b4ab8e4),
+	WORD(0xdd21f325), WORD(0xd2e88688), WORD(0x25885d85), WORD(0x8571ff18),
+	/* 3G */
+	WORD(0x4eebc127), WORD(0xffac3f90), WORD(0x087d81fb), WORD(0xb027f84a),
+	WORD(0x87cbbc98), WORD(0x66ad77dd), WORD(0xb6ff747e), WORD(0x26936a3f),
+	WORD(0xc983a7eb), WORD(0xb04c5c1f), WORD(0x0861fe1a), WORD(0x583e47ad),
+	WORD(0x1a2ee98e), WORD(0x78820831), WORD(0xe587cc07), WORD(0xd5f06a29),
+	/* 5G */
+	WORD(0xc45c61f5), WORD(0xbe1b8aae), WORD(0x94b9537d), WORD(0x90ec649a),
+	WORD(0xd076c20c), WORD(0x941cb5aa), WORD(0x890523c8), WORD(0xc9079605),
+	WORD(0xe7ba4f10), WORD(0xeb309b4a), WORD(0xe5eb882b), WORD(0x73c568ef),
+	WORD(0x7e7a1f68), WORD(0x3540a987), WORD(0x2dd1e916), WORD(0x73a076bb),
+	/* 7G */
+	WORD(0xa0173b4f), WORD(0x0746354e), WORD(0xd23c00f7), WORD(0x2bd20213),
+	WORD(0x0c23bb08), WORD(0xf43eaab5), WORD(0xc3123e03), WORD(0x13ba5119),
+	WORD(0x3f5b9d4d), WORD(0x2847d030), WORD(0x5da67bdd), WORD(0x6742f2f2),
+	WORD(0x77c94195), WORD(0xef933bdc), WORD(0x6e240867), WORD(0xeaedd915),
+	/* 9G */
+	WORD(0x264e20e8), WORD(0x75c96e8f), WORD(0x59a7a841), WORD(0xabe6bfed),
+	WORD(0x44c8eb00), WORD(0x2cc09c04), WORD(0xf0c4e16b), WORD(0xe05b3080),
+	WORD(0xa45f3314), WORD(0x1eb7777a), WORD(0xce5d45e3), WORD(0x56af7bed),
+	WORD(0x88b12f1a), WORD(0x2b6e019a), WORD(0xfd835f9b), WORD(0x086659cd),
+	/* 11G */
+	WORD(0x6245e404), WORD(0xea7d260a), WORD(0x6e7fdfe0), WORD(0x9de40795),
+	WORD(0x8dac1ab5), WORD(0x1ff3a415), WORD(0x649c9073), WORD(0x3e7090f1),
+	WORD(0x2b944e88), WORD(0x1a768561), WORD(0xe57f61c8), WORD(0x250f939e),
+	WORD(0x1ead643d), WORD(0x0c0daa89), WORD(0xe125b88e), WORD(0x68930023),
+	/* 13G */
+	WORD(0x4b2ed709), WORD(0xccc42563), WORD(0x856fd30d), WORD(0x0e356769),
+	WORD(0x559e9811), WORD(0xbcbcd43f), WORD(0x5395b759), WORD(0x738477ac),
+	WORD(0xc00ee17f), WORD(0x35752b90), WORD(0x742ed2e3), WORD(0x68748390),
+	WORD(0xbd1f5bc1), WORD(0x7cd06422), WORD(0xc9e7b797), WORD(0xfbc08769),
+	/* 15G */
+	WORD(0xbc60055b), WORD(0x72bcd8b7), WORD(0x56e27e4b), WORD(0x03cc23ee),
+	WORD(0xe4819370), WORD(0xee337424), WORD(0x0ad3da09), WORD(0xe2aa0e43),
+	WORD(0x6383c45d), WORD(0x40b8524f), WORD(0x42a41b25), WORD(0xd7663554),
+	WORD(0x778a4797), WORD(0x64efa6de), WORD(0x7079adf4), WORD(0x2042170a),
+	/* 17G */
+	WORD(0xd53c5c9d), WORD(0x97091dcb), WORD(0xac0a177b), WORD(0xf17624b6),
+	WORD(0x2cfe2dff), WORD(0xb0f13975), WORD(0x6c7a574e), WORD(0xc1a35c0a),
+	WORD(0x93e79987), WORD(0x227d3146), WORD(0xe89cb80e), WORD(0x0575bf30),
+	WORD(0x0d1883bb), WORD(0x2f4e247f), WORD(0x3274c3d0), WORD(0xebd51226),
+	/* 19G */
+	WORD(0xa5659ae8), WORD(0xfea912ba), WORD(0x25e1a16e), WORD(0x68363aba),
+	WORD(0x752c41ac), WORD(0xb8842277), WORD(0x2897c3fc), WORD(0xfe545c28),
+	WORD(0xdc4c696b), WORD(0x2d36e9e7), WORD(0xfba977c5), WORD(0x5806244a),
+	WORD(0xe39508c1), WORD(0x85665e9b), WORD(0x6d12597b), WORD(0xf720ee25),
+	/* 21G */
+	WORD(0xc135b208), WORD(0x562e4cec), WORD(0x4783f47d), WORD(0x74e1b265),
+	WORD(0x5a3f3b30), WORD(0x6d2a506c), WORD(0xc16762fc), WORD(0xecead9f4),
+	WORD(0xe286e5b9), WORD(0xf29dd4b2), WORD(0x83bb3c61), WORD(0x1b0fadc0),
+	WORD(0x7fac29a4), WORD(0x7a75023e), WORD(0xc9477fa3), WORD(0xc086d5f1),
+	/* 23G */
+	WORD(0x2de45068), WORD(0xf4f87653), WORD(0x9e2e1f6e), WORD(0x37c7a7e8),
+	WORD(0xa3584069), WORD(0xd0825fa2), WORD(0x1727bf42), WORD(0xaf2cea7c),
+	WORD(0x9e4785a9), WORD(0x0360a4fb), WORD(0x27299f4a), WORD(0xe5fda49c),
+	WORD(0x71ac2f71), WORD(0x48068e13), WORD(0x9077666f), WORD(0x83d0687b),
+	/* 25G */
+	WORD(0xd837879f), WORD(0xa4a319ac), WORD(0xed6b67b0), WORD(0x6fc1b49e),
+	WORD(0x32f1f3af), WORD(0xe3959933), WORD(0x65432a2e), WORD(0x966742eb),
+	WORD(0xb4966228), WORD(0x4b8dc9fe), WORD(0x43f43950), WORD(0x96cc6312),
+	WORD(0xc9b731ee), WORD(0x12068859), WORD(0x56f79968), WORD(0x7b948dc3),
+	/* 27G */
+	WORD(0x97e2feb4), WORD(0x042c2af4), WORD(0xaebf7313), WORD(0xd36a42d7),
+	WORD(0x084ffdd7), WORD(0x49d2c9eb), WORD(0x2ef7c76a), WORD(0x9f8aa54b),
+	WORD(0x09895e70), WORD(0x9200b7ba), WORD(0xddb7fb58), WORD(0x3bd0c66f),
+	WORD(0x78eb4cbb), WORD(0x2d97d108), WORD(0xd84bde31), WORD(0x2d431068),
+	/* 29G */
+	WORD(0xcb66e132), WORD(0x5e5db46a), WORD(0x0d925880), WORD(0xf1be963a),
+	WORD(0x0317b9e2), WORD(0x944a7027), WORD(0x48603d48), WORD(0xe266f959),
+	WORD(0x5c208899), WORD(0x98db6673), WORD(0xa2fb18a3), WORD(0x90472447),
+	WORD(0x777c619f), WORD(0x8a966939), WORD(0x2a3be21b), WORD(0x3798142a),
+	/* 31G */
+	WORD(0x6755ff89), WORD(0xe2f73c69), WORD(0x473017e6), WORD(0xdd3cf7e7),
+	WORD(0x3cf7600d), WORD(0x8ef5689d), WORD(0xb1fc87b4), WORD(0x948dc4f8),
+	WORD(0x4ea53299), WORD(0xd9e9fe81), WORD(0x98eb6028), WORD(0x2d921ca2),
+	WORD(0x0c9803fc), WORD(0xfaecedfd), WORD(0x4d7b4745), WORD(0xf38ae891),
+	/* 33G */
+	WORD(0x0f664534), WORD(0x87151456), WORD(0x4b68f103), WORD(0x85ceae7c),
+	WORD(0x65578ab9), WORD(0xac09c4ae), WORD(0xf044b10c), WORD(0x33ec6868),
+	WORD(0x3a8ec1f1), WORD(0x6ac4832b), WORD(0x5847d5ef), WORD(0x5509d128),
+	WORD(0x763f1574), WORD(0xf909604f), WORD(0xc32f63c4), WORD(0xb16c4303),
+	/* 35G */
+	WORD(0xdec67ef5), WORD(0xfd16847f), WORD(0x233e76b7), WORD(0x742ee464),
+	WORD(0xefc2b4c8), WORD(0x0b8e4134), WORD(0x42a3e521), WORD(0xca640b86),
+	WORD(0x8ceb6aa9), WORD(0x653a0190), WORD(0x547852d5), WORD(0x313c300c),
+	WORD(0x6b237af7), WORD(0x24e4ab12), WORD(0x8bb47af8), WORD(0x2ba90162),
+	/* 37G */
+	WORD(0x8cce08b5), WORD(0x00467bc5), WORD(0x7f178d55), WORD(0xb636458c),
+	WORD(0xa677d806), WORD(0xc5748bae), WORD(0xdfa394eb), WORD(0x2763a387),
+	WORD(0x7d3cebb6), WORD(0xa12b448a), WORD(0x6f20d850), WORD(0xe7adda3e),
+	WORD(0x1558462c), WORD(0xf63ebce5), WORD(0x620088a8), WORD(0x58b36143),
+	/* 39G */
+	WORD(0xa059c142), WORD(0xa9d89488), WORD(0xff0b9346), WORD(0x6f5ae714),
+	WORD(0x16fb3664), WORD(0x068f237d), WORD(0x363186ac), WORD(0x5853e4c4),
+	WORD(0x63c52f98), WORD(0xe2d87d23), WORD(0x81828876), WORD(0x2ec4a766),
+	WORD(0xe14e7b1c), WORD(0x47b864fa), WORD(0x69192408), WORD(0x0c0bc0e5),
+	/* 41G */
+	WORD(0x2ed22e91), WORD(0x624d6049), WORD(0x6f072822), WORD(0x6fdfe0b5),
+	WORD(0x39ce2271), WORD(0xeeca1115), WORD(0xdb01614f), WORD(0x98100a4f),
+	WORD(0xa35c628f), WORD(0xb6b0daa2), WORD(0xc87e9a47), WORD(0xb6f94d2e),
+	WORD(0x1d57d9ce), WORD(0xc6773259), WORD(0x03884a7b), WORD(0xf70bfeec),
+	/* 43G */
+	WORD(0x248a7d06), WORD(0x4ff23ffd), WORD(0x878873fa), WORD(0x80c5bfb4),
+	WORD(0x05745981), WORD(0xb7d9ad90), WORD(0x3db01994), WORD(0x179c85db),
+	WORD(0x61a6966c), WORD(0xba41b062), WORD(0xeadce5a8), WORD(0x4d82d052),
+	WORD(0xa5e6a318), WORD(0x9e91cd3b), WORD(0x95b2dda0), WORD(0x47795f4f),
+	/* 45G */
+	WORD(0xd5cd79bf), WORD(0x1ee426cc), WORD(0x946c6e18), WORD(0x0032940b),
+	WORD(0x57477f58), WORD(0x1b1e8ae0), WORD(0x6d823278), WORD(0xe94f7d34),
+	WORD(0x782ba21a), WORD(0xc747cb96), WORD(0xf72b33a5), WORD(0xc5254469),
+	WORD(0xc7f80c81), WORD(0x772ef6de), WORD(0x2cd9e6b5), WORD(0xd73acbfe),
+	/* 47G */
+	WORD(0xcaa76097), WORD(0x283c7513), WORD(0x36c83906), WORD(0x0a624fa9),
+	WORD(0x715af2c7), WORD(0x6b20afec), WORD(0xeba78bfd), WORD(0x4b969974),
+	WORD(0xd921d60e), WORD(0x220755cc), WORD(0x7baeca13), WORD(0x9b944e10),
+	WORD(0x5ded93d4), WORD(0x04819d51), WORD(0x6dddfd27), WORD(0x9bbff86e),
+	/* 49G */
+	WORD(0x1ff6acd3), WORD(0x21950b42), WORD(0x53dc6909), WORD(0xffe70484),
+	WORD(0x28766127), WORD(0xff4cd0b2), WORD(0x4fb7db2b), WORD(0xabdbe608),
+	WORD(0x5e1109e8), WORD(0x837c9228), WORD(0xf4645b5a), WORD(0x26147d27),
+	WORD(0xf7818ed8), WORD(0x4d78f592), WORD(0xf247fa36), WORD(0xd394077e),
+	/* 51G */
+	WORD(0x3b3f64c9), WORD(0x508cec1c), WORD(0x1e5edf3f), WORD(0xe20bc0ba),
+	WORD(0x2f4318d4), WORD(0xda1deb85), WORD(0x5c3fa443), WORD(0xd20ebe0d),
+	WORD(0x73241ea3), WORD(0x370b4ea7), WORD(0x5e1a5f65), WORD(0x61f1511c),
+	WORD(0x82681c62), WORD(0x99a5e23d), WORD(0xa2f54c2d), WORD(0xd731e383),
+	/* 53G */
+	WORD(0x546c4d8d), WORD(0x97359638), WORD(0x92f24679), WORD(0x5f9c3fc4),
+	WORD(0xa8c8acd9), WORD(0x912e8bed), WORD(0x306634b0), WORD(0xec3a318d),
+	WORD(0xc31cb264), WORD(0x80167f41), WORD(0x522113f2), WORD(0x3db82f6f),
+	WORD(0xdcafe197), WORD(0xb155bcd2), WORD(0x43465283), WORD(0xfba1da59),
+	/* 55G */
+	WORD(0xe7305683), WORD(0x258bbbf9), WORD(0x07ef5be6), WORD(0x31eea5bf),
+	WORD(0x46c814c1), WORD(0x0deb0e4a), WORD(0xa7b730dd), WORD(0x5cee8449),
+	WORD(0xa0182bde), WORD(0xeab495c5), WORD(0x9e27a6b4), WORD(0xee759f87),
+	WORD(0x80e518ca), WORD(0xc2cf6a68), WORD(0xf14cf3f4), WORD(0x25e8013f),
+	/* 57G */
+	WORD(0x7acaca28), WORD(0x3ec832e7), WORD(0xc7385b29), WORD(0x1bfeea57),
+	WORD(0xfd1eaf38), WORD(0x068212e3), WORD(0x6acf8ccc), WORD(0xc1329830),
+	WORD(0x2aac9e59), WORD(0xb909f2db), WORD(0xb661782a), WORD(0x5748060d),
+	WORD(0xc79b7a01), WORD(0xc5ab2632), WORD(0x00017626), WORD(0xda44c6c6),
+	/* 59G */
+	WORD(0x5c46aa8e), WORD(0x69d44ed6), WORD(0xa8d063d1), WORD(0x2100d5d3),
+	WORD(0xa2d17c36), WORD(0xcb9727ea), WORD(0x8add53b7), WORD(0x4c2bab1b),
+	WORD(0x15426704), WORD(0xa084e90c), WORD(0xa837ebea), WORD(0x778afcd3),
+	WORD(0x7ce477f8), WORD(0x6651f701), WORD(0x46fb7a8b), WORD(0xa0624998),
+	/* 61G */
+	WORD(0x7f4c04cc), WORD(0x3667eb1a), WORD(0xa9404f84), WORD(0x59556621),
+	WORD(0x7eceb50a), WORD(0x71cdf653), WORD(0x9b8335fa), WORD(0x994a44a6),
+	WORD(0xdbeb9b69), WORD(0xd7faf819), WORD(0xeed4350d), WORD(0x473c5680),
+	WORD(0xda44bba2), WORD(0xb6658466), WORD(0x872bdbf3), WORD(0x0d1bc780),
+	/* 63G */
+	WORD(0x9ff91fe5), WORD(0xb8d3d931), WORD(0xf0518eed), WORD(0x039c4800),
+	WORD(0x9182cb26), WORD(0x95c37632), WORD(0x82fc568d), WORD(0x0763a434),
+	WORD(0x383e76ba), WORD(0x707c04d5), WORD(0x824e8197), WORD(0xac98b930),
+	WORD(0x91230de0), WORD(0x92bf7c8f), WORD(0x40959b70), WORD(0x90876a01),
+};
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+static const word_t secp256r1_gen_wnaf[] = {
+	/* G */
+	WORD(0x143c), WORD(0x18a9), WORD(0x30d4), WORD(0x79e7), WORD(0xb601), WORD(0x5fed),
+	WORD(0x95fc), WORD(0x75ba), WORD(0x2510), WORD(0x7762), WORD(0x732b), WORD(0x79fb),
+	WORD(0x55c6), WORD(0xa537), WORD(0x5f76), WORD(0x1890), WORD(0x560a), WORD(0xce95),
+	WORD(0x5357), WORD(0xddf2), WORD(0xe45c), WORD(0xba19), WORD(0xb8e4), WORD(0x8b4a),
+	WORD(0xf325), WORD(0xdd21), WORD(0x8688), WORD(0xd2e8), WORD(0x5d85), WORD(0x2588),
+	WORD(0xff18), WORD(0x8571),
+	/* 3G */
+	WORD(0xc127), WORD(0x4eeb), WORD(0x3f90), WORD(0xffac), WORD(0x81fb), WORD(0x087d),
+	WORD(0xf84a), WORD(0xb027), WORD(0xbc98), WORD(0x87cb), WORD(0x77dd), WORD(0x66ad),
+	WORD(0x747e), WORD(0xb6ff), WORD(0x6a3f), WORD(0x2693), WORD(0xa7eb), WORD(0xc983),
+	WORD(0x5c1f), WORD(0xb04c), WORD(0xfe1a), WORD(0x0861), WORD(0x47ad), WORD(0x583e),
+	WORD(0xe98e), WORD(0x1a2e), WORD(0x0831), WORD(0x7882), WORD(0xcc07), WORD(0xe587),
+	WORD(0x6a29), WORD(0xd5f0),
+	/* 5G */
+	WORD(0x61f5), WORD(0xc45c), WORD(0x8aae), WORD(0xbe1b), WORD(0x537d), WORD(0x94b9),
+	WORD(0x649a), WORD(0x90ec), WORD(0xc20c), WORD(0xd076), WORD(0xb5aa), WORD(0x941c),
+	WORD(0x23c8), WORD(0x8905), WORD(0x9605), WORD(0xc907), WORD(0x4f10), WORD(0xe7ba),
+	WORD(0x9b4a), WORD(0xeb30), WORD(0x882b), WORD(0xe5eb), WORD(0x68ef), WORD(0x73c5),
+	WORD(0x1f68), WORD(0x7e7a), WORD(0xa987), WORD(0x3540), WORD(0xe916), WORD(0x2dd1),
+	WORD(0x76bb), WORD(0x73a0),
+	/* 7G */
+	WORD(0x3b4f), WORD(0xa017), WORD(0x354e), WORD(0x0746), WORD(0x00f7), WORD(0xd23c),
+	WORD(0x0213), WORD(0x2bd2), WORD(0xbb08), WORD(0x0c23), WORD(0xaab5), WORD(0xf43e),
+	WORD(0x3e03), WORD(0xc312), WORD(0x5119), WORD(0x13ba), WORD(0x9d4d), WORD(0x3f5b),
+	WORD(0xd030), WORD(0x2847), WORD(0x7bdd), WORD(0x5da6), WORD(0xf2f2), WORD(0x6742),
+	WORD(0x4195), WORD(0x77c9), WORD(0x3bdc), WORD(0xef93), WORD(0x0867), WORD(0x6e24),
+	WORD(0xd915), WORD(0xeaed),
+	/* 9G */
+	WORD(0x20e8), WORD(0x264e), WORD(0x6e8f), WORD(0x75c9), WORD(0xa841), WORD(0x59a7),
+	WORD(0xbfed), WORD(0xabe6), WORD(0xeb00), WORD(0x44c8), WORD(0x9c04), WORD(0x2cc0),
+	WORD(0xe16b), WORD(0xf0c4), WORD(0x3080), WORD(0xe05b), WORD(0x3314), WORD(0xa45f),
+	WORD(0x777a), WORD(0x1eb7), WORD(0x45e3), WORD(0xce5d), WORD(0x7bed), WORD(0x56af),
+	WORD(0x2f1a), WORD(0x88b1), WORD(0x019a), WORD(0x2b6e), WORD(0x5f9b), WORD(0xfd83),
+	WORD(0x59cd), WORD(0x0866),
+	/* 11G */
+	WORD(0xe404), WORD(0x6245), WORD(0x260a), WORD(0xea7d), WORD(0xdfe0), WORD(0x6e7f),
+	WORD(0x0795), WORD(0x9de4), WORD(0x1ab5), WORD(0x8dac), WORD(0xa415), WORD(0x1ff3),
+	WORD(0x9073), WORD(0x649c), WORD(0x90f1), WORD(0x3e70), WORD(0x4e88), WORD(0x2b94),
+	WORD(0x8561), WORD(0x1a76), WORD(0x61c8), WORD(0xe57f), WORD(0x939e), WORD(0x250f),
+	WORD(0x643d), WORD(0x1ead), WORD(0xaa89), WORD(0x0c0d), WORD(0xb88e), WORD(0xe125),
+	WORD(0x0023), WORD(0x6893),
+	/* 13G */
+	WORD(0xd709), WORD(0x4b2e), WORD(0x2563), WORD(0xccc4), WORD(0xd30d), WORD(0x856f),
+	WORD(0x6769), WORD(0x0e35), WORD(0x9811), WORD(0x559e), WORD(0xd43f), WORD(0xbcbc),
+	WORD(0xb759), WORD(0x5395), WORD(0x77ac), WORD(0x7384), WORD(0xe17f), WORD(0xc00e),
+	WORD(0x2b90), WORD(0x3575), WORD(0xd2e3), WORD(0x742e), WORD(0x8390), WORD(0x6874),
+	WORD(0x5bc1), WORD(0xbd1f), WORD(0x6422), WORD(0x7cd0), WORD(0xb797), WORD(0xc9e7),
+	WORD(0x8769), WORD(0xfbc0),
+	/* 15G */
+	WORD(0x055b), WORD(0xbc60), WORD(0xd8b7), WORD(0x72bc), WORD(0x7e4b), WORD(0x56e2),
+	WORD(0x23ee), WORD(0x03cc), WORD(0x9370), WORD(0xe481), WORD(0x7424), WORD(0xee33),
+	WORD(0xda09), WORD(0x0ad3), WORD(0x0e43), WORD(0xe2aa), WORD(0xc45d), WORD(0x6383),
+	WORD(0x524f), WORD(0x40b8), WORD(0x1b25), WORD(0x42a4), WORD(0x3554), WORD(0xd766),
+	WORD(0x4797), WORD(0x778a), WORD(0xa6de), WORD(0x64ef), WORD(0xadf4), WORD(0x7079),
+	WORD(0x170a), WORD(0x2042),
+	/* 17G */
+	WORD(0x5c9d), WORD(0xd53c), WORD(0x1dcb), WORD(0x9709), WORD(0x177b), WORD(0xac0a),
+	WORD(0x24b6), WORD(0xf176), WORD(0x2dff), WORD(0x2cfe), WORD(0x3975), WORD(0xb0f1),
+	WORD(0x574e), WORD(0x6c7a), WORD(0x5c0a), WORD(0xc1a3), WORD(0x9987), WORD(0x93e7),
+	WORD(0x3146), WORD(0x227d), WORD(0xb80e), WORD(0xe89c), WORD(0xbf30), WORD(0x0575),
+	WORD(0x83bb), WORD(0x0d18), WORD(0x247f), WORD(0x2f4e), WORD(0xc3d0), WORD(0x3274),
+	WORD(0x1226), WORD(0xebd5),
+	/* 19G */
+	WORD(0x9ae8), WORD(0xa565), WORD(0x12ba), WORD(0xfea9), WORD(0xa16e), WORD(0x25e1),
+	WORD(0x3aba), WORD(0x6836), WORD(0x41ac), WORD(0x752c), WORD(0x2277), WORD(0xb884),
+	WORD(0xc3fc), WORD(0x2897), WORD(0x5c28), WORD(0xfe54), WORD(0x696b), WORD(0xdc4c),
+	WORD(0xe9e7), WORD(0x2d36), WORD(0x77c5), WORD(0xfba9), WORD(0x244a), WORD(0x5806),
+	WORD(0x08c1), WORD(0xe395), WORD(0x5e9b), WORD(0x8566), WORD(0x597b), WORD(0x6d12),
+	WORD(0xee25), WORD(0xf720),
+	/* 21G */
+	WORD(0xb208), WORD(0xc135), WORD(0x4cec), WORD(0x562e), WORD(0xf47d), WORD(0x4783),
+	WORD(0xb265), WORD(0x74e1), WORD(0x3b30), WORD(0x5a3f), WORD(0x506c), WORD(0x6d2a),
+	WORD(0x62fc), WORD(0xc167), WORD(0xd9f4), WORD(0xecea), WORD(0xe5b9), WORD(0xe286),
+	WORD(0xd4b2), WORD(0xf29d), WORD(0x3c61), WORD(0x83bb), WORD(0xadc0), WORD(0x1b0f),
+	WORD(0x29a4), WORD(0x7fac), WORD(0x023e), WORD(0x7a75), WORD(0x7fa3), WORD(0xc947),
+	WORD(0xd5f1), WORD(0xc086),
+	/* 23G */
+	WORD(0x5068), WORD(0x2de4), WORD(0x7653), WORD(0xf4f8), WORD(0x1f6e), WORD(0x9e2e),
+	WORD(0xa7e8), WORD(0x37c7), WORD(0x4069), WORD(0xa358), WORD(0x5fa2), WORD(0xd082),
+	WORD(0xbf42), WORD(0x1727), WORD(0xea7c), WORD(0xaf2c), WORD(0x85a9), WORD(0x9e47),
+	WORD(0xa4fb), WORD(0x0360), WORD(0x9f4a), WORD(0x2729), WORD(0xa49c), WORD(0xe5fd),
+	WORD(0x2f71), WORD(0x71ac), WORD(0x8e13), WORD(0x4806), WORD(0x666f), WORD(0x9077),
+	WORD(0x687b), WORD(0x83d0),
+	/* 25G */
+	WORD(0x879f), WORD(0xd837), WORD(0x19ac), WORD(0xa4a3), WORD(0x67b0), WORD(0xed6b),
+	WORD(0xb49e), WORD(0x6fc1), WORD(0xf3af), WORD(0x32f1), WORD(0x9933), WORD(0xe395),
+	WORD(0x2a2e), WORD(0x6543), WORD(0x42eb), WORD(0x9667), WORD(0x6228), WORD(0xb496),
+	WORD(0xc9fe), WORD(0x4b8d), WORD(0x3950), WORD(0x43f4), WORD(0x6312), WORD(0x96cc),
+	WORD(0x31ee), WORD(0xc9b7), WORD(0x8859), WORD(0x1206), WORD(0x9968), WORD(0x56f7),
+	WORD(0x8dc3), WORD(0x7b94),
+	/* 27G */
+	WORD(0xfeb4), WORD(0x97e2), WORD(0x2af4), WORD(0x042c), WORD(0x7313), WORD(0xaebf),
+	WORD(0x42d7), WORD(0xd36a), WORD(0xfdd7), WORD(0x084f), WORD(0xc9eb), WORD(0x49d2),
+	WORD(0xc76a), WORD(0x2ef7), WORD(0xa54b), WORD(0x9f8a), WORD(0x5e70), WORD(0x0989),
+	WORD(0xb7ba), WORD(0x9200), WORD(0xfb58), WORD(0xddb7), WORD(0xc66f), WORD(0x3bd0),
+	WORD(0x4cbb), WORD(0x78eb), WORD(0xd108), WORD(0x2d97), WORD(0xde31), WORD(0xd84b),
+	WORD(0x1068), WORD(0x2d43),
+	/* 29G */
+	WORD(0xe132), WORD(0xcb66), WORD(0xb46a), WORD(0x5e5d), WORD(0x5880), WORD(0x0d92),
+	WORD(0x963a), WORD(0xf1be), WORD(0xb9e2), WORD(0x0317), WORD(0x7027), WORD(0x944a),
+	WORD(0x3d48), WORD(0x4860), WORD(0xf959), WORD(0xe266), WORD(0x8899), WORD(0x5c20),
+	WORD(0x6673), WORD(0x98db), WORD(0x18a3), WORD(0xa2fb), WORD(0x2447), WORD(0x9047),
+	WORD(0x619f), WORD(0x777c), WORD(0x6939), WORD(0x8a96), WORD(0xe21b), WORD(0x2a3b),
+	WORD(0x142a), WORD(0x3798),
+	/* 31G */
+	WORD(0xff89), WORD(0x6755), WORD(0x3c69), WORD(0xe2f7), WORD(0x17e6), WORD(0x4730),
+	WORD(0xf7e7), WORD(0xdd3c), WORD(0x600d), WORD(0x3cf7), WORD(0x689d), WORD(0x8ef5),
+	WORD(0x87b4), WORD(0xb1fc), WORD(0xc4f8), WORD(0x948d), WORD(0x3299), WORD(0x4ea5),
+	WORD(0xfe81), WORD(0xd9e9), WORD(0x6028), WORD(0x98eb), WORD(0x1ca2), WORD(0x2d92),
+	WORD(0x03fc), WORD(0x0c98), WORD(0xedfd), WORD(0xfaec), WORD(0x4745), WORD(0x4d7b),
+	WORD(0xe891), WORD(0xf38a),
+	/* 33G */
+	WORD(0x4534), WORD(0x0f66), WORD(0x1456), WORD(0x8715), WORD(0xf103), WORD(0x4b68),
+	WORD(0xae7c), WORD(0x85ce), WORD(0x8ab9), WORD(0x6557), WORD(0xc4ae), WORD(0xac09),
+	WORD(0xb10c), WORD(0xf044), WORD(0x6868), WORD(0x33ec), WORD(0xc1f1), WORD(0x3a8e),
+	WORD(0x832b), WORD(0x6ac4), WORD(0xd5ef), WORD(0x5847), WORD(0xd128), WORD(0x5509),
+	WORD(0x1574), WORD(0x763f), WORD(0x604f), WORD(0xf909), WORD(0x63c4), WORD(0xc32f),
+	WORD(0x4303), WORD(0xb16c),
+	/* 35G */
+	WORD(0x7ef5), WORD(0xdec6), WORD(0x847f), WORD(0xfd16), WORD(0x76b7), WORD(0x233e),
+	WORD(0xe464), WORD(0x742e), WORD(0xb4c8), WORD(0xefc2), WORD(0x4134), WORD(0x0b8e),
+	WORD(0xe521), WORD(0x42a3), WORD(0x0b86), WORD(0xca64), WORD(0x6aa9), WORD(0x8ceb),
+	WORD(0x0190), WORD(0x653a), WORD(0x52d5), WORD(0x5478), WORD(0x300c), WORD(0x313c),
+	WORD(0x7af7), WORD(0x6b23), WORD(0xab12), WORD(0x24e4), WORD(0x7af8), WORD(0x8bb4),
+	WORD(0x0162), WORD(0x2ba9),
+	/* 37G */
+	WORD(0x08b5), WORD(0x8cce), WORD(0x7bc5), WORD(0x0046), WORD(0x8d55), WORD(0x7f17),
+	WORD(0x458c), WORD(0xb636), WORD(0xd806), WORD(0xa677), WORD(0x8bae), WORD(0xc574),
+	WORD(0x94eb), WORD(0xdfa3), WORD(0xa387), WORD(0x2763), WORD(0xebb6), WORD(0x7d3c),
+	WORD(0x448a), WORD(0xa12b), WORD(0xd850), WORD(0x6f20), WORD(0xda3e), WORD(0xe7ad),
+	WORD(0x462c), WORD(0x1558), WORD(0xbce5), WORD(0xf63e), WORD(0x88a8), WORD(0x6200),
+	WORD(0x6143), WORD(0x58b3),
+	/* 39G */
+	WORD(0xc142), WORD(0xa059), WORD(0x9488), WORD(0xa9d8), WORD(0x9346), WORD(0xff0b),
+	WORD(0xe714), WORD(0x6f5a), WORD(0x3664), WORD(0x16fb), WORD(0x237d), WORD(0x068f),
+	WORD(0x86ac), WORD(0x3631), WORD(0xe4c4), WORD(0x5853), WORD(0x2f98), WORD(0x63c5),
+	WORD(0x7d23), WORD(0xe2d8), WORD(0x8876), WORD(0x8182), WORD(0xa766), WORD(0x2ec4),
+	WORD(0x7b1c), WORD(0xe14e), WORD(0x64fa), WORD(0x47b8), WORD(0x2408), WORD(0x6919),
+	WORD(0xc0e5), WORD(0x0c0b),
+	/* 41G */
+	WORD(0x2e91), WORD(0x2ed2), WORD(0x6049), WORD(0x624d), WORD(0x2822), WORD(0x6f07),
+	WORD(0xe0b5), WORD(0x6fdf), WORD(0x2271), WORD(0x39ce), WORD(0x1115), WORD(0xeeca),
+	WORD(0x614f), WORD(0xdb01), WORD(0x0a4f), WORD(0x9810), WORD(0x628f), WORD(0xa35c),
+	WORD(0xdaa2), WORD(0xb6b0), WORD(0x9a47), WORD(0xc87e), WORD(0x4d2e), WORD(0xb6f9),
+	WORD(0xd9ce), WORD(0x1d57), WORD(0x3259), WORD(0xc677), WORD(0x4a7b), WORD(0x0388),
+	WORD(0xfeec), WORD(0xf70b),
+	/* 43G */
+	WORD(0x7d06), WORD(0x248a), WORD(0x3ffd), WORD(0x4ff2), WORD(0x73fa), WORD(0x8788),
+	WORD(0xbfb4), WORD(0x80c5), WORD(0x5981), WORD(0x0574), WORD(0xad90), WORD(0xb7d9),
+	WORD(0x1994), WORD(0x3db0), WORD(0x85db), WORD(0x179c), WORD(0x966c), WORD(0x61a6),
+	WORD(0xb062), WORD(0xba41), WORD(0xe5a8), WORD(0xeadc), WORD(0xd052), WORD(0x4d82),
+	WORD(0xa318), WORD(0xa5e6), WORD(0xcd3b), WORD(0x9e91), WORD(0xdda0), WORD(0x95b2),
+	WORD(0x5f4f), WORD(0x4779),
+	/* 45G */
+	WORD(0x79bf), WORD(0xd5cd), WORD(0x26cc), WORD(0x1ee4), WORD(0x6e18), WORD(0x946c),
+	WORD(0x940b), WORD(0x0032), WORD(0x7f58), WORD(0x5747), WORD(0x8ae0), WORD(0x1b1e),
+	WORD(0x3278), WORD(0x6d82), WORD(0x7d34), WORD(0xe94f), WORD(0xa21a), WORD(0x782b),
+	WORD(0xcb96), WORD(0xc747), WORD(0x33a5), WORD(0xf72b), WORD(0x4469), WORD(0xc525),
+	WORD(0x0c81), WORD(0xc7f8), WORD(0xf6de), WORD(0x772e), WORD(0xe6b5), WORD(0x2cd9),
+	WORD(0xcbfe), WORD(0xd73a),
+	/* 47G */
+	WORD(0x6097), WORD(0xcaa7), WORD(0x7513), WORD(0x283c), WORD(0x3906), WORD(0x36c8),
+	WORD(0x4fa9), WORD(0x0a62), WORD(0xf2c7), WORD(0x715a), WORD(0xafec), WORD(0x6b20),
+	WORD(0x8bfd), WORD(0xeba7), WORD(0x9974), WORD(0x4b96), WORD(0xd60e), WORD(0xd921),
+	WORD(0x55cc), WORD(0x2207), WORD(0xca13), WORD(0x7bae), WORD(0x4e10), WORD(0x9b94),
+	WORD(0x93d4), WORD(0x5ded), WORD(0x9d51), WORD(0x0481), WORD(0xfd27), WORD(0x6ddd),
+	WORD(0xf86e), WORD(0x9bbf),
+	/* 49G */
+	WORD(0xacd3), WORD(0x1ff6), WORD(0x0b42), WORD(0x2195), WORD(0x6909), WORD(0x53dc),
+	WORD(0x0484), WORD(0xffe7), WORD(0x6127), WORD(0x2876), WORD(0xd0b2), WORD(0xff4c),
+	WORD(0xdb2b), WORD(0x4fb7), WORD(0xe608), WORD(0xabdb), WORD(0x09e8), WORD(0x5e11),
+	WORD(0x9228), WORD(0x837c), WORD(0x5b5a), WORD(0xf464), WORD(0x7d27), WORD(0x2614),
+	WORD(0x8ed8), WORD(0xf781), WORD(0xf592), WORD(0x4d78), WORD(0xfa36), WORD(0xf247),
+	WORD(0x077e), WORD(0xd394),
+	/* 51G */
+	WORD(0x64c9), WORD(0x3b3f), WORD(0xec1c), WORD(0x508c), WORD(0xdf3f), WORD(0x1e5e),
+	WORD(0xc0ba), WORD(0xe20b), WORD(0x18d4), WORD(0x2f43), WORD(0xeb85), WORD(0xda1d),
+	WORD(0xa443), WORD(0x5c3f), WORD(0xbe0d), WORD(0xd20e), WORD(0x1ea3), WORD(0x7324),
+	WORD(0x4ea7), WORD(0x370b), WORD(0x5f65), WORD(0x5e1a), WORD(0x511c), WORD(0x61f1),
+	WORD(0x1c62), WORD(0x8268), WORD(0xe23d), WORD(0x99a5), WORD(0x4c2d), WORD(0xa2f5),
+	WORD(0xe383), WORD(0xd731),
+	/* 53G */
+	WORD(0x4d8d), WORD(0x546c), WORD(0x9638), WORD(0x9735), WORD(0x4679), WORD(0x92f2),
+	WORD(0x3fc4), WORD(0x5f9c), WORD(0xacd9), WORD(0xa8c8), WORD(0x8bed), WORD(0x912e),
+	WORD(0x34b0), WORD(0x3066), WORD(0x318d), WORD(0xec3a), WORD(0xb264), WORD(0xc31c),
+	WORD(0x7f41), WORD(0x8016), WORD(0x13f2), WORD(0x5221), WORD(0x2f6f), WORD(0x3db8),
+	WORD(0xe197), WORD(0xdcaf), WORD(0xbcd2), WORD(0xb155), WORD(0x5283), WORD(0x4346),
+	WORD(0xda59), WORD(0xfba1),
+	/* 55G */
+	WORD(0x5683), WORD(0xe730), WORD(0xbbf9), WORD(0x258b), WORD(0x5be6), WORD(0x07ef),
+	WORD(0xa5bf), WORD(0x31ee), WORD(0x14c1), WORD(0x46c8), WORD(0x0e4a), WORD(0x0deb),
+	WORD(0x30dd), WORD(0xa7b7), WORD(0x8449), WORD(0x5cee), WORD(0x2bde), WORD(0xa018),
+	WORD(0x95c5), WORD(0xeab4), WORD(0xa6b4), WORD(0x9e27), WORD(0x9f87), WORD(0xee75),
+	WORD(0x18ca), WORD(0x80e5), WORD(0x6a68), WORD(0xc2cf), WORD(0xf3f4), WORD(0xf14c),
+	WORD(0x013f), WORD(0x25e8),
+	/* 57G */
+	WORD(0xca28), WORD(0x7aca), WORD(0x32e7), WORD(0x3ec8), WORD(0x5b29), WORD(0xc738),
+	WORD(0xea57), WORD(0x1bfe), WORD(0xaf38), WORD(0xfd1e), WORD(0x12e3), WORD(0x0682),
+	WORD(0x8ccc), WORD(0x6acf), WORD(0x9830), WORD(0xc132), WORD(0x9e59), WORD(0x2aac),
+	WORD(0xf2db), WORD(0xb909), WORD(0x782a), WORD(0xb661), WORD(0x060d), WORD(0x5748),
+	WORD(0x7a01), WORD(0xc79b), WORD(0x2632), WORD(0xc5ab), WORD(0x7626), WORD(0x0001),
+	WORD(0xc6c6), WORD(0xda44),
+	/* 59G */
+	WORD(0xaa8e), WORD(0x5c46), WORD(0x4ed6), WORD(0x69d4), WORD(0x63d1), WORD(0xa8d0),
+	WORD(0xd5d3), WORD(0x2100), WORD(0x7c36), WORD(0xa2d1), WORD(0x27ea), WORD(0xcb97),
+	WORD(0x53b7), WORD(0x8add), WORD(0xab1b), WORD(0x4c2b), WORD(0x6704), WORD(0x1542),
+	WORD(0xe90c), WORD(0xa084), WORD(0xebea), WORD(0xa837), WORD(0xfcd3), WORD(0x778a),
+	WORD(0x77f8), WORD(0x7ce4), WORD(0xf701), WORD(0x6651), WORD(0x7a8b), WORD(0x46fb),
+	WORD(0x4998), WORD(0xa062),
+	/* 61G */
+	WORD(0x04cc), WORD(0x7f4c), WORD(0xeb1a), WORD(0x3667), WORD(0x4f84), WORD(0xa940),
+	WORD(0x6621), WORD(0x5955), WORD(0xb50a), WORD(0x7ece), WORD(0xf653), WORD(0x71cd),
+	WORD(0x35fa), WORD(0x9b83), WORD(0x44a6), WORD(0x994a), WORD(0x9b69), WORD(0xdbeb),
+	WORD(0xf819), WORD(0xd7fa), WORD(0x350d), WORD(0xeed4), WORD(0x5680), WORD(0x473c),
+	WORD(0xbba2), WORD(0xda44), WORD(0x8466), WORD(0xb665), WORD(0xdbf3), WORD(0x872b),
+	WORD(0xc780), WORD(0x0d1b),
+	/* 63G */
+	WORD(0x1fe5), WORD(0x9ff9), WORD(0xd931), WORD(0xb8d3), WORD(0x8eed), WORD(0xf051),
+	WORD(0x4800), WORD(0x039c), WORD(0xcb26), WORD(0x9182), WORD(0x7632), WORD(0x95c3),
+	WORD(0x568d), WORD(0x82fc), WORD(0xa434), WORD(0x0763), WORD(0x76ba), WORD(0x383e),
+	WORD(0x04d5), WORD(0x707c), WORD(0x8197), WORD(0x824e), WORD(0xb930), WORD(0xac98),
+	WORD(0x0de0), WORD(0x9123), WORD(0x7c8f), WORD(0x92bf), WORD(0x9b70), WORD(0x4095),
+	WORD(0x6a01), WORD(0x9087),
+};
+#else                     /* unknown word size */
+#error "Unsupported word size"
+#endif
+TO_EC_GEN_TABLE_PARAM(secp256r1_gen_wnaf, 7);
+
+/*
+ * Signed comb of the generator for the fixed base multiplications (6
+ * teeth, spacing 43), affine x and y in Montgomery representation
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+static const word_t secp256r1_gen_comb[] = {
+	/* T[0] */
+	WORD(0x99b32dec59cc4be4), WORD(0x9cf49469b86ac974),
+	WORD(0x6b51751c20ae1d26), WORD(0xb26bed39a997aa99),
+	WORD(0x9a5109813c9db7a2), WORD(0x38d0b967ccdb0918),
+	WORD(0x313c232c2177aaeb), WORD(0x8f4e60907b8fdb5b),
+	/* T[1] */
+	WORD(0x182f4b729a395ddb), WORD(0xc803f9bc6ae2f96d),
+	WORD(0x976d07617656e088), WORD(0x468beb88b350aaba),
+	WORD(0x05dabdf9aa42a0ac), WORD(0x08dfb949118af982),
+	WORD(0x05ad10c2d7df1167), WORD(0xe2099d487b84564f),
+	/* T[2] */
+	WORD(0xd46783a089337219), WORD(0xa071ef2bb4da494f),
+	WORD(0xe84eb63b7491e4c4), WORD(0x09c8bd9424a8b453),
+	WORD(0x5050aefbc0799c36), WORD(0x0c2eccbd909c479e),
+	WORD(0xd1fabef6601f29d0), WORD(0xf0753552c0347267),
+	/* T[3] */
+	WORD(0xc91c3a19d5c5fd3d), WORD(0x779456f51b1fcdca),
+	WORD(0xb9d55947de6fd5ca), WORD(0xe2207308ad87c7d9),
+	WORD(0x65aba496a1e6dc7a), WORD(0xf717494dc8a15bec),
+	WORD(0x6d849f6bc8d93cc1), WORD(0x9bb3e3106852e7c9),
+	/* T[4] */
+	WORD(0x039f159e4ae9f8f8), WORD(0xbcb8d7d211ae0c0f),
+	WORD(0x441a985fc2a7aa6a), WORD(0x00e6837cc22712f9),
+	WORD(0xd88fa9b06d001b98), WORD(0x84185677add601cd),
+	WORD(0x1c3d0b7ad74a083b), WORD(0x9f562e54d07a6b75),
+	/* T[5] */
+	WORD(0x62a3d600ccf47afd), WORD(0xef8d4beb19341a6c),
+	WORD(0x7666ed3c7f584af8), WORD(0x77f9a2bd87614960),
+	WORD(0x9bad432e583a0b1d), WORD(0xd73b899a59c75118),
+	WORD(0x7dd074a841405318), WORD(0x35e3de66b680daf7),
+	/* T[6] */
+	WORD(0x31f845f18d1bb3b3), WORD(0xc01970c2455c3b66),
+	WORD(0x34a1d19600dd6f5d), WORD(0x66619ca5bd0196e2),
+	WORD(0x9345c919d54eb737), WORD(0xcc6f49b8c89f8ad5),
+	WORD(0x553709e3c92d2396), WORD(0xa2c024b2b424557d),
+	/* T[7] */
+	WORD(0x6398c2b55a53321c), WORD(0xa70fe391092001a2),
+	WORD(0xcb4c2947d8802fe2), WORD(0x3c51d45a0c1cf0af),
+	WORD(0x9357c287583c0261), WORD(0x997039de557ad9fd),
+	WORD(0xeb4f507e2445266f), WORD(0xe4ffee6770077237),
+	/* T[8] */
+	WORD(0x7ca74f2f7f68bdd1), WORD(0xd55d80429a829344),
+	WORD(0x1474a4cbd26fb1bc), WORD(0xf8be72a1e7ec1a0c),
+	WORD(0x8c17acddc153603e), WORD(0xa6ee9e299089d16f),
+	WORD(0x62da5576b53013e5), WORD(0xfb1f26196f66b23a),
+	/* T[9] */
+	WORD(0x821e44b0fd067189), WORD(0xacd0fdb304c35b63),
+	WORD(0x76741d3b845a0ddc), WORD(0x3a637c0e587a18e6),
+	WORD(0x301b8c98ae92b3a7), WORD(0xf3277e8e38eeb602),
+	WORD(0xe032cc465ed6c15c), WORD(0x85ca515fddde6f66),
+	/* T[10] */
+	WORD(0x9732b5eee9b04975), WORD(0xdef62766eca4ea63),
+	WORD(0xce2d25a3c3cc6b03), WORD(0x55e3c2595ca8544b),
+	WORD(0x3484fa835240a1ab), WORD(0x5a9f2a2a31bb0ea5),
+	WORD(0xf4b1b01b917eeb67), WORD(0x02dbe6ce09dc9fe6),
+	/* T[11] */
+	WORD(0x665863da38a4956b), WORD(0xf57cac05b0c9591e),
+	WORD(0x4ba3603e699b644e), WORD(0xc20bac6623061c9f),
+	WORD(0xd5446fdc8c9c60b3), WORD(0x39e1c0960e642c6b),
+	WORD(0xfb03298505f1408a), WORD(0xaa8af0697fc18a25),
+	/* T[12] */
+	WORD(0x3fc1cf4385ee57b9), WORD(0x1610e5412e3d82f9),
+	WORD(0x5e7156e320a7fda1), WORD(0x3172098a143af0c1),
+	WORD(0x1cf68c1e83b98dbd), WORD(0x32a88a075e4c5aa3),
+	WORD(0x6428a3b7634bae5d), WORD(0x746360d7c33a837a),
+	/* T[13] */
+	WORD(0xecb205ed9f36e768), WORD(0xf0c3c85585b3837a),
+	WORD(0x11867501059bb7f6), WORD(0x2bd25cafef05f8e4),
+	WORD(0x50315dd109994eeb), WORD(0xa269ddc94d4246db),
+	WORD(0x8a850d244320b069), WORD(0x9e33f1effe9eb577),
+	/* T[14] */
+	WORD(0x6acca7bca5706bf7), WORD(0x31f41d138dc8b9f8),
+	WORD(0xe85dcd4b1656968c), WORD(0x336471023e801923),
+	WORD(0x0de9a66187b8cbbd), WORD(0xbb52b2e9a27ea425),
+	WORD(0x373b1800184259a6), WORD(0x8caa8c46591fc946),
+	/* T[15] */
+	WORD(0xfd92a16c0664acba), WORD(0x027fff32edd6c62c),
+	WORD(0x9571fd851822787f), WORD(0x0a019d4913e66be3),
+	WORD(0xa1e62fbc733b322b), WORD(0xb3c6c72fdb9979ab),
+	WORD(0xa3d25adcc682f59a), WORD(0x3c32401ab402c194),
+	/* T[16] */
+	WORD(0x21cab5781331c151), WORD(0x4e399d450e8a9e6a),
+	WORD(0xfa90c07d565c8b4a), WORD(0x694e0e50debb407a),
+	WORD(0x19e4375597c924cf), WORD(0xae61d18a29c74abc),
+	WORD(0xfad446c7c745d3c9), WORD(0xeccec43aefd30937),
+	/* T[17] */
+	WORD(0x15defdbfd7cdf7a1), WORD(0xf3d5267cc7b9bc08),
+	WORD(0xf9ca0ac383833379), WORD(0x991881a01f191ec7),
+	WORD(0x6e6b0e3a1b80117c), WORD(0xa8322f8457cfcd78),
+	WORD(0x8bc7f288cdd902f5), WORD(0x77ab6d00637494c1),
+	/* T[18] */
+	WORD(0x38e59c150f640fad), WORD(0xb836ba1fe1e69a2d),
+	WORD(0x6626bd0b68beb3c0), WORD(0xd664fdc47ee5f316),
+	WORD(0x24bce21ac2bf5ac1), WORD(0x0b0be00170e39842),
+	WORD(0xc6ebef5a991f9baa), WORD(0xf5c047ae12369335),
+	/* T[19] */
+	WORD(0xaf6ec5dda0906a93), WORD(0xfc9a2617b85d48f4),
+	WORD(0x610c235ca13fd5fd), WORD(0x0f7bba60514d546e),
+	WORD(0xa4c810d15bf17765), WORD(0xe0d44476f84fda52),
+	WORD(0x06671af679aa92b4), WORD(0x41f6dec14d5cc38d),
+	/* T[20] */
+	WORD(0x74cf66a8811d6c76), WORD(0xa920a20d033afe0b),
+	WORD(0x77cfcc7da3591b99), WORD(0x64dc49b367b721c8),
+	WORD(0x3d2d03399b3884fa), WORD(0x356522ba345d36ec),
+	WORD(0xa56da3553e6445f3), WORD(0x642954381aaa9c93),
+	/* T[21] */
+	WORD(0x1146a656e1cf1ee0), WORD(0x7937f944a143d962),
+	WORD(0xcf930c93c4c4e9ef), WORD(0x35be04ce631cd689),
+	WORD(0x9bd4cea2a30af57b), WORD(0xcd84cd02b1c4930f),
+	WORD(0x5e606beb51fb59a1), WORD(0x57f9f7225b25ec54),
+	/* T[22] */
+	WORD(0xdccfe4acbe6ebc56), WORD(0x42340e3b8edef80c),
+	WORD(0x2d1190075aa07930), WORD(0xab36048e13c5d038),
+	WORD(0x72e642f65fba58b1), WORD(0x4579c88388e8c26e),
+	WORD(0xc02a828d8a35f4da), WORD(0xdfae02b2bc02b4f2),
+	/* T[23] */
+	WORD(0xa5c2e2c306bb88d3), WORD(0x6974dbf23c37db15),
+	WORD(0x5df1f87bb8896853), WORD(0x6be600deefec4eb8),
+	WORD(0x7ac91e4772469f14), WORD(0x41ba10b5c8139a3b),
+	WORD(0xdaae3665a0e72ec5), WORD(0xea0ed0e902be358f),
+	/* T[24] */
+	WORD(0x25328c46da00e0b3), WORD(0xc8d64e0241016756),
+	WORD(0xc409b717ae22275b), WORD(0xc17a5c4a044860d8),
+	WORD(0xe1b47e4ab12b302d), WORD(0x2b7d51fc406564e1),
+	WORD(0x85de76f0ad4d4c58), WORD(0x5ea02941e088a4a2),
+	/* T[25] */
+	WORD(0x7835e7c23202ba4d), WORD(0x81e985633a1a23cf),
+	WORD(0xc3f684ce40753a42), WORD(0x3a3eaddbe11622a2),
+	WORD(0xa4e717cc8f8193ef), WORD(0xfc25daae651df367),
+	WORD(0x7ab7404c077e7463), WORD(0x79e7b5aecc63887d),
+	/* T[26] */
+	WORD(0x21668013ab276795), WORD(0x3d4f51fdf66da853),
+	WORD(0x298c21e4d4968b25), WORD(0x7bd08fd0009d86e2),
+	WORD(0x0e68b0ae8368cd52), WORD(0x5adb8e4cc28f366c),
+	WORD(0x2b09107b45e91a00), WORD(0x710a8d4809a6a14c),
+	/* T[27] */
+	WORD(0x617cd763beefb4f3), WORD(0x26b136be6890818a),
+	WORD(0x096049d0d6fdc497), WORD(0xb92dafd03b143eee),
+	WORD(0x3dd58d4c0c16a11d), WORD(0x71d0915557d96611),
+	WORD(0x2d717a33449d469f), WORD(0xae67225b14f1425b),
+	/* T[28] */
+	WORD(0xc34a5a618d758d83), WORD(0xbd36376e51231f96),
+	WORD(0xce066a44a24524bc), WORD(0x379abb439f5fbb80),
+	WORD(0xcf1cc5a70c12f0e1), WORD(0x5aecdeef3437f4d5),
+	WORD(0x88a918384c00ceed), WORD(0x0c6f96ac86ce7b89),
+	/* T[29] */
+	WORD(0xa00f1ac8212f48d4), WORD(0x2e7fa2b32375e348),
+	WORD(0x7c94299df62d0d8a), WORD(0x195954a7221befa5),
+	WORD(0x2c324c13a0dd5c52), WORD(0x6f07976c39de5523),
+	WORD(0x9b71559e9717b432), WORD(0xd1541b8e9b6d228a),
+	/* T[30] */
+	WORD(0xee6bb69bde32cc14), WORD(0x69f4d3c9f9fc9533),
+	WORD(0x7093ceb916782df7), WORD(0xe995dd880d11af6d),
+	WORD(0x73512186402c5402), WORD(0x330c9bb87a00d4a6),
+	WORD(0xfb45d2528e558e58), WORD(0xc66aaec1b30126eb),
+	/* T[31] */
+	WORD(0xf9c5e9de44b06ed7), WORD(0x6ce7c4f74a597159),
+	WORD(0xd02ec441833accb5), WORD(0xf30205996296e8fc),
+	WORD(0x7df6c5c6c2afbe06), WORD(0xff429dda9c849b09),
+	WORD(0x42170166f5dd78d6), WORD(0x2403ea21830c388b),
+};
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+static const word_t secp256r1_gen_comb[] = {
+	/* T[0] */
+	WORD(0x59cc4be4), WORD(0x99b32dec), WORD(0xb86ac974), WORD(0x9cf49469),
+	WORD(0x20ae1d26), WORD(0x6b51751c), WORD(0xa997aa99), WORD(0xb26bed39),
+	WORD(0x3c9db7a2), WORD(0x9a510981), WORD(0xccdb0918), WORD(0x38d0b967),
+	WORD(0x2177aaeb), WORD(0x313c232c), WORD(0x7b8fdb5b), WORD(0x8f4e6090),
+	/* T[1] */
+	WORD(0x9a395ddb), WORD(0x182f4b72), WORD(0x6ae2f96d), WORD(0xc803f9bc),
+	WORD(0x7656e088), WORD(0x976d0761), WORD(0xb350aaba), WORD(0x468beb88),
+	WORD(0xaa42a0ac), WORD(0x05dabdf9), WORD(0x118af982), WORD(0x08dfb949),
+	WORD(0xd7df1167), WORD(0x05ad10c2), WORD(0x7b84564f), WORD(0xe2099d48),
+	/* T[2] */
+	WORD(0x89337219), WORD(0xd46783a0), WORD(0xb4da494f), WORD(0xa071ef2b),
+	WORD(0x7491e4c4), WORD(0xe84eb63b), WORD(0x24a8b453), WORD(0x09c8bd94),
+	WORD(0xc0799c36), WORD(0x5050aefb), WORD(0x909c479e), WORD(0x0c2eccbd),
+	WORD(0x601f29d0), WORD(0xd1fabef6), WORD(0xc0347267), WORD(0xf0753552),
+	/* T[3] */
+	WORD(0xd5c5fd3d), WORD(0xc91c3a19), WORD(0x1b1fcdca), WORD(0x779456f5),
+	WORD(0xde6fd5ca), WORD(0xb9d55947), WORD(0xad87c7d9), WORD(0xe2207308),
+	WORD(0xa1e6dc7a), WORD(0x65aba496), WORD(0xc8a15bec), WORD(0xf717494d),
+	WORD(0xc8d93cc1), WORD(0x6d849f6b), WORD(0x6852e7c9), WORD(0x9bb3e310),
+	/* T[4] */
+	WORD(0x4ae9f8f8), WORD(0x039f159e), WORD(0x11ae0c0f), WORD(0xbcb8d7d2),
+	WORD(0xc2a7aa6a), WORD(0x441a985f), WORD(0xc22712f9), WORD(0x00e6837c),
+	WORD(0x6d001b98), WORD(0xd88fa9b0), WORD(0xadd601cd), WORD(0x84185677),
+	WORD(0xd74a083b), WORD(0x1c3d0b7a), WORD(0xd07a6b75), WORD(0x9f562e54),
+	/* T[5] */
+	WORD(0xccf47afd), WORD(0x62a3d600), WORD(0x19341a6c), WORD(0xef8d4beb),
+	WORD(0x7f584af8), WORD(0x7666ed3c), WORD(0x87614960), WORD(0x77f9a2bd),
+	WORD(0x583a0b1d), WORD(0x9bad432e), WORD(0x59c75118), WORD(0xd73b899a),
+	WORD(0x41405318), WORD(0x7dd074a8), WORD(0xb680daf7), WORD(0x35e3de66),
+	/* T[6] */
+	WORD(0x8d1bb3b3), WORD(0x31f845f1), WORD(0x455c3b66), WORD(0xc01970c2),
+	WORD(0x00dd6f5d), WORD(0x34a1d196), WORD(0xbd0196e2), WORD(0x66619ca5),
+	WORD(0xd54eb737), WORD(0x9345c919), WORD(0xc89f8ad5), WORD(0xcc6f49b8),
+	WORD(0xc92d2396), WORD(0x553709e3), WORD(0xb424557d), WORD(0xa2c024b2),
+	/* T[7] */
+	WORD(0x5a53321c), WORD(0x6398c2b5), WORD(0x092001a2), WORD(0xa70fe391),
+	WORD(0xd8802fe2), WORD(0xcb4c2947), WORD(0x0c1cf0af), WORD(0x3c51d45a),
+	WORD(0x583c0261), WORD(0x9357c287), WORD(0x557ad9fd), WORD(0x997039de),
+	WORD(0x2445266f), WORD(0xeb4f507e), WORD(0x70077237), WORD(0xe4ffee67),
+	/* T[8] */
+	WORD(0x7f68bdd1), WORD(0x7ca74f2f), WORD(0x9a829344), WORD(0xd55d8042),
+	WORD(0xd26fb1bc), WORD(0x1474a4cb), WORD(0xe7ec1a0c), WORD(0xf8be72a1),
+	WORD(0xc153603e), WORD(0x8c17acdd), WORD(0x9089d16f), WORD(0xa6ee9e29),
+	WORD(0xb53013e5), WORD(0x62da5576), WORD(0x6f66b23a), WORD(0xfb1f2619),
+	/* T[9] */
+	WORD(0xfd067189), WORD(0x821e44b0), WORD(0x04c35b63), WORD(0xacd0fdb3),
+	WORD(0x845a0ddc), WORD(0x76741d3b), WORD(0x587a18e6), WORD(0x3a637c0e),
+	WORD(0xae92b3a7), WORD(0x301b8c98), WORD(0x38eeb602), WORD(0xf3277e8e),
+	WORD(0x5ed6c15c), WORD(0xe032cc46), WORD(0xddde6f66), WORD(0x85ca515f),
+	/* T[10] */
+	WORD(0xe9b04975), WORD(0x9732b5ee), WORD(0xeca4ea63), WORD(0xdef62766),
+	WORD(0xc3cc6b03), WORD(0xce2d25a3), WORD(0x5ca8544b), WORD(0x55e3c259),
+	WORD(0x5240a1ab), WORD(0x3484fa83), WORD(0x31bb0ea5), WORD(0x5a9f2a2a),
+	WORD(0x917eeb67), WORD(0xf4b1b01b), WORD(0x09dc9fe6), WORD(0x02dbe6ce),
+	/* T[11] */
+	WORD(0x38a4956b), WORD(0x665863da), WORD(0xb0c9591e), WORD(0xf57cac05),
+	WORD(0x699b644e), WORD(0x4ba3603e), WORD(0x23061c9f), WORD(0xc20bac66),
+	WORD(0x8c9c60b3), WORD(0xd5446fdc), WORD(0x0e642c6b), WORD(0x39e1c096),
+	WORD(0x05f1408a), WORD(0xfb032985), WORD(0x7fc18a25), WORD(0xaa8af069),
+	/* T[12] */
+	WORD(0x85ee57b9), WORD(0x3fc1cf43), WORD(0x2e3d82f9), WORD(0x1610e541),
+	WORD(0x20a7fda1), WORD(0x5e7156e3), WORD(0x143af0c1), WORD(0x3172098a),
+	WORD(0x83b98dbd), WORD(0x1cf68c1e), WORD(0x5e4c5aa3), WORD(0x32a88a07),
+	WORD(0x634bae5d), WORD(0x6428a3b7), WORD(0xc33a837a), WORD(0x746360d7),
+	/* T[13] */
+	WORD(0x9f36e768), WORD(0xecb205ed), WORD(0x85b3837a), WORD(0xf0c3c855),
+	WORD(0x059bb7f6), WORD(0x11867501), WORD(0xef05f8e4), WORD(0x2bd25caf),
+	WORD(0x09994eeb), WORD(0x50315dd1), WORD(0x4d4246db), WORD(0xa269ddc9),
+	WORD(0x4320b069), WORD(0x8a850d24), WORD(0xfe9eb577), WORD(0x9e33f1ef),
+	/* T[14] */
+	WORD(0xa5706bf7), WORD(0x6acca7bc), WORD(0x8dc8b9f8), WORD(0x31f41d13),
+	WORD(0x1656968c), WORD(0xe85dcd4b), WORD(0x3e801923), WORD(0x33647102),
+	WORD(0x87b8cbbd), WORD(0x0de9a661), WORD(0xa27ea425), WORD(0xbb52b2e9),
+	WORD(0x184259a6), WORD(0x373b1800), WORD(0x591fc946), WORD(0x8caa8c46),
+	/* T[15] */
+	WORD(0x0664acba), WORD(0xfd92a16c), WORD(0xedd6c62c), WORD(0x027fff32),
+	WORD(0x1822787f), WORD(0x9571fd85), WORD(0x13e66be3), WORD(0x0a019d49),
+	WORD(0x733b322b), WORD(0xa1e62fbc), WORD(0xdb9979ab), WORD(0xb3c6c72f),
+	WORD(0xc682f59a), WORD(0xa3d25adc), WORD(0xb402c194), WORD(0x3c32401a),
+	/* T[16] */
+	WORD(0x1331c151), WORD(0x21cab578), WORD(0x0e8a9e6a), WORD(0x4e399d45),
+	WORD(0x565c8b4a), WORD(0xfa90c07d), WORD(0xdebb407a), WORD(0x694e0e50),
+	WORD(0x97c924cf), WORD(0x19e43755), WORD(0x29c74abc), WORD(0xae61d18a),
+	WORD(0xc745d3c9), WORD(0xfad446c7), WORD(0xefd30937), WORD(0xeccec43a),
+	/* T[17] */
+	WORD(0xd7cdf7a1), WORD(0x15defdbf), WORD(0xc7b9bc08), WORD(0xf3d5267c),
+	WORD(0x83833379), WORD(0xf9ca0ac3), WORD(0x1f191ec7), WORD(0x991881a0),
+	WORD(0x1b80117c), WORD(0x6e6b0e3a), WORD(0x57cfcd78), WORD(0xa8322f84),
+	WORD(0xcdd902f5), WORD(0x8bc7f288), WORD(0x637494c1), WORD(0x77ab6d00),
+	/* T[18] */
+	WORD(0x0f640fad), WORD(0x38e59c15), WORD(0xe1e69a2d), WORD(0xb836ba1f),
+	WORD(0x68beb3c0), WORD(0x6626bd0b), WORD(0x7ee5f316), WORD(0xd664fdc4),
+	WORD(0xc2bf5ac1), WORD(0x24bce21a), WORD(0x70e39842), WORD(0x0b0be001),
+	WORD(0x991f9baa), WORD(0xc6ebef5a), WORD(0x12369335), WORD(0xf5c047ae),
+	/* T[19] */
+	WORD(0xa0906a93), WORD(0xaf6ec5dd), WORD(0xb85d48f4), WORD(0xfc9a2617),
+	WORD(0xa13fd5fd), WORD(0x610c235c), WORD(0x514d546e), WORD(0x0f7bba60),
+	WORD(0x5bf17765), WORD(0xa4c810d1), WORD(0xf84fda52), WORD(0xe0d44476),
+	WORD(0x79aa92b4), WORD(0x06671af6), WORD(0x4d5cc38d), WORD(0x41f6dec1),
+	/* T[20] */
+	WORD(0x811d6c76), WORD(0x74cf66a8), WORD(0x033afe0b), WORD(0xa920a20d),
+	WORD(0xa3591b99), WORD(0x77cfcc7d), WORD(0x67b721c8), WORD(0x64dc49b3),
+	WORD(0x9b3884fa), WORD(0x3d2d0339), WORD(0x345d36ec), WORD(0x356522ba),
+	WORD(0x3e6445f3), WORD(0xa56da355), WORD(0x1aaa9c93), WORD(0x64295438),
+	/* T[21] */
+	WORD(0xe1cf1ee0), WORD(0x1146a656), WORD(0xa143d962), WORD(0x7937f944),
+	WORD(0xc4c4e9ef), WORD(0xcf930c93), WORD(0x631cd689), WORD(0x35be04ce),
+	WORD(0xa30af57b), WORD(0x9bd4cea2), WORD(0xb1c4930f), WORD(0xcd84cd02),
+	WORD(0x51fb59a1), WORD(0x5e606beb), WORD(0x5b25ec54), WORD(0x57f9f722),
+	/* T[22] */
+	WORD(0xbe6ebc56), WORD(0xdccfe4ac), WORD(0x8edef80c), WORD(0x42340e3b),
+	WORD(0x5aa07930), WORD(0x2d119007), WORD(0x13c5d038), WORD(0xab36048e),
+	WORD(0x5fba58b1), WORD(0x72e642f6), WORD(0x88e8c26e), WORD(0x4579c883),
+	WORD(0x8a35f4da), WORD(0xc02a828d), WORD(0xbc02b4f2), WORD(0xdfae02b2),
+	/* T[23] */
+	WORD(0x06bb88d3), WORD(0xa5c2e2c3), WORD(0x3c37db15), WORD(0x6974dbf2),
+	WORD(0xb8896853), WORD(0x5df1f87b), WORD(0xefec4eb8), WORD(0x6be600de),
+	WORD(0x72469f14), WORD(0x7ac91e47), WORD(0xc8139a3b), WORD(0x41ba10b5),
+	WORD(0xa0e72ec5), WORD(0xdaae3665), WORD(0x02be358f), WORD(0xea0ed0e9),
+	/* T[24] */
+	WORD(0xda00e0b3), WORD(0x25328c46), WORD(0x41016756), WORD(0xc8d64e02),
+	WORD(0xae22275b), WORD(0xc409b717), WORD(0x044860d8), WORD(0xc17a5c4a),
+	WORD(0xb12b302d), WORD(0xe1b47e4a), WORD(0x406564e1), WORD(0x2b7d51fc),
+	WORD(0xad4d4c58), WORD(0x85de76f0), WORD(0xe088a4a2), WORD(0x5ea02941),
+	/* T[25] */
+	WORD(0x3202ba4d), WORD(0x7835e7c2), WORD(0x3a1a23cf), WORD(0x81e98563),
+	WORD(0x40753a42), WORD(0xc3f684ce), WORD(0xe11622a2), WORD(0x3a3eaddb),
+	WORD(0x8f8193ef), WORD(0xa4e717cc), WORD(0x651df367), WORD(0xfc25daae),
+	WORD(0x077e7463), WORD(0x7ab7404c), WORD(0xcc63887d), WORD(0x79e7b5ae),
+	/* T[26] */
+	WORD(0xab276795), WORD(0x21668013), WORD(0xf66da853), WORD(0x3d4f51fd),
+	WORD(0xd4968b25), WORD(0x298c21e4), WORD(0x009d86e2), WORD(0x7bd08fd0),
+	WORD(0x8368cd52), WORD(0x0e68b0ae), WORD(0xc28f366c), WORD(0x5adb8e4c),
+	WORD(0x45e91a00), WORD(0x2b09107b), WORD(0x09a6a14c), WORD(0x710a8d48),
+	/* T[27] */
+	WORD(0xbeefb4f3), WORD(0x617cd763), WORD(0x6890818a), WORD(0x26b136be),
+	WORD(0xd6fdc497), WORD(0x096049d0), WORD(0x3b143eee), WORD(0xb92dafd0),
+	WORD(0x0c16a11d), WORD(0x3dd58d4c), WORD(0x57d96611), WORD(0x71d09155),
+	WORD(0x449d469f), WORD(0x2d717a33), WORD(0x14f1425b), WORD(0xae67225b),
+	/* T[28] */
+	WORD(0x8d758d83), WORD(0xc34a5a61), WORD(0x51231f96), WORD(0xbd36376e),
+	WORD(0xa24524bc), WORD(0xce066a44), WORD(0x9f5fbb80), WORD(0x379abb43),
+	WORD(0x0c12f0e1), WORD(0xcf1cc5a7), WORD(0x3437f4d5), WORD(0x5aecdeef),
+	WORD(0x4c00ceed), WORD(0x88a91838), WORD(0x86ce7b89), WORD(0x0c6f96ac),
+	/* T[29] */
+	WORD(0x212f48d4), WORD(0xa00f1ac8), WORD(0x2375e348), WORD(0x2e7fa2b3),
+	WORD(0xf62d0d8a), WORD(0x7c94299d), WORD(0x221befa5), WORD(0x195954a7),
+	WORD(0xa0dd5c52), WORD(0x2c324c13), WORD(0x39de5523), WORD(0x6f07976c),
+	WORD(0x9717b432), WORD(0x9b71559e), WORD(0x9b6d228a), WORD(0xd1541b8e),
+	/* T[30] */
+	WORD(0xde32cc14), WORD(0xee6bb69b), WORD(0xf9fc9533), WORD(0x69f4d3c9),
+	WORD(0x16782df7), WORD(0x7093ceb9), WORD(0x0d11af6d), WORD(0xe995dd88),
+	WORD(0x402c5402), WORD(0x73512186), WORD(0x7a00d4a6), WORD(0x330c9bb8),
+	WORD(0x8e558e58), WORD(0xfb45d252), WORD(0xb30126eb), WORD(0xc66aaec1),
+	/* T[31] */
+	WORD(0x44b06ed7), WORD(0xf9c5e9de), WORD(0x4a597159), WORD(0x6ce7c4f7),
+	WORD(0x833accb5), WORD(0xd02ec441), WORD(0x6296e8fc), WORD(0xf3020599),
+	WORD(0xc2afbe06), WORD(0x7df6c5c6), WORD(0x9c849b09), WORD(0xff429dda),
+	WORD(0xf5dd78d6), WORD(0x42170166), WORD(0x830c388b), WORD(0x2403ea21),
+};
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+static const word_t secp256r1_gen_comb[] = {
+	/* T[0] */
+	WORD(0x4be4), WORD(0x59cc), WORD(0x2dec), WORD(0x99b3), WORD(0xc974), WORD(0xb86a),
+	WORD(0x9469), WORD(0x9cf4), WORD(0x1d26), WORD(0x20ae), WORD(0x751c), WORD(0x6b51),
+	WORD(0xaa99), WORD(0xa997), WORD(0xed39), WORD(0xb26b), WORD(0xb7a2), WORD(0x3c9d),
+	WORD(0x0981), WORD(0x9a51), WORD(0x0918), WORD(0xccdb), WORD(0xb967), WORD(0x38d0),
+	WORD(0xaaeb), WORD(0x2177), WORD(0x232c), WORD(0x313c), WORD(0xdb5b), WORD(0x7b8f),
+	WORD(0x6090), WORD(0x8f4e),
+	/* T[1] */
+	WORD(0x5ddb), WORD(0x9a39), WORD(0x4b72), WORD(0x182f), WORD(0xf96d), WORD(0x6ae2),
+	WORD(0xf9bc), WORD(0xc803), WORD(0xe088), WORD(0x7656), WORD(0x0761), WORD(0x976d),
+	WORD(0xaaba), WORD(0xb350), WORD(0xeb88), WORD(0x468b), WORD(0xa0ac), WORD(0xaa42),
+	WORD(0xbdf9), WORD(0x05da), WORD(0xf982), WORD(0x118a), WORD(0xb949), WORD(0x08df),
+	WORD(0x1167), WORD(0xd7df), WORD(0x10c2), WORD(0x05ad), WORD(0x564f), WORD(0x7b84),
+	WORD(0x9d48), WORD(0xe209),
+	/* T[2] */
+	WORD(0x7219), WORD(0x8933), WORD(0x83a0), WORD(0xd467), WORD(0x494f), WORD(0xb4da),
+	WORD(0xef2b), WORD(0xa071), WORD(0xe4c4), WORD(0x7491), WORD(0xb63b), WORD(0xe84e),
+	WORD(0xb453), WORD(0x24a8), WORD(0xbd94), WORD(0x09c8), WORD(0x9c36), WORD(0xc079),
+	WORD(0xaefb), WORD(0x5050), WORD(0x479e), WORD(0x909c), WORD(0xccbd), WORD(0x0c2e),
+	WORD(0x29d0), WORD(0x601f), WORD(0xbef6), WORD(0xd1fa), WORD(0x7267), WORD(0xc034),
+	WORD(0x3552), WORD(0xf075),
+	/* T[3] */
+	WORD(0xfd3d), WORD(0xd5c5), WORD(0x3a19), WORD(0xc91c), WORD(0xcdca), WORD(0x1b1f),
+	WORD(0x56f5), WORD(0x7794), WORD(0xd5ca), WORD(0xde6f), WORD(0x5947), WORD(0xb9d5),
+	WORD(0xc7d9), WORD(0xad87), WORD(0x7308), WORD(0xe220), WORD(0xdc7a), WORD(0xa1e6),
+	WORD(0xa496), WORD(0x65ab), WORD(0x5bec), WORD(0xc8a1), WORD(0x494d), WORD(0xf717),
+	WORD(0x3cc1), WORD(0xc8d9), WORD(0x9f6b), WORD(0x6d84), WORD(0xe7c9), WORD(0x6852),
+	WORD(0xe310), WORD(0x9bb3),
+	/* T[4] */
+	WORD(0xf8f8), WORD(0x4ae9), WORD(0x159e), WORD(0x039f), WORD(0x0c0f), WORD(0x11ae),
+	WORD(0xd7d2), WORD(0xbcb8), WORD(0xaa6a), WORD(0xc2a7), WORD(0x985f), WORD(0x441a),
+	WORD(0x12f9), WORD(0xc227), WORD(0x837c), WORD(0x00e6), WORD(0x1b98), WORD(0x6d00),
+	WORD(0xa9b0), WORD(0xd88f), WORD(0x01cd), WORD(0xadd6), WORD(0x5677), WORD(0x8418),
+	WORD(0x083b), WORD(0xd74a), WORD(0x0b7a), WORD(0x1c3d), WORD(0x6b75), WORD(0xd07a),
+	WORD(0x2e54), WORD(0x9f56),
+	/* T[5] */
+	WORD(0x7afd), WORD(0xccf4), WORD(0xd600), WORD(0x62a3), WORD(0x1a6c), WORD(0x1934),
+	WORD(0x4beb), WORD(0xef8d), WORD(0x4af8), WORD(0x7f58), WORD(0xed3c), WORD(0x7666),
+	WORD(0x4960), WORD(0x8761), WORD(0xa2bd), WORD(0x77f9), WORD(0x0b1d), WORD(0x583a),
+	WORD(0x432e), WORD(0x9bad), WORD(0x5118), WORD(0x59c7), WORD(0x899a), WORD(0xd73b),
+	WORD(0x5318), WORD(0x4140), WORD(0x74a8), WORD(0x7dd0), WORD(0xdaf7), WORD(0xb680),
+	WORD(0xde66), WORD(0x35e3),
+	/* T[6] */
+	WORD(0xb3b3), WORD(0x8d1b), WORD(0x45f1), WORD(0x31f8), WORD(0x3b66), WORD(0x455c),
+	WORD(0x70c2), WORD(0xc019), WORD(0x6f5d), WORD(0x00dd), WORD(0xd196), WORD(0x34a1),
+	WORD(0x96e2), WORD(0xbd01), WORD(0x9ca5), WORD(0x6661), WORD(0xb737), WORD(0xd54e),
+	WORD(0xc919), WORD(0x9345), WORD(0x8ad5), WORD(0xc89f), WORD(0x49b8), WORD(0xcc6f),
+	WORD(0x2396), WORD(0xc92d), WORD(0x09e3), WORD(0x5537), WORD(0x557d), WORD(0xb424),
+	WORD(0x24b2), WORD(0xa2c0),
+	/* T[7] */
+	WORD(0x321c), WORD(0x5a53), WORD(0xc2b5), WORD(0x6398), WORD(0x01a2), WORD(0x0920),
+	WORD(0xe391), WORD(0xa70f), WORD(0x2fe2), WORD(0xd880), WORD(0x2947), WORD(0xcb4c),
+	WORD(0xf0af), WORD(0x0c1c), WORD(0xd45a), WORD(0x3c51), WORD(0x0261), WORD(0x583c),
+	WORD(0xc287), WORD(0x9357), WORD(0xd9fd), WORD(0x557a), WORD(0x39de), WORD(0x9970),
+	WORD(0x266f), WORD(0x2445), WORD(0x507e), WORD(0xeb4f), WORD(0x7237), WORD(0x7007),
+	WORD(0xee67), WORD(0xe4ff),
+	/* T[8] */
+	WORD(0xbdd1), WORD(0x7f68), WORD(0x4f2f), WORD(0x7ca7), WORD(0x9344), WORD(0x9a82),
+	WORD(0x8042), WORD(0xd55d), WORD(0xb1bc), WORD(0xd26f), WORD(0xa4cb), WORD(0x1474),
+	WORD(0x1a0c), WORD(0xe7ec), WORD(0x72a1), WORD(0xf8be), WORD(0x603e), WORD(0xc153),
+	WORD(0xacdd), WORD(0x8c17), WORD(0xd16f), WORD(0x9089), WORD(0x9e29), WORD(0xa6ee),
+	WORD(0x13e5), WORD(0xb530), WORD(0x5576), WORD(0x62da), WORD(0xb23a), WORD(0x6f66),
+	WORD(0x2619), WORD(0xfb1f),
+	/* T[9] */
+	WORD(0x7189), WORD(0xfd06), WORD(0x44b0), WORD(0x821e), WORD(0x5b63), WORD(0x04c3),
+	WORD(0xfdb3), WORD(0xacd0), WORD(0x0ddc), WORD(0x845a), WORD(0x1d3b), WORD(0x7674),
+	WORD(0x18e6), WORD(0x587a), WORD(0x7c0e), WORD(0x3a63), WORD(0xb3a7), WORD(0xae92),
+	WORD(0x8c98), WORD(0x301b), WORD(0xb602), WORD(0x38ee), WORD(0x7e8e), WORD(0xf327),
+	WORD(0xc15c), WORD(0x5ed6), WORD(0xcc46), WORD(0xe032), WORD(0x6f66), WORD(0xddde),
+	WORD(0x515f), WORD(0x85ca),
+	/* T[10] */
+	WORD(0x4975), WORD(0xe9b0), WORD(0xb5ee), WORD(0x9732), WORD(0xea63), WORD(0xeca4),
+	WORD(0x2766), WORD(0xdef6), WORD(0x6b03), WORD(0xc3cc), WORD(0x25a3), WORD(0xce2d),
+	WORD(0x544b), WORD(0x5ca8), WORD(0xc259), WORD(0x55e3), WORD(0xa1ab), WORD(0x5240),
+	WORD(0xfa83), WORD(0x3484), WORD(0x0ea5), WORD(0x31bb), WORD(0x2a2a), WORD(0x5a9f),
+	WORD(0xeb67), WORD(0x917e), WORD(0xb01b), WORD(0xf4b1), WORD(0x9fe6), WORD(0x09dc),
+	WORD(0xe6ce), WORD(0x02db),
+	/* T[11] */
+	WORD(0x956b), WORD(0x38a4), WORD(0x63da), WORD(0x6658), WORD(0x591e), WORD(0xb0c9),
+	WORD(0xac05), WORD(0xf57c), WORD(0x644e), WORD(0x699b), WORD(0x603e), WORD(0x4ba3),
+	WORD(0x1c9f), WORD(0x2306), WORD(0xac66), WORD(0xc20b), WORD(0x60b3), WORD(0x8c9c),
+	WORD(0x6fdc), WORD(0xd544), WORD(0x2c6b), WORD(0x0e64), WORD(0xc096), WORD(0x39e1),
+	WORD(0x408a), WORD(0x05f1), WORD(0x2985), WORD(0xfb03), WORD(0x8a25), WORD(0x7fc1),
+	WORD(0xf069), WORD(0xaa8a),
+	/* T[12] */
+	WORD(0x57b9), WORD(0x85ee), WORD(0xcf43), WORD(0x3fc1), WORD(0x82f9), WORD(0x2e3d),
+	WORD(0xe541), WORD(0x1610), WORD(0xfda1), WORD(0x20a7), WORD(0x56e3), WORD(0x5e71),
+	WORD(0xf0c1), WORD(0x143a), WORD(0x098a), WORD(0x3172), WORD(0x8dbd), WORD(0x83b9),
+	WORD(0x8c1e), WORD(0x1cf6), WORD(0x5aa3), WORD(0x5e4c), WORD(0x8a07), WORD(0x32a8),
+	WORD(0xae5d), WORD(0x634b), WORD(0xa3b7), WORD(0x6428), WORD(0x837a), WORD(0xc33a),
+	WORD(0x60d7), WORD(0x7463),
+	/* T[13] */
+	WORD(0xe768), WORD(0x9f36), WORD(0x05ed), WORD(0xecb2), WORD(0x837a), WORD(0x85b3),
+	WORD(0xc855), WORD(0xf0c3), WORD(0xb7f6), WORD(0x059b), WORD(0x7501), WORD(0x1186),
+	WORD(0xf8e4), WORD(0xef05), WORD(0x5caf), WORD(0x2bd2), WORD(0x4eeb), WORD(0x0999),
+	WORD(0x5dd1), WORD(0x5031), WORD(0x46db), WORD(0x4d42), WORD(0xddc9), WORD(0xa269),
+	WORD(0xb069), WORD(0x4320), WORD(0x0d24), WORD(0x8a85), WORD(0xb577), WORD(0xfe9e),
+	WORD(0xf1ef), WORD(0x9e33),
+	/* T[14] */
+	WORD(0x6bf7), WORD(0xa570), WORD(0xa7bc), WORD(0x6acc), WORD(0xb9f8), WORD(0x8dc8),
+	WORD(0x1d13), WORD(0x31f4), WORD(0x968c), WORD(0x1656), WORD(0xcd4b), WORD(0xe85d),
+	WORD(0x1923), WORD(0x3e80), WORD(0x7102), WORD(0x3364), WORD(0xcbbd), WORD(0x87b8),
+	WORD(0xa661), WORD(0x0de9), WORD(0xa425), WORD(0xa27e), WORD(0xb2e9), WORD(0xbb52),
+	WORD(0x59a6), WORD(0x1842), WORD(0x1800), WORD(0x373b), WORD(0xc946), WORD(0x591f),
+	WORD(0x8c46), WORD(0x8caa),
+	/* T[15] */
+	WORD(0xacba), WORD(0x0664), WORD(0xa16c), WORD(0xfd92), WORD(0xc62c), WORD(0xedd6),
+	WORD(0xff32), WORD(0x027f), WORD(0x787f), WORD(0x1822), WORD(0xfd85), WORD(0x9571),
+	WORD(0x6be3), WORD(0x13e6), WORD(0x9d49), WORD(0x0a01), WORD(0x322b), WORD(0x733b),
+	WORD(0x2fbc), WORD(0xa1e6), WORD(0x79ab), WORD(0xdb99), WORD(0xc72f), WORD(0xb3c6),
+	WORD(0xf59a), WORD(0xc682), WORD(0x5adc), WORD(0xa3d2), WORD(0xc194), WORD(0xb402),
+	WORD(0x401a), WORD(0x3c32),
+	/* T[16] */
+	WORD(0xc151), WORD(0x1331), WORD(0xb578), WORD(0x21ca), WORD(0x9e6a), WORD(0x0e8a),
+	WORD(0x9d45), WORD(0x4e39), WORD(0x8b4a), WORD(0x565c), WORD(0xc07d), WORD(0xfa90),
+	WORD(0x407a), WORD(0xdebb), WORD(0x0e50), WORD(0x694e), WORD(0x24cf), WORD(0x97c9),
+	WORD(0x3755), WORD(0x19e4), WORD(0x4abc), WORD(0x29c7), WORD(0xd18a), WORD(0xae61),
+	WORD(0xd3c9), WORD(0xc745), WORD(0x46c7), WORD(0xfad4), WORD(0x0937), WORD(0xefd3),
+	WORD(0xc43a), WORD(0xecce),
+	/* T[17] */
+	WORD(0xf7a1), WORD(0xd7cd), WORD(0xfdbf), WORD(0x15de), WORD(0xbc08), WORD(0xc7b9),
+	WORD(0x267c), WORD(0xf3d5), WORD(0x3379), WORD(0x8383), WORD(0x0ac3), WORD(0xf9ca),
+	WORD(0x1ec7), WORD(0x1f19), WORD(0x81a0), WORD(0x9918), WORD(0x117c), WORD(0x1b80),
+	WORD(0x0e3a), WORD(0x6e6b), WORD(0xcd78), WORD(0x57cf), WORD(0x2f84), WORD(0xa832),
+	WORD(0x02f5), WORD(0xcdd9), WORD(0xf288), WORD(0x8bc7), WORD(0x94c1), WORD(0x6374),
+	WORD(0x6d00), WORD(0x77ab),
+	/* T[18] */
+	WORD(0x0fad), WORD(0x0f64), WORD(0x9c15), WORD(0x38e5), WORD(0x9a2d), WORD(0xe1e6),
+	WORD(0xba1f), WORD(0xb836), WORD(0xb3c0), WORD(0x68be), WORD(0xbd0b), WORD(0x6626),
+	WORD(0xf316), WORD(0x7ee5), WORD(0xfdc4), WORD(0xd664), WORD(0x5ac1), WORD(0xc2bf),
+	WORD(0xe21a), WORD(0x24bc), WORD(0x9842), WORD(0x70e3), WORD(0xe001), WORD(0x0b0b),
+	WORD(0x9baa), WORD(0x991f), WORD(0xef5a), WORD(0xc6eb), WORD(0x9335), WORD(0x1236),
+	WORD(0x47ae), WORD(0xf5c0),
+	/* T[19] */
+	WORD(0x6a93), WORD(0xa090), WORD(0xc5dd), WORD(0xaf6e), WORD(0x48f4), WORD(0xb85d),
+	WORD(0x2617), WORD(0xfc9a), WORD(0xd5fd), WORD(0xa13f), WORD(0x235c), WORD(0x610c),
+	WORD(0x546e), WORD(0x514d), WORD(0xba60), WORD(0x0f7b), WORD(0x7765), WORD(0x5bf1),
+	WORD(0x10d1), WORD(0xa4c8), WORD(0xda52), WORD(0xf84f), WORD(0x4476), WORD(0xe0d4),
+	WORD(0x92b4), WORD(0x79aa), WORD(0x1af6), WORD(0x0667), WORD(0xc38d), WORD(0x4d5c),
+	WORD(0xdec1), WORD(0x41f6),
+	/* T[20] */
+	WORD(0x6c76), WORD(0x811d), WORD(0x66a8), WORD(0x74cf), WORD(0xfe0b), WORD(0x033a),
+	WORD(0xa20d), WORD(0xa920), WORD(0x1b99), WORD(0xa359), WORD(0xcc7d), WORD(0x77cf),
+	WORD(0x21c8), WORD(0x67b7), WORD(0x49b3), WORD(0x64dc), WORD(0x84fa), WORD(0x9b38),
+	WORD(0x0339), WORD(0x3d2d), WORD(0x36ec), WORD(0x345d), WORD(0x22ba), WORD(0x3565),
+	WORD(0x45f3), WORD(0x3e64), WORD(0xa355), WORD(0xa56d), WORD(0x9c93), WORD(0x1aaa),
+	WORD(0x5438), WORD(0x6429),
+	/* T[21] */
+	WORD(0x1ee0), WORD(0xe1cf), WORD(0xa656), WORD(0x1146), WORD(0xd962), WORD(0xa143),
+	WORD(0xf944), WORD(0x7937), WORD(0xe9ef), WORD(0xc4c4), WORD(0x0c93), WORD(0xcf93),
+	WORD(0xd689), WORD(0x631c), WORD(0x04ce), WORD(0x35be), WORD(0xf57b), WORD(0xa30a),
+	WORD(0xcea2), WORD(0x9bd4), WORD(0x930f), WORD(0xb1c4), WORD(0xcd02), WORD(0xcd84),
+	WORD(0x59a1), WORD(0x51fb), WORD(0x6beb), WORD(0x5e60), WORD(0xec54), WORD(0x5b25),
+	WORD(0xf722), WORD(0x57f9),
+	/* T[22] */
+	WORD(0xbc56), WORD(0xbe6e), WORD(0xe4ac), WORD(0xdccf), WORD(0xf80c), WORD(0x8ede),
+	WORD(0x0e3b), WORD(0x4234), WORD(0x7930), WORD(0x5aa0), WORD(0x9007), WORD(0x2d11),
+	WORD(0xd038), WORD(0x13c5), WORD(0x048e), WORD(0xab36), WORD(0x58b1), WORD(0x5fba),
+	WORD(0x42f6), WORD(0x72e6), WORD(0xc26e), WORD(0x88e8), WORD(0xc883), WORD(0x4579),
+	WORD(0xf4da), WORD(0x8a35), WORD(0x828d), WORD(0xc02a), WORD(0xb4f2), WORD(0xbc02),
+	WORD(0x02b2), WORD(0xdfae),
+	/* T[23] */
+	WORD(0x88d3), WORD(0x06bb), WORD(0xe2c3), WORD(0xa5c2), WORD(0xdb15), WORD(0x3c37),
+	WORD(0xdbf2), WORD(0x6974), WORD(0x6853), WORD(0xb889), WORD(0xf87b), WORD(0x5df1),
+	WORD(0x4eb8), WORD(0xefec), WORD(0x00de), WORD(0x6be6), WORD(0x9f14), WORD(0x7246),
+	WORD(0x1e47), WORD(0x7ac9), WORD(0x9a3b), WORD(0xc813), WORD(0x10b5), WORD(0x41ba),
+	WORD(0x2ec5), WORD(0xa0e7), WORD(0x3665), WORD(0xdaae), WORD(0x358f), WORD(0x02be),
+	WORD(0xd0e9), WORD(0xea0e),
+	/* T[24] */
+	WORD(0xe0b3), WORD(0xda00), WORD(0x8c46), WORD(0x2532), WORD(0x6756), WORD(0x4101),
+	WORD(0x4e02), WORD(0xc8d6), WORD(0x275b), WORD(0xae22), WORD(0xb717), WORD(0xc409),
+	WORD(0x60d8), WORD(0x0448), WORD(0x5c4a), WORD(0xc17a), WORD(0x302d), WORD(0xb12b),
+	WORD(0x7e4a), WORD(0xe1b4), WORD(0x64e1), WORD(0x4065), WORD(0x51fc), WORD(0x2b7d),
+	WORD(0x4c58), WORD(0xad4d), WORD(0x76f0), WORD(0x85de), WORD(0xa4a2), WORD(0xe088),
+	WORD(0x2941), WORD(0x5ea0),
+	/* T[25] */
+	WORD(0xba4d), WORD(0x3202), WORD(0xe7c2), WORD(0x7835), WORD(0x23cf), WORD(0x3a1a),
+	WORD(0x8563), WORD(0x81e9), WORD(0x3a42), WORD(0x4075), WORD(0x84ce), WORD(0xc3f6),
+	WORD(0x22a2), WORD(0xe116), WORD(0xaddb), WORD(0x3a3e), WORD(0x93ef), WORD(0x8f81),
+	WORD(0x17cc), WORD(0xa4e7), WORD(0xf367), WORD(0x651d), WORD(0xdaae), WORD(0xfc25),
+	WORD(0x7463), WORD(0x077e), WORD(0x404c), WORD(0x7ab7), WORD(0x887d), WORD(0xcc63),
+	WORD(0xb5ae), WORD(0x79e7),
+	/* T[26] */
+	WORD(0x6795), WORD(0xab27), WORD(0x8013), WORD(0x2166), WORD(0xa853), WORD(0xf66d),
+	WORD(0x51fd), WORD(0x3d4f), WORD(0x8b25), WORD(0xd496), WORD(0x21e4), WORD(0x298c),
+	WORD(0x86e2), WORD(0x009d), WORD(0x8fd0), WORD(0x7bd0), WORD(0xcd52), WORD(0x8368),
+	WORD(0xb0ae), WORD(0x0e68), WORD(0x366c), WORD(0xc28f), WORD(0x8e4c), WORD(0x5adb),
+	WORD(0x1a00), WORD(0x45e9), WORD(0x107b), WORD(0x2b09), WORD(0xa14c), WORD(0x09a6),
+	WORD(0x8d48), WORD(0x710a),
+	/* T[27] */
+	WORD(0xb4f3), WORD(0xbeef), WORD(0xd763), WORD(0x617c), WORD(0x818a), WORD(0x6890),
+	WORD(0x36be), WORD(0x26b1), WORD(0xc497), WORD(0xd6fd), WORD(0x49d0), WORD(0x0960),
+	WORD(0x3eee), WORD(0x3b14), WORD(0xafd0), WORD(0xb92d), WORD(0xa11d), WORD(0x0c16),
+	WORD(0x8d4c), WORD(0x3dd5), WORD(0x6611), WORD(0x57d9), WORD(0x9155), WORD(0x71d0),
+	WORD(0x469f), WORD(0x449d), WORD(0x7a33), WORD(0x2d71), WORD(0x425b), WORD(0x14f1),
+	WORD(0x225b), WORD(0xae67),
+	/* T[28] */
+	WORD(0x8d83), WORD(0x8d75), WORD(0x5a61), WORD(0xc34a), WORD(0x1f96), WORD(0x5123),
+	WORD(0x376e), WORD(0xbd36), WORD(0x24bc), WORD(0xa245), WORD(0x6a44), WORD(0xce06),
+	WORD(0xbb80), WORD(0x9f5f), WORD(0xbb43), WORD(0x379a), WORD(0xf0e1), WORD(0x0c12),
+	WORD(0xc5a7), WORD(0xcf1c), WORD(0xf4d5), WORD(0x3437), WORD(0xdeef), WORD(0x5aec),
+	WORD(0xceed), WORD(0x4c00), WORD(0x1838), WORD(0x88a9), WORD(0x7b89), WORD(0x86ce),
+	WORD(0x96ac), WORD(0x0c6f),
+	/* T[29] */
+	WORD(0x48d4), WORD(0x212f), WORD(0x1ac8), WORD(0xa00f), WORD(0xe348), WORD(0x2375),
+	WORD(0xa2b3), WORD(0x2e7f), WORD(0x0d8a), WORD(0xf62d), WORD(0x299d), WORD(0x7c94),
+	WORD(0xefa5), WORD(0x221b), WORD(0x54a7), WORD(0x1959), WORD(0x5c52), WORD(0xa0dd),
+	WORD(0x4c13), WORD(0x2c32), WORD(0x5523), WORD(0x39de), WORD(0x976c), WORD(0x6f07),
+	WORD(0xb432), WORD(0x9717), WORD(0x559e), WORD(0x9b71), WORD(0x228a), WORD(0x9b6d),
+	WORD(0x1b8e), WORD(0xd154),
+	/* T[30] */
+	WORD(0xcc14), WORD(0xde32), WORD(0xb69b), WORD(0xee6b), WORD(0x9533), WORD(0xf9fc),
+	WORD(0xd3c9), WORD(0x69f4), WORD(0x2df7), WORD(0x1678), WORD(0xceb9), WORD(0x7093),
+	WORD(0xaf6d), WORD(0x0d11), WORD(0xdd88), WORD(0xe995), WORD(0x5402), WORD(0x402c),
+	WORD(0x2186), WORD(0x7351), WORD(0xd4a6), WORD(0x7a00), WORD(0x9bb8), WORD(0x330c),
+	WORD(0x8e58), WORD(0x8e55), WORD(0xd252), WORD(0xfb45), WORD(0x26eb), WORD(0xb301),
+	WORD(0xaec1), WORD(0xc66a),
+	/* T[31] */
+	WORD(0x6ed7), WORD(0x44b0), WORD(0xe9de), WORD(0xf9c5), WORD(0x7159), WORD(0x4a59),
+	WORD(0xc4f7), WORD(0x6ce7), WORD(0xccb5), WORD(0x833a), WORD(0xc441), WORD(0xd02e),
+	WORD(0xe8fc), WORD(0x6296), WORD(0x0599), WORD(0xf302), WORD(0xbe06), WORD(0xc2af),
+	WORD(0xc5c6), WORD(0x7df6), WORD(0x9b09), WORD(0x9c84), WORD(0x9dda), WORD(0xff42),
+	WORD(0x78d6), WORD(0xf5dd), WORD(0x0166), WORD(0x4217), WORD(0x388b), WORD(0x830c),
+	WORD(0xea21), WORD(0x2403),
+};
+#else                     /* unknown word size */
+#error "Unsupported word size"
+#endif
+TO_EC_GEN_TABLE_PARAM(secp256r1_gen_comb, 6);
+
 static const ec_str_params secp256r1_str_params = {
 	.p = &secp256r1_p_str_param,
 	.p_bitlen = &secp256r1_p_bitlen_str_param,
@@ -173,6 +1373,11 @@ static const ec_str_params secp256r1_str_params = {
 	.cofactor = &secp256r1_cofactor_str_param,
 	.oid = &secp256r1_oid_str_param,
 	.name = &secp256r1_name_str_param,
+	.p_inv_chain = &secp256r1_p_inv_chain_param,
+	.p_sqrt_chain = &secp256r1_p_sqrt_chain_param,
+	.q_inv_chain = &secp256r1_q_inv_chain_param,
+	.gen_wnaf_table = &secp256r1_gen_wnaf_table_param,
+	.gen_comb_table = &secp256r1_gen_comb_table_param,
 };
 
 /*
@@ -193,6 +1398,17 @@ static const ec_str_params secp256r1_str_params = {
 #define CURVES_MAX_Q_BIT_LEN CURVE_SECP256R1_Q_BITLEN
 #endif
 
+/*
+ * Limb count of p for the fixed limbs field backend (see fp_fixed.h)
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+#define FP_FIXED_WLEN_4_USED
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+#define FP_FIXED_WLEN_8_USED
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+#define FP_FIXED_WLEN_16_USED
+#endif
+
 #endif /* __EC_PARAMS_SECP256R1_H__ */
 
 #endif /* WITH_CURVE_SECP256R1 */
@@ -177,6 +177,1619 @@ TO_EC_STR_PARAM(secp384r1_oid);
 static const u8 secp384r1_name[] = "SECP384R1";
 TO_EC_STR_PARAM(secp384r1_name);
 
+/* x^(p - 2): 383 squarings and 20 multiplications */
+static const u8 secp384r1_p_inv[] = {
+	0x10, 0x01, 0x00,
+	0x21, 0x02, 0x01,
+	0x32, 0x04, 0x02,
+	0x43, 0x08, 0x03,
+	0x54, 0x10, 0x04,
+	0x65, 0x20, 0x05,
+	0x76, 0x40, 0x06,
+	0x77, 0x40, 0x06,
+	0x77, 0x20, 0x05,
+	0x77, 0x10, 0x04,
+	0x77, 0x08, 0x03,
+	0x77, 0x04, 0x02,
+	0x77, 0x02, 0x01,
+	0x77, 0x01, 0x00,
+	0x77, 0x21, 0x05,
+	0x77, 0x50, 0x04,
+	0x77, 0x08, 0x03,
+	0x77, 0x04, 0x02,
+	0x77, 0x02, 0x01,
+	0x77, 0x02, 0x00,
+};
+TO_EC_CHAIN_PARAM(secp384r1_p_inv);
+
+/* x^((p + 1) / 4): 381 squarings and 16 multiplications */
+static const u8 secp384r1_p_sqrt[] = {
+	0x10, 0x01, 0x00,
+	0x21, 0x02, 0x01,
+	0x32, 0x04, 0x02,
+	0x43, 0x08, 0x03,
+	0x54, 0x10, 0x04,
+	0x65, 0x20, 0x05,
+	0x76, 0x40, 0x06,
+	0x77, 0x40, 0x06,
+	0x77, 0x20, 0x05,
+	0x77, 0x10, 0x04,
+	0x77, 0x08, 0x03,
+	0x77, 0x04, 0x02,
+	0x77, 0x02, 0x01,
+	0x77, 0x01, 0x00,
+	0x77, 0x21, 0x05,
+	0x77, 0x40, 0x00,
+	0x77, 0x1e, 0xff,
+};
+TO_EC_CHAIN_PARAM(secp384r1_p_sqrt);
+
+/* x^(q - 2): 384 squarings and 52 multiplications */
+static const u8 secp384r1_q_inv[] = {
+	0x10, 0x01, 0x00,
+	0x21, 0x02, 0x01,
+	0x32, 0x04, 0x02,
+	0x43, 0x08, 0x03,
+	0x54, 0x10, 0x04,
+	0x65, 0x20, 0x05,
+	0x70, 0x01, 0xff,
+	0x81, 0x00, 0x07,
+	0x98, 0x00, 0x07,
+	0xa9, 0x00, 0x07,
+	0xba, 0x00, 0x07,
+	0xcb, 0x00, 0x07,
+	0xd6, 0x40, 0x06,
+	0xdd, 0x40, 0x06,
+	0xdd, 0x02, 0x01,
+	0xdd, 0x06, 0x09,
+	0xdd, 0x03, 0x01,
+	0xdd, 0x07, 0x0c,
+	0xdd, 0x06, 0x0c,
+	0xdd, 0x01, 0x00,
+	0xdd, 0x0a, 0x02,
+	0xdd, 0x03, 0x08,
+	0xdd, 0x08, 0x0c,
+	0xdd, 0x02, 0x01,
+	0xdd, 0x06, 0x0b,
+	0xdd, 0x04, 0x09,
+	0xdd, 0x05, 0x02,
+	0xdd, 0x03, 0x08,
+	0xdd, 0x03, 0x01,
+	0xdd, 0x0a, 0x0c,
+	0xdd, 0x09, 0x0c,
+	0xdd, 0x04, 0x0b,
+	0xdd, 0x06, 0x0a,
+	0xdd, 0x03, 0x00,
+	0xdd, 0x07, 0x0b,
+	0xdd, 0x07, 0x08,
+	0xdd, 0x05, 0x09,
+	0xdd, 0x05, 0x02,
+	0xdd, 0x05, 0x0b,
+	0xdd, 0x04, 0x0b,
+	0xdd, 0x05, 0x09,
+	0xdd, 0x03, 0x01,
+	0xdd, 0x07, 0x01,
+	0xdd, 0x06, 0x0b,
+	0xdd, 0x04, 0x08,
+	0xdd, 0x03, 0x01,
+	0xdd, 0x04, 0x01,
+	0xdd, 0x04, 0x01,
+	0xdd, 0x06, 0x08,
+	0xdd, 0x05, 0x08,
+	0xdd, 0x06, 0x0b,
+	0xdd, 0x01, 0x00,
+	0xdd, 0x04, 0x00,
+};
+TO_EC_CHAIN_PARAM(secp384r1_q_inv);
+
+/*
+ * Odd multiples G, 3G, ..., 63G of the generator for the wNAF
+ * multiplications (window 7), affine x and y in Montgomery representation
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+static const word_t secp384r1_gen_wnaf[] = {
+	/* G */
+	WORD(0x3dd0756649c0b528), WORD(0x20e378e2a0d6ce38),
+	WORD(0x879c3afc541b4d6e), WORD(0x6454868459a30eff),
+	WORD(0x812ff723614ede2b), WORD(0x4d3aadc2299e1513),
+	WORD(0x23043dad4b03a4fe), WORD(0xa1bfa8bf7bb4a9ac),
+	WORD(0x8bade7562e83b050), WORD(0xc6c3521968f4ffd9),
+	WORD(0xdd8002263969a840), WORD(0x2b78abc25a15c5e9),
+	/* 3G */
+	WORD(0x05e4dbe6c1dc4073), WORD(0xc54ea9fff04f779c),
+	WORD(0x6b2034e9a170ccf0), WORD(0x3a48d732d51c6c3e),
+	WORD(0xe36f7e2d263aa470), WORD(0xd283fe68e7c1c3ac),
+	WORD(0x7e284821c04ee157), WORD(0x92d789a77ae0e36d),
+	WORD(0x132663c04ef67446), WORD(0x68012d5ad2e1d0b4),
+	WORD(0xf6db68b15102b339), WORD(0x465465fc983292af),
+	/* 5G */
+	WORD(0xbb595eba68f1f0df), WORD(0xc185c0cbcc873466),
+	WORD(0x7f1eb1b5293c703b), WORD(0x60db2cf5aacc05e6),
+	WORD(0xc676b987e2e8e4c6), WORD(0xe1bb26b11d178ffb),
+	WORD(0x2b694ba07073fa21), WORD(0x22c16e2e72f34566),
+	WORD(0x80b61b3101c35b99), WORD(0x4b237faf982c0411),
+	WORD(0xe6c5944024de236d), WORD(0x4db1c9d6e209e4a3),
+	/* 7G */
+	WORD(0xdf13b9d17d69222b), WORD(0x4ce6415f874774b1),
+	WORD(0x731edcf8211faa95), WORD(0x5f4215d1659753ed),
+	WORD(0xf893db589db2df55), WORD(0x932c9f811c89025b),
+	WORD(0x0996b2207706a61e), WORD(0x135349d5a8641c79),
+	WORD(0x65aad76f50130844), WORD(0x0ff37c0401fff780),
+	WORD(0xf57f238e693b0706), WORD(0xd90a16b6af6c9b3e),
+	/* 9G */
+	WORD(0x2f5d200e2353b92f), WORD(0xe35d87293fd7e4f9),
+	WORD(0x26094833a96d745d), WORD(0xdc351dc13cbfff3f),
+	WORD(0x26d464c6dad54d6a), WORD(0x5cab1d1d53636c6a),
+	WORD(0xf2813072b18ec0b0), WORD(0x3777e270d742aa2f),
+	WORD(0x27f061c7033ca7c2), WORD(0xa6ecaccc68ead0d8),
+	WORD(0x7d9429f4ee69a754), WORD(0xe770633431e8f5c6),
+	/* 11G */
+	WORD(0xc7708b19b68b8c7d), WORD(0x4532077c44377aba),
+	WORD(0x0dcc67706cdad64f), WORD(0x01b8bf56147b6602),
+	WORD(0xf8d89885f0561d79), WORD(0x9c19e9fc7ba9c437),
+	WORD(0x764eb146bdc4ba25), WORD(0x604fe46bac144b83),
+	WORD(0x3ce813298a77e780), WORD(0x2e070f36fe9e682e),
+	WORD(0x41821d0c3a53287a), WORD(0x9aa62f9f3533f918),
+	/* 13G */
+	WORD(0x9b7aeb7e75ccbdfb), WORD(0xb25e28c5f6749a95),
+	WORD(0x8a7a8e4633b7d4ae), WORD(0xdb5203a8d9c1bd56),
+	WORD(0xd2657265ed22df97), WORD(0xb51c56e18cf23c94),
+	WORD(0xf4d394596c3d812d), WORD(0xd8e88f1a87cae0c2),
+	WORD(0x789a2a48cf4d0fe3), WORD(0xb7feac2dfec38d60),
+	WORD(0x81fdbd1c3b490ec3), WORD(0x4617adb7cc6979e1),
+	/* 15G */
+	WORD(0x446ad8884709f4a9), WORD(0x2b7210e2ec3dabd8),
+	WORD(0x83ccf19550e07b34), WORD(0x59500917789b3075),
+	WORD(0x0fc01fd4eb085993), WORD(0xfb62d26f4903026b),
+	WORD(0x2309cc9d6fe989bb), WORD(0x61609cbd144bd586),
+	WORD(0x4b23d3a0de06610c), WORD(0xdddc2866d898f470),
+	WORD(0x8733fc41400c5797), WORD(0x5a68c6fed0bc2716),
+	/* 17G */
+	WORD(0x8903e1304b4a3cd0), WORD(0x3ea4ea4c8ff1f43e),
+	WORD(0xe6fc3f2af655a10d), WORD(0x7be3737d524ffefc),
+	WORD(0x9f6928555330455e), WORD(0x524f166ee475ce70),
+	WORD(0x3fcc69cd6c12f055), WORD(0x4e23b6ffd5b9c0da),
+	WORD(0x49ce6993336bf183), WORD(0xf87d6d854a54504a),
+	WORD(0x25eb5df1b3c2677a), WORD(0xac37986f55b164c9),
+	/* 19G */
+	WORD(0x82a2ed4abaa84c08), WORD(0x22c4cc5f41a8c912),
+	WORD(0xca109c3b154aad5e), WORD(0x23891298fc38538e),
+	WORD(0xb3b6639c539802ae), WORD(0xfa0f1f450390d706),
+	WORD(0x46b78e5db0dc21d0), WORD(0xa8c72d3cc3da2eac),
+	WORD(0x9170b3786ff2f643), WORD(0x3f5a799bb67f30c3),
+	WORD(0x15d1dc778264b672), WORD(0xa1d47b23e9577764),
+	/* 21G */
+	WORD(0x08265e510422ce2f), WORD(0x88e0d496dd2f9e21),
+	WORD(0x30128aa06177f75d), WORD(0x2e59ab62bd9ebe69),
+	WORD(0x1b1a0f6c5df0e537), WORD(0xab16c626dac012b5),
+	WORD(0x8014214b008c5de7), WORD(0xaa740a9e38f17bea),
+	WORD(0x262ebb498a149098), WORD(0xb454111e8527cd59),
+	WORD(0x266ad15aacea5817), WORD(0x21824f411353ccba),
+	/* 23G */
+	WORD(0xd1b4e74d12e3683b), WORD(0x990ed20b569b8ef6),
+	WORD(0xb9d3dd25429c0a18), WORD(0x1c75b8ab2a351783),
+	WORD(0x61e4ca2b905432f0), WORD(0x80826a69eea8f224),
+	WORD(0x7fc33a6bec52abad), WORD(0x0bcca3f0a65e4813),
+	WORD(0x7ad8a132a527cebe), WORD(0xf0138950eaf22c7e),
+	WORD(0x282d2437566718c1), WORD(0x9dfccb0de2212559),
+	/* 25G */
+	WORD(0x1e93722758ce3b83), WORD(0xbb280dfa3cb3fb36),
+	WORD(0x57d0f3d2e2be174a), WORD(0x9bd51b99208abe1e),
+	WORD(0x3809ab50de248024), WORD(0xc29c6e2ca5bb7331),
+	WORD(0x9944fd2e61124f05), WORD(0x83ccbc4e9009e391),
+	WORD(0x01628f059424a3cc), WORD(0xd6a2f51dea8e4344),
+	WORD(0xda3e1a3d4cebc96e), WORD(0x1fe6fb42e97809dc),
+	/* 27G */
+	WORD(0xa04482d2467d66e4), WORD(0xcf1912934d78291d),
+	WORD(0x8e0d4168482396f9), WORD(0x7228e2d5d18f14d0),
+	WORD(0x2f7e8d509c6a58fe), WORD(0xe8ca780e373e5aec),
+	WORD(0x42aad1d61b68e9f8), WORD(0x58a6d7f569e2f8f4),
+	WORD(0xd779adfe31da1bea), WORD(0x7d26540638c85a85),
+	WORD(0x67e67195d44d3cdf), WORD(0x17820a0bc5134ed7),
+	/* 29G */
+	WORD(0x019d6ac5d3021470), WORD(0x25846b66780443d6),
+	WORD(0xce3c15ed55c97647), WORD(0x3dc22d490e3feb0f),
+	WORD(0x2065b7cba7df26e4), WORD(0xc8b00ae8187cea1f),
+	WORD(0x1a5284a0865dded3), WORD(0x293c164920c83de2),
+	WORD(0xab178d26cce851b3), WORD(0x8e6db10b404505fb),
+	WORD(0xf6f57e7190c82033), WORD(0x1d2a1c015977f16c),
+	/* 31G */
+	WORD(0xa39c89317c8906a4), WORD(0xb6e7ecdd9e821ee6),
+	WORD(0x2ecf8340f0df4fe6), WORD(0xd42f7dc953c14965),
+	WORD(0x1afb51a3e3ba8285), WORD(0x6c07c4040a3305d1),
+	WORD(0xdab83288127fc1da), WORD(0xbc0a699b374c4b08),
+	WORD(0x402a9bab42eb20dd), WORD(0xd7dd464f045a7a1c),
+	WORD(0x5b3d0d6d36beecc4), WORD(0x475a3e756398a19d),
+	/* 33G */
+	WORD(0x61333a382fb3ba63), WORD(0xdf330d9d5b943c86),
+	WORD(0xbbc7c7ee955ef3af), WORD(0xda631fc160f09efb),
+	WORD(0x68af622641d5c400), WORD(0xcc9e97a46c833e9d),
+	WORD(0x7fd73e8e3a625e76), WORD(0x13bf6124c209e55e),
+	WORD(0x08467cea48b90b91), WORD(0x8a416eb9bb6f0aba),
+	WORD(0x6fcc93a1b8c31072), WORD(0xa7fd2b619057dad7),
+	/* 35G */
+	WORD(0x58a5b5433720ec9b), WORD(0xbb3800d52d7c2fb4),
+	WORD(0x4a508620dde6bd0a), WORD(0x65f16273a02583fd),
+	WORD(0x832bd8e34fc78523), WORD(0xd6149f75e9417bc6),
+	WORD(0xfeb026e93deeb52a), WORD(0x0ce18088a55e0956),
+	WORD(0x50018998988092a2), WORD(0x22f19fab28f35eee),
+	WORD(0xac8a877f52ccd35c), WORD(0xb13a8ad830e23f26),
+	/* 37G */
+	WORD(0x0202d57de44f61a3), WORD(0x4027704bb5630ef2),
+	WORD(0xa129e2dff5b54a5d), WORD(0xacb60a7597482b86),
+	WORD(0x9261ede87ef27114), WORD(0x1eba28f3defc58b5),
+	WORD(0x6c91c0c98be5589e), WORD(0x2f1643d514594bee),
+	WORD(0x2ea912435d2ca034), WORD(0xb50649a894047d1f),
+	WORD(0x284fcbb5638ca337), WORD(0xfa0e07b7fe85bf85),
+	/* 39G */
+	WORD(0x7d894f80506e0e42), WORD(0xd984244a8e3d2c46),
+	WORD(0x6d7edf642b7f006f), WORD(0x36a1cd6dde9b6230),
+	WORD(0xc9985040b76c0665), WORD(0x587df4d6b89b1fc2),
+	WORD(0x4c0638476a71ae7a), WORD(0x7b2b0ab3e8294747),
+	WORD(0x345c553ab53153b8), WORD(0xb646e453436d9fe2),
+	WORD(0x1a95355f1cd60340), WORD(0x2d7bc128074968fb),
+	/* 41G */
+	WORD(0xad148e87bca6d14c), WORD(0x41dfd24d456a201e),
+	WORD(0x73a82933a80d68f3), WORD(0x89746c8d852ca035),
+	WORD(0xe3bc778895fd71ae), WORD(0x8764cd2cda92245d),
+	WORD(0xa2fe2c4782eb23e2), WORD(0x5ac762e00f3c9d6e),
+	WORD(0x57860ce121646f31), WORD(0xbdc9d6c34f9f589a),
+	WORD(0x679952c7d193272e), WORD(0x82ea702eeb18f1c5),
+	/* 43G */
+	WORD(0x37fa935500846d44), WORD(0x09112fc50578bc8c),
+	WORD(0xdad9f5b239c4943d), WORD(0x7314f5f0416dbd86),
+	WORD(0x5cf095a901fefb56), WORD(0x35178bad22dab393),
+	WORD(0xcf79fc1b36baf1a7), WORD(0x1b7ee42d749e5498),
+	WORD(0xbce78aa9ede314bb), WORD(0xaaf8e0f6bd0628df),
+	WORD(0xa974b09415cbf948), WORD(0x8f3f1f63c9632b78),
+	/* 45G */
+	WORD(0xd4c411564fddda5b), WORD(0xd4af65c673ad9112),
+	WORD(0xffe8e0bb39eb8f59), WORD(0xb0040c0e8d6fcf13),
+	WORD(0x99e1c0c61f2bb599), WORD(0x9c94c858b2ac3405),
+	WORD(0x8f8878d76eeed85d), WORD(0x62b2f54351fcca3f),
+	WORD(0xeb3b44a9e5b56918), WORD(0x16f96676b7234e93),
+	WORD(0x17477722bd2af19e), WORD(0x42eb2979db83a485),
+	/* 47G */
+	WORD(0x6f888f7df0c668ca), WORD(0x65c788785f0dc66c),
+	WORD(0xbfb185125f5b07a0), WORD(0x780abff7d878acd0),
+	WORD(0x504f21b1570cf950), WORD(0xea5b37c5da233371),
+	WORD(0x487ae8bd22437ed1), WORD(0x9c701758249cf9b7),
+	WORD(0xf86562a898fb34ff), WORD(0xdfeea1a265e0fc91),
+	WORD(0xeef006912e20fc23), WORD(0xac9dfec7dfa72a8b),
+	/* 49G */
+	WORD(0xfa5c3aef697136c6), WORD(0x8ea5af63a5ea6fb8),
+	WORD(0xa669156542e365a4), WORD(0x47c56c115b6e3386),
+	WORD(0x1197832bcea03f56), WORD(0x0b470bb250e4ea9e),
+	WORD(0x3113c74313b25712), WORD(0x8d6c174ed2497d48),
+	WORD(0xfc4486ee49c9ebe8), WORD(0x2487edd57f82bdd3),
+	WORD(0x771e64415b57be2f), WORD(0x2d1cc518e28b2bdb),
+	/* 51G */
+	WORD(0x2c4ccac72070ac8d), WORD(0x1947c0caec4a22b8),
+	WORD(0xa5e0fb598c5a78d9), WORD(0x464ae8d241a84de7),
+	WORD(0x3dba16e9daaabc27), WORD(0x16634a504f35cb3c),
+	WORD(0xadc18bf9b16ec84f), WORD(0x324d067e7359dd35),
+	WORD(0xdaeac0c3570543f0), WORD(0x0b2240003c887d36),
+	WORD(0xc69489e2373f1a0d), WORD(0x518b047dcbaa0d97),
+	/* 53G */
+	WORD(0x3b1bddc6fbde49ef), WORD(0xdaed7c268a0915cc),
+	WORD(0x0b0110610f0422a2), WORD(0xcf485c74a7c54b16),
+	WORD(0x642ec4e615c3aae2), WORD(0xa8ba8f10e0f383ea),
+	WORD(0x2a2054b495618501), WORD(0xebec6442089efa8b),
+	WORD(0x5786a19a4e2fa83e), WORD(0xd2c71ad139069963),
+	WORD(0xadc93d9a481765e2), WORD(0xedf2e3eb7ecc9485),
+	/* 55G */
+	WORD(0xbcab5f60069f3367), WORD(0xfd6622bc1718ec3c),
+	WORD(0xa4fb7867e3a142d6), WORD(0x6078d8bf085faeb3),
+	WORD(0xfa5cbfda60f4554f), WORD(0xb3fcd5d1690cd408),
+	WORD(0x4ebdee7d281f7884), WORD(0x82af23aa180a63a7),
+	WORD(0x8de3107c3d079f61), WORD(0x17c6b5cbbe2334f8),
+	WORD(0x6a91e73997d0fa06), WORD(0x7460257314ceeed4),
+	/* 57G */
+	WORD(0xb14ba61cf97f865c), WORD(0x73bae4c1694b8b0d),
+	WORD(0xa14967dfac4bbf62), WORD(0x1e9dd1509bf446e0),
+	WORD(0xc052f3eb1c99ceef), WORD(0x814d7fa07a78c189),
+	WORD(0xa101a483ab74b05d), WORD(0x7788c258a1737b65),
+	WORD(0x0d60bab7e809a13c), WORD(0x8f427bc473c81d5b),
+	WORD(0xd2e130552952c1fc), WORD(0x0a823b9a4b26df63),
+	/* 59G */
+	WORD(0xaf467ce227bf64c9), WORD(0xdfca6897f929974c),
+	WORD(0x64473b595c322738), WORD(0x96a917cf1ed0e315),
+	WORD(0x3703435b0de64db9), WORD(0x9ba039679267b646),
+	WORD(0xdf0c2aae3a522fbe), WORD(0x41bdb741b335eff0),
+	WORD(0xaccf2edd7b059703), WORD(0x6fb34b3028463cce),
+	WORD(0x96d9ba0bd9e3ca19), WORD(0xff336f12504655c1),
+	/* 61G */
+	WORD(0x48da1fd3fc60a6e0), WORD(0x54fb5a34222241e8),
+	WORD(0x6035e34f772ae080), WORD(0x5ff77ff2332982d0),
+	WORD(0x2366467300fe51fd), WORD(0xc93ea049ef6ba006),
+	WORD(0x6640f1177d381266), WORD(0x394d32cd6ae9f4ac),
+	WORD(0xe6a7885370d303eb), WORD(0x0dda19ffe5275767),
+	WORD(0xb0a6c77201466d23), WORD(0xc4cc11451fc69829),
+	/* 63G */
+	WORD(0xc5c0e6d7aaed89c0), WORD(0x6ce8ead6149a1896),
+	WORD(0x7a50f7458c949f8f), WORD(0xcd7e35f76e2b71aa),
+	WORD(0xf6159e519a049f7a), WORD(0x1c9bf0b0f1e52d1e),
+	WORD(0x3bb6c1f518202c80), WORD(0x8d3a5f621ecd7b1a),
+	WORD(0x3bb034e888d17f19), WORD(0xdc89bd4997d4048d),
+	WORD(0xf5af7b8e3735df22), WORD(0x52bb3712a0a689e8),
+};
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+static const word_t secp384r1_gen_wnaf[] = {
+	/* G */
+	WORD(0x49c0b528), WORD(0x3dd07566), WORD(0xa0d6ce38), WORD(0x20e378e2),
+	WORD(0x541b4d6e), WORD(0x879c3afc), WORD(0x59a30eff), WORD(0x64548684),
+	WORD(0x614ede2b), WORD(0x812ff723), WORD(0x299e1513), WORD(0x4d3aadc2),
+	WORD(0x4b03a4fe), WORD(0x23043dad), WORD(0x7bb4a9ac), WORD(0xa1bfa8bf),
+	WORD(0x2e83b050), WORD(0x8bade756), WORD(0x68f4ffd9), WORD(0xc6c35219),
+	WORD(0x3969a840), WORD(0xdd800226), WORD(0x5a15c5e9), WORD(0x2b78abc2),
+	/* 3G */
+	WORD(0xc1dc4073), WORD(0x05e4dbe6), WORD(0xf04f779c), WORD(0xc54ea9ff),
+	WORD(0xa170ccf0), WORD(0x6b2034e9), WORD(0xd51c6c3e), WORD(0x3a48d732),
+	WORD(0x263aa470), WORD(0xe36f7e2d), WORD(0xe7c1c3ac), WORD(0xd283fe68),
+	WORD(0xc04ee157), WORD(0x7e284821), WORD(0x7ae0e36d), WORD(0x92d789a7),
+	WORD(0x4ef67446), WORD(0x132663c0), WORD(0xd2e1d0b4), WORD(0x68012d5a),
+	WORD(0x5102b339), WORD(0xf6db68b1), WORD(0x983292af), WORD(0x465465fc),
+	/* 5G */
+	WORD(0x68f1f0df), WORD(0xbb595eba), WORD(0xcc873466), WORD(0xc185c0cb),
+	WORD(0x293c703b), WORD(0x7f1eb1b5), WORD(0xaacc05e6), WORD(0x60db2cf5),
+	WORD(0xe2e8e4c6), WORD(0xc676b987), WORD(0x1d178ffb), WORD(0xe1bb26b1),
+	WORD(0x7073fa21), WORD(0x2b694ba0), WORD(0x72f34566), WORD(0x22c16e2e),
+	WORD(0x01c35b99), WORD(0x80b61b31), WORD(0x982c0411), WORD(0x4b237faf),
+	WORD(0x24de236d), WORD(0xe6c59440), WORD(0xe209e4a3), WORD(0x4db1c9d6),
+	/* 7G */
+	WORD(0x7d69222b), WORD(0xdf13b9d1), WORD(0x874774b1), WORD(0x4ce6415f),
+	WORD(0x211faa95), WORD(0x731edcf8), WORD(0x659753ed), WORD(0x5f4215d1),
+	WORD(0x9db2df55), WORD(0xf893db58), WORD(0x1c89025b), WORD(0x932c9f81),
+	WORD(0x7706a61e), WORD(0x0996b220), WORD(0xa8641c79), WORD(0x135349d5),
+	WORD(0x50130844), WORD(0x65aad76f), WORD(0x01fff780), WORD(0x0ff37c04),
+	WORD(0x693b0706), WORD(0xf57f238e), WORD(0xaf6c9b3e), WORD(0xd90a16b6),
+	/* 9G */
+	WORD(0x2353b92f), WORD(0x2f5d200e), WORD(0x3fd7e4f9), WORD(0xe35d8729),
+	WORD(0xa96d745d), WORD(0x26094833), WORD(0x3cbfff3f), WORD(0xdc351dc1),
+	WORD(0xdad54d6a), WORD(0x26d464c6), WORD(0x53636c6a), WORD(0x5cab1d1d),
+	WORD(0xb18ec0b0), WORD(0xf2813072), WORD(0xd742aa2f), WORD(0x3777e270),
+	WORD(0x033ca7c2), WORD(0x27f061c7), WORD(0x68ead0d8), WORD(0xa6ecaccc),
+	WORD(0xee69a754), WORD(0x7d9429f4), WORD(0x31e8f5c6), WORD(0xe7706334),
+	/* 11G */
+	WORD(0xb68b8c7d), WORD(0xc7708b19), WORD(0x44377aba), WORD(0x4532077c),
+	WORD(0x6cdad64f), WORD(0x0dcc6770), WORD(0x147b6602), WORD(0x01b8bf56),
+	WORD(0xf0561d79), WORD(0xf8d89885), WORD(0x7ba9c437), WORD(0x9c19e9fc),
+	WORD(0xbdc4ba25), WORD(0x764eb146), WORD(0xac144b83), WORD(0x604fe46b),
+	WORD(0x8a77e780), WORD(0x3ce81329), WORD(0xfe9e682e), WORD(0x2e070f36),
+	WORD(0x3a53287a), WORD(0x41821d0c), WORD(0x3533f918), WORD(0x9aa62f9f),
+	/* 13G */
+	WORD(0x75ccbdfb), WORD(0x9b7aeb7e), WORD(0xf6749a95), WORD(0xb25e28c5),
+	WORD(0x33b7d4ae), WORD(0x8a7a8e46), WORD(0xd9c1bd56), WORD(0xdb5203a8),
+	WORD(0xed22df97), WORD(0xd2657265), WORD(0x8cf23c94), WORD(0xb51c56e1),
+	WORD(0x6c3d812d), WORD(0xf4d39459), WORD(0x87cae0c2), WORD(0xd8e88f1a),
+	WORD(0xcf4d0fe3), WORD(0x789a2a48), WORD(0xfec38d60), WORD(0xb7feac2d),
+	WORD(0x3b490ec3), WORD(0x81fdbd1c), WORD(0xcc6979e1), WORD(0x4617adb7),
+	/* 15G */
+	WORD(0x4709f4a9), WORD(0x446ad888), WORD(0xec3dabd8), WORD(0x2b7210e2),
+	WORD(0x50e07b34), WORD(0x83ccf195), WORD(0x789b3075), WORD(0x59500917),
+	WORD(0xeb085993), WORD(0x0fc01fd4), WORD(0x4903026b), WORD(0xfb62d26f),
+	WORD(0x6fe989bb), WORD(0x2309cc9d), WORD(0x144bd586), WORD(0x61609cbd),
+	WORD(0xde06610c), WORD(0x4b23d3a0), WORD(0xd898f470), WORD(0xdddc2866),
+	WORD(0x400c5797), WORD(0x8733fc41), WORD(0xd0bc2716), WORD(0x5a68c6fe),
+	/* 17G */
+	WORD(0x4b4a3cd0), WORD(0x8903e130), WORD(0x8ff1f43e), WORD(0x3ea4ea4c),
+	WORD(0xf655a10d), WORD(0xe6fc3f2a), WORD(0x524ffefc), WORD(0x7be3737d),
+	WORD(0x5330455e), WORD(0x9f692855), WORD(0xe475ce70), WORD(0x524f166e),
+	WORD(0x6c12f055), WORD(0x3fcc69cd), WORD(0xd5b9c0da), WORD(0x4e23b6ff),
+	WORD(0x336bf183), WORD(0x49ce6993), WORD(0x4a54504a), WORD(0xf87d6d85),
+	WORD(0xb3c2677a), WORD(0x25eb5df1), WORD(0x55b164c9), WORD(0xac37986f),
+	/* 19G */
+	WORD(0xbaa84c08), WORD(0x82a2ed4a), WORD(0x41a8c912), WORD(0x22c4cc5f),
+	WORD(0x154aad5e), WORD(0xca109c3b), WORD(0xfc38538e), WORD(0x23891298),
+	WORD(0x539802ae), WORD(0xb3b6639c), WORD(0x0390d706), WORD(0xfa0f1f45),
+	WORD(0xb0dc21d0), WORD(0x46b78e5d), WORD(0xc3da2eac), WORD(0xa8c72d3c),
+	WORD(0x6ff2f643), WORD(0x9170b378), WORD(0xb67f30c3), WORD(0x3f5a799b),
+	WORD(0x8264b672), WORD(0x15d1dc77), WORD(0xe9577764), WORD(0xa1d47b23),
+	/* 21G */
+	WORD(0x0422ce2f), WORD(0x08265e51), WORD(0xdd2f9e21), WORD(0x88e0d496),
+	WORD(0x6177f75d), WORD(0x30128aa0), WORD(0xbd9ebe69), WORD(0x2e59ab62),
+	WORD(0x5df0e537), WORD(0x1b1a0f6c), WORD(0xdac012b5), WORD(0xab16c626),
+	WORD(0x008c5de7), WORD(0x8014214b), WORD(0x38f17bea), WORD(0xaa740a9e),
+	WORD(0x8a149098), WORD(0x262ebb49), WORD(0x8527cd59), WORD(0xb454111e),
+	WORD(0xacea5817), WORD(0x266ad15a), WORD(0x1353ccba), WORD(0x21824f41),
+	/* 23G */
+	WORD(0x12e3683b), WORD(0xd1b4e74d), WORD(0x569b8ef6), WORD(0x990ed20b),
+	WORD(0x429c0a18), WORD(0xb9d3dd25), WORD(0x2a351783), WORD(0x1c75b8ab),
+	WORD(0x905432f0), WORD(0x61e4ca2b), WORD(0xeea8f224), WORD(0x80826a69),
+	WORD(0xec52abad), WORD(0x7fc33a6b), WORD(0xa65e4813), WORD(0x0bcca3f0),
+	WORD(0xa527cebe), WORD(0x7ad8a132), WORD(0xeaf22c7e), WORD(0xf0138950),
+	WORD(0x566718c1), WORD(0x282d2437), WORD(0xe2212559), WORD(0x9dfccb0d),
+	/* 25G */
+	WORD(0x58ce3b83), WORD(0x1e937227), WORD(0x3cb3fb36), WORD(0xbb280dfa),
+	WORD(0xe2be174a), WORD(0x57d0f3d2), WORD(0x208abe1e), WORD(0x9bd51b99),
+	WORD(0xde248024), WORD(0x3809ab50), WORD(0xa5bb7331), WORD(0xc29c6e2c),
+	WORD(0x61124f05), WORD(0x9944fd2e), WORD(0x9009e391), WORD(0x83ccbc4e),
+	WORD(0x9424a3cc), WORD(0x01628f05), WORD(0xea8e4344), WORD(0xd6a2f51d),
+	WORD(0x4cebc96e), WORD(0xda3e1a3d), WORD(0xe97809dc), WORD(0x1fe6fb42),
+	/* 27G */
+	WORD(0x467d66e4), WORD(0xa04482d2), WORD(0x4d78291d), WORD(0xcf191293),
+	WORD(0x482396f9), WORD(0x8e0d4168), WORD(0xd18f14d0), WORD(0x7228e2d5),
+	WORD(0x9c6a58fe), WORD(0x2f7e8d50), WORD(0x373e5aec), WORD(0xe8ca780e),
+	WORD(0x1b68e9f8), WORD(0x42aad1d6), WORD(0x69e2f8f4), WORD(0x58a6d7f5),
+	WORD(0x31da1bea), WORD(0xd779adfe), WORD(0x38c85a85), WORD(0x7d265406),
+	WORD(0xd44d3cdf), WORD(0x67e67195), WORD(0xc5134ed7), WORD(0x17820a0b),
+	/* 29G */
+	WORD(0xd3021470), WORD(0x019d6ac5), WORD(0x780443d6), WORD(0x25846b66),
+	WORD(0x55c97647), WORD(0xce3c15ed), WORD(0x0e3feb0f), WORD(0x3dc22d49),
+	WORD(0xa7df26e4), WORD(0x2065b7cb), WORD(0x187cea1f), WORD(0xc8b00ae8),
+	WORD(0x865dded3), WORD(0x1a5284a0), WORD(0x20c83de2), WORD(0x293c1649),
+	WORD(0xcce851b3), WORD(0xab178d26), WORD(0x404505fb), WORD(0x8e6db10b),
+	WORD(0x90c82033), WORD(0xf6f57e71), WORD(0x5977f16c), WORD(0x1d2a1c01),
+	/* 31G */
+	WORD(0x7c8906a4), WORD(0xa39c8931), WORD(0x9e821ee6), WORD(0xb6e7ecdd),
+	WORD(0xf0df4fe6), WORD(0x2ecf8340), WORD(0x53c14965), WORD(0xd42f7dc9),
+	WORD(0xe3ba8285), WORD(0x1afb51a3), WORD(0x0a3305d1), WORD(0x6c07c404),
+	WORD(0x127fc1da), WORD(0xdab83288), WORD(0x374c4b08), WORD(0xbc0a699b),
+	WORD(0x42eb20dd), WORD(0x402a9bab), WORD(0x045a7a1c), WORD(0xd7dd464f),
+	WORD(0x36beecc4), WORD(0x5b3d0d6d), WORD(0x6398a19d), WORD(0x475a3e75),
+	/* 33G */
+	WORD(0x2fb3ba63), WORD(0x61333a38), WORD(0x5b943c86), WORD(0xdf330d9d),
+	WORD(0x955ef3af), WORD(0xbbc7c7ee), WORD(0x60f09efb), WORD(0xda631fc1),
+	WORD(0x41d5c400), WORD(0x68af6226), WORD(0x6c833e9d), WORD(0xcc9e97a4),
+	WORD(0x3a625e76), WORD(0x7fd73e8e), WORD(0xc209e55e), WORD(0x13bf6124),
+	WORD(0x48b90b91), WORD(0x08467cea), WORD(0xbb6f0aba), WORD(0x8a416eb9),
+	WORD(0xb8c31072), WORD(0x6fcc93a1), WORD(0x9057dad7), WORD(0xa7fd2b61),
+	/* 35G */
+	WORD(0x3720ec9b), WORD(0x58a5b543), WORD(0x2d7c2fb4), WORD(0xbb3800d5),
+	WORD(0xdde6bd0a), WORD(0x4a508620), WORD(0xa02583fd), WORD(0x65f16273),
+	WORD(0x4fc78523), WORD(0x832bd8e3), WORD(0xe9417bc6), WORD(0xd6149f75),
+	WORD(0x3deeb52a), WORD(0xfeb026e9), WORD(0xa55e0956), WORD(0x0ce18088),
+	WORD(0x988092a2), WORD(0x50018998), WORD(0x28f35eee), WORD(0x22f19fab),
+	WORD(0x52ccd35c), WORD(0xac8a877f), WORD(0x30e23f26), WORD(0xb13a8ad8),
+	/* 37G */
+	WORD(0xe44f61a3), WORD(0x0202d57d), WORD(0xb5630ef2), WORD(0x4027704b),
+	WORD(0xf5b54a5d), WORD(0xa129e2df), WORD(0x97482b86), WORD(0xacb60a75),
+	WORD(0x7ef27114), WORD(0x9261ede8), WORD(0xdefc58b5), WORD(0x1eba28f3),
+	WORD(0x8be5589e), WORD(0x6c91c0c9), WORD(0x14594bee), WORD(0x2f1643d5),
+	WORD(0x5d2ca034), WORD(0x2ea91243), WORD(0x94047d1f), WORD(0xb50649a8),
+	WORD(0x638ca337), WORD(0x284fcbb5), WORD(0xfe85bf85), WORD(0xfa0e07b7),
+	/* 39G */
+	WORD(0x506e0e42), WORD(0x7d894f80), WORD(0x8e3d2c46), WORD(0xd984244a),
+	WORD(0x2b7f006f), WORD(0x6d7edf64), WORD(0xde9b6230), WORD(0x36a1cd6d),
+	WORD(0xb76c0665), WORD(0xc9985040), WORD(0xb89b1fc2), WORD(0x587df4d6),
+	WORD(0x6a71ae7a), WORD(0x4c063847), WORD(0xe8294747), WORD(0x7b2b0ab3),
+	WORD(0xb53153b8), WORD(0x345c553a), WORD(0x436d9fe2), WORD(0xb646e453),
+	WORD(0x1cd60340), WORD(0x1a95355f), WORD(0x074968fb), WORD(0x2d7bc128),
+	/* 41G */
+	WORD(0xbca6d14c), WORD(0xad148e87), WORD(0x456a201e), WORD(0x41dfd24d),
+	WORD(0xa80d68f3), WORD(0x73a82933), WORD(0x852ca035), WORD(0x89746c8d),
+	WORD(0x95fd71ae), WORD(0xe3bc7788), WORD(0xda92245d), WORD(0x8764cd2c),
+	WORD(0x82eb23e2), WORD(0xa2fe2c47), WORD(0x0f3c9d6e), WORD(0x5ac762e0),
+	WORD(0x21646f31), WORD(0x57860ce1), WORD(0x4f9f589a), WORD(0xbdc9d6c3),
+	WORD(0xd193272e), WORD(0x679952c7), WORD(0xeb18f1c5), WORD(0x82ea702e),
+	/* 43G */
+	WORD(0x00846d44), WORD(0x37fa9355), WORD(0x0578bc8c), WORD(0x09112fc5),
+	WORD(0x39c4943d), WORD(0xdad9f5b2), WORD(0x416dbd86), WORD(0x7314f5f0),
+	WORD(0x01fefb56), WORD(0x5cf095a9), WORD(0x22dab393), WORD(0x35178bad),
+	WORD(0x36baf1a7), WORD(0xcf79fc1b), WORD(0x749e5498), WORD(0x1b7ee42d),
+	WORD(0xede314bb), WORD(0xbce78aa9), WORD(0xbd0628df), WORD(0xaaf8e0f6),
+	WORD(0x15cbf948), WORD(0xa974b094), WORD(0xc9632b78), WORD(0x8f3f1f63),
+	/* 45G */
+	WORD(0x4fddda5b), WORD(0xd4c41156), WORD(0x73ad9112), WORD(0xd4af65c6),
+	WORD(0x39eb8f59), WORD(0xffe8e0bb), WORD(0x8d6fcf13), WORD(0xb0040c0e),
+	WORD(0x1f2bb599), WORD(0x99e1c0c6), WORD(0xb2ac3405), WORD(0x9c94c858),
+	WORD(0x6eeed85d), WORD(0x8f8878d7), WORD(0x51fcca3f), WORD(0x62b2f543),
+	WORD(0xe5b56918), WORD(0xeb3b44a9), WORD(0xb7234e93), WORD(0x16f96676),
+	WORD(0xbd2af19e), WORD(0x17477722), WORD(0xdb83a485), WORD(0x42eb2979),
+	/* 47G */
+	WORD(0xf0c668ca), WORD(0x6f888f7d), WORD(0x5f0dc66c), WORD(0x65c78878),
+	WORD(0x5f5b07a0), WORD(0xbfb18512), WORD(0xd878acd0), WORD(0x780abff7),
+	WORD(0x570cf950), WORD(0x504f21b1), WORD(0xda233371), WORD(0xea5b37c5),
+	WORD(0x22437ed1), WORD(0x487ae8bd), WORD(0x249cf9b7), WORD(0x9c701758),
+	WORD(0x98fb34ff), WORD(0xf86562a8), WORD(0x65e0fc91), WORD(0xdfeea1a2),
+	WORD(0x2e20fc23), WORD(0xeef00691), WORD(0xdfa72a8b), WORD(0xac9dfec7),
+	/* 49G */
+	WORD(0x697136c6), WORD(0xfa5c3aef), WORD(0xa5ea6fb8), WORD(0x8ea5af63),
+	WORD(0x42e365a4), WORD(0xa6691565), WORD(0x5b6e3386), WORD(0x47c56c11),
+	WORD(0xcea03f56), WORD(0x1197832b), WORD(0x50e4ea9e), WORD(0x0b470bb2),
+	WORD(0x13b25712), WORD(0x3113c743), WORD(0xd2497d48), WORD(0x8d6c174e),
+	WORD(0x49c9ebe8), WORD(0xfc4486ee), WORD(0x7f82bdd3), WORD(0x2487edd5),
+	WORD(0x5b57be2f), WORD(0x771e6441), WORD(0xe28b2bdb), WORD(0x2d1cc518),
+	/* 51G */
+	WORD(0x2070ac8d), WORD(0x2c4ccac7), WORD(0xec4a22b8), WORD(0x1947c0ca),
+	WORD(0x8c5a78d9), WORD(0xa5e0fb59), WORD(0x41a84de7), WORD(0x464ae8d2),
+	WORD(0xdaaabc27), WORD(0x3dba16e9), WORD(0x4f35cb3c), WORD(0x16634a50),
+	WORD(0xb16ec84f), WORD(0xadc18bf9), WORD(0x7359dd35), WORD(0x324d067e),
+	WORD(0x570543f0), WORD(0xdaeac0c3), WORD(0x3c887d36), WORD(0x0b224000),
+	WORD(0x373f1a0d), WORD(0xc69489e2), WORD(0xcbaa0d97), WORD(0x518b047d),
+	/* 53G */
+	WORD(0xfbde49ef), WORD(0x3b1bddc6), WORD(0x8a0915cc), WORD(0xdaed7c26),
+	WORD(0x0f0422a2), WORD(0x0b011061), WORD(0xa7c54b16), WORD(0xcf485c74),
+	WORD(0x15c3aae2), WORD(0x642ec4e6), WORD(0xe0f383ea), WORD(0xa8ba8f10),
+	WORD(0x95618501), WORD(0x2a2054b4), WORD(0x089efa8b), WORD(0xebec6442),
+	WORD(0x4e2fa83e), WORD(0x5786a19a), WORD(0x39069963), WORD(0xd2c71ad1),
+	WORD(0x481765e2), WORD(0xadc93d9a), WORD(0x7ecc9485), WORD(0xedf2e3eb),
+	/* 55G */
+	WORD(0x069f3367), WORD(0xbcab5f60), WORD(0x1718ec3c), WORD(0xfd6622bc),
+	WORD(0xe3a142d6), WORD(0xa4fb7867), WORD(0x085faeb3), WORD(0x6078d8bf),
+	WORD(0x60f4554f), WORD(0xfa5cbfda), WORD(0x690cd408), WORD(0xb3fcd5d1),
+	WORD(0x281f7884), WORD(0x4ebdee7d), WORD(0x180a63a7), WORD(0x82af23aa),
+	WORD(0x3d079f61), WORD(0x8de3107c), WORD(0xbe2334f8), WORD(0x17c6b5cb),
+	WORD(0x97d0fa06), WORD(0x6a91e739), WORD(0x14ceeed4), WORD(0x74602573),
+	/* 57G */
+	WORD(0xf97f865c), WORD(0xb14ba61c), WORD(0x694b8b0d), WORD(0x73bae4c1),
+	WORD(0xac4bbf62), WORD(0xa14967df), WORD(0x9bf446e0), WORD(0x1e9dd150),
+	WORD(0x1c99ceef), WORD(0xc052f3eb), WORD(0x7a78c189), WORD(0x814d7fa0),
+	WORD(0xab74b05d), WORD(0xa101a483), WORD(0xa1737b65), WORD(0x7788c258),
+	WORD(0xe809a13c), WORD(0x0d60bab7), WORD(0x73c81d5b), WORD(0x8f427bc4),
+	WORD(0x2952c1fc), WORD(0xd2e13055), WORD(0x4b26df63), WORD(0x0a823b9a),
+	/* 59G */
+	WORD(0x27bf64c9), WORD(0xaf467ce2), WORD(0xf929974c), WORD(0xdfca6897),
+	WORD(0x5c322738), WORD(0x64473b59), WORD(0x1ed0e315), WORD(0x96a917cf),
+	WORD(0x0de64db9), WORD(0x3703435b), WORD(0x9267b646), WORD(0x9ba03967),
+	WORD(0x3a522fbe), WORD(0xdf0c2aae), WORD(0xb335eff0), WORD(0x41bdb741),
+	WORD(0x7b059703), WORD(0xaccf2edd), WORD(0x28463cce), WORD(0x6fb34b30),
+	WORD(0xd9e3ca19), WORD(0x96d9ba0b), WORD(0x504655c1), WORD(0xff336f12),
+	/* 61G */
+	WORD(0xfc60a6e0), WORD(0x48da1fd3), WORD(0x222241e8), WORD(0x54fb5a34),
+	WORD(0x772ae080), WORD(0x6035e34f), WORD(0x332982d0), WORD(0x5ff77ff2),
+	WORD(0x00fe51fd), WORD(0x23664673), WORD(0xef6ba006), WORD(0xc93ea049),
+	WORD(0x7d381266), WORD(0x6640f117), WORD(0x6ae9f4ac), WORD(0x394d32cd),
+	WORD(0x70d303eb), WORD(0xe6a78853), WORD(0xe5275767), WORD(0x0dda19ff),
+	WORD(0x01466d23), WORD(0xb0a6c772), WORD(0x1fc69829), WORD(0xc4cc1145),
+	/* 63G */
+	WORD(0xaaed89c0), WORD(0xc5c0e6d7), WORD(0x149a1896), WORD(0x6ce8ead6),
+	WORD(0x8c949f8f), WORD(0x7a50f745), WORD(0x6e2b71aa), WORD(0xcd7e35f7),
+	WORD(0x9a049f7a), WORD(0xf6159e51), WORD(0xf1e52d1e), WORD(0x1c9bf0b0),
+	WORD(0x18202c80), WORD(0x3bb6c1f5), WORD(0x1ecd7b1a), WORD(0x8d3a5f62),
+	WORD(0x88d17f19), WORD(0x3bb034e8), WORD(0x97d4048d), WORD(0xdc89bd49),
+	WORD(0x3735df22), WORD(0xf5af7b8e), WORD(0xa0a689e8), WORD(0x52bb3712),
+};
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+static const word_t secp384r1_gen_wnaf[] = {
+	/* G */
+	WORD(0xb528), WORD(0x49c0), WORD(0x7566), WORD(0x3dd0), WORD(0xce38), WORD(0xa0d6),
+	WORD(0x78e2), WORD(0x20e3), WORD(0x4d6e), WORD(0x541b), WORD(0x3afc), WORD(0x879c),
+	WORD(0x0eff), WORD(0x59a3), WORD(0x8684), WORD(0x6454), WORD(0xde2b), WORD(0x614e),
+	WORD(0xf723), WORD(0x812f), WORD(0x1513), WORD(0x299e), WORD(0xadc2), WORD(0x4d3a),
+	WORD(0xa4fe), WORD(0x4b03), WORD(0x3dad), WORD(0x2304), WORD(0xa9ac), WORD(0x7bb4),
+	WORD(0xa8bf), WORD(0xa1bf), WORD(0xb050), WORD(0x2e83), WORD(0xe756), WORD(0x8bad),
+	WORD(0xffd9), WORD(0x68f4), WORD(0x5219), WORD(0xc6c3), WORD(0xa840), WORD(0x3969),
+	WORD(0x0226), WORD(0xdd80), WORD(0xc5e9), WORD(0x5a15), WORD(0xabc2), WORD(0x2b78),
+	/* 3G */
+	WORD(0x4073), WORD(0xc1dc), WORD(0xdbe6), WORD(0x05e4), WORD(0x779c), WORD(0xf04f),
+	WORD(0xa9ff), WORD(0xc54e), WORD(0xccf0), WORD(0xa170), WORD(0x34e9), WORD(0x6b20),
+	WORD(0x6c3e), WORD(0xd51c), WORD(0xd732), WORD(0x3a48), WORD(0xa470), WORD(0x263a),
+	WORD(0x7e2d), WORD(0xe36f), WORD(0xc3ac), WORD(0xe7c1), WORD(0xfe68), WORD(0xd283),
+	WORD(0xe157), WORD(0xc04e), WORD(0x4821), WORD(0x7e28), WORD(0xe36d), WORD(0x7ae0),
+	WORD(0x89a7), WORD(0x92d7), WORD(0x7446), WORD(0x4ef6), WORD(0x63c0), WORD(0x1326),
+	WORD(0xd0b4), WORD(0xd2e1), WORD(0x2d5a), WORD(0x6801), WORD(0xb339), WORD(0x5102),
+	WORD(0x68b1), WORD(0xf6db), WORD(0x92af), WORD(0x9832), WORD(0x65fc), WORD(0x4654),
+	/* 5G */
+	WORD(0xf0df), WORD(0x68f1), WORD(0x5eba), WORD(0xbb59), WORD(0x3466), WORD(0xcc87),
+	WORD(0xc0cb), WORD(0xc185), WORD(0x703b), WORD(0x293c), WORD(0xb1b5), WORD(0x7f1e),
+	WORD(0x05e6), WORD(0xaacc), WORD(0x2cf5), WORD(0x60db), WORD(0xe4c6), WORD(0xe2e8),
+	WORD(0xb987), WORD(0xc676), WORD(0x8ffb), WORD(0x1d17), WORD(0x26b1), WORD(0xe1bb),
+	WORD(0xfa21), WORD(0x7073), WORD(0x4ba0), WORD(0x2b69), WORD(0x4566), WORD(0x72f3),
+	WORD(0x6e2e), WORD(0x22c1), WORD(0x5b99), WORD(0x01c3), WORD(0x1b31), WORD(0x80b6),
+	WORD(0x0411), WORD(0x982c), WORD(0x7faf), WORD(0x4b23), WORD(0x236d), WORD(0x24de),
+	WORD(0x9440), WORD(0xe6c5), WORD(0xe4a3), WORD(0xe209), WORD(0xc9d6), WORD(0x4db1),
+	/* 7G */
+	WORD(0x222b), WORD(0x7d69), WORD(0xb9d1), WORD(0xdf13), WORD(0x74b1), WORD(0x8747),
+	WORD(0x415f), WORD(0x4ce6), WORD(0xaa95), WORD(0x211f), WORD(0xdcf8), WORD(0x731e),
+	WORD(0x53ed), WORD(0x6597), WORD(0x15d1), WORD(0x5f42), WORD(0xdf55), WORD(0x9db2),
+	WORD(0xdb58), WORD(0xf893), WORD(0x025b), WORD(0x1c89), WORD(0x9f81), WORD(0x932c),
+	WORD(0xa61e), WORD(0x7706), WORD(0xb220), WORD(0x0996), WORD(0x1c79), WORD(0xa864),
+	WORD(0x49d5), WORD(0x1353), WORD(0x0844), WORD(0x5013), WORD(0xd76f), WORD(0x65aa),
+	WORD(0xf780), WORD(0x01ff), WORD(0x7c04), WORD(0x0ff3), WORD(0x0706), WORD(0x693b),
+	WORD(0x238e), WORD(0xf57f), WORD(0x9b3e), WORD(0xaf6c), WORD(0x16b6), WORD(0xd90a),
+	/* 9G */
+	WORD(0xb92f), WORD(0x2353), WORD(0x200e), WORD(0x2f5d), WORD(0xe4f9), WORD(0x3fd7),
+	WORD(0x8729), WORD(0xe35d), WORD(0x745d), WORD(0xa96d), WORD(0x4833), WORD(0x2609),
+	WORD(0xff3f), WORD(0x3cbf), WORD(0x1dc1), WORD(0xdc35), WORD(0x4d6a), WORD(0xdad5),
+	WORD(0x64c6), WORD(0x26d4), WORD(0x6c6a), WORD(0x5363), WORD(0x1d1d), WORD(0x5cab),
+	WORD(0xc0b0), WORD(0xb18e), WORD(0x3072), WORD(0xf281), WORD(0xaa2f), WORD(0xd742),
+	WORD(0xe270), WORD(0x3777), WORD(0xa7c2), WORD(0x033c), WORD(0x61c7), WORD(0x27f0),
+	WORD(0xd0d8), WORD(0x68ea), WORD(0xaccc), WORD(0xa6ec), WORD(0xa754), WORD(0xee69),
+	WORD(0x29f4), WORD(0x7d94), WORD(0xf5c6), WORD(0x31e8), WORD(0x6334), WORD(0xe770),
+	/* 11G */
+	WORD(0x8c7d), WORD(0xb68b), WORD(0x8b19), WORD(0xc770), WORD(0x7aba), WORD(0x4437),
+	WORD(0x077c), WORD(0x4532), WORD(0xd64f), WORD(0x6cda), WORD(0x6770), WORD(0x0dcc),
+	WORD(0x6602), WORD(0x147b), WORD(0xbf56), WORD(0x01b8), WORD(0x1d79), WORD(0xf056),
+	WORD(0x9885), WORD(0xf8d8), WORD(0xc437), WORD(0x7ba9), WORD(0xe9fc), WORD(0x9c19),
+	WORD(0xba25), WORD(0xbdc4), WORD(0xb146), WORD(0x764e), WORD(0x4b83), WORD(0xac14),
+	WORD(0xe46b), WORD(0x604f), WORD(0xe780), WORD(0x8a77), WORD(0x1329), WORD(0x3ce8),
+	WORD(0x682e), WORD(0xfe9e), WORD(0x0f36), WORD(0x2e07), WORD(0x287a), WORD(0x3a53),
+	WORD(0x1d0c), WORD(0x4182), WORD(0xf918), WORD(0x3533), WORD(0x2f9f), WORD(0x9aa6),
+	/* 13G */
+	WORD(0xbdfb), WORD(0x75cc), WORD(0xeb7e), WORD(0x9b7a), WORD(0x9a95), WORD(0xf674),
+	WORD(0x28c5), WORD(0xb25e), WORD(0xd4ae), WORD(0x33b7), WORD(0x8e46), WORD(0x8a7a),
+	WORD(0xbd56), WORD(0xd9c1), WORD(0x03a8), WORD(0xdb52), WORD(0xdf97), WORD(0xed22),
+	WORD(0x7265), WORD(0xd265), WORD(0x3c94), WORD(0x8cf2), WORD(0x56e1), WORD(0xb51c),
+	WORD(0x812d), WORD(0x6c3d), WORD(0x9459), WORD(0xf4d3), WORD(0xe0c2), WORD(0x87ca),
+	WORD(0x8f1a), WORD(0xd8e8), WORD(0x0fe3), WORD(0xcf4d), WORD(0x2a48), WORD(0x789a),
+	WORD(0x8d60), WORD(0xfec3), WORD(0xac2d), WORD(0xb7fe), WORD(0x0ec3), WORD(0x3b49),
+	WORD(0xbd1c), WORD(0x81fd), WORD(0x79e1), WORD(0xcc69), WORD(0xadb7), WORD(0x4617),
+	/* 15G */
+	WORD(0xf4a9), WORD(0x4709), WORD(0xd888), WORD(0x446a), WORD(0xabd8), WORD(0xec3d),
+	WORD(0x10e2), WORD(0x2b72), WORD(0x7b34), WORD(0x50e0), WORD(0xf195), WORD(0x83cc),
+	WORD(0x3075), WORD(0x789b), WORD(0x0917), WORD(0x5950), WORD(0x5993), WORD(0xeb08),
+	WORD(0x1fd4), WORD(0x0fc0), WORD(0x026b), WORD(0x4903), WORD(0xd26f), WORD(0xfb62),
+	WORD(0x89bb), WORD(0x6fe9), WORD(0xcc9d), WORD(0x2309), WORD(0xd586), WORD(0x144b),
+	WORD(0x9cbd), WORD(0x6160), WORD(0x610c), WORD(0xde06), WORD(0xd3a0), WORD(0x4b23),
+	WORD(0xf470), WORD(0xd898), WORD(0x2866), WORD(0xdddc), WORD(0x5797), WORD(0x400c),
+	WORD(0xfc41), WORD(0x8733), WORD(0x2716), WORD(0xd0bc), WORD(0xc6fe), WORD(0x5a68),
+	/* 17G */
+	WORD(0x3cd0), WORD(0x4b4a), WORD(0xe130), WORD(0x8903), WORD(0xf43e), WORD(0x8ff1),
+	WORD(0xea4c), WORD(0x3ea4), WORD(0xa10d), WORD(0xf655), WORD(0x3f2a), WORD(0xe6fc),
+	WORD(0xfefc), WORD(0x524f), WORD(0x737d), WORD(0x7be3), WORD(0x455e), WORD(0x5330),
+	WORD(0x2855), WORD(0x9f69), WORD(0xce70), WORD(0xe475), WORD(0x166e), WORD(0x524f),
+	WORD(0xf055), WORD(0x6c12), WORD(0x69cd), WORD(0x3fcc), WORD(0xc0da), WORD(0xd5b9),
+	WORD(0xb6ff), WORD(0x4e23), WORD(0xf183), WORD(0x336b), WORD(0x6993), WORD(0x49ce),
+	WORD(0x504a), WORD(0x4a54), WORD(0x6d85), WORD(0xf87d), WORD(0x677a), WORD(0xb3c2),
+	WORD(0x5df1), WORD(0x25eb), WORD(0x64c9), WORD(0x55b1), WORD(0x986f), WORD(0xac37),
+	/* 19G */
+	WORD(0x4c08), WORD(0xbaa8), WORD(0xed4a), WORD(0x82a2), WORD(0xc912), WORD(0x41a8),
+	WORD(0xcc5f), WORD(0x22c4), WORD(0xad5e), WORD(0x154a), WORD(0x9c3b), WORD(0xca10),
+	WORD(0x538e), WORD(0xfc38), WORD(0x1298), WORD(0x2389), WORD(0x02ae), WORD(0x5398),
+	WORD(0x639c), WORD(0xb3b6), WORD(0xd706), WORD(0x0390), WORD(0x1f45), WORD(0xfa0f),
+	WORD(0x21d0), WORD(0xb0dc), WORD(0x8e5d), WORD(0x46b7), WORD(0x2eac), WORD(0xc3da),
+	WORD(0x2d3c), WORD(0xa8c7), WORD(0xf643), WORD(0x6ff2), WORD(0xb378), WORD(0x9170),
+	WORD(0x30c3), WORD(0xb67f), WORD(0x799b), WORD(0x3f5a), WORD(0xb672), WORD(0x8264),
+	WORD(0xdc77), WORD(0x15d1), WORD(0x7764), WORD(0xe957), WORD(0x7b23), WORD(0xa1d4),
+	/* 21G */
+	WORD(0xce2f), WORD(0x0422), WORD(0x5e51), WORD(0x0826), WORD(0x9e21), WORD(0xdd2f),
+	WORD(0xd496), WORD(0x88e0), WORD(0xf75d), WORD(0x6177), WORD(0x8aa0), WORD(0x3012),
+	WORD(0xbe69), WORD(0xbd9e), WORD(0xab62), WORD(0x2e59), WORD(0xe537), WORD(0x5df0),
+	WORD(0x0f6c), WORD(0x1b1a), WORD(0x12b5), WORD(0xdac0), WORD(0xc626), WORD(0xab16),
+	WORD(0x5de7), WORD(0x008c), WORD(0x214b), WORD(0x8014), WORD(0x7bea), WORD(0x38f1),
+	WORD(0x0a9e), WORD(0xaa74), WORD(0x9098), WORD(0x8a14), WORD(0xbb49), WORD(0x262e),
+	WORD(0xcd59), WORD(0x8527), WORD(0x111e), WORD(0xb454), WORD(0x5817), WORD(0xacea),
+	WORD(0xd15a), WORD(0x266a), WORD(0xccba), WORD(0x1353), WORD(0x4f41), WORD(0x2182),
+	/* 23G */
+	WORD(0x683b), WORD(0x12e3), WORD(0xe74d), WORD(0xd1b4), WORD(0x8ef6), WORD(0x569b),
+	WORD(0xd20b), WORD(0x990e), WORD(0x0a18), WORD(0x429c), WORD(0xdd25), WORD(0xb9d3),
+	WORD(0x1783), WORD(0x2a35), WORD(0xb8ab), WORD(0x1c75), WORD(0x32f0), WORD(0x9054),
+	WORD(0xca2b), WORD(0x61e4), WORD(0xf224), WORD(0xeea8), WORD(0x6a69), WORD(0x8082),
+	WORD(0xabad), WORD(0xec52), WORD(0x3a6b), WORD(0x7fc3), WORD(0x4813), WORD(0xa65e),
+	WORD(0xa3f0), WORD(0x0bcc), WORD(0xcebe), WORD(0xa527), WORD(0xa132), WORD(0x7ad8),
+	WORD(0x2c7e), WORD(0xeaf2), WORD(0x8950), WORD(0xf013), WORD(0x18c1), WORD(0x5667),
+	WORD(0x2437), WORD(0x282d), WORD(0x2559), WORD(0xe221), WORD(0xcb0d), WORD(0x9dfc),
+	/* 25G */
+	WORD(0x3b83), WORD(0x58ce), WORD(0x7227), WORD(0x1e93), WORD(0xfb36), WORD(0x3cb3),
+	WORD(0x0dfa), WORD(0xbb28), WORD(0x174a), WORD(0xe2be), WORD(0xf3d2), WORD(0x57d0),
+	WORD(0xbe1e), WORD(0x208a), WORD(0x1b99), WORD(0x9bd5), WORD(0x8024), WORD(0xde24),
+	WORD(0xab50), WORD(0x3809), WORD(0x7331), WORD(0xa5bb), WORD(0x6e2c), WORD(0xc29c),
+	WORD(0x4f05), WORD(0x6112), WORD(0xfd2e), WORD(0x9944), WORD(0xe391), WORD(0x9009),
+	WORD(0xbc4e), WORD(0x83cc), WORD(0xa3cc), WORD(0x9424), WORD(0x8f05), WORD(0x0162),
+	WORD(0x4344), WORD(0xea8e), WORD(0xf51d), WORD(0xd6a2), WORD(0xc96e), WORD(0x4ceb),
+	WORD(0x1a3d), WORD(0xda3e), WORD(0x09dc), WORD(0xe978), WORD(0xfb42), WORD(0x1fe6),
+	/* 27G */
+	WORD(0x66e4), WORD(0x467d), WORD(0x82d2), WORD(0xa044), WORD(0x291d), WORD(0x4d78),
+	WORD(0x1293), WORD(0xcf19), WORD(0x96f9), WORD(0x4823), WORD(0x4168), WORD(0x8e0d),
+	WORD(0x14d0), WORD(0xd18f), WORD(0xe2d5), WORD(0x7228), WORD(0x58fe), WORD(0x9c6a),
+	WORD(0x8d50), WORD(0x2f7e), WORD(0x5aec), WORD(0x373e), WORD(0x780e), WORD(0xe8ca),
+	WORD(0xe9f8), WORD(0x1b68), WORD(0xd1d6), WORD(0x42aa), WORD(0xf8f4), WORD(0x69e2),
+	WORD(0xd7f5), WORD(0x58a6), WORD(0x1bea), WORD(0x31da), WORD(0xadfe), WORD(0xd779),
+	WORD(0x5a85), WORD(0x38c8), WORD(0x5406), WORD(0x7d26), WORD(0x3cdf), WORD(0xd44d),
+	WORD(0x7195), WORD(0x67e6), WORD(0x4ed7), WORD(0xc513), WORD(0x0a0b), WORD(0x1782),
+	/* 29G */
+	WORD(0x1470), WORD(0xd302), WORD(0x6ac5), WORD(0x019d), WORD(0x43d6), WORD(0x7804),
+	WORD(0x6b66), WORD(0x2584), WORD(0x7647), WORD(0x55c9), WORD(0x15ed), WORD(0xce3c),
+	WORD(0xeb0f), WORD(0x0e3f), WORD(0x2d49), WORD(0x3dc2), WORD(0x26e4), WORD(0xa7df),
+	WORD(0xb7cb), WORD(0x2065), WORD(0xea1f), WORD(0x187c), WORD(0x0ae8), WORD(0xc8b0),
+	WORD(0xded3), WORD(0x865d), WORD(0x84a0), WORD(0x1a52), WORD(0x3de2), WORD(0x20c8),
+	WORD(0x1649), WORD(0x293c), WORD(0x51b3), WORD(0xcce8), WORD(0x8d26), WORD(0xab17),
+	WORD(0x05fb), WORD(0x4045), WORD(0xb10b), WORD(0x8e6d), WORD(0x2033), WORD(0x90c8),
+	WORD(0x7e71), WORD(0xf6f5), WORD(0xf16c), WORD(0x5977), WORD(0x1c01), WORD(0x1d2a),
+	/* 31G */
+	WORD(0x06a4), WORD(0x7c89), WORD(0x8931), WORD(0xa39c), WORD(0x1ee6), WORD(0x9e82),
+	WORD(0xecdd), WORD(0xb6e7), WORD(0x4fe6), WORD(0xf0df), WORD(0x8340), WORD(0x2ecf),
+	WORD(0x4965), WORD(0x53c1), WORD(0x7dc9), WORD(0xd42f), WORD(0x8285), WORD(0xe3ba),
+	WORD(0x51a3), WORD(0x1afb), WORD(0x05d1), WORD(0x0a33), WORD(0xc404), WORD(0x6c07),
+	WORD(0xc1da), WORD(0x127f), WORD(0x3288), WORD(0xdab8), WORD(0x4b08), WORD(0x374c),
+	WORD(0x699b), WORD(0xbc0a), WORD(0x20dd), WORD(0x42eb), WORD(0x9bab), WORD(0x402a),
+	WORD(0x7a1c), WORD(0x045a), WORD(0x464f), WORD(0xd7dd), WORD(0xecc4), WORD(0x36be),
+	WORD(0x0d6d), WORD(0x5b3d), WORD(0xa19d), WORD(0x6398), WORD(0x3e75), WORD(0x475a),
+	/* 33G */
+	WORD(0xba63), WORD(0x2fb3), WORD(0x3a38), WORD(0x6133), WORD(0x3c86), WORD(0x5b94),
+	WORD(0x0d9d), WORD(0xdf33), WORD(0xf3af), WORD(0x955e), WORD(0xc7ee), WORD(0xbbc7),
+	WORD(0x9efb), WORD(0x60f0), WORD(0x1fc1), WORD(0xda63), WORD(0xc400), WORD(0x41d5),
+	WORD(0x6226), WORD(0x68af), WORD(0x3e9d), WORD(0x6c83), WORD(0x97a4), WORD(0xcc9e),
+	WORD(0x5e76), WORD(0x3a62), WORD(0x3e8e), WORD(0x7fd7), WORD(0xe55e), WORD(0xc209),
+	WORD(0x6124), WORD(0x13bf), WORD(0x0b91), WORD(0x48b9), WORD(0x7cea), WORD(0x0846),
+	WORD(0x0aba), WORD(0xbb6f), WORD(0x6eb9), WORD(0x8a41), WORD(0x1072), WORD(0xb8c3),
+	WORD(0x93a1), WORD(0x6fcc), WORD(0xdad7), WORD(0x9057), WORD(0x2b61), WORD(0xa7fd),
+	/* 35G */
+	WORD(0xec9b), WORD(0x3720), WORD(0xb543), WORD(0x58a5), WORD(0x2fb4), WORD(0x2d7c),
+	WORD(0x00d5), WORD(0xbb38), WORD(0xbd0a), WORD(0xdde6), WORD(0x8620), WORD(0x4a50),
+	WORD(0x83fd), WORD(0xa025), WORD(0x6273), WORD(0x65f1), WORD(0x8523), WORD(0x4fc7),
+	WORD(0xd8e3), WORD(0x832b), WORD(0x7bc6), WORD(0xe941), WORD(0x9f75), WORD(0xd614),
+	WORD(0xb52a), WORD(0x3dee), WORD(0x26e9), WORD(0xfeb0), WORD(0x0956), WORD(0xa55e),
+	WORD(0x8088), WORD(0x0ce1), WORD(0x92a2), WORD(0x9880), WORD(0x8998), WORD(0x5001),
+	WORD(0x5eee), WORD(0x28f3), WORD(0x9fab), WORD(0x22f1), WORD(0xd35c), WORD(0x52cc),
+	WORD(0x877f), WORD(0xac8a), WORD(0x3f26), WORD(0x30e2), WORD(0x8ad8), WORD(0xb13a),
+	/* 37G */
+	WORD(0x61a3), WORD(0xe44f), WORD(0xd57d), WORD(0x0202), WORD(0x0ef2), WORD(0xb563),
+	WORD(0x704b), WORD(0x4027), WORD(0x4a5d), WORD(0xf5b5), WORD(0xe2df), WORD(0xa129),
+	WORD(0x2b86), WORD(0x9748), WORD(0x0a75), WORD(0xacb6), WORD(0x7114), WORD(0x7ef2),
+	WORD(0xede8), WORD(0x9261), WORD(0x58b5), WORD(0xdefc), WORD(0x28f3), WORD(0x1eba),
+	WORD(0x589e), WORD(0x8be5), WORD(0xc0c9), WORD(0x6c91), WORD(0x4bee), WORD(0x1459),
+	WORD(0x43d5), WORD(0x2f16), WORD(0xa034), WORD(0x5d2c), WORD(0x1243), WORD(0x2ea9),
+	WORD(0x7d1f), WORD(0x9404), WORD(0x49a8), WORD(0xb506), WORD(0xa337), WORD(0x638c),
+	WORD(0xcbb5), WORD(0x284f), WORD(0xbf85), WORD(0xfe85), WORD(0x07b7), WORD(0xfa0e),
+	/* 39G */
+	WORD(0x0e42), WORD(0x506e), WORD(0x4f80), WORD(0x7d89), WORD(0x2c46), WORD(0x8e3d),
+	WORD(0x244a), WORD(0xd984), WORD(0x006f), WORD(0x2b7f), WORD(0xdf64), WORD(0x6d7e),
+	WORD(0x6230), WORD(0xde9b), WORD(0xcd6d), WORD(0x36a1), WORD(0x0665), WORD(0xb76c),
+	WORD(0x5040), WORD(0xc998), WORD(0x1fc2), WORD(0xb89b), WORD(0xf4d6), WORD(0x587d),
+	WORD(0xae7a), WORD(0x6a71), WORD(0x3847), WORD(0x4c06), WORD(0x4747), WORD(0xe829),
+	WORD(0x0ab3), WORD(0x7b2b), WORD(0x53b8), WORD(0xb531), WORD(0x553a), WORD(0x345c),
+	WORD(0x9fe2), WORD(0x436d), WORD(0xe453), WORD(0xb646), WORD(0x0340), WORD(0x1cd6),
+	WORD(0x355f), WORD(0x1a95), WORD(0x68fb), WORD(0x0749), WORD(0xc128), WORD(0x2d7b),
+	/* 41G */
+	WORD(0xd14c), WORD(0xbca6), WORD(0x8e87), WORD(0xad14), WORD(0x201e), WORD(0x456a),
+	WORD(0xd24d), WORD(0x41df), WORD(0x68f3), WORD(0xa80d), WORD(0x2933), WORD(0x73a8),
+	WORD(0xa035), WORD(0x852c), WORD(0x6c8d), WORD(0x8974), WORD(0x71ae), WORD(0x95fd),
+	WORD(0x7788), WORD(0xe3bc), WORD(0x245d), WORD(0xda92), WORD(0xcd2c), WORD(0x8764),
+	WORD(0x23e2), WORD(0x82eb), WORD(0x2c47), WORD(0xa2fe), WORD(0x9d6e), WORD(0x0f3c),
+	WORD(0x62e0), WORD(0x5ac7), WORD(0x6f31), WORD(0x2164), WORD(0x0ce1), WORD(0x5786),
+	WORD(0x589a), WORD(0x4f9f), WORD(0xd6c3), WORD(0xbdc9), WORD(0x272e), WORD(0xd193),
+	WORD(0x52c7), WORD(0x6799), WORD(0xf1c5), WORD(0xeb18), WORD(0x702e), WORD(0x82ea),
+	/* 43G */
+	WORD(0x6d44), WORD(0x0084), WORD(0x9355), WORD(0x37fa), WORD(0xbc8c), WORD(0x0578),
+	WORD(0x2fc5), WORD(0x0911), WORD(0x943d), WORD(0x39c4), WORD(0xf5b2), WORD(0xdad9),
+	WORD(0xbd86), WORD(0x416d), WORD(0xf5f0), WORD(0x7314), WORD(0xfb56), WORD(0x01fe),
+	WORD(0x95a9), WORD(0x5cf0), WORD(0xb393), WORD(0x22da), WORD(0x8bad), WORD(0x3517),
+	WORD(0xf1a7), WORD(0x36ba), WORD(0xfc1b), WORD(0xcf79), WORD(0x5498), WORD(0x749e),
+	WORD(0xe42d), WORD(0x1b7e), WORD(0x14bb), WORD(0xede3), WORD(0x8aa9), WORD(0xbce7),
+	WORD(0x28df), WORD(0xbd06), WORD(0xe0f6), WORD(0xaaf8), WORD(0xf948), WORD(0x15cb),
+	WORD(0xb094), WORD(0xa974), WORD(0x2b78), WORD(0xc963), WORD(0x1f63), WORD(0x8f3f),
+	/* 45G */
+	WORD(0xda5b), WORD(0x4fdd), WORD(0x1156), WORD(0xd4c4), WORD(0x9112), WORD(0x73ad),
+	WORD(0x65c6), WORD(0xd4af), WORD(0x8f59), WORD(0x39eb), WORD(0xe0bb), WORD(0xffe8),
+	WORD(0xcf13), WORD(0x8d6f), WORD(0x0c0e), WORD(0xb004), WORD(0xb599), WORD(0x1f2b),
+	WORD(0xc0c6), WORD(0x99e1), WORD(0x3405), WORD(0xb2ac), WORD(0xc858), WORD(0x9c94),
+	WORD(0xd85d), WORD(0x6eee), WORD(0x78d7), WORD(0x8f88), WORD(0xca3f), WORD(0x51fc),
+	WORD(0xf543), WORD(0x62b2), WORD(0x6918), WORD(0xe5b5), WORD(0x44a9), WORD(0xeb3b),
+	WORD(0x4e93), WORD(0xb723), WORD(0x6676), WORD(0x16f9), WORD(0xf19e), WORD(0xbd2a),
+	WORD(0x7722), WORD(0x1747), WORD(0xa485), WORD(0xdb83), WORD(0x2979), WORD(0x42eb),
+	/* 47G */
+	WORD(0x68ca), WORD(0xf0c6), WORD(0x8f7d), WORD(0x6f88), WORD(0xc66c), WORD(0x5f0d),
+	WORD(0x8878), WORD(0x65c7), WORD(0x07a0), WORD(0x5f5b), WORD(0x8512), WORD(0xbfb1),
+	WORD(0xacd0), WORD(0xd878), WORD(0xbff7), WORD(0x780a), WORD(0xf950), WORD(0x570c),
+	WORD(0x21b1), WORD(0x504f), WORD(0x3371), WORD(0xda23), WORD(0x37c5), WORD(0xea5b),
+	WORD(0x7ed1), WORD(0x2243), WORD(0xe8bd), WORD(0x487a), WORD(0xf9b7), WORD(0x249c),
+	WORD(0x1758), WORD(0x9c70), WORD(0x34ff), WORD(0x98fb), WORD(0x62a8), WORD(0xf865),
+	WORD(0xfc91), WORD(0x65e0), WORD(0xa1a2), WORD(0xdfee), WORD(0xfc23), WORD(0x2e20),
+	WORD(0x0691), WORD(0xeef0), WORD(0x2a8b), WORD(0xdfa7), WORD(0xfec7), WORD(0xac9d),
+	/* 49G */
+	WORD(0x36c6), WORD(0x6971), WORD(0x3aef), WORD(0xfa5c), WORD(0x6fb8), WORD(0xa5ea),
+	WORD(0xaf63), WORD(0x8ea5), WORD(0x65a4), WORD(0x42e3), WORD(0x1565), WORD(0xa669),
+	WORD(0x3386), WORD(0x5b6e), WORD(0x6c11), WORD(0x47c5), WORD(0x3f56), WORD(0xcea0),
+	WORD(0x832b), WORD(0x1197), WORD(0xea9e), WORD(0x50e4), WORD(0x0bb2), WORD(0x0b47),
+	WORD(0x5712), WORD(0x13b2), WORD(0xc743), WORD(0x3113), WORD(0x7d48), WORD(0xd249),
+	WORD(0x174e), WORD(0x8d6c), WORD(0xebe8), WORD(0x49c9), WORD(0x86ee), WORD(0xfc44),
+	WORD(0xbdd3), WORD(0x7f82), WORD(0xedd5), WORD(0x2487), WORD(0xbe2f), WORD(0x5b57),
+	WORD(0x6441), WORD(0x771e), WORD(0x2bdb), WORD(0xe28b), WORD(0xc518), WORD(0x2d1c),
+	/* 51G */
+	WORD(0xac8d), WORD(0x2070), WORD(0xcac7), WORD(0x2c4c), WORD(0x22b8), WORD(0xec4a),
+	WORD(0xc0ca), WORD(0x1947), WORD(0x78d9), WORD(0x8c5a), WORD(0xfb59), WORD(0xa5e0),
+	WORD(0x4de7), WORD(0x41a8), WORD(0xe8d2), WORD(0x464a), WORD(0xbc27), WORD(0xdaaa),
+	WORD(0x16e9), WORD(0x3dba), WORD(0xcb3c), WORD(0x4f35), WORD(0x4a50), WORD(0x1663),
+	WORD(0xc84f), WORD(0xb16e), WORD(0x8bf9), WORD(0xadc1), WORD(0xdd35), WORD(0x7359),
+	WORD(0x067e), WORD(0x324d), WORD(0x43f0), WORD(0x5705), WORD(0xc0c3), WORD(0xdaea),
+	WORD(0x7d36), WORD(0x3c88), WORD(0x4000), WORD(0x0b22), WORD(0x1a0d), WORD(0x373f),
+	WORD(0x89e2), WORD(0xc694), WORD(0x0d97), WORD(0xcbaa), WORD(0x047d), WORD(0x518b),
+	/* 53G */
+	WORD(0x49ef), WORD(0xfbde), WORD(0xddc6), WORD(0x3b1b), WORD(0x15cc), WORD(0x8a09),
+	WORD(0x7c26), WORD(0xdaed), WORD(0x22a2), WORD(0x0f04), WORD(0x1061), WORD(0x0b01),
+	WORD(0x4b16), WORD(0xa7c5), WORD(0x5c74), WORD(0xcf48), WORD(0xaae2), WORD(0x15c3),
+	WORD(0xc4e6), WORD(0x642e), WORD(0x83ea), WORD(0xe0f3), WORD(0x8f10), WORD(0xa8ba),
+	WORD(0x8501), WORD(0x9561), WORD(0x54b4), WORD(0x2a20), WORD(0xfa8b), WORD(0x089e),
+	WORD(0x6442), WORD(0xebec), WORD(0xa83e), WORD(0x4e2f), WORD(0xa19a), WORD(0x5786),
+	WORD(0x9963), WORD(0x3906), WORD(0x1ad1), WORD(0xd2c7), WORD(0x65e2), WORD(0x4817),
+	WORD(0x3d9a), WORD(0xadc9), WORD(0x9485), WORD(0x7ecc), WORD(0xe3eb), WORD(0xedf2),
+	/* 55G */
+	WORD(0x3367), WORD(0x069f), WORD(0x5f60), WORD(0xbcab), WORD(0xec3c), WORD(0x1718),
+	WORD(0x22bc), WORD(0xfd66), WORD(0x42d6), WORD(0xe3a1), WORD(0x7867), WORD(0xa4fb),
+	WORD(0xaeb3), WORD(0x085f), WORD(0xd8bf), WORD(0x6078), WORD(0x554f), WORD(0x60f4),
+	WORD(0xbfda), WORD(0xfa5c), WORD(0xd408), WORD(0x690c), WORD(0xd5d1), WORD(0xb3fc),
+	WORD(0x7884), WORD(0x281f), WORD(0xee7d), WORD(0x4ebd), WORD(0x63a7), WORD(0x180a),
+	WORD(0x23aa), WORD(0x82af), WORD(0x9f61), WORD(0x3d07), WORD(0x107c), WORD(0x8de3),
+	WORD(0x34f8), WORD(0xbe23), WORD(0xb5cb), WORD(0x17c6), WORD(0xfa06), WORD(0x97d0),
+	WORD(0xe739), WORD(0x6a91), WORD(0xeed4), WORD(0x14ce), WORD(0x2573), WORD(0x7460),
+	/* 57G */
+	WORD(0x865c), WORD(0xf97f), WORD(0xa61c), WORD(0xb14b), WORD(0x8b0d), WORD(0x694b),
+	WORD(0xe4c1), WORD(0x73ba), WORD(0xbf62), WORD(0xac4b), WORD(0x67df), WORD(0xa149),
+	WORD(0x46e0), WORD(0x9bf4), WORD(0xd150), WORD(0x1e9d), WORD(0xceef), WORD(0x1c99),
+	WORD(0xf3eb), WORD(0xc052), WORD(0xc189), WORD(0x7a78), WORD(0x7fa0), WORD(0x814d),
+	WORD(0xb05d), WORD(0xab74), WORD(0xa483), WORD(0xa101), WORD(0x7b65), WORD(0xa173),
+	WORD(0xc258), WORD(0x7788), WORD(0xa13c), WORD(0xe809), WORD(0xbab7), WORD(0x0d60),
+	WORD(0x1d5b), WORD(0x73c8), WORD(0x7bc4), WORD(0x8f42), WORD(0xc1fc), WORD(0x2952),
+	WORD(0x3055), WORD(0xd2e1), WORD(0xdf63), WORD(0x4b26), WORD(0x3b9a), WORD(0x0a82),
+	/* 59G */
+	WORD(0x64c9), WORD(0x27bf), WORD(0x7ce2), WORD(0xaf46), WORD(0x974c), WORD(0xf929),
+	WORD(0x6897), WORD(0xdfca), WORD(0x2738), WORD(0x5c32), WORD(0x3b59), WORD(0x6447),
+	WORD(0xe315), WORD(0x1ed0), WORD(0x17cf), WORD(0x96a9), WORD(0x4db9), WORD(0x0de6),
+	WORD(0x435b), WORD(0x3703), WORD(0xb646), WORD(0x9267), WORD(0x3967), WORD(0x9ba0),
+	WORD(0x2fbe), WORD(0x3a52), WORD(0x2aae), WORD(0xdf0c), WORD(0xeff0), WORD(0xb335),
+	WORD(0xb741), WORD(0x41bd), WORD(0x9703), WORD(0x7b05), WORD(0x2edd), WORD(0xaccf),
+	WORD(0x3cce), WORD(0x2846), WORD(0x4b30), WORD(0x6fb3), WORD(0xca19), WORD(0xd9e3),
+	WORD(0xba0b), WORD(0x96d9), WORD(0x55c1), WORD(0x5046), WORD(0x6f12), WORD(0xff33),
+	/* 61G */
+	WORD(0xa6e0), WORD(0xfc60), WORD(0x1fd3), WORD(0x48da), WORD(0x41e8), WORD(0x2222),
+	WORD(0x5a34), WORD(0x54fb), WORD(0xe080), WORD(0x772a), WORD(0xe34f), WORD(0x6035),
+	WORD(0x82d0), WORD(0x3329), WORD(0x7ff2), WORD(0x5ff7), WORD(0x51fd), WORD(0x00fe),
+	WORD(0x4673), WORD(0x2366), WORD(0xa006), WORD(0xef6b), WORD(0xa049), WORD(0xc93e),
+	WORD(0x1266), WORD(0x7d38), WORD(0xf117), WORD(0x6640), WORD(0xf4ac), WORD(0x6ae9),
+	WORD(0x32cd), WORD(0x394d), WORD(0x03eb), WORD(0x70d3), WORD(0x8853), WORD(0xe6a7),
+	WORD(0x5767), WORD(0xe527), WORD(0x19ff), WORD(0x0dda), WORD(0x6d23), WORD(0x0146),
+	WORD(0xc772), WORD(0xb0a6), WORD(0x9829), WORD(0x1fc6), WORD(0x1145), WORD(0xc4cc),
+	/* 63G */
+	WORD(0x89c0), WORD(0xaaed), WORD(0xe6d7), WORD(0xc5c0), WORD(0x1896), WORD(0x149a),
+	WORD(0xead6), WORD(0x6ce8), WORD(0x9f8f), WORD(0x8c94), WORD(0xf745), WORD(0x7a50),
+	WORD(0x71aa), WORD(0x6e2b), WORD(0x35f7), WORD(0xcd7e), WORD(0x9f7a), WORD(0x9a04),
+	WORD(0x9e51), WORD(0xf615), WORD(0x2d1e), WORD(0xf1e5), WORD(0xf0b0), WORD(0x1c9b),
+	WORD(0x2c80), WORD(0x1820), WORD(0xc1f5), WORD(0x3bb6), WORD(0x7b1a), WORD(0x1ecd),
+	WORD(0x5f62), WORD(0x8d3a), WORD(0x7f19), WORD(0x88d1), WORD(0x34e8), WORD(0x3bb0),
+	WORD(0x048d), WORD(0x97d4), WORD(0xbd49), WORD(0xdc89), WORD(0xdf22), WORD(0x3735),
+	WORD(0x7b8e), WORD(0xf5af), WORD(0x89e8), WORD(0xa0a6), WORD(0x3712), WORD(0x52bb),
+};
+#else                     /* unknown word size */
+#error "Unsupported word size"
+#endif
+TO_EC_GEN_TABLE_PARAM(secp384r1_gen_wnaf, 7);
+
+/*
+ * Signed comb of the generator for the fixed base multiplications (6
+ * teeth, spacing 64), affine x and y in Montgomery representation
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+static const word_t secp384r1_gen_comb[] = {
+	/* T[0] */
+	WORD(0x80f13023aeb330a1), WORD(0x778b48795a9b5404),
+	WORD(0xd4a80c750e7ea6e1), WORD(0x5a924da6ca603f7a),
+	WORD(0x3229a4f7f1922676), WORD(0x197c2b4823fb1a8a),
+	WORD(0xe33beabe9d6546fd), WORD(0x40c1f776f63b4595),
+	WORD(0x3a752764bda85e6a), WORD(0x2738b63a00ce49c7),
+	WORD(0x7fb9f2b16006403a), WORD(0xc807e55a30e880e4),
+	/* T[1] */
+	WORD(0x9b8c2de2850e032c), WORD(0x1623df5a5e53a08b),
+	WORD(0x5e750560d959c953), WORD(0x76021e2240b418ba),
+	WORD(0x5689434f15d4fdfd), WORD(0xde66d6c9b1f155ed),
+	WORD(0xdb7ab7c74c08666d), WORD(0x0bebb19edb3e6905),
+	WORD(0xc5e6bd5421d8628f), WORD(0x846f9d11433ef685),
+	WORD(0x7aebc74cdbf28623), WORD(0xe64c11fc397a296e),
+	/* T[2] */
+	WORD(0x072f458d54c85b88), WORD(0xc9fc3c1f62e7e269),
+	WORD(0x90f804fbdb96df04), WORD(0xcef098d988b9c9f6),
+	WORD(0xf3e40e578587e62d), WORD(0xde0148ecdbb044ef),
+	WORD(0x96cbad03ab211c76), WORD(0x79af8b7abdcd82ef),
+	WORD(0x646ba6d474157f10), WORD(0x1823fe666219e061),
+	WORD(0xb43a893195d97b55), WORD(0x0020d0a75f4ed89e),
+	/* T[3] */
+	WORD(0x50f1a9bdb5df9327), WORD(0x9591e4609a660ca6),
+	WORD(0x194b26650d534c70), WORD(0xe53ae67819bd542e),
+	WORD(0x5983840fe200c2fb), WORD(0x3c98838ac9be7ff8),
+	WORD(0x63496d5cb389d8cf), WORD(0x365f53626653bf13),
+	WORD(0x1b2d01c8ee0663dd), WORD(0xfe99cbca570bfa89),
+	WORD(0x042f9880718ad899), WORD(0x71602170f7f3c463),
+	/* T[4] */
+	WORD(0x0af302699ea56fee), WORD(0x9722b89a5c06049f),
+	WORD(0x7ae5e92ccff9a4a2), WORD(0xa4138052a7f991ad),
+	WORD(0xe05fc593c90c3851), WORD(0x2a90e5f2d9a3affe),
+	WORD(0xc306dcc407199cc3), WORD(0x1709cf10dc22b49f),
+	WORD(0xaf69c12b920de01e), WORD(0x5325b1c06d3766de),
+	WORD(0x19203ab2ee821687), WORD(0x25b9d81b2d0a54b1),
+	/* T[5] */
+	WORD(0xfd6d5645a2816c0a), WORD(0xc5ea3f3a3492804e),
+	WORD(0x8b65eee1a86e72c3), WORD(0x4a511ca5c935971f),
+	WORD(0x5a02b94896a15841), WORD(0x70d760012b213650),
+	WORD(0x905fb2889accf748), WORD(0x25e7bdb9f2c19e63),
+	WORD(0x2364c8af7e8d91ca), WORD(0x193179b7a9d74617),
+	WORD(0xd5045874b2e3d5d9), WORD(0xda8d29dde162c387),
+	/* T[6] */
+	WORD(0xe620d909b2409843), WORD(0xaf96811d03375a86),
+	WORD(0xedda392749386938), WORD(0x8cc26c0fd8f03c5a),
+	WORD(0x6b4e02822d02ab19), WORD(0xcf7bb70030f7d02f),
+	WORD(0x7f28784f8cc8ddc6), WORD(0xf154a555ba04db8a),
+	WORD(0x37af1190d7c38096), WORD(0x3fdd8f347b9c5c1f),
+	WORD(0x6f8eaf22e50bf480), WORD(0x2c0c79be3268dd51),
+	/* T[7] */
+	WORD(0x23193242cd2ceaf6), WORD(0x2b37aa1e53da67d6),
+	WORD(0x7f775d794bb5fda9), WORD(0xe71658e3b6c2c628),
+	WORD(0xe84ef6e3bf8762c4), WORD(0xd91a6c51fe78d2ed),
+	WORD(0x2bb296c03a92e3ac), WORD(0xa55049044c58712a),
+	WORD(0xb760ff8250a578b1), WORD(0x8588be453c1a6d4c),
+	WORD(0xa885ce296982ef58), WORD(0x9a00534c2a54606c),
+	/* T[8] */
+	WORD(0xaec1359702699795), WORD(0x0a3634021fc11b27),
+	WORD(0xfe8bd5bf9a294c81), WORD(0x2eef2fa14afec28b),
+	WORD(0x04be38379260b7ee), WORD(0x7358768f4cac7e5c),
+	WORD(0xc1c5452680846944), WORD(0x1a3c641652ccfea7),
+	WORD(0xaa3b8b0b77392d59), WORD(0xbd8032a0e007a2fb),
+	WORD(0xf1a73d6c6f0df1c8), WORD(0xd86521cff0997036),
+	/* T[9] */
+	WORD(0x7cf881f05aa5dd5b), WORD(0x1933be208acd0512),
+	WORD(0xfc4a883cb87b12dc), WORD(0x2cc76680fdb6a1bf),
+	WORD(0x9e75e6601ecbf88e), WORD(0x891acd636826e31a),
+	WORD(0x8b2c59fa16bf16e1), WORD(0xeb5bdaecfbd1941f),
+	WORD(0xc1065e5b7026a363), WORD(0x5afcc903cc88e226),
+	WORD(0x459441300cd60552), WORD(0xacf18749852d2b1d),
+	/* T[10] */
+	WORD(0xe60e71179da8c259), WORD(0x84edfd2c2c9f7713),
+	WORD(0xd19d6f6d011b4787), WORD(0xced9acb4634dc557),
+	WORD(0xd7c9c60cc1718535), WORD(0xa9c109ee19e1ea96),
+	WORD(0x37e74d61d9cac0cc), WORD(0xbce53a333af0a535),
+	WORD(0x19377fb18d86faeb), WORD(0x1928cff57c1d22db),
+	WORD(0x9517ef08863e30e6), WORD(0xe1fc30f4681a26ab),
+	/* T[11] */
+	WORD(0xb8d24a67a6ab4962), WORD(0x1ff200c865e04919),
+	WORD(0x269af9001274cb59), WORD(0x9f371978e9139b40),
+	WORD(0xf29e91fe460fe65b), WORD(0x477fe51621eee281),
+	WORD(0xf7dc6de796086b3f), WORD(0xae9822c2ae10bf98),
+	WORD(0x4b472403ee29b155), WORD(0x14da61637a6b7701),
+	WORD(0x08d68d27e802fc7f), WORD(0xda6c1578696cd750),
+	/* T[12] */
+	WORD(0x938f36e508a423bf), WORD(0xfcb8e4f320342165),
+	WORD(0xa1d83353e3982f0d), WORD(0x1d63b6cde2a08df4),
+	WORD(0x084a1f88e89a6d54), WORD(0xa34a753fea7e52db),
+	WORD(0x863658031334036a), WORD(0xdd957a191bad977d),
+	WORD(0x6a809ca6e563d82f), WORD(0x6f02bd9aedd14008),
+	WORD(0x92a638cba31bd75a), WORD(0x635722cfeeb40505),
+	/* T[13] */
+	WORD(0xdc587f709f302ba8), WORD(0x877668d75950eab3),
+	WORD(0x979b3b116c8281ab), WORD(0x5ebb36ada8249b24),
+	WORD(0x2c82a5d62d6f0c04), WORD(0x6d6cd374a6b6f87b),
+	WORD(0xd185867fea1ddf5d), WORD(0x7dbc69516ff78a68),
+	WORD(0xe0de69ef64307816), WORD(0xf4c438b9a3952597),
+	WORD(0x6df02f5b60e34e05), WORD(0x2b87f83e6d79b49e),
+	/* T[14] */
+	WORD(0x69a8488ca3969d42), WORD(0x9e8d068aaadbc15a),
+	WORD(0x386ab095ef9199c4), WORD(0x5693a4450790437e),
+	WORD(0x6afee6fb05803408), WORD(0x2f70934c524470ea),
+	WORD(0x0c272bf75935efd8), WORD(0xf966b29ab02cde77),
+	WORD(0xeff845f055664489), WORD(0x32a551675f0e5f6f),
+	WORD(0xd2227a930ab15e81), WORD(0xaed026fc0ff28d4f),
+	/* T[15] */
+	WORD(0x8105c96e0251e61e), WORD(0xa7d4f18d99e1b0bb),
+	WORD(0x5b71f6f3dbc8234f), WORD(0x4dc2894f01f7d84a),
+	WORD(0xd5132c90e6904694), WORD(0x3c811b8292998242),
+	WORD(0x8ea5b43214477436), WORD(0x12b074c793275167),
+	WORD(0x24766c9e87437178), WORD(0x7d983f3effbd43f4),
+	WORD(0xe7f89de8c3d0b5cf), WORD(0xe9e3ed3355ef9bfc),
+	/* T[16] */
+	WORD(0x7908667c25d01d41), WORD(0x69411f8e4cfd6b8f),
+	WORD(0x43942326fc961fdf), WORD(0x9253b4528546504a),
+	WORD(0xe9e425d725ce07aa), WORD(0xd6f8a528d74f0fae),
+	WORD(0x7954b29781cc9e20), WORD(0x34e95e87e1f693b7),
+	WORD(0xf8e3a63d88ce81ee), WORD(0x7e31a4ea87d78ffa),
+	WORD(0x33fd3b3840052f93), WORD(0x7bfe3517e814eb2a),
+	/* T[17] */
+	WORD(0x51a2cf1c30452204), WORD(0x891d7d8e621c1c67),
+	WORD(0x0af5a9b465dff7c2), WORD(0x82126ca4504740a9),
+	WORD(0xbfbff1543d55ce0b), WORD(0xa6973d0217eb9702),
+	WORD(0x157c771666f2d88c), WORD(0x91251e53711dcc22),
+	WORD(0xe34b2b89f767c4fe), WORD(0xe1da6567b209f221),
+	WORD(0x9fca502b08bcf91a), WORD(0x0537af6732bab6de),
+	/* T[18] */
+	WORD(0x5bce03d793051a22), WORD(0x6d1f4420285e7b2f),
+	WORD(0xe7360fe04fe5fff1), WORD(0x9e2efe36c1baeffd),
+	WORD(0x3264cbff379eda53), WORD(0x9f299dfb3eeae815),
+	WORD(0xd73adf1b58922605), WORD(0x3d75b504d24eaa11),
+	WORD(0x4e7a8554e4861d27), WORD(0x3316f3b69deee5da),
+	WORD(0xe617d61ee9f520a6), WORD(0x7db56b989ca3d737),
+	/* T[19] */
+	WORD(0xf6cf2294cca6a5a4), WORD(0xdd76f41ff6170c50),
+	WORD(0x94f12ea3643b19b3), WORD(0x8c2b04fe9e15a617),
+	WORD(0x54314f079ca0fc93), WORD(0x8842f943ad704f9b),
+	WORD(0x25f9557f42fcfff0), WORD(0xed5ad97fb38f0aba),
+	WORD(0xfb5fdf6915deadf4), WORD(0xa4006524ef9d3ee2),
+	WORD(0xf313601ef6ca4ce6), WORD(0xfb5ea4f88225d2ee),
+	/* T[20] */
+	WORD(0xa39c15e807b0b0b4), WORD(0x104b7e40a8703d41),
+	WORD(0x031b04dba3dbb5f9), WORD(0x8ded2ee78990e720),
+	WORD(0x3b99cda3c6727dbf), WORD(0x28b7443e79f18898),
+	WORD(0x0256ebf5fa79a32c), WORD(0x299c19c362416757),
+	WORD(0xfb09701157c966c1), WORD(0xfb25fd2733c1f11b),
+	WORD(0xe6ca98889026fe1c), WORD(0x54fa967adad33921),
+	/* T[21] */
+	WORD(0x33d2f8b10f561ecf), WORD(0x7236b37cee33557e),
+	WORD(0x7421bc7de998dfe9), WORD(0xa48264fec5d95af5),
+	WORD(0x644c01ff604ba943), WORD(0x8a27b018ec50a0d6),
+	WORD(0x92fd9ff3d26f0af3), WORD(0xe67fc269a2436b74),
+	WORD(0x0e4c0ec04813bfae), WORD(0x16aa7b1197ced818),
+	WORD(0x8c7dc826e91e43df), WORD(0x2054ef3c4b5025fe),
+	/* T[22] */
+	WORD(0xb60dff3965c8e083), WORD(0xae786f2abb0fb9f0),
+	WORD(0x830a811a1fbb102c), WORD(0xb995e02a94c157bf),
+	WORD(0x7d07efdb53a6e0dc), WORD(0x5f0e8ea466d6337b),
+	WORD(0x34068a0d3c3e5029), WORD(0xade83d00578e7bed),
+	WORD(0x792352f7f7e1c602), WORD(0x6037612215f70b7a),
+	WORD(0xa7765869c8d8321e), WORD(0x708c30ea76273993),
+	/* T[23] */
+	WORD(0xa927751674bed419), WORD(0xa17787ab7cdf3a12),
+	WORD(0xe0f4df8a38fc2dd1), WORD(0x943be2df92536409),
+	WORD(0x509481d89c11a97b), WORD(0x6541f6fa435e0a97),
+	WORD(0x163037c4f8b29896), WORD(0x1c44292044a6aa79),
+	WORD(0xa0eb36d4b4050fe1), WORD(0x6cb75ca282f86ed2),
+	WORD(0x749bafd2e5187712), WORD(0xe34a649a4b529eae),
+	/* T[24] */
+	WORD(0xb287fb3e66675fe6), WORD(0x5268b35bc2500136),
+	WORD(0xa1fa9f68129d9918), WORD(0x2214d0f23df9c68c),
+	WORD(0x758e39be758cb1d9), WORD(0x8ad4a9d5e6d05162),
+	WORD(0x274acb9068a7ed0f), WORD(0x29d670fabfa08c37),
+	WORD(0xfd640d771d02e2ab), WORD(0x1cd2a7371f35d751),
+	WORD(0x0224ec71afee1c9b), WORD(0xb5d19ccdfe56e7b7),
+	/* T[25] */
+	WORD(0x00648445a144bd76), WORD(0x3c8fa5ac2610725f),
+	WORD(0x69c0b503de536f63), WORD(0x0cbdf5dc4869ad12),
+	WORD(0x5130a47cdf042d7e), WORD(0xa01ab51aba20e3bc),
+	WORD(0xafafe10f80c63e3b), WORD(0xef7bfda62f520fba),
+	WORD(0x55c639c25f86f5fe), WORD(0xdb5bc6a9a6e5c47e),
+	WORD(0xa4447085729722a5), WORD(0x52edefd8e682929d),
+	/* T[26] */
+	WORD(0x4ad482d384907295), WORD(0x282ebc1e6f4b7080),
+	WORD(0x0e1f4647f71087a0), WORD(0x8423478d0209d1fa),
+	WORD(0x9c893dd5f6e1f18d), WORD(0xc811aa8b3ad9517d),
+	WORD(0xbc4debdfd75e022d), WORD(0x8bfdf91bd2004c7d),
+	WORD(0x78376180caf04a4d), WORD(0xb7276e59e7325e5d),
+	WORD(0x84894802562d922e), WORD(0xc955ac20c6c9c0a6),
+	/* T[27] */
+	WORD(0xc32d7a991f33158b), WORD(0xf5846ea8d36b7f65),
+	WORD(0xf2f8be04b95d29f2), WORD(0x0db23a432b6f816a),
+	WORD(0x9a58683ccf74cf1d), WORD(0xa6550eb2adeaa37c),
+	WORD(0x42b3fba447057b02), WORD(0x24615327f7499483),
+	WORD(0xea6327fd31ee6f85), WORD(0x2671ac307a321a32),
+	WORD(0xae670b7348ae8c0a), WORD(0x82830301996a2086),
+	/* T[28] */
+	WORD(0x422685d51be45fc3), WORD(0x8415f9ff1a1a87c1),
+	WORD(0x0e16710653cf8d84), WORD(0x8c8cc1f0c09ea8f4),
+	WORD(0x120bab6e562293f1), WORD(0x5cf0f9d0fcfbdac8),
+	WORD(0x106fa677b83dccaf), WORD(0x4e1cef47d6669c00),
+	WORD(0xabf2a56b9984a268), WORD(0xb553702ca786fc40),
+	WORD(0x5f4afc824954c3d6), WORD(0xb299e4c0bb5f687c),
+	/* T[29] */
+	WORD(0x8803deb754ee243e), WORD(0x2e0659c0acca49ec),
+	WORD(0xf97bdac605bc7758), WORD(0x5416f5922758bd5b),
+	WORD(0x652d534c21c47cbf), WORD(0x50e9836a75aa28d4),
+	WORD(0xed57ddeab670bf38), WORD(0xcde8987213030c71),
+	WORD(0xc74e5e3b5885616d), WORD(0x108d27ac346c147b),
+	WORD(0x00293bd83ffef917), WORD(0x8224da8887a8d078),
+	/* T[30] */
+	WORD(0x4791b9a51fdb21dc), WORD(0x200762a05df38cf0),
+	WORD(0x23c6a20f51ed8460), WORD(0x7d01ae582b1f5787),
+	WORD(0xc73c4028a017b5e5), WORD(0xd8d23762f177ddd6),
+	WORD(0x2ca3f05f6502f03c), WORD(0x30193017766f96db),
+	WORD(0x5013d7dc56c9a093), WORD(0xe0a40beebba1744a),
+	WORD(0xdaef1be8978826e6), WORD(0x54f8acbb2d199cec),
+	/* T[31] */
+	WORD(0x1ae0c4e11c718580), WORD(0x303f48a6bf99a0bf),
+	WORD(0xa5551e4491ae219f), WORD(0xdc41d9bd55a05287),
+	WORD(0xd5aa73e36872b123), WORD(0x6fd94b0ce6395bf6),
+	WORD(0xbb95fdbac00afbc1), WORD(0x9cd96208497cac10),
+	WORD(0x8adbd8c1ca51afea), WORD(0x94fedafbf3bc5f5f),
+	WORD(0x29c0217bdf9f5371), WORD(0x5c13eb4bd9024634),
+};
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+static const word_t secp384r1_gen_comb[] = {
+	/* T[0] */
+	WORD(0xaeb330a1), WORD(0x80f13023), WORD(0x5a9b5404), WORD(0x778b4879),
+	WORD(0x0e7ea6e1), WORD(0xd4a80c75), WORD(0xca603f7a), WORD(0x5a924da6),
+	WORD(0xf1922676), WORD(0x3229a4f7), WORD(0x23fb1a8a), WORD(0x197c2b48),
+	WORD(0x9d6546fd), WORD(0xe33beabe), WORD(0xf63b4595), WORD(0x40c1f776),
+	WORD(0xbda85e6a), WORD(0x3a752764), WORD(0x00ce49c7), WORD(0x2738b63a),
+	WORD(0x6006403a), WORD(0x7fb9f2b1), WORD(0x30e880e4), WORD(0xc807e55a),
+	/* T[1] */
+	WORD(0x850e032c), WORD(0x9b8c2de2), WORD(0x5e53a08b), WORD(0x1623df5a),
+	WORD(0xd959c953), WORD(0x5e750560), WORD(0x40b418ba), WORD(0x76021e22),
+	WORD(0x15d4fdfd), WORD(0x5689434f), WORD(0xb1f155ed), WORD(0xde66d6c9),
+	WORD(0x4c08666d), WORD(0xdb7ab7c7), WORD(0xdb3e6905), WORD(0x0bebb19e),
+	WORD(0x21d8628f), WORD(0xc5e6bd54), WORD(0x433ef685), WORD(0x846f9d11),
+	WORD(0xdbf28623), WORD(0x7aebc74c), WORD(0x397a296e), WORD(0xe64c11fc),
+	/* T[2] */
+	WORD(0x54c85b88), WORD(0x072f458d), WORD(0x62e7e269), WORD(0xc9fc3c1f),
+	WORD(0xdb96df04), WORD(0x90f804fb), WORD(0x88b9c9f6), WORD(0xcef098d9),
+	WORD(0x8587e62d), WORD(0xf3e40e57), WORD(0xdbb044ef), WORD(0xde0148ec),
+	WORD(0xab211c76), WORD(0x96cbad03), WORD(0xbdcd82ef), WORD(0x79af8b7a),
+	WORD(0x74157f10), WORD(0x646ba6d4), WORD(0x6219e061), WORD(0x1823fe66),
+	WORD(0x95d97b55), WORD(0xb43a8931), WORD(0x5f4ed89e), WORD(0x0020d0a7),
+	/* T[3] */
+	WORD(0xb5df9327), WORD(0x50f1a9bd), WORD(0x9a660ca6), WORD(0x9591e460),
+	WORD(0x0d534c70), WORD(0x194b2665), WORD(0x19bd542e), WORD(0xe53ae678),
+	WORD(0xe200c2fb), WORD(0x5983840f), WORD(0xc9be7ff8), WORD(0x3c98838a),
+	WORD(0xb389d8cf), WORD(0x63496d5c), WORD(0x6653bf13), WORD(0x365f5362),
+	WORD(0xee0663dd), WORD(0x1b2d01c8), WORD(0x570bfa89), WORD(0xfe99cbca),
+	WORD(0x718ad899), WORD(0x042f9880), WORD(0xf7f3c463), WORD(0x71602170),
+	/* T[4] */
+	WORD(0x9ea56fee), WORD(0x0af30269), WORD(0x5c06049f), WORD(0x9722b89a),
+	WORD(0xcff9a4a2), WORD(0x7ae5e92c), WORD(0xa7f991ad), WORD(0xa4138052),
+	WORD(0xc90c3851), WORD(0xe05fc593), WORD(0xd9a3affe), WORD(0x2a90e5f2),
+	WORD(0x07199cc3), WORD(0xc306dcc4), WORD(0xdc22b49f), WORD(0x1709cf10),
+	WORD(0x920de01e), WORD(0xaf69c12b), WORD(0x6d3766de), WORD(0x5325b1c0),
+	WORD(0xee821687), WORD(0x19203ab2), WORD(0x2d0a54b1), WORD(0x25b9d81b),
+	/* T[5] */
+	WORD(0xa2816c0a), WORD(0xfd6d5645), WORD(0x3492804e), WORD(0xc5ea3f3a),
+	WORD(0xa86e72c3), WORD(0x8b65eee1), WORD(0xc935971f), WORD(0x4a511ca5),
+	WORD(0x96a15841), WORD(0x5a02b948), WORD(0x2b213650), WORD(0x70d76001),
+	WORD(0x9accf748), WORD(0x905fb288), WORD(0xf2c19e63), WORD(0x25e7bdb9),
+	WORD(0x7e8d91ca), WORD(0x2364c8af), WORD(0xa9d74617), WORD(0x193179b7),
+	WORD(0xb2e3d5d9), WORD(0xd5045874), WORD(0xe162c387), WORD(0xda8d29dd),
+	/* T[6] */
+	WORD(0xb2409843), WORD(0xe620d909), WORD(0x03375a86), WORD(0xaf96811d),
+	WORD(0x49386938), WORD(0xedda3927), WORD(0xd8f03c5a), WORD(0x8cc26c0f),
+	WORD(0x2d02ab19), WORD(0x6b4e0282), WORD(0x30f7d02f), WORD(0xcf7bb700),
+	WORD(0x8cc8ddc6), WORD(0x7f28784f), WORD(0xba04db8a), WORD(0xf154a555),
+	WORD(0xd7c38096), WORD(0x37af1190), WORD(0x7b9c5c1f), WORD(0x3fdd8f34),
+	WORD(0xe50bf480), WORD(0x6f8eaf22), WORD(0x3268dd51), WORD(0x2c0c79be),
+	/* T[7] */
+	WORD(0xcd2ceaf6), WORD(0x23193242), WORD(0x53da67d6), WORD(0x2b37aa1e),
+	WORD(0x4bb5fda9), WORD(0x7f775d79), WORD(0xb6c2c628), WORD(0xe71658e3),
+	WORD(0xbf8762c4), WORD(0xe84ef6e3), WORD(0xfe78d2ed), WORD(0xd91a6c51),
+	WORD(0x3a92e3ac), WORD(0x2bb296c0), WORD(0x4c58712a), WORD(0xa5504904),
+	WORD(0x50a578b1), WORD(0xb760ff82), WORD(0x3c1a6d4c), WORD(0x8588be45),
+	WORD(0x6982ef58), WORD(0xa885ce29), WORD(0x2a54606c), WORD(0x9a00534c),
+	/* T[8] */
+	WORD(0x02699795), WORD(0xaec13597), WORD(0x1fc11b27), WORD(0x0a363402),
+	WORD(0x9a294c81), WORD(0xfe8bd5bf), WORD(0x4afec28b), WORD(0x2eef2fa1),
+	WORD(0x9260b7ee), WORD(0x04be3837), WORD(0x4cac7e5c), WORD(0x7358768f),
+	WORD(0x80846944), WORD(0xc1c54526), WORD(0x52ccfea7), WORD(0x1a3c6416),
+	WORD(0x77392d59), WORD(0xaa3b8b0b), WORD(0xe007a2fb), WORD(0xbd8032a0),
+	WORD(0x6f0df1c8), WORD(0xf1a73d6c), WORD(0xf0997036), WORD(0xd86521cf),
+	/* T[9] */
+	WORD(0x5aa5dd5b), WORD(0x7cf881f0), WORD(0x8acd0512), WORD(0x1933be20),
+	WORD(0xb87b12dc), WORD(0xfc4a883c), WORD(0xfdb6a1bf), WORD(0x2cc76680),
+	WORD(0x1ecbf88e), WORD(0x9e75e660), WORD(0x6826e31a), WORD(0x891acd63),
+	WORD(0x16bf16e1), WORD(0x8b2c59fa), WORD(0xfbd1941f), WORD(0xeb5bdaec),
+	WORD(0x7026a363), WORD(0xc1065e5b), WORD(0xcc88e226), WORD(0x5afcc903),
+	WORD(0x0cd60552), WORD(0x45944130), WORD(0x852d2b1d), WORD(0xacf18749),
+	/* T[10] */
+	WORD(0x9da8c259), WORD(0xe60e7117), WORD(0x2c9f7713), WORD(0x84edfd2c),
+	WORD(0x011b4787), WORD(0xd19d6f6d), WORD(0x634dc557), WORD(0xced9acb4),
+	WORD(0xc1718535), WORD(0xd7c9c60c), WORD(0x19e1ea96), WORD(0xa9c109ee),
+	WORD(0xd9cac0cc), WORD(0x37e74d61), WORD(0x3af0a535), WORD(0xbce53a33),
+	WORD(0x8d86faeb), WORD(0x19377fb1), WORD(0x7c1d22db), WORD(0x1928cff5),
+	WORD(0x863e30e6), WORD(0x9517ef08), WORD(0x681a26ab), WORD(0xe1fc30f4),
+	/* T[11] */
+	WORD(0xa6ab4962), WORD(0xb8d24a67), WORD(0x65e04919), WORD(0x1ff200c8),
+	WORD(0x1274cb59), WORD(0x269af900), WORD(0xe9139b40), WORD(0x9f371978),
+	WORD(0x460fe65b), WORD(0xf29e91fe), WORD(0x21eee281), WORD(0x477fe516),
+	WORD(0x96086b3f), WORD(0xf7dc6de7), WORD(0xae10bf98), WORD(0xae9822c2),
+	WORD(0xee29b155), WORD(0x4b472403), WORD(0x7a6b7701), WORD(0x14da6163),
+	WORD(0xe802fc7f), WORD(0x08d68d27), WORD(0x696cd750), WORD(0xda6c1578),
+	/* T[12] */
+	WORD(0x08a423bf), WORD(0x938f36e5), WORD(0x20342165), WORD(0xfcb8e4f3),
+	WORD(0xe3982f0d), WORD(0xa1d83353), WORD(0xe2a08df4), WORD(0x1d63b6cd),
+	WORD(0xe89a6d54), WORD(0x084a1f88), WORD(0xea7e52db), WORD(0xa34a753f),
+	WORD(0x1334036a), WORD(0x86365803), WORD(0x1bad977d), WORD(0xdd957a19),
+	WORD(0xe563d82f), WORD(0x6a809ca6), WORD(0xedd14008), WORD(0x6f02bd9a),
+	WORD(0xa31bd75a), WORD(0x92a638cb), WORD(0xeeb40505), WORD(0x635722cf),
+	/* T[13] */
+	WORD(0x9f302ba8), WORD(0xdc587f70), WORD(0x5950eab3), WORD(0x877668d7),
+	WORD(0x6c8281ab), WORD(0x979b3b11), WORD(0xa8249b24), WORD(0x5ebb36ad),
+	WORD(0x2d6f0c04), WORD(0x2c82a5d6), WORD(0xa6b6f87b), WORD(0x6d6cd374),
+	WORD(0xea1ddf5d), WORD(0xd185867f), WORD(0x6ff78a68), WORD(0x7dbc6951),
+	WORD(0x64307816), WORD(0xe0de69ef), WORD(0xa3952597), WORD(0xf4c438b9),
+	WORD(0x60e34e05), WORD(0x6df02f5b), WORD(0x6d79b49e), WORD(0x2b87f83e),
+	/* T[14] */
+	WORD(0xa3969d42), WORD(0x69a8488c), WORD(0xaadbc15a), WORD(0x9e8d068a),
+	WORD(0xef9199c4), WORD(0x386ab095), WORD(0x0790437e), WORD(0x5693a445),
+	WORD(0x05803408), WORD(0x6afee6fb), WORD(0x524470ea), WORD(0x2f70934c),
+	WORD(0x5935efd8), WORD(0x0c272bf7), WORD(0xb02cde77), WORD(0xf966b29a),
+	WORD(0x55664489), WORD(0xeff845f0), WORD(0x5f0e5f6f), WORD(0x32a55167),
+	WORD(0x0ab15e81), WORD(0xd2227a93), WORD(0x0ff28d4f), WORD(0xaed026fc),
+	/* T[15] */
+	WORD(0x0251e61e), WORD(0x8105c96e), WORD(0x99e1b0bb), WORD(0xa7d4f18d),
+	WORD(0xdbc8234f), WORD(0x5b71f6f3), WORD(0x01f7d84a), WORD(0x4dc2894f),
+	WORD(0xe6904694), WORD(0xd5132c90), WORD(0x92998242), WORD(0x3c811b82),
+	WORD(0x14477436), WORD(0x8ea5b432), WORD(0x93275167), WORD(0x12b074c7),
+	WORD(0x87437178), WORD(0x24766c9e), WORD(0xffbd43f4), WORD(0x7d983f3e),
+	WORD(0xc3d0b5cf), WORD(0xe7f89de8), WORD(0x55ef9bfc), WORD(0xe9e3ed33),
+	/* T[16] */
+	WORD(0x25d01d41), WORD(0x7908667c), WORD(0x4cfd6b8f), WORD(0x69411f8e),
+	WORD(0xfc961fdf), WORD(0x43942326), WORD(0x8546504a), WORD(0x9253b452),
+	WORD(0x25ce07aa), WORD(0xe9e425d7), WORD(0xd74f0fae), WORD(0xd6f8a528),
+	WORD(0x81cc9e20), WORD(0x7954b297), WORD(0xe1f693b7), WORD(0x34e95e87),
+	WORD(0x88ce81ee), WORD(0xf8e3a63d), WORD(0x87d78ffa), WORD(0x7e31a4ea),
+	WORD(0x40052f93), WORD(0x33fd3b38), WORD(0xe814eb2a), WORD(0x7bfe3517),
+	/* T[17] */
+	WORD(0x30452204), WORD(0x51a2cf1c), WORD(0x621c1c67), WORD(0x891d7d8e),
+	WORD(0x65dff7c2), WORD(0x0af5a9b4), WORD(0x504740a9), WORD(0x82126ca4),
+	WORD(0x3d55ce0b), WORD(0xbfbff154), WORD(0x17eb9702), WORD(0xa6973d02),
+	WORD(0x66f2d88c), WORD(0x157c7716), WORD(0x711dcc22), WORD(0x91251e53),
+	WORD(0xf767c4fe), WORD(0xe34b2b89), WORD(0xb209f221), WORD(0xe1da6567),
+	WORD(0x08bcf91a), WORD(0x9fca502b), WORD(0x32bab6de), WORD(0x0537af67),
+	/* T[18] */
+	WORD(0x93051a22), WORD(0x5bce03d7), WORD(0x285e7b2f), WORD(0x6d1f4420),
+	WORD(0x4fe5fff1), WORD(0xe7360fe0), WORD(0xc1baeffd), WORD(0x9e2efe36),
+	WORD(0x379eda53), WORD(0x3264cbff), WORD(0x3eeae815), WORD(0x9f299dfb),
+	WORD(0x58922605), WORD(0xd73adf1b), WORD(0xd24eaa11), WORD(0x3d75b504),
+	WORD(0xe4861d27), WORD(0x4e7a8554), WORD(0x9deee5da), WORD(0x3316f3b6),
+	WORD(0xe9f520a6), WORD(0xe617d61e), WORD(0x9ca3d737), WORD(0x7db56b98),
+	/* T[19] */
+	WORD(0xcca6a5a4), WORD(0xf6cf2294), WORD(0xf6170c50), WORD(0xdd76f41f),
+	WORD(0x643b19b3), WORD(0x94f12ea3), WORD(0x9e15a617), WORD(0x8c2b04fe),
+	WORD(0x9ca0fc93), WORD(0x54314f07), WORD(0xad704f9b), WORD(0x8842f943),
+	WORD(0x42fcfff0), WORD(0x25f9557f), WORD(0xb38f0aba), WORD(0xed5ad97f),
+	WORD(0x15deadf4), WORD(0xfb5fdf69), WORD(0xef9d3ee2), WORD(0xa4006524),
+	WORD(0xf6ca4ce6), WORD(0xf313601e), WORD(0x8225d2ee), WORD(0xfb5ea4f8),
+	/* T[20] */
+	WORD(0x07b0b0b4), WORD(0xa39c15e8), WORD(0xa8703d41), WORD(0x104b7e40),
+	WORD(0xa3dbb5f9), WORD(0x031b04db), WORD(0x8990e720), WORD(0x8ded2ee7),
+	WORD(0xc6727dbf), WORD(0x3b99cda3), WORD(0x79f18898), WORD(0x28b7443e),
+	WORD(0xfa79a32c), WORD(0x0256ebf5), WORD(0x62416757), WORD(0x299c19c3),
+	WORD(0x57c966c1), WORD(0xfb097011), WORD(0x33c1f11b), WORD(0xfb25fd27),
+	WORD(0x9026fe1c), WORD(0xe6ca9888), WORD(0xdad33921), WORD(0x54fa967a),
+	/* T[21] */
+	WORD(0x0f561ecf), WORD(0x33d2f8b1), WORD(0xee33557e), WORD(0x7236b37c),
+	WORD(0xe998dfe9), WORD(0x7421bc7d), WORD(0xc5d95af5), WORD(0xa48264fe),
+	WORD(0x604ba943), WORD(0x644c01ff), WORD(0xec50a0d6), WORD(0x8a27b018),
+	WORD(0xd26f0af3), WORD(0x92fd9ff3), WORD(0xa2436b74), WORD(0xe67fc269),
+	WORD(0x4813bfae), WORD(0x0e4c0ec0), WORD(0x97ced818), WORD(0x16aa7b11),
+	WORD(0xe91e43df), WORD(0x8c7dc826), WORD(0x4b5025fe), WORD(0x2054ef3c),
+	/* T[22] */
+	WORD(0x65c8e083), WORD(0xb60dff39), WORD(0xbb0fb9f0), WORD(0xae786f2a),
+	WORD(0x1fbb102c), WORD(0x830a811a), WORD(0x94c157bf), WORD(0xb995e02a),
+	WORD(0x53a6e0dc), WORD(0x7d07efdb), WORD(0x66d6337b), WORD(0x5f0e8ea4),
+	WORD(0x3c3e5029), WORD(0x34068a0d), WORD(0x578e7bed), WORD(0xade83d00),
+	WORD(0xf7e1c602), WORD(0x792352f7), WORD(0x15f70b7a), WORD(0x60376122),
+	WORD(0xc8d8321e), WORD(0xa7765869), WORD(0x76273993), WORD(0x708c30ea),
+	/* T[23] */
+	WORD(0x74bed419), WORD(0xa9277516), WORD(0x7cdf3a12), WORD(0xa17787ab),
+	WORD(0x38fc2dd1), WORD(0xe0f4df8a), WORD(0x92536409), WORD(0x943be2df),
+	WORD(0x9c11a97b), WORD(0x509481d8), WORD(0x435e0a97), WORD(0x6541f6fa),
+	WORD(0xf8b29896), WORD(0x163037c4), WORD(0x44a6aa79), WORD(0x1c442920),
+	WORD(0xb4050fe1), WORD(0xa0eb36d4), WORD(0x82f86ed2), WORD(0x6cb75ca2),
+	WORD(0xe5187712), WORD(0x749bafd2), WORD(0x4b529eae), WORD(0xe34a649a),
+	/* T[24] */
+	WORD(0x66675fe6), WORD(0xb287fb3e), WORD(0xc2500136), WORD(0x5268b35b),
+	WORD(0x129d9918), WORD(0xa1fa9f68), WORD(0x3df9c68c), WORD(0x2214d0f2),
+	WORD(0x758cb1d9), WORD(0x758e39be), WORD(0xe6d05162), WORD(0x8ad4a9d5),
+	WORD(0x68a7ed0f), WORD(0x274acb90), WORD(0xbfa08c37), WORD(0x29d670fa),
+	WORD(0x1d02e2ab), WORD(0xfd640d77), WORD(0x1f35d751), WORD(0x1cd2a737),
+	WORD(0xafee1c9b), WORD(0x0224ec71), WORD(0xfe56e7b7), WORD(0xb5d19ccd),
+	/* T[25] */
+	WORD(0xa144bd76), WORD(0x00648445), WORD(0x2610725f), WORD(0x3c8fa5ac),
+	WORD(0xde536f63), WORD(0x69c0b503), WORD(0x4869ad12), WORD(0x0cbdf5dc),
+	WORD(0xdf042d7e), WORD(0x5130a47c), WORD(0xba20e3bc), WORD(0xa01ab51a),
+	WORD(0x80c63e3b), WORD(0xafafe10f), WORD(0x2f520fba), WORD(0xef7bfda6),
+	WORD(0x5f86f5fe), WORD(0x55c639c2), WORD(0xa6e5c47e), WORD(0xdb5bc6a9),
+	WORD(0x729722a5), WORD(0xa4447085), WORD(0xe682929d), WORD(0x52edefd8),
+	/* T[26] */
+	WORD(0x84907295), WORD(0x4ad482d3), WORD(0x6f4b7080), WORD(0x282ebc1e),
+	WORD(0xf71087a0), WORD(0x0e1f4647), WORD(0x0209d1fa), WORD(0x8423478d),
+	WORD(0xf6e1f18d), WORD(0x9c893dd5), WORD(0x3ad9517d), WORD(0xc811aa8b),
+	WORD(0xd75e022d), WORD(0xbc4debdf), WORD(0xd2004c7d), WORD(0x8bfdf91b),
+	WORD(0xcaf04a4d), WORD(0x78376180), WORD(0xe7325e5d), WORD(0xb7276e59),
+	WORD(0x562d922e), WORD(0x84894802), WORD(0xc6c9c0a6), WORD(0xc955ac20),
+	/* T[27] */
+	WORD(0x1f33158b), WORD(0xc32d7a99), WORD(0xd36b7f65), WORD(0xf5846ea8),
+	WORD(0xb95d29f2), WORD(0xf2f8be04), WORD(0x2b6f816a), WORD(0x0db23a43),
+	WORD(0xcf74cf1d), WORD(0x9a58683c), WORD(0xadeaa37c), WORD(0xa6550eb2),
+	WORD(0x47057b02), WORD(0x42b3fba4), WORD(0xf7499483), WORD(0x24615327),
+	WORD(0x31ee6f85), WORD(0xea6327fd), WORD(0x7a321a32), WORD(0x2671ac30),
+	WORD(0x48ae8c0a), WORD(0xae670b73), WORD(0x996a2086), WORD(0x82830301),
+	/* T[28] */
+	WORD(0x1be45fc3), WORD(0x422685d5), WORD(0x1a1a87c1), WORD(0x8415f9ff),
+	WORD(0x53cf8d84), WORD(0x0e167106), WORD(0xc09ea8f4), WORD(0x8c8cc1f0),
+	WORD(0x562293f1), WORD(0x120bab6e), WORD(0xfcfbdac8), WORD(0x5cf0f9d0),
+	WORD(0xb83dccaf), WORD(0x106fa677), WORD(0xd6669c00), WORD(0x4e1cef47),
+	WORD(0x9984a268), WORD(0xabf2a56b), WORD(0xa786fc40), WORD(0xb553702c),
+	WORD(0x4954c3d6), WORD(0x5f4afc82), WORD(0xbb5f687c), WORD(0xb299e4c0),
+	/* T[29] */
+	WORD(0x54ee243e), WORD(0x8803deb7), WORD(0xacca49ec), WORD(0x2e0659c0),
+	WORD(0x05bc7758), WORD(0xf97bdac6), WORD(0x2758bd5b), WORD(0x5416f592),
+	WORD(0x21c47cbf), WORD(0x652d534c), WORD(0x75aa28d4), WORD(0x50e9836a),
+	WORD(0xb670bf38), WORD(0xed57ddea), WORD(0x13030c71), WORD(0xcde89872),
+	WORD(0x5885616d), WORD(0xc74e5e3b), WORD(0x346c147b), WORD(0x108d27ac),
+	WORD(0x3ffef917), WORD(0x00293bd8), WORD(0x87a8d078), WORD(0x8224da88),
+	/* T[30] */
+	WORD(0x1fdb21dc), WORD(0x4791b9a5), WORD(0x5df38cf0), WORD(0x200762a0),
+	WORD(0x51ed8460), WORD(0x23c6a20f), WORD(0x2b1f5787), WORD(0x7d01ae58),
+	WORD(0xa017b5e5), WORD(0xc73c4028), WORD(0xf177ddd6), WORD(0xd8d23762),
+	WORD(0x6502f03c), WORD(0x2ca3f05f), WORD(0x766f96db), WORD(0x30193017),
+	WORD(0x56c9a093), WORD(0x5013d7dc), WORD(0xbba1744a), WORD(0xe0a40bee),
+	WORD(0x978826e6), WORD(0xdaef1be8), WORD(0x2d199cec), WORD(0x54f8acbb),
+	/* T[31] */
+	WORD(0x1c718580), WORD(0x1ae0c4e1), WORD(0xbf99a0bf), WORD(0x303f48a6),
+	WORD(0x91ae219f), WORD(0xa5551e44), WORD(0x55a05287), WORD(0xdc41d9bd),
+	WORD(0x6872b123), WORD(0xd5aa73e3), WORD(0xe6395bf6), WORD(0x6fd94b0c),
+	WORD(0xc00afbc1), WORD(0xbb95fdba), WORD(0x497cac10), WORD(0x9cd96208),
+	WORD(0xca51afea), WORD(0x8adbd8c1), WORD(0xf3bc5f5f), WORD(0x94fedafb),
+	WORD(0xdf9f5371), WORD(0x29c0217b), WORD(0xd9024634), WORD(0x5c13eb4b),
+};
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+static const word_t secp384r1_gen_comb[] = {
+	/* T[0] */
+	WORD(0x30a1), WORD(0xaeb3), WORD(0x3023), WORD(0x80f1), WORD(0x5404), WORD(0x5a9b),
+	WORD(0x4879), WORD(0x778b), WORD(0xa6e1), WORD(0x0e7e), WORD(0x0c75), WORD(0xd4a8),
+	WORD(0x3f7a), WORD(0xca60), WORD(0x4da6), WORD(0x5a92), WORD(0x2676), WORD(0xf192),
+	WORD(0xa4f7), WORD(0x3229), WORD(0x1a8a), WORD(0x23fb), WORD(0x2b48), WORD(0x197c),
+	WORD(0x46fd), WORD(0x9d65), WORD(0xeabe), WORD(0xe33b), WORD(0x4595), WORD(0xf63b),
+	WORD(0xf776), WORD(0x40c1), WORD(0x5e6a), WORD(0xbda8), WORD(0x2764), WORD(0x3a75),
+	WORD(0x49c7), WORD(0x00ce), WORD(0xb63a), WORD(0x2738), WORD(0x403a), WORD(0x6006),
+	WORD(0xf2b1), WORD(0x7fb9), WORD(0x80e4), WORD(0x30e8), WORD(0xe55a), WORD(0xc807),
+	/* T[1] */
+	WORD(0x032c), WORD(0x850e), WORD(0x2de2), WORD(0x9b8c), WORD(0xa08b), WORD(0x5e53),
+	WORD(0xdf5a), WORD(0x1623), WORD(0xc953), WORD(0xd959), WORD(0x0560), WORD(0x5e75),
+	WORD(0x18ba), WORD(0x40b4), WORD(0x1e22), WORD(0x7602), WORD(0xfdfd), WORD(0x15d4),
+	WORD(0x434f), WORD(0x5689), WORD(0x55ed), WORD(0xb1f1), WORD(0xd6c9), WORD(0xde66),
+	WORD(0x666d), WORD(0x4c08), WORD(0xb7c7), WORD(0xdb7a), WORD(0x6905), WORD(0xdb3e),
+	WORD(0xb19e), WORD(0x0beb), WORD(0x628f), WORD(0x21d8), WORD(0xbd54), WORD(0xc5e6),
+	WORD(0xf685), WORD(0x433e), WORD(0x9d11), WORD(0x846f), WORD(0x8623), WORD(0xdbf2),
+	WORD(0xc74c), WORD(0x7aeb), WORD(0x296e), WORD(0x397a), WORD(0x11fc), WORD(0xe64c),
+	/* T[2] */
+	WORD(0x5b88), WORD(0x54c8), WORD(0x458d), WORD(0x072f), WORD(0xe269), WORD(0x62e7),
+	WORD(0x3c1f), WORD(0xc9fc), WORD(0xdf04), WORD(0xdb96), WORD(0x04fb), WORD(0x90f8),
+	WORD(0xc9f6), WORD(0x88b9), WORD(0x98d9), WORD(0xcef0), WORD(0xe62d), WORD(0x8587),
+	WORD(0x0e57), WORD(0xf3e4), WORD(0x44ef), WORD(0xdbb0), WORD(0x48ec), WORD(0xde01),
+	WORD(0x1c76), WORD(0xab21), WORD(0xad03), WORD(0x96cb), WORD(0x82ef), WORD(0xbdcd),
+	WORD(0x8b7a), WORD(0x79af), WORD(0x7f10), WORD(0x7415), WORD(0xa6d4), WORD(0x646b),
+	WORD(0xe061), WORD(0x6219), WORD(0xfe66), WORD(0x1823), WORD(0x7b55), WORD(0x95d9),
+	WORD(0x8931), WORD(0xb43a), WORD(0xd89e), WORD(0x5f4e), WORD(0xd0a7), WORD(0x0020),
+	/* T[3] */
+	WORD(0x9327), WORD(0xb5df), WORD(0xa9bd), WORD(0x50f1), WORD(0x0ca6), WORD(0x9a66),
+	WORD(0xe460), WORD(0x9591), WORD(0x4c70), WORD(0x0d53), WORD(0x2665), WORD(0x194b),
+	WORD(0x542e), WORD(0x19bd), WORD(0xe678), WORD(0xe53a), WORD(0xc2fb), WORD(0xe200),
+	WORD(0x840f), WORD(0x5983), WORD(0x7ff8), WORD(0xc9be), WORD(0x838a), WORD(0x3c98),
+	WORD(0xd8cf), WORD(0xb389), WORD(0x6d5c), WORD(0x6349), WORD(0xbf13), WORD(0x6653),
+	WORD(0x5362), WORD(0x365f), WORD(0x63dd), WORD(0xee06), WORD(0x01c8), WORD(0x1b2d),
+	WORD(0xfa89), WORD(0x570b), WORD(0xcbca), WORD(0xfe99), WORD(0xd899), WORD(0x718a),
+	WORD(0x9880), WORD(0x042f), WORD(0xc463), WORD(0xf7f3), WORD(0x2170), WORD(0x7160),
+	/* T[4] */
+	WORD(0x6fee), WORD(0x9ea5), WORD(0x0269), WORD(0x0af3), WORD(0x049f), WORD(0x5c06),
+	WORD(0xb89a), WORD(0x9722), WORD(0xa4a2), WORD(0xcff9), WORD(0xe92c), WORD(0x7ae5),
+	WORD(0x91ad), WORD(0xa7f9), WORD(0x8052), WORD(0xa413), WORD(0x3851), WORD(0xc90c),
+	WORD(0xc593), WORD(0xe05f), WORD(0xaffe), WORD(0xd9a3), WORD(0xe5f2), WORD(0x2a90),
+	WORD(0x9cc3), WORD(0x0719), WORD(0xdcc4), WORD(0xc306), WORD(0xb49f), WORD(0xdc22),
+	WORD(0xcf10), WORD(0x1709), WORD(0xe01e), WORD(0x920d), WORD(0xc12b), WORD(0xaf69),
+	WORD(0x66de), WORD(0x6d37), WORD(0xb1c0), WORD(0x5325), WORD(0x1687), WORD(0xee82),
+	WORD(0x3ab2), WORD(0x1920), WORD(0x54b1), WORD(0x2d0a), WORD(0xd81b), WORD(0x25b9),
+	/* T[5] */
+	WORD(0x6c0a), WORD(0xa281), WORD(0x5645), WORD(0xfd6d), WORD(0x804e), WORD(0x3492),
+	WORD(0x3f3a), WORD(0xc5ea), WORD(0x72c3), WORD(0xa86e), WORD(0xeee1), WORD(0x8b65),
+	WORD(0x971f), WORD(0xc935), WORD(0x1ca5), WORD(0x4a51), WORD(0x5841), WORD(0x96a1),
+	WORD(0xb948), WORD(0x5a02), WORD(0x3650), WORD(0x2b21), WORD(0x6001), WORD(0x70d7),
+	WORD(0xf748), WORD(0x9acc), WORD(0xb288), WORD(0x905f), WORD(0x9e63), WORD(0xf2c1),
+	WORD(0xbdb9), WORD(0x25e7), WORD(0x91ca), WORD(0x7e8d), WORD(0xc8af), WORD(0x2364),
+	WORD(0x4617), WORD(0xa9d7), WORD(0x79b7), WORD(0x1931), WORD(0xd5d9), WORD(0xb2e3),
+	WORD(0x5874), WORD(0xd504), WORD(0xc387), WORD(0xe162), WORD(0x29dd), WORD(0xda8d),
+	/* T[6] */
+	WORD(0x9843), WORD(0xb240), WORD(0xd909), WORD(0xe620), WORD(0x5a86), WORD(0x0337),
+	WORD(0x811d), WORD(0xaf96), WORD(0x6938), WORD(0x4938), WORD(0x3927), WORD(0xedda),
+	WORD(0x3c5a), WORD(0xd8f0), WORD(0x6c0f), WORD(0x8cc2), WORD(0xab19), WORD(0x2d02),
+	WORD(0x0282), WORD(0x6b4e), WORD(0xd02f), WORD(0x30f7), WORD(0xb700), WORD(0xcf7b),
+	WORD(0xddc6), WORD(0x8cc8), WORD(0x784f), WORD(0x7f28), WORD(0xdb8a), WORD(0xba04),
+	WORD(0xa555), WORD(0xf154), WORD(0x8096), WORD(0xd7c3), WORD(0x1190), WORD(0x37af),
+	WORD(0x5c1f), WORD(0x7b9c), WORD(0x8f34), WORD(0x3fdd), WORD(0xf480), WORD(0xe50b),
+	WORD(0xaf22), WORD(0x6f8e), WORD(0xdd51), WORD(0x3268), WORD(0x79be), WORD(0x2c0c),
+	/* T[7] */
+	WORD(0xeaf6), WORD(0xcd2c), WORD(0x3242), WORD(0x2319), WORD(0x67d6), WORD(0x53da),
+	WORD(0xaa1e), WORD(0x2b37), WORD(0xfda9), WORD(0x4bb5), WORD(0x5d79), WORD(0x7f77),
+	WORD(0xc628), WORD(0xb6c2), WORD(0x58e3), WORD(0xe716), WORD(0x62c4), WORD(0xbf87),
+	WORD(0xf6e3), WORD(0xe84e), WORD(0xd2ed), WORD(0xfe78), WORD(0x6c51), WORD(0xd91a),
+	WORD(0xe3ac), WORD(0x3a92), WORD(0x96c0), WORD(0x2bb2), WORD(0x712a), WORD(0x4c58),
+	WORD(0x4904), WORD(0xa550), WORD(0x78b1), WORD(0x50a5), WORD(0xff82), WORD(0xb760),
+	WORD(0x6d4c), WORD(0x3c1a), WORD(0xbe45), WORD(0x8588), WORD(0xef58), WORD(0x6982),
+	WORD(0xce29), WORD(0xa885), WORD(0x606c), WORD(0x2a54), WORD(0x534c), WORD(0x9a00),
+	/* T[8] */
+	WORD(0x9795), WORD(0x0269), WORD(0x3597), WORD(0xaec1), WORD(0x1b27), WORD(0x1fc1),
+	WORD(0x3402), WORD(0x0a36), WORD(0x4c81), WORD(0x9a29), WORD(0xd5bf), WORD(0xfe8b),
+	WORD(0xc28b), WORD(0x4afe), WORD(0x2fa1), WORD(0x2eef), WORD(0xb7ee), WORD(0x9260),
+	WORD(0x3837), WORD(0x04be), WORD(0x7e5c), WORD(0x4cac), WORD(0x768f), WORD(0x7358),
+	WORD(0x6944), WORD(0x8084), WORD(0x4526), WORD(0xc1c5), WORD(0xfea7), WORD(0x52cc),
+	WORD(0x6416), WORD(0x1a3c), WORD(0x2d59), WORD(0x7739), WORD(0x8b0b), WORD(0xaa3b),
+	WORD(0xa2fb), WORD(0xe007), WORD(0x32a0), WORD(0xbd80), WORD(0xf1c8), WORD(0x6f0d),
+	WORD(0x3d6c), WORD(0xf1a7), WORD(0x7036), WORD(0xf099), WORD(0x21cf), WORD(0xd865),
+	/* T[9] */
+	WORD(0xdd5b), WORD(0x5aa5), WORD(0x81f0), WORD(0x7cf8), WORD(0x0512), WORD(0x8acd),
+	WORD(0xbe20), WORD(0x1933), WORD(0x12dc), WORD(0xb87b), WORD(0x883c), WORD(0xfc4a),
+	WORD(0xa1bf), WORD(0xfdb6), WORD(0x6680), WORD(0x2cc7), WORD(0xf88e), WORD(0x1ecb),
+	WORD(0xe660), WORD(0x9e75), WORD(0xe31a), WORD(0x6826), WORD(0xcd63), WORD(0x891a),
+	WORD(0x16e1), WORD(0x16bf), WORD(0x59fa), WORD(0x8b2c), WORD(0x941f), WORD(0xfbd1),
+	WORD(0xdaec), WORD(0xeb5b), WORD(0xa363), WORD(0x7026), WORD(0x5e5b), WORD(0xc106),
+	WORD(0xe226), WORD(0xcc88), WORD(0xc903), WORD(0x5afc), WORD(0x0552), WORD(0x0cd6),
+	WORD(0x4130), WORD(0x4594), WORD(0x2b1d), WORD(0x852d), WORD(0x8749), WORD(0xacf1),
+	/* T[10] */
+	WORD(0xc259), WORD(0x9da8), WORD(0x7117), WORD(0xe60e), WORD(0x7713), WORD(0x2c9f),
+	WORD(0xfd2c), WORD(0x84ed), WORD(0x4787), WORD(0x011b), WORD(0x6f6d), WORD(0xd19d),
+	WORD(0xc557), WORD(0x634d), WORD(0xacb4), WORD(0xced9), WORD(0x8535), WORD(0xc171),
+	WORD(0xc60c), WORD(0xd7c9), WORD(0xea96), WORD(0x19e1), WORD(0x09ee), WORD(0xa9c1),
+	WORD(0xc0cc), WORD(0xd9ca), WORD(0x4d61), WORD(0x37e7), WORD(0xa535), WORD(0x3af0),
+	WORD(0x3a33), WORD(0xbce5), WORD(0xfaeb), WORD(0x8d86), WORD(0x7fb1), WORD(0x1937),
+	WORD(0x22db), WORD(0x7c1d), WORD(0xcff5), WORD(0x1928), WORD(0x30e6), WORD(0x863e),
+	WORD(0xef08), WORD(0x9517), WORD(0x26ab), WORD(0x681a), WORD(0x30f4), WORD(0xe1fc),
+	/* T[11] */
+	WORD(0x4962), WORD(0xa6ab), WORD(0x4a67), WORD(0xb8d2), WORD(0x4919), WORD(0x65e0),
+	WORD(0x00c8), WORD(0x1ff2), WORD(0xcb59), WORD(0x1274), WORD(0xf900), WORD(0x269a),
+	WORD(0x9b40), WORD(0xe913), WORD(0x1978), WORD(0x9f37), WORD(0xe65b), WORD(0x460f),
+	WORD(0x91fe), WORD(0xf29e), WORD(0xe281), WORD(0x21ee), WORD(0xe516), WORD(0x477f),
+	WORD(0x6b3f), WORD(0x9608), WORD(0x6de7), WORD(0xf7dc), WORD(0xbf98), WORD(0xae10),
+	WORD(0x22c2), WORD(0xae98), WORD(0xb155), WORD(0xee29), WORD(0x2403), WORD(0x4b47),
+	WORD(0x7701), WORD(0x7a6b), WORD(0x6163), WORD(0x14da), WORD(0xfc7f), WORD(0xe802),
+	WORD(0x8d27), WORD(0x08d6), WORD(0xd750), WORD(0x696c), WORD(0x1578), WORD(0xda6c),
+	/* T[12] */
+	WORD(0x23bf), WORD(0x08a4), WORD(0x36e5), WORD(0x938f), WORD(0x2165), WORD(0x2034),
+	WORD(0xe4f3), WORD(0xfcb8), WORD(0x2f0d), WORD(0xe398), WORD(0x3353), WORD(0xa1d8),
+	WORD(0x8df4), WORD(0xe2a0), WORD(0xb6cd), WORD(0x1d63), WORD(0x6d54), WORD(0xe89a),
+	WORD(0x1f88), WORD(0x084a), WORD(0x52db), WORD(0xea7e), WORD(0x753f), WORD(0xa34a),
+	WORD(0x036a), WORD(0x1334), WORD(0x5803), WORD(0x8636), WORD(0x977d), WORD(0x1bad),
+	WORD(0x7a19), WORD(0xdd95), WORD(0xd82f), WORD(0xe563), WORD(0x9ca6), WORD(0x6a80),
+	WORD(0x4008), WORD(0xedd1), WORD(0xbd9a), WORD(0x6f02), WORD(0xd75a), WORD(0xa31b),
+	WORD(0x38cb), WORD(0x92a6), WORD(0x0505), WORD(0xeeb4), WORD(0x22cf), WORD(0x6357),
+	/* T[13] */
+	WORD(0x2ba8), WORD(0x9f30), WORD(0x7f70), WORD(0xdc58), WORD(0xeab3), WORD(0x5950),
+	WORD(0x68d7), WORD(0x8776), WORD(0x81ab), WORD(0x6c82), WORD(0x3b11), WORD(0x979b),
+	WORD(0x9b24), WORD(0xa824), WORD(0x36ad), WORD(0x5ebb), WORD(0x0c04), WORD(0x2d6f),
+	WORD(0xa5d6), WORD(0x2c82), WORD(0xf87b), WORD(0xa6b6), WORD(0xd374), WORD(0x6d6c),
+	WORD(0xdf5d), WORD(0xea1d), WORD(0x867f), WORD(0xd185), WORD(0x8a68), WORD(0x6ff7),
+	WORD(0x6951), WORD(0x7dbc), WORD(0x7816), WORD(0x6430), WORD(0x69ef), WORD(0xe0de),
+	WORD(0x2597), WORD(0xa395), WORD(0x38b9), WORD(0xf4c4), WORD(0x4e05), WORD(0x60e3),
+	WORD(0x2f5b), WORD(0x6df0), WORD(0xb49e), WORD(0x6d79), WORD(0xf83e), WORD(0x2b87),
+	/* T[14] */
+	WORD(0x9d42), WORD(0xa396), WORD(0x488c), WORD(0x69a8), WORD(0xc15a), WORD(0xaadb),
+	WORD(0x068a), WORD(0x9e8d), WORD(0x99c4), WORD(0xef91), WORD(0xb095), WORD(0x386a),
+	WORD(0x437e), WORD(0x0790), WORD(0xa445), WORD(0x5693), WORD(0x3408), WORD(0x0580),
+	WORD(0xe6fb), WORD(0x6afe), WORD(0x70ea), WORD(0x5244), WORD(0x934c), WORD(0x2f70),
+	WORD(0xefd8), WORD(0x5935), WORD(0x2bf7), WORD(0x0c27), WORD(0xde77), WORD(0xb02c),
+	WORD(0xb29a), WORD(0xf966), WORD(0x4489), WORD(0x5566), WORD(0x45f0), WORD(0xeff8),
+	WORD(0x5f6f), WORD(0x5f0e), WORD(0x5167), WORD(0x32a5), WORD(0x5e81), WORD(0x0ab1),
+	WORD(0x7a93), WORD(0xd222), WORD(0x8d4f), WORD(0x0ff2), WORD(0x26fc), WORD(0xaed0),
+	/* T[15] */
+	WORD(0xe61e), WORD(0x0251), WORD(0xc96e), WORD(0x8105), WORD(0xb0bb), WORD(0x99e1),
+	WORD(0xf18d), WORD(0xa7d4), WORD(0x234f), WORD(0xdbc8), WORD(0xf6f3), WORD(0x5b71),
+	WORD(0xd84a), WORD(0x01f7), WORD(0x894f), WORD(0x4dc2), WORD(0x4694), WORD(0xe690),
+	WORD(0x2c90), WORD(0xd513), WORD(0x8242), WORD(0x9299), WORD(0x1b82), WORD(0x3c81),
+	WORD(0x7436), WORD(0x1447), WORD(0xb432), WORD(0x8ea5), WORD(0x5167), WORD(0x9327),
+	WORD(0x74c7), WORD(0x12b0), WORD(0x7178), WORD(0x8743), WORD(0x6c9e), WORD(0x2476),
+	WORD(0x43f4), WORD(0xffbd), WORD(0x3f3e), WORD(0x7d98), WORD(0xb5cf), WORD(0xc3d0),
+	WORD(0x9de8), WORD(0xe7f8), WORD(0x9bfc), WORD(0x55ef), WORD(0xed33), WORD(0xe9e3),
+	/* T[16] */
+	WORD(0x1d41), WORD(0x25d0), WORD(0x667c), WORD(0x7908), WORD(0x6b8f), WORD(0x4cfd),
+	WORD(0x1f8e), WORD(0x6941), WORD(0x1fdf), WORD(0xfc96), WORD(0x2326), WORD(0x4394),
+	WORD(0x504a), WORD(0x8546), WORD(0xb452), WORD(0x9253), WORD(0x07aa), WORD(0x25ce),
+	WORD(0x25d7), WORD(0xe9e4), WORD(0x0fae), WORD(0xd74f), WORD(0xa528), WORD(0xd6f8),
+	WORD(0x9e20), WORD(0x81cc), WORD(0xb297), WORD(0x7954), WORD(0x93b7), WORD(0xe1f6),
+	WORD(0x5e87), WORD(0x34e9), WORD(0x81ee), WORD(0x88ce), WORD(0xa63d), WORD(0xf8e3),
+	WORD(0x8ffa), WORD(0x87d7), WORD(0xa4ea), WORD(0x7e31), WORD(0x2f93), WORD(0x4005),
+	WORD(0x3b38), WORD(0x33fd), WORD(0xeb2a), WORD(0xe814), WORD(0x3517), WORD(0x7bfe),
+	/* T[17] */
+	WORD(0x2204), WORD(0x3045), WORD(0xcf1c), WORD(0x51a2), WORD(0x1c67), WORD(0x621c),
+	WORD(0x7d8e), WORD(0x891d), WORD(0xf7c2), WORD(0x65df), WORD(0xa9b4), WORD(0x0af5),
+	WORD(0x40a9), WORD(0x5047), WORD(0x6ca4), WORD(0x8212), WORD(0xce0b), WORD(0x3d55),
+	WORD(0xf154), WORD(0xbfbf), WORD(0x9702), WORD(0x17eb), WORD(0x3d02), WORD(0xa697),
+	WORD(0xd88c), WORD(0x66f2), WORD(0x7716), WORD(0x157c), WORD(0xcc22), WORD(0x711d),
+	WORD(0x1e53), WORD(0x9125), WORD(0xc4fe), WORD(0xf767), WORD(0x2b89), WORD(0xe34b),
+	WORD(0xf221), WORD(0xb209), WORD(0x6567), WORD(0xe1da), WORD(0xf91a), WORD(0x08bc),
+	WORD(0x502b), WORD(0x9fca), WORD(0xb6de), WORD(0x32ba), WORD(0xaf67), WORD(0x0537),
+	/* T[18] */
+	WORD(0x1a22), WORD(0x9305), WORD(0x03d7), WORD(0x5bce), WORD(0x7b2f), WORD(0x285e),
+	WORD(0x4420), WORD(0x6d1f), WORD(0xfff1), WORD(0x4fe5), WORD(0x0fe0), WORD(0xe736),
+	WORD(0xeffd), WORD(0xc1ba), WORD(0xfe36), WORD(0x9e2e), WORD(0xda53), WORD(0x379e),
+	WORD(0xcbff), WORD(0x3264), WORD(0xe815), WORD(0x3eea), WORD(0x9dfb), WORD(0x9f29),
+	WORD(0x2605), WORD(0x5892), WORD(0xdf1b), WORD(0xd73a), WORD(0xaa11), WORD(0xd24e),
+	WORD(0xb504), WORD(0x3d75), WORD(0x1d27), WORD(0xe486), WORD(0x8554), WORD(0x4e7a),
+	WORD(0xe5da), WORD(0x9dee), WORD(0xf3b6), WORD(0x3316), WORD(0x20a6), WORD(0xe9f5),
+	WORD(0xd61e), WORD(0xe617), WORD(0xd737), WORD(0x9ca3), WORD(0x6b98), WORD(0x7db5),
+	/* T[19] */
+	WORD(0xa5a4), WORD(0xcca6), WORD(0x2294), WORD(0xf6cf), WORD(0x0c50), WORD(0xf617),
+	WORD(0xf41f), WORD(0xdd76), WORD(0x19b3), WORD(0x643b), WORD(0x2ea3), WORD(0x94f1),
+	WORD(0xa617), WORD(0x9e15), WORD(0x04fe), WORD(0x8c2b), WORD(0xfc93), WORD(0x9ca0),
+	WORD(0x4f07), WORD(0x5431), WORD(0x4f9b), WORD(0xad70), WORD(0xf943), WORD(0x8842),
+	WORD(0xfff0), WORD(0x42fc), WORD(0x557f), WORD(0x25f9), WORD(0x0aba), WORD(0xb38f),
+	WORD(0xd97f), WORD(0xed5a), WORD(0xadf4), WORD(0x15de), WORD(0xdf69), WORD(0xfb5f),
+	WORD(0x3ee2), WORD(0xef9d), WORD(0x6524), WORD(0xa400), WORD(0x4ce6), WORD(0xf6ca),
+	WORD(0x601e), WORD(0xf313), WORD(0xd2ee), WORD(0x8225), WORD(0xa4f8), WORD(0xfb5e),
+	/* T[20] */
+	WORD(0xb0b4), WORD(0x07b0), WORD(0x15e8), WORD(0xa39c), WORD(0x3d41), WORD(0xa870),
+	WORD(0x7e40), WORD(0x104b), WORD(0xb5f9), WORD(0xa3db), WORD(0x04db), WORD(0x031b),
+	WORD(0xe720), WORD(0x8990), WORD(0x2ee7), WORD(0x8ded), WORD(0x7dbf), WORD(0xc672),
+	WORD(0xcda3), WORD(0x3b99), WORD(0x8898), WORD(0x79f1), WORD(0x443e), WORD(0x28b7),
+	WORD(0xa32c), WORD(0xfa79), WORD(0xebf5), WORD(0x0256), WORD(0x6757), WORD(0x6241),
+	WORD(0x19c3), WORD(0x299c), WORD(0x66c1), WORD(0x57c9), WORD(0x7011), WORD(0xfb09),
+	WORD(0xf11b), WORD(0x33c1), WORD(0xfd27), WORD(0xfb25), WORD(0xfe1c), WORD(0x9026),
+	WORD(0x9888), WORD(0xe6ca), WORD(0x3921), WORD(0xdad3), WORD(0x967a), WORD(0x54fa),
+	/* T[21] */
+	WORD(0x1ecf), WORD(0x0f56), WORD(0xf8b1), WORD(0x33d2), WORD(0x557e), WORD(0xee33),
+	WORD(0xb37c), WORD(0x7236), WORD(0xdfe9), WORD(0xe998), WORD(0xbc7d), WORD(0x7421),
+	WORD(0x5af5), WORD(0xc5d9), WORD(0x64fe), WORD(0xa482), WORD(0xa943), WORD(0x604b),
+	WORD(0x01ff), WORD(0x644c), WORD(0xa0d6), WORD(0xec50), WORD(0xb018), WORD(0x8a27),
+	WORD(0x0af3), WORD(0xd26f), WORD(0x9ff3), WORD(0x92fd), WORD(0x6b74), WORD(0xa243),
+	WORD(0xc269), WORD(0xe67f), WORD(0xbfae), WORD(0x4813), WORD(0x0ec0), WORD(0x0e4c),
+	WORD(0xd818), WORD(0x97ce), WORD(0x7b11), WORD(0x16aa), WORD(0x43df), WORD(0xe91e),
+	WORD(0xc826), WORD(0x8c7d), WORD(0x25fe), WORD(0x4b50), WORD(0xef3c), WORD(0x2054),
+	/* T[22] */
+	WORD(0xe083), WORD(0x65c8), WORD(0xff39), WORD(0xb60d), WORD(0xb9f0), WORD(0xbb0f),
+	WORD(0x6f2a), WORD(0xae78), WORD(0x102c), WORD(0x1fbb), WORD(0x811a), WORD(0x830a),
+	WORD(0x57bf), WORD(0x94c1), WORD(0xe02a), WORD(0xb995), WORD(0xe0dc), WORD(0x53a6),
+	WORD(0xefdb), WORD(0x7d07), WORD(0x337b), WORD(0x66d6), WORD(0x8ea4), WORD(0x5f0e),
+	WORD(0x5029), WORD(0x3c3e), WORD(0x8a0d), WORD(0x3406), WORD(0x7bed), WORD(0x578e),
+	WORD(0x3d00), WORD(0xade8), WORD(0xc602), WORD(0xf7e1), WORD(0x52f7), WORD(0x7923),
+	WORD(0x0b7a), WORD(0x15f7), WORD(0x6122), WORD(0x6037), WORD(0x321e), WORD(0xc8d8),
+	WORD(0x5869), WORD(0xa776), WORD(0x3993), WORD(0x7627), WORD(0x30ea), WORD(0x708c),
+	/* T[23] */
+	WORD(0xd419), WORD(0x74be), WORD(0x7516), WORD(0xa927), WORD(0x3a12), WORD(0x7cdf),
+	WORD(0x87ab), WORD(0xa177), WORD(0x2dd1), WORD(0x38fc), WORD(0xdf8a), WORD(0xe0f4),
+	WORD(0x6409), WORD(0x9253), WORD(0xe2df), WORD(0x943b), WORD(0xa97b), WORD(0x9c11),
+	WORD(0x81d8), WORD(0x5094), WORD(0x0a97), WORD(0x435e), WORD(0xf6fa), WORD(0x6541),
+	WORD(0x9896), WORD(0xf8b2), WORD(0x37c4), WORD(0x1630), WORD(0xaa79), WORD(0x44a6),
+	WORD(0x2920), WORD(0x1c44), WORD(0x0fe1), WORD(0xb405), WORD(0x36d4), WORD(0xa0eb),
+	WORD(0x6ed2), WORD(0x82f8), WORD(0x5ca2), WORD(0x6cb7), WORD(0x7712), WORD(0xe518),
+	WORD(0xafd2), WORD(0x749b), WORD(0x9eae), WORD(0x4b52), WORD(0x649a), WORD(0xe34a),
+	/* T[24] */
+	WORD(0x5fe6), WORD(0x6667), WORD(0xfb3e), WORD(0xb287), WORD(0x0136), WORD(0xc250),
+	WORD(0xb35b), WORD(0x5268), WORD(0x9918), WORD(0x129d), WORD(0x9f68), WORD(0xa1fa),
+	WORD(0xc68c), WORD(0x3df9), WORD(0xd0f2), WORD(0x2214), WORD(0xb1d9), WORD(0x758c),
+	WORD(0x39be), WORD(0x758e), WORD(0x5162), WORD(0xe6d0), WORD(0xa9d5), WORD(0x8ad4),
+	WORD(0xed0f), WORD(0x68a7), WORD(0xcb90), WORD(0x274a), WORD(0x8c37), WORD(0xbfa0),
+	WORD(0x70fa), WORD(0x29d6), WORD(0xe2ab), WORD(0x1d02), WORD(0x0d77), WORD(0xfd64),
+	WORD(0xd751), WORD(0x1f35), WORD(0xa737), WORD(0x1cd2), WORD(0x1c9b), WORD(0xafee),
+	WORD(0xec71), WORD(0x0224), WORD(0xe7b7), WORD(0xfe56), WORD(0x9ccd), WORD(0xb5d1),
+	/* T[25] */
+	WORD(0xbd76), WORD(0xa144), WORD(0x8445), WORD(0x0064), WORD(0x725f), WORD(0x2610),
+	WORD(0xa5ac), WORD(0x3c8f), WORD(0x6f63), WORD(0xde53), WORD(0xb503), WORD(0x69c0),
+	WORD(0xad12), WORD(0x4869), WORD(0xf5dc), WORD(0x0cbd), WORD(0x2d7e), WORD(0xdf04),
+	WORD(0xa47c), WORD(0x5130), WORD(0xe3bc), WORD(0xba20), WORD(0xb51a), WORD(0xa01a),
+	WORD(0x3e3b), WORD(0x80c6), WORD(0xe10f), WORD(0xafaf), WORD(0x0fba), WORD(0x2f52),
+	WORD(0xfda6), WORD(0xef7b), WORD(0xf5fe), WORD(0x5f86), WORD(0x39c2), WORD(0x55c6),
+	WORD(0xc47e), WORD(0xa6e5), WORD(0xc6a9), WORD(0xdb5b), WORD(0x22a5), WORD(0x7297),
+	WORD(0x7085), WORD(0xa444), WORD(0x929d), WORD(0xe682), WORD(0xefd8), WORD(0x52ed),
+	/* T[26] */
+	WORD(0x7295), WORD(0x8490), WORD(0x82d3), WORD(0x4ad4), WORD(0x7080), WORD(0x6f4b),
+	WORD(0xbc1e), WORD(0x282e), WORD(0x87a0), WORD(0xf710), WORD(0x4647), WORD(0x0e1f),
+	WORD(0xd1fa), WORD(0x0209), WORD(0x478d), WORD(0x8423), WORD(0xf18d), WORD(0xf6e1),
+	WORD(0x3dd5), WORD(0x9c89), WORD(0x517d), WORD(0x3ad9), WORD(0xaa8b), WORD(0xc811),
+	WORD(0x022d), WORD(0xd75e), WORD(0xebdf), WORD(0xbc4d), WORD(0x4c7d), WORD(0xd200),
+	WORD(0xf91b), WORD(0x8bfd), WORD(0x4a4d), WORD(0xcaf0), WORD(0x6180), WORD(0x7837),
+	WORD(0x5e5d), WORD(0xe732), WORD(0x6e59), WORD(0xb727), WORD(0x922e), WORD(0x562d),
+	WORD(0x4802), WORD(0x8489), WORD(0xc0a6), WORD(0xc6c9), WORD(0xac20), WORD(0xc955),
+	/* T[27] */
+	WORD(0x158b), WORD(0x1f33), WORD(0x7a99), WORD(0xc32d), WORD(0x7f65), WORD(0xd36b),
+	WORD(0x6ea8), WORD(0xf584), WORD(0x29f2), WORD(0xb95d), WORD(0xbe04), WORD(0xf2f8),
+	WORD(0x816a), WORD(0x2b6f), WORD(0x3a43), WORD(0x0db2), WORD(0xcf1d), WORD(0xcf74),
+	WORD(0x683c), WORD(0x9a58), WORD(0xa37c), WORD(0xadea), WORD(0x0eb2), WORD(0xa655),
+	WORD(0x7b02), WORD(0x4705), WORD(0xfba4), WORD(0x42b3), WORD(0x9483), WORD(0xf749),
+	WORD(0x5327), WORD(0x2461), WORD(0x6f85), WORD(0x31ee), WORD(0x27fd), WORD(0xea63),
+	WORD(0x1a32), WORD(0x7a32), WORD(0xac30), WORD(0x2671), WORD(0x8c0a), WORD(0x48ae),
+	WORD(0x0b73), WORD(0xae67), WORD(0x2086), WORD(0x996a), WORD(0x0301), WORD(0x8283),
+	/* T[28] */
+	WORD(0x5fc3), WORD(0x1be4), WORD(0x85d5), WORD(0x4226), WORD(0x87c1), WORD(0x1a1a),
+	WORD(0xf9ff), WORD(0x8415), WORD(0x8d84), WORD(0x53cf), WORD(0x7106), WORD(0x0e16),
+	WORD(0xa8f4), WORD(0xc09e), WORD(0xc1f0), WORD(0x8c8c), WORD(0x93f1), WORD(0x5622),
+	WORD(0xab6e), WORD(0x120b), WORD(0xdac8), WORD(0xfcfb), WORD(0xf9d0), WORD(0x5cf0),
+	WORD(0xccaf), WORD(0xb83d), WORD(0xa677), WORD(0x106f), WORD(0x9c00), WORD(0xd666),
+	WORD(0xef47), WORD(0x4e1c), WORD(0xa268), WORD(0x9984), WORD(0xa56b), WORD(0xabf2),
+	WORD(0xfc40), WORD(0xa786), WORD(0x702c), WORD(0xb553), WORD(0xc3d6), WORD(0x4954),
+	WORD(0xfc82), WORD(0x5f4a), WORD(0x687c), WORD(0xbb5f), WORD(0xe4c0), WORD(0xb299),
+	/* T[29] */
+	WORD(0x243e), WORD(0x54ee), WORD(0xdeb7), WORD(0x8803), WORD(0x49ec), WORD(0xacca),
+	WORD(0x59c0), WORD(0x2e06), WORD(0x7758), WORD(0x05bc), WORD(0xdac6), WORD(0xf97b),
+	WORD(0xbd5b), WORD(0x2758), WORD(0xf592), WORD(0x5416), WORD(0x7cbf), WORD(0x21c4),
+	WORD(0x534c), WORD(0x652d), WORD(0x28d4), WORD(0x75aa), WORD(0x836a), WORD(0x50e9),
+	WORD(0xbf38), WORD(0xb670), WORD(0xddea), WORD(0xed57), WORD(0x0c71), WORD(0x1303),
+	WORD(0x9872), WORD(0xcde8), WORD(0x616d), WORD(0x5885), WORD(0x5e3b), WORD(0xc74e),
+	WORD(0x147b), WORD(0x346c), WORD(0x27ac), WORD(0x108d), WORD(0xf917), WORD(0x3ffe),
+	WORD(0x3bd8), WORD(0x0029), WORD(0xd078), WORD(0x87a8), WORD(0xda88), WORD(0x8224),
+	/* T[30] */
+	WORD(0x21dc), WORD(0x1fdb), WORD(0xb9a5), WORD(0x4791), WORD(0x8cf0), WORD(0x5df3),
+	WORD(0x62a0), WORD(0x2007), WORD(0x8460), WORD(0x51ed), WORD(0xa20f), WORD(0x23c6),
+	WORD(0x5787), WORD(0x2b1f), WORD(0xae58), WORD(0x7d01), WORD(0xb5e5), WORD(0xa017),
+	WORD(0x4028), WORD(0xc73c), WORD(0xddd6), WORD(0xf177), WORD(0x3762), WORD(0xd8d2),
+	WORD(0xf03c), WORD(0x6502), WORD(0xf05f), WORD(0x2ca3), WORD(0x96db), WORD(0x766f),
+	WORD(0x3017), WORD(0x3019), WORD(0xa093), WORD(0x56c9), WORD(0xd7dc), WORD(0x5013),
+	WORD(0x744a), WORD(0xbba1), WORD(0x0bee), WORD(0xe0a4), WORD(0x26e6), WORD(0x9788),
+	WORD(0x1be8), WORD(0xdaef), WORD(0x9cec), WORD(0x2d19), WORD(0xacbb), WORD(0x54f8),
+	/* T[31] */
+	WORD(0x8580), WORD(0x1c71), WORD(0xc4e1), WORD(0x1ae0), WORD(0xa0bf), WORD(0xbf99),
+	WORD(0x48a6), WORD(0x303f), WORD(0x219f), WORD(0x91ae), WORD(0x1e44), WORD(0xa555),
+	WORD(0x5287), WORD(0x55a0), WORD(0xd9bd), WORD(0xdc41), WORD(0xb123), WORD(0x6872),
+	WORD(0x73e3), WORD(0xd5aa), WORD(0x5bf6), WORD(0xe639), WORD(0x4b0c), WORD(0x6fd9),
+	WORD(0xfbc1), WORD(0xc00a), WORD(0xfdba), WORD(0xbb95), WORD(0xac10), WORD(0x497c),
+	WORD(0x6208), WORD(0x9cd9), WORD(0xafea), WORD(0xca51), WORD(0xd8c1), WORD(0x8adb),
+	WORD(0x5f5f), WORD(0xf3bc), WORD(0xdafb), WORD(0x94fe), WORD(0x5371), WORD(0xdf9f),
+	WORD(0x217b), WORD(0x29c0), WORD(0x4634), WORD(0xd902), WORD(0xeb4b), WORD(0x5c13),
+};
+#else                     /* unknown word size */
+#error "Unsupported word size"
+#endif
+TO_EC_GEN_TABLE_PARAM(secp384r1_gen_comb, 6);
+
 static const ec_str_params secp384r1_str_params = {
 	.p = &secp384r1_p_str_param,
 	.p_bitlen = &secp384r1_p_bitlen_str_param,
@@ -197,6 +1810,11 @@ static const ec_str_params secp384r1_str_params = {
 	.cofactor = &secp384r1_cofactor_str_param,
 	.oid = &secp384r1_oid_str_param,
 	.name = &secp384r1_name_str_param,
+	.p_inv_chain = &secp384r1_p_inv_chain_param,
+	.p_sqrt_chain = &secp384r1_p_sqrt_chain_param,
+	.q_inv_chain = &secp384r1_q_inv_chain_param,
+	.gen_wnaf_table = &secp384r1_gen_wnaf_table_param,
+	.gen_comb_table = &secp384r1_gen_comb_table_param,
 };
 
 /*
@@ -217,5 +1835,16 @@ static const ec_str_params secp384r1_str_params = {
 #define CURVES_MAX_Q_BIT_LEN CURVE_SECP384R1_Q_BITLEN
 #endif
 
+/*
+ * Limb count of p for the fixed limbs field backend (see fp_fixed.h)
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+#define FP_FIXED_WLEN_6_USED
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+#define FP_FIXED_WLEN_12_USED
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+/* More than 17 limbs: generic field code */
+#endif
+
 #endif /* __EC_PARAMS_SECP384R1_H__ */
 #endif /* WITH_CURVE_SECP384R1 */
@@ -253,6 +253,2189 @@ TO_EC_STR_PARAM(secp521r1_oid);
 static const u8 secp521r1_name[] = "SECP521R1";
 TO_EC_STR_PARAM(secp521r1_name);
 
+/* x^(p - 2): 520 squarings and 13 multiplications */
+static const u8 secp521r1_p_inv[] = {
+	0x10, 0x01, 0x00,
+	0x21, 0x02, 0x01,
+	0x32, 0x04, 0x02,
+	0x43, 0x08, 0x03,
+	0x54, 0x10, 0x04,
+	0x65, 0x20, 0x05,
+	0x76, 0x40, 0x06,
+	0x87, 0x80, 0x07,
+	0x98, 0xff, 0xff,
+	0x99, 0x01, 0x08,
+	0x99, 0x04, 0x02,
+	0x99, 0x02, 0x01,
+	0x99, 0x01, 0x00,
+	0x99, 0x02, 0x00,
+};
+TO_EC_CHAIN_PARAM(secp521r1_p_inv);
+
+/* x^((p + 1) / 4): 519 squarings and 0 multiplications */
+static const u8 secp521r1_p_sqrt[] = {
+	0x10, 0xff, 0xff,
+	0x11, 0xff, 0xff,
+	0x11, 0x09, 0xff,
+};
+TO_EC_CHAIN_PARAM(secp521r1_p_sqrt);
+
+/* x^(q - 2): 521 squarings and 66 multiplications */
+static const u8 secp521r1_q_inv[] = {
+	0x10, 0x01, 0x00,
+	0x21, 0x02, 0x01,
+	0x32, 0x04, 0x02,
+	0x43, 0x08, 0x03,
+	0x54, 0x10, 0x04,
+	0x65, 0x20, 0x05,
+	0x76, 0x40, 0x06,
+	0x80, 0x01, 0xff,
+	0x91, 0x00, 0x08,
+	0xa9, 0x00, 0x08,
+	0xba, 0x00, 0x08,
+	0xcb, 0x00, 0x08,
+	0xdc, 0x00, 0x08,
+	0xe7, 0x80, 0x07,
+	0xee, 0x04, 0x02,
+	0xee, 0x02, 0x01,
+	0xee, 0x05, 0x0b,
+	0xee, 0x02, 0x00,
+	0xee, 0x05, 0x01,
+	0xee, 0x08, 0x0d,
+	0xee, 0x08, 0x02,
+	0xee, 0x08, 0x0a,
+	0xee, 0x05, 0x02,
+	0xee, 0x02, 0x01,
+	0xee, 0x06, 0x0c,
+	0xee, 0x03, 0x0a,
+	0xee, 0x06, 0x0c,
+	0xee, 0x06, 0x0d,
+	0xee, 0x05, 0x0d,
+	0xee, 0x08, 0x03,
+	0xee, 0x04, 0x01,
+	0xee, 0x0c, 0x09,
+	0xee, 0x03, 0x00,
+	0xee, 0x07, 0x02,
+	0xee, 0x04, 0x0a,
+	0xee, 0x08, 0x0b,
+	0xee, 0x03, 0x09,
+	0xee, 0x06, 0x0c,
+	0xee, 0x03, 0x09,
+	0xee, 0x09, 0x0a,
+	0xee, 0x04, 0x0a,
+	0xee, 0x05, 0x0d,
+	0xee, 0x04, 0x0a,
+	0xee, 0x06, 0x0b,
+	0xee, 0x04, 0x0c,
+	0xee, 0x01, 0x00,
+	0xee, 0x04, 0x00,
+	0xee, 0x07, 0x0b,
+	0xee, 0x04, 0x0b,
+	0xee, 0x02, 0x01,
+	0xee, 0x04, 0x00,
+	0xee, 0x07, 0x02,
+	0xee, 0x05, 0x0c,
+	0xee, 0x03, 0x09,
+	0xee, 0x04, 0x0a,
+	0xee, 0x05, 0x0d,
+	0xee, 0x04, 0x0c,
+	0xee, 0x03, 0x0a,
+	0xee, 0x05, 0x0d,
+	0xee, 0x02, 0x01,
+	0xee, 0x07, 0x02,
+	0xee, 0x05, 0x0b,
+	0xee, 0x07, 0x0b,
+	0xee, 0x02, 0x01,
+	0xee, 0x06, 0x01,
+	0xee, 0x03, 0x00,
+	0xee, 0x0a, 0x0a,
+};
+TO_EC_CHAIN_PARAM(secp521r1_q_inv);
+
+/*
+ * Odd multiples G, 3G, ..., 63G of the generator for the wNAF
+ * multiplications (window 7), affine x and y in Montgomery representation
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+static const word_t secp521r1_gen_wnaf[] = {
+	/* G */
+	WORD(0xb331a16381adc101), WORD(0x4dfcbf3f18e172de),
+	WORD(0x6f19a459e0c2b521), WORD(0x947f0ee093d17fd4),
+	WORD(0xdd50a5af3bf7f3ac), WORD(0x90fc1457b035a69e),
+	WORD(0x214e32409c829fda), WORD(0xe6cf1f65b311cada),
+	WORD(0x0000000000000074), WORD(0x28460e4a5a9e268e),
+	WORD(0x20445f4a3b4fe8b3), WORD(0xb09a9e3843513961),
+	WORD(0x2062a85c809fd683), WORD(0x164bf7394caf7a13),
+	WORD(0x340bd7de8b939f33), WORD(0xeccc7aa224abcda2),
+	WORD(0x022e452fda163e8d), WORD(0x00000000000001e0),
+	/* 3G */
+	WORD(0xbee9cf4d4910f78a), WORD(0x02d2c8ce976f1bd6),
+	WORD(0x0dd75a4843161975), WORD(0x028ed35e8b5acff1),
+	WORD(0xe8d69f8b251d2419), WORD(0x5cf2d6bd0896bd46),
+	WORD(0x3cda95372d891ecd), WORD(0xaeec8eb5325acaca),
+	WORD(0x000000000000008c), WORD(0x72cfa6c0ee5f7e98),
+	WORD(0x212fac4650f74360), WORD(0x867882e4de49d2c8),
+	WORD(0xd816ad6768ef61e3), WORD(0x761716ea67c6e2ba),
+	WORD(0x8be97c558fd1aae7), WORD(0x7978aabfd4154e81),
+	WORD(0xeccbcfc363655c0a), WORD(0x000000000000016e),
+	/* 5G */
+	WORD(0x3c194afcf14a49e9), WORD(0x9c6ad5a84b764798),
+	WORD(0xd194ebf0f36c498b), WORD(0x11b8897f5789bf3c),
+	WORD(0x721c1e0636af180a), WORD(0x926781ed5c78bbd6),
+	WORD(0x5fbd2cb77eda9f86), WORD(0x639ede19c8e02758),
+	WORD(0x0000000000000019), WORD(0x65d6f9bbc6f75980),
+	WORD(0xfc0b9e61f46f5848), WORD(0xbce8f80392b9aa7b),
+	WORD(0xba188aa0108e7aff), WORD(0x43ddb44be4839679),
+	WORD(0x28f6ec0be4d01a38), WORD(0x488e6c7f47439700),
+	WORD(0x764515b988a54089), WORD(0x00000000000000eb),
+	/* 7G */
+	WORD(0x6a15b574766756df), WORD(0xcd00e756c4140b76),
+	WORD(0xe237ca9fa87ee130), WORD(0x6c64d36f986e71dd),
+	WORD(0x2ec61846855fe34c), WORD(0x14780c69617b88a6),
+	WORD(0x062f9170747aa419), WORD(0xa3775b2fed05839d),
+	WORD(0x00000000000001b1), WORD(0x8d8f4b46df66eaa8),
+	WORD(0x3dae35c5e4829292), WORD(0x2fcf3b38952eef7e),
+	WORD(0x15ca91d1a2c8e70d), WORD(0x2ab5e87949e6f64f),
+	WORD(0x6eb8edecc51365ef), WORD(0x3c5ae2c168141278),
+	WORD(0x8868ec18bd1ceb42), WORD(0x0000000000000150),
+	/* 9G */
+	WORD(0x03d614e278d67878), WORD(0x330fa2b13cb3e5f1),
+	WORD(0xc7a7a85d5ec2e694), WORD(0x1af9e2ab6fb92d18),
+	WORD(0x32ba14f09cb09a6d), WORD(0x4c962558a2dc635b),
+	WORD(0x44769a2a0dcc43a3), WORD(0x13517adf8ab8ab6a),
+	WORD(0x000000000000010c), WORD(0x270a8b986326a2bb),
+	WORD(0x9a1d5075435cd695), WORD(0x3eb9b61574944407),
+	WORD(0x4207fab767a55fec), WORD(0x3706b4f2bab02bd6),
+	WORD(0xdb6412dd131eeda2), WORD(0xc71844532a770e75),
+	WORD(0xcf85aaaabd13d749), WORD(0x00000000000000f9),
+	/* 11G */
+	WORD(0xcd229d6104967f7b), WORD(0x8176607016ed066d),
+	WORD(0x4280ae0127d264d4), WORD(0x0de8cd8d75f18c88),
+	WORD(0x2979ede2999331ed), WORD(0x4aa1f7962a794c8b),
+	WORD(0xe7f6aee3f6be0bc2), WORD(0xaa378d1cab9da18a),
+	WORD(0x00000000000000ff), WORD(0x0425becc0ff2ee88),
+	WORD(0xaeac43a7c9672464), WORD(0x9b6e564071fa40cd),
+	WORD(0x559c49198c8a54a9), WORD(0x158de4548745a152),
+	WORD(0x49f6974aea705cdc), WORD(0x149d6eab31085e82),
+	WORD(0xc24e86543b82a7d9), WORD(0x0000000000000094),
+	/* 13G */
+	WORD(0xd39f8fa63e6130e5), WORD(0xfc0c43c246997de6),
+	WORD(0x74a5f61d80559c77), WORD(0xb51aa852f3cd5c47),
+	WORD(0x3099622c84701e4c), WORD(0x1c2776e95f57adc3),
+	WORD(0x0d49fb9b66f0da61), WORD(0xce6bc32e95a49243),
+	WORD(0x0000000000000156), WORD(0xe4c23b963adb5e07),
+	WORD(0xfb948d00fd811538), WORD(0xe1b0ccf557c88bf4),
+	WORD(0x1f936fee9a8e5fdd), WORD(0x9560deaeac1c5e3b),
+	WORD(0xe34e3d33d72e0f10), WORD(0x04676a851c36aa10),
+	WORD(0xd48d0c936d51f6ad), WORD(0x00000000000001f6),
+	/* 15G */
+	WORD(0xaa9adab626af2e49), WORD(0x5ef4d7f19bde5c6d),
+	WORD(0x8ecdc6cb4c0f1fc9), WORD(0xff3c3ade8e47e019),
+	WORD(0x08dc8e6713ede807), WORD(0x296b4bda996f8947),
+	WORD(0x07dc7de6185a0504), WORD(0xf820aac7e2a36a18),
+	WORD(0x0000000000000032), WORD(0x32ed1a3689c55c4e),
+	WORD(0xecab1a1a4050a3aa), WORD(0xc9237ec86622355e),
+	WORD(0x4010a47111964b64), WORD(0x6abf4831644ca385),
+	WORD(0x5d25b10834cba42f), WORD(0xb1ef824b54dd6906),
+	WORD(0xb53e73269199f6df), WORD(0x000000000000008e),
+	/* 17G */
+	WORD(0x706c0376dc1fc4c3), WORD(0x083b7c0bd4298885),
+	WORD(0x07fc6182157868d2), WORD(0x43efa73ccdab409c),
+	WORD(0x2c3b0534f33a7f01), WORD(0xda6b329279349284),
+	WORD(0x354cf74f134fd159), WORD(0x09d05c3a322c91c8),
+	WORD(0x000000000000016d), WORD(0x23a15a0fc75f6c59),
+	WORD(0xfa9adce5be387323), WORD(0x1073482aca615baa),
+	WORD(0xf8697b3abf8b56fa), WORD(0x1efced2b277b6e85),
+	WORD(0x54c6b45615915099), WORD(0x835bcca9a67b4c88),
+	WORD(0x6de088ea72576ee8), WORD(0x00000000000000bb),
+	/* 19G */
+	WORD(0xcda6637339219067), WORD(0xf23c7f85920c6b50),
+	WORD(0x86ff67a18f392dde), WORD(0xb3c9192abebd22cb),
+	WORD(0xf8fd1d984b1b1334), WORD(0x3f7ff8566d9bc873),
+	WORD(0x3922dbbf03aaefaa), WORD(0x43e07ca4616ad0d0),
+	WORD(0x000000000000001a), WORD(0xbacdf5768189a808),
+	WORD(0x2254848d34adfe82), WORD(0xbbfad26c4f54fdff),
+	WORD(0x7cd8761ccc8b18e1), WORD(0x93b9d6cb1ff975c6),
+	WORD(0xa566287771b2a2bb), WORD(0x2eb3e9457715bde7),
+	WORD(0xae61ca124ba9ad92), WORD(0x00000000000000f6),
+	/* 21G */
+	WORD(0xf6e872ecb0469d0a), WORD(0x96a1779ccb49e464),
+	WORD(0xad9bd64901c9d236), WORD(0x84eca4bf576c13eb),
+	WORD(0xd4a312bf5726b151), WORD(0x4c0ca91f3ace233f),
+	WORD(0x881345dcc61768af), WORD(0x7d9e642a842cf69d),
+	WORD(0x00000000000001e9), WORD(0xfac688275f53e3ba),
+	WORD(0xb0f305e21e4e5d26), WORD(0x62be4d878bb24e65),
+	WORD(0x4adf5a1d1b9631f7), WORD(0xfbefba0d29ed2419),
+	WORD(0x360c0514b7b5d7d3), WORD(0x31741e002ce28c9f),
+	WORD(0xa416096d3e2f2067), WORD(0x000000000000019e),
+	/* 23G */
+	WORD(0xae6b82c9d75ca405), WORD(0x0350e352f67157a9),
+	WORD(0xf103f0f8d613572c), WORD(0x57f4f1fc74d2f629),
+	WORD(0x880fb7c1fe4d7ad8), WORD(0x41248691a6866ea2),
+	WORD(0xc7773d1cdd3c2fd9), WORD(0xbb6d8e56762faa3d),
+	WORD(0x00000000000000c9), WORD(0x003cb25ea09794e1),
+	WORD(0x2b6c0ae1a9b7d068), WORD(0x61109da22854691c),
+	WORD(0x7a1e13d93dd83ee8), WORD(0x07084219b0f74bfe),
+	WORD(0x195a18b23c22616e), WORD(0x8e3ebacffc48682c),
+	WORD(0x03345142c7e03423), WORD(0x000000000000009c),
+	/* 25G */
+	WORD(0x70553a131b5716a6), WORD(0xd89fc612305fb856),
+	WORD(0x93f20f0758e12e9f), WORD(0x26ab743f1553247f),
+	WORD(0xa5548c2b48be1b77), WORD(0xd88e3b96462a4ccc),
+	WORD(0xe90039881328d883), WORD(0x1a51ac3a537aeffc),
+	WORD(0x000000000000010c), WORD(0x183343f73a45c644),
+	WORD(0xb6a192de720263c1), WORD(0x7af76f152a339735),
+	WORD(0xd068f11b85352cb9), WORD(0x536f71aa1ab97de0),
+	WORD(0x63fb3614440a8b33), WORD(0x9f8ad491f5801150),
+	WORD(0x9d7115147c05db06), WORD(0x0000000000000023),
+	/* 27G */
+	WORD(0x45d80dcfb7e0863e), WORD(0xb41abb2180b8016b),
+	WORD(0x1e590ab022497622), WORD(0x41a89a9d76d0698b),
+	WORD(0xa6c059091ed38cea), WORD(0x1619f9a8c3f09ac2),
+	WORD(0x37c39ca9ae8727c3), WORD(0x53b1526a75c44f32),
+	WORD(0x00000000000000db), WORD(0xa03c565c14005373),
+	WORD(0x59f9f357652ec85b), WORD(0x97231fff384ea2d6),
+	WORD(0x2a09dc3a7a545dab), WORD(0x008f7d248f6c975e),
+	WORD(0xdda52b7bc70d0d91), WORD(0xfd4fe8c9e2e7a961),
+	WORD(0xe2f2c14200d60351), WORD(0x00000000000001f0),
+	/* 29G */
+	WORD(0xee5d319135b252da), WORD(0xcb161c93b0c76d12),
+	WORD(0xcf799ec2caea8fb6), WORD(0x48a001d5c7423ffd),
+	WORD(0x982e54de0343b6b9), WORD(0xf6145f79c7bb3250),
+	WORD(0x2ffcfa2898f43132), WORD(0x3ed9e0fdfe5b2d04),
+	WORD(0x0000000000000014), WORD(0x1846bce9f0be1fd0),
+	WORD(0xde8c3ddde2410d06), WORD(0x1f833cc93e1375df),
+	WORD(0x85a8613996b83698), WORD(0x5bdf0710ca96706c),
+	WORD(0xfe5ae7af5bcad69a), WORD(0xc10119f7c7e5b220),
+	WORD(0x3402d664ada0dbdb), WORD(0x00000000000000cf),
+	/* 31G */
+	WORD(0x01b63a64833cc3c3), WORD(0x09112be87060b544),
+	WORD(0x9106e7daf2447124), WORD(0x14fe0a60d604e6b5),
+	WORD(0x366b2aa1d48264ea), WORD(0x30b930541e52f3b9),
+	WORD(0xbedaba2c4b2be153), WORD(0x0a80352c66db983d),
+	WORD(0x0000000000000033), WORD(0x8cc9ec08ed515299),
+	WORD(0xc565233be39cbc96), WORD(0x31d50decbe3daa18),
+	WORD(0xc809cd4346572661), WORD(0x187bb5c6192268a3),
+	WORD(0x030577db965f68d5), WORD(0x7645aa0319478864),
+	WORD(0xc3ef84e09d10a518), WORD(0x000000000000011c),
+	/* 33G */
+	WORD(0x468a10657c25e3ee), WORD(0x96af5170fe324f98),
+	WORD(0x6152f62c8c359768), WORD(0x8d74d28cd2bd529d),
+	WORD(0xf855edf53f15bbf7), WORD(0x09f9c0a10d3a11b6),
+	WORD(0xc7290436a415f493), WORD(0xf3463b75a71e3b7a),
+	WORD(0x00000000000000b4), WORD(0x269f90fac23195b7),
+	WORD(0x79b5f4ad1ee9f08e), WORD(0x9d4477feae1145ac),
+	WORD(0x5f805eb90b60b6f5), WORD(0xf973b2b765f9e89c),
+	WORD(0x31cf00b3b4b0a562), WORD(0x9d126a89d5f031e3),
+	WORD(0xb5bdbd1de43482b6), WORD(0x0000000000000031),
+	/* 35G */
+	WORD(0x8c3770c01d5d5258), WORD(0x6c6e081ce4e66beb),
+	WORD(0x675497fb0a5aee64), WORD(0x11f72530c3047b59),
+	WORD(0x95da4036427ed3a0), WORD(0x5fe253c05ab7cb9c),
+	WORD(0xc95133d3215ac9f0), WORD(0x3c1cc5b1034f05d1),
+	WORD(0x0000000000000185), WORD(0xfa306f4b41fdab1f),
+	WORD(0x269f58e9f7920f03), WORD(0xcbef5d26da113205),
+	WORD(0xa12e1092917734f3), WORD(0xa84d588bc5e96380),
+	WORD(0xe7a313cb2c8d18ed), WORD(0xdfd28849b65aec2d),
+	WORD(0xe60dc1a18f86186d), WORD(0x00000000000001e2),
+	/* 37G */
+	WORD(0xb7a513d929b0860c), WORD(0x39f8d626acdaabd1),
+	WORD(0xf9463273b5723c01), WORD(0x02072c7137704c06),
+	WORD(0xa4dea22bb1d1442b), WORD(0x2114f6857357ceab),
+	WORD(0x33e1ae2eab60eacf), WORD(0x389cf3cc1a96f6ac),
+	WORD(0x000000000000015b), WORD(0x01d42dfb86c080a2),
+	WORD(0x4b1895fcc1ca7d95), WORD(0xe198d25f202b4c41),
+	WORD(0xc0dc2e2b24cad02b), WORD(0x82ee5ede1238e41f),
+	WORD(0x2c9318bed35bcc89), WORD(0xc97f2737f90c32fc),
+	WORD(0xa08625cb12793658), WORD(0x000000000000015b),
+	/* 39G */
+	WORD(0xbe49282e3d047eeb), WORD(0xb385b8208cf719db),
+	WORD(0xbcada7d0ea4041d7), WORD(0xf15605fa1a72fd18),
+	WORD(0x5392b58662c31350), WORD(0x391c6cfeb11ace37),
+	WORD(0x814f4b30d24dadc8), WORD(0x3aa9320931ab524c),
+	WORD(0x00000000000000b0), WORD(0xd3040a585bb71ccd),
+	WORD(0x55ec6e6e309145b0), WORD(0xb1790973a5b4c720),
+	WORD(0xd551e57920aca273), WORD(0xa40c6e2cff5cb412),
+	WORD(0xa66e05892063486d), WORD(0xce3449bdd543cb0a),
+	WORD(0x71b0154d2035de9c), WORD(0x00000000000000ee),
+	/* 41G */
+	WORD(0x0f5d68503b5e7a17), WORD(0x7b4700674a93121c),
+	WORD(0xfd6efed0d2916615), WORD(0x67260461eee414bd),
+	WORD(0x640b5c98f57a4ae6), WORD(0x5342dc2f91c32530),
+	WORD(0x12a95291f25944cc), WORD(0x53b1f5fece944184),
+	WORD(0x0000000000000112), WORD(0x67ec25a5b5c61578),
+	WORD(0xf675f5bb07608147), WORD(0x5efbaeebac73f9d1),
+	WORD(0xed0295372a8fd147), WORD(0x88d9cf0708f67993),
+	WORD(0x1911ef410d916410), WORD(0xf3d5acf2c074f72b),
+	WORD(0x769b7909a1e51ccd), WORD(0x000000000000016a),
+	/* 43G */
+	WORD(0xbf63005228597b16), WORD(0x90389f18419127a4),
+	WORD(0xe528f85b17ef703e), WORD(0xeed1d3a73d4d9ec2),
+	WORD(0xcb7e3356bd76be9b), WORD(0xd7c7787ca21c7f51),
+	WORD(0x503833c551760a0c), WORD(0x7f6aa8116c82a26c),
+	WORD(0x0000000000000072), WORD(0xdfc2aeea87c2679e),
+	WORD(0x6944ac14833b41d6), WORD(0xbd4a76dc97bb5b44),
+	WORD(0x78c996b015aa3e70), WORD(0xf633feb04c43cd8e),
+	WORD(0x66bd181bc0cf8d05), WORD(0x92133bf48ed8e8a2),
+	WORD(0x4d75fbd41e3d51df), WORD(0x0000000000000043),
+	/* 45G */
+	WORD(0x0d125a7461ab2827), WORD(0x625196f63007e4ae),
+	WORD(0x87e14aa303db35b8), WORD(0x6cee4750d672b81f),
+	WORD(0x33bc8c4dbefc50f9), WORD(0x603d96faf1f8cb94),
+	WORD(0x103d2c7bf9460a3e), WORD(0xdc3cacb5c7ff95e0),
+	WORD(0x0000000000000129), WORD(0xd4fa07b26d433634),
+	WORD(0x27ca4c53e6800481), WORD(0x709a31faec859bab),
+	WORD(0x42f376cf43cdf194), WORD(0x54dc6ad9401756d7),
+	WORD(0x209aac250dde6da0), WORD(0x3d8ac31521193844),
+	WORD(0x3ea6b5610f98a4fe), WORD(0x00000000000001c2),
+	/* 47G */
+	WORD(0x88abf8c7e241c122), WORD(0xb397ed31e4d5eace),
+	WORD(0xb3052b509868f65d), WORD(0x564e773ad1d4e26e),
+	WORD(0x591c0c32505cf491), WORD(0xfc4b919883638ee8),
+	WORD(0x1672727f138a019f), WORD(0xafce7a841f661ac4),
+	WORD(0x000000000000017e), WORD(0xeb04be5772195c9d),
+	WORD(0x9de9832e978ec870), WORD(0xf388e520accf8833),
+	WORD(0x5375dbb07a3c6c12), WORD(0x4bc93b0405c824c1),
+	WORD(0xc476753f993b7832), WORD(0x4d302f83c9a4904f),
+	WORD(0x4eda14865ddaa7fb), WORD(0x00000000000000ff),
+	/* 49G */
+	WORD(0x56a972e63e8f02e3), WORD(0x6506465a2824f7e0),
+	WORD(0xd4392c6d58d62602), WORD(0x2148ec6427171a2f),
+	WORD(0xf5b5e1516fa97b14), WORD(0x1cfac0dc5888ef54),
+	WORD(0x69cea2e1a3d724cc), WORD(0xabe5d20531ddd5d0),
+	WORD(0x000000000000000e), WORD(0x5a05772559502435),
+	WORD(0x8e85cdfa35164442), WORD(0xda25cb1fdfd85c45),
+	WORD(0xe10608796775db95), WORD(0xc1aeecbbaaa1eaba),
+	WORD(0xbf583961ceced45f), WORD(0x8dba4f7233c3bf2d),
+	WORD(0xcb8a04d80dfb970a), WORD(0x00000000000001bd),
+	/* 51G */
+	WORD(0x825a0e56e94789e1), WORD(0x6ed46c8b7ffde64a),
+	WORD(0xe07dd344f78ebdf1), WORD(0x6f8990d70d882a65),
+	WORD(0x136176ff357839c8), WORD(0xdd1dd18b65fcdf75),
+	WORD(0xe67efcfadef1a7f4), WORD(0xd1012ec9db40a2f9),
+	WORD(0x000000000000000a), WORD(0x3d9c73043cf28106),
+	WORD(0x0c475ce22f6eae04), WORD(0xd28300555f69d44f),
+	WORD(0x06424e1b04b71d75), WORD(0x9e4bde15b45d6db0),
+	WORD(0x671272d8ba56f5cd), WORD(0xbca96ec3c790e240),
+	WORD(0x2b1ceca98ca169fa), WORD(0x0000000000000112),
+	/* 53G */
+	WORD(0x8350fdb8924657b9), WORD(0x0b3142b426665b4c),
+	WORD(0x95840a9ed4e4c404), WORD(0xc769d7ac0fdd27f0),
+	WORD(0x6227108731b904d3), WORD(0xdb93f417b7ca4080),
+	WORD(0x6ffc3445f48b44af), WORD(0xfbbd9e87fe988183),
+	WORD(0x0000000000000149), WORD(0x30c14fa3f325863a),
+	WORD(0x357eb6ed6eea063c), WORD(0xc602051efde255f7),
+	WORD(0xd987b53d4ef1da67), WORD(0x58a7efb27a81e79d),
+	WORD(0xb49aa1bf4029e886), WORD(0xc3bee39feef21610),
+	WORD(0x3a62b08d012ba884), WORD(0x0000000000000195),
+	/* 55G */
+	WORD(0xaf12d4bf12db4c43), WORD(0x274256be675ea387),
+	WORD(0x4d3ff4d5a5ed4b56), WORD(0xf35f0ba4358f05aa),
+	WORD(0xd0c66549c8be5693), WORD(0xceb2396a014746d0),
+	WORD(0x54be581f4fece853), WORD(0xe25aa8f20aae36d6),
+	WORD(0x0000000000000073), WORD(0x790d617953fa0518),
+	WORD(0x753d0cb6691851b7), WORD(0xc37d01d11803504b),
+	WORD(0x266b4b04f1a2da9a), WORD(0xaa885542c4ae2d04),
+	WORD(0x5b007d88a53edd70), WORD(0x9730cfa2188d0b50),
+	WORD(0x109c2f53c83d0d3d), WORD(0x00000000000000d7),
+	/* 57G */
+	WORD(0xf13714f0f9ff3cf2), WORD(0x281a3a9985274d09),
+	WORD(0x9041b9647ffcae42), WORD(0x597b37eade325c52),
+	WORD(0xfc2579805def488c), WORD(0xc2f79e36bbd290dc),
+	WORD(0xfd2d46f7f39736df), WORD(0x702231ed3af7d92f),
+	WORD(0x0000000000000081), WORD(0x479d3a23f3353f6f),
+	WORD(0x9919d6bfbfece212), WORD(0xb9d4a498c863152a),
+	WORD(0x35251fc102b5494f), WORD(0xf51a412986869dec),
+	WORD(0xc4db173f59c86ff9), WORD(0x7bd89e86e9657cec),
+	WORD(0x95b4039f73626a7c), WORD(0x00000000000000cc),
+	/* 59G */
+	WORD(0x358d6bad152b4c61), WORD(0x4431df4513758b34),
+	WORD(0x4565d4292761a390), WORD(0x348d481a16b21b9d),
+	WORD(0x9002ab49e4d89a26), WORD(0xccd572e149a61114),
+	WORD(0x56e3911e2ecc480c), WORD(0xb9831e301a16f94f),
+	WORD(0x00000000000001b3), WORD(0x17061fb2fb051f9f),
+	WORD(0x8d67a5501e29c0fd), WORD(0x61fec161c67d7ff2),
+	WORD(0x5c64feafeeeb27ff), WORD(0xa2dc67c6225e41e8),
+	WORD(0xfa71179779e5b77e), WORD(0x3f8ad246d9b30481),
+	WORD(0xda6d85865057f8dd), WORD(0x0000000000000121),
+	/* 61G */
+	WORD(0x50c5551312804501), WORD(0x20e5a9ec67e7e1bb),
+	WORD(0x6bca95d68b38aa1e), WORD(0x9cd2f3fe72cd3d99),
+	WORD(0x8bb8c9e08d3bee05), WORD(0x8d266b9258df458b),
+	WORD(0xc7c5b668beadb306), WORD(0x2e49653e39950e3e),
+	WORD(0x00000000000001a1), WORD(0x25c54f7e71b02b19),
+	WORD(0x125c77fc66a50bb0), WORD(0x95ab791774e1ff2f),
+	WORD(0xd4541a7fb01d7d01), WORD(0x5001fbc6aa5bfaa9),
+	WORD(0x5ff604bd1d76ac63), WORD(0x963cd7a42ff7a116),
+	WORD(0xd983ccb6951cce43), WORD(0x0000000000000042),
+	/* 63G */
+	WORD(0x72f04c9d4ed91903), WORD(0x4687adf5b7e74444),
+	WORD(0x2f3ad7be812bb856), WORD(0x2f631ccb423ac313),
+	WORD(0x229d74cb30984709), WORD(0xe0f3faa7f26a8d84),
+	WORD(0x470e510dad7fd06e), WORD(0xbff417bccd658537),
+	WORD(0x0000000000000022), WORD(0x0ad4d1f861065e81),
+	WORD(0x5674e8ad69501edd), WORD(0x41d7b2bdadfb3251),
+	WORD(0x5e09fbc7c1780389), WORD(0xc002e9edee760c4b),
+	WORD(0x032caf461a9d5111), WORD(0xcb0d4f04994320a0),
+	WORD(0x0bb6c0d644d902eb), WORD(0x000000000000009c),
+};
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+static const word_t secp521r1_gen_wnaf[] = {
+	/* G */
+	WORD(0xb331a163), WORD(0x18e172de), WORD(0x4dfcbf3f), WORD(0xe0c2b521),
+	WORD(0x6f19a459), WORD(0x93d17fd4), WORD(0x947f0ee0), WORD(0x3bf7f3ac),
+	WORD(0xdd50a5af), WORD(0xb035a69e), WORD(0x90fc1457), WORD(0x9c829fda),
+	WORD(0x214e3240), WORD(0xb311cada), WORD(0xe6cf1f65), WORD(0x5b820274),
+	WORD(0x00000103), WORD(0x28460e4a), WORD(0x3b4fe8b3), WORD(0x20445f4a),
+	WORD(0x43513961), WORD(0xb09a9e38), WORD(0x809fd683), WORD(0x2062a85c),
+	WORD(0x4caf7a13), WORD(0x164bf739), WORD(0x8b939f33), WORD(0x340bd7de),
+	WORD(0x24abcda2), WORD(0xeccc7aa2), WORD(0xda163e8d), WORD(0x022e452f),
+	WORD(0x3c4d1de0), WORD(0x000000b5),
+	/* 3G */
+	WORD(0xbee9cf4d), WORD(0x976f1bd6), WORD(0x02d2c8ce), WORD(0x43161975),
+	WORD(0x0dd75a48), WORD(0x8b5acff1), WORD(0x028ed35e), WORD(0x251d2419),
+	WORD(0xe8d69f8b), WORD(0x0896bd46), WORD(0x5cf2d6bd), WORD(0x2d891ecd),
+	WORD(0x3cda9537), WORD(0x325acaca), WORD(0xaeec8eb5), WORD(0x21ef148c),
+	WORD(0x00000092), WORD(0x72cfa6c0), WORD(0x50f74360), WORD(0x212fac46),
+	WORD(0xde49d2c8), WORD(0x867882e4), WORD(0x68ef61e3), WORD(0xd816ad67),
+	WORD(0x67c6e2ba), WORD(0x761716ea), WORD(0x8fd1aae7), WORD(0x8be97c55),
+	WORD(0xd4154e81), WORD(0x7978aabf), WORD(0x63655c0a), WORD(0xeccbcfc3),
+	WORD(0xbefd316e), WORD(0x000001dc),
+	/* 5G */
+	WORD(0x3c194afc), WORD(0x4b764798), WORD(0x9c6ad5a8), WORD(0xf36c498b),
+	WORD(0xd194ebf0), WORD(0x5789bf3c), WORD(0x11b8897f), WORD(0x36af180a),
+	WORD(0x721c1e06), WORD(0x5c78bbd6), WORD(0x926781ed), WORD(0x7eda9f86),
+	WORD(0x5fbd2cb7), WORD(0xc8e02758), WORD(0x639ede19), WORD(0x9493d219),
+	WORD(0x000001e2), WORD(0x65d6f9bb), WORD(0xf46f5848), WORD(0xfc0b9e61),
+	WORD(0x92b9aa7b), WORD(0xbce8f803), WORD(0x108e7aff), WORD(0xba188aa0),
+	WORD(0xe4839679), WORD(0x43ddb44b), WORD(0xe4d01a38), WORD(0x28f6ec0b),
+	WORD(0x47439700), WORD(0x488e6c7f), WORD(0x88a54089), WORD(0x764515b9),
+	WORD(0xeeb300eb), WORD(0x0000018d),
+	/* 7G */
+	WORD(0x6a15b574), WORD(0xc4140b76), WORD(0xcd00e756), WORD(0xa87ee130),
+	WORD(0xe237ca9f), WORD(0x986e71dd), WORD(0x6c64d36f), WORD(0x855fe34c),
+	WORD(0x2ec61846), WORD(0x617b88a6), WORD(0x14780c69), WORD(0x747aa419),
+	WORD(0x062f9170), WORD(0xed05839d), WORD(0xa3775b2f), WORD(0xceadbfb1),
+	WORD(0x000000ec), WORD(0x8d8f4b46), WORD(0xe4829292), WORD(0x3dae35c5),
+	WORD(0x952eef7e), WORD(0x2fcf3b38), WORD(0xa2c8e70d), WORD(0x15ca91d1),
+	WORD(0x49e6f64f), WORD(0x2ab5e879), WORD(0xc51365ef), WORD(0x6eb8edec),
+	WORD(0x68141278), WORD(0x3c5ae2c1), WORD(0xbd1ceb42), WORD(0x8868ec18),
+	WORD(0xcdd55150), WORD(0x000001be),
+	/* 9G */
+	WORD(0x03d614e2), WORD(0x3cb3e5f1), WORD(0x330fa2b1), WORD(0x5ec2e694),
+	WORD(0xc7a7a85d), WORD(0x6fb92d18), WORD(0x1af9e2ab), WORD(0x9cb09a6d),
+	WORD(0x32ba14f0), WORD(0xa2dc635b), WORD(0x4c962558), WORD(0x0dcc43a3),
+	WORD(0x44769a2a), WORD(0x8ab8ab6a), WORD(0x13517adf), WORD(0xacf0f10c),
+	WORD(0x000000f1), WORD(0x270a8b98), WORD(0x435cd695), WORD(0x9a1d5075),
+	WORD(0x74944407), WORD(0x3eb9b615), WORD(0x67a55fec), WORD(0x4207fab7),
+	WORD(0xbab02bd6), WORD(0x3706b4f2), WORD(0x131eeda2), WORD(0xdb6412dd),
+	WORD(0x2a770e75), WORD(0xc7184453), WORD(0xbd13d749), WORD(0xcf85aaaa),
+	WORD(0x4d4576f9), WORD(0x000000c6),
+	/* 11G */
+	WORD(0xcd229d61), WORD(0x16ed066d), WORD(0x81766070), WORD(0x27d264d4),
+	WORD(0x4280ae01), WORD(0x75f18c88), WORD(0x0de8cd8d), WORD(0x999331ed),
+	WORD(0x2979ede2), WORD(0x2a794c8b), WORD(0x4aa1f796), WORD(0xf6be0bc2),
+	WORD(0xe7f6aee3), WORD(0xab9da18a), WORD(0xaa378d1c), WORD(0x2cfef6ff),
+	WORD(0x00000009), WORD(0x0425becc), WORD(0xc9672464), WORD(0xaeac43a7),
+	WORD(0x71fa40cd), WORD(0x9b6e5640), WORD(0x8c8a54a9), WORD(0x559c4919),
+	WORD(0x8745a152), WORD(0x158de454), WORD(0xea705cdc), WORD(0x49f6974a),
+	WORD(0x31085e82), WORD(0x149d6eab), WORD(0x3b82a7d9), WORD(0xc24e8654),
+	WORD(0xe5dd1094), WORD(0x0000001f),
+	/* 13G */
+	WORD(0xd39f8fa6), WORD(0x46997de6), WORD(0xfc0c43c2), WORD(0x80559c77),
+	WORD(0x74a5f61d), WORD(0xf3cd5c47), WORD(0xb51aa852), WORD(0x84701e4c),
+	WORD(0x3099622c), WORD(0x5f57adc3), WORD(0x1c2776e9), WORD(0x66f0da61),
+	WORD(0x0d49fb9b), WORD(0x95a49243), WORD(0xce6bc32e), WORD(0xc261cb56),
+	WORD(0x0000007c), WORD(0xe4c23b96), WORD(0xfd811538), WORD(0xfb948d00),
+	WORD(0x57c88bf4), WORD(0xe1b0ccf5), WORD(0x9a8e5fdd), WORD(0x1f936fee),
+	WORD(0xac1c5e3b), WORD(0x9560deae), WORD(0xd72e0f10), WORD(0xe34e3d33),
+	WORD(0x1c36aa10), WORD(0x04676a85), WORD(0x6d51f6ad), WORD(0xd48d0c93),
+	WORD(0xb6bc0ff6), WORD(0x00000075),
+	/* 15G */
+	WORD(0xaa9adab6), WORD(0x9bde5c6d), WORD(0x5ef4d7f1), WORD(0x4c0f1fc9),
+	WORD(0x8ecdc6cb), WORD(0x8e47e019), WORD(0xff3c3ade), WORD(0x13ede807),
+	WORD(0x08dc8e67), WORD(0x996f8947), WORD(0x296b4bda), WORD(0x185a0504),
+	WORD(0x07dc7de6), WORD(0xe2a36a18), WORD(0xf820aac7), WORD(0x5e5c9232),
+	WORD(0x0000004d), WORD(0x32ed1a36), WORD(0x4050a3aa), WORD(0xecab1a1a),
+	WORD(0x6622355e), WORD(0xc9237ec8), WORD(0x11964b64), WORD(0x4010a471),
+	WORD(0x644ca385), WORD(0x6abf4831), WORD(0x34cba42f), WORD(0x5d25b108),
+	WORD(0x54dd6906), WORD(0xb1ef824b), WORD(0x9199f6df), WORD(0xb53e7326),
+	WORD(0x8ab89c8e), WORD(0x00000113),
+	/* 17G */
+	WORD(0x706c0376), WORD(0xd4298885), WORD(0x083b7c0b), WORD(0x157868d2),
+	WORD(0x07fc6182), WORD(0xcdab409c), WORD(0x43efa73c), WORD(0xf33a7f01),
+	WORD(0x2c3b0534), WORD(0x79349284), WORD(0xda6b3292), WORD(0x134fd159),
+	WORD(0x354cf74f), WORD(0x322c91c8), WORD(0x09d05c3a), WORD(0x3f89876d),
+	WORD(0x000001b8), WORD(0x23a15a0f), WORD(0xbe387323), WORD(0xfa9adce5),
+	WORD(0xca615baa), WORD(0x1073482a), WORD(0xbf8b56fa), WORD(0xf8697b3a),
+	WORD(0x277b6e85), WORD(0x1efced2b), WORD(0x15915099), WORD(0x54c6b456),
+	WORD(0xa67b4c88), WORD(0x835bcca9), WORD(0x72576ee8), WORD(0x6de088ea),
+	WORD(0xbed8b2bb), WORD(0x0000018e),
+	/* 19G */
+	WORD(0xcda66373), WORD(0x920c6b50), WORD(0xf23c7f85), WORD(0x8f392dde),
+	WORD(0x86ff67a1), WORD(0xbebd22cb), WORD(0xb3c9192a), WORD(0x4b1b1334),
+	WORD(0xf8fd1d98), WORD(0x6d9bc873), WORD(0x3f7ff856), WORD(0x03aaefaa),
+	WORD(0x3922dbbf), WORD(0x616ad0d0), WORD(0x43e07ca4), WORD(0x4320ce1a),
+	WORD(0x00000072), WORD(0xbacdf576), WORD(0x34adfe82), WORD(0x2254848d),
+	WORD(0x4f54fdff), WORD(0xbbfad26c), WORD(0xcc8b18e1), WORD(0x7cd8761c),
+	WORD(0x1ff975c6), WORD(0x93b9d6cb), WORD(0x71b2a2bb), WORD(0xa5662877),
+	WORD(0x7715bde7), WORD(0x2eb3e945), WORD(0x4ba9ad92), WORD(0xae61ca12),
+	WORD(0x135010f6), WORD(0x00000103),
+	/* 21G */
+	WORD(0xf6e872ec), WORD(0xcb49e464), WORD(0x96a1779c), WORD(0x01c9d236),
+	WORD(0xad9bd649), WORD(0x576c13eb), WORD(0x84eca4bf), WORD(0x5726b151),
+	WORD(0xd4a312bf), WORD(0x3ace233f), WORD(0x4c0ca91f), WORD(0xc61768af),
+	WORD(0x881345dc), WORD(0x842cf69d), WORD(0x7d9e642a), WORD(0x8d3a15e9),
+	WORD(0x00000160), WORD(0xfac68827), WORD(0x1e4e5d26), WORD(0xb0f305e2),
+	WORD(0x8bb24e65), WORD(0x62be4d87), WORD(0x1b9631f7), WORD(0x4adf5a1d),
+	WORD(0x29ed2419), WORD(0xfbefba0d), WORD(0xb7b5d7d3), WORD(0x360c0514),
+	WORD(0x2ce28c9f), WORD(0x31741e00), WORD(0x3e2f2067), WORD(0xa416096d),
+	WORD(0xa7c7759e), WORD(0x000000be),
+	/* 23G */
+	WORD(0xae6b82c9), WORD(0xf67157a9), WORD(0x0350e352), WORD(0xd613572c),
+	WORD(0xf103f0f8), WORD(0x74d2f629), WORD(0x57f4f1fc), WORD(0xfe4d7ad8),
+	WORD(0x880fb7c1), WORD(0xa6866ea2), WORD(0x41248691), WORD(0xdd3c2fd9),
+	WORD(0xc7773d1c), WORD(0x762faa3d), WORD(0xbb6d8e56), WORD(0xb9480ac9),
+	WORD(0x000001ae), WORD(0x003cb25e), WORD(0xa9b7d068), WORD(0x2b6c0ae1),
+	WORD(0x2854691c), WORD(0x61109da2), WORD(0x3dd83ee8), WORD(0x7a1e13d9),
+	WORD(0xb0f74bfe), WORD(0x07084219), WORD(0x3c22616e), WORD(0x195a18b2),
+	WORD(0xfc48682c), WORD(0x8e3ebacf), WORD(0xc7e03423), WORD(0x03345142),
+	WORD(0x2f29c29c), WORD(0x00000141),
+	/* 25G */
+	WORD(0x70553a13), WORD(0x305fb856), WORD(0xd89fc612), WORD(0x58e12e9f),
+	WORD(0x93f20f07), WORD(0x1553247f), WORD(0x26ab743f), WORD(0x48be1b77),
+	WORD(0xa5548c2b), WORD(0x462a4ccc), WORD(0xd88e3b96), WORD(0x1328d883),
+	WORD(0xe9003988), WORD(0x537aeffc), WORD(0x1a51ac3a), WORD(0xae2d4d0c),
+	WORD(0x00000036), WORD(0x183343f7), WORD(0x720263c1), WORD(0xb6a192de),
+	WORD(0x2a339735), WORD(0x7af76f15), WORD(0x85352cb9), WORD(0xd068f11b),
+	WORD(0x1ab97de0), WORD(0x536f71aa), WORD(0x440a8b33), WORD(0x63fb3614),
+	WORD(0xf5801150), WORD(0x9f8ad491), WORD(0x7c05db06), WORD(0x9d711514),
+	WORD(0x8b8c8823), WORD(0x00000074),
+	/* 27G */
+	WORD(0x45d80dcf), WORD(0x80b8016b), WORD(0xb41abb21), WORD(0x22497622),
+	WORD(0x1e590ab0), WORD(0x76d0698b), WORD(0x41a89a9d), WORD(0x1ed38cea),
+	WORD(0xa6c05909), WORD(0xc3f09ac2), WORD(0x1619f9a8), WORD(0xae8727c3),
+	WORD(0x37c39ca9), WORD(0x75c44f32), WORD(0x53b1526a), WORD(0xc10c7cdb),
+	WORD(0x0000016f), WORD(0xa03c565c), WORD(0x652ec85b), WORD(0x59f9f357),
+	WORD(0x384ea2d6), WORD(0x97231fff), WORD(0x7a545dab), WORD(0x2a09dc3a),
+	WORD(0x8f6c975e), WORD(0x008f7d24), WORD(0xc70d0d91), WORD(0xdda52b7b),
+	WORD(0xe2e7a961), WORD(0xfd4fe8c9), WORD(0x00d60351), WORD(0xe2f2c142),
+	WORD(0x00a6e7f0), WORD(0x00000028),
+	/* 29G */
+	WORD(0xee5d3191), WORD(0xb0c76d12), WORD(0xcb161c93), WORD(0xcaea8fb6),
+	WORD(0xcf799ec2), WORD(0xc7423ffd), WORD(0x48a001d5), WORD(0x0343b6b9),
+	WORD(0x982e54de), WORD(0xc7bb3250), WORD(0xf6145f79), WORD(0x98f43132),
+	WORD(0x2ffcfa28), WORD(0xfe5b2d04), WORD(0x3ed9e0fd), WORD(0x64a5b414),
+	WORD(0x0000006b), WORD(0x1846bce9), WORD(0xe2410d06), WORD(0xde8c3ddd),
+	WORD(0x3e1375df), WORD(0x1f833cc9), WORD(0x96b83698), WORD(0x85a86139),
+	WORD(0xca96706c), WORD(0x5bdf0710), WORD(0x5bcad69a), WORD(0xfe5ae7af),
+	WORD(0xc7e5b220), WORD(0xc10119f7), WORD(0xada0dbdb), WORD(0x3402d664),
+	WORD(0x7c3fa0cf), WORD(0x000001e1),
+	/* 31G */
+	WORD(0x01b63a64), WORD(0x7060b544), WORD(0x09112be8), WORD(0xf2447124),
+	WORD(0x9106e7da), WORD(0xd604e6b5), WORD(0x14fe0a60), WORD(0xd48264ea),
+	WORD(0x366b2aa1), WORD(0x1e52f3b9), WORD(0x30b93054), WORD(0x4b2be153),
+	WORD(0xbedaba2c), WORD(0x66db983d), WORD(0x0a80352c), WORD(0x79878633),
+	WORD(0x00000106), WORD(0x8cc9ec08), WORD(0xe39cbc96), WORD(0xc565233b),
+	WORD(0xbe3daa18), WORD(0x31d50dec), WORD(0x46572661), WORD(0xc809cd43),
+	WORD(0x192268a3), WORD(0x187bb5c6), WORD(0x965f68d5), WORD(0x030577db),
+	WORD(0x19478864), WORD(0x7645aa03), WORD(0x9d10a518), WORD(0xc3ef84e0),
+	WORD(0xa2a5331c), WORD(0x000001da),
+	/* 33G */
+	WORD(0x468a1065), WORD(0xfe324f98), WORD(0x96af5170), WORD(0x8c359768),
+	WORD(0x6152f62c), WORD(0xd2bd529d), WORD(0x8d74d28c), WORD(0x3f15bbf7),
+	WORD(0xf855edf5), WORD(0x0d3a11b6), WORD(0x09f9c0a1), WORD(0xa415f493),
+	WORD(0xc7290436), WORD(0xa71e3b7a), WORD(0xf3463b75), WORD(0x4bc7dcb4),
+	WORD(0x000000f8), WORD(0x269f90fa), WORD(0x1ee9f08e), WORD(0x79b5f4ad),
+	WORD(0xae1145ac), WORD(0x9d4477fe), WORD(0x0b60b6f5), WORD(0x5f805eb9),
+	WORD(0x65f9e89c), WORD(0xf973b2b7), WORD(0xb4b0a562), WORD(0x31cf00b3),
+	WORD(0xd5f031e3), WORD(0x9d126a89), WORD(0xe43482b6), WORD(0xb5bdbd1d),
+	WORD(0x632b6e31), WORD(0x00000184),
+	/* 35G */
+	WORD(0x8c3770c0), WORD(0xe4e66beb), WORD(0x6c6e081c), WORD(0x0a5aee64),
+	WORD(0x675497fb), WORD(0xc3047b59), WORD(0x11f72530), WORD(0x427ed3a0),
+	WORD(0x95da4036), WORD(0x5ab7cb9c), WORD(0x5fe253c0), WORD(0x215ac9f0),
+	WORD(0xc95133d3), WORD(0x034f05d1), WORD(0x3c1cc5b1), WORD(0xbaa4b185),
+	WORD(0x0000003a), WORD(0xfa306f4b), WORD(0xf7920f03), WORD(0x269f58e9),
+	WORD(0xda113205), WORD(0xcbef5d26), WORD(0x917734f3), WORD(0xa12e1092),
+	WORD(0xc5e96380), WORD(0xa84d588b), WORD(0x2c8d18ed), WORD(0xe7a313cb),
+	WORD(0xb65aec2d), WORD(0xdfd28849), WORD(0x8f86186d), WORD(0xe60dc1a1),
+	WORD(0xfb563fe2), WORD(0x00000083),
+	/* 37G */
+	WORD(0xb7a513d9), WORD(0xacdaabd1), WORD(0x39f8d626), WORD(0xb5723c01),
+	WORD(0xf9463273), WORD(0x37704c06), WORD(0x02072c71), WORD(0xb1d1442b),
+	WORD(0xa4dea22b), WORD(0x7357ceab), WORD(0x2114f685), WORD(0xab60eacf),
+	WORD(0x33e1ae2e), WORD(0x1a96f6ac), WORD(0x389cf3cc), WORD(0x610c195b),
+	WORD(0x00000053), WORD(0x01d42dfb), WORD(0xc1ca7d95), WORD(0x4b1895fc),
+	WORD(0x202b4c41), WORD(0xe198d25f), WORD(0x24cad02b), WORD(0xc0dc2e2b),
+	WORD(0x1238e41f), WORD(0x82ee5ede), WORD(0xd35bcc89), WORD(0x2c9318be),
+	WORD(0xf90c32fc), WORD(0xc97f2737), WORD(0x12793658), WORD(0xa08625cb),
+	WORD(0x8101455b), WORD(0x0000010d),
+	/* 39G */
+	WORD(0xbe49282e), WORD(0x8cf719db), WORD(0xb385b820), WORD(0xea4041d7),
+	WORD(0xbcada7d0), WORD(0x1a72fd18), WORD(0xf15605fa), WORD(0x62c31350),
+	WORD(0x5392b586), WORD(0xb11ace37), WORD(0x391c6cfe), WORD(0xd24dadc8),
+	WORD(0x814f4b30), WORD(0x31ab524c), WORD(0x3aa93209), WORD(0x08fdd6b0),
+	WORD(0x0000007a), WORD(0xd3040a58), WORD(0x309145b0), WORD(0x55ec6e6e),
+	WORD(0xa5b4c720), WORD(0xb1790973), WORD(0x20aca273), WORD(0xd551e579),
+	WORD(0xff5cb412), WORD(0xa40c6e2c), WORD(0x2063486d), WORD(0xa66e0589),
+	WORD(0xd543cb0a), WORD(0xce3449bd), WORD(0x2035de9c), WORD(0x71b0154d),
+	WORD(0x6e399aee), WORD(0x000000b7),
+	/* 41G */
+	WORD(0x0f5d6850), WORD(0x4a93121c), WORD(0x7b470067), WORD(0xd2916615),
+	WORD(0xfd6efed0), WORD(0xeee414bd), WORD(0x67260461), WORD(0xf57a4ae6),
+	WORD(0x640b5c98), WORD(0x91c32530), WORD(0x5342dc2f), WORD(0xf25944cc),
+	WORD(0x12a95291), WORD(0xce944184), WORD(0x53b1f5fe), WORD(0xbcf42f12),
+	WORD(0x00000076), WORD(0x67ec25a5), WORD(0x07608147), WORD(0xf675f5bb),
+	WORD(0xac73f9d1), WORD(0x5efbaeeb), WORD(0x2a8fd147), WORD(0xed029537),
+	WORD(0x08f67993), WORD(0x88d9cf07), WORD(0x0d916410), WORD(0x1911ef41),
+	WORD(0xc074f72b), WORD(0xf3d5acf2), WORD(0xa1e51ccd), WORD(0x769b7909),
+	WORD(0x8c2af16a), WORD(0x0000016b),
+	/* 43G */
+	WORD(0xbf630052), WORD(0x419127a4), WORD(0x90389f18), WORD(0x17ef703e),
+	WORD(0xe528f85b), WORD(0x3d4d9ec2), WORD(0xeed1d3a7), WORD(0xbd76be9b),
+	WORD(0xcb7e3356), WORD(0xa21c7f51), WORD(0xd7c7787c), WORD(0x51760a0c),
+	WORD(0x503833c5), WORD(0x6c82a26c), WORD(0x7f6aa811), WORD(0xb2f62c72),
+	WORD(0x00000050), WORD(0xdfc2aeea), WORD(0x833b41d6), WORD(0x6944ac14),
+	WORD(0x97bb5b44), WORD(0xbd4a76dc), WORD(0x15aa3e70), WORD(0x78c996b0),
+	WORD(0x4c43cd8e), WORD(0xf633feb0), WORD(0xc0cf8d05), WORD(0x66bd181b),
+	WORD(0x8ed8e8a2), WORD(0x92133bf4), WORD(0x1e3d51df), WORD(0x4d75fbd4),
+	WORD(0x84cf3c43), WORD(0x0000010f),
+	/* 45G */
+	WORD(0x0d125a74), WORD(0x3007e4ae), WORD(0x625196f6), WORD(0x03db35b8),
+	WORD(0x87e14aa3), WORD(0xd672b81f), WORD(0x6cee4750), WORD(0xbefc50f9),
+	WORD(0x33bc8c4d), WORD(0xf1f8cb94), WORD(0x603d96fa), WORD(0xf9460a3e),
+	WORD(0x103d2c7b), WORD(0xc7ff95e0), WORD(0xdc3cacb5), WORD(0x56504f29),
+	WORD(0x000000c3), WORD(0xd4fa07b2), WORD(0xe6800481), WORD(0x27ca4c53),
+	WORD(0xec859bab), WORD(0x709a31fa), WORD(0x43cdf194), WORD(0x42f376cf),
+	WORD(0x401756d7), WORD(0x54dc6ad9), WORD(0x0dde6da0), WORD(0x209aac25),
+	WORD(0x21193844), WORD(0x3d8ac315), WORD(0x0f98a4fe), WORD(0x3ea6b561),
+	WORD(0x866c69c2), WORD(0x000000da),
+	/* 47G */
+	WORD(0x88abf8c7), WORD(0xe4d5eace), WORD(0xb397ed31), WORD(0x9868f65d),
+	WORD(0xb3052b50), WORD(0xd1d4e26e), WORD(0x564e773a), WORD(0x505cf491),
+	WORD(0x591c0c32), WORD(0x83638ee8), WORD(0xfc4b9198), WORD(0x138a019f),
+	WORD(0x1672727f), WORD(0x1f661ac4), WORD(0xafce7a84), WORD(0x8382457e),
+	WORD(0x000001c4), WORD(0xeb04be57), WORD(0x978ec870), WORD(0x9de9832e),
+	WORD(0xaccf8833), WORD(0xf388e520), WORD(0x7a3c6c12), WORD(0x5375dbb0),
+	WORD(0x05c824c1), WORD(0x4bc93b04), WORD(0x993b7832), WORD(0xc476753f),
+	WORD(0xc9a4904f), WORD(0x4d302f83), WORD(0x5ddaa7fb), WORD(0x4eda1486),
+	WORD(0x32b93aff), WORD(0x000000e4),
+	/* 49G */
+	WORD(0x56a972e6), WORD(0x2824f7e0), WORD(0x6506465a), WORD(0x58d62602),
+	WORD(0xd4392c6d), WORD(0x27171a2f), WORD(0x2148ec64), WORD(0x6fa97b14),
+	WORD(0xf5b5e151), WORD(0x5888ef54), WORD(0x1cfac0dc), WORD(0xa3d724cc),
+	WORD(0x69cea2e1), WORD(0x31ddd5d0), WORD(0xabe5d205), WORD(0x1e05c60e),
+	WORD(0x0000007d), WORD(0x5a057725), WORD(0x35164442), WORD(0x8e85cdfa),
+	WORD(0xdfd85c45), WORD(0xda25cb1f), WORD(0x6775db95), WORD(0xe1060879),
+	WORD(0xaaa1eaba), WORD(0xc1aeecbb), WORD(0xceced45f), WORD(0xbf583961),
+	WORD(0x33c3bf2d), WORD(0x8dba4f72), WORD(0x0dfb970a), WORD(0xcb8a04d8),
+	WORD(0xa0486bbd), WORD(0x000000b2),
+	/* 51G */
+	WORD(0x825a0e56), WORD(0x7ffde64a), WORD(0x6ed46c8b), WORD(0xf78ebdf1),
+	WORD(0xe07dd344), WORD(0x0d882a65), WORD(0x6f8990d7), WORD(0x357839c8),
+	WORD(0x136176ff), WORD(0x65fcdf75), WORD(0xdd1dd18b), WORD(0xdef1a7f4),
+	WORD(0xe67efcfa), WORD(0xdb40a2f9), WORD(0xd1012ec9), WORD(0x8f13c20a),
+	WORD(0x000001d2), WORD(0x3d9c7304), WORD(0x2f6eae04), WORD(0x0c475ce2),
+	WORD(0x5f69d44f), WORD(0xd2830055), WORD(0x04b71d75), WORD(0x06424e1b),
+	WORD(0xb45d6db0), WORD(0x9e4bde15), WORD(0xba56f5cd), WORD(0x671272d8),
+	WORD(0xc790e240), WORD(0xbca96ec3), WORD(0x8ca169fa), WORD(0x2b1ceca9),
+	WORD(0xe5020d12), WORD(0x00000079),
+	/* 53G */
+	WORD(0x8350fdb8), WORD(0x26665b4c), WORD(0x0b3142b4), WORD(0xd4e4c404),
+	WORD(0x95840a9e), WORD(0x0fdd27f0), WORD(0xc769d7ac), WORD(0x31b904d3),
+	WORD(0x62271087), WORD(0xb7ca4080), WORD(0xdb93f417), WORD(0xf48b44af),
+	WORD(0x6ffc3445), WORD(0xfe988183), WORD(0xfbbd9e87), WORD(0x8caf7349),
+	WORD(0x00000124), WORD(0x30c14fa3), WORD(0x6eea063c), WORD(0x357eb6ed),
+	WORD(0xfde255f7), WORD(0xc602051e), WORD(0x4ef1da67), WORD(0xd987b53d),
+	WORD(0x7a81e79d), WORD(0x58a7efb2), WORD(0x4029e886), WORD(0xb49aa1bf),
+	WORD(0xeef21610), WORD(0xc3bee39f), WORD(0x012ba884), WORD(0x3a62b08d),
+	WORD(0x4b0c7595), WORD(0x000001e6),
+	/* 55G */
+	WORD(0xaf12d4bf), WORD(0x675ea387), WORD(0x274256be), WORD(0xa5ed4b56),
+	WORD(0x4d3ff4d5), WORD(0x358f05aa), WORD(0xf35f0ba4), WORD(0xc8be5693),
+	WORD(0xd0c66549), WORD(0x014746d0), WORD(0xceb2396a), WORD(0x4fece853),
+	WORD(0x54be581f), WORD(0x0aae36d6), WORD(0xe25aa8f2), WORD(0xb6988673),
+	WORD(0x00000025), WORD(0x790d6179), WORD(0x691851b7), WORD(0x753d0cb6),
+	WORD(0x1803504b), WORD(0xc37d01d1), WORD(0xf1a2da9a), WORD(0x266b4b04),
+	WORD(0xc4ae2d04), WORD(0xaa885542), WORD(0xa53edd70), WORD(0x5b007d88),
+	WORD(0x188d0b50), WORD(0x9730cfa2), WORD(0xc83d0d3d), WORD(0x109c2f53),
+	WORD(0xf40a30d7), WORD(0x000000a7),
+	/* 57G */
+	WORD(0xf13714f0), WORD(0x85274d09), WORD(0x281a3a99), WORD(0x7ffcae42),
+	WORD(0x9041b964), WORD(0xde325c52), WORD(0x597b37ea), WORD(0x5def488c),
+	WORD(0xfc257980), WORD(0xbbd290dc), WORD(0xc2f79e36), WORD(0xf39736df),
+	WORD(0xfd2d46f7), WORD(0x3af7d92f), WORD(0x702231ed), WORD(0xfe79e481),
+	WORD(0x000001f3), WORD(0x479d3a23), WORD(0xbfece212), WORD(0x9919d6bf),
+	WORD(0xc863152a), WORD(0xb9d4a498), WORD(0x02b5494f), WORD(0x35251fc1),
+	WORD(0x86869dec), WORD(0xf51a4129), WORD(0x59c86ff9), WORD(0xc4db173f),
+	WORD(0xe9657cec), WORD(0x7bd89e86), WORD(0x73626a7c), WORD(0x95b4039f),
+	WORD(0x6a7edecc), WORD(0x000001e6),
+	/* 59G */
+	WORD(0x358d6bad), WORD(0x13758b34), WORD(0x4431df45), WORD(0x2761a390),
+	WORD(0x4565d429), WORD(0x16b21b9d), WORD(0x348d481a), WORD(0xe4d89a26),
+	WORD(0x9002ab49), WORD(0x49a61114), WORD(0xccd572e1), WORD(0x2ecc480c),
+	WORD(0x56e3911e), WORD(0x1a16f94f), WORD(0xb9831e30), WORD(0x5698c3b3),
+	WORD(0x0000002a), WORD(0x17061fb2), WORD(0x1e29c0fd), WORD(0x8d67a550),
+	WORD(0xc67d7ff2), WORD(0x61fec161), WORD(0xeeeb27ff), WORD(0x5c64feaf),
+	WORD(0x225e41e8), WORD(0xa2dc67c6), WORD(0x79e5b77e), WORD(0xfa711797),
+	WORD(0xd9b30481), WORD(0x3f8ad246), WORD(0x5057f8dd), WORD(0xda6d8586),
+	WORD(0x0a3f3f21), WORD(0x000001f6),
+	/* 61G */
+	WORD(0x50c55513), WORD(0x67e7e1bb), WORD(0x20e5a9ec), WORD(0x8b38aa1e),
+	WORD(0x6bca95d6), WORD(0x72cd3d99), WORD(0x9cd2f3fe), WORD(0x8d3bee05),
+	WORD(0x8bb8c9e0), WORD(0x58df458b), WORD(0x8d266b92), WORD(0xbeadb306),
+	WORD(0xc7c5b668), WORD(0x39950e3e), WORD(0x2e49653e), WORD(0x008a03a1),
+	WORD(0x00000025), WORD(0x25c54f7e), WORD(0x66a50bb0), WORD(0x125c77fc),
+	WORD(0x74e1ff2f), WORD(0x95ab7917), WORD(0xb01d7d01), WORD(0xd4541a7f),
+	WORD(0xaa5bfaa9), WORD(0x5001fbc6), WORD(0x1d76ac63), WORD(0x5ff604bd),
+	WORD(0x2ff7a116), WORD(0x963cd7a4), WORD(0x951cce43), WORD(0xd983ccb6),
+	WORD(0x60563242), WORD(0x000000e3),
+	/* 63G */
+	WORD(0x72f04c9d), WORD(0xb7e74444), WORD(0x4687adf5), WORD(0x812bb856),
+	WORD(0x2f3ad7be), WORD(0x423ac313), WORD(0x2f631ccb), WORD(0x30984709),
+	WORD(0x229d74cb), WORD(0xf26a8d84), WORD(0xe0f3faa7), WORD(0xad7fd06e),
+	WORD(0x470e510d), WORD(0xcd658537), WORD(0xbff417bc), WORD(0xb2320622),
+	WORD(0x0000009d), WORD(0x0ad4d1f8), WORD(0x69501edd), WORD(0x5674e8ad),
+	WORD(0xadfb3251), WORD(0x41d7b2bd), WORD(0xc1780389), WORD(0x5e09fbc7),
+	WORD(0xee760c4b), WORD(0xc002e9ed), WORD(0x1a9d5111), WORD(0x032caf46),
+	WORD(0x994320a0), WORD(0xcb0d4f04), WORD(0x44d902eb), WORD(0x0bb6c0d6),
+	WORD(0x0cbd029c), WORD(0x000000c2),
+};
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+static const word_t secp521r1_gen_wnaf[] = {
+	/* G */
+	WORD(0xb331), WORD(0x72de), WORD(0x18e1), WORD(0xbf3f), WORD(0x4dfc), WORD(0xb521),
+	WORD(0xe0c2), WORD(0xa459), WORD(0x6f19), WORD(0x7fd4), WORD(0x93d1), WORD(0x0ee0),
+	WORD(0x947f), WORD(0xf3ac), WORD(0x3bf7), WORD(0xa5af), WORD(0xdd50), WORD(0xa69e),
+	WORD(0xb035), WORD(0x1457), WORD(0x90fc), WORD(0x9fda), WORD(0x9c82), WORD(0x3240),
+	WORD(0x214e), WORD(0xcada), WORD(0xb311), WORD(0x1f65), WORD(0xe6cf), WORD(0x0274),
+	WORD(0x5b82), WORD(0xc703), WORD(0x0142), WORD(0x2846), WORD(0xe8b3), WORD(0x3b4f),
+	WORD(0x5f4a), WORD(0x2044), WORD(0x3961), WORD(0x4351), WORD(0x9e38), WORD(0xb09a),
+	WORD(0xd683), WORD(0x809f), WORD(0xa85c), WORD(0x2062), WORD(0x7a13), WORD(0x4caf),
+	WORD(0xf739), WORD(0x164b), WORD(0x9f33), WORD(0x8b93), WORD(0xd7de), WORD(0x340b),
+	WORD(0xcda2), WORD(0x24ab), WORD(0x7aa2), WORD(0xeccc), WORD(0x3e8d), WORD(0xda16),
+	WORD(0x452f), WORD(0x022e), WORD(0x1de0), WORD(0x3c4d), WORD(0x94b5), WORD(0x001c),
+	/* 3G */
+	WORD(0xbee9), WORD(0x1bd6), WORD(0x976f), WORD(0xc8ce), WORD(0x02d2), WORD(0x1975),
+	WORD(0x4316), WORD(0x5a48), WORD(0x0dd7), WORD(0xcff1), WORD(0x8b5a), WORD(0xd35e),
+	WORD(0x028e), WORD(0x2419), WORD(0x251d), WORD(0x9f8b), WORD(0xe8d6), WORD(0xbd46),
+	WORD(0x0896), WORD(0xd6bd), WORD(0x5cf2), WORD(0x1ecd), WORD(0x2d89), WORD(0x9537),
+	WORD(0x3cda), WORD(0xcaca), WORD(0x325a), WORD(0x8eb5), WORD(0xaeec), WORD(0x148c),
+	WORD(0x21ef), WORD(0x9a92), WORD(0x019e), WORD(0x72cf), WORD(0x4360), WORD(0x50f7),
+	WORD(0xac46), WORD(0x212f), WORD(0xd2c8), WORD(0xde49), WORD(0x82e4), WORD(0x8678),
+	WORD(0x61e3), WORD(0x68ef), WORD(0xad67), WORD(0xd816), WORD(0xe2ba), WORD(0x67c6),
+	WORD(0x16ea), WORD(0x7617), WORD(0xaae7), WORD(0x8fd1), WORD(0x7c55), WORD(0x8be9),
+	WORD(0x4e81), WORD(0xd415), WORD(0xaabf), WORD(0x7978), WORD(0x5c0a), WORD(0x6365),
+	WORD(0xcfc3), WORD(0xeccb), WORD(0x316e), WORD(0xbefd), WORD(0x81dc), WORD(0x014d),
+	/* 5G */
+	WORD(0x3c19), WORD(0x4798), WORD(0x4b76), WORD(0xd5a8), WORD(0x9c6a), WORD(0x498b),
+	WORD(0xf36c), WORD(0xebf0), WORD(0xd194), WORD(0xbf3c), WORD(0x5789), WORD(0x897f),
+	WORD(0x11b8), WORD(0x180a), WORD(0x36af), WORD(0x1e06), WORD(0x721c), WORD(0xbbd6),
+	WORD(0x5c78), WORD(0x81ed), WORD(0x9267), WORD(0x9f86), WORD(0x7eda), WORD(0x2cb7),
+	WORD(0x5fbd), WORD(0x2758), WORD(0xc8e0), WORD(0xde19), WORD(0x639e), WORD(0xd219),
+	WORD(0x9493), WORD(0xf9e2), WORD(0x0095), WORD(0x65d6), WORD(0x5848), WORD(0xf46f),
+	WORD(0x9e61), WORD(0xfc0b), WORD(0xaa7b), WORD(0x92b9), WORD(0xf803), WORD(0xbce8),
+	WORD(0x7aff), WORD(0x108e), WORD(0x8aa0), WORD(0xba18), WORD(0x9679), WORD(0xe483),
+	WORD(0xb44b), WORD(0x43dd), WORD(0x1a38), WORD(0xe4d0), WORD(0xec0b), WORD(0x28f6),
+	WORD(0x9700), WORD(0x4743), WORD(0x6c7f), WORD(0x488e), WORD(0x4089), WORD(0x88a5),
+	WORD(0x15b9), WORD(0x7645), WORD(0x00eb), WORD(0xeeb3), WORD(0x778d), WORD(0x01f3),
+	/* 7G */
+	WORD(0x6a15), WORD(0x0b76), WORD(0xc414), WORD(0xe756), WORD(0xcd00), WORD(0xe130),
+	WORD(0xa87e), WORD(0xca9f), WORD(0xe237), WORD(0x71dd), WORD(0x986e), WORD(0xd36f),
+	WORD(0x6c64), WORD(0xe34c), WORD(0x855f), WORD(0x1846), WORD(0x2ec6), WORD(0x88a6),
+	WORD(0x617b), WORD(0x0c69), WORD(0x1478), WORD(0xa419), WORD(0x747a), WORD(0x9170),
+	WORD(0x062f), WORD(0x839d), WORD(0xed05), WORD(0x5b2f), WORD(0xa377), WORD(0xbfb1),
+	WORD(0xcead), WORD(0xe8ec), WORD(0x016a), WORD(0x8d8f), WORD(0x9292), WORD(0xe482),
+	WORD(0x35c5), WORD(0x3dae), WORD(0xef7e), WORD(0x952e), WORD(0x3b38), WORD(0x2fcf),
+	WORD(0xe70d), WORD(0xa2c8), WORD(0x91d1), WORD(0x15ca), WORD(0xf64f), WORD(0x49e6),
+	WORD(0xe879), WORD(0x2ab5), WORD(0x65ef), WORD(0xc513), WORD(0xedec), WORD(0x6eb8),
+	WORD(0x1278), WORD(0x6814), WORD(0xe2c1), WORD(0x3c5a), WORD(0xeb42), WORD(0xbd1c),
+	WORD(0xec18), WORD(0x8868), WORD(0x5150), WORD(0xcdd5), WORD(0x8dbe), WORD(0x0096),
+	/* 9G */
+	WORD(0x03d6), WORD(0xe5f1), WORD(0x3cb3), WORD(0xa2b1), WORD(0x330f), WORD(0xe694),
+	WORD(0x5ec2), WORD(0xa85d), WORD(0xc7a7), WORD(0x2d18), WORD(0x6fb9), WORD(0xe2ab),
+	WORD(0x1af9), WORD(0x9a6d), WORD(0x9cb0), WORD(0x14f0), WORD(0x32ba), WORD(0x635b),
+	WORD(0xa2dc), WORD(0x2558), WORD(0x4c96), WORD(0x43a3), WORD(0x0dcc), WORD(0x9a2a),
+	WORD(0x4476), WORD(0xab6a), WORD(0x8ab8), WORD(0x7adf), WORD(0x1351), WORD(0xf10c),
+	WORD(0xacf0), WORD(0xc4f1), WORD(0x0029), WORD(0x270a), WORD(0xd695), WORD(0x435c),
+	WORD(0x5075), WORD(0x9a1d), WORD(0x4407), WORD(0x7494), WORD(0xb615), WORD(0x3eb9),
+	WORD(0x5fec), WORD(0x67a5), WORD(0xfab7), WORD(0x4207), WORD(0x2bd6), WORD(0xbab0),
+	WORD(0xb4f2), WORD(0x3706), WORD(0xeda2), WORD(0x131e), WORD(0x12dd), WORD(0xdb64),
+	WORD(0x0e75), WORD(0x2a77), WORD(0x4453), WORD(0xc718), WORD(0xd749), WORD(0xbd13),
+	WORD(0xaaaa), WORD(0xcf85), WORD(0x76f9), WORD(0x4d45), WORD(0x30c6), WORD(0x0117),
+	/* 11G */
+	WORD(0xcd22), WORD(0x066d), WORD(0x16ed), WORD(0x6070), WORD(0x8176), WORD(0x64d4),
+	WORD(0x27d2), WORD(0xae01), WORD(0x4280), WORD(0x8c88), WORD(0x75f1), WORD(0xcd8d),
+	WORD(0x0de8), WORD(0x31ed), WORD(0x9993), WORD(0xede2), WORD(0x2979), WORD(0x4c8b),
+	WORD(0x2a79), WORD(0xf796), WORD(0x4aa1), WORD(0x0bc2), WORD(0xf6be), WORD(0xaee3),
+	WORD(0xe7f6), WORD(0xa18a), WORD(0xab9d), WORD(0x8d1c), WORD(0xaa37), WORD(0xf6ff),
+	WORD(0x2cfe), WORD(0xc209), WORD(0x013a), WORD(0x0425), WORD(0x2464), WORD(0xc967),
+	WORD(0x43a7), WORD(0xaeac), WORD(0x40cd), WORD(0x71fa), WORD(0x5640), WORD(0x9b6e),
+	WORD(0x54a9), WORD(0x8c8a), WORD(0x4919), WORD(0x559c), WORD(0xa152), WORD(0x8745),
+	WORD(0xe454), WORD(0x158d), WORD(0x5cdc), WORD(0xea70), WORD(0x974a), WORD(0x49f6),
+	WORD(0x5e82), WORD(0x3108), WORD(0x6eab), WORD(0x149d), WORD(0xa7d9), WORD(0x3b82),
+	WORD(0x8654), WORD(0xc24e), WORD(0x1094), WORD(0xe5dd), WORD(0x981f), WORD(0x017d),
+	/* 13G */
+	WORD(0xd39f), WORD(0x7de6), WORD(0x4699), WORD(0x43c2), WORD(0xfc0c), WORD(0x9c77),
+	WORD(0x8055), WORD(0xf61d), WORD(0x74a5), WORD(0x5c47), WORD(0xf3cd), WORD(0xa852),
+	WORD(0xb51a), WORD(0x1e4c), WORD(0x8470), WORD(0x622c), WORD(0x3099), WORD(0xadc3),
+	WORD(0x5f57), WORD(0x76e9), WORD(0x1c27), WORD(0xda61), WORD(0x66f0), WORD(0xfb9b),
+	WORD(0x0d49), WORD(0x9243), WORD(0x95a4), WORD(0xc32e), WORD(0xce6b), WORD(0xcb56),
+	WORD(0xc261), WORD(0x4c7c), WORD(0x011f), WORD(0xe4c2), WORD(0x1538), WORD(0xfd81),
+	WORD(0x8d00), WORD(0xfb94), WORD(0x8bf4), WORD(0x57c8), WORD(0xccf5), WORD(0xe1b0),
+	WORD(0x5fdd), WORD(0x9a8e), WORD(0x6fee), WORD(0x1f93), WORD(0x5e3b), WORD(0xac1c),
+	WORD(0xdeae), WORD(0x9560), WORD(0x0f10), WORD(0xd72e), WORD(0x3d33), WORD(0xe34e),
+	WORD(0xaa10), WORD(0x1c36), WORD(0x6a85), WORD(0x0467), WORD(0xf6ad), WORD(0x6d51),
+	WORD(0x0c93), WORD(0xd48d), WORD(0x0ff6), WORD(0xb6bc), WORD(0x2c75), WORD(0x0077),
+	/* 15G */
+	WORD(0xaa9a), WORD(0x5c6d), WORD(0x9bde), WORD(0xd7f1), WORD(0x5ef4), WORD(0x1fc9),
+	WORD(0x4c0f), WORD(0xc6cb), WORD(0x8ecd), WORD(0xe019), WORD(0x8e47), WORD(0x3ade),
+	WORD(0xff3c), WORD(0xe807), WORD(0x13ed), WORD(0x8e67), WORD(0x08dc), WORD(0x8947),
+	WORD(0x996f), WORD(0x4bda), WORD(0x296b), WORD(0x0504), WORD(0x185a), WORD(0x7de6),
+	WORD(0x07dc), WORD(0x6a18), WORD(0xe2a3), WORD(0xaac7), WORD(0xf820), WORD(0x9232),
+	WORD(0x5e5c), WORD(0x6c4d), WORD(0x01b5), WORD(0x32ed), WORD(0xa3aa), WORD(0x4050),
+	WORD(0x1a1a), WORD(0xecab), WORD(0x355e), WORD(0x6622), WORD(0x7ec8), WORD(0xc923),
+	WORD(0x4b64), WORD(0x1196), WORD(0xa471), WORD(0x4010), WORD(0xa385), WORD(0x644c),
+	WORD(0x4831), WORD(0x6abf), WORD(0xa42f), WORD(0x34cb), WORD(0xb108), WORD(0x5d25),
+	WORD(0x6906), WORD(0x54dd), WORD(0x824b), WORD(0xb1ef), WORD(0xf6df), WORD(0x9199),
+	WORD(0x7326), WORD(0xb53e), WORD(0x9c8e), WORD(0x8ab8), WORD(0x6d13), WORD(0x0034),
+	/* 17G */
+	WORD(0x706c), WORD(0x8885), WORD(0xd429), WORD(0x7c0b), WORD(0x083b), WORD(0x68d2),
+	WORD(0x1578), WORD(0x6182), WORD(0x07fc), WORD(0x409c), WORD(0xcdab), WORD(0xa73c),
+	WORD(0x43ef), WORD(0x7f01), WORD(0xf33a), WORD(0x0534), WORD(0x2c3b), WORD(0x9284),
+	WORD(0x7934), WORD(0x3292), WORD(0xda6b), WORD(0xd159), WORD(0x134f), WORD(0xf74f),
+	WORD(0x354c), WORD(0x91c8), WORD(0x322c), WORD(0x5c3a), WORD(0x09d0), WORD(0x876d),
+	WORD(0x3f89), WORD(0xedb8), WORD(0x0006), WORD(0x23a1), WORD(0x7323), WORD(0xbe38),
+	WORD(0xdce5), WORD(0xfa9a), WORD(0x5baa), WORD(0xca61), WORD(0x482a), WORD(0x1073),
+	WORD(0x56fa), WORD(0xbf8b), WORD(0x7b3a), WORD(0xf869), WORD(0x6e85), WORD(0x277b),
+	WORD(0xed2b), WORD(0x1efc), WORD(0x5099), WORD(0x1591), WORD(0xb456), WORD(0x54c6),
+	WORD(0x4c88), WORD(0xa67b), WORD(0xcca9), WORD(0x835b), WORD(0x6ee8), WORD(0x7257),
+	WORD(0x88ea), WORD(0x6de0), WORD(0xb2bb), WORD(0xbed8), WORD(0x1f8e), WORD(0x00b4),
+	/* 19G */
+	WORD(0xcda6), WORD(0x6b50), WORD(0x920c), WORD(0x7f85), WORD(0xf23c), WORD(0x2dde),
+	WORD(0x8f39), WORD(0x67a1), WORD(0x86ff), WORD(0x22cb), WORD(0xbebd), WORD(0x192a),
+	WORD(0xb3c9), WORD(0x1334), WORD(0x4b1b), WORD(0x1d98), WORD(0xf8fd), WORD(0xc873),
+	WORD(0x6d9b), WORD(0xf856), WORD(0x3f7f), WORD(0xefaa), WORD(0x03aa), WORD(0xdbbf),
+	WORD(0x3922), WORD(0xd0d0), WORD(0x616a), WORD(0x7ca4), WORD(0x43e0), WORD(0xce1a),
+	WORD(0x4320), WORD(0xe672), WORD(0x00c6), WORD(0xbacd), WORD(0xfe82), WORD(0x34ad),
+	WORD(0x848d), WORD(0x2254), WORD(0xfdff), WORD(0x4f54), WORD(0xd26c), WORD(0xbbfa),
+	WORD(0x18e1), WORD(0xcc8b), WORD(0x761c), WORD(0x7cd8), WORD(0x75c6), WORD(0x1ff9),
+	WORD(0xd6cb), WORD(0x93b9), WORD(0xa2bb), WORD(0x71b2), WORD(0x2877), WORD(0xa566),
+	WORD(0xbde7), WORD(0x7715), WORD(0xe945), WORD(0x2eb3), WORD(0xad92), WORD(0x4ba9),
+	WORD(0xca12), WORD(0xae61), WORD(0x10f6), WORD(0x1350), WORD(0xed03), WORD(0x01ea),
+	/* 21G */
+	WORD(0xf6e8), WORD(0xe464), WORD(0xcb49), WORD(0x779c), WORD(0x96a1), WORD(0xd236),
+	WORD(0x01c9), WORD(0xd649), WORD(0xad9b), WORD(0x13eb), WORD(0x576c), WORD(0xa4bf),
+	WORD(0x84ec), WORD(0xb151), WORD(0x5726), WORD(0x12bf), WORD(0xd4a3), WORD(0x233f),
+	WORD(0x3ace), WORD(0xa91f), WORD(0x4c0c), WORD(0x68af), WORD(0xc617), WORD(0x45dc),
+	WORD(0x8813), WORD(0xf69d), WORD(0x842c), WORD(0x642a), WORD(0x7d9e), WORD(0x15e9),
+	WORD(0x8d3a), WORD(0xd960), WORD(0x00e5), WORD(0xfac6), WORD(0x5d26), WORD(0x1e4e),
+	WORD(0x05e2), WORD(0xb0f3), WORD(0x4e65), WORD(0x8bb2), WORD(0x4d87), WORD(0x62be),
+	WORD(0x31f7), WORD(0x1b96), WORD(0x5a1d), WORD(0x4adf), WORD(0x2419), WORD(0x29ed),
+	WORD(0xba0d), WORD(0xfbef), WORD(0xd7d3), WORD(0xb7b5), WORD(0x0514), WORD(0x360c),
+	WORD(0x8c9f), WORD(0x2ce2), WORD(0x1e00), WORD(0x3174), WORD(0x2067), WORD(0x3e2f),
+	WORD(0x096d), WORD(0xa416), WORD(0x759e), WORD(0xa7c7), WORD(0x4ebe), WORD(0x0110),
+	/* 23G */
+	WORD(0xae6b), WORD(0x57a9), WORD(0xf671), WORD(0xe352), WORD(0x0350), WORD(0x572c),
+	WORD(0xd613), WORD(0xf0f8), WORD(0xf103), WORD(0xf629), WORD(0x74d2), WORD(0xf1fc),
+	WORD(0x57f4), WORD(0x7ad8), WORD(0xfe4d), WORD(0xb7c1), WORD(0x880f), WORD(0x6ea2),
+	WORD(0xa686), WORD(0x8691), WORD(0x4124), WORD(0x2fd9), WORD(0xdd3c), WORD(0x3d1c),
+	WORD(0xc777), WORD(0xaa3d), WORD(0x762f), WORD(0x8e56), WORD(0xbb6d), WORD(0x0ac9),
+	WORD(0xb948), WORD(0x93ae), WORD(0x0105), WORD(0x003c), WORD(0xd068), WORD(0xa9b7),
+	WORD(0x0ae1), WORD(0x2b6c), WORD(0x691c), WORD(0x2854), WORD(0x9da2), WORD(0x6110),
+	WORD(0x3ee8), WORD(0x3dd8), WORD(0x13d9), WORD(0x7a1e), WORD(0x4bfe), WORD(0xb0f7),
+	WORD(0x4219), WORD(0x0708), WORD(0x616e), WORD(0x3c22), WORD(0x18b2), WORD(0x195a),
+	WORD(0x682c), WORD(0xfc48), WORD(0xbacf), WORD(0x8e3e), WORD(0x3423), WORD(0xc7e0),
+	WORD(0x5142), WORD(0x0334), WORD(0xc29c), WORD(0x2f29), WORD(0xbd41), WORD(0x0164),
+	/* 25G */
+	WORD(0x7055), WORD(0xb856), WORD(0x305f), WORD(0xc612), WORD(0xd89f), WORD(0x2e9f),
+	WORD(0x58e1), WORD(0x0f07), WORD(0x93f2), WORD(0x247f), WORD(0x1553), WORD(0x743f),
+	WORD(0x26ab), WORD(0x1b77), WORD(0x48be), WORD(0x8c2b), WORD(0xa554), WORD(0x4ccc),
+	WORD(0x462a), WORD(0x3b96), WORD(0xd88e), WORD(0xd883), WORD(0x1328), WORD(0x3988),
+	WORD(0xe900), WORD(0xeffc), WORD(0x537a), WORD(0xac3a), WORD(0x1a51), WORD(0x4d0c),
+	WORD(0xae2d), WORD(0x2636), WORD(0x0074), WORD(0x1833), WORD(0x63c1), WORD(0x7202),
+	WORD(0x92de), WORD(0xb6a1), WORD(0x9735), WORD(0x2a33), WORD(0x6f15), WORD(0x7af7),
+	WORD(0x2cb9), WORD(0x8535), WORD(0xf11b), WORD(0xd068), WORD(0x7de0), WORD(0x1ab9),
+	WORD(0x71aa), WORD(0x536f), WORD(0x8b33), WORD(0x440a), WORD(0x3614), WORD(0x63fb),
+	WORD(0x1150), WORD(0xf580), WORD(0xd491), WORD(0x9f8a), WORD(0xdb06), WORD(0x7c05),
+	WORD(0x1514), WORD(0x9d71), WORD(0x8823), WORD(0x8b8c), WORD(0xee74), WORD(0x0087),
+	/* 27G */
+	WORD(0x45d8), WORD(0x016b), WORD(0x80b8), WORD(0xbb21), WORD(0xb41a), WORD(0x7622),
+	WORD(0x2249), WORD(0x0ab0), WORD(0x1e59), WORD(0x698b), WORD(0x76d0), WORD(0x9a9d),
+	WORD(0x41a8), WORD(0x8cea), WORD(0x1ed3), WORD(0x5909), WORD(0xa6c0), WORD(0x9ac2),
+	WORD(0xc3f0), WORD(0xf9a8), WORD(0x1619), WORD(0x27c3), WORD(0xae87), WORD(0x9ca9),
+	WORD(0x37c3), WORD(0x4f32), WORD(0x75c4), WORD(0x526a), WORD(0x53b1), WORD(0x7cdb),
+	WORD(0xc10c), WORD(0x9f6f), WORD(0x001b), WORD(0xa03c), WORD(0xc85b), WORD(0x652e),
+	WORD(0xf357), WORD(0x59f9), WORD(0xa2d6), WORD(0x384e), WORD(0x1fff), WORD(0x9723),
+	WORD(0x5dab), WORD(0x7a54), WORD(0xdc3a), WORD(0x2a09), WORD(0x975e), WORD(0x8f6c),
+	WORD(0x7d24), WORD(0x008f), WORD(0x0d91), WORD(0xc70d), WORD(0x2b7b), WORD(0xdda5),
+	WORD(0xa961), WORD(0xe2e7), WORD(0xe8c9), WORD(0xfd4f), WORD(0x0351), WORD(0x00d6),
+	WORD(0xc142), WORD(0xe2f2), WORD(0xe7f0), WORD(0x00a6), WORD(0xb828), WORD(0x00ac),
+	/* 29G */
+	WORD(0xee5d), WORD(0x6d12), WORD(0xb0c7), WORD(0x1c93), WORD(0xcb16), WORD(0x8fb6),
+	WORD(0xcaea), WORD(0x9ec2), WORD(0xcf79), WORD(0x3ffd), WORD(0xc742), WORD(0x01d5),
+	WORD(0x48a0), WORD(0xb6b9), WORD(0x0343), WORD(0x54de), WORD(0x982e), WORD(0x3250),
+	WORD(0xc7bb), WORD(0x5f79), WORD(0xf614), WORD(0x3132), WORD(0x98f4), WORD(0xfa28),
+	WORD(0x2ffc), WORD(0x2d04), WORD(0xfe5b), WORD(0xe0fd), WORD(0x3ed9), WORD(0xb414),
+	WORD(0x64a5), WORD(0x226b), WORD(0x0063), WORD(0x1846), WORD(0x0d06), WORD(0xe241),
+	WORD(0x3ddd), WORD(0xde8c), WORD(0x75df), WORD(0x3e13), WORD(0x3cc9), WORD(0x1f83),
+	WORD(0x3698), WORD(0x96b8), WORD(0x6139), WORD(0x85a8), WORD(0x706c), WORD(0xca96),
+	WORD(0x0710), WORD(0x5bdf), WORD(0xd69a), WORD(0x5bca), WORD(0xe7af), WORD(0xfe5a),
+	WORD(0xb220), WORD(0xc7e5), WORD(0x19f7), WORD(0xc101), WORD(0xdbdb), WORD(0xada0),
+	WORD(0xd664), WORD(0x3402), WORD(0xa0cf), WORD(0x7c3f), WORD(0xd3e1), WORD(0x0179),
+	/* 31G */
+	WORD(0x01b6), WORD(0xb544), WORD(0x7060), WORD(0x2be8), WORD(0x0911), WORD(0x7124),
+	WORD(0xf244), WORD(0xe7da), WORD(0x9106), WORD(0xe6b5), WORD(0xd604), WORD(0x0a60),
+	WORD(0x14fe), WORD(0x64ea), WORD(0xd482), WORD(0x2aa1), WORD(0x366b), WORD(0xf3b9),
+	WORD(0x1e52), WORD(0x3054), WORD(0x30b9), WORD(0xe153), WORD(0x4b2b), WORD(0xba2c),
+	WORD(0xbeda), WORD(0x983d), WORD(0x66db), WORD(0x352c), WORD(0x0a80), WORD(0x8633),
+	WORD(0x7987), WORD(0xc906), WORD(0x0074), WORD(0x8cc9), WORD(0xbc96), WORD(0xe39c),
+	WORD(0x233b), WORD(0xc565), WORD(0xaa18), WORD(0xbe3d), WORD(0x0dec), WORD(0x31d5),
+	WORD(0x2661), WORD(0x4657), WORD(0xcd43), WORD(0xc809), WORD(0x68a3), WORD(0x1922),
+	WORD(0xb5c6), WORD(0x187b), WORD(0x68d5), WORD(0x965f), WORD(0x77db), WORD(0x0305),
+	WORD(0x8864), WORD(0x1947), WORD(0xaa03), WORD(0x7645), WORD(0xa518), WORD(0x9d10),
+	WORD(0x84e0), WORD(0xc3ef), WORD(0x331c), WORD(0xa2a5), WORD(0x11da), WORD(0x01d8),
+	/* 33G */
+	WORD(0x468a), WORD(0x4f98), WORD(0xfe32), WORD(0x5170), WORD(0x96af), WORD(0x9768),
+	WORD(0x8c35), WORD(0xf62c), WORD(0x6152), WORD(0x529d), WORD(0xd2bd), WORD(0xd28c),
+	WORD(0x8d74), WORD(0xbbf7), WORD(0x3f15), WORD(0xedf5), WORD(0xf855), WORD(0x11b6),
+	WORD(0x0d3a), WORD(0xc0a1), WORD(0x09f9), WORD(0xf493), WORD(0xa415), WORD(0x0436),
+	WORD(0xc729), WORD(0x3b7a), WORD(0xa71e), WORD(0x3b75), WORD(0xf346), WORD(0xdcb4),
+	WORD(0x4bc7), WORD(0xcaf8), WORD(0x0020), WORD(0x269f), WORD(0xf08e), WORD(0x1ee9),
+	WORD(0xf4ad), WORD(0x79b5), WORD(0x45ac), WORD(0xae11), WORD(0x77fe), WORD(0x9d44),
+	WORD(0xb6f5), WORD(0x0b60), WORD(0x5eb9), WORD(0x5f80), WORD(0xe89c), WORD(0x65f9),
+	WORD(0xb2b7), WORD(0xf973), WORD(0xa562), WORD(0xb4b0), WORD(0x00b3), WORD(0x31cf),
+	WORD(0x31e3), WORD(0xd5f0), WORD(0x6a89), WORD(0x9d12), WORD(0x82b6), WORD(0xe434),
+	WORD(0xbd1d), WORD(0xb5bd), WORD(0x6e31), WORD(0x632b), WORD(0xf584), WORD(0x0121),
+	/* 35G */
+	WORD(0x8c37), WORD(0x6beb), WORD(0xe4e6), WORD(0x081c), WORD(0x6c6e), WORD(0xee64),
+	WORD(0x0a5a), WORD(0x97fb), WORD(0x6754), WORD(0x7b59), WORD(0xc304), WORD(0x2530),
+	WORD(0x11f7), WORD(0xd3a0), WORD(0x427e), WORD(0x4036), WORD(0x95da), WORD(0xcb9c),
+	WORD(0x5ab7), WORD(0x53c0), WORD(0x5fe2), WORD(0xc9f0), WORD(0x215a), WORD(0x33d3),
+	WORD(0xc951), WORD(0x05d1), WORD(0x034f), WORD(0xc5b1), WORD(0x3c1c), WORD(0xb185),
+	WORD(0xbaa4), WORD(0x803a), WORD(0x00e1), WORD(0xfa30), WORD(0x0f03), WORD(0xf792),
+	WORD(0x58e9), WORD(0x269f), WORD(0x3205), WORD(0xda11), WORD(0x5d26), WORD(0xcbef),
+	WORD(0x34f3), WORD(0x9177), WORD(0x1092), WORD(0xa12e), WORD(0x6380), WORD(0xc5e9),
+	WORD(0x588b), WORD(0xa84d), WORD(0x18ed), WORD(0x2c8d), WORD(0x13cb), WORD(0xe7a3),
+	WORD(0xec2d), WORD(0xb65a), WORD(0x8849), WORD(0xdfd2), WORD(0x186d), WORD(0x8f86),
+	WORD(0xc1a1), WORD(0xe60d), WORD(0x3fe2), WORD(0xfb56), WORD(0x9683), WORD(0x00de),
+	/* 37G */
+	WORD(0xb7a5), WORD(0xabd1), WORD(0xacda), WORD(0xd626), WORD(0x39f8), WORD(0x3c01),
+	WORD(0xb572), WORD(0x3273), WORD(0xf946), WORD(0x4c06), WORD(0x3770), WORD(0x2c71),
+	WORD(0x0207), WORD(0x442b), WORD(0xb1d1), WORD(0xa22b), WORD(0xa4de), WORD(0xceab),
+	WORD(0x7357), WORD(0xf685), WORD(0x2114), WORD(0xeacf), WORD(0xab60), WORD(0xae2e),
+	WORD(0x33e1), WORD(0xf6ac), WORD(0x1a96), WORD(0xf3cc), WORD(0x389c), WORD(0x195b),
+	WORD(0x610c), WORD(0xb253), WORD(0x0027), WORD(0x01d4), WORD(0x7d95), WORD(0xc1ca),
+	WORD(0x95fc), WORD(0x4b18), WORD(0x4c41), WORD(0x202b), WORD(0xd25f), WORD(0xe198),
+	WORD(0xd02b), WORD(0x24ca), WORD(0x2e2b), WORD(0xc0dc), WORD(0xe41f), WORD(0x1238),
+	WORD(0x5ede), WORD(0x82ee), WORD(0xcc89), WORD(0xd35b), WORD(0x18be), WORD(0x2c93),
+	WORD(0x32fc), WORD(0xf90c), WORD(0x2737), WORD(0xc97f), WORD(0x3658), WORD(0x1279),
+	WORD(0x25cb), WORD(0xa086), WORD(0x455b), WORD(0x8101), WORD(0xf70d), WORD(0x005b),
+	/* 39G */
+	WORD(0xbe49), WORD(0x19db), WORD(0x8cf7), WORD(0xb820), WORD(0xb385), WORD(0x41d7),
+	WORD(0xea40), WORD(0xa7d0), WORD(0xbcad), WORD(0xfd18), WORD(0x1a72), WORD(0x05fa),
+	WORD(0xf156), WORD(0x1350), WORD(0x62c3), WORD(0xb586), WORD(0x5392), WORD(0xce37),
+	WORD(0xb11a), WORD(0x6cfe), WORD(0x391c), WORD(0xadc8), WORD(0xd24d), WORD(0x4b30),
+	WORD(0x814f), WORD(0x524c), WORD(0x31ab), WORD(0x3209), WORD(0x3aa9), WORD(0xd6b0),
+	WORD(0x08fd), WORD(0x5c7a), WORD(0x0050), WORD(0xd304), WORD(0x45b0), WORD(0x3091),
+	WORD(0x6e6e), WORD(0x55ec), WORD(0xc720), WORD(0xa5b4), WORD(0x0973), WORD(0xb179),
+	WORD(0xa273), WORD(0x20ac), WORD(0xe579), WORD(0xd551), WORD(0xb412), WORD(0xff5c),
+	WORD(0x6e2c), WORD(0xa40c), WORD(0x486d), WORD(0x2063), WORD(0x0589), WORD(0xa66e),
+	WORD(0xcb0a), WORD(0xd543), WORD(0x49bd), WORD(0xce34), WORD(0xde9c), WORD(0x2035),
+	WORD(0x154d), WORD(0x71b0), WORD(0x9aee), WORD(0x6e39), WORD(0xb0b7), WORD(0x0014),
+	/* 41G */
+	WORD(0x0f5d), WORD(0x121c), WORD(0x4a93), WORD(0x0067), WORD(0x7b47), WORD(0x6615),
+	WORD(0xd291), WORD(0xfed0), WORD(0xfd6e), WORD(0x14bd), WORD(0xeee4), WORD(0x0461),
+	WORD(0x6726), WORD(0x4ae6), WORD(0xf57a), WORD(0x5c98), WORD(0x640b), WORD(0x2530),
+	WORD(0x91c3), WORD(0xdc2f), WORD(0x5342), WORD(0x44cc), WORD(0xf259), WORD(0x5291),
+	WORD(0x12a9), WORD(0x4184), WORD(0xce94), WORD(0xf5fe), WORD(0x53b1), WORD(0x2f12),
+	WORD(0xbcf4), WORD(0xa076), WORD(0x00d0), WORD(0x67ec), WORD(0x8147), WORD(0x0760),
+	WORD(0xf5bb), WORD(0xf675), WORD(0xf9d1), WORD(0xac73), WORD(0xaeeb), WORD(0x5efb),
+	WORD(0xd147), WORD(0x2a8f), WORD(0x9537), WORD(0xed02), WORD(0x7993), WORD(0x08f6),
+	WORD(0xcf07), WORD(0x88d9), WORD(0x6410), WORD(0x0d91), WORD(0xef41), WORD(0x1911),
+	WORD(0xf72b), WORD(0xc074), WORD(0xacf2), WORD(0xf3d5), WORD(0x1ccd), WORD(0xa1e5),
+	WORD(0x7909), WORD(0x769b), WORD(0xf16a), WORD(0x8c2a), WORD(0x4b6b), WORD(0x004b),
+	/* 43G */
+	WORD(0xbf63), WORD(0x27a4), WORD(0x4191), WORD(0x9f18), WORD(0x9038), WORD(0x703e),
+	WORD(0x17ef), WORD(0xf85b), WORD(0xe528), WORD(0x9ec2), WORD(0x3d4d), WORD(0xd3a7),
+	WORD(0xeed1), WORD(0xbe9b), WORD(0xbd76), WORD(0x3356), WORD(0xcb7e), WORD(0x7f51),
+	WORD(0xa21c), WORD(0x787c), WORD(0xd7c7), WORD(0x0a0c), WORD(0x5176), WORD(0x33c5),
+	WORD(0x5038), WORD(0xa26c), WORD(0x6c82), WORD(0xa811), WORD(0x7f6a), WORD(0x2c72),
+	WORD(0xb2f6), WORD(0xa450), WORD(0x0000), WORD(0xdfc2), WORD(0x41d6), WORD(0x833b),
+	WORD(0xac14), WORD(0x6944), WORD(0x5b44), WORD(0x97bb), WORD(0x76dc), WORD(0xbd4a),
+	WORD(0x3e70), WORD(0x15aa), WORD(0x96b0), WORD(0x78c9), WORD(0xcd8e), WORD(0x4c43),
+	WORD(0xfeb0), WORD(0xf633), WORD(0x8d05), WORD(0xc0cf), WORD(0x181b), WORD(0x66bd),
+	WORD(0xe8a2), WORD(0x8ed8), WORD(0x3bf4), WORD(0x9213), WORD(0x51df), WORD(0x1e3d),
+	WORD(0xfbd4), WORD(0x4d75), WORD(0x3c43), WORD(0x84cf), WORD(0xd50f), WORD(0x015d),
+	/* 45G */
+	WORD(0x0d12), WORD(0xe4ae), WORD(0x3007), WORD(0x96f6), WORD(0x6251), WORD(0x35b8),
+	WORD(0x03db), WORD(0x4aa3), WORD(0x87e1), WORD(0xb81f), WORD(0xd672), WORD(0x4750),
+	WORD(0x6cee), WORD(0x50f9), WORD(0xbefc), WORD(0x8c4d), WORD(0x33bc), WORD(0xcb94),
+	WORD(0xf1f8), WORD(0x96fa), WORD(0x603d), WORD(0x0a3e), WORD(0xf946), WORD(0x2c7b),
+	WORD(0x103d), WORD(0x95e0), WORD(0xc7ff), WORD(0xacb5), WORD(0xdc3c), WORD(0x4f29),
+	WORD(0x5650), WORD(0xe8c3), WORD(0x00b4), WORD(0xd4fa), WORD(0x0481), WORD(0xe680),
+	WORD(0x4c53), WORD(0x27ca), WORD(0x9bab), WORD(0xec85), WORD(0x31fa), WORD(0x709a),
+	WORD(0xf194), WORD(0x43cd), WORD(0x76cf), WORD(0x42f3), WORD(0x56d7), WORD(0x4017),
+	WORD(0x6ad9), WORD(0x54dc), WORD(0x6da0), WORD(0x0dde), WORD(0xac25), WORD(0x209a),
+	WORD(0x3844), WORD(0x2119), WORD(0xc315), WORD(0x3d8a), WORD(0xa4fe), WORD(0x0f98),
+	WORD(0xb561), WORD(0x3ea6), WORD(0x69c2), WORD(0x866c), WORD(0x64da), WORD(0x000f),
+	/* 47G */
+	WORD(0x88ab), WORD(0xeace), WORD(0xe4d5), WORD(0xed31), WORD(0xb397), WORD(0xf65d),
+	WORD(0x9868), WORD(0x2b50), WORD(0xb305), WORD(0xe26e), WORD(0xd1d4), WORD(0x773a),
+	WORD(0x564e), WORD(0xf491), WORD(0x505c), WORD(0x0c32), WORD(0x591c), WORD(0x8ee8),
+	WORD(0x8363), WORD(0x9198), WORD(0xfc4b), WORD(0x019f), WORD(0x138a), WORD(0x727f),
+	WORD(0x1672), WORD(0x1ac4), WORD(0x1f66), WORD(0x7a84), WORD(0xafce), WORD(0x457e),
+	WORD(0x8382), WORD(0x8fc4), WORD(0x01f1), WORD(0xeb04), WORD(0xc870), WORD(0x978e),
+	WORD(0x832e), WORD(0x9de9), WORD(0x8833), WORD(0xaccf), WORD(0xe520), WORD(0xf388),
+	WORD(0x6c12), WORD(0x7a3c), WORD(0xdbb0), WORD(0x5375), WORD(0x24c1), WORD(0x05c8),
+	WORD(0x3b04), WORD(0x4bc9), WORD(0x7832), WORD(0x993b), WORD(0x753f), WORD(0xc476),
+	WORD(0x904f), WORD(0xc9a4), WORD(0x2f83), WORD(0x4d30), WORD(0xa7fb), WORD(0x5dda),
+	WORD(0x1486), WORD(0x4eda), WORD(0x3aff), WORD(0x32b9), WORD(0xaee4), WORD(0x017c),
+	/* 49G */
+	WORD(0x56a9), WORD(0xf7e0), WORD(0x2824), WORD(0x465a), WORD(0x6506), WORD(0x2602),
+	WORD(0x58d6), WORD(0x2c6d), WORD(0xd439), WORD(0x1a2f), WORD(0x2717), WORD(0xec64),
+	WORD(0x2148), WORD(0x7b14), WORD(0x6fa9), WORD(0xe151), WORD(0xf5b5), WORD(0xef54),
+	WORD(0x5888), WORD(0xc0dc), WORD(0x1cfa), WORD(0x24cc), WORD(0xa3d7), WORD(0xa2e1),
+	WORD(0x69ce), WORD(0xd5d0), WORD(0x31dd), WORD(0xd205), WORD(0xabe5), WORD(0xc60e),
+	WORD(0x1e05), WORD(0xcc7d), WORD(0x00e5), WORD(0x5a05), WORD(0x4442), WORD(0x3516),
+	WORD(0xcdfa), WORD(0x8e85), WORD(0x5c45), WORD(0xdfd8), WORD(0xcb1f), WORD(0xda25),
+	WORD(0xdb95), WORD(0x6775), WORD(0x0879), WORD(0xe106), WORD(0xeaba), WORD(0xaaa1),
+	WORD(0xecbb), WORD(0xc1ae), WORD(0xd45f), WORD(0xcece), WORD(0x3961), WORD(0xbf58),
+	WORD(0xbf2d), WORD(0x33c3), WORD(0x4f72), WORD(0x8dba), WORD(0x970a), WORD(0x0dfb),
+	WORD(0x04d8), WORD(0xcb8a), WORD(0x6bbd), WORD(0xa048), WORD(0x4ab2), WORD(0x00ee),
+	/* 51G */
+	WORD(0x825a), WORD(0xe64a), WORD(0x7ffd), WORD(0x6c8b), WORD(0x6ed4), WORD(0xbdf1),
+	WORD(0xf78e), WORD(0xd344), WORD(0xe07d), WORD(0x2a65), WORD(0x0d88), WORD(0x90d7),
+	WORD(0x6f89), WORD(0x39c8), WORD(0x3578), WORD(0x76ff), WORD(0x1361), WORD(0xdf75),
+	WORD(0x65fc), WORD(0xd18b), WORD(0xdd1d), WORD(0xa7f4), WORD(0xdef1), WORD(0xfcfa),
+	WORD(0xe67e), WORD(0xa2f9), WORD(0xdb40), WORD(0x2ec9), WORD(0xd101), WORD(0xc20a),
+	WORD(0x8f13), WORD(0xadd2), WORD(0x001c), WORD(0x3d9c), WORD(0xae04), WORD(0x2f6e),
+	WORD(0x5ce2), WORD(0x0c47), WORD(0xd44f), WORD(0x5f69), WORD(0x0055), WORD(0xd283),
+	WORD(0x1d75), WORD(0x04b7), WORD(0x4e1b), WORD(0x0642), WORD(0x6db0), WORD(0xb45d),
+	WORD(0xde15), WORD(0x9e4b), WORD(0xf5cd), WORD(0xba56), WORD(0x72d8), WORD(0x6712),
+	WORD(0xe240), WORD(0xc790), WORD(0x6ec3), WORD(0xbca9), WORD(0x69fa), WORD(0x8ca1),
+	WORD(0xeca9), WORD(0x2b1c), WORD(0x0d12), WORD(0xe502), WORD(0x0879), WORD(0x00e6),
+	/* 53G */
+	WORD(0x8350), WORD(0x5b4c), WORD(0x2666), WORD(0x42b4), WORD(0x0b31), WORD(0xc404),
+	WORD(0xd4e4), WORD(0x0a9e), WORD(0x9584), WORD(0x27f0), WORD(0x0fdd), WORD(0xd7ac),
+	WORD(0xc769), WORD(0x04d3), WORD(0x31b9), WORD(0x1087), WORD(0x6227), WORD(0x4080),
+	WORD(0xb7ca), WORD(0xf417), WORD(0xdb93), WORD(0x44af), WORD(0xf48b), WORD(0x3445),
+	WORD(0x6ffc), WORD(0x8183), WORD(0xfe98), WORD(0x9e87), WORD(0xfbbd), WORD(0x7349),
+	WORD(0x8caf), WORD(0x7124), WORD(0x01fb), WORD(0x30c1), WORD(0x063c), WORD(0x6eea),
+	WORD(0xb6ed), WORD(0x357e), WORD(0x55f7), WORD(0xfde2), WORD(0x051e), WORD(0xc602),
+	WORD(0xda67), WORD(0x4ef1), WORD(0xb53d), WORD(0xd987), WORD(0xe79d), WORD(0x7a81),
+	WORD(0xefb2), WORD(0x58a7), WORD(0xe886), WORD(0x4029), WORD(0xa1bf), WORD(0xb49a),
+	WORD(0x1610), WORD(0xeef2), WORD(0xe39f), WORD(0xc3be), WORD(0xa884), WORD(0x012b),
+	WORD(0xb08d), WORD(0x3a62), WORD(0x7595), WORD(0x4b0c), WORD(0x47e6), WORD(0x009f),
+	/* 55G */
+	WORD(0xaf12), WORD(0xa387), WORD(0x675e), WORD(0x56be), WORD(0x2742), WORD(0x4b56),
+	WORD(0xa5ed), WORD(0xf4d5), WORD(0x4d3f), WORD(0x05aa), WORD(0x358f), WORD(0x0ba4),
+	WORD(0xf35f), WORD(0x5693), WORD(0xc8be), WORD(0x6549), WORD(0xd0c6), WORD(0x46d0),
+	WORD(0x0147), WORD(0x396a), WORD(0xceb2), WORD(0xe853), WORD(0x4fec), WORD(0x581f),
+	WORD(0x54be), WORD(0x36d6), WORD(0x0aae), WORD(0xa8f2), WORD(0xe25a), WORD(0x8673),
+	WORD(0xb698), WORD(0x7e25), WORD(0x01a9), WORD(0x790d), WORD(0x51b7), WORD(0x6918),
+	WORD(0x0cb6), WORD(0x753d), WORD(0x504b), WORD(0x1803), WORD(0x01d1), WORD(0xc37d),
+	WORD(0xda9a), WORD(0xf1a2), WORD(0x4b04), WORD(0x266b), WORD(0x2d04), WORD(0xc4ae),
+	WORD(0x5542), WORD(0xaa88), WORD(0xdd70), WORD(0xa53e), WORD(0x7d88), WORD(0x5b00),
+	WORD(0x0b50), WORD(0x188d), WORD(0xcfa2), WORD(0x9730), WORD(0x0d3d), WORD(0xc83d),
+	WORD(0x2f53), WORD(0x109c), WORD(0x30d7), WORD(0xf40a), WORD(0xf2a7), WORD(0x00c2),
+	/* 57G */
+	WORD(0xf137), WORD(0x4d09), WORD(0x8527), WORD(0x3a99), WORD(0x281a), WORD(0xae42),
+	WORD(0x7ffc), WORD(0xb964), WORD(0x9041), WORD(0x5c52), WORD(0xde32), WORD(0x37ea),
+	WORD(0x597b), WORD(0x488c), WORD(0x5def), WORD(0x7980), WORD(0xfc25), WORD(0x90dc),
+	WORD(0xbbd2), WORD(0x9e36), WORD(0xc2f7), WORD(0x36df), WORD(0xf397), WORD(0x46f7),
+	WORD(0xfd2d), WORD(0xd92f), WORD(0x3af7), WORD(0x31ed), WORD(0x7022), WORD(0xe481),
+	WORD(0xfe79), WORD(0xe1f3), WORD(0x0029), WORD(0x479d), WORD(0xe212), WORD(0xbfec),
+	WORD(0xd6bf), WORD(0x9919), WORD(0x152a), WORD(0xc863), WORD(0xa498), WORD(0xb9d4),
+	WORD(0x494f), WORD(0x02b5), WORD(0x1fc1), WORD(0x3525), WORD(0x9dec), WORD(0x8686),
+	WORD(0x4129), WORD(0xf51a), WORD(0x6ff9), WORD(0x59c8), WORD(0x173f), WORD(0xc4db),
+	WORD(0x7cec), WORD(0xe965), WORD(0x9e86), WORD(0x7bd8), WORD(0x6a7c), WORD(0x7362),
+	WORD(0x039f), WORD(0x95b4), WORD(0xdecc), WORD(0x6a7e), WORD(0x47e6), WORD(0x0074),
+	/* 59G */
+	WORD(0x358d), WORD(0x8b34), WORD(0x1375), WORD(0xdf45), WORD(0x4431), WORD(0xa390),
+	WORD(0x2761), WORD(0xd429), WORD(0x4565), WORD(0x1b9d), WORD(0x16b2), WORD(0x481a),
+	WORD(0x348d), WORD(0x9a26), WORD(0xe4d8), WORD(0xab49), WORD(0x9002), WORD(0x1114),
+	WORD(0x49a6), WORD(0x72e1), WORD(0xccd5), WORD(0x480c), WORD(0x2ecc), WORD(0x911e),
+	WORD(0x56e3), WORD(0xf94f), WORD(0x1a16), WORD(0x1e30), WORD(0xb983), WORD(0xc3b3),
+	WORD(0x5698), WORD(0x5a2a), WORD(0x00d7), WORD(0x1706), WORD(0xc0fd), WORD(0x1e29),
+	WORD(0xa550), WORD(0x8d67), WORD(0x7ff2), WORD(0xc67d), WORD(0xc161), WORD(0x61fe),
+	WORD(0x27ff), WORD(0xeeeb), WORD(0xfeaf), WORD(0x5c64), WORD(0x41e8), WORD(0x225e),
+	WORD(0x67c6), WORD(0xa2dc), WORD(0xb77e), WORD(0x79e5), WORD(0x1797), WORD(0xfa71),
+	WORD(0x0481), WORD(0xd9b3), WORD(0xd246), WORD(0x3f8a), WORD(0xf8dd), WORD(0x5057),
+	WORD(0x8586), WORD(0xda6d), WORD(0x3f21), WORD(0x0a3f), WORD(0x65f6), WORD(0x003f),
+	/* 61G */
+	WORD(0x50c5), WORD(0xe1bb), WORD(0x67e7), WORD(0xa9ec), WORD(0x20e5), WORD(0xaa1e),
+	WORD(0x8b38), WORD(0x95d6), WORD(0x6bca), WORD(0x3d99), WORD(0x72cd), WORD(0xf3fe),
+	WORD(0x9cd2), WORD(0xee05), WORD(0x8d3b), WORD(0xc9e0), WORD(0x8bb8), WORD(0x458b),
+	WORD(0x58df), WORD(0x6b92), WORD(0x8d26), WORD(0xb306), WORD(0xbead), WORD(0xb668),
+	WORD(0xc7c5), WORD(0x0e3e), WORD(0x3995), WORD(0x653e), WORD(0x2e49), WORD(0x03a1),
+	WORD(0x008a), WORD(0x2625), WORD(0x00aa), WORD(0x25c5), WORD(0x0bb0), WORD(0x66a5),
+	WORD(0x77fc), WORD(0x125c), WORD(0xff2f), WORD(0x74e1), WORD(0x7917), WORD(0x95ab),
+	WORD(0x7d01), WORD(0xb01d), WORD(0x1a7f), WORD(0xd454), WORD(0xfaa9), WORD(0xaa5b),
+	WORD(0xfbc6), WORD(0x5001), WORD(0xac63), WORD(0x1d76), WORD(0x04bd), WORD(0x5ff6),
+	WORD(0xa116), WORD(0x2ff7), WORD(0xd7a4), WORD(0x963c), WORD(0xce43), WORD(0x951c),
+	WORD(0xccb6), WORD(0xd983), WORD(0x3242), WORD(0x6056), WORD(0xfce3), WORD(0x009e),
+	/* 63G */
+	WORD(0x72f0), WORD(0x4444), WORD(0xb7e7), WORD(0xadf5), WORD(0x4687), WORD(0xb856),
+	WORD(0x812b), WORD(0xd7be), WORD(0x2f3a), WORD(0xc313), WORD(0x423a), WORD(0x1ccb),
+	WORD(0x2f63), WORD(0x4709), WORD(0x3098), WORD(0x74cb), WORD(0x229d), WORD(0x8d84),
+	WORD(0xf26a), WORD(0xfaa7), WORD(0xe0f3), WORD(0xd06e), WORD(0xad7f), WORD(0x510d),
+	WORD(0x470e), WORD(0x8537), WORD(0xcd65), WORD(0x17bc), WORD(0xbff4), WORD(0x0622),
+	WORD(0xb232), WORD(0x3a9d), WORD(0x0099), WORD(0x0ad4), WORD(0x1edd), WORD(0x6950),
+	WORD(0xe8ad), WORD(0x5674), WORD(0x3251), WORD(0xadfb), WORD(0xb2bd), WORD(0x41d7),
+	WORD(0x0389), WORD(0xc178), WORD(0xfbc7), WORD(0x5e09), WORD(0x0c4b), WORD(0xee76),
+	WORD(0xe9ed), WORD(0xc002), WORD(0x5111), WORD(0x1a9d), WORD(0xaf46), WORD(0x032c),
+	WORD(0x20a0), WORD(0x9943), WORD(0x4f04), WORD(0xcb0d), WORD(0x02eb), WORD(0x44d9),
+	WORD(0xc0d6), WORD(0x0bb6), WORD(0x029c), WORD(0x0cbd), WORD(0xf0c2), WORD(0x01a3),
+};
+#else                     /* unknown word size */
+#error "Unsupported word size"
+#endif
+TO_EC_GEN_TABLE_PARAM(secp521r1_gen_wnaf, 7);
+
+/*
+ * Signed comb of the generator for the fixed base multiplications (6
+ * teeth, spacing 87), affine x and y in Montgomery representation
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+static const word_t secp521r1_gen_comb[] = {
+	/* T[0] */
+	WORD(0x31c1e719fb514795), WORD(0x54d9db79150a7282),
+	WORD(0x3f0803f4ea69c509), WORD(0x1a8bb7dc189fb51b),
+	WORD(0x738f55d90f2153dd), WORD(0x82330c742c394bad),
+	WORD(0xd01e3158db8502c1), WORD(0x0573d91680a8f059),
+	WORD(0x0000000000000053), WORD(0xe6d300530562b5c5),
+	WORD(0x7d5f69a40c551ec3), WORD(0x39eeff26c706be8e),
+	WORD(0x1517d9865e19f36b), WORD(0xda887e4d51149308),
+	WORD(0x83f2bd83652bc21c), WORD(0xe3553c318c104268),
+	WORD(0xa138c9de522c5f97), WORD(0x000000000000012e),
+	/* T[1] */
+	WORD(0x03569e990a9c0c05), WORD(0x8abfa9282d6f14ca),
+	WORD(0x22e895d3d24838ae), WORD(0x9f6ea39ec023141d),
+	WORD(0x8988055353e34dc7), WORD(0xc551af1201c87554),
+	WORD(0x1df653ca552b5c16), WORD(0x8ab27b4eafa6eedb),
+	WORD(0x0000000000000132), WORD(0x5a63473b927d4cb6),
+	WORD(0xa30ef686ca1d5c52), WORD(0xe3966741144c6275),
+	WORD(0xa40b26ef59b61036), WORD(0xd9051d5dc0e8c428),
+	WORD(0x7fcf5d8bb55d1e4e), WORD(0xcb882615bc2142c3),
+	WORD(0x99ff5c977881c63d), WORD(0x00000000000000dd),
+	/* T[2] */
+	WORD(0x47a552acbeeff154), WORD(0xd37164f9618bdd31),
+	WORD(0xf71f642b4b71b7a2), WORD(0x1ea11d06e4f2ca48),
+	WORD(0x59750fb892420fab), WORD(0x62e85cb8c8a8d3f0),
+	WORD(0xe0b7996dd15834f4), WORD(0x15f6654e543c0150),
+	WORD(0x00000000000000a8), WORD(0x305fdc471e724876),
+	WORD(0xbea626cafbb823c0), WORD(0x38bdbd75bbe667eb),
+	WORD(0xbcc97d8a59c86ed9), WORD(0x05d06fbebd8768b4),
+	WORD(0x1843fa3d0fc5d41a), WORD(0x14e420b907e8771f),
+	WORD(0xc3b666ece85348b0), WORD(0x00000000000001e4),
+	/* T[3] */
+	WORD(0x9c516f7a0901f6af), WORD(0xb459524ebb087c3e),
+	WORD(0x2e0406d509213209), WORD(0x14fafa704d5c1bb4),
+	WORD(0xf4f47cef61090361), WORD(0xfe8fd15dd6723977),
+	WORD(0x33ebd358d46ae87f), WORD(0xbc358e8e30cef438),
+	WORD(0x0000000000000148), WORD(0xc5a2698eb14dddc9),
+	WORD(0xdb661a85657e8357), WORD(0x8fc18bc6c70cebc0),
+	WORD(0x46098bccf87fb5cf), WORD(0x5be436aff3857f12),
+	WORD(0xe964a44a16d5c718), WORD(0xbbfcf1bc92c08968),
+	WORD(0xb967de19e2b8d78e), WORD(0x000000000000013e),
+	/* T[4] */
+	WORD(0xd1475fa303ce202a), WORD(0x524e986ca77fabf5),
+	WORD(0x372100a2d9e35e5f), WORD(0x4881aa4e047d86d8),
+	WORD(0xa2bb1b492c6fdefb), WORD(0xddba7d932c8169b6),
+	WORD(0x2b1975b32e8adc50), WORD(0x3e629204a6ef0b58),
+	WORD(0x00000000000001d8), WORD(0x259b2f4434a27e26),
+	WORD(0xa06c816ba22a0549), WORD(0x4e942b6d9f55b8e0),
+	WORD(0x5a7667d10759b53e), WORD(0x71b768672e139d50),
+	WORD(0x290cd29425572a8b), WORD(0x29ef4066519b67ee),
+	WORD(0x38e8b669a3c5f060), WORD(0x00000000000000c5),
+	/* T[5] */
+	WORD(0x5718c733d2a0cbdd), WORD(0xacf5764952e01664),
+	WORD(0x0a99968d0542d214), WORD(0x56eec619d49eacb4),
+	WORD(0x231349862bc447f5), WORD(0xb6ce7fa0ef4175f5),
+	WORD(0x45410ba44511d470), WORD(0x304fb551f5450e45),
+	WORD(0x0000000000000021), WORD(0x84dcaf4069505f1a),
+	WORD(0x97b214926fea1a8e), WORD(0x9c1b2183c77c4f35),
+	WORD(0x2a42eba2cc347298), WORD(0x74d765c267ef7ba1),
+	WORD(0x0f080683fb10dc79), WORD(0x4a9833d37419a7c6),
+	WORD(0xb7a02deb41dce0c2), WORD(0x0000000000000008),
+	/* T[6] */
+	WORD(0xd7de3e939a22111f), WORD(0x21a42d938bf1ff45),
+	WORD(0xa4b9fe464457450c), WORD(0x8b56471d0e2bc437),
+	WORD(0xdf6361144f3c7de2), WORD(0xa2c25ffd7d6948f9),
+	WORD(0xf4d16dae2d175f83), WORD(0xf1a756587b0b7b0c),
+	WORD(0x000000000000012f), WORD(0x1599be4ca8510397),
+	WORD(0xdf5a4d3a45a852e2), WORD(0xdeb7eaa34e971b68),
+	WORD(0xbd812f3ba0802e95), WORD(0x848e49846f2c1d6c),
+	WORD(0x1adf98b11f4edc94), WORD(0xcd1d8b03a300d9be),
+	WORD(0x1a2764e8dcb382ee), WORD(0x0000000000000172),
+	/* T[7] */
+	WORD(0xc7034e39c9e3cd6f), WORD(0x9f3bfe9be5eb05a3),
+	WORD(0x96132f98ad602abc), WORD(0x53152eadace8d02c),
+	WORD(0x6e57191955926d91), WORD(0xff3721d20a515e66),
+	WORD(0x8614a27f0d478c6d), WORD(0xb2d5745b33cf1569),
+	WORD(0x000000000000004d), WORD(0x5d2ec4dad77b484d),
+	WORD(0xe67e03615031acd3), WORD(0x7bf3d38f7eb3f4e9),
+	WORD(0x54f55ed872df8eef), WORD(0x1e3f0ed2a0d3bfa9),
+	WORD(0x82db8a5b83682892), WORD(0xf84c2fb3abe7d779),
+	WORD(0xd556e35f20603a95), WORD(0x0000000000000099),
+	/* T[8] */
+	WORD(0xef4e2f64967c9a9e), WORD(0xa891564cda831b5e),
+	WORD(0xbf44167ecc39681a), WORD(0x8a2e9acf3b3a7d13),
+	WORD(0x899a4de3df863a5e), WORD(0xbf901b74bd5c0f46),
+	WORD(0x92bb521f4d75d920), WORD(0x29e490c621161e10),
+	WORD(0x00000000000000ac), WORD(0x91d3c0b9e8d1ced2),
+	WORD(0xa436a8c71706f3e6), WORD(0xb9b1454d4a3b1031),
+	WORD(0xd84ef09e1ffdd2c9), WORD(0x06752d86df80c7cf),
+	WORD(0x0243d98c79a26422), WORD(0x8d078fb0aab05160),
+	WORD(0x441326bdaa788305), WORD(0x00000000000001bc),
+	/* T[9] */
+	WORD(0xb2ddd4d3f574665a), WORD(0x4bf4203bcf2aa6e9),
+	WORD(0x3971534b07334475), WORD(0xd522cfbdc83fcbc1),
+	WORD(0xe88e6453089626f7), WORD(0x2eece3449e1b5f3b),
+	WORD(0x1db0a34146e16972), WORD(0xb946bc951edab27a),
+	WORD(0x0000000000000128), WORD(0x9a6ff325631dc12c),
+	WORD(0x48a3149df568a371), WORD(0x2e909ef09af0e1d6),
+	WORD(0x1d7e57ff37f8492c), WORD(0xc6fbac832c94d807),
+	WORD(0x466ce17259f9ad53), WORD(0x2abc33b27df81fdd),
+	WORD(0x3b06d19ffabecd89), WORD(0x000000000000001b),
+	/* T[10] */
+	WORD(0x22ec393573d715e8), WORD(0xf480245883c616da),
+	WORD(0xc351bbbe3ce12fd5), WORD(0x4ae9fb66755688d1),
+	WORD(0xf7be4c3f767bd5b4), WORD(0x6912e858da52b442),
+	WORD(0x947996df8659f828), WORD(0x6aaefca0514174f1),
+	WORD(0x00000000000000ed), WORD(0xf46982d852dbaa4d),
+	WORD(0x81615a72af1a56fe), WORD(0xf5c360372f01364a),
+	WORD(0xef75506b1d498543), WORD(0x6e0edf47c6d10724),
+	WORD(0x1bdbfe4fc8afc8b4), WORD(0xd5de39234f86cc58),
+	WORD(0x51a75660c8bdfb59), WORD(0x0000000000000174),
+	/* T[11] */
+	WORD(0xbe82c59aa227938d), WORD(0xa19a8388c68f1c9f),
+	WORD(0x8d7e2c8e61ada129), WORD(0xe4f04f4cfea85704),
+	WORD(0xb5c277542e585fb9), WORD(0x3884c22a57f23a30),
+	WORD(0xc3ec21ae939ef503), WORD(0xf92c67276b97bb87),
+	WORD(0x000000000000007e), WORD(0x0b24c0a7f9828948),
+	WORD(0x4c1c57e3adf25a92), WORD(0x90b61e7febe46067),
+	WORD(0xa649ee0ebe66f7c3), WORD(0x7a946d8fde38f393),
+	WORD(0x2d11a1401dd76ee5), WORD(0x21f332e1a340094c),
+	WORD(0xe56d6671fd064aba), WORD(0x000000000000006c),
+	/* T[12] */
+	WORD(0xb7157394f8c7e13c), WORD(0x0d6b6b4d6ddd9ace),
+	WORD(0xfc01e098e10fa1c6), WORD(0xfa9ca6f8a4f5b3ce),
+	WORD(0x4330cc30b23cef45), WORD(0x34502467c8ac0aee),
+	WORD(0xca898b1f5840c8ea), WORD(0x3a564f4bd6b7a6d9),
+	WORD(0x000000000000016c), WORD(0x9ffdb13517305f61),
+	WORD(0x7c1e098235e6d9dd), WORD(0x53cf3a5429a75905),
+	WORD(0xa1fed0d21be75a8d), WORD(0x85495f18c08616ac),
+	WORD(0x8461011960eaf7ad), WORD(0x1a635529d36e0356),
+	WORD(0xeb5e4f40aa29ec56), WORD(0x00000000000001c0),
+	/* T[13] */
+	WORD(0xa4511599e914ab0f), WORD(0x21c7af66ae5bb73e),
+	WORD(0x6c66f090006aff84), WORD(0xce676e099adc9259),
+	WORD(0x9fa3958d50d99165), WORD(0xa5a20518c201dae4),
+	WORD(0x67f0f713cd4d9521), WORD(0xc6d2d2b5624472ff),
+	WORD(0x00000000000000f4), WORD(0x462c7ddbca658548),
+	WORD(0x0479ab0e77d10221), WORD(0x5c23d1e87bf07edc),
+	WORD(0x62b884906077a31e), WORD(0x6855ee552cb62b88),
+	WORD(0x870ad8f223238dea), WORD(0xdb8f14f399339417),
+	WORD(0xcb73585337c27071), WORD(0x0000000000000056),
+	/* T[14] */
+	WORD(0x9b115029a2173f69), WORD(0xce879acb0ba5aa77),
+	WORD(0xf71ddda11f48245d), WORD(0x45bde747ae5d3526),
+	WORD(0xe681880240d5c9ed), WORD(0x072018d5295326fb),
+	WORD(0xef1ff3514a4111c5), WORD(0x26911a4de352b580),
+	WORD(0x00000000000001f3), WORD(0xe65b7573bbf17b1e),
+	WORD(0x0547b90ec88ea215), WORD(0xbfa9356ca159d4e2),
+	WORD(0x27a7823653d4a687), WORD(0x72ebc2bc41757eec),
+	WORD(0x9f592ad7c24d905c), WORD(0x21b514cdbf02c081),
+	WORD(0x452286662c10b29a), WORD(0x00000000000001a5),
+	/* T[15] */
+	WORD(0xf87862277dd7749d), WORD(0x35aed5e48168536d),
+	WORD(0xac32955680561729), WORD(0x330c8cb6c542f4f2),
+	WORD(0xbc8e7d357d0c92b9), WORD(0xf9270221990d9f86),
+	WORD(0x9f40088bc0011806), WORD(0x6443e38f62ab6787),
+	WORD(0x000000000000013d), WORD(0xd78b254038427168),
+	WORD(0x96ecd9b1d3e6933d), WORD(0x3fb0de3ed0c52a3b),
+	WORD(0xd212bc6e27c34d13), WORD(0xc0dfca13c4375a55),
+	WORD(0x93b0cdc3441c783b), WORD(0xdace8f3b451df53e),
+	WORD(0x4d3e5645bec9be56), WORD(0x000000000000017b),
+	/* T[16] */
+	WORD(0xbc80723efad274e9), WORD(0x977e1a82e071601e),
+	WORD(0xbe0e9c5b9240c281), WORD(0x0495b6b40fdbcc59),
+	WORD(0x28a032de93ef0f2e), WORD(0x3de6934215110f86),
+	WORD(0xfc6189737d0b776e), WORD(0xf90414c1c14c2ecd),
+	WORD(0x00000000000001ff), WORD(0xdebc09475eb229e8),
+	WORD(0xd46c655a93dbfd94), WORD(0x61243f40c1811ccf),
+	WORD(0x63d982bd5abefdaf), WORD(0xfa0fe6d3965f7a9c),
+	WORD(0xf72a793f4048303e), WORD(0xb9e5d4fab6483d1e),
+	WORD(0x926d697bb028007a), WORD(0x000000000000016c),
+	/* T[17] */
+	WORD(0x4be82f13bb0283e3), WORD(0xdb666ef08fbb48c7),
+	WORD(0xc591cd01e2a9ef7e), WORD(0x062eaaaf83c981de),
+	WORD(0xa9bbb76fc0a56f1c), WORD(0x4ff57617a1ffb588),
+	WORD(0x20f4898ec4719c62), WORD(0xfccd8bfa3696f53e),
+	WORD(0x00000000000001cc), WORD(0x9127760906501cb8),
+	WORD(0x47aa7a7d4722d9fc), WORD(0xe1fa4b6ec2633a41),
+	WORD(0x2e82dc03ebff9a99), WORD(0xdd194073d625746b),
+	WORD(0x4f3c137338c3a0da), WORD(0xd845607803fe3e10),
+	WORD(0xcfa68aaf922b6279), WORD(0x0000000000000042),
+	/* T[18] */
+	WORD(0x56de6ed747411c33), WORD(0xa04619fe2ff37161),
+	WORD(0x1ef11975467d4670), WORD(0x8fd30b8cb1296d65),
+	WORD(0x7afa5332408686fc), WORD(0x60103c542eb56882),
+	WORD(0x8acc5d2b3b786876), WORD(0xb2837ebabfabccb3),
+	WORD(0x000000000000004f), WORD(0x376bf75981e26e43),
+	WORD(0xd11de0c02f81fcf3), WORD(0x6817166be954e5d8),
+	WORD(0x1883d73bfa2ac1d0), WORD(0x81d5a52ea8531a91),
+	WORD(0xaf8a52e748474d01), WORD(0xdcbd6641392f6d4b),
+	WORD(0x10a38e39fd32e73b), WORD(0x00000000000000e0),
+	/* T[19] */
+	WORD(0xbbfd9c34efcb14b7), WORD(0x98fbbddee1ac7185),
+	WORD(0x79a9392035dc9837), WORD(0xd7dd936d266009ee),
+	WORD(0x372d64cab3206da6), WORD(0x04a6461cddbb517c),
+	WORD(0xe7aaf8ca1b1e9439), WORD(0xf26ff3c5877497fe),
+	WORD(0x00000000000001dc), WORD(0xa65e72199b948f07),
+	WORD(0xcb928a23846d86fb), WORD(0x2303285945f4fdd4),
+	WORD(0x5720ff65c089858f), WORD(0xc55308417453c91f),
+	WORD(0xb7a19ce6a5ac9683), WORD(0x7328bb63c32812f2),
+	WORD(0xa6be41459807f776), WORD(0x0000000000000114),
+	/* T[20] */
+	WORD(0xa9c1dcf3a3df5096), WORD(0xe7f2b68d77f645ce),
+	WORD(0x36ceb20ed1069019), WORD(0x6fae1e477c855642),
+	WORD(0x5695450f7f482d51), WORD(0x9db0f1aeedc5e94e),
+	WORD(0x1713f02e8e1df180), WORD(0x9ef674cc5115b3df),
+	WORD(0x00000000000001a2), WORD(0xe1b6067aac576643),
+	WORD(0x651186d8c661e70f), WORD(0x26ed3eda9607c339),
+	WORD(0x77042a2681751f79), WORD(0x4e053166248a3faf),
+	WORD(0x78402b8aa8bbcd20), WORD(0x335e76f950566b37),
+	WORD(0x1c003ce374f2b008), WORD(0x00000000000001d1),
+	/* T[21] */
+	WORD(0x99c8932d95f78d05), WORD(0xe5473b9114db5acb),
+	WORD(0x8f76a898445d16d1), WORD(0x2ac7d4591f7e4ea7),
+	WORD(0xce786ce11a62122f), WORD(0xb53dccc85be3dcbc),
+	WORD(0xbe939c5b84fe8924), WORD(0xa8100f5ca926cb45),
+	WORD(0x000000000000014a), WORD(0xbddeeaf0be10aaa6),
+	WORD(0x5e18f8454c0b217f), WORD(0x28652116a973a273),
+	WORD(0x671bf6fa5647eff1), WORD(0x99981e9d1a93c747),
+	WORD(0x5a47dfa423b70a19), WORD(0xd87cfec140b65a5c),
+	WORD(0xcf28fb34f3af65eb), WORD(0x00000000000001e9),
+	/* T[22] */
+	WORD(0x2c329734764a6071), WORD(0xdc504e247e70a186),
+	WORD(0x7091134ae3938690), WORD(0xb8a0885ccaa3d172),
+	WORD(0x354559625d15acf1), WORD(0xa978a4214813bc17),
+	WORD(0x9a6f682ae24e7be2), WORD(0x5abed4d6c523f556),
+	WORD(0x0000000000000125), WORD(0xcce6d479acd37f06),
+	WORD(0xd4f1682697989e18), WORD(0x96345a570a6298ee),
+	WORD(0xbba17b08488d752b), WORD(0x6b4e1a68eb2e411d),
+	WORD(0x48c610c1080fd04e), WORD(0x6e3f149993fc3174),
+	WORD(0x23fc53158c81fd01), WORD(0x00000000000001fb),
+	/* T[23] */
+	WORD(0x35829bdcf3735db2), WORD(0x4cdf134203da130a),
+	WORD(0x10981748953347dd), WORD(0x7984c07c4996680e),
+	WORD(0x5683243710d091d0), WORD(0x4478b0d5c7deb10b),
+	WORD(0x176efda677c6a7d3), WORD(0x39c3826c6b97c130),
+	WORD(0x00000000000000fb), WORD(0xe8d65bfc87a8be04),
+	WORD(0x4c4de3f3717b9293), WORD(0x8857c0880cff4e86),
+	WORD(0x6ee31a406f06618e), WORD(0x55d253e9759b2e8f),
+	WORD(0x30671e7ee802ba71), WORD(0x6e60f5c8c3484df2),
+	WORD(0x7aa8864811a97dae), WORD(0x0000000000000007),
+	/* T[24] */
+	WORD(0x1ab49a6c7752e1d0), WORD(0x692b9ee06926c0a0),
+	WORD(0x80baef34c4adea1f), WORD(0x92fc6030a1f6c7e3),
+	WORD(0xa70987b32d69d0ec), WORD(0xabc34d36f96c0ce5),
+	WORD(0xfacd5c2993b8daba), WORD(0x6cd92dd58e915c4d),
+	WORD(0x00000000000001d2), WORD(0x507616fb4f5a5a02),
+	WORD(0xe69d39e9ff1e3f22), WORD(0xc6b7020b4a560209),
+	WORD(0x0610fba4ba9af51f), WORD(0x6cf2e7af5b3cb4c6),
+	WORD(0x20eb418b8728d140), WORD(0x6778bfd25c32c37a),
+	WORD(0x7e491d3df98805fe), WORD(0x00000000000000e3),
+	/* T[25] */
+	WORD(0x71941a96b3ed2e50), WORD(0x09194f1b2566231d),
+	WORD(0xd903790f98311c78), WORD(0x687a47e90d9749ef),
+	WORD(0x0b597af9c1b5d985), WORD(0x7e48ace5f25440ef),
+	WORD(0xa131f756010d0637), WORD(0xcc57921cb2cfffbb),
+	WORD(0x000000000000016d), WORD(0xe10fda98e59624c5),
+	WORD(0xe338765cf13dcf86), WORD(0x0eadfe9388e90c77),
+	WORD(0x6b52fc60f9757eae), WORD(0x4a4d68463d88964b),
+	WORD(0xd0fe51fa4640cc9b), WORD(0x41a2168dc10c203f),
+	WORD(0x41bbb6f8dda3ec58), WORD(0x0000000000000142),
+	/* T[26] */
+	WORD(0x7c7d85640edd9c76), WORD(0x0182959ad41072e7),
+	WORD(0xe1dc295185d347f1), WORD(0xbbf4ffb2f0329dbe),
+	WORD(0xbee65bdb50778fc3), WORD(0x16e77115ad4c7780),
+	WORD(0x831a384d7688908b), WORD(0xaa7846857b2850a5),
+	WORD(0x000000000000013b), WORD(0xc10aea32e27f7770),
+	WORD(0x0a449aa8ac8fe51a), WORD(0x3d0c1b411d00fee1),
+	WORD(0xd624bf682e909e49), WORD(0xf3d729c868ecfae1),
+	WORD(0xa6adfed6461f0cee), WORD(0x739706e5a66a592b),
+	WORD(0x31c5a04d2f84a712), WORD(0x0000000000000136),
+	/* T[27] */
+	WORD(0xd82ef6687c09e97d), WORD(0xc1aa8a755501a6a7),
+	WORD(0xafb1ad12b2fa2222), WORD(0x37de2bcb4de5d43d),
+	WORD(0x03984027dc4117b3), WORD(0x2c760387294789ad),
+	WORD(0x4968fffc0e59f4fa), WORD(0x4d54d3e02218ab41),
+	WORD(0x00000000000001a1), WORD(0x6c0942a637bb4f1e),
+	WORD(0x4729cde8dd9b4d38), WORD(0x8eefd28d62696ea2),
+	WORD(0xc69a8db8ef95052f), WORD(0xc29055340b438c36),
+	WORD(0xc84d6b30b302a66a), WORD(0x1281211af813be5a),
+	WORD(0xaaf4fff47176e9eb), WORD(0x00000000000001df),
+	/* T[28] */
+	WORD(0xa40648183cbc3753), WORD(0xcd4d95c87b12109a),
+	WORD(0xf791b1b4e85b9650), WORD(0x97f7bd09aa186965),
+	WORD(0x13108e1c959c13c5), WORD(0x59fa78db31a52ff5),
+	WORD(0xe4e94d0a13bf93fc), WORD(0xe0a2d26652970c63),
+	WORD(0x000000000000014d), WORD(0xc03f7fcf7d0d7810),
+	WORD(0xebc874c84f52a12c), WORD(0x70a4625a8bcd78bb),
+	WORD(0x6fac7a5db9359540), WORD(0x7b374b9c000c8325),
+	WORD(0xa2a2f3388e1bc128), WORD(0xb9f2803c2a9e6fcd),
+	WORD(0x0230b952a8744e5f), WORD(0x0000000000000109),
+	/* T[29] */
+	WORD(0xab0fde00709e6ecd), WORD(0x0a93a3f630d837b6),
+	WORD(0x8782444f366ab189), WORD(0xc6288d39d07301f1),
+	WORD(0x6e5de8bb6980326b), WORD(0xf784b7e8f0cd53ef),
+	WORD(0x64140bc4b59c9966), WORD(0x4fea84b6165a38a2),
+	WORD(0x0000000000000010), WORD(0xcb6d6d07fd82442b),
+	WORD(0x97326299e190f7a1), WORD(0xf11aa86e7421e15d),
+	WORD(0x9cbb6eb98aa33130), WORD(0x78ceda212f44441f),
+	WORD(0x7f6f3fd88799c653), WORD(0x040163ee492ce152),
+	WORD(0x191cc659ea57b0b8), WORD(0x000000000000000c),
+	/* T[30] */
+	WORD(0xf0085caa778bfaa7), WORD(0x448a04d6fd25d34c),
+	WORD(0xdcd43cbc9d685c92), WORD(0xe3107fe0b37c84e0),
+	WORD(0x75e2bd418a70e90e), WORD(0xa380bf7c57c8c735),
+	WORD(0xebcf4f74771c91b7), WORD(0xa9bb26466b07ad7b),
+	WORD(0x00000000000001c5), WORD(0x3fd9b74645b1bacc),
+	WORD(0x5a86dfbfd09851e3), WORD(0x7378862d37dd410d),
+	WORD(0x394889ce801255ac), WORD(0x5a2205d5814f5ad0),
+	WORD(0x678b76b28bd9f8cf), WORD(0x5a58853f706238f6),
+	WORD(0x6dbbe11cfb058e2e), WORD(0x00000000000000e9),
+	/* T[31] */
+	WORD(0x5b7ef79236784b9a), WORD(0xd2139441fd9a6146),
+	WORD(0x511158074f2f3e81), WORD(0x8311ddd65cbfa301),
+	WORD(0xa213ab26cb612476), WORD(0x494dbf0e7368e2da),
+	WORD(0x55d9ebbd96b88c17), WORD(0xa6d8c73c556f4ea3),
+	WORD(0x00000000000000eb), WORD(0xd7fa547a163cb0c3),
+	WORD(0x3646f3111104cf7f), WORD(0xe61109310d89940a),
+	WORD(0xe002f9e05801b3bf), WORD(0x05fa1f2412fd87e1),
+	WORD(0xf5ca69d99b4c29b7), WORD(0x7a9160e652112a40),
+	WORD(0x3895c3346fd4fe5d), WORD(0x0000000000000149),
+};
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+static const word_t secp521r1_gen_comb[] = {
+	/* T[0] */
+	WORD(0x31c1e719), WORD(0x150a7282), WORD(0x54d9db79), WORD(0xea69c509),
+	WORD(0x3f0803f4), WORD(0x189fb51b), WORD(0x1a8bb7dc), WORD(0x0f2153dd),
+	WORD(0x738f55d9), WORD(0x2c394bad), WORD(0x82330c74), WORD(0xdb8502c1),
+	WORD(0xd01e3158), WORD(0x80a8f059), WORD(0x0573d916), WORD(0xa28f2a53),
+	WORD(0x000001f6), WORD(0xe6d30053), WORD(0x0c551ec3), WORD(0x7d5f69a4),
+	WORD(0xc706be8e), WORD(0x39eeff26), WORD(0x5e19f36b), WORD(0x1517d986),
+	WORD(0x51149308), WORD(0xda887e4d), WORD(0x652bc21c), WORD(0x83f2bd83),
+	WORD(0x8c104268), WORD(0xe3553c31), WORD(0x522c5f97), WORD(0xa138c9de),
+	WORD(0xc56b8b2e), WORD(0x0000000a),
+	/* T[1] */
+	WORD(0x03569e99), WORD(0x2d6f14ca), WORD(0x8abfa928), WORD(0xd24838ae),
+	WORD(0x22e895d3), WORD(0xc023141d), WORD(0x9f6ea39e), WORD(0x53e34dc7),
+	WORD(0x89880553), WORD(0x01c87554), WORD(0xc551af12), WORD(0x552b5c16),
+	WORD(0x1df653ca), WORD(0xafa6eedb), WORD(0x8ab27b4e), WORD(0x38180b32),
+	WORD(0x00000015), WORD(0x5a63473b), WORD(0xca1d5c52), WORD(0xa30ef686),
+	WORD(0x144c6275), WORD(0xe3966741), WORD(0x59b61036), WORD(0xa40b26ef),
+	WORD(0xc0e8c428), WORD(0xd9051d5d), WORD(0xb55d1e4e), WORD(0x7fcf5d8b),
+	WORD(0xbc2142c3), WORD(0xcb882615), WORD(0x7881c63d), WORD(0x99ff5c97),
+	WORD(0xfa996cdd), WORD(0x00000124),
+	/* T[2] */
+	WORD(0x47a552ac), WORD(0x618bdd31), WORD(0xd37164f9), WORD(0x4b71b7a2),
+	WORD(0xf71f642b), WORD(0xe4f2ca48), WORD(0x1ea11d06), WORD(0x92420fab),
+	WORD(0x59750fb8), WORD(0xc8a8d3f0), WORD(0x62e85cb8), WORD(0xd15834f4),
+	WORD(0xe0b7996d), WORD(0x543c0150), WORD(0x15f6654e), WORD(0xdfe2a8a8),
+	WORD(0x0000017d), WORD(0x305fdc47), WORD(0xfbb823c0), WORD(0xbea626ca),
+	WORD(0xbbe667eb), WORD(0x38bdbd75), WORD(0x59c86ed9), WORD(0xbcc97d8a),
+	WORD(0xbd8768b4), WORD(0x05d06fbe), WORD(0x0fc5d41a), WORD(0x1843fa3d),
+	WORD(0x07e8771f), WORD(0x14e420b9), WORD(0xe85348b0), WORD(0xc3b666ec),
+	WORD(0xe490ede4), WORD(0x0000003c),
+	/* T[3] */
+	WORD(0x9c516f7a), WORD(0xbb087c3e), WORD(0xb459524e), WORD(0x09213209),
+	WORD(0x2e0406d5), WORD(0x4d5c1bb4), WORD(0x14fafa70), WORD(0x61090361),
+	WORD(0xf4f47cef), WORD(0xd6723977), WORD(0xfe8fd15d), WORD(0xd46ae87f),
+	WORD(0x33ebd358), WORD(0x30cef438), WORD(0xbc358e8e), WORD(0x03ed5f48),
+	WORD(0x00000012), WORD(0xc5a2698e), WORD(0x657e8357), WORD(0xdb661a85),
+	WORD(0xc70cebc0), WORD(0x8fc18bc6), WORD(0xf87fb5cf), WORD(0x46098bcc),
+	WORD(0xf3857f12), WORD(0x5be436af), WORD(0x16d5c718), WORD(0xe964a44a),
+	WORD(0x92c08968), WORD(0xbbfcf1bc), WORD(0xe2b8d78e), WORD(0xb967de19),
+	WORD(0x9bbb933e), WORD(0x00000162),
+	/* T[4] */
+	WORD(0xd1475fa3), WORD(0xa77fabf5), WORD(0x524e986c), WORD(0xd9e35e5f),
+	WORD(0x372100a2), WORD(0x047d86d8), WORD(0x4881aa4e), WORD(0x2c6fdefb),
+	WORD(0xa2bb1b49), WORD(0x2c8169b6), WORD(0xddba7d93), WORD(0x2e8adc50),
+	WORD(0x2b1975b3), WORD(0xa6ef0b58), WORD(0x3e629204), WORD(0x9c4055d8),
+	WORD(0x00000007), WORD(0x259b2f44), WORD(0xa22a0549), WORD(0xa06c816b),
+	WORD(0x9f55b8e0), WORD(0x4e942b6d), WORD(0x0759b53e), WORD(0x5a7667d1),
+	WORD(0x2e139d50), WORD(0x71b76867), WORD(0x25572a8b), WORD(0x290cd294),
+	WORD(0x519b67ee), WORD(0x29ef4066), WORD(0xa3c5f060), WORD(0x38e8b669),
+	WORD(0x44fc4cc5), WORD(0x00000069),
+	/* T[5] */
+	WORD(0x5718c733), WORD(0x52e01664), WORD(0xacf57649), WORD(0x0542d214),
+	WORD(0x0a99968d), WORD(0xd49eacb4), WORD(0x56eec619), WORD(0x2bc447f5),
+	WORD(0x23134986), WORD(0xef4175f5), WORD(0xb6ce7fa0), WORD(0x4511d470),
+	WORD(0x45410ba4), WORD(0xf5450e45), WORD(0x304fb551), WORD(0x4197ba21),
+	WORD(0x000001a5), WORD(0x84dcaf40), WORD(0x6fea1a8e), WORD(0x97b21492),
+	WORD(0xc77c4f35), WORD(0x9c1b2183), WORD(0xcc347298), WORD(0x2a42eba2),
+	WORD(0x67ef7ba1), WORD(0x74d765c2), WORD(0xfb10dc79), WORD(0x0f080683),
+	WORD(0x7419a7c6), WORD(0x4a9833d3), WORD(0x41dce0c2), WORD(0xb7a02deb),
+	WORD(0xa0be3408), WORD(0x000000d2),
+	/* T[6] */
+	WORD(0xd7de3e93), WORD(0x8bf1ff45), WORD(0x21a42d93), WORD(0x4457450c),
+	WORD(0xa4b9fe46), WORD(0x0e2bc437), WORD(0x8b56471d), WORD(0x4f3c7de2),
+	WORD(0xdf636114), WORD(0x7d6948f9), WORD(0xa2c25ffd), WORD(0x2d175f83),
+	WORD(0xf4d16dae), WORD(0x7b0b7b0c), WORD(0xf1a75658), WORD(0x44223f2f),
+	WORD(0x00000134), WORD(0x1599be4c), WORD(0x45a852e2), WORD(0xdf5a4d3a),
+	WORD(0x4e971b68), WORD(0xdeb7eaa3), WORD(0xa0802e95), WORD(0xbd812f3b),
+	WORD(0x6f2c1d6c), WORD(0x848e4984), WORD(0x1f4edc94), WORD(0x1adf98b1),
+	WORD(0xa300d9be), WORD(0xcd1d8b03), WORD(0xdcb382ee), WORD(0x1a2764e8),
+	WORD(0xa2072f72), WORD(0x00000150),
+	/* T[7] */
+	WORD(0xc7034e39), WORD(0xe5eb05a3), WORD(0x9f3bfe9b), WORD(0xad602abc),
+	WORD(0x96132f98), WORD(0xace8d02c), WORD(0x53152ead), WORD(0x55926d91),
+	WORD(0x6e571919), WORD(0x0a515e66), WORD(0xff3721d2), WORD(0x0d478c6d),
+	WORD(0x8614a27f), WORD(0x33cf1569), WORD(0xb2d5745b), WORD(0xc79ade4d),
+	WORD(0x00000193), WORD(0x5d2ec4da), WORD(0x5031acd3), WORD(0xe67e0361),
+	WORD(0x7eb3f4e9), WORD(0x7bf3d38f), WORD(0x72df8eef), WORD(0x54f55ed8),
+	WORD(0xa0d3bfa9), WORD(0x1e3f0ed2), WORD(0x83682892), WORD(0x82db8a5b),
+	WORD(0xabe7d779), WORD(0xf84c2fb3), WORD(0x20603a95), WORD(0xd556e35f),
+	WORD(0xf6909a99), WORD(0x000001ae),
+	/* T[8] */
+	WORD(0xef4e2f64), WORD(0xda831b5e), WORD(0xa891564c), WORD(0xcc39681a),
+	WORD(0xbf44167e), WORD(0x3b3a7d13), WORD(0x8a2e9acf), WORD(0xdf863a5e),
+	WORD(0x899a4de3), WORD(0xbd5c0f46), WORD(0xbf901b74), WORD(0x4d75d920),
+	WORD(0x92bb521f), WORD(0x21161e10), WORD(0x29e490c6), WORD(0xf9353cac),
+	WORD(0x0000012c), WORD(0x91d3c0b9), WORD(0x1706f3e6), WORD(0xa436a8c7),
+	WORD(0x4a3b1031), WORD(0xb9b1454d), WORD(0x1ffdd2c9), WORD(0xd84ef09e),
+	WORD(0xdf80c7cf), WORD(0x06752d86), WORD(0x79a26422), WORD(0x0243d98c),
+	WORD(0xaab05160), WORD(0x8d078fb0), WORD(0xaa788305), WORD(0x441326bd),
+	WORD(0xa39da5bc), WORD(0x000001d1),
+	/* T[9] */
+	WORD(0xb2ddd4d3), WORD(0xcf2aa6e9), WORD(0x4bf4203b), WORD(0x07334475),
+	WORD(0x3971534b), WORD(0xc83fcbc1), WORD(0xd522cfbd), WORD(0x089626f7),
+	WORD(0xe88e6453), WORD(0x9e1b5f3b), WORD(0x2eece344), WORD(0x46e16972),
+	WORD(0x1db0a341), WORD(0x1edab27a), WORD(0xb946bc95), WORD(0xe8ccb528),
+	WORD(0x000001ea), WORD(0x9a6ff325), WORD(0xf568a371), WORD(0x48a3149d),
+	WORD(0x9af0e1d6), WORD(0x2e909ef0), WORD(0x37f8492c), WORD(0x1d7e57ff),
+	WORD(0x2c94d807), WORD(0xc6fbac83), WORD(0x59f9ad53), WORD(0x466ce172),
+	WORD(0x7df81fdd), WORD(0x2abc33b2), WORD(0xfabecd89), WORD(0x3b06d19f),
+	WORD(0x3b82581b), WORD(0x000000c6),
+	/* T[10] */
+	WORD(0x22ec3935), WORD(0x83c616da), WORD(0xf4802458), WORD(0x3ce12fd5),
+	WORD(0xc351bbbe), WORD(0x755688d1), WORD(0x4ae9fb66), WORD(0x767bd5b4),
+	WORD(0xf7be4c3f), WORD(0xda52b442), WORD(0x6912e858), WORD(0x8659f828),
+	WORD(0x947996df), WORD(0x514174f1), WORD(0x6aaefca0), WORD(0xae2bd0ed),
+	WORD(0x000000e7), WORD(0xf46982d8), WORD(0xaf1a56fe), WORD(0x81615a72),
+	WORD(0x2f01364a), WORD(0xf5c36037), WORD(0x1d498543), WORD(0xef75506b),
+	WORD(0xc6d10724), WORD(0x6e0edf47), WORD(0xc8afc8b4), WORD(0x1bdbfe4f),
+	WORD(0x4f86cc58), WORD(0xd5de3923), WORD(0xc8bdfb59), WORD(0x51a75660),
+	WORD(0xb7549b74), WORD(0x000000a5),
+	/* T[11] */
+	WORD(0xbe82c59a), WORD(0xc68f1c9f), WORD(0xa19a8388), WORD(0x61ada129),
+	WORD(0x8d7e2c8e), WORD(0xfea85704), WORD(0xe4f04f4c), WORD(0x2e585fb9),
+	WORD(0xb5c27754), WORD(0x57f23a30), WORD(0x3884c22a), WORD(0x939ef503),
+	WORD(0xc3ec21ae), WORD(0x6b97bb87), WORD(0xf92c6727), WORD(0x4f271a7e),
+	WORD(0x00000144), WORD(0x0b24c0a7), WORD(0xadf25a92), WORD(0x4c1c57e3),
+	WORD(0xebe46067), WORD(0x90b61e7f), WORD(0xbe66f7c3), WORD(0xa649ee0e),
+	WORD(0xde38f393), WORD(0x7a946d8f), WORD(0x1dd76ee5), WORD(0x2d11a140),
+	WORD(0xa340094c), WORD(0x21f332e1), WORD(0xfd064aba), WORD(0xe56d6671),
+	WORD(0x0512906c), WORD(0x000001f3),
+	/* T[12] */
+	WORD(0xb7157394), WORD(0x6ddd9ace), WORD(0x0d6b6b4d), WORD(0xe10fa1c6),
+	WORD(0xfc01e098), WORD(0xa4f5b3ce), WORD(0xfa9ca6f8), WORD(0xb23cef45),
+	WORD(0x4330cc30), WORD(0xc8ac0aee), WORD(0x34502467), WORD(0x5840c8ea),
+	WORD(0xca898b1f), WORD(0xd6b7a6d9), WORD(0x3a564f4b), WORD(0x8fc2796c),
+	WORD(0x000001f1), WORD(0x9ffdb135), WORD(0x35e6d9dd), WORD(0x7c1e0982),
+	WORD(0x29a75905), WORD(0x53cf3a54), WORD(0x1be75a8d), WORD(0xa1fed0d2),
+	WORD(0xc08616ac), WORD(0x85495f18), WORD(0x60eaf7ad), WORD(0x84610119),
+	WORD(0xd36e0356), WORD(0x1a635529), WORD(0xaa29ec56), WORD(0xeb5e4f40),
+	WORD(0x60bec3c0), WORD(0x0000002e),
+	/* T[13] */
+	WORD(0xa4511599), WORD(0xae5bb73e), WORD(0x21c7af66), WORD(0x006aff84),
+	WORD(0x6c66f090), WORD(0x9adc9259), WORD(0xce676e09), WORD(0x50d99165),
+	WORD(0x9fa3958d), WORD(0xc201dae4), WORD(0xa5a20518), WORD(0xcd4d9521),
+	WORD(0x67f0f713), WORD(0x624472ff), WORD(0xc6d2d2b5), WORD(0x29561ef4),
+	WORD(0x000001d2), WORD(0x462c7ddb), WORD(0x77d10221), WORD(0x0479ab0e),
+	WORD(0x7bf07edc), WORD(0x5c23d1e8), WORD(0x6077a31e), WORD(0x62b88490),
+	WORD(0x2cb62b88), WORD(0x6855ee55), WORD(0x23238dea), WORD(0x870ad8f2),
+	WORD(0x99339417), WORD(0xdb8f14f3), WORD(0x37c27071), WORD(0xcb735853),
+	WORD(0xcb0a9056), WORD(0x00000194),
+	/* T[14] */
+	WORD(0x9b115029), WORD(0x0ba5aa77), WORD(0xce879acb), WORD(0x1f48245d),
+	WORD(0xf71ddda1), WORD(0xae5d3526), WORD(0x45bde747), WORD(0x40d5c9ed),
+	WORD(0xe6818802), WORD(0x295326fb), WORD(0x072018d5), WORD(0x4a4111c5),
+	WORD(0xef1ff351), WORD(0xe352b580), WORD(0x26911a4d), WORD(0x2e7ed3f3),
+	WORD(0x00000144), WORD(0xe65b7573), WORD(0xc88ea215), WORD(0x0547b90e),
+	WORD(0xa159d4e2), WORD(0xbfa9356c), WORD(0x53d4a687), WORD(0x27a78236),
+	WORD(0x41757eec), WORD(0x72ebc2bc), WORD(0xc24d905c), WORD(0x9f592ad7),
+	WORD(0xbf02c081), WORD(0x21b514cd), WORD(0x2c10b29a), WORD(0x45228666),
+	WORD(0xe2f63da5), WORD(0x00000177),
+	/* T[15] */
+	WORD(0xf8786227), WORD(0x8168536d), WORD(0x35aed5e4), WORD(0x80561729),
+	WORD(0xac329556), WORD(0xc542f4f2), WORD(0x330c8cb6), WORD(0x7d0c92b9),
+	WORD(0xbc8e7d35), WORD(0x990d9f86), WORD(0xf9270221), WORD(0xc0011806),
+	WORD(0x9f40088b), WORD(0x62ab6787), WORD(0x6443e38f), WORD(0xaee93b3d),
+	WORD(0x000000fb), WORD(0xd78b2540), WORD(0xd3e6933d), WORD(0x96ecd9b1),
+	WORD(0xd0c52a3b), WORD(0x3fb0de3e), WORD(0x27c34d13), WORD(0xd212bc6e),
+	WORD(0xc4375a55), WORD(0xc0dfca13), WORD(0x441c783b), WORD(0x93b0cdc3),
+	WORD(0x451df53e), WORD(0xdace8f3b), WORD(0xbec9be56), WORD(0x4d3e5645),
+	WORD(0x84e2d17b), WORD(0x00000070),
+	/* T[16] */
+	WORD(0xbc80723e), WORD(0xe071601e), WORD(0x977e1a82), WORD(0x9240c281),
+	WORD(0xbe0e9c5b), WORD(0x0fdbcc59), WORD(0x0495b6b4), WORD(0x93ef0f2e),
+	WORD(0x28a032de), WORD(0x15110f86), WORD(0x3de69342), WORD(0x7d0b776e),
+	WORD(0xfc618973), WORD(0xc14c2ecd), WORD(0xf90414c1), WORD(0xa4e9d3ff),
+	WORD(0x000001f5), WORD(0xdebc0947), WORD(0x93dbfd94), WORD(0xd46c655a),
+	WORD(0xc1811ccf), WORD(0x61243f40), WORD(0x5abefdaf), WORD(0x63d982bd),
+	WORD(0x965f7a9c), WORD(0xfa0fe6d3), WORD(0x4048303e), WORD(0xf72a793f),
+	WORD(0xb6483d1e), WORD(0xb9e5d4fa), WORD(0xb028007a), WORD(0x926d697b),
+	WORD(0x6453d16c), WORD(0x000000bd),
+	/* T[17] */
+	WORD(0x4be82f13), WORD(0x8fbb48c7), WORD(0xdb666ef0), WORD(0xe2a9ef7e),
+	WORD(0xc591cd01), WORD(0x83c981de), WORD(0x062eaaaf), WORD(0xc0a56f1c),
+	WORD(0xa9bbb76f), WORD(0xa1ffb588), WORD(0x4ff57617), WORD(0xc4719c62),
+	WORD(0x20f4898e), WORD(0x3696f53e), WORD(0xfccd8bfa), WORD(0x0507c7cc),
+	WORD(0x00000176), WORD(0x91277609), WORD(0x4722d9fc), WORD(0x47aa7a7d),
+	WORD(0xc2633a41), WORD(0xe1fa4b6e), WORD(0xebff9a99), WORD(0x2e82dc03),
+	WORD(0xd625746b), WORD(0xdd194073), WORD(0x38c3a0da), WORD(0x4f3c1373),
+	WORD(0x03fe3e10), WORD(0xd8456078), WORD(0x922b6279), WORD(0xcfa68aaf),
+	WORD(0xa0397042), WORD(0x0000000c),
+	/* T[18] */
+	WORD(0x56de6ed7), WORD(0x2ff37161), WORD(0xa04619fe), WORD(0x467d4670),
+	WORD(0x1ef11975), WORD(0xb1296d65), WORD(0x8fd30b8c), WORD(0x408686fc),
+	WORD(0x7afa5332), WORD(0x2eb56882), WORD(0x60103c54), WORD(0x3b786876),
+	WORD(0x8acc5d2b), WORD(0xbfabccb3), WORD(0xb2837eba), WORD(0x8238664f),
+	WORD(0x0000008e), WORD(0x376bf759), WORD(0x2f81fcf3), WORD(0xd11de0c0),
+	WORD(0xe954e5d8), WORD(0x6817166b), WORD(0xfa2ac1d0), WORD(0x1883d73b),
+	WORD(0xa8531a91), WORD(0x81d5a52e), WORD(0x48474d01), WORD(0xaf8a52e7),
+	WORD(0x392f6d4b), WORD(0xdcbd6641), WORD(0xfd32e73b), WORD(0x10a38e39),
+	WORD(0xc4dc86e0), WORD(0x00000103),
+	/* T[19] */
+	WORD(0xbbfd9c34), WORD(0xe1ac7185), WORD(0x98fbbdde), WORD(0x35dc9837),
+	WORD(0x79a93920), WORD(0x266009ee), WORD(0xd7dd936d), WORD(0xb3206da6),
+	WORD(0x372d64ca), WORD(0xddbb517c), WORD(0x04a6461c), WORD(0x1b1e9439),
+	WORD(0xe7aaf8ca), WORD(0x877497fe), WORD(0xf26ff3c5), WORD(0x96296fdc),
+	WORD(0x000001df), WORD(0xa65e7219), WORD(0x846d86fb), WORD(0xcb928a23),
+	WORD(0x45f4fdd4), WORD(0x23032859), WORD(0xc089858f), WORD(0x5720ff65),
+	WORD(0x7453c91f), WORD(0xc5530841), WORD(0xa5ac9683), WORD(0xb7a19ce6),
+	WORD(0xc32812f2), WORD(0x7328bb63), WORD(0x9807f776), WORD(0xa6be4145),
+	WORD(0x291e0f14), WORD(0x00000137),
+	/* T[20] */
+	WORD(0xa9c1dcf3), WORD(0x77f645ce), WORD(0xe7f2b68d), WORD(0xd1069019),
+	WORD(0x36ceb20e), WORD(0x7c855642), WORD(0x6fae1e47), WORD(0x7f482d51),
+	WORD(0x5695450f), WORD(0xedc5e94e), WORD(0x9db0f1ae), WORD(0x8e1df180),
+	WORD(0x1713f02e), WORD(0x5115b3df), WORD(0x9ef674cc), WORD(0xbea12da2),
+	WORD(0x00000147), WORD(0xe1b6067a), WORD(0xc661e70f), WORD(0x651186d8),
+	WORD(0x9607c339), WORD(0x26ed3eda), WORD(0x81751f79), WORD(0x77042a26),
+	WORD(0x248a3faf), WORD(0x4e053166), WORD(0xa8bbcd20), WORD(0x78402b8a),
+	WORD(0x50566b37), WORD(0x335e76f9), WORD(0x74f2b008), WORD(0x1c003ce3),
+	WORD(0xaecc87d1), WORD(0x00000158),
+	/* T[21] */
+	WORD(0x99c8932d), WORD(0x14db5acb), WORD(0xe5473b91), WORD(0x445d16d1),
+	WORD(0x8f76a898), WORD(0x1f7e4ea7), WORD(0x2ac7d459), WORD(0x1a62122f),
+	WORD(0xce786ce1), WORD(0x5be3dcbc), WORD(0xb53dccc8), WORD(0x84fe8924),
+	WORD(0xbe939c5b), WORD(0xa926cb45), WORD(0xa8100f5c), WORD(0xef1a0b4a),
+	WORD(0x0000012b), WORD(0xbddeeaf0), WORD(0x4c0b217f), WORD(0x5e18f845),
+	WORD(0xa973a273), WORD(0x28652116), WORD(0x5647eff1), WORD(0x671bf6fa),
+	WORD(0x1a93c747), WORD(0x99981e9d), WORD(0x23b70a19), WORD(0x5a47dfa4),
+	WORD(0x40b65a5c), WORD(0xd87cfec1), WORD(0xf3af65eb), WORD(0xcf28fb34),
+	WORD(0x21554de9), WORD(0x0000017c),
+	/* T[22] */
+	WORD(0x2c329734), WORD(0x7e70a186), WORD(0xdc504e24), WORD(0xe3938690),
+	WORD(0x7091134a), WORD(0xcaa3d172), WORD(0xb8a0885c), WORD(0x5d15acf1),
+	WORD(0x35455962), WORD(0x4813bc17), WORD(0xa978a421), WORD(0xe24e7be2),
+	WORD(0x9a6f682a), WORD(0xc523f556), WORD(0x5abed4d6), WORD(0x94c0e325),
+	WORD(0x000000ec), WORD(0xcce6d479), WORD(0x97989e18), WORD(0xd4f16826),
+	WORD(0x0a6298ee), WORD(0x96345a57), WORD(0x488d752b), WORD(0xbba17b08),
+	WORD(0xeb2e411d), WORD(0x6b4e1a68), WORD(0x080fd04e), WORD(0x48c610c1),
+	WORD(0x93fc3174), WORD(0x6e3f1499), WORD(0x8c81fd01), WORD(0x23fc5315),
+	WORD(0xa6fe0dfb), WORD(0x00000159),
+	/* T[23] */
+	WORD(0x35829bdc), WORD(0x03da130a), WORD(0x4cdf1342), WORD(0x953347dd),
+	WORD(0x10981748), WORD(0x4996680e), WORD(0x7984c07c), WORD(0x10d091d0),
+	WORD(0x56832437), WORD(0xc7deb10b), WORD(0x4478b0d5), WORD(0x77c6a7d3),
+	WORD(0x176efda6), WORD(0x6b97c130), WORD(0x39c3826c), WORD(0xe6bb64fb),
+	WORD(0x000001e6), WORD(0xe8d65bfc), WORD(0x717b9293), WORD(0x4c4de3f3),
+	WORD(0x0cff4e86), WORD(0x8857c088), WORD(0x6f06618e), WORD(0x6ee31a40),
+	WORD(0x759b2e8f), WORD(0x55d253e9), WORD(0xe802ba71), WORD(0x30671e7e),
+	WORD(0xc3484df2), WORD(0x6e60f5c8), WORD(0x11a97dae), WORD(0x7aa88648),
+	WORD(0x517c0807), WORD(0x0000010f),
+	/* T[24] */
+	WORD(0x1ab49a6c), WORD(0x6926c0a0), WORD(0x692b9ee0), WORD(0xc4adea1f),
+	WORD(0x80baef34), WORD(0xa1f6c7e3), WORD(0x92fc6030), WORD(0x2d69d0ec),
+	WORD(0xa70987b3), WORD(0xf96c0ce5), WORD(0xabc34d36), WORD(0x93b8daba),
+	WORD(0xfacd5c29), WORD(0x8e915c4d), WORD(0x6cd92dd5), WORD(0xa5c3a1d2),
+	WORD(0x000000ee), WORD(0x507616fb), WORD(0xff1e3f22), WORD(0xe69d39e9),
+	WORD(0x4a560209), WORD(0xc6b7020b), WORD(0xba9af51f), WORD(0x0610fba4),
+	WORD(0x5b3cb4c6), WORD(0x6cf2e7af), WORD(0x8728d140), WORD(0x20eb418b),
+	WORD(0x5c32c37a), WORD(0x6778bfd2), WORD(0xf98805fe), WORD(0x7e491d3d),
+	WORD(0xb4b404e3), WORD(0x0000009e),
+	/* T[25] */
+	WORD(0x71941a96), WORD(0x2566231d), WORD(0x09194f1b), WORD(0x98311c78),
+	WORD(0xd903790f), WORD(0x0d9749ef), WORD(0x687a47e9), WORD(0xc1b5d985),
+	WORD(0x0b597af9), WORD(0xf25440ef), WORD(0x7e48ace5), WORD(0x010d0637),
+	WORD(0xa131f756), WORD(0xb2cfffbb), WORD(0xcc57921c), WORD(0xda5ca16d),
+	WORD(0x00000167), WORD(0xe10fda98), WORD(0xf13dcf86), WORD(0xe338765c),
+	WORD(0x88e90c77), WORD(0x0eadfe93), WORD(0xf9757eae), WORD(0x6b52fc60),
+	WORD(0x3d88964b), WORD(0x4a4d6846), WORD(0x4640cc9b), WORD(0xd0fe51fa),
+	WORD(0xc10c203f), WORD(0x41a2168d), WORD(0xdda3ec58), WORD(0x41bbb6f8),
+	WORD(0x2c498b42), WORD(0x000001cb),
+	/* T[26] */
+	WORD(0x7c7d8564), WORD(0xd41072e7), WORD(0x0182959a), WORD(0x85d347f1),
+	WORD(0xe1dc2951), WORD(0xf0329dbe), WORD(0xbbf4ffb2), WORD(0x50778fc3),
+	WORD(0xbee65bdb), WORD(0xad4c7780), WORD(0x16e77115), WORD(0x7688908b),
+	WORD(0x831a384d), WORD(0x7b2850a5), WORD(0xaa784685), WORD(0xbb38ed3b),
+	WORD(0x0000001d), WORD(0xc10aea32), WORD(0xac8fe51a), WORD(0x0a449aa8),
+	WORD(0x1d00fee1), WORD(0x3d0c1b41), WORD(0x2e909e49), WORD(0xd624bf68),
+	WORD(0x68ecfae1), WORD(0xf3d729c8), WORD(0x461f0cee), WORD(0xa6adfed6),
+	WORD(0xa66a592b), WORD(0x739706e5), WORD(0x2f84a712), WORD(0x31c5a04d),
+	WORD(0xfeeee136), WORD(0x000001c4),
+	/* T[27] */
+	WORD(0xd82ef668), WORD(0x5501a6a7), WORD(0xc1aa8a75), WORD(0xb2fa2222),
+	WORD(0xafb1ad12), WORD(0x4de5d43d), WORD(0x37de2bcb), WORD(0xdc4117b3),
+	WORD(0x03984027), WORD(0x294789ad), WORD(0x2c760387), WORD(0x0e59f4fa),
+	WORD(0x4968fffc), WORD(0x2218ab41), WORD(0x4d54d3e0), WORD(0x13d2fba1),
+	WORD(0x000000f8), WORD(0x6c0942a6), WORD(0xdd9b4d38), WORD(0x4729cde8),
+	WORD(0x62696ea2), WORD(0x8eefd28d), WORD(0xef95052f), WORD(0xc69a8db8),
+	WORD(0x0b438c36), WORD(0xc2905534), WORD(0xb302a66a), WORD(0xc84d6b30),
+	WORD(0xf813be5a), WORD(0x1281211a), WORD(0x7176e9eb), WORD(0xaaf4fff4),
+	WORD(0x769e3ddf), WORD(0x0000006f),
+	/* T[28] */
+	WORD(0xa4064818), WORD(0x7b12109a), WORD(0xcd4d95c8), WORD(0xe85b9650),
+	WORD(0xf791b1b4), WORD(0xaa186965), WORD(0x97f7bd09), WORD(0x959c13c5),
+	WORD(0x13108e1c), WORD(0x31a52ff5), WORD(0x59fa78db), WORD(0x13bf93fc),
+	WORD(0xe4e94d0a), WORD(0x52970c63), WORD(0xe0a2d266), WORD(0x786ea74d),
+	WORD(0x00000079), WORD(0xc03f7fcf), WORD(0x4f52a12c), WORD(0xebc874c8),
+	WORD(0x8bcd78bb), WORD(0x70a4625a), WORD(0xb9359540), WORD(0x6fac7a5d),
+	WORD(0x000c8325), WORD(0x7b374b9c), WORD(0x8e1bc128), WORD(0xa2a2f338),
+	WORD(0x2a9e6fcd), WORD(0xb9f2803c), WORD(0xa8744e5f), WORD(0x0230b952),
+	WORD(0x1af02109), WORD(0x000000fa),
+	/* T[29] */
+	WORD(0xab0fde00), WORD(0x30d837b6), WORD(0x0a93a3f6), WORD(0x366ab189),
+	WORD(0x8782444f), WORD(0xd07301f1), WORD(0xc6288d39), WORD(0x6980326b),
+	WORD(0x6e5de8bb), WORD(0xf0cd53ef), WORD(0xf784b7e8), WORD(0xb59c9966),
+	WORD(0x64140bc4), WORD(0x165a38a2), WORD(0x4fea84b6), WORD(0x3cdd9a10),
+	WORD(0x000000e1), WORD(0xcb6d6d07), WORD(0xe190f7a1), WORD(0x97326299),
+	WORD(0x7421e15d), WORD(0xf11aa86e), WORD(0x8aa33130), WORD(0x9cbb6eb9),
+	WORD(0x2f44441f), WORD(0x78ceda21), WORD(0x8799c653), WORD(0x7f6f3fd8),
+	WORD(0x492ce152), WORD(0x040163ee), WORD(0xea57b0b8), WORD(0x191cc659),
+	WORD(0x0488560c), WORD(0x000001fb),
+	/* T[30] */
+	WORD(0xf0085caa), WORD(0xfd25d34c), WORD(0x448a04d6), WORD(0x9d685c92),
+	WORD(0xdcd43cbc), WORD(0xb37c84e0), WORD(0xe3107fe0), WORD(0x8a70e90e),
+	WORD(0x75e2bd41), WORD(0x57c8c735), WORD(0xa380bf7c), WORD(0x771c91b7),
+	WORD(0xebcf4f74), WORD(0x6b07ad7b), WORD(0xa9bb2646), WORD(0x17f54fc5),
+	WORD(0x000000ef), WORD(0x3fd9b746), WORD(0xd09851e3), WORD(0x5a86dfbf),
+	WORD(0x37dd410d), WORD(0x7378862d), WORD(0x801255ac), WORD(0x394889ce),
+	WORD(0x814f5ad0), WORD(0x5a2205d5), WORD(0x8bd9f8cf), WORD(0x678b76b2),
+	WORD(0x706238f6), WORD(0x5a58853f), WORD(0xfb058e2e), WORD(0x6dbbe11c),
+	WORD(0x637598e9), WORD(0x0000008b),
+	/* T[31] */
+	WORD(0x5b7ef792), WORD(0xfd9a6146), WORD(0xd2139441), WORD(0x4f2f3e81),
+	WORD(0x51115807), WORD(0x5cbfa301), WORD(0x8311ddd6), WORD(0xcb612476),
+	WORD(0xa213ab26), WORD(0x7368e2da), WORD(0x494dbf0e), WORD(0x96b88c17),
+	WORD(0x55d9ebbd), WORD(0x556f4ea3), WORD(0xa6d8c73c), WORD(0xf09734eb),
+	WORD(0x0000006c), WORD(0xd7fa547a), WORD(0x1104cf7f), WORD(0x3646f311),
+	WORD(0x0d89940a), WORD(0xe6110931), WORD(0x5801b3bf), WORD(0xe002f9e0),
+	WORD(0x12fd87e1), WORD(0x05fa1f24), WORD(0x9b4c29b7), WORD(0xf5ca69d9),
+	WORD(0x52112a40), WORD(0x7a9160e6), WORD(0x6fd4fe5d), WORD(0x3895c334),
+	WORD(0x79618749), WORD(0x0000002c),
+};
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+static const word_t secp521r1_gen_comb[] = {
+	/* T[0] */
+	WORD(0x31c1), WORD(0x7282), WORD(0x150a), WORD(0xdb79), WORD(0x54d9), WORD(0xc509),
+	WORD(0xea69), WORD(0x03f4), WORD(0x3f08), WORD(0xb51b), WORD(0x189f), WORD(0xb7dc),
+	WORD(0x1a8b), WORD(0x53dd), WORD(0x0f21), WORD(0x55d9), WORD(0x738f), WORD(0x4bad),
+	WORD(0x2c39), WORD(0x0c74), WORD(0x8233), WORD(0x02c1), WORD(0xdb85), WORD(0x3158),
+	WORD(0xd01e), WORD(0xf059), WORD(0x80a8), WORD(0xd916), WORD(0x0573), WORD(0x2a53),
+	WORD(0xa28f), WORD(0x33f6), WORD(0x01ce), WORD(0xe6d3), WORD(0x1ec3), WORD(0x0c55),
+	WORD(0x69a4), WORD(0x7d5f), WORD(0xbe8e), WORD(0xc706), WORD(0xff26), WORD(0x39ee),
+	WORD(0xf36b), WORD(0x5e19), WORD(0xd986), WORD(0x1517), WORD(0x9308), WORD(0x5114),
+	WORD(0x7e4d), WORD(0xda88), WORD(0xc21c), WORD(0x652b), WORD(0xbd83), WORD(0x83f2),
+	WORD(0x4268), WORD(0x8c10), WORD(0x3c31), WORD(0xe355), WORD(0x5f97), WORD(0x522c),
+	WORD(0xc9de), WORD(0xa138), WORD(0x8b2e), WORD(0xc56b), WORD(0xa60a), WORD(0x0000),
+	/* T[1] */
+	WORD(0x0356), WORD(0x14ca), WORD(0x2d6f), WORD(0xa928), WORD(0x8abf), WORD(0x38ae),
+	WORD(0xd248), WORD(0x95d3), WORD(0x22e8), WORD(0x141d), WORD(0xc023), WORD(0xa39e),
+	WORD(0x9f6e), WORD(0x4dc7), WORD(0x53e3), WORD(0x0553), WORD(0x8988), WORD(0x7554),
+	WORD(0x01c8), WORD(0xaf12), WORD(0xc551), WORD(0x5c16), WORD(0x552b), WORD(0x53ca),
+	WORD(0x1df6), WORD(0xeedb), WORD(0xafa6), WORD(0x7b4e), WORD(0x8ab2), WORD(0x0b32),
+	WORD(0x3818), WORD(0x3215), WORD(0x013d), WORD(0x5a63), WORD(0x5c52), WORD(0xca1d),
+	WORD(0xf686), WORD(0xa30e), WORD(0x6275), WORD(0x144c), WORD(0x6741), WORD(0xe396),
+	WORD(0x1036), WORD(0x59b6), WORD(0x26ef), WORD(0xa40b), WORD(0xc428), WORD(0xc0e8),
+	WORD(0x1d5d), WORD(0xd905), WORD(0x1e4e), WORD(0xb55d), WORD(0x5d8b), WORD(0x7fcf),
+	WORD(0x42c3), WORD(0xbc21), WORD(0x2615), WORD(0xcb88), WORD(0xc63d), WORD(0x7881),
+	WORD(0x5c97), WORD(0x99ff), WORD(0x6cdd), WORD(0xfa99), WORD(0x7724), WORD(0x008e),
+	/* T[2] */
+	WORD(0x47a5), WORD(0xdd31), WORD(0x618b), WORD(0x64f9), WORD(0xd371), WORD(0xb7a2),
+	WORD(0x4b71), WORD(0x642b), WORD(0xf71f), WORD(0xca48), WORD(0xe4f2), WORD(0x1d06),
+	WORD(0x1ea1), WORD(0x0fab), WORD(0x9242), WORD(0x0fb8), WORD(0x5975), WORD(0xd3f0),
+	WORD(0xc8a8), WORD(0x5cb8), WORD(0x62e8), WORD(0x34f4), WORD(0xd158), WORD(0x996d),
+	WORD(0xe0b7), WORD(0x0150), WORD(0x543c), WORD(0x654e), WORD(0x15f6), WORD(0xa8a8),
+	WORD(0xdfe2), WORD(0x597d), WORD(0x00a5), WORD(0x305f), WORD(0x23c0), WORD(0xfbb8),
+	WORD(0x26ca), WORD(0xbea6), WORD(0x67eb), WORD(0xbbe6), WORD(0xbd75), WORD(0x38bd),
+	WORD(0x6ed9), WORD(0x59c8), WORD(0x7d8a), WORD(0xbcc9), WORD(0x68b4), WORD(0xbd87),
+	WORD(0x6fbe), WORD(0x05d0), WORD(0xd41a), WORD(0x0fc5), WORD(0xfa3d), WORD(0x1843),
+	WORD(0x771f), WORD(0x07e8), WORD(0x20b9), WORD(0x14e4), WORD(0x48b0), WORD(0xe853),
+	WORD(0x66ec), WORD(0xc3b6), WORD(0xede4), WORD(0xe490), WORD(0x8e3c), WORD(0x01b8),
+	/* T[3] */
+	WORD(0x9c51), WORD(0x7c3e), WORD(0xbb08), WORD(0x524e), WORD(0xb459), WORD(0x3209),
+	WORD(0x0921), WORD(0x06d5), WORD(0x2e04), WORD(0x1bb4), WORD(0x4d5c), WORD(0xfa70),
+	WORD(0x14fa), WORD(0x0361), WORD(0x6109), WORD(0x7cef), WORD(0xf4f4), WORD(0x3977),
+	WORD(0xd672), WORD(0xd15d), WORD(0xfe8f), WORD(0xe87f), WORD(0xd46a), WORD(0xd358),
+	WORD(0x33eb), WORD(0xf438), WORD(0x30ce), WORD(0x8e8e), WORD(0xbc35), WORD(0x5f48),
+	WORD(0x03ed), WORD(0xf412), WORD(0x00de), WORD(0xc5a2), WORD(0x8357), WORD(0x657e),
+	WORD(0x1a85), WORD(0xdb66), WORD(0xebc0), WORD(0xc70c), WORD(0x8bc6), WORD(0x8fc1),
+	WORD(0xb5cf), WORD(0xf87f), WORD(0x8bcc), WORD(0x4609), WORD(0x7f12), WORD(0xf385),
+	WORD(0x36af), WORD(0x5be4), WORD(0xc718), WORD(0x16d5), WORD(0xa44a), WORD(0xe964),
+	WORD(0x8968), WORD(0x92c0), WORD(0xf1bc), WORD(0xbbfc), WORD(0xd78e), WORD(0xe2b8),
+	WORD(0xde19), WORD(0xb967), WORD(0x933e), WORD(0x9bbb), WORD(0x1d62), WORD(0x00d3),
+	/* T[4] */
+	WORD(0xd147), WORD(0xabf5), WORD(0xa77f), WORD(0x986c), WORD(0x524e), WORD(0x5e5f),
+	WORD(0xd9e3), WORD(0x00a2), WORD(0x3721), WORD(0x86d8), WORD(0x047d), WORD(0xaa4e),
+	WORD(0x4881), WORD(0xdefb), WORD(0x2c6f), WORD(0x1b49), WORD(0xa2bb), WORD(0x69b6),
+	WORD(0x2c81), WORD(0x7d93), WORD(0xddba), WORD(0xdc50), WORD(0x2e8a), WORD(0x75b3),
+	WORD(0x2b19), WORD(0x0b58), WORD(0xa6ef), WORD(0x9204), WORD(0x3e62), WORD(0x55d8),
+	WORD(0x9c40), WORD(0x4607), WORD(0x00bf), WORD(0x259b), WORD(0x0549), WORD(0xa22a),
+	WORD(0x816b), WORD(0xa06c), WORD(0xb8e0), WORD(0x9f55), WORD(0x2b6d), WORD(0x4e94),
+	WORD(0xb53e), WORD(0x0759), WORD(0x67d1), WORD(0x5a76), WORD(0x9d50), WORD(0x2e13),
+	WORD(0x6867), WORD(0x71b7), WORD(0x2a8b), WORD(0x2557), WORD(0xd294), WORD(0x290c),
+	WORD(0x67ee), WORD(0x519b), WORD(0x4066), WORD(0x29ef), WORD(0xf060), WORD(0xa3c5),
+	WORD(0xb669), WORD(0x38e8), WORD(0x4cc5), WORD(0x44fc), WORD(0x8869), WORD(0x005e),
+	/* T[5] */
+	WORD(0x5718), WORD(0x1664), WORD(0x52e0), WORD(0x7649), WORD(0xacf5), WORD(0xd214),
+	WORD(0x0542), WORD(0x968d), WORD(0x0a99), WORD(0xacb4), WORD(0xd49e), WORD(0xc619),
+	WORD(0x56ee), WORD(0x47f5), WORD(0x2bc4), WORD(0x4986), WORD(0x2313), WORD(0x75f5),
+	WORD(0xef41), WORD(0x7fa0), WORD(0xb6ce), WORD(0xd470), WORD(0x4511), WORD(0x0ba4),
+	WORD(0x4541), WORD(0x0e45), WORD(0xf545), WORD(0xb551), WORD(0x304f), WORD(0xba21),
+	WORD(0x4197), WORD(0x67a5), WORD(0x018e), WORD(0x84dc), WORD(0x1a8e), WORD(0x6fea),
+	WORD(0x1492), WORD(0x97b2), WORD(0x4f35), WORD(0xc77c), WORD(0x2183), WORD(0x9c1b),
+	WORD(0x7298), WORD(0xcc34), WORD(0xeba2), WORD(0x2a42), WORD(0x7ba1), WORD(0x67ef),
+	WORD(0x65c2), WORD(0x74d7), WORD(0xdc79), WORD(0xfb10), WORD(0x0683), WORD(0x0f08),
+	WORD(0xa7c6), WORD(0x7419), WORD(0x33d3), WORD(0x4a98), WORD(0xe0c2), WORD(0x41dc),
+	WORD(0x2deb), WORD(0xb7a0), WORD(0x3408), WORD(0xa0be), WORD(0x80d2), WORD(0x015e),
+	/* T[6] */
+	WORD(0xd7de), WORD(0xff45), WORD(0x8bf1), WORD(0x2d93), WORD(0x21a4), WORD(0x450c),
+	WORD(0x4457), WORD(0xfe46), WORD(0xa4b9), WORD(0xc437), WORD(0x0e2b), WORD(0x471d),
+	WORD(0x8b56), WORD(0x7de2), WORD(0x4f3c), WORD(0x6114), WORD(0xdf63), WORD(0x48f9),
+	WORD(0x7d69), WORD(0x5ffd), WORD(0xa2c2), WORD(0x5f83), WORD(0x2d17), WORD(0x6dae),
+	WORD(0xf4d1), WORD(0x7b0c), WORD(0x7b0b), WORD(0x5658), WORD(0xf1a7), WORD(0x3f2f),
+	WORD(0x4422), WORD(0x2734), WORD(0x007d), WORD(0x1599), WORD(0x52e2), WORD(0x45a8),
+	WORD(0x4d3a), WORD(0xdf5a), WORD(0x1b68), WORD(0x4e97), WORD(0xeaa3), WORD(0xdeb7),
+	WORD(0x2e95), WORD(0xa080), WORD(0x2f3b), WORD(0xbd81), WORD(0x1d6c), WORD(0x6f2c),
+	WORD(0x4984), WORD(0x848e), WORD(0xdc94), WORD(0x1f4e), WORD(0x98b1), WORD(0x1adf),
+	WORD(0xd9be), WORD(0xa300), WORD(0x8b03), WORD(0xcd1d), WORD(0x82ee), WORD(0xdcb3),
+	WORD(0x64e8), WORD(0x1a27), WORD(0x2f72), WORD(0xa207), WORD(0x9950), WORD(0x017c),
+	/* T[7] */
+	WORD(0xc703), WORD(0x05a3), WORD(0xe5eb), WORD(0xfe9b), WORD(0x9f3b), WORD(0x2abc),
+	WORD(0xad60), WORD(0x2f98), WORD(0x9613), WORD(0xd02c), WORD(0xace8), WORD(0x2ead),
+	WORD(0x5315), WORD(0x6d91), WORD(0x5592), WORD(0x1919), WORD(0x6e57), WORD(0x5e66),
+	WORD(0x0a51), WORD(0x21d2), WORD(0xff37), WORD(0x8c6d), WORD(0x0d47), WORD(0xa27f),
+	WORD(0x8614), WORD(0x1569), WORD(0x33cf), WORD(0x745b), WORD(0xb2d5), WORD(0xde4d),
+	WORD(0xc79a), WORD(0x7393), WORD(0x009c), WORD(0x5d2e), WORD(0xacd3), WORD(0x5031),
+	WORD(0x0361), WORD(0xe67e), WORD(0xf4e9), WORD(0x7eb3), WORD(0xd38f), WORD(0x7bf3),
+	WORD(0x8eef), WORD(0x72df), WORD(0x5ed8), WORD(0x54f5), WORD(0xbfa9), WORD(0xa0d3),
+	WORD(0x0ed2), WORD(0x1e3f), WORD(0x2892), WORD(0x8368), WORD(0x8a5b), WORD(0x82db),
+	WORD(0xd779), WORD(0xabe7), WORD(0x2fb3), WORD(0xf84c), WORD(0x3a95), WORD(0x2060),
+	WORD(0xe35f), WORD(0xd556), WORD(0x9a99), WORD(0xf690), WORD(0xb5ae), WORD(0x0189),
+	/* T[8] */
+	WORD(0xef4e), WORD(0x1b5e), WORD(0xda83), WORD(0x564c), WORD(0xa891), WORD(0x681a),
+	WORD(0xcc39), WORD(0x167e), WORD(0xbf44), WORD(0x7d13), WORD(0x3b3a), WORD(0x9acf),
+	WORD(0x8a2e), WORD(0x3a5e), WORD(0xdf86), WORD(0x4de3), WORD(0x899a), WORD(0x0f46),
+	WORD(0xbd5c), WORD(0x1b74), WORD(0xbf90), WORD(0xd920), WORD(0x4d75), WORD(0x521f),
+	WORD(0x92bb), WORD(0x1e10), WORD(0x2116), WORD(0x90c6), WORD(0x29e4), WORD(0x3cac),
+	WORD(0xf935), WORD(0xc92c), WORD(0x005e), WORD(0x91d3), WORD(0xf3e6), WORD(0x1706),
+	WORD(0xa8c7), WORD(0xa436), WORD(0x1031), WORD(0x4a3b), WORD(0x454d), WORD(0xb9b1),
+	WORD(0xd2c9), WORD(0x1ffd), WORD(0xf09e), WORD(0xd84e), WORD(0xc7cf), WORD(0xdf80),
+	WORD(0x2d86), WORD(0x0675), WORD(0x6422), WORD(0x79a2), WORD(0xd98c), WORD(0x0243),
+	WORD(0x5160), WORD(0xaab0), WORD(0x8fb0), WORD(0x8d07), WORD(0x8305), WORD(0xaa78),
+	WORD(0x26bd), WORD(0x4413), WORD(0xa5bc), WORD(0xa39d), WORD(0x73d1), WORD(0x0181),
+	/* T[9] */
+	WORD(0xb2dd), WORD(0xa6e9), WORD(0xcf2a), WORD(0x203b), WORD(0x4bf4), WORD(0x4475),
+	WORD(0x0733), WORD(0x534b), WORD(0x3971), WORD(0xcbc1), WORD(0xc83f), WORD(0xcfbd),
+	WORD(0xd522), WORD(0x26f7), WORD(0x0896), WORD(0x6453), WORD(0xe88e), WORD(0x5f3b),
+	WORD(0x9e1b), WORD(0xe344), WORD(0x2eec), WORD(0x6972), WORD(0x46e1), WORD(0xa341),
+	WORD(0x1db0), WORD(0xb27a), WORD(0x1eda), WORD(0xbc95), WORD(0xb946), WORD(0xb528),
+	WORD(0xe8cc), WORD(0xa7ea), WORD(0x01a9), WORD(0x9a6f), WORD(0xa371), WORD(0xf568),
+	WORD(0x149d), WORD(0x48a3), WORD(0xe1d6), WORD(0x9af0), WORD(0x9ef0), WORD(0x2e90),
+	WORD(0x492c), WORD(0x37f8), WORD(0x57ff), WORD(0x1d7e), WORD(0xd807), WORD(0x2c94),
+	WORD(0xac83), WORD(0xc6fb), WORD(0xad53), WORD(0x59f9), WORD(0xe172), WORD(0x466c),
+	WORD(0x1fdd), WORD(0x7df8), WORD(0x33b2), WORD(0x2abc), WORD(0xcd89), WORD(0xfabe),
+	WORD(0xd19f), WORD(0x3b06), WORD(0x581b), WORD(0x3b82), WORD(0x4ac6), WORD(0x01e6),
+	/* T[10] */
+	WORD(0x22ec), WORD(0x16da), WORD(0x83c6), WORD(0x2458), WORD(0xf480), WORD(0x2fd5),
+	WORD(0x3ce1), WORD(0xbbbe), WORD(0xc351), WORD(0x88d1), WORD(0x7556), WORD(0xfb66),
+	WORD(0x4ae9), WORD(0xd5b4), WORD(0x767b), WORD(0x4c3f), WORD(0xf7be), WORD(0xb442),
+	WORD(0xda52), WORD(0xe858), WORD(0x6912), WORD(0xf828), WORD(0x8659), WORD(0x96df),
+	WORD(0x9479), WORD(0x74f1), WORD(0x5141), WORD(0xfca0), WORD(0x6aae), WORD(0xd0ed),
+	WORD(0xae2b), WORD(0x6ae7), WORD(0x0072), WORD(0xf469), WORD(0x56fe), WORD(0xaf1a),
+	WORD(0x5a72), WORD(0x8161), WORD(0x364a), WORD(0x2f01), WORD(0x6037), WORD(0xf5c3),
+	WORD(0x8543), WORD(0x1d49), WORD(0x506b), WORD(0xef75), WORD(0x0724), WORD(0xc6d1),
+	WORD(0xdf47), WORD(0x6e0e), WORD(0xc8b4), WORD(0xc8af), WORD(0xfe4f), WORD(0x1bdb),
+	WORD(0xcc58), WORD(0x4f86), WORD(0x3923), WORD(0xd5de), WORD(0xfb59), WORD(0xc8bd),
+	WORD(0x5660), WORD(0x51a7), WORD(0x9b74), WORD(0xb754), WORD(0xb0a5), WORD(0x0105),
+	/* T[11] */
+	WORD(0xbe82), WORD(0x1c9f), WORD(0xc68f), WORD(0x8388), WORD(0xa19a), WORD(0xa129),
+	WORD(0x61ad), WORD(0x2c8e), WORD(0x8d7e), WORD(0x5704), WORD(0xfea8), WORD(0x4f4c),
+	WORD(0xe4f0), WORD(0x5fb9), WORD(0x2e58), WORD(0x7754), WORD(0xb5c2), WORD(0x3a30),
+	WORD(0x57f2), WORD(0xc22a), WORD(0x3884), WORD(0xf503), WORD(0x939e), WORD(0x21ae),
+	WORD(0xc3ec), WORD(0xbb87), WORD(0x6b97), WORD(0x6727), WORD(0xf92c), WORD(0x1a7e),
+	WORD(0x4f27), WORD(0x3544), WORD(0x018b), WORD(0x0b24), WORD(0x5a92), WORD(0xadf2),
+	WORD(0x57e3), WORD(0x4c1c), WORD(0x6067), WORD(0xebe4), WORD(0x1e7f), WORD(0x90b6),
+	WORD(0xf7c3), WORD(0xbe66), WORD(0xee0e), WORD(0xa649), WORD(0xf393), WORD(0xde38),
+	WORD(0x6d8f), WORD(0x7a94), WORD(0x6ee5), WORD(0x1dd7), WORD(0xa140), WORD(0x2d11),
+	WORD(0x094c), WORD(0xa340), WORD(0x32e1), WORD(0x21f3), WORD(0x4aba), WORD(0xfd06),
+	WORD(0x6671), WORD(0xe56d), WORD(0x906c), WORD(0x0512), WORD(0x4ff3), WORD(0x0181),
+	/* T[12] */
+	WORD(0xb715), WORD(0x9ace), WORD(0x6ddd), WORD(0x6b4d), WORD(0x0d6b), WORD(0xa1c6),
+	WORD(0xe10f), WORD(0xe098), WORD(0xfc01), WORD(0xb3ce), WORD(0xa4f5), WORD(0xa6f8),
+	WORD(0xfa9c), WORD(0xef45), WORD(0xb23c), WORD(0xcc30), WORD(0x4330), WORD(0x0aee),
+	WORD(0xc8ac), WORD(0x2467), WORD(0x3450), WORD(0xc8ea), WORD(0x5840), WORD(0x8b1f),
+	WORD(0xca89), WORD(0xa6d9), WORD(0xd6b7), WORD(0x4f4b), WORD(0x3a56), WORD(0x796c),
+	WORD(0x8fc2), WORD(0x29f1), WORD(0x00e7), WORD(0x9ffd), WORD(0xd9dd), WORD(0x35e6),
+	WORD(0x0982), WORD(0x7c1e), WORD(0x5905), WORD(0x29a7), WORD(0x3a54), WORD(0x53cf),
+	WORD(0x5a8d), WORD(0x1be7), WORD(0xd0d2), WORD(0xa1fe), WORD(0x16ac), WORD(0xc086),
+	WORD(0x5f18), WORD(0x8549), WORD(0xf7ad), WORD(0x60ea), WORD(0x0119), WORD(0x8461),
+	WORD(0x0356), WORD(0xd36e), WORD(0x5529), WORD(0x1a63), WORD(0xec56), WORD(0xaa29),
+	WORD(0x4f40), WORD(0xeb5e), WORD(0xc3c0), WORD(0x60be), WORD(0x6a2e), WORD(0x0162),
+	/* T[13] */
+	WORD(0xa451), WORD(0xb73e), WORD(0xae5b), WORD(0xaf66), WORD(0x21c7), WORD(0xff84),
+	WORD(0x006a), WORD(0xf090), WORD(0x6c66), WORD(0x9259), WORD(0x9adc), WORD(0x6e09),
+	WORD(0xce67), WORD(0x9165), WORD(0x50d9), WORD(0x958d), WORD(0x9fa3), WORD(0xdae4),
+	WORD(0xc201), WORD(0x0518), WORD(0xa5a2), WORD(0x9521), WORD(0xcd4d), WORD(0xf713),
+	WORD(0x67f0), WORD(0x72ff), WORD(0x6244), WORD(0xd2b5), WORD(0xc6d2), WORD(0x1ef4),
+	WORD(0x2956), WORD(0x33d2), WORD(0x002b), WORD(0x462c), WORD(0x0221), WORD(0x77d1),
+	WORD(0xab0e), WORD(0x0479), WORD(0x7edc), WORD(0x7bf0), WORD(0xd1e8), WORD(0x5c23),
+	WORD(0xa31e), WORD(0x6077), WORD(0x8490), WORD(0x62b8), WORD(0x2b88), WORD(0x2cb6),
+	WORD(0xee55), WORD(0x6855), WORD(0x8dea), WORD(0x2323), WORD(0xd8f2), WORD(0x870a),
+	WORD(0x9417), WORD(0x9933), WORD(0x14f3), WORD(0xdb8f), WORD(0x7071), WORD(0x37c2),
+	WORD(0x5853), WORD(0xcb73), WORD(0x9056), WORD(0xcb0a), WORD(0xb794), WORD(0x00fb),
+	/* T[14] */
+	WORD(0x9b11), WORD(0xaa77), WORD(0x0ba5), WORD(0x9acb), WORD(0xce87), WORD(0x245d),
+	WORD(0x1f48), WORD(0xdda1), WORD(0xf71d), WORD(0x3526), WORD(0xae5d), WORD(0xe747),
+	WORD(0x45bd), WORD(0xc9ed), WORD(0x40d5), WORD(0x8802), WORD(0xe681), WORD(0x26fb),
+	WORD(0x2953), WORD(0x18d5), WORD(0x0720), WORD(0x11c5), WORD(0x4a41), WORD(0xf351),
+	WORD(0xef1f), WORD(0xb580), WORD(0xe352), WORD(0x1a4d), WORD(0x2691), WORD(0xd3f3),
+	WORD(0x2e7e), WORD(0x5344), WORD(0x00a0), WORD(0xe65b), WORD(0xa215), WORD(0xc88e),
+	WORD(0xb90e), WORD(0x0547), WORD(0xd4e2), WORD(0xa159), WORD(0x356c), WORD(0xbfa9),
+	WORD(0xa687), WORD(0x53d4), WORD(0x8236), WORD(0x27a7), WORD(0x7eec), WORD(0x4175),
+	WORD(0xc2bc), WORD(0x72eb), WORD(0x905c), WORD(0xc24d), WORD(0x2ad7), WORD(0x9f59),
+	WORD(0xc081), WORD(0xbf02), WORD(0x14cd), WORD(0x21b5), WORD(0xb29a), WORD(0x2c10),
+	WORD(0x8666), WORD(0x4522), WORD(0x3da5), WORD(0xe2f6), WORD(0xe777), WORD(0x00ea),
+	/* T[15] */
+	WORD(0xf878), WORD(0x536d), WORD(0x8168), WORD(0xd5e4), WORD(0x35ae), WORD(0x1729),
+	WORD(0x8056), WORD(0x9556), WORD(0xac32), WORD(0xf4f2), WORD(0xc542), WORD(0x8cb6),
+	WORD(0x330c), WORD(0x92b9), WORD(0x7d0c), WORD(0x7d35), WORD(0xbc8e), WORD(0x9f86),
+	WORD(0x990d), WORD(0x0221), WORD(0xf927), WORD(0x1806), WORD(0xc001), WORD(0x088b),
+	WORD(0x9f40), WORD(0x6787), WORD(0x62ab), WORD(0xe38f), WORD(0x6443), WORD(0x3b3d),
+	WORD(0xaee9), WORD(0x4efb), WORD(0x00c4), WORD(0xd78b), WORD(0x933d), WORD(0xd3e6),
+	WORD(0xd9b1), WORD(0x96ec), WORD(0x2a3b), WORD(0xd0c5), WORD(0xde3e), WORD(0x3fb0),
+	WORD(0x4d13), WORD(0x27c3), WORD(0xbc6e), WORD(0xd212), WORD(0x5a55), WORD(0xc437),
+	WORD(0xca13), WORD(0xc0df), WORD(0x783b), WORD(0x441c), WORD(0xcdc3), WORD(0x93b0),
+	WORD(0xf53e), WORD(0x451d), WORD(0x8f3b), WORD(0xdace), WORD(0xbe56), WORD(0xbec9),
+	WORD(0x5645), WORD(0x4d3e), WORD(0xd17b), WORD(0x84e2), WORD(0x8070), WORD(0x004a),
+	/* T[16] */
+	WORD(0xbc80), WORD(0x601e), WORD(0xe071), WORD(0x1a82), WORD(0x977e), WORD(0xc281),
+	WORD(0x9240), WORD(0x9c5b), WORD(0xbe0e), WORD(0xcc59), WORD(0x0fdb), WORD(0xb6b4),
+	WORD(0x0495), WORD(0x0f2e), WORD(0x93ef), WORD(0x32de), WORD(0x28a0), WORD(0x0f86),
+	WORD(0x1511), WORD(0x9342), WORD(0x3de6), WORD(0x776e), WORD(0x7d0b), WORD(0x8973),
+	WORD(0xfc61), WORD(0x2ecd), WORD(0xc14c), WORD(0x14c1), WORD(0xf904), WORD(0xd3ff),
+	WORD(0xa4e9), WORD(0x7df5), WORD(0x00e4), WORD(0xdebc), WORD(0xfd94), WORD(0x93db),
+	WORD(0x655a), WORD(0xd46c), WORD(0x1ccf), WORD(0xc181), WORD(0x3f40), WORD(0x6124),
+	WORD(0xfdaf), WORD(0x5abe), WORD(0x82bd), WORD(0x63d9), WORD(0x7a9c), WORD(0x965f),
+	WORD(0xe6d3), WORD(0xfa0f), WORD(0x303e), WORD(0x4048), WORD(0x793f), WORD(0xf72a),
+	WORD(0x3d1e), WORD(0xb648), WORD(0xd4fa), WORD(0xb9e5), WORD(0x007a), WORD(0xb028),
+	WORD(0x697b), WORD(0x926d), WORD(0xd16c), WORD(0x6453), WORD(0x8ebd), WORD(0x0012),
+	/* T[17] */
+	WORD(0x4be8), WORD(0x48c7), WORD(0x8fbb), WORD(0x6ef0), WORD(0xdb66), WORD(0xef7e),
+	WORD(0xe2a9), WORD(0xcd01), WORD(0xc591), WORD(0x81de), WORD(0x83c9), WORD(0xaaaf),
+	WORD(0x062e), WORD(0x6f1c), WORD(0xc0a5), WORD(0xb76f), WORD(0xa9bb), WORD(0xb588),
+	WORD(0xa1ff), WORD(0x7617), WORD(0x4ff5), WORD(0x9c62), WORD(0xc471), WORD(0x898e),
+	WORD(0x20f4), WORD(0xf53e), WORD(0x3696), WORD(0x8bfa), WORD(0xfccd), WORD(0xc7cc),
+	WORD(0x0507), WORD(0x2776), WORD(0x005e), WORD(0x9127), WORD(0xd9fc), WORD(0x4722),
+	WORD(0x7a7d), WORD(0x47aa), WORD(0x3a41), WORD(0xc263), WORD(0x4b6e), WORD(0xe1fa),
+	WORD(0x9a99), WORD(0xebff), WORD(0xdc03), WORD(0x2e82), WORD(0x746b), WORD(0xd625),
+	WORD(0x4073), WORD(0xdd19), WORD(0xa0da), WORD(0x38c3), WORD(0x1373), WORD(0x4f3c),
+	WORD(0x3e10), WORD(0x03fe), WORD(0x6078), WORD(0xd845), WORD(0x6279), WORD(0x922b),
+	WORD(0x8aaf), WORD(0xcfa6), WORD(0x7042), WORD(0xa039), WORD(0x120c), WORD(0x00ec),
+	/* T[18] */
+	WORD(0x56de), WORD(0x7161), WORD(0x2ff3), WORD(0x19fe), WORD(0xa046), WORD(0x4670),
+	WORD(0x467d), WORD(0x1975), WORD(0x1ef1), WORD(0x6d65), WORD(0xb129), WORD(0x0b8c),
+	WORD(0x8fd3), WORD(0x86fc), WORD(0x4086), WORD(0x5332), WORD(0x7afa), WORD(0x6882),
+	WORD(0x2eb5), WORD(0x3c54), WORD(0x6010), WORD(0x6876), WORD(0x3b78), WORD(0x5d2b),
+	WORD(0x8acc), WORD(0xccb3), WORD(0xbfab), WORD(0x7eba), WORD(0xb283), WORD(0x664f),
+	WORD(0x8238), WORD(0xae8e), WORD(0x00dd), WORD(0x376b), WORD(0xfcf3), WORD(0x2f81),
+	WORD(0xe0c0), WORD(0xd11d), WORD(0xe5d8), WORD(0xe954), WORD(0x166b), WORD(0x6817),
+	WORD(0xc1d0), WORD(0xfa2a), WORD(0xd73b), WORD(0x1883), WORD(0x1a91), WORD(0xa853),
+	WORD(0xa52e), WORD(0x81d5), WORD(0x4d01), WORD(0x4847), WORD(0x52e7), WORD(0xaf8a),
+	WORD(0x6d4b), WORD(0x392f), WORD(0x6641), WORD(0xdcbd), WORD(0xe73b), WORD(0xfd32),
+	WORD(0x8e39), WORD(0x10a3), WORD(0x86e0), WORD(0xc4dc), WORD(0xb303), WORD(0x01ee),
+	/* T[19] */
+	WORD(0xbbfd), WORD(0x7185), WORD(0xe1ac), WORD(0xbdde), WORD(0x98fb), WORD(0x9837),
+	WORD(0x35dc), WORD(0x3920), WORD(0x79a9), WORD(0x09ee), WORD(0x2660), WORD(0x936d),
+	WORD(0xd7dd), WORD(0x6da6), WORD(0xb320), WORD(0x64ca), WORD(0x372d), WORD(0x517c),
+	WORD(0xddbb), WORD(0x461c), WORD(0x04a6), WORD(0x9439), WORD(0x1b1e), WORD(0xf8ca),
+	WORD(0xe7aa), WORD(0x97fe), WORD(0x8774), WORD(0xf3c5), WORD(0xf26f), WORD(0x6fdc),
+	WORD(0x9629), WORD(0x69df), WORD(0x0138), WORD(0xa65e), WORD(0x86fb), WORD(0x846d),
+	WORD(0x8a23), WORD(0xcb92), WORD(0xfdd4), WORD(0x45f4), WORD(0x2859), WORD(0x2303),
+	WORD(0x858f), WORD(0xc089), WORD(0xff65), WORD(0x5720), WORD(0xc91f), WORD(0x7453),
+	WORD(0x0841), WORD(0xc553), WORD(0x9683), WORD(0xa5ac), WORD(0x9ce6), WORD(0xb7a1),
+	WORD(0x12f2), WORD(0xc328), WORD(0xbb63), WORD(0x7328), WORD(0xf776), WORD(0x9807),
+	WORD(0x4145), WORD(0xa6be), WORD(0x0f14), WORD(0x291e), WORD(0x3337), WORD(0x00e4),
+	/* T[20] */
+	WORD(0xa9c1), WORD(0x45ce), WORD(0x77f6), WORD(0xb68d), WORD(0xe7f2), WORD(0x9019),
+	WORD(0xd106), WORD(0xb20e), WORD(0x36ce), WORD(0x5642), WORD(0x7c85), WORD(0x1e47),
+	WORD(0x6fae), WORD(0x2d51), WORD(0x7f48), WORD(0x450f), WORD(0x5695), WORD(0xe94e),
+	WORD(0xedc5), WORD(0xf1ae), WORD(0x9db0), WORD(0xf180), WORD(0x8e1d), WORD(0xf02e),
+	WORD(0x1713), WORD(0xb3df), WORD(0x5115), WORD(0x74cc), WORD(0x9ef6), WORD(0x2da2),
+	WORD(0xbea1), WORD(0xe747), WORD(0x01b9), WORD(0xe1b6), WORD(0xe70f), WORD(0xc661),
+	WORD(0x86d8), WORD(0x6511), WORD(0xc339), WORD(0x9607), WORD(0x3eda), WORD(0x26ed),
+	WORD(0x1f79), WORD(0x8175), WORD(0x2a26), WORD(0x7704), WORD(0x3faf), WORD(0x248a),
+	WORD(0x3166), WORD(0x4e05), WORD(0xcd20), WORD(0xa8bb), WORD(0x2b8a), WORD(0x7840),
+	WORD(0x6b37), WORD(0x5056), WORD(0x76f9), WORD(0x335e), WORD(0xb008), WORD(0x74f2),
+	WORD(0x3ce3), WORD(0x1c00), WORD(0x87d1), WORD(0xaecc), WORD(0xf558), WORD(0x000c),
+	/* T[21] */
+	WORD(0x99c8), WORD(0x5acb), WORD(0x14db), WORD(0x3b91), WORD(0xe547), WORD(0x16d1),
+	WORD(0x445d), WORD(0xa898), WORD(0x8f76), WORD(0x4ea7), WORD(0x1f7e), WORD(0xd459),
+	WORD(0x2ac7), WORD(0x122f), WORD(0x1a62), WORD(0x6ce1), WORD(0xce78), WORD(0xdcbc),
+	WORD(0x5be3), WORD(0xccc8), WORD(0xb53d), WORD(0x8924), WORD(0x84fe), WORD(0x9c5b),
+	WORD(0xbe93), WORD(0xcb45), WORD(0xa926), WORD(0x0f5c), WORD(0xa810), WORD(0x0b4a),
+	WORD(0xef1a), WORD(0x5b2b), WORD(0x0126), WORD(0xbdde), WORD(0x217f), WORD(0x4c0b),
+	WORD(0xf845), WORD(0x5e18), WORD(0xa273), WORD(0xa973), WORD(0x2116), WORD(0x2865),
+	WORD(0xeff1), WORD(0x5647), WORD(0xf6fa), WORD(0x671b), WORD(0xc747), WORD(0x1a93),
+	WORD(0x1e9d), WORD(0x9998), WORD(0x0a19), WORD(0x23b7), WORD(0xdfa4), WORD(0x5a47),
+	WORD(0x5a5c), WORD(0x40b6), WORD(0xfec1), WORD(0xd87c), WORD(0x65eb), WORD(0xf3af),
+	WORD(0xfb34), WORD(0xcf28), WORD(0x4de9), WORD(0x2155), WORD(0xe17c), WORD(0x01d5),
+	/* T[22] */
+	WORD(0x2c32), WORD(0xa186), WORD(0x7e70), WORD(0x4e24), WORD(0xdc50), WORD(0x8690),
+	WORD(0xe393), WORD(0x134a), WORD(0x7091), WORD(0xd172), WORD(0xcaa3), WORD(0x885c),
+	WORD(0xb8a0), WORD(0xacf1), WORD(0x5d15), WORD(0x5962), WORD(0x3545), WORD(0xbc17),
+	WORD(0x4813), WORD(0xa421), WORD(0xa978), WORD(0x7be2), WORD(0xe24e), WORD(0x682a),
+	WORD(0x9a6f), WORD(0xf556), WORD(0xc523), WORD(0xd4d6), WORD(0x5abe), WORD(0xe325),
+	WORD(0x94c0), WORD(0x68ec), WORD(0x012e), WORD(0xcce6), WORD(0x9e18), WORD(0x9798),
+	WORD(0x6826), WORD(0xd4f1), WORD(0x98ee), WORD(0x0a62), WORD(0x5a57), WORD(0x9634),
+	WORD(0x752b), WORD(0x488d), WORD(0x7b08), WORD(0xbba1), WORD(0x411d), WORD(0xeb2e),
+	WORD(0x1a68), WORD(0x6b4e), WORD(0xd04e), WORD(0x080f), WORD(0x10c1), WORD(0x48c6),
+	WORD(0x3174), WORD(0x93fc), WORD(0x1499), WORD(0x6e3f), WORD(0xfd01), WORD(0x8c81),
+	WORD(0x5315), WORD(0x23fc), WORD(0x0dfb), WORD(0xa6fe), WORD(0xf359), WORD(0x01a8),
+	/* T[23] */
+	WORD(0x3582), WORD(0x130a), WORD(0x03da), WORD(0x1342), WORD(0x4cdf), WORD(0x47dd),
+	WORD(0x9533), WORD(0x1748), WORD(0x1098), WORD(0x680e), WORD(0x4996), WORD(0xc07c),
+	WORD(0x7984), WORD(0x91d0), WORD(0x10d0), WORD(0x2437), WORD(0x5683), WORD(0xb10b),
+	WORD(0xc7de), WORD(0xb0d5), WORD(0x4478), WORD(0xa7d3), WORD(0x77c6), WORD(0xfda6),
+	WORD(0x176e), WORD(0xc130), WORD(0x6b97), WORD(0x826c), WORD(0x39c3), WORD(0x64fb),
+	WORD(0xe6bb), WORD(0xb9e6), WORD(0x0137), WORD(0xe8d6), WORD(0x9293), WORD(0x717b),
+	WORD(0xe3f3), WORD(0x4c4d), WORD(0x4e86), WORD(0x0cff), WORD(0xc088), WORD(0x8857),
+	WORD(0x618e), WORD(0x6f06), WORD(0x1a40), WORD(0x6ee3), WORD(0x2e8f), WORD(0x759b),
+	WORD(0x53e9), WORD(0x55d2), WORD(0xba71), WORD(0xe802), WORD(0x1e7e), WORD(0x3067),
+	WORD(0x4df2), WORD(0xc348), WORD(0xf5c8), WORD(0x6e60), WORD(0x7dae), WORD(0x11a9),
+	WORD(0x8648), WORD(0x7aa8), WORD(0x0807), WORD(0x517c), WORD(0xf90f), WORD(0x00b7),
+	/* T[24] */
+	WORD(0x1ab4), WORD(0xc0a0), WORD(0x6926), WORD(0x9ee0), WORD(0x692b), WORD(0xea1f),
+	WORD(0xc4ad), WORD(0xef34), WORD(0x80ba), WORD(0xc7e3), WORD(0xa1f6), WORD(0x6030),
+	WORD(0x92fc), WORD(0xd0ec), WORD(0x2d69), WORD(0x87b3), WORD(0xa709), WORD(0x0ce5),
+	WORD(0xf96c), WORD(0x4d36), WORD(0xabc3), WORD(0xdaba), WORD(0x93b8), WORD(0x5c29),
+	WORD(0xfacd), WORD(0x5c4d), WORD(0x8e91), WORD(0x2dd5), WORD(0x6cd9), WORD(0xa1d2),
+	WORD(0xa5c3), WORD(0xd8ee), WORD(0x0134), WORD(0x5076), WORD(0x3f22), WORD(0xff1e),
+	WORD(0x39e9), WORD(0xe69d), WORD(0x0209), WORD(0x4a56), WORD(0x020b), WORD(0xc6b7),
+	WORD(0xf51f), WORD(0xba9a), WORD(0xfba4), WORD(0x0610), WORD(0xb4c6), WORD(0x5b3c),
+	WORD(0xe7af), WORD(0x6cf2), WORD(0xd140), WORD(0x8728), WORD(0x418b), WORD(0x20eb),
+	WORD(0xc37a), WORD(0x5c32), WORD(0xbfd2), WORD(0x6778), WORD(0x05fe), WORD(0xf988),
+	WORD(0x1d3d), WORD(0x7e49), WORD(0x04e3), WORD(0xb4b4), WORD(0xf69e), WORD(0x002d),
+	/* T[25] */
+	WORD(0x7194), WORD(0x231d), WORD(0x2566), WORD(0x4f1b), WORD(0x0919), WORD(0x1c78),
+	WORD(0x9831), WORD(0x790f), WORD(0xd903), WORD(0x49ef), WORD(0x0d97), WORD(0x47e9),
+	WORD(0x687a), WORD(0xd985), WORD(0xc1b5), WORD(0x7af9), WORD(0x0b59), WORD(0x40ef),
+	WORD(0xf254), WORD(0xace5), WORD(0x7e48), WORD(0x0637), WORD(0x010d), WORD(0xf756),
+	WORD(0xa131), WORD(0xffbb), WORD(0xb2cf), WORD(0x921c), WORD(0xcc57), WORD(0xa16d),
+	WORD(0xda5c), WORD(0x2d67), WORD(0x0035), WORD(0xe10f), WORD(0xcf86), WORD(0xf13d),
+	WORD(0x765c), WORD(0xe338), WORD(0x0c77), WORD(0x88e9), WORD(0xfe93), WORD(0x0ead),
+	WORD(0x7eae), WORD(0xf975), WORD(0xfc60), WORD(0x6b52), WORD(0x964b), WORD(0x3d88),
+	WORD(0x6846), WORD(0x4a4d), WORD(0xcc9b), WORD(0x4640), WORD(0x51fa), WORD(0xd0fe),
+	WORD(0x203f), WORD(0xc10c), WORD(0x168d), WORD(0x41a2), WORD(0xec58), WORD(0xdda3),
+	WORD(0xb6f8), WORD(0x41bb), WORD(0x8b42), WORD(0x2c49), WORD(0x31cb), WORD(0x01b5),
+	/* T[26] */
+	WORD(0x7c7d), WORD(0x72e7), WORD(0xd410), WORD(0x959a), WORD(0x0182), WORD(0x47f1),
+	WORD(0x85d3), WORD(0x2951), WORD(0xe1dc), WORD(0x9dbe), WORD(0xf032), WORD(0xffb2),
+	WORD(0xbbf4), WORD(0x8fc3), WORD(0x5077), WORD(0x5bdb), WORD(0xbee6), WORD(0x7780),
+	WORD(0xad4c), WORD(0x7115), WORD(0x16e7), WORD(0x908b), WORD(0x7688), WORD(0x384d),
+	WORD(0x831a), WORD(0x50a5), WORD(0x7b28), WORD(0x4685), WORD(0xaa78), WORD(0xed3b),
+	WORD(0xbb38), WORD(0xc81d), WORD(0x010a), WORD(0xc10a), WORD(0xe51a), WORD(0xac8f),
+	WORD(0x9aa8), WORD(0x0a44), WORD(0xfee1), WORD(0x1d00), WORD(0x1b41), WORD(0x3d0c),
+	WORD(0x9e49), WORD(0x2e90), WORD(0xbf68), WORD(0xd624), WORD(0xfae1), WORD(0x68ec),
+	WORD(0x29c8), WORD(0xf3d7), WORD(0x0cee), WORD(0x461f), WORD(0xfed6), WORD(0xa6ad),
+	WORD(0x592b), WORD(0xa66a), WORD(0x06e5), WORD(0x7397), WORD(0xa712), WORD(0x2f84),
+	WORD(0xa04d), WORD(0x31c5), WORD(0xe136), WORD(0xfeee), WORD(0x65c4), WORD(0x01d4),
+	/* T[27] */
+	WORD(0xd82e), WORD(0xa6a7), WORD(0x5501), WORD(0x8a75), WORD(0xc1aa), WORD(0x2222),
+	WORD(0xb2fa), WORD(0xad12), WORD(0xafb1), WORD(0xd43d), WORD(0x4de5), WORD(0x2bcb),
+	WORD(0x37de), WORD(0x17b3), WORD(0xdc41), WORD(0x4027), WORD(0x0398), WORD(0x89ad),
+	WORD(0x2947), WORD(0x0387), WORD(0x2c76), WORD(0xf4fa), WORD(0x0e59), WORD(0xfffc),
+	WORD(0x4968), WORD(0xab41), WORD(0x2218), WORD(0xd3e0), WORD(0x4d54), WORD(0xfba1),
+	WORD(0x13d2), WORD(0xd0f8), WORD(0x01ec), WORD(0x6c09), WORD(0x4d38), WORD(0xdd9b),
+	WORD(0xcde8), WORD(0x4729), WORD(0x6ea2), WORD(0x6269), WORD(0xd28d), WORD(0x8eef),
+	WORD(0x052f), WORD(0xef95), WORD(0x8db8), WORD(0xc69a), WORD(0x8c36), WORD(0x0b43),
+	WORD(0x5534), WORD(0xc290), WORD(0xa66a), WORD(0xb302), WORD(0x6b30), WORD(0xc84d),
+	WORD(0xbe5a), WORD(0xf813), WORD(0x211a), WORD(0x1281), WORD(0xe9eb), WORD(0x7176),
+	WORD(0xfff4), WORD(0xaaf4), WORD(0x3ddf), WORD(0x769e), WORD(0x4c6f), WORD(0x0085),
+	/* T[28] */
+	WORD(0xa406), WORD(0x109a), WORD(0x7b12), WORD(0x95c8), WORD(0xcd4d), WORD(0x9650),
+	WORD(0xe85b), WORD(0xb1b4), WORD(0xf791), WORD(0x6965), WORD(0xaa18), WORD(0xbd09),
+	WORD(0x97f7), WORD(0x13c5), WORD(0x959c), WORD(0x8e1c), WORD(0x1310), WORD(0x2ff5),
+	WORD(0x31a5), WORD(0x78db), WORD(0x59fa), WORD(0x93fc), WORD(0x13bf), WORD(0x4d0a),
+	WORD(0xe4e9), WORD(0x0c63), WORD(0x5297), WORD(0xd266), WORD(0xe0a2), WORD(0xa74d),
+	WORD(0x786e), WORD(0x3079), WORD(0x0090), WORD(0xc03f), WORD(0xa12c), WORD(0x4f52),
+	WORD(0x74c8), WORD(0xebc8), WORD(0x78bb), WORD(0x8bcd), WORD(0x625a), WORD(0x70a4),
+	WORD(0x9540), WORD(0xb935), WORD(0x7a5d), WORD(0x6fac), WORD(0x8325), WORD(0x000c),
+	WORD(0x4b9c), WORD(0x7b37), WORD(0xc128), WORD(0x8e1b), WORD(0xf338), WORD(0xa2a2),
+	WORD(0x6fcd), WORD(0x2a9e), WORD(0x803c), WORD(0xb9f2), WORD(0x4e5f), WORD(0xa874),
+	WORD(0xb952), WORD(0x0230), WORD(0x2109), WORD(0x1af0), WORD(0x9efa), WORD(0x00ff),
+	/* T[29] */
+	WORD(0xab0f), WORD(0x37b6), WORD(0x30d8), WORD(0xa3f6), WORD(0x0a93), WORD(0xb189),
+	WORD(0x366a), WORD(0x444f), WORD(0x8782), WORD(0x01f1), WORD(0xd073), WORD(0x8d39),
+	WORD(0xc628), WORD(0x326b), WORD(0x6980), WORD(0xe8bb), WORD(0x6e5d), WORD(0x53ef),
+	WORD(0xf0cd), WORD(0xb7e8), WORD(0xf784), WORD(0x9966), WORD(0xb59c), WORD(0x0bc4),
+	WORD(0x6414), WORD(0x38a2), WORD(0x165a), WORD(0x84b6), WORD(0x4fea), WORD(0x9a10),
+	WORD(0x3cdd), WORD(0x00e1), WORD(0x01bc), WORD(0xcb6d), WORD(0xf7a1), WORD(0xe190),
+	WORD(0x6299), WORD(0x9732), WORD(0xe15d), WORD(0x7421), WORD(0xa86e), WORD(0xf11a),
+	WORD(0x3130), WORD(0x8aa3), WORD(0x6eb9), WORD(0x9cbb), WORD(0x441f), WORD(0x2f44),
+	WORD(0xda21), WORD(0x78ce), WORD(0xc653), WORD(0x8799), WORD(0x3fd8), WORD(0x7f6f),
+	WORD(0xe152), WORD(0x492c), WORD(0x63ee), WORD(0x0401), WORD(0xb0b8), WORD(0xea57),
+	WORD(0xc659), WORD(0x191c), WORD(0x560c), WORD(0x0488), WORD(0x0ffb), WORD(0x00da),
+	/* T[30] */
+	WORD(0xf008), WORD(0xd34c), WORD(0xfd25), WORD(0x04d6), WORD(0x448a), WORD(0x5c92),
+	WORD(0x9d68), WORD(0x3cbc), WORD(0xdcd4), WORD(0x84e0), WORD(0xb37c), WORD(0x7fe0),
+	WORD(0xe310), WORD(0xe90e), WORD(0x8a70), WORD(0xbd41), WORD(0x75e2), WORD(0xc735),
+	WORD(0x57c8), WORD(0xbf7c), WORD(0xa380), WORD(0x91b7), WORD(0x771c), WORD(0x4f74),
+	WORD(0xebcf), WORD(0xad7b), WORD(0x6b07), WORD(0x2646), WORD(0xa9bb), WORD(0x4fc5),
+	WORD(0x17f5), WORD(0x54ef), WORD(0x00b9), WORD(0x3fd9), WORD(0x51e3), WORD(0xd098),
+	WORD(0xdfbf), WORD(0x5a86), WORD(0x410d), WORD(0x37dd), WORD(0x862d), WORD(0x7378),
+	WORD(0x55ac), WORD(0x8012), WORD(0x89ce), WORD(0x3948), WORD(0x5ad0), WORD(0x814f),
+	WORD(0x05d5), WORD(0x5a22), WORD(0xf8cf), WORD(0x8bd9), WORD(0x76b2), WORD(0x678b),
+	WORD(0x38f6), WORD(0x7062), WORD(0x853f), WORD(0x5a58), WORD(0x8e2e), WORD(0xfb05),
+	WORD(0xe11c), WORD(0x6dbb), WORD(0x98e9), WORD(0x6375), WORD(0x8c8b), WORD(0x016e),
+	/* T[31] */
+	WORD(0x5b7e), WORD(0x6146), WORD(0xfd9a), WORD(0x9441), WORD(0xd213), WORD(0x3e81),
+	WORD(0x4f2f), WORD(0x5807), WORD(0x5111), WORD(0xa301), WORD(0x5cbf), WORD(0xddd6),
+	WORD(0x8311), WORD(0x2476), WORD(0xcb61), WORD(0xab26), WORD(0xa213), WORD(0xe2da),
+	WORD(0x7368), WORD(0xbf0e), WORD(0x494d), WORD(0x8c17), WORD(0x96b8), WORD(0xebbd),
+	WORD(0x55d9), WORD(0x4ea3), WORD(0x556f), WORD(0xc73c), WORD(0xa6d8), WORD(0x34eb),
+	WORD(0xf097), WORD(0x246c), WORD(0x01ef), WORD(0xd7fa), WORD(0xcf7f), WORD(0x1104),
+	WORD(0xf311), WORD(0x3646), WORD(0x940a), WORD(0x0d89), WORD(0x0931), WORD(0xe611),
+	WORD(0xb3bf), WORD(0x5801), WORD(0xf9e0), WORD(0xe002), WORD(0x87e1), WORD(0x12fd),
+	WORD(0x1f24), WORD(0x05fa), WORD(0x29b7), WORD(0x9b4c), WORD(0x69d9), WORD(0xf5ca),
+	WORD(0x2a40), WORD(0x5211), WORD(0x60e6), WORD(0x7a91), WORD(0xfe5d), WORD(0x6fd4),
+	WORD(0xc334), WORD(0x3895), WORD(0x8749), WORD(0x7961), WORD(0xf42c), WORD(0x00a8),
+};
+#else                     /* unknown word size */
+#error "Unsupported word size"
+#endif
+TO_EC_GEN_TABLE_PARAM(secp521r1_gen_comb, 6);
+
 static const ec_str_params secp521r1_str_params = {
 	.p = &secp521r1_p_str_param,
 	.p_bitlen = &secp521r1_p_bitlen_str_param,
@@ -273,6 +2456,11 @@ static const ec_str_params secp521r1_str_params = {
 	.cofactor = &secp521r1_cofactor_str_param,
 	.oid = &secp521r1_oid_str_param,
 	.name = &secp521r1_name_str_param,
+	.p_inv_chain = &secp521r1_p_inv_chain_param,
+	.p_sqrt_chain = &secp521r1_p_sqrt_chain_param,
+	.q_inv_chain = &secp521r1_q_inv_chain_param,
+	.gen_wnaf_table = &secp521r1_gen_wnaf_table_param,
+	.gen_comb_table = &secp521r1_gen_comb_table_param,
 };
 
 /*
@@ -293,6 +2481,17 @@ static const ec_str_params secp521r1_str_params = {
 #define CURVES_MAX_Q_BIT_LEN CURVE_SECP521R1_Q_BITLEN
 #endif
 
+/*
+ * Limb count of p for the fixed limbs field backend (see fp_fixed.h)
+ */
+#if (WORD_BYTES == 8)     /* 64-bit words */
+#define FP_FIXED_WLEN_9_USED
+#elif (WORD_BYTES == 4)   /* 32-bit words */
+#define FP_FIXED_WLEN_17_USED
+#elif (WORD_BYTES == 2)   /* 16-bit words */
+/* More than 17 limbs: generic field code */
+#endif
+
 #endif /* __EC_PARAMS_SECP521R1_H__ */
 
 #endif /* WITH_CURVE_SECP521R1 */
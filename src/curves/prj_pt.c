@@ -108,14 +108,14 @@ int prj_pt_is_on_curve(prj_pt_src_t in)
 	prj_pt_init(&in1, in->crv);
 	prj_pt_copy(&in1, in);
 	prj_pt_init(&in2, in->crv);
-	nn_copy(&(in2.X.fp_val), &((in2.crv)->a.fp_val));
-	nn_copy(&(in2.Y.fp_val), &((in2.crv)->b.fp_val));
-	nn_copy(&(in2.Z.fp_val), &((in2.crv)->a_monty.fp_val));
+	fp_copy(&(in2.X), &((in2.crv)->a));
+	fp_copy(&(in2.Y), &((in2.crv)->b));
+	fp_copy(&(in2.Z), &((in2.crv)->a_monty));
 
 	ret = prj_pt_iszero(in);
-	nn_cnd_swap(ret, &(in1.X.fp_val), &(in2.X.fp_val));
-	nn_cnd_swap(ret, &(in1.Y.fp_val), &(in2.Y.fp_val));
-	nn_cnd_swap(ret, &(in1.Z.fp_val), &(in2.Z.fp_val));
+	fp_cnd_swap(ret, &(in1.X), &(in2.X));
+	fp_cnd_swap(ret, &(in1.Y), &(in2.Y));
+	fp_cnd_swap(ret, &(in1.Z), &(in2.Z));
 
 	/* Move to the affine unique representation */
 	prj_pt_to_aff(&in_aff, &in1);
@@ -173,6 +173,59 @@ void prj_pt_normalize(prj_pt_t out)
 	fp_uninit(&inv);
 }
 
+/* Maximum number of points normalized with a single inversion */
+#define PRJ_PT_BATCH_NORMALIZE_MAX 16
+
+/* Normalize the num points of todo, zinv being scratch space */
+static void _prj_pt_batch_normalize(prj_pt_t *todo, fp *zinv, size_t num)
+{
+	fp_t out[PRJ_PT_BATCH_NORMALIZE_MAX];
+	fp_src_t in[PRJ_PT_BATCH_NORMALIZE_MAX];
+	size_t i;
+
+	for (i = 0; i < num; i++) {
+		fp_init(&zinv[i], todo[i]->Z.ctx);
+		out[i] = &zinv[i];
+		in[i] = &(todo[i]->Z);
+	}
+	fp_batch_inv(out, in, num);
+	for (i = 0; i < num; i++) {
+		fp_mul(&(todo[i]->X), &(todo[i]->X), &zinv[i]);
+		fp_mul(&(todo[i]->Y), &(todo[i]->Y), &zinv[i]);
+		fp_one(&(todo[i]->Z));
+		fp_uninit(&zinv[i]);
+	}
+}
+
+/*
+ * Normalize the n points of pts (see prj_pt_normalize()), sharing the
+ * inversions of their Z coordinates with fp_batch_inv(): one inversion
+ * is performed for each batch of PRJ_PT_BATCH_NORMALIZE_MAX points. As
+ * with prj_pt_normalize(), points already having Z = 1 are skipped.
+ */
+void prj_pt_batch_normalize(prj_pt_t *pts, size_t n)
+{
+	fp zinv[PRJ_PT_BATCH_NORMALIZE_MAX];
+	prj_pt_t todo[PRJ_PT_BATCH_NORMALIZE_MAX];
+	size_t i, num = 0;
+
+	MUST_HAVE(pts != NULL);
+
+	for (i = 0; i < n; i++) {
+		prj_pt_check_initialized(pts[i]);
+		MUST_HAVE(!prj_pt_iszero(pts[i]));
+		if (fp_isone(&(pts[i]->Z))) {
+			continue;
+		}
+		todo[num++] = pts[i];
+		if (num == PRJ_PT_BATCH_NORMALIZE_MAX) {
+			_prj_pt_batch_normalize(todo, zinv, num);
+			num = 0;
+		}
+	}
+	_prj_pt_batch_normalize(todo, zinv, num);
+}
+
 void prj_pt_to_aff(aff_pt_t out, prj_pt_src_t in)
 {
 	fp inv;
@@ -201,7 +254,7 @@ void ec_shortw_aff_to_prj(prj_pt_t out, aff_pt_src_t in)
 
 	fp_copy(&(out->X), &(in->x));
 	fp_copy(&(out->Y), &(in->y));
-	nn_inc(&(out->Z).fp_val, &(out->Z).fp_val);	/* Z = 1 */
+	fp_one(&(out->Z));	/* Z = 1 */
 }
 
 int prj_pt_cmp(prj_pt_src_t in1, prj_pt_src_t in2)
@@ -879,9 +932,9 @@ static void _prj_pt_mul_ltr_dbl_add_always(prj_pt_t out, nn_src_t m, prj_pt_src_
 		 * NOTE: we use the low level nn_copy function here to avoid
 		 * any possible leakage on operands with prj_pt_copy
 		 */
-		nn_copy(&(T[rbit_next].X.fp_val), &(T[mbit ^ rbit].X.fp_val));
-		nn_copy(&(T[rbit_next].Y.fp_val), &(T[mbit ^ rbit].Y.fp_val));
-		nn_copy(&(T[rbit_next].Z.fp_val), &(T[mbit ^ rbit].Z.fp_val));
+		fp_copy(&(T[rbit_next].X), &(T[mbit ^ rbit].X));
+		fp_copy(&(T[rbit_next].Y), &(T[mbit ^ rbit].Y));
+		fp_copy(&(T[rbit_next].Z), &(T[mbit ^ rbit].Z));
 		/* Update rbit */
 		rbit = rbit_next;
 	}
@@ -1022,16 +1075,16 @@ static void _prj_pt_mul_ltr_ladder(prj_pt_t out, nn_src_t m, prj_pt_src_t in)
 		/* NOTE: we use the low level nn_copy function here to avoid
 		 * any possible leakage on operands with prj_pt_copy
 		 */
-		nn_copy(&(T[0].X.fp_val), &(T[2-(mbit ^ rbit_next)].X.fp_val));
-		nn_copy(&(T[0].Y.fp_val), &(T[2-(mbit ^ rbit_next)].Y.fp_val));
-		nn_copy(&(T[0].Z.fp_val), &(T[2-(mbit ^ rbit_next)].Z.fp_val));
+		fp_copy(&(T[0].X), &(T[2-(mbit ^ rbit_next)].X));
+		fp_copy(&(T[0].Y), &(T[2-(mbit ^ rbit_next)].Y));
+		fp_copy(&(T[0].Z), &(T[2-(mbit ^ rbit_next)].Z));
 		/* T[1] = T[1+(d[i] ^ r[i])] */
 		/* NOTE: we use the low level nn_copy function here to avoid
 		 * any possible leakage on operands with prj_pt_copy
 		 */
-		nn_copy(&(T[1].X.fp_val), &(T[1+(mbit ^ rbit_next)].X.fp_val));
-		nn_copy(&(T[1].Y.fp_val), &(T[1+(mbit ^ rbit_next)].Y.fp_val));
-		nn_copy(&(T[1].Z.fp_val), &(T[1+(mbit ^ rbit_next)].Z.fp_val));
+		fp_copy(&(T[1].X), &(T[1+(mbit ^ rbit_next)].X));
+		fp_copy(&(T[1].Y), &(T[1+(mbit ^ rbit_next)].Y));
+		fp_copy(&(T[1].Z), &(T[1+(mbit ^ rbit_next)].Z));
 		/* Update rbit */
 		rbit = rbit_next;
 	}
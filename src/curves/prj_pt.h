@@ -59,6 +59,9 @@ void prj_pt_copy(prj_pt_t out, prj_pt_src_t in);
 // This is useful in situations like getting the affine coordinates of the point.
 void prj_pt_normalize(prj_pt_t out);
 
+// Same as above for n points, sharing the Z inversions.
+void prj_pt_batch_normalize(prj_pt_t *pts, size_t n);
+
 void prj_pt_to_aff(aff_pt_t out, prj_pt_src_t in);
 
 void ec_shortw_aff_to_prj(prj_pt_t out, aff_pt_src_t in);
@@ -22,10 +22,65 @@
 #include "../fp/fp_add.h"
 #include "../fp/fp_mul.h"
 #include "../fp/fp_montgomery.h"
+#include "../fp/fp_lazy.h"
 #include "../fp/fp_rand.h"
+#include "../nn/ll_u256_pt.h"
 
 #include "../utils/dbg_sig.h"
 
+/*
+ * Field operations of the point formulas, which are written once and take
+ * them from _prj_pt_fp_ops(): the fully reducing _fp_*_unchecked()
+ * routines, or the lazy reduction ones of fp_lazy.h when 4p fits in the
+ * words of p (ctx->lazy). With the latter the intermediate values are in
+ * [0, 2p), and reduce() brings the values which are tested or returned
+ * back to [0, p). It does nothing with the former.
+ */
+typedef struct {
+	void (*mul) (fp_t out, fp_src_t in1, fp_src_t in2);
+	void (*sqr) (fp_t out, fp_src_t in);
+	void (*add) (fp_t out, fp_src_t in1, fp_src_t in2);
+	void (*sub) (fp_t out, fp_src_t in1, fp_src_t in2);
+	void (*dbl) (fp_t out, fp_src_t in);
+	void (*tpl) (fp_t out, fp_src_t in);
+	void (*reduce) (fp_t inout);
+} prj_pt_fp_ops;
+
+static void _prj_pt_fp_reduce_none(fp_t inout)
+{
+	(void)inout;
+}
+
+static void _prj_pt_fp_reduce_lazy(fp_t inout)
+{
+	_fp_reduce_lazy(inout, inout);
+}
+
+static const prj_pt_fp_ops prj_pt_fp_ops_strict = {
+	.mul = _fp_mul_redc1_unchecked,
+	.sqr = _fp_sqr_redc1_unchecked,
+	.add = _fp_add_unchecked,
+	.sub = _fp_sub_unchecked,
+	.dbl = _fp_dbl_unchecked,
+	.tpl = _fp_tpl_unchecked,
+	.reduce = _prj_pt_fp_reduce_none,
+};
+
+static const prj_pt_fp_ops prj_pt_fp_ops_lazy = {
+	.mul = _fp_mul_redc1_lazy,
+	.sqr = _fp_sqr_redc1_lazy,
+	.add = _fp_add_lazy,
+	.sub = _fp_sub_lazy,
+	.dbl = _fp_dbl_lazy,
+	.tpl = _fp_tpl_lazy,
+	.reduce = _prj_pt_fp_reduce_lazy,
+};
+
+static const prj_pt_fp_ops *_prj_pt_fp_ops(ec_shortw_crv_src_t crv)
+{
+	return crv->a.ctx->lazy ? &prj_pt_fp_ops_lazy : &prj_pt_fp_ops_strict;
+}
+
 /*
  * If NO_USE_COMPLETE_FORMULAS flag is not defined addition formulas from Algorithm 1
  * of https://joostrenes.nl/publications/complete.pdf are used, otherwise
@@ -36,6 +91,7 @@ static void __prj_pt_add_monty(prj_pt_t out, prj_pt_src_t in1,
 {
 #ifndef NO_USE_COMPLETE_FORMULAS
 	fp t0, t1, t2, t3, t4, t5;
+	const prj_pt_fp_ops *ops = _prj_pt_fp_ops(in1->crv);
 
 	/* Info: initialization check of in1 and in2 done at upper level */
 	MUST_HAVE(in1->crv == in2->crv);
@@ -52,53 +108,56 @@ static void __prj_pt_add_monty(prj_pt_t out, prj_pt_src_t in1,
 	MUST_HAVE(out->crv == in1->crv);
 	MUST_HAVE(out->crv == in2->crv);
 
-	fp_mul_monty(&t0, &in1->X, &in2->X);
-	fp_mul_monty(&t1, &in1->Y, &in2->Y);
-	fp_mul_monty(&t2, &in1->Z, &in2->Z);
-	fp_add_monty(&t3, &in1->X, &in1->Y);
-	fp_add_monty(&t4, &in2->X, &in2->Y);
-
-	fp_mul_monty(&t3, &t3, &t4);
-	fp_add_monty(&t4, &t0, &t1);
-	fp_sub_monty(&t3, &t3, &t4);
-	fp_add_monty(&t4, &in1->X, &in1->Z);
-	fp_add_monty(&t5, &in2->X, &in2->Z);
-
-	fp_mul_monty(&t4, &t4, &t5);
-	fp_add_monty(&t5, &t0, &t2);
-	fp_sub_monty(&t4, &t4, &t5);
-	fp_add_monty(&t5, &in1->Y, &in1->Z);
-	fp_add_monty(&out->X, &in2->Y, &in2->Z);
-
-	fp_mul_monty(&t5, &t5, &out->X);
-	fp_add_monty(&out->X, &t1, &t2);
-	fp_sub_monty(&t5, &t5, &out->X);
-	fp_mul_monty(&out->Z, &in1->crv->a_monty, &t4);
-	fp_mul_monty(&out->X, &in1->crv->b3_monty, &t2);
-
-	fp_add_monty(&out->Z, &out->X, &out->Z);
-	fp_sub_monty(&out->X, &t1, &out->Z);
-	fp_add_monty(&out->Z, &t1, &out->Z);
-	fp_mul_monty(&out->Y, &out->X, &out->Z);
-	fp_add_monty(&t1, &t0, &t0);
-
-	fp_add_monty(&t1, &t1, &t0);
-	fp_mul_monty(&t2, &in1->crv->a_monty, &t2);
-	fp_mul_monty(&t4, &in1->crv->b3_monty, &t4);
-	fp_add_monty(&t1, &t1, &t2);
-	fp_sub_monty(&t2, &t0, &t2);
-
-	fp_mul_monty(&t2, &in1->crv->a_monty, &t2);
-	fp_add_monty(&t4, &t4, &t2);
-	fp_mul_monty(&t0, &t1, &t4);
-	fp_add_monty(&out->Y, &out->Y, &t0);
-	fp_mul_monty(&t0, &t5, &t4);
-
-	fp_mul_monty(&out->X, &t3, &out->X);
-	fp_sub_monty(&out->X, &out->X, &t0);
-	fp_mul_monty(&t0, &t3, &t1);
-	fp_mul_monty(&out->Z, &t5, &out->Z);
-	fp_add_monty(&out->Z, &out->Z, &t0);
+	ops->mul(&t0, &in1->X, &in2->X);
+	ops->mul(&t1, &in1->Y, &in2->Y);
+	ops->mul(&t2, &in1->Z, &in2->Z);
+	ops->add(&t3, &in1->X, &in1->Y);
+	ops->add(&t4, &in2->X, &in2->Y);
+
+	ops->mul(&t3, &t3, &t4);
+	ops->add(&t4, &t0, &t1);
+	ops->sub(&t3, &t3, &t4);
+	ops->add(&t4, &in1->X, &in1->Z);
+	ops->add(&t5, &in2->X, &in2->Z);
+
+	ops->mul(&t4, &t4, &t5);
+	ops->add(&t5, &t0, &t2);
+	ops->sub(&t4, &t4, &t5);
+	ops->add(&t5, &in1->Y, &in1->Z);
+	ops->add(&out->X, &in2->Y, &in2->Z);
+
+	ops->mul(&t5, &t5, &out->X);
+	ops->add(&out->X, &t1, &t2);
+	ops->sub(&t5, &t5, &out->X);
+	ops->mul(&out->Z, &in1->crv->a_monty, &t4);
+	ops->mul(&out->X, &in1->crv->b3_monty, &t2);
+
+	ops->add(&out->Z, &out->X, &out->Z);
+	ops->sub(&out->X, &t1, &out->Z);
+	ops->add(&out->Z, &t1, &out->Z);
+	ops->mul(&out->Y, &out->X, &out->Z);
+	ops->tpl(&t1, &t0);
+
+	ops->mul(&t2, &in1->crv->a_monty, &t2);
+	ops->mul(&t4, &in1->crv->b3_monty, &t4);
+	ops->add(&t1, &t1, &t2);
+	ops->sub(&t2, &t0, &t2);
+
+	ops->mul(&t2, &in1->crv->a_monty, &t2);
+	ops->add(&t4, &t4, &t2);
+	ops->mul(&t0, &t1, &t4);
+	ops->add(&out->Y, &out->Y, &t0);
+	ops->mul(&t0, &t5, &t4);
+
+	ops->mul(&out->X, &t3, &out->X);
+	ops->sub(&out->X, &out->X, &t0);
+	ops->mul(&t0, &t3, &t1);
+	ops->mul(&out->Z, &t5, &out->Z);
+	ops->add(&out->Z, &out->Z, &t0);
+
+	ops->reduce(&out->X);
+	ops->reduce(&out->Y);
+	ops->reduce(&out->Z);
 
 	fp_uninit(&t0);
 	fp_uninit(&t1);
@@ -136,51 +195,51 @@ static void __prj_pt_add_monty(prj_pt_t out, prj_pt_src_t in1,
 	fp_init(&A, out->crv->a.ctx);
 
 	/* Y1Z2 = Y1*Z2 */
-	fp_mul_monty(&Y1Z2, &(in1->Y), &(in2->Z));
+	_fp_mul_redc1_unchecked(&Y1Z2, &(in1->Y), &(in2->Z));
 
 	/* X1Z2 = X1*Z2 */
-	fp_mul_monty(&X1Z2, &(in1->X), &(in2->Z));
+	_fp_mul_redc1_unchecked(&X1Z2, &(in1->X), &(in2->Z));
 
 	/* Z1Z2 = Z1*Z2 */
-	fp_mul_monty(&Z1Z2, &(in1->Z), &(in2->Z));
+	_fp_mul_redc1_unchecked(&Z1Z2, &(in1->Z), &(in2->Z));
 
 	/* u = Y2*Z1-Y1Z2 */
-	fp_mul_monty(&u, &(in2->Y), &(in1->Z));
-	fp_sub_monty(&u, &u, &Y1Z2);
+	_fp_mul_redc1_unchecked(&u, &(in2->Y), &(in1->Z));
+	_fp_sub_unchecked(&u, &u, &Y1Z2);
 
 	/* uu = u² */
-	fp_sqr_monty(&uu, &u);
+	_fp_sqr_redc1_unchecked(&uu, &u);
 
 	/* v = X2*Z1-X1Z2 */
-	fp_mul_monty(&v, &(in2->X), &(in1->Z));
-	fp_sub_monty(&v, &v, &X1Z2);
+	_fp_mul_redc1_unchecked(&v, &(in2->X), &(in1->Z));
+	_fp_sub_unchecked(&v, &v, &X1Z2);
 
 	/* vv = v² */
-	fp_sqr_monty(&vv, &v);
+	_fp_sqr_redc1_unchecked(&vv, &v);
 
 	/* vvv = v*vv */
-	fp_mul_monty(&vvv, &v, &vv);
+	_fp_mul_redc1_unchecked(&vvv, &v, &vv);
 
 	/* R = vv*X1Z2 */
-	fp_mul_monty(&R, &vv, &X1Z2);
+	_fp_mul_redc1_unchecked(&R, &vv, &X1Z2);
 
 	/* A = uu*Z1Z2-vvv-2*R */
-	fp_mul_monty(&A, &uu, &Z1Z2);
-	fp_sub_monty(&A, &A, &vvv);
-	fp_sub_monty(&A, &A, &R);
-	fp_sub_monty(&A, &A, &R);
+	_fp_mul_redc1_unchecked(&A, &uu, &Z1Z2);
+	_fp_sub_unchecked(&A, &A, &vvv);
+	_fp_sub_unchecked(&A, &A, &R);
+	_fp_sub_unchecked(&A, &A, &R);
 
 	/* X3 = v*A */
-	fp_mul_monty(&(out->X), &v, &A);
+	_fp_mul_redc1_unchecked(&(out->X), &v, &A);
 
 	/* Y3 = u*(R-A)-vvv*Y1Z2 */
-	fp_sub_monty(&R, &R, &A);
-	fp_mul_monty(&(out->Y), &u, &R);
-	fp_mul_monty(&R, &vvv, &Y1Z2);
-	fp_sub_monty(&(out->Y), &(out->Y), &R);
+	_fp_sub_unchecked(&R, &R, &A);
+	_fp_mul_redc1_unchecked(&(out->Y), &u, &R);
+	_fp_mul_redc1_unchecked(&R, &vvv, &Y1Z2);
+	_fp_sub_unchecked(&(out->Y), &(out->Y), &R);
 
 	/* Z3 = vvv*Z1Z2 */
-	fp_mul_monty(&(out->Z), &vvv, &Z1Z2);
+	_fp_mul_redc1_unchecked(&(out->Z), &vvv, &Z1Z2);
 
 	fp_uninit(&Y1Z2);
 	fp_uninit(&X1Z2);
@@ -210,14 +269,13 @@ static void _prj_pt_add_monty(prj_pt_t out, prj_pt_src_t in1, prj_pt_src_t in2)
 	}
 }
 
-/* Public version of the addition to handle the case where the inputs are
- * zero or opposites
+/* Addition handling the case where the inputs are zero or opposites,
+ * without the initialization checks of the public version (used by the
+ * scalar multiplication loops on points they have already checked)
  */
-void prj_pt_add_monty(prj_pt_t out, prj_pt_src_t in1, prj_pt_src_t in2)
+static void _prj_pt_add_monty_unchecked(prj_pt_t out, prj_pt_src_t in1,
+					prj_pt_src_t in2)
 {
-	prj_pt_check_initialized(in1);
-	prj_pt_check_initialized(in2);
-
 #ifdef NO_USE_COMPLETE_FORMULAS
 	if (prj_pt_iszero(in1)) {
 		prj_pt_init(out, in2->crv);
@@ -248,6 +306,17 @@ void prj_pt_add_monty(prj_pt_t out, prj_pt_src_t in1, prj_pt_src_t in2)
 #endif
 }
 
+/* Public version of the addition to handle the case where the inputs are
+ * zero or opposites
+ */
+void prj_pt_add_monty(prj_pt_t out, prj_pt_src_t in1, prj_pt_src_t in2)
+{
+	prj_pt_check_initialized(in1);
+	prj_pt_check_initialized(in2);
+
+	_prj_pt_add_monty_unchecked(out, in1, in2);
+}
+
 /*
  * If NO_USE_COMPLETE_FORMULAS flag is not defined addition formulas from Algorithm 3
  * of https://joostrenes.nl/publications/complete.pdf are used, otherwise
@@ -257,8 +326,10 @@ static void __prj_pt_dbl_monty(prj_pt_t out, prj_pt_src_t in)
 {
 #ifndef NO_USE_COMPLETE_FORMULAS
 	fp t0, t1, t2 ,t3;
+	const prj_pt_fp_ops *ops = _prj_pt_fp_ops(in->crv);
 
 	/* Info: initialization check of in done at upper level */
+
 	prj_pt_init(out, in->crv);
 
 	fp_init(&t0, out->crv->a.ctx);
@@ -268,43 +339,46 @@ static void __prj_pt_dbl_monty(prj_pt_t out, prj_pt_src_t in)
 
 	MUST_HAVE(out->crv == in->crv);
 
-	fp_mul_monty(&t0, &in->X, &in->X);
-	fp_mul_monty(&t1, &in->Y, &in->Y);
-	fp_mul_monty(&t2, &in->Z, &in->Z);
-	fp_mul_monty(&t3, &in->X, &in->Y);
-	fp_add_monty(&t3, &t3, &t3);
-
-	fp_mul_monty(&out->Z, &in->X, &in->Z);
-	fp_add_monty(&out->Z, &out->Z, &out->Z);
-	fp_mul_monty(&out->X, &in->crv->a_monty, &out->Z);
-	fp_mul_monty(&out->Y, &in->crv->b3_monty, &t2);
-	fp_add_monty(&out->Y, &out->X, &out->Y);
-
-	fp_sub_monty(&out->X, &t1, &out->Y);
-	fp_add_monty(&out->Y, &t1, &out->Y);
-	fp_mul_monty(&out->Y, &out->X, &out->Y);
-	fp_mul_monty(&out->X, &t3, &out->X);
-	fp_mul_monty(&out->Z, &in->crv->b3_monty, &out->Z);
-
-	fp_mul_monty(&t2, &in->crv->a_monty, &t2);
-	fp_sub_monty(&t3, &t0, &t2);
-	fp_mul_monty(&t3, &in->crv->a_monty, &t3);
-	fp_add_monty(&t3, &t3, &out->Z);
-	fp_add_monty(&out->Z, &t0, &t0);
-
-	fp_add_monty(&t0, &out->Z, &t0);
-	fp_add_monty(&t0, &t0, &t2);
-	fp_mul_monty(&t0, &t0, &t3);
-	fp_add_monty(&out->Y, &out->Y, &t0);
-	fp_mul_monty(&t2, &in->Y, &in->Z);
-
-	fp_add_monty(&t2, &t2, &t2);
-	fp_mul_monty(&t0, &t2, &t3);
-	fp_sub_monty(&out->X, &out->X, &t0);
-	fp_mul_monty(&out->Z, &t2, &t1);
-	fp_add_monty(&out->Z, &out->Z, &out->Z);
-
-	fp_add_monty(&out->Z, &out->Z, &out->Z);
+	ops->sqr(&t0, &in->X);
+	ops->sqr(&t1, &in->Y);
+	ops->sqr(&t2, &in->Z);
+	ops->mul(&t3, &in->X, &in->Y);
+	ops->dbl(&t3, &t3);
+
+	ops->mul(&out->Z, &in->X, &in->Z);
+	ops->dbl(&out->Z, &out->Z);
+	ops->mul(&out->X, &in->crv->a_monty, &out->Z);
+	ops->mul(&out->Y, &in->crv->b3_monty, &t2);
+	ops->add(&out->Y, &out->X, &out->Y);
+
+	ops->sub(&out->X, &t1, &out->Y);
+	ops->add(&out->Y, &t1, &out->Y);
+	ops->mul(&out->Y, &out->X, &out->Y);
+	ops->mul(&out->X, &t3, &out->X);
+	ops->mul(&out->Z, &in->crv->b3_monty, &out->Z);
+
+	ops->mul(&t2, &in->crv->a_monty, &t2);
+	ops->sub(&t3, &t0, &t2);
+	ops->mul(&t3, &in->crv->a_monty, &t3);
+	ops->add(&t3, &t3, &out->Z);
+	ops->tpl(&t0, &t0);
+
+	ops->add(&t0, &t0, &t2);
+	ops->mul(&t0, &t0, &t3);
+	ops->add(&out->Y, &out->Y, &t0);
+	ops->mul(&t2, &in->Y, &in->Z);
+
+	ops->dbl(&t2, &t2);
+	ops->mul(&t0, &t2, &t3);
+	ops->sub(&out->X, &out->X, &t0);
+	ops->mul(&out->Z, &t2, &t1);
+	ops->dbl(&out->Z, &out->Z);
+
+	ops->dbl(&out->Z, &out->Z);
+
+	ops->reduce(&out->X);
+	ops->reduce(&out->Y);
+	ops->reduce(&out->Z);
 
 	fp_uninit(&t0);
 	fp_uninit(&t1);
@@ -330,52 +404,51 @@ static void __prj_pt_dbl_monty(prj_pt_t out, prj_pt_src_t in)
 	fp_init(&h, out->crv->a.ctx);
 
 	/* XX = X1² */
-	fp_sqr_monty(&XX, &(in->X));
+	_fp_sqr_redc1_unchecked(&XX, &(in->X));
 
 	/* ZZ = Z1² */
-	fp_sqr_monty(&ZZ, &(in->Z));
+	_fp_sqr_redc1_unchecked(&ZZ, &(in->Z));
 
 	/* w = a*ZZ+3*XX */
-	fp_mul_monty(&w, &(in->crv->a_monty), &ZZ);
-	fp_add_monty(&w, &w, &XX);
-	fp_add_monty(&w, &w, &XX);
-	fp_add_monty(&w, &w, &XX);
+	_fp_mul_redc1_unchecked(&w, &(in->crv->a_monty), &ZZ);
+	_fp_tpl_unchecked(&B, &XX);
+	_fp_add_unchecked(&w, &w, &B);
 
 	/* s = 2*Y1*Z1 */
-	fp_mul_monty(&s, &(in->Y), &(in->Z));
-	fp_add_monty(&s, &s, &s);
+	_fp_mul_redc1_unchecked(&s, &(in->Y), &(in->Z));
+	_fp_dbl_unchecked(&s, &s);
 
 	/* ss = s² */
-	fp_sqr_monty(&ss, &s);
+	_fp_sqr_redc1_unchecked(&ss, &s);
 
 	/* sss = s*ss */
-	fp_mul_monty(&sss, &s, &ss);
+	_fp_mul_redc1_unchecked(&sss, &s, &ss);
 
 	/* R = Y1*s */
-	fp_mul_monty(&R, &(in->Y), &s);
+	_fp_mul_redc1_unchecked(&R, &(in->Y), &s);
 
 	/* RR = R² */
-	fp_sqr_monty(&RR, &R);
+	_fp_sqr_redc1_unchecked(&RR, &R);
 
 	/* B = (X1+R)²-XX-RR */
-	fp_add_monty(&R, &R, &(in->X));
-	fp_sqr_monty(&B, &R);
-	fp_sub_monty(&B, &B, &XX);
-	fp_sub_monty(&B, &B, &RR);
+	_fp_add_unchecked(&R, &R, &(in->X));
+	_fp_sqr_redc1_unchecked(&B, &R);
+	_fp_sub_unchecked(&B, &B, &XX);
+	_fp_sub_unchecked(&B, &B, &RR);
 
 	/* h = w²-2*B */
-	fp_sqr_monty(&h, &w);
-	fp_sub_monty(&h, &h, &B);
-	fp_sub_monty(&h, &h, &B);
+	_fp_sqr_redc1_unchecked(&h, &w);
+	_fp_sub_unchecked(&h, &h, &B);
+	_fp_sub_unchecked(&h, &h, &B);
 
 	/* X3 = h*s */
-	fp_mul_monty(&(out->X), &h, &s);
+	_fp_mul_redc1_unchecked(&(out->X), &h, &s);
 
 	/* Y3 = w*(B-h)-2*RR */
-	fp_sub_monty(&B, &B, &h);
-	fp_mul_monty(&(out->Y), &w, &B);
-	fp_sub_monty(&(out->Y), &(out->Y), &RR);
-	fp_sub_monty(&(out->Y), &(out->Y), &RR);
+	_fp_sub_unchecked(&B, &B, &h);
+	_fp_mul_redc1_unchecked(&(out->Y), &w, &B);
+	_fp_sub_unchecked(&(out->Y), &(out->Y), &RR);
+	_fp_sub_unchecked(&(out->Y), &(out->Y), &RR);
 
 	/* Z3 = sss */
 	fp_copy(&(out->Z), &sss);
@@ -408,13 +481,11 @@ static void _prj_pt_dbl_monty(prj_pt_t out, prj_pt_src_t in)
 	}
 }
 
-/* Public version of the doubling to handle the case where the inputs are
- * zero or opposites
+/* Doubling handling the case where the input is zero, without the
+ * initialization check of the public version
  */
-void prj_pt_dbl_monty(prj_pt_t out, prj_pt_src_t in)
+static void _prj_pt_dbl_monty_unchecked(prj_pt_t out, prj_pt_src_t in)
 {
-	prj_pt_check_initialized(in);
-
 #ifdef NO_USE_COMPLETE_FORMULAS
 	if (prj_pt_iszero(in)) {
 		prj_pt_init(out, in->crv);
@@ -427,6 +498,16 @@ void prj_pt_dbl_monty(prj_pt_t out, prj_pt_src_t in)
 #endif
 }
 
+/* Public version of the doubling to handle the case where the inputs are
+ * zero or opposites
+ */
+void prj_pt_dbl_monty(prj_pt_t out, prj_pt_src_t in)
+{
+	prj_pt_check_initialized(in);
+
+	_prj_pt_dbl_monty_unchecked(out, in);
+}
+
 
 
 /****** Scalar multiplication algorithms *****/
@@ -540,9 +621,9 @@ static void _prj_pt_mul_ltr_monty_dbl_add_always(prj_pt_t out, nn_src_t m, prj_p
 	 * Blind the point with projective coordinates (X, Y, Z) => (l*X, l*Y, l*Z)
          */
 	prj_pt_init(&T[2], in->crv);
-        fp_mul_monty(&(T[2].X), &(in->X), &l);
-        fp_mul_monty(&(T[2].Y), &(in->Y), &l);
-        fp_mul_monty(&(T[2].Z), &(in->Z), &l);
+        _fp_mul_redc1_unchecked(&(T[2].X), &(in->X), &l);
+        _fp_mul_redc1_unchecked(&(T[2].Y), &(in->Y), &l);
+        _fp_mul_redc1_unchecked(&(T[2].Z), &(in->Z), &l);
 
 	/*  T[r[n-1]] = T[2] */
 	prj_pt_copy(&T[rbit], &T[2]);
@@ -556,16 +637,16 @@ static void _prj_pt_mul_ltr_monty_dbl_add_always(prj_pt_t out, nn_src_t m, prj_p
 		/* mbit is m[i] */
 		mbit = nn_getbit(&m_msb_fixed, mlen);
 		/* Double: T[r[i+1]] = ECDBL(T[r[i+1]]) */
-		prj_pt_dbl_monty(&T[rbit], &T[rbit]);
+		_prj_pt_dbl_monty_unchecked(&T[rbit], &T[rbit]);
 		/* Add:  T[1-r[i+1]] = ECADD(T[r[i+1]],T[2]) */
-		prj_pt_add_monty(&T[1-rbit], &T[rbit], &T[2]);
+		_prj_pt_add_monty_unchecked(&T[1-rbit], &T[rbit], &T[2]);
 		/* T[r[i]] = T[d[i] ^ r[i+1]] 
 		 * NOTE: we use the low level nn_copy function here to avoid
 		 * any possible leakage on operands with prj_pt_copy
 		 */
-		nn_copy(&(T[rbit_next].X.fp_val), &(T[mbit ^ rbit].X.fp_val));
-		nn_copy(&(T[rbit_next].Y.fp_val), &(T[mbit ^ rbit].Y.fp_val));
-		nn_copy(&(T[rbit_next].Z.fp_val), &(T[mbit ^ rbit].Z.fp_val));
+		fp_copy(&(T[rbit_next].X), &(T[mbit ^ rbit].X));
+		fp_copy(&(T[rbit_next].Y), &(T[mbit ^ rbit].Y));
+		fp_copy(&(T[rbit_next].Z), &(T[mbit ^ rbit].Z));
 		/* Update rbit */
 		rbit = rbit_next;
 	}
@@ -684,11 +765,11 @@ static void _prj_pt_mul_ltr_monty_ladder(prj_pt_t out, nn_src_t m, prj_pt_src_t
 	prj_pt_copy(&T[rbit], in);
         /* Blind the point with projective coordinates (X, Y, Z) => (l*X, l*Y, l*Z)
          */
-        fp_mul_monty(&(T[rbit].X), &(T[rbit].X), &l);
-        fp_mul_monty(&(T[rbit].Y), &(T[rbit].Y), &l);
-        fp_mul_monty(&(T[rbit].Z), &(T[rbit].Z), &l);
+        _fp_mul_redc1_unchecked(&(T[rbit].X), &(T[rbit].X), &l);
+        _fp_mul_redc1_unchecked(&(T[rbit].Y), &(T[rbit].Y), &l);
+        _fp_mul_redc1_unchecked(&(T[rbit].Z), &(T[rbit].Z), &l);
 	/* Initialize T[1-r[n-1]] with ECDBL(T[r[n-1]])) */
-	prj_pt_dbl_monty(&T[1-rbit], &T[rbit]);
+	_prj_pt_dbl_monty_unchecked(&T[1-rbit], &T[rbit]);
 
 	/* Main loop of the Montgomery Ladder */
 	while (mlen > 0) {
@@ -699,23 +780,23 @@ static void _prj_pt_mul_ltr_monty_ladder(prj_pt_t out, nn_src_t m, prj_pt_src_t
 		/* mbit is m[i] */
 		mbit = nn_getbit(&m_msb_fixed, mlen);
 		/* Double: T[2] = ECDBL(T[d[i] ^ r[i+1]]) */
-		prj_pt_dbl_monty(&T[2], &T[mbit ^ rbit]);
+		_prj_pt_dbl_monty_unchecked(&T[2], &T[mbit ^ rbit]);
 		/* Add: T[1] = ECADD(T[0],T[1]) */
-		prj_pt_add_monty(&T[1], &T[0], &T[1]);
+		_prj_pt_add_monty_unchecked(&T[1], &T[0], &T[1]);
 		/* T[0] = T[2-(d[i] ^ r[i])] */
 		/* NOTE: we use the low level nn_copy function here to avoid
 		 * any possible leakage on operands with prj_pt_copy
 		 */
-		nn_copy(&(T[0].X.fp_val), &(T[2-(mbit ^ rbit_next)].X.fp_val));
-		nn_copy(&(T[0].Y.fp_val), &(T[2-(mbit ^ rbit_next)].Y.fp_val));
-		nn_copy(&(T[0].Z.fp_val), &(T[2-(mbit ^ rbit_next)].Z.fp_val));
+		fp_copy(&(T[0].X), &(T[2-(mbit ^ rbit_next)].X));
+		fp_copy(&(T[0].Y), &(T[2-(mbit ^ rbit_next)].Y));
+		fp_copy(&(T[0].Z), &(T[2-(mbit ^ rbit_next)].Z));
 		/* T[1] = T[1+(d[i] ^ r[i])] */
 		/* NOTE: we use the low level nn_copy function here to avoid
 		 * any possible leakage on operands with prj_pt_copy
 		 */
-		nn_copy(&(T[1].X.fp_val), &(T[1+(mbit ^ rbit_next)].X.fp_val));
-		nn_copy(&(T[1].Y.fp_val), &(T[1+(mbit ^ rbit_next)].Y.fp_val));
-		nn_copy(&(T[1].Z.fp_val), &(T[1+(mbit ^ rbit_next)].Z.fp_val));
+		fp_copy(&(T[1].X), &(T[1+(mbit ^ rbit_next)].X));
+		fp_copy(&(T[1].Y), &(T[1+(mbit ^ rbit_next)].Y));
+		fp_copy(&(T[1].Z), &(T[1+(mbit ^ rbit_next)].Z));
 		/* Update rbit */
 		rbit = rbit_next;
 	}
@@ -769,14 +850,249 @@ void prj_pt_mul_ltr_monty(prj_pt_t out, nn_src_t m, prj_pt_src_t in)
 }
 
 
+/*
+ * Fixed base multiplications by the generator G of a curve having a
+ * precomputed signed comb (see ec_shortw_crv_set_gen_comb()).
+ *
+ * With w teeth and d = ceil(bitlen(q) / w), an odd scalar 0 < m' < 2^(w*d)
+ * is written m' = sum_{i < w*d} s_i 2^i with s_i = 2 * b_i - 1, b_i being
+ * the bits of k = (m' - 1) / 2 + 2^(w*d - 1) (so that every s_i is +1 or
+ * -1), and m' * G = sum_{j < d} 2^j V_j with
+ * V_j = (s_j + s_(j + d) 2^d + ... + s_(j + (w - 1)d) 2^((w - 1)d))G.
+ * V_j is the point of the table whose index has the bits b_(j + td) of
+ * t = 1, ..., w - 1 when s_j = 1, and the opposite of the point whose
+ * index has the complemented bits otherwise. An even scalar m is replaced
+ * by q - m, the signs of the digits being then flipped. The result is
+ * computed with the Horner rule on the d columns, with d - 1 doublings and
+ * d additions of points of the table, all the operations and memory
+ * accesses being the same whatever the scalar is.
+ */
+
+/*
+ * Non zero when in is the generator G of its curve and the curve has a
+ * comb. in = (X, Y, Z) is compared in projective coordinates with the
+ * first point (x, y) of the wNAF table, i.e. G: it is G when X = x * Z and
+ * Y = y * Z, the Montgomery products of the coordinates of the table
+ * (which are in Montgomery representation) with Z giving x * Z and y * Z.
+ */
+static int _prj_pt_is_gen_comb_base(prj_pt_src_t in)
+{
+	const word_t *tab = in->crv->gen_wnaf_table;
+	fp_ctx_src_t ctx = in->crv->a.ctx;
+	fp t;
+	int ret;
+	u8 i;
+
+	if ((in->crv->gen_comb_table == NULL) || fp_iszero(&(in->Z))) {
+		return 0;
+	}
+
+	fp_init(&t, ctx);
+	for (i = 0; i < ctx->p.wlen; i++) {
+		t.fp_val[i] = tab[i];
+	}
+	_fp_mul_redc1_unchecked(&t, &t, &(in->Z));
+	ret = (fp_cmp(&t, &(in->X)) == 0);
+	for (i = 0; i < ctx->p.wlen; i++) {
+		t.fp_val[i] = tab[ctx->p.wlen + i];
+	}
+	_fp_mul_redc1_unchecked(&t, &t, &(in->Z));
+	ret &= (fp_cmp(&t, &(in->Y)) == 0);
+	fp_uninit(&t);
+
+	return ret;
+}
+
+/*
+ * Recoding of the scalar 0 <= m < q for the comb on nbits = w * d bits:
+ * out = k = (m' - 1) / 2 + 2^(nbits - 1), m' being m when m is odd and
+ * q - m otherwise. Returns non zero in the latter case, i.e. when the
+ * digits of m' must be negated.
+ */
+static int _prj_pt_gen_comb_recode(nn_t out, nn_src_t m, nn_src_t q,
+				   bitcnt_t nbits)
+{
+	nn t;
+	int neg;
+
+	neg = !nn_isodd(m);
+	nn_sub(&t, q, m);
+	nn_copy(out, m);
+	nn_cnd_swap(neg, out, &t);
+	nn_rshift(out, out, 1);
+	nn_one(&t);
+	nn_lshift(&t, &t, (bitcnt_t)(nbits - 1));
+	nn_add(out, out, &t);
+	nn_uninit(&t);
+
+	return neg;
+}
+
+/*
+ * out = m mod q, m being copied when it is already reduced (the scalars
+ * of the signatures always are), nn_mod() not being constant time.
+ */
+static void _prj_pt_gen_comb_reduce(nn_t out, nn_src_t m, nn_src_t q)
+{
+	if (nn_cmp(m, q) < 0) {
+		nn_copy(out, m);
+	} else {
+		nn_mod(out, m, q);
+	}
+}
+
+/*
+ * out = T[idx] when neg is zero and -T[idx] otherwise, T being the comb of
+ * the generator of the curve of out (tmp is a scratch element of Fp). The
+ * whole table is read, the point being selected by masking as in
+ * fp_tabselect(), and the negation is a conditional swap, so that neither
+ * the memory accesses nor the timings depend on idx and neg.
+ */
+static void _prj_pt_get_gen_comb_point(prj_pt_t out, fp_t tmp, word_t idx,
+				       int neg)
+{
+	fp_ctx_src_t ctx = out->crv->a.ctx;
+	const word_t *pt = out->crv->gen_comb_table;
+	word_t k, mask, n = (word_t)1 << (out->crv->gen_comb_teeth - 1);
+	u8 i, wlen = ctx->p.wlen;
+
+	for (i = 0; i < wlen; i++) {
+		out->X.fp_val[i] = WORD(0);
+		out->Y.fp_val[i] = WORD(0);
+		out->Z.fp_val[i] = ctx->r.val[i];
+	}
+	for (k = 0; k < n; k++, pt += 2 * wlen) {
+		mask = WORD_MASK_IFNOTZERO(idx == k);
+		for (i = 0; i < wlen; i++) {
+			out->X.fp_val[i] |= (pt[i] & mask);
+			out->Y.fp_val[i] |= (pt[wlen + i] & mask);
+		}
+	}
+	_fp_neg_unchecked(tmp, &(out->Y));
+	fp_cnd_swap(neg, &(out->Y), tmp);
+}
+
+/*
+ * out = (m1 + m2) * G with the comb of the curve crv, 0 <= m1, m2 < q, m2
+ * being possibly NULL (m1 * G then). The columns of both scalars are
+ * processed in the same loop, which shares the doublings, and the first
+ * point is blinded with random projective coordinates.
+ */
+static void _prj_pt_mul_gen_comb(prj_pt_t out, ec_shortw_crv_src_t crv,
+				 nn_src_t m1, nn_src_t m2)
+{
+	nn_src_t m[2];
+	nn k[2];
+	int neg[2];
+	prj_pt T;
+	fp l, tmp;
+	bitcnt_t d, j, t;
+	word_t idx, b0, mask;
+	u8 s, nscalars, teeth = crv->gen_comb_teeth;
+
+	m[0] = m1;
+	m[1] = m2;
+	nscalars = (m2 == NULL) ? 1 : 2;
+	d = (bitcnt_t)((nn_bitlen(&(crv->order)) + teeth - 1) / teeth);
+	mask = ((word_t)1 << (teeth - 1)) - 1;
+
+	for (s = 0; s < nscalars; s++) {
+		neg[s] = _prj_pt_gen_comb_recode(&k[s], m[s], &(crv->order),
+						 (bitcnt_t)(d * teeth));
+	}
+
+	/* Get a random value l in Fp for projective coordinates masking */
+	MUST_HAVE(!fp_get_random(&l, crv->a.ctx));
+
+	prj_pt_init(out, crv);
+	prj_pt_init(&T, crv);
+	fp_init(&tmp, crv->a.ctx);
+
+	for (j = d; j > 0; j--) {
+		if (j != d) {
+			_prj_pt_dbl_monty_unchecked(out, out);
+		}
+		for (s = 0; s < nscalars; s++) {
+			/* Column j - 1: index from bits j - 1 + t * d, t > 0 */
+			idx = 0;
+			for (t = 1; t < teeth; t++) {
+				idx |= (word_t)nn_getbit(&k[s], (bitcnt_t)(j - 1 + (t * d))) << (t - 1);
+			}
+			b0 = nn_getbit(&k[s], (bitcnt_t)(j - 1));
+			/* Complement the index when s_(j - 1) = -1 */
+			idx ^= (mask & (WORD(0) - (b0 ^ 1)));
+			_prj_pt_get_gen_comb_point(&T, &tmp, idx,
+						   (int)((b0 ^ 1) ^ (word_t)neg[s]));
+			if ((j == d) && (s == 0)) {
+				/* Blind the first point: (X, Y, Z) => (l*X, l*Y, l*Z) */
+				_fp_mul_redc1_unchecked(&(out->X), &(T.X), &l);
+				_fp_mul_redc1_unchecked(&(out->Y), &(T.Y), &l);
+				_fp_mul_redc1_unchecked(&(out->Z), &(T.Z), &l);
+			} else {
+				_prj_pt_add_monty_unchecked(out, out, &T);
+			}
+		}
+	}
+	/* Check that the output is on the curve */
+	MUST_HAVE(prj_pt_is_on_curve(out) == 1);
+
+	for (s = 0; s < nscalars; s++) {
+		nn_uninit(&k[s]);
+	}
+	prj_pt_uninit(&T);
+	fp_uninit(&l);
+	fp_uninit(&tmp);
+}
 
+/*
+ * out = m * in, with the comb when in is the generator of a curve having
+ * one (m being reduced modulo q) and with the ladder otherwise.
+ */
 void prj_pt_mul_monty(prj_pt_t out, nn_src_t m, prj_pt_src_t in)
 {
+	nn m_mod;
+
+	prj_pt_check_initialized(in);
+	nn_check_initialized(m);
+
+	if (_prj_pt_is_gen_comb_base(in)) {
+		_prj_pt_gen_comb_reduce(&m_mod, m, &(in->crv->order));
+		_prj_pt_mul_gen_comb(out, in->crv, &m_mod, NULL);
+		nn_zero(&m_mod);
+		nn_uninit(&m_mod);
+		return;
+	}
+
 	prj_pt_mul_ltr_monty(out, m, in);
 }
 
 int prj_pt_mul_monty_blind(prj_pt_t out, nn_src_t m, prj_pt_src_t in, nn_t b, nn_src_t q)
 {
+	nn m_mod, b_mod;
+
+	prj_pt_check_initialized(in);
+	nn_check_initialized(m);
+
+	if (_prj_pt_is_gen_comb_base(in) &&
+	    (nn_cmp(q, &(in->crv->order)) == 0)) {
+		/*
+		 * Split the scalar instead of lengthening it: m = b + (m - b)
+		 * mod q, both shares being random and of the size of q, and
+		 * the comb processing them at once.
+		 */
+		_prj_pt_gen_comb_reduce(&m_mod, m, q);
+		_prj_pt_gen_comb_reduce(&b_mod, b, q);
+		nn_mod_sub(&m_mod, &m_mod, &b_mod, q);
+		_prj_pt_mul_gen_comb(out, in->crv, &b_mod, &m_mod);
+		/* Zero the shares and the mask to avoid information leak */
+		nn_zero(b);
+		nn_zero(&b_mod);
+		nn_zero(&m_mod);
+		nn_uninit(&b_mod);
+		nn_uninit(&m_mod);
+		return 0;
+	}
+
 	/* Blind the scalar m with (b*q) */
 	nn_mul(b, b, q);
 	nn_add(b, b, m);
@@ -792,7 +1108,102 @@ int prj_pt_mul_monty_blind(prj_pt_t out, nn_src_t m, prj_pt_src_t in, nn_t b, nn
 	return 0;
 }
 
+#if defined(WITH_LL_U256_MONT) && (WORD_BYTES == 8)
+/*
+ * The Jacobian doubling and mixed addition of ll_u256_pt.h, used for 4
+ * limbs primes (unless they have a fixed limbs backend, or are small
+ * enough for the lazy reduction). The coordinates are copied to and from
+ * the contiguous arrays of the kernels.
+ */
+static int _jprj_pt_use_ll_u256(prj_pt_src_t in)
+{
+	fp_ctx_src_t ctx = in->crv->a.ctx;
+
+	return (ctx->fixed == NULL) && (!ctx->lazy) &&
+	       (ctx->p.wlen == LL_U256_MONT_WLEN);
+}
+
+static void _jprj_pt_get_words(u64 *out, fp_src_t x, fp_src_t y,
+			       fp_src_t z)
+{
+	u8 i;
+
+	for (i = 0; i < LL_U256_MONT_WLEN; i++) {
+		out[i] = x->fp_val[i];
+		out[LL_U256_MONT_WLEN + i] = y->fp_val[i];
+		if (z != NULL) {
+			out[(2 * LL_U256_MONT_WLEN) + i] = z->fp_val[i];
+		}
+	}
+}
+
+static void _jprj_pt_set_words(prj_pt_t out, const u64 *in)
+{
+	u8 i;
+
+	for (i = 0; i < LL_U256_MONT_WLEN; i++) {
+		out->X.fp_val[i] = in[i];
+		out->Y.fp_val[i] = in[LL_U256_MONT_WLEN + i];
+		out->Z.fp_val[i] = in[(2 * LL_U256_MONT_WLEN) + i];
+	}
+}
+
+/* Jacobian doubling for a = -3 (same formula as the a = -3 case of
+ * _jprj_pt_dbl_monty())
+ */
+static void _jprj_pt_dbl_ll_u256(prj_pt_t out, prj_pt_src_t in)
+{
+	fp_ctx_src_t ctx = in->crv->a.ctx;
+	u64 pt[3 * LL_U256_MONT_WLEN];
+
+	_jprj_pt_get_words(pt, &in->X, &in->Y, &in->Z);
+	ll_u256_jprj_dbl_a3(pt, pt, ctx->p.val, ctx->mpinv);
+	_jprj_pt_set_words(out, pt);
+}
+
+/*
+ * Jacobian addition of in2 whose Z is one (in Montgomery representation),
+ * in1 not being the point at infinity. Returns 1 without touching out
+ * when the points are equal.
+ */
+static int _jprj_pt_add_mixed_ll_u256(prj_pt_t out, prj_pt_src_t in1,
+				      prj_pt_src_t in2)
+{
+	fp_ctx_src_t ctx = in1->crv->a.ctx;
+	u64 pt1[3 * LL_U256_MONT_WLEN], pt2[2 * LL_U256_MONT_WLEN];
+
+	_jprj_pt_get_words(pt1, &in1->X, &in1->Y, &in1->Z);
+	_jprj_pt_get_words(pt2, &in2->X, &in2->Y, NULL);
+	if (ll_u256_jprj_add_mixed(pt1, pt1, pt2, ctx->p.val, ctx->mpinv)) {
+		return 1;
+	}
+	_jprj_pt_set_words(out, pt1);
+
+	return 0;
+}
+
+/* Non zero when the Z coordinate of in is one in Montgomery representation */
+static int _jprj_pt_z_is_one(prj_pt_src_t in)
+{
+	fp_ctx_src_t ctx = in->crv->a.ctx;
+	word_t diff = WORD(0);
+	u8 i;
+
+	for (i = 0; i < LL_U256_MONT_WLEN; i++) {
+		diff |= in->Z.fp_val[i] ^ ctx->r.val[i];
+	}
+
+	return (diff == WORD(0));
+}
+#endif
+
+/*
+ * Jacobian doubling: only M = 3*X1^2 + a*Z1^4 depends on a, whose shape
+ * is found once at ec_shortw_crv_init() time (see ec_shortw_a_type). It
+ * costs 4M + 4S for a = -3, 3M + 4S for a = 0 and 4M + 6S otherwise.
+ */
 static void _jprj_pt_dbl_monty(prj_pt_t out, prj_pt_src_t in){
+	const prj_pt_fp_ops *ops = _prj_pt_fp_ops(in->crv);
 
 	// ext_printf("_jprj_pt_dbl_monty\n");
 
@@ -802,6 +1213,14 @@ static void _jprj_pt_dbl_monty(prj_pt_t out, prj_pt_src_t in){
 		return;
 	}
 
+#if defined(WITH_LL_U256_MONT) && (WORD_BYTES == 8)
+	if (_jprj_pt_use_ll_u256(in) &&
+	    (in->crv->a_type == EC_SHORTW_A_MINUS_3)) {
+		_jprj_pt_dbl_ll_u256(out, in);
+		return;
+	}
+#endif
+
 	fp x2, x4, y2, y4, z2;
 	fp_init(&x2, out->crv->a.ctx);
 	fp_init(&x4, out->crv->a.ctx);
@@ -809,54 +1228,66 @@ static void _jprj_pt_dbl_monty(prj_pt_t out, prj_pt_src_t in){
 	fp_init(&y4, out->crv->a.ctx);
 	fp_init(&z2, out->crv->a.ctx);
 
-	/* x2 = 3x^2 */
-
-	fp_mul_monty(&z2, &in->Z, &in->Z);
-
-	// fp_mul_monty(&z2, &z2, &z2);
-	// fp_mul_monty(&z2, &z2, &out->crv->a_monty);
-	// fp_mul_monty(&x2, &in->X, &in->X);
-	// fp_add_monty(&x4, &x2, &x2);
-	// fp_add_monty(&x2, &x4, &x2);
-	// fp_add_monty(&x2, &x2, &z2);
-
-	/* M = 3*(X1-Z12)*(X1+Z12) */
-	fp_add_monty(&x2, &in->X, &z2);
-	fp_sub_monty(&x4, &in->X, &z2);
-	fp_mul_monty(&x2, &x2, &x4);
-	fp_add_monty(&x4, &x2, &x2);
-	fp_add_monty(&x2, &x4, &x2);
+	/* M = 3*X1^2 + a*Z1^4, depending on the shape of a */
+	switch (in->crv->a_type) {
+	case EC_SHORTW_A_MINUS_3:
+		/* M = 3*(X1-Z12)*(X1+Z12) */
+		ops->sqr(&z2, &in->Z);
+		ops->add(&x2, &in->X, &z2);
+		ops->sub(&x4, &in->X, &z2);
+		ops->mul(&x2, &x2, &x4);
+		ops->tpl(&x2, &x2);
+		break;
+	case EC_SHORTW_A_ZERO:
+		/* M = 3*X1^2 */
+		ops->sqr(&x2, &in->X);
+		ops->tpl(&x2, &x2);
+		break;
+	default:
+		/* M = 3*X1^2 + a*Z1^4 */
+		ops->sqr(&z2, &in->Z);
+		ops->sqr(&z2, &z2);
+		ops->mul(&z2, &z2, &in->crv->a_monty);
+		ops->sqr(&x2, &in->X);
+		ops->tpl(&x2, &x2);
+		ops->add(&x2, &x2, &z2);
+		break;
+	}
 
 
 
 	/* M^2 */
-	fp_mul_monty(&x4, &x2, &x2);
+	ops->sqr(&x4, &x2);
 
 	// 2y^2
-	fp_mul_monty(&y2, &in->Y, &in->Y);
-	fp_add_monty(&y2, &y2, &y2);
+	ops->sqr(&y2, &in->Y);
+	ops->dbl(&y2, &y2);
 
 	// y4 = 8y^4
-	fp_mul_monty(&y4, &y2, &y2);
-	fp_add_monty(&y4, &y4, &y4);
+	ops->sqr(&y4, &y2);
+	ops->dbl(&y4, &y4);
 
 	// y2 = 4y^2
-	fp_add_monty(&y2, &y2, &y2);
+	ops->dbl(&y2, &y2);
 	
 	/* S = 4xy^2   */
-	fp_mul_monty(&y2, &y2, &in->X);
+	ops->mul(&y2, &y2, &in->X);
 
 	/* X = T = M^2 - 2*s */
-	fp_sub_monty(&out->X, &x4, &y2);
-	fp_sub_monty(&out->X, &out->X, &y2);
+	ops->sub(&out->X, &x4, &y2);
+	ops->sub(&out->X, &out->X, &y2);
 
 	/* Y3 = M*(S-T)-8*y^4 */
-	fp_sub_monty(&out->Y, &y2, &out->X);
-	fp_mul_monty(&out->Y, &out->Y, &x2);
-	fp_sub_monty(&out->Y, &out->Y, &y4);
+	ops->sub(&out->Y, &y2, &out->X);
+	ops->mul(&out->Y, &out->Y, &x2);
+	ops->sub(&out->Y, &out->Y, &y4);
 
-	fp_mul_monty(&out->Z, &in->Z, &in->Y);
-	fp_add_monty(&out->Z, &out->Z, &out->Z);
+	ops->mul(&out->Z, &in->Z, &in->Y);
+	ops->dbl(&out->Z, &out->Z);
+
+	ops->reduce(&out->X);
+	ops->reduce(&out->Y);
+	ops->reduce(&out->Z);
 
 	fp_uninit(&x2);
 	fp_uninit(&x4);
@@ -880,6 +1311,7 @@ static void jprj_pt_dbl_monty(prj_pt_t out, prj_pt_src_t in){
 
 
 static void _jprj_pt_add_monty(prj_pt_t out, prj_pt_src_t in1, prj_pt_src_t in2){
+	const prj_pt_fp_ops *ops = _prj_pt_fp_ops(in1->crv);
 
 	// ext_printf("_jprj_pt_add_monty\n");
 
@@ -897,6 +1329,15 @@ static void _jprj_pt_add_monty(prj_pt_t out, prj_pt_src_t in1, prj_pt_src_t in2)
 		return;
 	}
 
+#if defined(WITH_LL_U256_MONT) && (WORD_BYTES == 8)
+	/* Mixed addition when in2 is affine */
+	if (_jprj_pt_use_ll_u256(in1) && _jprj_pt_z_is_one(in2)) {
+		if (_jprj_pt_add_mixed_ll_u256(out, in1, in2)) {
+			jprj_pt_dbl_monty(out, in1);
+		}
+		return;
+	}
+#endif
 
 	fp u1, u2, s1, s2, tz1, tz2, h, r, r2, h2, h3;
 
@@ -912,44 +1353,51 @@ static void _jprj_pt_add_monty(prj_pt_t out, prj_pt_src_t in1, prj_pt_src_t in2)
 	fp_init(&h2, out->crv->a.ctx);
 	fp_init(&h3, out->crv->a.ctx);
 
-	fp_mul_monty(&tz1, &in1->Z, &in1->Z);
-	fp_mul_monty(&tz2, &in2->Z, &in2->Z);
+	ops->sqr(&tz1, &in1->Z);
+	ops->sqr(&tz2, &in2->Z);
 
-	fp_mul_monty(&u1, &in1->X, &tz2);
-	fp_mul_monty(&u2, &in2->X, &tz1);
+	ops->mul(&u1, &in1->X, &tz2);
+	ops->mul(&u2, &in2->X, &tz1);
 
-	fp_mul_monty(&tz1, &tz1, &in1->Z);
-	fp_mul_monty(&tz2, &tz2, &in2->Z);
+	ops->mul(&tz1, &tz1, &in1->Z);
+	ops->mul(&tz2, &tz2, &in2->Z);
 
-	fp_mul_monty(&s1, &in1->Y, &tz2);
-	fp_mul_monty(&s2, &in2->Y, &tz1);
+	ops->mul(&s1, &in1->Y, &tz2);
+	ops->mul(&s2, &in2->Y, &tz1);
 
-	fp_sub_monty(&h, &u2, &u1);
-	fp_sub_monty(&r, &s2, &s1);
+	ops->sub(&h, &u2, &u1);
+	ops->sub(&r, &s2, &s1);
 
+	/* The zero tests need the reduced values */
+	ops->reduce(&h);
+	ops->reduce(&r);
 	if(fp_iszero(&h) && fp_iszero(&r)){
 
 		// ext_printf("_jprj_pt_add_monty zero\n");
 		jprj_pt_dbl_monty(out, in1);
 	}else{
-		fp_mul_monty(&r2, &r, &r);
-		fp_mul_monty(&h2, &h, &h);
-		fp_mul_monty(&h3, &h2, &h);
+		ops->sqr(&r2, &r);
+		ops->sqr(&h2, &h);
+		ops->mul(&h3, &h2, &h);
 
-		fp_mul_monty(&u1, &u1, &h2);
+		ops->mul(&u1, &u1, &h2);
 
-		fp_sub_monty(&out->X, &r2, &h3);
-		fp_sub_monty(&out->X, &out->X, &u1);
-		fp_sub_monty(&out->X, &out->X, &u1);
+		ops->sub(&out->X, &r2, &h3);
+		ops->sub(&out->X, &out->X, &u1);
+		ops->sub(&out->X, &out->X, &u1);
 
-		fp_mul_monty(&s1, &s1, &h3);
+		ops->mul(&s1, &s1, &h3);
 
-		fp_sub_monty(&out->Y, &u1, &out->X);
-		fp_mul_monty(&out->Y, &out->Y, &r);
-		fp_sub_monty(&out->Y, &out->Y, &s1);
+		ops->sub(&out->Y, &u1, &out->X);
+		ops->mul(&out->Y, &out->Y, &r);
+		ops->sub(&out->Y, &out->Y, &s1);
 
-		fp_mul_monty(&out->Z, &in1->Z, &in2->Z);
-		fp_mul_monty(&out->Z, &out->Z, &h);
+		ops->mul(&out->Z, &in1->Z, &in2->Z);
+		ops->mul(&out->Z, &out->Z, &h);
+
+		ops->reduce(&out->X);
+		ops->reduce(&out->Y);
+		ops->reduce(&out->Z);
 	}
 
 	fp_uninit(&u1);
@@ -980,6 +1428,176 @@ static void jprj_pt_add_monty(prj_pt_t out, prj_pt_src_t in1, prj_pt_src_t in2){
 	}
 }
 
+/*
+ * Mixed Jacobian-affine addition (8M + 3S instead of 12M + 4S): the
+ * _jprj_pt_add_monty() formulas with Z2 = 1, i.e. U1 = X1 and S1 = Y1.
+ * in2 must have Z equal to one in Montgomery representation (e.g. the
+ * tables normalized by _jprj_pt_batch_normalize_monty() and the points of
+ * the generator table) and must not be the point at infinity.
+ */
+static void _jprj_pt_add_mixed_monty(prj_pt_t out, prj_pt_src_t in1, prj_pt_src_t in2){
+	const prj_pt_fp_ops *ops = _prj_pt_fp_ops(in1->crv);
+
+	MUST_HAVE(in1->crv == in2->crv);
+	prj_pt_init(out, in1->crv);
+	if(prj_pt_iszero(in1)){
+		prj_pt_copy(out, in2);
+		return;
+	}
+
+#if defined(WITH_LL_U256_MONT) && (WORD_BYTES == 8)
+	if (_jprj_pt_use_ll_u256(in1)) {
+		if (_jprj_pt_add_mixed_ll_u256(out, in1, in2)) {
+			jprj_pt_dbl_monty(out, in1);
+		}
+		return;
+	}
+#endif
+
+	fp u2, s2, tz1, h, r, r2, h2, h3;
+
+	fp_init(&u2, out->crv->a.ctx);
+	fp_init(&s2, out->crv->a.ctx);
+	fp_init(&tz1, out->crv->a.ctx);
+	fp_init(&h, out->crv->a.ctx);
+	fp_init(&r, out->crv->a.ctx);
+	fp_init(&r2, out->crv->a.ctx);
+	fp_init(&h2, out->crv->a.ctx);
+	fp_init(&h3, out->crv->a.ctx);
+
+	ops->sqr(&tz1, &in1->Z);
+	ops->mul(&u2, &in2->X, &tz1);
+	ops->mul(&tz1, &tz1, &in1->Z);
+	ops->mul(&s2, &in2->Y, &tz1);
+
+	ops->sub(&h, &u2, &in1->X);
+	ops->sub(&r, &s2, &in1->Y);
+
+	/* The zero tests need the reduced values */
+	ops->reduce(&h);
+	ops->reduce(&r);
+	if(fp_iszero(&h) && fp_iszero(&r)){
+		jprj_pt_dbl_monty(out, in1);
+	}else{
+		ops->sqr(&r2, &r);
+		ops->sqr(&h2, &h);
+		ops->mul(&h3, &h2, &h);
+
+		/* u2 = U1 * H^2, with U1 = X1 */
+		ops->mul(&u2, &in1->X, &h2);
+
+		ops->sub(&out->X, &r2, &h3);
+		ops->sub(&out->X, &out->X, &u2);
+		ops->sub(&out->X, &out->X, &u2);
+
+		/* s2 = S1 * H^3, with S1 = Y1 */
+		ops->mul(&s2, &in1->Y, &h3);
+
+		ops->sub(&out->Y, &u2, &out->X);
+		ops->mul(&out->Y, &out->Y, &r);
+		ops->sub(&out->Y, &out->Y, &s2);
+
+		ops->mul(&out->Z, &in1->Z, &h);
+
+		ops->reduce(&out->X);
+		ops->reduce(&out->Y);
+		ops->reduce(&out->Z);
+	}
+
+	fp_uninit(&u2);
+	fp_uninit(&s2);
+	fp_uninit(&tz1);
+	fp_uninit(&h);
+	fp_uninit(&r);
+	fp_uninit(&r2);
+	fp_uninit(&h2);
+	fp_uninit(&h3);
+}
+
+static void jprj_pt_add_mixed_monty(prj_pt_t out, prj_pt_src_t in1, prj_pt_src_t in2){
+	if ((out == in1) || (out == in2)) {
+		prj_pt out_cpy;
+		prj_pt_init(&out_cpy, out->crv);
+		prj_pt_copy(&out_cpy, out);
+		_jprj_pt_add_mixed_monty(&out_cpy, in1, in2);
+		prj_pt_copy(out, &out_cpy);
+		prj_pt_uninit(&out_cpy);
+	} else {
+		_jprj_pt_add_mixed_monty(out, in1, in2);
+	}
+}
+
+/* Maximum number of points of _jprj_pt_batch_normalize_monty() */
+#define JPRJ_PT_BATCH_NORMALIZE_MAX 16
+
+/*
+ * Normalize the n Jacobian points of pts in Montgomery representation to
+ * Z = 1 (X / Z^2 and Y / Z^3) with a single inversion, using Montgomery's
+ * trick on the Z coordinates. Returns 0 without modifying the points when
+ * one of them is the point at infinity, 1 otherwise.
+ */
+static int _jprj_pt_batch_normalize_monty(prj_pt_t *pts, int n)
+{
+	fp_ctx_src_t ctx = pts[0]->crv->a.ctx;
+	/* prod[i] = Z_0 * ... * Z_i */
+	fp prod[JPRJ_PT_BATCH_NORMALIZE_MAX];
+	fp inv, zinv, zinv2;
+	int i, ret = 0;
+	u8 k;
+
+	MUST_HAVE((n > 0) && (n <= JPRJ_PT_BATCH_NORMALIZE_MAX));
+
+	fp_init(&inv, ctx);
+	fp_init(&zinv, ctx);
+	fp_init(&zinv2, ctx);
+	fp_init(&prod[0], ctx);
+	fp_copy(&prod[0], &(pts[0]->Z));
+	for (i = 1; i < n; i++) {
+		fp_init(&prod[i], ctx);
+		_fp_mul_redc1_unchecked(&prod[i], &prod[i - 1], &(pts[i]->Z));
+	}
+	if (fp_iszero(&prod[n - 1])) {
+		goto out;
+	}
+
+	/*
+	 * The inverse of the product in Montgomery representation: fp_inv()
+	 * of (P * r) is P^-1 * r^-1, which is brought back to P^-1 * r by two
+	 * multiplications by r.
+	 */
+	fp_inv(&inv, &prod[n - 1]);
+	fp_redcify(&inv, &inv);
+	fp_redcify(&inv, &inv);
+
+	for (i = n - 1; i >= 0; i--) {
+		/* zinv = Z_i^-1, inv becoming (Z_0 * ... * Z_(i - 1))^-1 */
+		if (i > 0) {
+			_fp_mul_redc1_unchecked(&zinv, &inv, &prod[i - 1]);
+			_fp_mul_redc1_unchecked(&inv, &inv, &(pts[i]->Z));
+		} else {
+			fp_copy(&zinv, &inv);
+		}
+		_fp_sqr_redc1_unchecked(&zinv2, &zinv);
+		_fp_mul_redc1_unchecked(&(pts[i]->X), &(pts[i]->X), &zinv2);
+		_fp_mul_redc1_unchecked(&zinv2, &zinv2, &zinv);
+		_fp_mul_redc1_unchecked(&(pts[i]->Y), &(pts[i]->Y), &zinv2);
+		for (k = 0; k < ctx->p.wlen; k++) {
+			pts[i]->Z.fp_val[k] = ctx->r.val[k];
+		}
+	}
+	ret = 1;
+
+ out:
+	for (i = 0; i < n; i++) {
+		fp_uninit(&prod[i]);
+	}
+	fp_uninit(&inv);
+	fp_uninit(&zinv);
+	fp_uninit(&zinv2);
+
+	return ret;
+}
+
 /*
 precomp points = [1, 3, 5, 2n + 1,....2^(w-1)] multiply point in
 */
@@ -1042,7 +1660,63 @@ int ecmult_wnaf(int * wnag, nn_src_t m, int window){
 }
 
 
-void prj_pt_ec_mult_wnaf(prj_pt_t out, nn_src_t m, prj_pt_src_t in11, nn_src_t n, prj_pt_src_t in3)
+/*
+ * Non zero when in, normalized and in Montgomery representation, is the
+ * generator of a curve having a precomputed wNAF table (see
+ * ec_shortw_crv_set_gen_tables()), i.e. the first point of the table.
+ */
+static int _prj_pt_is_gen_wnaf_base(prj_pt_src_t in)
+{
+	const word_t *tab = in->crv->gen_wnaf_table;
+	fp_ctx_src_t ctx = in->crv->a.ctx;
+	word_t diff = WORD(0);
+	u8 i;
+
+	if (tab == NULL) {
+		return 0;
+	}
+
+	for (i = 0; i < ctx->p.wlen; i++) {
+		diff |= in->X.fp_val[i] ^ tab[i];
+		diff |= in->Y.fp_val[i] ^ tab[ctx->p.wlen + i];
+		diff |= in->Z.fp_val[i] ^ ctx->r.val[i];
+	}
+
+	return (diff == WORD(0));
+}
+
+/*
+ * out = digit * G from the wNAF table of the curve of out, digit being
+ * odd (and negative when its opposite is needed)
+ */
+static void _prj_pt_get_gen_wnaf_point(prj_pt_t out, int digit)
+{
+	fp_ctx_src_t ctx = out->crv->a.ctx;
+	const word_t *pt;
+	u8 i;
+
+	pt = out->crv->gen_wnaf_table +
+		((((digit < 0) ? -digit : digit) - 1) / 2) * (2 * ctx->p.wlen);
+	for (i = 0; i < ctx->p.wlen; i++) {
+		out->X.fp_val[i] = pt[i];
+		out->Y.fp_val[i] = pt[ctx->p.wlen + i];
+		out->Z.fp_val[i] = ctx->r.val[i];
+	}
+	if (digit < 0) {
+		fp_neg(&(out->Y), &(out->Y));
+	}
+}
+
+/*
+ * out = m * in11 + n * in3 in Jacobian coordinates (x = X / Z^2 and
+ * y = Y / Z^3, out being the point at infinity when Z = 0), without going
+ * back to affine coordinates: this saves the final inversion when the
+ * caller only needs to check x, e.g. the ECDSA verification (see
+ * ecdsa_r_check_projective()). The coordinates are in the usual (non
+ * Montgomery) representation. in11 and in3 are only normalized (one
+ * inversion) when their Z is not already one.
+ */
+void jprj_pt_ec_mult_wnaf(prj_pt_t out, nn_src_t m, prj_pt_src_t in11, nn_src_t n, prj_pt_src_t in3)
 {
 
 	prj_pt in22, in111;
@@ -1056,8 +1730,13 @@ void prj_pt_ec_mult_wnaf(prj_pt_t out, nn_src_t m, prj_pt_src_t in11, nn_src_t n
 	prj_pt_copy(in1, in11);
 	prj_pt_copy(in2, in3);
 	// Below algorithm works only for projective points whose z coordinate is 1.
-	prj_pt_normalize(in1);
-	prj_pt_normalize(in2);
+	{
+		prj_pt_t to_normalize[2];
+
+		to_normalize[0] = in1;
+		to_normalize[1] = in2;
+		prj_pt_batch_normalize(to_normalize, 2);
+	}
 
 	// fp inv;
 	// fp_init(&inv, in3->crv->a.ctx);
@@ -1078,18 +1757,18 @@ void prj_pt_ec_mult_wnaf(prj_pt_t out, nn_src_t m, prj_pt_src_t in11, nn_src_t n
 	fp_redcify(&in2->Z, &in2->Z);
 
 	// dbg_ec_point_print("in1", in1);
-	// dbg_nn_print("in1 X", &in1->X.fp_val);
-	// dbg_nn_print("in1 Y", &in1->Y.fp_val);
-	// dbg_nn_print("in1 Z", &in1->Z.fp_val);
-
-	// dbg_nn_print("in2 X", &in2->X.fp_val);
-	// dbg_nn_print("in2 Y", &in2->Y.fp_val);
-	// dbg_nn_print("in2 Z", &in2->Z.fp_val);
 
 	// calculate precomputation for in1 and in2
 	int window = 5;
 	int pre_comp_size = 1 << (window - 2);
 
+	/*
+	 * The odd multiples of the generator are precomputed for the built-in
+	 * curves, with a wider window for its scalar
+	 */
+	int use_gen_table = _prj_pt_is_gen_wnaf_base(in1);
+	int m_window = use_gen_table ? in1->crv->gen_wnaf_window : window;
+
 	// ext_printf("window size %d\n", window);
 	// ext_printf("pre_comp_size %d\n", pre_comp_size);
 
@@ -1100,17 +1779,41 @@ void prj_pt_ec_mult_wnaf(prj_pt_t out, nn_src_t m, prj_pt_src_t in11, nn_src_t n
 	nn mr, nr;
 
 	// prj_pt_init(&neg_pt, in2->crv);
-	int m_wnag[512], n_wnag[512];
+	/* The wNAF of a scalar reduced modulo q has at most one more digit */
+	int m_wnag[CURVES_MAX_Q_BIT_LEN + 1], n_wnag[CURVES_MAX_Q_BIT_LEN + 1];
 
-	get_pre_comp_points(pre_comp_m, in1, pre_comp_size);
+	if (!use_gen_table) {
+		get_pre_comp_points(pre_comp_m, in1, pre_comp_size);
+	}
 	get_pre_comp_points(pre_comp_n, in2, pre_comp_size);
 
+	/*
+	 * Normalize the tables computed above with a single inversion, so
+	 * that all the additions of the main loop are mixed ones (the points
+	 * of the generator table already have Z = 1).
+	 */
+	int mixed;
+	{
+		prj_pt_t to_normalize[2 * pre_comp_size];
+		int num = 0, k;
+
+		for (k = 0; k < pre_comp_size; k++) {
+			if (!use_gen_table) {
+				to_normalize[num++] = &pre_comp_m[k];
+			}
+			to_normalize[num++] = &pre_comp_n[k];
+		}
+		mixed = _jprj_pt_batch_normalize_monty(to_normalize, num);
+	}
+	void (*add_pre_comp)(prj_pt_t, prj_pt_src_t, prj_pt_src_t) =
+		mixed ? jprj_pt_add_mixed_monty : jprj_pt_add_monty;
+
 
 	nn_mod(&mr, m, &(in1->crv->order));
 	nn_mod(&nr, n, &(in2->crv->order));
 
 
-	bitcnt_t m_bit_len = ecmult_wnaf(m_wnag, &mr, window);
+	bitcnt_t m_bit_len = ecmult_wnaf(m_wnag, &mr, m_window);
 	bitcnt_t n_bit_len = ecmult_wnaf(n_wnag, &nr, window);
 	// bitcnt_t m_bit_len = nn_bitlen(m);
 	// bitcnt_t n_bit_len = nn_bitlen(n);
@@ -1145,9 +1848,14 @@ void prj_pt_ec_mult_wnaf(prj_pt_t out, nn_src_t m, prj_pt_src_t in11, nn_src_t n
 		{
 			no = m_wnag[i];
 			// ext_printf("m_wnag[i] = %d \n", no);
-			if (no > 0)
+			if ((no != 0) && use_gen_table)
 			{
-				jprj_pt_add_monty(out, out, &pre_comp_m[(no-1)/2]);
+				_prj_pt_get_gen_wnaf_point(&neg_pt, no);
+				jprj_pt_add_mixed_monty(out, out, &neg_pt);
+			}
+			else if (no > 0)
+			{
+				add_pre_comp(out, out, &pre_comp_m[(no-1)/2]);
 			}
 			else if (no < 0)
 			{
@@ -1155,7 +1863,7 @@ void prj_pt_ec_mult_wnaf(prj_pt_t out, nn_src_t m, prj_pt_src_t in11, nn_src_t n
 				prj_pt_copy(&neg_pt, &pre_comp_m[(-no-1)/2]);
 				fp_neg(&(neg_pt.Y), &(neg_pt.Y));
 
-				jprj_pt_add_monty(out, out, &neg_pt);
+				add_pre_comp(out, out, &neg_pt);
 			}
 		}
 
@@ -1165,7 +1873,7 @@ void prj_pt_ec_mult_wnaf(prj_pt_t out, nn_src_t m, prj_pt_src_t in11, nn_src_t n
 			// ext_printf("n_wnag[i] = %d \n", no);
 			if (no > 0)
 			{
-				jprj_pt_add_monty(out, out, &pre_comp_n[(no-1)/2]);
+				add_pre_comp(out, out, &pre_comp_n[(no-1)/2]);
 			}
 			else if (no < 0)
 			{
@@ -1173,7 +1881,7 @@ void prj_pt_ec_mult_wnaf(prj_pt_t out, nn_src_t m, prj_pt_src_t in11, nn_src_t n
 				prj_pt_copy(&neg_pt, &pre_comp_n[(-no-1)/2]);
 				fp_neg(&(neg_pt.Y), &(neg_pt.Y));
 
-				jprj_pt_add_monty(out, out, &neg_pt);
+				add_pre_comp(out, out, &neg_pt);
 			}
 		}
 
@@ -1183,7 +1891,34 @@ void prj_pt_ec_mult_wnaf(prj_pt_t out, nn_src_t m, prj_pt_src_t in11, nn_src_t n
 	fp_unredcify(&out->Y, &out->Y);
 	fp_unredcify(&out->Z, &out->Z);
 
+	nn_uninit(&mr);
+	nn_uninit(&nr);
+	prj_pt_uninit(&neg_pt);
+	for (i = 0; i < pre_comp_size; i++)
+	{
+		if (!use_gen_table) {
+			prj_pt_uninit(&pre_comp_m[i]);
+		}
+		prj_pt_uninit(&pre_comp_n[i]);
+	}
+
+	prj_pt_uninit(in1);
+	prj_pt_uninit(in2);
+}
+
+/*
+ * out = m * in1 + n * in2 with Z = 1 (see jprj_pt_ec_mult_wnaf()), the
+ * point at infinity being returned as such.
+ */
+void prj_pt_ec_mult_wnaf(prj_pt_t out, nn_src_t m, prj_pt_src_t in1, nn_src_t n, prj_pt_src_t in2)
+{
 	fp zinv2, zinv3;
+
+	jprj_pt_ec_mult_wnaf(out, m, in1, n, in2);
+	if (prj_pt_iszero(out)) {
+		return;
+	}
+
 	fp_init(&zinv2, out->crv->a.ctx);
 	fp_init(&zinv3, out->crv->a.ctx);
 
@@ -1196,16 +1931,4 @@ void prj_pt_ec_mult_wnaf(prj_pt_t out, nn_src_t m, prj_pt_src_t in11, nn_src_t n
 
 	fp_uninit(&zinv2);
 	fp_uninit(&zinv3);
-
-	nn_uninit(&mr);
-	nn_uninit(&nr);
-	prj_pt_uninit(&neg_pt);
-	for (i = 0; i < pre_comp_size; i++)
-	{
-		prj_pt_uninit(&pre_comp_m[i]);
-		prj_pt_uninit(&pre_comp_n[i]);
-	}
-
-	prj_pt_uninit(in1);
-	prj_pt_uninit(in2);
 }
@@ -299,7 +299,7 @@ int main()
 		fp_print("x", &x);
 		ext_printf("Random after squaring:\n");
 		fp_sqr(&x, &x);
-		nn_print("x^2", &(x.fp_val));
+		fp_print("x^2", &x);
 
 		ret = fp_square_root(&x_sqrt1, &x_sqrt2, &x);
 
@@ -15,6 +15,7 @@
  */
 #include "fp.h"
 #include "fp_add.h"
+#include "fp_solinas.h"
 #include "../nn/nn_add.h"
 #include "../nn/nn_logical.h"
 #include "../nn/nn_mul_redc1.h"
@@ -50,6 +51,12 @@ int fp_ctx_is_initialized(fp_ctx_src_t ctx)
  *    or 64).
  *  - p_shift, p_normalized and p_reciprocal are precomputed
  *    division parameters (see ec_params_external.h for details).
+ *
+ * When p is one of the NIST generalized Mersenne primes, the matching
+ * fast reduction is also selected for fp_mul(). With WITH_FIXED_LIMBS,
+ * the fixed limb count routines for the length of p are selected when
+ * they have been instantiated. The lazy reduction routines (see
+ * fp_lazy.h) are enabled when p leaves two spare bits in its top word.
  */
 void fp_ctx_init(fp_ctx_t ctx, nn_src_t p, bitcnt_t p_bitlen,
 		 nn_src_t r, nn_src_t r_square,
@@ -62,6 +69,8 @@ void fp_ctx_init(fp_ctx_t ctx, nn_src_t p, bitcnt_t p_bitlen,
 	nn_check_initialized(p_normalized);
 
 	MUST_HAVE(ctx != NULL);
+	/* The Fp elements are stored on FP_MAX_WORD_LEN words */
+	MUST_HAVE(p->wlen <= FP_MAX_WORD_LEN);
 	nn_copy(&(ctx->p), p);
 	ctx->p_bitlen = p_bitlen;
 	nn_copy(&(ctx->r), r);
@@ -70,9 +79,40 @@ void fp_ctx_init(fp_ctx_t ctx, nn_src_t p, bitcnt_t p_bitlen,
 	ctx->p_shift = p_shift;
 	nn_copy(&(ctx->p_normalized), p_normalized);
 	ctx->p_reciprocal = p_reciprocal;
+	ctx->red_type = fp_solinas_get_type(p, p_bitlen);
+	ctx->inv_chain = NULL;
+	ctx->inv_chain_len = 0;
+	ctx->sqrt_chain = NULL;
+	ctx->sqrt_chain_len = 0;
+#ifdef WITH_FIXED_LIMBS
+	ctx->fixed = fp_fixed_get_ops(p->wlen);
+#else
+	ctx->fixed = NULL;
+#endif
+	ctx->lazy = ((p_bitlen + 2) <= ((bitcnt_t)(p->wlen) * WORD_BITS));
 	ctx->magic = FP_CTX_MAGIC;
 }
 
+/*
+ * Attach to the Fp context the addition chains for p - 2 and (p + 1) / 4
+ * used by fp_inv_fixed() and fp_sqrt_fixed() (see fp_pow.c). Any of them
+ * can be NULL, the generic exponentiation being then used.
+ */
+void fp_ctx_set_chains(fp_ctx_t ctx, const u8 *inv_chain, u16 inv_chain_len,
+		       const u8 *sqrt_chain, u16 sqrt_chain_len)
+{
+	fp_ctx_check_initialized(ctx);
+	MUST_HAVE((inv_chain == NULL) || ((inv_chain_len > 0) &&
+					  ((inv_chain_len % 3) == 0)));
+	MUST_HAVE((sqrt_chain == NULL) || ((sqrt_chain_len > 0) &&
+					   ((sqrt_chain_len % 3) == 0)));
+
+	ctx->inv_chain = inv_chain;
+	ctx->inv_chain_len = (inv_chain == NULL) ? 0 : inv_chain_len;
+	ctx->sqrt_chain = sqrt_chain;
+	ctx->sqrt_chain_len = (sqrt_chain == NULL) ? 0 : sqrt_chain_len;
+}
+
 /*
  * Initialize pointed Fp context structure only from the prime p.
  * The Montgomery related parameters are dynamically computed
@@ -147,9 +187,13 @@ int fp_is_initialized(fp_src_t in)
  */
 void fp_init(fp_t in, fp_ctx_src_t fpctx)
 {
+	u8 i;
+
 	MUST_HAVE(in != NULL);
 	fp_ctx_check_initialized(fpctx);
-	nn_init(&in->fp_val, fpctx->p.wlen * WORD_BYTES);
+	for (i = 0; i < FP_MAX_WORD_LEN; i++) {
+		in->fp_val[i] = WORD(0);
+	}
 	in->ctx = fpctx;
 	in->magic = FP_MAGIC;
 }
@@ -174,8 +218,12 @@ void fp_init_from_buf(fp_t in, fp_ctx_src_t fpctx, const u8 *buf, u16 buflen)
  */
 void fp_uninit(fp_t in)
 {
+	u8 i;
+
 	fp_check_initialized(in);
-	nn_uninit(&in->fp_val);
+	for (i = 0; i < FP_MAX_WORD_LEN; i++) {
+		in->fp_val[i] = WORD(0);
+	}
 	in->ctx = NULL;
 	in->magic = WORD(0);
 }
@@ -187,34 +235,51 @@ void fp_uninit(fp_t in)
  */
 void fp_set_nn(fp_t out, nn_src_t in)
 {
+	u8 i;
+
+	fp_check_initialized(out);
 	nn_check_initialized(in);
+	MUST_HAVE(nn_cmp(in, &(out->ctx->p)) < 0);
 
-	nn_copy(&(out->fp_val), in);
+	/* Words of in above its wlen are zero */
+	for (i = 0; i < out->ctx->p.wlen; i++) {
+		out->fp_val[i] = in->val[i];
+	}
+}
 
-	MUST_HAVE(nn_cmp(&(out->fp_val), &(out->ctx->p)) < 0);
+/*
+ * Get the value of given Fp element as an nn, which is initialized by
+ * the function with the length of p.
+ */
+void fp_get_nn(nn_t out, fp_src_t in)
+{
+	u8 i;
 
-	/* Set the wlen to the length of p */
-	nn_set_wlen(&(out->fp_val), out->ctx->p.wlen);
+	fp_check_initialized(in);
+
+	nn_init(out, (u16)(in->ctx->p.wlen * WORD_BYTES));
+	for (i = 0; i < in->ctx->p.wlen; i++) {
+		out->val[i] = in->fp_val[i];
+	}
 }
 
 /* Set 'out' to the element 0 of Fp (neutral element for addition) */
 void fp_zero(fp_t out)
 {
+	u8 i;
+
 	fp_check_initialized(out);
 
-	nn_set_word_value(&(out->fp_val), 0);
-	/* Set the wlen to the length of p */
-	nn_set_wlen(&(out->fp_val), out->ctx->p.wlen);
+	for (i = 0; i < out->ctx->p.wlen; i++) {
+		out->fp_val[i] = WORD(0);
+	}
 }
 
 /* Set out to the element 1 of Fp (neutral element for multiplication) */
 void fp_one(fp_t out)
 {
-	fp_check_initialized(out);
-
-	nn_set_word_value(&(out->fp_val), 1);
-	/* Set the wlen to the length of p */
-	nn_set_wlen(&(out->fp_val), out->ctx->p.wlen);
+	fp_zero(out);
+	out->fp_val[0] = WORD(1);
 }
 
 /*
@@ -226,20 +291,50 @@ void fp_one(fp_t out)
  */
 int fp_cmp(fp_src_t in1, fp_src_t in2)
 {
+	int i;
+
 	fp_check_initialized(in1);
 	fp_check_initialized(in2);
 
 	MUST_HAVE(in1->ctx == in2->ctx);
 
-	return nn_cmp(&(in1->fp_val), &(in2->fp_val));
+	for (i = in1->ctx->p.wlen - 1; i >= 0; i--) {
+		if (in1->fp_val[i] > in2->fp_val[i]) return 1;
+		if (in1->fp_val[i] < in2->fp_val[i]) return -1;
+	}
+
+	return 0;
 }
 
 /* Check if given Fp element has value 0 */
 int fp_iszero(fp_src_t in)
 {
+	word_t acc = WORD(0);
+	u8 i;
+
+	fp_check_initialized(in);
+
+	for (i = 0; i < in->ctx->p.wlen; i++) {
+		acc |= in->fp_val[i];
+	}
+
+	return (acc == WORD(0));
+}
+
+/* Check if given Fp element has value 1 */
+int fp_isone(fp_src_t in)
+{
+	word_t acc;
+	u8 i;
+
 	fp_check_initialized(in);
 
-	return nn_iszero(&(in->fp_val));
+	acc = in->fp_val[0] ^ WORD(1);
+	for (i = 1; i < in->ctx->p.wlen; i++) {
+		acc |= in->fp_val[i];
+	}
+
+	return (acc == WORD(0));
 }
 
 
@@ -250,6 +345,8 @@ int fp_iszero(fp_src_t in)
  */
 void fp_copy(fp_t out, fp_src_t in)
 {
+        u8 i;
+
         fp_check_initialized(in);
         MUST_HAVE(out != NULL);
 
@@ -261,7 +358,30 @@ void fp_copy(fp_t out, fp_src_t in)
                 fp_init(out, in->ctx);
         }
 
-        nn_copy(&(out->fp_val), &(in->fp_val));
+        for (i = 0; i < in->ctx->p.wlen; i++) {
+                out->fp_val[i] = in->fp_val[i];
+        }
+}
+
+/*
+ * Swap the values of in1 and in2 if cnd is not zero, without leaking
+ * cnd through the memory accesses.
+ */
+void fp_cnd_swap(int cnd, fp_t in1, fp_t in2)
+{
+	word_t mask = WORD_MASK_IFNOTZERO(cnd);
+	word_t t;
+	u8 i;
+
+	fp_check_initialized(in1);
+	fp_check_initialized(in2);
+	MUST_HAVE(in1->ctx == in2->ctx);
+
+	for (i = 0; i < in1->ctx->p.wlen; i++) {
+		t = (in1->fp_val[i] ^ in2->fp_val[i]) & mask;
+		in1->fp_val[i] ^= t;
+		in2->fp_val[i] ^= t;
+	}
 }
 
 
@@ -290,9 +410,8 @@ void fp_tabselect(fp_t out, u8 idx, fp_src_t *tab, u8 tabsize)
 	MUST_HAVE(p != NULL);
 	p_wlen = p->wlen;
 
-	/* Zeroize out and enforce its size. */
-	nn_zero(&(out->fp_val));
-	out->fp_val.wlen = p_wlen;
+	/* Zeroize out */
+	fp_zero(out);
 
 	for (k = 0; k < tabsize; k++) {
 		/* Check current element is initialized and from Fp */
@@ -302,7 +421,7 @@ void fp_tabselect(fp_t out, u8 idx, fp_src_t *tab, u8 tabsize)
 		mask = WORD_MASK_IFNOTZERO(idx == k);
 
 		for (i = 0; i < p_wlen; i++) {
-			out->fp_val.val[i] |= (tab[k]->fp_val.val[i] & mask);
+			out->fp_val[i] |= (tab[k]->fp_val[i] & mask);
 		}
 	}
 }
@@ -323,8 +442,8 @@ int fp_eq_or_opp(fp_src_t in1, fp_src_t in2)
 	fp_init(&opp, in1->ctx);
 
 	fp_neg(&opp, in2);
-	ret = (nn_cmp(&(in1->fp_val), &(in2->fp_val)) == 0);
-	ret |= (nn_cmp(&(in1->fp_val), &(opp.fp_val)) == 0);
+	ret = (fp_cmp(in1, in2) == 0);
+	ret |= (fp_cmp(in1, &opp) == 0);
 
 	fp_uninit(&opp);
 
@@ -339,11 +458,14 @@ int fp_eq_or_opp(fp_src_t in1, fp_src_t in2)
  */
 void fp_import_from_buf(fp_t out_fp, const u8 *buf, u16 buflen)
 {
+	nn tmp;
+
 	fp_check_initialized(out_fp);
 
-	nn_init_from_buf(&(out_fp->fp_val), buf, buflen);
+	nn_init_from_buf(&tmp, buf, buflen);
+	fp_set_nn(out_fp, &tmp);
 
-	MUST_HAVE(nn_cmp(&(out_fp->fp_val), &(out_fp->ctx->p)) < 0);
+	nn_uninit(&tmp);
 }
 
 /*
@@ -352,5 +474,10 @@ void fp_import_from_buf(fp_t out_fp, const u8 *buf, u16 buflen)
  */
 void fp_export_to_buf(u8 *buf, u16 buflen, fp_src_t in_fp)
 {
-	nn_export_to_buf(buf, buflen, &(in_fp->fp_val));
+	nn tmp;
+
+	fp_get_nn(&tmp, in_fp);
+	nn_export_to_buf(buf, buflen, &tmp);
+
+	nn_uninit(&tmp);
 }
@@ -22,6 +22,21 @@
 #include "../nn/nn_mul.h"
 #include "../nn/nn_mul_redc1.h"
 #include "../fp/fp_config.h"
+#include "../fp/fp_fixed.h"
+
+/*
+ * Generalized Mersenne primes (from FIPS 186-4 D.2) for which fp_mul()
+ * uses a dedicated fast reduction instead of a division (see
+ * fp_solinas.c). FP_RED_GENERIC is used for any other prime.
+ */
+typedef enum {
+	FP_RED_GENERIC = 0,
+	FP_RED_P192 = 1,
+	FP_RED_P224 = 2,
+	FP_RED_P256 = 3,
+	FP_RED_P384 = 4,
+	FP_RED_P521 = 5,
+} fp_red_type;
 
 /*
  * First, definition of our Fp context, containing all the elements
@@ -53,6 +68,21 @@ typedef struct {
 	/* floor(B^3/(DMSW(p_normalized) + 1)) - B */
 	word_t p_reciprocal;
 
+	/* Fast reduction to use for p, if any */
+	fp_red_type red_type;
+
+	/* Optional addition chains for p - 2 and (p + 1) / 4 */
+	const u8 *inv_chain;
+	u16 inv_chain_len;
+	const u8 *sqrt_chain;
+	u16 sqrt_chain_len;
+
+	/* Fixed limb count routines for p, if any (see fp_fixed.h) */
+	const fp_fixed_ops *fixed;
+
+	/* Non zero when 4p < 2^(p.wlen * WORD_BITS), see fp_lazy.h */
+	u8 lazy;
+
 	word_t magic;
 } fp_ctx;
 
@@ -66,13 +96,20 @@ void fp_ctx_init(fp_ctx_t ctx, nn_src_t p, bitcnt_t p_bitlen,
 		 word_t mpinv,
 		 bitcnt_t p_shift, nn_src_t p_normalized, word_t p_reciprocal);
 void fp_ctx_init_from_p(fp_ctx_t ctx, nn_src_t p);
+void fp_ctx_set_chains(fp_ctx_t ctx, const u8 *inv_chain, u16 inv_chain_len,
+		       const u8 *sqrt_chain, u16 sqrt_chain_len);
 
 /*
- * Then the definition of our Fp elements
+ * Then the definition of our Fp elements. Their value, always < p, is
+ * stored on the p.wlen first words of fp_val (least significant word
+ * first), the other ones being zero. Contrary to nn, the storage is
+ * sized to the largest p, which makes the elements (and the points made
+ * of them) about three times smaller. The Fp routines use nn temporaries
+ * where double size values are needed, see fp_get_nn() and fp_set_nn().
  */
 
 typedef struct {
-	nn fp_val;
+	word_t fp_val[FP_MAX_WORD_LEN];
 	fp_ctx_src_t ctx;
 	word_t magic;
 } fp;
@@ -86,11 +123,14 @@ void fp_init(fp_t A, fp_ctx_src_t fpctx);
 void fp_init_from_buf(fp_t A, fp_ctx_src_t fpctx, const u8 *buf, u16 buflen);
 void fp_uninit(fp_t A);
 void fp_set_nn(fp_t out, nn_src_t in);
+void fp_get_nn(nn_t out, fp_src_t in);
 void fp_zero(fp_t out);
 void fp_one(fp_t out);
 int fp_cmp(fp_src_t in1, fp_src_t in2);
 int fp_iszero(fp_src_t in);
+int fp_isone(fp_src_t in);
 void fp_copy(fp_t out, fp_src_t in);
+void fp_cnd_swap(int cnd, fp_t in1, fp_t in2);
 void fp_tabselect(fp_t out, u8 idx, fp_src_t *tab, u8 tabsize);
 int fp_eq_or_opp(fp_src_t in1, fp_src_t in2);
 void fp_import_from_buf(fp_t out_fp, const u8 *buf, u16 buflen);
@@ -14,8 +14,148 @@
  *  See LICENSE file at the root folder of the project.
  */
 #include "fp_add.h"
-#include "../nn/nn_add.h"
+#include "../nn/ll_u256_mont.h"
 
+/*
+ * out = in1 + in2 mod p on the len words of the Fp elements, inputs being
+ * < p. The sum is computed with its carry word, p being subtracted when
+ * the sum is >= p. Done in constant time, and out may alias the inputs.
+ */
+static void _fp_add_words(word_t *out, const word_t *in1, const word_t *in2,
+			  const word_t *p, u8 len)
+{
+	word_t tmp, s, carry, borrow, mask;
+	u8 i;
+
+	carry = WORD(0);
+	borrow = WORD(0);
+	for (i = 0; i < len; i++) {
+		tmp = in1[i] + carry;
+		carry = (tmp < carry);
+		out[i] = tmp + in2[i];
+		carry |= (out[i] < tmp);
+		/* Borrow of the subtraction of p, for the final one */
+		tmp = out[i] - p[i];
+		s = tmp - borrow;
+		borrow = (tmp > out[i]) | (s > tmp);
+	}
+	/* The sum is < p if there is no carry and a borrow */
+	mask = WORD_MASK_IFNOTZERO(carry | (borrow ^ WORD(1)));
+	borrow = WORD(0);
+	for (i = 0; i < len; i++) {
+		tmp = (p[i] & mask) + borrow;
+		borrow = (tmp < borrow);
+		s = out[i] - tmp;
+		borrow |= (s > out[i]);
+		out[i] = s;
+	}
+}
+
+/*
+ * out = in1 - in2 mod p on the len words of the Fp elements, p being
+ * added back when in1 < in2. Done in constant time, and out may alias
+ * the inputs.
+ */
+static void _fp_sub_words(word_t *out, const word_t *in1, const word_t *in2,
+			  const word_t *p, u8 len)
+{
+	word_t tmp, s, carry, borrow, mask;
+	u8 i;
+
+	borrow = WORD(0);
+	for (i = 0; i < len; i++) {
+		tmp = in1[i] - in2[i];
+		s = tmp - borrow;
+		borrow = (tmp > in1[i]) | (s > tmp);
+		out[i] = s;
+	}
+	mask = WORD_MASK_IFNOTZERO(borrow);
+	carry = WORD(0);
+	for (i = 0; i < len; i++) {
+		tmp = out[i] + carry;
+		carry = (tmp < carry);
+		out[i] = tmp + (p[i] & mask);
+		carry |= (out[i] < tmp);
+	}
+}
+
+/*
+ * out = in1 + in2 mod p on the words of the Fp elements of context ctx,
+ * dispatched to the fixed limbs backend, then to the 4-limb low level
+ * kernel, then to the generic routine.
+ */
+static void _fp_add_ctx(word_t *out, const word_t *in1, const word_t *in2,
+			fp_ctx_src_t ctx)
+{
+#ifdef WITH_FIXED_LIMBS
+	if (ctx->fixed != NULL) {
+		ctx->fixed->add(out, in1, in2, ctx->p.val);
+		return;
+	}
+#endif
+#if defined(WITH_LL_U256_MONT) && (WORD_BYTES == 8)
+	if (ctx->p.wlen == LL_U256_MONT_WLEN) {
+		ll_u256_mont_add(out, in1, in2, ctx->p.val);
+		return;
+	}
+#endif
+	_fp_add_words(out, in1, in2, ctx->p.val, ctx->p.wlen);
+}
+
+/* Same as _fp_add_ctx() for out = in1 - in2 mod p */
+static void _fp_sub_ctx(word_t *out, const word_t *in1, const word_t *in2,
+			fp_ctx_src_t ctx)
+{
+#ifdef WITH_FIXED_LIMBS
+	if (ctx->fixed != NULL) {
+		ctx->fixed->sub(out, in1, in2, ctx->p.val);
+		return;
+	}
+#endif
+#if defined(WITH_LL_U256_MONT) && (WORD_BYTES == 8)
+	if (ctx->p.wlen == LL_U256_MONT_WLEN) {
+		ll_u256_mont_sub(out, in1, in2, ctx->p.val);
+		return;
+	}
+#endif
+	_fp_sub_words(out, in1, in2, ctx->p.val, ctx->p.wlen);
+}
+
+/* Unchecked version of fp_add(), see fp_add.h */
+void _fp_add_unchecked(fp_t out, fp_src_t in1, fp_src_t in2)
+{
+	_fp_add_ctx(out->fp_val, in1->fp_val, in2->fp_val, out->ctx);
+}
+
+/* out = 2 * in mod p, unchecked (see fp_add.h) */
+void _fp_dbl_unchecked(fp_t out, fp_src_t in)
+{
+#if defined(WITH_LL_U256_MONT) && (WORD_BYTES == 8)
+	if ((out->ctx->fixed == NULL) &&
+	    (out->ctx->p.wlen == LL_U256_MONT_WLEN)) {
+		ll_u256_mont_dbl(out->fp_val, in->fp_val, out->ctx->p.val);
+		return;
+	}
+#endif
+	_fp_add_ctx(out->fp_val, in->fp_val, in->fp_val, out->ctx);
+}
+
+/* out = 3 * in mod p, unchecked (see fp_add.h) */
+void _fp_tpl_unchecked(fp_t out, fp_src_t in)
+{
+	word_t tmp[FP_MAX_WORD_LEN];
+
+#if defined(WITH_LL_U256_MONT) && (WORD_BYTES == 8)
+	if ((out->ctx->fixed == NULL) &&
+	    (out->ctx->p.wlen == LL_U256_MONT_WLEN)) {
+		ll_u256_mont_tpl(out->fp_val, in->fp_val, out->ctx->p.val);
+		return;
+	}
+#endif
+	/* tmp keeps in when out aliases it */
+	_fp_add_ctx(tmp, in->fp_val, in->fp_val, out->ctx);
+	_fp_add_ctx(out->fp_val, tmp, in->fp_val, out->ctx);
+}
 /* Compute out = in1 + in2 mod p */
 void fp_add(fp_t out, fp_src_t in1, fp_src_t in2)
 {
@@ -24,22 +164,48 @@ void fp_add(fp_t out, fp_src_t in1, fp_src_t in2)
 	fp_check_initialized(in2);
 	MUST_HAVE((&(in1->ctx->p)) == (&(in2->ctx->p)));
 	MUST_HAVE((&(in1->ctx->p)) == (&(out->ctx->p)));
-	SHOULD_HAVE(nn_cmp(&in1->fp_val, &(in1->ctx->p)) < 0);
-	SHOULD_HAVE(nn_cmp(&in2->fp_val, &(in2->ctx->p)) < 0);
-	nn_mod_add(&(out->fp_val), &(in1->fp_val),
-		   &(in2->fp_val), &(in1->ctx->p));
+	_fp_add_unchecked(out, in1, in2);
 }
 
 /* Compute out = in + 1 mod p */
 void fp_inc(fp_t out, fp_src_t in)
 {
+	fp one;
+
 	fp_check_initialized(in);
 	fp_check_initialized(out);
 	MUST_HAVE((&(in->ctx->p)) == (&(out->ctx->p)));
-	SHOULD_HAVE(nn_cmp(&in->fp_val, &(in->ctx->p)) < 0);
-	nn_mod_inc(&(out->fp_val), &(in->fp_val), &(in->ctx->p));
+
+	fp_init(&one, in->ctx);
+	fp_one(&one);
+	fp_add(out, in, &one);
+	fp_uninit(&one);
 }
 
+/* Unchecked version of fp_sub(), see fp_add.h */
+void _fp_sub_unchecked(fp_t out, fp_src_t in1, fp_src_t in2)
+{
+	_fp_sub_ctx(out->fp_val, in1->fp_val, in2->fp_val, out->ctx);
+}
+
+/* Unchecked version of fp_neg(), see fp_add.h */
+void _fp_neg_unchecked(fp_t out, fp_src_t in)
+{
+	word_t zero[FP_MAX_WORD_LEN];
+	u8 i;
+
+#if defined(WITH_LL_U256_MONT) && (WORD_BYTES == 8)
+	if ((out->ctx->fixed == NULL) &&
+	    (out->ctx->p.wlen == LL_U256_MONT_WLEN)) {
+		ll_u256_mont_neg(out->fp_val, in->fp_val, out->ctx->p.val);
+		return;
+	}
+#endif
+	for (i = 0; i < out->ctx->p.wlen; i++) {
+		zero[i] = WORD(0);
+	}
+	_fp_sub_ctx(out->fp_val, zero, in->fp_val, out->ctx);
+}
 /* Compute out = in1 - in2 mod p */
 void fp_sub(fp_t out, fp_src_t in1, fp_src_t in2)
 {
@@ -48,28 +214,29 @@ void fp_sub(fp_t out, fp_src_t in1, fp_src_t in2)
 	fp_check_initialized(in2);
 	MUST_HAVE((&(in1->ctx->p)) == (&(in2->ctx->p)));
 	MUST_HAVE((&(in1->ctx->p)) == (&(out->ctx->p)));
-	SHOULD_HAVE(nn_cmp(&in1->fp_val, &(in1->ctx->p)) < 0);
-	SHOULD_HAVE(nn_cmp(&in2->fp_val, &(in2->ctx->p)) < 0);
-	nn_mod_sub(&(out->fp_val), &(in1->fp_val),
-		   &(in2->fp_val), &(in1->ctx->p));
+	_fp_sub_unchecked(out, in1, in2);
 }
 
 /* Compute out = in - 1 mod p */
 void fp_dec(fp_t out, fp_src_t in)
 {
+	fp one;
+
 	fp_check_initialized(out);
 	fp_check_initialized(in);
 	MUST_HAVE((&(in->ctx->p)) == (&(out->ctx->p)));
-	SHOULD_HAVE(nn_cmp(&in->fp_val, &(in->ctx->p)) < 0);
-	nn_mod_dec(&(out->fp_val), &(in->fp_val), &(in->ctx->p));
+
+	fp_init(&one, in->ctx);
+	fp_one(&one);
+	fp_sub(out, in, &one);
+	fp_uninit(&one);
 }
 
-/* Compute out = -in mod p = (p - in) mod p */
+/* Compute out = -in mod p = (0 - in) mod p */
 void fp_neg(fp_t out, fp_src_t in)
 {
 	fp_check_initialized(in);
 	fp_check_initialized(out);
 	MUST_HAVE((&(in->ctx->p)) == (&(out->ctx->p)));
-	SHOULD_HAVE(nn_cmp(&in->fp_val, &(in->ctx->p)) < 0);
-	nn_sub(&(out->fp_val), &(in->ctx->p), &(in->fp_val));
+	_fp_neg_unchecked(out, in);
 }
@@ -23,4 +23,20 @@ void fp_sub(fp_t out, fp_src_t in1, fp_src_t in2);
 void fp_dec(fp_t out, fp_src_t in);
 void fp_neg(fp_t out, fp_src_t in);
 
+/*
+ * Internal versions of fp_add(), fp_sub() and fp_neg() without the initialization
+ * and context checks, see _fp_mul_redc1_unchecked().
+ */
+void _fp_add_unchecked(fp_t out, fp_src_t in1, fp_src_t in2);
+void _fp_sub_unchecked(fp_t out, fp_src_t in1, fp_src_t in2);
+void _fp_neg_unchecked(fp_t out, fp_src_t in);
+
+/*
+ * out = 2 * in and out = 3 * in mod p, unchecked as well. They use the
+ * dedicated 4-limb kernels of ll_u256_mont.h when available, and are
+ * otherwise computed with one or two additions. out may alias in.
+ */
+void _fp_dbl_unchecked(fp_t out, fp_src_t in);
+void _fp_tpl_unchecked(fp_t out, fp_src_t in);
+
 #endif /* __FP_ADD_H__ */
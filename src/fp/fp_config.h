@@ -22,4 +22,14 @@
 #define FP_MAX_BIT_LEN (NN_MAX_BIT_LEN - 1)
 #endif
 
+/*
+ * Storage size in words of the Fp elements, i.e. the base size from which
+ * NN_MAX_WORD_LEN is derived (see nn_config.h). The room kept by nn for
+ * double size products and divisions is only needed by the temporaries
+ * of some Fp routines, not by the elements themselves.
+ */
+#ifndef FP_MAX_WORD_LEN
+#define FP_MAX_WORD_LEN (NN_MAX_WORD_LEN / 3)
+#endif
+
 #endif /* __FP_CONFIG_H__ */
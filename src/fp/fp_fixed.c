@@ -0,0 +1,275 @@
+/*
+ *  Copyright (C) 2017 - This file is part of libecc project
+ *
+ *  Authors:
+ *      Ryad BENADJILA <ryadbenadjila@gmail.com>
+ *      Arnaud EBALARD <arnaud.ebalard@ssi.gouv.fr>
+ *      Jean-Pierre FLORI <jean-pierre.flori@ssi.gouv.fr>
+ *
+ *  Contributors:
+ *      Nicolas VIVET <nicolas.vivet@ssi.gouv.fr>
+ *      Karim KHALFALLAH <karim.khalfallah@ssi.gouv.fr>
+ *
+ *  This software is licensed under a dual BSD and GPL v2 license.
+ *  See LICENSE file at the root folder of the project.
+ */
+#include "fp_fixed.h"
+#include "../nn/ll_mont_x86_64.h"
+
+#ifdef WITH_FIXED_LIMBS
+
+#define _FP_FIXED_CONCAT(a, b) a##b
+#define FP_FIXED_CONCAT(a, b) _FP_FIXED_CONCAT(a, b)
+#define FP_FIXED_FUNC(name) FP_FIXED_CONCAT(name, FP_FIXED_N)
+
+/*
+ * Instantiate the routines for the limb counts used by the enabled
+ * curves (from 2 to 17 limbs, larger primes using the generic code).
+ */
+#ifdef FP_FIXED_WLEN_2_USED
+#define FP_FIXED_N 2
+#include "fp_fixed_template.h"
+#undef FP_FIXED_N
+#endif
+#ifdef FP_FIXED_WLEN_3_USED
+#define FP_FIXED_N 3
+#include "fp_fixed_template.h"
+#undef FP_FIXED_N
+#endif
+#ifdef FP_FIXED_WLEN_4_USED
+#define FP_FIXED_N 4
+#include "fp_fixed_template.h"
+#undef FP_FIXED_N
+#endif
+#ifdef FP_FIXED_WLEN_5_USED
+#define FP_FIXED_N 5
+#include "fp_fixed_template.h"
+#undef FP_FIXED_N
+#endif
+#ifdef FP_FIXED_WLEN_6_USED
+#define FP_FIXED_N 6
+#include "fp_fixed_template.h"
+#undef FP_FIXED_N
+#endif
+#ifdef FP_FIXED_WLEN_7_USED
+#define FP_FIXED_N 7
+#include "fp_fixed_template.h"
+#undef FP_FIXED_N
+#endif
+#ifdef FP_FIXED_WLEN_8_USED
+#define FP_FIXED_N 8
+#include "fp_fixed_template.h"
+#undef FP_FIXED_N
+#endif
+#ifdef FP_FIXED_WLEN_9_USED
+#define FP_FIXED_N 9
+#include "fp_fixed_template.h"
+#undef FP_FIXED_N
+#endif
+#ifdef FP_FIXED_WLEN_10_USED
+#define FP_FIXED_N 10
+#include "fp_fixed_template.h"
+#undef FP_FIXED_N
+#endif
+#ifdef FP_FIXED_WLEN_11_USED
+#define FP_FIXED_N 11
+#include "fp_fixed_template.h"
+#undef FP_FIXED_N
+#endif
+#ifdef FP_FIXED_WLEN_12_USED
+#define FP_FIXED_N 12
+#include "fp_fixed_template.h"
+#undef FP_FIXED_N
+#endif
+#ifdef FP_FIXED_WLEN_13_USED
+#define FP_FIXED_N 13
+#include "fp_fixed_template.h"
+#undef FP_FIXED_N
+#endif
+#ifdef FP_FIXED_WLEN_14_USED
+#define FP_FIXED_N 14
+#include "fp_fixed_template.h"
+#undef FP_FIXED_N
+#endif
+#ifdef FP_FIXED_WLEN_15_USED
+#define FP_FIXED_N 15
+#include "fp_fixed_template.h"
+#undef FP_FIXED_N
+#endif
+#ifdef FP_FIXED_WLEN_16_USED
+#define FP_FIXED_N 16
+#include "fp_fixed_template.h"
+#undef FP_FIXED_N
+#endif
+#ifdef FP_FIXED_WLEN_17_USED
+#define FP_FIXED_N 17
+#include "fp_fixed_template.h"
+#undef FP_FIXED_N
+#endif
+
+#if defined(WITH_LL_MONT_X86_64) && (WORD_BYTES == 8)
+/*
+ * The same routines with the multiplication and squaring of the x86-64
+ * BMI2/ADX kernels (see ll_mont_x86_64.h), used when the CPU supports
+ * them. Their fully reduced results are also valid lazy ones.
+ */
+#define FP_FIXED_MULX_OPS(n) {			\
+	.mul = ll_mont_mulx_##n,		\
+	.sqr = ll_mont_sqrx_##n,		\
+	.mul_lazy = ll_mont_mulx_##n,		\
+	.sqr_lazy = ll_mont_sqrx_##n,		\
+	.redc = fp_fixed_redc_##n,		\
+	.add = fp_fixed_add_##n,		\
+	.sub = fp_fixed_sub_##n,		\
+	.wlen = n,				\
+}
+#ifdef FP_FIXED_WLEN_4_USED
+static const fp_fixed_ops fp_fixed_ops_mulx_4 = FP_FIXED_MULX_OPS(4);
+#endif
+#ifdef FP_FIXED_WLEN_6_USED
+static const fp_fixed_ops fp_fixed_ops_mulx_6 = FP_FIXED_MULX_OPS(6);
+#endif
+#ifdef FP_FIXED_WLEN_9_USED
+static const fp_fixed_ops fp_fixed_ops_mulx_9 = FP_FIXED_MULX_OPS(9);
+#endif
+
+static const fp_fixed_ops *fp_fixed_get_mulx_ops(u8 wlen)
+{
+	const fp_fixed_ops *ops;
+
+	if (ll_mont_x86_64_get_mul(wlen) == NULL) {
+		return NULL;
+	}
+
+	switch (wlen) {
+#ifdef FP_FIXED_WLEN_4_USED
+	case 4:
+		ops = &fp_fixed_ops_mulx_4;
+		break;
+#endif
+#ifdef FP_FIXED_WLEN_6_USED
+	case 6:
+		ops = &fp_fixed_ops_mulx_6;
+		break;
+#endif
+#ifdef FP_FIXED_WLEN_9_USED
+	case 9:
+		ops = &fp_fixed_ops_mulx_9;
+		break;
+#endif
+	default:
+		ops = NULL;
+		break;
+	}
+
+	return ops;
+}
+#endif
+
+const fp_fixed_ops *fp_fixed_get_ops(u8 wlen)
+{
+	const fp_fixed_ops *ops;
+
+#if defined(WITH_LL_MONT_X86_64) && (WORD_BYTES == 8)
+	ops = fp_fixed_get_mulx_ops(wlen);
+	if (ops != NULL) {
+		return ops;
+	}
+#endif
+
+	switch (wlen) {
+#ifdef FP_FIXED_WLEN_2_USED
+	case 2:
+		ops = &fp_fixed_ops_2;
+		break;
+#endif
+#ifdef FP_FIXED_WLEN_3_USED
+	case 3:
+		ops = &fp_fixed_ops_3;
+		break;
+#endif
+#ifdef FP_FIXED_WLEN_4_USED
+	case 4:
+		ops = &fp_fixed_ops_4;
+		break;
+#endif
+#ifdef FP_FIXED_WLEN_5_USED
+	case 5:
+		ops = &fp_fixed_ops_5;
+		break;
+#endif
+#ifdef FP_FIXED_WLEN_6_USED
+	case 6:
+		ops = &fp_fixed_ops_6;
+		break;
+#endif
+#ifdef FP_FIXED_WLEN_7_USED
+	case 7:
+		ops = &fp_fixed_ops_7;
+		break;
+#endif
+#ifdef FP_FIXED_WLEN_8_USED
+	case 8:
+		ops = &fp_fixed_ops_8;
+		break;
+#endif
+#ifdef FP_FIXED_WLEN_9_USED
+	case 9:
+		ops = &fp_fixed_ops_9;
+		break;
+#endif
+#ifdef FP_FIXED_WLEN_10_USED
+	case 10:
+		ops = &fp_fixed_ops_10;
+		break;
+#endif
+#ifdef FP_FIXED_WLEN_11_USED
+	case 11:
+		ops = &fp_fixed_ops_11;
+		break;
+#endif
+#ifdef FP_FIXED_WLEN_12_USED
+	case 12:
+		ops = &fp_fixed_ops_12;
+		break;
+#endif
+#ifdef FP_FIXED_WLEN_13_USED
+	case 13:
+		ops = &fp_fixed_ops_13;
+		break;
+#endif
+#ifdef FP_FIXED_WLEN_14_USED
+	case 14:
+		ops = &fp_fixed_ops_14;
+		break;
+#endif
+#ifdef FP_FIXED_WLEN_15_USED
+	case 15:
+		ops = &fp_fixed_ops_15;
+		break;
+#endif
+#ifdef FP_FIXED_WLEN_16_USED
+	case 16:
+		ops = &fp_fixed_ops_16;
+		break;
+#endif
+#ifdef FP_FIXED_WLEN_17_USED
+	case 17:
+		ops = &fp_fixed_ops_17;
+		break;
+#endif
+	default:
+		ops = NULL;
+		break;
+	}
+
+	return ops;
+}
+
+#else /* WITH_FIXED_LIMBS */
+
+/*
+ * Dummy definition to avoid the empty translation unit ISO C warning
+ */
+typedef int dummy;
+#endif /* WITH_FIXED_LIMBS */
@@ -0,0 +1,72 @@
+/*
+ *  Copyright (C) 2017 - This file is part of libecc project
+ *
+ *  Authors:
+ *      Ryad BENADJILA <ryadbenadjila@gmail.com>
+ *      Arnaud EBALARD <arnaud.ebalard@ssi.gouv.fr>
+ *      Jean-Pierre FLORI <jean-pierre.flori@ssi.gouv.fr>
+ *
+ *  Contributors:
+ *      Nicolas VIVET <nicolas.vivet@ssi.gouv.fr>
+ *      Karim KHALFALLAH <karim.khalfallah@ssi.gouv.fr>
+ *
+ *  This software is licensed under a dual BSD and GPL v2 license.
+ *  See LICENSE file at the root folder of the project.
+ */
+#ifndef __FP_FIXED_H__
+#define __FP_FIXED_H__
+#include "../nn/nn.h"
+
+/*
+ * Fixed limb count field backend. When the library is compiled with
+ * WITH_FIXED_LIMBS (i.e. LIBECC_WITH_FIXED_LIMBS=1), the Montgomery
+ * multiplication, squaring and reduction, and the modular addition and
+ * subtraction are instantiated for the limb count of each enabled curve
+ * prime (e.g. 4, 6 and 9 limbs for 256, 384 and 521-bit primes with
+ * 64-bit words), with all loop bounds known at compile time. fp_ctx_init()
+ * then selects them for p, and the fp layer dispatches to them instead of
+ * the generic nn routines.
+ *
+ * The curve parameters headers tell which limb counts are used by
+ * defining FP_FIXED_WLEN_<n>_USED. Only 2 to 17 limbs are instantiated
+ * (fp_fixed.c), so with 16-bit words the 384, 512 and 521-bit primes
+ * (24, 32 and 33 limbs) keep the generic routines, their headers not
+ * defining any FP_FIXED_WLEN_<n>_USED.
+ *
+ * With WITH_LL_MONT_X86_64, the multiplication and squaring are the
+ * BMI2/ADX kernels of ll_mont_x86_64.h for 4, 6 and 9 limbs when the CPU
+ * supports them.
+ *
+ * All the routines work on arrays of exactly n words (the length of p),
+ * inputs being < p. The result is fully reduced, and the output may alias
+ * any of the inputs.
+ */
+typedef struct {
+	/* r = a * b * B^(-n) mod p */
+	void (*mul) (word_t *r, const word_t *a, const word_t *b,
+		     const word_t *p, word_t mpinv);
+	/* r = a^2 * B^(-n) mod p */
+	void (*sqr) (word_t *r, const word_t *a, const word_t *p,
+		     word_t mpinv);
+	/* Lazy versions (4p < B^n, inputs and r < 2p), see fp_lazy.h */
+	void (*mul_lazy) (word_t *r, const word_t *a, const word_t *b,
+			  const word_t *p, word_t mpinv);
+	void (*sqr_lazy) (word_t *r, const word_t *a, const word_t *p,
+			  word_t mpinv);
+	/* r = a * B^(-n) mod p */
+	void (*redc) (word_t *r, const word_t *a, const word_t *p,
+		      word_t mpinv);
+	/* r = a + b mod p */
+	void (*add) (word_t *r, const word_t *a, const word_t *b,
+		     const word_t *p);
+	/* r = a - b mod p */
+	void (*sub) (word_t *r, const word_t *a, const word_t *b,
+		     const word_t *p);
+	/* Number of limbs */
+	u8 wlen;
+} fp_fixed_ops;
+
+/* Routines for a prime of wlen words, NULL if not instantiated */
+const fp_fixed_ops *fp_fixed_get_ops(u8 wlen);
+
+#endif /* __FP_FIXED_H__ */
@@ -0,0 +1,301 @@
+/*
+ *  Copyright (C) 2017 - This file is part of libecc project
+ *
+ *  Authors:
+ *      Ryad BENADJILA <ryadbenadjila@gmail.com>
+ *      Arnaud EBALARD <arnaud.ebalard@ssi.gouv.fr>
+ *      Jean-Pierre FLORI <jean-pierre.flori@ssi.gouv.fr>
+ *
+ *  Contributors:
+ *      Nicolas VIVET <nicolas.vivet@ssi.gouv.fr>
+ *      Karim KHALFALLAH <karim.khalfallah@ssi.gouv.fr>
+ *
+ *  This software is licensed under a dual BSD and GPL v2 license.
+ *  See LICENSE file at the root folder of the project.
+ */
+
+/*
+ * Fixed limb count field routines, instantiated by fp_fixed.c for each
+ * limb count FP_FIXED_N it defines before including this file (hence
+ * no include guard). All the loops are bounded by FP_FIXED_N, so that
+ * the compiler can fully unroll them and keep the accumulators in
+ * registers. Everything is constant time.
+ */
+#ifndef FP_FIXED_N
+#error "FP_FIXED_N must be defined before including fp_fixed_template.h"
+#endif
+
+/*
+ * r = x + hi * B^n - p if this is >= 0, x otherwise. (hi, x) < 2p is
+ * expected, hi being 0 or 1.
+ */
+static void FP_FIXED_FUNC(_fp_fixed_final_sub_) (word_t *r, const word_t *x,
+						 word_t hi, const word_t *p)
+{
+	word_t s[FP_FIXED_N];
+	word_t borrow, tmp, mask;
+	unsigned int j;
+
+	borrow = 0;
+	for (j = 0; j < FP_FIXED_N; j++) {
+		tmp = x[j] - p[j];
+		s[j] = tmp - borrow;
+		borrow = (tmp > x[j]) | (s[j] > tmp);
+	}
+	/* Keep x when it is < p, i.e. no carry word and a borrow */
+	mask = WORD_MASK_IFNOTZERO(borrow & (hi ^ 1));
+	for (j = 0; j < FP_FIXED_N; j++) {
+		r[j] = (x[j] & mask) | (s[j] & ~mask);
+	}
+}
+
+/*
+ * Montgomery reduction rounds on the double size t: n rounds each adding
+ * m * p at word i so that it vanishes, the carry of the round being
+ * added at word i + n along with the one (top) left there by the
+ * previous round. t being < p * B^n, the upper half of t plus the
+ * returned carry word is t * B^(-n) mod p + (0 or p).
+ */
+static word_t FP_FIXED_FUNC(_fp_fixed_rounds_) (word_t *t, const word_t *p,
+						word_t mpinv)
+{
+	word_t prod_high, prod_low, carry, top, c, m;
+	unsigned int i, j;
+
+	top = 0;
+	for (i = 0; i < FP_FIXED_N; i++) {
+		m = t[i] * mpinv;
+		carry = 0;
+		for (j = 0; j < FP_FIXED_N; j++) {
+			WORD_MUL(prod_high, prod_low, m, p[j]);
+			prod_low += carry;
+			prod_high += (prod_low < carry);
+			t[i + j] += prod_low;
+			carry = prod_high + (t[i + j] < prod_low);
+		}
+		t[i + FP_FIXED_N] += carry;
+		c = (t[i + FP_FIXED_N] < carry);
+		t[i + FP_FIXED_N] += top;
+		top = c + (t[i + FP_FIXED_N] < top);
+	}
+
+	return top;
+}
+
+/* Montgomery reduction r = t * B^(-n) mod p of the double size t */
+static void FP_FIXED_FUNC(_fp_fixed_reduce_) (word_t *r, word_t *t,
+					      const word_t *p, word_t mpinv)
+{
+	word_t top;
+
+	top = FP_FIXED_FUNC(_fp_fixed_rounds_) (t, p, mpinv);
+	FP_FIXED_FUNC(_fp_fixed_final_sub_) (r, &t[FP_FIXED_N], top, p);
+}
+
+/*
+ * Montgomery multiplication (CIOS), see _nn_mul_redc1_words(): the
+ * result before the final subtraction is left in t[0..n] (t[n] being
+ * 0 or 1).
+ */
+static void FP_FIXED_FUNC(_fp_fixed_mul_core_) (word_t *t, const word_t *a,
+						const word_t *b,
+						const word_t *p, word_t mpinv)
+{
+	word_t prod_high, prod_low, carry, m;
+	unsigned int i, j;
+
+	for (j = 0; j < (FP_FIXED_N + 2); j++) {
+		t[j] = 0;
+	}
+	for (i = 0; i < FP_FIXED_N; i++) {
+		/* t += a * b[i] */
+		carry = 0;
+		for (j = 0; j < FP_FIXED_N; j++) {
+			WORD_MUL(prod_high, prod_low, a[j], b[i]);
+			prod_low += carry;
+			prod_high += (prod_low < carry);
+			t[j] += prod_low;
+			carry = prod_high + (t[j] < prod_low);
+		}
+		t[FP_FIXED_N] += carry;
+		t[FP_FIXED_N + 1] = (t[FP_FIXED_N] < carry);
+
+		/* t = (t + m * p) / B */
+		m = t[0] * mpinv;
+		WORD_MUL(prod_high, prod_low, m, p[0]);
+		prod_low += t[0];
+		carry = prod_high + (prod_low < t[0]);
+		for (j = 1; j < FP_FIXED_N; j++) {
+			WORD_MUL(prod_high, prod_low, m, p[j]);
+			prod_low += carry;
+			prod_high += (prod_low < carry);
+			t[j - 1] = t[j] + prod_low;
+			carry = prod_high + (t[j - 1] < prod_low);
+		}
+		t[FP_FIXED_N - 1] = t[FP_FIXED_N] + carry;
+		t[FP_FIXED_N] = t[FP_FIXED_N + 1] + (t[FP_FIXED_N - 1] < carry);
+	}
+}
+
+static void FP_FIXED_FUNC(fp_fixed_mul_) (word_t *r, const word_t *a,
+					  const word_t *b, const word_t *p,
+					  word_t mpinv)
+{
+	word_t t[FP_FIXED_N + 2];
+
+	FP_FIXED_FUNC(_fp_fixed_mul_core_) (t, a, b, p, mpinv);
+	FP_FIXED_FUNC(_fp_fixed_final_sub_) (r, t, t[FP_FIXED_N], p);
+}
+
+/*
+ * Lazy Montgomery multiplication, see nn_mul_redc1_words_lazy(): for
+ * 4p < B^n, inputs < 2p give a result < 2p without final subtraction.
+ */
+static void FP_FIXED_FUNC(fp_fixed_mul_lazy_) (word_t *r, const word_t *a,
+					       const word_t *b,
+					       const word_t *p, word_t mpinv)
+{
+	word_t t[FP_FIXED_N + 2];
+	unsigned int j;
+
+	FP_FIXED_FUNC(_fp_fixed_mul_core_) (t, a, b, p, mpinv);
+	for (j = 0; j < FP_FIXED_N; j++) {
+		r[j] = t[j];
+	}
+}
+
+/*
+ * Montgomery squaring (SOS), see _nn_sqr_redc1_words(): the double size
+ * square is left in t.
+ */
+static void FP_FIXED_FUNC(_fp_fixed_sqr_core_) (word_t *t, const word_t *a)
+{
+	word_t prod_high, prod_low, carry, msb;
+	unsigned int i, j;
+
+	/* Cross products a[i] * a[j], i < j */
+	for (j = 0; j < (2 * FP_FIXED_N); j++) {
+		t[j] = 0;
+	}
+	for (i = 0; i < FP_FIXED_N; i++) {
+		carry = 0;
+		for (j = i + 1; j < FP_FIXED_N; j++) {
+			WORD_MUL(prod_high, prod_low, a[i], a[j]);
+			prod_low += carry;
+			prod_high += (prod_low < carry);
+			t[i + j] += prod_low;
+			carry = prod_high + (t[i + j] < prod_low);
+		}
+		t[i + FP_FIXED_N] = carry;
+	}
+
+	/* Doubled, plus the diagonal products */
+	carry = 0;
+	for (j = 0; j < (2 * FP_FIXED_N); j++) {
+		msb = t[j] >> (WORD_BITS - 1);
+		t[j] = (word_t)((t[j] << 1) | carry);
+		carry = msb;
+	}
+	carry = 0;
+	for (i = 0; i < FP_FIXED_N; i++) {
+		WORD_MUL(prod_high, prod_low, a[i], a[i]);
+		prod_low += carry;
+		prod_high += (prod_low < carry);
+		t[2 * i] += prod_low;
+		prod_high += (t[2 * i] < prod_low);
+		t[(2 * i) + 1] += prod_high;
+		carry = (t[(2 * i) + 1] < prod_high);
+	}
+}
+
+static void FP_FIXED_FUNC(fp_fixed_sqr_) (word_t *r, const word_t *a,
+					  const word_t *p, word_t mpinv)
+{
+	word_t t[2 * FP_FIXED_N];
+
+	FP_FIXED_FUNC(_fp_fixed_sqr_core_) (t, a);
+	FP_FIXED_FUNC(_fp_fixed_reduce_) (r, t, p, mpinv);
+}
+
+/* Lazy Montgomery squaring, see fp_fixed_mul_lazy_() */
+static void FP_FIXED_FUNC(fp_fixed_sqr_lazy_) (word_t *r, const word_t *a,
+					       const word_t *p, word_t mpinv)
+{
+	word_t t[2 * FP_FIXED_N];
+	unsigned int j;
+
+	FP_FIXED_FUNC(_fp_fixed_sqr_core_) (t, a);
+	(void)FP_FIXED_FUNC(_fp_fixed_rounds_) (t, p, mpinv);
+	for (j = 0; j < FP_FIXED_N; j++) {
+		r[j] = t[j + FP_FIXED_N];
+	}
+}
+
+/* Montgomery reduction */
+static void FP_FIXED_FUNC(fp_fixed_redc_) (word_t *r, const word_t *a,
+					   const word_t *p, word_t mpinv)
+{
+	word_t t[2 * FP_FIXED_N];
+	unsigned int j;
+
+	for (j = 0; j < FP_FIXED_N; j++) {
+		t[j] = a[j];
+		t[j + FP_FIXED_N] = 0;
+	}
+
+	FP_FIXED_FUNC(_fp_fixed_reduce_) (r, t, p, mpinv);
+}
+
+/* r = a + b mod p */
+static void FP_FIXED_FUNC(fp_fixed_add_) (word_t *r, const word_t *a,
+					  const word_t *b, const word_t *p)
+{
+	word_t t[FP_FIXED_N];
+	word_t carry, tmp;
+	unsigned int j;
+
+	carry = 0;
+	for (j = 0; j < FP_FIXED_N; j++) {
+		tmp = a[j] + carry;
+		carry = (tmp < carry);
+		t[j] = tmp + b[j];
+		carry |= (t[j] < tmp);
+	}
+
+	FP_FIXED_FUNC(_fp_fixed_final_sub_) (r, t, carry, p);
+}
+
+/* r = a - b mod p, p being added back when a < b */
+static void FP_FIXED_FUNC(fp_fixed_sub_) (word_t *r, const word_t *a,
+					  const word_t *b, const word_t *p)
+{
+	word_t t[FP_FIXED_N];
+	word_t borrow, carry, tmp, mask;
+	unsigned int j;
+
+	borrow = 0;
+	for (j = 0; j < FP_FIXED_N; j++) {
+		tmp = a[j] - b[j];
+		t[j] = tmp - borrow;
+		borrow = (tmp > a[j]) | (t[j] > tmp);
+	}
+	mask = WORD_MASK_IFNOTZERO(borrow);
+	carry = 0;
+	for (j = 0; j < FP_FIXED_N; j++) {
+		tmp = t[j] + carry;
+		carry = (tmp < carry);
+		r[j] = tmp + (p[j] & mask);
+		carry |= (r[j] < tmp);
+	}
+}
+
+static const fp_fixed_ops FP_FIXED_FUNC(fp_fixed_ops_) = {
+	.mul = FP_FIXED_FUNC(fp_fixed_mul_),
+	.sqr = FP_FIXED_FUNC(fp_fixed_sqr_),
+	.mul_lazy = FP_FIXED_FUNC(fp_fixed_mul_lazy_),
+	.sqr_lazy = FP_FIXED_FUNC(fp_fixed_sqr_lazy_),
+	.redc = FP_FIXED_FUNC(fp_fixed_redc_),
+	.add = FP_FIXED_FUNC(fp_fixed_add_),
+	.sub = FP_FIXED_FUNC(fp_fixed_sub_),
+	.wlen = FP_FIXED_N,
+};
@@ -0,0 +1,186 @@
+/*
+ *  Copyright (C) 2017 - This file is part of libecc project
+ *
+ *  Authors:
+ *      Ryad BENADJILA <ryadbenadjila@gmail.com>
+ *      Arnaud EBALARD <arnaud.ebalard@ssi.gouv.fr>
+ *      Jean-Pierre FLORI <jean-pierre.flori@ssi.gouv.fr>
+ *
+ *  Contributors:
+ *      Nicolas VIVET <nicolas.vivet@ssi.gouv.fr>
+ *      Karim KHALFALLAH <karim.khalfallah@ssi.gouv.fr>
+ *
+ *  This software is licensed under a dual BSD and GPL v2 license.
+ *  See LICENSE file at the root folder of the project.
+ */
+#include "fp_lazy.h"
+#include "fp_add.h"
+#include "fp_mul_redc1.h"
+
+/* Word i of 2p, computed on the fly (2p fits in p.wlen words) */
+#define FP_LAZY_P2_WORD(p, i) \
+	((word_t)(((p)[(i)] << 1) | \
+		  (((i) > 0) ? ((p)[(i) - 1] >> (WORD_BITS - 1)) : WORD(0))))
+
+void _fp_mul_redc1_lazy(fp_t out, fp_src_t in1, fp_src_t in2)
+{
+	if (!out->ctx->lazy) {
+		_fp_mul_redc1_unchecked(out, in1, in2);
+		return;
+	}
+#ifdef WITH_FIXED_LIMBS
+	if (out->ctx->fixed != NULL) {
+		out->ctx->fixed->mul_lazy(out->fp_val, in1->fp_val,
+					  in2->fp_val, out->ctx->p.val,
+					  out->ctx->mpinv);
+		return;
+	}
+#endif
+	nn_mul_redc1_words_lazy(out->fp_val, in1->fp_val, in2->fp_val,
+				out->ctx->p.val, out->ctx->p.wlen,
+				out->ctx->mpinv);
+}
+
+void _fp_sqr_redc1_lazy(fp_t out, fp_src_t in)
+{
+	if (!out->ctx->lazy) {
+		_fp_sqr_redc1_unchecked(out, in);
+		return;
+	}
+#ifdef WITH_FIXED_LIMBS
+	if (out->ctx->fixed != NULL) {
+		out->ctx->fixed->sqr_lazy(out->fp_val, in->fp_val,
+					  out->ctx->p.val, out->ctx->mpinv);
+		return;
+	}
+#endif
+	nn_sqr_redc1_words_lazy(out->fp_val, in->fp_val, out->ctx->p.val,
+				out->ctx->p.wlen, out->ctx->mpinv);
+}
+
+/*
+ * out = in1 + in2, minus 2p if this is >= 2p, on the words of p. The
+ * inputs being < 2p, the sum is < 4p and fits in the words of p, and out
+ * is < 2p. Done in constant time.
+ */
+static void _fp_add_lazy_words(word_t *out, const word_t *in1,
+			       const word_t *in2, fp_ctx_src_t ctx)
+{
+	const word_t *p = ctx->p.val;
+	u8 len = ctx->p.wlen;
+	word_t tmp, s, carry, borrow, mask;
+	u8 i;
+
+	carry = WORD(0);
+	borrow = WORD(0);
+	for (i = 0; i < len; i++) {
+		tmp = in1[i] + carry;
+		carry = (tmp < carry);
+		out[i] = tmp + in2[i];
+		carry |= (out[i] < tmp);
+		/* Borrow of the subtraction of 2p */
+		tmp = out[i] - FP_LAZY_P2_WORD(p, i);
+		s = tmp - borrow;
+		borrow = (tmp > out[i]) | (s > tmp);
+	}
+	/* Subtract 2p when there is no borrow, i.e. the sum is >= 2p */
+	mask = WORD_MASK_IFNOTZERO(borrow ^ WORD(1));
+	borrow = WORD(0);
+	for (i = 0; i < len; i++) {
+		tmp = (FP_LAZY_P2_WORD(p, i) & mask) + borrow;
+		borrow = (tmp < borrow);
+		s = out[i] - tmp;
+		borrow |= (s > out[i]);
+		out[i] = s;
+	}
+}
+
+void _fp_add_lazy(fp_t out, fp_src_t in1, fp_src_t in2)
+{
+	if (!out->ctx->lazy) {
+		_fp_add_unchecked(out, in1, in2);
+		return;
+	}
+	_fp_add_lazy_words(out->fp_val, in1->fp_val, in2->fp_val, out->ctx);
+}
+
+void _fp_dbl_lazy(fp_t out, fp_src_t in)
+{
+	if (!out->ctx->lazy) {
+		_fp_dbl_unchecked(out, in);
+		return;
+	}
+	_fp_add_lazy_words(out->fp_val, in->fp_val, in->fp_val, out->ctx);
+}
+
+void _fp_tpl_lazy(fp_t out, fp_src_t in)
+{
+	word_t tmp[FP_MAX_WORD_LEN];
+
+	if (!out->ctx->lazy) {
+		_fp_tpl_unchecked(out, in);
+		return;
+	}
+	/* tmp keeps in when out aliases it */
+	_fp_add_lazy_words(tmp, in->fp_val, in->fp_val, out->ctx);
+	_fp_add_lazy_words(out->fp_val, tmp, in->fp_val, out->ctx);
+}
+
+/*
+ * out = in1 - in2, plus 2p if this is negative. The inputs being < 2p,
+ * out is < 2p. Done in constant time.
+ */
+void _fp_sub_lazy(fp_t out, fp_src_t in1, fp_src_t in2)
+{
+	const word_t *p = out->ctx->p.val;
+	u8 len = out->ctx->p.wlen;
+	word_t tmp, s, carry, borrow, mask;
+	u8 i;
+
+	if (!out->ctx->lazy) {
+		_fp_sub_unchecked(out, in1, in2);
+		return;
+	}
+
+	borrow = WORD(0);
+	for (i = 0; i < len; i++) {
+		tmp = in1->fp_val[i] - in2->fp_val[i];
+		s = tmp - borrow;
+		borrow = (tmp > in1->fp_val[i]) | (s > tmp);
+		out->fp_val[i] = s;
+	}
+	mask = WORD_MASK_IFNOTZERO(borrow);
+	carry = WORD(0);
+	for (i = 0; i < len; i++) {
+		tmp = out->fp_val[i] + carry;
+		carry = (tmp < carry);
+		out->fp_val[i] = tmp + (FP_LAZY_P2_WORD(p, i) & mask);
+		carry |= (out->fp_val[i] < tmp);
+	}
+}
+
+/* out = in mod p for in < 2p, in constant time */
+void _fp_reduce_lazy(fp_t out, fp_src_t in)
+{
+	const word_t *p = out->ctx->p.val;
+	u8 len = out->ctx->p.wlen;
+	word_t tmp, s, borrow, mask;
+	u8 i;
+
+	borrow = WORD(0);
+	for (i = 0; i < len; i++) {
+		tmp = in->fp_val[i] - p[i];
+		s = tmp - borrow;
+		borrow = (tmp > in->fp_val[i]) | (s > tmp);
+	}
+	/* Subtract p when there is no borrow, i.e. in >= p */
+	mask = WORD_MASK_IFNOTZERO(borrow ^ WORD(1));
+	borrow = WORD(0);
+	for (i = 0; i < len; i++) {
+		tmp = (p[i] & mask) + borrow;
+		borrow = (tmp < borrow);
+		s = in->fp_val[i] - tmp;
+		borrow |= (s > in->fp_val[i]);
+		out->fp_val[i] = s;
+	}
+}
@@ -0,0 +1,46 @@
+/*
+ *  Copyright (C) 2017 - This file is part of libecc project
+ *
+ *  Authors:
+ *      Ryad BENADJILA <ryadbenadjila@gmail.com>
+ *      Arnaud EBALARD <arnaud.ebalard@ssi.gouv.fr>
+ *      Jean-Pierre FLORI <jean-pierre.flori@ssi.gouv.fr>
+ *
+ *  Contributors:
+ *      Nicolas VIVET <nicolas.vivet@ssi.gouv.fr>
+ *      Karim KHALFALLAH <karim.khalfallah@ssi.gouv.fr>
+ *
+ *  This software is licensed under a dual BSD and GPL v2 license.
+ *  See LICENSE file at the root folder of the project.
+ */
+#ifndef __FP_LAZY_H__
+#define __FP_LAZY_H__
+#include "fp.h"
+
+/*
+ * Lazy reduction. When p has at least two spare bits in its top word
+ * (i.e. 4p < 2^(p.wlen * WORD_BITS), ctx->lazy being set, e.g. for
+ * SECP224R1 or SECP521R1 with 64-bit words), Fp elements can be kept in
+ * the redundant range [0, 2p) instead of [0, p) along a sequence of
+ * operations: the Montgomery multiplication and squaring then skip their
+ * final conditional subtraction, and the addition and subtraction only
+ * reduce their result to [0, 2p). _fp_reduce_lazy() brings an element
+ * back to [0, p), which is needed before any comparison or test, and
+ * before handing it to the other Fp routines.
+ *
+ * When ctx->lazy is not set, these routines are the fully reducing
+ * _fp_*_unchecked() ones (elements of [0, p) being valid redundant ones),
+ * so that code using them is correct for any p.
+ *
+ * Like the _fp_*_unchecked() routines, they are meant for the point
+ * formulas and do not check their arguments. Aliasing is supported.
+ */
+void _fp_mul_redc1_lazy(fp_t out, fp_src_t in1, fp_src_t in2);
+void _fp_sqr_redc1_lazy(fp_t out, fp_src_t in);
+void _fp_add_lazy(fp_t out, fp_src_t in1, fp_src_t in2);
+void _fp_sub_lazy(fp_t out, fp_src_t in1, fp_src_t in2);
+void _fp_dbl_lazy(fp_t out, fp_src_t in);
+void _fp_tpl_lazy(fp_t out, fp_src_t in);
+void _fp_reduce_lazy(fp_t out, fp_src_t in);
+
+#endif /* __FP_LAZY_H__ */
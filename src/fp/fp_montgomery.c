@@ -29,6 +29,29 @@ void fp_sub_monty(fp_t out, fp_src_t in1, fp_src_t in2)
 	fp_sub(out, in1, in2);
 }
 
+/* out = 2 * in, see _fp_dbl_unchecked() */
+void fp_dbl_monty(fp_t out, fp_src_t in)
+{
+	fp_check_initialized(in);
+	fp_check_initialized(out);
+	MUST_HAVE((&(in->ctx->p)) == (&(out->ctx->p)));
+	_fp_dbl_unchecked(out, in);
+}
+
+/* out = 3 * in, see _fp_tpl_unchecked() */
+void fp_tpl_monty(fp_t out, fp_src_t in)
+{
+	fp_check_initialized(in);
+	fp_check_initialized(out);
+	MUST_HAVE((&(in->ctx->p)) == (&(out->ctx->p)));
+	_fp_tpl_unchecked(out, in);
+}
+
+void fp_neg_monty(fp_t out, fp_src_t in)
+{
+	fp_neg(out, in);
+}
+
 void fp_mul_monty(fp_t out, fp_src_t in1, fp_src_t in2)
 {
 	fp_mul_redc1(out, in1, in2);
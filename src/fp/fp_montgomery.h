@@ -23,6 +23,9 @@
 
 void fp_add_monty(fp_t out, fp_src_t in1, fp_src_t in2);
 void fp_sub_monty(fp_t out, fp_src_t in1, fp_src_t in2);
+void fp_dbl_monty(fp_t out, fp_src_t in);
+void fp_tpl_monty(fp_t out, fp_src_t in);
+void fp_neg_monty(fp_t out, fp_src_t in);
 void fp_mul_monty(fp_t out, fp_src_t in1, fp_src_t in2);
 void fp_sqr_monty(fp_t out, fp_src_t in);
 void fp_div_monty(fp_t out, fp_src_t in1, fp_src_t in2);
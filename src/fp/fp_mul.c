@@ -14,45 +14,85 @@
  *  See LICENSE file at the root folder of the project.
  */
 #include "fp_mul.h"
+#include "fp_solinas.h"
 #include "../nn/nn_mul.h"
 #include "../nn/nn_div.h"
 #include "../nn/nn_modinv.h"
 
+/* Reduce a double size product modulo p into out */
+static void _fp_reduce(fp_t out, nn_src_t prod)
+{
+	nn r;
+
+	nn_init(&r, 0);
+	if (out->ctx->red_type != FP_RED_GENERIC) {
+		/* Special form prime: no division needed */
+		fp_solinas_reduce(&r, prod, out->ctx);
+	} else {
+		nn_mod_unshifted(&r, prod, &(out->ctx->p_normalized),
+				 out->ctx->p_reciprocal, out->ctx->p_shift);
+	}
+	fp_set_nn(out, &r);
+
+	nn_uninit(&r);
+}
+
 void fp_mul(fp_t out, fp_src_t in1, fp_src_t in2)
 {
-	nn prod;
+	nn a, b, prod;
 
 	fp_check_initialized(in1);
 	fp_check_initialized(in2);
 	fp_check_initialized(out);
 
-	nn_init(&prod, 2 * (in1->ctx->p.wlen) * WORD_BYTES);
-
 	MUST_HAVE(out->ctx == in1->ctx);
 	MUST_HAVE(out->ctx == in2->ctx);
 
-	nn_mul(&prod, &(in1->fp_val), &(in2->fp_val));
-	nn_mod_unshifted(&(out->fp_val), &prod, &(in1->ctx->p_normalized),
-			 in1->ctx->p_reciprocal, in1->ctx->p_shift);
+	/* The double size product is computed on nn temporaries */
+	fp_get_nn(&a, in1);
+	fp_get_nn(&b, in2);
+	nn_init(&prod, 2 * (in1->ctx->p.wlen) * WORD_BYTES);
+	nn_mul(&prod, &a, &b);
+	_fp_reduce(out, &prod);
 
+	nn_uninit(&a);
+	nn_uninit(&b);
 	nn_uninit(&prod);
 }
 
 void fp_sqr(fp_t out, fp_src_t in)
 {
-	fp_mul(out, in, in);
+	nn a, sqr;
+
+	fp_check_initialized(in);
+	fp_check_initialized(out);
+
+	MUST_HAVE(out->ctx == in->ctx);
+
+	fp_get_nn(&a, in);
+	nn_sqr(&sqr, &a);
+	_fp_reduce(out, &sqr);
+
+	nn_uninit(&a);
+	nn_uninit(&sqr);
 }
 
 void fp_inv(fp_t out, fp_src_t in)
 {
+	nn a, inv;
 	int ret;
 
 	fp_check_initialized(in);
 	fp_check_initialized(out);
 
 	MUST_HAVE(out->ctx == in->ctx);
-	ret = nn_modinv(&(out->fp_val), &(in->fp_val), &(in->ctx->p));
+	fp_get_nn(&a, in);
+	ret = nn_modinv(&inv, &a, &(in->ctx->p));
 	MUST_HAVE(ret == 1);
+	fp_set_nn(out, &inv);
+
+	nn_uninit(&a);
+	nn_uninit(&inv);
 }
 
 void fp_div(fp_t out, fp_src_t num, fp_src_t den)
@@ -73,3 +113,121 @@ void fp_div(fp_t out, fp_src_t num, fp_src_t den)
 
 	fp_uninit(&inv);
 }
+
+/*
+ * Return a mask with all bits set if in is zero, 0 otherwise. Done in
+ * constant time.
+ */
+static word_t _fp_zero_mask(fp_src_t in)
+{
+	word_t acc = WORD(0);
+	u8 i;
+
+	for (i = 0; i < in->ctx->p.wlen; i++) {
+		acc |= in->fp_val[i];
+	}
+
+	return WORD_MASK_IFZERO(acc);
+}
+
+/*
+ * out = in, or one if in is zero and zero_ok is set. Done in constant
+ * time, out having the length of p. The zero mask of in is returned.
+ */
+static word_t _fp_batch_inv_get(fp_t out, fp_src_t in, int zero_ok)
+{
+	word_t mask = zero_ok ? _fp_zero_mask(in) : WORD(0);
+
+	fp_copy(out, in);
+	out->fp_val[0] |= (WORD(1) & mask);
+
+	return mask;
+}
+
+/*
+ * Montgomery's trick: the n inverses are computed with one inversion
+ * and 3(n-1) multiplications. The prefix products are stored in out,
+ * hence no out[i] can alias an in[j].
+ */
+static int _fp_batch_inv(fp_t *out, fp_src_t *in, size_t n, int zero_ok)
+{
+	fp_ctx_src_t ctx;
+	fp inv, tmp;
+	word_t mask, zeros = WORD(0);
+	size_t i;
+	u8 j;
+
+	MUST_HAVE((out != NULL) && (in != NULL));
+	if (n == 0) {
+		return 1;
+	}
+	ctx = in[0]->ctx;
+	for (i = 0; i < n; i++) {
+		fp_check_initialized(in[i]);
+		fp_check_initialized(out[i]);
+		MUST_HAVE((in[i]->ctx == ctx) && (out[i]->ctx == ctx));
+		MUST_HAVE((fp_src_t)out[i] != in[i]);
+	}
+
+	fp_init(&inv, ctx);
+	fp_init(&tmp, ctx);
+
+	/* out[i] = in[0] * ... * in[i] */
+	_fp_batch_inv_get(out[0], in[0], zero_ok);
+	for (i = 1; i < n; i++) {
+		_fp_batch_inv_get(&tmp, in[i], zero_ok);
+		fp_mul(out[i], out[i - 1], &tmp);
+	}
+
+	/* inv = (in[0] * ... * in[n - 1])^-1 */
+	fp_inv(&inv, out[n - 1]);
+
+	/*
+	 * Going backward, inv = (in[0] * ... * in[i])^-1 hence
+	 * in[i]^-1 = out[i - 1] * inv
+	 */
+	for (i = n - 1; i > 0; i--) {
+		_fp_batch_inv_get(&tmp, in[i], zero_ok);
+		fp_mul(out[i], out[i - 1], &inv);
+		fp_mul(&inv, &inv, &tmp);
+	}
+	fp_copy(out[0], &inv);
+
+	/* Zero inputs get a zero "inverse" */
+	if (zero_ok) {
+		for (i = 0; i < n; i++) {
+			mask = _fp_zero_mask(in[i]);
+			zeros |= mask;
+			for (j = 0; j < ctx->p.wlen; j++) {
+				out[i]->fp_val[j] &= ~mask;
+			}
+		}
+	}
+
+	fp_uninit(&inv);
+	fp_uninit(&tmp);
+
+	return (zeros == WORD(0));
+}
+
+/*
+ * Batch inversion: out[i] = in[i]^-1 for 0 <= i < n, for the cost of one
+ * inversion and 3(n-1) multiplications. All the inputs must be non zero
+ * and share the same context. out elements are expected to be
+ * initialized, and no out[i] can alias an in[j].
+ */
+void fp_batch_inv(fp_t *out, fp_src_t *in, size_t n)
+{
+	_fp_batch_inv(out, in, n, 0);
+}
+
+/*
+ * Same as fp_batch_inv() but zero inputs are allowed: they get a zero
+ * output without leaking which inputs were zero, the computation being
+ * the same whatever the values of the inputs. Returns 1 if all the
+ * inputs were invertible, 0 otherwise.
+ */
+int fp_batch_inv_ct(fp_t *out, fp_src_t *in, size_t n)
+{
+	return _fp_batch_inv(out, in, n, 1);
+}
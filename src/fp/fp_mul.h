@@ -20,6 +20,8 @@
 void fp_mul(fp_t out, fp_src_t in1, fp_src_t in2);
 void fp_sqr(fp_t out, fp_src_t in);
 void fp_inv(fp_t out, fp_src_t in);
+void fp_batch_inv(fp_t *out, fp_src_t *in, size_t n);
+int fp_batch_inv_ct(fp_t *out, fp_src_t *in, size_t n);
 void fp_div(fp_t out, fp_src_t num, fp_src_t den);
 
 #endif /* __FP_MUL_H__ */
@@ -16,12 +16,33 @@
 #include "fp_mul_redc1.h"
 
 /*
- * Perform Montgomery multiplication.
+ * Unchecked versions of fp_mul_redc1() and fp_sqr_redc1(), see
+ * fp_mul_redc1.h.
  */
-static inline void _fp_mul_redc1(nn_t out, nn_src_t in1, nn_src_t in2,
-				 fp_ctx_src_t ctx)
+void _fp_mul_redc1_unchecked(fp_t out, fp_src_t in1, fp_src_t in2)
 {
-	nn_mul_redc1(out, in1, in2, &(ctx->p), ctx->mpinv);
+#ifdef WITH_FIXED_LIMBS
+	if (out->ctx->fixed != NULL) {
+		out->ctx->fixed->mul(out->fp_val, in1->fp_val, in2->fp_val,
+				     out->ctx->p.val, out->ctx->mpinv);
+		return;
+	}
+#endif
+	nn_mul_redc1_words(out->fp_val, in1->fp_val, in2->fp_val,
+			   out->ctx->p.val, out->ctx->p.wlen, out->ctx->mpinv);
+}
+
+void _fp_sqr_redc1_unchecked(fp_t out, fp_src_t in)
+{
+#ifdef WITH_FIXED_LIMBS
+	if (out->ctx->fixed != NULL) {
+		out->ctx->fixed->sqr(out->fp_val, in->fp_val, out->ctx->p.val,
+				     out->ctx->mpinv);
+		return;
+	}
+#endif
+	nn_sqr_redc1_words(out->fp_val, in->fp_val, out->ctx->p.val,
+			   out->ctx->p.wlen, out->ctx->mpinv);
 }
 
 void fp_mul_redc1(fp_t out, fp_src_t in1, fp_src_t in2)
@@ -33,13 +54,17 @@ void fp_mul_redc1(fp_t out, fp_src_t in1, fp_src_t in2)
 	MUST_HAVE(out->ctx == in1->ctx);
 	MUST_HAVE(out->ctx == in2->ctx);
 
-	_fp_mul_redc1(&(out->fp_val), &(in1->fp_val), &(in2->fp_val),
-		      out->ctx);
+	_fp_mul_redc1_unchecked(out, in1, in2);
 }
 
 void fp_sqr_redc1(fp_t out, fp_src_t in)
 {
-	fp_mul_redc1(out, in, in);
+	fp_check_initialized(in);
+	fp_check_initialized(out);
+
+	MUST_HAVE(out->ctx == in->ctx);
+
+	_fp_sqr_redc1_unchecked(out, in);
 }
 
 /*
@@ -51,21 +76,36 @@ void fp_redcify(fp_t out, fp_src_t in)
 	fp_check_initialized(out);
 
 	MUST_HAVE(out->ctx == in->ctx);
-	_fp_mul_redc1(&(out->fp_val), &(in->fp_val), &(out->ctx->r_square),
-		      out->ctx);
+#ifdef WITH_FIXED_LIMBS
+	if (out->ctx->fixed != NULL) {
+		out->ctx->fixed->mul(out->fp_val, in->fp_val,
+				     out->ctx->r_square.val, out->ctx->p.val,
+				     out->ctx->mpinv);
+		return;
+	}
+#endif
+	nn_mul_redc1_words(out->fp_val, in->fp_val, out->ctx->r_square.val,
+			   out->ctx->p.val, out->ctx->p.wlen, out->ctx->mpinv);
 }
 
+/*
+ * unredcify is a Montgomery multiplication by one, i.e. a mere
+ * Montgomery reduction.
+ */
 void fp_unredcify(fp_t out, fp_src_t in)
 {
-	nn one;
-
 	fp_check_initialized(in);
 	fp_check_initialized(out);
 
-	nn_init(&one, 0);
-	nn_one(&one);
-
-	_fp_mul_redc1(&(out->fp_val), &(in->fp_val), &one, out->ctx);
+	MUST_HAVE(out->ctx == in->ctx);
 
-	nn_uninit(&one);
+#ifdef WITH_FIXED_LIMBS
+	if (out->ctx->fixed != NULL) {
+		out->ctx->fixed->redc(out->fp_val, in->fp_val, out->ctx->p.val,
+				      out->ctx->mpinv);
+		return;
+	}
+#endif
+	nn_redc1_words(out->fp_val, in->fp_val, out->ctx->p.val,
+		       out->ctx->p.wlen, out->ctx->mpinv);
 }
@@ -22,4 +22,15 @@ void fp_sqr_redc1(fp_t out, fp_src_t in);
 void fp_redcify(fp_t out, fp_src_t in);
 void fp_unredcify(fp_t out, fp_src_t in);
 
+/*
+ * Internal versions of fp_mul_redc1() and fp_sqr_redc1() without the
+ * initialization and context checks, for the point arithmetic and the
+ * scalar multiplication loops. The caller must guarantee that all the
+ * elements are initialized with the same context (e.g. they are the
+ * coordinates of checked points of a curve and temporaries initialized
+ * with its context).
+ */
+void _fp_mul_redc1_unchecked(fp_t out, fp_src_t in1, fp_src_t in2);
+void _fp_sqr_redc1_unchecked(fp_t out, fp_src_t in);
+
 #endif /* __FP_MUL_REDC1_H__ */
@@ -14,21 +14,60 @@
  *  See LICENSE file at the root folder of the project.
  */
 #include "../nn/nn_logical.h"
+#include "../nn/nn_add.h"
 #include "fp_mul_redc1.h"
+#include "fp_mul.h"
 #include "fp_pow.h"
 #include "fp.h"
 
 /*
+ * Maximum window widths: the constant time table holds 2^w powers and is
+ * entirely scanned for each window, the sliding window one only holds the
+ * 2^(w - 1) odd powers.
+ */
+#define FP_POW_FIXED_WINDOW_MAX		4
+#define FP_POW_SLIDING_WINDOW_MAX	5
+
+/*
+ * Window width for an exponent of explen bits, balancing the size of the
+ * precomputed table against the number of multiplications in the main
+ * loop (about explen / w).
+ */
+static u8 _fp_pow_window(bitcnt_t explen, u8 wmax)
+{
+	u8 w;
+
+	if (explen <= 8) {
+		w = 1;
+	} else if (explen <= 24) {
+		w = 2;
+	} else if (explen <= 80) {
+		w = 3;
+	} else if (explen <= 240) {
+		w = 4;
+	} else {
+		w = 5;
+	}
+
+	return (w > wmax) ? wmax : w;
+}
+
+/*
+ * Fixed window (k-ary) exponentiation: exp is processed from its most
+ * significant bit in windows of w bits, each costing w squarings and one
+ * multiplication by an entry of the table of base^0 ... base^(2^w - 1),
+ * selected with a full (constant time) scan of the table.
+ *
  * NOT constant time with regard to the bitlength of exp.
  * Aliasing not supported.
  */
-#define TAB_ENTRIES 2
 static void _fp_pow(fp_t out, fp_src_t base, nn_src_t exp)
 {
-	fp base_monty, mul_monty, sqr_monty, out_monty, r;
-	fp_src_t tab_monty[TAB_ENTRIES];
-	bitcnt_t explen;
-	u8 expbit;
+	fp tab[1 << FP_POW_FIXED_WINDOW_MAX];
+	fp_src_t tab_monty[1 << FP_POW_FIXED_WINDOW_MAX];
+	fp mul_monty, out_monty;
+	bitcnt_t explen, pos;
+	u8 w, tabsize, win, i;
 
 	fp_check_initialized(base);
 	nn_check_initialized(exp);
@@ -36,35 +75,132 @@ static void _fp_pow(fp_t out, fp_src_t base, nn_src_t exp)
 
 	MUST_HAVE(!nn_iszero(exp));
 
-	fp_init(&base_monty, out->ctx);
+	explen = nn_bitlen(exp);
+	w = _fp_pow_window(explen, FP_POW_FIXED_WINDOW_MAX);
+	tabsize = (u8)(1 << w);
+
+	/* tab[i] = base^i in Montgomery representation */
+	fp_init(&tab[0], out->ctx);
+	fp_set_nn(&tab[0], &(out->ctx->r));
+	fp_init(&tab[1], out->ctx);
+	fp_redcify(&tab[1], base);
+	for (i = 2; i < tabsize; i++) {
+		fp_init(&tab[i], out->ctx);
+		fp_mul_redc1(&tab[i], &tab[i - 1], &tab[1]);
+	}
+	for (i = 0; i < tabsize; i++) {
+		tab_monty[i] = &tab[i];
+	}
+
 	fp_init(&mul_monty, out->ctx);
-	fp_init(&sqr_monty, out->ctx);
 	fp_init(&out_monty, out->ctx);
-	fp_init(&r, out->ctx);
-	fp_set_nn(&r, &(out->ctx->r));
 
-	explen = nn_bitlen(exp) - 1;
+	/* The top window holds the (explen % w) leftmost bits, if any */
+	pos = (bitcnt_t)(explen - (explen % w));
+	if (pos == explen) {
+		pos = (bitcnt_t)(pos - w);
+	}
+	win = 0;
+	for (i = 0; (bitcnt_t)(pos + i) < explen; i++) {
+		win |= (u8)(nn_getbit(exp, (bitcnt_t)(pos + i)) << i);
+	}
+	fp_tabselect(&out_monty, win, tab_monty, tabsize);
+
+	while (pos > 0) {
+		pos = (bitcnt_t)(pos - w);
+		win = 0;
+		for (i = 0; i < w; i++) {
+			fp_sqr_redc1(&out_monty, &out_monty);
+			win |= (u8)(nn_getbit(exp, (bitcnt_t)(pos + i)) << i);
+		}
+		fp_tabselect(&mul_monty, win, tab_monty, tabsize);
+		fp_mul_redc1(&out_monty, &out_monty, &mul_monty);
+	}
+
+	fp_unredcify(out, &out_monty);
+
+	for (i = 0; i < tabsize; i++) {
+		fp_uninit(&tab[i]);
+	}
+	fp_uninit(&mul_monty);
+	fp_uninit(&out_monty);
+}
+
+/*
+ * Sliding window exponentiation, for public exponents only: exp is
+ * scanned from its most significant bit, zero bits costing one squaring
+ * and windows of at most w bits starting and ending with a one being
+ * handled with one multiplication by an entry of the table of odd powers
+ * base^1, base^3, ... base^(2^w - 1).
+ *
+ * NOT constant time with regard to exp.
+ * Aliasing not supported.
+ */
+static void _fp_pow_vartime(fp_t out, fp_src_t base, nn_src_t exp)
+{
+	fp tab[1 << (FP_POW_SLIDING_WINDOW_MAX - 1)];
+	fp base_sqr, out_monty;
+	bitcnt_t explen, i, j;
+	u8 w, tabsize, k, win;
+	int first = 1;
+
+	fp_check_initialized(base);
+	nn_check_initialized(exp);
+	fp_init(out, base->ctx);
+
+	MUST_HAVE(!nn_iszero(exp));
+
+	explen = nn_bitlen(exp);
+	w = _fp_pow_window(explen, FP_POW_SLIDING_WINDOW_MAX);
+	tabsize = (u8)(1 << (w - 1));
 
-	fp_redcify(&base_monty, base);
-	nn_copy(&(out_monty.fp_val), &(base_monty.fp_val));
+	/* tab[k] = base^(2k + 1) in Montgomery representation */
+	fp_init(&base_sqr, out->ctx);
+	fp_init(&tab[0], out->ctx);
+	fp_redcify(&tab[0], base);
+	fp_sqr_redc1(&base_sqr, &tab[0]);
+	for (k = 1; k < tabsize; k++) {
+		fp_init(&tab[k], out->ctx);
+		fp_mul_redc1(&tab[k], &tab[k - 1], &base_sqr);
+	}
 
-	tab_monty[0] = &r;
-	tab_monty[1] = &base_monty;
+	fp_init(&out_monty, out->ctx);
 
-	while (explen-- > 0) {
-		expbit = nn_getbit(exp, explen);
-		fp_sqr_redc1(&sqr_monty, &out_monty);
-		fp_tabselect(&mul_monty, expbit, tab_monty, TAB_ENTRIES);
-		fp_mul_redc1(&out_monty, &sqr_monty, &mul_monty);
+	i = explen;
+	while (i > 0) {
+		if (!nn_getbit(exp, (bitcnt_t)(i - 1))) {
+			fp_sqr_redc1(&out_monty, &out_monty);
+			i--;
+			continue;
+		}
+		/* Window exp[i - 1 .. j] of at most w bits ending with a one */
+		j = (i > w) ? (bitcnt_t)(i - w) : 0;
+		while (!nn_getbit(exp, j)) {
+			j++;
+		}
+		win = 0;
+		for (k = 0; (bitcnt_t)(j + k) < i; k++) {
+			win |= (u8)(nn_getbit(exp, (bitcnt_t)(j + k)) << k);
+			if (!first) {
+				fp_sqr_redc1(&out_monty, &out_monty);
+			}
+		}
+		if (first) {
+			fp_copy(&out_monty, &tab[win >> 1]);
+			first = 0;
+		} else {
+			fp_mul_redc1(&out_monty, &out_monty, &tab[win >> 1]);
+		}
+		i = j;
 	}
 
 	fp_unredcify(out, &out_monty);
 
-	fp_uninit(&base_monty);
-	fp_uninit(&mul_monty);
-	fp_uninit(&sqr_monty);
+	for (k = 0; k < tabsize; k++) {
+		fp_uninit(&tab[k]);
+	}
+	fp_uninit(&base_sqr);
 	fp_uninit(&out_monty);
-	fp_uninit(&r);
 }
 
 /* Aliased version */
@@ -82,3 +218,147 @@ void fp_pow(fp_t out, fp_src_t base, nn_src_t exp)
 		_fp_pow(out, base, exp);
 	}
 }
+
+/* Aliased version */
+void fp_pow_vartime(fp_t out, fp_src_t base, nn_src_t exp)
+{
+	/* Handle output aliasing */
+	if (out == base) {
+		fp out_cpy;
+
+		_fp_pow_vartime(&out_cpy, base, exp);
+		fp_init(out, out_cpy.ctx);
+		fp_copy(out, &out_cpy);
+		fp_uninit(&out_cpy);
+	} else {
+		_fp_pow_vartime(out, base, exp);
+	}
+}
+
+/*
+ * Run the addition chain (see nn_pow_redc1_chain()) on Fp registers in
+ * the Montgomery representation, i.e. on the compact Fp storage and with
+ * the Fp Montgomery routines. Aliasing is supported.
+ */
+static void _fp_pow_redc1_chain(fp_t out, fp_src_t in, const u8 *chain,
+				u16 chain_len)
+{
+	fp t[NN_CHAIN_MAX_REGS];
+	u8 dst = 0, src, nsqr, mul, j;
+	u16 i;
+
+	MUST_HAVE((chain != NULL) && (chain_len > 0) && ((chain_len % 3) == 0));
+
+	for (j = 0; j < NN_CHAIN_MAX_REGS; j++) {
+		fp_init(&t[j], in->ctx);
+	}
+	fp_copy(&t[0], in);
+
+	for (i = 0; i < chain_len; i += 3) {
+		dst = (u8)(chain[i] >> 4);
+		src = (u8)(chain[i] & 0xf);
+		nsqr = chain[i + 1];
+		mul = chain[i + 2];
+		MUST_HAVE((mul == NN_CHAIN_NO_MUL) || (mul < NN_CHAIN_MAX_REGS));
+
+		if (dst != src) {
+			fp_copy(&t[dst], &t[src]);
+		}
+		for (j = 0; j < nsqr; j++) {
+			fp_sqr_redc1(&t[dst], &t[dst]);
+		}
+		if (mul != NN_CHAIN_NO_MUL) {
+			fp_mul_redc1(&t[dst], &t[dst], &t[mul]);
+		}
+	}
+	fp_copy(out, &t[dst]);
+
+	for (j = 0; j < NN_CHAIN_MAX_REGS; j++) {
+		fp_uninit(&t[j]);
+	}
+}
+
+/*
+ * Compute out = in^e where e is p - 2 or, when is_sqrt is set,
+ * (p + 1) / 4, with the given addition chain for e when not NULL and
+ * fp_pow() otherwise. Constant time in both cases. Aliasing is
+ * supported.
+ */
+static void _fp_pow_fixed(fp_t out, fp_src_t in, const u8 *chain,
+			  u16 chain_len, int is_sqrt)
+{
+	fp_ctx_src_t ctx = in->ctx;
+	fp tmp;
+	nn e;
+
+	fp_init(&tmp, ctx);
+	if (chain != NULL) {
+		fp_redcify(&tmp, in);
+		_fp_pow_redc1_chain(&tmp, &tmp, chain, chain_len);
+		fp_unredcify(out, &tmp);
+	} else {
+		nn_init(&e, 0);
+		if (is_sqrt) {
+			/* (p + 1) / 4 */
+			nn_inc(&e, &(ctx->p));
+			nn_rshift(&e, &e, 2);
+		} else {
+			/* p - 2 */
+			nn_dec(&e, &(ctx->p));
+			nn_dec(&e, &e);
+		}
+		fp_copy(&tmp, in);
+		fp_pow(out, &tmp, &e);
+		nn_uninit(&e);
+	}
+	fp_uninit(&tmp);
+}
+
+/*
+ * Compute out = in^-1 as in^(p - 2), in constant time, using the addition
+ * chain for p - 2 attached to the context (see fp_ctx_set_chains()) when
+ * there is one. in = 0 gives out = 0. Aliasing is supported.
+ */
+void fp_inv_fixed(fp_t out, fp_src_t in)
+{
+	fp_check_initialized(in);
+	fp_check_initialized(out);
+	MUST_HAVE(out->ctx == in->ctx);
+
+	_fp_pow_fixed(out, in, in->ctx->inv_chain, in->ctx->inv_chain_len, 0);
+}
+
+/*
+ * Compute a square root of in as in^((p + 1) / 4), which requires
+ * p = 3 mod 4, in constant time, using the addition chain attached to the
+ * context when there is one. Aliasing is supported.
+ *
+ * Return 0 if in is a square (out being then one of its square roots),
+ * -1 if in is not a square or p != 3 mod 4.
+ */
+int fp_sqrt_fixed(fp_t out, fp_src_t in)
+{
+	fp_ctx_src_t ctx;
+	fp in_cpy, check;
+	int ret;
+
+	fp_check_initialized(in);
+	fp_check_initialized(out);
+	MUST_HAVE(out->ctx == in->ctx);
+	ctx = in->ctx;
+
+	if ((ctx->p.val[0] & 3) != 3) {
+		return -1;
+	}
+
+	fp_init(&in_cpy, ctx);
+	fp_init(&check, ctx);
+	fp_copy(&in_cpy, in);
+	_fp_pow_fixed(out, &in_cpy, ctx->sqrt_chain, ctx->sqrt_chain_len, 1);
+	fp_sqr(&check, out);
+	ret = (fp_cmp(&check, &in_cpy) == 0) ? 0 : -1;
+	fp_uninit(&in_cpy);
+	fp_uninit(&check);
+
+	return ret;
+}
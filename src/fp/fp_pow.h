@@ -18,5 +18,8 @@
 #include "fp.h"
 
 void fp_pow(fp_t out, fp_src_t base, nn_src_t exp);
+void fp_pow_vartime(fp_t out, fp_src_t base, nn_src_t exp);
+void fp_inv_fixed(fp_t out, fp_src_t in);
+int fp_sqrt_fixed(fp_t out, fp_src_t in);
 
 #endif /* __FP_POW_H__ */
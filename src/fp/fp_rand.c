@@ -19,6 +19,15 @@
 
 int fp_get_random(fp_t out, fp_ctx_src_t ctx)
 {
+	nn tmp;
+	int ret;
+
 	fp_init(out, ctx);
-	return nn_get_random_mod(&(out->fp_val), &(ctx->p));
+	ret = nn_get_random_mod(&tmp, &(ctx->p));
+	if (!ret) {
+		fp_set_nn(out, &tmp);
+	}
+	nn_uninit(&tmp);
+
+	return ret;
 }
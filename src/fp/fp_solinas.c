@@ -0,0 +1,372 @@
+/*
+ *  Copyright (C) 2017 - This file is part of libecc project
+ *
+ *  Authors:
+ *      Ryad BENADJILA <ryadbenadjila@gmail.com>
+ *      Arnaud EBALARD <arnaud.ebalard@ssi.gouv.fr>
+ *      Jean-Pierre FLORI <jean-pierre.flori@ssi.gouv.fr>
+ *
+ *  Contributors:
+ *      Nicolas VIVET <nicolas.vivet@ssi.gouv.fr>
+ *      Karim KHALFALLAH <karim.khalfallah@ssi.gouv.fr>
+ *
+ *  This software is licensed under a dual BSD and GPL v2 license.
+ *  See LICENSE file at the root folder of the project.
+ */
+#include "fp_solinas.h"
+
+/*
+ * Fast reduction modulo the generalized Mersenne primes used by the
+ * secp192r1, secp224r1, secp256r1, secp384r1 and secp521r1 curves, as
+ * described in FIPS 186-4 appendix D.2. The product to reduce is split
+ * in 32-bit chunks (whatever our word size is), which are summed with
+ * the chunk patterns of the standard. The sums are computed on 64-bit
+ * accumulators holding signed values in two's complement, and the final
+ * corrections are done with masks, i.e. in constant time.
+ */
+
+/* Maximum number of 32-bit chunks of p (17 for p521) */
+#define SOLINAS_MAX_LIMBS 17
+
+/* Arithmetic right shift by 32 of a signed 64-bit value stored in a u64 */
+#define SOLINAS_SAR32(s) (((s) >> 32) | (((u64)0 - ((s) >> 63)) << 32))
+
+/* Get 32-bit chunk i of the nn a (i.e. bits 32*i to 32*i+31) */
+static inline u32 _nn_get_u32(nn_src_t a, unsigned int i)
+{
+#if (WORD_BYTES >= 4)
+	return (u32)(a->val[(32 * i) / WORD_BITS] >> ((32 * i) % WORD_BITS));
+#else
+	return (u32)a->val[2 * i] | ((u32)a->val[(2 * i) + 1] << 16);
+#endif
+}
+
+static void _nn_to_u32(u32 *c, unsigned int n, nn_src_t a)
+{
+	unsigned int i;
+
+	for (i = 0; i < n; i++) {
+		c[i] = _nn_get_u32(a, i);
+	}
+}
+
+/* out = r where r has n 32-bit chunks and out is wlen words long */
+static void _nn_from_u32(nn_t out, const u32 *r, unsigned int n, u8 wlen)
+{
+	unsigned int i;
+
+	nn_init(out, (u16)(wlen * WORD_BYTES));
+	for (i = 0; i < n; i++) {
+#if (WORD_BYTES >= 4)
+		out->val[(32 * i) / WORD_BITS] |=
+			(word_t)r[i] << ((32 * i) % WORD_BITS);
+#else
+		out->val[2 * i] = (word_t)(r[i] & 0xffff);
+		out->val[(2 * i) + 1] = (word_t)(r[i] >> 16);
+#endif
+	}
+}
+
+/*
+ * Propagate the carries of the signed sums s into the 32-bit chunks r.
+ * The (signed) carry going out of the n chunks is returned.
+ */
+static u64 _solinas_carry(u32 *r, const u64 *s, unsigned int n)
+{
+	u64 acc, carry = 0;
+	unsigned int i;
+
+	for (i = 0; i < n; i++) {
+		acc = s[i] + carry;
+		r[i] = (u32)acc;
+		carry = SOLINAS_SAR32(acc);
+	}
+
+	return carry;
+}
+
+/*
+ * Replace c * 2^(32n) by c * (2^(32n) mod p), where 2^(32n) mod p only
+ * has +1 chunks (pos bit mask) and -1 chunks (neg bit mask). Three such
+ * foldings are enough to get rid of any carry for our primes, starting
+ * with a carry c such that |c| < 8.
+ */
+static void _solinas_fold(u32 *r, u64 c, unsigned int n, u32 pos, u32 neg)
+{
+	u64 acc, carry;
+	unsigned int i, k;
+
+	for (k = 0; k < 3; k++) {
+		carry = 0;
+		for (i = 0; i < n; i++) {
+			acc = (u64)r[i] + carry;
+			if (pos & ((u32)1 << i)) {
+				acc += c;
+			}
+			if (neg & ((u32)1 << i)) {
+				acc -= c;
+			}
+			r[i] = (u32)acc;
+			carry = SOLINAS_SAR32(acc);
+		}
+		c = carry;
+	}
+	/* After the three passes, the value fits on n chunks */
+	MUST_HAVE(c == 0);
+}
+
+/*
+ * Given r < 2p on n chunks, subtract p from r if r >= p. This is done
+ * in constant time.
+ */
+static void _solinas_cnd_sub_p(u32 *r, nn_src_t p, unsigned int n)
+{
+	u32 d[SOLINAS_MAX_LIMBS];
+	u32 mask;
+	u64 acc, borrow = 0;
+	unsigned int i;
+
+	for (i = 0; i < n; i++) {
+		acc = (u64)r[i] - _nn_get_u32(p, i) - borrow;
+		d[i] = (u32)acc;
+		borrow = (acc >> 63);
+	}
+	/* mask is all ones when there is no borrow, i.e. r >= p */
+	mask = (u32)(borrow - 1);
+	for (i = 0; i < n; i++) {
+		r[i] = (d[i] & mask) | (r[i] & ~mask);
+	}
+}
+
+/* r = c mod p192 with p192 = 2^192 - 2^64 - 1 */
+static void _solinas_p192(u32 *r, const u32 *A)
+{
+	u64 s[6], c;
+
+	/* T + S1 + S2 + S3, with 64-bit chunks split in two */
+	s[0] = (u64)A[0] + A[6] + A[10];
+	s[1] = (u64)A[1] + A[7] + A[11];
+	s[2] = (u64)A[2] + A[6] + A[8] + A[10];
+	s[3] = (u64)A[3] + A[7] + A[9] + A[11];
+	s[4] = (u64)A[4] + A[8] + A[10];
+	s[5] = (u64)A[5] + A[9] + A[11];
+
+	c = _solinas_carry(r, s, 6);
+	/* 2^192 = 2^64 + 1 mod p192 */
+	_solinas_fold(r, c, 6, 0x5, 0x0);
+}
+
+/* r = c mod p224 with p224 = 2^224 - 2^96 + 1 */
+static void _solinas_p224(u32 *r, const u32 *A)
+{
+	u64 s[7], c;
+
+	/* T + S1 + S2 - D1 - D2 */
+	s[0] = (u64)A[0] - A[7] - A[11];
+	s[1] = (u64)A[1] - A[8] - A[12];
+	s[2] = (u64)A[2] - A[9] - A[13];
+	s[3] = (u64)A[3] + A[7] + A[11] - A[10];
+	s[4] = (u64)A[4] + A[8] + A[12] - A[11];
+	s[5] = (u64)A[5] + A[9] + A[13] - A[12];
+	s[6] = (u64)A[6] + A[10] - A[13];
+
+	c = _solinas_carry(r, s, 7);
+	/* 2^224 = 2^96 - 1 mod p224 */
+	_solinas_fold(r, c, 7, 0x8, 0x1);
+}
+
+/* r = c mod p256 with p256 = 2^256 - 2^224 + 2^192 + 2^96 - 1 */
+static void _solinas_p256(u32 *r, const u32 *A)
+{
+	u64 s[8], c;
+
+	/* T + 2 S1 + 2 S2 + S3 + S4 - D1 - D2 - D3 - D4 */
+	s[0] = (u64)A[0] + A[8] + A[9] - A[11] - A[12] - A[13] - A[14];
+	s[1] = (u64)A[1] + A[9] + A[10] - A[12] - A[13] - A[14] - A[15];
+	s[2] = (u64)A[2] + A[10] + A[11] - A[13] - A[14] - A[15];
+	s[3] = (u64)A[3] + (2 * (u64)A[11]) + (2 * (u64)A[12]) + A[13]
+		- A[15] - A[8] - A[9];
+	s[4] = (u64)A[4] + (2 * (u64)A[12]) + (2 * (u64)A[13]) + A[14]
+		- A[9] - A[10];
+	s[5] = (u64)A[5] + (2 * (u64)A[13]) + (2 * (u64)A[14]) + A[15]
+		- A[10] - A[11];
+	s[6] = (u64)A[6] + (3 * (u64)A[14]) + (2 * (u64)A[15]) + A[13]
+		- A[8] - A[9];
+	s[7] = (u64)A[7] + (3 * (u64)A[15]) + A[8]
+		- A[10] - A[11] - A[12] - A[13];
+
+	c = _solinas_carry(r, s, 8);
+	/* 2^256 = 2^224 - 2^192 - 2^96 + 1 mod p256 */
+	_solinas_fold(r, c, 8, 0x81, 0x48);
+}
+
+/* r = c mod p384 with p384 = 2^384 - 2^128 - 2^96 + 2^32 - 1 */
+static void _solinas_p384(u32 *r, const u32 *A)
+{
+	u64 s[12], c;
+
+	/* T + 2 S1 + S2 + S3 + S4 + S5 + S6 - D1 - D2 - D3 */
+	s[0] = (u64)A[0] + A[12] + A[21] + A[20] - A[23];
+	s[1] = (u64)A[1] + A[13] + A[22] + A[23] - A[12] - A[20];
+	s[2] = (u64)A[2] + A[14] + A[23] - A[13] - A[21];
+	s[3] = (u64)A[3] + A[15] + A[12] + A[20] + A[21]
+		- A[14] - A[22] - A[23];
+	s[4] = (u64)A[4] + (2 * (u64)A[21]) + A[16] + A[13] + A[12] + A[20]
+		+ A[22] - A[15] - (2 * (u64)A[23]);
+	s[5] = (u64)A[5] + (2 * (u64)A[22]) + A[17] + A[14] + A[13] + A[21]
+		+ A[23] - A[16];
+	s[6] = (u64)A[6] + (2 * (u64)A[23]) + A[18] + A[15] + A[14] + A[22]
+		- A[17];
+	s[7] = (u64)A[7] + A[19] + A[16] + A[15] + A[23] - A[18];
+	s[8] = (u64)A[8] + A[20] + A[17] + A[16] - A[19];
+	s[9] = (u64)A[9] + A[21] + A[18] + A[17] - A[20];
+	s[10] = (u64)A[10] + A[22] + A[19] + A[18] - A[21];
+	s[11] = (u64)A[11] + A[23] + A[20] + A[19] - A[22];
+
+	c = _solinas_carry(r, s, 12);
+	/* 2^384 = 2^128 + 2^96 - 2^32 + 1 mod p384 */
+	_solinas_fold(r, c, 12, 0x19, 0x2);
+}
+
+/* r = c mod p521 with p521 = 2^521 - 1 */
+static void _solinas_p521(u32 *r, const u32 *A)
+{
+	u64 acc;
+	u32 hi;
+	unsigned int i;
+
+	/* r = (c mod 2^521) + (c >> 521) < 2^522 */
+	acc = 0;
+	for (i = 0; i < 16; i++) {
+		hi = (A[16 + i] >> 9) | (A[17 + i] << 23);
+		acc += (u64)A[i] + hi;
+		r[i] = (u32)acc;
+		acc >>= 32;
+	}
+	acc += (u64)(A[16] & 0x1ff) + (A[32] >> 9);
+	r[16] = (u32)acc;
+
+	/* Fold the bit above 2^521 once more: r <= 2^521 */
+	acc = (u64)(r[16] >> 9);
+	r[16] &= 0x1ff;
+	for (i = 0; i < 17; i++) {
+		acc += (u64)r[i];
+		r[i] = (u32)acc;
+		acc >>= 32;
+	}
+}
+
+/*
+ * Return the fast reduction type matching p (of bit length p_bitlen),
+ * FP_RED_GENERIC if p is not one of our special primes.
+ */
+fp_red_type fp_solinas_get_type(nn_src_t p, bitcnt_t p_bitlen)
+{
+	/* The primes as 32-bit chunks, least significant first */
+	static const u32 p192[] = {
+		0xffffffff, 0xffffffff, 0xfffffffe, 0xffffffff,
+		0xffffffff, 0xffffffff
+	};
+	static const u32 p224[] = {
+		0x00000001, 0x00000000, 0x00000000, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff
+	};
+	static const u32 p256[] = {
+		0xffffffff, 0xffffffff, 0xffffffff, 0x00000000,
+		0x00000000, 0x00000000, 0x00000001, 0xffffffff
+	};
+	static const u32 p384[] = {
+		0xffffffff, 0x00000000, 0x00000000, 0xffffffff,
+		0xfffffffe, 0xffffffff, 0xffffffff, 0xffffffff,
+		0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff
+	};
+	static const struct {
+		fp_red_type type;
+		bitcnt_t bitlen;
+		const u32 *chunks;
+	} primes[] = {
+		{ FP_RED_P192, 192, p192 },
+		{ FP_RED_P224, 224, p224 },
+		{ FP_RED_P256, 256, p256 },
+		{ FP_RED_P384, 384, p384 },
+	};
+	unsigned int i, j;
+
+	nn_check_initialized(p);
+
+	/*
+	 * We need room for the 32-bit chunks of a product of two elements,
+	 * this is always the case for our curves.
+	 */
+	if ((2 * (u32)(((p_bitlen + 31) / 32) * 32)) > NN_MAX_BIT_LEN) {
+		return FP_RED_GENERIC;
+	}
+
+	if (p_bitlen == 521) {
+		for (i = 0; i < 16; i++) {
+			if (_nn_get_u32(p, i) != 0xffffffff) {
+				return FP_RED_GENERIC;
+			}
+		}
+		return (_nn_get_u32(p, 16) == 0x1ff) ? FP_RED_P521 :
+			FP_RED_GENERIC;
+	}
+
+	for (i = 0; i < (sizeof(primes) / sizeof(primes[0])); i++) {
+		if (primes[i].bitlen != p_bitlen) {
+			continue;
+		}
+		for (j = 0; j < (p_bitlen / 32); j++) {
+			if (_nn_get_u32(p, j) != primes[i].chunks[j]) {
+				return FP_RED_GENERIC;
+			}
+		}
+		return primes[i].type;
+	}
+
+	return FP_RED_GENERIC;
+}
+
+/*
+ * out = in mod p where p is the special prime of ctx and in < p^2
+ * (typically a product of two elements of Fp). Aliasing of out and in
+ * is supported.
+ */
+void fp_solinas_reduce(nn_t out, nn_src_t in, fp_ctx_src_t ctx)
+{
+	u32 A[2 * SOLINAS_MAX_LIMBS];
+	u32 r[SOLINAS_MAX_LIMBS];
+	unsigned int n;
+
+	nn_check_initialized(in);
+	fp_ctx_check_initialized(ctx);
+
+	n = (ctx->p_bitlen + 31) / 32;
+	MUST_HAVE(n <= SOLINAS_MAX_LIMBS);
+	MUST_HAVE((2 * n * 32) <= NN_MAX_BIT_LEN);
+	_nn_to_u32(A, 2 * n, in);
+
+	switch (ctx->red_type) {
+	case FP_RED_P192:
+		_solinas_p192(r, A);
+		break;
+	case FP_RED_P224:
+		_solinas_p224(r, A);
+		break;
+	case FP_RED_P256:
+		_solinas_p256(r, A);
+		break;
+	case FP_RED_P384:
+		_solinas_p384(r, A);
+		break;
+	case FP_RED_P521:
+		_solinas_p521(r, A);
+		break;
+	default:
+		MUST_HAVE(0);
+		return;
+	}
+	_solinas_cnd_sub_p(r, &(ctx->p), n);
+
+	_nn_from_u32(out, r, n, ctx->p.wlen);
+}
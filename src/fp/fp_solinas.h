@@ -0,0 +1,23 @@
+/*
+ *  Copyright (C) 2017 - This file is part of libecc project
+ *
+ *  Authors:
+ *      Ryad BENADJILA <ryadbenadjila@gmail.com>
+ *      Arnaud EBALARD <arnaud.ebalard@ssi.gouv.fr>
+ *      Jean-Pierre FLORI <jean-pierre.flori@ssi.gouv.fr>
+ *
+ *  Contributors:
+ *      Nicolas VIVET <nicolas.vivet@ssi.gouv.fr>
+ *      Karim KHALFALLAH <karim.khalfallah@ssi.gouv.fr>
+ *
+ *  This software is licensed under a dual BSD and GPL v2 license.
+ *  See LICENSE file at the root folder of the project.
+ */
+#ifndef __FP_SOLINAS_H__
+#define __FP_SOLINAS_H__
+#include "fp.h"
+
+fp_red_type fp_solinas_get_type(nn_src_t p, bitcnt_t p_bitlen);
+void fp_solinas_reduce(nn_t out, nn_src_t in, fp_ctx_src_t ctx);
+
+#endif /* __FP_SOLINAS_H__ */
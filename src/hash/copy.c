@@ -8,6 +8,12 @@ void copy256_init(copy256_context *ctx)
 	MUST_HAVE(ctx != NULL);
 
 	ctx->copied_bytes = 0;
+	/*
+	 * Less than COPY256_SIZE bytes may be copied, and copy256_final()
+	 * always outputs the whole buffer: clear it so that the digest
+	 * does not depend on what was left on the stack.
+	 */
+	local_memset(ctx->buffer, 0, COPY256_SIZE);
 }
 
 /* Update hash function */
@@ -31,6 +31,7 @@
 #include "fp/fp.h"
 #include "fp/fp_add.h"
 #include "fp/fp_montgomery.h"
+#include "fp/fp_lazy.h"
 #include "fp/fp_mul.h"
 #include "fp/fp_pow.h"
 #include "fp/fp_rand.h"
@@ -0,0 +1,58 @@
+/*
+ *  Copyright (C) 2017 - This file is part of libecc project
+ *
+ *  Authors:
+ *      Ryad BENADJILA <ryadbenadjila@gmail.com>
+ *      Arnaud EBALARD <arnaud.ebalard@ssi.gouv.fr>
+ *      Jean-Pierre FLORI <jean-pierre.flori@ssi.gouv.fr>
+ *
+ *  Contributors:
+ *      Nicolas VIVET <nicolas.vivet@ssi.gouv.fr>
+ *      Karim KHALFALLAH <karim.khalfallah@ssi.gouv.fr>
+ *
+ *  This software is licensed under a dual BSD and GPL v2 license.
+ *  See LICENSE file at the root folder of the project.
+ */
+#ifndef __LL_MONT_RISCV64_H__
+#define __LL_MONT_RISCV64_H__
+#include "../words/words.h"
+
+/*
+ * rv64 Montgomery kernels for 6, 8 and 9 x 64-bit limbs moduli (i.e.
+ * 384, 512 and 521-bit primes such as SECP384R1, BRAINPOOLP384R1,
+ * BRAINPOOLP512R1, GOST512 and SECP521R1), completing the 4 limbs ones of
+ * ll_u256_mont.h. They are in ll_mont-riscv64.S, generated by
+ * scripts/ll_mont_riscv64.py, and are used by the nn_*_redc1 routines
+ * when the library is compiled with WITH_LL_MONT_RISCV64 (i.e.
+ * LIBECC_WITH_LL_U256_MONT=1 on a riscv64 target).
+ *
+ * The contract is the one of the ll_u256_mont kernels: little endian
+ * limbs, inputs < Nd, k0 = -Nd^(-1) mod 2^64, fully reduced result and
+ * output possibly aliasing the inputs. Since the kernels are plain
+ * Montgomery multiplications (CIOS, or SOS for the squarings)
+ * with a final conditional subtraction, inputs < 2 * Nd are also fine
+ * when 4 * Nd < 2^(64 * n) (see fp_lazy.h).
+ */
+#if defined(WITH_LL_MONT_RISCV64) && (WORD_BYTES == 8)
+
+/* rd = ad * bd * 2^(-64n) mod Nd */
+void ll_u384_mont_mul(u64 rd[6], const u64 ad[6], const u64 bd[6],
+		      const u64 Nd[6], u64 k0);
+void ll_u512_mont_mul(u64 rd[8], const u64 ad[8], const u64 bd[8],
+		      const u64 Nd[8], u64 k0);
+void ll_u521_mont_mul(u64 rd[9], const u64 ad[9], const u64 bd[9],
+		      const u64 Nd[9], u64 k0);
+/* rd = ad^2 * 2^(-64n) mod Nd */
+void ll_u384_mont_sqr(u64 rd[6], const u64 ad[6], const u64 Nd[6], u64 k0);
+void ll_u512_mont_sqr(u64 rd[8], const u64 ad[8], const u64 Nd[8], u64 k0);
+void ll_u521_mont_sqr(u64 rd[9], const u64 ad[9], const u64 Nd[9], u64 k0);
+/* rd = ad * 2^(-64n) mod Nd */
+void ll_u384_mont_reduce(u64 rd[6], const u64 ad[6], const u64 Nd[6],
+			 u64 k0);
+void ll_u512_mont_reduce(u64 rd[8], const u64 ad[8], const u64 Nd[8],
+			 u64 k0);
+void ll_u521_mont_reduce(u64 rd[9], const u64 ad[9], const u64 Nd[9],
+			 u64 k0);
+#endif
+
+#endif /* __LL_MONT_RISCV64_H__ */
@@ -0,0 +1,94 @@
+/*
+ *  Copyright (C) 2017 - This file is part of libecc project
+ *
+ *  Authors:
+ *      Ryad BENADJILA <ryadbenadjila@gmail.com>
+ *      Arnaud EBALARD <arnaud.ebalard@ssi.gouv.fr>
+ *      Jean-Pierre FLORI <jean-pierre.flori@ssi.gouv.fr>
+ *
+ *  Contributors:
+ *      Nicolas VIVET <nicolas.vivet@ssi.gouv.fr>
+ *      Karim KHALFALLAH <karim.khalfallah@ssi.gouv.fr>
+ *
+ *  This software is licensed under a dual BSD and GPL v2 license.
+ *  See LICENSE file at the root folder of the project.
+ */
+#include "ll_mont_x86_64.h"
+
+/*
+ * Runtime selection of the x86-64 BMI2/ADX Montgomery kernels of
+ * ll_mont-x86_64.S.
+ */
+#if defined(WITH_LL_MONT_X86_64) && (WORD_BYTES == 8)
+
+/* -1 until CPUID has been queried, then ll_mont_x86_64_cpu_ok() */
+static int ll_mont_x86_64_cpu = -1;
+
+static int ll_mont_x86_64_enabled(void)
+{
+	/* Concurrent first calls all store the same value */
+	if (ll_mont_x86_64_cpu < 0) {
+		ll_mont_x86_64_cpu = (ll_mont_x86_64_cpu_ok() != 0);
+	}
+
+	return ll_mont_x86_64_cpu;
+}
+
+ll_mont_mul_func ll_mont_x86_64_get_mul(u8 wlen)
+{
+	ll_mont_mul_func f;
+
+	if (!ll_mont_x86_64_enabled()) {
+		return NULL;
+	}
+
+	switch (wlen) {
+	case 4:
+		f = ll_mont_mulx_4;
+		break;
+	case 6:
+		f = ll_mont_mulx_6;
+		break;
+	case 9:
+		f = ll_mont_mulx_9;
+		break;
+	default:
+		f = NULL;
+		break;
+	}
+
+	return f;
+}
+
+ll_mont_sqr_func ll_mont_x86_64_get_sqr(u8 wlen)
+{
+	ll_mont_sqr_func f;
+
+	if (!ll_mont_x86_64_enabled()) {
+		return NULL;
+	}
+
+	switch (wlen) {
+	case 4:
+		f = ll_mont_sqrx_4;
+		break;
+	case 6:
+		f = ll_mont_sqrx_6;
+		break;
+	case 9:
+		f = ll_mont_sqrx_9;
+		break;
+	default:
+		f = NULL;
+		break;
+	}
+
+	return f;
+}
+
+#else
+/*
+ * Dummy definition to avoid the empty translation unit ISO C warning
+ */
+typedef int dummy;
+#endif
@@ -0,0 +1,75 @@
+/*
+ *  Copyright (C) 2017 - This file is part of libecc project
+ *
+ *  Authors:
+ *      Ryad BENADJILA <ryadbenadjila@gmail.com>
+ *      Arnaud EBALARD <arnaud.ebalard@ssi.gouv.fr>
+ *      Jean-Pierre FLORI <jean-pierre.flori@ssi.gouv.fr>
+ *
+ *  Contributors:
+ *      Nicolas VIVET <nicolas.vivet@ssi.gouv.fr>
+ *      Karim KHALFALLAH <karim.khalfallah@ssi.gouv.fr>
+ *
+ *  This software is licensed under a dual BSD and GPL v2 license.
+ *  See LICENSE file at the root folder of the project.
+ */
+#ifndef __LL_MONT_X86_64_H__
+#define __LL_MONT_X86_64_H__
+#include "../words/words.h"
+
+/*
+ * x86-64 Montgomery kernels for 4, 6 and 9 x 64-bit limbs moduli (i.e.
+ * 256, 384 and 521-bit primes), using the BMI2 mulx and ADX adcx/adox
+ * instructions (ll_mont-x86_64.S, generated by scripts/ll_mont_x86_64.py).
+ * They are only built when the library is compiled with
+ * WITH_LL_MONT_X86_64 (i.e. LIBECC_WITH_LL_MONT_X86_64=1 on an x86-64
+ * target), and are used by the nn and fp layers only when the CPU
+ * supports these instructions, which is checked at runtime with
+ * ll_mont_x86_64_get_mul() and ll_mont_x86_64_get_sqr(). Otherwise,
+ * the portable routines are used.
+ *
+ * The contract is the one of the ll_u256_mont kernels: little endian
+ * limbs, inputs < Nd, k0 = -Nd^(-1) mod 2^64, fully reduced result and
+ * output possibly aliasing the inputs. The multiplications are plain CIOS
+ * ones, and the squarings compute each cross product once before a
+ * separate reduction. Since both end with a single conditional
+ * subtraction, inputs < 2 * Nd are also fine when 4 * Nd < 2^(64 * n)
+ * (see fp_lazy.h).
+ *
+ * The kernels take their arguments as the System V ABI and are assembled
+ * for ELF: on other targets (e.g. Windows or Mac OS), WITH_LL_MONT_X86_64
+ * is dropped here and the portable routines are used.
+ */
+#if defined(WITH_LL_MONT_X86_64) && !(defined(__ELF__) && !defined(_WIN64))
+#undef WITH_LL_MONT_X86_64
+#endif
+
+#if defined(WITH_LL_MONT_X86_64) && (WORD_BYTES == 8)
+
+typedef void (*ll_mont_mul_func) (u64 *rd, const u64 *ad, const u64 *bd,
+				  const u64 *Nd, u64 k0);
+typedef void (*ll_mont_sqr_func) (u64 *rd, const u64 *ad, const u64 *Nd,
+				  u64 k0);
+
+/* Non zero when the CPU supports BMI2 and ADX */
+int ll_mont_x86_64_cpu_ok(void);
+
+void ll_mont_mulx_4(u64 rd[4], const u64 ad[4], const u64 bd[4],
+		    const u64 Nd[4], u64 k0);
+void ll_mont_sqrx_4(u64 rd[4], const u64 ad[4], const u64 Nd[4], u64 k0);
+void ll_mont_mulx_6(u64 rd[6], const u64 ad[6], const u64 bd[6],
+		    const u64 Nd[6], u64 k0);
+void ll_mont_sqrx_6(u64 rd[6], const u64 ad[6], const u64 Nd[6], u64 k0);
+void ll_mont_mulx_9(u64 rd[9], const u64 ad[9], const u64 bd[9],
+		    const u64 Nd[9], u64 k0);
+void ll_mont_sqrx_9(u64 rd[9], const u64 ad[9], const u64 Nd[9], u64 k0);
+
+/*
+ * Kernels for a modulus of wlen limbs, NULL when there is none or when
+ * the CPU lacks BMI2/ADX (CPUID being only queried once).
+ */
+ll_mont_mul_func ll_mont_x86_64_get_mul(u8 wlen);
+ll_mont_sqr_func ll_mont_x86_64_get_sqr(u8 wlen);
+#endif
+
+#endif /* __LL_MONT_X86_64_H__ */
@@ -0,0 +1,336 @@
+/*
+ *  Copyright (C) 2017 - This file is part of libecc project
+ *
+ *  Authors:
+ *      Ryad BENADJILA <ryadbenadjila@gmail.com>
+ *      Arnaud EBALARD <arnaud.ebalard@ssi.gouv.fr>
+ *      Jean-Pierre FLORI <jean-pierre.flori@ssi.gouv.fr>
+ *
+ *  Contributors:
+ *      Nicolas VIVET <nicolas.vivet@ssi.gouv.fr>
+ *      Karim KHALFALLAH <karim.khalfallah@ssi.gouv.fr>
+ *
+ *  This software is licensed under a dual BSD and GPL v2 license.
+ *  See LICENSE file at the root folder of the project.
+ */
+#include "ll_u256_mont.h"
+
+/*
+ * Portable C implementation of the 4 limbs Montgomery kernels exported
+ * by ll_u256_mont-riscv64.S and of the modular ones exported by
+ * ll_u256_mod-riscv64.S. This is what we link on 64-bit hosts that
+ * are not riscv64 when compiling with LIBECC_WITH_LL_U256_MONT=1.
+ */
+#if defined(WITH_LL_U256_MONT) && (WORD_BYTES == 8)
+
+#if !defined(__SIZEOF_INT128__)
+#error "LIBECC_WITH_LL_U256_MONT needs a compiler providing unsigned __int128 on this target"
+#endif
+
+__extension__ typedef unsigned __int128 u128;
+
+/* (c, t) = t + (a * b) + c, which cannot overflow 128 bits */
+#define LL_MAC(t, c, a, b) do {					\
+	u128 _acc = ((u128)(a) * (b)) + (t) + (c);		\
+	(t) = (u64)_acc;					\
+	(c) = (u64)(_acc >> 64);				\
+} while (0)
+
+/* (t5, t4, t3, t2, t1, t0) += (a3, a2, a1, a0) * bi */
+#define LL_MUL_ROW(bi) do {					\
+	c = 0;							\
+	LL_MAC(t0, c, a0, (bi));				\
+	LL_MAC(t1, c, a1, (bi));				\
+	LL_MAC(t2, c, a2, (bi));				\
+	LL_MAC(t3, c, a3, (bi));				\
+	acc = (u128)t4 + c;					\
+	t4 = (u64)acc;						\
+	t5 = (u64)(acc >> 64);					\
+} while (0)
+
+/*
+ * Add m * N where m is chosen so that the low limb vanishes, and
+ * shift the accumulator one limb to the right.
+ */
+#define LL_RED_ROW() do {					\
+	m = t0 * k0;						\
+	c = 0;							\
+	LL_MAC(t0, c, m, n0);					\
+	LL_MAC(t1, c, m, n1);					\
+	LL_MAC(t2, c, m, n2);					\
+	LL_MAC(t3, c, m, n3);					\
+	acc = (u128)t4 + c;					\
+	t0 = t1;						\
+	t1 = t2;						\
+	t2 = t3;						\
+	t3 = (u64)acc;						\
+	t4 = t5 + (u64)(acc >> 64);				\
+} while (0)
+
+/*
+ * Final conditional subtraction of N from (hi, x3, x2, x1, x0) < 2N,
+ * done in constant time with masks.
+ */
+#define LL_FINAL_SUB(rd, x0, x1, x2, x3, hi) do {		\
+	u64 r0, r1, r2, r3, borrow, mask;			\
+	acc = (u128)(x0) - n0;					\
+	r0 = (u64)acc;						\
+	borrow = (u64)(acc >> 64) & 1;				\
+	acc = (u128)(x1) - n1 - borrow;				\
+	r1 = (u64)acc;						\
+	borrow = (u64)(acc >> 64) & 1;				\
+	acc = (u128)(x2) - n2 - borrow;				\
+	r2 = (u64)acc;						\
+	borrow = (u64)(acc >> 64) & 1;				\
+	acc = (u128)(x3) - n3 - borrow;				\
+	r3 = (u64)acc;						\
+	borrow = (u64)(acc >> 64) & 1;				\
+	/* mask is all ones when x < N, i.e. we keep x */	\
+	mask = (u64)0 - ((~(hi)) & borrow & 1);			\
+	(rd)[0] = ((x0) & mask) | (r0 & ~mask);			\
+	(rd)[1] = ((x1) & mask) | (r1 & ~mask);			\
+	(rd)[2] = ((x2) & mask) | (r2 & ~mask);			\
+	(rd)[3] = ((x3) & mask) | (r3 & ~mask);			\
+} while (0)
+
+/*
+ * Montgomery multiplication using the CIOS method, with the four
+ * rounds fully unrolled. All the inputs are loaded before the output
+ * is written, hence rd can alias ad, bd or Nd.
+ */
+void ll_u256_mont_mul(u64 rd[4], const u64 ad[4], const u64 bd[4],
+		      const u64 Nd[4], u64 k0)
+{
+	u64 a0 = ad[0], a1 = ad[1], a2 = ad[2], a3 = ad[3];
+	u64 b0 = bd[0], b1 = bd[1], b2 = bd[2], b3 = bd[3];
+	u64 n0 = Nd[0], n1 = Nd[1], n2 = Nd[2], n3 = Nd[3];
+	u64 t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0;
+	u64 c, m;
+	u128 acc;
+
+	LL_MUL_ROW(b0);
+	LL_RED_ROW();
+	LL_MUL_ROW(b1);
+	LL_RED_ROW();
+	LL_MUL_ROW(b2);
+	LL_RED_ROW();
+	LL_MUL_ROW(b3);
+	LL_RED_ROW();
+
+	LL_FINAL_SUB(rd, t0, t1, t2, t3, t4);
+}
+
+/*
+ * (hb, x4, x3, x2, x1, x0) += m * N where m is chosen so that x0
+ * vanishes. hb holds the carry going to the limb above x4 (it is
+ * added back during the next round).
+ */
+#define LL_RED8_ROW(x0, x1, x2, x3, x4) do {			\
+	m = (x0) * k0;						\
+	c = 0;							\
+	LL_MAC(x0, c, m, n0);					\
+	LL_MAC(x1, c, m, n1);					\
+	LL_MAC(x2, c, m, n2);					\
+	LL_MAC(x3, c, m, n3);					\
+	acc = (u128)(x4) + c + hb;				\
+	(x4) = (u64)acc;					\
+	hb = (u64)(acc >> 64);					\
+} while (0)
+
+/*
+ * Montgomery squaring: the 512-bit square is computed first, the off
+ * diagonal products being only computed once and then doubled, and it
+ * is then reduced with four Montgomery rounds.
+ */
+void ll_u256_mont_sqr(u64 rd[4], const u64 ad[4], const u64 Nd[4], u64 k0)
+{
+	u64 a0 = ad[0], a1 = ad[1], a2 = ad[2], a3 = ad[3];
+	u64 n0 = Nd[0], n1 = Nd[1], n2 = Nd[2], n3 = Nd[3];
+	u64 t0, t1 = 0, t2 = 0, t3 = 0, t4, t5, t6, t7;
+	u64 c, m, hb;
+	u128 acc;
+
+	/* Off diagonal products a_i * a_j with i < j */
+	c = 0;
+	LL_MAC(t1, c, a1, a0);
+	LL_MAC(t2, c, a2, a0);
+	LL_MAC(t3, c, a3, a0);
+	t4 = c;
+	c = 0;
+	LL_MAC(t3, c, a2, a1);
+	LL_MAC(t4, c, a3, a1);
+	t5 = c;
+	c = 0;
+	LL_MAC(t5, c, a3, a2);
+	t6 = c;
+
+	/* Double them */
+	t7 = t6 >> 63;
+	t6 = (t6 << 1) | (t5 >> 63);
+	t5 = (t5 << 1) | (t4 >> 63);
+	t4 = (t4 << 1) | (t3 >> 63);
+	t3 = (t3 << 1) | (t2 >> 63);
+	t2 = (t2 << 1) | (t1 >> 63);
+	t1 = t1 << 1;
+
+	/* Add the diagonal squares a_i^2 */
+	acc = (u128)a0 * a0;
+	t0 = (u64)acc;
+	acc = (u128)t1 + (u64)(acc >> 64);
+	t1 = (u64)acc;
+	c = (u64)(acc >> 64);
+	acc = ((u128)a1 * a1) + t2 + c;
+	t2 = (u64)acc;
+	acc = (u128)t3 + (u64)(acc >> 64);
+	t3 = (u64)acc;
+	c = (u64)(acc >> 64);
+	acc = ((u128)a2 * a2) + t4 + c;
+	t4 = (u64)acc;
+	acc = (u128)t5 + (u64)(acc >> 64);
+	t5 = (u64)acc;
+	c = (u64)(acc >> 64);
+	acc = ((u128)a3 * a3) + t6 + c;
+	t6 = (u64)acc;
+	t7 += (u64)(acc >> 64);
+
+	/* Montgomery reduction of (t7, ..., t0) */
+	hb = 0;
+	LL_RED8_ROW(t0, t1, t2, t3, t4);
+	LL_RED8_ROW(t1, t2, t3, t4, t5);
+	LL_RED8_ROW(t2, t3, t4, t5, t6);
+	LL_RED8_ROW(t3, t4, t5, t6, t7);
+
+	LL_FINAL_SUB(rd, t4, t5, t6, t7, hb);
+}
+
+/*
+ * Montgomery reduction of a 4 limbs number, i.e. rd = ad * 2^(-256)
+ * mod Nd. This is what is used to come back from the Montgomery
+ * representation, and is way cheaper than a multiplication by one.
+ */
+void ll_u256_mont_reduce(u64 rd[4], const u64 ad[4], const u64 Nd[4], u64 k0)
+{
+	u64 t0 = ad[0], t1 = ad[1], t2 = ad[2], t3 = ad[3];
+	u64 n0 = Nd[0], n1 = Nd[1], n2 = Nd[2], n3 = Nd[3];
+	u64 t4 = 0, t5 = 0;
+	u64 c, m;
+	u128 acc;
+
+	LL_RED_ROW();
+	LL_RED_ROW();
+	LL_RED_ROW();
+	LL_RED_ROW();
+
+	LL_FINAL_SUB(rd, t0, t1, t2, t3, t4);
+}
+
+/* rd = ad + bd mod Nd: the sum, minus Nd when it is >= Nd */
+void ll_u256_mont_add(u64 rd[4], const u64 ad[4], const u64 bd[4],
+		      const u64 Nd[4])
+{
+	u64 n0 = Nd[0], n1 = Nd[1], n2 = Nd[2], n3 = Nd[3];
+	u64 s0, s1, s2, s3, c;
+	u128 acc;
+
+	acc = (u128)ad[0] + bd[0];
+	s0 = (u64)acc;
+	acc = (u128)ad[1] + bd[1] + (u64)(acc >> 64);
+	s1 = (u64)acc;
+	acc = (u128)ad[2] + bd[2] + (u64)(acc >> 64);
+	s2 = (u64)acc;
+	acc = (u128)ad[3] + bd[3] + (u64)(acc >> 64);
+	s3 = (u64)acc;
+	c = (u64)(acc >> 64);
+
+	LL_FINAL_SUB(rd, s0, s1, s2, s3, c);
+}
+
+/* rd = ad - bd mod Nd: the difference, plus Nd when it is negative */
+void ll_u256_mont_sub(u64 rd[4], const u64 ad[4], const u64 bd[4],
+		      const u64 Nd[4])
+{
+	u64 n0 = Nd[0], n1 = Nd[1], n2 = Nd[2], n3 = Nd[3];
+	u64 d0, d1, d2, d3, borrow, mask;
+	u128 acc;
+
+	acc = (u128)ad[0] - bd[0];
+	d0 = (u64)acc;
+	borrow = (u64)(acc >> 64) & 1;
+	acc = (u128)ad[1] - bd[1] - borrow;
+	d1 = (u64)acc;
+	borrow = (u64)(acc >> 64) & 1;
+	acc = (u128)ad[2] - bd[2] - borrow;
+	d2 = (u64)acc;
+	borrow = (u64)(acc >> 64) & 1;
+	acc = (u128)ad[3] - bd[3] - borrow;
+	d3 = (u64)acc;
+	borrow = (u64)(acc >> 64) & 1;
+
+	mask = (u64)0 - borrow;
+	acc = (u128)d0 + (n0 & mask);
+	rd[0] = (u64)acc;
+	acc = (u128)d1 + (n1 & mask) + (u64)(acc >> 64);
+	rd[1] = (u64)acc;
+	acc = (u128)d2 + (n2 & mask) + (u64)(acc >> 64);
+	rd[2] = (u64)acc;
+	acc = (u128)d3 + (n3 & mask) + (u64)(acc >> 64);
+	rd[3] = (u64)acc;
+}
+
+/* rd = 2 * ad mod Nd, the doubling being a shift */
+void ll_u256_mont_dbl(u64 rd[4], const u64 ad[4], const u64 Nd[4])
+{
+	u64 a0 = ad[0], a1 = ad[1], a2 = ad[2], a3 = ad[3];
+	u64 n0 = Nd[0], n1 = Nd[1], n2 = Nd[2], n3 = Nd[3];
+	u64 s0, s1, s2, s3, c;
+	u128 acc;
+
+	c = a3 >> 63;
+	s3 = (a3 << 1) | (a2 >> 63);
+	s2 = (a2 << 1) | (a1 >> 63);
+	s1 = (a1 << 1) | (a0 >> 63);
+	s0 = a0 << 1;
+
+	LL_FINAL_SUB(rd, s0, s1, s2, s3, c);
+}
+
+/* rd = 3 * ad mod Nd = (2 * ad mod Nd) + ad mod Nd */
+void ll_u256_mont_tpl(u64 rd[4], const u64 ad[4], const u64 Nd[4])
+{
+	u64 t[4];
+
+	ll_u256_mont_dbl(t, ad, Nd);
+	ll_u256_mont_add(rd, t, ad, Nd);
+}
+
+/* rd = -ad mod Nd, i.e. Nd - ad, or 0 when ad is 0 */
+void ll_u256_mont_neg(u64 rd[4], const u64 ad[4], const u64 Nd[4])
+{
+	u64 a0 = ad[0], a1 = ad[1], a2 = ad[2], a3 = ad[3];
+	u64 n0 = Nd[0], n1 = Nd[1], n2 = Nd[2], n3 = Nd[3];
+	u64 nz, mask, borrow;
+	u128 acc;
+
+	/* All ones when ad is not zero */
+	nz = a0 | a1 | a2 | a3;
+	mask = (u64)0 - ((nz | ((u64)0 - nz)) >> 63);
+
+	acc = (u128)n0 - a0;
+	rd[0] = (u64)acc & mask;
+	borrow = (u64)(acc >> 64) & 1;
+	acc = (u128)n1 - a1 - borrow;
+	rd[1] = (u64)acc & mask;
+	borrow = (u64)(acc >> 64) & 1;
+	acc = (u128)n2 - a2 - borrow;
+	rd[2] = (u64)acc & mask;
+	borrow = (u64)(acc >> 64) & 1;
+	acc = (u128)n3 - a3 - borrow;
+	rd[3] = (u64)acc & mask;
+}
+
+#else
+/*
+ * Dummy definition to avoid the empty translation unit ISO C warning
+ */
+typedef int dummy;
+#endif
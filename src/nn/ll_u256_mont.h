@@ -0,0 +1,66 @@
+/*
+ *  Copyright (C) 2017 - This file is part of libecc project
+ *
+ *  Authors:
+ *      Ryad BENADJILA <ryadbenadjila@gmail.com>
+ *      Arnaud EBALARD <arnaud.ebalard@ssi.gouv.fr>
+ *      Jean-Pierre FLORI <jean-pierre.flori@ssi.gouv.fr>
+ *
+ *  Contributors:
+ *      Nicolas VIVET <nicolas.vivet@ssi.gouv.fr>
+ *      Karim KHALFALLAH <karim.khalfallah@ssi.gouv.fr>
+ *
+ *  This software is licensed under a dual BSD and GPL v2 license.
+ *  See LICENSE file at the root folder of the project.
+ */
+#ifndef __LL_U256_MONT_H__
+#define __LL_U256_MONT_H__
+#include "../words/words.h"
+
+/*
+ * Low level 4 x 64-bit limbs Montgomery kernels. They are only used
+ * when the library is compiled with WITH_LL_U256_MONT (i.e.
+ * LIBECC_WITH_LL_U256_MONT=1) on a 64-bit word build: the RISC-V
+ * assembly (ll_u256_mont-riscv64.S) is linked on riscv64 targets, and
+ * the portable C version (ll_u256_mont.c) everywhere else. With
+ * LIBECC_WITH_LL_U256_MONT_FUSED=1, the riscv64 assembly is instead
+ * ll_u256_mont_fused-riscv64.S (generated by scripts/ll_mont_riscv64.py),
+ * which is constant time and scheduled for the macro-op fusion of CKB-VM.
+ *
+ * All limbs are little endian (rd[0] is the least significant limb),
+ * inputs are expected to be < Nd and k0 = -Nd^(-1) mod 2^64. The result
+ * is fully reduced (i.e. < Nd). The output may alias any of the inputs.
+ */
+#if defined(WITH_LL_U256_MONT) && (WORD_BYTES == 8)
+#define LL_U256_MONT_WLEN 4
+
+/* rd = ad * bd * 2^(-256) mod Nd */
+void ll_u256_mont_mul(u64 rd[4], const u64 ad[4], const u64 bd[4],
+		      const u64 Nd[4], u64 k0);
+/* rd = ad^2 * 2^(-256) mod Nd */
+void ll_u256_mont_sqr(u64 rd[4], const u64 ad[4], const u64 Nd[4], u64 k0);
+/* rd = ad * 2^(-256) mod Nd */
+void ll_u256_mont_reduce(u64 rd[4], const u64 ad[4], const u64 Nd[4],
+			 u64 k0);
+
+/*
+ * Modular addition, subtraction, doubling, tripling and negation, used by
+ * the fp layer for 4 limbs primes (ll_u256_mod-riscv64.S on riscv64).
+ * Same contract as above, and done in constant time. These do not depend
+ * on the Montgomery representation.
+ */
+/* rd = ad + bd mod Nd */
+void ll_u256_mont_add(u64 rd[4], const u64 ad[4], const u64 bd[4],
+		      const u64 Nd[4]);
+/* rd = ad - bd mod Nd */
+void ll_u256_mont_sub(u64 rd[4], const u64 ad[4], const u64 bd[4],
+		      const u64 Nd[4]);
+/* rd = 2 * ad mod Nd */
+void ll_u256_mont_dbl(u64 rd[4], const u64 ad[4], const u64 Nd[4]);
+/* rd = 3 * ad mod Nd */
+void ll_u256_mont_tpl(u64 rd[4], const u64 ad[4], const u64 Nd[4]);
+/* rd = -ad mod Nd */
+void ll_u256_mont_neg(u64 rd[4], const u64 ad[4], const u64 Nd[4]);
+#endif
+
+#endif /* __LL_U256_MONT_H__ */
@@ -0,0 +1,115 @@
+/*
+ *  Copyright (C) 2017 - This file is part of libecc project
+ *
+ *  Authors:
+ *      Ryad BENADJILA <ryadbenadjila@gmail.com>
+ *      Arnaud EBALARD <arnaud.ebalard@ssi.gouv.fr>
+ *      Jean-Pierre FLORI <jean-pierre.flori@ssi.gouv.fr>
+ *
+ *  Contributors:
+ *      Nicolas VIVET <nicolas.vivet@ssi.gouv.fr>
+ *      Karim KHALFALLAH <karim.khalfallah@ssi.gouv.fr>
+ *
+ *  This software is licensed under a dual BSD and GPL v2 license.
+ *  See LICENSE file at the root folder of the project.
+ */
+#include "ll_u256_pt.h"
+
+/*
+ * Portable C implementation of the point formulas exported by
+ * ll_u256_pt-riscv64.S, on top of the ll_u256_mont kernels. This is what
+ * we link on 64-bit hosts that are not riscv64 when compiling with
+ * LIBECC_WITH_LL_U256_MONT=1.
+ */
+#if defined(WITH_LL_U256_MONT) && (WORD_BYTES == 8)
+
+#define X(p) (&(p)[0])
+#define Y(p) (&(p)[4])
+#define Z(p) (&(p)[8])
+
+void ll_u256_jprj_dbl_a3(u64 rd[12], const u64 ad[12], const u64 Nd[4],
+			 u64 k0)
+{
+	u64 z2[4], m[4], m2[4], y2[4], y4[4];
+
+	/* M = 3 * (X1 - Z1^2) * (X1 + Z1^2) */
+	ll_u256_mont_sqr(z2, Z(ad), Nd, k0);
+	ll_u256_mont_add(m, X(ad), z2, Nd);
+	ll_u256_mont_sub(m2, X(ad), z2, Nd);
+	ll_u256_mont_mul(m, m, m2, Nd, k0);
+	ll_u256_mont_tpl(m, m, Nd);
+	ll_u256_mont_sqr(m2, m, Nd, k0);
+
+	/* y2 = 4 * Y1^2, y4 = 8 * Y1^4 */
+	ll_u256_mont_sqr(y2, Y(ad), Nd, k0);
+	ll_u256_mont_dbl(y2, y2, Nd);
+	ll_u256_mont_sqr(y4, y2, Nd, k0);
+	ll_u256_mont_dbl(y4, y4, Nd);
+	ll_u256_mont_dbl(y2, y2, Nd);
+
+	/* S = 4 * X1 * Y1^2 */
+	ll_u256_mont_mul(y2, y2, X(ad), Nd, k0);
+
+	/* Z3 = 2 * Y1 * Z1, the last use of ad */
+	ll_u256_mont_mul(Z(rd), Z(ad), Y(ad), Nd, k0);
+	ll_u256_mont_dbl(Z(rd), Z(rd), Nd);
+
+	/* X3 = M^2 - 2 * S, Y3 = M * (S - X3) - 8 * Y1^4 */
+	ll_u256_mont_sub(X(rd), m2, y2, Nd);
+	ll_u256_mont_sub(X(rd), X(rd), y2, Nd);
+	ll_u256_mont_sub(Y(rd), y2, X(rd), Nd);
+	ll_u256_mont_mul(Y(rd), Y(rd), m, Nd, k0);
+	ll_u256_mont_sub(Y(rd), Y(rd), y4, Nd);
+}
+
+int ll_u256_jprj_add_mixed(u64 rd[12], const u64 ad[12], const u64 bd[8],
+			   const u64 Nd[4], u64 k0)
+{
+	u64 t[4], u2[4], s2[4], h[4], r[4], r2[4], h2[4], h3[4], u1[4];
+	u64 z;
+	int i;
+
+	/* H = x2 * Z1^2 - X1, R = y2 * Z1^3 - Y1 */
+	ll_u256_mont_sqr(t, Z(ad), Nd, k0);
+	ll_u256_mont_mul(u2, X(bd), t, Nd, k0);
+	ll_u256_mont_mul(t, t, Z(ad), Nd, k0);
+	ll_u256_mont_mul(s2, Y(bd), t, Nd, k0);
+	ll_u256_mont_sub(h, u2, X(ad), Nd);
+	ll_u256_mont_sub(r, s2, Y(ad), Nd);
+
+	z = 0;
+	for (i = 0; i < 4; i++) {
+		z |= h[i] | r[i];
+	}
+	if (z == 0) {
+		return 1;
+	}
+
+	ll_u256_mont_sqr(r2, r, Nd, k0);
+	ll_u256_mont_sqr(h2, h, Nd, k0);
+	ll_u256_mont_mul(h3, h2, h, Nd, k0);
+	ll_u256_mont_mul(u1, X(ad), h2, Nd, k0);
+	ll_u256_mont_mul(s2, Y(ad), h3, Nd, k0);
+
+	/* Z3 = Z1 * H, the last use of ad */
+	ll_u256_mont_mul(Z(rd), Z(ad), h, Nd, k0);
+
+	/* X3 = R^2 - H^3 - 2 * X1 * H^2 */
+	ll_u256_mont_sub(X(rd), r2, h3, Nd);
+	ll_u256_mont_sub(X(rd), X(rd), u1, Nd);
+	ll_u256_mont_sub(X(rd), X(rd), u1, Nd);
+
+	/* Y3 = R * (X1 * H^2 - X3) - Y1 * H^3 */
+	ll_u256_mont_sub(Y(rd), u1, X(rd), Nd);
+	ll_u256_mont_mul(Y(rd), Y(rd), r, Nd, k0);
+	ll_u256_mont_sub(Y(rd), Y(rd), s2, Nd);
+
+	return 0;
+}
+
+#else
+/*
+ * Dummy definition to avoid the empty translation unit ISO C warning
+ */
+typedef int dummy;
+#endif
@@ -0,0 +1,56 @@
+/*
+ *  Copyright (C) 2017 - This file is part of libecc project
+ *
+ *  Authors:
+ *      Ryad BENADJILA <ryadbenadjila@gmail.com>
+ *      Arnaud EBALARD <arnaud.ebalard@ssi.gouv.fr>
+ *      Jean-Pierre FLORI <jean-pierre.flori@ssi.gouv.fr>
+ *
+ *  Contributors:
+ *      Nicolas VIVET <nicolas.vivet@ssi.gouv.fr>
+ *      Karim KHALFALLAH <karim.khalfallah@ssi.gouv.fr>
+ *
+ *  This software is licensed under a dual BSD and GPL v2 license.
+ *  See LICENSE file at the root folder of the project.
+ */
+#ifndef __LL_U256_PT_H__
+#define __LL_U256_PT_H__
+#include "ll_u256_mont.h"
+
+/*
+ * Whole Jacobian point formulas for 4 x 64-bit limbs primes, on
+ * Montgomery representations, used by prj_pt_monty.c when the library is
+ * compiled with WITH_LL_U256_MONT. On riscv64, they are the assembly of
+ * ll_u256_pt-riscv64.S (generated by scripts/ll_mont_riscv64.py), where
+ * all the field operations are inlined with N and k0 kept in registers,
+ * and the intermediate results passed in registers between consecutive
+ * operations. Elsewhere, the portable C version (ll_u256_pt.c) chains the
+ * ll_u256_mont kernels.
+ *
+ * A point is given as its X, Y and Z coordinates (4 limbs each, in that
+ * order), an affine one as its x and y coordinates. Same contract as the
+ * ll_u256_mont kernels for the coordinates; the output may alias ad.
+ */
+#if defined(WITH_LL_U256_MONT) && (WORD_BYTES == 8)
+
+/*
+ * rd = 2 * ad for a = -3: M = 3 * (X1 - Z1^2) * (X1 + Z1^2),
+ * S = 4 * X1 * Y1^2, X3 = M^2 - 2 * S, Y3 = M * (S - X3) - 8 * Y1^4 and
+ * Z3 = 2 * Y1 * Z1. The point at infinity (Z1 = 0) gives Z3 = 0.
+ */
+void ll_u256_jprj_dbl_a3(u64 rd[12], const u64 ad[12], const u64 Nd[4],
+			 u64 k0);
+
+/*
+ * rd = ad + bd, bd being the affine point (x2, y2): H = x2 * Z1^2 - X1,
+ * R = y2 * Z1^3 - Y1, X3 = R^2 - H^3 - 2 * X1 * H^2,
+ * Y3 = R * (X1 * H^2 - X3) - Y1 * H^3 and Z3 = Z1 * H. When the points are
+ * equal (H = R = 0), 1 is returned and rd is left untouched: the caller
+ * must double instead. Otherwise, 0 is returned. ad must not be the point
+ * at infinity; opposite points give Z3 = 0.
+ */
+int ll_u256_jprj_add_mixed(u64 rd[12], const u64 ad[12], const u64 bd[8],
+			   const u64 Nd[4], u64 k0);
+#endif
+
+#endif /* __LL_U256_PT_H__ */
@@ -759,6 +759,167 @@ void nn_mod(nn_t r, nn_src_t a, nn_src_t b)
 	nn_uninit(&q);
 }
 
+#define NN_BARRETT_CTX_MAGIC ((word_t)(0x3c9d2e57a1f4b86dULL))
+
+void nn_barrett_ctx_check_initialized(nn_barrett_ctx_src_t ctx)
+{
+	MUST_HAVE((ctx != NULL) && (ctx->magic == NN_BARRETT_CTX_MAGIC));
+}
+
+int nn_barrett_ctx_is_initialized(nn_barrett_ctx_src_t ctx)
+{
+	return !!((ctx != NULL) && (ctx->magic == NN_BARRETT_CTX_MAGIC));
+}
+
+/*
+ * Initialize the Barrett context ctx for the modulus m, which must not be
+ * a power of B (curve orders never are), i.e. compute
+ * mu = floor(B^(2k) / m) where B = 2^WORD_BITS and k is the number of
+ * words of m. Not constant time, m being public.
+ */
+void nn_barrett_ctx_init(nn_barrett_ctx_t ctx, nn_src_t m)
+{
+	nn b2k, rem;
+	u8 k;
+
+	MUST_HAVE(ctx != NULL);
+	nn_check_initialized(m);
+
+	/* Number of significant words of m */
+	k = m->wlen;
+	while ((k > 0) && (m->val[k - 1] == 0)) {
+		k--;
+	}
+	MUST_HAVE(k > 0);
+	/* Room for the (2k + 2)-word products of nn_barrett_reduce() */
+	MUST_HAVE(((2 * (u16)k) + 2) <= NN_MAX_WORD_LEN);
+
+	nn_init(&(ctx->m), 0);
+	nn_copy(&(ctx->m), m);
+	nn_set_wlen(&(ctx->m), k);
+	ctx->k = k;
+
+	/* mu fits on k + 1 words unless m = B^(k - 1), which is rejected */
+	nn_init(&b2k, 0);
+	nn_set_wlen(&b2k, (u8)((2 * k) + 1));
+	b2k.val[2 * k] = WORD(1);
+	nn_divrem(&(ctx->mu), &rem, &b2k, &(ctx->m));
+	MUST_HAVE((ctx->mu.wlen <= (k + 1)) || (ctx->mu.val[k + 1] == 0));
+	nn_set_wlen(&(ctx->mu), (u8)(k + 1));
+	nn_uninit(&b2k);
+	nn_uninit(&rem);
+
+	ctx->magic = NN_BARRETT_CTX_MAGIC;
+}
+
+/*
+ * out = (a * b) mod B^olen for word arrays a and b of respectively alen
+ * and blen words (schoolbook). The loops only depend on the lengths.
+ */
+static void _nn_barrett_mul(word_t *out, u8 olen, const word_t *a, u8 alen,
+			    const word_t *b, u8 blen)
+{
+	word_t carry, prod_high, prod_low;
+	u8 i, j;
+
+	for (i = 0; i < olen; i++) {
+		out[i] = 0;
+	}
+	for (i = 0; (i < alen) && (i < olen); i++) {
+		carry = 0;
+		for (j = 0; (j < blen) && ((i + j) < olen); j++) {
+			WORD_MUL(prod_high, prod_low, a[i], b[j]);
+			prod_low = (word_t)(prod_low + carry);
+			prod_high = (word_t)(prod_high + (prod_low < carry));
+			out[i + j] = (word_t)(out[i + j] + prod_low);
+			carry = (word_t)(prod_high + (out[i + j] < prod_low));
+		}
+		if ((i + blen) < olen) {
+			out[i + blen] = carry;
+		}
+	}
+}
+
+/*
+ * out = a - b on len words, returning the borrow. Aliasing of out with
+ * the inputs is supported.
+ */
+static word_t _nn_barrett_sub(word_t *out, const word_t *a, const word_t *b,
+			      u8 len)
+{
+	word_t borrow = 0, diff, tmp_borrow;
+	u8 i;
+
+	for (i = 0; i < len; i++) {
+		diff = (word_t)(a[i] - b[i]);
+		tmp_borrow = (word_t)(diff > a[i]);
+		out[i] = (word_t)(diff - borrow);
+		borrow = (word_t)(tmp_borrow | (out[i] > diff));
+	}
+
+	return borrow;
+}
+
+/*
+ * Compute r = a mod m with the Barrett reduction (HAC 14.42) where m is
+ * the modulus of the Barrett context ctx. The reduction is done in
+ * constant time for inputs of at most 2k words (k being the number of
+ * words of m), which covers products of two reduced values and digests
+ * of up to twice the size of m. Larger inputs (only seen with digests
+ * much longer than m) are reduced with nn_mod(), whose timing then only
+ * depends on the public length of the input. Aliasing of r and a is
+ * supported.
+ */
+void nn_barrett_reduce(nn_t r, nn_src_t a, nn_barrett_ctx_src_t ctx)
+{
+	word_t q1[NN_MAX_WORD_LEN], q2[NN_MAX_WORD_LEN], res[NN_MAX_WORD_LEN];
+	word_t tmp[NN_MAX_WORD_LEN];
+	word_t borrow, mask;
+	const word_t *m, *mu;
+	u8 i, j, k;
+
+	nn_barrett_ctx_check_initialized(ctx);
+	nn_check_initialized(a);
+
+	k = ctx->k;
+	if (a->wlen > (2 * k)) {
+		nn_mod(r, a, &(ctx->m));
+		return;
+	}
+	m = ctx->m.val;
+	mu = ctx->mu.val;
+
+	/* q1 = floor(a / B^(k - 1)), on k + 1 words (words of a above wlen are 0) */
+	for (i = 0; i <= k; i++) {
+		q1[i] = a->val[k - 1 + i];
+	}
+	/* q3 = floor(q1 * mu / B^(k + 1)), stored in q2[k + 1 .. 2k + 1] */
+	_nn_barrett_mul(q2, (u8)((2 * k) + 2), q1, (u8)(k + 1), mu, (u8)(k + 1));
+	/* tmp = (q3 * m) mod B^(k + 1) */
+	_nn_barrett_mul(tmp, (u8)(k + 1), &q2[k + 1], (u8)(k + 1), m, k);
+	/* res = (a - q3 * m) mod B^(k + 1), which is < 3m */
+	_nn_barrett_sub(res, a->val, tmp, (u8)(k + 1));
+
+	/*
+	 * At most two subtractions of m, always performed (word k of m is
+	 * zero since ctx->m is trimmed to k words).
+	 */
+	for (j = 0; j < 2; j++) {
+		borrow = _nn_barrett_sub(tmp, res, m, (u8)(k + 1));
+		/* Keep res - m when there is no borrow, i.e. when res >= m */
+		mask = WORD_MASK_IFZERO(borrow);
+		for (i = 0; i <= k; i++) {
+			res[i] = (res[i] & ~mask) | (tmp[i] & mask);
+		}
+	}
+
+	nn_init(r, 0);
+	nn_set_wlen(r, k);
+	for (i = 0; i < k; i++) {
+		r->val[i] = res[i];
+	}
+}
+
 /*
  * Below follow gcd and xgcd non constant time functions for the user ease.
  */
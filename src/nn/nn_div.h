@@ -35,6 +35,29 @@ word_t wreciprocal(word_t dh, word_t dl);
 void nn_compute_div_coefs(nn_t p_normalized, word_t *p_shift,
 			  word_t *p_reciprocal, nn_src_t p_in);
 
+/*
+ * Barrett context for reductions modulo a fixed number m (e.g. the order
+ * q of a curve): mu = floor(B^(2k) / m) where B = 2^WORD_BITS and k is
+ * the number of words of m.
+ */
+typedef struct {
+	/* The modulus, trimmed to its k significant words */
+	nn m;
+	/* mu, on k + 1 words */
+	nn mu;
+	u8 k;
+
+	word_t magic;
+} nn_barrett_ctx;
+
+typedef nn_barrett_ctx *nn_barrett_ctx_t;
+typedef const nn_barrett_ctx *nn_barrett_ctx_src_t;
+
+void nn_barrett_ctx_check_initialized(nn_barrett_ctx_src_t ctx);
+int nn_barrett_ctx_is_initialized(nn_barrett_ctx_src_t ctx);
+void nn_barrett_ctx_init(nn_barrett_ctx_t ctx, nn_src_t m);
+void nn_barrett_reduce(nn_t r, nn_src_t a, nn_barrett_ctx_src_t ctx);
+
 /* Compute gcd of a and b */
 void nn_gcd(nn_t d, nn_src_t a, nn_src_t b);
 int nn_xgcd(nn_t g, nn_t u, nn_t v, nn_src_t a, nn_src_t b);
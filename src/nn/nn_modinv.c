@@ -36,8 +36,11 @@
  * and performs reduction modulo m at each step.
  *
  * This does not normalize out on return.
+ *
+ * This was our odd modulus inversion before the divsteps based one
+ * below, it is kept as a reference (see the modinv benchmark).
  */
-static int nn_modinv_odd(nn_t out, nn_src_t x, nn_src_t m)
+int nn_modinv_binxgcd(nn_t out, nn_src_t x, nn_src_t m)
 {
 	int odd, swap, smaller, ret;
 	nn a, b, u, tmp, mp1d2;
@@ -180,10 +183,346 @@ static int nn_modinv_odd(nn_t out, nn_src_t x, nn_src_t m)
 	return ret;
 }
 
+/*
+ * Constant time inversion modulo an odd m using the safegcd algorithm
+ * of Bernstein and Yang ("Fast constant-time gcd computation and modular
+ * inversion", 2019), following the structure of the libsecp256k1
+ * implementation.
+ *
+ * The divsteps are performed in batches of SAFEGCD_LIMB_BITS steps on the
+ * low limbs of f and g only, yielding a 2x2 transition matrix (scaled by
+ * 2^SAFEGCD_LIMB_BITS) which is then applied to the full (f, g) and (d, e)
+ * values. These are stored as signed limbs of SAFEGCD_LIMB_BITS bits: all
+ * the limbs are in [0, 2^SAFEGCD_LIMB_BITS) except the top one which is
+ * signed. We use 62-bit limbs with 128-bit products when available on 64-bit
+ * words builds, and 30-bit limbs with 64-bit products otherwise.
+ *
+ * NOTE: signed right shifts are expected to be arithmetic ones, which is
+ * the case with all the compilers we support.
+ */
+#if (WORD_BYTES == 8) && defined(__SIZEOF_INT128__)
+#define SAFEGCD_LIMB_BITS 62
+typedef long long sg_limb;
+__extension__ typedef __int128 sg_dlimb;
+#else
+#define SAFEGCD_LIMB_BITS 30
+typedef long long sg_limb;
+typedef long long sg_dlimb;
+#endif
+#define SAFEGCD_LIMB_MASK ((sg_limb)((((u64)1) << SAFEGCD_LIMB_BITS) - 1))
+/* Sign mask (all ones if negative) of a signed limb */
+#define SAFEGCD_SIGN(a) ((a) >> 63)
+/* Enough limbs to hold (with a sign bit) any nn and twice our modulus */
+#define SAFEGCD_MAX_LIMBS (((NN_MAX_BIT_LEN + 2) / SAFEGCD_LIMB_BITS) + 1)
+
+/* Get bits [pos, pos + len) of in, with len <= 64 */
+static u64 _safegcd_get_bits(nn_src_t in, bitcnt_t pos, bitcnt_t len)
+{
+	u64 res = 0;
+	word_t w;
+	bitcnt_t got = 0, off, take;
+	unsigned int idx;
+
+	while (got < len) {
+		idx = (unsigned int)(pos + got) / WORD_BITS;
+		off = (bitcnt_t)((pos + got) % WORD_BITS);
+		if (idx >= NN_MAX_WORD_LEN) {
+			break;
+		}
+		take = (bitcnt_t)(WORD_BITS - off);
+		if (take > (len - got)) {
+			take = (bitcnt_t)(len - got);
+		}
+		w = (word_t)(in->val[idx] >> off);
+		if (take < WORD_BITS) {
+			w &= (word_t)((WORD(1) << take) - WORD(1));
+		}
+		res |= ((u64)w) << got;
+		got = (bitcnt_t)(got + take);
+	}
+
+	return res;
+}
+
+/* OR the len low bits of v into out at bit position pos */
+static void _safegcd_set_bits(nn_t out, bitcnt_t pos, bitcnt_t len, u64 v)
+{
+	bitcnt_t done = 0, off, take;
+	unsigned int idx;
+
+	while (done < len) {
+		idx = (unsigned int)(pos + done) / WORD_BITS;
+		off = (bitcnt_t)((pos + done) % WORD_BITS);
+		if (idx >= out->wlen) {
+			break;
+		}
+		take = (bitcnt_t)(WORD_BITS - off);
+		if (take > (len - done)) {
+			take = (bitcnt_t)(len - done);
+		}
+		out->val[idx] |= (word_t)(((word_t)(v >> done)) << off);
+		done = (bitcnt_t)(done + take);
+	}
+}
+
+/*
+ * Bit length of m (which is public, hence no need for constant time
+ * here).
+ */
+static bitcnt_t _safegcd_bitlen(nn_src_t m)
+{
+	word_t w;
+	bitcnt_t len;
+	u8 i;
+
+	for (i = m->wlen; i > 0; i--) {
+		w = m->val[i - 1];
+		if (w != 0) {
+			len = (bitcnt_t)((i - 1) * WORD_BITS);
+			while (w != 0) {
+				len++;
+				w >>= 1;
+			}
+			return len;
+		}
+	}
+
+	return 0;
+}
+
+/* Propagate the carries so that all the limbs but the top one are reduced */
+static void _safegcd_carry(sg_limb *a, unsigned int n)
+{
+	unsigned int i;
+
+	for (i = 0; i < (n - 1); i++) {
+		a[i + 1] += (a[i] >> SAFEGCD_LIMB_BITS);
+		a[i] &= SAFEGCD_LIMB_MASK;
+	}
+}
+
+/* a = a + (M & mask), mask being 0 or all ones */
+static void _safegcd_cnd_add(sg_limb *a, const sg_limb *M, sg_limb mask,
+			     unsigned int n)
+{
+	unsigned int i;
+
+	for (i = 0; i < n; i++) {
+		a[i] += (M[i] & mask);
+	}
+	_safegcd_carry(a, n);
+}
+
+/* a = -a if mask is all ones, a if mask is 0 */
+static void _safegcd_cnd_neg(sg_limb *a, sg_limb mask, unsigned int n)
+{
+	unsigned int i;
+
+	for (i = 0; i < n; i++) {
+		a[i] = (a[i] ^ mask) - mask;
+	}
+	_safegcd_carry(a, n);
+}
+
+/*
+ * Perform SAFEGCD_LIMB_BITS divsteps on the low limbs of f and g, starting
+ * with eta = -delta, in constant time. The transition matrix (u, v, q, r)
+ * scaled by 2^SAFEGCD_LIMB_BITS is returned in t, and the new eta is
+ * returned.
+ */
+static sg_limb _safegcd_divsteps(sg_limb eta, u64 f0, u64 g0, sg_limb t[4])
+{
+	u64 u = 1, v = 0, q = 0, r = 1;
+	u64 f = f0, g = g0, c1, c2, x, y, z;
+	unsigned int i;
+
+	for (i = 0; i < SAFEGCD_LIMB_BITS; i++) {
+		/* Masks for (eta < 0) and (g odd) */
+		c1 = (u64)SAFEGCD_SIGN(eta);
+		c2 = (u64)0 - (g & 1);
+		/* Conditionally negated f, u, v */
+		x = (f ^ c1) - c1;
+		y = (u ^ c1) - c1;
+		z = (v ^ c1) - c1;
+		/* If g is odd, add them to g, q, r */
+		g += (x & c2);
+		q += (y & c2);
+		r += (z & c2);
+		/* Swap case, i.e. (eta < 0) and (g odd) */
+		c1 &= c2;
+		eta = (eta ^ (sg_limb)c1) - ((sg_limb)c1 + 1);
+		f += (g & c1);
+		u += (q & c1);
+		v += (r & c1);
+		g >>= 1;
+		u <<= 1;
+		v <<= 1;
+	}
+	t[0] = (sg_limb)u;
+	t[1] = (sg_limb)v;
+	t[2] = (sg_limb)q;
+	t[3] = (sg_limb)r;
+
+	return eta;
+}
+
+/*
+ * (d, e) = t * (d, e) / 2^SAFEGCD_LIMB_BITS mod M, where the division is
+ * made exact by adding the proper multiples of M. d and e are kept in
+ * the range (-2M, M).
+ */
+static void _safegcd_update_de(sg_limb *d, sg_limb *e, const sg_limb t[4],
+			       const sg_limb *M, u64 minv, unsigned int n)
+{
+	const sg_limb u = t[0], v = t[1], q = t[2], r = t[3];
+	sg_limb md, me, sd, se;
+	sg_dlimb cd, ce;
+	unsigned int i;
+
+	/* Start with M * (u, q) if d < 0 and M * (v, r) if e < 0 */
+	sd = SAFEGCD_SIGN(d[n - 1]);
+	se = SAFEGCD_SIGN(e[n - 1]);
+	md = (u & sd) + (v & se);
+	me = (q & sd) + (r & se);
+	cd = ((sg_dlimb)u * d[0]) + ((sg_dlimb)v * e[0]);
+	ce = ((sg_dlimb)q * d[0]) + ((sg_dlimb)r * e[0]);
+	/* Fix md and me so that the low limb vanishes */
+	md -= (sg_limb)((minv * (u64)cd + (u64)md) & (u64)SAFEGCD_LIMB_MASK);
+	me -= (sg_limb)((minv * (u64)ce + (u64)me) & (u64)SAFEGCD_LIMB_MASK);
+	cd += (sg_dlimb)M[0] * md;
+	ce += (sg_dlimb)M[0] * me;
+	cd >>= SAFEGCD_LIMB_BITS;
+	ce >>= SAFEGCD_LIMB_BITS;
+	for (i = 1; i < n; i++) {
+		cd += ((sg_dlimb)u * d[i]) + ((sg_dlimb)v * e[i]) +
+		      ((sg_dlimb)M[i] * md);
+		ce += ((sg_dlimb)q * d[i]) + ((sg_dlimb)r * e[i]) +
+		      ((sg_dlimb)M[i] * me);
+		d[i - 1] = (sg_limb)cd & SAFEGCD_LIMB_MASK;
+		e[i - 1] = (sg_limb)ce & SAFEGCD_LIMB_MASK;
+		cd >>= SAFEGCD_LIMB_BITS;
+		ce >>= SAFEGCD_LIMB_BITS;
+	}
+	d[n - 1] = (sg_limb)cd;
+	e[n - 1] = (sg_limb)ce;
+}
+
+/* (f, g) = t * (f, g) / 2^SAFEGCD_LIMB_BITS, the division being exact */
+static void _safegcd_update_fg(sg_limb *f, sg_limb *g, const sg_limb t[4],
+			       unsigned int n)
+{
+	const sg_limb u = t[0], v = t[1], q = t[2], r = t[3];
+	sg_dlimb cf, cg;
+	unsigned int i;
+
+	cf = ((sg_dlimb)u * f[0]) + ((sg_dlimb)v * g[0]);
+	cg = ((sg_dlimb)q * f[0]) + ((sg_dlimb)r * g[0]);
+	cf >>= SAFEGCD_LIMB_BITS;
+	cg >>= SAFEGCD_LIMB_BITS;
+	for (i = 1; i < n; i++) {
+		cf += ((sg_dlimb)u * f[i]) + ((sg_dlimb)v * g[i]);
+		cg += ((sg_dlimb)q * f[i]) + ((sg_dlimb)r * g[i]);
+		f[i - 1] = (sg_limb)cf & SAFEGCD_LIMB_MASK;
+		g[i - 1] = (sg_limb)cg & SAFEGCD_LIMB_MASK;
+		cf >>= SAFEGCD_LIMB_BITS;
+		cg >>= SAFEGCD_LIMB_BITS;
+	}
+	f[n - 1] = (sg_limb)cf;
+	g[n - 1] = (sg_limb)cg;
+}
+
+/*
+ * Compute out = x^-1 mod m for an odd m and x < m with the safegcd
+ * algorithm. out is initialized by the function.
+ * Done in *constant time*: the number of divsteps only depends on the
+ * bit length of m (using the Bernstein-Yang bound (49d + 80) / 17).
+ *
+ * Return 0 if x has no reciprocal modulo m (out is zeroed), 1 otherwise.
+ */
+static int nn_modinv_odd(nn_t out, nn_src_t x, nn_src_t m)
+{
+	sg_limb f[SAFEGCD_MAX_LIMBS], g[SAFEGCD_MAX_LIMBS];
+	sg_limb d[SAFEGCD_MAX_LIMBS], e[SAFEGCD_MAX_LIMBS];
+	sg_limb M[SAFEGCD_MAX_LIMBS], t[4];
+	sg_limb eta = -1, sign, acc;
+	u64 minv;
+	bitcnt_t m_bitlen;
+	unsigned int i, n, rounds;
+	int ret;
+
+	MUST_HAVE(nn_isodd(m));
+	MUST_HAVE(nn_cmp(x, m) < 0);
+
+	m_bitlen = _safegcd_bitlen(m);
+	n = ((m_bitlen + 2) / SAFEGCD_LIMB_BITS) + 1;
+	MUST_HAVE(n <= SAFEGCD_MAX_LIMBS);
+	rounds = ((((49 * (u32)m_bitlen) + 80) / 17) + SAFEGCD_LIMB_BITS - 1) /
+		 SAFEGCD_LIMB_BITS;
+
+	/* f = m, g = x, d = 0, e = 1 */
+	for (i = 0; i < n; i++) {
+		M[i] = (sg_limb)_safegcd_get_bits(m, (bitcnt_t)(i * SAFEGCD_LIMB_BITS),
+						  SAFEGCD_LIMB_BITS);
+		f[i] = M[i];
+		g[i] = (sg_limb)_safegcd_get_bits(x, (bitcnt_t)(i * SAFEGCD_LIMB_BITS),
+						  SAFEGCD_LIMB_BITS);
+		d[i] = 0;
+		e[i] = 0;
+	}
+	e[0] = 1;
+
+	/* minv = m^-1 mod 2^SAFEGCD_LIMB_BITS with Newton iterations */
+	minv = (u64)M[0];
+	for (i = 0; i < 5; i++) {
+		minv *= 2 - ((u64)M[0] * minv);
+	}
+	minv &= (u64)SAFEGCD_LIMB_MASK;
+
+	/*
+	 * Maintain d * x = f mod m and e * x = g mod m. In the end g = 0
+	 * and f = +/-gcd(x, m).
+	 */
+	for (i = 0; i < rounds; i++) {
+		eta = _safegcd_divsteps(eta, (u64)f[0], (u64)g[0], t);
+		_safegcd_update_de(d, e, t, M, minv, n);
+		_safegcd_update_fg(f, g, t, n);
+	}
+
+	acc = 0;
+	for (i = 0; i < n; i++) {
+		acc |= g[i];
+	}
+	MUST_HAVE(acc == 0);
+
+	/* Check that |f| = 1, i.e. that x is invertible */
+	sign = SAFEGCD_SIGN(f[n - 1]);
+	_safegcd_cnd_neg(f, sign, n);
+	acc = f[0] ^ 1;
+	for (i = 1; i < n; i++) {
+		acc |= f[i];
+	}
+	ret = (acc == 0);
+
+	/* out = sign(f) * d mod m, with d in (-2m, m) */
+	_safegcd_cnd_add(d, M, SAFEGCD_SIGN(d[n - 1]), n);
+	_safegcd_cnd_neg(d, sign, n);
+	_safegcd_cnd_add(d, M, SAFEGCD_SIGN(d[n - 1]), n);
+
+	/* If not invertible, set "inverse" to zero */
+	nn_init(out, (u16)(m->wlen * WORD_BYTES));
+	for (i = 0; i < n; i++) {
+		d[i] &= ((sg_limb)0 - (sg_limb)ret);
+		_safegcd_set_bits(out, (bitcnt_t)(i * SAFEGCD_LIMB_BITS),
+				  SAFEGCD_LIMB_BITS, (u64)d[i]);
+	}
+
+	return ret;
+}
+
 /*
  * Same as above without restriction on m.
  * No attempt to make it constant time.
- * Uses the above constant-time binary xgcd when m is odd
+ * Uses the above constant-time safegcd when m is odd
  * and a not constant time plain Euclidean xgcd when m is even.
  *
  * Return 0 if x has no reciprocal modulo m, out is zeroed.
@@ -242,6 +581,180 @@ int nn_modinv(nn_t out, nn_src_t x, nn_src_t m)
 	return ret;
 }
 
+/*
+ * Compute out = x^-1 mod m where m is the (odd) modulus of the Montgomery
+ * context ctx and x < m, in constant time. Contrary to nn_modinv(), out
+ * can alias x.
+ *
+ * Return 0 if x has no reciprocal modulo m (out is zeroed), 1 otherwise.
+ */
+int nn_modinv_ctx(nn_t out, nn_src_t x, nn_mod_ctx_src_t ctx)
+{
+	nn_mod_ctx_check_initialized(ctx);
+	nn_check_initialized(x);
+
+	return nn_modinv_odd(out, x, &(ctx->m));
+}
+
+/*
+ * Compute out = x^-1 mod m as x^(m - 2) where m is the prime modulus of
+ * the Montgomery context ctx and x < m, using the addition chain attached
+ * to ctx (see nn_mod_ctx_set_inv_chain()). The exponentiation is constant
+ * time; without chain, this falls back to nn_modinv_ctx(). Aliasing of
+ * out and x is supported.
+ *
+ * Return 0 if x is 0 (out is then 0), 1 otherwise.
+ */
+int nn_modinv_fixed(nn_t out, nn_src_t x, nn_mod_ctx_src_t ctx)
+{
+	nn tmp;
+
+	nn_mod_ctx_check_initialized(ctx);
+	nn_check_initialized(x);
+
+	if (ctx->inv_chain == NULL) {
+		return nn_modinv_ctx(out, x, ctx);
+	}
+
+	nn_mul_redc1(&tmp, x, &(ctx->r_square), &(ctx->m), ctx->mpinv);
+	nn_pow_redc1_chain(&tmp, &tmp, ctx->inv_chain, ctx->inv_chain_len,
+			   &(ctx->m), ctx->mpinv);
+	nn_redc1(out, &tmp, &(ctx->m), ctx->mpinv);
+	nn_uninit(&tmp);
+
+	return !nn_iszero(out);
+}
+
+/*
+ * Return a mask with all bits set if in is zero, 0 otherwise. Done in
+ * constant time.
+ */
+static word_t _nn_zero_mask(nn_src_t in)
+{
+	word_t acc = WORD(0);
+	u8 i;
+
+	for (i = 0; i < in->wlen; i++) {
+		acc |= in->val[i];
+	}
+
+	return WORD_MASK_IFZERO(acc);
+}
+
+/*
+ * out = in, or one if in is zero and zero_ok is set. Done in constant
+ * time, out having the length of m.
+ */
+static void _nn_batch_modinv_get(nn_t out, nn_src_t in, nn_src_t m,
+				 int zero_ok)
+{
+	word_t mask = zero_ok ? _nn_zero_mask(in) : WORD(0);
+
+	nn_copy(out, in);
+	nn_set_wlen(out, m->wlen);
+	out->val[0] |= (WORD(1) & mask);
+}
+
+/* out = (in1 * in2) mod m */
+static void _nn_batch_modinv_mul(nn_t out, nn_src_t in1, nn_src_t in2,
+				 nn_src_t m)
+{
+	nn prod;
+
+	nn_init(&prod, 0);
+	nn_mul(&prod, in1, in2);
+	nn_mod(out, &prod, m);
+	nn_uninit(&prod);
+}
+
+/*
+ * Montgomery's trick, see fp_batch_inv() for details. The prefix
+ * products are stored in out, hence no out[i] can alias an in[j].
+ */
+static int _nn_batch_modinv(nn_t *out, nn_src_t *in, size_t n, nn_src_t m,
+			    int zero_ok)
+{
+	nn inv, tmp;
+	word_t mask, zeros = WORD(0);
+	size_t i;
+	int ret;
+	u8 j;
+
+	MUST_HAVE((out != NULL) && (in != NULL));
+	nn_check_initialized(m);
+	if (n == 0) {
+		return 1;
+	}
+	for (i = 0; i < n; i++) {
+		nn_check_initialized(in[i]);
+		MUST_HAVE(nn_cmp(in[i], m) < 0);
+		MUST_HAVE((nn_src_t)out[i] != in[i]);
+		nn_init(out[i], 0);
+	}
+
+	nn_init(&inv, 0);
+	nn_init(&tmp, 0);
+
+	/* out[i] = in[0] * ... * in[i] mod m */
+	_nn_batch_modinv_get(out[0], in[0], m, zero_ok);
+	for (i = 1; i < n; i++) {
+		_nn_batch_modinv_get(&tmp, in[i], m, zero_ok);
+		_nn_batch_modinv_mul(out[i], out[i - 1], &tmp, m);
+	}
+
+	ret = nn_modinv(&inv, out[n - 1], m);
+
+	/* in[i]^-1 = out[i - 1] * (in[0] * ... * in[i])^-1 */
+	for (i = n - 1; i > 0; i--) {
+		_nn_batch_modinv_get(&tmp, in[i], m, zero_ok);
+		_nn_batch_modinv_mul(out[i], out[i - 1], &inv, m);
+		_nn_batch_modinv_mul(&inv, &inv, &tmp, m);
+	}
+	nn_copy(out[0], &inv);
+
+	/*
+	 * Zero inputs get a zero "inverse", and everything is zeroed if
+	 * some input is not invertible.
+	 */
+	for (i = 0; i < n; i++) {
+		mask = zero_ok ? _nn_zero_mask(in[i]) : WORD(0);
+		zeros |= mask;
+		mask |= WORD_MASK_IFZERO(ret);
+		for (j = 0; j < out[i]->wlen; j++) {
+			out[i]->val[j] &= ~mask;
+		}
+	}
+
+	nn_uninit(&inv);
+	nn_uninit(&tmp);
+
+	return ret && (zeros == WORD(0));
+}
+
+/*
+ * Batch inversion: out[i] = in[i]^-1 mod m for 0 <= i < n, for the cost
+ * of one inversion and 3(n-1) modular multiplications. The inputs must
+ * be smaller than m, and no out[i] can alias an in[j] (out elements are
+ * initialized by the function).
+ *
+ * Return 1 if all the inputs are invertible. Otherwise, 0 is returned
+ * and all the outputs are zeroed.
+ */
+int nn_batch_modinv(nn_t *out, nn_src_t *in, size_t n, nn_src_t m)
+{
+	return _nn_batch_modinv(out, in, n, m, 0);
+}
+
+/*
+ * Same as nn_batch_modinv() but zero inputs get a zero output (the
+ * other outputs being valid), without leaking which inputs were zero.
+ * Return 1 if all the inputs are invertible, 0 otherwise.
+ */
+int nn_batch_modinv_ct(nn_t *out, nn_src_t *in, size_t n, nn_src_t m)
+{
+	return _nn_batch_modinv(out, in, n, m, 1);
+}
+
 /*
  * Compute (A - B) % 2^(storagebitsizeof(B) + 1).
  * No assumption on A and B such as A >= B.
@@ -16,8 +16,14 @@
 #ifndef __NN_MODINV_H__
 #define __NN_MODINV_H__
 #include "nn.h"
+#include "nn_mul_redc1.h"
 
 int nn_modinv(nn_t out, nn_src_t x, nn_src_t m);
+int nn_modinv_binxgcd(nn_t out, nn_src_t x, nn_src_t m);
+int nn_modinv_ctx(nn_t out, nn_src_t x, nn_mod_ctx_src_t ctx);
+int nn_modinv_fixed(nn_t out, nn_src_t x, nn_mod_ctx_src_t ctx);
+int nn_batch_modinv(nn_t *out, nn_src_t *in, size_t n, nn_src_t m);
+int nn_batch_modinv_ct(nn_t *out, nn_src_t *in, size_t n, nn_src_t m);
 int nn_modinv_2exp(nn_t out, nn_src_t in, bitcnt_t exp);
 
 #endif /* __NN_MODINV_H__ */
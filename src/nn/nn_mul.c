@@ -18,43 +18,92 @@
 #include "nn.h"
 
 /*
- * Compute out = (in1 * in2) & (2^(WORD_BYTES * wlimits) - 1).
+ * Comba (product scanning) accumulation, used by the unrolled routines of
+ * nn_mul_comba.h: the words of the result are computed one after the
+ * other, by summing all the products in1[i] * in2[j] with i + j = k in a
+ * three words accumulator (c2, c1, c0) before writing out[k], so that
+ * the partial result is never read back from memory.
+ *
+ * Add the two words product a * b to the accumulator, which cannot
+ * overflow as long as less than B = 2^WORD_BITS products are summed.
+ * When the compiler provides double words (see WORD_MUL), (c1, c0) is a
+ * double word.
+ */
+#ifdef __GNUC__
+#define COMBA_MULADD(c2, c1, c0, a, b) do {				\
+	dword_t _p = (dword_t)(a) * (b);				\
+	dword_t _acc = (((dword_t)(c1)) << WORD_BITS) | (c0);		\
+	_acc += _p;							\
+	(c2) += _acc < _p;						\
+	(c0) = (word_t)_acc;						\
+	(c1) = (word_t)(_acc >> WORD_BITS);				\
+	} while (0)
+#else
+#define COMBA_MULADD(c2, c1, c0, a, b) do {				\
+	word_t _ph, _pl;						\
+	WORD_MUL(_ph, _pl, (a), (b));					\
+	(c0) += _pl;							\
+	_ph += (c0) < _pl;						\
+	(c1) += _ph;							\
+	(c2) += (c1) < _ph;						\
+	} while (0)
+#endif
+
+/* out = c0, the accumulator being shifted by one word */
+#define COMBA_NEXT(out, c2, c1, c0) do {				\
+	(out) = (c0);							\
+	(c0) = (c1);							\
+	(c1) = (c2);							\
+	(c2) = 0;							\
+	} while (0)
+
+/* (c2, c1, c0) += 2 * (d2, d1, d0), d being modified */
+#define COMBA_DBLADD(c2, c1, c0, d2, d1, d0) do {			\
+	(d2) = (word_t)(((d2) << 1) | ((d1) >> (WORD_BITS - 1)));	\
+	(d1) = (word_t)(((d1) << 1) | ((d0) >> (WORD_BITS - 1)));	\
+	(d0) = (word_t)((d0) << 1);					\
+	(c0) = (word_t)((c0) + (d0));					\
+	(d1) = (word_t)((d1) + ((c0) < (d0)));				\
+	(d2) = (word_t)((d2) + ((d1) < ((c0) < (d0))));			\
+	(c1) = (word_t)((c1) + (d1));					\
+	(c2) = (word_t)((c2) + (d2) + ((c1) < (d1)));			\
+	} while (0)
+
+/* Unrolled versions for the limb counts of the enabled curves */
+#include "nn_mul_comba.h"
+
+/*
+ * Compute out = (in1 * in2) & (2^(WORD_BYTES * wlimits) - 1) on raw word
+ * arrays, in1 being len1 words, in2 len2 words and out wlimit words (not
+ * aliasing the inputs).
  *
  * The function is constant time for all sets of parameters of given
  * lengths.
  *
- * Implementation: while most generic library implement some advanced
- * algorithm (Karatsuba, Toom-Cook, or FFT based algorithms)
- * which provide a performance advantage for large numbers, the code
- * below is mainly oriented towards simplicity and readibility. It is
- * a direct writing of the naive multiplication algorithm one has
- * learned in school.
+ * Implementation: a direct writing of the naive multiplication
+ * algorithm one has learned in school. This is the base case for the
+ * lengths which have no unrolled Comba routine, Karatsuba being used
+ * from NN_KARATSUBA_THRESHOLD words (see nn_mul.h).
  *
  * Portability: in order for the code to be portable, all word by
  * word multiplication are actually performed by an helper macro
  * on half words.
- *
- * Note: 'out' is initialized by the function (caller can omit it)
  */
-
-static void _nn_mul_low(nn_t out, nn_src_t in1, nn_src_t in2,
-			u8 wlimit)
+static void _nn_mul_school_words(word_t *out, const word_t *in1, u8 len1,
+				 const word_t *in2, u8 len2, u8 wlimit)
 {
 	word_t carry, prod_high, prod_low;
 	u8 i, j, pos;
 
-	nn_check_initialized(in1);
-	nn_check_initialized(in2);
-
-	/* We have to check that wlimit does not exceed our NN_MAX_WORD_LEN */
-	MUST_HAVE((wlimit * WORD_BYTES) <= NN_MAX_BYTE_LEN);
-	nn_init(out, (u16)(wlimit * WORD_BYTES));
+	for (i = 0; i < wlimit; i++) {
+		out[i] = 0;
+	}
 
-	for (i = 0; i < in1->wlen; i++) {
+	for (i = 0; i < len1; i++) {
 		carry = 0;
 		pos = 0;
 
-		for (j = 0; j < in2->wlen; j++) {
+		for (j = 0; j < len2; j++) {
 			pos = i + j;
 
 			/*
@@ -70,8 +119,7 @@ static void _nn_mul_low(nn_t out, nn_src_t in1, nn_src_t in2,
 			 * Compute the result of the multiplication of
 			 * two words.
 			 */
-			WORD_MUL(prod_high, prod_low,
-				 in1->val[i], in2->val[j]);
+			WORD_MUL(prod_high, prod_low, in1[i], in2[j]);
 			/*
 			 * And add previous carry.
 			 */
@@ -82,8 +130,8 @@ static void _nn_mul_low(nn_t out, nn_src_t in1, nn_src_t in2,
 			 * Add computed word to what we can currently
 			 * find at current position in result.
 			 */
-			out->val[pos] += prod_low;
-			carry = prod_high + (out->val[pos] < prod_low);
+			out[pos] += prod_low;
+			carry = prod_high + (out[pos] < prod_low);
 		}
 
 		/*
@@ -91,8 +139,318 @@ static void _nn_mul_low(nn_t out, nn_src_t in1, nn_src_t in2,
 		 * be added to next word after pos in result.
 		 */
 		if ((pos + 1) < wlimit) {
-			out->val[pos + 1] += carry;
+			out[pos + 1] += carry;
+		}
+	}
+}
+
+/*
+ * Compute out = (in * in) & (2^(WORD_BYTES * wlimits) - 1) on raw word
+ * arrays, in being len words and out wlimit words (not aliasing in).
+ *
+ * The function is constant time for all sets of parameters of given
+ * lengths.
+ *
+ * Implementation: each cross product in[i] * in[j] with i < j appears
+ * twice in the square. They are only computed once, the sum being then
+ * doubled with a one bit shift before the diagonal products in[i]^2 are
+ * added. This needs about n^2 / 2 + n word multiplications instead of
+ * n^2 for the multiplication of in by itself.
+ */
+static void _nn_sqr_school_words(word_t *out, const word_t *in, u8 len,
+				 u8 wlimit)
+{
+	word_t carry, prod_high, prod_low, top, msb;
+	u8 i, j, pos;
+
+	for (i = 0; i < wlimit; i++) {
+		out[i] = 0;
+	}
+
+	/* Cross products */
+	for (i = 0; i < len; i++) {
+		carry = 0;
+
+		for (j = (u8)(i + 1); j < len; j++) {
+			pos = i + j;
+
+			if (pos >= wlimit) {
+				continue;
+			}
+
+			WORD_MUL(prod_high, prod_low, in[i], in[j]);
+			prod_low += carry;
+			prod_high += prod_low < carry;
+			out[pos] += prod_low;
+			carry = prod_high + (out[pos] < prod_low);
+		}
+
+		/* Position i + len has not been written by previous rows */
+		if ((i + len) < wlimit) {
+			out[i + len] += carry;
+		}
+	}
+
+	/* Double them */
+	top = 0;
+	for (i = 0; i < wlimit; i++) {
+		msb = out[i] >> (WORD_BITS - 1);
+		out[i] = (word_t)((out[i] << 1) | top);
+		top = msb;
+	}
+
+	/* Add the diagonal products */
+	carry = 0;
+	for (i = 0; i < len; i++) {
+		pos = (u8)(2 * i);
+
+		WORD_MUL(prod_high, prod_low, in[i], in[i]);
+		/* in[i]^2 + 1 and in[i]^2 + out[pos] + 1 fit in two words */
+		prod_low += carry;
+		prod_high += prod_low < carry;
+		carry = 0;
+		if (pos < wlimit) {
+			out[pos] += prod_low;
+			prod_high += out[pos] < prod_low;
+		}
+		if ((pos + 1) < wlimit) {
+			out[pos + 1] += prod_high;
+			carry = out[pos + 1] < prod_high;
+		}
+	}
+}
+
+/*
+ * Karatsuba: with in1 = a1 * B^m + a0 and in2 = b1 * B^m + b0, where
+ * m = ceil(len / 2),
+ *
+ *   in1 * in2 = z2 * B^2m + (z0 + z2 - (a0 - a1) * (b0 - b1)) * B^m + z0
+ *
+ * with z0 = a0 * b0 and z2 = a1 * b1, i.e. three half size products
+ * instead of four. The subtractive form keeps the middle product on m
+ * words: |a0 - a1| and |b0 - b1| are computed, their product being
+ * added or subtracted depending on the signs. All of this (including
+ * the sign handling) is done with masks, so that the functions are
+ * constant time for a given length.
+ */
+
+/*
+ * out = |lo - hi| on m words (hi being the hi_len <= m words above lo),
+ * returns 1 when lo < hi, 0 otherwise.
+ */
+static word_t _nn_karatsuba_absdiff(word_t *out, const word_t *lo,
+				    const word_t *hi, u8 m, u8 hi_len)
+{
+	word_t borrow = 0, mask, carry, h, t;
+	u8 i;
+
+	for (i = 0; i < m; i++) {
+		h = (i < hi_len) ? hi[i] : WORD(0);
+		t = (word_t)(lo[i] - h);
+		out[i] = (word_t)(t - borrow);
+		borrow = (t > lo[i]) | (out[i] > t);
+	}
+
+	/* Negate the result when it is negative */
+	mask = (word_t)(-borrow);
+	carry = borrow;
+	for (i = 0; i < m; i++) {
+		out[i] = (word_t)((out[i] ^ mask) + carry);
+		carry = out[i] < carry;
+	}
+
+	return borrow;
+}
+
+/* r = a + b + carry and r = a + carry, carry being updated */
+#define KARA_ADC(r, a, b, carry) do {					\
+	word_t _s = (word_t)((a) + (carry));				\
+	(carry) = _s < (carry);						\
+	(r) = (word_t)(_s + (b));					\
+	(carry) += (r) < _s;						\
+	} while (0)
+#define KARA_AC(r, a, carry) do {					\
+	(r) = (word_t)((a) + (carry));					\
+	(carry) = (r) < (carry);					\
+	} while (0)
+
+/*
+ * out[m, 2 * len) += z0 + z2 + ((mid ^ mask) + (mask & 1)), z0 and z2
+ * being already in out (z0 on 2 * m words, z2 on the 2 * (len - m) words
+ * above) and mid being the 2 * m words middle product. With mask all
+ * ones mid is subtracted, otherwise it is added. The sum being the
+ * positive middle term of the product, it fits on the 2 * m + 1 words
+ * computed modulo B^(2m + 1).
+ */
+static void _nn_karatsuba_combine(word_t *out, const word_t *mid, u8 len,
+				  u8 m, word_t mask)
+{
+	word_t t[NN_MAX_WORD_LEN + 2];
+	word_t carry = 0, carry2 = mask & 1, w;
+	u16 i, hi2 = (u16)(2 * (len - m)), m2 = (u16)(2 * m);
+
+	/* t = z0 + z2 +/- mid */
+	for (i = 0; i < hi2; i++) {
+		KARA_ADC(t[i], out[i], out[m2 + i], carry);
+	}
+	for (; i < m2; i++) {
+		KARA_AC(t[i], out[i], carry);
+	}
+	t[m2] = carry;
+	for (i = 0; i < m2; i++) {
+		w = (word_t)(mid[i] ^ mask);
+		KARA_ADC(t[i], t[i], w, carry2);
+	}
+	t[m2] = (word_t)(t[m2] + mask + carry2);
+
+	/* out += t * B^m (the result fitting on 2 * len words) */
+	carry = 0;
+	for (i = 0; i <= m2; i++) {
+		if ((m + i) >= (2 * len)) {
+			break;
+		}
+		KARA_ADC(out[m + i], out[m + i], t[i], carry);
+	}
+	for (i = (u16)(m + m2 + 1); i < (2 * len); i++) {
+		KARA_AC(out[i], out[i], carry);
+	}
+}
+
+static void _nn_mul_words_full(word_t *out, const word_t *in1,
+			       const word_t *in2, u8 len);
+static void _nn_sqr_words_full(word_t *out, const word_t *in, u8 len);
+
+/*
+ * out = in1 * in2 on 2 * len words, with one Karatsuba step on top
+ * (out not aliasing the inputs).
+ */
+static void _nn_mul_karatsuba_words(word_t *out, const word_t *in1,
+				    const word_t *in2, u8 len)
+{
+	word_t da[(NN_MAX_WORD_LEN + 1) / 2] = { 0 };
+	word_t db[(NN_MAX_WORD_LEN + 1) / 2] = { 0 };
+	word_t mid[NN_MAX_WORD_LEN + 1];
+	word_t sa, sb;
+	u8 m = (u8)((len + 1) / 2), h = (u8)(len - m);
+
+	MUST_HAVE((len >= 2) && (len <= NN_MAX_WORD_LEN));
+
+	_nn_mul_words_full(out, in1, in2, m);
+	_nn_mul_words_full(out + (2 * m), in1 + m, in2 + m, h);
+	sa = _nn_karatsuba_absdiff(da, in1, in1 + m, m, h);
+	sb = _nn_karatsuba_absdiff(db, in2, in2 + m, m, h);
+	_nn_mul_words_full(mid, da, db, m);
+	/* (a0 - a1) * (b0 - b1) is subtracted when the signs are equal */
+	_nn_karatsuba_combine(out, mid, len, m, WORD_MASK_IFZERO(sa ^ sb));
+}
+
+/* Same as above for the square of in, the middle product being a square */
+static void _nn_sqr_karatsuba_words(word_t *out, const word_t *in, u8 len)
+{
+	word_t da[(NN_MAX_WORD_LEN + 1) / 2] = { 0 };
+	word_t mid[NN_MAX_WORD_LEN + 1];
+	u8 m = (u8)((len + 1) / 2), h = (u8)(len - m);
+
+	MUST_HAVE((len >= 2) && (len <= NN_MAX_WORD_LEN));
+
+	_nn_sqr_words_full(out, in, m);
+	_nn_sqr_words_full(out + (2 * m), in + m, h);
+	_nn_karatsuba_absdiff(da, in, in + m, m, h);
+	_nn_sqr_words_full(mid, da, m);
+	_nn_karatsuba_combine(out, mid, len, m, WORD_MASK);
+}
+
+/* out = in1 * in2 on 2 * len words, in1 and in2 being len words */
+static void _nn_mul_words_full(word_t *out, const word_t *in1,
+			       const word_t *in2, u8 len)
+{
+	if (len >= NN_KARATSUBA_THRESHOLD) {
+		_nn_mul_karatsuba_words(out, in1, in2, len);
+	} else if (!_nn_mul_comba_fixed(out, in1, in2, len)) {
+		_nn_mul_school_words(out, in1, len, in2, len, (u8)(2 * len));
+	}
+}
+
+/* out = in^2 on 2 * len words, in being len words */
+static void _nn_sqr_words_full(word_t *out, const word_t *in, u8 len)
+{
+	if (len >= NN_KARATSUBA_SQR_THRESHOLD) {
+		_nn_sqr_karatsuba_words(out, in, len);
+	} else if (!_nn_mul_comba_fixed(out, in, NULL, len)) {
+		_nn_sqr_school_words(out, in, len, (u8)(2 * len));
+	}
+}
+
+void nn_mul_basecase_words(word_t *out, const word_t *in1,
+			   const word_t *in2, u8 len)
+{
+	if (!_nn_mul_comba_fixed(out, in1, in2, len)) {
+		_nn_mul_school_words(out, in1, len, in2, len, (u8)(2 * len));
+	}
+}
+
+void nn_mul_karatsuba_words(word_t *out, const word_t *in1,
+			    const word_t *in2, u8 len)
+{
+	_nn_mul_karatsuba_words(out, in1, in2, len);
+}
+
+void nn_sqr_basecase_words(word_t *out, const word_t *in, u8 len)
+{
+	if (!_nn_mul_comba_fixed(out, in, NULL, len)) {
+		_nn_sqr_school_words(out, in, len, (u8)(2 * len));
+	}
+}
+
+void nn_sqr_karatsuba_words(word_t *out, const word_t *in, u8 len)
+{
+	_nn_sqr_karatsuba_words(out, in, len);
+}
+
+/*
+ * Compute out = (in1 * in2) & (2^(WORD_BYTES * wlimits) - 1).
+ *
+ * The function is constant time for all sets of parameters of given
+ * lengths.
+ *
+ * Implementation: the full products of operands of the same length use
+ * the unrolled Comba routines for the limb counts of the enabled curves,
+ * Karatsuba from NN_KARATSUBA_THRESHOLD words and the schoolbook
+ * algorithm otherwise. Karatsuba is also used for truncated products
+ * whose upper half is needed, and when the lengths differ, the shorter
+ * operand being padded with zero words (which are already there above
+ * its wlen). This is only done when the lengths are close enough for the
+ * padding not to cost more than what Karatsuba saves.
+ *
+ * Note: 'out' is initialized by the function (caller can omit it)
+ */
+static void _nn_mul_low(nn_t out, nn_src_t in1, nn_src_t in2,
+			u8 wlimit)
+{
+	u8 len, min_len, i;
+
+	nn_check_initialized(in1);
+	nn_check_initialized(in2);
+
+	/* We have to check that wlimit does not exceed our NN_MAX_WORD_LEN */
+	MUST_HAVE((wlimit * WORD_BYTES) <= NN_MAX_BYTE_LEN);
+	nn_init(out, (u16)(wlimit * WORD_BYTES));
+
+	len = (in1->wlen > in2->wlen) ? in1->wlen : in2->wlen;
+	min_len = (in1->wlen > in2->wlen) ? in2->wlen : in1->wlen;
+	if ((in1->wlen == in2->wlen) && (wlimit >= (2 * len))) {
+		_nn_mul_words_full(out->val, in1->val, in2->val, len);
+	} else if ((min_len >= NN_KARATSUBA_THRESHOLD) && (wlimit > len) &&
+		   ((2 * (u16)len) <= NN_MAX_WORD_LEN) &&
+		   ((4 * (u16)min_len) >= (3 * (u16)len))) {
+		/* The words above wlimit are then cleared */
+		_nn_mul_karatsuba_words(out->val, in1->val, in2->val, len);
+		for (i = wlimit; i < (2 * len); i++) {
+			out->val[i] = 0;
 		}
+	} else {
+		_nn_mul_school_words(out->val, in1->val, in1->wlen, in2->val,
+				     in2->wlen, wlimit);
 	}
 }
 
@@ -117,15 +475,60 @@ void nn_mul(nn_t out, nn_src_t in1, nn_src_t in2)
 	nn_mul_low(out, in1, in2, in1->wlen + in2->wlen);
 }
 
+/*
+ * Compute out = (in * in) & (2^(WORD_BYTES * wlimits) - 1).
+ *
+ * The function is constant time for all sets of parameters of given
+ * lengths.
+ *
+ * Implementation: as nn_mul_low(), Karatsuba being used from
+ * NN_KARATSUBA_SQR_THRESHOLD words.
+ *
+ * Note: 'out' is initialized by the function (caller can omit it)
+ */
+static void _nn_sqr_low(nn_t out, nn_src_t in, u8 wlimit)
+{
+	u8 i;
+
+	nn_check_initialized(in);
+
+	/* We have to check that wlimit does not exceed our NN_MAX_WORD_LEN */
+	MUST_HAVE((wlimit * WORD_BYTES) <= NN_MAX_BYTE_LEN);
+	nn_init(out, (u16)(wlimit * WORD_BYTES));
+
+	if (wlimit >= (2 * in->wlen)) {
+		_nn_sqr_words_full(out->val, in->val, in->wlen);
+	} else if ((in->wlen >= NN_KARATSUBA_SQR_THRESHOLD) &&
+		   (wlimit > in->wlen)) {
+		/* The words above wlimit are then cleared */
+		_nn_sqr_karatsuba_words(out->val, in->val, in->wlen);
+		for (i = wlimit; i < (2 * in->wlen); i++) {
+			out->val[i] = 0;
+		}
+	} else {
+		_nn_sqr_school_words(out->val, in->val, in->wlen, wlimit);
+	}
+}
+
+/* Handle aliasing */
 void nn_sqr_low(nn_t out, nn_src_t in, u8 wlimit)
 {
-	nn_mul_low(out, in, in, wlimit);
+	/* Handle output aliasing */
+	if (out == in) {
+		nn out_cpy;
+		_nn_sqr_low(&out_cpy, in, wlimit);
+		nn_init(out, out_cpy.wlen);
+		nn_copy(out, &out_cpy);
+		nn_uninit(&out_cpy);
+	} else {
+		_nn_sqr_low(out, in, wlimit);
+	}
 }
 
 /* Note: 'out' is initialized by the function (caller can omit it) */
 void nn_sqr(nn_t out, nn_src_t in)
 {
-	nn_mul(out, in, in);
+	nn_sqr_low(out, in, (u8)(2 * in->wlen));
 }
 
 /* Multiply a multiprecision number by a word. */
@@ -17,10 +17,51 @@
 #define __NN_MUL_H__
 #include "nn.h"
 
+/*
+ * Karatsuba is used for the products of operands of at least
+ * NN_KARATSUBA_THRESHOLD words (NN_KARATSUBA_SQR_THRESHOLD for squares,
+ * whose base case is already cheaper), smaller ones using the unrolled
+ * Comba routines for the limb counts of the enabled curves and the
+ * schoolbook algorithm otherwise. The defaults are the crossovers reported
+ * by the "karatsuba" benchmark of arith_bench on x86-64 (with a native
+ * double word multiplication). They can be overridden at compile time,
+ * which is worth it on targets where multiplications are expensive
+ * compared to additions.
+ */
+#ifndef NN_KARATSUBA_THRESHOLD
+#if (WORDSIZE == 64)
+#define NN_KARATSUBA_THRESHOLD		22
+#else
+#define NN_KARATSUBA_THRESHOLD		24
+#endif
+#endif
+#ifndef NN_KARATSUBA_SQR_THRESHOLD
+#if (WORDSIZE == 64)
+#define NN_KARATSUBA_SQR_THRESHOLD	38
+#else
+#define NN_KARATSUBA_SQR_THRESHOLD	48
+#endif
+#endif
+
 void nn_mul_low(nn_t out, nn_src_t in1, nn_src_t in2, u8 wlimit);
 void nn_mul(nn_t out, nn_src_t in1, nn_src_t in2);
 void nn_sqr_low(nn_t out, nn_src_t in, u8 wlimit);
 void nn_sqr(nn_t out, nn_src_t in);
 void nn_mul_word(nn_t out, nn_src_t in, word_t w);
 
+/*
+ * Full products of len words operands on raw little endian word arrays
+ * (out being 2 * len words, not aliasing the inputs), with the base case
+ * (unrolled Comba or schoolbook) or with one Karatsuba step on top
+ * (len >= 2). These are the
+ * building blocks of nn_mul_low() and nn_sqr_low(), exposed for the
+ * benchmarks.
+ */
+void nn_mul_basecase_words(word_t *out, const word_t *in1,
+			   const word_t *in2, u8 len);
+void nn_mul_karatsuba_words(word_t *out, const word_t *in1,
+			    const word_t *in2, u8 len);
+void nn_sqr_basecase_words(word_t *out, const word_t *in, u8 len);
+void nn_sqr_karatsuba_words(word_t *out, const word_t *in, u8 len);
+
 #endif /* __NN_MUL_H__ */
@@ -0,0 +1,4351 @@
+/*
+ *  Copyright (C) 2017 - This file is part of libecc project
+ *
+ *  Authors:
+ *      Ryad BENADJILA <ryadbenadjila@gmail.com>
+ *      Arnaud EBALARD <arnaud.ebalard@ssi.gouv.fr>
+ *      Jean-Pierre FLORI <jean-pierre.flori@ssi.gouv.fr>
+ *
+ *  Contributors:
+ *      Nicolas VIVET <nicolas.vivet@ssi.gouv.fr>
+ *      Karim KHALFALLAH <karim.khalfallah@ssi.gouv.fr>
+ *
+ *  This software is licensed under a dual BSD and GPL v2 license.
+ *  See LICENSE file at the root folder of the project.
+ */
+
+/*
+ * Fully unrolled Comba multiplication and squaring for the limb counts of
+ * the enabled curves, only included by nn_mul.c (which defines the
+ * COMBA_* macros). This file is generated by scripts/nn_mul_comba.py, do
+ * not edit.
+ */
+#ifndef __NN_MUL_COMBA_H__
+#define __NN_MUL_COMBA_H__
+
+#ifdef FP_FIXED_WLEN_2_USED
+
+/* out = in1 * in2 on 4 words, in1 and in2 being 2 words */
+static void _nn_mul_comba_2(word_t *out, const word_t *in1,
+			     const word_t *in2)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0;
+
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[0]);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[1]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	out[3] = c0;
+}
+
+/* out = in^2 on 4 words, in being 2 words */
+static void _nn_sqr_comba_2(word_t *out, const word_t *in)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0, d0, d1, d2;
+
+	COMBA_MULADD(c2, c1, c0, in[0], in[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[1]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in[1], in[1]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	out[3] = c0;
+}
+#endif
+
+#ifdef FP_FIXED_WLEN_3_USED
+
+/* out = in1 * in2 on 6 words, in1 and in2 being 3 words */
+static void _nn_mul_comba_3(word_t *out, const word_t *in1,
+			     const word_t *in2)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0;
+
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[0]);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[0]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[1]);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[2]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	out[5] = c0;
+}
+
+/* out = in^2 on 6 words, in being 3 words */
+static void _nn_sqr_comba_3(word_t *out, const word_t *in)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0, d0, d1, d2;
+
+	COMBA_MULADD(c2, c1, c0, in[0], in[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[1]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[1], in[1]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[1], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in[2], in[2]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	out[5] = c0;
+}
+#endif
+
+#ifdef FP_FIXED_WLEN_4_USED
+
+/* out = in1 * in2 on 8 words, in1 and in2 being 4 words */
+static void _nn_mul_comba_4(word_t *out, const word_t *in1,
+			     const word_t *in2)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0;
+
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[0]);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[0]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[0]);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[1]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[2]);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[3]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	out[7] = c0;
+}
+
+/* out = in^2 on 8 words, in being 4 words */
+static void _nn_sqr_comba_4(word_t *out, const word_t *in)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0, d0, d1, d2;
+
+	COMBA_MULADD(c2, c1, c0, in[0], in[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[1]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[1], in[1]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[3]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[1], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[2], in[2]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[2], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in[3], in[3]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	out[7] = c0;
+}
+#endif
+
+#ifdef FP_FIXED_WLEN_5_USED
+
+/* out = in1 * in2 on 10 words, in1 and in2 being 5 words */
+static void _nn_mul_comba_5(word_t *out, const word_t *in1,
+			     const word_t *in2)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0;
+
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[0]);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[0]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[0]);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[0]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[1]);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[2]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[3]);
+	COMBA_NEXT(out[7], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[4]);
+	COMBA_NEXT(out[8], c2, c1, c0);
+	out[9] = c0;
+}
+
+/* out = in^2 on 10 words, in being 5 words */
+static void _nn_sqr_comba_5(word_t *out, const word_t *in)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0, d0, d1, d2;
+
+	COMBA_MULADD(c2, c1, c0, in[0], in[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[1]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[1], in[1]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[3]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[4]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[2], in[2]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[1], in[4]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[2], in[4]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[3], in[3]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[3], in[4]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[7], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in[4], in[4]);
+	COMBA_NEXT(out[8], c2, c1, c0);
+	out[9] = c0;
+}
+#endif
+
+#ifdef FP_FIXED_WLEN_6_USED
+
+/* out = in1 * in2 on 12 words, in1 and in2 being 6 words */
+static void _nn_mul_comba_6(word_t *out, const word_t *in1,
+			     const word_t *in2)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0;
+
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[0]);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[0]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[0]);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[0]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[0]);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[1]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[2]);
+	COMBA_NEXT(out[7], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[3]);
+	COMBA_NEXT(out[8], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[4]);
+	COMBA_NEXT(out[9], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[5]);
+	COMBA_NEXT(out[10], c2, c1, c0);
+	out[11] = c0;
+}
+
+/* out = in^2 on 12 words, in being 6 words */
+static void _nn_sqr_comba_6(word_t *out, const word_t *in)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0, d0, d1, d2;
+
+	COMBA_MULADD(c2, c1, c0, in[0], in[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[1]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[1], in[1]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[3]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[4]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[2], in[2]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[4]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[1], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[4]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[3], in[3]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[2], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[4]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[7], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[3], in[5]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[4], in[4]);
+	COMBA_NEXT(out[8], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[4], in[5]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[9], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in[5], in[5]);
+	COMBA_NEXT(out[10], c2, c1, c0);
+	out[11] = c0;
+}
+#endif
+
+#ifdef FP_FIXED_WLEN_7_USED
+
+/* out = in1 * in2 on 14 words, in1 and in2 being 7 words */
+static void _nn_mul_comba_7(word_t *out, const word_t *in1,
+			     const word_t *in2)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0;
+
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[0]);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[0]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[0]);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[0]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[0]);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[0]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[1]);
+	COMBA_NEXT(out[7], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[2]);
+	COMBA_NEXT(out[8], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[3]);
+	COMBA_NEXT(out[9], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[4]);
+	COMBA_NEXT(out[10], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[5]);
+	COMBA_NEXT(out[11], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[6]);
+	COMBA_NEXT(out[12], c2, c1, c0);
+	out[13] = c0;
+}
+
+/* out = in^2 on 14 words, in being 7 words */
+static void _nn_sqr_comba_7(word_t *out, const word_t *in)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0, d0, d1, d2;
+
+	COMBA_MULADD(c2, c1, c0, in[0], in[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[1]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[1], in[1]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[3]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[4]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[2], in[2]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[4]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[4]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[3], in[3]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[1], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[4]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[7], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[2], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[5]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[4], in[4]);
+	COMBA_NEXT(out[8], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[3], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[5]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[9], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[4], in[6]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[5], in[5]);
+	COMBA_NEXT(out[10], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[5], in[6]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[11], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in[6], in[6]);
+	COMBA_NEXT(out[12], c2, c1, c0);
+	out[13] = c0;
+}
+#endif
+
+#ifdef FP_FIXED_WLEN_8_USED
+
+/* out = in1 * in2 on 16 words, in1 and in2 being 8 words */
+static void _nn_mul_comba_8(word_t *out, const word_t *in1,
+			     const word_t *in2)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0;
+
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[0]);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[0]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[0]);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[0]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[0]);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[0]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[0]);
+	COMBA_NEXT(out[7], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[1]);
+	COMBA_NEXT(out[8], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[2]);
+	COMBA_NEXT(out[9], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[3]);
+	COMBA_NEXT(out[10], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[4]);
+	COMBA_NEXT(out[11], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[5]);
+	COMBA_NEXT(out[12], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[6]);
+	COMBA_NEXT(out[13], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[7]);
+	COMBA_NEXT(out[14], c2, c1, c0);
+	out[15] = c0;
+}
+
+/* out = in^2 on 16 words, in being 8 words */
+static void _nn_sqr_comba_8(word_t *out, const word_t *in)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0, d0, d1, d2;
+
+	COMBA_MULADD(c2, c1, c0, in[0], in[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[1]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[1], in[1]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[3]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[4]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[2], in[2]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[4]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[4]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[3], in[3]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[4]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[7], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[1], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[5]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[4], in[4]);
+	COMBA_NEXT(out[8], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[2], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[5]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[9], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[3], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[6]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[5], in[5]);
+	COMBA_NEXT(out[10], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[4], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[6]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[11], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[5], in[7]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[6], in[6]);
+	COMBA_NEXT(out[12], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[6], in[7]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[13], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in[7], in[7]);
+	COMBA_NEXT(out[14], c2, c1, c0);
+	out[15] = c0;
+}
+#endif
+
+#ifdef FP_FIXED_WLEN_9_USED
+
+/* out = in1 * in2 on 18 words, in1 and in2 being 9 words */
+static void _nn_mul_comba_9(word_t *out, const word_t *in1,
+			     const word_t *in2)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0;
+
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[0]);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[0]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[0]);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[0]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[0]);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[0]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[0]);
+	COMBA_NEXT(out[7], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[0]);
+	COMBA_NEXT(out[8], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[1]);
+	COMBA_NEXT(out[9], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[2]);
+	COMBA_NEXT(out[10], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[3]);
+	COMBA_NEXT(out[11], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[4]);
+	COMBA_NEXT(out[12], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[5]);
+	COMBA_NEXT(out[13], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[6]);
+	COMBA_NEXT(out[14], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[7]);
+	COMBA_NEXT(out[15], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[8]);
+	COMBA_NEXT(out[16], c2, c1, c0);
+	out[17] = c0;
+}
+
+/* out = in^2 on 18 words, in being 9 words */
+static void _nn_sqr_comba_9(word_t *out, const word_t *in)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0, d0, d1, d2;
+
+	COMBA_MULADD(c2, c1, c0, in[0], in[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[1]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[1], in[1]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[3]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[4]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[2], in[2]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[4]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[4]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[3], in[3]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[4]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[7], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[5]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[4], in[4]);
+	COMBA_NEXT(out[8], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[1], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[5]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[9], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[2], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[6]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[5], in[5]);
+	COMBA_NEXT(out[10], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[3], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[6]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[11], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[4], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[7]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[6], in[6]);
+	COMBA_NEXT(out[12], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[5], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[7]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[13], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[6], in[8]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[7], in[7]);
+	COMBA_NEXT(out[14], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[7], in[8]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[15], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in[8], in[8]);
+	COMBA_NEXT(out[16], c2, c1, c0);
+	out[17] = c0;
+}
+#endif
+
+#ifdef FP_FIXED_WLEN_10_USED
+
+/* out = in1 * in2 on 20 words, in1 and in2 being 10 words */
+static void _nn_mul_comba_10(word_t *out, const word_t *in1,
+			      const word_t *in2)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0;
+
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[0]);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[0]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[0]);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[0]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[0]);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[0]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[0]);
+	COMBA_NEXT(out[7], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[0]);
+	COMBA_NEXT(out[8], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[0]);
+	COMBA_NEXT(out[9], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[1]);
+	COMBA_NEXT(out[10], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[2]);
+	COMBA_NEXT(out[11], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[3]);
+	COMBA_NEXT(out[12], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[4]);
+	COMBA_NEXT(out[13], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[5]);
+	COMBA_NEXT(out[14], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[6]);
+	COMBA_NEXT(out[15], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[7]);
+	COMBA_NEXT(out[16], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[8]);
+	COMBA_NEXT(out[17], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[9]);
+	COMBA_NEXT(out[18], c2, c1, c0);
+	out[19] = c0;
+}
+
+/* out = in^2 on 20 words, in being 10 words */
+static void _nn_sqr_comba_10(word_t *out, const word_t *in)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0, d0, d1, d2;
+
+	COMBA_MULADD(c2, c1, c0, in[0], in[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[1]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[1], in[1]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[3]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[4]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[2], in[2]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[4]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[4]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[3], in[3]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[4]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[7], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[5]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[4], in[4]);
+	COMBA_NEXT(out[8], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[5]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[9], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[1], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[6]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[5], in[5]);
+	COMBA_NEXT(out[10], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[2], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[6]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[11], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[3], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[7]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[6], in[6]);
+	COMBA_NEXT(out[12], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[4], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[7]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[13], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[5], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[8]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[7], in[7]);
+	COMBA_NEXT(out[14], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[6], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[8]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[15], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[7], in[9]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[8], in[8]);
+	COMBA_NEXT(out[16], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[8], in[9]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[17], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in[9], in[9]);
+	COMBA_NEXT(out[18], c2, c1, c0);
+	out[19] = c0;
+}
+#endif
+
+#ifdef FP_FIXED_WLEN_11_USED
+
+/* out = in1 * in2 on 22 words, in1 and in2 being 11 words */
+static void _nn_mul_comba_11(word_t *out, const word_t *in1,
+			      const word_t *in2)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0;
+
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[0]);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[0]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[0]);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[0]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[0]);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[0]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[0]);
+	COMBA_NEXT(out[7], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[0]);
+	COMBA_NEXT(out[8], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[0]);
+	COMBA_NEXT(out[9], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[0]);
+	COMBA_NEXT(out[10], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[1]);
+	COMBA_NEXT(out[11], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[2]);
+	COMBA_NEXT(out[12], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[3]);
+	COMBA_NEXT(out[13], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[4]);
+	COMBA_NEXT(out[14], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[5]);
+	COMBA_NEXT(out[15], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[6]);
+	COMBA_NEXT(out[16], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[7]);
+	COMBA_NEXT(out[17], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[8]);
+	COMBA_NEXT(out[18], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[9]);
+	COMBA_NEXT(out[19], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[10]);
+	COMBA_NEXT(out[20], c2, c1, c0);
+	out[21] = c0;
+}
+
+/* out = in^2 on 22 words, in being 11 words */
+static void _nn_sqr_comba_11(word_t *out, const word_t *in)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0, d0, d1, d2;
+
+	COMBA_MULADD(c2, c1, c0, in[0], in[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[1]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[1], in[1]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[3]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[4]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[2], in[2]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[4]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[4]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[3], in[3]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[4]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[7], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[5]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[4], in[4]);
+	COMBA_NEXT(out[8], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[5]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[9], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[6]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[5], in[5]);
+	COMBA_NEXT(out[10], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[1], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[6]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[11], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[2], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[7]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[6], in[6]);
+	COMBA_NEXT(out[12], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[3], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[7]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[13], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[4], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[8]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[7], in[7]);
+	COMBA_NEXT(out[14], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[5], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[8]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[15], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[6], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[9]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[8], in[8]);
+	COMBA_NEXT(out[16], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[7], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[9]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[17], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[8], in[10]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[9], in[9]);
+	COMBA_NEXT(out[18], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[9], in[10]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[19], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in[10], in[10]);
+	COMBA_NEXT(out[20], c2, c1, c0);
+	out[21] = c0;
+}
+#endif
+
+#ifdef FP_FIXED_WLEN_12_USED
+
+/* out = in1 * in2 on 24 words, in1 and in2 being 12 words */
+static void _nn_mul_comba_12(word_t *out, const word_t *in1,
+			      const word_t *in2)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0;
+
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[0]);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[0]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[0]);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[0]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[0]);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[0]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[0]);
+	COMBA_NEXT(out[7], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[0]);
+	COMBA_NEXT(out[8], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[0]);
+	COMBA_NEXT(out[9], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[0]);
+	COMBA_NEXT(out[10], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[0]);
+	COMBA_NEXT(out[11], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[1]);
+	COMBA_NEXT(out[12], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[2]);
+	COMBA_NEXT(out[13], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[3]);
+	COMBA_NEXT(out[14], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[4]);
+	COMBA_NEXT(out[15], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[5]);
+	COMBA_NEXT(out[16], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[6]);
+	COMBA_NEXT(out[17], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[7]);
+	COMBA_NEXT(out[18], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[8]);
+	COMBA_NEXT(out[19], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[9]);
+	COMBA_NEXT(out[20], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[10]);
+	COMBA_NEXT(out[21], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[11]);
+	COMBA_NEXT(out[22], c2, c1, c0);
+	out[23] = c0;
+}
+
+/* out = in^2 on 24 words, in being 12 words */
+static void _nn_sqr_comba_12(word_t *out, const word_t *in)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0, d0, d1, d2;
+
+	COMBA_MULADD(c2, c1, c0, in[0], in[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[1]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[1], in[1]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[3]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[4]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[2], in[2]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[4]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[4]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[3], in[3]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[4]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[7], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[5]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[4], in[4]);
+	COMBA_NEXT(out[8], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[5]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[9], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[6]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[5], in[5]);
+	COMBA_NEXT(out[10], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[6]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[11], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[1], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[7]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[6], in[6]);
+	COMBA_NEXT(out[12], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[2], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[7]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[13], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[3], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[8]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[7], in[7]);
+	COMBA_NEXT(out[14], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[4], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[8]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[15], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[5], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[9]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[8], in[8]);
+	COMBA_NEXT(out[16], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[6], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[9]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[17], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[7], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[10]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[9], in[9]);
+	COMBA_NEXT(out[18], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[8], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[9], in[10]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[19], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[9], in[11]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[10], in[10]);
+	COMBA_NEXT(out[20], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[10], in[11]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[21], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in[11], in[11]);
+	COMBA_NEXT(out[22], c2, c1, c0);
+	out[23] = c0;
+}
+#endif
+
+#ifdef FP_FIXED_WLEN_13_USED
+
+/* out = in1 * in2 on 26 words, in1 and in2 being 13 words */
+static void _nn_mul_comba_13(word_t *out, const word_t *in1,
+			      const word_t *in2)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0;
+
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[0]);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[0]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[0]);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[0]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[0]);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[0]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[0]);
+	COMBA_NEXT(out[7], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[0]);
+	COMBA_NEXT(out[8], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[0]);
+	COMBA_NEXT(out[9], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[0]);
+	COMBA_NEXT(out[10], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[0]);
+	COMBA_NEXT(out[11], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[0]);
+	COMBA_NEXT(out[12], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[1]);
+	COMBA_NEXT(out[13], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[2]);
+	COMBA_NEXT(out[14], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[3]);
+	COMBA_NEXT(out[15], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[4]);
+	COMBA_NEXT(out[16], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[5]);
+	COMBA_NEXT(out[17], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[6]);
+	COMBA_NEXT(out[18], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[7]);
+	COMBA_NEXT(out[19], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[8]);
+	COMBA_NEXT(out[20], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[9]);
+	COMBA_NEXT(out[21], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[10]);
+	COMBA_NEXT(out[22], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[11]);
+	COMBA_NEXT(out[23], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[12]);
+	COMBA_NEXT(out[24], c2, c1, c0);
+	out[25] = c0;
+}
+
+/* out = in^2 on 26 words, in being 13 words */
+static void _nn_sqr_comba_13(word_t *out, const word_t *in)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0, d0, d1, d2;
+
+	COMBA_MULADD(c2, c1, c0, in[0], in[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[1]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[1], in[1]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[3]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[4]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[2], in[2]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[4]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[4]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[3], in[3]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[4]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[7], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[5]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[4], in[4]);
+	COMBA_NEXT(out[8], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[5]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[9], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[6]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[5], in[5]);
+	COMBA_NEXT(out[10], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[6]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[11], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[7]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[6], in[6]);
+	COMBA_NEXT(out[12], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[1], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[7]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[13], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[2], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[8]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[7], in[7]);
+	COMBA_NEXT(out[14], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[3], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[8]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[15], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[4], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[9]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[8], in[8]);
+	COMBA_NEXT(out[16], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[5], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[9]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[17], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[6], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[10]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[9], in[9]);
+	COMBA_NEXT(out[18], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[7], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[9], in[10]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[19], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[8], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[9], in[11]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[10], in[10]);
+	COMBA_NEXT(out[20], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[9], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[10], in[11]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[21], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[10], in[12]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[11], in[11]);
+	COMBA_NEXT(out[22], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[11], in[12]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[23], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in[12], in[12]);
+	COMBA_NEXT(out[24], c2, c1, c0);
+	out[25] = c0;
+}
+#endif
+
+#ifdef FP_FIXED_WLEN_14_USED
+
+/* out = in1 * in2 on 28 words, in1 and in2 being 14 words */
+static void _nn_mul_comba_14(word_t *out, const word_t *in1,
+			      const word_t *in2)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0;
+
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[0]);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[0]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[0]);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[0]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[0]);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[0]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[0]);
+	COMBA_NEXT(out[7], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[0]);
+	COMBA_NEXT(out[8], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[0]);
+	COMBA_NEXT(out[9], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[0]);
+	COMBA_NEXT(out[10], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[0]);
+	COMBA_NEXT(out[11], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[0]);
+	COMBA_NEXT(out[12], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[0]);
+	COMBA_NEXT(out[13], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[1]);
+	COMBA_NEXT(out[14], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[2]);
+	COMBA_NEXT(out[15], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[3]);
+	COMBA_NEXT(out[16], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[4]);
+	COMBA_NEXT(out[17], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[5]);
+	COMBA_NEXT(out[18], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[6]);
+	COMBA_NEXT(out[19], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[7]);
+	COMBA_NEXT(out[20], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[8]);
+	COMBA_NEXT(out[21], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[9]);
+	COMBA_NEXT(out[22], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[10]);
+	COMBA_NEXT(out[23], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[11]);
+	COMBA_NEXT(out[24], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[12]);
+	COMBA_NEXT(out[25], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[13]);
+	COMBA_NEXT(out[26], c2, c1, c0);
+	out[27] = c0;
+}
+
+/* out = in^2 on 28 words, in being 14 words */
+static void _nn_sqr_comba_14(word_t *out, const word_t *in)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0, d0, d1, d2;
+
+	COMBA_MULADD(c2, c1, c0, in[0], in[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[1]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[1], in[1]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[3]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[4]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[2], in[2]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[4]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[4]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[3], in[3]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[4]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[7], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[5]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[4], in[4]);
+	COMBA_NEXT(out[8], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[5]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[9], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[6]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[5], in[5]);
+	COMBA_NEXT(out[10], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[6]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[11], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[7]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[6], in[6]);
+	COMBA_NEXT(out[12], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[7]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[13], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[1], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[8]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[7], in[7]);
+	COMBA_NEXT(out[14], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[2], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[8]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[15], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[3], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[9]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[8], in[8]);
+	COMBA_NEXT(out[16], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[4], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[9]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[17], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[5], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[10]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[9], in[9]);
+	COMBA_NEXT(out[18], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[6], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[9], in[10]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[19], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[7], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[9], in[11]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[10], in[10]);
+	COMBA_NEXT(out[20], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[8], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[9], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[10], in[11]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[21], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[9], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[10], in[12]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[11], in[11]);
+	COMBA_NEXT(out[22], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[10], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[11], in[12]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[23], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[11], in[13]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[12], in[12]);
+	COMBA_NEXT(out[24], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[12], in[13]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[25], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in[13], in[13]);
+	COMBA_NEXT(out[26], c2, c1, c0);
+	out[27] = c0;
+}
+#endif
+
+#ifdef FP_FIXED_WLEN_15_USED
+
+/* out = in1 * in2 on 30 words, in1 and in2 being 15 words */
+static void _nn_mul_comba_15(word_t *out, const word_t *in1,
+			      const word_t *in2)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0;
+
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[0]);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[0]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[0]);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[0]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[0]);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[0]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[0]);
+	COMBA_NEXT(out[7], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[0]);
+	COMBA_NEXT(out[8], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[0]);
+	COMBA_NEXT(out[9], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[0]);
+	COMBA_NEXT(out[10], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[0]);
+	COMBA_NEXT(out[11], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[0]);
+	COMBA_NEXT(out[12], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[0]);
+	COMBA_NEXT(out[13], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[0]);
+	COMBA_NEXT(out[14], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[1]);
+	COMBA_NEXT(out[15], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[2]);
+	COMBA_NEXT(out[16], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[3]);
+	COMBA_NEXT(out[17], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[4]);
+	COMBA_NEXT(out[18], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[5]);
+	COMBA_NEXT(out[19], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[6]);
+	COMBA_NEXT(out[20], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[7]);
+	COMBA_NEXT(out[21], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[8]);
+	COMBA_NEXT(out[22], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[9]);
+	COMBA_NEXT(out[23], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[10]);
+	COMBA_NEXT(out[24], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[11]);
+	COMBA_NEXT(out[25], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[12]);
+	COMBA_NEXT(out[26], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[13]);
+	COMBA_NEXT(out[27], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[14]);
+	COMBA_NEXT(out[28], c2, c1, c0);
+	out[29] = c0;
+}
+
+/* out = in^2 on 30 words, in being 15 words */
+static void _nn_sqr_comba_15(word_t *out, const word_t *in)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0, d0, d1, d2;
+
+	COMBA_MULADD(c2, c1, c0, in[0], in[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[1]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[1], in[1]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[3]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[4]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[2], in[2]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[4]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[4]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[3], in[3]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[4]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[7], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[5]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[4], in[4]);
+	COMBA_NEXT(out[8], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[5]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[9], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[6]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[5], in[5]);
+	COMBA_NEXT(out[10], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[6]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[11], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[7]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[6], in[6]);
+	COMBA_NEXT(out[12], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[7]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[13], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[8]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[7], in[7]);
+	COMBA_NEXT(out[14], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[1], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[8]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[15], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[2], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[9]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[8], in[8]);
+	COMBA_NEXT(out[16], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[3], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[9]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[17], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[4], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[10]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[9], in[9]);
+	COMBA_NEXT(out[18], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[5], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[9], in[10]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[19], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[6], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[9], in[11]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[10], in[10]);
+	COMBA_NEXT(out[20], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[7], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[9], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[10], in[11]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[21], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[8], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[9], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[10], in[12]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[11], in[11]);
+	COMBA_NEXT(out[22], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[9], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[10], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[11], in[12]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[23], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[10], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[11], in[13]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[12], in[12]);
+	COMBA_NEXT(out[24], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[11], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[12], in[13]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[25], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[12], in[14]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[13], in[13]);
+	COMBA_NEXT(out[26], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[13], in[14]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[27], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in[14], in[14]);
+	COMBA_NEXT(out[28], c2, c1, c0);
+	out[29] = c0;
+}
+#endif
+
+#ifdef FP_FIXED_WLEN_16_USED
+
+/* out = in1 * in2 on 32 words, in1 and in2 being 16 words */
+static void _nn_mul_comba_16(word_t *out, const word_t *in1,
+			      const word_t *in2)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0;
+
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[0]);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[0]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[0]);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[0]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[0]);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[0]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[0]);
+	COMBA_NEXT(out[7], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[0]);
+	COMBA_NEXT(out[8], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[0]);
+	COMBA_NEXT(out[9], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[0]);
+	COMBA_NEXT(out[10], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[0]);
+	COMBA_NEXT(out[11], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[0]);
+	COMBA_NEXT(out[12], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[0]);
+	COMBA_NEXT(out[13], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[0]);
+	COMBA_NEXT(out[14], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[0]);
+	COMBA_NEXT(out[15], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[1]);
+	COMBA_NEXT(out[16], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[2]);
+	COMBA_NEXT(out[17], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[3]);
+	COMBA_NEXT(out[18], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[4]);
+	COMBA_NEXT(out[19], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[5]);
+	COMBA_NEXT(out[20], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[6]);
+	COMBA_NEXT(out[21], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[7]);
+	COMBA_NEXT(out[22], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[8]);
+	COMBA_NEXT(out[23], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[9]);
+	COMBA_NEXT(out[24], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[10]);
+	COMBA_NEXT(out[25], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[11]);
+	COMBA_NEXT(out[26], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[12]);
+	COMBA_NEXT(out[27], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[13]);
+	COMBA_NEXT(out[28], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[14]);
+	COMBA_NEXT(out[29], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[15]);
+	COMBA_NEXT(out[30], c2, c1, c0);
+	out[31] = c0;
+}
+
+/* out = in^2 on 32 words, in being 16 words */
+static void _nn_sqr_comba_16(word_t *out, const word_t *in)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0, d0, d1, d2;
+
+	COMBA_MULADD(c2, c1, c0, in[0], in[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[1]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[1], in[1]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[3]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[4]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[2], in[2]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[4]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[4]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[3], in[3]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[4]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[7], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[5]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[4], in[4]);
+	COMBA_NEXT(out[8], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[5]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[9], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[6]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[5], in[5]);
+	COMBA_NEXT(out[10], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[6]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[11], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[7]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[6], in[6]);
+	COMBA_NEXT(out[12], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[7]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[13], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[8]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[7], in[7]);
+	COMBA_NEXT(out[14], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[15]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[8]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[15], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[1], in[15]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[9]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[8], in[8]);
+	COMBA_NEXT(out[16], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[2], in[15]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[9]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[17], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[3], in[15]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[10]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[9], in[9]);
+	COMBA_NEXT(out[18], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[4], in[15]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[9], in[10]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[19], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[5], in[15]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[9], in[11]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[10], in[10]);
+	COMBA_NEXT(out[20], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[6], in[15]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[9], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[10], in[11]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[21], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[7], in[15]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[9], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[10], in[12]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[11], in[11]);
+	COMBA_NEXT(out[22], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[8], in[15]);
+	COMBA_MULADD(d2, d1, d0, in[9], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[10], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[11], in[12]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[23], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[9], in[15]);
+	COMBA_MULADD(d2, d1, d0, in[10], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[11], in[13]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[12], in[12]);
+	COMBA_NEXT(out[24], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[10], in[15]);
+	COMBA_MULADD(d2, d1, d0, in[11], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[12], in[13]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[25], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[11], in[15]);
+	COMBA_MULADD(d2, d1, d0, in[12], in[14]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[13], in[13]);
+	COMBA_NEXT(out[26], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[12], in[15]);
+	COMBA_MULADD(d2, d1, d0, in[13], in[14]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[27], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[13], in[15]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[14], in[14]);
+	COMBA_NEXT(out[28], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[14], in[15]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[29], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in[15], in[15]);
+	COMBA_NEXT(out[30], c2, c1, c0);
+	out[31] = c0;
+}
+#endif
+
+#ifdef FP_FIXED_WLEN_17_USED
+
+/* out = in1 * in2 on 34 words, in1 and in2 being 17 words */
+static void _nn_mul_comba_17(word_t *out, const word_t *in1,
+			      const word_t *in2)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0;
+
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[0]);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[0]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[0]);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[0]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[0]);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[0]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[0]);
+	COMBA_NEXT(out[7], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[0]);
+	COMBA_NEXT(out[8], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[0]);
+	COMBA_NEXT(out[9], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[0]);
+	COMBA_NEXT(out[10], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[0]);
+	COMBA_NEXT(out[11], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[0]);
+	COMBA_NEXT(out[12], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[0]);
+	COMBA_NEXT(out[13], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[0]);
+	COMBA_NEXT(out[14], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[0]);
+	COMBA_NEXT(out[15], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[0], in2[16]);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[1]);
+	COMBA_MULADD(c2, c1, c0, in1[16], in2[0]);
+	COMBA_NEXT(out[16], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[1], in2[16]);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[2]);
+	COMBA_MULADD(c2, c1, c0, in1[16], in2[1]);
+	COMBA_NEXT(out[17], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[2], in2[16]);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[3]);
+	COMBA_MULADD(c2, c1, c0, in1[16], in2[2]);
+	COMBA_NEXT(out[18], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[3], in2[16]);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[4]);
+	COMBA_MULADD(c2, c1, c0, in1[16], in2[3]);
+	COMBA_NEXT(out[19], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[4], in2[16]);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[5]);
+	COMBA_MULADD(c2, c1, c0, in1[16], in2[4]);
+	COMBA_NEXT(out[20], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[5], in2[16]);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[6]);
+	COMBA_MULADD(c2, c1, c0, in1[16], in2[5]);
+	COMBA_NEXT(out[21], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[6], in2[16]);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[7]);
+	COMBA_MULADD(c2, c1, c0, in1[16], in2[6]);
+	COMBA_NEXT(out[22], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[7], in2[16]);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[8]);
+	COMBA_MULADD(c2, c1, c0, in1[16], in2[7]);
+	COMBA_NEXT(out[23], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[8], in2[16]);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[9]);
+	COMBA_MULADD(c2, c1, c0, in1[16], in2[8]);
+	COMBA_NEXT(out[24], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[9], in2[16]);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[10]);
+	COMBA_MULADD(c2, c1, c0, in1[16], in2[9]);
+	COMBA_NEXT(out[25], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[10], in2[16]);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[11]);
+	COMBA_MULADD(c2, c1, c0, in1[16], in2[10]);
+	COMBA_NEXT(out[26], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[11], in2[16]);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[12]);
+	COMBA_MULADD(c2, c1, c0, in1[16], in2[11]);
+	COMBA_NEXT(out[27], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[12], in2[16]);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[13]);
+	COMBA_MULADD(c2, c1, c0, in1[16], in2[12]);
+	COMBA_NEXT(out[28], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[13], in2[16]);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[14]);
+	COMBA_MULADD(c2, c1, c0, in1[16], in2[13]);
+	COMBA_NEXT(out[29], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[14], in2[16]);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[15]);
+	COMBA_MULADD(c2, c1, c0, in1[16], in2[14]);
+	COMBA_NEXT(out[30], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[15], in2[16]);
+	COMBA_MULADD(c2, c1, c0, in1[16], in2[15]);
+	COMBA_NEXT(out[31], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in1[16], in2[16]);
+	COMBA_NEXT(out[32], c2, c1, c0);
+	out[33] = c0;
+}
+
+/* out = in^2 on 34 words, in being 17 words */
+static void _nn_sqr_comba_17(word_t *out, const word_t *in)
+{
+	word_t c0 = 0, c1 = 0, c2 = 0, d0, d1, d2;
+
+	COMBA_MULADD(c2, c1, c0, in[0], in[0]);
+	COMBA_NEXT(out[0], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[1]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[1], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[1], in[1]);
+	COMBA_NEXT(out[2], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[3]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[2]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[3], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[4]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[2], in[2]);
+	COMBA_NEXT(out[4], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[4]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[3]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[5], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[4]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[3], in[3]);
+	COMBA_NEXT(out[6], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[5]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[4]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[7], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[5]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[4], in[4]);
+	COMBA_NEXT(out[8], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[6]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[5]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[9], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[6]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[5], in[5]);
+	COMBA_NEXT(out[10], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[7]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[6]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[11], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[7]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[6], in[6]);
+	COMBA_NEXT(out[12], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[8]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[7]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[13], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[8]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[7], in[7]);
+	COMBA_NEXT(out[14], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[15]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[9]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[8]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[15], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[0], in[16]);
+	COMBA_MULADD(d2, d1, d0, in[1], in[15]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[9]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[8], in[8]);
+	COMBA_NEXT(out[16], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[1], in[16]);
+	COMBA_MULADD(d2, d1, d0, in[2], in[15]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[10]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[9]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[17], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[2], in[16]);
+	COMBA_MULADD(d2, d1, d0, in[3], in[15]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[10]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[9], in[9]);
+	COMBA_NEXT(out[18], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[3], in[16]);
+	COMBA_MULADD(d2, d1, d0, in[4], in[15]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[11]);
+	COMBA_MULADD(d2, d1, d0, in[9], in[10]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[19], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[4], in[16]);
+	COMBA_MULADD(d2, d1, d0, in[5], in[15]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[9], in[11]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[10], in[10]);
+	COMBA_NEXT(out[20], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[5], in[16]);
+	COMBA_MULADD(d2, d1, d0, in[6], in[15]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[9], in[12]);
+	COMBA_MULADD(d2, d1, d0, in[10], in[11]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[21], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[6], in[16]);
+	COMBA_MULADD(d2, d1, d0, in[7], in[15]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[9], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[10], in[12]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[11], in[11]);
+	COMBA_NEXT(out[22], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[7], in[16]);
+	COMBA_MULADD(d2, d1, d0, in[8], in[15]);
+	COMBA_MULADD(d2, d1, d0, in[9], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[10], in[13]);
+	COMBA_MULADD(d2, d1, d0, in[11], in[12]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[23], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[8], in[16]);
+	COMBA_MULADD(d2, d1, d0, in[9], in[15]);
+	COMBA_MULADD(d2, d1, d0, in[10], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[11], in[13]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[12], in[12]);
+	COMBA_NEXT(out[24], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[9], in[16]);
+	COMBA_MULADD(d2, d1, d0, in[10], in[15]);
+	COMBA_MULADD(d2, d1, d0, in[11], in[14]);
+	COMBA_MULADD(d2, d1, d0, in[12], in[13]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[25], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[10], in[16]);
+	COMBA_MULADD(d2, d1, d0, in[11], in[15]);
+	COMBA_MULADD(d2, d1, d0, in[12], in[14]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[13], in[13]);
+	COMBA_NEXT(out[26], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[11], in[16]);
+	COMBA_MULADD(d2, d1, d0, in[12], in[15]);
+	COMBA_MULADD(d2, d1, d0, in[13], in[14]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[27], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[12], in[16]);
+	COMBA_MULADD(d2, d1, d0, in[13], in[15]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[14], in[14]);
+	COMBA_NEXT(out[28], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[13], in[16]);
+	COMBA_MULADD(d2, d1, d0, in[14], in[15]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[29], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[14], in[16]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_MULADD(c2, c1, c0, in[15], in[15]);
+	COMBA_NEXT(out[30], c2, c1, c0);
+	d0 = d1 = d2 = 0;
+	COMBA_MULADD(d2, d1, d0, in[15], in[16]);
+	COMBA_DBLADD(c2, c1, c0, d2, d1, d0);
+	COMBA_NEXT(out[31], c2, c1, c0);
+	COMBA_MULADD(c2, c1, c0, in[16], in[16]);
+	COMBA_NEXT(out[32], c2, c1, c0);
+	out[33] = c0;
+}
+#endif
+
+
+/*
+ * out = in1 * in2 on 2 * len words (in1^2 when in2 is NULL) when len is
+ * one of the above limb counts, returns 0 otherwise.
+ */
+static int _nn_mul_comba_fixed(word_t *out, const word_t *in1,
+			       const word_t *in2, u8 len)
+{
+	switch (len) {
+#ifdef FP_FIXED_WLEN_2_USED
+	case 2:
+		if (in2 == NULL) {
+			_nn_sqr_comba_2(out, in1);
+		} else {
+			_nn_mul_comba_2(out, in1, in2);
+		}
+		return 1;
+#endif
+#ifdef FP_FIXED_WLEN_3_USED
+	case 3:
+		if (in2 == NULL) {
+			_nn_sqr_comba_3(out, in1);
+		} else {
+			_nn_mul_comba_3(out, in1, in2);
+		}
+		return 1;
+#endif
+#ifdef FP_FIXED_WLEN_4_USED
+	case 4:
+		if (in2 == NULL) {
+			_nn_sqr_comba_4(out, in1);
+		} else {
+			_nn_mul_comba_4(out, in1, in2);
+		}
+		return 1;
+#endif
+#ifdef FP_FIXED_WLEN_5_USED
+	case 5:
+		if (in2 == NULL) {
+			_nn_sqr_comba_5(out, in1);
+		} else {
+			_nn_mul_comba_5(out, in1, in2);
+		}
+		return 1;
+#endif
+#ifdef FP_FIXED_WLEN_6_USED
+	case 6:
+		if (in2 == NULL) {
+			_nn_sqr_comba_6(out, in1);
+		} else {
+			_nn_mul_comba_6(out, in1, in2);
+		}
+		return 1;
+#endif
+#ifdef FP_FIXED_WLEN_7_USED
+	case 7:
+		if (in2 == NULL) {
+			_nn_sqr_comba_7(out, in1);
+		} else {
+			_nn_mul_comba_7(out, in1, in2);
+		}
+		return 1;
+#endif
+#ifdef FP_FIXED_WLEN_8_USED
+	case 8:
+		if (in2 == NULL) {
+			_nn_sqr_comba_8(out, in1);
+		} else {
+			_nn_mul_comba_8(out, in1, in2);
+		}
+		return 1;
+#endif
+#ifdef FP_FIXED_WLEN_9_USED
+	case 9:
+		if (in2 == NULL) {
+			_nn_sqr_comba_9(out, in1);
+		} else {
+			_nn_mul_comba_9(out, in1, in2);
+		}
+		return 1;
+#endif
+#ifdef FP_FIXED_WLEN_10_USED
+	case 10:
+		if (in2 == NULL) {
+			_nn_sqr_comba_10(out, in1);
+		} else {
+			_nn_mul_comba_10(out, in1, in2);
+		}
+		return 1;
+#endif
+#ifdef FP_FIXED_WLEN_11_USED
+	case 11:
+		if (in2 == NULL) {
+			_nn_sqr_comba_11(out, in1);
+		} else {
+			_nn_mul_comba_11(out, in1, in2);
+		}
+		return 1;
+#endif
+#ifdef FP_FIXED_WLEN_12_USED
+	case 12:
+		if (in2 == NULL) {
+			_nn_sqr_comba_12(out, in1);
+		} else {
+			_nn_mul_comba_12(out, in1, in2);
+		}
+		return 1;
+#endif
+#ifdef FP_FIXED_WLEN_13_USED
+	case 13:
+		if (in2 == NULL) {
+			_nn_sqr_comba_13(out, in1);
+		} else {
+			_nn_mul_comba_13(out, in1, in2);
+		}
+		return 1;
+#endif
+#ifdef FP_FIXED_WLEN_14_USED
+	case 14:
+		if (in2 == NULL) {
+			_nn_sqr_comba_14(out, in1);
+		} else {
+			_nn_mul_comba_14(out, in1, in2);
+		}
+		return 1;
+#endif
+#ifdef FP_FIXED_WLEN_15_USED
+	case 15:
+		if (in2 == NULL) {
+			_nn_sqr_comba_15(out, in1);
+		} else {
+			_nn_mul_comba_15(out, in1, in2);
+		}
+		return 1;
+#endif
+#ifdef FP_FIXED_WLEN_16_USED
+	case 16:
+		if (in2 == NULL) {
+			_nn_sqr_comba_16(out, in1);
+		} else {
+			_nn_mul_comba_16(out, in1, in2);
+		}
+		return 1;
+#endif
+#ifdef FP_FIXED_WLEN_17_USED
+	case 17:
+		if (in2 == NULL) {
+			_nn_sqr_comba_17(out, in1);
+		} else {
+			_nn_mul_comba_17(out, in1, in2);
+		}
+		return 1;
+#endif
+	default:
+		break;
+	}
+
+	/* Avoid unused parameter warnings when no size is used */
+	(void)out;
+	(void)in1;
+	(void)in2;
+
+	return 0;
+}
+
+#endif /* __NN_MUL_COMBA_H__ */
@@ -20,6 +20,9 @@
 #include "nn_div.h"
 #include "nn_modinv.h"
 #include "nn.h"
+#include "ll_u256_mont.h"
+#include "ll_mont_x86_64.h"
+#include "ll_mont_riscv64.h"
 
 /*
  * Given an odd number p, compute Montgomery coefficients r, r_square
@@ -96,45 +99,434 @@ word_t nn_compute_redc1_coefs(nn_t r, nn_t r_square, nn_src_t p_in)
 	return mpinv;
 }
 
-#ifdef WITH_LL_U256_MONT
+/*
+ * Final step of the Montgomery routines below: out = (hi, t) - p if it
+ * is >= p, t otherwise, (hi, t) being a len words number plus a carry
+ * word hi (0 or 1) that is < 2p. The difference is computed twice (for
+ * the borrow, and then for the masked result) to avoid a temporary, so
+ * that out can be the output of any of the routines whatever its
+ * aliasing. Done in constant time.
+ */
+static void _nn_redc1_final_sub(word_t *out, const word_t *t, word_t hi,
+				const word_t *p, unsigned int len)
+{
+	word_t tmp, s, borrow, mask;
+	unsigned int i;
+
+	borrow = WORD(0);
+	for (i = 0; i < len; i++) {
+		tmp = t[i] - p[i];
+		s = tmp - borrow;
+		borrow = (tmp > t[i]) | (s > tmp);
+	}
+	/* Keep t when it is < p, i.e. no carry word and a borrow */
+	mask = WORD_MASK_IFNOTZERO(borrow & (hi ^ WORD(1)));
 
-__attribute__((noinline)) void
-ll_u256_mont_mul(uint64_t rd[4], const uint64_t ad[4], const uint64_t bd[4],
-                 const uint64_t Nd[4], uint64_t k0);
+	borrow = WORD(0);
+	for (i = 0; i < len; i++) {
+		tmp = t[i] - p[i];
+		s = tmp - borrow;
+		borrow = (tmp > t[i]) | (s > tmp);
+		out[i] = (t[i] & mask) | (s & ~mask);
+	}
+}
 
-static void _nn_mul_redc1(nn_t out, nn_src_t in1, nn_src_t in2, nn_src_t p,
-			  word_t mpinv);
+/*
+ * Copy of the len words result of a lazy Montgomery routine, which is
+ * < 2p < B^len (see nn_mul_redc1_words_lazy()) and needs no final
+ * subtraction.
+ */
+static void _nn_redc1_lazy_copy(word_t *out, const word_t *t,
+				unsigned int len)
+{
+	unsigned int i;
 
-static void my_nn_mul_redc1(nn_t out, nn_src_t in1, nn_src_t in2, nn_src_t p,
-			  word_t mpinv) {
-  nn_set_wlen(out, p->wlen);
-  ll_u256_mont_mul(out->val, in1->val, in2->val, p->val, mpinv);
+	for (i = 0; i < len; i++) {
+		out[i] = t[i];
+	}
+}
+
+/*
+ * Reduction rounds of the SOS (separated operand scanning) algorithm from
+ * Koc et al., on the double size t: each round adds m * p at word i,
+ * making it vanish. The carry of the round is added at word i + len,
+ * along with the carry (top) left there by the previous round. t must be
+ * < p * B^len, and out = t * B^(-len) mod p. When lazy is set, the final
+ * subtraction is skipped and out is only < 2p.
+ */
+static void _nn_redc1_rounds(word_t *out, word_t *t, const word_t *p,
+			     unsigned int len, word_t mpinv, int lazy)
+{
+	word_t prod_high, prod_low, carry, top, c, m;
+	unsigned int i, j;
+
+	top = WORD(0);
+	for (i = 0; i < len; i++) {
+		m = t[i] * mpinv;
+		carry = WORD(0);
+		for (j = 0; j < len; j++) {
+			WORD_MUL(prod_high, prod_low, m, p[j]);
+			prod_low += carry;
+			prod_high += (prod_low < carry);
+			t[i + j] += prod_low;
+			carry = prod_high + (t[i + j] < prod_low);
+		}
+		t[i + len] += carry;
+		c = (t[i + len] < carry);
+		t[i + len] += top;
+		top = c + (t[i + len] < top);
+	}
+
+	/* The result, < 2p, is in the upper half of t and top */
+	if (lazy) {
+		_nn_redc1_lazy_copy(out, &t[len], len);
+	} else {
+		_nn_redc1_final_sub(out, &t[len], top, p, len);
+	}
 }
 
-#endif
 /*
  * Perform Montgomery multiplication, that is usual multplication
- * followed by reduction modulo p.
- *
- * Inputs are supposed to be < p (i.e. taken modulo p).
+ * followed by reduction modulo p, on len words inputs that are supposed
+ * to be < p (i.e. taken modulo p).
  *
  * This uses the CIOS algorithm from Koc et al.
  *
  * The p input is the modulo number of the Montgomery multiplication,
- * and mpinv is -p^(-1) mod (2^WORDSIZE).
+ * and mpinv is -p^(-1) mod (2^WORDSIZE). The product is accumulated in
+ * a local buffer, hence out may alias any of the inputs. When lazy is
+ * set, see nn_mul_redc1_words_lazy().
  */
-static void _nn_mul_redc1(nn_t out, nn_src_t in1, nn_src_t in2, nn_src_t p,
-			  word_t mpinv)
+static void _nn_mul_redc1_words(word_t *out, const word_t *in1,
+				const word_t *in2, const word_t *p,
+				unsigned int len, word_t mpinv, int lazy)
 {
-	word_t prod_high, prod_low, carry, acc, m;
-	unsigned int i, j, len, len_mul;
-	/* a and b inputs such that len(b) <= len(a) */
-	nn_src_t a, b;
+	word_t t[NN_MAX_WORD_LEN + 1];
+	word_t prod_high, prod_low, carry, m;
+	unsigned int i, j;
 
+	/* We need len + 2 words to store the carries */
+	MUST_HAVE((len > 0) && (len < NN_MAX_WORD_LEN));
+
+	for (j = 0; j < (len + 2); j++) {
+		t[j] = 0;
+	}
+	for (i = 0; i < len; i++) {
+		/* t += in1 * in2[i] */
+		carry = WORD(0);
+		for (j = 0; j < len; j++) {
+			WORD_MUL(prod_high, prod_low, in1[j], in2[i]);
+			prod_low += carry;
+			prod_high += (prod_low < carry);
+			t[j] += prod_low;
+			carry = prod_high + (t[j] < prod_low);
+		}
+		t[len] += carry;
+		t[len + 1] = (t[len] < carry);
+
+		/* t = (t + m * p) / B */
+		m = t[0] * mpinv;
+		WORD_MUL(prod_high, prod_low, m, p[0]);
+		prod_low += t[0];
+		carry = prod_high + (prod_low < t[0]);
+		for (j = 1; j < len; j++) {
+			WORD_MUL(prod_high, prod_low, m, p[j]);
+			prod_low += carry;
+			prod_high += (prod_low < carry);
+			t[j - 1] = t[j] + prod_low;
+			carry = prod_high + (t[j - 1] < prod_low);
+		}
+		t[len - 1] = t[len] + carry;
+		t[len] = t[len + 1] + (t[len - 1] < carry);
+	}
+
+	/* Note that at this stage t[len] is either 0 or 1 */
+	if (lazy) {
+		_nn_redc1_lazy_copy(out, t, len);
+	} else {
+		_nn_redc1_final_sub(out, t, t[len], p, len);
+	}
+}
+
+/*
+ * Montgomery squaring, i.e. out = in^2 * r^(-1) mod p.
+ *
+ * This uses the SOS algorithm: the double size square is first computed
+ * in a local buffer, each cross product in[i] * in[j] (i < j) being
+ * computed once and the sum doubled before the diagonal products are
+ * added (as in nn_sqr_low()), and then reduced word by word. This costs
+ * about 3n^2 / 2 word multiplications instead of 2n^2 for the CIOS
+ * multiplication of in by itself.
+ *
+ * in is supposed to be < p. Since in is entirely read before out is
+ * written, aliasing is supported.
+ */
+static void _nn_sqr_redc1_words(word_t *out, const word_t *in,
+				const word_t *p, unsigned int len,
+				word_t mpinv, int lazy)
+{
+	word_t t[NN_MAX_WORD_LEN];
+	word_t prod_high, prod_low, carry, top, msb;
+	unsigned int i, j;
+
+	MUST_HAVE((len > 0) && (NN_MAX_WORD_LEN >= (2 * len)));
+
+	/* Cross products */
+	for (i = 0; i < (2 * len); i++) {
+		t[i] = 0;
+	}
+	for (i = 0; i < len; i++) {
+		carry = WORD(0);
+		for (j = i + 1; j < len; j++) {
+			WORD_MUL(prod_high, prod_low, in[i], in[j]);
+			prod_low += carry;
+			prod_high += (prod_low < carry);
+			t[i + j] += prod_low;
+			carry = prod_high + (t[i + j] < prod_low);
+		}
+		t[i + len] = carry;
+	}
+
+	/* Doubled, plus the diagonal products */
+	top = WORD(0);
+	for (i = 0; i < (2 * len); i++) {
+		msb = t[i] >> (WORD_BITS - 1);
+		t[i] = (word_t)((t[i] << 1) | top);
+		top = msb;
+	}
+	carry = WORD(0);
+	for (i = 0; i < len; i++) {
+		WORD_MUL(prod_high, prod_low, in[i], in[i]);
+		prod_low += carry;
+		prod_high += (prod_low < carry);
+		t[2 * i] += prod_low;
+		prod_high += (t[2 * i] < prod_low);
+		t[(2 * i) + 1] += prod_high;
+		carry = (t[(2 * i) + 1] < prod_high);
+	}
+
+	_nn_redc1_rounds(out, t, p, len, mpinv, lazy);
+}
+
+/*
+ * Montgomery reduction only, i.e. out = in * r^(-1) mod p. This is
+ * the same as a Montgomery multiplication by one, but we only perform
+ * the reduction rounds. Aliasing is supported.
+ */
+static void _nn_redc1_words(word_t *out, const word_t *in, const word_t *p,
+			    unsigned int len, word_t mpinv)
+{
+	word_t t[NN_MAX_WORD_LEN];
+	unsigned int i;
+
+	MUST_HAVE((len > 0) && (NN_MAX_WORD_LEN >= (2 * len)));
+
+	for (i = 0; i < len; i++) {
+		t[i] = in[i];
+		t[i + len] = 0;
+	}
+
+	_nn_redc1_rounds(out, t, p, len, mpinv, 0);
+}
+
+#if defined(WITH_LL_MONT_RISCV64) && (WORD_BYTES == 8)
+/*
+ * rv64 kernels of ll_mont_riscv64.h for 384, 512 and 521-bit moduli:
+ * these return 1 when len is handled, 0 otherwise.
+ */
+static int _nn_mul_redc1_words_rv64(word_t *out, const word_t *in1,
+				    const word_t *in2, const word_t *p,
+				    u8 len, word_t mpinv)
+{
+	switch (len) {
+	case 6:
+		ll_u384_mont_mul(out, in1, in2, p, mpinv);
+		return 1;
+	case 8:
+		ll_u512_mont_mul(out, in1, in2, p, mpinv);
+		return 1;
+	case 9:
+		ll_u521_mont_mul(out, in1, in2, p, mpinv);
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+static int _nn_sqr_redc1_words_rv64(word_t *out, const word_t *in,
+				    const word_t *p, u8 len, word_t mpinv)
+{
+	switch (len) {
+	case 6:
+		ll_u384_mont_sqr(out, in, p, mpinv);
+		return 1;
+	case 8:
+		ll_u512_mont_sqr(out, in, p, mpinv);
+		return 1;
+	case 9:
+		ll_u521_mont_sqr(out, in, p, mpinv);
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+static int _nn_redc1_words_rv64(word_t *out, const word_t *in,
+				const word_t *p, u8 len, word_t mpinv)
+{
+	switch (len) {
+	case 6:
+		ll_u384_mont_reduce(out, in, p, mpinv);
+		return 1;
+	case 8:
+		ll_u512_mont_reduce(out, in, p, mpinv);
+		return 1;
+	case 9:
+		ll_u521_mont_reduce(out, in, p, mpinv);
+		return 1;
+	default:
+		return 0;
+	}
+}
+#endif
+
+/*
+ * Montgomery multiplication, squaring and reduction on raw little endian
+ * word arrays of len words, len being the length of p. These are used
+ * by the nn routines below and by the Fp layer, whose elements are not
+ * stored as nn (see fp.h). Inputs must be < p, the result is fully
+ * reduced and out may alias any of the inputs.
+ */
+void nn_mul_redc1_words(word_t *out, const word_t *in1, const word_t *in2,
+			const word_t *p, u8 len, word_t mpinv)
+{
+#if defined(WITH_LL_MONT_X86_64) && (WORD_BYTES == 8)
+	/* BMI2/ADX kernel when the CPU supports it */
+	ll_mont_mul_func mulx = ll_mont_x86_64_get_mul(len);
+
+	if (mulx != NULL) {
+		mulx(out, in1, in2, p, mpinv);
+		return;
+	}
+#endif
+#if defined(WITH_LL_U256_MONT) && (WORD_BYTES == 8)
+	/* 256-bit moduli are handled by the fixed size low level kernel */
+	if (len == LL_U256_MONT_WLEN) {
+		ll_u256_mont_mul(out, in1, in2, p, mpinv);
+		return;
+	}
+#endif
+#if defined(WITH_LL_MONT_RISCV64) && (WORD_BYTES == 8)
+	if (_nn_mul_redc1_words_rv64(out, in1, in2, p, len, mpinv)) {
+		return;
+	}
+#endif
+	_nn_mul_redc1_words(out, in1, in2, p, len, mpinv, 0);
+}
+
+void nn_sqr_redc1_words(word_t *out, const word_t *in, const word_t *p,
+			u8 len, word_t mpinv)
+{
+#if defined(WITH_LL_MONT_X86_64) && (WORD_BYTES == 8)
+	ll_mont_sqr_func sqrx = ll_mont_x86_64_get_sqr(len);
+
+	if (sqrx != NULL) {
+		sqrx(out, in, p, mpinv);
+		return;
+	}
+#endif
+#if defined(WITH_LL_U256_MONT) && (WORD_BYTES == 8)
+	if (len == LL_U256_MONT_WLEN) {
+		ll_u256_mont_sqr(out, in, p, mpinv);
+		return;
+	}
+#endif
+#if defined(WITH_LL_MONT_RISCV64) && (WORD_BYTES == 8)
+	if (_nn_sqr_redc1_words_rv64(out, in, p, len, mpinv)) {
+		return;
+	}
+#endif
+	_nn_sqr_redc1_words(out, in, p, len, mpinv, 0);
+}
+
+/*
+ * Lazy versions of nn_mul_redc1_words() and nn_sqr_redc1_words() for
+ * moduli with at least two spare bits in their top word (i.e.
+ * 4p < B^len): the inputs may be < 2p instead of < p, and the result is
+ * only guaranteed to be < 2p, the final conditional subtraction being
+ * skipped. Indeed, t = in1 * in2 + m * p < 4p^2 + p * B^len, and thus
+ * t / B^len < 4p^2 / B^len + p < 2p. Aliasing is supported. The x86-64
+ * and rv64 kernels, when available, are used as is: their fully reduced
+ * result is also a valid one here.
+ */
+void nn_mul_redc1_words_lazy(word_t *out, const word_t *in1,
+			     const word_t *in2, const word_t *p, u8 len,
+			     word_t mpinv)
+{
+#if defined(WITH_LL_MONT_X86_64) && (WORD_BYTES == 8)
+	ll_mont_mul_func mulx = ll_mont_x86_64_get_mul(len);
+
+	if (mulx != NULL) {
+		mulx(out, in1, in2, p, mpinv);
+		return;
+	}
+#endif
+#if defined(WITH_LL_MONT_RISCV64) && (WORD_BYTES == 8)
+	if (_nn_mul_redc1_words_rv64(out, in1, in2, p, len, mpinv)) {
+		return;
+	}
+#endif
+	_nn_mul_redc1_words(out, in1, in2, p, len, mpinv, 1);
+}
+
+void nn_sqr_redc1_words_lazy(word_t *out, const word_t *in, const word_t *p,
+			     u8 len, word_t mpinv)
+{
+#if defined(WITH_LL_MONT_X86_64) && (WORD_BYTES == 8)
+	ll_mont_sqr_func sqrx = ll_mont_x86_64_get_sqr(len);
+
+	if (sqrx != NULL) {
+		sqrx(out, in, p, mpinv);
+		return;
+	}
+#endif
+#if defined(WITH_LL_MONT_RISCV64) && (WORD_BYTES == 8)
+	if (_nn_sqr_redc1_words_rv64(out, in, p, len, mpinv)) {
+		return;
+	}
+#endif
+	_nn_sqr_redc1_words(out, in, p, len, mpinv, 1);
+}
+
+void nn_redc1_words(word_t *out, const word_t *in, const word_t *p, u8 len,
+		    word_t mpinv)
+{
+#if defined(WITH_LL_U256_MONT) && (WORD_BYTES == 8)
+	if (len == LL_U256_MONT_WLEN) {
+		ll_u256_mont_reduce(out, in, p, mpinv);
+		return;
+	}
+#endif
+#if defined(WITH_LL_MONT_RISCV64) && (WORD_BYTES == 8)
+	if (_nn_redc1_words_rv64(out, in, p, len, mpinv)) {
+		return;
+	}
+#endif
+	_nn_redc1_words(out, in, p, len, mpinv);
+}
+
+/*
+ * Prepare out for the result of a Montgomery routine with inputs in1 and
+ * in2 (in2 being possibly NULL): out is initialized if it is not one of
+ * the inputs, and its length is set to the one of p. Since words above
+ * wlen are always zero, the inputs can then be read on the length of p
+ * even if they have been trimmed.
+ */
+static void _nn_redc1_init_out(nn_t out, nn_src_t in1, nn_src_t in2,
+			       nn_src_t p)
+{
 	nn_check_initialized(in1);
-	nn_check_initialized(in2);
 	nn_check_initialized(p);
-
 	/*
 	 * These comparisons are input hypothesis and does not "break"
 	 * the following computation. However performance loss exists
@@ -142,117 +534,128 @@ static void _nn_mul_redc1(nn_t out, nn_src_t in1, nn_src_t in2, nn_src_t p,
 	 * SHOULD_HAVE primitive.
 	 */
 	SHOULD_HAVE(nn_cmp(in1, p) < 0);
-	SHOULD_HAVE(nn_cmp(in2, p) < 0);
-
-	nn_init(out, 0);
-	/* Check which one of in1 or in2 is the biggest */
-	a = (in1->wlen <= in2->wlen) ? in2 : in1;
-	b = (in1->wlen <= in2->wlen) ? in1 : in2;
+	if (in2 != NULL) {
+		nn_check_initialized(in2);
+		SHOULD_HAVE(nn_cmp(in2, p) < 0);
+	}
 
-	/*
-	 * The inputs might have been reduced due to trimming
-	 * because of leading zeroes. It is important for our
-	 * Montgomery algorithm to work on sizes consistent with
-	 * out prime p real bit size. Thus, we expand the output
-	 * size to the size of p.
-	 */
+	if ((out != in1) && (out != in2)) {
+		nn_init(out, 0);
+	}
 	nn_set_wlen(out, p->wlen);
+}
 
-	len = out->wlen;
-	len_mul = b->wlen;
-	/*
-	 * We extend out to store carries. We first check that we
-	 * do not have an overflow on the NN size.
-	 */
-	MUST_HAVE(NN_MAX_BIT_LEN >= (WORD_BITS * (out->wlen + 1)));
-	out->wlen += 1;
+/*
+ * Generic Montgomery multiplication, whatever the size of p (i.e. without
+ * the low level kernel of nn_mul_redc1()). Aliasing of out with the
+ * inputs is supported.
+ */
+void nn_mul_redc1_generic(nn_t out, nn_src_t in1, nn_src_t in2, nn_src_t p,
+			  word_t mpinv)
+{
+	_nn_redc1_init_out(out, in1, in2, p);
+	_nn_mul_redc1_words(out->val, in1->val, in2->val, p->val, p->wlen,
+			    mpinv, 0);
+}
 
-	/*
-	 * This can be skipped if the first iteration of the for loop
-	 * is separated.
-	 */
-	for (i = 0; i < out->wlen; i++) {
-		out->val[i] = 0;
+void nn_mul_redc1(nn_t out, nn_src_t in1, nn_src_t in2, nn_src_t p,
+		  word_t mpinv)
+{
+	_nn_redc1_init_out(out, in1, in2, p);
+	nn_mul_redc1_words(out->val, in1->val, in2->val, p->val, p->wlen,
+			   mpinv);
+}
+
+/*
+ * Montgomery squaring, i.e. out = in^2 * r^(-1) mod p. Aliasing is
+ * supported.
+ */
+void nn_sqr_redc1(nn_t out, nn_src_t in, nn_src_t p, word_t mpinv)
+{
+	_nn_redc1_init_out(out, in, NULL, p);
+	nn_sqr_redc1_words(out->val, in->val, p->val, p->wlen, mpinv);
+}
+
+/*
+ * Montgomery reduction only, i.e. out = in * r^(-1) mod p. Aliasing is
+ * supported.
+ */
+void nn_redc1(nn_t out, nn_src_t in, nn_src_t p, word_t mpinv)
+{
+	_nn_redc1_init_out(out, in, NULL, p);
+	nn_redc1_words(out->val, in->val, p->val, p->wlen, mpinv);
+}
+/*
+ * Compute out = in^e in the Montgomery representation modulo p, e being
+ * a fixed exponent given by an addition chain (see nn_mul_redc1.h). The
+ * sequence of operations only depends on the chain, so the computation
+ * is constant time for a given chain. in must be < p. Aliasing of out
+ * and in is supported.
+ */
+void nn_pow_redc1_chain(nn_t out, nn_src_t in, const u8 *chain,
+			u16 chain_len, nn_src_t p, word_t mpinv)
+{
+	nn t[NN_CHAIN_MAX_REGS];
+	u8 dst = 0, src, nsqr, mul, j;
+	u16 i;
+
+	nn_check_initialized(in);
+	nn_check_initialized(p);
+	MUST_HAVE((chain != NULL) && (chain_len > 0) && ((chain_len % 3) == 0));
+
+	for (j = 0; j < NN_CHAIN_MAX_REGS; j++) {
+		nn_init(&t[j], 0);
 	}
-	for (i = 0; i < len; i++) {
-		carry = WORD(0);
-		for (j = 0; j < len_mul; j++) {
-			WORD_MUL(prod_high, prod_low, a->val[i], b->val[j]);
-			prod_low += carry;
-			prod_high += (prod_low < carry);
-			out->val[j] += prod_low;
-			carry = prod_high + (out->val[j] < prod_low);
+	nn_copy(&t[0], in);
+
+	for (i = 0; i < chain_len; i += 3) {
+		dst = (u8)(chain[i] >> 4);
+		src = (u8)(chain[i] & 0xf);
+		nsqr = chain[i + 1];
+		mul = chain[i + 2];
+		MUST_HAVE((mul == NN_CHAIN_NO_MUL) || (mul < NN_CHAIN_MAX_REGS));
+
+		if (dst != src) {
+			nn_copy(&t[dst], &t[src]);
 		}
-		for (; j < len; j++) {
-			out->val[j] += carry;
-			carry = out->val[j] < carry;
+		for (j = 0; j < nsqr; j++) {
+			nn_sqr_redc1(&t[dst], &t[dst], p, mpinv);
 		}
-		out->val[j] += carry;
-		acc = out->val[j] < carry;
-
-		m = out->val[0] * mpinv;
-		WORD_MUL(prod_high, prod_low, m, p->val[0]);
-		prod_low += out->val[0];
-		carry = prod_high + (prod_low < out->val[0]);
-		for (j = 1; j < len; j++) {
-			WORD_MUL(prod_high, prod_low, m, p->val[j]);
-			prod_low += carry;
-			prod_high += (prod_low < carry);
-			out->val[j - 1] = prod_low + out->val[j];
-			carry = prod_high + (out->val[j - 1] < prod_low);
+		if (mul != NN_CHAIN_NO_MUL) {
+			nn_mul_redc1(&t[dst], &t[dst], &t[mul], p, mpinv);
 		}
-		out->val[j - 1] = carry + out->val[j];
-		carry = out->val[j - 1] < out->val[j];
-		out->val[j] = acc + carry;
 	}
-	/*
-	 * Note that at this stage the msw of out is either 0 or 1.
-	 * If out > p we need to subtract p from out.
-	 */
-	nn_cnd_sub(nn_cmp(out, p) >= 0, out, out, p);
-	MUST_HAVE(nn_cmp(out, p) < 0);
-	/* We restore out wlen. */
-	out->wlen -= 1;
+	nn_copy(out, &t[dst]);
+
+	for (j = 0; j < NN_CHAIN_MAX_REGS; j++) {
+		nn_uninit(&t[j]);
+	}
 }
 
-void nn_mul_redc1(nn_t out, nn_src_t in1, nn_src_t in2, nn_src_t p,
-		  word_t mpinv)
+#define NN_MOD_CTX_MAGIC ((word_t)(0x5bd1e9958e36cb71ULL))
+
+void nn_mod_ctx_check_initialized(nn_mod_ctx_src_t ctx)
 {
-#ifdef WITH_LL_U256_MONT
-	my_nn_mul_redc1(out, in1, in2, p, mpinv);
-#else
-	nn out_cpy;
-	_nn_mul_redc1(&out_cpy, in1, in2, p, mpinv);
-	nn_init(out, out_cpy.wlen);
-	nn_copy(out, &out_cpy);
-#endif
+	MUST_HAVE((ctx != NULL) && (ctx->magic == NN_MOD_CTX_MAGIC));
+}
+
+int nn_mod_ctx_is_initialized(nn_mod_ctx_src_t ctx)
+{
+	return !!((ctx != NULL) && (ctx->magic == NN_MOD_CTX_MAGIC));
 }
 
 /*
- * Compute in1 * in2 mod p where in1 and in2 are numbers < p and
- * p is an odd number. The function redcifies in1 and in2
- * parameters, does the computation and then unredcifies the
- * result.
- *
- * From a mathematical standpoint, the computation is equivalent
- * to performing:
- *
- *   nn_mul(&tmp2, in1, in2);
- *   nn_mod(&out, &tmp2, q);
- *
- * but the modular reduction is done progressively during
- * Montgomery reduction.
+ * Initialize the Montgomery context ctx for the odd modulus m, i.e.
+ * compute r, r^2 and mpinv once for all.
  */
-void nn_mul_mod(nn_t out, nn_src_t in1, nn_src_t in2, nn_src_t p_in)
+void nn_mod_ctx_init(nn_mod_ctx_t ctx, nn_src_t m)
 {
-	nn r, r_square;
-	nn in1_tmp, in2_tmp, tmp;
-	word_t mpinv;
-	nn one;
-	nn p;
+	MUST_HAVE(ctx != NULL);
+	nn_check_initialized(m);
+	MUST_HAVE(nn_isodd(m));
 
-	nn_init(&p, 0);
-	nn_copy(&p, p_in);
+	nn_init(&(ctx->m), 0);
+	nn_copy(&(ctx->m), m);
 
 	/*
 	 * In order for our reciprocal division routines to work, it is
@@ -260,28 +663,68 @@ void nn_mul_mod(nn_t out, nn_src_t in1, nn_src_t in2, nn_src_t p_in)
 	 * input prime p is >= 2 * wlen where wlen is the number of bits
 	 * of a word size.
 	 */
-	if (p.wlen < 2) {
-		nn_set_wlen(&p, 2);
+	if (ctx->m.wlen < 2) {
+		nn_set_wlen(&(ctx->m), 2);
 	}
 
-	/* Compute Mongtomery coefs */
-	mpinv = nn_compute_redc1_coefs(&r, &r_square, &p);
-	nn_uninit(&r);
+	ctx->mpinv = nn_compute_redc1_coefs(&(ctx->r), &(ctx->r_square),
+					    &(ctx->m));
+	ctx->inv_chain = NULL;
+	ctx->inv_chain_len = 0;
+	ctx->magic = NN_MOD_CTX_MAGIC;
+}
 
-	/* redcify in1 and in2 */
-	nn_mul_redc1(&in1_tmp, in1, &r_square, &p, mpinv);
-	nn_mul_redc1(&in2_tmp, in2, &r_square, &p, mpinv);
+/*
+ * Attach to ctx an addition chain for m - 2, m being prime, which is then
+ * used by nn_modinv_fixed().
+ */
+void nn_mod_ctx_set_inv_chain(nn_mod_ctx_t ctx, const u8 *chain,
+			      u16 chain_len)
+{
+	nn_mod_ctx_check_initialized(ctx);
+	MUST_HAVE((chain != NULL) && (chain_len > 0) && ((chain_len % 3) == 0));
 
-	/* Compute in1 * in2 mod p in montgomery world */
-	nn_mul_redc1(&tmp, &in1_tmp, &in2_tmp, &p, mpinv);
-	nn_uninit(&in1_tmp);
-	nn_uninit(&in2_tmp);
+	ctx->inv_chain = chain;
+	ctx->inv_chain_len = chain_len;
+}
 
-	/* Come back to real world by unredcifying result */
-	nn_init(&one, 0);
-	nn_one(&one);
-	nn_mul_redc1(out, &tmp, &one, &p, mpinv);
+/*
+ * Compute out = in1 * in2 mod m where in1 and in2 are numbers < m, m
+ * being the modulus of the Montgomery context ctx. Two Montgomery
+ * multiplications are used: in1 * in2 / r, and then times r^2 / r.
+ * Aliasing of out with the inputs is supported.
+ */
+void nn_mul_mod_ctx(nn_t out, nn_src_t in1, nn_src_t in2,
+		    nn_mod_ctx_src_t ctx)
+{
+	nn tmp;
+
+	nn_mod_ctx_check_initialized(ctx);
+
+	nn_mul_redc1(&tmp, in1, in2, &(ctx->m), ctx->mpinv);
+	nn_mul_redc1(out, &tmp, &(ctx->r_square), &(ctx->m), ctx->mpinv);
 	nn_uninit(&tmp);
-	nn_uninit(&one);
-	nn_uninit(&p);
+}
+
+/*
+ * Compute in1 * in2 mod p where in1 and in2 are numbers < p and
+ * p is an odd number. The Montgomery coefficients of p are computed
+ * on each call: use nn_mul_mod_ctx() with a context built once when
+ * several multiplications modulo p are performed.
+ *
+ * From a mathematical standpoint, the computation is equivalent
+ * to performing:
+ *
+ *   nn_mul(&tmp2, in1, in2);
+ *   nn_mod(&out, &tmp2, q);
+ *
+ * but the modular reduction is done progressively during
+ * Montgomery reduction.
+ */
+void nn_mul_mod(nn_t out, nn_src_t in1, nn_src_t in2, nn_src_t p_in)
+{
+	nn_mod_ctx ctx;
+
+	nn_mod_ctx_init(&ctx, p_in);
+	nn_mul_mod_ctx(out, in1, in2, &ctx);
 }
@@ -20,6 +20,73 @@
 word_t nn_compute_redc1_coefs(nn_t r, nn_t r_square, nn_src_t p_in);
 void nn_mul_redc1(nn_t out, nn_src_t in1, nn_src_t in2, nn_src_t p,
 		  word_t mpinv);
+void nn_mul_redc1_generic(nn_t out, nn_src_t in1, nn_src_t in2, nn_src_t p,
+			  word_t mpinv);
+void nn_sqr_redc1(nn_t out, nn_src_t in, nn_src_t p, word_t mpinv);
+void nn_redc1(nn_t out, nn_src_t in, nn_src_t p, word_t mpinv);
 void nn_mul_mod(nn_t out, nn_src_t in1, nn_src_t in2, nn_src_t p);
 
+/*
+ * The same Montgomery routines on raw little endian word arrays of len
+ * words (the length of p), inputs being < p. Aliasing is supported.
+ */
+void nn_mul_redc1_words(word_t *out, const word_t *in1, const word_t *in2,
+			const word_t *p, u8 len, word_t mpinv);
+void nn_sqr_redc1_words(word_t *out, const word_t *in, const word_t *p,
+			u8 len, word_t mpinv);
+void nn_redc1_words(word_t *out, const word_t *in, const word_t *p, u8 len,
+		    word_t mpinv);
+/*
+ * Lazy versions for 4p < B^len: inputs and result are only < 2p (no final
+ * subtraction).
+ */
+void nn_mul_redc1_words_lazy(word_t *out, const word_t *in1,
+			     const word_t *in2, const word_t *p, u8 len,
+			     word_t mpinv);
+void nn_sqr_redc1_words_lazy(word_t *out, const word_t *in, const word_t *p,
+			     u8 len, word_t mpinv);
+
+/*
+ * Addition chains run by nn_pow_redc1_chain(): each instruction is three
+ * bytes ((dst << 4) | src, nsqr, mul) meaning
+ * t[dst] = t[src]^(2^nsqr) * t[mul], no multiplication being done when
+ * mul is NN_CHAIN_NO_MUL. See scripts/addchain.py.
+ */
+#define NN_CHAIN_MAX_REGS	16
+#define NN_CHAIN_NO_MUL		0xff
+void nn_pow_redc1_chain(nn_t out, nn_src_t in, const u8 *chain,
+			u16 chain_len, nn_src_t p, word_t mpinv);
+
+/*
+ * Montgomery context for computations modulo a fixed odd number m (e.g.
+ * the order q of a curve), built once so that the Montgomery coefficients
+ * are not recomputed on each operation as nn_mul_mod() does.
+ */
+typedef struct {
+	/* The modulus, with at least two words */
+	nn m;
+	/* r = 2^(m.wlen * WORD_BITS) mod m and r^2 mod m */
+	nn r;
+	nn r_square;
+	/* -m^-1 mod 2^WORD_BITS */
+	word_t mpinv;
+
+	/* Optional addition chain for m - 2 (m prime), see nn_modinv_fixed() */
+	const u8 *inv_chain;
+	u16 inv_chain_len;
+
+	word_t magic;
+} nn_mod_ctx;
+
+typedef nn_mod_ctx *nn_mod_ctx_t;
+typedef const nn_mod_ctx *nn_mod_ctx_src_t;
+
+void nn_mod_ctx_check_initialized(nn_mod_ctx_src_t ctx);
+int nn_mod_ctx_is_initialized(nn_mod_ctx_src_t ctx);
+void nn_mod_ctx_init(nn_mod_ctx_t ctx, nn_src_t m);
+void nn_mod_ctx_set_inv_chain(nn_mod_ctx_t ctx, const u8 *chain,
+			      u16 chain_len);
+void nn_mul_mod_ctx(nn_t out, nn_src_t in1, nn_src_t in2,
+		    nn_mod_ctx_src_t ctx);
+
 #endif /* __NN_MUL_REDC1_H__ */
@@ -51,6 +51,11 @@ void ecdsa_init_pub_key(ec_pub_key *out_pub, ec_priv_key *in_priv)
 		goto err;
 	}
 	nn_uninit(&scalar_b);
+	/*
+	 * Keep Y normalized (Z = 1), which saves its normalization in each
+	 * verification (see jprj_pt_ec_mult_wnaf())
+	 */
+	prj_pt_normalize(&(out_pub->y));
 
 	out_pub->key_type = ECDSA;
 	out_pub->params = in_priv->params;
@@ -172,6 +177,8 @@ int _ecdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 	prj_pt kG;
 	aff_pt W;
 	nn_src_t q, x;
+	nn_barrett_ctx_src_t q_barrett;
+	nn_mod_ctx_src_t q_ctx;
 	u8 hsize, q_len;
 	int ret;
 
@@ -186,6 +193,8 @@ int _ecdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 	/* Make things more readable */
 	priv_key = &(ctx->key_pair->priv_key);
 	q = &(priv_key->params->ec_gen_order);
+	q_barrett = &(priv_key->params->ec_gen_order_barrett);
+	q_ctx = &(priv_key->params->ec_gen_order_ctx);
 	q_bit_len = priv_key->params->ec_gen_order_bitlen;
 	G = &(priv_key->params->ec_gen);
 	q_len = (u8)BYTECEIL(q_bit_len);
@@ -234,7 +243,7 @@ int _ecdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 		nn_rshift_fixedlen(&tmp2, &tmp2, rshift);
 	}
 	dbg_nn_print("h   final import as nn", &tmp2);
-	nn_mod(&e, &tmp2, q);
+	nn_barrett_reduce(&e, &tmp2, q_barrett);
 	dbg_nn_print("e", &e);
 
  restart:
@@ -284,11 +293,12 @@ int _ecdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 	prj_pt_to_aff(&W, &kG);
 	prj_pt_uninit(&kG);
 
-	dbg_nn_print("W_x", &(W.x.fp_val));
-	dbg_nn_print("W_y", &(W.y.fp_val));
+	dbg_fp_print("W_x", &(W.x));
+	dbg_fp_print("W_y", &(W.y));
 
 	/* 6. Compute r = W_x mod q */
-	nn_mod(&r, &(W.x.fp_val), q);
+	fp_get_nn(&r, &(W.x));
+	nn_barrett_reduce(&r, &r, q_barrett);
 	aff_pt_uninit(&W);
 	dbg_nn_print("r", &r);
 
@@ -302,14 +312,14 @@ int _ecdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 
 #ifdef USE_SIG_BLINDING
 	/* Blind r with b */
-	nn_mul_mod(&r, &r, &b, q);
+	nn_mul_mod_ctx(&r, &r, &b, q_ctx);
 
 	/* Blind the message e */
-	nn_mul_mod(&e, &e, &b, q);
+	nn_mul_mod_ctx(&e, &e, &b, q_ctx);
 #endif /* USE_SIG_BLINDING */
 
 	/* tmp = xr mod q */
-	nn_mul_mod(&tmp, x, &r, q);
+	nn_mul_mod_ctx(&tmp, x, &r, q_ctx);
 	dbg_nn_print("x*r mod q", &tmp);
 
 	/* 8. If e == rx, restart the process at step 4. */
@@ -329,16 +339,16 @@ int _ecdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 	/* In case of blinding, we compute (b*k)^-1, and 
 	 * b^-1 will automatically unblind (r*x) in the following
 	 */
-	nn_mul_mod(&k, &k, &b, q);
+	nn_mul_mod_ctx(&k, &k, &b, q_ctx);
 #endif
 	/* Compute k^-1 mod q */
-	nn_modinv(&kinv, &k, q);
+	nn_modinv_ctx(&kinv, &k, q_ctx);
 	nn_uninit(&k);
 
 	dbg_nn_print("k^-1 mod q", &kinv);
 
 	/* s = k^-1 * tmp2 mod q */
-	nn_mul_mod(&s, &tmp2, &kinv, q);
+	nn_mul_mod_ctx(&s, &tmp2, &kinv, q_ctx);
 	nn_uninit(&kinv);
 	nn_uninit(&tmp2);
 
@@ -367,6 +377,8 @@ int _ecdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 	PTR_NULLIFY(priv_key);
 	PTR_NULLIFY(G);
 	PTR_NULLIFY(q);
+	PTR_NULLIFY(q_ctx);
+	PTR_NULLIFY(q_barrett);
 	PTR_NULLIFY(x);
 	VAR_ZEROIFY(q_len);
 	VAR_ZEROIFY(q_bit_len);
@@ -492,16 +504,54 @@ int _ecdsa_verify_update(struct ec_verify_context *ctx,
 	return 0;
 }
 
+/*
+ * Check that r = x mod q for the point W = (X, Y, Z) in Jacobian
+ * coordinates, whose x is X / Z^2, without inverting Z: as 0 <= x < p,
+ * this holds if and only if x = r + k * q for some k >= 0 with
+ * r + k * q < p, i.e. (r + k * q) * Z^2 = X (only k = 0 and k = 1 being
+ * possible when p < 2 * q). W must not be the point at infinity. Returns
+ * 0 when r matches, -1 otherwise.
+ */
+static int ecdsa_r_check_projective(nn_src_t r, prj_pt_src_t W, nn_src_t q)
+{
+	fp_ctx_src_t ctx = W->X.ctx;
+	fp z2, c_fp;
+	nn c;
+	int ret = -1;
+
+	fp_init(&z2, ctx);
+	fp_init(&c_fp, ctx);
+	fp_sqr(&z2, &(W->Z));
+
+	nn_copy(&c, r);
+	while (nn_cmp(&c, &(ctx->p)) < 0) {
+		fp_set_nn(&c_fp, &c);
+		fp_mul(&c_fp, &c_fp, &z2);
+		if (fp_cmp(&c_fp, &(W->X)) == 0) {
+			ret = 0;
+			break;
+		}
+		nn_add(&c, &c, q);
+	}
+
+	nn_uninit(&c);
+	fp_uninit(&z2);
+	fp_uninit(&c_fp);
+
+	return ret;
+}
+
 int _ecdsa_verify_finalize(struct ec_verify_context *ctx)
 {
 	// prj_pt uG, vY, W_prime;
 	prj_pt W_prime;
-	nn e, tmp, sinv, u, v, r_prime;
+	nn e, tmp, sinv, u, v;
 	// aff_pt W_prime_aff;
 	prj_pt_src_t G, Y;
 	u8 hash[MAX_DIGEST_SIZE];
 	bitcnt_t rshift, q_bit_len;
-	nn_src_t q;
+	nn_barrett_ctx_src_t q_barrett;
+	nn_mod_ctx_src_t q_ctx;
 	nn *s, *r;
 	u8 hsize;
 	int ret;
@@ -517,7 +567,8 @@ int _ecdsa_verify_finalize(struct ec_verify_context *ctx)
 	/* Make things more readable */
 	G = &(ctx->pub_key->params->ec_gen);
 	Y = &(ctx->pub_key->y);
-	q = &(ctx->pub_key->params->ec_gen_order);
+	q_barrett = &(ctx->pub_key->params->ec_gen_order_barrett);
+	q_ctx = &(ctx->pub_key->params->ec_gen_order_ctx);
 	q_bit_len = ctx->pub_key->params->ec_gen_order_bitlen;
 	hsize = ctx->h->digest_size;
 	r = &(ctx->verify_data.ecdsa.r);
@@ -553,24 +604,23 @@ int _ecdsa_verify_finalize(struct ec_verify_context *ctx)
 	}
 	dbg_nn_print("h   final import as nn", &tmp);
 
-	nn_mod(&e, &tmp, q);
+	nn_barrett_reduce(&e, &tmp, q_barrett);
 	nn_uninit(&tmp);
 	dbg_nn_print("e", &e);
 
 	/* Compute s^-1 mod q */
-	nn_modinv(&sinv, s, q);
+	nn_modinv_ctx(&sinv, s, q_ctx);
 	dbg_nn_print("s", s);
 	dbg_nn_print("sinv", &sinv);
 	nn_uninit(s);
 
 	/* 5. Compute u = (s^-1)e mod q */
-	nn_mul(&tmp, &e, &sinv);
+	nn_mul_mod_ctx(&u, &e, &sinv, q_ctx);
 	nn_uninit(&e);
-	nn_mod(&u, &tmp, q);
 	dbg_nn_print("u = (s^-1)e mod q", &u);
 
 	/* 6. Compute v = (s^-1)r mod q */
-	nn_mul_mod(&v, r, &sinv, q);
+	nn_mul_mod_ctx(&v, r, &sinv, q_ctx);
 	dbg_nn_print("v = (s^-1)r mod q", &v);
 	nn_uninit(&sinv);
 	nn_uninit(&tmp);
@@ -585,7 +635,7 @@ int _ecdsa_verify_finalize(struct ec_verify_context *ctx)
 
 	// prj_pt_copy(&W_prime, Y);
 	// prj_pt_copy(&W_prime, G);
-	prj_pt_ec_mult_wnaf(&W_prime, &u, G, &v, Y);
+	jprj_pt_ec_mult_wnaf(&W_prime, &u, G, &v, Y);
 	// prj_pt_copy(&uG, G);
 	// prj_pt_copy(&vY, Y);
 	// prj_pt_copy(&W_prime, Y);
@@ -604,18 +654,13 @@ int _ecdsa_verify_finalize(struct ec_verify_context *ctx)
 		goto err;
 	}
 
-	/* 9. Compute r' = W'_x mod q */
-	// prj_pt_to_aff(&W_prime_aff, &W_prime);
-	// dbg_nn_print("W'_x", &(W_prime_aff.x.fp_val));
-	// dbg_nn_print("W'_y", &(W_prime_aff.y.fp_val));
-	// nn_mod(&r_prime, &(W_prime_aff.x.fp_val), q);
-	nn_mod(&r_prime, &(W_prime.X.fp_val), q);
+	/*
+	 * 9. Compute r' = W'_x mod q and 10. accept the signature if and
+	 * only if r equals r', W' being kept in Jacobian coordinates
+	 */
+	ret = ecdsa_r_check_projective(r, &W_prime,
+				       &(ctx->pub_key->params->ec_gen_order));
 	prj_pt_uninit(&W_prime);
-	// aff_pt_uninit(&W_prime_aff);
-
-	/* 10. Accept the signature if and only if r equals r' */
-	ret = (nn_cmp(&r_prime, r) != 0) ? -1 : 0;
-	nn_uninit(&r_prime);
 
  err:
 	/*
@@ -629,7 +674,8 @@ int _ecdsa_verify_finalize(struct ec_verify_context *ctx)
 	PTR_NULLIFY(Y);
 	VAR_ZEROIFY(rshift);
 	VAR_ZEROIFY(q_bit_len);
-	PTR_NULLIFY(q);
+	PTR_NULLIFY(q_ctx);
+	PTR_NULLIFY(q_barrett);
 	PTR_NULLIFY(s);
 	PTR_NULLIFY(r);
 	VAR_ZEROIFY(hsize);
@@ -191,8 +191,8 @@ int _ecfsdsa_sign_init(struct ec_sign_context *ctx)
 	prj_pt_to_aff(&W, &kG);
 	prj_pt_uninit(&kG);
 
-	dbg_nn_print("Wx", &(W.x.fp_val));
-	dbg_nn_print("Wy", &(W.y.fp_val));
+	dbg_fp_print("Wx", &(W.x));
+	dbg_fp_print("Wy", &(W.y));
 
 	/*  3. Compute r = FE2OS(W_x)||FE2OS(W_y) */
 	fp_export_to_buf(r, p_len, &(W.x));
@@ -256,6 +256,8 @@ int _ecfsdsa_sign_update(struct ec_sign_context *ctx,
 int _ecfsdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 {
 	nn_src_t q, x;
+	nn_barrett_ctx_src_t q_barrett;
+	nn_mod_ctx_src_t q_ctx;
 	nn tmp, s, e, ex, *k;
 	const ec_priv_key *priv_key;
 	u8 e_buf[MAX_DIGEST_SIZE];
@@ -280,6 +282,8 @@ int _ecfsdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 	/* Make things more readable */
 	priv_key = &(ctx->key_pair->priv_key);
 	q = &(priv_key->params->ec_gen_order);
+	q_barrett = &(priv_key->params->ec_gen_order_barrett);
+	q_ctx = &(priv_key->params->ec_gen_order_ctx);
 	x = &(priv_key->x);
 	p_bit_len = ctx->key_pair->priv_key.params->ec_fp.p_bitlen;
 	q_bit_len = ctx->key_pair->priv_key.params->ec_gen_order_bitlen;
@@ -310,18 +314,18 @@ int _ecfsdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 	/*  6. Compute e by converting h to an integer and reducing it mod q */
 	nn_init_from_buf(&tmp, e_buf, hsize);
 	local_memset(e_buf, 0, hsize);
-	nn_mod(&e, &tmp, q);
+	nn_barrett_reduce(&e, &tmp, q_barrett);
 
 #ifdef USE_SIG_BLINDING
 	/* Blind e with b */
-	nn_mul_mod(&e, &e, &b, q);
+	nn_mul_mod_ctx(&e, &e, &b, q_ctx);
 #endif /* USE_SIG_BLINDING */
 	/*  7. Compute s = (k + ex) mod q */
-	nn_mul_mod(&ex, &e, x, q);
+	nn_mul_mod_ctx(&ex, &e, x, q_ctx);
 	nn_uninit(&e);
 #ifdef USE_SIG_BLINDING
 	/* Blind k with b */
-	nn_mul_mod(&s, k, &b, q);
+	nn_mul_mod_ctx(&s, k, &b, q_ctx);
 	nn_mod_add(&s, &s, &ex, q);
 #else
 	nn_mod_add(&s, k, &ex, q);
@@ -330,8 +334,8 @@ int _ecfsdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 	nn_uninit(&tmp);
 #ifdef USE_SIG_BLINDING
 	/* Unblind s */
-        nn_modinv(&binv, &b, q);
-	nn_mul_mod(&s, &s, &binv, q);	
+        nn_modinv_ctx(&binv, &b, q_ctx);
+	nn_mul_mod_ctx(&s, &s, &binv, q_ctx);	
 #endif /* USE_SIG_BLINDING */
 	dbg_nn_print("s: ", &s);
 
@@ -363,6 +367,8 @@ int _ecfsdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 	local_memset(&(ctx->sign_data.ecfsdsa), 0, sizeof(ecfsdsa_sign_data));
 
 	PTR_NULLIFY(q);
+	PTR_NULLIFY(q_ctx);
+	PTR_NULLIFY(q_barrett);
 	PTR_NULLIFY(x);
 	PTR_NULLIFY(k);
 	PTR_NULLIFY(priv_key);
@@ -530,6 +536,7 @@ int _ecfsdsa_verify_finalize(struct ec_verify_context *ctx)
 {
 	prj_pt_src_t G, Y;
 	nn_src_t q;
+	nn_barrett_ctx_src_t q_barrett;
 	nn tmp, tmp2, e, *s;
 	prj_pt sG, eY, Wprime;
 	bitcnt_t p_bit_len, r_len;
@@ -552,6 +559,7 @@ int _ecfsdsa_verify_finalize(struct ec_verify_context *ctx)
 	G = &(ctx->pub_key->params->ec_gen);
 	Y = &(ctx->pub_key->y);
 	q = &(ctx->pub_key->params->ec_gen_order);
+	q_barrett = &(ctx->pub_key->params->ec_gen_order_barrett);
 	hsize = ctx->h->digest_size;
 	s = &(ctx->verify_data.ecfsdsa.s);
 	r = ctx->verify_data.ecfsdsa.r;
@@ -570,7 +578,7 @@ int _ecfsdsa_verify_finalize(struct ec_verify_context *ctx)
 	 */
 	nn_init_from_buf(&tmp, e_buf, hsize);
 	local_memset(e_buf, 0, hsize);
-	nn_mod(&tmp2, &tmp, q);
+	nn_barrett_reduce(&tmp2, &tmp, q_barrett);
 	nn_uninit(&tmp);
 	if (nn_iszero(&tmp2)) {
 		nn_zero(&e);
@@ -611,6 +619,7 @@ int _ecfsdsa_verify_finalize(struct ec_verify_context *ctx)
 	PTR_NULLIFY(G);
 	PTR_NULLIFY(Y);
 	PTR_NULLIFY(q);
+	PTR_NULLIFY(q_barrett);
 	PTR_NULLIFY(s);
 	PTR_NULLIFY(r);
 	VAR_ZEROIFY(p_len);
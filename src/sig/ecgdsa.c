@@ -159,6 +159,8 @@ int _ecgdsa_sign_update(struct ec_sign_context *ctx,
 int _ecgdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 {
 	nn_src_t q, x;
+	nn_barrett_ctx_src_t q_barrett;
+	nn_mod_ctx_src_t q_ctx;
 	nn tmp, tmp2, s, e, kr, k, r;
 #ifdef USE_SIG_BLINDING
         /* b is the blinding mask */
@@ -188,6 +190,8 @@ int _ecgdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 	priv_key = &(ctx->key_pair->priv_key);
 	G = &(priv_key->params->ec_gen);
 	q = &(priv_key->params->ec_gen_order);
+	q_barrett = &(priv_key->params->ec_gen_order_barrett);
+	q_ctx = &(priv_key->params->ec_gen_order_ctx);
 	x = &(priv_key->x);
 	q_bit_len = priv_key->params->ec_gen_order_bitlen;
 	p_bit_len = priv_key->params->ec_fp.p_bitlen;
@@ -227,7 +231,7 @@ int _ecgdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 	 */
 	nn_init_from_buf(&tmp, e_buf, hsize);
 	local_memset(e_buf, 0, hsize);
-	nn_mod(&tmp2, &tmp, q);
+	nn_barrett_reduce(&tmp2, &tmp, q_barrett);
 	if (nn_iszero(&tmp2)) {
 		nn_zero(&e);
 	} else {
@@ -284,11 +288,12 @@ int _ecgdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 	prj_pt_to_aff(&W, &kG);
 	prj_pt_uninit(&kG);
 
-	dbg_nn_print("W_x", &(W.x.fp_val));
-	dbg_nn_print("W_y", &(W.y.fp_val));
+	dbg_fp_print("W_x", &(W.x));
+	dbg_fp_print("W_y", &(W.y));
 
 	/* 5. Compute r = Wx mod q */
-	nn_mod(&r, &(W.x.fp_val), q);
+	fp_get_nn(&r, &(W.x));
+	nn_barrett_reduce(&r, &r, q_barrett);
 	aff_pt_uninit(&W);
 	dbg_nn_print("r", &r);
 
@@ -302,22 +307,22 @@ int _ecgdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 
 #ifdef USE_SIG_BLINDING
 	/* Blind e and r with b */
-	nn_mul_mod(&e, &e, &b, q);
-	nn_mul_mod(&r, &r, &b, q);
+	nn_mul_mod_ctx(&e, &e, &b, q_ctx);
+	nn_mul_mod_ctx(&r, &r, &b, q_ctx);
 #endif /* USE_SIG_BLINDING */
 	/* 7. Compute s = x(kr + e) mod q */
-	nn_mul_mod(&kr, &k, &r, q);
+	nn_mul_mod_ctx(&kr, &k, &r, q_ctx);
 	nn_uninit(&k);
 	nn_mod_add(&tmp2, &kr, &e, q);
 	nn_uninit(&kr);
 	nn_uninit(&e);
 	nn_uninit(&tmp);
-	nn_mul_mod(&s, x, &tmp2, q);
+	nn_mul_mod_ctx(&s, x, &tmp2, q_ctx);
 	nn_uninit(&tmp2);
 #ifdef USE_SIG_BLINDING
 	/* Unblind s */
-	nn_modinv(&binv, &b, q);
-	nn_mul_mod(&s, &s, &binv, q);
+	nn_modinv_ctx(&binv, &b, q_ctx);
+	nn_mul_mod_ctx(&s, &s, &binv, q_ctx);
 #endif
 	dbg_nn_print("s", &s);
 
@@ -350,6 +355,8 @@ int _ecgdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 	VAR_ZEROIFY(p_len);
 	VAR_ZEROIFY(hsize);
 	PTR_NULLIFY(q);
+	PTR_NULLIFY(q_ctx);
+	PTR_NULLIFY(q_barrett);
 	PTR_NULLIFY(x);
 	PTR_NULLIFY(priv_key);
 	PTR_NULLIFY(G);
@@ -485,7 +492,8 @@ int _ecgdsa_verify_finalize(struct ec_verify_context *ctx)
 	aff_pt Wprime_aff;
 	prj_pt_src_t G, Y;
 	u8 e_buf[MAX_DIGEST_SIZE];
-	nn_src_t q;
+	nn_barrett_ctx_src_t q_barrett;
+	nn_mod_ctx_src_t q_ctx;
 	u8 hsize;
 	int ret;
 
@@ -500,7 +508,8 @@ int _ecgdsa_verify_finalize(struct ec_verify_context *ctx)
 	/* Make things more readable */
 	G = &(ctx->pub_key->params->ec_gen);
 	Y = &(ctx->pub_key->y);
-	q = &(ctx->pub_key->params->ec_gen_order);
+	q_barrett = &(ctx->pub_key->params->ec_gen_order_barrett);
+	q_ctx = &(ctx->pub_key->params->ec_gen_order_ctx);
 	r = &(ctx->verify_data.ecgdsa.r);
 	s = &(ctx->verify_data.ecgdsa.s);
 	hsize = ctx->h->digest_size;
@@ -512,17 +521,15 @@ int _ecgdsa_verify_finalize(struct ec_verify_context *ctx)
 	/* 3. Compute e by converting h to an integer and reducing it mod q */
 	nn_init_from_buf(&tmp, e_buf, hsize);
 	local_memset(e_buf, 0, hsize);
-	nn_mod(&e, &tmp, q);
+	nn_barrett_reduce(&e, &tmp, q_barrett);
 
 	/* 4. Compute u = (r^-1)e mod q */
-	nn_modinv(&rinv, r, q);	/* r^-1 */
-	nn_mul(&tmp, &rinv, &e);	/* r^-1 * e */
-	nn_mod(&u, &tmp, q);	/* (r^-1 * e) mod q */
+	nn_modinv_ctx(&rinv, r, q_ctx);	/* r^-1 */
+	nn_mul_mod_ctx(&u, &rinv, &e, q_ctx);	/* (r^-1 * e) mod q */
 	nn_uninit(&e);
 
 	/* 5. Compute v = (r^-1)s mod q */
-	nn_mul(&tmp, &rinv, s);	/*  r^-1 * s */
-	nn_mod(&v, &tmp, q);	/* (r^-1 * s) mod q */
+	nn_mul_mod_ctx(&v, &rinv, s, q_ctx);	/* (r^-1 * s) mod q */
 	nn_uninit(&tmp);
 	nn_uninit(&rinv);
 
@@ -538,9 +545,10 @@ int _ecgdsa_verify_finalize(struct ec_verify_context *ctx)
 	/* 7. Compute r' = W'_x mod q */
 	prj_pt_to_aff(&Wprime_aff, &Wprime);
 	prj_pt_uninit(&Wprime);
-	dbg_nn_print("W'_x", &(Wprime_aff.x.fp_val));
-	dbg_nn_print("W'_y", &(Wprime_aff.y.fp_val));
-	nn_mod(&r_prime, &(Wprime_aff.x.fp_val), q);
+	dbg_fp_print("W'_x", &(Wprime_aff.x));
+	dbg_fp_print("W'_y", &(Wprime_aff.y));
+	fp_get_nn(&r_prime, &(Wprime_aff.x));
+	nn_barrett_reduce(&r_prime, &r_prime, q_barrett);
 	aff_pt_uninit(&Wprime_aff);
 
 	/* 8. Accept the signature if and only if r equals r' */
@@ -558,7 +566,8 @@ int _ecgdsa_verify_finalize(struct ec_verify_context *ctx)
 	PTR_NULLIFY(s);
 	PTR_NULLIFY(G);
 	PTR_NULLIFY(Y);
-	PTR_NULLIFY(q);
+	PTR_NULLIFY(q_ctx);
+	PTR_NULLIFY(q_barrett);
 	VAR_ZEROIFY(hsize);
 
 	return ret;
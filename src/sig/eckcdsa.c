@@ -249,6 +249,8 @@ int _eckcdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 {
 	prj_pt_src_t G;
 	nn_src_t q, x;
+	nn_barrett_ctx_src_t q_barrett;
+	nn_mod_ctx_src_t q_ctx;
 #ifdef USE_SIG_BLINDING
 	/* b is the blinding mask */
 	nn b, binv;
@@ -280,6 +282,8 @@ int _eckcdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 	priv_key = &(ctx->key_pair->priv_key);
 	G = &(priv_key->params->ec_gen);
 	q = &(priv_key->params->ec_gen_order);
+	q_barrett = &(priv_key->params->ec_gen_order_barrett);
+	q_ctx = &(priv_key->params->ec_gen_order_ctx);
 	hsize = ctx->h->digest_size;
 	p_len = (u8)BYTECEIL(priv_key->params->ec_fp.p_bitlen);
 	q_bit_len = priv_key->params->ec_gen_order_bitlen;
@@ -348,8 +352,8 @@ int _eckcdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 #endif /* USE_SIG_BLINDING */
 	prj_pt_to_aff(&W, &kG);
 	prj_pt_uninit(&kG);
-	dbg_nn_print("W_x", &(W.x.fp_val));
-	dbg_nn_print("W_y", &(W.y.fp_val));
+	dbg_fp_print("W_x", &(W.x));
+	dbg_fp_print("W_y", &(W.y));
 
 	/* 5 Compute r = h(FE2OS(W_x)). */
 	local_memset(tmp_buf, 0, sizeof(tmp_buf));
@@ -380,15 +384,15 @@ int _eckcdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 	}
 	nn_init_from_buf(&tmp, hzm, r_len);
 	local_memset(hzm, 0, r_len);
-	nn_mod(&e, &tmp, q);
+	nn_barrett_reduce(&e, &tmp, q_barrett);
 	nn_zero(&tmp);
 	dbg_nn_print("e", &e);
 
 #ifdef USE_SIG_BLINDING
 	/* In case of blinding, we compute (k*b - e*b) * x * b^-1 */
-	nn_mul_mod(&k, &k, &b, q);
-	nn_mul_mod(&e, &e, &b, q);
-	nn_modinv(&binv, &b, q);
+	nn_mul_mod_ctx(&k, &k, &b, q_ctx);
+	nn_mul_mod_ctx(&e, &e, &b, q_ctx);
+	nn_modinv_ctx(&binv, &b, q_ctx);
 #endif /* USE_SIG_BLINDING */
 	/*
 	 * 8. Compute s = x(k - e) mod q
@@ -403,12 +407,12 @@ int _eckcdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 	nn_zero(&e);
 	nn_mod_add(&tmp2, &k, &tmp, q);
 	nn_zero(&k);
-	nn_mul_mod(&s, x, &tmp2, q);
+	nn_mul_mod_ctx(&s, x, &tmp2, q_ctx);
 	nn_zero(&tmp2);
 	nn_zero(&tmp);
 #ifdef USE_SIG_BLINDING
 	/* Unblind s with b^-1 */
-	nn_mul_mod(&s, &s, &binv, q);
+	nn_mul_mod_ctx(&s, &s, &binv, q_ctx);
 #endif /* USE_SIG_BLINDING */
 
 	/* 9. if s == 0, restart at step 3. */
@@ -435,6 +439,8 @@ int _eckcdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 
 	PTR_NULLIFY(G);
 	PTR_NULLIFY(q);
+	PTR_NULLIFY(q_ctx);
+	PTR_NULLIFY(q_barrett);
 	PTR_NULLIFY(x);
 	VAR_ZEROIFY(i);
 	PTR_NULLIFY(priv_key);
@@ -641,7 +647,7 @@ int _eckcdsa_verify_finalize(struct ec_verify_context *ctx)
 	hash_context r_prime_ctx;
 	u8 hzm[MAX_DIGEST_SIZE];
 	unsigned int i;
-	nn_src_t q;
+	nn_barrett_ctx_src_t q_barrett;
 	nn e, tmp;
 	u8 hsize, shift;
 	int ret;
@@ -660,7 +666,7 @@ int _eckcdsa_verify_finalize(struct ec_verify_context *ctx)
 	pub_key = ctx->pub_key;
 	G = &(pub_key->params->ec_gen);
 	Y = &(pub_key->y);
-	q = &(pub_key->params->ec_gen_order);
+	q_barrett = &(pub_key->params->ec_gen_order_barrett);
 	p_bit_len = pub_key->params->ec_fp.p_bitlen;
 	q_bit_len = pub_key->params->ec_gen_order_bitlen;
 	p_len = (u8)BYTECEIL(p_bit_len);
@@ -692,7 +698,7 @@ int _eckcdsa_verify_finalize(struct ec_verify_context *ctx)
 	}
 	nn_init_from_buf(&tmp, hzm, r_len);
 	local_memset(hzm, 0, hsize);
-	nn_mod(&e, &tmp, q);
+	nn_barrett_reduce(&e, &tmp, q_barrett);
 	nn_zero(&tmp);
 
 	dbg_nn_print("e", &e);
@@ -706,8 +712,8 @@ int _eckcdsa_verify_finalize(struct ec_verify_context *ctx)
 	prj_pt_uninit(&eG);
 	prj_pt_to_aff(&Wprime_aff, &Wprime);
 	prj_pt_uninit(&Wprime);
-	dbg_nn_print("W'_x", &(Wprime_aff.x.fp_val));
-	dbg_nn_print("W'_y", &(Wprime_aff.y.fp_val));
+	dbg_fp_print("W'_x", &(Wprime_aff.x));
+	dbg_fp_print("W'_y", &(Wprime_aff.y));
 
 	/* 7. Compute r' = h(W'x) */
 	local_memset(tmp_buf, 0, sizeof(tmp_buf));
@@ -742,7 +748,7 @@ int _eckcdsa_verify_finalize(struct ec_verify_context *ctx)
 	VAR_ZEROIFY(i);
 	PTR_NULLIFY(G);
 	PTR_NULLIFY(Y);
-	PTR_NULLIFY(q);
+	PTR_NULLIFY(q_barrett);
 	VAR_ZEROIFY(p_len);
 	VAR_ZEROIFY(r_len);
 	VAR_ZEROIFY(q_bit_len);
@@ -153,6 +153,8 @@ int _ecrdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 	prj_pt kG;
 	aff_pt W;
 	nn_src_t q, x;
+	nn_barrett_ctx_src_t q_barrett;
+	nn_mod_ctx_src_t q_ctx;
 	u8 hsize, r_len, s_len;
 	int ret;
 
@@ -168,6 +170,8 @@ int _ecrdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 	priv_key = &(ctx->key_pair->priv_key);
 	G = &(priv_key->params->ec_gen);
 	q = &(priv_key->params->ec_gen_order);
+	q_barrett = &(priv_key->params->ec_gen_order_barrett);
+	q_ctx = &(priv_key->params->ec_gen_order_ctx);
 	p_bit_len = priv_key->params->ec_fp.p_bitlen;
 	q_bit_len = priv_key->params->ec_gen_order_bitlen;
 	x = &(priv_key->x);
@@ -229,11 +233,12 @@ int _ecrdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 #endif /* USE_SIG_BLINDING */
 	prj_pt_to_aff(&W, &kG);
 	prj_pt_uninit(&kG);
-	dbg_nn_print("W_x", &(W.x.fp_val));
-	dbg_nn_print("W_y", &(W.y.fp_val));
+	dbg_fp_print("W_x", &(W.x));
+	dbg_fp_print("W_y", &(W.y));
 
 	/* 4. Compute r = Wx mod q */
-	nn_mod(&r, &(W.x.fp_val), q);
+	fp_get_nn(&r, &(W.x));
+	nn_barrett_reduce(&r, &r, q_barrett);
 	aff_pt_uninit(&W);
 
 	/* 5. If r is 0, restart the process at step 2. */
@@ -251,7 +256,7 @@ int _ecrdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 	dbg_buf_print("H(m)", h_buf, hsize);
 	nn_init_from_buf(&tmp, h_buf, hsize);
 	local_memset(h_buf, 0, hsize);
-	nn_mod(&e, &tmp, q);
+	nn_barrett_reduce(&e, &tmp, q_barrett);
 	if (nn_iszero(&e)) {
 		nn_inc(&e, &e);
 	}
@@ -259,13 +264,13 @@ int _ecrdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 
 #ifdef USE_SIG_BLINDING
         /* In case of blinding, we blind r and e */
-        nn_mul_mod(&r, &r, &b, q);
-        nn_mul_mod(&e, &e, &b, q);
+        nn_mul_mod_ctx(&r, &r, &b, q_ctx);
+        nn_mul_mod_ctx(&e, &e, &b, q_ctx);
 #endif /* USE_SIG_BLINDING */
 
 	/* Compute s = (rx + ke) mod q */
-	nn_mul_mod(&rx, &r, x, q);
-	nn_mul_mod(&ke, &k, &e, q);
+	nn_mul_mod_ctx(&rx, &r, x, q_ctx);
+	nn_mul_mod_ctx(&ke, &k, &e, q_ctx);
 	nn_zero(&e);
 	nn_zero(&k);
 	nn_mod_add(&s, &rx, &ke, q);
@@ -274,8 +279,8 @@ int _ecrdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 	nn_zero(&tmp);
 #ifdef USE_SIG_BLINDING
 	/* Unblind s */
-        nn_modinv(&binv, &b, q);
-	nn_mul_mod(&s, &s, &binv, q);
+        nn_modinv_ctx(&binv, &b, q_ctx);
+	nn_mul_mod_ctx(&s, &s, &binv, q_ctx);
 #endif /* USE_SIG_BLINDING */
 
 	/* If s is 0, restart the process at step 2. */
@@ -308,6 +313,8 @@ int _ecrdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 	PTR_NULLIFY(priv_key);
 	PTR_NULLIFY(G);
 	PTR_NULLIFY(q);
+	PTR_NULLIFY(q_ctx);
+	PTR_NULLIFY(q_barrett);
 	PTR_NULLIFY(x);
 
 #ifdef USE_SIG_BLINDING
@@ -431,6 +438,8 @@ int _ecrdsa_verify_finalize(struct ec_verify_context *ctx)
 {
 	prj_pt_src_t G, Y;
 	nn_src_t q;
+	nn_barrett_ctx_src_t q_barrett;
+	nn_mod_ctx_src_t q_ctx;
 	nn tmp, h, r_prime, e, v, u;
 	prj_pt vY, uG, Wprime;
 	aff_pt Wprime_aff;
@@ -451,6 +460,8 @@ int _ecrdsa_verify_finalize(struct ec_verify_context *ctx)
 	G = &(ctx->pub_key->params->ec_gen);
 	Y = &(ctx->pub_key->y);
 	q = &(ctx->pub_key->params->ec_gen_order);
+	q_barrett = &(ctx->pub_key->params->ec_gen_order_barrett);
+	q_ctx = &(ctx->pub_key->params->ec_gen_order_ctx);
 	r = &(ctx->verify_data.ecrdsa.r);
 	s = &(ctx->verify_data.ecrdsa.s);
 	hsize = ctx->h->digest_size;
@@ -463,25 +474,23 @@ int _ecrdsa_verify_finalize(struct ec_verify_context *ctx)
 	/* 3. Compute e = OS2I(h)^-1 mod q */
 	nn_init_from_buf(&tmp, h_buf, hsize);
 	local_memset(h_buf, 0, hsize);
-	nn_mod(&h, &tmp, q);	/* h = OS2I(h) mod q */
+	nn_barrett_reduce(&h, &tmp, q_barrett);	/* h = OS2I(h) mod q */
 	if (nn_iszero(&h)) {	/* If h is equal to 0, set it to 1 */
 		nn_inc(&h, &h);
 	}
-	nn_modinv(&e, &h, q);	/* e = h^-1 mod q */
+	nn_modinv_ctx(&e, &h, q_ctx);	/* e = h^-1 mod q */
 	nn_zero(&h);
 
 	/* 4. Compute u = es mod q */
-	nn_mul(&tmp, &e, s);
-	nn_mod(&u, &tmp, q);
+	nn_mul_mod_ctx(&u, &e, s, q_ctx);
 
 	/* 5. Compute v = -er mod q
 	 *
 	 * Because we only support positive integers, we compute
 	 * v = -er mod q = q - (er mod q) (except when er is 0).
 	 */
-	nn_mul(&tmp, &e, r);	/* tmp = er */
+	nn_mul_mod_ctx(&tmp, &e, r, q_ctx);	/* tmp = er mod q */
 	nn_zero(&e);
-	nn_mod(&tmp, &tmp, q);	/* tmp = er mod q */
 	if (nn_iszero(&tmp)) {
 		nn_zero(&v);
 	} else {
@@ -499,11 +508,12 @@ int _ecrdsa_verify_finalize(struct ec_verify_context *ctx)
 	prj_pt_uninit(&vY);
 	prj_pt_to_aff(&Wprime_aff, &Wprime);
 	prj_pt_uninit(&Wprime);
-	dbg_nn_print("W'_x", &(Wprime_aff.x.fp_val));
-	dbg_nn_print("W'_y", &(Wprime_aff.y.fp_val));
+	dbg_fp_print("W'_x", &(Wprime_aff.x));
+	dbg_fp_print("W'_y", &(Wprime_aff.y));
 
 	/* 7. Compute r' = W'_x mod q */
-	nn_mod(&r_prime, &(Wprime_aff.x.fp_val), q);
+	fp_get_nn(&r_prime, &(Wprime_aff.x));
+	nn_barrett_reduce(&r_prime, &r_prime, q_barrett);
 	aff_pt_uninit(&Wprime_aff);
 
 	/* 8. Check r and r' are the same */
@@ -521,6 +531,8 @@ int _ecrdsa_verify_finalize(struct ec_verify_context *ctx)
 	PTR_NULLIFY(G);
 	PTR_NULLIFY(Y);
 	PTR_NULLIFY(q);
+	PTR_NULLIFY(q_ctx);
+	PTR_NULLIFY(q_barrett);
 	PTR_NULLIFY(r);
 	PTR_NULLIFY(s);
 	VAR_ZEROIFY(hsize);
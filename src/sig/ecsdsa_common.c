@@ -187,8 +187,8 @@ int __ecsdsa_sign_init(struct ec_sign_context *ctx,
 #endif
 	prj_pt_to_aff(&W_aff, &kG);
 	prj_pt_uninit(&kG);
-	dbg_nn_print("W_x", &(W_aff.x.fp_val));
-	dbg_nn_print("W_y", &(W_aff.y.fp_val));
+	dbg_fp_print("W_x", &(W_aff.x));
+	dbg_fp_print("W_y", &(W_aff.y));
 
 	/*
 	 * 3. Compute r = H(Wx [|| Wy] || m)
@@ -246,6 +246,8 @@ int __ecsdsa_sign_update(struct ec_sign_context *ctx,
 int __ecsdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 {
 	nn_src_t q, x;
+	nn_barrett_ctx_src_t q_barrett;
+	nn_mod_ctx_src_t q_ctx;
 	nn tmp, s, e, ex;
 	u8 r[MAX_DIGEST_SIZE];
 	const ec_priv_key *priv_key;
@@ -269,6 +271,8 @@ int __ecsdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 	/* Make things more readable */
 	priv_key = &(ctx->key_pair->priv_key);
 	q = &(priv_key->params->ec_gen_order);
+	q_barrett = &(priv_key->params->ec_gen_order_barrett);
+	q_ctx = &(priv_key->params->ec_gen_order_ctx);
 	x = &(priv_key->x);
 	q_bit_len = priv_key->params->ec_gen_order_bitlen;
 	hsize = ctx->h->digest_size;
@@ -296,7 +300,7 @@ int __ecsdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 
 	/* 4. Compute e = OS2I(r) mod q */
 	nn_init_from_buf(&tmp, r, r_len);
-	nn_mod(&e, &tmp, q);
+	nn_barrett_reduce(&e, &tmp, q_barrett);
 	dbg_nn_print("e", &e);
 
 	/*
@@ -312,15 +316,15 @@ int __ecsdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 
 #ifdef USE_SIG_BLINDING
         /* Blind e with b */
-        nn_mul_mod(&e, &e, &b, q);
+        nn_mul_mod_ctx(&e, &e, &b, q_ctx);
 #endif /* USE_SIG_BLINDING */
 
 	/* 6. Compute s = (k + ex) mod q. */
-	nn_mul_mod(&ex, x, &e, q);
+	nn_mul_mod_ctx(&ex, x, &e, q_ctx);
 	nn_zero(&e);
 #ifdef USE_SIG_BLINDING
         /* Blind k with b */
-        nn_mul_mod(&s, &(ctx->sign_data.ecsdsa.k), &b, q);
+        nn_mul_mod_ctx(&s, &(ctx->sign_data.ecsdsa.k), &b, q_ctx);
         nn_mod_add(&s, &s, &ex, q);
 #else
         nn_mod_add(&s, &(ctx->sign_data.ecsdsa.k), &ex, q);
@@ -330,8 +334,8 @@ int __ecsdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 
 #ifdef USE_SIG_BLINDING
         /* Unblind s */
-        nn_modinv(&binv, &b, q);
-        nn_mul_mod(&s, &s, &binv, q);
+        nn_modinv_ctx(&binv, &b, q_ctx);
+        nn_mul_mod_ctx(&s, &s, &binv, q_ctx);
 #endif /* USE_SIG_BLINDING */
 	dbg_nn_print("s", &s);
 
@@ -363,6 +367,8 @@ int __ecsdsa_sign_finalize(struct ec_sign_context *ctx, u8 *sig, u8 siglen)
 
 	/* Clean what remains on the stack */
 	PTR_NULLIFY(q);
+	PTR_NULLIFY(q_ctx);
+	PTR_NULLIFY(q_barrett);
 	PTR_NULLIFY(x);
 	PTR_NULLIFY(priv_key);
 	VAR_ZEROIFY(q_bit_len);
@@ -403,6 +409,7 @@ int __ecsdsa_verify_init(struct ec_verify_context *ctx,
 	prj_pt_src_t G, Y;
 	const ec_pub_key *pub_key;
 	nn_src_t q;
+	nn_barrett_ctx_src_t q_barrett;
 	nn rmodq, e, r, s;
 	prj_pt sG, eY, Wprime;
 	u8 Wprimex[BYTECEIL(CURVES_MAX_P_BIT_LEN)];
@@ -429,6 +436,7 @@ int __ecsdsa_verify_init(struct ec_verify_context *ctx,
 	G = &(pub_key->params->ec_gen);
 	Y = &(pub_key->y);
 	q = &(pub_key->params->ec_gen_order);
+	q_barrett = &(pub_key->params->ec_gen_order_barrett);
 	p_len = (u8)BYTECEIL(pub_key->params->ec_fp.p_bitlen);
 	q_bit_len = pub_key->params->ec_gen_order_bitlen;
 	hsize = ctx->h->digest_size;
@@ -454,7 +462,7 @@ int __ecsdsa_verify_init(struct ec_verify_context *ctx,
 	 * e = -r mod q = q - (r mod q) (except when r is 0).
 	 */
 	nn_init_from_buf(&r, sig, r_len);
-	nn_mod(&rmodq, &r, q);
+	nn_barrett_reduce(&rmodq, &r, q_barrett);
 	nn_zero(&r);
 	if (nn_iszero(&rmodq)) {
 		nn_zero(&e);
@@ -511,6 +519,7 @@ int __ecsdsa_verify_init(struct ec_verify_context *ctx,
 	PTR_NULLIFY(Y);
 	PTR_NULLIFY(pub_key);
 	PTR_NULLIFY(q);
+	PTR_NULLIFY(q_barrett);
 	VAR_ZEROIFY(p_len);
 	VAR_ZEROIFY(r_len);
 	VAR_ZEROIFY(s_len);
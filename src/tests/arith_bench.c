@@ -0,0 +1,1878 @@
+/*
+ *  Copyright (C) 2017 - This file is part of libecc project
+ *
+ *  Authors:
+ *      Ryad BENADJILA <ryadbenadjila@gmail.com>
+ *      Arnaud EBALARD <arnaud.ebalard@ssi.gouv.fr>
+ *      Jean-Pierre FLORI <jean-pierre.flori@ssi.gouv.fr>
+ *
+ *  Contributors:
+ *      Nicolas VIVET <nicolas.vivet@ssi.gouv.fr>
+ *      Karim KHALFALLAH <karim.khalfallah@ssi.gouv.fr>
+ *
+ *  This software is licensed under a dual BSD and GPL v2 license.
+ *  See LICENSE file at the root folder of the project.
+ */
+#include "../external_deps/print.h"
+#include "../external_deps/time.h"
+#include "../external_deps/rand.h"
+#include "../utils/utils.h"
+#include "../libsig.h"
+
+/*
+ * Micro benchmarks of the arithmetic primitives, on the prime field
+ * (and when relevant the curve order) of each compiled curve. Each
+ * benchmark checks that the compared implementations agree before
+ * reporting the number of operations per second.
+ */
+
+/* Number of operations for each timed loop */
+#define BENCH_NUM_OP	(1 << 20)
+/* Number of operations for the (much slower) inversions */
+#define BENCH_NUM_INV	(1 << 12)
+/* Number of random inputs we cycle through */
+#define BENCH_NUM_IN	16
+
+typedef int (*bench_func) (const ec_params *params);
+
+typedef struct {
+	const char *bench_name;
+	const char *bench_help;
+	bench_func bench;
+} bench_type;
+
+/* Print the number of operations per second of a timed loop */
+static void bench_print(const char *name, const char *crv_name, u64 t1, u64 t2,
+			unsigned int num)
+{
+	u64 delta = t2 - t1;
+
+	if (delta == 0) {
+		delta = 1;
+	}
+	ext_printf("[+] %12s %-24s %10u op/s\n", crv_name, name,
+		   (unsigned int)((num * (u64)1000) / delta));
+}
+
+static int bench_random_inputs(nn *in, unsigned int num, nn_src_t mod)
+{
+	unsigned int i;
+
+	for (i = 0; i < num; i++) {
+		if (nn_get_random_mod(&in[i], mod)) {
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+/* Montgomery operations we compare, with a unified prototype */
+typedef void (*mont_op) (nn_t out, nn_src_t in1, nn_src_t in2, nn_src_t p,
+			 word_t mpinv);
+
+static void mont_sqr(nn_t out, nn_src_t in1, nn_src_t in2, nn_src_t p,
+		     word_t mpinv)
+{
+	(void)in2;
+	nn_sqr_redc1(out, in1, p, mpinv);
+}
+
+static void mont_sqr_generic(nn_t out, nn_src_t in1, nn_src_t in2,
+			     nn_src_t p, word_t mpinv)
+{
+	(void)in2;
+	nn_mul_redc1_generic(out, in1, in1, p, mpinv);
+}
+
+static void mont_redc(nn_t out, nn_src_t in1, nn_src_t in2, nn_src_t p,
+		      word_t mpinv)
+{
+	(void)in2;
+	nn_redc1(out, in1, p, mpinv);
+}
+
+static void mont_redc_generic(nn_t out, nn_src_t in1, nn_src_t in2,
+			      nn_src_t p, word_t mpinv)
+{
+	nn one;
+
+	(void)in2;
+	nn_init(&one, 0);
+	nn_one(&one);
+	nn_mul_redc1_generic(out, in1, &one, p, mpinv);
+	nn_uninit(&one);
+}
+
+/*
+ * Check that op and ref agree on random inputs modulo p, then time
+ * chained calls of both (the result feeding the next call).
+ */
+static int bench_mont_op(const ec_params *params, const char *op_name,
+			 mont_op op, const char *ref_name, mont_op ref)
+{
+	const char *crv_name = (const char *)params->curve_name;
+	nn_src_t p = &(params->ec_fp.p);
+	word_t mpinv = params->ec_fp.mpinv;
+	nn in[BENCH_NUM_IN], acc1, acc2;
+	u64 t1, t2;
+	unsigned int i;
+
+	if (bench_random_inputs(in, BENCH_NUM_IN, p)) {
+		goto err;
+	}
+
+	/* Sanity check: both implementations must agree */
+	for (i = 0; i < BENCH_NUM_IN; i++) {
+		op(&acc1, &in[i], &in[(i + 1) % BENCH_NUM_IN], p, mpinv);
+		ref(&acc2, &in[i], &in[(i + 1) % BENCH_NUM_IN], p, mpinv);
+		if (nn_cmp(&acc1, &acc2) != 0) {
+			ext_printf("[-] %s: %s mismatch\n", crv_name, op_name);
+			goto err;
+		}
+	}
+
+	nn_copy(&acc1, &in[0]);
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < BENCH_NUM_OP; i++) {
+		op(&acc1, &acc1, &in[i % BENCH_NUM_IN], p, mpinv);
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print(op_name, crv_name, t1, t2, BENCH_NUM_OP);
+
+	nn_copy(&acc2, &in[0]);
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < BENCH_NUM_OP; i++) {
+		ref(&acc2, &acc2, &in[i % BENCH_NUM_IN], p, mpinv);
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print(ref_name, crv_name, t1, t2, BENCH_NUM_OP);
+
+	if (nn_cmp(&acc1, &acc2) != 0) {
+		ext_printf("[-] %s: %s chain mismatch\n", crv_name, op_name);
+		goto err;
+	}
+
+	return 0;
+
+ err:
+	return -1;
+}
+
+/*
+ * nn_mul_redc1() (which uses the ll_u256_mont kernels when compiled
+ * with WITH_LL_U256_MONT and p is 256-bit, and the x86-64 BMI2/ADX
+ * ones when compiled with WITH_LL_MONT_X86_64) against the generic CIOS.
+ */
+static int bench_mul_redc1(const ec_params *params)
+{
+	return bench_mont_op(params, "nn_mul_redc1", nn_mul_redc1,
+			     "nn_mul_redc1_generic", nn_mul_redc1_generic);
+}
+
+/* Dedicated Montgomery squaring against a generic multiplication */
+static int bench_sqr_redc1(const ec_params *params)
+{
+	return bench_mont_op(params, "nn_sqr_redc1", mont_sqr,
+			     "nn_mul_redc1_generic", mont_sqr_generic);
+}
+
+/* Montgomery reduction against a generic multiplication by one */
+static int bench_redc1(const ec_params *params)
+{
+	return bench_mont_op(params, "nn_redc1", mont_redc,
+			     "nn_mul_redc1_generic", mont_redc_generic);
+}
+
+/* Reference fp multiplication: product followed by a generic division */
+static void fp_mul_generic(fp_t out, fp_src_t in1, fp_src_t in2)
+{
+	fp_ctx_src_t ctx = in1->ctx;
+	nn a, b, prod, r;
+
+	fp_get_nn(&a, in1);
+	fp_get_nn(&b, in2);
+	nn_init(&prod, 2 * (ctx->p.wlen) * WORD_BYTES);
+	nn_init(&r, 0);
+	nn_mul(&prod, &a, &b);
+	nn_mod_unshifted(&r, &prod, &(ctx->p_normalized),
+			 ctx->p_reciprocal, ctx->p_shift);
+	fp_set_nn(out, &r);
+	nn_uninit(&a);
+	nn_uninit(&b);
+	nn_uninit(&prod);
+	nn_uninit(&r);
+}
+
+/*
+ * fp_mul() (which uses the Solinas reduction on NIST primes) against a
+ * generic multiplication and division. The inputs include the edge
+ * values 0, 1 and p - 1.
+ */
+static int bench_fp_mul(const ec_params *params)
+{
+	const char *crv_name = (const char *)params->curve_name;
+	fp_ctx_src_t ctx = &(params->ec_fp);
+	nn in_nn[BENCH_NUM_IN];
+	fp in[BENCH_NUM_IN], acc1, acc2;
+	u64 t1, t2;
+	unsigned int i, j;
+
+	if (bench_random_inputs(in_nn, BENCH_NUM_IN, &(ctx->p))) {
+		goto err;
+	}
+	nn_zero(&in_nn[0]);
+	nn_one(&in_nn[1]);
+	nn_dec(&in_nn[2], &(ctx->p));
+	for (i = 0; i < BENCH_NUM_IN; i++) {
+		fp_init(&in[i], ctx);
+		fp_set_nn(&in[i], &in_nn[i]);
+	}
+	fp_init(&acc1, ctx);
+	fp_init(&acc2, ctx);
+
+	/* Sanity check: both implementations must agree */
+	for (i = 0; i < BENCH_NUM_IN; i++) {
+		for (j = 0; j < BENCH_NUM_IN; j++) {
+			fp_mul(&acc1, &in[i], &in[j]);
+			fp_mul_generic(&acc2, &in[i], &in[j]);
+			if (fp_cmp(&acc1, &acc2) != 0) {
+				ext_printf("[-] %s: fp_mul mismatch\n",
+					   crv_name);
+				goto err;
+			}
+		}
+	}
+
+	fp_copy(&acc1, &in[3]);
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < BENCH_NUM_OP; i++) {
+		fp_mul(&acc1, &acc1, &in[3 + (i % (BENCH_NUM_IN - 3))]);
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print("fp_mul", crv_name, t1, t2, BENCH_NUM_OP);
+
+	fp_copy(&acc2, &in[3]);
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < BENCH_NUM_OP; i++) {
+		fp_mul_generic(&acc2, &acc2, &in[3 + (i % (BENCH_NUM_IN - 3))]);
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print("fp_mul_generic", crv_name, t1, t2, BENCH_NUM_OP);
+
+	if (fp_cmp(&acc1, &acc2) != 0) {
+		ext_printf("[-] %s: fp_mul chain mismatch\n", crv_name);
+		goto err;
+	}
+
+	return 0;
+
+ err:
+	return -1;
+}
+
+/*
+ * Square and always multiply exponentiation (one multiplication per bit,
+ * by one when the bit is 0), as fp_pow() used to do.
+ */
+static void fp_pow_binary(fp_t out, fp_src_t base, nn_src_t exp)
+{
+	fp_ctx_src_t ctx = base->ctx;
+	fp_src_t tab[2];
+	fp one, base_monty, mul;
+	bitcnt_t explen;
+
+	fp_init(&one, ctx);
+	fp_init(&base_monty, ctx);
+	fp_init(&mul, ctx);
+	fp_set_nn(&one, &(ctx->r));
+	fp_redcify(&base_monty, base);
+	tab[0] = &one;
+	tab[1] = &base_monty;
+
+	explen = nn_bitlen(exp) - 1;
+	fp_copy(out, &base_monty);
+	while (explen-- > 0) {
+		fp_sqr_redc1(out, out);
+		fp_tabselect(&mul, nn_getbit(exp, explen), tab, 2);
+		fp_mul_redc1(out, out, &mul);
+	}
+	fp_unredcify(out, out);
+
+	fp_uninit(&one);
+	fp_uninit(&base_monty);
+	fp_uninit(&mul);
+}
+
+typedef void (*fp_pow_func) (fp_t out, fp_src_t base, nn_src_t exp);
+
+static int bench_fp_pow_one(const char *name, const char *crv_name,
+			    fp_pow_func pow, fp_src_t base, nn_src_t exp,
+			    fp_t res)
+{
+	fp tmp;
+	u64 t1, t2;
+	unsigned int i;
+
+	fp_init(&tmp, base->ctx);
+	fp_copy(res, base);
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < (BENCH_NUM_INV / 2); i++) {
+		/* fp_pow_binary() does not support aliasing */
+		pow(&tmp, res, exp);
+		pow(res, &tmp, exp);
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print(name, crv_name, t1, t2, BENCH_NUM_INV);
+
+	return 0;
+
+ err:
+	return -1;
+}
+
+/*
+ * fp_pow() (constant time fixed window) and fp_pow_vartime() (sliding
+ * window) against the binary square and always multiply method, on
+ * random and edge case exponents, and timed with p - 2.
+ */
+static int bench_fp_pow(const ec_params *params)
+{
+	const char *crv_name = (const char *)params->curve_name;
+	fp_ctx_src_t ctx = &(params->ec_fp);
+	nn exp[BENCH_NUM_IN];
+	fp base, res1, res2, res3;
+	unsigned int i;
+
+	fp_init(&base, ctx);
+	fp_init(&res1, ctx);
+	fp_init(&res2, ctx);
+	fp_init(&res3, ctx);
+
+	if (bench_random_inputs(exp, BENCH_NUM_IN, &(ctx->p))) {
+		goto err;
+	}
+	/* Edge cases for the windows: 1, 2, 0xffff, 2^16, 0x10001, p - 2 */
+	nn_one(&exp[0]);
+	nn_set_word_value(&exp[1], WORD(2));
+	nn_set_word_value(&exp[2], WORD(0xffff));
+	nn_set_word_value(&exp[3], WORD(0x10000));
+	nn_set_word_value(&exp[4], WORD(0x10001));
+	nn_dec(&exp[5], &(ctx->p));
+	nn_dec(&exp[5], &exp[5]);
+	nn_rshift(&exp[6], &exp[5], 7);
+	for (i = 0; i < BENCH_NUM_IN; i++) {
+		if (nn_iszero(&exp[i])) {
+			nn_one(&exp[i]);
+		}
+		if (fp_get_random(&base, ctx)) {
+			goto err;
+		}
+		fp_pow_binary(&res1, &base, &exp[i]);
+		fp_pow(&res2, &base, &exp[i]);
+		fp_pow_vartime(&res3, &base, &exp[i]);
+		if ((fp_cmp(&res1, &res2) != 0) || (fp_cmp(&res1, &res3) != 0)) {
+			ext_printf("[-] %s: fp_pow mismatch\n", crv_name);
+			goto err;
+		}
+		/* Aliasing */
+		fp_pow(&res2, &res2, &exp[i]);
+		fp_pow_vartime(&res3, &res3, &exp[i]);
+		if (fp_cmp(&res2, &res3) != 0) {
+			ext_printf("[-] %s: fp_pow aliasing mismatch\n",
+				   crv_name);
+			goto err;
+		}
+	}
+
+	if (bench_fp_pow_one("fp_pow_binary (p - 2)", crv_name, fp_pow_binary,
+			     &base, &exp[5], &res1) ||
+	    bench_fp_pow_one("fp_pow (p - 2)", crv_name, fp_pow, &base,
+			     &exp[5], &res2) ||
+	    bench_fp_pow_one("fp_pow_vartime (p - 2)", crv_name,
+			     fp_pow_vartime, &base, &exp[5], &res3)) {
+		goto err;
+	}
+	if ((fp_cmp(&res1, &res2) != 0) || (fp_cmp(&res1, &res3) != 0)) {
+		ext_printf("[-] %s: fp_pow chain mismatch\n", crv_name);
+		goto err;
+	}
+
+	return 0;
+
+ err:
+	return -1;
+}
+
+/*
+ * nn_sqr() and fp_sqr() (cross products computed once) against the
+ * multiplication of the input by itself.
+ */
+static int bench_sqr(const ec_params *params)
+{
+	const char *crv_name = (const char *)params->curve_name;
+	fp_ctx_src_t ctx = &(params->ec_fp);
+	nn in_nn[BENCH_NUM_IN], sqr1, sqr2;
+	fp in[BENCH_NUM_IN], acc1, acc2;
+	u64 t1, t2;
+	unsigned int i;
+
+	if (bench_random_inputs(in_nn, BENCH_NUM_IN, &(ctx->p))) {
+		goto err;
+	}
+	nn_zero(&in_nn[0]);
+	nn_one(&in_nn[1]);
+	nn_dec(&in_nn[2], &(ctx->p));
+	for (i = 0; i < BENCH_NUM_IN; i++) {
+		fp_init(&in[i], ctx);
+		fp_set_nn(&in[i], &in_nn[i]);
+	}
+	fp_init(&acc1, ctx);
+	fp_init(&acc2, ctx);
+
+	/* Sanity check, including truncated squares */
+	for (i = 0; i < BENCH_NUM_IN; i++) {
+		nn_sqr(&sqr1, &in_nn[i]);
+		nn_mul(&sqr2, &in_nn[i], &in_nn[i]);
+		if (nn_cmp(&sqr1, &sqr2) != 0) {
+			ext_printf("[-] %s: nn_sqr mismatch\n", crv_name);
+			goto err;
+		}
+		nn_sqr_low(&sqr1, &in_nn[i], (u8)(ctx->p.wlen + 1));
+		nn_mul_low(&sqr2, &in_nn[i], &in_nn[i], (u8)(ctx->p.wlen + 1));
+		if (nn_cmp(&sqr1, &sqr2) != 0) {
+			ext_printf("[-] %s: nn_sqr_low mismatch\n", crv_name);
+			goto err;
+		}
+		fp_sqr(&acc1, &in[i]);
+		fp_mul(&acc2, &in[i], &in[i]);
+		if (fp_cmp(&acc1, &acc2) != 0) {
+			ext_printf("[-] %s: fp_sqr mismatch\n", crv_name);
+			goto err;
+		}
+	}
+
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < BENCH_NUM_OP; i++) {
+		nn_sqr(&sqr1, &in_nn[i % BENCH_NUM_IN]);
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print("nn_sqr", crv_name, t1, t2, BENCH_NUM_OP);
+
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < BENCH_NUM_OP; i++) {
+		nn_mul(&sqr2, &in_nn[i % BENCH_NUM_IN], &in_nn[i % BENCH_NUM_IN]);
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print("nn_mul (x, x)", crv_name, t1, t2, BENCH_NUM_OP);
+
+	fp_copy(&acc1, &in[3]);
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < BENCH_NUM_OP; i++) {
+		fp_sqr(&acc1, &acc1);
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print("fp_sqr", crv_name, t1, t2, BENCH_NUM_OP);
+
+	fp_copy(&acc2, &in[3]);
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < BENCH_NUM_OP; i++) {
+		fp_mul(&acc2, &acc2, &acc2);
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print("fp_mul (x, x)", crv_name, t1, t2, BENCH_NUM_OP);
+
+	if ((nn_cmp(&sqr1, &sqr2) != 0) || (fp_cmp(&acc1, &acc2) != 0)) {
+		ext_printf("[-] %s: fp_sqr chain mismatch\n", crv_name);
+		goto err;
+	}
+
+	return 0;
+
+ err:
+	return -1;
+}
+
+/*
+ * Time the inversion function inv modulo m, the result of each inversion
+ * being the input of the next one (BENCH_NUM_INV being even, the final
+ * result is in res).
+ */
+static int bench_modinv_one(const char *name, const char *crv_name,
+			    int (*inv) (nn_t, nn_src_t, nn_src_t),
+			    nn_src_t start, nn_src_t m, nn_t res)
+{
+	nn tmp;
+	u64 t1, t2;
+	unsigned int i;
+
+	nn_copy(res, start);
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < (BENCH_NUM_INV / 2); i++) {
+		/* Output cannot alias the input */
+		if ((inv(&tmp, res, m) != 1) || (inv(res, &tmp, m) != 1)) {
+			goto err;
+		}
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print(name, crv_name, t1, t2, BENCH_NUM_INV);
+
+	return 0;
+
+ err:
+	return -1;
+}
+
+/*
+ * nn_modinv() (safegcd for odd moduli) against the binary xgcd, modulo
+ * p and modulo the curve order q.
+ */
+static int bench_modinv(const ec_params *params)
+{
+	const char *crv_name = (const char *)params->curve_name;
+	nn_src_t mods[2];
+	const char *names[2][2] = {
+		{ "nn_modinv (p)", "nn_modinv_binxgcd (p)" },
+		{ "nn_modinv (q)", "nn_modinv_binxgcd (q)" },
+	};
+	nn in[BENCH_NUM_IN], inv1, inv2, check;
+	unsigned int i, j;
+
+	mods[0] = &(params->ec_fp.p);
+	mods[1] = &(params->ec_gen_order);
+
+	for (j = 0; j < 2; j++) {
+		if (bench_random_inputs(in, BENCH_NUM_IN, mods[j])) {
+			goto err;
+		}
+		nn_one(&in[0]);
+		nn_dec(&in[1], mods[j]);
+		/* Sanity check: both agree, and x * x^-1 = 1 */
+		for (i = 0; i < BENCH_NUM_IN; i++) {
+			if (nn_iszero(&in[i])) {
+				nn_one(&in[i]);
+			}
+			if ((nn_modinv(&inv1, &in[i], mods[j]) != 1) ||
+			    (nn_modinv_binxgcd(&inv2, &in[i], mods[j]) != 1)) {
+				ext_printf("[-] %s: %s failed\n", crv_name,
+					   names[j][0]);
+				goto err;
+			}
+			nn_mul_mod(&check, &inv1, &in[i], mods[j]);
+			if ((nn_cmp(&inv1, &inv2) != 0) || !nn_isone(&check)) {
+				ext_printf("[-] %s: %s mismatch\n", crv_name,
+					   names[j][0]);
+				goto err;
+			}
+		}
+		/* 0 is not invertible */
+		nn_zero(&check);
+		if (nn_modinv(&inv1, &check, mods[j]) != 0) {
+			ext_printf("[-] %s: %s inverted 0\n", crv_name,
+				   names[j][0]);
+			goto err;
+		}
+
+		if (bench_modinv_one(names[j][0], crv_name, nn_modinv,
+				     &in[2], mods[j], &inv1) ||
+		    bench_modinv_one(names[j][1], crv_name, nn_modinv_binxgcd,
+				     &in[2], mods[j], &inv2)) {
+			goto err;
+		}
+		if (nn_cmp(&inv1, &inv2) != 0) {
+			ext_printf("[-] %s: %s chain mismatch\n", crv_name,
+				   names[j][0]);
+			goto err;
+		}
+	}
+
+	return 0;
+
+ err:
+	return -1;
+}
+
+/*
+ * fp_batch_inv() of BENCH_NUM_IN elements against BENCH_NUM_IN calls to
+ * fp_inv(). The constant time variant is checked with zero inputs, and
+ * nn_batch_modinv() modulo the curve order.
+ */
+static int bench_batch_inv(const ec_params *params)
+{
+	const char *crv_name = (const char *)params->curve_name;
+	fp_ctx_src_t ctx = &(params->ec_fp);
+	nn_src_t q = &(params->ec_gen_order);
+	nn in_nn[BENCH_NUM_IN], out_nn[BENCH_NUM_IN], check;
+	fp in[BENCH_NUM_IN], out[BENCH_NUM_IN], ref;
+	fp_t out_ptr[BENCH_NUM_IN];
+	fp_src_t in_ptr[BENCH_NUM_IN];
+	nn_t out_nn_ptr[BENCH_NUM_IN];
+	nn_src_t in_nn_ptr[BENCH_NUM_IN];
+	u64 t1, t2;
+	unsigned int i, j;
+
+	if (bench_random_inputs(in_nn, BENCH_NUM_IN, &(ctx->p))) {
+		goto err;
+	}
+	fp_init(&ref, ctx);
+	for (i = 0; i < BENCH_NUM_IN; i++) {
+		if (nn_iszero(&in_nn[i])) {
+			nn_one(&in_nn[i]);
+		}
+		fp_init(&in[i], ctx);
+		fp_set_nn(&in[i], &in_nn[i]);
+		fp_init(&out[i], ctx);
+		in_ptr[i] = &in[i];
+		out_ptr[i] = &out[i];
+	}
+
+	/* Sanity checks against fp_inv() */
+	fp_batch_inv(out_ptr, in_ptr, BENCH_NUM_IN);
+	for (i = 0; i < BENCH_NUM_IN; i++) {
+		fp_inv(&ref, &in[i]);
+		if (fp_cmp(&ref, &out[i]) != 0) {
+			ext_printf("[-] %s: fp_batch_inv mismatch\n", crv_name);
+			goto err;
+		}
+	}
+	fp_zero(&in[1]);
+	fp_zero(&in[BENCH_NUM_IN - 1]);
+	if (fp_batch_inv_ct(out_ptr, in_ptr, BENCH_NUM_IN) != 0) {
+		ext_printf("[-] %s: fp_batch_inv_ct missed zeros\n", crv_name);
+		goto err;
+	}
+	for (i = 0; i < BENCH_NUM_IN; i++) {
+		if (fp_iszero(&in[i])) {
+			fp_zero(&ref);
+		} else {
+			fp_inv(&ref, &in[i]);
+		}
+		if (fp_cmp(&ref, &out[i]) != 0) {
+			ext_printf("[-] %s: fp_batch_inv_ct mismatch\n",
+				   crv_name);
+			goto err;
+		}
+	}
+	fp_set_nn(&in[1], &in_nn[1]);
+	fp_set_nn(&in[BENCH_NUM_IN - 1], &in_nn[BENCH_NUM_IN - 1]);
+
+	/* nn_batch_modinv() modulo q */
+	if (bench_random_inputs(in_nn, BENCH_NUM_IN, q)) {
+		goto err;
+	}
+	for (i = 0; i < BENCH_NUM_IN; i++) {
+		if (nn_iszero(&in_nn[i])) {
+			nn_one(&in_nn[i]);
+		}
+		in_nn_ptr[i] = &in_nn[i];
+		out_nn_ptr[i] = &out_nn[i];
+	}
+	nn_zero(&in_nn[2]);
+	if ((nn_batch_modinv(out_nn_ptr, in_nn_ptr, BENCH_NUM_IN, q) != 0) ||
+	    (nn_batch_modinv_ct(out_nn_ptr, in_nn_ptr, BENCH_NUM_IN, q) != 0)) {
+		ext_printf("[-] %s: nn_batch_modinv missed zero\n", crv_name);
+		goto err;
+	}
+	for (i = 0; i < BENCH_NUM_IN; i++) {
+		if (i == 2) {
+			nn_zero(&check);
+		} else if (nn_modinv(&check, &in_nn[i], q) != 1) {
+			goto err;
+		}
+		if (nn_cmp(&check, &out_nn[i]) != 0) {
+			ext_printf("[-] %s: nn_batch_modinv_ct mismatch\n",
+				   crv_name);
+			goto err;
+		}
+	}
+
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < BENCH_NUM_INV; i++) {
+		fp_batch_inv(out_ptr, in_ptr, BENCH_NUM_IN);
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print("fp_batch_inv (x16)", crv_name, t1, t2, BENCH_NUM_INV);
+
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < BENCH_NUM_INV; i++) {
+		for (j = 0; j < BENCH_NUM_IN; j++) {
+			fp_inv(&out[j], &in[j]);
+		}
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print("fp_inv (x16)", crv_name, t1, t2, BENCH_NUM_INV);
+
+	return 0;
+
+ err:
+	return -1;
+}
+
+/*
+ * Multiplication modulo the curve order q: nn_mul_mod_ctx() with the
+ * context cached in ec_params, against nn_mul_mod() (which rebuilds the
+ * Montgomery coefficients on each call) and a multiplication followed
+ * by a division.
+ */
+static int bench_mul_mod(const ec_params *params)
+{
+	const char *crv_name = (const char *)params->curve_name;
+	nn_src_t q = &(params->ec_gen_order);
+	nn_mod_ctx_src_t q_ctx = &(params->ec_gen_order_ctx);
+	nn in[BENCH_NUM_IN], acc1, acc2, prod;
+	u64 t1, t2;
+	unsigned int i, j;
+
+	if (bench_random_inputs(in, BENCH_NUM_IN, q)) {
+		goto err;
+	}
+	nn_zero(&in[0]);
+	nn_one(&in[1]);
+	nn_dec(&in[2], q);
+
+	/* Sanity check: all implementations must agree */
+	for (i = 0; i < BENCH_NUM_IN; i++) {
+		for (j = 0; j < BENCH_NUM_IN; j++) {
+			nn_mul_mod_ctx(&acc1, &in[i], &in[j], q_ctx);
+			nn_mul(&prod, &in[i], &in[j]);
+			nn_mod(&acc2, &prod, q);
+			if (nn_cmp(&acc1, &acc2) != 0) {
+				ext_printf("[-] %s: nn_mul_mod_ctx mismatch\n",
+					   crv_name);
+				goto err;
+			}
+			nn_mul_mod(&acc2, &in[i], &in[j], q);
+			if (nn_cmp(&acc1, &acc2) != 0) {
+				ext_printf("[-] %s: nn_mul_mod mismatch\n",
+					   crv_name);
+				goto err;
+			}
+		}
+	}
+
+	nn_copy(&acc1, &in[3]);
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < BENCH_NUM_OP; i++) {
+		nn_mul_mod_ctx(&acc1, &acc1, &in[3 + (i % (BENCH_NUM_IN - 3))],
+			       q_ctx);
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print("nn_mul_mod_ctx (q)", crv_name, t1, t2, BENCH_NUM_OP);
+
+	nn_copy(&acc2, &in[3]);
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < (BENCH_NUM_OP / 16); i++) {
+		nn_mul_mod(&acc2, &acc2, &in[3 + (i % (BENCH_NUM_IN - 3))], q);
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print("nn_mul_mod (q)", crv_name, t1, t2, BENCH_NUM_OP / 16);
+
+	nn_copy(&acc2, &in[3]);
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < BENCH_NUM_OP; i++) {
+		nn_mul(&prod, &acc2, &in[3 + (i % (BENCH_NUM_IN - 3))]);
+		nn_mod(&acc2, &prod, q);
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print("nn_mul + nn_mod (q)", crv_name, t1, t2, BENCH_NUM_OP);
+
+	if (nn_cmp(&acc1, &acc2) != 0) {
+		ext_printf("[-] %s: nn_mul_mod_ctx chain mismatch\n", crv_name);
+		goto err;
+	}
+
+	return 0;
+
+ err:
+	return -1;
+}
+
+/*
+ * Reduction modulo the curve order q of double width values: Barrett
+ * reduction with the context cached in ec_params against nn_mod(). The
+ * inputs are products of reduced values, plus the edge values 0, q,
+ * (q - 1)^2 and the largest value on twice the words of q.
+ */
+static int bench_barrett(const ec_params *params)
+{
+	const char *crv_name = (const char *)params->curve_name;
+	nn_src_t q = &(params->ec_gen_order);
+	nn_barrett_ctx_src_t q_barrett = &(params->ec_gen_order_barrett);
+	nn in[BENCH_NUM_IN], prod[BENCH_NUM_IN], acc1, acc2;
+	u64 t1, t2;
+	unsigned int i, j;
+
+	if (bench_random_inputs(in, BENCH_NUM_IN, q)) {
+		goto err;
+	}
+	for (i = 0; i < BENCH_NUM_IN; i++) {
+		nn_mul(&prod[i], &in[i], &in[(i + 1) % BENCH_NUM_IN]);
+	}
+	nn_zero(&prod[0]);
+	nn_copy(&prod[1], q);
+	nn_dec(&acc1, q);
+	nn_mul(&prod[2], &acc1, &acc1);
+	nn_init(&prod[3], 0);
+	nn_set_wlen(&prod[3], (u8)(2 * q_barrett->k));
+	for (j = 0; j < prod[3].wlen; j++) {
+		prod[3].val[j] = WORD_MAX;
+	}
+
+	/* Sanity check: both implementations must agree */
+	for (i = 0; i < BENCH_NUM_IN; i++) {
+		nn_barrett_reduce(&acc1, &prod[i], q_barrett);
+		nn_mod(&acc2, &prod[i], q);
+		if (nn_cmp(&acc1, &acc2) != 0) {
+			ext_printf("[-] %s: nn_barrett_reduce mismatch\n",
+				   crv_name);
+			goto err;
+		}
+	}
+
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < BENCH_NUM_OP; i++) {
+		nn_barrett_reduce(&acc1, &prod[i % BENCH_NUM_IN], q_barrett);
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print("nn_barrett_reduce (q)", crv_name, t1, t2, BENCH_NUM_OP);
+
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < BENCH_NUM_OP; i++) {
+		nn_mod(&acc2, &prod[i % BENCH_NUM_IN], q);
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print("nn_mod (q)", crv_name, t1, t2, BENCH_NUM_OP);
+
+	if (nn_cmp(&acc1, &acc2) != 0) {
+		ext_printf("[-] %s: nn_barrett_reduce mismatch\n", crv_name);
+		goto err;
+	}
+
+	return 0;
+
+ err:
+	return -1;
+}
+
+/*
+ * fp_inv_fixed() (addition chain for p - 2) against fp_inv() and the
+ * generic exponentiation fp_pow() by p - 2, fp_sqrt_fixed() on squares
+ * when p = 3 mod 4, and nn_modinv_fixed() (addition chain for q - 2)
+ * against nn_modinv_ctx() modulo the curve order.
+ */
+static int bench_pow_fixed(const ec_params *params)
+{
+	const char *crv_name = (const char *)params->curve_name;
+	fp_ctx_src_t ctx = &(params->ec_fp);
+	nn_mod_ctx_src_t q_ctx = &(params->ec_gen_order_ctx);
+	nn in[BENCH_NUM_IN], e, inv1, inv2;
+	fp x, y, z;
+	u64 t1, t2;
+	unsigned int i;
+
+	fp_init(&x, ctx);
+	fp_init(&y, ctx);
+	fp_init(&z, ctx);
+	nn_init(&e, 0);
+	nn_dec(&e, &(ctx->p));
+	nn_dec(&e, &e);
+
+	if (bench_random_inputs(in, BENCH_NUM_IN, &(ctx->p))) {
+		goto err;
+	}
+	nn_one(&in[0]);
+	nn_dec(&in[1], &(ctx->p));
+	/* Sanity check: all agree, and the square roots square back */
+	for (i = 0; i < BENCH_NUM_IN; i++) {
+		fp_set_nn(&x, &in[i]);
+		fp_inv(&y, &x);
+		fp_inv_fixed(&z, &x);
+		if (fp_cmp(&y, &z) != 0) {
+			ext_printf("[-] %s: fp_inv_fixed mismatch\n", crv_name);
+			goto err;
+		}
+		fp_pow(&z, &x, &e);
+		if (fp_cmp(&y, &z) != 0) {
+			ext_printf("[-] %s: fp_pow (p - 2) mismatch\n",
+				   crv_name);
+			goto err;
+		}
+		fp_sqr(&y, &x);
+		if ((ctx->p.val[0] & 3) == 3) {
+			if (fp_sqrt_fixed(&z, &y) != 0) {
+				ext_printf("[-] %s: fp_sqrt_fixed failed\n",
+					   crv_name);
+				goto err;
+			}
+			fp_sqr(&z, &z);
+			if (fp_cmp(&z, &y) != 0) {
+				ext_printf("[-] %s: fp_sqrt_fixed mismatch\n",
+					   crv_name);
+				goto err;
+			}
+		} else if (fp_sqrt_fixed(&z, &y) != -1) {
+			ext_printf("[-] %s: fp_sqrt_fixed on p = 1 mod 4\n",
+				   crv_name);
+			goto err;
+		}
+	}
+	/* 0 gives 0 */
+	fp_zero(&x);
+	fp_inv_fixed(&y, &x);
+	if (!fp_iszero(&y)) {
+		ext_printf("[-] %s: fp_inv_fixed(0) != 0\n", crv_name);
+		goto err;
+	}
+
+	fp_set_nn(&x, &in[2]);
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < BENCH_NUM_INV; i++) {
+		fp_inv_fixed(&x, &x);
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print("fp_inv_fixed", crv_name, t1, t2, BENCH_NUM_INV);
+
+	fp_set_nn(&y, &in[2]);
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < (BENCH_NUM_INV / 2); i++) {
+		/* Output cannot alias the input */
+		fp_inv(&z, &y);
+		fp_inv(&y, &z);
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print("fp_inv", crv_name, t1, t2, BENCH_NUM_INV);
+
+	fp_set_nn(&z, &in[2]);
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < BENCH_NUM_INV; i++) {
+		/* Output cannot alias the input */
+		fp_copy(&y, &z);
+		fp_pow(&z, &y, &e);
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print("fp_pow (p - 2)", crv_name, t1, t2, BENCH_NUM_INV);
+	if (fp_cmp(&x, &z) != 0) {
+		ext_printf("[-] %s: fp_inv_fixed chain mismatch\n", crv_name);
+		goto err;
+	}
+
+	/* Modulo the curve order */
+	if (bench_random_inputs(in, BENCH_NUM_IN, &(q_ctx->m))) {
+		goto err;
+	}
+	for (i = 0; i < BENCH_NUM_IN; i++) {
+		if (nn_iszero(&in[i])) {
+			nn_one(&in[i]);
+		}
+		if ((nn_modinv_fixed(&inv1, &in[i], q_ctx) != 1) ||
+		    (nn_modinv_ctx(&inv2, &in[i], q_ctx) != 1) ||
+		    (nn_cmp(&inv1, &inv2) != 0)) {
+			ext_printf("[-] %s: nn_modinv_fixed mismatch\n",
+				   crv_name);
+			goto err;
+		}
+	}
+
+	nn_copy(&inv1, &in[2]);
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < BENCH_NUM_INV; i++) {
+		nn_modinv_fixed(&inv1, &inv1, q_ctx);
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print("nn_modinv_fixed (q)", crv_name, t1, t2, BENCH_NUM_INV);
+
+	nn_copy(&inv2, &in[2]);
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < (BENCH_NUM_INV / 2); i++) {
+		/* Output cannot alias the input */
+		nn_modinv_ctx(&e, &inv2, q_ctx);
+		nn_modinv_ctx(&inv2, &e, q_ctx);
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print("nn_modinv_ctx (q)", crv_name, t1, t2, BENCH_NUM_INV);
+	if (nn_cmp(&inv1, &inv2) != 0) {
+		ext_printf("[-] %s: nn_modinv_fixed chain mismatch\n",
+			   crv_name);
+		goto err;
+	}
+
+	return 0;
+
+ err:
+	return -1;
+}
+
+/*
+ * Check that an element in the redundant range [0, 2p) of the lazy
+ * reduction routines is below 2p and represents ref.
+ */
+static int lazy_check(fp_src_t x, fp_src_t ref, nn_src_t p2)
+{
+	nn tmp;
+	fp red;
+	int ret;
+
+	fp_get_nn(&tmp, x);
+	fp_init(&red, x->ctx);
+	_fp_reduce_lazy(&red, x);
+	ret = ((nn_cmp(&tmp, p2) < 0) && (fp_cmp(&red, ref) == 0)) ? 0 : -1;
+	fp_uninit(&red);
+	nn_uninit(&tmp);
+
+	return ret;
+}
+
+static int lazy_pt_cmp(prj_pt_src_t a, prj_pt_src_t b)
+{
+	return ((fp_cmp(&(a->X), &(b->X)) == 0) &&
+		(fp_cmp(&(a->Y), &(b->Y)) == 0) &&
+		(fp_cmp(&(a->Z), &(b->Z)) == 0)) ? 0 : -1;
+}
+
+/*
+ * Lazy reduction field routines (fp_lazy.h) against the fully reducing
+ * ones on random redundant inputs, then the Montgomery point formulas
+ * and the wNAF double scalar multiplication with and without lazy
+ * reduction on random points, the outputs having to be exactly the
+ * same. Nothing is done for primes without the needed headroom.
+ */
+static int bench_lazy(const ec_params *params)
+{
+	const char *crv_name = (const char *)params->curve_name;
+	/* The lazy flag is toggled to get the fully reduced formulas */
+	fp_ctx *ctx = (fp_ctx *)&(params->ec_fp);
+	nn_src_t q = &(params->ec_gen_order);
+	prj_pt_src_t G = &(params->ec_gen);
+	nn in[BENCH_NUM_IN], p2;
+	fp u, v, x, y, xr, yr, r, ref;
+	prj_pt P, Q, R1, R2;
+	u64 t1, t2;
+	unsigned int i, j;
+	u8 lazy = ctx->lazy;
+
+	if (!lazy) {
+		ext_printf("[+] %12s lazy reduction not applicable\n",
+			   crv_name);
+		return 0;
+	}
+
+	nn_init(&p2, 0);
+	nn_add(&p2, &(ctx->p), &(ctx->p));
+	fp_init(&u, ctx);
+	fp_init(&v, ctx);
+	fp_init(&x, ctx);
+	fp_init(&y, ctx);
+	fp_init(&xr, ctx);
+	fp_init(&yr, ctx);
+	fp_init(&r, ctx);
+	fp_init(&ref, ctx);
+
+	if (bench_random_inputs(in, BENCH_NUM_IN, &(ctx->p))) {
+		goto err;
+	}
+	nn_dec(&in[0], &(ctx->p));
+	nn_dec(&in[1], &(ctx->p));
+	nn_zero(&in[2]);
+	/* Redundant inputs u + v (not reduced below p) */
+	for (i = 0; i < BENCH_NUM_IN; i++) {
+		for (j = 0; j < BENCH_NUM_IN; j++) {
+			fp_set_nn(&u, &in[i]);
+			fp_set_nn(&v, &in[j]);
+			fp_add(&x, &u, &v);
+			_fp_add_lazy(&xr, &u, &v);
+			fp_set_nn(&u, &in[(i + j) % BENCH_NUM_IN]);
+			fp_set_nn(&v, &in[(i + 1) % BENCH_NUM_IN]);
+			fp_add(&y, &u, &v);
+			_fp_add_lazy(&yr, &u, &v);
+			if (lazy_check(&xr, &x, &p2) ||
+			    lazy_check(&yr, &y, &p2)) {
+				ext_printf("[-] %s: _fp_add_lazy mismatch\n",
+					   crv_name);
+				goto err;
+			}
+
+			fp_mul_redc1(&ref, &x, &y);
+			_fp_mul_redc1_lazy(&r, &xr, &yr);
+			if (lazy_check(&r, &ref, &p2)) {
+				ext_printf("[-] %s: _fp_mul_redc1_lazy "
+					   "mismatch\n", crv_name);
+				goto err;
+			}
+			fp_sqr_redc1(&ref, &x);
+			_fp_sqr_redc1_lazy(&r, &xr);
+			if (lazy_check(&r, &ref, &p2)) {
+				ext_printf("[-] %s: _fp_sqr_redc1_lazy "
+					   "mismatch\n", crv_name);
+				goto err;
+			}
+			fp_add(&ref, &x, &y);
+			_fp_add_lazy(&r, &xr, &yr);
+			if (lazy_check(&r, &ref, &p2)) {
+				ext_printf("[-] %s: _fp_add_lazy mismatch\n",
+					   crv_name);
+				goto err;
+			}
+			fp_sub(&ref, &x, &y);
+			_fp_sub_lazy(&r, &xr, &yr);
+			if (lazy_check(&r, &ref, &p2)) {
+				ext_printf("[-] %s: _fp_sub_lazy mismatch\n",
+					   crv_name);
+				goto err;
+			}
+		}
+	}
+
+	/* Point formulas on random points P = a * G and Q = b * G */
+	prj_pt_init(&P, &(params->ec_curve));
+	prj_pt_init(&Q, &(params->ec_curve));
+	prj_pt_init(&R1, &(params->ec_curve));
+	prj_pt_init(&R2, &(params->ec_curve));
+	if (bench_random_inputs(in, BENCH_NUM_IN, q)) {
+		goto err;
+	}
+	for (i = 0; i < BENCH_NUM_IN; i++) {
+		prj_pt_mul_monty(&P, &in[i], G);
+		prj_pt_mul_monty(&Q, &in[(i + 1) % BENCH_NUM_IN], G);
+
+		ctx->lazy = 0;
+		prj_pt_add_monty(&R1, &P, &Q);
+		ctx->lazy = lazy;
+		prj_pt_add_monty(&R2, &P, &Q);
+		if (lazy_pt_cmp(&R1, &R2)) {
+			ext_printf("[-] %s: lazy prj_pt_add_monty mismatch\n",
+				   crv_name);
+			goto err;
+		}
+		ctx->lazy = 0;
+		prj_pt_add_monty(&R1, &P, &P);
+		ctx->lazy = lazy;
+		prj_pt_add_monty(&R2, &P, &P);
+		if (lazy_pt_cmp(&R1, &R2)) {
+			ext_printf("[-] %s: lazy prj_pt_add_monty (P, P) "
+				   "mismatch\n", crv_name);
+			goto err;
+		}
+		ctx->lazy = 0;
+		prj_pt_dbl_monty(&R1, &P);
+		ctx->lazy = lazy;
+		prj_pt_dbl_monty(&R2, &P);
+		if (lazy_pt_cmp(&R1, &R2)) {
+			ext_printf("[-] %s: lazy prj_pt_dbl_monty mismatch\n",
+				   crv_name);
+			goto err;
+		}
+		ctx->lazy = 0;
+		prj_pt_ec_mult_wnaf(&R1, &in[i], G,
+				    &in[(i + 2) % BENCH_NUM_IN], &Q);
+		ctx->lazy = lazy;
+		prj_pt_ec_mult_wnaf(&R2, &in[i], G,
+				    &in[(i + 2) % BENCH_NUM_IN], &Q);
+		if (lazy_pt_cmp(&R1, &R2)) {
+			ext_printf("[-] %s: lazy prj_pt_ec_mult_wnaf "
+				   "mismatch\n", crv_name);
+			goto err;
+		}
+	}
+
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < (BENCH_NUM_INV / 16); i++) {
+		prj_pt_ec_mult_wnaf(&R2, &in[i % BENCH_NUM_IN], G,
+				    &in[(i + 1) % BENCH_NUM_IN], &Q);
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print("ec_mult_wnaf (lazy)", crv_name, t1, t2,
+		    BENCH_NUM_INV / 16);
+
+	ctx->lazy = 0;
+	if (get_ms_time(&t1)) {
+		ctx->lazy = lazy;
+		goto err;
+	}
+	for (i = 0; i < (BENCH_NUM_INV / 16); i++) {
+		prj_pt_ec_mult_wnaf(&R1, &in[i % BENCH_NUM_IN], G,
+				    &in[(i + 1) % BENCH_NUM_IN], &Q);
+	}
+	ctx->lazy = lazy;
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print("ec_mult_wnaf", crv_name, t1, t2, BENCH_NUM_INV / 16);
+
+	if (lazy_pt_cmp(&R1, &R2)) {
+		ext_printf("[-] %s: lazy prj_pt_ec_mult_wnaf mismatch\n",
+			   crv_name);
+		goto err;
+	}
+
+	return 0;
+
+ err:
+	return -1;
+}
+
+/*
+ * fp_dbl_monty(), fp_tpl_monty() and fp_neg_monty() (the dedicated 4-limb
+ * kernels when compiled with WITH_LL_U256_MONT) against additions and
+ * subtractions, including the edge values 0, 1 and p - 1 and aliasing.
+ */
+static int bench_modadd(const ec_params *params)
+{
+	const char *crv_name = (const char *)params->curve_name;
+	fp_ctx_src_t ctx = &(params->ec_fp);
+	nn in_nn[BENCH_NUM_IN];
+	fp in[BENCH_NUM_IN], zero, acc1, acc2;
+	u64 t1, t2;
+	unsigned int i;
+
+	if (bench_random_inputs(in_nn, BENCH_NUM_IN, &(ctx->p))) {
+		goto err;
+	}
+	nn_zero(&in_nn[0]);
+	nn_one(&in_nn[1]);
+	nn_dec(&in_nn[2], &(ctx->p));
+	for (i = 0; i < BENCH_NUM_IN; i++) {
+		fp_init(&in[i], ctx);
+		fp_set_nn(&in[i], &in_nn[i]);
+	}
+	fp_init(&zero, ctx);
+	fp_init(&acc1, ctx);
+	fp_init(&acc2, ctx);
+
+	for (i = 0; i < BENCH_NUM_IN; i++) {
+		fp_add(&acc2, &in[i], &in[i]);
+		fp_dbl_monty(&acc1, &in[i]);
+		if (fp_cmp(&acc1, &acc2) != 0) {
+			ext_printf("[-] %s: fp_dbl_monty mismatch\n", crv_name);
+			goto err;
+		}
+		fp_add(&acc2, &acc2, &in[i]);
+		fp_tpl_monty(&acc1, &in[i]);
+		if (fp_cmp(&acc1, &acc2) != 0) {
+			ext_printf("[-] %s: fp_tpl_monty mismatch\n", crv_name);
+			goto err;
+		}
+		fp_copy(&acc1, &in[i]);
+		fp_tpl_monty(&acc1, &acc1);
+		if (fp_cmp(&acc1, &acc2) != 0) {
+			ext_printf("[-] %s: fp_tpl_monty aliasing mismatch\n",
+				   crv_name);
+			goto err;
+		}
+		fp_sub(&acc2, &zero, &in[i]);
+		fp_neg_monty(&acc1, &in[i]);
+		if (fp_cmp(&acc1, &acc2) != 0) {
+			ext_printf("[-] %s: fp_neg_monty mismatch\n", crv_name);
+			goto err;
+		}
+	}
+
+	fp_copy(&acc1, &in[3]);
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < BENCH_NUM_OP; i++) {
+		fp_tpl_monty(&acc1, &acc1);
+		fp_neg_monty(&acc1, &acc1);
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print("fp_tpl_monty+fp_neg_monty", crv_name, t1, t2,
+		    BENCH_NUM_OP);
+
+	fp_copy(&acc2, &in[3]);
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < BENCH_NUM_OP; i++) {
+		fp_add(&zero, &acc2, &acc2);
+		fp_add(&acc2, &zero, &acc2);
+		fp_zero(&zero);
+		fp_sub(&acc2, &zero, &acc2);
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print("fp_add+fp_add+fp_sub", crv_name, t1, t2, BENCH_NUM_OP);
+
+	if (fp_cmp(&acc1, &acc2) != 0) {
+		ext_printf("[-] %s: fp_tpl_monty chain mismatch\n", crv_name);
+		goto err;
+	}
+
+	return 0;
+
+ err:
+	return -1;
+}
+
+/*
+ * prj_pt_ec_mult_wnaf() with the precomputed wNAF table of the generator
+ * against the odd multiples computed at each call, on random scalars and
+ * points, both being checked against u * G + v * Q computed with the
+ * scalar multiplication.
+ */
+static int bench_gen_table(const ec_params *params)
+{
+	const char *crv_name = (const char *)params->curve_name;
+	/* The table is detached to get the computed odd multiples */
+	ec_shortw_crv *crv = (ec_shortw_crv *)&(params->ec_curve);
+	const word_t *table = crv->gen_wnaf_table;
+	u8 window = crv->gen_wnaf_window;
+	nn_src_t q = &(params->ec_gen_order);
+	prj_pt_src_t G = &(params->ec_gen);
+	nn in[BENCH_NUM_IN];
+	prj_pt Q[BENCH_NUM_IN], R1, R2, ref;
+	u64 t1, t2;
+	unsigned int i;
+
+	if (table == NULL) {
+		ext_printf("[+] %12s no generator table\n", crv_name);
+		return 0;
+	}
+
+	if (bench_random_inputs(in, BENCH_NUM_IN, q)) {
+		goto err;
+	}
+	prj_pt_init(&R1, crv);
+	prj_pt_init(&R2, crv);
+	prj_pt_init(&ref, crv);
+	for (i = 0; i < BENCH_NUM_IN; i++) {
+		prj_pt_init(&Q[i], crv);
+		prj_pt_mul_monty(&Q[i], &in[(i + 1) % BENCH_NUM_IN], G);
+	}
+
+	/* Both against the sum of the scalar multiplications */
+	for (i = 0; i < BENCH_NUM_IN; i++) {
+		prj_pt_mul_monty(&R1, &in[i], G);
+		prj_pt_mul_monty(&R2, &in[(i + 2) % BENCH_NUM_IN], &Q[i]);
+		prj_pt_add_monty(&ref, &R1, &R2);
+		crv->gen_wnaf_table = NULL;
+		prj_pt_ec_mult_wnaf(&R1, &in[i], G,
+				    &in[(i + 2) % BENCH_NUM_IN], &Q[i]);
+		crv->gen_wnaf_table = table;
+		prj_pt_ec_mult_wnaf(&R2, &in[i], G,
+				    &in[(i + 2) % BENCH_NUM_IN], &Q[i]);
+		if (prj_pt_cmp(&R1, &ref) || prj_pt_cmp(&R2, &ref)) {
+			ext_printf("[-] %s: prj_pt_ec_mult_wnaf mismatch\n",
+				   crv_name);
+			goto err;
+		}
+	}
+
+	crv->gen_wnaf_table = NULL;
+	if (get_ms_time(&t1)) {
+		crv->gen_wnaf_table = table;
+		goto err;
+	}
+	for (i = 0; i < (BENCH_NUM_INV / 16); i++) {
+		prj_pt_ec_mult_wnaf(&R1, &in[i % BENCH_NUM_IN], G,
+				    &in[(i + 1) % BENCH_NUM_IN],
+				    &Q[i % BENCH_NUM_IN]);
+	}
+	crv->gen_wnaf_table = table;
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print("ec_mult_wnaf (window 5)", crv_name, t1, t2,
+		    BENCH_NUM_INV / 16);
+
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < (BENCH_NUM_INV / 16); i++) {
+		prj_pt_ec_mult_wnaf(&R2, &in[i % BENCH_NUM_IN], G,
+				    &in[(i + 1) % BENCH_NUM_IN],
+				    &Q[i % BENCH_NUM_IN]);
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	ext_printf("[+] %12s generator table window %u\n", crv_name, window);
+	bench_print("ec_mult_wnaf (table)", crv_name, t1, t2,
+		    BENCH_NUM_INV / 16);
+
+	if (lazy_pt_cmp(&R1, &R2)) {
+		ext_printf("[-] %s: prj_pt_ec_mult_wnaf generator table "
+			   "mismatch\n", crv_name);
+		goto err;
+	}
+
+	return 0;
+
+ err:
+	return -1;
+}
+
+/*
+ * Multiplications by the generator with its precomputed comb, plain and
+ * with the blinding by scalar splitting of prj_pt_mul_monty_blind(), on
+ * random scalars (and on scalars larger than q), checked against the
+ * ladder, which is the blinded multiplication used without the comb.
+ */
+static int bench_gen_comb(const ec_params *params)
+{
+	const char *crv_name = (const char *)params->curve_name;
+	/* The comb is detached to get the ladder */
+	ec_shortw_crv *crv = (ec_shortw_crv *)&(params->ec_curve);
+	const word_t *table = crv->gen_comb_table;
+	u8 teeth = crv->gen_comb_teeth;
+	nn_src_t q = &(params->ec_gen_order);
+	prj_pt_src_t G = &(params->ec_gen);
+	nn in[BENCH_NUM_IN], b, m;
+	prj_pt R1, R2, ref;
+	u64 t1, t2;
+	unsigned int i;
+
+	if (table == NULL) {
+		ext_printf("[+] %12s no generator comb\n", crv_name);
+		return 0;
+	}
+
+	if (bench_random_inputs(in, BENCH_NUM_IN, q)) {
+		goto err;
+	}
+	prj_pt_init(&R1, crv);
+	prj_pt_init(&R2, crv);
+	prj_pt_init(&ref, crv);
+
+	for (i = 0; i < BENCH_NUM_IN; i++) {
+		prj_pt_mul_ltr_monty(&ref, &in[i], G);
+		prj_pt_mul_monty(&R1, &in[i], G);
+		if (nn_get_random_mod(&b, q)) {
+			goto err;
+		}
+		prj_pt_mul_monty_blind(&R2, &in[i], G, &b, q);
+		if (prj_pt_cmp(&R1, &ref) || prj_pt_cmp(&R2, &ref)) {
+			ext_printf("[-] %s: generator comb mismatch\n",
+				   crv_name);
+			goto err;
+		}
+		/* The same point from m + q */
+		nn_add(&m, &in[i], q);
+		prj_pt_mul_monty(&R1, &m, G);
+		if (prj_pt_cmp(&R1, &ref)) {
+			ext_printf("[-] %s: generator comb mismatch (m >= q)\n",
+				   crv_name);
+			goto err;
+		}
+	}
+
+	crv->gen_comb_table = NULL;
+	if (get_ms_time(&t1)) {
+		crv->gen_comb_table = table;
+		goto err;
+	}
+	for (i = 0; i < (BENCH_NUM_INV / 16); i++) {
+		nn_copy(&b, &in[(i + 1) % BENCH_NUM_IN]);
+		prj_pt_mul_monty_blind(&R1, &in[i % BENCH_NUM_IN], G, &b, q);
+	}
+	crv->gen_comb_table = table;
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print("mul_monty_blind (ladder)", crv_name, t1, t2,
+		    BENCH_NUM_INV / 16);
+
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < (BENCH_NUM_INV / 16); i++) {
+		nn_copy(&b, &in[(i + 1) % BENCH_NUM_IN]);
+		prj_pt_mul_monty_blind(&R2, &in[i % BENCH_NUM_IN], G, &b, q);
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	ext_printf("[+] %12s generator comb %u teeth\n", crv_name, teeth);
+	bench_print("mul_monty_blind (comb)", crv_name, t1, t2,
+		    BENCH_NUM_INV / 16);
+
+	if (get_ms_time(&t1)) {
+		goto err;
+	}
+	for (i = 0; i < (BENCH_NUM_INV / 16); i++) {
+		prj_pt_mul_monty(&R1, &in[i % BENCH_NUM_IN], G);
+	}
+	if (get_ms_time(&t2)) {
+		goto err;
+	}
+	bench_print("mul_monty (comb)", crv_name, t1, t2, BENCH_NUM_INV / 16);
+
+	if (prj_pt_cmp(&R1, &R2)) {
+		ext_printf("[-] %s: generator comb mismatch\n", crv_name);
+		goto err;
+	}
+
+	return 0;
+
+ err:
+	return -1;
+}
+
+/* Product routines on len words compared by the karatsuba benchmark */
+typedef void (*words_mul_op) (word_t *out, const word_t *in1,
+			      const word_t *in2, u8 len);
+
+static void sqr_basecase(word_t *out, const word_t *in1, const word_t *in2,
+			 u8 len)
+{
+	(void)in2;
+	nn_sqr_basecase_words(out, in1, len);
+}
+
+static void sqr_karatsuba(word_t *out, const word_t *in1, const word_t *in2,
+			  u8 len)
+{
+	(void)in2;
+	nn_sqr_karatsuba_words(out, in1, len);
+}
+
+/* Number of calls of op per second, num being rounded to an even count */
+static int bench_words_op(words_mul_op op, word_t *out, word_t *in,
+			  u8 len, unsigned int num, unsigned int *rate)
+{
+	u64 t1, t2;
+	unsigned int i;
+
+	if (get_ms_time(&t1)) {
+		return -1;
+	}
+	for (i = 0; i < num; i += 2) {
+		/* Chain the calls through the product */
+		op(out, in, in + len, len);
+		op(in, out, out + len, len);
+	}
+	if (get_ms_time(&t2)) {
+		return -1;
+	}
+	if (t2 == t1) {
+		t2 = t1 + 1;
+	}
+	*rate = (unsigned int)((num * (u64)1000) / (t2 - t1));
+
+	return 0;
+}
+
+/*
+ * Base case products against one Karatsuba step on top of them, for all the
+ * operand lengths from 2 words to half the maximum nn size. The
+ * crossover is the length from which Karatsuba stays faster, which is
+ * what NN_KARATSUBA_THRESHOLD and NN_KARATSUBA_SQR_THRESHOLD should be
+ * for the target (the default ones being reported for comparison). As
+ * this does not depend on the curve, it only runs once.
+ */
+static int bench_karatsuba(const ec_params *params)
+{
+	static int done = 0;
+	const char *names[2] = { "nn_mul", "nn_sqr" };
+	const words_mul_op base[2] = { nn_mul_basecase_words, sqr_basecase };
+	const words_mul_op kara[2] = { nn_mul_karatsuba_words, sqr_karatsuba };
+	const unsigned int thresholds[2] = { NN_KARATSUBA_THRESHOLD,
+		NN_KARATSUBA_SQR_THRESHOLD
+	};
+	word_t in[2 * NN_MAX_WORD_LEN], out1[2 * NN_MAX_WORD_LEN];
+	word_t out2[2 * NN_MAX_WORD_LEN];
+	unsigned int r1, r2, num, crossover, op;
+	u8 len, i;
+
+	(void)params;
+	if (done) {
+		return 0;
+	}
+	done = 1;
+
+	for (op = 0; op < 2; op++) {
+		crossover = 0;
+		for (len = 2; len <= (NN_MAX_WORD_LEN / 2); len++) {
+			/* Sanity check on random and all ones operands */
+			if (get_random((unsigned char *)in, sizeof(in))) {
+				goto err;
+			}
+			base[op](out1, in, in + len, len);
+			kara[op](out2, in, in + len, len);
+			for (i = 0; i < 2 * len; i++) {
+				in[i] = WORD_MAX;
+			}
+			base[op](out1 + (2 * len), in, in + len, len);
+			kara[op](out2 + (2 * len), in, in + len, len);
+			if (!are_equal(out1, out2, 4 * len * WORD_BYTES)) {
+				ext_printf("[-] %s Karatsuba mismatch on %u "
+					   "words\n", names[op], len);
+				goto err;
+			}
+
+			/* About the same time for each length */
+			num = (BENCH_NUM_OP * 16) / ((unsigned int)len * len);
+			if (bench_words_op(base[op], out1, in, len, num, &r1) ||
+			    bench_words_op(kara[op], out2, in, len, num, &r2)) {
+				goto err;
+			}
+			ext_printf("[+] %6s %2u words: base case %10u op/s, "
+				   "Karatsuba %10u op/s\n", names[op], len,
+				   r1, r2);
+			if (r2 <= r1) {
+				crossover = 0;
+			} else if (crossover == 0) {
+				crossover = len;
+			}
+		}
+		if (crossover != 0) {
+			ext_printf("[+] %6s Karatsuba crossover: %u words "
+				   "(threshold %u)\n", names[op], crossover,
+				   thresholds[op]);
+		} else {
+			ext_printf("[+] %6s Karatsuba crossover: none up to "
+				   "%u words (threshold %u)\n", names[op],
+				   NN_MAX_WORD_LEN / 2, thresholds[op]);
+		}
+	}
+
+	return 0;
+
+ err:
+	return -1;
+}
+
+static const bench_type bench_types[] = {
+	{
+	 .bench_name = "mul_redc1",
+	 .bench_help = "Montgomery multiplication vs generic CIOS",
+	 .bench = bench_mul_redc1,
+	 },
+	{
+	 .bench_name = "sqr_redc1",
+	 .bench_help = "Montgomery squaring vs generic CIOS",
+	 .bench = bench_sqr_redc1,
+	 },
+	{
+	 .bench_name = "redc1",
+	 .bench_help = "Montgomery reduction vs CIOS multiplication by one",
+	 .bench = bench_redc1,
+	 },
+	{
+	 .bench_name = "fp_mul",
+	 .bench_help = "fp_mul (fast reduction on NIST primes) vs division",
+	 .bench = bench_fp_mul,
+	 },
+	{
+	 .bench_name = "sqr",
+	 .bench_help = "nn_sqr and fp_sqr vs multiplication by itself",
+	 .bench = bench_sqr,
+	 },
+	{
+	 .bench_name = "fp_pow",
+	 .bench_help = "fixed and sliding window fp_pow vs square and multiply",
+	 .bench = bench_fp_pow,
+	 },
+	{
+	 .bench_name = "modinv",
+	 .bench_help = "safegcd modular inversion vs binary xgcd",
+	 .bench = bench_modinv,
+	 },
+	{
+	 .bench_name = "batch_inv",
+	 .bench_help = "Montgomery's trick batch inversion vs single inversions",
+	 .bench = bench_batch_inv,
+	 },
+	{
+	 .bench_name = "mul_mod",
+	 .bench_help = "multiplication modulo q with the cached context",
+	 .bench = bench_mul_mod,
+	 },
+	{
+	 .bench_name = "barrett",
+	 .bench_help = "Barrett reduction modulo q vs division",
+	 .bench = bench_barrett,
+	 },
+	{
+	 .bench_name = "pow_fixed",
+	 .bench_help = "addition chain inversion and square root vs fp_inv",
+	 .bench = bench_pow_fixed,
+	 },
+	{
+	 .bench_name = "lazy",
+	 .bench_help = "lazy reduction point formulas vs fully reduced ones",
+	 .bench = bench_lazy,
+	 },
+	{
+	 .bench_name = "modadd",
+	 .bench_help = "modular doubling, tripling and negation vs fp_add/fp_sub",
+	 .bench = bench_modadd,
+	 },
+	{
+	 .bench_name = "gen_table",
+	 .bench_help = "wNAF with the generator table vs computed odd multiples",
+	 .bench = bench_gen_table,
+	 },
+	{
+	 .bench_name = "gen_comb",
+	 .bench_help = "fixed base comb multiplications by G vs the ladder",
+	 .bench = bench_gen_comb,
+	 },
+	{
+	 .bench_name = "karatsuba",
+	 .bench_help = "Base case vs Karatsuba products, crossover length",
+	 .bench = bench_karatsuba,
+	 },
+};
+
+#define BENCH_TYPES_NUM (sizeof(bench_types) / sizeof(bench_type))
+
+static void print_help(const char *bad_arg)
+{
+	unsigned int j;
+
+	if (bad_arg != NULL) {
+		ext_printf("Argument %s is unknown. Possible args are:\n",
+			   bad_arg);
+	}
+	for (j = 0; j < BENCH_TYPES_NUM; j++) {
+		ext_printf("\t%20s:\t%s\n", bench_types[j].bench_name,
+			   bench_types[j].bench_help);
+	}
+	ext_printf("-------------------\n");
+	ext_printf("NOTE: you can filter curves with 'curve='\n");
+	ext_printf("\tExample: mul_redc1 curve=SECP256R1\n");
+}
+
+int main(int argc, char *argv[])
+{
+	unsigned int i, j, k;
+	unsigned char todo[BENCH_TYPES_NUM];
+	const char *curve = NULL;
+	int found_ops = 0;
+	ec_params params;
+
+	local_memset(todo, 0, sizeof(todo));
+	for (i = 1; i < (unsigned int)argc; i++) {
+		if (are_equal(argv[i], "curve=", sizeof("curve=") - 1)) {
+			curve = argv[i] + sizeof("curve=") - 1;
+			continue;
+		}
+		for (j = 0; j < BENCH_TYPES_NUM; j++) {
+			if (are_str_equal(argv[i], bench_types[j].bench_name)) {
+				todo[j] = 1;
+				found_ops = 1;
+				break;
+			}
+		}
+		if (j == BENCH_TYPES_NUM) {
+			print_help(argv[i]);
+			return -1;
+		}
+	}
+	/* By default, perform all benchmarks */
+	if (!found_ops) {
+		local_memset(todo, 1, sizeof(todo));
+	}
+
+	ext_printf("======= Arithmetic benchmarks ===================\n");
+	for (k = 0; k < EC_CURVES_NUM; k++) {
+		if ((curve != NULL) &&
+		    !are_str_equal((const char *)ec_maps[k].params->name->buf,
+				   curve)) {
+			continue;
+		}
+		import_params(&params, ec_maps[k].params);
+		for (j = 0; j < BENCH_TYPES_NUM; j++) {
+			if (todo[j] && bench_types[j].bench(&params)) {
+				return -1;
+			}
+		}
+	}
+
+	return 0;
+}
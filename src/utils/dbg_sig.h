@@ -29,6 +29,9 @@
 #define dbg_nn_print(msg, ...) do {\
 	nn_print(EC_SIG_ALG " " msg, __VA_ARGS__);\
 } while(0);
+#define dbg_fp_print(msg, ...) do {\
+	fp_print(EC_SIG_ALG " " msg, __VA_ARGS__);\
+} while(0);
 #define dbg_ec_point_print(msg, ...) do {\
 	ec_point_print(EC_SIG_ALG " " msg, __VA_ARGS__);\
 } while(0);
@@ -43,6 +46,7 @@
 
 #define dbg_buf_print(msg, ...)
 #define dbg_nn_print(msg, ...)
+#define dbg_fp_print(msg, ...)
 #define dbg_ec_point_print(msg, ...)
 #define dbg_priv_key_print(msg, ...)
 #define dbg_pub_key_print(msg, ...)
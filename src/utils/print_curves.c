@@ -25,7 +25,7 @@ void ec_point_print(const char *msg, prj_pt_src_t prj_pt)
 
 	prj_pt_to_aff(&y_aff, prj_pt);
 	ext_printf("%s", msg);
-	nn_print("x", &(y_aff.x.fp_val));
+	fp_print("x", &(y_aff.x));
 	ext_printf("%s", msg);
-	nn_print("y", &(y_aff.y.fp_val));
+	fp_print("y", &(y_aff.y));
 }
@@ -31,9 +31,11 @@ void fp_ctx_print(const char *msg, fp_ctx_src_t ctx)
 /* Print the value of an Fp element */
 void fp_print(const char *msg, fp_src_t a)
 {
-	fp_check_initialized(a);
+	nn tmp;
 
-	nn_print(msg, &(a->fp_val));
+	fp_get_nn(&tmp, a);
+	nn_print(msg, &tmp);
+	nn_uninit(&tmp);
 }
 
 /* Print the value and Fp context of an Fp element */
@@ -42,6 +44,6 @@ void fp_print_all(const char *msg, fp_src_t a)
 	fp_check_initialized(a);
 
 	ext_printf("%s:\n", msg);
-	nn_print("\t fp_val", &(a->fp_val));
+	fp_print("\t fp_val", a);
 	fp_ctx_print("", a->ctx);
 }